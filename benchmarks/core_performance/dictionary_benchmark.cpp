@@ -0,0 +1,207 @@
+/**
+ * @file dictionary_benchmark.cpp
+ * @brief Per-element dictionary lookup and decode cost benchmark
+ *
+ * Measures nanoseconds per data element for:
+ * - the previous dictionary design (unordered_map behind a shared_mutex,
+ *   returning a copy), rebuilt here from the current registry as baseline
+ * - dicom_dictionary::find (perfect hash, returns a copy)
+ * - dicom_dictionary::lookup (perfect hash, returns a pointer)
+ * - implicit_vr_codec::decode of a header-sized dataset, per element
+ *
+ * Each lookup is measured on one thread and on all hardware threads, since
+ * the shared_mutex reader count is a single contended cache line while the
+ * perfect hash tables are read-only.
+ *
+ * Usage: dictionary_benchmark [lookups_per_thread] [threads]
+ */
+
+#include "kcenon/pacs/core/dicom_dataset.h"
+#include "kcenon/pacs/core/dicom_dictionary.h"
+#include "kcenon/pacs/encoding/implicit_vr_codec.h"
+#include "kcenon/pacs/encoding/vr_type.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace kcenon::pacs::core;
+using namespace kcenon::pacs::encoding;
+
+namespace {
+
+// =============================================================================
+// Baseline: the dictionary as it was before the perfect hash tables
+// =============================================================================
+
+class locked_map_dictionary {
+public:
+    explicit locked_map_dictionary(const std::vector<tag_info>& tags) {
+        tag_map_.reserve(tags.size());
+        for (const auto& info : tags) {
+            tag_map_.emplace(info.tag, info);
+        }
+    }
+
+    [[nodiscard]] auto find(dicom_tag tag) const -> std::optional<tag_info> {
+        std::shared_lock lock(mutex_);
+        const auto it = tag_map_.find(tag);
+        if (it != tag_map_.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+private:
+    std::unordered_map<dicom_tag, tag_info> tag_map_;
+    mutable std::shared_mutex mutex_;
+};
+
+// =============================================================================
+// Workload
+// =============================================================================
+
+auto all_standard_tags() -> std::vector<tag_info> {
+    std::vector<tag_info> tags;
+    const auto& dict = dicom_dictionary::instance();
+    for (uint32_t group = 0; group <= 0xFFFF; group += 2) {
+        auto in_group = dict.get_tags_in_group(static_cast<uint16_t>(group));
+        tags.insert(tags.end(), in_group.begin(), in_group.end());
+    }
+    return tags;
+}
+
+/// Header-sized dataset: current string and US attributes of common groups
+auto make_header(const std::vector<tag_info>& tags) -> dicom_dataset {
+    dicom_dataset dataset;
+    for (const auto& info : tags) {
+        const auto group = info.tag.group();
+        if (info.retired || (group != 0x0008 && group != 0x0010 && group != 0x0018 &&
+                             group != 0x0020 && group != 0x0028)) {
+            continue;
+        }
+        const auto vr = static_cast<vr_type>(info.vr);
+        if (vr == vr_type::US) {
+            dataset.set_numeric<uint16_t>(info.tag, vr, 1);
+        } else if (is_string_vr(vr) && vr != vr_type::UR && vr != vr_type::UT) {
+            dataset.set_string(info.tag, vr, "12");
+        }
+        if (dataset.size() >= 250) {
+            break;
+        }
+    }
+    return dataset;
+}
+
+/// Sum of lookup results, so the optimizer cannot drop the lookups
+std::atomic<std::uint64_t> checksum{0};
+
+/**
+ * @brief Run lookup(i) lookups_per_thread times on each thread
+ * @return Nanoseconds per lookup, as seen by the slowest thread
+ */
+template <typename Lookup>
+auto measure(std::size_t threads, std::size_t lookups_per_thread, Lookup lookup) -> double {
+    std::vector<std::thread> workers;
+    std::vector<double> per_thread(threads, 0.0);
+    workers.reserve(threads);
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            std::uint64_t sum = 0;
+            const auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < lookups_per_thread; ++i) {
+                sum += lookup(t * 7919 + i);
+            }
+            const auto elapsed = std::chrono::duration<double, std::nano>(
+                std::chrono::steady_clock::now() - start);
+            per_thread[t] = elapsed.count() / static_cast<double>(lookups_per_thread);
+            checksum.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return *std::max_element(per_thread.begin(), per_thread.end());
+}
+
+void report(const std::string& name, std::size_t threads, double ns_per_element) {
+    std::cout << std::left << std::setw(44) << name << std::right << std::setw(4)
+              << threads << " threads  " << std::fixed << std::setprecision(1)
+              << std::setw(8) << ns_per_element << " ns/element\n";
+}
+
+}  // namespace
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char** argv) {
+    const size_t lookups = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 5'000'000;
+    size_t threads = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 0;
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    const auto& dict = dicom_dictionary::instance();
+    const auto tags = all_standard_tags();
+    const auto header = make_header(tags);
+
+    // Lookups follow the element order of a real header
+    std::vector<dicom_tag> stream;
+    for (const auto& [tag, element] : header) {
+        stream.push_back(tag);
+    }
+    const auto element_tag = [&](std::uint64_t i) { return stream[i % stream.size()]; };
+
+    std::cout << "======================================\n";
+    std::cout << "  DICOM Dictionary Benchmark\n";
+    std::cout << "======================================\n";
+    std::cout << "Lookups per thread: " << lookups << "\n";
+    std::cout << "Dictionary entries: " << dict.standard_tag_count() << "\n";
+    std::cout << "Header elements:    " << stream.size() << "\n\n";
+
+    const locked_map_dictionary baseline(tags);
+
+    for (const auto count : {std::size_t{1}, threads}) {
+        report("before: shared_mutex + unordered_map", count,
+               measure(count, lookups, [&](std::uint64_t i) -> std::uint64_t {
+                   const auto info = baseline.find(element_tag(i));
+                   return info ? info->vr : 0;
+               }));
+        report("after:  dicom_dictionary::find", count,
+               measure(count, lookups, [&](std::uint64_t i) -> std::uint64_t {
+                   const auto info = dict.find(element_tag(i));
+                   return info ? info->vr : 0;
+               }));
+        report("after:  dicom_dictionary::lookup", count,
+               measure(count, lookups, [&](std::uint64_t i) -> std::uint64_t {
+                   const auto* info = dict.lookup(element_tag(i));
+                   return info != nullptr ? info->vr : 0;
+               }));
+    }
+
+    // Whole decode, so the lookup share of per-element cost is visible
+    const auto encoded = implicit_vr_codec::encode(header);
+    const auto decodes = std::max<std::size_t>(1, lookups / stream.size() / 10);
+    for (const auto count : {std::size_t{1}, threads}) {
+        const auto ns_per_decode = measure(count, decodes, [&](std::uint64_t) -> std::uint64_t {
+            auto decoded = implicit_vr_codec::decode(encoded);
+            return decoded.is_ok() ? decoded.value().size() : 0;
+        });
+        report("implicit_vr_codec::decode", count,
+               ns_per_decode / static_cast<double>(stream.size()));
+    }
+
+    return checksum.load() == 0 ? 1 : 0;
+}
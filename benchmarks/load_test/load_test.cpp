@@ -0,0 +1,1056 @@
+/**
+ * @file load_test.cpp
+ * @brief End-to-end load test of a running PACS server
+ *
+ * Replays a mix of C-STORE, C-FIND, C-MOVE, QIDO-RS and WADO-RS traffic
+ * against a server over many concurrent associations and reports
+ * throughput and latency percentiles per operation as JSON, so a release
+ * can be gated on regressions against a previous report.
+ *
+ * Stored instances come from the synthetic workload generator (CT, MR, DX,
+ * US cine and WSI shapes, native or RLE). Queries and retrievals target
+ * studies stored earlier in the run; a seed phase stores a few studies
+ * before measuring so they have something to find.
+ *
+ * With --rate the load is open loop: operation i is due at start + i/rate
+ * and its latency is measured from that due time, so a server falling
+ * behind shows up as latency instead of as a silently lower rate. Without
+ * --rate every association issues its next operation as soon as the last
+ * one completes.
+ *
+ * Usage: load_test <host> <port> <called_ae> [options]   (see --help)
+ */
+
+#include "web_client.h"
+#include "workload_generator.h"
+
+#include "kcenon/pacs/core/dicom_dataset.h"
+#include "kcenon/pacs/core/dicom_tag_constants.h"
+#include "kcenon/pacs/encoding/dataset_encoder.h"
+#include "kcenon/pacs/encoding/transfer_syntax.h"
+#include "kcenon/pacs/monitoring/latency_histogram.h"
+#include "kcenon/pacs/network/association.h"
+#include "kcenon/pacs/network/dicom_server.h"
+#include "kcenon/pacs/network/server_config.h"
+#include "kcenon/pacs/services/query_scp.h"
+#include "kcenon/pacs/services/query_scu.h"
+#include "kcenon/pacs/services/retrieve_scp.h"
+#include "kcenon/pacs/services/retrieve_scu.h"
+#include "kcenon/pacs/services/storage_scp.h"
+#include "kcenon/pacs/services/storage_scu.h"
+#include "kcenon/pacs/services/verification_scp.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kcenon::pacs;
+using namespace kcenon::pacs::benchmark;
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+// =============================================================================
+// Operations
+// =============================================================================
+
+enum class operation { c_store, c_find, c_move, qido, wado };
+
+constexpr std::size_t operation_count = 5;
+
+constexpr std::array<operation, operation_count> all_operations = {
+    operation::c_store, operation::c_find, operation::c_move, operation::qido,
+    operation::wado};
+
+/// Operation name in the mix option and the report
+constexpr auto to_string(operation op) noexcept -> std::string_view {
+    switch (op) {
+        case operation::c_store: return "store";
+        case operation::c_find: return "find";
+        case operation::c_move: return "move";
+        case operation::qido: return "qido";
+        case operation::wado: return "wado";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Counters and latency distribution of one operation
+ */
+struct operation_stats {
+    monitoring::latency_histogram latency;
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> errors{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> items{0};
+
+    std::mutex error_mutex;
+    std::string first_error;
+
+    void record_error(const std::string& message) {
+        ++errors;
+        std::lock_guard lock(error_mutex);
+        if (first_error.empty()) {
+            first_error = message;
+        }
+    }
+};
+
+// =============================================================================
+// Options
+// =============================================================================
+
+struct options {
+    std::string host;
+    uint16_t port{0};
+    std::string called_ae;
+    std::string calling_ae{"LOAD_SCU"};
+
+    /// Target operations per second across all associations (0 = closed loop)
+    double rate{0.0};
+    std::size_t associations{8};
+    std::chrono::seconds duration{60};
+    std::array<double, operation_count> mix{60, 20, 5, 10, 5};
+
+    workload_config workload;
+    std::size_t seed_studies{4};
+    uint64_t seed{1};
+
+    std::string move_destination;
+    uint16_t sink_port{0};
+
+    uint16_t web_port{0};
+    std::string web_prefix{"/dicomweb"};
+
+    std::chrono::milliseconds timeout{30000};
+    std::string report_path;
+    double max_error_rate{-1.0};
+};
+
+void print_usage(const char* program_name) {
+    std::cout << R"(
+PACS Load Test - Synthetic DICOM traffic against a running server
+
+Usage: )" << program_name << R"( <host> <port> <called_ae> [options]
+
+Traffic:
+  --rate <ops/s>          Target operations per second, all associations (default: unpaced)
+  --associations <n>      Concurrent associations / clients (default: 8)
+  --duration <seconds>    Measured run time (default: 60)
+  --mix <op=w,...>        Operation weights: store, find, move, qido, wado
+                          (default: store=60,find=20,move=5,qido=10,wado=5)
+
+Workload:
+  --shapes <shape=w,...>  Study shape weights: ct, mr, dx, us, wsi
+                          (default: ct=40,mr=25,dx=20,us=10,wsi=5)
+  --compressed <0..1>     Fraction of studies sent RLE Lossless (default: 0.5)
+  --study-scale <x>       Multiplier on instances per series (default: 1.0)
+  --patients <n>          Distinct patients (default: 500)
+  --seed-studies <n>      Studies stored before measuring (default: 4)
+  --seed <n>              Random seed (default: 1)
+
+Retrieval:
+  --move-dest <ae>        C-MOVE destination AE (required for move)
+  --sink-port <port>      Run a storage SCP for the move destination on this port;
+                          the server must map --move-dest to this host and port
+  --web-port <port>       DICOMweb port (required for qido and wado)
+  --web-prefix <path>     DICOMweb base path (default: /dicomweb)
+
+Output:
+  --calling-ae <ae>       Calling AE Title (default: LOAD_SCU)
+  --timeout <ms>          Per-operation timeout (default: 30000)
+  --report <file>         Write the JSON report to a file (default: stdout)
+  --max-error-rate <r>    Exit with status 2 when errors / operations exceed r
+  --help, -h              Show this help message
+
+Example:
+  )" << program_name << R"( localhost 11112 PACS_SCP --rate 200 --associations 32 \
+      --duration 300 --move-dest LOAD_SINK --sink-port 11113 --web-port 8080 \
+      --report load.json --max-error-rate 0.001
+)";
+}
+
+/// Parse "name=weight,name=weight" into weights indexed by parse_name()
+template <std::size_t N, typename Parse>
+auto parse_weights(const std::string& text, std::array<double, N>& weights, Parse parse_name)
+    -> bool {
+    std::array<double, N> parsed{};
+    std::istringstream stream(text);
+    std::string entry;
+    while (std::getline(stream, entry, ',')) {
+        const auto eq = entry.find('=');
+        if (eq == std::string::npos) {
+            return false;
+        }
+        const auto index = parse_name(entry.substr(0, eq));
+        if (!index) {
+            return false;
+        }
+        try {
+            parsed[*index] = std::stod(entry.substr(eq + 1));
+        } catch (...) {
+            return false;
+        }
+        if (parsed[*index] < 0.0) {
+            return false;
+        }
+    }
+    weights = parsed;
+    return true;
+}
+
+auto parse_operation(const std::string& name) -> std::optional<std::size_t> {
+    for (std::size_t i = 0; i < operation_count; ++i) {
+        if (to_string(all_operations[i]) == name) {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+auto parse_shape(const std::string& name) -> std::optional<std::size_t> {
+    if (auto shape = parse_study_shape(name)) {
+        return static_cast<std::size_t>(*shape);
+    }
+    return std::nullopt;
+}
+
+auto parse_arguments(int argc, char* argv[], options& opts) -> bool {
+    if (argc < 4) {
+        return false;
+    }
+    opts.host = argv[1];
+    opts.called_ae = argv[3];
+
+    try {
+        const int port = std::stoi(argv[2]);
+        if (port < 1 || port > 65535) {
+            std::cerr << "Error: Port must be between 1 and 65535\n";
+            return false;
+        }
+        opts.port = static_cast<uint16_t>(port);
+
+        for (int i = 4; i < argc; ++i) {
+            const std::string arg = argv[i];
+            const bool has_value = i + 1 < argc;
+            auto port_value = [&](uint16_t& out) {
+                const int value = std::stoi(argv[++i]);
+                if (value < 1 || value > 65535) {
+                    throw std::out_of_range("port");
+                }
+                out = static_cast<uint16_t>(value);
+            };
+
+            if (arg == "--help" || arg == "-h") {
+                return false;
+            } else if (arg == "--rate" && has_value) {
+                opts.rate = std::max(0.0, std::stod(argv[++i]));
+            } else if (arg == "--associations" && has_value) {
+                opts.associations = std::max(1, std::stoi(argv[++i]));
+            } else if (arg == "--duration" && has_value) {
+                opts.duration = std::chrono::seconds{std::max(1, std::stoi(argv[++i]))};
+            } else if (arg == "--mix" && has_value) {
+                if (!parse_weights(argv[++i], opts.mix, parse_operation)) {
+                    std::cerr << "Error: Invalid --mix '" << argv[i] << "'\n";
+                    return false;
+                }
+            } else if (arg == "--shapes" && has_value) {
+                if (!parse_weights(argv[++i], opts.workload.shape_weights, parse_shape)) {
+                    std::cerr << "Error: Invalid --shapes '" << argv[i] << "'\n";
+                    return false;
+                }
+            } else if (arg == "--compressed" && has_value) {
+                opts.workload.compressed_ratio = std::stod(argv[++i]);
+            } else if (arg == "--study-scale" && has_value) {
+                opts.workload.study_scale = std::max(0.0, std::stod(argv[++i]));
+            } else if (arg == "--patients" && has_value) {
+                opts.workload.patients = std::max(1, std::stoi(argv[++i]));
+            } else if (arg == "--seed-studies" && has_value) {
+                opts.seed_studies = std::max(0, std::stoi(argv[++i]));
+            } else if (arg == "--seed" && has_value) {
+                opts.seed = std::stoull(argv[++i]);
+            } else if (arg == "--move-dest" && has_value) {
+                opts.move_destination = argv[++i];
+            } else if (arg == "--sink-port" && has_value) {
+                port_value(opts.sink_port);
+            } else if (arg == "--web-port" && has_value) {
+                port_value(opts.web_port);
+            } else if (arg == "--web-prefix" && has_value) {
+                opts.web_prefix = argv[++i];
+            } else if (arg == "--calling-ae" && has_value) {
+                opts.calling_ae = argv[++i];
+            } else if (arg == "--timeout" && has_value) {
+                opts.timeout = std::chrono::milliseconds{std::max(1, std::stoi(argv[++i]))};
+            } else if (arg == "--report" && has_value) {
+                opts.report_path = argv[++i];
+            } else if (arg == "--max-error-rate" && has_value) {
+                opts.max_error_rate = std::stod(argv[++i]);
+            } else {
+                std::cerr << "Error: Unknown option '" << arg << "'\n";
+                return false;
+            }
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Error: Invalid option value\n";
+        return false;
+    }
+
+    if (opts.mix[static_cast<std::size_t>(operation::c_move)] > 0.0 &&
+        opts.move_destination.empty()) {
+        std::cerr << "Error: move traffic requires --move-dest\n";
+        return false;
+    }
+    if ((opts.mix[static_cast<std::size_t>(operation::qido)] > 0.0 ||
+         opts.mix[static_cast<std::size_t>(operation::wado)] > 0.0) &&
+        opts.web_port == 0) {
+        std::cerr << "Error: qido and wado traffic require --web-port "
+                     "(or set their weight to 0 with --mix)\n";
+        return false;
+    }
+    auto positive = [](const auto& weights) {
+        return std::any_of(weights.begin(), weights.end(), [](double w) { return w > 0.0; });
+    };
+    if (!positive(opts.mix) || !positive(opts.workload.shape_weights)) {
+        std::cerr << "Error: --mix and --shapes need at least one positive weight\n";
+        return false;
+    }
+    return true;
+}
+
+// =============================================================================
+// Stored Instance Registry
+// =============================================================================
+
+struct stored_instance {
+    std::string patient_id;
+    std::string study_uid;
+    std::string series_uid;
+    std::string sop_uid;
+};
+
+/**
+ * @brief Instances stored so far, the targets of queries and retrievals
+ *
+ * Keeps the most recent entries in a ring so memory stays bounded on long
+ * runs.
+ */
+class instance_registry {
+public:
+    static constexpr std::size_t capacity = 20000;
+
+    void add(stored_instance instance) {
+        std::lock_guard lock(mutex_);
+        if (entries_.size() < capacity) {
+            entries_.push_back(std::move(instance));
+        } else {
+            entries_[next_++ % capacity] = std::move(instance);
+        }
+    }
+
+    [[nodiscard]] auto pick(std::mt19937_64& rng) -> std::optional<stored_instance> {
+        std::lock_guard lock(mutex_);
+        if (entries_.empty()) {
+            return std::nullopt;
+        }
+        return entries_[rng() % entries_.size()];
+    }
+
+    [[nodiscard]] auto size() -> std::size_t {
+        std::lock_guard lock(mutex_);
+        return entries_.size();
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<stored_instance> entries_;
+    std::size_t next_{0};
+};
+
+// =============================================================================
+// Association Setup
+// =============================================================================
+
+constexpr const char* implementation_class_uid = "1.2.826.0.1.3680043.9.8888.50.1";
+
+enum class channel { store_native, store_rle, find, move };
+
+auto make_association_config(const options& opts, channel kind) -> network::association_config {
+    network::association_config config;
+    config.calling_ae_title = opts.calling_ae;
+    config.called_ae_title = opts.called_ae;
+    config.implementation_class_uid = implementation_class_uid;
+    config.implementation_version_name = "LOAD_TEST";
+
+    const std::string explicit_le(encoding::transfer_syntax::explicit_vr_little_endian.uid());
+    const std::string implicit_le(encoding::transfer_syntax::implicit_vr_little_endian.uid());
+
+    switch (kind) {
+        case channel::store_native:
+        case channel::store_rle: {
+            uint8_t id = 1;
+            for (auto shape : all_study_shapes) {
+                std::vector<std::string> syntaxes;
+                if (kind == channel::store_rle) {
+                    syntaxes = {std::string(encoding::transfer_syntax::rle_lossless.uid())};
+                } else {
+                    syntaxes = {explicit_le, implicit_le};
+                }
+                config.proposed_contexts.push_back(
+                    {id, std::string(default_profile(shape).sop_class_uid), syntaxes});
+                id += 2;
+            }
+            break;
+        }
+        case channel::find:
+            config.proposed_contexts.push_back(
+                {1, std::string(services::study_root_find_sop_class_uid),
+                 {explicit_le, implicit_le}});
+            break;
+        case channel::move:
+            config.proposed_contexts.push_back(
+                {1, std::string(services::study_root_move_sop_class_uid),
+                 {explicit_le, implicit_le}});
+            break;
+    }
+    return config;
+}
+
+// =============================================================================
+// Client
+// =============================================================================
+
+/// What an operation did, filled in by client::execute()
+struct outcome {
+    bool ok{false};
+    uint64_t bytes{0};
+    uint64_t items{0};
+    std::string error;
+};
+
+/**
+ * @brief One simulated client holding its associations open across operations
+ *
+ * Associations are opened on first use and kept; one that fails is aborted
+ * and reopened by the next operation needing it, as a modality would.
+ */
+class client {
+public:
+    client(const options& opts, workload_generator& generator, instance_registry& registry,
+           uint64_t seed)
+        : opts_(opts),
+          generator_(generator),
+          registry_(registry),
+          rng_(seed),
+          storage_([&] {
+              services::storage_scu_config config;
+              config.response_timeout = opts.timeout;
+              return config;
+          }()),
+          query_([&] {
+              services::query_scu_config config;
+              config.timeout = opts.timeout;
+              config.max_results = 100;
+              return config;
+          }()),
+          retrieve_([&] {
+              services::retrieve_scu_config config;
+              config.mode = services::retrieve_mode::c_move;
+              config.move_destination = opts.move_destination;
+              config.timeout = opts.timeout * 4;
+              return config;
+          }()) {}
+
+    ~client() { release_all(); }
+
+    client(const client&) = delete;
+    client& operator=(const client&) = delete;
+
+    [[nodiscard]] auto rng() -> std::mt19937_64& { return rng_; }
+
+    /// Store every instance of a fresh study; false on the first failure
+    auto seed_study() -> bool {
+        auto study = generator_.next_study(rng_);
+        for (std::size_t i = 0; i < study.instance_count(); ++i) {
+            auto result = store(study, generator_.instance(study, i));
+            if (!result.ok) {
+                std::cerr << "Seed store failed: " << result.error << "\n";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Work done before an operation is due, outside its measured latency
+    void prepare(operation op) {
+        if (op != operation::c_store) {
+            target_ = registry_.pick(rng_);
+            return;
+        }
+        if (!study_ || next_instance_ >= study_->instance_count()) {
+            study_ = generator_.next_study(rng_);
+            next_instance_ = 0;
+        }
+        pending_ = generator_.instance(*study_, next_instance_++);
+    }
+
+    auto execute(operation op) -> outcome {
+        switch (op) {
+            case operation::c_store:
+                return store(*study_, std::move(*pending_));
+            case operation::c_find:
+                return find();
+            case operation::c_move:
+                return move();
+            case operation::qido:
+                return qido();
+            case operation::wado:
+                return wado();
+        }
+        return {};
+    }
+
+    void release_all() {
+        for (auto& assoc : associations_) {
+            if (assoc && assoc->is_established()) {
+                (void)assoc->release(std::chrono::milliseconds{2000});
+            }
+            assoc.reset();
+        }
+    }
+
+private:
+    auto connection(channel kind) -> network::association* {
+        auto& slot = associations_[static_cast<std::size_t>(kind)];
+        if (slot && !slot->is_established()) {
+            slot.reset();
+        }
+        if (!slot) {
+            auto result = network::association::connect(
+                opts_.host, opts_.port, make_association_config(opts_, kind), opts_.timeout);
+            if (result.is_err()) {
+                last_connect_error_ = result.error().message;
+                return nullptr;
+            }
+            slot.emplace(std::move(result.value()));
+        }
+        return &*slot;
+    }
+
+    void drop(channel kind) {
+        auto& slot = associations_[static_cast<std::size_t>(kind)];
+        if (slot) {
+            slot->abort();
+            slot.reset();
+        }
+    }
+
+    auto store(const synthetic_study& study, core::dicom_dataset dataset) -> outcome {
+        outcome out;
+        const auto kind = study.compressed ? channel::store_rle : channel::store_native;
+        auto* assoc = connection(kind);
+        if (assoc == nullptr) {
+            out.error = "association: " + last_connect_error_;
+            return out;
+        }
+
+        out.bytes = encoder_.encoded_size(dataset);
+        auto result = storage_.store(*assoc, dataset);
+        if (result.is_err()) {
+            out.error = result.error().message;
+            drop(kind);
+            return out;
+        }
+        if (!result.value().is_success() && !result.value().is_warning()) {
+            std::ostringstream status;
+            status << "C-STORE status 0x" << std::hex << result.value().status;
+            out.error = status.str();
+            return out;
+        }
+
+        out.ok = true;
+        out.items = 1;
+        registry_.add({study.patient_id, study.study_uid,
+                       dataset.get_string(core::tags::series_instance_uid),
+                       dataset.get_string(core::tags::sop_instance_uid)});
+        return out;
+    }
+
+    auto find() -> outcome {
+        outcome out;
+        if (!target_) {
+            out.error = "no stored instances to query";
+            return out;
+        }
+        auto* assoc = connection(channel::find);
+        if (assoc == nullptr) {
+            out.error = "association: " + last_connect_error_;
+            return out;
+        }
+
+        services::study_query_keys keys;
+        keys.patient_id = target_->patient_id;
+        auto result = query_.find_studies(*assoc, keys);
+        if (result.is_err()) {
+            out.error = result.error().message;
+            drop(channel::find);
+            return out;
+        }
+        out.items = result.value().matches.size();
+        out.ok = result.value().is_success() && out.items > 0;
+        if (!out.ok) {
+            out.error = result.value().is_success() ? "C-FIND returned no matches"
+                                                    : "C-FIND failed";
+        }
+        return out;
+    }
+
+    auto move() -> outcome {
+        outcome out;
+        if (!target_) {
+            out.error = "no stored instances to retrieve";
+            return out;
+        }
+        auto* assoc = connection(channel::move);
+        if (assoc == nullptr) {
+            out.error = "association: " + last_connect_error_;
+            return out;
+        }
+
+        auto result = retrieve_.retrieve_study(*assoc, target_->study_uid);
+        if (result.is_err()) {
+            out.error = result.error().message;
+            drop(channel::move);
+            return out;
+        }
+        out.items = result.value().completed;
+        out.ok = result.value().is_success();
+        if (!out.ok) {
+            out.error = "C-MOVE failed sub-operations: " +
+                        std::to_string(result.value().failed);
+        }
+        return out;
+    }
+
+    auto qido() -> outcome {
+        if (!target_) {
+            return {false, 0, 0, "no stored instances to query"};
+        }
+        return web(opts_.web_prefix + "/studies?PatientID=" + url_encode(target_->patient_id) +
+                       "&limit=100",
+                   "application/dicom+json");
+    }
+
+    auto wado() -> outcome {
+        if (!target_) {
+            return {false, 0, 0, "no stored instances to retrieve"};
+        }
+        return web(opts_.web_prefix + "/studies/" + target_->study_uid + "/series/" +
+                       target_->series_uid + "/instances/" + target_->sop_uid,
+                   "multipart/related; type=\"application/dicom\"");
+    }
+
+    auto web(const std::string& target, const std::string& accept) -> outcome {
+        outcome out;
+        auto response = http_get(opts_.host, opts_.web_port, target, accept, opts_.timeout);
+        out.bytes = response.body_bytes;
+        out.ok = response.is_success();
+        if (out.ok) {
+            out.items = 1;
+        } else {
+            out.error = response.error.empty()
+                            ? "HTTP status " + std::to_string(response.status)
+                            : response.error;
+        }
+        return out;
+    }
+
+    const options& opts_;
+    workload_generator& generator_;
+    instance_registry& registry_;
+    std::mt19937_64 rng_;
+
+    services::storage_scu storage_;
+    services::query_scu query_;
+    services::retrieve_scu retrieve_;
+    encoding::dataset_encoder encoder_{encoding::transfer_syntax::explicit_vr_little_endian};
+
+    std::array<std::optional<network::association>, 4> associations_;
+    std::string last_connect_error_;
+
+    std::optional<synthetic_study> study_;
+    std::size_t next_instance_{0};
+    std::optional<core::dicom_dataset> pending_;
+    std::optional<stored_instance> target_;
+};
+
+// =============================================================================
+// Move Destination
+// =============================================================================
+
+/**
+ * @brief Storage SCP receiving the instances C-MOVE sends to --move-dest
+ */
+class move_sink {
+public:
+    move_sink(const std::string& ae_title, uint16_t port) {
+        network::server_config config;
+        config.ae_title = ae_title;
+        config.port = port;
+        config.max_associations = 256;
+        config.idle_timeout = std::chrono::seconds{60};
+        config.implementation_class_uid = implementation_class_uid;
+        config.implementation_version_name = "LOAD_SINK";
+
+        server_ = std::make_unique<network::dicom_server>(config);
+        server_->register_service(std::make_shared<services::verification_scp>());
+        auto storage = std::make_shared<services::storage_scp>();
+        storage->set_handler([this](const core::dicom_dataset&, const std::string&,
+                                    const std::string&, const std::string&) {
+            ++received_;
+            return services::storage_status::success;
+        });
+        server_->register_service(storage);
+    }
+
+    auto start() -> bool { return server_->start().is_ok(); }
+    void stop() { server_->stop(); }
+    [[nodiscard]] auto received() const -> uint64_t { return received_.load(); }
+
+private:
+    std::unique_ptr<network::dicom_server> server_;
+    std::atomic<uint64_t> received_{0};
+};
+
+// =============================================================================
+// Report
+// =============================================================================
+
+auto json_escape(const std::string& text) -> std::string {
+    std::string escaped;
+    for (char c : text) {
+        switch (c) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\r': escaped += "\\r"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    escaped += ' ';
+                } else {
+                    escaped += c;
+                }
+        }
+    }
+    return escaped;
+}
+
+auto to_ms(double ns) -> double {
+    return ns / 1e6;
+}
+
+struct run_summary {
+    double elapsed_seconds{0.0};
+    uint64_t operations{0};
+    uint64_t errors{0};
+    uint64_t sink_received{0};
+    bool sink{false};
+
+    [[nodiscard]] auto error_rate() const -> double {
+        return operations == 0 ? 0.0
+                               : static_cast<double>(errors) / static_cast<double>(operations);
+    }
+};
+
+auto build_report(const options& opts, workload_generator& generator,
+                  std::array<operation_stats, operation_count>& stats,
+                  const run_summary& summary) -> std::string {
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\n";
+    json << "  \"tool\": \"pacs_load_test\",\n";
+    json << "  \"target\": {\"host\": \"" << json_escape(opts.host)
+         << "\", \"port\": " << opts.port << ", \"called_ae\": \""
+         << json_escape(opts.called_ae) << "\", \"web_port\": " << opts.web_port << "},\n";
+
+    json << "  \"config\": {\n";
+    json << "    \"rate_per_second\": " << opts.rate << ",\n";
+    json << "    \"associations\": " << opts.associations << ",\n";
+    json << "    \"duration_seconds\": " << opts.duration.count() << ",\n";
+    json << "    \"compressed_ratio\": " << generator.config().compressed_ratio << ",\n";
+    json << "    \"study_scale\": " << generator.config().study_scale << ",\n";
+    json << "    \"seed\": " << opts.seed << ",\n";
+    json << "    \"mix\": {";
+    for (std::size_t i = 0; i < operation_count; ++i) {
+        json << (i ? ", " : "") << "\"" << to_string(all_operations[i]) << "\": " << opts.mix[i];
+    }
+    json << "},\n";
+    json << "    \"shapes\": {";
+    for (std::size_t i = 0; i < study_shape_count; ++i) {
+        json << (i ? ", " : "") << "\"" << to_string(all_study_shapes[i])
+             << "\": " << generator.config().shape_weights[i];
+    }
+    json << "}\n  },\n";
+
+    json << "  \"workload\": {";
+    bool first = true;
+    for (std::size_t i = 0; i < study_shape_count; ++i) {
+        if (generator.config().shape_weights[i] <= 0.0) {
+            continue;
+        }
+        const auto shape = all_study_shapes[i];
+        const auto profile = default_profile(shape);
+        json << (first ? "\n" : ",\n") << "    \"" << to_string(shape) << "\": {"
+             << "\"frames\": " << profile.frames
+             << ", \"header_bytes\": " << profile.header_bytes
+             << ", \"native_pixel_bytes\": " << generator.pixel_bytes(shape, false);
+        if (generator.config().compressed_ratio > 0.0) {
+            json << ", \"rle_pixel_bytes\": " << generator.pixel_bytes(shape, true);
+        }
+        json << "}";
+        first = false;
+    }
+    json << "\n  },\n";
+
+    json << "  \"elapsed_seconds\": " << summary.elapsed_seconds << ",\n";
+    json << "  \"operations\": {";
+    first = true;
+    for (std::size_t i = 0; i < operation_count; ++i) {
+        auto& s = stats[i];
+        const auto snapshot = s.latency.snapshot();
+        const auto count = s.count.load();
+        const auto seconds = std::max(summary.elapsed_seconds, 1e-9);
+        json << (first ? "\n" : ",\n") << "    \"" << to_string(all_operations[i]) << "\": {\n";
+        json << "      \"completed\": " << count << ",\n";
+        json << "      \"errors\": " << s.errors.load() << ",\n";
+        json << "      \"throughput_per_second\": " << static_cast<double>(count) / seconds
+             << ",\n";
+        json << "      \"bytes\": " << s.bytes.load() << ",\n";
+        json << "      \"megabytes_per_second\": "
+             << static_cast<double>(s.bytes.load()) / seconds / 1e6 << ",\n";
+        json << "      \"items\": " << s.items.load() << ",\n";
+        json << "      \"latency_ms\": {\"mean\": " << to_ms(snapshot.mean())
+             << ", \"p50\": " << to_ms(static_cast<double>(snapshot.percentile(0.50)))
+             << ", \"p90\": " << to_ms(static_cast<double>(snapshot.percentile(0.90)))
+             << ", \"p95\": " << to_ms(static_cast<double>(snapshot.percentile(0.95)))
+             << ", \"p99\": " << to_ms(static_cast<double>(snapshot.percentile(0.99)))
+             << ", \"max\": " << to_ms(static_cast<double>(snapshot.max())) << "}";
+        std::lock_guard lock(s.error_mutex);
+        if (!s.first_error.empty()) {
+            json << ",\n      \"first_error\": \"" << json_escape(s.first_error) << "\"";
+        }
+        json << "\n    }";
+        first = false;
+    }
+    json << "\n  },\n";
+
+    json << "  \"totals\": {\"operations\": " << summary.operations
+         << ", \"errors\": " << summary.errors
+         << ", \"error_rate\": " << std::setprecision(6) << summary.error_rate()
+         << std::setprecision(3) << ", \"throughput_per_second\": "
+         << static_cast<double>(summary.operations) / std::max(summary.elapsed_seconds, 1e-9)
+         << "}";
+    if (summary.sink) {
+        json << ",\n  \"move_sink\": {\"received\": " << summary.sink_received << "}";
+    }
+    json << "\n}\n";
+    return json.str();
+}
+
+void print_summary(std::array<operation_stats, operation_count>& stats,
+                   const run_summary& summary) {
+    std::cerr << "\n"
+              << std::left << std::setw(8) << "op" << std::right << std::setw(10) << "count"
+              << std::setw(8) << "errors" << std::setw(10) << "ops/s" << std::setw(10)
+              << "p50 ms" << std::setw(10) << "p99 ms" << std::setw(10) << "max ms" << "\n";
+    std::cerr << std::fixed << std::setprecision(1);
+    for (std::size_t i = 0; i < operation_count; ++i) {
+        const auto snapshot = stats[i].latency.snapshot();
+        if (snapshot.count == 0 && stats[i].errors.load() == 0) {
+            continue;
+        }
+        std::cerr << std::left << std::setw(8) << to_string(all_operations[i]) << std::right
+                  << std::setw(10) << stats[i].count.load() << std::setw(8)
+                  << stats[i].errors.load() << std::setw(10)
+                  << static_cast<double>(stats[i].count.load()) /
+                         std::max(summary.elapsed_seconds, 1e-9)
+                  << std::setw(10) << to_ms(static_cast<double>(snapshot.percentile(0.50)))
+                  << std::setw(10) << to_ms(static_cast<double>(snapshot.percentile(0.99)))
+                  << std::setw(10) << to_ms(static_cast<double>(snapshot.max())) << "\n";
+    }
+    std::cerr << "Total: " << summary.operations << " operations, " << summary.errors
+              << " errors in " << summary.elapsed_seconds << " s\n";
+}
+
+}  // namespace
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    options opts;
+    if (!parse_arguments(argc, argv, opts)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    web_client_startup();
+
+    workload_generator generator(opts.workload);
+    try {
+        std::cerr << "Synthesizing study templates...\n";
+        generator.warm_up();
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    std::unique_ptr<move_sink> sink;
+    if (opts.sink_port != 0 && !opts.move_destination.empty()) {
+        sink = std::make_unique<move_sink>(opts.move_destination, opts.sink_port);
+        if (!sink->start()) {
+            std::cerr << "Error: Failed to start move destination on port "
+                      << opts.sink_port << "\n";
+            return 1;
+        }
+    }
+
+    instance_registry registry;
+    std::vector<std::unique_ptr<client>> clients;
+    for (std::size_t i = 0; i < opts.associations; ++i) {
+        clients.push_back(std::make_unique<client>(opts, generator, registry,
+                                                   opts.seed * 1000003 + i));
+    }
+
+    // Seed phase: give queries and retrievals something to find
+    if (opts.seed_studies > 0) {
+        std::cerr << "Seeding " << opts.seed_studies << " studies...\n";
+        std::atomic<std::size_t> next{0};
+        std::atomic<bool> failed{false};
+        std::vector<std::thread> seeders;
+        for (std::size_t c = 0; c < std::min(opts.seed_studies, clients.size()); ++c) {
+            seeders.emplace_back([&, c] {
+                while (!failed && next++ < opts.seed_studies) {
+                    if (!clients[c]->seed_study()) {
+                        failed = true;
+                    }
+                }
+            });
+        }
+        for (auto& t : seeders) {
+            t.join();
+        }
+        if (failed) {
+            std::cerr << "Error: Seeding failed; is the server running and accepting "
+                      << opts.calling_ae << "?\n";
+            return 1;
+        }
+    }
+
+    // Measured run
+    std::array<operation_stats, operation_count> stats;
+    std::atomic<uint64_t> next_op{0};
+    const auto start = clock_type::now();
+    const auto end = start + opts.duration;
+
+    std::cerr << "Running for " << opts.duration.count() << " s on " << opts.associations
+              << " associations";
+    if (opts.rate > 0.0) {
+        std::cerr << " at " << opts.rate << " ops/s";
+    }
+    std::cerr << "...\n";
+
+    std::vector<std::thread> workers;
+    for (auto& c : clients) {
+        workers.emplace_back([&, cl = c.get()] {
+            std::discrete_distribution<std::size_t> pick(opts.mix.begin(), opts.mix.end());
+            for (;;) {
+                clock_type::time_point due = clock_type::now();
+                if (opts.rate > 0.0) {
+                    const auto index = next_op++;
+                    due = start + std::chrono::duration_cast<clock_type::duration>(
+                                      std::chrono::duration<double>(
+                                          static_cast<double>(index) / opts.rate));
+                }
+                if (due >= end) {
+                    break;
+                }
+
+                const auto op = all_operations[pick(cl->rng())];
+                cl->prepare(op);
+                std::this_thread::sleep_until(due);
+
+                const auto began = opts.rate > 0.0 ? due : clock_type::now();
+                auto result = cl->execute(op);
+                const auto latency = clock_type::now() - began;
+
+                auto& s = stats[static_cast<std::size_t>(op)];
+                if (result.ok) {
+                    ++s.count;
+                    s.latency.record(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(latency));
+                    s.bytes += result.bytes;
+                    s.items += result.items;
+                } else {
+                    s.record_error(result.error);
+                }
+            }
+        });
+    }
+    for (auto& t : workers) {
+        t.join();
+    }
+
+    run_summary summary;
+    summary.elapsed_seconds =
+        std::chrono::duration<double>(clock_type::now() - start).count();
+    for (auto& s : stats) {
+        summary.operations += s.count.load() + s.errors.load();
+        summary.errors += s.errors.load();
+    }
+
+    for (auto& c : clients) {
+        c->release_all();
+    }
+    if (sink) {
+        summary.sink = true;
+        summary.sink_received = sink->received();
+        sink->stop();
+    }
+
+    print_summary(stats, summary);
+    const auto report = build_report(opts, generator, stats, summary);
+    if (opts.report_path.empty()) {
+        std::cout << report;
+    } else {
+        std::ofstream out(opts.report_path);
+        out << report;
+        if (!out) {
+            std::cerr << "Error: Failed to write report to " << opts.report_path << "\n";
+            return 1;
+        }
+        std::cerr << "Report written to " << opts.report_path << "\n";
+    }
+
+    if (opts.max_error_rate >= 0.0 && summary.error_rate() > opts.max_error_rate) {
+        std::cerr << "FAIL: error rate " << summary.error_rate() << " exceeds "
+                  << opts.max_error_rate << "\n";
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file web_client.cpp
+ * @brief Implementation of the load test HTTP GET client
+ */
+
+#include "web_client.h"
+
+// Platform-specific socket headers for HTTP client
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+namespace kcenon::pacs::benchmark {
+
+namespace {
+
+#ifdef _WIN32
+using native_socket = SOCKET;
+constexpr native_socket invalid_socket = INVALID_SOCKET;
+#else
+using native_socket = int;
+constexpr native_socket invalid_socket = -1;
+#endif
+
+/// RAII socket handle
+class socket_handle {
+public:
+    explicit socket_handle(native_socket fd) : fd_(fd) {}
+    ~socket_handle() {
+        if (fd_ != invalid_socket) {
+#ifdef _WIN32
+            closesocket(fd_);
+#else
+            ::close(fd_);
+#endif
+        }
+    }
+
+    socket_handle(const socket_handle&) = delete;
+    socket_handle& operator=(const socket_handle&) = delete;
+
+    [[nodiscard]] bool valid() const noexcept { return fd_ != invalid_socket; }
+    [[nodiscard]] native_socket get() const noexcept { return fd_; }
+
+private:
+    native_socket fd_;
+};
+
+void set_timeouts(native_socket fd, std::chrono::milliseconds timeout) {
+#ifdef _WIN32
+    DWORD tv = static_cast<DWORD>(timeout.count());
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&tv), sizeof(tv));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&tv), sizeof(tv));
+#else
+    struct timeval tv{};
+    tv.tv_sec = static_cast<decltype(tv.tv_sec)>(timeout.count() / 1000);
+    tv.tv_usec = static_cast<decltype(tv.tv_usec)>((timeout.count() % 1000) * 1000);
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+#endif
+}
+
+}  // namespace
+
+void web_client_startup() {
+#ifdef _WIN32
+    WSADATA data;
+    WSAStartup(MAKEWORD(2, 2), &data);
+#else
+    // A server closing mid-request must fail the request, not end the run
+    std::signal(SIGPIPE, SIG_IGN);
+#endif
+}
+
+auto url_encode(const std::string& value) -> std::string {
+    std::string encoded;
+    encoded.reserve(value.size());
+    for (unsigned char c : value) {
+        if ((c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+            c == '-' || c == '.' || c == '_' || c == '~') {
+            encoded.push_back(static_cast<char>(c));
+        } else {
+            char buffer[4];
+            std::snprintf(buffer, sizeof(buffer), "%%%02X", c);
+            encoded += buffer;
+        }
+    }
+    return encoded;
+}
+
+auto http_get(const std::string& host, uint16_t port, const std::string& target,
+              const std::string& accept, std::chrono::milliseconds timeout)
+    -> web_response {
+    web_response response;
+
+    struct addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+
+    struct addrinfo* addr_result = nullptr;
+    const auto service = std::to_string(port);
+    if (getaddrinfo(host.c_str(), service.c_str(), &hints, &addr_result) != 0) {
+        response.error = "DNS resolution failed for " + host;
+        return response;
+    }
+    auto addr_cleanup = [](struct addrinfo* p) { freeaddrinfo(p); };
+    std::unique_ptr<struct addrinfo, decltype(addr_cleanup)> addr_guard(addr_result,
+                                                                        addr_cleanup);
+
+    socket_handle sock(::socket(addr_result->ai_family, addr_result->ai_socktype,
+                                addr_result->ai_protocol));
+    if (!sock.valid()) {
+        response.error = "Failed to create socket";
+        return response;
+    }
+    set_timeouts(sock.get(), timeout);
+
+    if (::connect(sock.get(), addr_result->ai_addr,
+                  static_cast<int>(addr_result->ai_addrlen)) != 0) {
+        response.error = "Connection failed to " + host + ":" + service;
+        return response;
+    }
+
+    const std::string request = "GET " + target + " HTTP/1.1\r\nHost: " + host + ":" +
+                                service + "\r\nAccept: " + accept +
+                                "\r\nConnection: close\r\n\r\n";
+    std::size_t sent_total = 0;
+    while (sent_total < request.size()) {
+        const auto sent = ::send(sock.get(), request.data() + sent_total,
+                                 static_cast<int>(request.size() - sent_total), 0);
+        if (sent <= 0) {
+            response.error = "Failed to send HTTP request";
+            return response;
+        }
+        sent_total += static_cast<std::size_t>(sent);
+    }
+
+    // Keep the header only; the body is counted and dropped
+    std::string header;
+    bool in_body = false;
+    char buffer[16384];
+    for (;;) {
+        const auto received = ::recv(sock.get(), buffer, sizeof(buffer), 0);
+        if (received < 0) {
+            response.error = "Failed to receive HTTP response";
+            return response;
+        }
+        if (received == 0) {
+            break;
+        }
+        const auto n = static_cast<std::size_t>(received);
+        if (in_body) {
+            response.body_bytes += n;
+            continue;
+        }
+        header.append(buffer, n);
+        const auto end = header.find("\r\n\r\n");
+        if (end != std::string::npos) {
+            in_body = true;
+            response.body_bytes = header.size() - end - 4;
+            header.resize(end);
+        }
+    }
+
+    // "HTTP/1.x STATUS REASON"
+    const auto space = header.find(' ');
+    if (!in_body || space == std::string::npos) {
+        response.error = "Malformed HTTP response";
+        return response;
+    }
+    response.status = std::atoi(header.c_str() + space + 1);
+    return response;
+}
+
+}  // namespace kcenon::pacs::benchmark
@@ -0,0 +1,67 @@
+/**
+ * @file web_client.h
+ * @brief Minimal blocking HTTP/1.1 GET client for QIDO-RS and WADO-RS load
+ *
+ * One connection per request with "Connection: close", read to end of
+ * stream, like a simple DICOMweb viewer without connection reuse. Only
+ * plain HTTP is supported; the load test targets a local server.
+ *
+ * @see load_test.cpp
+ */
+
+#ifndef PACS_BENCHMARKS_LOAD_TEST_WEB_CLIENT_HPP
+#define PACS_BENCHMARKS_LOAD_TEST_WEB_CLIENT_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace kcenon::pacs::benchmark {
+
+/**
+ * @brief Outcome of one HTTP request
+ */
+struct web_response {
+    /// HTTP status code, 0 when no response was received
+    int status{0};
+
+    /// Bytes of response body
+    std::size_t body_bytes{0};
+
+    /// Transport or protocol error, empty when a response was received
+    std::string error;
+
+    [[nodiscard]] auto is_success() const noexcept -> bool {
+        return error.empty() && status >= 200 && status < 300;
+    }
+};
+
+/**
+ * @brief Send a GET request and drain the response
+ *
+ * @param host Server host name or address
+ * @param port Server port
+ * @param target Request target (path and query string)
+ * @param accept Value of the Accept header
+ * @param timeout Send and receive timeout
+ */
+[[nodiscard]] auto http_get(const std::string& host, uint16_t port,
+                            const std::string& target, const std::string& accept,
+                            std::chrono::milliseconds timeout) -> web_response;
+
+/**
+ * @brief Prepare the process for socket I/O; call once before http_get
+ *
+ * Initializes Winsock on Windows and ignores SIGPIPE elsewhere.
+ */
+void web_client_startup();
+
+/**
+ * @brief Percent-encode a query parameter value
+ */
+[[nodiscard]] auto url_encode(const std::string& value) -> std::string;
+
+}  // namespace kcenon::pacs::benchmark
+
+#endif  // PACS_BENCHMARKS_LOAD_TEST_WEB_CLIENT_HPP
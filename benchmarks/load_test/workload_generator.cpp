@@ -0,0 +1,548 @@
+/**
+ * @file workload_generator.cpp
+ * @brief Implementation of the synthetic DICOM workload generator
+ */
+
+#include "workload_generator.h"
+
+#include "kcenon/pacs/core/dicom_element.h"
+#include "kcenon/pacs/core/dicom_tag_constants.h"
+#include "kcenon/pacs/encoding/compression/codec_factory.h"
+#include "kcenon/pacs/encoding/compression/compression_codec.h"
+#include "kcenon/pacs/encoding/dataset_encoder.h"
+#include "kcenon/pacs/encoding/transfer_syntax.h"
+#include "kcenon/pacs/encoding/vr_type.h"
+#include "kcenon/pacs/services/sop_classes/ct_storage.h"
+#include "kcenon/pacs/services/sop_classes/dx_storage.h"
+#include "kcenon/pacs/services/sop_classes/mr_storage.h"
+#include "kcenon/pacs/services/sop_classes/us_storage.h"
+#include "kcenon/pacs/services/sop_classes/wsi_storage.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+namespace kcenon::pacs::benchmark {
+
+namespace {
+
+using core::dicom_dataset;
+using core::dicom_element;
+using core::dicom_tag;
+using encoding::vr_type;
+namespace tags = core::tags;
+namespace compression = encoding::compression;
+namespace sop = services::sop_classes;
+
+// Image attributes without a named constant
+constexpr dicom_tag tag_number_of_frames{0x0028, 0x0008};
+constexpr dicom_tag tag_planar_configuration{0x0028, 0x0006};
+constexpr dicom_tag tag_frame_time{0x0018, 0x1063};
+constexpr dicom_tag tag_body_part_examined{0x0018, 0x0015};
+constexpr dicom_tag tag_slice_thickness{0x0018, 0x0050};
+constexpr dicom_tag tag_kvp{0x0018, 0x0060};
+constexpr dicom_tag tag_lossy_image_compression{0x0028, 0x2110};
+
+// Vendor private block padding the header to its target size
+constexpr dicom_tag tag_private_creator{0x0009, 0x0010};
+constexpr dicom_tag tag_private_blob{0x0009, 0x1010};
+
+/// Cheap noise source; pixel synthesis draws hundreds of millions of values
+struct xorshift {
+    uint64_t state;
+
+    auto next(uint32_t bound) noexcept -> uint32_t {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return bound == 0 ? 0 : static_cast<uint32_t>(state % bound);
+    }
+};
+
+void put16(std::vector<uint8_t>& pixels, std::size_t index, int value) {
+    const auto v = static_cast<uint16_t>(static_cast<int16_t>(value));
+    pixels[index * 2] = static_cast<uint8_t>(v & 0xFF);
+    pixels[index * 2 + 1] = static_cast<uint8_t>(v >> 8);
+}
+
+void put_rgb(std::vector<uint8_t>& pixels, std::size_t index, int r, int g, int b) {
+    pixels[index * 3] = static_cast<uint8_t>(std::clamp(r, 0, 255));
+    pixels[index * 3 + 1] = static_cast<uint8_t>(std::clamp(g, 0, 255));
+    pixels[index * 3 + 2] = static_cast<uint8_t>(std::clamp(b, 0, 255));
+}
+
+/**
+ * @brief Phantom pixel data for every frame of a shape
+ *
+ * Smooth anatomy-like regions with a few bits of noise: flat background
+ * compresses well, textured regions do not, as in clinical images.
+ */
+auto synthesize_pixels(study_shape shape, const shape_profile& p) -> std::vector<uint8_t> {
+    std::vector<uint8_t> pixels(p.frame_bytes() * p.frames);
+    xorshift noise{0x9E3779B97F4A7C15ull + static_cast<uint64_t>(shape)};
+
+    const double cx = p.columns / 2.0;
+    const double cy = p.rows / 2.0;
+    std::size_t index = 0;
+
+    for (uint32_t f = 0; f < p.frames; ++f) {
+        const double drift = 0.15 * std::sin(f * 0.35);
+        for (uint16_t y = 0; y < p.rows; ++y) {
+            for (uint16_t x = 0; x < p.columns; ++x, ++index) {
+                const double u = (x - cx) / (p.columns * 0.42);
+                const double v = (y - cy) / (p.rows * 0.38);
+                const double r2 = u * u + v * v;
+                const double ou = u - drift;
+                const bool organ = ou * ou + (v + 0.1) * (v + 0.1) < 0.09;
+
+                switch (shape) {
+                    case study_shape::ct: {
+                        int hu = -1000 + static_cast<int>(noise.next(9)) - 4;
+                        if (r2 < 1.0) {
+                            hu = 40 + static_cast<int>(noise.next(25)) - 12;
+                            if (r2 > 0.8 && r2 < 0.9) {
+                                hu = 700 + static_cast<int>(noise.next(41)) - 20;
+                            } else if (organ) {
+                                hu = 60 + static_cast<int>(noise.next(17)) - 8;
+                            }
+                        }
+                        put16(pixels, index, hu);
+                        break;
+                    }
+                    case study_shape::mr: {
+                        int level = static_cast<int>(noise.next(16));
+                        if (r2 < 1.0) {
+                            level = 400 + static_cast<int>(300 * (1.0 - r2)) +
+                                    static_cast<int>(noise.next(33));
+                            if (organ) {
+                                level = 900 + static_cast<int>(noise.next(49));
+                            }
+                        }
+                        put16(pixels, index, level);
+                        break;
+                    }
+                    case study_shape::dx: {
+                        // Direct exposure around an elongated body with ribs
+                        const double bu = u * 1.6;
+                        int level = 3800 + static_cast<int>(noise.next(17));
+                        if (bu * bu + v * v * 0.6 < 1.0) {
+                            level = 1200 + static_cast<int>(600 * std::cos(bu)) +
+                                    static_cast<int>(noise.next(33));
+                            if (std::sin(y * 0.045) > 0.75 && std::abs(bu) > 0.2) {
+                                level += 600;
+                            }
+                        }
+                        put16(pixels, index, level);
+                        break;
+                    }
+                    case study_shape::us_cine: {
+                        // Speckled sector from an apex at the top edge
+                        const double dx = x - cx;
+                        const double depth = std::sqrt(dx * dx + static_cast<double>(y) * y) / p.rows;
+                        const double angle = std::atan2(dx, y + 1.0);
+                        int level = 0;
+                        if (depth < 0.92 && std::abs(angle) < 0.7) {
+                            level = 60 + static_cast<int>(90 * (1.0 - depth)) +
+                                    static_cast<int>(noise.next(64));
+                            if (organ) {
+                                level /= 3;
+                            }
+                        }
+                        put_rgb(pixels, index, level, level, level);
+                        break;
+                    }
+                    case study_shape::wsi: {
+                        // Near-white glass with stained tissue and nuclei
+                        const double tu = u + 0.3 * std::cos(f * 1.7);
+                        const double tv = v + 0.3 * std::sin(f * 1.3);
+                        if (tu * tu + tv * tv < 0.6) {
+                            if ((x * 7 + y * 13 + f * 31) % 97 < 6) {
+                                put_rgb(pixels, index, 120, 60 + static_cast<int>(noise.next(20)),
+                                        150);
+                            } else {
+                                put_rgb(pixels, index, 230 - static_cast<int>(noise.next(24)),
+                                        160 - static_cast<int>(noise.next(24)),
+                                        200 - static_cast<int>(noise.next(16)));
+                            }
+                        } else {
+                            put_rgb(pixels, index, 242 + static_cast<int>(noise.next(3)),
+                                    240 + static_cast<int>(noise.next(3)),
+                                    245 + static_cast<int>(noise.next(3)));
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    return pixels;
+}
+
+/// Attributes shared by every instance of a shape, values filled per instance
+void add_header(dicom_dataset& ds, study_shape shape, const shape_profile& p) {
+    ds.set_string(tags::specific_character_set, vr_type::CS, "ISO_IR 100");
+    ds.set_string(tags::image_type, vr_type::CS,
+                  shape == study_shape::wsi ? "ORIGINAL\\PRIMARY\\VOLUME\\NONE"
+                                            : "ORIGINAL\\PRIMARY\\AXIAL");
+    ds.set_string(tags::sop_class_uid, vr_type::UI, p.sop_class_uid);
+    ds.set_string(tags::modality, vr_type::CS, p.modality);
+    ds.set_string(tags::manufacturer, vr_type::LO, "LOADTEST");
+    ds.set_string(tags::manufacturers_model_name, vr_type::LO,
+                  std::string("SYNTHETIC ") + std::string(to_string(shape)));
+    ds.set_string(tags::institution_name, vr_type::LO, "SYNTHETIC GENERAL HOSPITAL");
+    ds.set_string(tags::institution_address, vr_type::ST,
+                  "1 Benchmark Way, Load Test City");
+    ds.set_string(tags::station_name, vr_type::SH, "LOADGEN01");
+    ds.set_string(tags::referring_physician_name, vr_type::PN, "REFERRING^DOCTOR");
+    ds.set_string(tags::performing_physician_name, vr_type::PN, "PERFORMING^DOCTOR");
+    ds.set_string(tags::operators_name, vr_type::PN, "TECH^OPERATOR");
+    ds.set_string(tags::study_description, vr_type::LO,
+                  std::string(p.modality) + " SYNTHETIC STUDY");
+    ds.set_string(tags::series_description, vr_type::LO,
+                  std::string(p.modality) + " SYNTHETIC SERIES");
+    ds.set_string(tags::patient_sex, vr_type::CS, "O");
+    ds.set_string(tags::patient_age, vr_type::AS, "045Y");
+    ds.set_string(tags::patient_size, vr_type::DS, "1.72");
+    ds.set_string(tags::patient_weight, vr_type::DS, "70");
+    ds.set_string(tags::study_id, vr_type::SH, "1");
+    ds.set_string(tags::acquisition_number, vr_type::IS, "1");
+    if (shape != study_shape::wsi) {
+        ds.set_string(tag_body_part_examined, vr_type::CS, "CHEST");
+    }
+
+    if (shape == study_shape::ct || shape == study_shape::mr) {
+        ds.set_string(tags::image_orientation_patient, vr_type::DS, "1\\0\\0\\0\\1\\0");
+        ds.set_string(tags::pixel_spacing, vr_type::DS, "0.703125\\0.703125");
+        ds.set_string(tag_slice_thickness, vr_type::DS, "1.25");
+    }
+    if (shape == study_shape::ct) {
+        ds.set_string(tag_kvp, vr_type::DS, "120");
+        ds.set_string(tags::rescale_intercept, vr_type::DS, "0");
+        ds.set_string(tags::rescale_slope, vr_type::DS, "1");
+        ds.set_string(tags::rescale_type, vr_type::LO, "HU");
+    }
+    if (shape == study_shape::us_cine) {
+        ds.set_string(tag_frame_time, vr_type::DS, "33.3");
+    }
+
+    ds.set_numeric<uint16_t>(tags::samples_per_pixel, vr_type::US, p.samples_per_pixel);
+    ds.set_string(tags::photometric_interpretation, vr_type::CS, p.photometric);
+    if (p.samples_per_pixel > 1) {
+        ds.set_numeric<uint16_t>(tag_planar_configuration, vr_type::US, 0);
+    }
+    if (p.frames > 1) {
+        ds.set_string(tag_number_of_frames, vr_type::IS, std::to_string(p.frames));
+    }
+    ds.set_numeric<uint16_t>(tags::rows, vr_type::US, p.rows);
+    ds.set_numeric<uint16_t>(tags::columns, vr_type::US, p.columns);
+    ds.set_numeric<uint16_t>(tags::bits_allocated, vr_type::US, p.bits_allocated);
+    ds.set_numeric<uint16_t>(tags::bits_stored, vr_type::US, p.bits_stored);
+    ds.set_numeric<uint16_t>(tags::high_bit, vr_type::US,
+                             static_cast<uint16_t>(p.bits_stored - 1));
+    ds.set_numeric<uint16_t>(tags::pixel_representation, vr_type::US,
+                             p.pixel_representation);
+    if (p.samples_per_pixel == 1) {
+        ds.set_string(tags::window_center, vr_type::DS,
+                      shape == study_shape::ct ? "40" : "600");
+        ds.set_string(tags::window_width, vr_type::DS,
+                      shape == study_shape::ct ? "400" : "1200");
+    }
+    ds.set_string(tag_lossy_image_compression, vr_type::CS, "00");
+
+    // Per-instance attributes, set here so they count towards the header size
+    const std::string uid(64, '9');
+    for (auto tag : {tags::sop_instance_uid, tags::study_instance_uid,
+                     tags::series_instance_uid, tags::frame_of_reference_uid}) {
+        ds.set_string(tag, vr_type::UI, uid);
+    }
+    ds.set_string(tags::patient_name, vr_type::PN, "LOADTEST^PATIENT000000");
+    ds.set_string(tags::patient_id, vr_type::LO, "LT000000");
+    ds.set_string(tags::patient_birth_date, vr_type::DA, "19800101");
+    ds.set_string(tags::accession_number, vr_type::SH, "A000000000");
+    for (auto tag : {tags::study_date, tags::series_date, tags::acquisition_date,
+                     tags::content_date, tags::instance_creation_date}) {
+        ds.set_string(tag, vr_type::DA, "20250101");
+    }
+    for (auto tag : {tags::study_time, tags::series_time, tags::acquisition_time,
+                     tags::content_time, tags::instance_creation_time}) {
+        ds.set_string(tag, vr_type::TM, "120000.000000");
+    }
+    ds.set_string(tags::series_number, vr_type::IS, "1");
+    ds.set_string(tags::instance_number, vr_type::IS, "1");
+    if (shape == study_shape::ct || shape == study_shape::mr) {
+        ds.set_string(tags::image_position_patient, vr_type::DS, "-180\\-180\\-0.00");
+        ds.set_string(tags::slice_location, vr_type::DS, "-0.00");
+    }
+
+    // Vendor private block up to the header size of the shape
+    ds.set_string(tag_private_creator, vr_type::LO, "LOADTEST SYNTHETIC");
+    const encoding::dataset_encoder encoder(
+        encoding::transfer_syntax::explicit_vr_little_endian);
+    const auto size = encoder.encoded_size(ds) + 12;  // blob element header
+    if (p.header_bytes > size) {
+        std::vector<uint8_t> blob((p.header_bytes - size + 1) & ~std::size_t{1});
+        for (std::size_t i = 0; i < blob.size(); ++i) {
+            blob[i] = static_cast<uint8_t>((i * 31) ^ (i >> 5));
+        }
+        ds.insert(dicom_element(tag_private_blob, vr_type::OB, blob));
+    }
+}
+
+auto to_photometric(const shape_profile& p) -> compression::photometric_interpretation {
+    return p.samples_per_pixel == 3 ? compression::photometric_interpretation::rgb
+                                    : compression::photometric_interpretation::monochrome2;
+}
+
+/// Pixel Data element for a shape, native or RLE Lossless encapsulated
+auto make_pixel_element(study_shape shape, const shape_profile& p, bool compressed)
+    -> dicom_element {
+    auto pixels = synthesize_pixels(shape, p);
+    const auto native_vr = p.bits_allocated > 8 ? vr_type::OW : vr_type::OB;
+    if (!compressed) {
+        return dicom_element(tags::pixel_data, native_vr, pixels);
+    }
+
+    compression::image_params params;
+    params.width = p.columns;
+    params.height = p.rows;
+    params.bits_allocated = p.bits_allocated;
+    params.bits_stored = p.bits_stored;
+    params.high_bit = static_cast<uint16_t>(p.bits_stored - 1);
+    params.samples_per_pixel = p.samples_per_pixel;
+    params.pixel_representation = p.pixel_representation;
+    params.photometric = to_photometric(p);
+    params.number_of_frames = p.frames;
+
+    auto codec = compression::codec_factory::create(
+        encoding::transfer_syntax::rle_lossless.uid());
+    if (!codec) {
+        throw std::runtime_error("RLE Lossless codec is not available");
+    }
+    auto encoded = codec->encode_frames(pixels, params);
+    if (encoded.is_err()) {
+        throw std::runtime_error("RLE encoding of " + std::string(to_string(shape)) +
+                                 " failed: " + encoded.error().message);
+    }
+    return dicom_element(tags::pixel_data, vr_type::OB, encoded.value().data);
+}
+
+auto template_slot(study_shape shape, bool compressed) -> std::size_t {
+    return static_cast<std::size_t>(shape) * 2 + (compressed ? 1 : 0);
+}
+
+}  // namespace
+
+// =============================================================================
+// Study Shapes
+// =============================================================================
+
+auto to_string(study_shape shape) noexcept -> std::string_view {
+    switch (shape) {
+        case study_shape::ct: return "ct";
+        case study_shape::mr: return "mr";
+        case study_shape::dx: return "dx";
+        case study_shape::us_cine: return "us";
+        case study_shape::wsi: return "wsi";
+    }
+    return "unknown";
+}
+
+auto parse_study_shape(std::string_view name) -> std::optional<study_shape> {
+    for (auto shape : all_study_shapes) {
+        if (to_string(shape) == name) {
+            return shape;
+        }
+    }
+    return std::nullopt;
+}
+
+auto default_profile(study_shape shape) -> shape_profile {
+    shape_profile p;
+    switch (shape) {
+        case study_shape::ct:
+            p.modality = "CT";
+            p.sop_class_uid = sop::ct_image_storage_uid;
+            p.photometric = "MONOCHROME2";
+            p.rows = p.columns = 512;
+            p.bits_stored = 12;
+            p.pixel_representation = 1;
+            p.series = 2;
+            p.instances_per_series = 80;
+            p.header_bytes = 6 * 1024;
+            break;
+        case study_shape::mr:
+            p.modality = "MR";
+            p.sop_class_uid = sop::mr_image_storage_uid;
+            p.photometric = "MONOCHROME2";
+            p.rows = p.columns = 256;
+            p.bits_stored = 12;
+            p.series = 4;
+            p.instances_per_series = 24;
+            p.header_bytes = 12 * 1024;
+            break;
+        case study_shape::dx:
+            p.modality = "DX";
+            p.sop_class_uid = sop::dx_image_storage_for_presentation_uid;
+            p.photometric = "MONOCHROME2";
+            p.rows = 2500;
+            p.columns = 2048;
+            p.bits_stored = 14;
+            p.series = 1;
+            p.instances_per_series = 2;
+            p.header_bytes = 3 * 1024;
+            break;
+        case study_shape::us_cine:
+            p.modality = "US";
+            p.sop_class_uid = sop::us_multiframe_image_storage_uid;
+            p.photometric = "RGB";
+            p.rows = 480;
+            p.columns = 640;
+            p.bits_allocated = p.bits_stored = 8;
+            p.samples_per_pixel = 3;
+            p.frames = 40;
+            p.series = 1;
+            p.instances_per_series = 3;
+            p.header_bytes = 4 * 1024;
+            break;
+        case study_shape::wsi:
+            p.modality = "SM";
+            p.sop_class_uid = sop::wsi_image_storage_uid;
+            p.photometric = "RGB";
+            p.rows = p.columns = 512;
+            p.bits_allocated = p.bits_stored = 8;
+            p.samples_per_pixel = 3;
+            p.frames = 16;
+            p.series = 1;
+            p.instances_per_series = 4;
+            p.header_bytes = 8 * 1024;
+            break;
+    }
+    return p;
+}
+
+// =============================================================================
+// Generator
+// =============================================================================
+
+workload_generator::workload_generator(workload_config config)
+    : config_(std::move(config)),
+      shape_pick_(config_.shape_weights.begin(), config_.shape_weights.end()),
+      run_id_(std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                 std::chrono::system_clock::now().time_since_epoch())
+                                 .count())) {
+    config_.compressed_ratio = std::clamp(config_.compressed_ratio, 0.0, 1.0);
+    config_.patients = std::max<std::size_t>(config_.patients, 1);
+}
+
+auto workload_generator::make_uid() -> std::string {
+    return config_.uid_root + "." + run_id_ + "." + std::to_string(++next_uid_);
+}
+
+auto workload_generator::next_study(std::mt19937_64& rng) -> synthetic_study {
+    synthetic_study study;
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    std::lock_guard lock(mutex_);
+    study.shape = all_study_shapes[shape_pick_(rng)];
+    study.compressed = unit(rng) < config_.compressed_ratio;
+
+    const auto profile = default_profile(study.shape);
+    const auto patient = rng() % config_.patients;
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "LT%06zu", static_cast<std::size_t>(patient));
+    study.patient_id = buffer;
+    std::snprintf(buffer, sizeof(buffer), "LOADTEST^PATIENT%06zu",
+                  static_cast<std::size_t>(patient));
+    study.patient_name = buffer;
+    std::snprintf(buffer, sizeof(buffer), "%04d%02d%02d",
+                  2020 + static_cast<int>(rng() % 6), 1 + static_cast<int>(rng() % 12),
+                  1 + static_cast<int>(rng() % 28));
+    study.study_date = buffer;
+
+    study.study_uid = make_uid();
+    study.accession_number = "A" + std::to_string(next_uid_);
+    for (std::size_t s = 0; s < profile.series; ++s) {
+        study.series_uids.push_back(make_uid());
+    }
+    study.instances_per_series = std::max<std::size_t>(
+        1, static_cast<std::size_t>(
+               std::lround(profile.instances_per_series * config_.study_scale)));
+    return study;
+}
+
+auto workload_generator::instance(const synthetic_study& study, std::size_t index)
+    -> core::dicom_dataset {
+    auto ds = templ(study.shape, study.compressed);
+
+    const auto series = index / study.instances_per_series;
+    const auto number = index % study.instances_per_series + 1;
+    const auto& series_uid = study.series_uids.at(series);
+
+    ds.set_string(tags::study_instance_uid, vr_type::UI, study.study_uid);
+    ds.set_string(tags::series_instance_uid, vr_type::UI, series_uid);
+    ds.set_string(tags::sop_instance_uid, vr_type::UI,
+                  series_uid + "." + std::to_string(number));
+    ds.set_string(tags::frame_of_reference_uid, vr_type::UI, study.series_uids.front());
+    ds.set_string(tags::patient_name, vr_type::PN, study.patient_name);
+    ds.set_string(tags::patient_id, vr_type::LO, study.patient_id);
+    ds.set_string(tags::accession_number, vr_type::SH, study.accession_number);
+    for (auto tag : {tags::study_date, tags::series_date, tags::acquisition_date,
+                     tags::content_date, tags::instance_creation_date}) {
+        ds.set_string(tag, vr_type::DA, study.study_date);
+    }
+    ds.set_string(tags::series_number, vr_type::IS, std::to_string(series + 1));
+    ds.set_string(tags::instance_number, vr_type::IS, std::to_string(number));
+    if (ds.get(tags::slice_location) != nullptr) {
+        const auto z = std::to_string(-1.25 * static_cast<double>(number));
+        ds.set_string(tags::image_position_patient, vr_type::DS, "-180\\-180\\" + z);
+        ds.set_string(tags::slice_location, vr_type::DS, z);
+    }
+    return ds;
+}
+
+auto workload_generator::transfer_syntax_uid(const synthetic_study& study)
+    -> std::string_view {
+    return study.compressed ? encoding::transfer_syntax::rle_lossless.uid()
+                            : encoding::transfer_syntax::explicit_vr_little_endian.uid();
+}
+
+void workload_generator::warm_up() {
+    for (std::size_t i = 0; i < study_shape_count; ++i) {
+        if (config_.shape_weights[i] <= 0.0) {
+            continue;
+        }
+        if (config_.compressed_ratio < 1.0) {
+            (void)templ(all_study_shapes[i], false);
+        }
+        if (config_.compressed_ratio > 0.0) {
+            (void)templ(all_study_shapes[i], true);
+        }
+    }
+}
+
+auto workload_generator::pixel_bytes(study_shape shape, bool compressed) -> std::size_t {
+    const auto* pixels = templ(shape, compressed).get(tags::pixel_data);
+    return pixels != nullptr ? pixels->raw_data().size() : 0;
+}
+
+auto workload_generator::config() const noexcept -> const workload_config& {
+    return config_;
+}
+
+auto workload_generator::templ(study_shape shape, bool compressed)
+    -> const core::dicom_dataset& {
+    std::lock_guard lock(mutex_);
+    auto& slot = templates_[template_slot(shape, compressed)];
+    if (!slot) {
+        const auto profile = default_profile(shape);
+        auto ds = std::make_unique<dicom_dataset>();
+        add_header(*ds, shape, profile);
+        ds->insert(make_pixel_element(shape, profile, compressed));
+        slot = std::move(ds);
+    }
+    return *slot;
+}
+
+}  // namespace kcenon::pacs::benchmark
@@ -0,0 +1,218 @@
+/**
+ * @file workload_generator.h
+ * @brief Synthetic DICOM studies shaped like real clinical traffic
+ *
+ * Each study shape reproduces the properties that drive server cost for a
+ * modality: matrix size, bit depth, colour, frames per instance, instances
+ * per study and the size of the non-pixel header (vendor private blocks
+ * included). Pixel data is a smooth phantom with low-bit noise, so RLE
+ * compresses it at ratios close to clinical images, and each study is sent
+ * either native or RLE Lossless encapsulated.
+ *
+ * Pixel data and headers are synthesized once per shape and encoding; an
+ * instance is a copy of that template with its own identifiers, so the
+ * generator keeps up with the network at high rates.
+ *
+ * @see load_test.cpp
+ */
+
+#ifndef PACS_BENCHMARKS_LOAD_TEST_WORKLOAD_GENERATOR_HPP
+#define PACS_BENCHMARKS_LOAD_TEST_WORKLOAD_GENERATOR_HPP
+
+#include "kcenon/pacs/core/dicom_dataset.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace kcenon::pacs::benchmark {
+
+// =============================================================================
+// Study Shapes
+// =============================================================================
+
+/**
+ * @brief Clinical study archetypes the generator can synthesize
+ */
+enum class study_shape {
+    ct,       ///< Axial CT series, 512x512 16-bit signed
+    mr,       ///< Multi-sequence MR, 256x256 16-bit
+    dx,       ///< Projection radiograph, large 16-bit single frame
+    us_cine,  ///< Ultrasound cine loop, RGB multi-frame
+    wsi       ///< Whole slide imaging, tiled RGB multi-frame
+};
+
+/// Number of study shapes
+inline constexpr std::size_t study_shape_count = 5;
+
+/// All study shapes in declaration order
+inline constexpr std::array<study_shape, study_shape_count> all_study_shapes = {
+    study_shape::ct, study_shape::mr, study_shape::dx,
+    study_shape::us_cine, study_shape::wsi};
+
+[[nodiscard]] auto to_string(study_shape shape) noexcept -> std::string_view;
+
+/**
+ * @brief Parse a shape name ("ct", "mr", "dx", "us", "wsi")
+ */
+[[nodiscard]] auto parse_study_shape(std::string_view name)
+    -> std::optional<study_shape>;
+
+/**
+ * @brief Image geometry and study layout of a shape
+ */
+struct shape_profile {
+    std::string_view modality;
+    std::string_view sop_class_uid;
+    std::string_view photometric;
+    uint16_t rows{0};
+    uint16_t columns{0};
+    uint16_t bits_allocated{16};
+    uint16_t bits_stored{16};
+    uint16_t samples_per_pixel{1};
+    uint16_t pixel_representation{0};
+
+    /// Frames per instance (1 = single frame)
+    uint32_t frames{1};
+
+    /// Series per study
+    std::size_t series{1};
+
+    /// Instances per series
+    std::size_t instances_per_series{1};
+
+    /// Encoded size of the attributes outside Pixel Data
+    std::size_t header_bytes{0};
+
+    [[nodiscard]] auto frame_bytes() const noexcept -> std::size_t {
+        return std::size_t{rows} * columns * samples_per_pixel * (bits_allocated / 8);
+    }
+};
+
+/**
+ * @brief Default profile of a shape
+ *
+ * Matrix sizes and header sizes follow typical clinical instances; instance
+ * counts are scaled down from full studies so a run cycles through many
+ * studies.
+ */
+[[nodiscard]] auto default_profile(study_shape shape) -> shape_profile;
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+/**
+ * @brief Workload generator configuration
+ */
+struct workload_config {
+    /// Relative weight of each shape, indexed like all_study_shapes
+    std::array<double, study_shape_count> shape_weights{40, 25, 20, 10, 5};
+
+    /// Fraction of studies sent RLE Lossless compressed (0..1)
+    double compressed_ratio{0.5};
+
+    /// Multiplier on instances per series (at least one instance)
+    double study_scale{1.0};
+
+    /// Patients the studies are spread over
+    std::size_t patients{500};
+
+    /// Root of generated UIDs
+    std::string uid_root{"1.2.826.0.1.3680043.9.8888.50"};
+};
+
+// =============================================================================
+// Synthetic Studies
+// =============================================================================
+
+/**
+ * @brief Identity and layout of one synthetic study
+ *
+ * Instances are produced on demand with workload_generator::instance(), so
+ * a study of several hundred megabytes is never held in memory at once.
+ */
+struct synthetic_study {
+    study_shape shape{study_shape::ct};
+    bool compressed{false};
+    std::string study_uid;
+    std::string patient_id;
+    std::string patient_name;
+    std::string accession_number;
+    std::string study_date;
+    std::vector<std::string> series_uids;
+    std::size_t instances_per_series{1};
+
+    [[nodiscard]] auto instance_count() const noexcept -> std::size_t {
+        return series_uids.size() * instances_per_series;
+    }
+};
+
+/**
+ * @brief Generates synthetic studies and their instances
+ *
+ * Thread Safety: all methods may be called concurrently. Templates are
+ * built on first use under a lock; afterwards instance() only copies.
+ */
+class workload_generator {
+public:
+    explicit workload_generator(workload_config config = {});
+
+    /**
+     * @brief Pick the shape, encoding and patient of the next study
+     * @param rng Caller-owned random source
+     */
+    [[nodiscard]] auto next_study(std::mt19937_64& rng) -> synthetic_study;
+
+    /**
+     * @brief Build one instance of a study
+     * @param study Study from next_study()
+     * @param index Instance index in [0, study.instance_count())
+     * @return Complete dataset ready for C-STORE
+     */
+    [[nodiscard]] auto instance(const synthetic_study& study, std::size_t index)
+        -> core::dicom_dataset;
+
+    /**
+     * @brief Transfer syntax a study's instances must be sent with
+     */
+    [[nodiscard]] static auto transfer_syntax_uid(const synthetic_study& study)
+        -> std::string_view;
+
+    /**
+     * @brief Build every template ahead of the measured run
+     */
+    void warm_up();
+
+    /**
+     * @brief Bytes of Pixel Data per instance of a shape and encoding
+     */
+    [[nodiscard]] auto pixel_bytes(study_shape shape, bool compressed) -> std::size_t;
+
+    [[nodiscard]] auto config() const noexcept -> const workload_config&;
+
+private:
+    [[nodiscard]] auto templ(study_shape shape, bool compressed)
+        -> const core::dicom_dataset&;
+
+    [[nodiscard]] auto make_uid() -> std::string;
+
+    workload_config config_;
+    std::discrete_distribution<std::size_t> shape_pick_;
+    std::string run_id_;
+
+    std::mutex mutex_;
+    uint64_t next_uid_{0};
+    std::array<std::unique_ptr<core::dicom_dataset>, study_shape_count * 2> templates_;
+};
+
+}  // namespace kcenon::pacs::benchmark
+
+#endif  // PACS_BENCHMARKS_LOAD_TEST_WORKLOAD_GENERATOR_HPP
@@ -0,0 +1,145 @@
+/**
+ * @file latency_histogram_benchmark.cpp
+ * @brief Recording overhead benchmark for latency histograms
+ *
+ * Measures nanoseconds per recorded value for:
+ * - latency_histogram::record, single thread and contended
+ * - operation_counter::record_success (counters, min/max and histogram)
+ * - pacs_metrics::record_calling_ae (label lookup plus histogram)
+ *
+ * Recording is expected to stay in the tens of nanoseconds, including when
+ * every thread records into the same histogram.
+ *
+ * Usage: latency_histogram_benchmark [records_per_thread] [threads]
+ *
+ * threads defaults to the number of hardware threads; with more threads than
+ * cores, threads are time-sliced and the per-record figures include waiting.
+ */
+
+#include "kcenon/pacs/monitoring/latency_histogram.h"
+#include "kcenon/pacs/monitoring/pacs_metrics.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kcenon::pacs::monitoring;
+
+namespace {
+
+// =============================================================================
+// Measurement
+// =============================================================================
+
+/// Spread of durations, so records hit many buckets as real traffic does
+auto sample_duration(std::uint64_t i) -> std::uint64_t {
+    return 50 + (i * 2654435761u) % 5'000'000;
+}
+
+/**
+ * @brief Run record(i) records_per_thread times on each thread
+ * @return Nanoseconds per record, as seen by one thread
+ */
+template <typename Record>
+auto measure(std::size_t threads, std::size_t records_per_thread, Record record) -> double {
+    std::vector<std::thread> workers;
+    std::vector<double> per_thread(threads, 0.0);
+    workers.reserve(threads);
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            const auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < records_per_thread; ++i) {
+                record(t * records_per_thread + i);
+            }
+            const auto elapsed = std::chrono::duration<double, std::nano>(
+                std::chrono::steady_clock::now() - start);
+            per_thread[t] = elapsed.count() / static_cast<double>(records_per_thread);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return *std::max_element(per_thread.begin(), per_thread.end());
+}
+
+void report(const std::string& name, std::size_t threads, double ns_per_record) {
+    std::cout << std::left << std::setw(44) << name << std::right << std::setw(4)
+              << threads << " threads  " << std::fixed << std::setprecision(1)
+              << std::setw(8) << ns_per_record << " ns/record\n";
+}
+
+}  // namespace
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char** argv) {
+    const size_t records = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 5'000'000;
+    size_t threads = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 0;
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::cout << "======================================\n";
+    std::cout << "  Latency Histogram Benchmark\n";
+    std::cout << "======================================\n";
+    std::cout << "Records per thread: " << records << "\n";
+    std::cout << "Buckets: " << latency_histogram::bucket_count << " x "
+              << latency_histogram::shard_count << " shards\n\n";
+
+    for (const auto count : {std::size_t{1}, threads}) {
+        latency_histogram histogram;
+        report("latency_histogram::record", count,
+               measure(count, records, [&](std::uint64_t i) {
+                   histogram.record(std::chrono::nanoseconds(sample_duration(i)));
+               }));
+
+        const auto snapshot = histogram.snapshot();
+        if (snapshot.count != count * records) {
+            std::cerr << "Lost records: " << snapshot.count << "\n";
+            return 1;
+        }
+    }
+
+    for (const auto count : {std::size_t{1}, threads}) {
+        operation_counter counter;
+        report("operation_counter::record_success", count,
+               measure(count, records, [&](std::uint64_t i) {
+                   counter.record_success(
+                       std::chrono::microseconds(sample_duration(i) / 1000));
+               }));
+    }
+
+    for (const auto count : {std::size_t{1}, threads}) {
+        pacs_metrics metrics;
+        report("pacs_metrics::record_calling_ae", count,
+               measure(count, records, [&](std::uint64_t i) {
+                   metrics.record_calling_ae(
+                       "MODALITY_AE", dimse_operation::c_store,
+                       std::chrono::microseconds(sample_duration(i) / 1000));
+               }));
+    }
+
+    latency_histogram histogram;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        histogram.record(std::chrono::nanoseconds(sample_duration(i)));
+    }
+    const auto snapshot_start = std::chrono::steady_clock::now();
+    constexpr int kSnapshots = 1000;
+    std::uint64_t p99 = 0;
+    for (int i = 0; i < kSnapshots; ++i) {
+        p99 += histogram.snapshot().percentile(0.99);
+    }
+    const auto snapshot_us = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - snapshot_start).count() / kSnapshots;
+    std::cout << "\nsnapshot + percentile: " << std::setprecision(2) << snapshot_us
+              << " us (p99 " << p99 / kSnapshots << " ns)\n";
+    return 0;
+}
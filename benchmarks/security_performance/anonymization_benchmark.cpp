@@ -0,0 +1,159 @@
+/**
+ * @file anonymization_benchmark.cpp
+ * @brief Throughput benchmark for batch de-identification
+ *
+ * Measures instances/s for de-identifying a synthetic CT study on disk:
+ * - Full decode and re-encode, single worker (per-instance baseline)
+ * - Header-only rewrite with Pixel Data copied through, single worker
+ * - Header-only rewrite with a worker pool
+ *
+ * Usage: anonymization_benchmark [instances] [workers]
+ */
+
+#include "kcenon/pacs/core/dicom_file.h"
+#include "kcenon/pacs/core/dicom_tag_constants.h"
+#include "kcenon/pacs/encoding/transfer_syntax.h"
+#include "kcenon/pacs/encoding/vr_type.h"
+#include "kcenon/pacs/security/batch_anonymizer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kcenon::pacs::core;
+using namespace kcenon::pacs::encoding;
+using namespace kcenon::pacs::security;
+
+namespace {
+
+// =============================================================================
+// Test Data
+// =============================================================================
+
+constexpr uint16_t kRows = 512;
+constexpr uint16_t kColumns = 512;
+
+auto make_ct_instance(size_t series, size_t number) -> dicom_dataset {
+    const std::string series_uid = "1.2.826.0.1.3680043.2.1." + std::to_string(series);
+
+    dicom_dataset ds;
+    ds.set_string(tags::patient_name, vr_type::PN, "DOE^JOHN");
+    ds.set_string(tags::patient_id, vr_type::LO, "PID-0001");
+    ds.set_string(tags::patient_birth_date, vr_type::DA, "19700101");
+    ds.set_string(tags::patient_sex, vr_type::CS, "M");
+    ds.set_string(tags::institution_name, vr_type::LO, "General Hospital");
+    ds.set_string(tags::referring_physician_name, vr_type::PN, "SMITH^JANE");
+    ds.set_string(tags::accession_number, vr_type::SH, "ACC0001");
+    ds.set_string(tags::study_date, vr_type::DA, "20240115");
+    ds.set_string(tags::study_instance_uid, vr_type::UI, "1.2.826.0.1.3680043.2.1");
+    ds.set_string(tags::series_instance_uid, vr_type::UI, series_uid);
+    ds.set_string(tags::sop_instance_uid, vr_type::UI,
+                  series_uid + "." + std::to_string(number));
+    ds.set_string(tags::sop_class_uid, vr_type::UI, "1.2.840.10008.5.1.4.1.1.2");
+    ds.set_string(tags::modality, vr_type::CS, "CT");
+    ds.set_numeric<uint16_t>(tags::rows, vr_type::US, kRows);
+    ds.set_numeric<uint16_t>(tags::columns, vr_type::US, kColumns);
+    ds.set_numeric<uint16_t>(tags::bits_allocated, vr_type::US, 16);
+    ds.set_numeric<uint16_t>(tags::bits_stored, vr_type::US, 12);
+    ds.set_numeric<uint16_t>(tags::high_bit, vr_type::US, 11);
+    ds.set_numeric<uint16_t>(tags::samples_per_pixel, vr_type::US, 1);
+    ds.set_numeric<uint16_t>(tags::pixel_representation, vr_type::US, 0);
+    ds.set_string(tags::photometric_interpretation, vr_type::CS, "MONOCHROME2");
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(kRows) * kColumns * 2);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>((i * 31 + number) & 0x0F);
+    }
+    ds.insert(dicom_element(tags::pixel_data, vr_type::OW, pixels));
+    return ds;
+}
+
+void write_study(const std::filesystem::path& root, size_t instances) {
+    constexpr size_t kInstancesPerSeries = 100;
+    for (size_t i = 0; i < instances; ++i) {
+        const auto series = i / kInstancesPerSeries + 1;
+        const auto dir = root / ("series" + std::to_string(series));
+        std::filesystem::create_directories(dir);
+        auto file = dicom_file::create(make_ct_instance(series, i + 1),
+                                       transfer_syntax::explicit_vr_little_endian);
+        if (file.save(dir / (std::to_string(i + 1) + ".dcm")).is_err()) {
+            std::cerr << "Failed to write test data\n";
+            std::exit(1);
+        }
+    }
+}
+
+// =============================================================================
+// Benchmark
+// =============================================================================
+
+void run_case(const std::string& name, const std::filesystem::path& input,
+              const std::filesystem::path& output, size_t workers,
+              bool passthrough) {
+    std::filesystem::remove_all(output);
+
+    batch_anonymization_config config;
+    config.output_directory = output;
+    config.worker_count = workers;
+    config.pixel_passthrough = passthrough;
+
+    anonymizer prototype(anonymization_profile::basic);
+    batch_anonymizer batch(prototype, config);
+    uid_mapping mapping;
+
+    auto result = batch.run({input}, mapping);
+    if (result.is_err()) {
+        std::cerr << name << ": " << result.error().message << "\n";
+        return;
+    }
+    const auto& stats = result.value();
+    const double seconds = static_cast<double>(stats.elapsed.count()) / 1000.0;
+    const double mb_per_sec =
+        seconds > 0.0 ? static_cast<double>(stats.bytes_read) / (1024.0 * 1024.0) / seconds
+                      : 0.0;
+
+    std::cout << std::left << std::setw(36) << name << std::right
+              << std::setw(8) << stats.instances_processed
+              << std::setw(12) << std::fixed << std::setprecision(1)
+              << stats.instances_per_second() << " inst/s"
+              << std::setw(10) << mb_per_sec << " MB/s"
+              << "  (passthrough " << stats.pixel_passthrough
+              << ", failed " << stats.instances_failed << ")\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t instances = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500;
+    size_t workers = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 0;
+    if (workers == 0) {
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::cout << "======================================\n";
+    std::cout << "  Batch Anonymization Benchmark\n";
+    std::cout << "======================================\n";
+    std::cout << "Instances: " << instances << " (" << kRows << "x" << kColumns
+              << " 16-bit CT)\n";
+    std::cout << "Workers:   " << workers << "\n\n";
+
+    const auto root = std::filesystem::temp_directory_path() / "pacs_anonymization_benchmark";
+    std::filesystem::remove_all(root);
+    write_study(root / "input", instances);
+
+    run_case("Full decode, 1 worker", root / "input", root / "output", 1, false);
+    run_case("Header-only rewrite, 1 worker", root / "input", root / "output", 1, true);
+    run_case("Full decode, " + std::to_string(workers) + " workers", root / "input",
+             root / "output", workers, false);
+    run_case("Header-only rewrite, " + std::to_string(workers) + " workers",
+             root / "input", root / "output", workers, true);
+
+    std::filesystem::remove_all(root);
+    return 0;
+}
@@ -9,16 +9,22 @@
  * - C-ECHO messages per second (single connection)
  * - C-STORE messages per second (single connection)
  * - Sustained throughput over time
+ * - Inline vs pipelined DIMSE dispatch under mixed C-STORE/C-FIND load
  *
  * @see Issue #154 - Establish performance baseline benchmarks for thread migration
  */
 
 #include "benchmark_common.h"
 
+#include "kcenon/pacs/network/pdu_encoder.h"
+#include "kcenon/pacs/network/pipeline/pipeline_coordinator.h"
+#include "kcenon/pacs/network/v2/dicom_association_handler.h"
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
 
 #include <iostream>
+#include <map>
 #include <numeric>
 #include <vector>
 
@@ -359,6 +365,245 @@ TEST_CASE("C-STORE with varying image sizes", "[benchmark][throughput][store][si
     server.stop();
 }
 
+// =============================================================================
+// Inline vs Pipelined DIMSE Dispatch
+// =============================================================================
+
+namespace {
+
+/// Study Root Query/Retrieve Information Model - FIND
+constexpr const char* study_root_find_uid = "1.2.840.10008.5.1.4.1.2.2.1";
+
+/**
+ * @brief SCP that simulates the cost of a storage write and an index query
+ *
+ * Also verifies that each association sees its messages in the order
+ * they were received.
+ */
+class simulated_cost_scp final : public scp_service {
+public:
+    simulated_cost_scp(std::chrono::microseconds store_cost,
+                       std::chrono::microseconds find_cost)
+        : store_cost_(store_cost), find_cost_(find_cost) {}
+
+    [[nodiscard]] std::vector<std::string> supported_sop_classes() const override {
+        return {ct_storage_sop_class_uid, study_root_find_uid};
+    }
+
+    [[nodiscard]] Result<std::monostate> handle_message(
+        association& assoc,
+        uint8_t /*context_id*/,
+        const dimse_message& request) override {
+
+        {
+            std::lock_guard<std::mutex> lock(order_mutex_);
+            auto [it, inserted] = last_message_id_.try_emplace(&assoc, request.message_id());
+            if (!inserted) {
+                if (request.message_id() <= it->second) {
+                    ++out_of_order_;
+                }
+                it->second = request.message_id();
+            }
+        }
+
+        std::this_thread::sleep_for(
+            request.command() == command_field::c_store_rq ? store_cost_ : find_cost_);
+        ++completed_;
+        return std::monostate{};
+    }
+
+    [[nodiscard]] std::string_view service_name() const noexcept override {
+        return "Simulated Cost SCP";
+    }
+
+    [[nodiscard]] size_t completed() const { return completed_.load(); }
+
+    [[nodiscard]] size_t out_of_order() const {
+        std::lock_guard<std::mutex> lock(order_mutex_);
+        return out_of_order_;
+    }
+
+private:
+    std::chrono::microseconds store_cost_;
+    std::chrono::microseconds find_cost_;
+    std::atomic<size_t> completed_{0};
+    mutable std::mutex order_mutex_;
+    std::map<const association*, uint16_t> last_message_id_;
+    size_t out_of_order_{0};
+};
+
+/// Encoded A-ASSOCIATE-RQ proposing CT storage and Study Root FIND
+std::vector<uint8_t> make_mixed_associate_rq(const std::string& calling_ae,
+                                             const std::string& called_ae) {
+    associate_rq rq;
+    rq.calling_ae_title = calling_ae;
+    rq.called_ae_title = called_ae;
+    rq.application_context = "1.2.840.10008.3.1.1.1";
+    rq.presentation_contexts.emplace_back(
+        1, ct_storage_sop_class_uid, std::vector<std::string>{explicit_vr_le});
+    rq.presentation_contexts.emplace_back(
+        3, study_root_find_uid, std::vector<std::string>{explicit_vr_le});
+    rq.user_info.max_pdu_length = 16384;
+    rq.user_info.implementation_class_uid = "1.2.826.0.1.3680043.9.8888.4";
+    return pdu_encoder::encode_associate_rq(rq);
+}
+
+/// Encoded P-DATA-TF carrying one command-only DIMSE message
+std::vector<uint8_t> make_command_pdu(uint8_t context_id, const dimse_message& msg) {
+    auto encoded = dimse_message::encode(
+        msg, kcenon::pacs::encoding::transfer_syntax::explicit_vr_little_endian);
+    return pdu_encoder::encode_p_data_tf(
+        presentation_data_value(context_id, true, true, std::move(encoded.value().first)));
+}
+
+struct mixed_load_result {
+    double feed_seconds{0.0};   ///< Time the I/O threads were busy delivering PDUs
+    double total_seconds{0.0};  ///< Time until every message was executed
+    size_t completed{0};
+    size_t out_of_order{0};
+};
+
+/**
+ * @brief Feed a 3:1 C-STORE/C-FIND mix through association handlers
+ *
+ * A small set of I/O threads delivers PDUs to many associations, as the
+ * network layer does. In inline mode each delivery runs the service on the
+ * I/O thread; in pipelined mode it only queues work on the coordinator.
+ */
+mixed_load_result run_mixed_load(v2::dimse_execution_mode mode,
+                                 size_t associations,
+                                 size_t messages_per_association,
+                                 size_t io_threads) {
+    simulated_cost_scp service(std::chrono::microseconds{2000},
+                               std::chrono::microseconds{500});
+
+    server_config config;
+    config.ae_title = "BENCH_SCP";
+    config.implementation_class_uid = "1.2.826.0.1.3680043.9.8888.1";
+
+    v2::dicom_association_handler::service_map services;
+    for (const auto& uid : service.supported_sop_classes()) {
+        services[uid] = &service;
+    }
+
+    std::shared_ptr<pipeline::pipeline_coordinator> coordinator;
+    if (mode == v2::dimse_execution_mode::pipelined) {
+        pipeline::pipeline_config pipeline_cfg;
+        pipeline_cfg.execution_workers = 8;
+        coordinator = std::make_shared<pipeline::pipeline_coordinator>(pipeline_cfg);
+        if (coordinator->start().is_err()) {
+            return {};
+        }
+    }
+
+    std::vector<std::shared_ptr<v2::dicom_association_handler>> handlers;
+    for (size_t a = 0; a < associations; ++a) {
+        auto handler = std::make_shared<v2::dicom_association_handler>(
+            nullptr, config, services);
+        if (coordinator) {
+            handler->set_pipeline(coordinator);
+        }
+        handler->feed_data(make_mixed_associate_rq(
+            "MIX_" + std::to_string(a), config.ae_title));
+        if (!handler->is_established()) {
+            return {};
+        }
+        handlers.push_back(std::move(handler));
+    }
+
+    // Pre-encode the request stream: every fourth message is a C-FIND
+    std::vector<std::vector<uint8_t>> pdus;
+    for (size_t i = 0; i < messages_per_association; ++i) {
+        const auto message_id = static_cast<uint16_t>(i + 1);
+        if (i % 4 == 3) {
+            pdus.push_back(make_command_pdu(3, make_c_find_rq(message_id, study_root_find_uid)));
+        } else {
+            pdus.push_back(make_command_pdu(
+                1, make_c_store_rq(message_id, ct_storage_sop_class_uid, generate_uid())));
+        }
+    }
+
+    const size_t expected = associations * messages_per_association;
+    high_resolution_timer total_timer;
+    high_resolution_timer feed_timer;
+    total_timer.start();
+    feed_timer.start();
+
+    std::vector<std::thread> io;
+    for (size_t t = 0; t < io_threads; ++t) {
+        io.emplace_back([&, t]() {
+            for (const auto& pdu : pdus) {
+                for (size_t a = t; a < handlers.size(); a += io_threads) {
+                    handlers[a]->feed_data(pdu);
+                }
+            }
+        });
+    }
+    for (auto& thread : io) {
+        thread.join();
+    }
+    feed_timer.stop();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{60};
+    while (service.completed() < expected && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::microseconds{200});
+    }
+    total_timer.stop();
+
+    for (auto& handler : handlers) {
+        handler->stop(false);
+    }
+    if (coordinator) {
+        (void)coordinator->stop();
+    }
+
+    mixed_load_result result;
+    result.feed_seconds = feed_timer.elapsed_seconds();
+    result.total_seconds = total_timer.elapsed_seconds();
+    result.completed = service.completed();
+    result.out_of_order = service.out_of_order();
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("Inline vs pipelined dispatch under mixed load",
+          "[benchmark][throughput][pipeline]") {
+    constexpr size_t associations = 16;
+    constexpr size_t messages_per_association = 60;
+    constexpr size_t io_threads = 4;
+    constexpr size_t expected = associations * messages_per_association;
+
+    auto inline_result = run_mixed_load(v2::dimse_execution_mode::inline_dispatch,
+                                        associations, messages_per_association, io_threads);
+    auto pipelined_result = run_mixed_load(v2::dimse_execution_mode::pipelined,
+                                           associations, messages_per_association, io_threads);
+
+    auto report = [](const char* name, const mixed_load_result& r) {
+        std::cout << "  " << name << ":" << std::endl;
+        std::cout << "    Completed: " << r.completed << std::endl;
+        std::cout << "    I/O thread busy: " << r.feed_seconds * 1000.0 << " ms" << std::endl;
+        std::cout << "    Total time: " << r.total_seconds * 1000.0 << " ms" << std::endl;
+        std::cout << "    Throughput: "
+                  << static_cast<double>(r.completed) / r.total_seconds << " msg/s" << std::endl;
+        std::cout << "    Out of order: " << r.out_of_order << std::endl;
+    };
+
+    std::cout << "\n=== Inline vs Pipelined Dispatch (3:1 C-STORE/C-FIND) ===" << std::endl;
+    std::cout << "  Associations: " << associations << ", I/O threads: " << io_threads
+              << ", messages/association: " << messages_per_association << std::endl;
+    report("Inline", inline_result);
+    report("Pipelined", pipelined_result);
+
+    REQUIRE(inline_result.completed == expected);
+    REQUIRE(pipelined_result.completed == expected);
+    REQUIRE(inline_result.out_of_order == 0);
+    REQUIRE(pipelined_result.out_of_order == 0);
+
+    // Pipelined delivery must not wait for storage/query execution
+    REQUIRE(pipelined_result.feed_seconds < inline_result.feed_seconds);
+}
+
 // =============================================================================
 // Catch2 BENCHMARK macros
 // =============================================================================
@@ -0,0 +1,166 @@
+/**
+ * @file lock_contention_benchmark.cpp
+ * @brief Contention benchmark for study_lock_manager
+ *
+ * Many client threads acquire and release study locks through lock_wait(),
+ * the way routing, PIR and migration workers do:
+ * - hot study: every client wants the same exclusive lock
+ * - many studies: clients pick a random study out of a large set, 80 %
+ *   shared and 20 % exclusive, holding each lock for a short critical section
+ *
+ * The many-studies workload is run with a single shard and with the default
+ * shard count, showing how much of the throughput is lost to a single table
+ * mutex.
+ *
+ * Usage: lock_contention_benchmark [ops_per_client] [clients] [studies]
+ */
+
+#include "kcenon/pacs/workflow/study_lock_manager.h"
+
+#include <kcenon/common/patterns/result.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace kcenon::pacs::workflow;
+using namespace std::chrono_literals;
+
+namespace {
+
+// =============================================================================
+// Measurement
+// =============================================================================
+
+struct run_result {
+    double ops_per_second{0.0};
+    std::size_t failures{0};
+    lock_manager_stats stats;
+};
+
+/// Keep the lock for a few hundred nanoseconds of "work"
+void critical_section(std::uint64_t seed) {
+    volatile std::uint64_t x = seed;
+    for (int i = 0; i < 64; ++i) {
+        x = x * 6364136223846793005u + 1442695040888963407u;
+    }
+}
+
+/**
+ * @brief Run ops_per_client lock/unlock cycles on each client thread
+ * @param pick Returns {study index, type} for an operation
+ */
+template <typename Pick>
+auto measure(study_lock_manager& manager, const std::vector<std::string>& studies,
+             std::size_t clients, std::size_t ops_per_client, Pick pick) -> run_result {
+    std::atomic<std::size_t> failures{0};
+    std::vector<std::thread> workers;
+    workers.reserve(clients);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t c = 0; c < clients; ++c) {
+        workers.emplace_back([&, c]() {
+            std::mt19937_64 rng(c + 1);
+            const auto holder = "client" + std::to_string(c);
+            for (std::size_t i = 0; i < ops_per_client; ++i) {
+                const auto [index, type] = pick(rng);
+                auto token = manager.lock_wait(studies[index], type, "benchmark",
+                                               holder, 10s);
+                if (token.is_err()) {
+                    ++failures;
+                    continue;
+                }
+                critical_section(i);
+                (void)manager.unlock(token.value());
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    const auto elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    run_result result;
+    result.ops_per_second = static_cast<double>(clients * ops_per_client) / elapsed;
+    result.failures = failures.load();
+    result.stats = manager.get_stats();
+    return result;
+}
+
+void report(const std::string& name, const run_result& result) {
+    std::cout << std::left << std::setw(34) << name << std::right << std::fixed
+              << std::setprecision(0) << std::setw(12) << result.ops_per_second
+              << " ops/s  " << std::setw(9) << result.stats.wait_count << " waits  "
+              << std::setw(6) << result.failures << " failed\n";
+}
+
+auto make_config(std::size_t shards) -> study_lock_manager_config {
+    study_lock_manager_config config;
+    config.shard_count = shards;
+    config.default_timeout = 60s;  // every lock goes through the timer wheel
+    return config;
+}
+
+}  // namespace
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char** argv) {
+    const size_t ops = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100'000;
+    size_t clients = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 0;
+    const size_t study_count = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 10'000;
+    if (clients == 0) {
+        clients = std::max(2u, std::thread::hardware_concurrency()) * 2;
+    }
+
+    std::vector<std::string> studies;
+    studies.reserve(study_count);
+    for (size_t i = 0; i < study_count; ++i) {
+        studies.push_back("1.2.840.113619.2.55.3." + std::to_string(1000000 + i));
+    }
+
+    std::cout << "======================================\n";
+    std::cout << "  Study Lock Contention Benchmark\n";
+    std::cout << "======================================\n";
+    std::cout << "Operations per client: " << ops << "\n";
+    std::cout << "Clients: " << clients << "\n";
+    std::cout << "Studies: " << study_count << "\n\n";
+
+    {
+        study_lock_manager manager{make_config(study_lock_manager_config{}.shard_count)};
+        report("hot study, exclusive",
+               measure(manager, studies, clients, ops / 10, [](std::mt19937_64&) {
+                   return std::pair{std::size_t{0}, lock_type::exclusive};
+               }));
+    }
+
+    const auto mixed = [&](std::mt19937_64& rng) {
+        const auto index = static_cast<std::size_t>(rng() % studies.size());
+        const auto type = rng() % 5 == 0 ? lock_type::exclusive : lock_type::shared;
+        return std::pair{index, type};
+    };
+
+    for (const auto shards : {std::size_t{1}, study_lock_manager_config{}.shard_count}) {
+        study_lock_manager manager{make_config(shards)};
+        auto result = measure(manager, studies, clients, ops, mixed);
+        report("many studies, " + std::to_string(shards) + " shard(s)", result);
+
+        if (result.stats.active_locks != 0) {
+            std::cerr << "Locks left behind: " << result.stats.active_locks << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -332,4 +332,44 @@ if(PACS_BUILD_BENCHMARKS)
     else()
         message(STATUS "  [--] simd_performance_benchmarks: OFF (requires pacs_encoding and Catch2)")
     endif()
+
+    # Security Performance Benchmarks (batch de-identification throughput)
+    if(TARGET pacs_security)
+        add_subdirectory(benchmarks/security_performance)
+        message(STATUS "  [OK] anonymization_benchmark: Batch de-identification throughput")
+    else()
+        message(STATUS "  [--] anonymization_benchmark: OFF (requires pacs_security)")
+    endif()
+
+    # Monitoring Performance Benchmarks (latency histogram recording overhead)
+    if(TARGET pacs_monitoring)
+        add_subdirectory(benchmarks/monitoring_performance)
+        message(STATUS "  [OK] latency_histogram_benchmark: Histogram recording overhead")
+    else()
+        message(STATUS "  [--] latency_histogram_benchmark: OFF (requires pacs_monitoring)")
+    endif()
+
+    # Core Performance Benchmarks (dictionary lookup cost per decoded element)
+    if(TARGET pacs_encoding)
+        add_subdirectory(benchmarks/core_performance)
+        message(STATUS "  [OK] dictionary_benchmark: Per-element dictionary lookup and decode cost")
+    else()
+        message(STATUS "  [--] dictionary_benchmark: OFF (requires pacs_encoding)")
+    endif()
+
+    # Workflow Performance Benchmarks (study lock throughput under contention)
+    if(TARGET pacs_workflow)
+        add_subdirectory(benchmarks/workflow_performance)
+        message(STATUS "  [OK] lock_contention_benchmark: Study lock throughput under contention")
+    else()
+        message(STATUS "  [--] lock_contention_benchmark: OFF (requires pacs_workflow)")
+    endif()
+
+    # End-to-end load test (synthetic mixed DIMSE/DICOMweb traffic against a server)
+    if(TARGET pacs_integration AND TARGET pacs_services)
+        add_subdirectory(benchmarks/load_test)
+        message(STATUS "  [OK] pacs_load_test: Mixed DIMSE/DICOMweb load against a running server")
+    else()
+        message(STATUS "  [--] pacs_load_test: OFF (requires pacs_integration and pacs_services)")
+    endif()
 endif()
@@ -43,6 +43,12 @@ option(PACS_BUILD_CODECS "Enable image compression codecs (JPEG, PNG, JPEG2000,
 option(PACS_WITH_OPENSSL "Enable OpenSSL for digital signatures and TLS" ON)
 option(PACS_WITH_REST_API "Enable DICOMweb REST API via Crow HTTP framework" ON)
 
+# DICOM data dictionary source: empty uses the checked-in
+# src/core/standard_tags_data.cpp; a list of DocBook files (part06.xml and
+# part07.xml) regenerates it at build time
+set(PACS_DICOM_DICTIONARY_XML "" CACHE STRING
+    "DICOM PS3.6/PS3.7 DocBook XML files to generate the data dictionary from")
+
 # Prevent mock S3 from being used in Release builds
 if(PACS_USE_MOCK_S3 AND CMAKE_BUILD_TYPE STREQUAL "Release")
     message(FATAL_ERROR "PACS_USE_MOCK_S3 cannot be enabled in Release builds")
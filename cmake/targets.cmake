@@ -2,6 +2,28 @@
 # PACS Libraries
 ##################################################
 
+# Standard tag tables: checked in, or regenerated from the DICOM XML
+set(PACS_STANDARD_TAGS_SOURCE src/core/standard_tags_data.cpp)
+if(PACS_DICOM_DICTIONARY_XML)
+    find_package(Python3 COMPONENTS Interpreter REQUIRED)
+    set(PACS_STANDARD_TAGS_SOURCE
+        ${CMAKE_CURRENT_BINARY_DIR}/generated/standard_tags_data.cpp)
+    add_custom_command(
+        OUTPUT ${PACS_STANDARD_TAGS_SOURCE}
+        COMMAND ${CMAKE_COMMAND} -E make_directory
+            ${CMAKE_CURRENT_BINARY_DIR}/generated
+        COMMAND ${Python3_EXECUTABLE}
+            ${CMAKE_CURRENT_SOURCE_DIR}/scripts/generate_dicom_dictionary.py
+            --xml ${PACS_DICOM_DICTIONARY_XML}
+            -o ${PACS_STANDARD_TAGS_SOURCE}
+        DEPENDS
+            ${CMAKE_CURRENT_SOURCE_DIR}/scripts/generate_dicom_dictionary.py
+            ${PACS_DICOM_DICTIONARY_XML}
+        COMMENT "Generating DICOM data dictionary from ${PACS_DICOM_DICTIONARY_XML}"
+        VERBATIM
+    )
+endif()
+
 # Core library
 add_library(pacs_core
     src/core/dicom_tag.cpp
@@ -9,9 +31,10 @@ add_library(pacs_core
     src/core/dicom_dataset.cpp
     src/core/dicom_file.cpp
     src/core/memory_mapped_file.cpp
+    src/core/frame_index.cpp
     src/core/tag_info.cpp
     src/core/dicom_dictionary.cpp
-    src/core/standard_tags_data.cpp
+    ${PACS_STANDARD_TAGS_SOURCE}
     src/core/pool_manager.cpp
     src/core/private_tag_registry.cpp
 )
@@ -55,6 +78,7 @@ add_library(pacs_encoding
     src/encoding/implicit_vr_codec.cpp
     src/encoding/explicit_vr_codec.cpp
     src/encoding/explicit_vr_big_endian_codec.cpp
+    src/encoding/dataset_encoder.cpp
     src/encoding/character_set.cpp
     src/encoding/dataset_charset.cpp
     src/encoding/compression/jpeg_baseline_codec.cpp
@@ -65,8 +89,11 @@ add_library(pacs_encoding
     src/encoding/compression/jpeg2000_codec.cpp
     src/encoding/compression/jpeg_ls_codec.cpp
     src/encoding/compression/jpegxl_codec.cpp
+    src/encoding/compression/compression_codec.cpp
     src/encoding/compression/rle_codec.cpp
     src/encoding/compression/codec_factory.cpp
+    src/encoding/compression/encapsulated_pixel_data.cpp
+    src/encoding/compression/pixel_data_transcoder.cpp
 )
 target_include_directories(pacs_encoding
     PUBLIC
@@ -190,6 +217,7 @@ add_library(pacs_network
     src/network/pdu_encoder.cpp
     src/network/pdu_decoder.cpp
     src/network/pdu_buffer_pool.cpp
+    src/network/p_data_fragmenter.cpp
     src/network/association.cpp
     src/network/dicom_server.cpp
     src/network/dimse/dimse_message.cpp
@@ -398,6 +426,8 @@ add_library(pacs_services
     src/services/cache/query_result_stream.cpp
     src/services/cache/streaming_query_handler.cpp
     src/services/cache/parallel_query_executor.cpp
+    src/services/transcoding/transcode_cache.cpp
+    src/services/transcoding/transcoding_service.cpp
 )
 
 # Add monitoring sources conditionally (use TARGET check, not CMake variable)
@@ -461,6 +491,7 @@ set(PACS_SECURITY_SOURCES
     src/security/tag_action.cpp
     src/security/uid_mapping.cpp
     src/security/anonymizer.cpp
+    src/security/batch_anonymizer.cpp
     src/security/atna_audit_logger.cpp
     src/security/atna_syslog_transport.cpp
     src/security/atna_service_auditor.cpp
@@ -520,6 +551,13 @@ if(PACS_BUILD_STORAGE AND SQLITE3_FOUND)
         src/storage/azure_blob_storage.cpp
         src/storage/hsm_storage.cpp
         src/storage/hsm_migration_service.cpp
+        src/storage/compression_policy.cpp
+        src/storage/compressing_storage.cpp
+        src/storage/content_hash.cpp
+        src/storage/study_digest.cpp
+        src/storage/access_tracker.cpp
+        src/storage/caching_storage.cpp
+        src/storage/parallel_transfer.cpp
         src/storage/sqlite_security_storage.cpp
         src/storage/migration_runner.cpp
         src/storage/index_database.cpp
@@ -550,6 +588,8 @@ if(PACS_BUILD_STORAGE AND SQLITE3_FOUND)
         src/storage/pacs_database_adapter.cpp
         src/storage/repository_factory.cpp
         src/storage/commitment_repository.cpp
+        src/storage/fixity_scrubber.cpp
+        src/storage/retention_engine.cpp
     )
     target_include_directories(pacs_storage
         PUBLIC
@@ -714,6 +754,7 @@ if(TARGET pacs_storage)
     add_library(pacs_monitoring
         src/monitoring/health_checker.cpp
         src/monitoring/pacs_metrics.cpp
+        src/monitoring/request_tracer.cpp
     )
     target_include_directories(pacs_monitoring
         PUBLIC
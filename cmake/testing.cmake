@@ -54,6 +54,7 @@ if(PACS_BUILD_TESTS)
         tests/core/dicom_dictionary_test.cpp
         tests/core/events_test.cpp
         tests/core/private_tag_registry_test.cpp
+        tests/core/frame_index_test.cpp
     )
     target_link_libraries(core_tests
         PRIVATE
@@ -84,6 +85,7 @@ if(PACS_BUILD_TESTS)
         tests/encoding/explicit_vr_codec_test.cpp
         tests/encoding/byte_swap_test.cpp
         tests/encoding/explicit_vr_big_endian_codec_test.cpp
+        tests/encoding/dataset_encoder_test.cpp
         tests/encoding/compression/jpeg_baseline_codec_test.cpp
         tests/encoding/compression/jpeg_lossless_codec_test.cpp
         tests/encoding/compression/frame_deflate_codec_test.cpp
@@ -93,6 +95,7 @@ if(PACS_BUILD_TESTS)
         tests/encoding/compression/jpeg_ls_codec_test.cpp
         tests/encoding/compression/jpegxl_codec_test.cpp
         tests/encoding/compression/rle_codec_test.cpp
+        tests/encoding/compression/encapsulated_pixel_data_test.cpp
         tests/encoding/simd/simd_rle_test.cpp
         tests/encoding/character_set_test.cpp
     )
@@ -106,6 +109,7 @@ if(PACS_BUILD_TESTS)
     add_executable(network_tests
         tests/network/pdu_encoder_test.cpp
         tests/network/pdu_decoder_test.cpp
+        tests/network/p_data_fragmenter_test.cpp
         tests/network/association_test.cpp
         tests/network/dicom_server_test.cpp
         tests/network/dimse/dimse_message_test.cpp
@@ -189,6 +193,7 @@ if(PACS_BUILD_TESTS)
         tests/services/cache/query_cache_test.cpp
         tests/services/cache/streaming_query_test.cpp
         tests/services/cache/parallel_query_executor_test.cpp
+        tests/services/transcoding/transcoding_service_test.cpp
     )
 
     # Add monitoring tests conditionally (use TARGET check, not CMake variable)
@@ -218,6 +223,7 @@ if(PACS_BUILD_TESTS)
         tests/security/sqlite_security_storage_test.cpp
         tests/security/uid_mapping_test.cpp
         tests/security/anonymizer_test.cpp
+        tests/security/batch_anonymizer_test.cpp
         tests/security/atna_audit_logger_test.cpp
         tests/security/atna_syslog_transport_test.cpp
         tests/security/atna_service_auditor_test.cpp
@@ -250,6 +256,13 @@ if(PACS_BUILD_TESTS)
             tests/storage/s3_storage_test.cpp
             tests/storage/azure_blob_storage_test.cpp
             tests/storage/hsm_storage_test.cpp
+            tests/storage/compressing_storage_test.cpp
+            tests/storage/content_hash_test.cpp
+            tests/storage/fixity_scrubber_test.cpp
+            tests/storage/retention_engine_test.cpp
+            tests/storage/access_tracker_test.cpp
+            tests/storage/caching_storage_test.cpp
+            tests/storage/parallel_transfer_test.cpp
             tests/storage/migration_runner_test.cpp
             tests/storage/index_database_test.cpp
             tests/storage/mpps_test.cpp
@@ -328,6 +341,8 @@ if(PACS_BUILD_TESTS)
             tests/monitoring/health_checker_test.cpp
             tests/monitoring/health_json_test.cpp
             tests/monitoring/pacs_metrics_test.cpp
+            tests/monitoring/latency_histogram_test.cpp
+            tests/monitoring/request_tracer_test.cpp
             tests/monitoring/collectors_test.cpp
         )
         target_link_libraries(monitoring_tests
@@ -277,6 +277,8 @@ bool pacs_server_app::setup_server() {
         [this](const auto& keys) {
             return handle_retrieve(keys);
         });
+    // Convert instances whose stored transfer syntax the peer did not accept
+    retrieve_scp->set_transcoder(std::make_shared<services::transcoding_service>());
     server_->register_service(retrieve_scp);
 
     // Register Worklist SCP
@@ -438,15 +440,17 @@ services::storage_status pacs_server_app::handle_store(
             } catch (...) {}
         }
 
-        auto instance_result = database_->upsert_instance(
-            series_pk,
-            sop_instance_uid,
-            sop_class_uid,
-            file_path.string(),
-            file_size,
-            "",  // transfer_syntax
-            instance_number
-        );
+        storage::instance_record instance;
+        instance.series_pk = series_pk;
+        instance.sop_uid = sop_instance_uid;
+        instance.sop_class_uid = sop_class_uid;
+        instance.file_path = file_path.string();
+        instance.file_size = file_size;
+        instance.instance_number = instance_number;
+        // Hashed while the file was written; verified by the fixity scrubber
+        instance.file_hash = file_storage_->get_file_hash(sop_instance_uid);
+
+        auto instance_result = database_->upsert_instance(instance);
         if (instance_result.is_err()) {
             std::cerr << log_prefix() << "Database error (instance)\n";
         }
@@ -21,6 +21,7 @@
 #include "kcenon/pacs/services/query_scp.h"
 #include "kcenon/pacs/services/retrieve_scp.h"
 #include "kcenon/pacs/services/storage_scp.h"
+#include "kcenon/pacs/services/transcoding/transcoding_service.h"
 #include "kcenon/pacs/services/verification_scp.h"
 #include "kcenon/pacs/services/worklist_scp.h"
 #include "kcenon/pacs/storage/file_storage.h"
@@ -20,10 +20,13 @@
 #include "kcenon/pacs/client/sync_types.h"
 #include "kcenon/pacs/core/result.h"
 #include "kcenon/pacs/di/ilogger.h"
+#include "kcenon/pacs/storage/study_digest.h"
 
 #include <atomic>
+#include <functional>
 #include <future>
 #include <memory>
+#include <optional>
 #include <shared_mutex>
 #include <string>
 #include <string_view>
@@ -31,6 +34,7 @@
 
 // Forward declarations
 namespace kcenon::pacs::storage {
+class index_database;
 class sync_repository;
 class sync_config_repository;
 class sync_conflict_repository;
@@ -53,6 +57,32 @@ struct sync_repositories {
     std::shared_ptr<storage::sync_history_repository> history;
 };
 
+/**
+ * @brief Access to a remote node's study digest tree
+ *
+ * With a provider and a local index_database, a sync compares the digest
+ * trees of both sides and lists only the studies of buckets that differ.
+ * Either function returns std::nullopt when the node cannot answer; if the
+ * root cannot be fetched, the sync falls back to a study-level C-FIND of
+ * the whole window.
+ *
+ * @see storage::study_digest_node
+ */
+struct sync_digest_provider {
+    /// Children of a node of the remote tree, sorted by key, as
+    /// index_database::study_digest_children returns them
+    std::function<std::optional<std::vector<storage::study_digest_node>>(
+        const std::string& node_id, const std::string& parent_key,
+        const storage::study_digest_scope& scope)>
+        children;
+
+    /// Studies of a remote bucket; when unset, the bucket is listed with a
+    /// C-FIND on its StudyDate and ModalitiesInStudy
+    std::function<std::optional<std::vector<storage::study_digest_entry>>(
+        const std::string& node_id, const std::string& bucket_key)>
+        members;
+};
+
 // =============================================================================
 // Sync Manager
 // =============================================================================
@@ -63,6 +93,7 @@ struct sync_repositories {
  * Provides synchronization capabilities with:
  * - Incremental sync based on timestamps
  * - Full sync for initial setup
+ * - Digest-based reconciliation that queries only differing buckets
  * - Conflict detection and resolution
  * - Scheduled sync jobs via cron expressions
  * - Statistics tracking per config
@@ -432,6 +463,27 @@ public:
      */
     void set_conflict_callback(sync_conflict_callback callback);
 
+    // =========================================================================
+    // Reconciliation
+    // =========================================================================
+
+    /**
+     * @brief Set the local study index compared against remote nodes
+     *
+     * Without it every remote study is treated as missing locally.
+     *
+     * @param database Local index database (nullptr to detach)
+     */
+    void set_local_database(std::shared_ptr<storage::index_database> database);
+
+    /**
+     * @brief Set the source of remote study digest trees
+     *
+     * @param provider Digest access for remote nodes (empty to compare by
+     * full C-FIND only)
+     */
+    void set_digest_provider(sync_digest_provider provider);
+
     // =========================================================================
     // Configuration
     // =========================================================================
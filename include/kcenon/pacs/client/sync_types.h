@@ -264,6 +264,7 @@ struct sync_result {
     size_t studies_skipped{0};       ///< Studies skipped
     size_t instances_transferred{0}; ///< Individual instances transferred
     size_t bytes_transferred{0};     ///< Total bytes transferred
+    size_t buckets_reconciled{0};    ///< Digest buckets listed (0 = full comparison)
 
     // =========================================================================
     // Issues
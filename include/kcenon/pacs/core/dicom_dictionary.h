@@ -7,9 +7,11 @@
  * @brief DICOM Data Dictionary for tag metadata lookup
  *
  * This file defines the dicom_dictionary class which provides O(1) lookup
- * for DICOM tag metadata as specified in DICOM PS3.6. The dictionary is
- * implemented as a thread-safe singleton with support for private tag
- * registration at runtime.
+ * for DICOM tag metadata as specified in DICOM PS3.6. Standard tags come
+ * from compile-time perfect hash tables generated from the full registry
+ * (see scripts/generate_dicom_dictionary.py); private tags registered at
+ * runtime live in a copy-on-grow overlay. Neither path takes a lock on
+ * lookup.
  *
  * @see DICOM PS3.6 - Data Dictionary
  * @author kcenon
@@ -21,12 +23,14 @@
 #include "dicom_tag.h"
 #include "tag_info.h"
 
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <optional>
-#include <shared_mutex>
 #include <span>
 #include <string_view>
-#include <unordered_map>
 #include <vector>
 
 namespace kcenon::pacs::core {
@@ -39,7 +43,8 @@ namespace kcenon::pacs::core {
  * PS3.6 and supports runtime registration of private tags.
  *
  * Thread Safety:
- * - Read operations (lookup) are thread-safe and can be concurrent
+ * - Read operations are lock-free and can run concurrently with each
+ *   other and with register_private_tag()
  * - Write operations (register_private_tag) are serialized
  *
  * @example
@@ -78,12 +83,32 @@ public:
     auto operator=(const dicom_dictionary&) -> dicom_dictionary& = delete;
     auto operator=(dicom_dictionary&&) -> dicom_dictionary& = delete;
 
+    /**
+     * @brief Look up tag metadata by DICOM tag without copying it
+     * @param tag The DICOM tag to look up
+     * @return Pointer to the entry, or nullptr if the tag is unknown
+     *
+     * Entries are never removed, so the pointer stays valid for the life
+     * of the program. This is the per-element path used by the decoders:
+     * one perfect hash probe for standard tags, a short lock-free probe of
+     * the private overlay for private tags.
+     */
+    [[nodiscard]] auto lookup(dicom_tag tag) const noexcept -> const tag_info*;
+
+    /**
+     * @brief Look up tag metadata by keyword without copying it
+     * @param keyword The tag keyword (e.g., "PatientName")
+     * @return Pointer to the entry, or nullptr if the keyword is unknown
+     */
+    [[nodiscard]] auto lookup_keyword(std::string_view keyword) const noexcept
+        -> const tag_info*;
+
     /**
      * @brief Find tag metadata by DICOM tag
      * @param tag The DICOM tag to look up
      * @return Optional containing tag_info if found, nullopt otherwise
      *
-     * O(1) average time complexity using hash table lookup.
+     * O(1) time complexity; see lookup() for the non-copying variant.
      * Thread-safe for concurrent reads.
      */
     [[nodiscard]] auto find(dicom_tag tag) const -> std::optional<tag_info>;
@@ -93,7 +118,7 @@ public:
      * @param keyword The tag keyword (e.g., "PatientName")
      * @return Optional containing tag_info if found, nullopt otherwise
      *
-     * O(1) average time complexity using hash table lookup.
+     * O(1) time complexity; see lookup_keyword() for the non-copying variant.
      * Thread-safe for concurrent reads.
      */
     [[nodiscard]] auto find_by_keyword(std::string_view keyword) const
@@ -134,7 +159,8 @@ public:
      * @return true if registration succeeded, false if tag already exists
      *
      * Only private tags (odd group numbers > 0x0008) can be registered.
-     * Thread-safe, serializes write operations.
+     * Thread-safe, serializes write operations. The keyword and name views
+     * are stored as given and must outlive the dictionary.
      */
     auto register_private_tag(const tag_info& info) -> bool;
 
@@ -165,27 +191,33 @@ public:
         -> std::vector<tag_info>;
 
 private:
+    /// Open-addressing table of private tags, replaced when it fills up
+    struct private_table;
+
     /**
-     * @brief Private constructor - initializes with standard tags
+     * @brief Private constructor - standard tags need no initialization
      */
     dicom_dictionary();
 
-    /**
-     * @brief Initialize the dictionary with standard PS3.6 tags
-     */
-    void initialize_standard_tags();
+    ~dicom_dictionary();
+
+    /// Insert an entry into a table that has room for it (writer only)
+    static void insert_private(private_table& table, const tag_info* entry);
+
+    /// Current private tag table; nullptr until the first registration
+    std::atomic<const private_table*> private_table_{nullptr};
 
-    /// Hash map for O(1) lookup by tag
-    std::unordered_map<dicom_tag, tag_info> tag_map_;
+    /// Number of registered private tags
+    std::atomic<size_t> private_count_{0};
 
-    /// Hash map for O(1) lookup by keyword
-    std::unordered_map<std::string_view, dicom_tag> keyword_map_;
+    /// Owner of the current table (which owns the ones it replaced)
+    std::unique_ptr<private_table> private_owner_;
 
-    /// Count of standard tags (vs private)
-    size_t standard_count_{0};
+    /// Registered private tags; a deque so published pointers stay valid
+    std::deque<tag_info> private_entries_;
 
-    /// Mutex for thread-safe private tag registration
-    mutable std::shared_mutex mutex_;
+    /// Serializes private tag registration
+    mutable std::mutex write_mutex_;
 };
 
 }  // namespace kcenon::pacs::core
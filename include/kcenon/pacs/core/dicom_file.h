@@ -29,8 +29,29 @@
 #include <string_view>
 #include <vector>
 
+namespace kcenon::pacs::encoding {
+class byte_sink;
+}  // namespace kcenon::pacs::encoding
+
 namespace kcenon::pacs::core {
 
+/**
+ * @brief Header of an encoded Part 10 object
+ *
+ * Everything in front of the main dataset, so stored bytes can be
+ * forwarded without decoding the dataset itself.
+ */
+struct part10_header {
+    /// File Meta Information (group 0002)
+    dicom_dataset meta_info;
+
+    /// Transfer Syntax of the main dataset
+    encoding::transfer_syntax transfer_syntax;
+
+    /// Offset of the first byte of the main dataset
+    size_t dataset_offset{0};
+};
+
 /**
  * @brief Represents a DICOM Part 10 file
  *
@@ -87,6 +108,18 @@ public:
     [[nodiscard]] static auto from_bytes(std::span<const uint8_t> data)
         -> kcenon::pacs::Result<dicom_file>;
 
+    /**
+     * @brief Parse only the preamble and File Meta Information
+     * @param data Raw byte data of the DICOM file (at least the header)
+     * @return Meta information, Transfer Syntax and dataset offset, or an
+     *         error if the bytes are not a Part 10 file
+     *
+     * data.subspan(dataset_offset) is the main dataset exactly as encoded
+     * in the returned Transfer Syntax.
+     */
+    [[nodiscard]] static auto read_header(std::span<const uint8_t> data)
+        -> kcenon::pacs::Result<part10_header>;
+
     // ========================================================================
     // Static Factory Methods (Creation)
     // ========================================================================
@@ -117,13 +150,54 @@ public:
      * @brief Save the DICOM file to disk
      * @param path Destination file path
      * @return Result indicating success or failure
+     *
+     * The file is streamed to disk; large values such as Pixel Data are
+     * written straight from the dataset without an intermediate buffer.
      */
     [[nodiscard]] auto save(const std::filesystem::path& path) const
         -> kcenon::pacs::VoidResult;
 
+    /**
+     * @brief Save a dataset as a Part 10 file without building a dicom_file
+     * @param path Destination file path
+     * @param dataset The main dataset (SOP Class UID and Instance UID required)
+     * @param ts The transfer syntax to use for encoding
+     * @return Result indicating success or failure
+     *
+     * Equivalent to create(dataset, ts).save(path) but never copies the
+     * dataset.
+     */
+    [[nodiscard]] static auto save_dataset(const std::filesystem::path& path,
+                                           const dicom_dataset& dataset,
+                                           const encoding::transfer_syntax& ts)
+        -> kcenon::pacs::VoidResult;
+
+    /**
+     * @brief Stream a dataset as a Part 10 file into a byte sink
+     * @param sink Destination of the encoded bytes
+     * @param dataset The main dataset (SOP Class UID and Instance UID required)
+     * @param ts The transfer syntax to use for encoding
+     * @return The first error reported by the sink, if any
+     *
+     * The sink counterpart of save_dataset().
+     */
+    [[nodiscard]] static auto write_dataset(encoding::byte_sink& sink,
+                                            const dicom_dataset& dataset,
+                                            const encoding::transfer_syntax& ts)
+        -> kcenon::pacs::VoidResult;
+
+    /**
+     * @brief Stream the encoded file into a byte sink
+     * @param sink Destination of the encoded bytes
+     * @return The first error reported by the sink, if any
+     */
+    [[nodiscard]] auto write_to(encoding::byte_sink& sink) const
+        -> kcenon::pacs::VoidResult;
+
     /**
      * @brief Encode the DICOM file to raw bytes
-     * @return Vector containing the encoded file data
+     * @return Vector containing the encoded file data, allocated once at its
+     *         exact size
      */
     [[nodiscard]] auto to_bytes() const -> std::vector<uint8_t>;
 
@@ -238,12 +312,18 @@ private:
         -> dicom_dataset;
 
     /**
-     * @brief Encode a dataset using Explicit VR Little Endian
-     * @param dataset The dataset to encode
-     * @return Encoded byte data
+     * @brief Stream preamble, DICM prefix, meta information and dataset
+     * @param sink Destination of the encoded bytes
+     * @param meta_info File Meta Information (always Explicit VR LE)
+     * @param dataset The main dataset
+     * @param ts The Transfer Syntax of the main dataset
+     * @return The first error reported by the sink, if any
      */
-    [[nodiscard]] static auto encode_explicit_vr_le(const dicom_dataset& dataset)
-        -> std::vector<uint8_t>;
+    [[nodiscard]] static auto write_part10(encoding::byte_sink& sink,
+                                           const dicom_dataset& meta_info,
+                                           const dicom_dataset& dataset,
+                                           const encoding::transfer_syntax& ts)
+        -> kcenon::pacs::VoidResult;
 
     /**
      * @brief Decode a dataset from Explicit VR Little Endian format
@@ -277,22 +357,6 @@ private:
         std::span<const uint8_t> data, size_t& bytes_read)
         -> kcenon::pacs::Result<dicom_dataset>;
 
-    /**
-     * @brief Encode a dataset using Implicit VR Little Endian
-     * @param dataset The dataset to encode
-     * @return Encoded byte data
-     */
-    [[nodiscard]] static auto encode_implicit_vr_le(const dicom_dataset& dataset)
-        -> std::vector<uint8_t>;
-
-    /**
-     * @brief Encode a dataset using Explicit VR Big Endian
-     * @param dataset The dataset to encode
-     * @return Encoded byte data
-     */
-    [[nodiscard]] static auto encode_explicit_vr_be(const dicom_dataset& dataset)
-        -> std::vector<uint8_t>;
-
     /**
      * @brief Decode a dataset based on its Transfer Syntax
      * @param data The raw byte data
@@ -306,17 +370,6 @@ private:
         size_t& bytes_read)
         -> kcenon::pacs::Result<dicom_dataset>;
 
-    /**
-     * @brief Encode a dataset based on its Transfer Syntax
-     * @param dataset The dataset to encode
-     * @param ts The Transfer Syntax to use for encoding
-     * @return Encoded byte data
-     */
-    [[nodiscard]] static auto encode_dataset(
-        const dicom_dataset& dataset,
-        const encoding::transfer_syntax& ts)
-        -> std::vector<uint8_t>;
-
     /**
      * @brief Parse a sequence with undefined length
      * @param data The raw byte data starting at sequence value
@@ -0,0 +1,245 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file frame_index.h
+ * @brief Byte-range index of Pixel Data frames for random frame access
+ *
+ * Provides the frame_index class which maps each frame of a stored DICOM
+ * instance to the byte ranges holding it inside the Part 10 file. With the
+ * index, a single frame of a large multi-frame object (whole slide imaging,
+ * cine loops, enhanced CT/MR) can be read without parsing or copying the
+ * rest of the Pixel Data.
+ *
+ * @see DICOM PS3.5 Annex A.4 - Transfer Syntaxes for Encapsulation
+ * @see DICOM PS3.3 Section C.7.6.3.1.8 - Extended Offset Table
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include "memory_mapped_file.h"
+#include "result.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace kcenon::pacs::core {
+
+/**
+ * @brief Byte range of one Pixel Data fragment (or native frame)
+ */
+struct fragment_range {
+    /// Offset of the first value byte, relative to the indexed buffer
+    std::uint64_t offset{0};
+
+    /// Length of the value in bytes
+    std::uint32_t length{0};
+};
+
+/**
+ * @brief Position of the top-level Pixel Data element in a Part 10 file
+ */
+struct pixel_data_location {
+    /// Transfer Syntax UID from the File Meta Information
+    std::string transfer_syntax_uid;
+
+    /// Offset of the Pixel Data element tag
+    std::uint64_t element_offset{0};
+
+    /// Offset of the first value byte
+    std::uint64_t value_offset{0};
+
+    /// Offset just past the element (after the Sequence Delimitation Item
+    /// for encapsulated Pixel Data)
+    std::uint64_t element_end{0};
+
+    /// Whether the value has undefined length (encapsulated)
+    bool encapsulated{false};
+};
+
+/**
+ * @brief Frame to byte-range mapping for a stored instance
+ *
+ * For encapsulated transfer syntaxes each frame maps to one or more
+ * fragment value ranges. Frame boundaries are taken from the Extended
+ * Offset Table, the Basic Offset Table, a one-fragment-per-frame layout, or
+ * JPEG end-of-image markers, in that order. For native transfer syntaxes
+ * each frame is a single contiguous range.
+ *
+ * The index is computed once (by walking element headers of a memory-mapped
+ * file) and can be persisted in a small sidecar file next to the instance.
+ * Frame numbers are 1-based, as in DICOM.
+ *
+ * @example
+ * @code
+ * auto index = frame_index::load_or_build("/storage/1.2.3.dcm");
+ * if (index.is_ok()) {
+ *     auto frame = index.value().read_frame("/storage/1.2.3.dcm", 120);
+ * }
+ * @endcode
+ */
+class frame_index {
+public:
+    frame_index() = default;
+
+    // =========================================================================
+    // Construction
+    // =========================================================================
+
+    /**
+     * @brief Index the Pixel Data of a Part 10 file
+     *
+     * Only element headers are inspected; Pixel Data values are skipped
+     * except for the few bytes needed to delimit frames.
+     *
+     * @param path DICOM Part 10 file
+     * @return Frame index or error
+     */
+    [[nodiscard]] static auto build(const std::filesystem::path& path)
+        -> kcenon::pacs::Result<frame_index>;
+
+    /**
+     * @brief Index an in-memory encapsulated Pixel Data value
+     *
+     * @param value Value of the encapsulated Pixel Data element
+     * @param number_of_frames Number of Frames (0028,0008)
+     * @param base_offset Offset added to every recorded range
+     * @param extended_offsets Extended Offset Table (7FE0,0001), if any
+     * @param extended_lengths Extended Offset Table Lengths (7FE0,0002), if any
+     * @return Frame index or error when frames cannot be delimited
+     */
+    [[nodiscard]] static auto from_encapsulated(
+        std::span<const std::uint8_t> value,
+        std::uint32_t number_of_frames,
+        std::uint64_t base_offset = 0,
+        std::span<const std::uint64_t> extended_offsets = {},
+        std::span<const std::uint64_t> extended_lengths = {})
+        -> kcenon::pacs::Result<frame_index>;
+
+    /**
+     * @brief Locate the top-level Pixel Data element of a Part 10 buffer
+     *
+     * Walks element headers only, like build(). Lets callers rewrite the
+     * attributes preceding Pixel Data while copying the Pixel Data bytes
+     * through unchanged.
+     *
+     * @param data Complete Part 10 file contents
+     * @return Location, or error for malformed files, files without Pixel
+     *         Data, and deflated or big endian transfer syntaxes
+     */
+    [[nodiscard]] static auto locate_pixel_data(std::span<const std::uint8_t> data)
+        -> kcenon::pacs::Result<pixel_data_location>;
+
+    // =========================================================================
+    // Persistence
+    // =========================================================================
+
+    /**
+     * @brief Sidecar path used to persist the index of an instance
+     * @param instance_path Path of the DICOM file
+     * @return instance_path with ".fidx" appended
+     */
+    [[nodiscard]] static auto sidecar_path(const std::filesystem::path& instance_path)
+        -> std::filesystem::path;
+
+    /**
+     * @brief Write the index to a file
+     * @param path Destination (usually sidecar_path())
+     */
+    [[nodiscard]] auto save(const std::filesystem::path& path) const
+        -> kcenon::pacs::VoidResult;
+
+    /**
+     * @brief Read an index previously written by save()
+     * @param path Index file
+     */
+    [[nodiscard]] static auto load(const std::filesystem::path& path)
+        -> kcenon::pacs::Result<frame_index>;
+
+    /**
+     * @brief Load the sidecar index of an instance, building it if needed
+     *
+     * The sidecar is rebuilt when missing or when it was computed for a
+     * file of a different size (the instance was replaced).
+     *
+     * @param instance_path Path of the DICOM file
+     * @return Frame index or error
+     */
+    [[nodiscard]] static auto load_or_build(const std::filesystem::path& instance_path)
+        -> kcenon::pacs::Result<frame_index>;
+
+    // =========================================================================
+    // Access
+    // =========================================================================
+
+    /// Number of indexed frames
+    [[nodiscard]] auto frame_count() const noexcept -> std::uint32_t;
+
+    /// Transfer Syntax UID of the indexed file
+    [[nodiscard]] auto transfer_syntax_uid() const noexcept -> const std::string&;
+
+    /// Whether frames are encapsulated fragments rather than native pixels
+    [[nodiscard]] auto is_encapsulated() const noexcept -> bool;
+
+    /**
+     * @brief Byte ranges holding a frame
+     * @param frame_number 1-based frame number
+     * @return Ranges in file order, empty when out of range
+     */
+    [[nodiscard]] auto fragments(std::uint32_t frame_number) const
+        -> std::span<const fragment_range>;
+
+    /**
+     * @brief Total size of a frame in bytes
+     * @param frame_number 1-based frame number
+     */
+    [[nodiscard]] auto frame_size(std::uint32_t frame_number) const -> std::uint64_t;
+
+    /**
+     * @brief Copy one frame out of a mapped file
+     * @param file Mapped instance the index was built from
+     * @param frame_number 1-based frame number
+     * @return Frame bytes (concatenated fragments) or error
+     */
+    [[nodiscard]] auto read_frame(const memory_mapped_file& file,
+                                  std::uint32_t frame_number) const
+        -> kcenon::pacs::Result<std::vector<std::uint8_t>>;
+
+    /**
+     * @brief Read one frame from the instance file
+     *
+     * Maps the file and copies only the frame's byte ranges; the rest of
+     * the Pixel Data is never touched.
+     *
+     * @param path Instance the index was built from
+     * @param frame_number 1-based frame number
+     * @return Frame bytes or error
+     */
+    [[nodiscard]] auto read_frame(const std::filesystem::path& path,
+                                  std::uint32_t frame_number) const
+        -> kcenon::pacs::Result<std::vector<std::uint8_t>>;
+
+private:
+    /// Transfer Syntax UID of the indexed file
+    std::string transfer_syntax_uid_;
+
+    /// Size of the indexed file (used to detect stale sidecars)
+    std::uint64_t source_size_{0};
+
+    bool encapsulated_{false};
+
+    /// All ranges in file order
+    std::vector<fragment_range> ranges_;
+
+    /// Frame i owns ranges_[frame_begin_[i], frame_begin_[i + 1])
+    std::vector<std::uint32_t> frame_begin_;
+};
+
+}  // namespace kcenon::pacs::core
@@ -15,6 +15,7 @@
 #include "kcenon/pacs/encoding/transfer_syntax.h"
 #include <kcenon/pacs/core/result.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <span>
@@ -22,6 +23,10 @@
 #include <string_view>
 #include <vector>
 
+namespace kcenon::pacs::integration {
+class thread_pool_interface;
+}  // namespace kcenon::pacs::integration
+
 namespace kcenon::pacs::encoding::compression {
 
 /**
@@ -61,6 +66,21 @@ struct compression_result {
     image_params output_params;
 };
 
+/**
+ * @brief Parallelism settings for multi-frame batch operations.
+ *
+ * Frames are split into contiguous chunks; each chunk is processed by one
+ * worker that owns a private clone of the codec for the whole chunk.
+ */
+struct frame_parallel_options {
+    /// Maximum number of concurrent workers (0 = pool size + 1, or
+    /// hardware concurrency when no pool is given)
+    std::size_t max_workers{0};
+
+    /// Worker pool (nullptr = std::async helpers)
+    std::shared_ptr<integration::thread_pool_interface> thread_pool;
+};
+
 /**
  * @brief Result type alias for compression operations using kcenon::pacs::Result<T> pattern
  */
@@ -118,6 +138,12 @@ public:
      */
     [[nodiscard]] virtual bool can_decode(const image_params& params) const noexcept = 0;
 
+    /**
+     * @brief Creates an independent codec with the same configuration.
+     * @return A new instance that encodes and decodes exactly like this one
+     */
+    [[nodiscard]] virtual std::unique_ptr<compression_codec> clone() const = 0;
+
     /// @}
 
     /// @name Compression Operations
@@ -158,6 +184,48 @@ public:
 
     /// @}
 
+    /// @name Multi-frame Batch Operations
+    /// @{
+
+    /**
+     * @brief Compresses every frame of a multi-frame image in parallel.
+     *
+     * @param pixel_data Native pixel data holding params.number_of_frames
+     *                   consecutive frames
+     * @param params Image parameters describing a single frame
+     * @param options Compression settings
+     * @param parallel Worker pool and concurrency limit
+     * @return codec_result whose data is the value of an encapsulated Pixel
+     *         Data element: a Basic Offset Table, one fragment per frame and
+     *         a Sequence Delimitation Item
+     *
+     * The calling thread uses this codec instance; helper workers use a
+     * clone(), so every frame is encoded with the same settings and the
+     * call is safe as long as this instance is not used concurrently
+     * elsewhere.
+     */
+    [[nodiscard]] codec_result encode_frames(
+        std::span<const uint8_t> pixel_data,
+        const image_params& params,
+        const compression_options& options = {},
+        const frame_parallel_options& parallel = {}) const;
+
+    /**
+     * @brief Decompresses every frame of encapsulated pixel data in parallel.
+     *
+     * @param encapsulated_data Value of the encapsulated Pixel Data element
+     * @param params Image parameters; number_of_frames selects the frame count
+     * @param parallel Worker pool and concurrency limit
+     * @return codec_result whose data holds all decoded frames back to back
+     *         in a single pre-sized buffer
+     */
+    [[nodiscard]] codec_result decode_frames(
+        std::span<const uint8_t> encapsulated_data,
+        const image_params& params,
+        const frame_parallel_options& parallel = {}) const;
+
+    /// @}
+
 protected:
     compression_codec() = default;
     compression_codec(const compression_codec&) = default;
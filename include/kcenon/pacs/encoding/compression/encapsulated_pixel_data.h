@@ -0,0 +1,66 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file encapsulated_pixel_data.h
+ * @brief Helpers for splitting and building encapsulated Pixel Data
+ *
+ * Encapsulated (compressed) Pixel Data is stored as a sequence of items:
+ * a Basic Offset Table item followed by one or more fragment items and a
+ * Sequence Delimitation Item. These helpers map between that layout and
+ * a list of per-frame compressed bitstreams.
+ *
+ * @see DICOM PS3.5 Section A.4 - Transfer Syntaxes for Encapsulation
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#ifndef PACS_ENCODING_COMPRESSION_ENCAPSULATED_PIXEL_DATA_HPP
+#define PACS_ENCODING_COMPRESSION_ENCAPSULATED_PIXEL_DATA_HPP
+
+#include <kcenon/pacs/core/result.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace kcenon::pacs::encoding::compression {
+
+/**
+ * @brief Splits encapsulated Pixel Data into per-frame bitstreams.
+ *
+ * Frame boundaries are resolved in the following order:
+ * 1. Basic Offset Table, when present
+ * 2. One fragment per frame, when the fragment count equals the frame count
+ * 3. All fragments concatenated, for single-frame images
+ * 4. JPEG/JPEG 2000 end-of-codestream markers (FFD9) at fragment ends
+ *
+ * @param encapsulated Raw value of the encapsulated Pixel Data element
+ *                     (BOT item, fragment items, optional delimiter)
+ * @param number_of_frames Number of Frames (0028,0008), at least 1
+ * @return One compressed bitstream per frame, or an error when the item
+ *         structure is malformed or frames cannot be delimited
+ */
+[[nodiscard]] auto split_encapsulated_frames(
+    std::span<const uint8_t> encapsulated,
+    uint32_t number_of_frames)
+    -> kcenon::pacs::Result<std::vector<std::vector<uint8_t>>>;
+
+/**
+ * @brief Builds encapsulated Pixel Data from per-frame bitstreams.
+ *
+ * Each frame is emitted as a single fragment (padded to even length) and a
+ * Basic Offset Table is filled with the frame offsets, so the result can be
+ * randomly accessed by frame number.
+ *
+ * @param frames Compressed bitstream for each frame
+ * @return Raw value for an encapsulated Pixel Data element, terminated
+ *         with a Sequence Delimitation Item
+ */
+[[nodiscard]] auto build_encapsulated_pixel_data(
+    const std::vector<std::vector<uint8_t>>& frames) -> std::vector<uint8_t>;
+
+}  // namespace kcenon::pacs::encoding::compression
+
+#endif  // PACS_ENCODING_COMPRESSION_ENCAPSULATED_PIXEL_DATA_HPP
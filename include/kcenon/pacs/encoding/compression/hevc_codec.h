@@ -81,6 +81,7 @@ public:
     [[nodiscard]] bool is_lossy() const noexcept override;
     [[nodiscard]] bool can_encode(const image_params& params) const noexcept override;
     [[nodiscard]] bool can_decode(const image_params& params) const noexcept override;
+    [[nodiscard]] std::unique_ptr<compression_codec> clone() const override;
 
     /// @}
 
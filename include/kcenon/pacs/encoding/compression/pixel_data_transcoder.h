@@ -0,0 +1,88 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file pixel_data_transcoder.h
+ * @brief Transfer syntax conversion of whole DICOM files
+ *
+ * Converts the Pixel Data of a dicom_file between native and encapsulated
+ * transfer syntaxes using the codecs from codec_factory. This is the common
+ * engine behind on-the-fly transcoding on retrieve paths and compression
+ * of stored instances (on ingest or during tier migration).
+ *
+ * @see DICOM PS3.5 Section 8.2 - Native and Encapsulated Pixel Data
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#ifndef PACS_ENCODING_COMPRESSION_PIXEL_DATA_TRANSCODER_HPP
+#define PACS_ENCODING_COMPRESSION_PIXEL_DATA_TRANSCODER_HPP
+
+#include "kcenon/pacs/encoding/compression/compression_codec.h"
+#include "kcenon/pacs/encoding/compression/image_params.h"
+#include "kcenon/pacs/encoding/transfer_syntax.h"
+
+#include <kcenon/pacs/core/dicom_dataset.h>
+#include <kcenon/pacs/core/dicom_file.h>
+#include <kcenon/pacs/core/result.h>
+
+namespace kcenon::pacs::encoding::compression {
+
+/**
+ * @brief Options for transcode_file()
+ */
+struct transcode_options {
+    /// Allow conversion into lossy transfer syntaxes
+    bool allow_lossy{false};
+
+    /// Options passed to codecs when encoding
+    compression_options encode_options{};
+
+    /// Frame-level parallelism for multi-frame instances
+    frame_parallel_options parallel{};
+};
+
+/**
+ * @brief Read Image Pixel Module attributes into codec parameters
+ *
+ * Number of Frames defaults to 1 when absent or malformed.
+ *
+ * @param dataset Dataset holding the Image Pixel Module
+ * @return Codec parameters (zero width/height when attributes are missing)
+ */
+[[nodiscard]] auto read_image_params(const core::dicom_dataset& dataset)
+    -> image_params;
+
+/**
+ * @brief Check whether a conversion is possible
+ *
+ * @param source Current transfer syntax
+ * @param target Requested transfer syntax
+ * @param allow_lossy Whether lossy targets are acceptable
+ * @return true if transcode_file() can produce the target syntax
+ */
+[[nodiscard]] auto can_transcode(const transfer_syntax& source,
+                                 const transfer_syntax& target,
+                                 bool allow_lossy) -> bool;
+
+/**
+ * @brief Convert a DICOM file to another transfer syntax
+ *
+ * Returns a copy of the input unchanged when the syntaxes already match.
+ * Frames of multi-frame instances go through
+ * compression_codec::encode_frames() / decode_frames().
+ *
+ * @param file Source file
+ * @param target Requested transfer syntax
+ * @param options Conversion options
+ * @return Converted file or error
+ */
+[[nodiscard]] auto transcode_file(const core::dicom_file& file,
+                                  const transfer_syntax& target,
+                                  const transcode_options& options = {})
+    -> kcenon::pacs::Result<core::dicom_file>;
+
+}  // namespace kcenon::pacs::encoding::compression
+
+#endif  // PACS_ENCODING_COMPRESSION_PIXEL_DATA_TRANSCODER_HPP
@@ -0,0 +1,182 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file dataset_encoder.h
+ * @brief Two-pass dataset encoder writing into one buffer or a byte sink
+ *
+ * This file provides the dataset_encoder class, the single encoder behind
+ * the Implicit VR, Explicit VR Little Endian and Explicit VR Big Endian
+ * codecs, dicom_file and dimse_message.
+ *
+ * The first pass computes the exact encoded size, including the length of
+ * every sequence item; the second writes each byte exactly once, either
+ * into a buffer allocated at that size or through a byte_sink. Large values
+ * such as Pixel Data are handed to the sink straight from the element
+ * without being copied.
+ *
+ * @see DICOM PS3.5 Section 7 - The Data Set
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include <kcenon/pacs/core/dicom_dataset.h>
+#include <kcenon/pacs/core/dicom_element.h>
+#include <kcenon/pacs/core/result.h>
+#include <kcenon/pacs/encoding/byte_order.h>
+#include <kcenon/pacs/encoding/transfer_syntax.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <vector>
+
+namespace kcenon::pacs::encoding {
+
+/**
+ * @brief Destination for encoded bytes (file, socket, PDU fragmenter)
+ *
+ * write() receives the stream in order. Small elements arrive batched in
+ * chunks of up to dataset_encoder::staging_size bytes; large values arrive
+ * as views into the source element and are only valid during the call.
+ */
+class byte_sink {
+public:
+    virtual ~byte_sink() = default;
+
+    /**
+     * @brief Append bytes to the destination
+     * @return Error to abort encoding
+     */
+    virtual auto write(std::span<const uint8_t> bytes) -> VoidResult = 0;
+};
+
+/**
+ * @brief byte_sink over a std::ostream (e.g. std::ofstream)
+ */
+class ostream_sink final : public byte_sink {
+public:
+    explicit ostream_sink(std::ostream& stream) noexcept : stream_(stream) {}
+
+    auto write(std::span<const uint8_t> bytes) -> VoidResult override {
+        if (!stream_.write(reinterpret_cast<const char*>(bytes.data()),
+                           static_cast<std::streamsize>(bytes.size()))) {
+            return pacs_void_error(error_codes::file_write_error,
+                                   "Failed to write encoded data");
+        }
+        return ok();
+    }
+
+private:
+    std::ostream& stream_;
+};
+
+/**
+ * @brief Options selecting the encoding produced by dataset_encoder
+ */
+struct encoder_options {
+    /// Implicit or explicit VR
+    vr_encoding vr{vr_encoding::explicit_vr};
+
+    /// Byte order of tags, lengths and numeric values
+    byte_order order{byte_order::little_endian};
+
+    /**
+     * @brief Write Pixel Data holding encapsulated fragments with undefined
+     * length
+     *
+     * Part 10 files keep encapsulated Pixel Data as its raw item stream
+     * (Basic Offset Table, fragments, Sequence Delimitation Item); with this
+     * set such a value is written with undefined length instead of its byte
+     * count. Only applies to Explicit VR Little Endian.
+     */
+    bool undefined_length_encapsulated{false};
+};
+
+/**
+ * @brief Two-pass encoder for DICOM datasets
+ *
+ * Elements are written in tag order. Values are padded to even length with
+ * the VR's padding character, sequences use undefined length with items of
+ * explicit length, and item/delimiter tags use the dataset byte order.
+ *
+ * Thread Safety: an encoder holds only its options; one instance may be
+ * used from any number of threads.
+ *
+ * @example
+ * @code
+ * dataset_encoder encoder(transfer_syntax::explicit_vr_little_endian);
+ * auto bytes = encoder.encode(dataset);   // one allocation, exact size
+ *
+ * std::ofstream out(path, std::ios::binary);
+ * ostream_sink sink(out);
+ * auto result = encoder.encode(dataset, sink);
+ * @endcode
+ */
+class dataset_encoder {
+public:
+    /// Bytes of element headers and small values batched per sink write
+    static constexpr std::size_t staging_size = 64 * 1024;
+
+    /// Values at least this large bypass staging and go to the sink as is
+    static constexpr std::size_t direct_write_threshold = 16 * 1024;
+
+    explicit dataset_encoder(encoder_options options = {}) noexcept
+        : options_(options) {}
+
+    /// Encoder for the VR mode and byte order of a transfer syntax
+    explicit dataset_encoder(const transfer_syntax& ts) noexcept
+        : options_{ts.vr_type(), ts.endianness(), false} {}
+
+    [[nodiscard]] auto options() const noexcept -> const encoder_options& {
+        return options_;
+    }
+
+    /**
+     * @brief Exact number of bytes encode() produces for a dataset
+     */
+    [[nodiscard]] auto encoded_size(const core::dicom_dataset& dataset) const
+        -> std::size_t;
+
+    /**
+     * @brief Exact number of bytes encode() produces for one element
+     */
+    [[nodiscard]] auto encoded_size(const core::dicom_element& element) const
+        -> std::size_t;
+
+    /**
+     * @brief Encode a dataset into a buffer allocated at its exact size
+     */
+    [[nodiscard]] auto encode(const core::dicom_dataset& dataset) const
+        -> std::vector<uint8_t>;
+
+    /**
+     * @brief Encode a single element into a buffer of its exact size
+     */
+    [[nodiscard]] auto encode(const core::dicom_element& element) const
+        -> std::vector<uint8_t>;
+
+    /**
+     * @brief Append the encoding of a dataset to a buffer
+     *
+     * The buffer grows once, by exactly the encoded size.
+     */
+    void encode_append(const core::dicom_dataset& dataset,
+                       std::vector<uint8_t>& buffer) const;
+
+    /**
+     * @brief Stream the encoding of a dataset into a sink
+     * @return The first error reported by the sink, if any
+     */
+    [[nodiscard]] auto encode(const core::dicom_dataset& dataset,
+                              byte_sink& sink) const -> VoidResult;
+
+private:
+    encoder_options options_;
+};
+
+}  // namespace kcenon::pacs::encoding
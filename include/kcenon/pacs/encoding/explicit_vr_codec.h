@@ -110,13 +110,6 @@ public:
         std::span<const uint8_t>& data);
 
 private:
-    // Internal encoding helpers
-    static void encode_sequence(std::vector<uint8_t>& buffer,
-                                const core::dicom_element& element);
-
-    static void encode_sequence_item(std::vector<uint8_t>& buffer,
-                                     const core::dicom_dataset& item);
-
     // Internal decoding helpers
     static result<core::dicom_element> decode_undefined_length(
         core::dicom_tag tag, vr_type vr,
@@ -40,6 +40,10 @@
 #include <kcenon/common/patterns/result.h>
 #endif
 
+namespace kcenon::pacs::network {
+class p_data_fragmenter;
+}  // namespace kcenon::pacs::network
+
 // Forward declarations for kcenon::network types
 namespace kcenon::network::session {
 class messaging_session;
@@ -263,6 +267,19 @@ public:
     [[nodiscard]] Result<std::monostate> send_raw(
         const std::vector<uint8_t>& data);
 
+    /**
+     * @brief Send the P-DATA-TF PDUs of a fragmented DIMSE message
+     *
+     * The session transport takes owned buffers, so each PDU is copied
+     * into its own buffer and sent in order; memory held per send is
+     * bounded by the maximum PDU length rather than the message size.
+     *
+     * @param fragmenter PDUs built by network::p_data_fragmenter
+     * @return Result indicating success or error
+     */
+    [[nodiscard]] Result<std::monostate> send_p_data(
+        const network::p_data_fragmenter& fragmenter);
+
     /**
      * @brief Receive a complete DICOM PDU
      *
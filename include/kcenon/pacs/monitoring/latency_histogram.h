@@ -0,0 +1,268 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file latency_histogram.h
+ * @brief Lock-free log-linear latency histogram for operation metrics
+ *
+ * This file provides the latency_histogram class used by pacs_metrics and
+ * the I/O pipeline to record operation durations as distributions rather
+ * than only count/total/min/max, so percentiles and tail regressions are
+ * visible.
+ *
+ * Buckets follow the HDR layout: every power-of-two range (octave) is split
+ * into 8 linear sub-buckets, so a recorded value is known to within 12.5%
+ * from 1 ns up to about 18 minutes (larger values land in the last bucket).
+ * Recording is two relaxed atomic increments on a per-thread shard; shards
+ * are merged only when a snapshot is taken.
+ *
+ * @see pacs_metrics
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace kcenon::pacs::monitoring {
+
+/**
+ * @class histogram_snapshot
+ * @brief Point-in-time copy of a latency_histogram
+ *
+ * Snapshots are plain values: they can be merged (e.g. across calling AEs)
+ * and queried without touching the live histogram. All values are in
+ * nanoseconds.
+ */
+class histogram_snapshot {
+public:
+    /// Per-bucket counts, indexed like latency_histogram buckets
+    std::vector<std::uint64_t> counts;
+
+    /// Number of recorded values
+    std::uint64_t count{0};
+
+    /// Sum of recorded values in nanoseconds
+    std::uint64_t sum_ns{0};
+
+    /// Add another snapshot's values to this one
+    void merge(const histogram_snapshot& other) {
+        if (counts.size() < other.counts.size()) {
+            counts.resize(other.counts.size(), 0);
+        }
+        for (std::size_t i = 0; i < other.counts.size(); ++i) {
+            counts[i] += other.counts[i];
+        }
+        count += other.count;
+        sum_ns += other.sum_ns;
+    }
+
+    /**
+     * @brief Value at the given quantile
+     * @param quantile Quantile in [0, 1] (e.g. 0.99)
+     * @return Highest value of the bucket holding the quantile, 0 if empty
+     */
+    [[nodiscard]] std::uint64_t percentile(double quantile) const noexcept;
+
+    /// Highest value of the highest non-empty bucket, 0 if empty
+    [[nodiscard]] std::uint64_t max() const noexcept;
+
+    /// Mean of the recorded values, 0 if empty
+    [[nodiscard]] double mean() const noexcept {
+        return count == 0 ? 0.0
+                          : static_cast<double>(sum_ns) / static_cast<double>(count);
+    }
+
+    /**
+     * @brief Number of values known to be at most the given bound
+     *
+     * Counts the buckets lying entirely at or below the bound; a bucket
+     * straddling it is left out, so the result errs low by at most one
+     * bucket.
+     */
+    [[nodiscard]] std::uint64_t count_at_or_below(std::uint64_t bound_ns) const noexcept;
+};
+
+/**
+ * @class latency_histogram
+ * @brief Per-thread-sharded log-linear histogram of durations
+ *
+ * Thread Safety: record() is wait-free and may be called from any thread.
+ * snapshot() and reset() may run concurrently with record(); a snapshot
+ * taken during recording may miss values recorded meanwhile.
+ *
+ * @example
+ * @code
+ * latency_histogram histogram;
+ * histogram.record(std::chrono::microseconds(250));
+ *
+ * auto snapshot = histogram.snapshot();
+ * auto p99_ns = snapshot.percentile(0.99);
+ * @endcode
+ */
+class latency_histogram {
+public:
+    /// Linear sub-buckets per octave (log2)
+    static constexpr unsigned sub_bucket_bits = 3;
+
+    /// Linear sub-buckets per octave
+    static constexpr std::size_t sub_bucket_count = std::size_t{1} << sub_bucket_bits;
+
+    /// Values from 2^max_value_bits ns on share the last bucket
+    static constexpr unsigned max_value_bits = 40;
+
+    /// Total number of buckets
+    static constexpr std::size_t bucket_count =
+        sub_bucket_count * (max_value_bits - sub_bucket_bits + 1);
+
+    /// Number of shards threads are spread over
+    static constexpr std::size_t shard_count = 8;
+
+    latency_histogram() : shards_(std::make_unique<shard[]>(shard_count)) {}
+
+    // Non-copyable, non-movable (contains atomics)
+    latency_histogram(const latency_histogram&) = delete;
+    latency_histogram& operator=(const latency_histogram&) = delete;
+    latency_histogram(latency_histogram&&) = delete;
+    latency_histogram& operator=(latency_histogram&&) = delete;
+
+    /**
+     * @brief Bucket holding a value
+     * @param value_ns Value in nanoseconds
+     * @return Bucket index in [0, bucket_count)
+     */
+    [[nodiscard]] static constexpr std::size_t bucket_index(std::uint64_t value_ns) noexcept {
+        if (value_ns < sub_bucket_count) {
+            return static_cast<std::size_t>(value_ns);
+        }
+        const auto exponent = static_cast<unsigned>(std::bit_width(value_ns)) - 1;
+        if (exponent >= max_value_bits) {
+            return bucket_count - 1;
+        }
+        const auto shift = exponent - sub_bucket_bits;
+        return sub_bucket_count * (shift + 1) +
+               static_cast<std::size_t>((value_ns >> shift) - sub_bucket_count);
+    }
+
+    /// Lowest value of a bucket in nanoseconds
+    [[nodiscard]] static constexpr std::uint64_t bucket_lower_bound(std::size_t index) noexcept {
+        if (index < sub_bucket_count) {
+            return index;
+        }
+        const auto shift = index / sub_bucket_count - 1;
+        return (sub_bucket_count + index % sub_bucket_count) << shift;
+    }
+
+    /// One past the highest value of a bucket in nanoseconds
+    [[nodiscard]] static constexpr std::uint64_t bucket_upper_bound(std::size_t index) noexcept {
+        if (index < sub_bucket_count) {
+            return index + 1;
+        }
+        const auto shift = index / sub_bucket_count - 1;
+        return (sub_bucket_count + index % sub_bucket_count + 1) << shift;
+    }
+
+    /// Record a duration
+    void record(std::chrono::nanoseconds duration) noexcept {
+        const auto value = static_cast<std::uint64_t>((std::max)(
+            duration.count(), std::chrono::nanoseconds::rep{0}));
+        auto& target = shards_[shard_slot()];
+        target.counts[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        target.sum_ns.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /// Merge all shards into a snapshot
+    [[nodiscard]] histogram_snapshot snapshot() const {
+        histogram_snapshot result;
+        result.counts.assign(bucket_count, 0);
+        for (std::size_t s = 0; s < shard_count; ++s) {
+            const auto& source = shards_[s];
+            for (std::size_t i = 0; i < bucket_count; ++i) {
+                const auto n = source.counts[i].load(std::memory_order_relaxed);
+                result.counts[i] += n;
+                result.count += n;
+            }
+            result.sum_ns += source.sum_ns.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    /// Reset all buckets to zero
+    void reset() noexcept {
+        for (std::size_t s = 0; s < shard_count; ++s) {
+            for (auto& bucket : shards_[s].counts) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            shards_[s].sum_ns.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    /// One cache-line-aligned set of buckets, written mostly by one thread
+    struct alignas(64) shard {
+        std::array<std::atomic<std::uint64_t>, bucket_count> counts{};
+        std::atomic<std::uint64_t> sum_ns{0};
+    };
+
+    /// Shard of the calling thread, assigned round-robin on first use
+    [[nodiscard]] static std::size_t shard_slot() noexcept {
+        static std::atomic<std::size_t> next_slot{0};
+        thread_local const std::size_t slot =
+            next_slot.fetch_add(1, std::memory_order_relaxed) % shard_count;
+        return slot;
+    }
+
+    std::unique_ptr<shard[]> shards_;
+};
+
+inline std::uint64_t histogram_snapshot::percentile(double quantile) const noexcept {
+    if (count == 0) {
+        return 0;
+    }
+    const auto clamped = std::clamp(quantile, 0.0, 1.0);
+    const auto rank = (std::max)(
+        std::uint64_t{1},
+        static_cast<std::uint64_t>(std::ceil(clamped * static_cast<double>(count))));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            return latency_histogram::bucket_upper_bound(i) - 1;
+        }
+    }
+    return max();
+}
+
+inline std::uint64_t histogram_snapshot::max() const noexcept {
+    for (auto i = counts.size(); i > 0; --i) {
+        if (counts[i - 1] != 0) {
+            return latency_histogram::bucket_upper_bound(i - 1) - 1;
+        }
+    }
+    return 0;
+}
+
+inline std::uint64_t histogram_snapshot::count_at_or_below(
+    std::uint64_t bound_ns) const noexcept {
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+        if (latency_histogram::bucket_upper_bound(i) - 1 > bound_ns) {
+            break;
+        }
+        total += counts[i];
+    }
+    return total;
+}
+
+}  // namespace kcenon::pacs::monitoring
@@ -18,9 +18,12 @@
 
 #pragma once
 
+#include "latency_histogram.h"
+
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -90,7 +93,7 @@ enum class dimse_operation {
  * @brief Atomic counter for tracking operation success/failure counts
  *
  * Thread-safe counters for tracking the number of successful and failed
- * operations, along with timing statistics.
+ * operations, along with timing statistics and the latency distribution.
  */
 struct operation_counter {
     std::atomic<std::uint64_t> success_count{0};
@@ -98,6 +101,7 @@ struct operation_counter {
     std::atomic<std::uint64_t> total_duration_us{0};  ///< Total duration in microseconds
     std::atomic<std::uint64_t> min_duration_us{UINT64_MAX};
     std::atomic<std::uint64_t> max_duration_us{0};
+    latency_histogram latency;  ///< Durations of successful and failed operations
 
     /// Get total operation count (success + failure)
     [[nodiscard]] std::uint64_t total_count() const noexcept {
@@ -119,6 +123,7 @@ struct operation_counter {
         success_count.fetch_add(1, std::memory_order_relaxed);
         const auto duration_us = static_cast<std::uint64_t>(duration.count());
         total_duration_us.fetch_add(duration_us, std::memory_order_relaxed);
+        latency.record(duration);
 
         // Update min/max with CAS loops
         auto current_min = min_duration_us.load(std::memory_order_relaxed);
@@ -141,6 +146,7 @@ struct operation_counter {
         failure_count.fetch_add(1, std::memory_order_relaxed);
         const auto duration_us = static_cast<std::uint64_t>(duration.count());
         total_duration_us.fetch_add(duration_us, std::memory_order_relaxed);
+        latency.record(duration);
 
         // Update min/max with CAS loops
         auto current_min = min_duration_us.load(std::memory_order_relaxed);
@@ -163,6 +169,7 @@ struct operation_counter {
         total_duration_us.store(0, std::memory_order_relaxed);
         min_duration_us.store(UINT64_MAX, std::memory_order_relaxed);
         max_duration_us.store(0, std::memory_order_relaxed);
+        latency.reset();
     }
 };
 
@@ -322,6 +329,90 @@ struct pool_counters {
     }
 };
 
+/**
+ * @struct transcode_counters
+ * @brief Metrics for on-the-fly transfer syntax conversion
+ *
+ * Tracks how often retrieve and WADO paths had to transcode instances,
+ * how many frames went through a codec, and how effective the transcode
+ * cache is.
+ */
+struct transcode_counters {
+    operation_counter conversions;
+    std::atomic<std::uint64_t> frames_processed{0};
+    std::atomic<std::uint64_t> cache_hits{0};
+    std::atomic<std::uint64_t> cache_misses{0};
+
+    /// Record a completed conversion and the number of frames it touched
+    void record_conversion(bool success,
+                           std::chrono::microseconds duration,
+                           std::uint64_t frames) noexcept {
+        if (success) {
+            conversions.record_success(duration);
+            frames_processed.fetch_add(frames, std::memory_order_relaxed);
+        } else {
+            conversions.record_failure(duration);
+        }
+    }
+
+    /// Record a transcode cache lookup
+    void record_cache_lookup(bool hit) noexcept {
+        if (hit) {
+            cache_hits.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            cache_misses.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /// Reset all counters to zero
+    void reset() noexcept {
+        conversions.reset();
+        frames_processed.store(0, std::memory_order_relaxed);
+        cache_hits.store(0, std::memory_order_relaxed);
+        cache_misses.store(0, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @struct fixity_counters
+ * @brief Metrics for background fixity (content hash) verification
+ *
+ * Tracks how much stored data the scrubber re-read and what it found:
+ * files whose bytes no longer match their recorded hash, files missing
+ * from storage and files that could not be read.
+ */
+struct fixity_counters {
+    std::atomic<std::uint64_t> files_verified{0};
+    std::atomic<std::uint64_t> bytes_verified{0};
+    std::atomic<std::uint64_t> mismatches{0};
+    std::atomic<std::uint64_t> missing{0};
+    std::atomic<std::uint64_t> unreadable{0};
+    std::atomic<std::uint64_t> hashes_backfilled{0};
+
+    /// Record a file whose bytes were re-read and matched
+    void record_verified(std::uint64_t bytes) noexcept {
+        files_verified.fetch_add(1, std::memory_order_relaxed);
+        bytes_verified.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    /// Total corruption findings of any kind
+    [[nodiscard]] std::uint64_t failures() const noexcept {
+        return mismatches.load(std::memory_order_relaxed) +
+               missing.load(std::memory_order_relaxed) +
+               unreadable.load(std::memory_order_relaxed);
+    }
+
+    /// Reset all counters to zero
+    void reset() noexcept {
+        files_verified.store(0, std::memory_order_relaxed);
+        bytes_verified.store(0, std::memory_order_relaxed);
+        mismatches.store(0, std::memory_order_relaxed);
+        missing.store(0, std::memory_order_relaxed);
+        unreadable.store(0, std::memory_order_relaxed);
+        hashes_backfilled.store(0, std::memory_order_relaxed);
+    }
+};
+
 /**
  * @class pacs_metrics
  * @brief Central metrics collection for PACS DICOM operations
@@ -329,8 +420,10 @@ struct pool_counters {
  * The pacs_metrics class provides a thread-safe, low-overhead mechanism for
  * tracking DICOM operation metrics including:
  * - DIMSE operation counts and timing (C-ECHO, C-STORE, C-FIND, C-MOVE, C-GET)
+ * - Latency histograms per DIMSE operation, pipeline stage and calling AE
  * - Data transfer volumes (bytes sent/received, images stored/retrieved)
  * - Association lifecycle events (established, rejected, aborted)
+ * - Fixity verification results (verified, mismatched, missing files)
  *
  * Thread Safety: All public methods are thread-safe using atomic operations.
  *
@@ -494,6 +587,91 @@ public:
         }
     }
 
+    /**
+     * @brief Record a DIMSE operation against the calling AE's histogram
+     * @param calling_ae Calling AE title of the association
+     * @param op Operation type
+     * @param duration Operation duration
+     *
+     * Only the latency is recorded; counts stay with record_operation().
+     */
+    void record_calling_ae(std::string_view calling_ae,
+                           dimse_operation op,
+                           std::chrono::microseconds duration) {
+        calling_ae_latency(calling_ae, op).record(duration);
+    }
+
+    // =========================================================================
+    // Latency Histograms
+    // =========================================================================
+
+    /// Distinct calling AEs tracked before further ones share one label
+    static constexpr std::size_t max_calling_ae_labels = 64;
+
+    /// Label shared by calling AEs beyond max_calling_ae_labels
+    static constexpr std::string_view overflow_calling_ae = "other";
+
+    /**
+     * @brief Get the latency histogram of a pipeline stage
+     * @param stage Stage name (e.g. "pdu_decode")
+     * @return Histogram, created on first use and valid for the lifetime
+     *         of this object
+     */
+    [[nodiscard]] latency_histogram& stage_latency(std::string_view stage) {
+        {
+            std::shared_lock lock(histograms_mutex_);
+            if (auto it = stage_latency_.find(stage); it != stage_latency_.end()) {
+                return *it->second;
+            }
+        }
+        std::unique_lock lock(histograms_mutex_);
+        auto& slot = stage_latency_[std::string(stage)];
+        if (!slot) {
+            slot = std::make_unique<latency_histogram>();
+        }
+        return *slot;
+    }
+
+    /**
+     * @brief Get the latency histogram of an operation from a calling AE
+     * @param calling_ae Calling AE title
+     * @param op Operation type
+     * @return Histogram, created on first use and valid for the lifetime
+     *         of this object
+     *
+     * Once max_calling_ae_labels AEs are tracked, further AEs share the
+     * overflow_calling_ae histograms to bound memory and label cardinality.
+     */
+    [[nodiscard]] latency_histogram& calling_ae_latency(std::string_view calling_ae,
+                                                        dimse_operation op) {
+        {
+            std::shared_lock lock(histograms_mutex_);
+            auto it = calling_ae_latency_.find(calling_ae);
+            if (it == calling_ae_latency_.end() &&
+                calling_ae_latency_.size() >= max_calling_ae_labels) {
+                it = calling_ae_latency_.find(overflow_calling_ae);
+            }
+            if (it != calling_ae_latency_.end()) {
+                if (auto op_it = it->second.find(op); op_it != it->second.end()) {
+                    return *op_it->second;
+                }
+            }
+        }
+        std::unique_lock lock(histograms_mutex_);
+        auto it = calling_ae_latency_.find(calling_ae);
+        if (it == calling_ae_latency_.end()) {
+            const auto label = calling_ae_latency_.size() < max_calling_ae_labels
+                                   ? calling_ae
+                                   : overflow_calling_ae;
+            it = calling_ae_latency_.try_emplace(std::string(label)).first;
+        }
+        auto& slot = it->second[op];
+        if (!slot) {
+            slot = std::make_unique<latency_histogram>();
+        }
+        return *slot;
+    }
+
     // =========================================================================
     // Data Transfer Recording
     // =========================================================================
@@ -662,6 +840,46 @@ public:
         return pdu_buffer_pool_;
     }
 
+    // =========================================================================
+    // Transcoding Metrics
+    // =========================================================================
+
+    /**
+     * @brief Get transcoding counters
+     * @return Const reference to transcoding counters
+     */
+    [[nodiscard]] const transcode_counters& transcoding() const noexcept {
+        return transcoding_;
+    }
+
+    /**
+     * @brief Get mutable transcoding counters
+     * @return Reference to transcoding counters
+     */
+    [[nodiscard]] transcode_counters& transcoding() noexcept {
+        return transcoding_;
+    }
+
+    // =========================================================================
+    // Fixity Metrics
+    // =========================================================================
+
+    /**
+     * @brief Get fixity verification counters
+     * @return Const reference to fixity counters
+     */
+    [[nodiscard]] const fixity_counters& fixity() const noexcept {
+        return fixity_;
+    }
+
+    /**
+     * @brief Get mutable fixity verification counters
+     * @return Reference to fixity counters
+     */
+    [[nodiscard]] fixity_counters& fixity() noexcept {
+        return fixity_;
+    }
+
     // =========================================================================
     // Export Methods
     // =========================================================================
@@ -712,6 +930,18 @@ public:
         element_pool_.reset();
         dataset_pool_.reset();
         pdu_buffer_pool_.reset();
+        transcoding_.reset();
+        fixity_.reset();
+
+        std::shared_lock lock(histograms_mutex_);
+        for (auto& [stage, histogram] : stage_latency_) {
+            histogram->reset();
+        }
+        for (auto& [calling_ae, operations] : calling_ae_latency_) {
+            for (auto& [op, histogram] : operations) {
+                histogram->reset();
+            }
+        }
     }
 
 private:
@@ -738,6 +968,21 @@ private:
     pool_counters element_pool_;
     pool_counters dataset_pool_;
     pool_counters pdu_buffer_pool_;
+
+    // Transfer syntax conversion metrics
+    transcode_counters transcoding_;
+
+    // Stored content verification metrics
+    fixity_counters fixity_;
+
+    // Labelled latency histograms; entries are never removed, so references
+    // handed out stay valid
+    mutable std::shared_mutex histograms_mutex_;
+    std::map<std::string, std::unique_ptr<latency_histogram>, std::less<>> stage_latency_;
+    std::map<std::string,
+             std::map<dimse_operation, std::unique_ptr<latency_histogram>>,
+             std::less<>>
+        calling_ae_latency_;
 };
 
 }  // namespace kcenon::pacs::monitoring
@@ -0,0 +1,463 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file request_tracer.h
+ * @brief Sampled per-request trace spans kept in a local ring buffer
+ *
+ * This file provides the request_tracer used to follow individual DIMSE
+ * requests through the association, service and storage layers. A sampled
+ * request gets a trace id; every layer it passes through opens a
+ * trace_span, and finished spans are written to a fixed-size ring buffer
+ * that can be exported as OTLP-JSON or as a Chrome trace
+ * (chrome://tracing, Perfetto).
+ *
+ * The active span is tracked per thread, so code only has to open a
+ * trace_span where work happens: spans nest under whatever span is active
+ * on the calling thread and cost a single thread-local check when the
+ * request is not sampled. Work handed to another thread carries its
+ * trace_context and installs it with trace_context_scope.
+ *
+ * @see pacs_metrics
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace kcenon::pacs::monitoring {
+
+/**
+ * @struct trace_context
+ * @brief Identifies the trace and span a piece of work belongs to
+ */
+struct trace_context {
+    /// Trace identifier (0 = request not sampled)
+    std::uint64_t trace_id{0};
+
+    /// Span new child spans are parented to
+    std::uint64_t span_id{0};
+
+    /// Whether the request is being traced
+    [[nodiscard]] bool sampled() const noexcept { return trace_id != 0; }
+};
+
+/**
+ * @struct span_record
+ * @brief A finished span as stored in the ring buffer
+ */
+struct span_record {
+    std::uint64_t trace_id{0};
+    std::uint64_t span_id{0};
+    std::uint64_t parent_span_id{0};  ///< 0 for the request span
+    std::string name;
+    std::uint64_t start_ns{0};  ///< steady_clock time in nanoseconds
+    std::uint64_t end_ns{0};    ///< steady_clock time in nanoseconds
+    std::uint64_t thread_id{0};
+    bool error{false};
+    std::vector<std::pair<std::string, std::string>> attributes;
+
+    /// Span duration in nanoseconds
+    [[nodiscard]] std::uint64_t duration_ns() const noexcept {
+        return end_ns > start_ns ? end_ns - start_ns : 0;
+    }
+};
+
+/**
+ * @struct tracer_config
+ * @brief Sampling and buffer settings of the request tracer
+ */
+struct tracer_config {
+    /// Trace one request in this many (1 = every request, 0 = disabled)
+    std::uint32_t sample_every{100};
+
+    /// Spans kept; the oldest are overwritten once full
+    std::size_t capacity{4096};
+};
+
+/**
+ * @class request_tracer
+ * @brief Sampling decision, span ids and the ring buffer of finished spans
+ *
+ * Thread Safety: All methods are thread-safe. Recording takes a short
+ * mutex, which only sampled requests ever reach.
+ *
+ * @example
+ * @code
+ * request_tracer::global().configure({.sample_every = 10});
+ *
+ * {
+ *     auto request = trace_span::start_request("dimse_request");
+ *     trace_span decode("dimse_decode");
+ *     // ...
+ * }
+ *
+ * auto& tracer = request_tracer::global();
+ * std::string otlp = tracer.to_otlp_json(tracer.spans());
+ * @endcode
+ */
+class request_tracer {
+public:
+    explicit request_tracer(const tracer_config& config = {})
+        : config_(config),
+          ring_(config.capacity),
+          epoch_offset_ns_(unix_now_ns() - static_cast<std::int64_t>(now_ns())),
+          id_state_(seed()) {}
+
+    // Non-copyable, non-movable (owns the ring buffer shared by all spans)
+    request_tracer(const request_tracer&) = delete;
+    request_tracer& operator=(const request_tracer&) = delete;
+    request_tracer(request_tracer&&) = delete;
+    request_tracer& operator=(request_tracer&&) = delete;
+
+    /**
+     * @brief Get the global tracer instance
+     *
+     * Thread-safe lazy initialization using Meyer's singleton pattern.
+     */
+    [[nodiscard]] static request_tracer& global() noexcept {
+        static request_tracer instance;
+        return instance;
+    }
+
+    /**
+     * @brief Change sampling and buffer size
+     *
+     * Resizing the buffer drops the spans recorded so far.
+     */
+    void configure(const tracer_config& config) {
+        sample_every_.store(config.sample_every, std::memory_order_relaxed);
+        std::lock_guard lock(mutex_);
+        if (config.capacity != config_.capacity) {
+            ring_.assign(config.capacity, span_record{});
+            next_ = 0;
+            size_ = 0;
+        }
+        config_ = config;
+    }
+
+    /// Current settings
+    [[nodiscard]] tracer_config config() const {
+        std::lock_guard lock(mutex_);
+        return config_;
+    }
+
+    /**
+     * @brief Decide whether a new request is traced
+     * @return Context with a fresh trace id, or an unsampled context
+     */
+    [[nodiscard]] trace_context start_trace() noexcept {
+        const auto every = sample_every_.load(std::memory_order_relaxed);
+        if (every == 0 ||
+            requests_.fetch_add(1, std::memory_order_relaxed) % every != 0) {
+            return {};
+        }
+        return {next_id(), 0};
+    }
+
+    /// Generate a non-zero span or trace id
+    [[nodiscard]] std::uint64_t next_id() noexcept {
+        // splitmix64 over an atomic counter
+        auto z = id_state_.fetch_add(0x9E3779B97F4A7C15ULL, std::memory_order_relaxed) +
+                 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        z ^= z >> 31;
+        return z == 0 ? 1 : z;
+    }
+
+    /// Store a finished span, overwriting the oldest one when full
+    void record(span_record span) {
+        std::lock_guard lock(mutex_);
+        if (ring_.empty()) {
+            return;
+        }
+        ring_[next_] = std::move(span);
+        next_ = (next_ + 1) % ring_.size();
+        if (size_ < ring_.size()) {
+            ++size_;
+        } else {
+            ++overwritten_;
+        }
+    }
+
+    /// All buffered spans, oldest first
+    [[nodiscard]] std::vector<span_record> spans() const {
+        return collect([](const span_record&) { return true; });
+    }
+
+    /// Buffered spans of one trace, oldest first
+    [[nodiscard]] std::vector<span_record> spans(std::uint64_t trace_id) const {
+        return collect(
+            [trace_id](const span_record& span) { return span.trace_id == trace_id; });
+    }
+
+    /// Number of spans lost to overwriting since the last clear()
+    [[nodiscard]] std::uint64_t overwritten() const {
+        std::lock_guard lock(mutex_);
+        return overwritten_;
+    }
+
+    /// Drop all buffered spans
+    void clear() {
+        std::lock_guard lock(mutex_);
+        for (auto& span : ring_) {
+            span = span_record{};
+        }
+        next_ = 0;
+        size_ = 0;
+        overwritten_ = 0;
+    }
+
+    /// Current steady_clock time in nanoseconds (the span time base)
+    [[nodiscard]] static std::uint64_t now_ns() noexcept {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+    /// Convert a span time to nanoseconds since the Unix epoch
+    [[nodiscard]] std::uint64_t to_unix_ns(std::uint64_t steady_ns) const noexcept {
+        return static_cast<std::uint64_t>(static_cast<std::int64_t>(steady_ns) +
+                                          epoch_offset_ns_);
+    }
+
+    /// Context of the span active on the calling thread
+    [[nodiscard]] static trace_context current() noexcept { return current_slot(); }
+
+    /// Replace the context active on the calling thread
+    static void set_current(trace_context context) noexcept { current_slot() = context; }
+
+    // =========================================================================
+    // Export
+    // =========================================================================
+
+    /**
+     * @brief Export spans as an OTLP/JSON ExportTraceServiceRequest
+     * @param spans Spans to export
+     * @param service_name Value of the service.name resource attribute
+     * @return JSON accepted by OTLP/HTTP collectors (/v1/traces)
+     */
+    [[nodiscard]] std::string to_otlp_json(const std::vector<span_record>& spans,
+                                           std::string_view service_name = "pacs_system") const;
+
+    /**
+     * @brief Export spans in the Chrome trace event format
+     * @param spans Spans to export
+     * @return JSON loadable by chrome://tracing and Perfetto
+     */
+    [[nodiscard]] std::string to_chrome_trace(const std::vector<span_record>& spans) const;
+
+private:
+    template <typename Predicate>
+    [[nodiscard]] std::vector<span_record> collect(Predicate matches) const {
+        std::lock_guard lock(mutex_);
+        std::vector<span_record> result;
+        result.reserve(size_);
+        const auto first = (next_ + ring_.size() - size_) % (std::max)(ring_.size(), std::size_t{1});
+        for (std::size_t i = 0; i < size_; ++i) {
+            const auto& span = ring_[(first + i) % ring_.size()];
+            if (matches(span)) {
+                result.push_back(span);
+            }
+        }
+        return result;
+    }
+
+    [[nodiscard]] static trace_context& current_slot() noexcept {
+        thread_local trace_context context;
+        return context;
+    }
+
+    [[nodiscard]] static std::int64_t unix_now_ns() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    }
+
+    [[nodiscard]] static std::uint64_t seed() {
+        std::random_device device;
+        return (static_cast<std::uint64_t>(device()) << 32) ^ device() ^
+               static_cast<std::uint64_t>(unix_now_ns());
+    }
+
+    mutable std::mutex mutex_;
+    tracer_config config_;
+    std::vector<span_record> ring_;
+    std::size_t next_{0};
+    std::size_t size_{0};
+    std::uint64_t overwritten_{0};
+
+    std::atomic<std::uint32_t> sample_every_{config_.sample_every};
+    std::atomic<std::uint64_t> requests_{0};
+    const std::int64_t epoch_offset_ns_;
+    std::atomic<std::uint64_t> id_state_;
+};
+
+/**
+ * @class trace_span
+ * @brief RAII span that becomes the calling thread's active span
+ *
+ * A span opened while no sampled request is active on the thread is inert
+ * and records nothing. Spans finish on destruction or on finish(), which
+ * also restores the previously active span.
+ */
+class trace_span {
+public:
+    /**
+     * @brief Open a child of the span active on this thread
+     * @param name Span name (e.g. "file_write")
+     * @param start_ns Start time (steady ns); 0 means now
+     */
+    explicit trace_span(std::string_view name, std::uint64_t start_ns = 0)
+        : trace_span(name, request_tracer::current(), start_ns) {}
+
+    /**
+     * @brief Open the root span of a new request, subject to sampling
+     * @param name Span name (e.g. "dimse_request")
+     * @param start_ns Start time (steady ns); 0 means now
+     */
+    [[nodiscard]] static trace_span start_request(std::string_view name,
+                                                  std::uint64_t start_ns = 0) {
+        return trace_span(name, request_tracer::global().start_trace(), start_ns);
+    }
+
+    ~trace_span() { finish(); }
+
+    trace_span(const trace_span&) = delete;
+    trace_span& operator=(const trace_span&) = delete;
+    trace_span& operator=(trace_span&&) = delete;
+
+    trace_span(trace_span&& other) noexcept
+        : record_(std::move(other.record_)),
+          previous_(other.previous_),
+          active_(std::exchange(other.active_, false)) {}
+
+    /// Whether this span belongs to a sampled request
+    [[nodiscard]] bool active() const noexcept { return active_; }
+
+    /// Context for work continuing this span on another thread
+    [[nodiscard]] trace_context context() const noexcept {
+        return active_ ? trace_context{record_.trace_id, record_.span_id} : trace_context{};
+    }
+
+    /// Attach a key/value attribute
+    void set_attribute(std::string_view key, std::string_view value) {
+        if (active_) {
+            record_.attributes.emplace_back(key, value);
+        }
+    }
+
+    /// Mark the span as failed
+    void set_error() noexcept { record_.error = true; }
+
+    /**
+     * @brief Record a finished child span with explicit times
+     *
+     * For intervals measured before the request was known to be traced,
+     * such as receiving the PDU that carried it.
+     */
+    void add_child(std::string_view name, std::uint64_t start_ns, std::uint64_t end_ns) {
+        if (!active_) {
+            return;
+        }
+        auto& tracer = request_tracer::global();
+        span_record child;
+        child.trace_id = record_.trace_id;
+        child.span_id = tracer.next_id();
+        child.parent_span_id = record_.span_id;
+        child.name = name;
+        child.start_ns = start_ns;
+        child.end_ns = end_ns;
+        child.thread_id = record_.thread_id;
+        tracer.record(std::move(child));
+    }
+
+    /**
+     * @brief Stop being this thread's active span while staying open
+     *
+     * For spans handed to another thread to be finished there.
+     */
+    void detach() noexcept {
+        const auto current = request_tracer::current();
+        if (active_ && current.trace_id == record_.trace_id &&
+            current.span_id == record_.span_id) {
+            request_tracer::set_current(previous_);
+        }
+    }
+
+    /// Finish the span now (later calls do nothing)
+    void finish() {
+        if (!active_) {
+            return;
+        }
+        active_ = false;
+        record_.end_ns = request_tracer::now_ns();
+        const auto current = request_tracer::current();
+        if (current.trace_id == record_.trace_id && current.span_id == record_.span_id) {
+            request_tracer::set_current(previous_);
+        }
+        request_tracer::global().record(std::move(record_));
+    }
+
+private:
+    trace_span(std::string_view name, trace_context parent, std::uint64_t start_ns)
+        : active_(parent.sampled()) {
+        if (!active_) {
+            return;
+        }
+        record_.trace_id = parent.trace_id;
+        record_.span_id = request_tracer::global().next_id();
+        record_.parent_span_id = parent.span_id;
+        record_.name = name;
+        record_.start_ns = start_ns != 0 ? start_ns : request_tracer::now_ns();
+        record_.thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        previous_ = request_tracer::current();
+        request_tracer::set_current({record_.trace_id, record_.span_id});
+    }
+
+    span_record record_;
+    trace_context previous_;
+    bool active_{false};
+};
+
+/**
+ * @class trace_context_scope
+ * @brief Makes a context the active one on this thread for a scope
+ *
+ * Used where a request's work moves to another thread, e.g. a pipeline
+ * worker running a queued DIMSE dispatch.
+ */
+class trace_context_scope {
+public:
+    explicit trace_context_scope(trace_context context) noexcept
+        : previous_(request_tracer::current()) {
+        request_tracer::set_current(context);
+    }
+
+    ~trace_context_scope() { request_tracer::set_current(previous_); }
+
+    trace_context_scope(const trace_context_scope&) = delete;
+    trace_context_scope& operator=(const trace_context_scope&) = delete;
+
+private:
+    trace_context previous_;
+};
+
+}  // namespace kcenon::pacs::monitoring
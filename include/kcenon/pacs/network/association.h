@@ -30,6 +30,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -46,6 +47,7 @@ namespace kcenon::pacs::network {
 // =============================================================================
 
 class association;
+class p_data_fragmenter;
 
 // =============================================================================
 // Result Type
@@ -453,6 +455,53 @@ public:
         uint8_t context_id,
         const dimse::dimse_message& msg);
 
+    /**
+     * @brief Send a DIMSE message whose data set is already encoded.
+     *
+     * Used to forward stored instances without decoding them: @p dataset
+     * must already be in the transfer syntax accepted for @p context_id
+     * (for example the bytes that follow the File Meta Information of a
+     * stored Part 10 file) and is only referenced while the P-DATA-TF PDUs
+     * are sent. @p command must not carry a data set of its own.
+     *
+     * @param context_id Presentation Context ID to use
+     * @param command The DIMSE command
+     * @param dataset Encoded data set bytes
+     * @return Success or error
+     */
+    [[nodiscard]] Result<std::monostate> send_dimse_encoded(
+        uint8_t context_id,
+        const dimse::dimse_message& command,
+        std::span<const uint8_t> dataset);
+
+    /// Transmits the P-DATA-TF PDUs of one outgoing DIMSE message
+    using p_data_transport =
+        std::function<Result<std::monostate>(const p_data_fragmenter& pdus)>;
+
+    /**
+     * @brief Route outgoing DIMSE messages to a wire transport.
+     *
+     * Once set, send_dimse() and send_dimse_encoded() split each message
+     * into PDUs no larger than max_pdu_size() and hand them to
+     * @p transport (typically write_gather() on the connection socket)
+     * instead of the in-memory peer.
+     */
+    void set_p_data_transport(p_data_transport transport);
+
+    /// Sends a DIMSE message on an association that may have gone away
+    using deferred_sender = std::function<Result<std::monostate>(
+        uint8_t context_id, const dimse::dimse_message& msg)>;
+
+    /**
+     * @brief Get a sender usable after the current handler has returned.
+     *
+     * The sender forwards to send_dimse() for as long as this association
+     * exists (following it when moved) and fails once it is destroyed, so
+     * services can send a late message such as the Storage Commitment
+     * N-EVENT-REPORT from another thread without holding a reference.
+     */
+    [[nodiscard]] deferred_sender make_deferred_sender();
+
     /**
      * @brief Receive a DIMSE message.
      *
@@ -572,10 +621,29 @@ private:
     /// Negotiate presentation contexts for SCP
     void negotiate_contexts(const associate_rq& rq, const scp_config& config);
 
+    /**
+     * @brief Fragment an encoded message and pass it to the transport.
+     * @note Called with mutex_ held
+     */
+    [[nodiscard]] Result<std::monostate> send_p_data(
+        uint8_t context_id,
+        std::span<const uint8_t> command,
+        std::span<const uint8_t> dataset,
+        bool has_dataset);
+
     // =========================================================================
     // Member Variables
     // =========================================================================
 
+    /// Association targeted by deferred senders; cleared on destruction
+    struct deferred_link {
+        std::mutex mutex;
+        association* target{nullptr};
+    };
+
+    /// Retarget link_ to this association
+    void attach_link();
+
     /// Current state
     association_state state_{association_state::idle};
 
@@ -633,11 +701,17 @@ private:
     /// Peer association for in-memory testing
     association* peer_{nullptr};
 
+    /// Wire transport for outgoing P-DATA-TF PDUs (none: in-memory peer)
+    p_data_transport p_data_transport_;
+
     /// Incoming message queue for in-memory testing (thread-safe)
     using message_type = std::pair<uint8_t, dimse::dimse_message>;
     using message_queue_type = kcenon::thread::detail::concurrent_queue<message_type>;
     mutable std::unique_ptr<message_queue_type> incoming_queue_{
         std::make_unique<message_queue_type>()};
+
+    /// Shared with deferred senders; always locked before mutex_
+    std::shared_ptr<deferred_link> link_{std::make_shared<deferred_link>()};
 };
 
 }  // namespace kcenon::pacs::network
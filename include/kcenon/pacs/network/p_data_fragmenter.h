@@ -0,0 +1,154 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file p_data_fragmenter.h
+ * @brief Zero-copy P-DATA-TF fragmentation and scatter-gather sending
+ *
+ * This file provides p_data_fragmenter, which splits an encoded DIMSE
+ * command and dataset into P-DATA-TF PDUs without copying them: each PDU
+ * is a 12-byte header (PDU header + PDV header) built separately plus a
+ * view into the caller's bytes (an encoded dataset or a memory-mapped
+ * file). write_gather() hands the headers and views to the kernel as one
+ * iovec list, so a large object is never duplicated on the way out.
+ *
+ * @see DICOM PS3.8 Section 9.3.5 - P-DATA-TF PDU Structure
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include "pdu_types.h"
+
+#include <kcenon/pacs/core/result.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace kcenon::pacs::network {
+
+/// PDU header (type, reserved, length) followed by PDV header (length,
+/// presentation context ID, message control header)
+inline constexpr std::size_t p_data_header_size = 12;
+
+/**
+ * @brief One P-DATA-TF PDU carrying a single PDV
+ *
+ * The payload is a view; the bytes it refers to must outlive the fragment.
+ */
+struct p_data_fragment {
+    std::array<uint8_t, p_data_header_size> header{};
+    std::span<const uint8_t> payload;
+
+    /// Encoded size of the PDU, header included
+    [[nodiscard]] auto size() const noexcept -> std::size_t {
+        return header.size() + payload.size();
+    }
+
+    /// Append the encoded PDU to a buffer
+    void append_to(std::vector<uint8_t>& out) const;
+};
+
+/**
+ * @brief Splits DIMSE command and dataset bytes into P-DATA-TF PDUs
+ *
+ * Each PDU carries one PDV of at most max_pdu_length - 6 bytes of data,
+ * so that the PDU length field never exceeds the Maximum Length
+ * negotiated by the peer. Only the headers are stored; payloads are views
+ * into the bytes passed to add_command() / add_dataset().
+ *
+ * @example
+ * @code
+ * auto encoded = dimse_message::encode(msg, ts).value();
+ * p_data_fragmenter fragmenter(context_id, assoc.max_pdu_size());
+ * fragmenter.add_command(encoded.first);
+ * fragmenter.add_dataset(encoded.second);
+ * auto sent = write_gather(socket, fragmenter.fragments());
+ * @endcode
+ */
+class p_data_fragmenter {
+public:
+    /**
+     * @brief Construct a fragmenter
+     * @param context_id Presentation Context ID of every PDV
+     * @param max_pdu_length Maximum PDU length (variable field) accepted by
+     *        the peer; 0 means unlimited
+     */
+    p_data_fragmenter(uint8_t context_id, uint32_t max_pdu_length) noexcept;
+
+    /// Fragment an encoded command set (message control bit 0 set)
+    void add_command(std::span<const uint8_t> command);
+
+    /// Fragment an encoded dataset
+    void add_dataset(std::span<const uint8_t> dataset);
+
+    /**
+     * @brief Fragment command or dataset bytes
+     *
+     * The last fragment has the "last" bit set. Empty data still produces
+     * one (empty) last fragment.
+     */
+    void add(std::span<const uint8_t> data, bool is_command);
+
+    /// Fragments in send order
+    [[nodiscard]] auto fragments() const noexcept
+        -> const std::vector<p_data_fragment>& {
+        return fragments_;
+    }
+
+    /// Total encoded size of all PDUs
+    [[nodiscard]] auto total_size() const noexcept -> std::size_t {
+        return total_size_;
+    }
+
+    /// Largest PDV data carried by one PDU
+    [[nodiscard]] auto max_fragment_payload() const noexcept -> std::size_t {
+        return max_payload_;
+    }
+
+    /**
+     * @brief Concatenate all PDUs into one buffer
+     *
+     * For transports that only accept owned contiguous buffers; the data
+     * is copied exactly once.
+     */
+    [[nodiscard]] auto to_bytes() const -> std::vector<uint8_t>;
+
+    /// Remove all fragments, keeping context ID and PDU limit
+    void clear() noexcept;
+
+private:
+    uint8_t context_id_;
+    std::size_t max_payload_;
+    std::vector<p_data_fragment> fragments_;
+    std::size_t total_size_{0};
+};
+
+/// Native socket handle accepted by write_gather()
+#ifdef _WIN32
+using native_socket = std::uintptr_t;
+#else
+using native_socket = int;
+#endif
+
+/**
+ * @brief Send PDUs with gather I/O
+ *
+ * Headers and payload views are passed to sendmsg()/writev() (WSASend()
+ * on Windows) in batches of up to IOV_MAX buffers; partial writes resume
+ * where the kernel stopped. The socket must be in blocking mode.
+ *
+ * @param socket Connected stream socket
+ * @param fragments PDUs to send, in order
+ * @return Number of bytes sent, or send_failed
+ */
+[[nodiscard]] auto write_gather(native_socket socket,
+                                std::span<const p_data_fragment> fragments)
+    -> Result<std::size_t>;
+
+}  // namespace kcenon::pacs::network
@@ -127,10 +127,6 @@ private:
 
     /// Encode DIMSE command
     [[nodiscard]] auto encode_dimse_command() -> Result<std::vector<uint8_t>>;
-
-    /// Fragment large data if needed
-    [[nodiscard]] auto fragment_data(const std::vector<uint8_t>& data)
-        -> std::vector<std::vector<uint8_t>>;
 };
 
 }  // namespace kcenon::pacs::network::pipeline
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <kcenon/pacs/monitoring/pacs_metrics.h>
 #include <kcenon/pacs/network/pipeline/pipeline_job_types.h>
 
 #include <array>
@@ -212,8 +213,17 @@ public:
 
     /**
      * @brief Default constructor
+     *
+     * Binds each stage to its latency histogram in the global pacs_metrics,
+     * so stage latency distributions are exported with the other metrics.
      */
-    pipeline_metrics() = default;
+    pipeline_metrics() {
+        auto& global = monitoring::pacs_metrics::global_metrics();
+        for (size_t i = 0; i < stage_count; ++i) {
+            stage_latency_[i] =
+                &global.stage_latency(get_stage_name(static_cast<pipeline_stage>(i)));
+        }
+    }
 
     // Non-copyable, non-movable (contains atomics)
     pipeline_metrics(const pipeline_metrics&) = delete;
@@ -253,6 +263,20 @@ public:
                                  bool success) noexcept {
         stage_metrics_[static_cast<size_t>(stage)]
             .record_job_completion(processing_time_ns, success);
+        stage_latency_[static_cast<size_t>(stage)]->record(
+            std::chrono::nanoseconds(processing_time_ns));
+    }
+
+    /**
+     * @brief Get the processing time distribution of a stage
+     * @param stage The pipeline stage
+     * @return Snapshot of the stage's latency histogram
+     *
+     * The histogram is process-wide and shared by all pipelines.
+     */
+    [[nodiscard]] auto get_stage_latency(pipeline_stage stage) const
+        -> monitoring::histogram_snapshot {
+        return stage_latency_[static_cast<size_t>(stage)]->snapshot();
     }
 
     /**
@@ -396,6 +420,7 @@ public:
 
 private:
     std::array<stage_metrics, stage_count> stage_metrics_;
+    std::array<monitoring::latency_histogram*, stage_count> stage_latency_{};
     std::array<category_metrics, category_count> category_metrics_;
     std::atomic<uint64_t> total_operations_{0};
     std::atomic<uint32_t> active_associations_{0};
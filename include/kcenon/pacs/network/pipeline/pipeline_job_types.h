@@ -203,6 +203,12 @@ struct job_context {
 
     /// Priority (lower = higher priority, 0 = highest)
     uint8_t priority{128};
+
+    /// Trace of the request this job serves (0 = not sampled)
+    uint64_t trace_id{0};
+
+    /// Span the job's own spans are parented to
+    uint64_t parent_span_id{0};
 };
 
 }  // namespace kcenon::pacs::network::pipeline
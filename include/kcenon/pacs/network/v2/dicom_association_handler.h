@@ -21,10 +21,12 @@
 
 #include "kcenon/pacs/network/association.h"
 #include "kcenon/pacs/network/pdu_types.h"
+#include "kcenon/pacs/network/pipeline/pipeline_coordinator.h"
 #include "kcenon/pacs/network/server_config.h"
 #include "kcenon/pacs/security/access_control_manager.h"
 #include "kcenon/pacs/services/scp_service.h"
 #include "kcenon/pacs/integration/dicom_session.h"
+#include "kcenon/pacs/monitoring/request_tracer.h"
 
 #include <atomic>
 #include <chrono>
@@ -80,6 +82,38 @@ enum class handler_state {
     }
 }
 
+// =============================================================================
+// DIMSE Execution Mode
+// =============================================================================
+
+/**
+ * @brief Where decoded DIMSE messages are executed.
+ *
+ * - inline_dispatch: the service runs on the network I/O thread that
+ *   delivered the PDU (default, lowest latency for light workloads).
+ * - pipelined: the service runs on the pipeline_coordinator's execution
+ *   stage, so a slow storage or database operation does not hold the
+ *   I/O thread. Messages of one association still run one at a time, in
+ *   the order they were received.
+ */
+enum class dimse_execution_mode {
+    inline_dispatch,  ///< Dispatch on the receiving I/O thread
+    pipelined         ///< Dispatch on the pipeline execution stage
+};
+
+/**
+ * @brief Convert dimse_execution_mode to string representation.
+ * @param mode The mode to convert
+ * @return String representation of the mode
+ */
+[[nodiscard]] constexpr const char* to_string(dimse_execution_mode mode) noexcept {
+    switch (mode) {
+        case dimse_execution_mode::inline_dispatch: return "Inline";
+        case dimse_execution_mode::pipelined: return "Pipelined";
+        default: return "Unknown";
+    }
+}
+
 // =============================================================================
 // Handler Callbacks
 // =============================================================================
@@ -358,6 +392,34 @@ public:
      */
     void set_access_control_enabled(bool enabled);
 
+    // =========================================================================
+    // Execution Mode
+    // =========================================================================
+
+    /**
+     * @brief Execute DIMSE messages on a pipeline coordinator.
+     *
+     * Must be called before start(). Passing nullptr restores inline
+     * dispatch. Each message is tagged with a per-association
+     * job_context::sequence_number and only the lowest pending sequence
+     * number is in flight, so responses keep the request order.
+     *
+     * @param coordinator Running coordinator shared by all handlers
+     */
+    void set_pipeline(std::shared_ptr<pipeline::pipeline_coordinator> coordinator);
+
+    /**
+     * @brief Get the active execution mode.
+     * @return pipelined if a coordinator is attached, inline otherwise
+     */
+    [[nodiscard]] dimse_execution_mode execution_mode() const noexcept;
+
+    /**
+     * @brief Get number of DIMSE messages queued or executing in the pipeline.
+     * @return Pending dispatch count (always 0 in inline mode)
+     */
+    [[nodiscard]] size_t pending_dispatches() const;
+
 private:
     // =========================================================================
     // Network Callbacks
@@ -404,8 +466,8 @@ private:
     /// Send A-ASSOCIATE-RJ response
     void send_associate_rj(reject_result result, uint8_t source, uint8_t reason);
 
-    /// Send P-DATA-TF PDU
-    void send_p_data_tf(const std::vector<uint8_t>& payload);
+    /// Send a complete P-DATA-TF PDU
+    void send_p_data_tf(std::vector<uint8_t> pdu);
 
     /// Send A-RELEASE-RP response
     void send_release_rp();
@@ -413,8 +475,8 @@ private:
     /// Send A-ABORT PDU
     void send_abort(abort_source source, abort_reason reason);
 
-    /// Send raw PDU data
-    void send_pdu(pdu_type type, const std::vector<uint8_t>& payload);
+    /// Send raw PDU data (handed to the session without copying)
+    void send_pdu(pdu_type type, std::vector<uint8_t> encoded_pdu);
 
     // =========================================================================
     // Service Dispatching
@@ -428,6 +490,22 @@ private:
     /// Find service for SOP Class UID
     [[nodiscard]] services::scp_service* find_service(const std::string& sop_class_uid) const;
 
+    /// Decode-side entry point: dispatch inline or queue for the pipeline;
+    /// the request span finishes once the dispatch has run
+    void execute_message(uint8_t context_id, dimse::dimse_message msg,
+                         monitoring::trace_span request);
+
+    /// Queue work behind earlier messages of this association
+    void schedule_ordered(pipeline::job_category category,
+                          uint16_t message_id,
+                          std::function<bool()> work);
+
+    /// Submit the lowest pending sequence number if nothing is in flight
+    void submit_next_dispatch();
+
+    /// Whether earlier messages are still queued or executing
+    [[nodiscard]] bool has_pending_dispatch() const;
+
     // =========================================================================
     // State Management
     // =========================================================================
@@ -472,6 +550,12 @@ private:
     /// Current PDU type being received
     [[maybe_unused]] pdu_type current_pdu_type_{pdu_type::abort};
 
+    /// When the first byte of the PDU at the head of receive_buffer_ arrived
+    uint64_t pdu_first_byte_ns_{0};
+
+    /// Receive interval (first byte, last byte) of the PDU being processed
+    std::pair<uint64_t, uint64_t> pdu_receive_ns_{0, 0};
+
     /// Last activity timestamp
     time_point last_activity_;
 
@@ -497,6 +581,30 @@ private:
 
     /// Whether access control is enabled
     bool access_control_enabled_{false};
+
+    /// A queued DIMSE dispatch awaiting its turn on the pipeline
+    struct pending_dispatch {
+        pipeline::job_context context;
+        std::function<bool()> work;
+    };
+
+    /// Pipeline coordinator (nullptr in inline mode)
+    std::shared_ptr<pipeline::pipeline_coordinator> pipeline_;
+
+    /// Numeric session identifier used in job contexts
+    uint64_t pipeline_session_id_{0};
+
+    /// Queued dispatches ordered by job_context::sequence_number
+    std::map<uint32_t, pending_dispatch> dispatch_queue_;
+
+    /// Next sequence number to assign
+    uint32_t next_sequence_{0};
+
+    /// Whether a dispatch is currently executing on the pipeline
+    bool dispatch_in_flight_{false};
+
+    /// Protects dispatch_queue_, next_sequence_ and dispatch_in_flight_
+    mutable std::mutex dispatch_mutex_;
 };
 
 }  // namespace kcenon::pacs::network::v2
@@ -294,6 +294,37 @@ public:
      */
     [[nodiscard]] bool is_access_control_enabled() const noexcept;
 
+    // =========================================================================
+    // Execution Mode
+    // =========================================================================
+
+    /**
+     * @brief Select where DIMSE messages are executed
+     *
+     * In pipelined mode, start() creates a pipeline_coordinator and every
+     * association hands its decoded messages to the coordinator's execution
+     * stage instead of running services on the network I/O thread. Messages
+     * of one association are still executed one at a time in arrival order.
+     *
+     * @param mode Execution mode (default: inline_dispatch)
+     * @param config Pipeline configuration used in pipelined mode
+     * @note Must be called before start()
+     */
+    void set_execution_mode(dimse_execution_mode mode,
+                            const pipeline::pipeline_config& config = {});
+
+    /**
+     * @brief Get the selected execution mode
+     * @return Current execution mode
+     */
+    [[nodiscard]] dimse_execution_mode execution_mode() const noexcept;
+
+    /**
+     * @brief Get the pipeline coordinator (for metrics)
+     * @return Coordinator while running in pipelined mode, nullptr otherwise
+     */
+    [[nodiscard]] std::shared_ptr<pipeline::pipeline_coordinator> pipeline() const;
+
 private:
     // =========================================================================
     // Network System Callbacks
@@ -340,6 +371,12 @@ private:
     /// Report error through callback
     void report_error(const std::string& error);
 
+    /// Create and start the pipeline coordinator in pipelined mode
+    [[nodiscard]] Result<std::monostate> start_pipeline();
+
+    /// Stop and release the pipeline coordinator, if any
+    void stop_pipeline();
+
     // =========================================================================
     // Member Variables
     // =========================================================================
@@ -400,6 +437,18 @@ private:
 
     /// Access control mutex
     mutable std::mutex acl_mutex_;
+
+    /// Selected DIMSE execution mode
+    dimse_execution_mode execution_mode_{dimse_execution_mode::inline_dispatch};
+
+    /// Pipeline configuration for pipelined mode
+    pipeline::pipeline_config pipeline_config_;
+
+    /// Pipeline coordinator (created by start() in pipelined mode)
+    std::shared_ptr<pipeline::pipeline_coordinator> pipeline_;
+
+    /// Pipeline mutex (protects pipeline_)
+    mutable std::mutex pipeline_mutex_;
 };
 
 }  // namespace kcenon::pacs::network::v2
@@ -32,7 +32,9 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace kcenon::pacs::security {
@@ -88,6 +90,9 @@ enum class private_tag_action : std::uint8_t {
  */
 class anonymizer {
 public:
+    /// Effective tag actions sorted by tag
+    using action_plan = std::vector<std::pair<core::dicom_tag, tag_action_config>>;
+
     // ========================================================================
     // Construction
     // ========================================================================
@@ -244,6 +249,27 @@ public:
     [[nodiscard]] auto get_tag_action(core::dicom_tag tag) const
         -> tag_action_config;
 
+    /**
+     * @brief Get the compiled action plan
+     *
+     * Profile defaults merged with custom actions, sorted by tag. The plan
+     * is compiled when the profile or custom actions change, not per
+     * dataset, and is shared (immutable) between copies of the anonymizer.
+     *
+     * @return Effective actions in tag order
+     */
+    [[nodiscard]] auto get_action_plan() const noexcept
+        -> std::span<const std::pair<core::dicom_tag, tag_action_config>>;
+
+    /**
+     * @brief Check whether Pixel Data is left untouched
+     *
+     * True when the profile does not clean pixel data and no action targets
+     * Pixel Data or any tag following it, so an encoder may copy the Pixel
+     * Data bytes of the source file through unchanged.
+     */
+    [[nodiscard]] auto preserves_pixel_data() const noexcept -> bool;
+
     // ========================================================================
     // Date Shifting
     // ========================================================================
@@ -376,6 +402,9 @@ private:
     /// Custom tag actions (override profile defaults)
     std::map<core::dicom_tag, tag_action_config> custom_actions_;
 
+    /// Compiled profile + custom actions (rebuilt on configuration change)
+    std::shared_ptr<const action_plan> plan_;
+
     /// Date offset for shifting
     std::optional<std::chrono::days> date_offset_;
 
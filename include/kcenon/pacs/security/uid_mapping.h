@@ -233,6 +233,9 @@ public:
     [[nodiscard]] auto generate_uid() const -> std::string;
 
 private:
+    /// Build a UID under the given root (no locking)
+    [[nodiscard]] auto make_uid(std::string_view root) const -> std::string;
+
     /// UID root for generated UIDs (default: pacs_system root)
     std::string uid_root_{"1.2.826.0.1.3680043.8.498.1"};
 
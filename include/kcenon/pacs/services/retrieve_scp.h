@@ -25,9 +25,11 @@
 #include "scp_service.h"
 #include "kcenon/pacs/core/dicom_dataset.h"
 #include "kcenon/pacs/core/dicom_file.h"
+#include "kcenon/pacs/storage/storage_interface.h"
 
 #include <atomic>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 #include <utility>
@@ -35,6 +37,8 @@
 
 namespace kcenon::pacs::services {
 
+class transcoding_service;
+
 // =============================================================================
 // SOP Class UIDs
 // =============================================================================
@@ -136,6 +140,38 @@ using store_sub_operation = std::function<network::dimse::status_code(
     const std::string& move_originator_ae,
     uint16_t move_originator_msg_id)>;
 
+/**
+ * @brief Stored instance locator function type
+ *
+ * Used instead of retrieve_handler when pass-through is enabled: returns
+ * the SOP Instance UIDs matching a retrieve query, whose stored bytes are
+ * then read from the configured storage.
+ *
+ * @param query_keys The query dataset containing search criteria
+ * @return SOP Instance UIDs of the matching instances
+ */
+using stored_instance_locator = std::function<std::vector<std::string>(
+    const core::dicom_dataset& query_keys)>;
+
+/**
+ * @brief Move sub-association provider function type
+ *
+ * Called once per C-MOVE with matches to open the association to the
+ * resolved Move Destination. Without a custom store handler, sub-operations
+ * are sent on it with the default C-STORE path, which sends stored bytes
+ * unchanged in pass-through mode. The provider decides how the association
+ * is released, e.g. with a deleter calling association::release().
+ *
+ * @param ae_title The Move Destination AE title
+ * @param host Resolved destination host
+ * @param port Resolved destination port
+ * @return Established association, or nullptr if it could not be opened
+ */
+using move_association_provider = std::function<std::shared_ptr<network::association>(
+    const std::string& ae_title,
+    const std::string& host,
+    uint16_t port)>;
+
 /**
  * @brief Cancel check function type
  *
@@ -276,6 +312,18 @@ public:
      */
     void set_store_sub_operation(store_sub_operation handler);
 
+    /**
+     * @brief Set the provider of C-MOVE sub-associations
+     *
+     * Lets the default C-STORE path serve C-MOVE: each sub-operation is sent
+     * on the association returned by @p provider, streaming stored bytes in
+     * pass-through mode as for C-GET. A store handler, if set, takes
+     * precedence. Without either, C-MOVE sub-operations are not sent.
+     *
+     * @param provider Opens the association to a Move Destination
+     */
+    void set_move_association_provider(move_association_provider provider);
+
     /**
      * @brief Set the cancel check function
      *
@@ -286,6 +334,62 @@ public:
      */
     void set_cancel_check(retrieve_cancel_check check);
 
+    /**
+     * @brief Set the transcoder used for C-STORE sub-operations
+     *
+     * When set, the default C-GET store path converts instances whose stored
+     * transfer syntax does not match the accepted presentation context
+     * (e.g. JPEG 2000 stored, Explicit VR Little Endian accepted). Custom
+     * store handlers can obtain it through transcoder().
+     *
+     * @param transcoder Shared transcoding service (nullptr disables)
+     */
+    void set_transcoder(std::shared_ptr<transcoding_service> transcoder);
+
+    /**
+     * @brief Send instances from their stored bytes
+     *
+     * Matching instances are located with @p locator instead of the
+     * retrieve handler and opened with storage_interface::open_read(). When
+     * the stored transfer syntax is the one accepted for the C-STORE
+     * presentation context, the data set bytes following the File Meta
+     * Information (memory-mapped where the backend allows) are sent as-is
+     * through association::send_dimse_encoded(); otherwise the instance is
+     * decoded and prepared as usual. Custom store handlers still receive a
+     * decoded dicom_file.
+     *
+     * @param storage Storage holding the instances (nullptr disables)
+     * @param locator Maps query keys to SOP Instance UIDs
+     */
+    void set_pass_through(std::shared_ptr<storage::storage_interface> storage,
+                          stored_instance_locator locator);
+
+    /**
+     * @brief Perform one C-STORE sub-operation from stored bytes
+     *
+     * Sends the instance on @p assoc and waits for the C-STORE response.
+     * Used by the default C-GET and C-MOVE paths in pass-through mode;
+     * custom store handlers can call it with their own association.
+     *
+     * @param assoc Association to send the C-STORE-RQ on
+     * @param sop_instance_uid Instance to read from the pass-through storage
+     * @param move_originator_ae The original requester's AE title
+     * @param move_originator_msg_id The original message ID
+     * @return Status of the C-STORE, or a failure status if it could not be sent
+     */
+    [[nodiscard]] network::dimse::status_code send_stored_instance(
+        network::association& assoc,
+        std::string_view sop_instance_uid,
+        const std::string& move_originator_ae,
+        uint16_t move_originator_msg_id) const;
+
+    /**
+     * @brief Get the configured transcoder
+     * @return Transcoding service, or nullptr if none is set
+     */
+    [[nodiscard]] auto transcoder() const noexcept
+        -> std::shared_ptr<transcoding_service>;
+
     // =========================================================================
     // scp_service Interface Implementation
     // =========================================================================
@@ -432,6 +536,80 @@ private:
     [[nodiscard]] std::string get_move_destination(
         const network::dimse::dimse_message& request) const;
 
+    /**
+     * @brief Prepare a dataset for sending on a presentation context
+     *
+     * Returns the file's dataset as-is when the stored and accepted transfer
+     * syntaxes share the same pixel data encoding. Otherwise converts it
+     * with the transcoder, failing if none is configured.
+     *
+     * @param assoc The association
+     * @param context_id Presentation context used for the C-STORE
+     * @param file The stored instance
+     * @return Dataset ready to be encoded in the context's transfer syntax
+     */
+    [[nodiscard]] network::Result<core::dicom_dataset> prepare_for_context(
+        network::association& assoc,
+        uint8_t context_id,
+        const core::dicom_file& file) const;
+
+    /**
+     * @brief Build a C-STORE-RQ carrying Move Originator information
+     */
+    [[nodiscard]] static network::dimse::dimse_message make_store_request(
+        std::string_view sop_class_uid,
+        std::string_view sop_instance_uid,
+        const std::string& move_originator_ae,
+        uint16_t move_originator_msg_id);
+
+    /**
+     * @brief Wait for the C-STORE-RSP of a sent sub-operation
+     */
+    [[nodiscard]] static network::dimse::status_code receive_store_status(
+        network::association& assoc);
+
+    /**
+     * @brief Default C-STORE sub-operation for a decoded file
+     */
+    [[nodiscard]] network::dimse::status_code send_file(
+        network::association& assoc,
+        const core::dicom_file& file,
+        const std::string& move_originator_ae,
+        uint16_t move_originator_msg_id) const;
+
+    /**
+     * @brief Read and decode a stored instance for a custom store handler
+     */
+    [[nodiscard]] std::optional<core::dicom_file> load_stored_file(
+        std::string_view sop_instance_uid) const;
+
+    /**
+     * @brief Matches of a query, from the locator or the retrieve handler
+     *
+     * Exactly one of the two vectors is filled, depending on whether
+     * pass-through is enabled.
+     */
+    void find_matches(const core::dicom_dataset& query_keys,
+                      std::vector<core::dicom_file>& files,
+                      std::vector<std::string>& stored) const;
+
+    /**
+     * @brief Run one C-STORE sub-operation for match @p index
+     *
+     * @param destination C-MOVE sub-association (nullptr for C-GET, or
+     *                    when none could be opened)
+     */
+    [[nodiscard]] network::dimse::status_code store_match(
+        network::association& assoc,
+        uint8_t context_id,
+        bool is_move,
+        network::association* destination,
+        const std::vector<core::dicom_file>& files,
+        const std::vector<std::string>& stored,
+        size_t index,
+        const std::string& calling_ae,
+        uint16_t message_id) const;
+
     // =========================================================================
     // Member Variables
     // =========================================================================
@@ -439,7 +617,11 @@ private:
     retrieve_handler retrieve_handler_;
     destination_resolver destination_resolver_;
     store_sub_operation store_handler_;
+    move_association_provider move_association_provider_;
     retrieve_cancel_check cancel_check_;
+    std::shared_ptr<transcoding_service> transcoder_;
+    std::shared_ptr<storage::storage_interface> pass_through_storage_;
+    stored_instance_locator instance_locator_;
 
     std::atomic<size_t> move_operations_{0};
     std::atomic<size_t> get_operations_{0};
@@ -10,6 +10,12 @@
  * verifies each instance against the storage backend, and reports results
  * via N-EVENT-REPORT.
  *
+ * A request may reference tens of thousands of instances, so existence is
+ * checked with one storage_interface::exists_batch() call, stored bytes can
+ * optionally be re-hashed in parallel against the recorded file hashes, and
+ * the verification and N-EVENT-REPORT run on a background thread once the
+ * N-ACTION-RSP has been sent.
+ *
  * @see DICOM PS3.4 Annex J - Storage Commitment Push Model Service Class
  * @see DICOM PS3.7 Section 10.1.4 - N-ACTION Service
  * @see DICOM PS3.7 Section 10.1.1 - N-EVENT-REPORT Service
@@ -26,11 +32,45 @@
 #include <kcenon/pacs/storage/storage_interface.h>
 
 #include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace kcenon::pacs::services {
 
+/**
+ * @brief Configuration for the Storage Commitment SCP
+ */
+struct storage_commitment_scp_config {
+    /// Re-hash stored instances and compare with their recorded file hash
+    bool verify_checksums = false;
+
+    /// Threads hashing instances when verify_checksums is set
+    size_t checksum_threads = 4;
+
+    /// Verify and send the N-EVENT-REPORT after handle_message() returns
+    bool async_event_report = true;
+};
+
+/**
+ * @brief Looks up the recorded file hashes of a batch of instances
+ *
+ * Returns the hash per SOP Instance UID, as stored in
+ * instance_record::file_hash ("xxh64:<hex>"). UIDs without a recorded
+ * hash may be left out; only their existence is verified. Typically bound
+ * to storage::index_database::get_file_hashes().
+ */
+using commitment_hash_lookup =
+    std::function<std::unordered_map<std::string, std::string>(
+        const std::vector<std::string>& sop_instance_uids)>;
+
 /**
  * @brief Storage Commitment Push Model SCP
  *
@@ -68,7 +108,58 @@ public:
         std::shared_ptr<storage::storage_interface> storage,
         std::shared_ptr<di::ILogger> logger = nullptr);
 
-    ~storage_commitment_scp() override = default;
+    /**
+     * @brief Construct Storage Commitment SCP with custom configuration
+     *
+     * @param storage The storage interface for verifying instance existence
+     * @param config Verification and reporting configuration
+     * @param logger Logger instance for service logging
+     */
+    storage_commitment_scp(
+        std::shared_ptr<storage::storage_interface> storage,
+        const storage_commitment_scp_config& config,
+        std::shared_ptr<di::ILogger> logger = nullptr);
+
+    /**
+     * @brief Destructor; finishes pending commitment requests first
+     */
+    ~storage_commitment_scp() override;
+
+    storage_commitment_scp(const storage_commitment_scp&) = delete;
+    storage_commitment_scp& operator=(const storage_commitment_scp&) = delete;
+
+    // =========================================================================
+    // Configuration
+    // =========================================================================
+
+    /**
+     * @brief Set the lookup of recorded file hashes
+     *
+     * Required for checksum verification; without it only existence is
+     * checked. Must be set before the service handles requests.
+     *
+     * @param lookup The batch hash lookup
+     */
+    void set_hash_lookup(commitment_hash_lookup lookup);
+
+    /**
+     * @brief Verify a batch of referenced instances
+     *
+     * Checks existence with one exists_batch() call and, if enabled,
+     * compares the stored bytes with the recorded file hashes.
+     *
+     * @param transaction_uid Transaction UID of the request
+     * @param references Referenced SOP instances
+     * @return Per-instance success or failure
+     */
+    [[nodiscard]] commitment_result verify_instances(
+        const std::string& transaction_uid,
+        const std::vector<sop_reference>& references);
+
+    /**
+     * @brief Block until all queued asynchronous reports have been sent
+     */
+    void wait_for_pending_reports();
 
     // =========================================================================
     // scp_service Interface
@@ -106,9 +197,16 @@ private:
     // Instance Verification
     // =========================================================================
 
-    [[nodiscard]] commitment_result verify_instances(
-        const std::string& transaction_uid,
-        const std::vector<sop_reference>& references);
+    /// Indexes of instances whose stored bytes do not match their hash
+    [[nodiscard]] std::vector<bool> find_checksum_mismatches(
+        const std::vector<sop_reference>& references,
+        const std::vector<bool>& present);
+
+    /// Queue a job for the report worker, starting it on first use
+    void enqueue_report(std::function<void()> job);
+
+    /// Report worker loop
+    void run_report_worker();
 
     // =========================================================================
     // N-EVENT-REPORT Sender
@@ -119,6 +217,9 @@ private:
         uint8_t context_id,
         const commitment_result& result);
 
+    [[nodiscard]] static network::dimse::dimse_message build_event_report(
+        const commitment_result& result);
+
     // =========================================================================
     // Response Helpers
     // =========================================================================
@@ -144,6 +245,16 @@ private:
     // =========================================================================
 
     std::shared_ptr<storage::storage_interface> storage_;
+    storage_commitment_scp_config config_;
+    commitment_hash_lookup hash_lookup_;
+
+    /// Pending asynchronous verifications, run in order by report_worker_
+    std::mutex report_mutex_;
+    std::condition_variable report_cv_;
+    std::deque<std::function<void()>> report_queue_;
+    size_t reports_running_{0};
+    bool stopping_{false};
+    std::thread report_worker_;
 
     std::atomic<size_t> actions_processed_{0};
     std::atomic<size_t> instances_committed_{0};
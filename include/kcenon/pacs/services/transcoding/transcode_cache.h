@@ -0,0 +1,137 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file transcode_cache.h
+ * @brief On-disk cache of transcoded DICOM instances
+ *
+ * This file provides the transcode_cache class, a size-bounded LRU cache
+ * of encoded Part 10 files keyed by (SOP Instance UID, Transfer Syntax UID,
+ * source digest). It avoids repeating expensive codec work when the same
+ * instance is requested in the same non-native syntax more than once.
+ *
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#ifndef PACS_SERVICES_TRANSCODING_TRANSCODE_CACHE_HPP
+#define PACS_SERVICES_TRANSCODING_TRANSCODE_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace kcenon::pacs::services {
+
+/**
+ * @brief Size-bounded on-disk LRU cache for transcoded instances
+ *
+ * Entries are stored as `<sop_uid>@<ts_uid>@<digest>.dcm` files in the
+ * cache directory, where the digest identifies the stored bytes the entry
+ * was produced from. An instance that is re-stored or recompressed under
+ * the same SOP Instance UID therefore misses instead of serving the old
+ * encoding. Writes go through a temporary file and an atomic rename so a
+ * crash never leaves a truncated entry behind. On construction the
+ * directory is scanned and existing entries are adopted in modification
+ * time order.
+ *
+ * Thread Safety: All methods are thread-safe.
+ */
+class transcode_cache {
+public:
+    /**
+     * @brief Construct a cache rooted at the given directory
+     * @param directory Cache directory (created if missing)
+     * @param max_bytes Maximum total size of cached files
+     */
+    transcode_cache(std::filesystem::path directory, std::size_t max_bytes);
+
+    transcode_cache(const transcode_cache&) = delete;
+    auto operator=(const transcode_cache&) -> transcode_cache& = delete;
+
+    /**
+     * @brief Look up a cached encoding
+     * @param sop_instance_uid SOP Instance UID of the source instance
+     * @param transfer_syntax_uid Target Transfer Syntax UID
+     * @param source_digest Content digest of the stored source bytes
+     * @return Encoded Part 10 bytes, or std::nullopt on miss
+     */
+    [[nodiscard]] auto get(std::string_view sop_instance_uid,
+                           std::string_view transfer_syntax_uid,
+                           std::string_view source_digest)
+        -> std::optional<std::vector<uint8_t>>;
+
+    /**
+     * @brief Insert or replace a cached encoding
+     *
+     * Encodings of the same instance and syntax made from other source
+     * digests are dropped, then least recently used entries are evicted
+     * until the cache fits within its size limit. Entries larger than the
+     * limit are not stored.
+     *
+     * @return true if the entry was written
+     */
+    auto put(std::string_view sop_instance_uid,
+             std::string_view transfer_syntax_uid,
+             std::string_view source_digest,
+             std::span<const uint8_t> data) -> bool;
+
+    /**
+     * @brief Remove every cached encoding of an instance
+     * @param sop_instance_uid SOP Instance UID to invalidate
+     */
+    void invalidate(std::string_view sop_instance_uid);
+
+    /// Remove all entries
+    void clear();
+
+    /// Current total size of cached files in bytes
+    [[nodiscard]] auto size_bytes() const -> std::size_t;
+
+    /// Number of cached entries
+    [[nodiscard]] auto entry_count() const -> std::size_t;
+
+    /// Cache directory
+    [[nodiscard]] auto directory() const -> const std::filesystem::path&;
+
+private:
+    struct entry {
+        std::string key;
+        std::size_t size;
+    };
+
+    [[nodiscard]] static auto make_key(std::string_view sop_instance_uid,
+                                       std::string_view transfer_syntax_uid,
+                                       std::string_view source_digest)
+        -> std::optional<std::string>;
+
+    [[nodiscard]] auto path_for(const std::string& key) const
+        -> std::filesystem::path;
+
+    void load_existing();
+    void evict_to_fit(std::size_t incoming);
+    void erase_locked(std::list<entry>::iterator it);
+    void erase_prefix_locked(const std::string& prefix);
+
+    std::filesystem::path directory_;
+    std::size_t max_bytes_;
+    std::size_t total_bytes_{0};
+
+    /// Most recently used entries at the front
+    std::list<entry> lru_;
+    std::unordered_map<std::string, std::list<entry>::iterator> index_;
+    mutable std::mutex mutex_;
+};
+
+}  // namespace kcenon::pacs::services
+
+#endif  // PACS_SERVICES_TRANSCODING_TRANSCODE_CACHE_HPP
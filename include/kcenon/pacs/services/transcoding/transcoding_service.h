@@ -0,0 +1,198 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file transcoding_service.h
+ * @brief On-the-fly transfer syntax conversion for retrieve paths
+ *
+ * This file provides the transcoding_service class which converts stored
+ * DICOM instances into a transfer syntax requested by a peer. It is used by
+ * C-MOVE/C-GET when the stored syntax was not accepted for the presentation
+ * context, and by WADO-RS when the Accept header asks for a specific
+ * transfer-syntax.
+ *
+ * Frames of multi-frame instances are decoded/encoded in parallel on a
+ * worker pool, and results can be kept in an on-disk transcode_cache.
+ *
+ * @see DICOM PS3.5 Section 8.2 - Native and Encapsulated Pixel Data
+ * @see DICOM PS3.18 Section 8.7.3 - Transfer Syntax Query Parameter
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#ifndef PACS_SERVICES_TRANSCODING_TRANSCODING_SERVICE_HPP
+#define PACS_SERVICES_TRANSCODING_TRANSCODING_SERVICE_HPP
+
+#include "kcenon/pacs/services/transcoding/transcode_cache.h"
+
+#include "kcenon/pacs/core/dicom_file.h"
+#include "kcenon/pacs/core/result.h"
+#include "kcenon/pacs/encoding/compression/compression_codec.h"
+#include "kcenon/pacs/encoding/transfer_syntax.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace kcenon::pacs::integration {
+class thread_pool_interface;
+}  // namespace kcenon::pacs::integration
+
+namespace kcenon::pacs::services {
+
+/**
+ * @brief Configuration for the transcoding service
+ */
+struct transcoding_config {
+    /// Maximum number of frames encoded/decoded concurrently (0 = hardware concurrency)
+    std::size_t max_parallel_frames{0};
+
+    /// Allow conversion into lossy transfer syntaxes
+    bool allow_lossy{false};
+
+    /// Options passed to codecs when encoding
+    encoding::compression::compression_options encode_options{};
+
+    /// Directory for the transcode cache (empty = caching disabled)
+    std::filesystem::path cache_directory;
+
+    /// Maximum size of the transcode cache in bytes
+    std::size_t cache_max_bytes{1024ULL * 1024 * 1024};
+
+    /// Record conversion metrics in pacs_metrics::global_metrics()
+    bool enable_metrics{true};
+};
+
+/**
+ * @brief Converts DICOM instances between transfer syntaxes
+ *
+ * Supported conversions:
+ * - native -> native (Implicit/Explicit VR Little Endian, Explicit VR Big Endian)
+ * - encapsulated -> native (decode via codec_factory)
+ * - native -> encapsulated (encode via codec_factory)
+ * - encapsulated -> encapsulated (decode followed by encode)
+ *
+ * Frames are processed through compression_codec::encode_frames() and
+ * decode_frames(), which give every worker its own codec instance.
+ *
+ * Thread Safety: transcode() may be called concurrently.
+ *
+ * @example
+ * @code
+ * transcoding_config config;
+ * config.cache_directory = "/var/cache/pacs/transcode";
+ *
+ * transcoding_service transcoder(config, thread_pool);
+ * auto result = transcoder.transcode(
+ *     file, encoding::transfer_syntax::explicit_vr_little_endian);
+ * @endcode
+ */
+class transcoding_service {
+public:
+    /**
+     * @brief Construct a transcoding service
+     * @param config Service configuration
+     * @param thread_pool Worker pool for per-frame parallelism
+     *                    (nullptr = std::async)
+     */
+    explicit transcoding_service(
+        transcoding_config config = {},
+        std::shared_ptr<integration::thread_pool_interface> thread_pool = nullptr);
+
+    ~transcoding_service();
+
+    transcoding_service(const transcoding_service&) = delete;
+    auto operator=(const transcoding_service&) -> transcoding_service& = delete;
+
+    /**
+     * @brief Check whether a conversion is possible
+     * @param source Stored transfer syntax
+     * @param target Requested transfer syntax
+     * @return true if transcode() can produce the target syntax
+     */
+    [[nodiscard]] auto can_transcode(const encoding::transfer_syntax& source,
+                                     const encoding::transfer_syntax& target) const
+        -> bool;
+
+    /**
+     * @brief Choose the best transfer syntax the peer can receive
+     *
+     * Prefers the stored syntax, then the first acceptable syntax that
+     * can be produced without loss.
+     *
+     * @param source Stored transfer syntax
+     * @param acceptable Transfer Syntax UIDs acceptable to the peer
+     * @return Selected syntax, or std::nullopt if none is reachable
+     */
+    [[nodiscard]] auto select_target(const encoding::transfer_syntax& source,
+                                     std::span<const std::string> acceptable) const
+        -> std::optional<encoding::transfer_syntax>;
+
+    /**
+     * @brief Convert a DICOM file to another transfer syntax
+     *
+     * Returns a copy of the input unchanged when the syntaxes already match.
+     *
+     * @param file Source file
+     * @param target Requested transfer syntax
+     * @return Converted file or error
+     */
+    [[nodiscard]] auto transcode(const core::dicom_file& file,
+                                 const encoding::transfer_syntax& target)
+        -> Result<core::dicom_file>;
+
+    /**
+     * @brief Convert a file and return its Part 10 encoding
+     *
+     * Consults the transcode cache before doing any codec work and stores
+     * the result afterwards. Intended for WADO responses, which need bytes
+     * rather than a dicom_file.
+     *
+     * @param file Source file
+     * @param target Requested transfer syntax
+     * @param source_digest Content digest of the stored bytes @p file was
+     *                      read from (e.g. storage::content_hasher); part of
+     *                      the cache key so re-stored instances miss. Empty
+     *                      bypasses the cache.
+     * @return Encoded Part 10 bytes or error
+     */
+    [[nodiscard]] auto transcode_to_bytes(const core::dicom_file& file,
+                                          const encoding::transfer_syntax& target,
+                                          std::string_view source_digest = {})
+        -> Result<std::vector<uint8_t>>;
+
+    /**
+     * @brief Get the transcode cache
+     * @return Cache instance, or nullptr when caching is disabled
+     */
+    [[nodiscard]] auto cache() noexcept -> transcode_cache*;
+
+    /**
+     * @brief Get the service configuration
+     */
+    [[nodiscard]] auto config() const noexcept -> const transcoding_config&;
+
+private:
+    [[nodiscard]] auto convert(const core::dicom_file& file,
+                               const encoding::transfer_syntax& target,
+                               std::size_t& frames)
+        -> Result<core::dicom_file>;
+
+    [[nodiscard]] auto parallel_options() const
+        -> encoding::compression::frame_parallel_options;
+
+    transcoding_config config_;
+    std::shared_ptr<integration::thread_pool_interface> thread_pool_;
+    std::unique_ptr<transcode_cache> cache_;
+};
+
+}  // namespace kcenon::pacs::services
+
+#endif  // PACS_SERVICES_TRANSCODING_TRANSCODING_SERVICE_HPP
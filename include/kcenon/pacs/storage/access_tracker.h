@@ -0,0 +1,114 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file access_tracker.h
+ * @brief Sharded buffer of instance access times
+ *
+ * This file provides access_tracker, which records "instance was read"
+ * events on the retrieve path without touching the owner's metadata lock.
+ * Timestamps are truncated to a configurable granularity, and the buffered
+ * entries are drained into the owner's metadata periodically.
+ *
+ * @see SRS-STOR-010, FR-4.5 (Hierarchical Storage Management)
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace kcenon::pacs::storage {
+
+/**
+ * @brief Sharded, coarse-grained access time buffer
+ *
+ * Each UID maps to one of several independently locked shards, so
+ * concurrent readers of different instances rarely contend. Repeated
+ * accesses within one granularity step only compare a timestamp.
+ *
+ * Thread Safety: all methods are thread-safe.
+ *
+ * @example
+ * @code
+ * access_tracker tracker{std::chrono::seconds{1}};
+ * tracker.record("1.2.3.4.5");             // retrieve path
+ *
+ * for (auto& [uid, when] : tracker.drain()) {  // periodic flush
+ *     apply_access_time(uid, when);
+ * }
+ * @endcode
+ */
+class access_tracker {
+public:
+    using clock = std::chrono::system_clock;
+
+    /**
+     * @brief Construct a tracker
+     * @param granularity Timestamps are truncated to multiples of this
+     * @param shard_count Number of independently locked shards
+     */
+    explicit access_tracker(clock::duration granularity = std::chrono::seconds{1},
+                            std::size_t shard_count = 16);
+
+    ~access_tracker();
+
+    access_tracker(const access_tracker&) = delete;
+    access_tracker& operator=(const access_tracker&) = delete;
+
+    /**
+     * @brief Record an access at the current time
+     */
+    void record(std::string_view uid);
+
+    /**
+     * @brief Record an access at the given time
+     */
+    void record(std::string_view uid, clock::time_point when);
+
+    /**
+     * @brief Latest buffered access of an instance, if not yet drained
+     */
+    [[nodiscard]] auto last_access(std::string_view uid) const
+        -> std::optional<clock::time_point>;
+
+    /**
+     * @brief Remove and return all buffered accesses
+     */
+    [[nodiscard]] auto drain()
+        -> std::vector<std::pair<std::string, clock::time_point>>;
+
+    /**
+     * @brief Number of instances with buffered accesses
+     */
+    [[nodiscard]] auto pending() const noexcept -> std::size_t;
+
+    /**
+     * @brief Timestamp truncation step
+     */
+    [[nodiscard]] auto granularity() const noexcept -> clock::duration;
+
+private:
+    struct shard;
+
+    [[nodiscard]] auto shard_for(std::string_view uid) const -> shard&;
+
+    clock::duration granularity_;
+    std::size_t shard_count_;
+    std::unique_ptr<shard[]> shards_;
+    std::atomic<std::size_t> pending_{0};
+};
+
+}  // namespace kcenon::pacs::storage
@@ -16,12 +16,14 @@
 
 #pragma once
 
+#include "parallel_transfer.h"
 #include "storage_interface.h"
 
 #include <kcenon/pacs/core/dicom_dataset.h>
 
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -29,6 +31,7 @@
 #include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace kcenon::pacs::storage {
 
@@ -60,9 +63,11 @@ struct azure_storage_config {
 
   /// Block size for block blob upload in bytes (default: 4MB)
   /// Azure allows up to 4000MB per block (API version 2019-12-12+)
+  /// Blobs larger than block_upload_threshold are also downloaded in ranges
+  /// of this size
   std::size_t block_size = 4 * 1024 * 1024;
 
-  /// Maximum number of concurrent upload threads
+  /// Maximum number of blocks of one blob transferred concurrently
   std::size_t max_concurrency = 8;
 
   /// Connection timeout in milliseconds
@@ -77,10 +82,10 @@ struct azure_storage_config {
   /// Blob tier (Hot, Cool, Archive)
   std::string access_tier{"Hot"};
 
-  /// Retry count for transient failures
+  /// Retry count for transient failures of a block request
   std::uint32_t max_retries = 3;
 
-  /// Initial retry delay in milliseconds
+  /// Initial retry delay in milliseconds (doubled per retry)
   std::uint32_t retry_delay_ms = 1000;
 };
 
@@ -233,6 +238,63 @@ public:
   [[nodiscard]] auto retrieve(std::string_view sop_instance_uid)
       -> Result<core::dicom_dataset> override;
 
+  /**
+   * @brief Store a DICOM file in its own transfer syntax
+   *
+   * @param file The DICOM file to store (e.g. with compressed Pixel Data)
+   * @return VoidResult Success or error information
+   */
+  [[nodiscard]] auto store_file(const core::dicom_file &file)
+      -> VoidResult override;
+
+  /**
+   * @brief Retrieve a stored blob as a Part 10 file
+   *
+   * @param sop_instance_uid The unique identifier for the instance
+   * @return Result containing the file or error information
+   */
+  [[nodiscard]] auto retrieve_file(std::string_view sop_instance_uid)
+      -> Result<core::dicom_file> override;
+
+  /**
+   * @brief Upload Part 10 bytes as the blob body unchanged
+   *
+   * Sources exposing contiguous() (e.g. mapped files) are uploaded without
+   * copying; other sources are buffered to identify the instance. Blobs
+   * above block_upload_threshold are staged as concurrent blocks.
+   *
+   * @param source Part 10 bytes
+   * @return Identity of the stored instance or error information
+   */
+  [[nodiscard]] auto store_stream(byte_source &source)
+      -> Result<stored_instance> override;
+
+  /**
+   * @brief Overwrite the stored object with a new Part 10 file
+   *
+   * The object becomes visible only when the upload completes, so readers
+   * get the old or the new version.
+   *
+   * @param file The DICOM file to store
+   * @return Identity and content hash of the uploaded bytes, or error
+   */
+  [[nodiscard]] auto replace_file(const core::dicom_file &file)
+      -> Result<stored_instance> override;
+
+  /**
+   * @brief Download the stored blob, or a range of it via ranged download
+   *
+   * Ranges above block_upload_threshold are fetched as concurrent ranged
+   * downloads.
+   *
+   * @param sop_instance_uid The unique identifier for the instance
+   * @param range Byte range to read (default: whole blob)
+   * @return Reader over the downloaded bytes or error information
+   */
+  [[nodiscard]] auto open_read(std::string_view sop_instance_uid,
+                               byte_range range = {})
+      -> Result<std::unique_ptr<byte_source>> override;
+
   /**
    * @brief Remove a DICOM blob from Azure Storage
    *
@@ -253,6 +315,19 @@ public:
   [[nodiscard]] auto exists(std::string_view sop_instance_uid) const
       -> bool override;
 
+  /**
+   * @brief Check which of several DICOM instances exist
+   *
+   * Answers the whole batch from the local index under one lock, without
+   * a request per blob.
+   *
+   * @param sop_instance_uids The collection of UIDs to check
+   * @return One flag per UID, in the order given
+   */
+  [[nodiscard]] auto exists_batch(
+      const std::vector<std::string> &sop_instance_uids) const
+      -> std::vector<bool> override;
+
   /**
    * @brief Find DICOM datasets matching query criteria
    *
@@ -309,6 +384,22 @@ public:
                                             azure_progress_callback callback)
       -> Result<core::dicom_dataset>;
 
+  /**
+   * @brief Download a blob to a local file without buffering it
+   *
+   * Ranges are fetched concurrently and written in order; the file is
+   * removed if the download fails or is cancelled.
+   *
+   * @param sop_instance_uid The SOP Instance UID
+   * @param path Destination file (overwritten)
+   * @param callback Progress callback (may be empty)
+   * @return VoidResult Success or error information
+   */
+  [[nodiscard]] auto download_to_file(std::string_view sop_instance_uid,
+                                      const std::filesystem::path &path,
+                                      azure_progress_callback callback = nullptr)
+      -> VoidResult;
+
   /**
    * @brief Get the blob name for a SOP Instance UID
    *
@@ -358,6 +449,65 @@ private:
   // Internal Helper Methods
   // =========================================================================
 
+  /**
+   * @brief Serialize and upload a Part 10 file, then index it
+   * @param file File to upload
+   * @param callback Progress callback (may be empty)
+   */
+  [[nodiscard]] auto upload_file(const core::dicom_file &file,
+                                 azure_progress_callback callback) -> VoidResult;
+
+  /**
+   * @brief Upload Part 10 bytes under the instance blob name, then index them
+   * @param study_uid Study Instance UID
+   * @param series_uid Series Instance UID
+   * @param sop_uid SOP Instance UID
+   * @param source Part 10 bytes
+   * @param callback Progress callback (may be empty)
+   */
+  [[nodiscard]] auto upload_blob(const std::string &study_uid,
+                                 const std::string &series_uid,
+                                 const std::string &sop_uid,
+                                 byte_source &source,
+                                 azure_progress_callback callback) -> VoidResult;
+
+  /**
+   * @brief Look up the blob name and size of an instance
+   */
+  [[nodiscard]] auto find_blob(std::string_view sop_instance_uid) const
+      -> std::optional<std::pair<std::string, std::uint64_t>>;
+
+  /**
+   * @brief Download a byte range of a blob to a sink
+   *
+   * Ranges above block_upload_threshold are fetched as concurrent parts.
+   *
+   * @param blob_name Blob name
+   * @param blob_size Size of the whole blob
+   * @param range Byte range resolved against blob_size
+   * @param sink Receives the bytes in order
+   * @param callback Progress callback (may be empty)
+   */
+  [[nodiscard]] auto download_range(const std::string &blob_name,
+                                    std::uint64_t blob_size, byte_range range,
+                                    const part_sink_fn &sink,
+                                    azure_progress_callback callback)
+      -> VoidResult;
+
+  /**
+   * @brief Block transfer settings derived from the configuration
+   */
+  [[nodiscard]] auto transfer_settings() const -> transfer_options;
+
+  /**
+   * @brief Download and parse the Part 10 file of an instance
+   * @param sop_instance_uid The SOP Instance UID
+   * @param callback Progress callback (may be empty)
+   */
+  [[nodiscard]] auto download_file(std::string_view sop_instance_uid,
+                                   azure_progress_callback callback)
+      -> Result<core::dicom_file>;
+
   /**
    * @brief Build blob name for a dataset
    * @param study_uid Study Instance UID
@@ -379,13 +529,16 @@ private:
 
   /**
    * @brief Execute block blob upload for large files
+   *
+   * Blocks are staged concurrently and committed once all succeeded.
+   *
    * @param blob_name Blob name
-   * @param data Data to upload
+   * @param source Data to upload
    * @param callback Optional progress callback
    * @return VoidResult Success or error information
    */
   [[nodiscard]] auto upload_block_blob(const std::string &blob_name,
-                                       const std::vector<std::uint8_t> &data,
+                                       byte_source &source,
                                        azure_progress_callback callback)
       -> VoidResult;
 
@@ -0,0 +1,390 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file caching_storage.h
+ * @brief Local read-through disk cache in front of a remote storage backend
+ *
+ * This file provides the caching_storage class which keeps recently read
+ * objects of a slow backend (s3_storage, azure_blob_storage) on local disk.
+ * Cached objects are stored content-addressed by their XXH64 digest, and
+ * the cache index is an append-only journal replayed on startup, so a
+ * crash never serves a partially written object.
+ *
+ * Byte-range reads of objects that are not cached are passed through to
+ * the backend as ranged requests instead of downloading the whole object.
+ *
+ * @see content_hasher
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include "storage_interface.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace kcenon::pacs::storage {
+
+/**
+ * @brief Configuration for caching_storage
+ */
+struct cache_config {
+    /// Directory holding cached objects and the index journal
+    std::filesystem::path directory;
+
+    /// Upper bound of cached bytes; least recently used objects are evicted
+    std::uint64_t max_bytes{10ULL * 1024 * 1024 * 1024};
+
+    /// Objects larger than this are never cached
+    std::uint64_t max_object_size{512ULL * 1024 * 1024};
+
+    /// Whole-object misses of an instance before it is admitted
+    /// (1 = cache on first read, 2 = only instances read twice, ...)
+    std::size_t admission_threshold{1};
+
+    /// Instances whose misses are remembered for admission
+    std::size_t history_capacity{65536};
+
+    /// Re-hash every cached object when the index is loaded (slow, detects
+    /// corruption in addition to truncation)
+    bool verify_on_load{false};
+};
+
+/**
+ * @brief Counters reported by caching_storage
+ */
+struct cache_statistics {
+    /// Reads served from the cache
+    std::size_t hits{0};
+
+    /// Whole-object reads fetched from the backend
+    std::size_t misses{0};
+
+    /// Byte-range reads of uncached objects passed through to the backend
+    std::size_t range_passthroughs{0};
+
+    /// Objects written to the cache
+    std::size_t admissions{0};
+
+    /// Fetched objects not cached (admission threshold or size limit)
+    std::size_t rejections{0};
+
+    /// Objects evicted to stay within max_bytes
+    std::size_t evictions{0};
+
+    /// Entries dropped because the instance was stored or removed
+    std::size_t invalidations{0};
+
+    /// Instances currently cached
+    std::size_t entries{0};
+
+    /// Bytes currently cached
+    std::uint64_t bytes_cached{0};
+
+    /// Bytes served from cached objects
+    std::uint64_t bytes_from_cache{0};
+
+    /// Bytes fetched from the backend
+    std::uint64_t bytes_from_backend{0};
+
+    /// Fraction of cacheable reads served locally
+    [[nodiscard]] auto hit_ratio() const noexcept -> double {
+        const auto total = hits + misses;
+        return total > 0 ? static_cast<double>(hits) / static_cast<double>(total)
+                         : 0.0;
+    }
+};
+
+/**
+ * @brief Read-through disk cache decorator for remote backends
+ *
+ * Reads are answered from the cache when possible. A whole-object miss
+ * downloads the object once, writes it to a temporary file while hashing
+ * it, and renames it to its digest; objects are evicted in least recently
+ * used order. Stores and removes go to the backend and invalidate the
+ * cached copy (write-around), so the cache never serves bytes that were
+ * replaced through this decorator.
+ *
+ * Thread Safety: All methods are thread-safe. Concurrent misses of the same
+ * instance may both download it; the second admission is a no-op.
+ *
+ * @example
+ * @code
+ * auto s3 = std::make_shared<s3_storage>(cloud_config);
+ *
+ * cache_config cache;
+ * cache.directory = "/var/cache/pacs";
+ * cache.max_bytes = 200ULL * 1024 * 1024 * 1024;
+ *
+ * caching_storage storage{s3, cache};
+ * auto header = storage.open_read(uid, {0, 64 * 1024});  // ranged GET
+ * auto file = storage.retrieve_file(uid);                // cached
+ * @endcode
+ */
+class caching_storage : public storage_interface {
+public:
+    /**
+     * @brief Construct the cache and load its index
+     *
+     * Entries whose object file is missing or truncated, orphaned object
+     * files, and leftover temporary files are discarded.
+     *
+     * @param backend Remote storage being cached
+     * @param config Cache configuration
+     */
+    caching_storage(std::shared_ptr<storage_interface> backend,
+                    cache_config config);
+
+    ~caching_storage() override;
+
+    caching_storage(const caching_storage&) = delete;
+    caching_storage& operator=(const caching_storage&) = delete;
+    caching_storage(caching_storage&&) = delete;
+    caching_storage& operator=(caching_storage&&) = delete;
+
+    // =========================================================================
+    // storage_interface Implementation
+    // =========================================================================
+
+    [[nodiscard]] auto store(const core::dicom_dataset& dataset)
+        -> VoidResult override;
+
+    [[nodiscard]] auto store_file(const core::dicom_file& file)
+        -> VoidResult override;
+
+    [[nodiscard]] auto store_stream(byte_source& source)
+        -> Result<stored_instance> override;
+
+    /**
+     * @brief Retrieve a dataset, reading the object through the cache
+     */
+    [[nodiscard]] auto retrieve(std::string_view sop_instance_uid)
+        -> Result<core::dicom_dataset> override;
+
+    /**
+     * @brief Retrieve a file, reading the object through the cache
+     */
+    [[nodiscard]] auto retrieve_file(std::string_view sop_instance_uid)
+        -> Result<core::dicom_file> override;
+
+    /**
+     * @brief Open stored bytes from the cache or the backend
+     *
+     * Cached objects are served from disk for any range. For uncached
+     * objects, whole-object reads go through admission and byte-range reads
+     * are passed to the backend unchanged.
+     */
+    [[nodiscard]] auto open_read(std::string_view sop_instance_uid,
+                                 byte_range range = {})
+        -> Result<std::unique_ptr<byte_source>> override;
+
+    [[nodiscard]] auto remove(std::string_view sop_instance_uid)
+        -> VoidResult override;
+
+    [[nodiscard]] auto exists(std::string_view sop_instance_uid) const
+        -> bool override;
+
+    [[nodiscard]] auto exists_batch(
+        const std::vector<std::string>& sop_instance_uids) const
+        -> std::vector<bool> override;
+
+    [[nodiscard]] auto find(const core::dicom_dataset& query)
+        -> Result<std::vector<core::dicom_dataset>> override;
+
+    [[nodiscard]] auto get_statistics() const -> storage_statistics override;
+
+    [[nodiscard]] auto verify_integrity() -> VoidResult override;
+
+    // =========================================================================
+    // Cache Control
+    // =========================================================================
+
+    /**
+     * @brief Whether an instance is currently cached
+     */
+    [[nodiscard]] auto is_cached(std::string_view sop_instance_uid) const
+        -> bool;
+
+    /**
+     * @brief Drop the cached copy of an instance, if any
+     */
+    void invalidate(std::string_view sop_instance_uid);
+
+    /**
+     * @brief Drop all cached objects
+     */
+    void clear();
+
+    /**
+     * @brief Get cache counters
+     */
+    [[nodiscard]] auto get_cache_statistics() const -> cache_statistics;
+
+    /**
+     * @brief Get the cache configuration
+     */
+    [[nodiscard]] auto config() const noexcept -> const cache_config&;
+
+    /**
+     * @brief Get the wrapped backend
+     */
+    [[nodiscard]] auto backend() const noexcept -> storage_interface*;
+
+private:
+    /**
+     * @brief Index entry of one cached instance
+     */
+    struct cache_entry {
+        /// Hex XXH64 digest naming the object file
+        std::string digest;
+
+        /// Object size in bytes
+        std::uint64_t size{0};
+
+        /// Position in lru_
+        std::list<std::string>::iterator lru;
+    };
+
+    /**
+     * @brief Remembered misses of an uncached instance
+     */
+    struct history_entry {
+        std::size_t misses{0};
+        std::list<std::string>::iterator lru;
+    };
+
+    /**
+     * @brief Read-through fills of one instance that are still fetching
+     */
+    struct pending_fill {
+        /// Bumped by invalidate() while any fill is in flight
+        std::uint64_t generation{0};
+
+        /// Number of fills in flight
+        std::size_t readers{0};
+    };
+
+    /**
+     * @brief Open a cached object, or return nullptr on a miss
+     */
+    [[nodiscard]] auto open_cached(std::string_view sop_instance_uid,
+                                   byte_range range)
+        -> Result<std::unique_ptr<byte_source>>;
+
+    /**
+     * @brief Serve a range of a mapped cached object and count the hit
+     */
+    [[nodiscard]] auto serve_mapped(core::memory_mapped_file mapped,
+                                    byte_range range)
+        -> Result<std::unique_ptr<byte_source>>;
+
+    /**
+     * @brief Count a whole-object miss and decide whether to cache it
+     */
+    [[nodiscard]] auto should_admit(std::string_view sop_instance_uid,
+                                    std::uint64_t size) -> bool;
+
+    /**
+     * @brief Write a fetched object to the cache
+     *
+     * Fails without caching anything if the instance was invalidated
+     * since begin_fill() returned @p generation: the fetched bytes may
+     * predate a store that completed during the fetch.
+     *
+     * @return Digest of the cached object
+     */
+    [[nodiscard]] auto admit(std::string_view sop_instance_uid,
+                             byte_source& source,
+                             std::uint64_t generation) -> Result<std::string>;
+
+    /**
+     * @brief Read a whole object through the cache
+     */
+    [[nodiscard]] auto read_object(std::string_view sop_instance_uid)
+        -> Result<std::unique_ptr<byte_source>>;
+
+    /**
+     * @brief Fetch a missed object from the backend and try to admit it
+     */
+    [[nodiscard]] auto read_through(std::string_view sop_instance_uid,
+                                    std::uint64_t generation)
+        -> Result<std::unique_ptr<byte_source>>;
+
+    /// Register a fill before its backend fetch; returns its generation
+    [[nodiscard]] auto begin_fill(std::string_view sop_instance_uid)
+        -> std::uint64_t;
+
+    /// Unregister a fill started by begin_fill()
+    void end_fill(std::string_view sop_instance_uid);
+
+    /// Replay the journal and discard anything not backed by a valid file
+    void load_index();
+
+    /// Rewrite the journal with one record per live entry
+    void compact_journal();
+
+    /// Append a record to the journal (caller holds mutex_)
+    void append_journal(const std::string& record);
+
+    /// Drop an entry and release its object file (caller holds mutex_)
+    void erase_entry(std::unordered_map<std::string, cache_entry>::iterator it);
+
+    /// Evict least recently used entries above max_bytes (caller holds mutex_)
+    void evict_to_fit();
+
+    [[nodiscard]] auto object_path(const std::string& digest) const
+        -> std::filesystem::path;
+
+    [[nodiscard]] auto journal_path() const -> std::filesystem::path;
+
+    /// Cached backend
+    std::shared_ptr<storage_interface> backend_;
+
+    /// Cache configuration
+    cache_config config_;
+
+    /// Cached instances by SOP Instance UID
+    std::unordered_map<std::string, cache_entry> entries_;
+
+    /// SOP Instance UIDs, most recently used first
+    std::list<std::string> lru_;
+
+    /// Instances referencing each object file (identical objects share one)
+    std::unordered_map<std::string, std::size_t> digest_refs_;
+
+    /// Miss counts of uncached instances for admission
+    std::unordered_map<std::string, history_entry> history_;
+
+    /// Instances in history_, most recently missed first
+    std::list<std::string> history_lru_;
+
+    /// Read-through fills in flight, by SOP Instance UID
+    std::unordered_map<std::string, pending_fill> pending_fills_;
+
+    /// Append-only index journal
+    std::ofstream journal_;
+
+    /// Records written to the journal since the last compaction
+    std::size_t journal_records_{0};
+
+    /// Counters
+    cache_statistics stats_;
+
+    /// Protects all of the above except backend_ and config_
+    mutable std::mutex mutex_;
+};
+
+}  // namespace kcenon::pacs::storage
@@ -0,0 +1,314 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file compressing_storage.h
+ * @brief Storage decorator applying a lossless compression policy on ingest
+ *
+ * This file provides the compressing_storage class which wraps another
+ * storage backend and converts incoming native instances to a lossless
+ * compressed transfer syntax, either inline (within a latency budget) or
+ * on a background queue after the instance has been stored as received.
+ *
+ * Because it implements storage_interface, it can be placed in front of any
+ * backend used by the Storage SCP handler, STOW-RS, or bulk import.
+ *
+ * @see compression_policy
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include "compression_policy.h"
+#include "storage_interface.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace kcenon::pacs::storage {
+
+class index_database;
+
+/**
+ * @brief Counters reported by compressing_storage
+ */
+struct compression_statistics {
+    /// Instances compressed before the store completed
+    std::size_t compressed_inline{0};
+
+    /// Instances compressed by the background queue
+    std::size_t compressed_background{0};
+
+    /// Instances deferred because the inline budget would be exceeded
+    std::size_t deferred{0};
+
+    /// Instances not matched by any rule (or already compressed)
+    std::size_t skipped{0};
+
+    /// Compressions that failed (instance kept as received)
+    std::size_t failed{0};
+
+    /// Jobs dropped because the background queue was full
+    std::size_t queue_overflows{0};
+
+    /// Jobs currently waiting or running in the background
+    std::size_t pending{0};
+
+    /// Pixel Data bytes before compression (compressed instances only)
+    std::uint64_t bytes_before{0};
+
+    /// Pixel Data bytes after compression
+    std::uint64_t bytes_after{0};
+
+    /// Achieved compression ratio (0 when nothing was compressed)
+    [[nodiscard]] auto compression_ratio() const noexcept -> double {
+        return bytes_after > 0
+                   ? static_cast<double>(bytes_before) / static_cast<double>(bytes_after)
+                   : 0.0;
+    }
+};
+
+/**
+ * @brief Storage decorator compressing native instances on ingest
+ *
+ * In budgeted mode the encode time of each instance is estimated from the
+ * throughput measured for its target transfer syntax; instances whose
+ * estimate exceeds compression_policy::inline_budget are stored as
+ * received and recompressed in the background. Background recompression
+ * swaps the compressed copy in with storage_interface::replace_file(), so
+ * readers observe either version but never a missing instance; backends
+ * without an atomic replace keep their instances as received. When an
+ * index database is given, the instance's file size, hash and transfer
+ * syntax are updated right after the swap, and the original is put back if
+ * that update fails.
+ *
+ * Thread Safety: All methods are thread-safe.
+ *
+ * @example
+ * @code
+ * auto files = std::make_shared<file_storage>(file_config);
+ *
+ * compression_policy policy;
+ * policy.rules.push_back({{"CT", "MR"}, {}, std::chrono::days{0},
+ *                         "1.2.840.10008.1.2.4.80"});
+ *
+ * compressing_storage storage{files, policy};
+ * storage.store(dataset);  // compressed inline or queued
+ * @endcode
+ */
+class compressing_storage : public storage_interface {
+public:
+    /**
+     * @brief Construct a compressing decorator
+     *
+     * @param backend Storage receiving the (compressed) instances
+     * @param policy Compression policy
+     * @param database Index whose instance records follow background
+     *                 recompression (optional). It is only accessed from
+     *                 the background workers, one at a time; callers using
+     *                 it concurrently must serialize access themselves.
+     */
+    compressing_storage(std::shared_ptr<storage_interface> backend,
+                        compression_policy policy,
+                        index_database* database = nullptr);
+
+    /**
+     * @brief Destructor; stops background workers
+     *
+     * Jobs still queued are dropped; their instances stay uncompressed.
+     */
+    ~compressing_storage() override;
+
+    compressing_storage(const compressing_storage&) = delete;
+    compressing_storage& operator=(const compressing_storage&) = delete;
+    compressing_storage(compressing_storage&&) = delete;
+    compressing_storage& operator=(compressing_storage&&) = delete;
+
+    // =========================================================================
+    // storage_interface Implementation
+    // =========================================================================
+
+    /**
+     * @brief Store a dataset, compressing it according to the policy
+     *
+     * Datasets already carrying encapsulated Pixel Data are passed through.
+     */
+    [[nodiscard]] auto store(const core::dicom_dataset& dataset)
+        -> VoidResult override;
+
+    /**
+     * @brief Store a Part 10 file, compressing it according to the policy
+     */
+    [[nodiscard]] auto store_file(const core::dicom_file& file)
+        -> VoidResult override;
+
+    [[nodiscard]] auto retrieve(std::string_view sop_instance_uid)
+        -> Result<core::dicom_dataset> override;
+
+    [[nodiscard]] auto retrieve_file(std::string_view sop_instance_uid)
+        -> Result<core::dicom_file> override;
+
+    /**
+     * @brief Replace an instance in the backend as given (not compressed)
+     */
+    [[nodiscard]] auto replace_file(const core::dicom_file& file)
+        -> Result<stored_instance> override;
+
+    /**
+     * @brief Open the backend bytes as stored (compressed or not)
+     *
+     * store_stream() is not overridden: the default decodes the stream and
+     * goes through store_file(), so the compression policy still applies.
+     */
+    [[nodiscard]] auto open_read(std::string_view sop_instance_uid,
+                                 byte_range range = {})
+        -> Result<std::unique_ptr<byte_source>> override;
+
+    [[nodiscard]] auto remove(std::string_view sop_instance_uid)
+        -> VoidResult override;
+
+    [[nodiscard]] auto exists(std::string_view sop_instance_uid) const
+        -> bool override;
+
+    [[nodiscard]] auto exists_batch(
+        const std::vector<std::string>& sop_instance_uids) const
+        -> std::vector<bool> override;
+
+    [[nodiscard]] auto find(const core::dicom_dataset& query)
+        -> Result<std::vector<core::dicom_dataset>> override;
+
+    [[nodiscard]] auto get_statistics() const -> storage_statistics override;
+
+    [[nodiscard]] auto verify_integrity() -> VoidResult override;
+
+    // =========================================================================
+    // Compression Control
+    // =========================================================================
+
+    /**
+     * @brief Get compression counters
+     */
+    [[nodiscard]] auto get_compression_statistics() const
+        -> compression_statistics;
+
+    /**
+     * @brief Get the compression policy
+     */
+    [[nodiscard]] auto policy() const noexcept -> const compression_policy&;
+
+    /**
+     * @brief Block until the background queue is empty
+     *
+     * @param timeout Maximum time to wait
+     * @return true if the queue drained before the timeout
+     */
+    auto wait_idle(std::chrono::milliseconds timeout) -> bool;
+
+    /**
+     * @brief Get the wrapped backend
+     */
+    [[nodiscard]] auto backend() const noexcept -> storage_interface*;
+
+private:
+    /**
+     * @brief Background job for one stored instance
+     */
+    struct pending_job {
+        std::string sop_instance_uid;
+        std::size_t rule_index{0};
+    };
+
+    /**
+     * @brief Compress inline or defer according to the mode and budget
+     */
+    [[nodiscard]] auto store_native(const core::dicom_file& file,
+                                    const compression_rule& rule) -> VoidResult;
+
+    /**
+     * @brief Compress a file and record timing and size counters
+     */
+    [[nodiscard]] auto compress_measured(const core::dicom_file& file,
+                                         const compression_rule& rule)
+        -> Result<core::dicom_file>;
+
+    /**
+     * @brief Estimated encode time for a Pixel Data size and target syntax
+     */
+    [[nodiscard]] auto estimate_encode_time(std::size_t pixel_bytes,
+                                            const std::string& transfer_syntax) const
+        -> std::chrono::microseconds;
+
+    /**
+     * @brief Queue an instance for background recompression
+     */
+    void enqueue(std::string sop_instance_uid, const compression_rule& rule);
+
+    /**
+     * @brief Recompress a stored instance and replace it in the backend
+     */
+    void process_job(const pending_job& job);
+
+    /**
+     * @brief Point the index record of a replaced instance at the new bytes
+     */
+    [[nodiscard]] auto update_index(const stored_instance& stored) -> VoidResult;
+
+    /// Background worker loop
+    void worker_loop();
+
+    /// Wrapped backend
+    std::shared_ptr<storage_interface> backend_;
+
+    /// Compression policy (immutable after construction)
+    compression_policy policy_;
+
+    /// Index updated after background recompression (may be null)
+    index_database* database_{nullptr};
+
+    /// Serializes workers' access to database_
+    std::mutex database_mutex_;
+
+    /// Measured encode throughput per Transfer Syntax UID (bytes/second)
+    std::unordered_map<std::string, double> throughput_;
+
+    /// Counters
+    compression_statistics stats_;
+
+    /// Protects throughput_ and stats_
+    mutable std::mutex stats_mutex_;
+
+    /// Background queue
+    std::deque<pending_job> queue_;
+
+    /// Jobs taken from the queue and not yet finished
+    std::size_t active_jobs_{0};
+
+    /// Protects queue_ and active_jobs_
+    mutable std::mutex queue_mutex_;
+
+    /// Signals new jobs and shutdown to workers
+    std::condition_variable queue_cv_;
+
+    /// Signals an empty, idle queue to wait_idle()
+    std::condition_variable idle_cv_;
+
+    /// Flag to signal shutdown
+    std::atomic<bool> stop_requested_{false};
+
+    /// Background workers
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace kcenon::pacs::storage
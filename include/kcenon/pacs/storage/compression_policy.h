@@ -0,0 +1,179 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file compression_policy.h
+ * @brief Lossless compression policy for stored DICOM instances
+ *
+ * This file defines the rules deciding which stored instances are converted
+ * to a lossless compressed transfer syntax (JPEG-LS, HTJ2K lossless, RLE),
+ * and when. The policy is applied on ingest by compressing_storage and on
+ * tier migration by hsm_storage.
+ *
+ * @see DICOM PS3.5 Section 10 - Transfer Syntax
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include <kcenon/pacs/core/dicom_dataset.h>
+#include <kcenon/pacs/core/dicom_file.h>
+
+#include <kcenon/common/patterns/result.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace kcenon::pacs::storage {
+
+/**
+ * @brief When ingest compression runs
+ */
+enum class compression_mode {
+    /// Compress before the store completes
+    inline_only,
+
+    /// Store as received, compress later on a background queue
+    background,
+
+    /// Compress inline when the estimated cost fits the latency budget,
+    /// otherwise defer to the background queue
+    budgeted
+};
+
+/**
+ * @brief Convert compression_mode to string
+ */
+[[nodiscard]] constexpr auto to_string(compression_mode mode) noexcept
+    -> std::string_view {
+    switch (mode) {
+        case compression_mode::inline_only:
+            return "inline";
+        case compression_mode::background:
+            return "background";
+        case compression_mode::budgeted:
+            return "budgeted";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief One selection rule of a compression policy
+ *
+ * Empty filters match everything.
+ */
+struct compression_rule {
+    /// Modalities (0008,0060) the rule applies to, e.g. {"CT", "MR"}
+    std::vector<std::string> modalities;
+
+    /// SOP Class UIDs the rule applies to
+    std::vector<std::string> sop_classes;
+
+    /// Minimum age of the study, from Study Date (0008,0020)
+    std::chrono::days min_study_age{0};
+
+    /// Target Transfer Syntax UID (must be lossless)
+    std::string transfer_syntax;
+};
+
+/**
+ * @brief Lossless compression policy
+ *
+ * Rules are evaluated in order and the first match wins. Only instances
+ * with native (uncompressed) Pixel Data are ever selected, and lossy
+ * target syntaxes are refused.
+ *
+ * @example
+ * @code
+ * compression_policy policy;
+ * policy.rules.push_back({{"CT", "MR"}, {}, std::chrono::days{0},
+ *                         "1.2.840.10008.1.2.4.80"});  // JPEG-LS lossless
+ * policy.inline_budget = std::chrono::milliseconds{100};
+ * @endcode
+ */
+struct compression_policy {
+    /// Selection rules, first match wins (empty = compression disabled)
+    std::vector<compression_rule> rules;
+
+    /// When ingest compression runs
+    compression_mode mode{compression_mode::budgeted};
+
+    /// Maximum estimated encode time for inline compression (budgeted mode)
+    std::chrono::milliseconds inline_budget{200};
+
+    /// Encode throughput assumed before any instance has been measured
+    std::size_t initial_throughput_bytes_per_sec{64ULL * 1024 * 1024};
+
+    /// Number of background compression workers
+    std::size_t background_workers{1};
+
+    /// Maximum queued background jobs (further jobs stay uncompressed)
+    std::size_t max_pending{10000};
+
+    /// Maximum frames encoded concurrently per instance (0 = hardware concurrency)
+    std::size_t max_parallel_frames{0};
+
+    /**
+     * @brief Check whether the policy has any rule
+     */
+    [[nodiscard]] auto enabled() const noexcept -> bool { return !rules.empty(); }
+
+    /**
+     * @brief Find the rule applying to a dataset
+     *
+     * @param dataset Instance to classify
+     * @param now Reference time for the study age
+     * @return Matching rule, or nullptr if no rule applies
+     */
+    [[nodiscard]] auto select(const core::dicom_dataset& dataset,
+                              std::chrono::system_clock::time_point now =
+                                  std::chrono::system_clock::now()) const
+        -> const compression_rule*;
+
+    /**
+     * @brief Find the rule applying to a stored file
+     *
+     * Same as select(), but also returns nullptr when the file is already
+     * encapsulated or has no Pixel Data.
+     */
+    [[nodiscard]] auto select(const core::dicom_file& file,
+                              std::chrono::system_clock::time_point now =
+                                  std::chrono::system_clock::now()) const
+        -> const compression_rule*;
+
+    /**
+     * @brief Compress a file according to a rule
+     *
+     * @param file Native instance
+     * @param rule Rule returned by select()
+     * @return Compressed file, or error when the target is lossy,
+     *         unsupported, or encoding fails
+     */
+    [[nodiscard]] auto compress(const core::dicom_file& file,
+                                const compression_rule& rule) const
+        -> kcenon::common::Result<core::dicom_file>;
+};
+
+/**
+ * @brief Check whether a dataset carries encapsulated Pixel Data
+ *
+ * Datasets handed to storage_interface::store() have no transfer syntax,
+ * so the Pixel Data value is inspected for the item structure of
+ * encapsulated data.
+ */
+[[nodiscard]] auto has_encapsulated_pixel_data(const core::dicom_dataset& dataset)
+    -> bool;
+
+/**
+ * @brief Size of the Pixel Data value in bytes (0 if absent)
+ */
+[[nodiscard]] auto pixel_data_size(const core::dicom_dataset& dataset)
+    -> std::size_t;
+
+}  // namespace kcenon::pacs::storage
@@ -0,0 +1,85 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file content_hash.h
+ * @brief Incremental content hash for stored object verification
+ *
+ * This file provides content_hasher, a streaming XXH64 implementation used
+ * to verify that bytes copied between storage backends arrived unchanged.
+ * XXH64 is not a cryptographic hash; it detects corruption, not tampering.
+ *
+ * @see https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace kcenon::pacs::storage {
+
+/**
+ * @brief Streaming XXH64 hasher
+ *
+ * Feeding the same bytes in any chunking yields the same digest.
+ *
+ * @example
+ * @code
+ * content_hasher hasher;
+ * hasher.update(first_chunk);
+ * hasher.update(second_chunk);
+ * auto digest = hasher.hex_digest();  // "xxh64:5c2c0b1f..."
+ * @endcode
+ */
+class content_hasher {
+public:
+    /**
+     * @brief Construct a hasher
+     * @param seed Hash seed (0 for stored-object digests)
+     */
+    explicit content_hasher(std::uint64_t seed = 0) noexcept;
+
+    /**
+     * @brief Feed bytes into the hash
+     * @param data Next chunk of content
+     */
+    void update(std::span<const std::uint8_t> data) noexcept;
+
+    /**
+     * @brief Digest of all bytes fed so far; the hasher stays usable
+     */
+    [[nodiscard]] auto digest() const noexcept -> std::uint64_t;
+
+    /**
+     * @brief Digest formatted as "xxh64:<16 hex digits>"
+     */
+    [[nodiscard]] auto hex_digest() const -> std::string;
+
+    /**
+     * @brief Number of bytes fed so far
+     */
+    [[nodiscard]] auto size() const noexcept -> std::uint64_t;
+
+    /**
+     * @brief One-shot digest of a buffer
+     */
+    [[nodiscard]] static auto hash(std::span<const std::uint8_t> data,
+                                   std::uint64_t seed = 0) noexcept
+        -> std::uint64_t;
+
+private:
+    std::uint64_t seed_;
+    std::array<std::uint64_t, 4> lanes_;
+    std::array<std::uint8_t, 32> buffer_{};
+    std::size_t buffered_{0};
+    std::uint64_t total_{0};
+};
+
+}  // namespace kcenon::pacs::storage
@@ -23,11 +23,16 @@
 #include <kcenon/pacs/core/dicom_file.h>
 
 #include <filesystem>
+#include <functional>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <unordered_map>
 
+namespace kcenon::pacs::encoding {
+class byte_sink;
+}  // namespace kcenon::pacs::encoding
+
 namespace kcenon::pacs::storage {
 
 /**
@@ -99,6 +104,12 @@ struct file_storage_config {
  * - Writes require exclusive lock
  * - File operations use atomic write pattern (write to temp, then rename)
  *
+ * Content Hashes:
+ * - store(), store_file() and store_stream() hash the bytes while writing
+ *   them (content_hasher, "xxh64:<hex>"); get_file_hash() hands the digest
+ *   to the caller recording the instance in the index database, so
+ *   instance_record::file_hash costs no extra read of the file
+ *
  * @example
  * @code
  * file_storage_config config;
@@ -163,6 +174,69 @@ public:
     [[nodiscard]] auto store(const core::dicom_dataset& dataset)
         -> VoidResult override;
 
+    /**
+     * @brief Store a DICOM file in its own transfer syntax
+     *
+     * Same layout and atomic write pattern as store(), but the Part 10 file
+     * keeps the transfer syntax of @p file (e.g. compressed Pixel Data).
+     *
+     * @param file The DICOM file to store
+     * @return VoidResult Success or error information
+     */
+    [[nodiscard]] auto store_file(const core::dicom_file& file)
+        -> VoidResult override;
+
+    /**
+     * @brief Retrieve a stored Part 10 file with its transfer syntax
+     *
+     * @param sop_instance_uid The unique identifier for the instance
+     * @return Result containing the file or error information
+     */
+    [[nodiscard]] auto retrieve_file(std::string_view sop_instance_uid)
+        -> Result<core::dicom_file> override;
+
+    /**
+     * @brief Replace a stored instance through temp file and rename
+     *
+     * Ignores the duplicate policy. The new file is written and flushed
+     * next to the old one and renamed over it, so readers open either
+     * version; the returned identity carries the size and content hash of
+     * the new file.
+     *
+     * @param file The DICOM file to store
+     * @return Identity of the stored instance or error information
+     */
+    [[nodiscard]] auto replace_file(const core::dicom_file& file)
+        -> Result<stored_instance> override;
+
+    /**
+     * @brief Write Part 10 bytes to the instance path unchanged
+     *
+     * The bytes are streamed to a temporary file under the root, the
+     * header is read back through a memory map to find the UIDs, and the
+     * file is renamed into place. The duplicate policy applies as in
+     * store().
+     *
+     * @param source Part 10 bytes
+     * @return Identity and content hash of the stored instance or error
+     *         information
+     */
+    [[nodiscard]] auto store_stream(byte_source& source)
+        -> Result<stored_instance> override;
+
+    /**
+     * @brief Memory-map the stored file, or a range of it
+     *
+     * The returned source exposes the mapped region through contiguous().
+     *
+     * @param sop_instance_uid The unique identifier for the instance
+     * @param range Byte range to read (default: whole file)
+     * @return Reader over the mapped bytes or error information
+     */
+    [[nodiscard]] auto open_read(std::string_view sop_instance_uid,
+                                 byte_range range = {})
+        -> Result<std::unique_ptr<byte_source>> override;
+
     /**
      * @brief Retrieve a DICOM dataset by SOP Instance UID
      *
@@ -190,6 +264,18 @@ public:
     [[nodiscard]] auto exists(std::string_view sop_instance_uid) const
         -> bool override;
 
+    /**
+     * @brief Check which of several DICOM instances exist
+     *
+     * Answers the whole batch from the in-memory index under one lock.
+     *
+     * @param sop_instance_uids The collection of UIDs to check
+     * @return One flag per UID, in the order given
+     */
+    [[nodiscard]] auto exists_batch(
+        const std::vector<std::string>& sop_instance_uids) const
+        -> std::vector<bool> override;
+
     /**
      * @brief Find DICOM datasets matching query criteria
      *
@@ -223,6 +309,17 @@ public:
     // File-specific Operations
     // =========================================================================
 
+    /**
+     * @brief Content hash of an instance computed when it was written
+     *
+     * @param sop_instance_uid The SOP Instance UID
+     * @return "xxh64:<hex>" digest of the stored file, or empty if the
+     *         instance was not written through this object (e.g. it was
+     *         found by rebuild_index())
+     */
+    [[nodiscard]] auto get_file_hash(std::string_view sop_instance_uid) const
+        -> std::string;
+
     /**
      * @brief Get the filesystem path for a SOP Instance UID
      *
@@ -232,6 +329,21 @@ public:
     [[nodiscard]] auto get_file_path(std::string_view sop_instance_uid) const
         -> std::filesystem::path;
 
+    /**
+     * @brief Read a single frame without loading the whole instance
+     *
+     * Uses the frame index sidecar of the instance (built and persisted on
+     * first access) to copy only the byte ranges of the requested frame.
+     *
+     * @param sop_instance_uid The SOP Instance UID
+     * @param frame_number 1-based frame number
+     * @return Frame bytes (the compressed bitstream for encapsulated
+     *         transfer syntaxes) or error information
+     */
+    [[nodiscard]] auto read_frame(std::string_view sop_instance_uid,
+                                  uint32_t frame_number) const
+        -> Result<std::vector<uint8_t>>;
+
     /**
      * @brief Import DICOM files from a directory
      *
@@ -264,6 +376,23 @@ private:
     // Internal Helper Methods
     // =========================================================================
 
+    /**
+     * @brief Place an instance in the storage layout and index it
+     * @param dataset The instance dataset (UIDs and Study Date)
+     * @param write Streams the Part 10 file into the given sink
+     * @param replace Overwrite an existing instance regardless of the
+     *                duplicate policy
+     * @return VoidResult Success or error information
+     *
+     * Shared by store(), store_file() and replace_file(): duplicate policy,
+     * directory creation, hashed temp-file write and atomic rename.
+     */
+    [[nodiscard]] auto write_instance(
+        const core::dicom_dataset& dataset,
+        const std::function<VoidResult(encoding::byte_sink&)>& write,
+        bool replace = false)
+        -> VoidResult;
+
     /**
      * @brief Build filesystem path for a dataset
      * @param study_uid Study Instance UID
@@ -288,13 +417,37 @@ private:
                                        std::string_view sop_uid) const
         -> std::filesystem::path;
 
+    /**
+     * @brief Build the path for an instance under the configured scheme
+     * @param study_uid Study Instance UID
+     * @param series_uid Series Instance UID
+     * @param sop_uid SOP Instance UID
+     * @param study_date Study date (YYYYMMDD, empty = today)
+     * @return The constructed path
+     */
+    [[nodiscard]] auto instance_path(std::string_view study_uid,
+                                     std::string_view series_uid,
+                                     std::string_view sop_uid,
+                                     std::string study_date) const
+        -> std::filesystem::path;
+
+    /**
+     * @brief Apply the duplicate policy to an incoming instance
+     * @param sop_uid SOP Instance UID
+     * @return true to write, false to skip silently, or error on reject
+     */
+    [[nodiscard]] auto admit_instance(const std::string& sop_uid) const
+        -> Result<bool>;
+
     /**
      * @brief Update internal index with new mapping
      * @param sop_uid SOP Instance UID
      * @param path File path
+     * @param content_hash Digest of the written file
      */
     void update_index(const std::string& sop_uid,
-                      const std::filesystem::path& path);
+                      const std::filesystem::path& path,
+                      std::string content_hash);
 
     /**
      * @brief Remove entry from internal index
@@ -329,6 +482,9 @@ private:
     /// Mapping from SOP Instance UID to file path
     std::unordered_map<std::string, std::filesystem::path> index_;
 
+    /// Content hashes of instances written since construction
+    std::unordered_map<std::string, std::string> hashes_;
+
     /// Mutex for thread-safe access
     mutable std::shared_mutex mutex_;
 };
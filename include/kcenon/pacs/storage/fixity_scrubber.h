@@ -0,0 +1,243 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file fixity_scrubber.h
+ * @brief Background re-verification of stored files against ingest hashes
+ *
+ * This file provides fixity_scrubber, which walks the instances table in
+ * primary key order and re-reads every stored file on a pool of worker
+ * threads, comparing its content hash with instance_record::file_hash
+ * recorded when the file was written. Reads are throttled to a bandwidth
+ * and IOPS budget so scrubbing does not starve clinical traffic, progress
+ * is checkpointed to a file so a restart resumes where the last run
+ * stopped, and findings are counted in pacs_metrics::fixity().
+ *
+ * @see file_storage::get_file_hash, content_hasher
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include "instance_record.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace kcenon::pacs::storage {
+
+class index_database;
+
+/**
+ * @brief Configuration for fixity_scrubber
+ */
+struct fixity_scrubber_config {
+    /// Worker threads reading and hashing files
+    std::size_t worker_count{2};
+
+    /// Instances fetched from the database per page
+    std::size_t batch_size{256};
+
+    /// Instances verified per run before it stops (0 = until the end of
+    /// the table); the next run resumes after the last one
+    std::size_t max_instances_per_run{0};
+
+    /// Read bandwidth across all workers in bytes per second (0 = unlimited)
+    std::uint64_t max_bytes_per_second{64ULL * 1024 * 1024};
+
+    /// Read requests per second across all workers; opening a file and
+    /// every chunk read count as one (0 = unlimited)
+    std::uint32_t max_iops{500};
+
+    /// Bytes per read request
+    std::size_t read_chunk_size{1024 * 1024};
+
+    /// Re-read and hash file content; false only checks existence and size
+    bool verify_content{true};
+
+    /// Record hashes for instances stored before ingest hashing existed
+    bool backfill_missing{true};
+
+    /// File holding the resume position (empty = keep it in memory only)
+    std::filesystem::path checkpoint_path;
+
+    /// Instances verified between checkpoint writes
+    std::size_t checkpoint_interval{1000};
+
+    /// Failures listed in a run report; all of them are counted
+    std::size_t max_reported_failures{100};
+};
+
+/**
+ * @brief Outcome of verifying one instance
+ */
+enum class fixity_status {
+    verified,    ///< Content matches the recorded hash
+    mismatch,    ///< Content or size differs from what was recorded
+    missing,     ///< File does not exist
+    unreadable,  ///< File exists but could not be read
+    backfilled,  ///< No hash was recorded; one has been computed and stored
+    skipped      ///< Hash of an unsupported algorithm, or none and no backfill
+};
+
+/**
+ * @brief Convert fixity_status to string
+ */
+[[nodiscard]] auto to_string(fixity_status status) -> std::string;
+
+/**
+ * @brief One instance that failed verification
+ */
+struct fixity_failure {
+    std::string sop_instance_uid;
+    std::string file_path;
+    fixity_status status{fixity_status::mismatch};
+
+    /// Recorded hash (or size, for size mismatches)
+    std::string expected;
+
+    /// Hash (or size) found on disk, empty if the file could not be read
+    std::string actual;
+};
+
+/**
+ * @brief Summary of one scrubber run
+ */
+struct fixity_report {
+    std::size_t checked{0};
+    std::size_t verified{0};
+    std::size_t mismatched{0};
+    std::size_t missing{0};
+    std::size_t unreadable{0};
+    std::size_t backfilled{0};
+    std::size_t skipped{0};
+
+    /// Bytes re-read from storage
+    std::uint64_t bytes_read{0};
+
+    /// Wall-clock duration of the run
+    std::chrono::milliseconds elapsed{0};
+
+    /// The run reached the end of the instances table; the next run
+    /// starts a new pass from the beginning
+    bool pass_completed{false};
+
+    /// Primary key the next run resumes after
+    int64_t resume_after_pk{0};
+
+    /// First max_reported_failures failures
+    std::vector<fixity_failure> failures;
+
+    /// Database error that ended the run early, empty otherwise
+    std::string error;
+
+    /// Number of corrupt, missing or unreadable instances found
+    [[nodiscard]] auto failure_count() const noexcept -> std::size_t {
+        return mismatched + missing + unreadable;
+    }
+};
+
+/**
+ * @brief Throttled, resumable verifier of stored file hashes
+ *
+ * Each run() walks the instances table from the checkpoint in pages of
+ * batch_size records. A page is verified by worker_count threads sharing
+ * one bandwidth and one IOPS budget; when the page is done the checkpoint
+ * advances past it. Hashes are only compared for "xxh64:" digests, which
+ * is what file_storage records at ingest.
+ *
+ * Database access (paging and hash backfill) happens on the thread calling
+ * run(); workers only read files.
+ *
+ * @example
+ * @code
+ * fixity_scrubber_config config;
+ * config.checkpoint_path = "/var/lib/pacs/fixity.checkpoint";
+ * config.max_bytes_per_second = 32 * 1024 * 1024;
+ *
+ * fixity_scrubber scrubber(database, config);
+ * auto report = scrubber.run();
+ * for (const auto& failure : report.failures) {
+ *     // quarantine or restore failure.sop_instance_uid
+ * }
+ * @endcode
+ */
+class fixity_scrubber {
+public:
+    /**
+     * @brief Construct a scrubber, loading the checkpoint if there is one
+     * @param database Index database holding instance paths and hashes
+     * @param config Worker, throttle and checkpoint settings
+     */
+    explicit fixity_scrubber(index_database& database,
+                             fixity_scrubber_config config = {});
+
+    /// Non-copyable, non-movable (shared with running workers)
+    fixity_scrubber(const fixity_scrubber&) = delete;
+    auto operator=(const fixity_scrubber&) -> fixity_scrubber& = delete;
+    fixity_scrubber(fixity_scrubber&&) = delete;
+    auto operator=(fixity_scrubber&&) -> fixity_scrubber& = delete;
+
+    ~fixity_scrubber() = default;
+
+    /**
+     * @brief Verify instances from the checkpoint on
+     *
+     * Blocks until max_instances_per_run instances are verified, the end
+     * of the table is reached, or cancel() is called. Only one run is
+     * active at a time; concurrent calls wait for each other.
+     *
+     * @return Summary of the run
+     */
+    auto run() -> fixity_report;
+
+    /**
+     * @brief Ask a running run() to stop after the current page
+     */
+    void cancel() noexcept;
+
+    /**
+     * @brief Primary key the next run resumes after (0 = start of a pass)
+     */
+    [[nodiscard]] auto checkpoint() const noexcept -> int64_t;
+
+    /**
+     * @brief Restart from the beginning of the table on the next run
+     */
+    void reset_checkpoint();
+
+    /**
+     * @brief Number of full passes over the table since construction
+     */
+    [[nodiscard]] auto passes_completed() const noexcept -> std::size_t;
+
+    /**
+     * @brief Get the configuration
+     */
+    [[nodiscard]] auto config() const noexcept -> const fixity_scrubber_config&;
+
+private:
+    /// Load the resume position from checkpoint_path
+    void load_checkpoint();
+
+    /// Persist the resume position to checkpoint_path
+    void save_checkpoint(int64_t after_pk) const;
+
+    index_database& database_;
+    fixity_scrubber_config config_;
+
+    std::mutex run_mutex_;
+    std::atomic<int64_t> checkpoint_{0};
+    std::atomic<std::size_t> passes_completed_{0};
+    std::atomic<bool> cancel_requested_{false};
+};
+
+}  // namespace kcenon::pacs::storage
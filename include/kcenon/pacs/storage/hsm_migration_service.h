@@ -48,9 +48,14 @@ struct migration_service_config {
     /// Interval between migration cycles
     std::chrono::seconds migration_interval{3600};  // 1 hour default
 
-    /// Maximum concurrent migrations
+    /// Maximum concurrent migrations within a cycle
+    /// (0 = hsm_storage_config::migration_parallelism)
     std::size_t max_concurrent_migrations{4};
 
+    /// Interval for applying buffered access times between cycles
+    /// (see hsm_storage::flush_access_times(); 0 = only at cycle start)
+    std::chrono::seconds access_flush_interval{60};
+
     /// Whether to start automatically on construction
     bool auto_start{false};
 
@@ -151,8 +156,9 @@ public:
     /**
      * @brief Stop the background migration service
      *
-     * Gracefully stops the service, waiting for any in-progress migrations
-     * to complete. If not started, this is a no-op.
+     * Gracefully stops the service. A running cycle is cancelled after its
+     * in-flight transfers complete; the instances it did not reach are
+     * migrated by a later cycle. If not started, this is a no-op.
      *
      * @param wait_for_completion If true, waits for current cycle to complete
      */
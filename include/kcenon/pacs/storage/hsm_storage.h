@@ -17,11 +17,19 @@
 
 #pragma once
 
+#include "access_tracker.h"
+#include "compression_policy.h"
 #include "hsm_types.h"
 #include "storage_interface.h"
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <shared_mutex>
+#include <tuple>
 #include <unordered_map>
 
 namespace kcenon::pacs::storage {
@@ -37,12 +45,36 @@ struct hsm_storage_config {
     /// When true, retrieves update the last_accessed timestamp
     bool track_access_time{true};
 
+    /// Resolution of recorded access times. Retrieves only buffer the
+    /// access; buffered times reach the metadata on flush_access_times().
+    std::chrono::system_clock::duration access_time_granularity{
+        std::chrono::seconds{1}};
+
     /// Whether to verify data integrity after migration
     bool verify_after_migration{true};
 
     /// Whether to remove source after successful migration
     /// When false, data is copied (not moved) between tiers
     bool delete_after_migration{true};
+
+    /// Lossless recompression applied when instances move to the warm tier
+    /// (no rules = keep the stored transfer syntax)
+    compression_policy warm_compression;
+
+    /// Lossless recompression applied when instances move to the cold tier
+    compression_policy cold_compression;
+
+    /// Move stored bytes between tiers unchanged instead of decoding and
+    /// re-encoding the instance. Tiers with recompression enabled always
+    /// take the decode path.
+    bool byte_copy_migration{true};
+
+    /// Instances migrated concurrently within one cycle
+    std::size_t migration_parallelism{1};
+
+    /// Read bandwidth shared by all migration transfers in bytes per second
+    /// (0 = unlimited)
+    std::uint64_t migration_bandwidth_limit{0};
 };
 
 /**
@@ -141,7 +173,8 @@ public:
      * @brief Retrieve a DICOM dataset by SOP Instance UID
      *
      * Searches all tiers for the instance, starting from hot tier.
-     * If track_access_time is enabled, updates the last access timestamp.
+     * If track_access_time is enabled, records the access without taking
+     * the exclusive metadata lock (see flush_access_times()).
      *
      * @param sop_instance_uid The unique identifier for the instance
      * @return Result containing the dataset or error information
@@ -149,6 +182,44 @@ public:
     [[nodiscard]] auto retrieve(std::string_view sop_instance_uid)
         -> Result<core::dicom_dataset> override;
 
+    /**
+     * @brief Store a DICOM file in the hot tier, keeping its transfer syntax
+     *
+     * @param file The DICOM file to store
+     * @return VoidResult Success or error information
+     */
+    [[nodiscard]] auto store_file(const core::dicom_file& file)
+        -> VoidResult override;
+
+    /**
+     * @brief Retrieve a stored instance from whichever tier holds it
+     *
+     * @param sop_instance_uid The SOP Instance UID to retrieve
+     * @return Result containing the file or error information
+     */
+    [[nodiscard]] auto retrieve_file(std::string_view sop_instance_uid)
+        -> Result<core::dicom_file> override;
+
+    /**
+     * @brief Store Part 10 bytes unchanged in the hot tier
+     *
+     * @param source Part 10 bytes
+     * @return Identity of the stored instance or error information
+     */
+    [[nodiscard]] auto store_stream(byte_source& source)
+        -> Result<stored_instance> override;
+
+    /**
+     * @brief Open the stored bytes from whichever tier holds the instance
+     *
+     * @param sop_instance_uid The SOP Instance UID to read
+     * @param range Byte range to read (default: whole object)
+     * @return Reader over the stored bytes or error information
+     */
+    [[nodiscard]] auto open_read(std::string_view sop_instance_uid,
+                                 byte_range range = {})
+        -> Result<std::unique_ptr<byte_source>> override;
+
     /**
      * @brief Remove a DICOM dataset from all tiers
      *
@@ -169,6 +240,18 @@ public:
     [[nodiscard]] auto exists(std::string_view sop_instance_uid) const
         -> bool override;
 
+    /**
+     * @brief Check which of several DICOM instances exist in any tier
+     *
+     * Answers the whole batch from the metadata index under one lock.
+     *
+     * @param sop_instance_uids The collection of UIDs to check
+     * @return One flag per UID, in the order given
+     */
+    [[nodiscard]] auto exists_batch(
+        const std::vector<std::string>& sop_instance_uids) const
+        -> std::vector<bool> override;
+
     /**
      * @brief Find DICOM datasets matching query criteria across all tiers
      *
@@ -221,6 +304,10 @@ public:
     /**
      * @brief Manually migrate an instance to a different tier
      *
+     * The stored transfer syntax is preserved. Native instances moving to
+     * the warm or cold tier are recompressed when the tier's
+     * compression policy selects them.
+     *
      * @param sop_instance_uid The SOP Instance UID to migrate
      * @param target_tier The target tier
      * @return VoidResult Success or error information
@@ -235,6 +322,8 @@ public:
      * @brief Get instances eligible for migration
      *
      * Returns instances that should be migrated based on the tier policy.
+     * Only instances inactive past the policy threshold are visited, in
+     * order of last activity; accesses not yet flushed are honored.
      *
      * @param from_tier Source tier to check
      * @param to_tier Target tier
@@ -247,12 +336,44 @@ public:
     /**
      * @brief Run a single migration cycle
      *
-     * Migrates eligible instances according to the tier policy.
+     * Migrates eligible instances according to the tier policy, with
+     * hsm_storage_config::migration_parallelism concurrent transfers.
+     *
+     * A cycle is resumable: instances not reached (budget exhausted or
+     * cancel_migration()) stay in their tier and are picked up by the next
+     * cycle, and a transfer interrupted after its copy landed completes
+     * without copying again once the target digest matches the source.
      *
      * @return Migration result with statistics
      */
     [[nodiscard]] auto run_migration_cycle() -> migration_result;
 
+    /**
+     * @brief Run a single migration cycle with the given parallelism
+     *
+     * @param parallelism Concurrent transfers (0 = use the configuration)
+     * @return Migration result with statistics
+     */
+    [[nodiscard]] auto run_migration_cycle(std::size_t parallelism)
+        -> migration_result;
+
+    /**
+     * @brief Apply buffered access times to the tier metadata
+     *
+     * Called at the start of every migration cycle; hsm_migration_service
+     * also calls it periodically between cycles.
+     *
+     * @return Number of buffered accesses applied
+     */
+    auto flush_access_times() -> std::size_t;
+
+    /**
+     * @brief Stop the running migration cycle after in-flight transfers
+     *
+     * Thread-safe. The flag is cleared when the next cycle starts.
+     */
+    void cancel_migration() noexcept;
+
     /**
      * @brief Get the current tier policy
      *
@@ -313,11 +434,20 @@ private:
     void update_metadata(std::string_view sop_instance_uid, storage_tier tier,
                          const core::dicom_dataset& dataset);
 
+    /**
+     * @brief Update tier metadata after a byte-stream store
+     * @param instance Identity and size reported by the tier
+     * @param tier The tier where the instance is stored
+     */
+    void update_metadata(const stored_instance& instance, storage_tier tier);
+
     /**
      * @brief Update last access time for an instance
      * @param sop_instance_uid The SOP Instance UID
+     * @param when Access time (earlier than the recorded one = no change)
      */
-    void update_access_time(std::string_view sop_instance_uid);
+    void update_access_time(std::string_view sop_instance_uid,
+                            std::chrono::system_clock::time_point when);
 
     /**
      * @brief Remove tier metadata
@@ -325,16 +455,73 @@ private:
      */
     void remove_metadata(std::string_view sop_instance_uid);
 
+    /**
+     * @brief Insert or replace metadata, keeping activity_index_ in sync
+     * @param meta The new metadata
+     */
+    void put_metadata(tier_metadata meta);
+
+    /**
+     * @brief Key of an instance in activity_index_
+     */
+    [[nodiscard]] static auto activity_key(const tier_metadata& meta)
+        -> std::tuple<storage_tier, std::chrono::system_clock::time_point,
+                      std::string>;
+
     /**
      * @brief Migrate a single instance between tiers
      * @param uid The SOP Instance UID
      * @param from_tier Source tier
      * @param to_tier Target tier
-     * @return VoidResult Success or error information
+     * @return Bytes written to the target tier, or error information
      */
     [[nodiscard]] auto migrate_instance(std::string_view uid,
                                          storage_tier from_tier,
-                                         storage_tier to_tier) -> VoidResult;
+                                         storage_tier to_tier)
+        -> Result<std::uint64_t>;
+
+    /**
+     * @brief Copy the stored bytes to the target tier and verify the digest
+     * @param uid The SOP Instance UID
+     * @param source Source tier backend
+     * @param target Target tier backend
+     * @return Bytes written to the target tier, or error information
+     */
+    [[nodiscard]] auto copy_instance_bytes(std::string_view uid,
+                                           storage_interface& source,
+                                           storage_interface& target)
+        -> Result<std::uint64_t>;
+
+    /**
+     * @brief Decode, optionally recompress, and store to the target tier
+     * @param uid The SOP Instance UID
+     * @param source Source tier backend
+     * @param target Target tier backend
+     * @param to_tier Target tier (selects the compression policy)
+     * @return VoidResult Success or error information
+     */
+    [[nodiscard]] auto transcode_instance(std::string_view uid,
+                                          storage_interface& source,
+                                          storage_interface& target,
+                                          storage_tier to_tier) -> VoidResult;
+
+    /**
+     * @brief Migrate the candidates of one tier pair with a worker pool
+     * @param candidates Instances to migrate, oldest first
+     * @param from_tier Source tier
+     * @param to_tier Target tier
+     * @param parallelism Number of workers
+     * @param result Cycle result to accumulate into
+     */
+    void migrate_candidates(const std::vector<tier_metadata>& candidates,
+                            storage_tier from_tier, storage_tier to_tier,
+                            std::size_t parallelism, migration_result& result);
+
+    /**
+     * @brief Wait until the bandwidth cap allows reading more bytes
+     * @param bytes Size of the next read
+     */
+    void throttle_transfer(std::size_t bytes);
 
     // =========================================================================
     // Member Variables
@@ -355,8 +542,34 @@ private:
     /// Tier metadata index (SOP Instance UID -> metadata)
     std::unordered_map<std::string, tier_metadata> metadata_index_;
 
+    /// Instances ordered by tier, then last activity (access or store time)
+    std::set<std::tuple<storage_tier, std::chrono::system_clock::time_point,
+                        std::string>>
+        activity_index_;
+
     /// Mutex for thread-safe access
     mutable std::shared_mutex mutex_;
+
+    /// Accesses recorded by retrieves, not yet applied to metadata_index_
+    access_tracker access_tracker_;
+
+    /// Instances recompressed during migration since construction
+    std::atomic<std::size_t> instances_recompressed_{0};
+
+    /// Set by cancel_migration(), cleared when a cycle starts
+    std::atomic<bool> migration_cancelled_{false};
+
+    /// Cumulative migration transfer counters
+    migration_throughput throughput_;
+
+    /// Mutex for throughput_
+    mutable std::mutex throughput_mutex_;
+
+    /// Earliest time the next throttled read may start
+    std::chrono::steady_clock::time_point throttle_next_{};
+
+    /// Mutex for throttle_next_
+    std::mutex throttle_mutex_;
 };
 
 }  // namespace kcenon::pacs::storage
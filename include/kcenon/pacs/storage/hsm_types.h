@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -243,6 +244,13 @@ struct migration_result {
     /// Number of instances that were skipped (not eligible)
     std::size_t instances_skipped{0};
 
+    /// Number of migrated instances recompressed on the way to their tier
+    std::size_t instances_recompressed{0};
+
+    /// True when the cycle was cancelled before all candidates were handled;
+    /// the remaining candidates stay in their tier for the next cycle
+    bool interrupted{false};
+
     /**
      * @brief Check if the migration was completely successful
      * @return true if no failures occurred
@@ -257,6 +265,16 @@ struct migration_result {
     [[nodiscard]] auto total_processed() const noexcept -> std::size_t {
         return instances_migrated + failed_uids.size() + instances_skipped;
     }
+
+    /**
+     * @brief Migration throughput of this cycle in bytes per second
+     */
+    [[nodiscard]] auto bytes_per_second() const noexcept -> double {
+        return duration.count() > 0
+                   ? static_cast<double>(bytes_migrated) * 1000.0 /
+                         static_cast<double>(duration.count())
+                   : 0.0;
+    }
 };
 
 /**
@@ -276,6 +294,46 @@ struct tier_statistics {
     std::size_t series_count{0};
 };
 
+/**
+ * @brief Cumulative migration transfer counters
+ */
+struct migration_throughput {
+    /// Bytes written to target tiers
+    std::uint64_t bytes_copied{0};
+
+    /// Instances moved between tiers
+    std::size_t instances_copied{0};
+
+    /// Instances moved as raw bytes without decoding
+    std::size_t byte_copies{0};
+
+    /// Instances decoded and re-encoded (recompression enabled for the tier)
+    std::size_t transcoded_copies{0};
+
+    /// Interrupted migrations finished without copying again because the
+    /// target already held identical bytes
+    std::size_t resumed{0};
+
+    /// Copies rejected because the target digest differed from the source
+    std::size_t verification_failures{0};
+
+    /// Wall-clock time spent in migration cycles
+    std::chrono::milliseconds busy_time{0};
+
+    /// Throughput of the most recent migration cycle
+    double last_cycle_bytes_per_second{0.0};
+
+    /**
+     * @brief Average throughput over all migration cycles
+     */
+    [[nodiscard]] auto bytes_per_second() const noexcept -> double {
+        return busy_time.count() > 0
+                   ? static_cast<double>(bytes_copied) * 1000.0 /
+                         static_cast<double>(busy_time.count())
+                   : 0.0;
+    }
+};
+
 /**
  * @brief Combined statistics for all HSM tiers
  */
@@ -289,6 +347,9 @@ struct hsm_statistics {
     /// Statistics for cold tier
     tier_statistics cold;
 
+    /// Migration transfer counters since construction
+    migration_throughput migration;
+
     /**
      * @brief Get total instance count across all tiers
      */
@@ -26,7 +26,9 @@
 #include "migration_runner.h"
 #include "mpps_record.h"
 #include "patient_record.h"
+#include "retention_policy.h"
 #include "series_record.h"
+#include "study_digest.h"
 #include "study_record.h"
 #include "ups_workitem.h"
 #include "worklist_record.h"
@@ -39,6 +41,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #ifdef PACS_WITH_DATABASE_SYSTEM
@@ -356,6 +359,119 @@ public:
     [[nodiscard]] auto update_modalities_in_study(int64_t study_pk)
         -> VoidResult;
 
+    // ========================================================================
+    // Study Digest Operations
+    // ========================================================================
+
+    /**
+     * @brief Recompute the digest buckets of days changed since last time
+     *
+     * Triggers record every day whose studies, instance counts or modality
+     * sets change; this folds those days into the bucket table. Digest
+     * reads do it for the days they cover, so calling this is only needed
+     * to keep the work off the read path.
+     *
+     * @return Result containing the number of days recomputed or error
+     */
+    [[nodiscard]] auto refresh_study_digests() -> Result<size_t>;
+
+    /**
+     * @brief Get the children of a node of the study digest tree
+     *
+     * Children of the root are months, of a month days, and of a day its
+     * buckets; a bucket has none. Only studies within @p scope count.
+     *
+     * @param parent_key "", "YYYYMM" or "YYYYMMDD" (see study_digest.h)
+     * @param scope Date range and modalities the tree covers
+     * @return Result containing the child nodes sorted by key, or error
+     */
+    [[nodiscard]] auto study_digest_children(std::string_view parent_key,
+                                             const study_digest_scope& scope)
+        -> Result<std::vector<study_digest_node>>;
+
+    /**
+     * @brief Get the root of the study digest tree
+     *
+     * @param scope Date range and modalities the tree covers
+     * @return Result containing the root node or error
+     */
+    [[nodiscard]] auto study_digest_root(const study_digest_scope& scope)
+        -> Result<study_digest_node>;
+
+    /**
+     * @brief List the studies of one digest bucket
+     *
+     * @param bucket_key Bucket key, "YYYYMMDD/<modalities>"
+     * @return Result containing the bucket's studies sorted by UID, or error
+     */
+    [[nodiscard]] auto study_digest_members(std::string_view bucket_key) const
+        -> Result<std::vector<study_digest_entry>>;
+
+    // ========================================================================
+    // Retention Operations
+    // ========================================================================
+
+    /**
+     * @brief Find expired studies in StudyDate order
+     *
+     * Evaluates @p criteria as one query driven by the study_date index,
+     * with per-modality rules checked against study_modalities. Pages are
+     * keyed by (study_date, study_pk); pass the last candidate of a page to
+     * get the next one.
+     *
+     * @param criteria Cutoffs and exclusions (see retention_policy.h)
+     * @param after_date StudyDate of the last candidate seen ("" = start)
+     * @param after_pk Primary key of the last candidate seen (0 = start)
+     * @param limit Maximum number of candidates to return
+     * @return Result containing the expired studies or error
+     */
+    [[nodiscard]] auto find_retention_candidates(const retention_criteria& criteria,
+                                                 std::string_view after_date,
+                                                 int64_t after_pk,
+                                                 size_t limit) const
+        -> Result<std::vector<retention_candidate>>;
+
+    /**
+     * @brief Delete studies and queue their files in one transaction
+     *
+     * Series and instances go with their studies. When @p queue_files is
+     * set, the instances' file paths are moved to the unlink queue in the
+     * same transaction, so a crash cannot lose track of a deleted file.
+     *
+     * @param study_pks Primary keys of the studies (at most 500)
+     * @param queue_files Queue the studies' files for unlinking
+     * @return Result containing the batch counts or error
+     */
+    [[nodiscard]] auto delete_expired_studies(const std::vector<int64_t>& study_pks,
+                                              bool queue_files)
+        -> Result<retention_batch>;
+
+    /**
+     * @brief List queued files in queue order
+     *
+     * @param after_pk Queue key of the last file seen (0 = start)
+     * @param limit Maximum number of files to return
+     * @return Result containing the queued files or error
+     */
+    [[nodiscard]] auto list_retention_unlinks(int64_t after_pk, size_t limit) const
+        -> Result<std::vector<retention_unlink>>;
+
+    /**
+     * @brief Remove unlinked files from the queue
+     *
+     * @param pks Queue keys of the files
+     * @return VoidResult indicating success or error
+     */
+    [[nodiscard]] auto complete_retention_unlinks(const std::vector<int64_t>& pks)
+        -> VoidResult;
+
+    /**
+     * @brief Get the number of files waiting to be unlinked
+     *
+     * @return Result containing the queue length or error
+     */
+    [[nodiscard]] auto retention_unlink_count() const -> Result<size_t>;
+
     // ========================================================================
     // Series Operations
     // ========================================================================
@@ -521,6 +637,20 @@ public:
     [[nodiscard]] auto list_instances(std::string_view series_uid) const
         -> Result<std::vector<instance_record>>;
 
+    /**
+     * @brief List instances in primary key order, one page at a time
+     *
+     * Walks the whole instances table without OFFSET scans; the pk of the
+     * last record of a page is the @p after_pk of the next, so a walk can
+     * be checkpointed and resumed.
+     *
+     * @param after_pk Return instances with a larger primary key (0 = start)
+     * @param limit Maximum number of instances to return
+     * @return Result containing up to @p limit instance records or error
+     */
+    [[nodiscard]] auto list_instances_after(int64_t after_pk, size_t limit) const
+        -> Result<std::vector<instance_record>>;
+
     /**
      * @brief Search instances with query criteria
      *
@@ -532,6 +662,23 @@ public:
     [[nodiscard]] auto search_instances(const instance_query& query) const
         -> Result<std::vector<instance_record>>;
 
+    /**
+     * @brief Record a content hash for an instance that has none
+     *
+     * A conditional update: the row changes only while its file_hash is
+     * empty and its file_size equals @p file_size (or is 0), so a hash
+     * computed from a file that has since been re-stored is discarded.
+     *
+     * @param sop_uid The SOP Instance UID
+     * @param file_hash Digest of the file content ("xxh64:<hex>")
+     * @param file_size Number of bytes that were hashed
+     * @return Result containing true if the hash was recorded, or error
+     */
+    [[nodiscard]] auto set_missing_file_hash(std::string_view sop_uid,
+                                             std::string_view file_hash,
+                                             int64_t file_size)
+        -> Result<bool>;
+
     /**
      * @brief Delete an instance by SOP Instance UID
      *
@@ -1070,6 +1217,20 @@ public:
     [[nodiscard]] auto get_series_files(std::string_view series_instance_uid) const
         -> Result<std::vector<std::string>>;
 
+    /**
+     * @brief Get the recorded file hashes of several instances
+     *
+     * Resolves a whole batch with a few indexed IN-list queries, e.g. to
+     * check a storage commitment request against stored checksums.
+     *
+     * @param sop_instance_uids The SOP Instance UIDs to look up
+     * @return Result containing a map from UID to file hash (empty if none
+     *         was recorded) for every indexed UID, or error
+     */
+    [[nodiscard]] auto get_file_hashes(
+        const std::vector<std::string>& sop_instance_uids) const
+        -> Result<std::unordered_map<std::string, std::string>>;
+
     // ========================================================================
     // Database Maintenance Operations
     // ========================================================================
@@ -1222,6 +1383,13 @@ private:
     [[nodiscard]] static auto to_like_pattern(std::string_view pattern)
         -> std::string;
 
+    /**
+     * @brief Recompute digest buckets of dirty days within [from, to]
+     */
+    [[nodiscard]] auto refresh_study_digests(std::string_view from_date,
+                                             std::string_view to_date)
+        -> Result<size_t>;
+
 #ifdef PACS_WITH_DATABASE_SYSTEM
     /// PACS database adapter for unified database operations
     /// Provides simplified API through pacs_database_adapter (Issue #606)
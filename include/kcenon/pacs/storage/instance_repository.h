@@ -25,6 +25,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #ifdef PACS_WITH_DATABASE_SYSTEM
@@ -102,6 +103,20 @@ public:
     [[nodiscard]] auto list_instances(std::string_view series_uid)
         -> Result<std::vector<instance_record>>;
 
+    /**
+     * @brief List instance records in primary key order after a given key.
+     *
+     * Keyset pagination over the whole table for resumable walks such as
+     * fixity verification: pass the pk of the last record of one page to
+     * get the next.
+     *
+     * @param after_pk Return records with a larger primary key (0 = start)
+     * @param limit Maximum number of records to return
+     * @return Result containing up to @p limit records, or an error
+     */
+    [[nodiscard]] auto list_instances_after(int64_t after_pk, size_t limit)
+        -> Result<std::vector<instance_record>>;
+
     /**
      * @brief Search for instance records matching the given query criteria.
      * @param query Query parameters including optional filters and pagination
@@ -110,6 +125,23 @@ public:
     [[nodiscard]] auto search_instances(const instance_query& query)
         -> Result<std::vector<instance_record>>;
 
+    /**
+     * @brief Record a content hash for an instance that has none.
+     *
+     * Only updates the row while its file_hash is still empty and its
+     * file_size matches the hashed content (or is unknown), so a record
+     * re-stored after the file was read is left alone.
+     *
+     * @param sop_uid SOP Instance UID of the instance
+     * @param file_hash Digest of the file content
+     * @param file_size Number of bytes that were hashed
+     * @return Result containing true if the row was updated, or an error
+     */
+    [[nodiscard]] auto set_missing_file_hash(std::string_view sop_uid,
+                                             std::string_view file_hash,
+                                             int64_t file_size)
+        -> Result<bool>;
+
     /**
      * @brief Delete an instance record by its SOP Instance UID.
      * @param sop_uid SOP Instance UID of the instance to delete
@@ -157,6 +189,20 @@ public:
     [[nodiscard]] auto get_series_files(std::string_view series_instance_uid)
         -> Result<std::vector<std::string>>;
 
+    /**
+     * @brief Retrieve the stored file hashes of several instances.
+     *
+     * Looks the UIDs up in chunks of IN-list queries on the sop_uid index
+     * instead of one query per instance.
+     *
+     * @param sop_instance_uids SOP Instance UIDs to look up
+     * @return Result containing a map from UID to file hash (empty if none
+     *         was recorded) for every UID that is indexed, or an error
+     */
+    [[nodiscard]] auto get_file_hashes(
+        const std::vector<std::string>& sop_instance_uids)
+        -> Result<std::unordered_map<std::string, std::string>>;
+
 protected:
     [[nodiscard]] auto map_row_to_entity(const database_row& row) const
         -> instance_record override;
@@ -257,6 +303,20 @@ public:
     [[nodiscard]] auto list_instances(std::string_view series_uid) const
         -> Result<std::vector<instance_record>>;
 
+    /**
+     * @brief List instance records in primary key order after a given key.
+     *
+     * Keyset pagination over the whole table for resumable walks such as
+     * fixity verification: pass the pk of the last record of one page to
+     * get the next.
+     *
+     * @param after_pk Return records with a larger primary key (0 = start)
+     * @param limit Maximum number of records to return
+     * @return Result containing up to @p limit records, or an error
+     */
+    [[nodiscard]] auto list_instances_after(int64_t after_pk, size_t limit) const
+        -> Result<std::vector<instance_record>>;
+
     /**
      * @brief Search for instance records matching the given query criteria.
      * @param query Query parameters including optional filters and pagination
@@ -265,6 +325,23 @@ public:
     [[nodiscard]] auto search_instances(const instance_query& query) const
         -> Result<std::vector<instance_record>>;
 
+    /**
+     * @brief Record a content hash for an instance that has none.
+     *
+     * Only updates the row while its file_hash is still empty and its
+     * file_size matches the hashed content (or is unknown), so a record
+     * re-stored after the file was read is left alone.
+     *
+     * @param sop_uid SOP Instance UID of the instance
+     * @param file_hash Digest of the file content
+     * @param file_size Number of bytes that were hashed
+     * @return Result containing true if the row was updated, or an error
+     */
+    [[nodiscard]] auto set_missing_file_hash(std::string_view sop_uid,
+                                             std::string_view file_hash,
+                                             int64_t file_size)
+        -> Result<bool>;
+
     /**
      * @brief Delete an instance record by its SOP Instance UID.
      * @param sop_uid SOP Instance UID of the instance to delete
@@ -312,6 +389,20 @@ public:
     [[nodiscard]] auto get_series_files(std::string_view series_instance_uid) const
         -> Result<std::vector<std::string>>;
 
+    /**
+     * @brief Retrieve the stored file hashes of several instances.
+     *
+     * Looks the UIDs up in chunks of IN-list queries on the sop_uid index
+     * instead of one query per instance.
+     *
+     * @param sop_instance_uids SOP Instance UIDs to look up
+     * @return Result containing a map from UID to file hash (empty if none
+     *         was recorded) for every UID that is indexed, or an error
+     */
+    [[nodiscard]] auto get_file_hashes(
+        const std::vector<std::string>& sop_instance_uids) const
+        -> Result<std::unordered_map<std::string, std::string>>;
+
 private:
     [[nodiscard]] auto parse_instance_row(void* stmt) const -> instance_record;
     [[nodiscard]] static auto parse_timestamp(const std::string& str)
@@ -301,6 +301,9 @@ private:
     [[nodiscard]] auto migrate_v7(sqlite3* db) -> VoidResult;
     [[nodiscard]] auto migrate_v8(sqlite3* db) -> VoidResult;
     [[nodiscard]] auto migrate_v9(sqlite3* db) -> VoidResult;
+    [[nodiscard]] auto migrate_v10(sqlite3* db) -> VoidResult;
+    [[nodiscard]] auto migrate_v11(sqlite3* db) -> VoidResult;
+    [[nodiscard]] auto migrate_v12(sqlite3* db) -> VoidResult;
 
 #ifdef PACS_WITH_DATABASE_SYSTEM
     // ========================================================================
@@ -358,13 +361,16 @@ private:
     [[nodiscard]] auto migrate_v7(pacs_database_adapter& db) -> VoidResult;
     [[nodiscard]] auto migrate_v8(pacs_database_adapter& db) -> VoidResult;
     [[nodiscard]] auto migrate_v9(pacs_database_adapter& db) -> VoidResult;
+    [[nodiscard]] auto migrate_v10(pacs_database_adapter& db) -> VoidResult;
+    [[nodiscard]] auto migrate_v11(pacs_database_adapter& db) -> VoidResult;
+    [[nodiscard]] auto migrate_v12(pacs_database_adapter& db) -> VoidResult;
 
     /// Migration function registry (pacs_database_adapter)
     std::vector<std::pair<int, adapter_migration_function>> adapter_migrations_;
 #endif
 
     /// Latest schema version (increment when adding migrations)
-    static constexpr int LATEST_VERSION = 9;
+    static constexpr int LATEST_VERSION = 12;
 
     /// Migration function registry
     std::vector<std::pair<int, migration_function>> migrations_;
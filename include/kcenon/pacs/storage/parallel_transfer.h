@@ -0,0 +1,136 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file parallel_transfer.h
+ * @brief Concurrent part-wise upload and download for object storage clients
+ *
+ * This file provides the part scheduler shared by the S3 multipart and
+ * Azure block-blob paths. Objects are split into fixed-size parts that are
+ * transferred by a bounded number of concurrent requests, each part retried
+ * independently with exponential backoff. Memory use is bounded by the
+ * in-flight window, so objects are streamed from a byte_source and to a
+ * sink instead of being held in memory as a whole.
+ *
+ * @see s3_storage, azure_blob_storage
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include "storage_interface.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace kcenon::pacs::storage {
+
+/**
+ * @brief Part size, concurrency and retry settings of a transfer
+ */
+struct transfer_options {
+    /// Bytes per part (the last part may be shorter)
+    std::size_t part_size{8 * 1024 * 1024};
+
+    /// Part requests running concurrently
+    std::size_t max_in_flight{4};
+
+    /// Retries of a failed part request before the transfer fails
+    std::uint32_t max_retries{3};
+
+    /// Delay before the first retry; doubled for every further retry
+    std::chrono::milliseconds retry_delay{200};
+};
+
+/**
+ * @brief Outcome of a completed transfer
+ */
+struct transfer_stats {
+    /// Number of parts transferred
+    std::size_t parts{0};
+
+    /// Part requests repeated after a failure
+    std::size_t retries{0};
+
+    /// Bytes transferred
+    std::uint64_t bytes{0};
+
+    /// Wall-clock duration of the transfer
+    std::chrono::milliseconds elapsed{0};
+};
+
+/**
+ * @brief Progress callback (bytes done, total bytes); false cancels
+ */
+using transfer_progress =
+    std::function<bool(std::size_t bytes_transferred, std::size_t total_bytes)>;
+
+/**
+ * @brief Uploads one part; part_index counts from 0
+ *
+ * Called concurrently from several threads.
+ */
+using part_upload_fn = std::function<VoidResult(
+    std::size_t part_index, std::span<const std::uint8_t> data)>;
+
+/**
+ * @brief Downloads the given byte range of the object
+ *
+ * Called concurrently from several threads.
+ */
+using part_download_fn = std::function<Result<std::vector<std::uint8_t>>(
+    std::uint64_t offset, std::uint64_t length)>;
+
+/**
+ * @brief Receives downloaded bytes in object order
+ */
+using part_sink_fn = std::function<VoidResult(std::span<const std::uint8_t> data)>;
+
+/**
+ * @brief Upload a source as concurrent parts
+ *
+ * Parts are read from the source in order and uploaded by up to
+ * max_in_flight requests. Sources exposing contiguous() are uploaded
+ * without copying; other sources are buffered one part per request.
+ *
+ * @param source Bytes to upload
+ * @param options Part size, window and retry settings
+ * @param upload Uploads one part
+ * @param progress Optional progress callback
+ * @return Transfer statistics (stats.parts parts, indexes 0..parts-1), or
+ *         the error of the first part that failed after all retries
+ */
+[[nodiscard]] auto parallel_upload(byte_source& source,
+                                   const transfer_options& options,
+                                   const part_upload_fn& upload,
+                                   const transfer_progress& progress = {})
+    -> Result<transfer_stats>;
+
+/**
+ * @brief Download an object as concurrent ranged requests
+ *
+ * Parts complete out of order but reach the sink in order; a part is only
+ * requested while it lies within max_in_flight parts of the next one the
+ * sink expects, which bounds the reorder buffer.
+ *
+ * @param size Object size in bytes
+ * @param options Part size, window and retry settings
+ * @param download Downloads one byte range
+ * @param sink Receives the bytes in order
+ * @param progress Optional progress callback
+ * @return Transfer statistics, or the first error
+ */
+[[nodiscard]] auto parallel_download(std::uint64_t size,
+                                     const transfer_options& options,
+                                     const part_download_fn& download,
+                                     const part_sink_fn& sink,
+                                     const transfer_progress& progress = {})
+    -> Result<transfer_stats>;
+
+}  // namespace kcenon::pacs::storage
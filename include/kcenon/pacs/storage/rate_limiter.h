@@ -0,0 +1,72 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file rate_limiter.h
+ * @brief Token bucket throttling background storage I/O
+ *
+ * @see fixity_scrubber, retention_engine
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace kcenon::pacs::storage {
+
+/**
+ * @brief Token bucket shared by all workers
+ *
+ * Requests draw the bucket into debt and sleep until it is repaid, so the
+ * long-run rate holds however many workers ask at once. The bucket holds
+ * at most one second of budget.
+ */
+class rate_limiter {
+public:
+    /**
+     * @param rate_per_second Budget refilled per second (0 or less = unlimited)
+     */
+    explicit rate_limiter(double rate_per_second)
+        : rate_(rate_per_second),
+          tokens_(rate_per_second),
+          last_refill_(std::chrono::steady_clock::now()) {}
+
+    /**
+     * @brief Take @p amount from the budget, sleeping if it is overdrawn
+     */
+    void acquire(double amount) {
+        if (rate_ <= 0.0) {
+            return;
+        }
+
+        std::chrono::duration<double> wait{0.0};
+        {
+            std::lock_guard lock(mutex_);
+            const auto now = std::chrono::steady_clock::now();
+            const std::chrono::duration<double> elapsed = now - last_refill_;
+            last_refill_ = now;
+            tokens_ = std::min(rate_, tokens_ + elapsed.count() * rate_);
+            tokens_ -= amount;
+            if (tokens_ < 0.0) {
+                wait = std::chrono::duration<double>(-tokens_ / rate_);
+            }
+        }
+        if (wait.count() > 0.0) {
+            std::this_thread::sleep_for(wait);
+        }
+    }
+
+private:
+    double rate_;
+    double tokens_;
+    std::chrono::steady_clock::time_point last_refill_;
+    std::mutex mutex_;
+};
+
+}  // namespace kcenon::pacs::storage
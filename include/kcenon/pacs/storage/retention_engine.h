@@ -0,0 +1,200 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file retention_engine.h
+ * @brief Batched, resumable deletion of studies past their retention period
+ *
+ * This file provides retention_engine, which finds expired studies with
+ * one indexed query per batch (see retention_policy.h), deletes each batch
+ * from the index in a single transaction that also queues the batch's
+ * files, and unlinks queued files on a pool of worker threads throttled
+ * to a file-per-second budget. Database work stays on the thread calling
+ * run() while workers unlink, so deleting the next batch overlaps the
+ * I/O of the previous ones.
+ *
+ * Progress lives in the database: a batch is either fully deleted and
+ * queued or untouched, and a queued file leaves the queue only once it is
+ * gone. A run that is cancelled, capped or killed therefore resumes on the
+ * next run, which first unlinks whatever the last one left queued.
+ *
+ * @see index_database::find_retention_candidates, fixity_scrubber
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include "retention_policy.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+
+namespace kcenon::pacs::storage {
+
+class file_storage;
+class index_database;
+
+/**
+ * @brief Configuration for retention_engine
+ */
+struct retention_engine_config {
+    /// Retention for modalities without a rule
+    std::chrono::days default_retention{365};
+
+    /// Retention per modality; a study is kept until all of its
+    /// modalities have expired
+    std::map<std::string, std::chrono::days> modality_retention;
+
+    /// Study description substrings that exempt a study
+    std::set<std::string> exclude_patterns;
+
+    /// Count expired studies without deleting anything
+    bool dry_run{false};
+
+    /// Delete index records only and leave files in place
+    bool database_only{false};
+
+    /// Studies deleted per transaction (at most 500)
+    std::size_t batch_size{200};
+
+    /// Studies deleted per run before it stops (0 = until none are left)
+    std::size_t max_deletions_per_run{0};
+
+    /// Worker threads unlinking files
+    std::size_t unlink_workers{4};
+
+    /// Files unlinked per second across all workers (0 = unlimited)
+    std::uint32_t max_unlinks_per_second{500};
+
+    /// Queued files handed to workers at once; the rest wait in the
+    /// database
+    std::size_t max_pending_unlinks{10000};
+};
+
+/**
+ * @brief Summary of one retention run
+ */
+struct retention_report {
+    /// Expired studies found (deleted, or that would be in a dry run)
+    std::size_t studies_matched{0};
+
+    /// Studies removed from the index
+    std::size_t studies_deleted{0};
+
+    /// Transactions committed
+    std::size_t batches{0};
+
+    /// Files queued by this run's deletions
+    std::size_t files_queued{0};
+
+    /// Files unlinked, including ones an earlier run left queued
+    std::size_t files_unlinked{0};
+
+    /// Files that could not be removed; they stay queued for the next run
+    std::size_t unlink_failures{0};
+
+    /// Wall-clock duration of the run
+    std::chrono::milliseconds elapsed{0};
+
+    /// No expired studies remain and the unlink queue was drained
+    bool completed{false};
+
+    /// Database error that ended the run early, empty otherwise
+    std::string error;
+};
+
+/**
+ * @brief Format the last expired StudyDate for a retention period
+ *
+ * @param now Reference time
+ * @param retention Retention period
+ * @return Local date of @p now minus @p retention as YYYYMMDD
+ */
+[[nodiscard]] auto retention_cutoff_date(std::chrono::system_clock::time_point now,
+                                         std::chrono::days retention)
+    -> std::string;
+
+/**
+ * @brief Deletes studies past their retention period in bounded batches
+ *
+ * @example
+ * @code
+ * retention_engine_config config;
+ * config.default_retention = std::chrono::days{3650};
+ * config.modality_retention["MG"] = std::chrono::days{7300};
+ *
+ * retention_engine engine(database, &storage, config);
+ * auto report = engine.run();
+ * @endcode
+ */
+class retention_engine {
+public:
+    /**
+     * @brief Construct an engine
+     * @param database Index database to delete from
+     * @param storage File storage whose files are unlinked (nullptr = unlink
+     *        queued paths directly)
+     * @param config Policy, batching and throttle settings
+     */
+    retention_engine(index_database& database, file_storage* storage,
+                     retention_engine_config config = {});
+
+    /// Non-copyable, non-movable (shared with running workers)
+    retention_engine(const retention_engine&) = delete;
+    auto operator=(const retention_engine&) -> retention_engine& = delete;
+    retention_engine(retention_engine&&) = delete;
+    auto operator=(retention_engine&&) -> retention_engine& = delete;
+
+    ~retention_engine() = default;
+
+    /**
+     * @brief Delete expired studies and unlink their files
+     *
+     * Blocks until no expired study remains and the unlink queue is empty,
+     * max_deletions_per_run studies are deleted, or cancel() is called.
+     * Only one run is active at a time; concurrent calls wait for each
+     * other.
+     *
+     * @param now Reference time for the retention periods
+     * @return Summary of the run
+     */
+    auto run(std::chrono::system_clock::time_point now =
+                 std::chrono::system_clock::now()) -> retention_report;
+
+    /**
+     * @brief Ask a running run() to stop after the current batch
+     *
+     * Files being unlinked finish; the rest stay queued for the next run.
+     */
+    void cancel() noexcept;
+
+    /**
+     * @brief Resolve the policy into StudyDate cutoffs
+     * @param now Reference time for the retention periods
+     */
+    [[nodiscard]] auto criteria(std::chrono::system_clock::time_point now) const
+        -> retention_criteria;
+
+    /**
+     * @brief Get the configuration
+     */
+    [[nodiscard]] auto config() const noexcept -> const retention_engine_config&;
+
+private:
+    index_database& database_;
+    file_storage* storage_;
+    retention_engine_config config_;
+
+    std::mutex run_mutex_;
+    std::atomic<bool> cancel_requested_{false};
+};
+
+}  // namespace kcenon::pacs::storage
@@ -0,0 +1,86 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file retention_policy.h
+ * @brief Retention criteria and the records retention deletes work on
+ *
+ * A retention policy resolved against a point in time becomes a set of
+ * StudyDate cutoffs, which index_database evaluates as one indexed query
+ * over studies.study_date and study_modalities. A study is expired when
+ * its StudyDate is on or before the cutoff of every modality it contains;
+ * modalities without a rule, and studies without modalities, use the
+ * default cutoff. Studies without a StudyDate never expire.
+ *
+ * @see retention_engine, index_database::find_retention_candidates
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace kcenon::pacs::storage {
+
+/**
+ * @brief StudyDate cutoffs a retention pass deletes up to
+ */
+struct retention_criteria {
+    /// Last expired StudyDate for modalities without a rule (YYYYMMDD)
+    std::string default_cutoff;
+
+    /// Last expired StudyDate per modality (YYYYMMDD)
+    std::map<std::string, std::string> modality_cutoffs;
+
+    /// Studies whose description contains one of these are kept
+    std::vector<std::string> exclude_patterns;
+
+    /// Latest cutoff of all rules; no study dated after it can expire
+    [[nodiscard]] auto upper_cutoff() const -> std::string {
+        auto upper = default_cutoff;
+        for (const auto& [modality, cutoff] : modality_cutoffs) {
+            if (cutoff > upper) {
+                upper = cutoff;
+            }
+        }
+        return upper;
+    }
+};
+
+/**
+ * @brief Expired study found by a retention query
+ */
+struct retention_candidate {
+    int64_t study_pk{0};
+    std::string study_uid;
+    std::string study_date;
+};
+
+/**
+ * @brief Outcome of deleting one batch of expired studies
+ */
+struct retention_batch {
+    /// Studies removed from the index
+    std::size_t studies_deleted{0};
+
+    /// Files of those studies added to the unlink queue
+    std::size_t files_queued{0};
+};
+
+/**
+ * @brief File of a deleted study waiting to be unlinked
+ */
+struct retention_unlink {
+    /// Queue primary key, used to dequeue the file once it is gone
+    int64_t pk{0};
+    std::string sop_uid;
+    std::string file_path;
+};
+
+}  // namespace kcenon::pacs::storage
@@ -16,12 +16,14 @@
 
 #pragma once
 
+#include "parallel_transfer.h"
 #include "storage_interface.h"
 
 #include <kcenon/pacs/core/dicom_dataset.h>
 
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -29,6 +31,7 @@
 #include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace kcenon::pacs::storage {
 
@@ -60,11 +63,22 @@ struct cloud_storage_config {
   std::size_t multipart_threshold = 100 * 1024 * 1024;
 
   /// Part size for multipart upload in bytes (default: 10MB)
+  /// Objects larger than multipart_threshold are also downloaded in parts
+  /// of this size
   std::size_t part_size = 10 * 1024 * 1024;
 
   /// Maximum number of concurrent upload connections
   std::size_t max_connections = 25;
 
+  /// Parts of one object transferred concurrently
+  std::size_t max_concurrent_parts = 8;
+
+  /// Retries of a failed part request
+  std::uint32_t max_retries = 3;
+
+  /// Delay before the first part retry in milliseconds (doubled per retry)
+  std::uint32_t retry_delay_ms = 200;
+
   /// Connection timeout in milliseconds
   std::uint32_t connect_timeout_ms = 3000;
 
@@ -226,6 +240,62 @@ public:
   [[nodiscard]] auto retrieve(std::string_view sop_instance_uid)
       -> Result<core::dicom_dataset> override;
 
+  /**
+   * @brief Store a DICOM file in its own transfer syntax
+   *
+   * @param file The DICOM file to store (e.g. with compressed Pixel Data)
+   * @return VoidResult Success or error information
+   */
+  [[nodiscard]] auto store_file(const core::dicom_file &file)
+      -> VoidResult override;
+
+  /**
+   * @brief Retrieve a stored object as a Part 10 file
+   *
+   * @param sop_instance_uid The unique identifier for the instance
+   * @return Result containing the file or error information
+   */
+  [[nodiscard]] auto retrieve_file(std::string_view sop_instance_uid)
+      -> Result<core::dicom_file> override;
+
+  /**
+   * @brief Upload Part 10 bytes as the object body unchanged
+   *
+   * Sources exposing contiguous() (e.g. mapped files) are uploaded without
+   * copying; other sources are buffered to identify the instance. Objects
+   * above multipart_threshold are uploaded as concurrent parts.
+   *
+   * @param source Part 10 bytes
+   * @return Identity of the stored instance or error information
+   */
+  [[nodiscard]] auto store_stream(byte_source &source)
+      -> Result<stored_instance> override;
+
+  /**
+   * @brief Overwrite the stored object with a new Part 10 file
+   *
+   * The object becomes visible only when the upload completes, so readers
+   * get the old or the new version.
+   *
+   * @param file The DICOM file to store
+   * @return Identity and content hash of the uploaded bytes, or error
+   */
+  [[nodiscard]] auto replace_file(const core::dicom_file &file)
+      -> Result<stored_instance> override;
+
+  /**
+   * @brief Download the stored object, or a range of it via ranged GET
+   *
+   * Ranges above multipart_threshold are fetched as concurrent ranged GETs.
+   *
+   * @param sop_instance_uid The unique identifier for the instance
+   * @param range Byte range to read (default: whole object)
+   * @return Reader over the downloaded bytes or error information
+   */
+  [[nodiscard]] auto open_read(std::string_view sop_instance_uid,
+                               byte_range range = {})
+      -> Result<std::unique_ptr<byte_source>> override;
+
   /**
    * @brief Remove a DICOM object from S3
    *
@@ -246,6 +316,19 @@ public:
   [[nodiscard]] auto exists(std::string_view sop_instance_uid) const
       -> bool override;
 
+  /**
+   * @brief Check which of several DICOM instances exist
+   *
+   * Answers the whole batch from the local index under one lock, without
+   * a request per object.
+   *
+   * @param sop_instance_uids The collection of UIDs to check
+   * @return One flag per UID, in the order given
+   */
+  [[nodiscard]] auto exists_batch(
+      const std::vector<std::string> &sop_instance_uids) const
+      -> std::vector<bool> override;
+
   /**
    * @brief Find DICOM datasets matching query criteria
    *
@@ -302,6 +385,22 @@ public:
                                             progress_callback callback)
       -> Result<core::dicom_dataset>;
 
+  /**
+   * @brief Download an object to a local file without buffering it
+   *
+   * Parts are fetched concurrently and written in order; the file is
+   * removed if the download fails or is cancelled.
+   *
+   * @param sop_instance_uid The SOP Instance UID
+   * @param path Destination file (overwritten)
+   * @param callback Progress callback (may be empty)
+   * @return VoidResult Success or error information
+   */
+  [[nodiscard]] auto download_to_file(std::string_view sop_instance_uid,
+                                      const std::filesystem::path &path,
+                                      progress_callback callback = nullptr)
+      -> VoidResult;
+
   /**
    * @brief Get the S3 object key for a SOP Instance UID
    *
@@ -341,6 +440,64 @@ private:
   // Internal Helper Methods
   // =========================================================================
 
+  /**
+   * @brief Serialize and upload a Part 10 file, then index it
+   * @param file File to upload
+   * @param callback Progress callback (may be empty)
+   */
+  [[nodiscard]] auto upload_file(const core::dicom_file &file,
+                                 progress_callback callback) -> VoidResult;
+
+  /**
+   * @brief Upload Part 10 bytes under the instance key, then index them
+   * @param study_uid Study Instance UID
+   * @param series_uid Series Instance UID
+   * @param sop_uid SOP Instance UID
+   * @param source Part 10 bytes
+   * @param callback Progress callback (may be empty)
+   */
+  [[nodiscard]] auto upload_object(const std::string &study_uid,
+                                   const std::string &series_uid,
+                                   const std::string &sop_uid,
+                                   byte_source &source,
+                                   progress_callback callback) -> VoidResult;
+
+  /**
+   * @brief Look up the object key and size of an instance
+   */
+  [[nodiscard]] auto find_object(std::string_view sop_instance_uid) const
+      -> std::optional<std::pair<std::string, std::uint64_t>>;
+
+  /**
+   * @brief Download a byte range of an object to a sink
+   *
+   * Ranges above multipart_threshold are fetched as concurrent parts.
+   *
+   * @param key S3 object key
+   * @param object_size Size of the whole object
+   * @param range Byte range resolved against object_size
+   * @param sink Receives the bytes in order
+   * @param callback Progress callback (may be empty)
+   */
+  [[nodiscard]] auto download_range(const std::string &key,
+                                    std::uint64_t object_size, byte_range range,
+                                    const part_sink_fn &sink,
+                                    progress_callback callback) -> VoidResult;
+
+  /**
+   * @brief Part transfer settings derived from the configuration
+   */
+  [[nodiscard]] auto transfer_settings() const -> transfer_options;
+
+  /**
+   * @brief Download and parse the Part 10 file of an instance
+   * @param sop_instance_uid The SOP Instance UID
+   * @param callback Progress callback (may be empty)
+   */
+  [[nodiscard]] auto download_file(std::string_view sop_instance_uid,
+                                   progress_callback callback)
+      -> Result<core::dicom_file>;
+
   /**
    * @brief Build S3 object key for a dataset
    * @param study_uid Study Instance UID
@@ -362,13 +519,17 @@ private:
 
   /**
    * @brief Execute multipart upload for large files
+   *
+   * Parts are uploaded concurrently; the upload is aborted if any part
+   * fails after its retries.
+   *
    * @param key S3 object key
-   * @param data Data to upload
+   * @param source Data to upload
    * @param callback Optional progress callback
    * @return VoidResult Success or error information
    */
   [[nodiscard]] auto upload_multipart(const std::string &key,
-                                      const std::vector<std::uint8_t> &data,
+                                      byte_source &source,
                                       progress_callback callback) -> VoidResult;
 
   /**
@@ -18,12 +18,16 @@
 #pragma once
 
 #include <kcenon/pacs/core/dicom_dataset.h>
+#include <kcenon/pacs/core/dicom_file.h>
+#include <kcenon/pacs/core/memory_mapped_file.h>
 
 #include <kcenon/common/patterns/result.h>
 
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -59,6 +63,157 @@ struct storage_statistics {
     std::size_t patients_count{0};
 };
 
+/**
+ * @brief A byte range within a stored Part 10 object
+ *
+ * The default range covers the whole object.
+ */
+struct byte_range {
+    /// Length value meaning "up to the end of the object"
+    static constexpr std::uint64_t to_end = ~std::uint64_t{0};
+
+    /// First byte of the range
+    std::uint64_t offset{0};
+
+    /// Number of bytes (to_end = through the last byte)
+    std::uint64_t length{to_end};
+
+    /**
+     * @brief Clamp the range to an object of the given size
+     *
+     * @param object_size Size of the whole object in bytes
+     * @return Concrete range, or nullopt if offset is past the end
+     */
+    [[nodiscard]] auto resolve(std::uint64_t object_size) const noexcept
+        -> std::optional<byte_range> {
+        if (offset > object_size) {
+            return std::nullopt;
+        }
+        const auto available = object_size - offset;
+        return byte_range{offset, length < available ? length : available};
+    }
+
+    /// Whether the range starts at 0 and runs to the end
+    [[nodiscard]] auto is_whole() const noexcept -> bool {
+        return offset == 0 && length == to_end;
+    }
+};
+
+/**
+ * @brief Identity of an instance written by storage_interface::store_stream
+ *
+ * Taken from the Part 10 header of the stored bytes.
+ */
+struct stored_instance {
+    std::string sop_instance_uid;
+    std::string study_instance_uid;
+    std::string series_instance_uid;
+    std::string study_date;
+    std::string transfer_syntax_uid;
+
+    /// Size of the stored object in bytes
+    std::uint64_t size_bytes{0};
+
+    /// Digest of the stored bytes ("xxh64:<hex>"), empty if the backend
+    /// does not compute one
+    std::string content_hash;
+};
+
+/**
+ * @brief Sequential reader over stored bytes
+ *
+ * Returned by storage_interface::open_read() and accepted by
+ * storage_interface::store_stream(). Backends that hold the bytes in
+ * memory or map them from disk also expose them through contiguous(), so
+ * pass-through callers can send them without copying.
+ */
+class byte_source {
+public:
+    virtual ~byte_source() = default;
+
+    /**
+     * @brief Number of bytes this source yields in total
+     */
+    [[nodiscard]] virtual auto size() const noexcept -> std::uint64_t = 0;
+
+    /**
+     * @brief Read the next bytes into buffer
+     *
+     * @param buffer Destination buffer
+     * @return Number of bytes read (0 once the source is exhausted)
+     */
+    [[nodiscard]] virtual auto read(std::span<std::uint8_t> buffer)
+        -> Result<std::size_t> = 0;
+
+    /**
+     * @brief All bytes of the source as one memory region, if available
+     *
+     * @return The region (independent of read position), or an empty span
+     *         when the source is only readable sequentially
+     */
+    [[nodiscard]] virtual auto contiguous() const noexcept
+        -> std::span<const std::uint8_t> {
+        return {};
+    }
+
+    /**
+     * @brief Read the remaining bytes into a vector
+     */
+    [[nodiscard]] auto read_all() -> Result<std::vector<std::uint8_t>>;
+};
+
+/**
+ * @brief byte_source over an owned buffer
+ */
+class memory_byte_source final : public byte_source {
+public:
+    /**
+     * @brief Expose a range of data
+     *
+     * @param data Buffer holding the bytes
+     * @param range Range within data; must be resolved (see byte_range::resolve)
+     */
+    explicit memory_byte_source(std::vector<std::uint8_t> data,
+                                byte_range range = {});
+
+    [[nodiscard]] auto size() const noexcept -> std::uint64_t override;
+    [[nodiscard]] auto read(std::span<std::uint8_t> buffer)
+        -> Result<std::size_t> override;
+    [[nodiscard]] auto contiguous() const noexcept
+        -> std::span<const std::uint8_t> override;
+
+private:
+    std::vector<std::uint8_t> data_;
+    std::size_t begin_{0};
+    std::size_t end_{0};
+    std::size_t position_{0};
+};
+
+/**
+ * @brief byte_source over a memory-mapped file
+ */
+class mapped_byte_source final : public byte_source {
+public:
+    /**
+     * @brief Expose a range of a mapped file
+     *
+     * @param file The mapped file
+     * @param range Range within the file; must be resolved
+     */
+    mapped_byte_source(core::memory_mapped_file file, byte_range range);
+
+    [[nodiscard]] auto size() const noexcept -> std::uint64_t override;
+    [[nodiscard]] auto read(std::span<std::uint8_t> buffer)
+        -> Result<std::size_t> override;
+    [[nodiscard]] auto contiguous() const noexcept
+        -> std::span<const std::uint8_t> override;
+
+private:
+    core::memory_mapped_file file_;
+    std::span<const std::uint8_t> region_;
+    std::size_t position_{0};
+};
+
 /**
  * @brief Abstract storage interface for DICOM persistence
  *
@@ -193,6 +348,119 @@ public:
         const std::vector<std::string>& sop_instance_uids)
         -> Result<std::vector<core::dicom_dataset>>;
 
+    /**
+     * @brief Check which of several DICOM instances exist
+     *
+     * Default implementation calls exists() for each UID. Backends with an
+     * in-memory index override it to answer the whole batch under one lock.
+     *
+     * @param sop_instance_uids The collection of UIDs to check
+     * @return One flag per UID, in the order given
+     */
+    [[nodiscard]] virtual auto exists_batch(
+        const std::vector<std::string>& sop_instance_uids) const
+        -> std::vector<bool>;
+
+    // =========================================================================
+    // Part 10 File Operations
+    // =========================================================================
+
+    /**
+     * @brief Store a DICOM file, keeping its transfer syntax
+     *
+     * Unlike store(), which always encodes the dataset in Explicit VR Little
+     * Endian, this keeps the file's transfer syntax so compressed
+     * (encapsulated) Pixel Data is stored as-is.
+     *
+     * Default implementation calls store() for native transfer syntaxes and
+     * fails for encapsulated ones. Backends that persist Part 10 files
+     * should override it.
+     *
+     * @param file The DICOM file to store
+     * @return VoidResult Success or error information
+     */
+    [[nodiscard]] virtual auto store_file(const core::dicom_file& file)
+        -> VoidResult;
+
+    /**
+     * @brief Retrieve a stored instance with its transfer syntax
+     *
+     * Default implementation wraps retrieve() in Explicit VR Little Endian.
+     *
+     * @param sop_instance_uid The unique identifier for the instance
+     * @return Result containing the file or error information
+     */
+    [[nodiscard]] virtual auto retrieve_file(std::string_view sop_instance_uid)
+        -> Result<core::dicom_file>;
+
+    /**
+     * @brief Replace a stored instance in one step
+     *
+     * Writes @p file in full before it takes the place of the stored
+     * instance with the same SOP Instance UID, regardless of the backend's
+     * duplicate handling. Concurrent readers see the old or the new
+     * version, never a missing instance; if the write fails the old version
+     * is kept.
+     *
+     * Default implementation fails: a backend that cannot swap objects
+     * atomically must not be used to rewrite instances in place.
+     *
+     * @param file The DICOM file to store
+     * @return Identity of the stored instance (size_bytes and, where the
+     *         backend computes it, content_hash of the new bytes) or error
+     */
+    [[nodiscard]] virtual auto replace_file(const core::dicom_file& file)
+        -> Result<stored_instance>;
+
+    // =========================================================================
+    // Raw Byte Operations
+    // =========================================================================
+
+    /**
+     * @brief Store Part 10 bytes as they are
+     *
+     * The source must yield a complete Part 10 file (preamble, "DICM",
+     * File Meta Information, dataset). Backends that persist Part 10 files
+     * write the bytes unchanged and read only the header to find the
+     * instance UIDs; nothing is re-encoded.
+     *
+     * Default implementation decodes the bytes and calls store_file().
+     *
+     * @param source Part 10 bytes
+     * @return Identity of the stored instance or error information
+     */
+    [[nodiscard]] virtual auto store_stream(byte_source& source)
+        -> Result<stored_instance>;
+
+    /**
+     * @brief Open the stored bytes of an instance for reading
+     *
+     * Returns the Part 10 object exactly as stored, or a range of it, so
+     * callers that forward bytes (WADO, C-MOVE, tier migration) do not
+     * decode the dataset.
+     *
+     * Default implementation encodes retrieve_file() into a buffer.
+     *
+     * @param sop_instance_uid The unique identifier for the instance
+     * @param range Byte range to read (default: whole object)
+     * @return Reader over the requested bytes or error information
+     */
+    [[nodiscard]] virtual auto open_read(std::string_view sop_instance_uid,
+                                         byte_range range = {})
+        -> Result<std::unique_ptr<byte_source>>;
+
+    /**
+     * @brief Read the identity of a Part 10 object from its header
+     *
+     * Decodes only the attributes in front of Pixel Data.
+     *
+     * @param data Complete Part 10 bytes
+     * @return Identity (size_bytes = data size) or error if the bytes are
+     *         not a Part 10 file or lack Study, Series or SOP Instance UID
+     */
+    [[nodiscard]] static auto identify_part10(std::span<const std::uint8_t> data)
+        -> Result<stored_instance>;
+
     // =========================================================================
     // Maintenance Operations
     // =========================================================================
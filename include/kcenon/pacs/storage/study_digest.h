@@ -0,0 +1,148 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file study_digest.h
+ * @brief Hierarchical digests of the study index for bulk reconciliation
+ *
+ * Studies are grouped into buckets by StudyDate and ModalitiesInStudy. A
+ * bucket's digest is the wrapping sum of one XXH64 hash per study (over the
+ * Study Instance UID and instance count), and every coarser node is the sum
+ * of its children, so digests combine in any order and two archives holding
+ * the same studies produce the same tree. The tree has four levels:
+ *
+ * | Key               | Node                                  |
+ * |-------------------|---------------------------------------|
+ * | ""                | root (every bucket in the scope)      |
+ * | "YYYYMM"          | month                                 |
+ * | "YYYYMMDD"        | day                                   |
+ * | "YYYYMMDD/CT\PT"  | bucket: one day, one modality set     |
+ *
+ * Two sites compare their roots and descend only into nodes whose digests
+ * differ, so reconciling mostly identical archives takes a number of
+ * queries proportional to the differences rather than to the archive size.
+ * Studies without a StudyDate are not part of the tree.
+ *
+ * @see index_database::study_digest_children
+ * @author kcenon
+ * @since 1.0.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace kcenon::pacs::storage {
+
+/**
+ * @brief Range of the study index a digest tree covers
+ */
+struct study_digest_scope {
+    /// First StudyDate included (YYYYMMDD, empty = unbounded)
+    std::string from_date;
+
+    /// Last StudyDate included (YYYYMMDD, empty = unbounded)
+    std::string to_date;
+
+    /// Buckets with at least one of these modalities (empty = all)
+    std::vector<std::string> modalities;
+};
+
+/**
+ * @brief One node of the digest tree
+ */
+struct study_digest_node {
+    /// Node key (see the table in study_digest.h)
+    std::string key;
+
+    /// Studies under the node
+    std::size_t study_count{0};
+
+    /// Instances of those studies
+    std::size_t instance_count{0};
+
+    /// Sum of the study hashes under the node
+    std::uint64_t digest{0};
+
+    /// Add another node's studies to this one
+    void combine(const study_digest_node& other) noexcept {
+        study_count += other.study_count;
+        instance_count += other.instance_count;
+        digest += other.digest;
+    }
+
+    /// True if both nodes cover the same studies with the same counts
+    [[nodiscard]] auto matches(const study_digest_node& other) const noexcept
+        -> bool {
+        return study_count == other.study_count &&
+               instance_count == other.instance_count && digest == other.digest;
+    }
+};
+
+/**
+ * @brief One study of a bucket, as listed when a bucket differs
+ */
+struct study_digest_entry {
+    std::string study_uid;
+    std::size_t instance_count{0};
+};
+
+/**
+ * @brief Hash of one study, the leaf value summed into bucket digests
+ */
+[[nodiscard]] auto study_digest_leaf(std::string_view study_uid,
+                                     std::size_t instance_count) noexcept
+    -> std::uint64_t;
+
+/**
+ * @brief Canonical modality set of a bucket: sorted, unique, '\' separated
+ * @param modalities_in_study Modalities in any order, '\' separated
+ */
+[[nodiscard]] auto normalize_study_modalities(std::string_view modalities_in_study)
+    -> std::string;
+
+/**
+ * @brief Key of the bucket holding a study
+ */
+[[nodiscard]] auto study_digest_bucket_key(std::string_view study_date,
+                                           std::string_view modalities)
+    -> std::string;
+
+/**
+ * @brief True if @p key names a bucket (a leaf of the tree)
+ */
+[[nodiscard]] auto is_study_digest_bucket(std::string_view key) noexcept -> bool;
+
+/**
+ * @brief True if @p key names the root, a month, a day or a bucket
+ */
+[[nodiscard]] auto is_valid_study_digest_key(std::string_view key) noexcept
+    -> bool;
+
+/**
+ * @brief Combine nodes into their parent
+ * @param key Key of the parent node
+ * @param children Nodes under the parent
+ */
+[[nodiscard]] auto combine_study_digests(
+    std::string key, const std::vector<study_digest_node>& children)
+    -> study_digest_node;
+
+/**
+ * @brief Keys of nodes that differ between two sibling lists
+ *
+ * A key present on only one side differs. Both lists must be sorted by key,
+ * which is how index_database returns them.
+ *
+ * @return Differing keys in ascending order
+ */
+[[nodiscard]] auto diff_study_digests(const std::vector<study_digest_node>& local,
+                                      const std::vector<study_digest_node>& remote)
+    -> std::vector<std::string>;
+
+}  // namespace kcenon::pacs::storage
@@ -82,6 +82,30 @@ struct study_record {
     }
 };
 
+/**
+ * @brief Position in the study search order for keyset pagination
+ *
+ * Studies are returned newest first, ordered by study date, study time
+ * and primary key (all descending). A page key taken from the last record
+ * of one page continues the search right after it, without the cost of
+ * skipping rows that OFFSET has on deep pages.
+ */
+struct study_page_key {
+    /// Study date of the last returned study
+    std::string study_date;
+
+    /// Study time of the last returned study
+    std::string study_time;
+
+    /// Primary key of the last returned study
+    int64_t study_pk{0};
+
+    /// Page key continuing after the given record
+    [[nodiscard]] static auto after(const study_record& record) -> study_page_key {
+        return {record.study_date, record.study_time, record.pk};
+    }
+};
+
 /**
  * @brief Query parameters for study search
  *
@@ -138,6 +162,10 @@ struct study_query {
     /// Offset for pagination
     size_t offset{0};
 
+    /// Keyset pagination: return only studies ordered after this key
+    /// (offset is ignored when set)
+    std::optional<study_page_key> after;
+
     /**
      * @brief Check if any filter criteria is set
      *
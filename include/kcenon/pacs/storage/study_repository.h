@@ -93,7 +93,11 @@ public:
      * @brief Search studies with query criteria
      *
      * Supports wildcard matching, patient-level filters, date ranges,
-     * and modality filtering.
+     * and modality filtering. Modality filters use the study_modalities
+     * table; patient name and study description patterns with at least
+     * three consecutive literal characters use the trigram full-text
+     * indexes when available. Results are ordered newest first and can
+     * be paged with query.after (keyset) or query.offset.
      */
     [[nodiscard]] auto search_studies(const study_query& query)
         -> Result<std::vector<study_record>>;
@@ -147,11 +151,20 @@ private:
     [[nodiscard]] static auto to_like_pattern(std::string_view pattern)
         -> std::string;
 
+    /// Whether a wildcard pattern is selective enough for the trigram index
+    [[nodiscard]] static auto has_trigram_run(std::string_view pattern)
+        -> bool;
+
+    /// Whether the trigram full-text indexes exist (checked once)
+    [[nodiscard]] auto has_trigram_index() -> bool;
+
     [[nodiscard]] auto parse_timestamp(const std::string& str) const
         -> std::chrono::system_clock::time_point;
 
     [[nodiscard]] auto format_timestamp(
         std::chrono::system_clock::time_point tp) const -> std::string;
+
+    std::optional<bool> trigram_index_;
 };
 
 }  // namespace kcenon::pacs::storage
@@ -208,8 +221,12 @@ private:
     [[nodiscard]] auto parse_study_row(void* stmt) const -> study_record;
     [[nodiscard]] static auto to_like_pattern(std::string_view pattern)
         -> std::string;
+    [[nodiscard]] static auto has_trigram_run(std::string_view pattern)
+        -> bool;
+    [[nodiscard]] auto has_trigram_index() const -> bool;
 
     sqlite3* db_{nullptr};
+    mutable std::optional<bool> trigram_index_;
 };
 
 }  // namespace kcenon::pacs::storage
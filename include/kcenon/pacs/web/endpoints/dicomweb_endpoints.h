@@ -89,6 +89,15 @@ struct accept_info {
 [[nodiscard]] auto is_acceptable(const std::vector<accept_info>& accept_infos,
                                   std::string_view media_type) -> bool;
 
+/**
+ * @brief Get the transfer syntax requested for application/dicom
+ * @param accept_infos Parsed accept header
+ * @return Requested Transfer Syntax UID, or empty string when any syntax
+ *         is acceptable ("*" or no transfer-syntax parameter)
+ */
+[[nodiscard]] auto requested_transfer_syntax(
+    const std::vector<accept_info>& accept_infos) -> std::string;
+
 /**
  * @brief Builder for multipart MIME responses
  *
@@ -7,7 +7,7 @@
  * @brief System API endpoints for REST server
  *
  * This file provides the system endpoints for health status, metrics,
- * and configuration management.
+ * request trace export, and configuration management.
  *
  * @copyright Copyright (c) 2025
  * @license MIT
@@ -28,6 +28,10 @@ namespace kcenon::pacs::services::monitoring {
 class database_metrics_service;
 } // namespace kcenon::pacs::services::monitoring
 
+namespace kcenon::pacs::services {
+class transcoding_service;
+} // namespace kcenon::pacs::services
+
 namespace kcenon::pacs::security {
 class access_control_manager;
 } // namespace kcenon::pacs::security
@@ -95,6 +99,9 @@ struct rest_server_context {
 
   /// OAuth 2.0 middleware for DICOMweb endpoint authorization
   std::shared_ptr<auth::oauth2_middleware> oauth2;
+
+  /// Transcoder for WADO-RS transfer-syntax negotiation (optional)
+  std::shared_ptr<services::transcoding_service> transcoder;
 };
 
 namespace endpoints {
@@ -48,6 +48,10 @@ namespace kcenon::pacs::network {
 class dicom_server;
 } // namespace kcenon::pacs::network
 
+namespace kcenon::pacs::services {
+class transcoding_service;
+} // namespace kcenon::pacs::services
+
 namespace kcenon::pacs::client {
 class remote_node_manager;
 class job_manager;
@@ -194,6 +198,12 @@ public:
   void set_oauth2_middleware(
       std::shared_ptr<auth::oauth2_middleware> middleware);
 
+  /**
+   * @brief Set transcoder for WADO-RS transfer-syntax negotiation
+   * @param transcoder Transcoding service instance (nullptr disables)
+   */
+  void set_transcoder(std::shared_ptr<services::transcoding_service> transcoder);
+
   // =========================================================================
   // Lifecycle
   // =========================================================================
@@ -24,7 +24,9 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -84,11 +86,27 @@ struct prefetch_request {
     /// Study Instance UID of scheduled study (to avoid prefetching)
     std::string scheduled_study_uid;
 
+    /// Scheduled Procedure Step start (epoch if unknown)
+    std::chrono::system_clock::time_point scheduled_time;
+
     /// Request timestamp
     std::chrono::system_clock::time_point request_time;
 
     /// Number of retry attempts
     std::size_t retry_count{0};
+
+    /**
+     * @brief Time by which the priors should be local
+     *
+     * The scheduled start when known; otherwise the request time, so
+     * unscheduled requests are served as soon as possible.
+     */
+    [[nodiscard]] auto deadline() const noexcept
+        -> std::chrono::system_clock::time_point {
+        return scheduled_time != std::chrono::system_clock::time_point{}
+                   ? scheduled_time
+                   : request_time;
+    }
 };
 
 /**
@@ -105,9 +123,17 @@ struct prefetch_request {
  * - **Configurable Selection**: Filter priors by modality, body part,
  *   lookback period, and other criteria
  * - **Multi-Source Support**: Can prefetch from multiple remote PACS
- * - **Parallel Processing**: Uses thread_system for concurrent prefetches
+ * - **Deadline Ordering**: Patients are served in order of Scheduled
+ *   Procedure Step start time, so the earliest exams get their priors first
+ * - **Parallel Processing**: Up to max_concurrent_prefetches patients are
+ *   prefetched at once, with at most max_concurrent_associations
+ *   associations open to any one remote PACS
+ * - **Deduplication**: Repeated worklist queries merge into the pending
+ *   request for a patient and do not re-queue recently prefetched patients
  * - **Rate Limiting**: Prevents overloading remote PACS with requests
  * - **Retry Logic**: Automatically retries failed prefetches
+ * - **Queue Metrics**: Queue depth, queue lag and missed deadlines are
+ *   reported through monitoring_adapter and prefetch_result
  *
  * ## Integration with kcenon Ecosystem
  *
@@ -413,6 +439,23 @@ public:
      */
     [[nodiscard]] auto pending_requests() const noexcept -> std::size_t;
 
+    /**
+     * @brief Get pending requests in the order they will be served
+     *
+     * @return Pending requests, earliest deadline first
+     */
+    [[nodiscard]] auto pending_request_list() const
+        -> std::vector<prefetch_request>;
+
+    /**
+     * @brief Get how long the oldest pending request has been waiting
+     *
+     * Requests waiting for a retry delay are not counted.
+     *
+     * @return Current queue lag, zero if no request is waiting
+     */
+    [[nodiscard]] auto queue_lag() const -> std::chrono::milliseconds;
+
     // =========================================================================
     // Configuration
     // =========================================================================
@@ -485,9 +528,11 @@ private:
      * @brief Process a single prefetch request
      *
      * @param request The prefetch request to process
+     * @param lookback Lookback period for prior studies
      * @return Prefetch result for this request
      */
-    [[nodiscard]] auto process_request(const prefetch_request& request)
+    [[nodiscard]] auto process_request(const prefetch_request& request,
+                                       std::chrono::days lookback)
         -> prefetch_result;
 
     /**
@@ -541,20 +586,81 @@ private:
      */
     void update_stats(const prefetch_result& result);
 
+    /// Pending request with its queue bookkeeping
+    struct queued_request {
+        prefetch_request request;
+
+        /// When the request became eligible to run (for queue lag)
+        std::chrono::steady_clock::time_point ready_since;
+    };
+
+    /// Pending requests ordered by deadline
+    using request_queue = std::multimap<std::chrono::system_clock::time_point,
+                                        queued_request>;
+
     /**
      * @brief Add request to queue (deduplicated)
      *
+     * A request for a patient already pending is merged into it, keeping
+     * the earlier deadline. Requests for patients being prefetched, or
+     * prefetched within request_dedup_window, are dropped.
+     *
      * @param request The prefetch request to queue
      */
     void queue_request(const prefetch_request& request);
 
     /**
-     * @brief Get next request from queue
+     * @brief Take the ready request with the earliest deadline
+     *
+     * The patient is marked in flight until finish_request() is called.
      *
-     * @return Optional containing next request, or nullopt if empty
+     * @return Optional containing next request, or nullopt if none is ready
      */
     [[nodiscard]] auto dequeue_request()
-        -> std::optional<prefetch_request>;
+        -> std::optional<queued_request>;
+
+    /**
+     * @brief Complete a dequeued request, re-queueing it if it should retry
+     *
+     * @param request The request returned by dequeue_request()
+     * @param result Outcome of processing it
+     */
+    void finish_request(const prefetch_request& request,
+                        const prefetch_result& result);
+
+    /**
+     * @brief Check whether a queued request is ready to run
+     */
+    [[nodiscard]] auto has_ready_request() const -> bool;
+
+    /**
+     * @brief Earliest time a waiting retry becomes ready, if any
+     */
+    [[nodiscard]] auto next_retry_time() const
+        -> std::optional<std::chrono::steady_clock::time_point>;
+
+    /**
+     * @brief Wait for an association slot on a remote PACS
+     *
+     * @param pacs_config Remote PACS configuration
+     * @return false if the service is stopping
+     */
+    [[nodiscard]] auto acquire_node_slot(const remote_pacs_config& pacs_config)
+        -> bool;
+
+    /**
+     * @brief Release a slot taken by acquire_node_slot()
+     *
+     * @param pacs_config Remote PACS configuration
+     */
+    void release_node_slot(const remote_pacs_config& pacs_config);
+
+    /**
+     * @brief Wait until rate_limit_per_minute allows another retrieve
+     *
+     * @return false if the service is stopping
+     */
+    [[nodiscard]] auto wait_for_rate_limit() -> bool;
 
     // =========================================================================
     // Member Variables
@@ -590,15 +696,38 @@ private:
     /// Flag indicating a cycle is in progress
     std::atomic<bool> cycle_in_progress_{false};
 
-    /// Queue of pending prefetch requests
-    std::queue<prefetch_request> request_queue_;
+    /// Pending prefetch requests, earliest deadline first
+    request_queue request_queue_;
+
+    /// Patient ID -> queue entry (for deduplication)
+    std::map<std::string, request_queue::iterator> queued_patients_;
 
-    /// Set of patient IDs currently in queue (for deduplication)
-    std::set<std::string> queued_patients_;
+    /// Patients whose request a worker is processing
+    std::set<std::string> in_flight_patients_;
+
+    /// Patient ID -> when their last prefetch finished
+    std::map<std::string, std::chrono::steady_clock::time_point>
+        recently_prefetched_;
+
+    /// Retries waiting for retry_delay: (ready time, request)
+    std::vector<std::pair<std::chrono::steady_clock::time_point,
+                          prefetch_request>> retry_requests_;
 
     /// Mutex for request queue
     mutable std::mutex queue_mutex_;
 
+    /// Open associations per remote PACS (ae_title@host:port)
+    std::map<std::string, std::size_t> node_associations_;
+
+    /// Start times of retrieves within the last minute (rate limiting)
+    std::deque<std::chrono::steady_clock::time_point> recent_retrieves_;
+
+    /// Mutex for node slots and the rate limiter
+    std::mutex dispatch_mutex_;
+
+    /// Signalled when a node slot is released or the service stops
+    std::condition_variable dispatch_cv_;
+
     /// Last prefetch result
     std::optional<prefetch_result> last_result_;
 
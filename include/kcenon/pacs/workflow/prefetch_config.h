@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <functional>
@@ -55,6 +56,10 @@ struct remote_pacs_config {
     /// Enable TLS for secure connections
     bool use_tls{false};
 
+    /// Associations prefetch workers may hold open to this PACS at once
+    /// (0 = limited only by max_concurrent_prefetches)
+    std::size_t max_concurrent_associations{2};
+
     /**
      * @brief Check if configuration is valid
      * @return true if required fields are set
@@ -126,6 +131,12 @@ struct prefetch_result {
     /// Duration of the prefetch operation
     std::chrono::milliseconds duration{0};
 
+    /// Requests finished after their scheduled procedure start time
+    std::size_t deadlines_missed{0};
+
+    /// Longest time a request waited in the queue before a worker took it
+    std::chrono::milliseconds max_queue_lag{0};
+
     /// Time when this result was recorded
     std::chrono::system_clock::time_point timestamp;
 
@@ -151,6 +162,8 @@ struct prefetch_result {
         studies_already_present += other.studies_already_present;
         bytes_downloaded += other.bytes_downloaded;
         duration += other.duration;
+        deadlines_missed += other.deadlines_missed;
+        max_queue_lag = std::max(max_queue_lag, other.max_queue_lag);
         return *this;
     }
 };
@@ -206,7 +219,8 @@ struct prefetch_service_config {
     /// Interval between prefetch cycles (default: 5 minutes)
     std::chrono::seconds prefetch_interval{300};
 
-    /// Maximum concurrent prefetch operations
+    /// Maximum concurrent prefetch operations (worker threads per cycle,
+    /// each serving one patient at a time, earliest scheduled start first)
     std::size_t max_concurrent_prefetches{4};
 
     /// Whether to start automatically on construction
@@ -230,12 +244,33 @@ struct prefetch_service_config {
     /// Delay between retries
     std::chrono::seconds retry_delay{60};
 
+    /// A patient whose priors were prefetched within this window is not
+    /// queued again by repeated worklist queries (0 = only merge requests
+    /// that are still pending or running)
+    std::chrono::minutes request_dedup_window{30};
+
+    /// Replaces the C-FIND for prior studies (default: query_scu over a new
+    /// association); used by tests and custom transports
+    using query_function = std::function<std::vector<prior_study_info>(
+        const remote_pacs_config& pacs,
+        const std::string& patient_id,
+        std::chrono::days lookback)>;
+    query_function query_override;
+
+    /// Replaces the C-MOVE of one study (default: retrieve_scu over a new
+    /// association); returns true on success
+    using retrieve_function = std::function<bool(
+        const remote_pacs_config& pacs,
+        const prior_study_info& study)>;
+    retrieve_function retrieve_override;
+
     /// Callback for prefetch cycle completion
     using cycle_complete_callback =
         std::function<void(const prefetch_result& result)>;
     cycle_complete_callback on_cycle_complete;
 
-    /// Callback for individual prefetch completion
+    /// Callback for individual prefetch completion; with several workers
+    /// it may be called from more than one thread at a time
     using prefetch_complete_callback =
         std::function<void(const std::string& patient_id,
                           const prior_study_info& study,
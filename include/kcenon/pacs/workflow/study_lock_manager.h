@@ -8,7 +8,9 @@
  *
  * This file provides the study_lock_manager class which manages locks on DICOM
  * studies to prevent concurrent modifications and ensure data integrity during
- * operations like migrations and updates.
+ * operations like migrations and updates. The lock table is hash-sharded,
+ * blocked requests wait in per-study FIFO queues, and expiring locks are
+ * tracked on a timer wheel.
  *
  * @see SRS-WKF-003 - Study Lock Manager Specification
  * @see FR-4.8 - Study Modification Control
@@ -20,14 +22,19 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <functional>
-#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <variant>
 #include <vector>
 
 // Forward declarations for kcenon ecosystem
@@ -182,15 +189,23 @@ struct study_lock_manager_config {
     /// Default lock timeout (0 = no timeout)
     std::chrono::seconds default_timeout{0};
 
-    /// Maximum time to wait when trying to acquire a lock
+    /// Maximum time lock_wait() and upgrade_lock() wait by default
     std::chrono::milliseconds acquire_wait_timeout{5000};
 
     /// How often to check for expired locks
     std::chrono::seconds cleanup_interval{60};
 
-    /// Enable automatic cleanup of expired locks
+    /// Expire locks proactively from a background timer wheel, firing the
+    /// expiration callback (fixed at construction)
     bool auto_cleanup{true};
 
+    /// Resolution of proactive expiry (fixed at construction)
+    std::chrono::milliseconds expiry_tick{100};
+
+    /// Number of independently locked partitions of the lock table
+    /// (fixed at construction)
+    std::size_t shard_count{16};
+
     /// Maximum number of concurrent shared locks
     std::size_t max_shared_locks{100};
 
@@ -238,6 +253,12 @@ struct lock_manager_stats {
 
     /// Number of lock contention events
     std::size_t contention_count{0};
+
+    /// Acquisitions and upgrades that had to wait in a queue
+    std::size_t wait_count{0};
+
+    /// Locks removed because they expired
+    std::size_t expired_count{0};
 };
 
 // =============================================================================
@@ -294,10 +315,23 @@ namespace lock_error {
  * - **Migration Locks**: High-priority locks for migration operations
  * - **Automatic Timeout**: Locks can expire after a configured duration
  * - **Force Unlock**: Admin capability to forcibly release locks
+ * - **Blocking Acquisition**: lock_wait() and upgrade_lock() queue fairly
+ *   instead of failing while a study is held
+ *
+ * ## Concurrency
+ *
+ * Studies are hashed onto shard_count shards, each with its own
+ * shared_mutex, so operations on different studies rarely contend.
+ * Requests that cannot be granted wait in a FIFO queue on the study and
+ * are handed the lock directly when it is released: a non-blocking lock()
+ * never overtakes queued waiters, so a stream of readers cannot starve a
+ * writer. Locks with a timeout are also placed on a timer wheel, which
+ * removes them shortly after they expire and fires the expiration callback
+ * without waiting for the next access.
  *
  * ## Integration with kcenon Ecosystem
  *
- * - **thread_system**: Thread-safe operations via shared_mutex
+ * - **thread_system**: Thread-safe operations via sharded shared_mutex
  * - **logger_system**: Audit trails for lock operations
  * - **monitoring_system**: Lock contention and duration metrics
  * - **common_system**: Result<T> for error handling
@@ -305,9 +339,10 @@ namespace lock_error {
  * ## Lock Priority
  *
  * When multiple lock requests compete:
- * 1. Migration locks have highest priority
- * 2. Exclusive locks block new shared locks
- * 3. Shared locks can coexist with other shared locks
+ * 1. A pending shared-to-exclusive upgrade is served first
+ * 2. Migration locks are queued ahead of other waiting requests
+ * 3. Exclusive locks block new shared locks
+ * 4. Shared locks can coexist with other shared locks
  *
  * @example
  * @code
@@ -353,7 +388,9 @@ public:
     explicit study_lock_manager(const study_lock_manager_config& config);
 
     /**
-     * @brief Destructor - releases all locks
+     * @brief Destructor - stops the expiry timer and releases all locks
+     *
+     * No thread may be waiting in lock_wait() or upgrade_lock().
      */
     ~study_lock_manager();
 
@@ -361,7 +398,7 @@ public:
     study_lock_manager(const study_lock_manager&) = delete;
     study_lock_manager& operator=(const study_lock_manager&) = delete;
 
-    /// Movable
+    /// Movable (no thread may be waiting on either manager)
     study_lock_manager(study_lock_manager&&) noexcept;
     study_lock_manager& operator=(study_lock_manager&&) noexcept;
 
@@ -403,6 +440,48 @@ public:
         std::chrono::seconds timeout = std::chrono::seconds{0})
         -> kcenon::common::Result<lock_token>;
 
+    /**
+     * @brief Acquire a lock, waiting while the study is held
+     *
+     * The request joins the study's FIFO queue (migration requests go
+     * ahead of other waiters) and is granted as soon as the holders that
+     * conflict with it have released the lock.
+     *
+     * @param study_uid Study UID to lock
+     * @param type Type of lock to acquire
+     * @param reason Reason for acquiring the lock
+     * @param holder Identifier of the lock holder
+     * @param wait Maximum time to wait (nullopt = acquire_wait_timeout)
+     * @param timeout Optional timeout for the lock once granted
+     * @return Result containing lock_token, or lock_error::timeout
+     */
+    [[nodiscard]] auto lock_wait(
+        const std::string& study_uid,
+        lock_type type,
+        const std::string& reason,
+        const std::string& holder = "",
+        std::optional<std::chrono::milliseconds> wait = std::nullopt,
+        std::chrono::seconds timeout = std::chrono::seconds{0})
+        -> kcenon::common::Result<lock_token>;
+
+    /**
+     * @brief Upgrade a shared lock to an exclusive one
+     *
+     * Granted once the token's holder is the only shared holder left; the
+     * upgrade waits ahead of every queued request. Only one upgrade per
+     * study may wait at a time: a second one fails immediately with
+     * lock_error::upgrade_failed, since neither could ever be granted. On
+     * timeout the shared lock is kept.
+     *
+     * @param token Shared lock token
+     * @param wait Maximum time to wait (nullopt = acquire_wait_timeout)
+     * @return Result containing the exclusive lock_token (same token ID)
+     */
+    [[nodiscard]] auto upgrade_lock(
+        const lock_token& token,
+        std::optional<std::chrono::milliseconds> wait = std::nullopt)
+        -> kcenon::common::Result<lock_token>;
+
     /**
      * @brief Try to acquire a lock without blocking
      *
@@ -628,6 +707,9 @@ public:
     /**
      * @brief Set callback for lock expiration events
      *
+     * With auto_cleanup the callback runs on the expiry timer thread.
+     * Callbacks should be set before the manager is shared between threads.
+     *
      * @param callback Callback function
      */
     void set_on_lock_expired(lock_event_callback callback);
@@ -637,11 +719,54 @@ private:
     // Internal Types
     // =========================================================================
 
-    struct lock_entry {
+    /// One holder of a lock (several for a shared lock)
+    struct lock_holder {
+        std::string token_id;
+        std::string holder;
+        std::chrono::system_clock::time_point acquired_at;
+    };
+
+    /// A blocked lock_wait() or upgrade_lock() call
+    struct lock_waiter {
+        lock_type type{lock_type::exclusive};
+        std::string reason;
+        std::string holder;
+        std::chrono::seconds timeout{0};
+        std::string upgrade_token;  ///< Token being upgraded, empty otherwise
+
+        bool done{false};          ///< Granted or failed
+        int error{0};              ///< lock_error code if failed
+        lock_token token;
         lock_info info;
-        std::vector<std::string> shared_holders;  // For shared locks
+        std::condition_variable_any cv;
     };
 
+    struct lock_entry {
+        lock_info info;  ///< Reflects the first holder
+        std::vector<lock_holder> holders;
+        std::deque<lock_waiter*> waiters;
+    };
+
+    /// Partition of the lock table
+    struct lock_shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, lock_entry> locks;
+    };
+
+    /// Hashed timer wheel of lock expiry deadlines
+    struct expiry_wheel {
+        static constexpr std::size_t slot_count = 512;
+
+        std::mutex mutex;
+        std::vector<std::vector<
+            std::pair<std::chrono::system_clock::time_point, std::string>>> slots;
+        std::size_t cursor{0};
+        std::chrono::system_clock::time_point cursor_time;
+    };
+
+    /// Callback invocations deferred until the shard lock is released
+    using pending_events = std::vector<std::pair<std::string, lock_info>>;
+
     // =========================================================================
     // Internal Methods
     // =========================================================================
@@ -664,21 +789,102 @@ private:
         -> std::optional<std::chrono::system_clock::time_point>;
 
     /**
-     * @brief Check if a lock can be acquired
+     * @brief Copy of the configuration, safe against set_config()
      */
-    [[nodiscard]] auto can_acquire_lock(
-        const std::string& study_uid,
-        lock_type type) const -> bool;
+    [[nodiscard]] auto current_config() const -> study_lock_manager_config;
+
+    /**
+     * @brief Shard owning a study
+     */
+    [[nodiscard]] auto shard_for(const std::string& study_uid) const
+        -> lock_shard&;
+
+    /**
+     * @brief Whether a new holder of @p type is compatible with the entry
+     */
+    [[nodiscard]] auto can_grant(const lock_entry& entry, lock_type type) const
+        -> bool;
+
+    /**
+     * @brief Add a holder to an entry (shard locked)
+     */
+    auto add_holder(const std::string& study_uid,
+                    lock_entry& entry,
+                    lock_type type,
+                    const std::string& reason,
+                    const std::string& holder,
+                    std::chrono::seconds timeout) -> lock_token;
+
+    /**
+     * @brief Remove the holder at @p index (shard locked)
+     */
+    void remove_holder(lock_entry& entry, std::size_t index);
+
+    /**
+     * @brief Hand the lock to queued waiters that can now be granted
+     */
+    void grant_waiters(const std::string& study_uid, lock_entry& entry);
+
+    /**
+     * @brief Drop all holders of an expired entry (shard locked)
+     * @return true if the entry had expired
+     */
+    auto expire_if_stale(const std::string& study_uid,
+                         lock_entry& entry,
+                         pending_events& expired) -> bool;
+
+    /**
+     * @brief Erase an entry that has neither holders nor waiters
+     */
+    static void erase_if_unused(
+        lock_shard& shard,
+        std::unordered_map<std::string, lock_entry>::iterator it);
+
+    /**
+     * @brief Block until a queued waiter is granted, fails or times out
+     */
+    auto wait_for_grant(std::unique_lock<std::shared_mutex>& lock,
+                        const std::string& study_uid,
+                        lock_waiter& waiter,
+                        std::chrono::milliseconds wait)
+        -> kcenon::common::Result<lock_token>;
+
+    /**
+     * @brief Fire deferred callbacks (no shard lock held)
+     */
+    void notify(const lock_event_callback& callback,
+                const pending_events& events) const;
+
+    /**
+     * @brief Put a lock deadline on the timer wheel
+     */
+    void schedule_expiry(const std::string& study_uid,
+                         std::chrono::system_clock::time_point deadline);
+
+    /**
+     * @brief Expire locks whose wheel slots have passed
+     */
+    void process_expiry_tick();
+
+    /**
+     * @brief Start the timer wheel thread if auto_cleanup is set
+     */
+    void start_expiry_timer();
+
+    /**
+     * @brief Stop the timer wheel thread
+     */
+    void stop_expiry_timer();
 
     /**
      * @brief Update statistics on lock acquisition
      */
-    void record_acquisition(lock_type type);
+    void record_acquisition();
 
     /**
      * @brief Update statistics on lock release
      */
-    void record_release(lock_type type, std::chrono::milliseconds duration);
+    void record_release(std::chrono::milliseconds duration);
 
     // =========================================================================
     // Member Variables
@@ -687,20 +893,32 @@ private:
     /// Configuration
     study_lock_manager_config config_;
 
-    /// Lock entries (study_uid -> lock_entry)
-    std::map<std::string, lock_entry> locks_;
-
-    /// Token to study UID mapping for fast lookup
-    std::map<std::string, std::string> token_to_study_;
-
-    /// Mutex for thread-safe access
-    mutable std::shared_mutex mutex_;
-
-    /// Statistics
-    mutable lock_manager_stats stats_;
-
-    /// Mutex for statistics
-    mutable std::mutex stats_mutex_;
+    /// Guards config_ against set_config()
+    mutable std::shared_mutex config_mutex_;
+
+    /// Lock table partitions (study_uid hash -> shard)
+    std::vector<std::unique_ptr<lock_shard>> shards_;
+
+    /// Expiry deadlines of locks with a timeout
+    std::unique_ptr<expiry_wheel> wheel_;
+
+    /// Timer wheel thread
+    std::thread expiry_thread_;
+    std::mutex expiry_mutex_;
+    std::condition_variable expiry_cv_;
+    bool expiry_stop_{false};
+    std::atomic<bool> expiry_running_{false};
+
+    /// Statistics counters
+    std::atomic<std::size_t> total_acquisitions_{0};
+    std::atomic<std::size_t> total_releases_{0};
+    std::atomic<std::size_t> timeout_count_{0};
+    std::atomic<std::size_t> force_unlock_count_{0};
+    std::atomic<std::size_t> contention_count_{0};
+    std::atomic<std::size_t> wait_count_{0};
+    std::atomic<std::size_t> expired_count_{0};
+    std::atomic<std::int64_t> total_duration_ms_{0};
+    std::atomic<std::int64_t> max_duration_ms_{0};
 
     /// Next token ID counter
     mutable std::atomic<uint64_t> next_token_id_{1};
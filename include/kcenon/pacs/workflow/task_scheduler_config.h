@@ -342,12 +342,18 @@ struct scheduled_task {
 
 /**
  * @brief Configuration for cleanup scheduling
+ *
+ * Cleanup runs storage::retention_engine, which selects expired studies
+ * with an indexed query, deletes them in bounded transactions and unlinks
+ * their files on a throttled worker pool. A run stopped by the deletion
+ * cap or a restart resumes on the next cycle.
  */
 struct cleanup_config {
     /// Default retention period
     std::chrono::days default_retention{365};
 
-    /// Modality-specific retention periods
+    /// Modality-specific retention periods; a study is kept until all of
+    /// its modalities have expired
     std::map<std::string, std::chrono::days> modality_retention;
 
     /// Study description patterns to exclude from cleanup
@@ -359,12 +365,21 @@ struct cleanup_config {
     /// Perform dry run (report only, no deletion)
     bool dry_run{false};
 
-    /// Maximum studies to delete per cycle
+    /// Maximum studies to delete per cycle (0 = all expired studies)
     std::size_t max_deletions_per_cycle{100};
 
     /// Delete from database only (keep files)
     bool database_only{false};
 
+    /// Studies deleted per database transaction (at most 500)
+    std::size_t batch_size{200};
+
+    /// Worker threads unlinking files of deleted studies
+    std::size_t unlink_workers{4};
+
+    /// Files unlinked per second across all workers (0 = unlimited)
+    std::uint32_t max_unlinks_per_second{500};
+
     /// Schedule for cleanup task
     schedule cleanup_schedule{cron_schedule::daily_at(2, 0)};  // 2:00 AM
 
@@ -436,12 +451,18 @@ struct archive_config {
 
 /**
  * @brief Configuration for verification scheduling
+ *
+ * Verification runs storage::fixity_scrubber, which re-hashes stored files
+ * against the hashes recorded at ingest on a throttled worker pool and
+ * resumes each run where the previous one stopped. The hash algorithm is
+ * the one named in each recorded digest ("xxh64:<hex>"), so it is not
+ * configurable here.
  */
 struct verification_config {
     /// Interval between verification runs
     std::chrono::hours interval{24};
 
-    /// Verify file checksums (MD5/SHA256)
+    /// Re-hash file content; false only checks existence and size
     bool check_checksums{true};
 
     /// Verify database-storage consistency
@@ -453,11 +474,21 @@ struct verification_config {
     /// Attempt repair on failure
     bool repair_on_failure{false};
 
-    /// Maximum studies to verify per cycle
+    /// Maximum instances to verify per run (0 = the whole archive);
+    /// the next run resumes after the last instance verified
     std::size_t max_verifications_per_cycle{1000};
 
-    /// Hash algorithm for checksum verification
-    std::string hash_algorithm{"SHA256"};
+    /// Worker threads reading and hashing files
+    std::size_t worker_count{2};
+
+    /// Read bandwidth budget in bytes per second (0 = unlimited)
+    std::uint64_t max_bytes_per_second{64ULL * 1024 * 1024};
+
+    /// Read requests per second budget (0 = unlimited)
+    std::uint32_t max_iops{500};
+
+    /// File holding the resume position across restarts (empty = memory only)
+    std::string checkpoint_path;
 
     /// Schedule for verification task
     schedule verification_schedule{cron_schedule::daily_at(4, 0)};  // 4:00 AM
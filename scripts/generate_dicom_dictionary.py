@@ -0,0 +1,493 @@
+#!/usr/bin/env python3
+"""Generate src/core/standard_tags_data.cpp from the DICOM data dictionary.
+
+The dictionary is read from the DocBook sources of the standard (part06.xml
+for data elements, part07.xml for command elements), or, when those are not
+at hand, from pydicom's transcription of them (pydicom/_dicom_dict.py).
+
+The generated file holds every registry entry as a constexpr tag_info array
+plus two minimal perfect hash tables (by tag and by keyword), so lookups are
+a couple of table reads with no locking and no start-up cost.
+
+Usage:
+    scripts/generate_dicom_dictionary.py --xml part06.xml part07.xml -o out.cpp
+    scripts/generate_dicom_dictionary.py --pydicom _dicom_dict.py -o out.cpp
+"""
+
+from __future__ import annotations
+
+import argparse
+import ast
+import re
+import sys
+import xml.etree.ElementTree as ET
+from dataclasses import dataclass
+from pathlib import Path
+
+
+MASK32 = 0xFFFFFFFF
+
+# Hash table geometry: displacement buckets and slots, both powers of two
+TAG_BUCKETS = 2048
+KEYWORD_BUCKETS = 2048
+SLOT_COUNT = 8192
+
+VR_NAMES = {
+    "AE", "AS", "AT", "CS", "DA", "DS", "DT", "FD", "FL", "IS", "LO", "LT",
+    "OB", "OD", "OF", "OL", "OV", "OW", "PN", "SH", "SL", "SQ", "SS", "ST",
+    "SV", "TM", "UC", "UI", "UL", "UN", "UR", "US", "UT", "UV",
+}
+
+TAG_PATTERN = re.compile(r"\(?\s*([0-9A-Fa-fx]{4})\s*,\s*([0-9A-Fa-fx]{4})\s*\)?")
+
+
+@dataclass
+class Entry:
+    """One registry row; `tag` keeps 'x' wildcards for repeating groups."""
+
+    tag: str
+    vr: str
+    vm: str
+    name: str
+    keyword: str
+    retired: bool
+    fill: str = "0"
+
+    @property
+    def base(self) -> int:
+        """Representative tag: the wildcards filled with `fill`."""
+        return int(self.tag.replace("x", self.fill), 16)
+
+    @property
+    def repeating(self) -> bool:
+        return "x" in self.tag
+
+
+# ---------------------------------------------------------------------------
+# Sources
+# ---------------------------------------------------------------------------
+
+def clean(text: str) -> str:
+    """Drop the zero-width spaces the DocBook sources use as break hints."""
+    text = text.replace("\u200b", "").replace("\u00a0", " ")
+    return " ".join(text.split())
+
+
+def read_docbook(paths: list[Path]) -> list[Entry]:
+    """Collect registry rows from every table with Tag/Keyword/VR/VM columns."""
+    entries: list[Entry] = []
+    for path in paths:
+        root = ET.parse(path).getroot()
+        for table in root.iter():
+            if not table.tag.endswith("}table") and table.tag != "table":
+                continue
+            title = clean("".join(
+                next((c for c in table if c.tag.endswith("caption")
+                      or c.tag.endswith("title")), ET.Element("x")).itertext()))
+            rows = [r for r in table.iter() if r.tag.endswith("tr")]
+            if not rows:
+                continue
+            header = [clean("".join(c.itertext())).lower()
+                      for c in rows[0] if c.tag.endswith(("th", "td"))]
+            if not {"tag", "keyword", "vr", "vm"} <= set(header):
+                continue
+            column = {name: header.index(name) for name in header}
+            name_column = column.get("name", column.get("message field"))
+            retired_table = "retired" in title.lower()
+            for row in rows[1:]:
+                cells = [clean("".join(c.itertext()))
+                         for c in row if c.tag.endswith(("th", "td"))]
+                if len(cells) < len(header):
+                    continue
+                match = TAG_PATTERN.fullmatch(cells[column["tag"]])
+                if not match:
+                    continue
+                # Table 6-1 marks retired rows with "RET" after the VM column
+                trailing = " ".join(cells[column["vm"] + 1:])
+                entries.append(Entry(
+                    tag=(match.group(1) + match.group(2)).upper().replace("X", "x"),
+                    vr=cells[column["vr"]],
+                    vm=cells[column["vm"]],
+                    name=cells[name_column] if name_column is not None else "",
+                    keyword=cells[column["keyword"]],
+                    retired=retired_table or "RET" in trailing.split(),
+                ))
+    return entries
+
+
+def read_pydicom(path: Path) -> list[Entry]:
+    """Read pydicom's DicomDictionary and RepeatersDictionary literals."""
+    tree = ast.parse(path.read_text(encoding="utf-8"))
+    tables: dict[str, dict] = {}
+    for node in tree.body:
+        target = getattr(node, "target", None) or (
+            node.targets[0] if isinstance(node, ast.Assign) else None)
+        if isinstance(target, ast.Name) and target.id in (
+                "DicomDictionary", "RepeatersDictionary"):
+            tables[target.id] = ast.literal_eval(node.value)
+
+    entries: list[Entry] = []
+    for key, (vr, vm, name, retired, keyword) in tables["DicomDictionary"].items():
+        entries.append(Entry(f"{key:08X}", vr, vm, name, keyword, retired == "Retired"))
+    for key, (vr, vm, name, retired, keyword) in tables["RepeatersDictionary"].items():
+        entries.append(Entry(key.upper().replace("X", "x"), vr, vm, name, keyword,
+                             retired == "Retired"))
+    return entries
+
+
+# ---------------------------------------------------------------------------
+# Normalisation
+# ---------------------------------------------------------------------------
+
+def normalise_vr(text: str) -> str:
+    """Collapse alternatives to the VR the implicit VR decoder should assume.
+
+    "US or SS" (and "US or SS or OW") become US and "OB or OW" becomes OW,
+    matching the values used before the table was generated; elements with
+    no VR (items and delimiters) become UN.
+    """
+    choices = [c.strip() for c in text.replace(",", " or ").split(" or ") if c.strip()]
+    if not choices or choices[0] in ("NONE", "See Note"):
+        return "UN"
+    if "US" in choices:
+        return "US"
+    if "OW" in choices:
+        return "OW"
+    if choices[0] not in VR_NAMES:
+        raise ValueError(f"unknown VR {text!r}")
+    return choices[0]
+
+
+def parse_vm(text: str) -> tuple[int, int | None, int]:
+    """Parse "1", "1-3", "1-n", "2-2n" into (min, max or None, multiplier)."""
+    text = text.split(" or ")[0].strip()
+    match = re.fullmatch(r"(\d+)(?:-(\d*)(n)?)?", text)
+    if not match:
+        raise ValueError(f"unknown VM {text!r}")
+    low = int(match.group(1))
+    if match.group(3):
+        return low, None, int(match.group(2) or 1)
+    if match.group(2):
+        return low, int(match.group(2)), 1
+    return low, low, 1
+
+
+def vm_constant(vm: tuple[int, int | None, int]) -> str:
+    low, high, multiplier = vm
+    if high is None:
+        return f"vm_{low}_{'' if multiplier == 1 else multiplier}n"
+    if high == low:
+        return f"vm_{low}"
+    return f"vm_{low}_{high}"
+
+
+def repeating_mask(tag: str) -> tuple[int, int]:
+    """Mask/value pair for a repeating tag; group wildcards only match even groups."""
+    mask = int("".join("0" if c == "x" else "F" for c in tag), 16)
+    if "x" in tag[:4]:
+        mask |= 0x00010000
+    return mask, int(tag.replace("x", "0"), 16)
+
+
+# ---------------------------------------------------------------------------
+# Perfect hashing (hash-and-displace); mirrored by the emitted C++ code
+# ---------------------------------------------------------------------------
+
+def mix(x: int) -> int:
+    x &= MASK32
+    x ^= x >> 16
+    x = (x * 0x85EBCA6B) & MASK32
+    x ^= x >> 13
+    x = (x * 0xC2B2AE35) & MASK32
+    x ^= x >> 16
+    return x
+
+
+def keyword_hash(keyword: str) -> int:
+    h = 0x811C9DC5
+    for byte in keyword.encode("ascii"):
+        h = ((h ^ byte) * 0x01000193) & MASK32
+    return h
+
+
+def build_perfect_hash(keys: list[tuple[int, int]], bucket_count: int,
+                       slot_count: int) -> tuple[list[int], list[int]]:
+    """Place (hash, index) pairs; returns (displacements, slots of index + 1)."""
+    if len({h for h, _ in keys}) != len(keys):
+        raise ValueError("hash collision between distinct keys")
+    buckets: list[list[tuple[int, int]]] = [[] for _ in range(bucket_count)]
+    for h, index in keys:
+        buckets[mix(h) & (bucket_count - 1)].append((h, index))
+
+    displacements = [0] * bucket_count
+    slots = [0] * slot_count
+    for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        members = buckets[bucket]
+        if not members:
+            break
+        for attempt in range(1, 1 << 24):
+            displacement = mix(attempt * 0x9E3779B9)
+            positions = [mix(h ^ displacement) & (slot_count - 1) for h, _ in members]
+            if len(set(positions)) == len(positions) and not any(
+                    slots[p] for p in positions):
+                for position, (_, index) in zip(positions, members):
+                    slots[position] = index + 1
+                displacements[bucket] = displacement
+                break
+        else:
+            raise RuntimeError("no displacement found; enlarge the tables")
+    return displacements, slots
+
+
+# ---------------------------------------------------------------------------
+# Output
+# ---------------------------------------------------------------------------
+
+def c_string(text: str) -> str:
+    return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def emit_array(name: str, ctype: str, values: list[int], per_line: int,
+               width: int) -> list[str]:
+    lines = [f"constexpr std::array<{ctype}, {len(values)}> {name} = {{{{"]
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        lines.append("    " + " ".join(f"0x{v:0{width}X}," for v in chunk))
+    lines.append("}};")
+    return lines
+
+
+HEADER = """\
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file standard_tags_data.cpp
+ * @brief Standard DICOM tags from PS3.6 Data Dictionary
+ *
+ * GENERATED by scripts/generate_dicom_dictionary.py - do not edit.
+ * Source: {source}
+ *
+ * Holds every data, file meta, directory and command element of the
+ * standard ({count} entries, {repeating} of them repeating-group tags such
+ * as (60xx,3000)) together with two minimal perfect hash tables, one keyed
+ * by tag and one by keyword. Lookups hash the key, read one displacement
+ * and one slot, and compare a single entry; everything is constant
+ * initialized, so there is no start-up cost and nothing to lock.
+ *
+ * For elements with alternative VRs the VR an implicit VR decoder should
+ * assume is stored ("US or SS" -> US, "OB or OW" -> OW); items and
+ * delimiters are UN.
+ *
+ * @see DICOM PS3.6 - Data Dictionary
+ * @see DICOM PS3.7 Annex E - Command Dictionary
+ */
+
+#include "kcenon/pacs/core/tag_info.h"
+#include "kcenon/pacs/encoding/vr_type.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace kcenon::pacs::core {{
+
+namespace {{
+
+using VR = kcenon::pacs::encoding::vr_type;
+
+// Helper to create VR value
+constexpr auto vr(VR v) -> uint16_t {{
+    return static_cast<uint16_t>(v);
+}}
+
+// VM patterns used by the dictionary
+"""
+
+LOOKUP = """\
+/// Murmur3 finalizer, shared by both hash tables
+constexpr auto mix(uint32_t x) noexcept -> uint32_t {
+    x ^= x >> 16;
+    x *= 0x85EBCA6BU;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35U;
+    x ^= x >> 16;
+    return x;
+}
+
+/// FNV-1a over the keyword characters
+constexpr auto keyword_hash(std::string_view keyword) noexcept -> uint32_t {
+    uint32_t hash = 0x811C9DC5U;
+    for (const char c : keyword) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 0x01000193U;
+    }
+    return hash;
+}
+
+/// Slot of a key: its bucket's displacement picks a collision-free slot
+template <size_t Buckets, size_t Slots>
+constexpr auto slot_of(uint32_t key,
+                       const std::array<uint32_t, Buckets>& displacements,
+                       const std::array<uint16_t, Slots>& slots) noexcept
+    -> uint16_t {
+    static_assert((Buckets & (Buckets - 1)) == 0 && (Slots & (Slots - 1)) == 0);
+    const auto displacement = displacements[mix(key) & (Buckets - 1)];
+    return slots[mix(key ^ displacement) & (Slots - 1)];
+}
+
+constexpr auto lookup_tag(dicom_tag tag) noexcept -> const tag_info* {
+    const auto key = tag.combined();
+    const auto slot = slot_of(key, tag_displacements, tag_slots);
+    if (slot != 0 && standard_tags[slot - 1].tag == tag) {
+        return &standard_tags[slot - 1];
+    }
+    for (const auto& repeating : repeating_tags) {
+        if ((key & repeating.mask) == repeating.value) {
+            return &standard_tags[repeating.index];
+        }
+    }
+    return nullptr;
+}
+
+constexpr auto lookup_keyword(std::string_view keyword) noexcept
+    -> const tag_info* {
+    if (keyword.empty()) {
+        return nullptr;
+    }
+    const auto slot =
+        slot_of(keyword_hash(keyword), keyword_displacements, keyword_slots);
+    if (slot != 0 && standard_tags[slot - 1].keyword == keyword) {
+        return &standard_tags[slot - 1];
+    }
+    return nullptr;
+}
+"""
+
+
+def generate(entries: list[Entry], source: str) -> str:
+    # (0028,04x0) and friends exclude x = 0, which (0028,0400) occupies
+    regular = {e.base for e in entries if not e.repeating}
+    for entry in entries:
+        if entry.repeating and entry.base in regular:
+            entry.fill = "1"
+    entries = sorted(entries, key=lambda e: (e.base, e.tag))
+    seen: dict[int, str] = {}
+    for entry in entries:
+        if entry.base in seen:
+            raise ValueError(f"duplicate tag {entry.tag} ({seen[entry.base]})")
+        seen[entry.base] = entry.tag
+    keywords = [e.keyword for e in entries if e.keyword]
+    if len(set(keywords)) != len(keywords):
+        raise ValueError("duplicate keywords")
+    if len(entries) >= 0xFFFF:
+        raise ValueError("too many entries for 16-bit slots")
+
+    vms = {e.tag: parse_vm(e.vm) for e in entries}
+    out = [HEADER.format(source=source, count=len(entries),
+                         repeating=sum(e.repeating for e in entries))]
+    for vm in sorted(set(vms.values()), key=lambda v: (v[0], v[1] or 1 << 20, v[2])):
+        low, high, multiplier = vm
+        high_text = "std::nullopt" if high is None else str(high)
+        suffix = f", {multiplier}" if multiplier != 1 else ""
+        out.append(f"constexpr value_multiplicity {vm_constant(vm)}"
+                   f"{{{low}, {high_text}{suffix}}};\n")
+
+    out.append("\n// Sorted by tag; repeating-group tags are listed under their first instance.\n")
+    out.append("// Note: Array size explicitly specified to avoid Clang's fold expression\n")
+    out.append("//       nesting limit of 256 when using CTAD with large initializer lists\n")
+    out.append("// clang-format off\n")
+    out.append(f"constexpr std::array<tag_info, {len(entries)}> standard_tags = {{{{\n")
+    for entry in entries:
+        base = entry.base
+        comment = f"  // ({entry.tag[:4]},{entry.tag[4:]})" if entry.repeating else ""
+        out.append(
+            f"    tag_info{{dicom_tag{{0x{base >> 16:04X}, 0x{base & 0xFFFF:04X}}}, "
+            f"vr(VR::{normalise_vr(entry.vr)}), {vm_constant(vms[entry.tag])}, "
+            f"{c_string(entry.keyword)}, {c_string(entry.name)}, "
+            f"{'true' if entry.retired else 'false'}}},{comment}\n")
+    out.append("}};\n\n")
+
+    repeating = [(repeating_mask(e.tag), i) for i, e in enumerate(entries) if e.repeating]
+    # Most specific masks first so overlapping patterns resolve predictably
+    repeating.sort(key=lambda r: (-bin(r[0][0]).count("1"), r[0][1]))
+    out.append("/// Repeating-group tags: a tag matches when (tag & mask) == value\n")
+    out.append("struct repeating_tag {\n    uint32_t mask;\n    uint32_t value;\n"
+               "    uint16_t index;\n};\n\n")
+    out.append(f"constexpr std::array<repeating_tag, {len(repeating)}> repeating_tags = {{{{\n")
+    for (mask, value), index in repeating:
+        out.append(f"    {{0x{mask:08X}, 0x{value:08X}, {index}}},\n")
+    out.append("}};\n\n")
+
+    tag_keys = [(e.base, i) for i, e in enumerate(entries)]
+    displacements, slots = build_perfect_hash(tag_keys, TAG_BUCKETS, SLOT_COUNT)
+    out.append("// Perfect hash by tag: displacement per bucket, then entry index + 1\n")
+    out.append("\n".join(emit_array("tag_displacements", "uint32_t", displacements, 8, 8)))
+    out.append("\n\n")
+    out.append("\n".join(emit_array("tag_slots", "uint16_t", slots, 16, 4)))
+    out.append("\n\n")
+
+    keyword_keys = [(keyword_hash(e.keyword), i) for i, e in enumerate(entries) if e.keyword]
+    displacements, slots = build_perfect_hash(keyword_keys, KEYWORD_BUCKETS, SLOT_COUNT)
+    out.append("// Perfect hash by keyword: displacement per bucket, then entry index + 1\n")
+    out.append("\n".join(emit_array("keyword_displacements", "uint32_t", displacements, 8, 8)))
+    out.append("\n\n")
+    out.append("\n".join(emit_array("keyword_slots", "uint16_t", slots, 16, 4)))
+    out.append("\n// clang-format on\n\n")
+
+    out.append(LOOKUP)
+    out.append("""
+static_assert(lookup_tag(dicom_tag{0x0010, 0x0010})->keyword == "PatientName");
+static_assert(lookup_tag(dicom_tag{0x7FE0, 0x0010})->keyword == "PixelData");
+static_assert(lookup_tag(dicom_tag{0x6002, 0x3000})->keyword == "OverlayData");
+static_assert(lookup_tag(dicom_tag{0x6001, 0x3000}) == nullptr);
+static_assert(lookup_keyword("StudyInstanceUID")->tag == dicom_tag{0x0020, 0x000D});
+static_assert(lookup_keyword("NotAKeyword") == nullptr);
+
+}  // namespace
+
+auto get_standard_tags() -> std::span<const tag_info> {
+    return standard_tags;
+}
+
+auto find_standard_tag(dicom_tag tag) noexcept -> const tag_info* {
+    return lookup_tag(tag);
+}
+
+auto find_standard_keyword(std::string_view keyword) noexcept -> const tag_info* {
+    return lookup_keyword(keyword);
+}
+
+}  // namespace kcenon::pacs::core
+""")
+    return "".join(out)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--xml", nargs="+", type=Path,
+                        help="DocBook part06.xml (and part07.xml for command elements)")
+    source.add_argument("--pydicom", type=Path, help="pydicom/_dicom_dict.py")
+    parser.add_argument("-o", "--output", type=Path, required=True)
+    args = parser.parse_args()
+
+    if args.xml:
+        entries = read_docbook(args.xml)
+        description = "DICOM " + ", ".join(p.name for p in args.xml)
+    else:
+        entries = read_pydicom(args.pydicom)
+        description = "pydicom _dicom_dict.py (transcribed from PS3.6/PS3.7)"
+    if not entries:
+        print("no dictionary entries found", file=sys.stderr)
+        return 1
+
+    text = generate(entries, description)
+    if not args.output.exists() or args.output.read_text(encoding="utf-8") != text:
+        args.output.write_text(text, encoding="utf-8")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -18,6 +18,7 @@
 #include "kcenon/pacs/storage/sync_conflict_repository.h"
 #include "kcenon/pacs/storage/sync_history_repository.h"
 #endif
+#include "kcenon/pacs/storage/index_database.h"
 #include "kcenon/pacs/storage/sync_repository.h"
 #include "kcenon/pacs/services/query_scu.h"
 #include "kcenon/pacs/core/dicom_tag_constants.h"
@@ -70,6 +71,55 @@ std::string generate_uuid() {
     return oss.str();
 }
 
+/// Format a time point as a DICOM DA value in local time
+std::string format_dicom_date(std::chrono::system_clock::time_point time) {
+    auto time_t_value = std::chrono::system_clock::to_time_t(time);
+    std::tm tm_buf;
+#ifdef _WIN32
+    localtime_s(&tm_buf, &time_t_value);
+#else
+    localtime_r(&time_t_value, &tm_buf);
+#endif
+    std::ostringstream oss;
+    oss << std::put_time(&tm_buf, "%Y%m%d");
+    return oss.str();
+}
+
+/// Studies listed from a C-FIND response, sorted by UID
+std::vector<storage::study_digest_entry> parse_study_matches(
+    const std::vector<core::dicom_dataset>& matches,
+    const std::optional<std::string>& modalities = std::nullopt) {
+    std::vector<storage::study_digest_entry> studies;
+    for (const auto& match : matches) {
+        auto uid = match.get_string(core::tags::study_instance_uid);
+        if (uid.empty()) {
+            continue;
+        }
+        // C-FIND matches any of the requested modalities; a bucket wants
+        // exactly its own set
+        if (modalities && storage::normalize_study_modalities(match.get_string(
+                              core::tags::modalities_in_study)) != *modalities) {
+            continue;
+        }
+        storage::study_digest_entry entry;
+        entry.study_uid = std::move(uid);
+        const auto count =
+            match.get_string(core::tags::number_of_study_related_instances);
+        if (!count.empty()) {
+            try {
+                entry.instance_count = static_cast<size_t>(std::stoull(count));
+            } catch (...) {
+                entry.instance_count = 0;
+            }
+        }
+        studies.push_back(std::move(entry));
+    }
+    std::sort(studies.begin(), studies.end(), [](const auto& a, const auto& b) {
+        return a.study_uid < b.study_uid;
+    });
+    return studies;
+}
+
 }  // namespace
 
 // =============================================================================
@@ -88,6 +138,11 @@ struct sync_manager::impl {
     std::shared_ptr<services::query_scu> query_scu;
     std::shared_ptr<di::ILogger> logger;
 
+    // Reconciliation sources
+    std::shared_ptr<storage::index_database> local_db;
+    sync_digest_provider digest_provider;
+    mutable std::mutex reconcile_mutex;
+
     // Config cache
     std::vector<sync_config> configs;
     mutable std::shared_mutex configs_mutex;
@@ -350,8 +405,8 @@ struct sync_manager::impl {
             sync_start_time = std::chrono::system_clock::now() - cfg.lookback;
         }
 
-        // Query remote studies
-        auto remote_studies = query_remote_studies(cfg, sync_start_time, result);
+        // Find the studies that differ between both sides
+        auto comparison = reconcile(cfg, sync_start_time, result);
         if (!result.errors.empty()) {
             result.success = false;
             result.completed_at = std::chrono::system_clock::now();
@@ -360,11 +415,6 @@ struct sync_manager::impl {
             return result;
         }
 
-        result.studies_checked = remote_studies.size();
-
-        // Compare with local studies
-        auto comparison = compare_with_local(cfg, remote_studies, result);
-
         // Process differences based on sync direction
         if (cfg.direction == sync_direction::pull ||
             cfg.direction == sync_direction::bidirectional) {
@@ -466,32 +516,270 @@ struct sync_manager::impl {
         return result;
     }
 
-    std::vector<std::string> query_remote_studies(
+    // =========================================================================
+    // Reconciliation
+    // =========================================================================
+
+    /**
+     * @brief Find the studies that differ between the local and remote node
+     *
+     * Compares digest trees when a local database and a digest provider are
+     * set, and falls back to listing every remote study otherwise.
+     */
+    std::vector<sync_conflict> reconcile(
         const sync_config& cfg,
         std::chrono::system_clock::time_point since,
         sync_result& result) {
 
-        std::vector<std::string> study_uids;
+        std::shared_ptr<storage::index_database> db;
+        sync_digest_provider provider;
+        {
+            std::lock_guard lock(reconcile_mutex);
+            db = local_db;
+            provider = digest_provider;
+        }
+
+        if (db && provider.children) {
+            auto conflicts = reconcile_by_digest(cfg, since, *db, provider, result);
+            if (conflicts) {
+                return std::move(*conflicts);
+            }
+            if (logger) {
+                logger->info_fmt("Node '{}' has no study digests, comparing all studies",
+                    cfg.source_node_id);
+            }
+        }
+
+        auto remote_studies = query_remote_studies(cfg, since, result);
+        if (!result.errors.empty()) {
+            return {};
+        }
+        result.studies_checked = remote_studies.size();
+        return compare_with_local(cfg, remote_studies, db.get(), result);
+    }
+
+    /**
+     * @brief Descend both digest trees from the root into differing nodes
+     *
+     * @return Conflicts found, or std::nullopt if the remote root could not
+     * be fetched
+     */
+    std::optional<std::vector<sync_conflict>> reconcile_by_digest(
+        const sync_config& cfg,
+        std::chrono::system_clock::time_point since,
+        storage::index_database& db,
+        const sync_digest_provider& provider,
+        sync_result& result) {
+
+        storage::study_digest_scope scope;
+        if (since != std::chrono::system_clock::time_point{}) {
+            scope.from_date = format_dicom_date(since);
+        }
+        scope.modalities = cfg.modalities;
+
+        std::vector<sync_conflict> conflicts;
+        std::vector<std::string> pending{""};
+        bool at_root = true;
+        size_t nodes_compared = 0;
+
+        while (!pending.empty()) {
+            const auto key = std::move(pending.back());
+            pending.pop_back();
+
+            auto remote = provider.children(cfg.source_node_id, key, scope);
+            if (!remote) {
+                if (at_root) {
+                    return std::nullopt;
+                }
+                result.errors.push_back("Remote study digest unavailable for '" +
+                                        key + "'");
+                return conflicts;
+            }
+            auto local = db.study_digest_children(key, scope);
+            if (local.is_err()) {
+                result.errors.push_back("Local study digest failed: " +
+                                        local.error().message);
+                return conflicts;
+            }
+            nodes_compared += remote->size();
+
+            if (at_root) {
+                at_root = false;
+                const auto remote_root = storage::combine_study_digests("", *remote);
+                result.studies_checked = remote_root.study_count;
+                if (remote_root.matches(storage::combine_study_digests("", local.value()))) {
+                    break;
+                }
+            }
+
+            for (const auto& child : storage::diff_study_digests(local.value(), *remote)) {
+                if (!storage::is_study_digest_bucket(child)) {
+                    pending.push_back(child);
+                    continue;
+                }
+                const auto it = std::lower_bound(
+                    remote->begin(), remote->end(), child,
+                    [](const storage::study_digest_node& node, const std::string& key) {
+                        return node.key < key;
+                    });
+                const bool on_remote = it != remote->end() && it->key == child;
+                if (!reconcile_bucket(cfg, child, on_remote, db, provider,
+                                      conflicts, result)) {
+                    return conflicts;
+                }
+            }
+        }
+
+        if (logger) {
+            logger->info_fmt("Digest comparison with '{}': {} nodes compared, "
+                "{} buckets listed, {} differences",
+                cfg.source_node_id, nodes_compared, result.buckets_reconciled,
+                conflicts.size());
+        }
+        return conflicts;
+    }
+
+    /**
+     * @brief List both sides of one differing bucket and diff the studies
+     * @return false if a listing failed (the error is in @p result)
+     */
+    bool reconcile_bucket(const sync_config& cfg,
+                          const std::string& bucket_key,
+                          bool on_remote,
+                          storage::index_database& db,
+                          const sync_digest_provider& provider,
+                          std::vector<sync_conflict>& conflicts,
+                          sync_result& result) {
+        std::vector<storage::study_digest_entry> remote;
+        if (on_remote) {
+            std::optional<std::vector<storage::study_digest_entry>> listed;
+            if (provider.members) {
+                listed = provider.members(cfg.source_node_id, bucket_key);
+            }
+            if (!listed) {
+                listed = query_bucket_studies(cfg, bucket_key, result);
+            }
+            if (!listed) {
+                return false;
+            }
+            remote = std::move(*listed);
+            std::sort(remote.begin(), remote.end(), [](const auto& a, const auto& b) {
+                return a.study_uid < b.study_uid;
+            });
+        }
+
+        auto local = db.study_digest_members(bucket_key);
+        if (local.is_err()) {
+            result.errors.push_back("Local study digest failed: " +
+                                    local.error().message);
+            return false;
+        }
+        ++result.buckets_reconciled;
+
+        const auto now = std::chrono::system_clock::now();
+        auto make_conflict = [&](const std::string& study_uid,
+                                 sync_conflict_type type) {
+            sync_conflict conflict;
+            conflict.config_id = cfg.config_id;
+            conflict.study_uid = study_uid;
+            conflict.conflict_type = type;
+            conflict.remote_modified = now;
+            conflict.detected_at = now;
+            return conflict;
+        };
+
+        auto l = local.value().begin();
+        const auto l_end = local.value().end();
+        auto r = remote.begin();
+        while (l != l_end || r != remote.end()) {
+            if (r == remote.end() || (l != l_end && l->study_uid < r->study_uid)) {
+                auto conflict = make_conflict(l->study_uid,
+                                              sync_conflict_type::missing_remote);
+                conflict.local_instance_count = l->instance_count;
+                conflicts.push_back(std::move(conflict));
+                ++l;
+            } else if (l == l_end || r->study_uid < l->study_uid) {
+                auto conflict = make_conflict(r->study_uid,
+                                              sync_conflict_type::missing_local);
+                conflict.remote_instance_count = r->instance_count;
+                conflicts.push_back(std::move(conflict));
+                ++r;
+            } else {
+                if (l->instance_count != r->instance_count) {
+                    auto conflict = make_conflict(l->study_uid,
+                                                  sync_conflict_type::count_mismatch);
+                    conflict.local_instance_count = l->instance_count;
+                    conflict.remote_instance_count = r->instance_count;
+                    conflicts.push_back(std::move(conflict));
+                }
+                ++l;
+                ++r;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Run a study-level C-FIND against the config's source node
+     */
+    std::optional<std::vector<core::dicom_dataset>> find_remote(
+        const sync_config& cfg,
+        const core::dicom_dataset& query_keys,
+        sync_result& result) {
 
         // Get association for query
         std::vector<std::string> sop_classes = {
             std::string(services::study_root_find_sop_class_uid)
         };
 
+        if (!node_manager) {
+            result.errors.push_back("No remote node manager");
+            return std::nullopt;
+        }
         auto assoc_result = node_manager->acquire_association(
             cfg.source_node_id, sop_classes);
         if (assoc_result.is_err()) {
             result.errors.push_back("Failed to acquire association: " +
                                     assoc_result.error().message);
-            return study_uids;
+            return std::nullopt;
         }
 
         auto assoc = std::move(assoc_result.value());
 
-        // Build query
+        // Execute query
+        services::query_scu_config query_config;
+        query_config.model = services::query_model::study_root;
+        query_config.level = services::query_level::study;
+
+        services::query_scu scu(query_config, logger);
+        auto query_result = scu.find(*assoc, query_keys);
+
+        // Release association
+        node_manager->release_association(cfg.source_node_id, std::move(assoc));
+
+        if (query_result.is_err()) {
+            result.errors.push_back("Query failed: " + query_result.error().message);
+            return std::nullopt;
+        }
+        return std::move(query_result.value().matches);
+    }
+
+    static core::dicom_dataset study_query_keys() {
         core::dicom_dataset query_keys;
         query_keys.set_string(core::tags::query_retrieve_level, encoding::vr_type::CS, "STUDY");
         query_keys.set_string(core::tags::study_instance_uid, encoding::vr_type::UI, "");
+        query_keys.set_string(core::tags::number_of_study_related_instances,
+                              encoding::vr_type::IS, "");
+        return query_keys;
+    }
+
+    std::vector<storage::study_digest_entry> query_remote_studies(
+        const sync_config& cfg,
+        std::chrono::system_clock::time_point since,
+        sync_result& result) {
+
+        // Build query
+        auto query_keys = study_query_keys();
 
         // Apply filters
         if (!cfg.modalities.empty()) {
@@ -505,66 +793,72 @@ struct sync_manager::impl {
 
         // Date range filter
         if (since != std::chrono::system_clock::time_point{}) {
-            auto since_time_t = std::chrono::system_clock::to_time_t(since);
-            std::tm tm_buf;
-#ifdef _WIN32
-            localtime_s(&tm_buf, &since_time_t);
-#else
-            localtime_r(&since_time_t, &tm_buf);
-#endif
-            std::ostringstream date_oss;
-            date_oss << std::put_time(&tm_buf, "%Y%m%d") << "-";
-            query_keys.set_string(core::tags::study_date, encoding::vr_type::DA, date_oss.str());
+            query_keys.set_string(core::tags::study_date, encoding::vr_type::DA,
+                                  format_dicom_date(since) + "-");
         }
 
-        // Execute query
-        services::query_scu_config query_config;
-        query_config.model = services::query_model::study_root;
-        query_config.level = services::query_level::study;
+        auto matches = find_remote(cfg, query_keys, result);
+        if (!matches) {
+            return {};
+        }
+        return parse_study_matches(*matches);
+    }
 
-        services::query_scu scu(query_config, logger);
-        auto query_result = scu.find(*assoc, query_keys);
+    /**
+     * @brief List the studies of one remote bucket with a C-FIND
+     */
+    std::optional<std::vector<storage::study_digest_entry>> query_bucket_studies(
+        const sync_config& cfg,
+        const std::string& bucket_key,
+        sync_result& result) {
 
-        // Release association
-        node_manager->release_association(cfg.source_node_id, std::move(assoc));
+        const auto day = bucket_key.substr(0, 8);
+        const auto modalities = bucket_key.substr(9);
 
-        if (query_result.is_err()) {
-            result.errors.push_back("Query failed: " + query_result.error().message);
-            return study_uids;
-        }
+        auto query_keys = study_query_keys();
+        query_keys.set_string(core::tags::study_date, encoding::vr_type::DA, day);
+        query_keys.set_string(core::tags::modalities_in_study, encoding::vr_type::CS,
+                              modalities);
 
-        const auto& qr = query_result.value();
-        for (const auto& match : qr.matches) {
-            auto uid = match.get_string(core::tags::study_instance_uid);
-            if (!uid.empty()) {
-                study_uids.push_back(uid);
-            }
+        auto matches = find_remote(cfg, query_keys, result);
+        if (!matches) {
+            return std::nullopt;
         }
-
-        return study_uids;
+        return parse_study_matches(*matches, modalities);
     }
 
     std::vector<sync_conflict> compare_with_local(
         const sync_config& cfg,
-        const std::vector<std::string>& remote_study_uids,
+        const std::vector<storage::study_digest_entry>& remote_studies,
+        const storage::index_database* db,
         sync_result& result) {
         (void)result;  // Reserved for future result aggregation
 
         std::vector<sync_conflict> comparison_conflicts;
 
         // For each remote study, check if it exists locally
-        for (const auto& study_uid : remote_study_uids) {
-            // In real implementation, query local database
-            // For now, we'll simulate that all remote studies are missing locally
-            bool exists_locally = false;  // Would check storage index here
-
-            if (!exists_locally) {
-                sync_conflict conflict;
-                conflict.config_id = cfg.config_id;
-                conflict.study_uid = study_uid;
+        for (const auto& remote : remote_studies) {
+            std::optional<storage::study_record> local;
+            if (db) {
+                local = db->find_study(remote.study_uid);
+            }
+
+            sync_conflict conflict;
+            conflict.config_id = cfg.config_id;
+            conflict.study_uid = remote.study_uid;
+            conflict.remote_instance_count = remote.instance_count;
+            conflict.remote_modified = std::chrono::system_clock::now();
+            conflict.detected_at = std::chrono::system_clock::now();
+
+            if (!local) {
+                // Without a local index every remote study is pulled
                 conflict.conflict_type = sync_conflict_type::missing_local;
-                conflict.remote_modified = std::chrono::system_clock::now();
-                conflict.detected_at = std::chrono::system_clock::now();
+                comparison_conflicts.push_back(conflict);
+            } else if (remote.instance_count > 0 &&
+                       static_cast<size_t>(local->num_instances) != remote.instance_count) {
+                conflict.conflict_type = sync_conflict_type::count_mismatch;
+                conflict.local_instance_count =
+                    static_cast<size_t>(local->num_instances);
                 comparison_conflicts.push_back(conflict);
             }
         }
@@ -970,19 +1264,15 @@ sync_result sync_manager::compare(std::string_view config_id) {
 
     const auto& cfg = *config_opt;
 
-    // Query remote studies
+    // Compare with the remote node over the lookback window
     auto sync_start_time = std::chrono::system_clock::now() - cfg.lookback;
-    auto remote_studies = impl_->query_remote_studies(cfg, sync_start_time, result);
+    auto conflicts = impl_->reconcile(cfg, sync_start_time, result);
 
     if (!result.errors.empty()) {
         result.completed_at = std::chrono::system_clock::now();
         return result;
     }
 
-    result.studies_checked = remote_studies.size();
-
-    // Compare with local
-    auto conflicts = impl_->compare_with_local(cfg, remote_studies, result);
     result.conflicts = conflicts;
 
     result.success = true;
@@ -1218,6 +1508,21 @@ void sync_manager::set_conflict_callback(sync_conflict_callback callback) {
     impl_->conflict_callback = std::move(callback);
 }
 
+// =============================================================================
+// Reconciliation
+// =============================================================================
+
+void sync_manager::set_local_database(
+    std::shared_ptr<storage::index_database> database) {
+    std::lock_guard lock(impl_->reconcile_mutex);
+    impl_->local_db = std::move(database);
+}
+
+void sync_manager::set_digest_provider(sync_digest_provider provider) {
+    std::lock_guard lock(impl_->reconcile_mutex);
+    impl_->digest_provider = std::move(provider);
+}
+
 // =============================================================================
 // Configuration
 // =============================================================================
@@ -5,143 +5,251 @@
 /**
  * @file dicom_dictionary.cpp
  * @brief Implementation of dicom_dictionary class
+ *
+ * Standard tags are answered from the constant tables in
+ * standard_tags_data.cpp. Private tags go into an insert-only open
+ * addressing table whose slots are atomic pointers into a deque of entries:
+ * readers probe it without locking, the (mutex-serialized) writer publishes
+ * an entry with a release store once it is complete. When the table passes
+ * half full the writer builds a table twice the size and publishes it with
+ * a single pointer swap; the replaced table is kept alive (chained from the
+ * new one) because readers may still be probing it.
  */
 
 #include "kcenon/pacs/core/dicom_dictionary.h"
 #include "kcenon/pacs/encoding/vr_type.h"
 
 #include <algorithm>
+#include <functional>
 
 namespace kcenon::pacs::core {
 
-// Forward declaration - defined in standard_tags_data.cpp
+// Forward declarations - defined in standard_tags_data.cpp
 extern auto get_standard_tags() -> std::span<const tag_info>;
+extern auto find_standard_tag(dicom_tag tag) noexcept -> const tag_info*;
+extern auto find_standard_keyword(std::string_view keyword) noexcept
+    -> const tag_info*;
+
+namespace {
+
+/// Initial private table capacity (power of two)
+constexpr size_t kInitialPrivateCapacity = 64;
+
+auto tag_slot(dicom_tag tag, size_t mask) noexcept -> size_t {
+    // Murmur3 finalizer spreads group/element bits over the whole word
+    auto x = tag.combined();
+    x ^= x >> 16;
+    x *= 0x85EBCA6BU;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35U;
+    x ^= x >> 16;
+    return x & mask;
+}
+
+auto keyword_slot(std::string_view keyword, size_t mask) noexcept -> size_t {
+    return std::hash<std::string_view>{}(keyword) & mask;
+}
+
+}  // namespace
+
+struct dicom_dictionary::private_table {
+    explicit private_table(size_t capacity)
+        : by_tag(capacity), by_keyword(capacity) {}
+
+    /// Slots keyed by tag, nullptr = empty
+    std::vector<std::atomic<const tag_info*>> by_tag;
+
+    /// Slots keyed by keyword, nullptr = empty
+    std::vector<std::atomic<const tag_info*>> by_keyword;
+
+    /// Table this one replaced, kept for readers still probing it
+    std::unique_ptr<private_table> previous;
+};
 
 auto dicom_dictionary::instance() -> dicom_dictionary& {
     static dicom_dictionary instance;
     return instance;
 }
 
-dicom_dictionary::dicom_dictionary() {
-    initialize_standard_tags();
-}
+dicom_dictionary::dicom_dictionary() = default;
 
-void dicom_dictionary::initialize_standard_tags() {
-    const auto tags = get_standard_tags();
+dicom_dictionary::~dicom_dictionary() = default;
 
-    tag_map_.reserve(tags.size());
-    keyword_map_.reserve(tags.size());
+auto dicom_dictionary::lookup(dicom_tag tag) const noexcept -> const tag_info* {
+    if (!tag.is_private()) {
+        return find_standard_tag(tag);
+    }
 
-    for (const auto& info : tags) {
-        tag_map_.emplace(info.tag, info);
-        if (!info.keyword.empty()) {
-            keyword_map_.emplace(info.keyword, info.tag);
+    const auto* table = private_table_.load(std::memory_order_acquire);
+    if (table == nullptr) {
+        return nullptr;
+    }
+    const auto mask = table->by_tag.size() - 1;
+    for (auto slot = tag_slot(tag, mask);; slot = (slot + 1) & mask) {
+        const auto* entry = table->by_tag[slot].load(std::memory_order_acquire);
+        if (entry == nullptr || entry->tag == tag) {
+            return entry;
         }
     }
+}
+
+auto dicom_dictionary::lookup_keyword(std::string_view keyword) const noexcept
+    -> const tag_info* {
+    if (const auto* info = find_standard_keyword(keyword)) {
+        return info;
+    }
 
-    standard_count_ = tags.size();
+    const auto* table = private_table_.load(std::memory_order_acquire);
+    if (table == nullptr || keyword.empty()) {
+        return nullptr;
+    }
+    const auto mask = table->by_keyword.size() - 1;
+    for (auto slot = keyword_slot(keyword, mask);; slot = (slot + 1) & mask) {
+        const auto* entry =
+            table->by_keyword[slot].load(std::memory_order_acquire);
+        if (entry == nullptr || entry->keyword == keyword) {
+            return entry;
+        }
+    }
 }
 
 auto dicom_dictionary::find(dicom_tag tag) const -> std::optional<tag_info> {
-    std::shared_lock lock(mutex_);
-
-    const auto it = tag_map_.find(tag);
-    if (it != tag_map_.end()) {
-        return it->second;
+    if (const auto* info = lookup(tag)) {
+        return *info;
     }
     return std::nullopt;
 }
 
 auto dicom_dictionary::find_by_keyword(std::string_view keyword) const
     -> std::optional<tag_info> {
-    std::shared_lock lock(mutex_);
-
-    const auto it = keyword_map_.find(keyword);
-    if (it != keyword_map_.end()) {
-        const auto tag_it = tag_map_.find(it->second);
-        if (tag_it != tag_map_.end()) {
-            return tag_it->second;
-        }
+    if (const auto* info = lookup_keyword(keyword)) {
+        return *info;
     }
     return std::nullopt;
 }
 
 auto dicom_dictionary::contains(dicom_tag tag) const -> bool {
-    std::shared_lock lock(mutex_);
-    return tag_map_.contains(tag);
+    return lookup(tag) != nullptr;
 }
 
 auto dicom_dictionary::contains_keyword(std::string_view keyword) const -> bool {
-    std::shared_lock lock(mutex_);
-    return keyword_map_.contains(keyword);
+    return lookup_keyword(keyword) != nullptr;
 }
 
 auto dicom_dictionary::validate_vm(dicom_tag tag, uint32_t count) const -> bool {
-    const auto info = find(tag);
-    if (!info) {
+    const auto* info = lookup(tag);
+    if (info == nullptr) {
         return false;
     }
     return info->vm.is_valid(count);
 }
 
 auto dicom_dictionary::get_vr(dicom_tag tag) const -> uint16_t {
-    const auto info = find(tag);
-    if (!info) {
+    const auto* info = lookup(tag);
+    if (info == nullptr) {
         return 0;
     }
     return info->vr;
 }
 
+void dicom_dictionary::insert_private(private_table& table,
+                                      const tag_info* entry) {
+    const auto mask = table.by_tag.size() - 1;
+    auto slot = tag_slot(entry->tag, mask);
+    while (table.by_tag[slot].load(std::memory_order_relaxed) != nullptr) {
+        slot = (slot + 1) & mask;
+    }
+    table.by_tag[slot].store(entry, std::memory_order_release);
+
+    if (entry->keyword.empty() || find_standard_keyword(entry->keyword)) {
+        return;
+    }
+    // The first registration of a keyword wins, as with the standard set
+    for (slot = keyword_slot(entry->keyword, mask);;
+         slot = (slot + 1) & mask) {
+        const auto* existing =
+            table.by_keyword[slot].load(std::memory_order_relaxed);
+        if (existing == nullptr) {
+            table.by_keyword[slot].store(entry, std::memory_order_release);
+            return;
+        }
+        if (existing->keyword == entry->keyword) {
+            return;
+        }
+    }
+}
+
 auto dicom_dictionary::register_private_tag(const tag_info& info) -> bool {
     // Only allow private tags
     if (!info.tag.is_private()) {
         return false;
     }
 
-    std::unique_lock lock(mutex_);
+    std::lock_guard lock(write_mutex_);
 
     // Check if already exists
-    if (tag_map_.contains(info.tag)) {
+    if (lookup(info.tag) != nullptr) {
         return false;
     }
 
-    tag_map_.emplace(info.tag, info);
-    if (!info.keyword.empty()) {
-        keyword_map_.emplace(info.keyword, info.tag);
+    // Keep the load factor at or below one half so probes stay short
+    const auto count = private_entries_.size() + 1;
+    if (!private_owner_ || count * 2 > private_owner_->by_tag.size()) {
+        auto capacity = private_owner_ ? private_owner_->by_tag.size() * 2
+                                       : kInitialPrivateCapacity;
+        auto grown = std::make_unique<private_table>(capacity);
+        for (const auto& entry : private_entries_) {
+            insert_private(*grown, &entry);
+        }
+        grown->previous = std::move(private_owner_);
+        private_owner_ = std::move(grown);
+        private_table_.store(private_owner_.get(), std::memory_order_release);
     }
 
+    const auto& entry = private_entries_.emplace_back(info);
+    insert_private(*private_owner_, &entry);
+    private_count_.fetch_add(1, std::memory_order_relaxed);
+
     return true;
 }
 
 auto dicom_dictionary::size() const -> size_t {
-    std::shared_lock lock(mutex_);
-    return tag_map_.size();
+    return standard_tag_count() + private_tag_count();
 }
 
 auto dicom_dictionary::standard_tag_count() const -> size_t {
-    return standard_count_;
+    return get_standard_tags().size();
 }
 
 auto dicom_dictionary::private_tag_count() const -> size_t {
-    std::shared_lock lock(mutex_);
-    return tag_map_.size() - standard_count_;
+    return private_count_.load(std::memory_order_relaxed);
 }
 
 auto dicom_dictionary::get_tags_in_group(uint16_t group) const
     -> std::vector<tag_info> {
-    std::shared_lock lock(mutex_);
-
     std::vector<tag_info> result;
-    for (const auto& [tag, info] : tag_map_) {
-        if (tag.group() == group) {
-            result.push_back(info);
-        }
+
+    // Standard tags are sorted by tag
+    const auto tags = get_standard_tags();
+    const auto first = std::lower_bound(
+        tags.begin(), tags.end(), group,
+        [](const tag_info& info, uint16_t g) { return info.tag.group() < g; });
+    for (auto it = first; it != tags.end() && it->tag.group() == group; ++it) {
+        result.push_back(*it);
     }
 
-    std::sort(result.begin(), result.end(),
-              [](const auto& a, const auto& b) {
-                  return a.tag < b.tag;
-              });
+    if ((group & 1) != 0) {
+        std::lock_guard lock(write_mutex_);
+        for (const auto& info : private_entries_) {
+            if (info.tag.group() == group) {
+                result.push_back(info);
+            }
+        }
+        std::sort(result.begin(), result.end(),
+                  [](const auto& a, const auto& b) {
+                      return a.tag < b.tag;
+                  });
+    }
 
     return result;
 }
@@ -13,6 +13,8 @@
 #include "kcenon/pacs/core/memory_mapped_file.h"
 #include "kcenon/pacs/core/private_tag_registry.h"
 #include "kcenon/pacs/encoding/compression/codec_factory.h"
+#include "kcenon/pacs/encoding/dataset_encoder.h"
+#include "kcenon/pacs/encoding/explicit_vr_big_endian_codec.h"
 
 #include <algorithm>
 #include <cstring>
@@ -71,40 +73,43 @@ constexpr uint16_t kSequenceDelimitationElement = 0xE0DD;
            (static_cast<uint32_t>(data[0]) << 24);
 }
 
-/**
- * @brief Write a 16-bit unsigned integer as little-endian bytes
- */
-void write_uint16_le(std::vector<uint8_t>& buffer, uint16_t value) {
-    buffer.push_back(static_cast<uint8_t>(value & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-}
+/// File Meta Information is always Explicit VR Little Endian
+constexpr encoding::encoder_options kMetaEncoding{
+    encoding::vr_encoding::explicit_vr, encoding::byte_order::little_endian,
+    true};
 
 /**
- * @brief Write a 32-bit unsigned integer as little-endian bytes
+ * @brief Encoder options for the main dataset of a Part 10 file
+ *
+ * Encapsulated Pixel Data keeps its raw item stream and is written with
+ * undefined length.
  */
-void write_uint32_le(std::vector<uint8_t>& buffer, uint32_t value) {
-    buffer.push_back(static_cast<uint8_t>(value & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 16) & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 24) & 0xFF));
+[[nodiscard]] auto dataset_encoding(const encoding::transfer_syntax& ts)
+    -> encoding::encoder_options {
+    return {ts.vr_type(), ts.endianness(), true};
 }
 
 /**
- * @brief Write a 16-bit unsigned integer as big-endian bytes
+ * @brief Open a file for writing and stream encoded bytes into it
  */
-void write_uint16_be(std::vector<uint8_t>& buffer, uint16_t value) {
-    buffer.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-    buffer.push_back(static_cast<uint8_t>(value & 0xFF));
-}
+template <typename Write>
+[[nodiscard]] auto write_file(const std::filesystem::path& path, Write&& write)
+    -> kcenon::pacs::VoidResult {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        return kcenon::pacs::pacs_void_error(
+            kcenon::pacs::error_codes::file_write_error,
+            "Failed to open file for writing: " + path.string());
+    }
 
-/**
- * @brief Write a 32-bit unsigned integer as big-endian bytes
- */
-void write_uint32_be(std::vector<uint8_t>& buffer, uint32_t value) {
-    buffer.push_back(static_cast<uint8_t>((value >> 24) & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 16) & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-    buffer.push_back(static_cast<uint8_t>(value & 0xFF));
+    encoding::ostream_sink sink(file);
+    if (write(sink).is_err() || !file.flush()) {
+        return kcenon::pacs::pacs_void_error(
+            kcenon::pacs::error_codes::file_write_error,
+            "Failed to write to file: " + path.string());
+    }
+
+    return kcenon::pacs::ok();
 }
 
 /**
@@ -165,9 +170,30 @@ auto dicom_file::open(const std::filesystem::path& path)
 
 auto dicom_file::from_bytes(std::span<const uint8_t> data)
     -> kcenon::pacs::Result<dicom_file> {
+    auto header_result = read_header(data);
+    if (header_result.is_err()) {
+        return kcenon::pacs::Result<dicom_file>::err(header_result.error());
+    }
+    auto& header = header_result.value();
+
+    // Parse main dataset using appropriate decoder based on Transfer Syntax
+    size_t dataset_bytes_read = 0;
+    auto dataset_result = decode_dataset(data.subspan(header.dataset_offset),
+                                         header.transfer_syntax,
+                                         dataset_bytes_read);
+    if (dataset_result.is_err()) {
+        return kcenon::pacs::Result<dicom_file>::err(dataset_result.error());
+    }
+
+    return kcenon::pacs::Result<dicom_file>::ok(
+        dicom_file{std::move(header.meta_info), std::move(dataset_result.value())});
+}
+
+auto dicom_file::read_header(std::span<const uint8_t> data)
+    -> kcenon::pacs::Result<part10_header> {
     // Minimum size: 128 (preamble) + 4 (DICM) + minimal meta info
     if (data.size() < kPreambleSize + 4) {
-        return kcenon::pacs::pacs_error<dicom_file>(
+        return kcenon::pacs::pacs_error<part10_header>(
             kcenon::pacs::error_codes::invalid_dicom_file,
             "File too small to be valid DICOM Part 10 file");
     }
@@ -175,7 +201,7 @@ auto dicom_file::from_bytes(std::span<const uint8_t> data)
     // Check for DICM prefix at offset 128
     const auto prefix = data.subspan(kPreambleSize, 4);
     if (std::memcmp(prefix.data(), kDicmPrefix, 4) != 0) {
-        return kcenon::pacs::pacs_error<dicom_file>(
+        return kcenon::pacs::pacs_error<part10_header>(
             kcenon::pacs::error_codes::missing_dicm_prefix,
             "Missing DICM prefix at offset 128");
     }
@@ -186,20 +212,20 @@ auto dicom_file::from_bytes(std::span<const uint8_t> data)
 
     auto meta_result = parse_meta_information(meta_start, meta_bytes_read);
     if (meta_result.is_err()) {
-        return kcenon::pacs::Result<dicom_file>::err(meta_result.error());
+        return kcenon::pacs::Result<part10_header>::err(meta_result.error());
     }
 
     // Extract Transfer Syntax from meta information
     const auto* ts_elem = meta_result.value().get(tags::transfer_syntax_uid);
     if (ts_elem == nullptr) {
-        return kcenon::pacs::pacs_error<dicom_file>(
+        return kcenon::pacs::pacs_error<part10_header>(
             kcenon::pacs::error_codes::missing_transfer_syntax,
             "Transfer Syntax UID not found in meta information");
     }
 
     auto ts_uid_result = ts_elem->as_string();
     if (ts_uid_result.is_err()) {
-        return kcenon::pacs::pacs_error<dicom_file>(
+        return kcenon::pacs::pacs_error<part10_header>(
             kcenon::pacs::error_codes::value_conversion_error,
             "Failed to read Transfer Syntax UID");
     }
@@ -207,22 +233,14 @@ auto dicom_file::from_bytes(std::span<const uint8_t> data)
     encoding::transfer_syntax ts{ts_uid};
 
     if (!ts.is_valid()) {
-        return kcenon::pacs::pacs_error<dicom_file>(
+        return kcenon::pacs::pacs_error<part10_header>(
             kcenon::pacs::error_codes::unsupported_transfer_syntax,
             "Unsupported Transfer Syntax: " + ts_uid);
     }
 
-    // Parse main dataset using appropriate decoder based on Transfer Syntax
-    const auto dataset_start = meta_start.subspan(meta_bytes_read);
-    size_t dataset_bytes_read = 0;
-
-    auto dataset_result = decode_dataset(dataset_start, ts, dataset_bytes_read);
-    if (dataset_result.is_err()) {
-        return kcenon::pacs::Result<dicom_file>::err(dataset_result.error());
-    }
-
-    return kcenon::pacs::Result<dicom_file>::ok(
-        dicom_file{std::move(meta_result.value()), std::move(dataset_result.value())});
+    return kcenon::pacs::Result<part10_header>::ok(part10_header{
+        std::move(meta_result.value()), std::move(ts),
+        kPreambleSize + 4 + meta_bytes_read});
 }
 
 // ============================================================================
@@ -242,45 +260,50 @@ auto dicom_file::create(dicom_dataset dataset,
 
 auto dicom_file::save(const std::filesystem::path& path) const
     -> kcenon::pacs::VoidResult {
-    auto bytes = to_bytes();
+    return write_file(path, [this](encoding::byte_sink& sink) {
+        return write_to(sink);
+    });
+}
 
-    std::ofstream file(path, std::ios::binary);
-    if (!file) {
-        return kcenon::pacs::pacs_void_error(
-            kcenon::pacs::error_codes::file_write_error,
-            "Failed to open file for writing: " + path.string());
-    }
+auto dicom_file::save_dataset(const std::filesystem::path& path,
+                              const dicom_dataset& dataset,
+                              const encoding::transfer_syntax& ts)
+    -> kcenon::pacs::VoidResult {
+    const auto meta_info = generate_meta_information(dataset, ts);
+    return write_file(path, [&](encoding::byte_sink& sink) {
+        return write_part10(sink, meta_info, dataset, ts);
+    });
+}
 
-    if (!file.write(reinterpret_cast<const char*>(bytes.data()),
-                    static_cast<std::streamsize>(bytes.size()))) {
-        return kcenon::pacs::pacs_void_error(
-            kcenon::pacs::error_codes::file_write_error,
-            "Failed to write to file: " + path.string());
-    }
+auto dicom_file::write_dataset(encoding::byte_sink& sink,
+                               const dicom_dataset& dataset,
+                               const encoding::transfer_syntax& ts)
+    -> kcenon::pacs::VoidResult {
+    return write_part10(sink, generate_meta_information(dataset, ts), dataset, ts);
+}
 
-    return kcenon::pacs::ok();
+auto dicom_file::write_to(encoding::byte_sink& sink) const
+    -> kcenon::pacs::VoidResult {
+    return write_part10(sink, meta_info_, dataset_, transfer_syntax());
 }
 
 auto dicom_file::to_bytes() const -> std::vector<uint8_t> {
-    std::vector<uint8_t> result;
+    const auto ts = transfer_syntax();
+    const encoding::dataset_encoder meta_encoder(kMetaEncoding);
+    const encoding::dataset_encoder dataset_encoder(dataset_encoding(ts));
 
-    // Reserve estimated size
-    result.reserve(kPreambleSize + 4 + 512 + 65536);
+    std::vector<uint8_t> result;
+    result.reserve(kPreambleSize + sizeof(kDicmPrefix) +
+                   meta_encoder.encoded_size(meta_info_) +
+                   dataset_encoder.encoded_size(dataset_));
 
-    // Write 128-byte preamble (zeros)
+    // Write 128-byte preamble (zeros) and DICM prefix
     result.resize(kPreambleSize, 0);
-
-    // Write DICM prefix
     result.insert(result.end(), std::begin(kDicmPrefix), std::end(kDicmPrefix));
 
-    // Encode and write File Meta Information (always Explicit VR LE)
-    auto meta_bytes = encode_explicit_vr_le(meta_info_);
-    result.insert(result.end(), meta_bytes.begin(), meta_bytes.end());
-
-    // Encode and write main dataset using appropriate Transfer Syntax
-    auto ts = transfer_syntax();
-    auto dataset_bytes = encode_dataset(dataset_, ts);
-    result.insert(result.end(), dataset_bytes.begin(), dataset_bytes.end());
+    // File Meta Information, then the main dataset in its Transfer Syntax
+    meta_encoder.encode_append(meta_info_, result);
+    dataset_encoder.encode_append(dataset_, result);
 
     return result;
 }
@@ -462,39 +485,26 @@ auto dicom_file::generate_meta_information(const dicom_dataset& dataset,
     return meta_info;
 }
 
-auto dicom_file::encode_explicit_vr_le(const dicom_dataset& dataset)
-    -> std::vector<uint8_t> {
-    std::vector<uint8_t> result;
-    result.reserve(65536);  // Initial estimate
-
-    for (const auto& [tag, element] : dataset) {
-        // Write tag (4 bytes, little-endian)
-        write_uint16_le(result, tag.group());
-        write_uint16_le(result, tag.element());
-
-        // Write VR (2 bytes)
-        const auto vr_str = encoding::to_string(element.vr());
-        result.push_back(static_cast<uint8_t>(vr_str[0]));
-        result.push_back(static_cast<uint8_t>(vr_str[1]));
-
-        const auto& raw_data = element.raw_data();
-        const auto length = static_cast<uint32_t>(raw_data.size());
-
-        if (encoding::has_explicit_32bit_length(element.vr())) {
-            // 2 reserved bytes + 4 byte length
-            result.push_back(0x00);
-            result.push_back(0x00);
-            write_uint32_le(result, length);
-        } else {
-            // 2 byte length
-            write_uint16_le(result, static_cast<uint16_t>(length));
-        }
+auto dicom_file::write_part10(encoding::byte_sink& sink,
+                              const dicom_dataset& meta_info,
+                              const dicom_dataset& dataset,
+                              const encoding::transfer_syntax& ts)
+    -> kcenon::pacs::VoidResult {
+    uint8_t header[kPreambleSize + sizeof(kDicmPrefix)] = {};
+    std::copy(std::begin(kDicmPrefix), std::end(kDicmPrefix),
+              header + kPreambleSize);
 
-        // Write value
-        result.insert(result.end(), raw_data.begin(), raw_data.end());
+    auto result = sink.write(header);
+    if (result.is_err()) {
+        return result;
     }
 
-    return result;
+    result = encoding::dataset_encoder(kMetaEncoding).encode(meta_info, sink);
+    if (result.is_err()) {
+        return result;
+    }
+
+    return encoding::dataset_encoder(dataset_encoding(ts)).encode(dataset, sink);
 }
 
 auto dicom_file::decode_explicit_vr_le(std::span<const uint8_t> data,
@@ -652,14 +662,11 @@ auto dicom_file::decode_implicit_vr_le(std::span<const uint8_t> data,
         uint32_t length = read_uint32_le(data.subspan(offset + 4, 4));
 
         // Look up VR from dictionary
-        auto tag_info = dict.find(tag);
+        const auto* tag_info = dict.lookup(tag);
         encoding::vr_type vr = encoding::vr_type::UN;
-        if (tag_info) {
-            auto vr_opt = encoding::from_string(
-                encoding::to_string(static_cast<encoding::vr_type>(tag_info->vr)));
-            if (vr_opt) {
-                vr = *vr_opt;
-            }
+        if (tag_info != nullptr &&
+            encoding::to_string(static_cast<encoding::vr_type>(tag_info->vr)) != "??") {
+            vr = static_cast<encoding::vr_type>(tag_info->vr);
         }
 
         // For private data elements without dictionary entry, try creator-based lookup
@@ -874,31 +881,9 @@ auto dicom_file::decode_explicit_vr_be(std::span<const uint8_t> data,
             break;
         }
 
-        // Read value - need to swap bytes for numeric types
-        const auto value_data = data.subspan(offset + header_size, length);
-        std::vector<uint8_t> swapped_data(value_data.begin(), value_data.end());
-
-        // Swap bytes for numeric VRs
-        if (encoding::is_numeric_vr(vr)) {
-            const size_t element_size = encoding::fixed_length(vr);
-            if (element_size == 2) {
-                for (size_t i = 0; i + 1 < swapped_data.size(); i += 2) {
-                    std::swap(swapped_data[i], swapped_data[i + 1]);
-                }
-            } else if (element_size == 4) {
-                for (size_t i = 0; i + 3 < swapped_data.size(); i += 4) {
-                    std::swap(swapped_data[i], swapped_data[i + 3]);
-                    std::swap(swapped_data[i + 1], swapped_data[i + 2]);
-                }
-            } else if (element_size == 8) {
-                for (size_t i = 0; i + 7 < swapped_data.size(); i += 8) {
-                    std::swap(swapped_data[i], swapped_data[i + 7]);
-                    std::swap(swapped_data[i + 1], swapped_data[i + 6]);
-                    std::swap(swapped_data[i + 2], swapped_data[i + 5]);
-                    std::swap(swapped_data[i + 3], swapped_data[i + 4]);
-                }
-            }
-        }
+        // Read value, converting word/long ordered VRs to little-endian
+        const auto swapped_data = encoding::explicit_vr_big_endian_codec::from_big_endian(
+            vr, data.subspan(offset + header_size, length));
 
         dicom_element elem{tag, vr, std::span<const uint8_t>(swapped_data)};
         dataset.insert(std::move(elem));
@@ -910,86 +895,6 @@ auto dicom_file::decode_explicit_vr_be(std::span<const uint8_t> data,
     return kcenon::pacs::Result<dicom_dataset>::ok(std::move(dataset));
 }
 
-auto dicom_file::encode_implicit_vr_le(const dicom_dataset& dataset)
-    -> std::vector<uint8_t> {
-    std::vector<uint8_t> result;
-    result.reserve(65536);
-
-    for (const auto& [tag, element] : dataset) {
-        // Write tag (4 bytes, little-endian)
-        write_uint16_le(result, tag.group());
-        write_uint16_le(result, tag.element());
-
-        // Write length (4 bytes in Implicit VR)
-        const auto& raw_data = element.raw_data();
-        write_uint32_le(result, static_cast<uint32_t>(raw_data.size()));
-
-        // Write value
-        result.insert(result.end(), raw_data.begin(), raw_data.end());
-    }
-
-    return result;
-}
-
-auto dicom_file::encode_explicit_vr_be(const dicom_dataset& dataset)
-    -> std::vector<uint8_t> {
-    std::vector<uint8_t> result;
-    result.reserve(65536);
-
-    for (const auto& [tag, element] : dataset) {
-        // Write tag (4 bytes, big-endian)
-        write_uint16_be(result, tag.group());
-        write_uint16_be(result, tag.element());
-
-        // Write VR (2 bytes ASCII)
-        const auto vr_str = encoding::to_string(element.vr());
-        result.push_back(static_cast<uint8_t>(vr_str[0]));
-        result.push_back(static_cast<uint8_t>(vr_str[1]));
-
-        const auto& raw_data = element.raw_data();
-        const auto length = static_cast<uint32_t>(raw_data.size());
-
-        if (encoding::has_explicit_32bit_length(element.vr())) {
-            // 2 reserved bytes + 4 byte length (big-endian)
-            result.push_back(0x00);
-            result.push_back(0x00);
-            write_uint32_be(result, length);
-        } else {
-            // 2 byte length (big-endian)
-            write_uint16_be(result, static_cast<uint16_t>(length));
-        }
-
-        // Write value - swap bytes for numeric types
-        if (encoding::is_numeric_vr(element.vr())) {
-            const size_t element_size = encoding::fixed_length(element.vr());
-            std::vector<uint8_t> swapped_data(raw_data.begin(), raw_data.end());
-
-            if (element_size == 2) {
-                for (size_t i = 0; i + 1 < swapped_data.size(); i += 2) {
-                    std::swap(swapped_data[i], swapped_data[i + 1]);
-                }
-            } else if (element_size == 4) {
-                for (size_t i = 0; i + 3 < swapped_data.size(); i += 4) {
-                    std::swap(swapped_data[i], swapped_data[i + 3]);
-                    std::swap(swapped_data[i + 1], swapped_data[i + 2]);
-                }
-            } else if (element_size == 8) {
-                for (size_t i = 0; i + 7 < swapped_data.size(); i += 8) {
-                    std::swap(swapped_data[i], swapped_data[i + 7]);
-                    std::swap(swapped_data[i + 1], swapped_data[i + 6]);
-                    std::swap(swapped_data[i + 2], swapped_data[i + 5]);
-                    std::swap(swapped_data[i + 3], swapped_data[i + 4]);
-                }
-            }
-            result.insert(result.end(), swapped_data.begin(), swapped_data.end());
-        } else {
-            result.insert(result.end(), raw_data.begin(), raw_data.end());
-        }
-    }
-
-    return result;
-}
-
 auto dicom_file::decode_dataset(std::span<const uint8_t> data,
                                 const encoding::transfer_syntax& ts,
                                 size_t& bytes_read)
@@ -1012,23 +917,6 @@ auto dicom_file::decode_dataset(std::span<const uint8_t> data,
     return decode_explicit_vr_le(data, bytes_read);
 }
 
-auto dicom_file::encode_dataset(const dicom_dataset& dataset,
-                                const encoding::transfer_syntax& ts)
-    -> std::vector<uint8_t> {
-
-    // Route to appropriate encoder based on Transfer Syntax properties
-    if (ts.vr_type() == encoding::vr_encoding::implicit) {
-        return encode_implicit_vr_le(dataset);
-    }
-
-    if (ts.endianness() == encoding::byte_order::big_endian) {
-        return encode_explicit_vr_be(dataset);
-    }
-
-    // Explicit VR Little Endian (default)
-    return encode_explicit_vr_le(dataset);
-}
-
 auto dicom_file::parse_undefined_length_sequence(
     std::span<const uint8_t> data, size_t& bytes_read,
     bool explicit_vr, bool big_endian)
@@ -0,0 +1,817 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file frame_index.cpp
+ * @brief Implementation of the Pixel Data frame index
+ */
+
+#include "kcenon/pacs/core/frame_index.h"
+
+#include <kcenon/pacs/encoding/transfer_syntax.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace kcenon::pacs::core {
+
+namespace {
+
+constexpr uint32_t kUndefinedLength = 0xFFFFFFFF;
+constexpr uint16_t kItemGroup = 0xFFFE;
+constexpr uint16_t kItemElement = 0xE000;
+constexpr uint16_t kItemDelimitationElement = 0xE00D;
+constexpr uint16_t kSequenceDelimitationElement = 0xE0DD;
+constexpr size_t kItemHeaderSize = 8;
+constexpr size_t kPreambleSize = 128;
+
+/// Maximum sequence nesting accepted while walking element headers
+constexpr int kMaxNestingDepth = 64;
+
+/// Sidecar file layout identifier and version
+constexpr char kSidecarMagic[4] = {'P', 'F', 'I', 'X'};
+constexpr uint32_t kSidecarVersion = 1;
+
+constexpr std::string_view kImplicitVrLittleEndian = "1.2.840.10008.1.2";
+
+auto read_le16(const uint8_t* p) -> uint16_t {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+auto read_le32(const uint8_t* p) -> uint32_t {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+auto read_le64(const uint8_t* p) -> uint64_t {
+    return static_cast<uint64_t>(read_le32(p)) |
+           (static_cast<uint64_t>(read_le32(p + 4)) << 32);
+}
+
+void append_le32(std::vector<uint8_t>& out, uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+}
+
+void append_le64(std::vector<uint8_t>& out, uint64_t v) {
+    append_le32(out, static_cast<uint32_t>(v));
+    append_le32(out, static_cast<uint32_t>(v >> 32));
+}
+
+/// Strip trailing NUL and space padding from a string value
+auto trim_value(std::span<const uint8_t> value) -> std::string {
+    std::string s(value.begin(), value.end());
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\0')) {
+        s.pop_back();
+    }
+    while (!s.empty() && s.front() == ' ') {
+        s.erase(s.begin());
+    }
+    return s;
+}
+
+/// VRs that use the 4-byte length form in Explicit VR encoding
+auto has_long_length(char a, char b) -> bool {
+    static constexpr const char* kLongVrs[] = {
+        "OB", "OD", "OF", "OL", "OV", "OW", "SQ", "SV", "UC", "UN", "UR", "UT", "UV"};
+    return std::any_of(std::begin(kLongVrs), std::end(kLongVrs),
+                       [a, b](const char* vr) { return vr[0] == a && vr[1] == b; });
+}
+
+struct element_header {
+    uint16_t group{0};
+    uint16_t element{0};
+    char vr[2]{0, 0};
+    uint32_t length{0};
+    size_t value_offset{0};
+};
+
+/**
+ * @brief Read an element (or item) header at pos
+ */
+auto read_header(std::span<const uint8_t> data, size_t pos, bool implicit)
+    -> std::optional<element_header> {
+    if (pos + 8 > data.size()) {
+        return std::nullopt;
+    }
+    element_header h;
+    h.group = read_le16(data.data() + pos);
+    h.element = read_le16(data.data() + pos + 2);
+
+    if (h.group == kItemGroup || implicit) {
+        h.length = read_le32(data.data() + pos + 4);
+        h.value_offset = pos + 8;
+        return h;
+    }
+
+    h.vr[0] = static_cast<char>(data[pos + 4]);
+    h.vr[1] = static_cast<char>(data[pos + 5]);
+    if (has_long_length(h.vr[0], h.vr[1])) {
+        if (pos + 12 > data.size()) {
+            return std::nullopt;
+        }
+        h.length = read_le32(data.data() + pos + 8);
+        h.value_offset = pos + 12;
+    } else {
+        h.length = read_le16(data.data() + pos + 6);
+        h.value_offset = pos + 8;
+    }
+    return h;
+}
+
+/**
+ * @brief Top-level attributes collected while looking for Pixel Data
+ */
+struct walk_state {
+    std::span<const uint8_t> data;
+
+    uint16_t rows{0};
+    uint16_t columns{0};
+    uint16_t bits_allocated{0};
+    uint16_t samples_per_pixel{1};
+    uint32_t number_of_frames{1};
+    std::vector<uint64_t> extended_offsets;
+    std::vector<uint64_t> extended_lengths;
+
+    bool pixel_found{false};
+    size_t pixel_offset{0};
+    uint32_t pixel_length{0};
+};
+
+void capture(walk_state& s, const element_header& h) {
+    const auto value = s.data.subspan(h.value_offset, h.length);
+    const uint32_t tag = (static_cast<uint32_t>(h.group) << 16) | h.element;
+
+    auto read_us = [&value]() -> uint16_t {
+        return value.size() >= 2 ? read_le16(value.data()) : 0;
+    };
+    auto read_ov = [&value]() {
+        std::vector<uint64_t> out(value.size() / 8);
+        for (size_t i = 0; i < out.size(); ++i) {
+            out[i] = read_le64(value.data() + i * 8);
+        }
+        return out;
+    };
+
+    switch (tag) {
+        case 0x00280002: s.samples_per_pixel = read_us(); break;
+        case 0x00280010: s.rows = read_us(); break;
+        case 0x00280011: s.columns = read_us(); break;
+        case 0x00280100: s.bits_allocated = read_us(); break;
+        case 0x00280008: {
+            try {
+                const auto n = std::stol(trim_value(value));
+                if (n > 0) {
+                    s.number_of_frames = static_cast<uint32_t>(n);
+                }
+            } catch (...) {
+                // Keep single frame for malformed values
+            }
+            break;
+        }
+        case 0x7FE00001: s.extended_offsets = read_ov(); break;
+        case 0x7FE00002: s.extended_lengths = read_ov(); break;
+        default: break;
+    }
+}
+
+auto walk_elements(walk_state& s, size_t pos, bool implicit, int depth)
+    -> std::optional<size_t>;
+
+/**
+ * @brief Skip the items of an undefined-length sequence
+ * @return Position after the Sequence Delimitation Item
+ */
+auto skip_sequence(walk_state& s, size_t pos, bool implicit, int depth)
+    -> std::optional<size_t> {
+    while (true) {
+        auto h = read_header(s.data, pos, true);
+        if (!h || h->group != kItemGroup) {
+            return std::nullopt;
+        }
+        if (h->element == kSequenceDelimitationElement) {
+            return h->value_offset;
+        }
+        if (h->element != kItemElement) {
+            return std::nullopt;
+        }
+        if (h->length == kUndefinedLength) {
+            auto end = walk_elements(s, h->value_offset, implicit, depth + 1);
+            if (!end) {
+                return std::nullopt;
+            }
+            pos = *end;
+        } else {
+            if (h->value_offset + h->length > s.data.size()) {
+                return std::nullopt;
+            }
+            pos = h->value_offset + h->length;
+        }
+    }
+}
+
+/**
+ * @brief Walk element headers
+ *
+ * At depth 0 the walk stops at Pixel Data (or end of data) and returns its
+ * position. Nested walks stop after the Item Delimitation Item.
+ */
+auto walk_elements(walk_state& s, size_t pos, bool implicit, int depth)
+    -> std::optional<size_t> {
+    if (depth > kMaxNestingDepth) {
+        return std::nullopt;
+    }
+    const bool nested = depth > 0;
+
+    while (pos < s.data.size()) {
+        auto h = read_header(s.data, pos, implicit);
+        if (!h) {
+            return nested ? std::nullopt : std::optional<size_t>(pos);
+        }
+
+        if (nested && h->group == kItemGroup && h->element == kItemDelimitationElement) {
+            return h->value_offset;
+        }
+        if (!nested && h->group == 0x7FE0 && h->element == 0x0010) {
+            s.pixel_found = true;
+            s.pixel_offset = h->value_offset;
+            s.pixel_length = h->length;
+            return pos;
+        }
+
+        if (h->length == kUndefinedLength) {
+            // UN with undefined length is encoded as Implicit VR (PS3.5 6.2.2)
+            const bool inner_implicit =
+                implicit || (h->vr[0] == 'U' && h->vr[1] == 'N');
+            auto end = skip_sequence(s, h->value_offset, inner_implicit, depth);
+            if (!end) {
+                return std::nullopt;
+            }
+            pos = *end;
+            continue;
+        }
+
+        if (h->value_offset + h->length > s.data.size()) {
+            return std::nullopt;
+        }
+        if (!nested) {
+            capture(s, *h);
+        }
+        pos = h->value_offset + h->length;
+    }
+    return nested ? std::nullopt : std::optional<size_t>(pos);
+}
+
+/**
+ * @brief Parse the File Meta Information of a Part 10 buffer
+ *
+ * @return Transfer Syntax UID and offset of the first dataset element, or
+ *         error for deflated and big endian syntaxes (not walkable in place)
+ */
+auto read_meta(std::span<const uint8_t> data, const std::string& source)
+    -> kcenon::pacs::Result<std::pair<std::string, size_t>> {
+    using meta_result = std::pair<std::string, size_t>;
+
+    if (data.size() < kPreambleSize + 4 ||
+        std::memcmp(data.data() + kPreambleSize, "DICM", 4) != 0) {
+        return kcenon::pacs::pacs_error<meta_result>(
+            kcenon::pacs::error_codes::missing_dicm_prefix,
+            "Not a DICOM Part 10 file: " + source);
+    }
+
+    // File Meta Information is always Explicit VR Little Endian
+    std::string ts_uid;
+    size_t pos = kPreambleSize + 4;
+    while (true) {
+        auto h = read_header(data, pos, false);
+        if (!h || h->group != 0x0002) {
+            break;
+        }
+        if (h->value_offset + h->length > data.size()) {
+            return kcenon::pacs::pacs_error<meta_result>(
+                kcenon::pacs::error_codes::invalid_meta_info,
+                "Truncated File Meta Information");
+        }
+        if (h->element == 0x0010) {
+            ts_uid = trim_value(data.subspan(h->value_offset, h->length));
+        }
+        pos = h->value_offset + h->length;
+    }
+
+    if (ts_uid.empty()) {
+        return kcenon::pacs::pacs_error<meta_result>(
+            kcenon::pacs::error_codes::missing_transfer_syntax,
+            "File Meta Information has no Transfer Syntax UID");
+    }
+    if (auto ts = encoding::find_transfer_syntax(ts_uid);
+        ts && (ts->is_deflated() ||
+               ts->endianness() == encoding::byte_order::big_endian)) {
+        return kcenon::pacs::pacs_error<meta_result>(
+            kcenon::pacs::error_codes::unsupported_transfer_syntax,
+            "Frame index does not support " + ts_uid);
+    }
+    return kcenon::pacs::Result<meta_result>::ok(meta_result{std::move(ts_uid), pos});
+}
+
+/// Check whether a JPEG family codestream ends inside this fragment
+auto ends_with_end_marker(std::span<const uint8_t> fragment) -> bool {
+    size_t end = fragment.size();
+    if (end >= 1 && fragment[end - 1] == 0x00) {
+        --end;
+    }
+    return end >= 2 && fragment[end - 2] == 0xFF && fragment[end - 1] == 0xD9;
+}
+
+}  // namespace
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+auto frame_index::from_encapsulated(std::span<const uint8_t> value,
+                                    uint32_t number_of_frames,
+                                    uint64_t base_offset,
+                                    std::span<const uint64_t> extended_offsets,
+                                    std::span<const uint64_t> extended_lengths)
+    -> kcenon::pacs::Result<frame_index> {
+    if (number_of_frames == 0) {
+        number_of_frames = 1;
+    }
+
+    auto fail = [](const std::string& message) {
+        return kcenon::pacs::pacs_error<frame_index>(
+            kcenon::pacs::error_codes::decompression_error, message);
+    };
+
+    // Basic Offset Table item
+    if (value.size() < kItemHeaderSize || read_le16(value.data()) != kItemGroup ||
+        read_le16(value.data() + 2) != kItemElement) {
+        return fail("Encapsulated pixel data does not start with a Basic Offset Table item");
+    }
+    const uint32_t bot_length = read_le32(value.data() + 4);
+    if (kItemHeaderSize + static_cast<uint64_t>(bot_length) > value.size() ||
+        bot_length % 4 != 0) {
+        return fail("Invalid Basic Offset Table length");
+    }
+
+    // Fragment items; item_offsets are relative to the first fragment item
+    const size_t first_fragment = kItemHeaderSize + bot_length;
+    std::vector<uint64_t> item_offsets;
+    std::vector<fragment_range> fragments;
+    size_t pos = first_fragment;
+    while (pos + kItemHeaderSize <= value.size()) {
+        const uint16_t group = read_le16(value.data() + pos);
+        const uint16_t element = read_le16(value.data() + pos + 2);
+        if (group == kItemGroup && element == kSequenceDelimitationElement) {
+            break;
+        }
+        if (group != kItemGroup || element != kItemElement) {
+            return fail("Unexpected tag inside encapsulated pixel data");
+        }
+        const uint32_t length = read_le32(value.data() + pos + 4);
+        if (pos + kItemHeaderSize + static_cast<uint64_t>(length) > value.size()) {
+            return fail("Fragment length exceeds pixel data size");
+        }
+        item_offsets.push_back(pos - first_fragment);
+        fragments.push_back(fragment_range{pos + kItemHeaderSize, length});
+        pos += kItemHeaderSize + length;
+    }
+    if (fragments.empty()) {
+        return fail("Encapsulated pixel data contains no fragments");
+    }
+
+    // Frame start offsets: Extended Offset Table, then Basic Offset Table
+    std::vector<uint64_t> offsets;
+    if (extended_offsets.size() == number_of_frames &&
+        (extended_lengths.empty() || extended_lengths.size() == number_of_frames)) {
+        offsets.assign(extended_offsets.begin(), extended_offsets.end());
+    } else if (bot_length / 4 == number_of_frames) {
+        offsets.reserve(number_of_frames);
+        for (uint32_t i = 0; i < bot_length; i += 4) {
+            offsets.push_back(read_le32(value.data() + kItemHeaderSize + i));
+        }
+    }
+
+    frame_index index;
+    index.encapsulated_ = true;
+    index.frame_begin_.reserve(number_of_frames + 1);
+
+    if (!offsets.empty()) {
+        size_t frag = 0;
+        for (uint32_t f = 0; f < number_of_frames; ++f) {
+            // Frames must start exactly on a fragment boundary
+            while (frag < item_offsets.size() && item_offsets[frag] < offsets[f]) {
+                ++frag;
+            }
+            if (frag >= item_offsets.size() || item_offsets[frag] != offsets[f]) {
+                return fail("Offset table entry " + std::to_string(f + 1) +
+                            " does not point at a fragment");
+            }
+            index.frame_begin_.push_back(static_cast<uint32_t>(frag));
+        }
+        index.ranges_ = std::move(fragments);
+    } else if (fragments.size() == number_of_frames) {
+        for (uint32_t f = 0; f < number_of_frames; ++f) {
+            index.frame_begin_.push_back(f);
+        }
+        index.ranges_ = std::move(fragments);
+    } else if (number_of_frames == 1) {
+        index.frame_begin_.push_back(0);
+        index.ranges_ = std::move(fragments);
+    } else {
+        bool frame_open = false;
+        for (size_t i = 0; i < fragments.size(); ++i) {
+            if (!frame_open) {
+                index.frame_begin_.push_back(static_cast<uint32_t>(i));
+                frame_open = true;
+            }
+            if (ends_with_end_marker(
+                    value.subspan(fragments[i].offset, fragments[i].length))) {
+                frame_open = false;
+            }
+        }
+        if (index.frame_begin_.size() != number_of_frames) {
+            return fail("Unable to delimit " + std::to_string(number_of_frames) +
+                        " frames from " + std::to_string(fragments.size()) +
+                        " fragments");
+        }
+        index.ranges_ = std::move(fragments);
+    }
+
+    for (auto& range : index.ranges_) {
+        range.offset += base_offset;
+    }
+    index.frame_begin_.push_back(static_cast<uint32_t>(index.ranges_.size()));
+
+    return kcenon::pacs::Result<frame_index>::ok(std::move(index));
+}
+
+auto frame_index::build(const std::filesystem::path& path)
+    -> kcenon::pacs::Result<frame_index> {
+    auto mapped = memory_mapped_file::open(path);
+    if (mapped.is_err()) {
+        return kcenon::pacs::Result<frame_index>::err(mapped.error());
+    }
+    const auto data = mapped.value().as_span();
+
+    auto meta = read_meta(data, path.string());
+    if (meta.is_err()) {
+        return kcenon::pacs::Result<frame_index>::err(meta.error());
+    }
+    auto [ts_uid, pos] = std::move(meta.value());
+
+    walk_state state;
+    state.data = data;
+    if (!walk_elements(state, pos, ts_uid == kImplicitVrLittleEndian, 0)) {
+        return kcenon::pacs::pacs_error<frame_index>(
+            kcenon::pacs::error_codes::invalid_dicom_file,
+            "Malformed element structure in " + path.string());
+    }
+    if (!state.pixel_found) {
+        return kcenon::pacs::pacs_error<frame_index>(
+            kcenon::pacs::error_codes::element_not_found,
+            "Instance has no Pixel Data");
+    }
+
+    frame_index index;
+    if (state.pixel_length == kUndefinedLength) {
+        auto built = from_encapsulated(data.subspan(state.pixel_offset),
+                                       state.number_of_frames,
+                                       state.pixel_offset,
+                                       state.extended_offsets,
+                                       state.extended_lengths);
+        if (built.is_err()) {
+            return built;
+        }
+        index = std::move(built.value());
+    } else {
+        const uint64_t length = state.pixel_length;
+        if (state.pixel_offset + length > data.size()) {
+            return kcenon::pacs::pacs_error<frame_index>(
+                kcenon::pacs::error_codes::data_size_mismatch,
+                "Pixel Data extends past end of file");
+        }
+
+        const uint32_t frames = state.number_of_frames;
+        uint64_t frame_size = length;
+        if (frames > 1) {
+            if (state.bits_allocated == 0 || state.bits_allocated % 8 != 0) {
+                return kcenon::pacs::pacs_error<frame_index>(
+                    kcenon::pacs::error_codes::data_size_mismatch,
+                    "Cannot index frames that are not byte aligned");
+            }
+            frame_size = static_cast<uint64_t>(state.rows) * state.columns *
+                         state.samples_per_pixel * (state.bits_allocated / 8);
+            if (frame_size == 0 || frame_size * frames > length ||
+                frame_size > UINT32_MAX) {
+                return kcenon::pacs::pacs_error<frame_index>(
+                    kcenon::pacs::error_codes::data_size_mismatch,
+                    "Pixel Data is shorter than Rows x Columns x Frames");
+            }
+        }
+
+        index.ranges_.reserve(frames);
+        index.frame_begin_.reserve(frames + 1);
+        for (uint32_t f = 0; f < frames; ++f) {
+            index.frame_begin_.push_back(f);
+            index.ranges_.push_back(fragment_range{
+                state.pixel_offset + f * frame_size,
+                static_cast<uint32_t>(frame_size)});
+        }
+        index.frame_begin_.push_back(frames);
+    }
+
+    index.transfer_syntax_uid_ = std::move(ts_uid);
+    index.source_size_ = data.size();
+    return kcenon::pacs::Result<frame_index>::ok(std::move(index));
+}
+
+auto frame_index::locate_pixel_data(std::span<const uint8_t> data)
+    -> kcenon::pacs::Result<pixel_data_location> {
+    auto meta = read_meta(data, "buffer");
+    if (meta.is_err()) {
+        return kcenon::pacs::Result<pixel_data_location>::err(meta.error());
+    }
+    auto [ts_uid, pos] = std::move(meta.value());
+
+    walk_state state;
+    state.data = data;
+    auto element = walk_elements(state, pos, ts_uid == kImplicitVrLittleEndian, 0);
+    if (!element) {
+        return kcenon::pacs::pacs_error<pixel_data_location>(
+            kcenon::pacs::error_codes::invalid_dicom_file,
+            "Malformed element structure");
+    }
+    if (!state.pixel_found) {
+        return kcenon::pacs::pacs_error<pixel_data_location>(
+            kcenon::pacs::error_codes::element_not_found,
+            "Instance has no Pixel Data");
+    }
+
+    pixel_data_location location;
+    location.transfer_syntax_uid = std::move(ts_uid);
+    location.element_offset = *element;
+    location.value_offset = state.pixel_offset;
+    location.encapsulated = state.pixel_length == kUndefinedLength;
+
+    if (!location.encapsulated) {
+        location.element_end = state.pixel_offset + static_cast<uint64_t>(state.pixel_length);
+        if (location.element_end > data.size()) {
+            return kcenon::pacs::pacs_error<pixel_data_location>(
+                kcenon::pacs::error_codes::data_size_mismatch,
+                "Pixel Data extends past end of file");
+        }
+        return kcenon::pacs::Result<pixel_data_location>::ok(std::move(location));
+    }
+
+    // Skip fragment items up to the Sequence Delimitation Item
+    size_t item = state.pixel_offset;
+    while (true) {
+        auto h = read_header(data, item, true);
+        if (!h || h->group != kItemGroup) {
+            return kcenon::pacs::pacs_error<pixel_data_location>(
+                kcenon::pacs::error_codes::invalid_dicom_file,
+                "Unterminated encapsulated Pixel Data");
+        }
+        if (h->element == kSequenceDelimitationElement) {
+            location.element_end = h->value_offset;
+            break;
+        }
+        if (h->value_offset + static_cast<uint64_t>(h->length) > data.size()) {
+            return kcenon::pacs::pacs_error<pixel_data_location>(
+                kcenon::pacs::error_codes::data_size_mismatch,
+                "Fragment length exceeds pixel data size");
+        }
+        item = h->value_offset + h->length;
+    }
+    return kcenon::pacs::Result<pixel_data_location>::ok(std::move(location));
+}
+
+// ============================================================================
+// Persistence
+// ============================================================================
+
+auto frame_index::sidecar_path(const std::filesystem::path& instance_path)
+    -> std::filesystem::path {
+    auto path = instance_path;
+    path += ".fidx";
+    return path;
+}
+
+auto frame_index::save(const std::filesystem::path& path) const
+    -> kcenon::pacs::VoidResult {
+    std::vector<uint8_t> out;
+    out.reserve(32 + transfer_syntax_uid_.size() + frame_begin_.size() * 4 +
+                ranges_.size() * 12);
+
+    out.insert(out.end(), std::begin(kSidecarMagic), std::end(kSidecarMagic));
+    append_le32(out, kSidecarVersion);
+    append_le64(out, source_size_);
+    out.push_back(encapsulated_ ? 1 : 0);
+    append_le32(out, static_cast<uint32_t>(transfer_syntax_uid_.size()));
+    out.insert(out.end(), transfer_syntax_uid_.begin(), transfer_syntax_uid_.end());
+    append_le32(out, static_cast<uint32_t>(frame_begin_.size()));
+    append_le32(out, static_cast<uint32_t>(ranges_.size()));
+    for (auto begin : frame_begin_) {
+        append_le32(out, begin);
+    }
+    for (const auto& range : ranges_) {
+        append_le64(out, range.offset);
+        append_le32(out, range.length);
+    }
+
+    // Write through a temporary file so readers never see a partial index
+    auto temp_path = path;
+    temp_path += ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(reinterpret_cast<const char*>(out.data()),
+                                 static_cast<std::streamsize>(out.size()))) {
+            std::error_code ec;
+            std::filesystem::remove(temp_path, ec);
+            return kcenon::pacs::pacs_void_error(
+                kcenon::pacs::error_codes::file_write_error,
+                "Failed to write frame index: " + path.string());
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp_path, ec);
+        return kcenon::pacs::pacs_void_error(
+            kcenon::pacs::error_codes::file_write_error,
+            "Failed to rename frame index: " + ec.message());
+    }
+    return kcenon::pacs::ok();
+}
+
+auto frame_index::load(const std::filesystem::path& path)
+    -> kcenon::pacs::Result<frame_index> {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return kcenon::pacs::pacs_error<frame_index>(
+            kcenon::pacs::error_codes::file_not_found,
+            "Frame index not found: " + path.string());
+    }
+    std::vector<uint8_t> in((std::istreambuf_iterator<char>(file)),
+                            std::istreambuf_iterator<char>());
+
+    auto corrupt = [&path]() {
+        return kcenon::pacs::pacs_error<frame_index>(
+            kcenon::pacs::error_codes::file_read_error,
+            "Corrupt frame index: " + path.string());
+    };
+
+    size_t pos = 0;
+    auto need = [&in, &pos](size_t n) { return pos + n <= in.size(); };
+
+    if (!need(21) || std::memcmp(in.data(), kSidecarMagic, 4) != 0 ||
+        read_le32(in.data() + 4) != kSidecarVersion) {
+        return corrupt();
+    }
+    pos = 8;
+
+    frame_index index;
+    index.source_size_ = read_le64(in.data() + pos);
+    pos += 8;
+    index.encapsulated_ = in[pos++] != 0;
+
+    const uint32_t ts_length = read_le32(in.data() + pos);
+    pos += 4;
+    if (!need(static_cast<size_t>(ts_length) + 8)) {
+        return corrupt();
+    }
+    index.transfer_syntax_uid_.assign(in.begin() + static_cast<std::ptrdiff_t>(pos),
+                                      in.begin() + static_cast<std::ptrdiff_t>(pos + ts_length));
+    pos += ts_length;
+
+    const uint32_t begin_count = read_le32(in.data() + pos);
+    const uint32_t range_count = read_le32(in.data() + pos + 4);
+    pos += 8;
+    if (begin_count == 0 ||
+        !need(static_cast<size_t>(begin_count) * 4 + static_cast<size_t>(range_count) * 12)) {
+        return corrupt();
+    }
+
+    index.frame_begin_.resize(begin_count);
+    for (auto& begin : index.frame_begin_) {
+        begin = read_le32(in.data() + pos);
+        pos += 4;
+    }
+    index.ranges_.resize(range_count);
+    for (auto& range : index.ranges_) {
+        range.offset = read_le64(in.data() + pos);
+        range.length = read_le32(in.data() + pos + 8);
+        pos += 12;
+    }
+
+    if (!std::is_sorted(index.frame_begin_.begin(), index.frame_begin_.end()) ||
+        index.frame_begin_.back() != range_count) {
+        return corrupt();
+    }
+    return kcenon::pacs::Result<frame_index>::ok(std::move(index));
+}
+
+auto frame_index::load_or_build(const std::filesystem::path& instance_path)
+    -> kcenon::pacs::Result<frame_index> {
+    const auto sidecar = sidecar_path(instance_path);
+
+    std::error_code ec;
+    const auto current_size = std::filesystem::file_size(instance_path, ec);
+    if (ec) {
+        return kcenon::pacs::pacs_error<frame_index>(
+            kcenon::pacs::error_codes::file_not_found,
+            "Instance not found: " + instance_path.string());
+    }
+
+    if (auto loaded = load(sidecar);
+        loaded.is_ok() && loaded.value().source_size_ == current_size) {
+        return loaded;
+    }
+
+    auto built = build(instance_path);
+    if (built.is_ok()) {
+        // A missing sidecar only costs a rebuild next time
+        (void)built.value().save(sidecar);
+    }
+    return built;
+}
+
+// ============================================================================
+// Access
+// ============================================================================
+
+auto frame_index::frame_count() const noexcept -> uint32_t {
+    return frame_begin_.empty() ? 0 : static_cast<uint32_t>(frame_begin_.size() - 1);
+}
+
+auto frame_index::transfer_syntax_uid() const noexcept -> const std::string& {
+    return transfer_syntax_uid_;
+}
+
+auto frame_index::is_encapsulated() const noexcept -> bool {
+    return encapsulated_;
+}
+
+auto frame_index::fragments(uint32_t frame_number) const
+    -> std::span<const fragment_range> {
+    if (frame_number == 0 || frame_number > frame_count()) {
+        return {};
+    }
+    const auto begin = frame_begin_[frame_number - 1];
+    const auto end = frame_begin_[frame_number];
+    return std::span<const fragment_range>(ranges_).subspan(begin, end - begin);
+}
+
+auto frame_index::frame_size(uint32_t frame_number) const -> uint64_t {
+    uint64_t total = 0;
+    for (const auto& range : fragments(frame_number)) {
+        total += range.length;
+    }
+    return total;
+}
+
+auto frame_index::read_frame(const memory_mapped_file& file,
+                             uint32_t frame_number) const
+    -> kcenon::pacs::Result<std::vector<uint8_t>> {
+    const auto ranges = fragments(frame_number);
+    if (ranges.empty()) {
+        return kcenon::pacs::pacs_error<std::vector<uint8_t>>(
+            kcenon::pacs::error_codes::element_not_found,
+            "Frame " + std::to_string(frame_number) + " does not exist");
+    }
+
+    std::vector<uint8_t> frame(frame_size(frame_number));
+    size_t written = 0;
+    for (const auto& range : ranges) {
+        if (range.offset + range.length > file.size()) {
+            return kcenon::pacs::pacs_error<std::vector<uint8_t>>(
+                kcenon::pacs::error_codes::data_size_mismatch,
+                "Frame index does not match file contents");
+        }
+        std::memcpy(frame.data() + written, file.data() + range.offset, range.length);
+        written += range.length;
+    }
+    return kcenon::pacs::Result<std::vector<uint8_t>>::ok(std::move(frame));
+}
+
+auto frame_index::read_frame(const std::filesystem::path& path,
+                             uint32_t frame_number) const
+    -> kcenon::pacs::Result<std::vector<uint8_t>> {
+    auto mapped = memory_mapped_file::open(path);
+    if (mapped.is_err()) {
+        return kcenon::pacs::Result<std::vector<uint8_t>>::err(mapped.error());
+    }
+    return read_frame(mapped.value(), frame_number);
+}
+
+}  // namespace kcenon::pacs::core
@@ -6,23 +6,36 @@
  * @file standard_tags_data.cpp
  * @brief Standard DICOM tags from PS3.6 Data Dictionary
  *
- * This file contains the standard DICOM tag definitions as specified
- * in DICOM PS3.6. The data is organized by group for easier maintenance.
+ * GENERATED by scripts/generate_dicom_dictionary.py - do not edit.
+ * Source: pydicom _dicom_dict.py (transcribed from PS3.6/PS3.7)
  *
- * Note: This file includes commonly used tags. For complete PS3.6 coverage,
- * additional tags can be generated from the official DICOM standard XML.
+ * Holds every data, file meta, directory and command element of the
+ * standard (5179 entries, 88 of them repeating-group tags such
+ * as (60xx,3000)) together with two minimal perfect hash tables, one keyed
+ * by tag and one by keyword. Lookups hash the key, read one displacement
+ * and one slot, and compare a single entry; everything is constant
+ * initialized, so there is no start-up cost and nothing to lock.
+ *
+ * For elements with alternative VRs the VR an implicit VR decoder should
+ * assume is stored ("US or SS" -> US, "OB or OW" -> OW); items and
+ * delimiters are UN.
  *
  * @see DICOM PS3.6 - Data Dictionary
+ * @see DICOM PS3.7 Annex E - Command Dictionary
  */
 
 #include "kcenon/pacs/core/tag_info.h"
 #include "kcenon/pacs/encoding/vr_type.h"
 
 #include <array>
+#include <cstdint>
 #include <span>
+#include <string_view>
 
 namespace kcenon::pacs::core {
 
+namespace {
+
 using VR = kcenon::pacs::encoding::vr_type;
 
 // Helper to create VR value
@@ -30,41 +43,79 @@ constexpr auto vr(VR v) -> uint16_t {
     return static_cast<uint16_t>(v);
 }
 
-// Helper for common VM patterns
+// VM patterns used by the dictionary
 constexpr value_multiplicity vm_1{1, 1};
+constexpr value_multiplicity vm_1_2{1, 2};
+constexpr value_multiplicity vm_1_3{1, 3};
+constexpr value_multiplicity vm_1_8{1, 8};
+constexpr value_multiplicity vm_1_32{1, 32};
+constexpr value_multiplicity vm_1_99{1, 99};
 constexpr value_multiplicity vm_1_n{1, std::nullopt};
 constexpr value_multiplicity vm_2{2, 2};
+constexpr value_multiplicity vm_2_4{2, 4};
 constexpr value_multiplicity vm_2_n{2, std::nullopt};
+constexpr value_multiplicity vm_2_2n{2, std::nullopt, 2};
 constexpr value_multiplicity vm_3{3, 3};
+constexpr value_multiplicity vm_3_n{3, std::nullopt};
+constexpr value_multiplicity vm_3_3n{3, std::nullopt, 3};
+constexpr value_multiplicity vm_4{4, 4};
+constexpr value_multiplicity vm_4_5{4, 5};
 constexpr value_multiplicity vm_6{6, 6};
+constexpr value_multiplicity vm_6_n{6, std::nullopt};
+constexpr value_multiplicity vm_9{9, 9};
+constexpr value_multiplicity vm_16{16, 16};
 
-// Standard DICOM tags organized by group
+// Sorted by tag; repeating-group tags are listed under their first instance.
 // Note: Array size explicitly specified to avoid Clang's fold expression
 //       nesting limit of 256 when using CTAD with large initializer lists
 // clang-format off
-static constexpr std::array<tag_info, 298> standard_tags = {{
-    // ========================================================================
-    // Command Group (0x0000) - DIMSE messages
-    // ========================================================================
+constexpr std::array<tag_info, 5179> standard_tags = {{
     tag_info{dicom_tag{0x0000, 0x0000}, vr(VR::UL), vm_1, "CommandGroupLength", "Command Group Length", false},
+    tag_info{dicom_tag{0x0000, 0x0001}, vr(VR::UL), vm_1, "CommandLengthToEnd", "Command Length to End", true},
     tag_info{dicom_tag{0x0000, 0x0002}, vr(VR::UI), vm_1, "AffectedSOPClassUID", "Affected SOP Class UID", false},
     tag_info{dicom_tag{0x0000, 0x0003}, vr(VR::UI), vm_1, "RequestedSOPClassUID", "Requested SOP Class UID", false},
+    tag_info{dicom_tag{0x0000, 0x0010}, vr(VR::SH), vm_1, "CommandRecognitionCode", "Command Recognition Code", true},
     tag_info{dicom_tag{0x0000, 0x0100}, vr(VR::US), vm_1, "CommandField", "Command Field", false},
     tag_info{dicom_tag{0x0000, 0x0110}, vr(VR::US), vm_1, "MessageID", "Message ID", false},
     tag_info{dicom_tag{0x0000, 0x0120}, vr(VR::US), vm_1, "MessageIDBeingRespondedTo", "Message ID Being Responded To", false},
+    tag_info{dicom_tag{0x0000, 0x0200}, vr(VR::AE), vm_1, "Initiator", "Initiator", true},
+    tag_info{dicom_tag{0x0000, 0x0300}, vr(VR::AE), vm_1, "Receiver", "Receiver", true},
+    tag_info{dicom_tag{0x0000, 0x0400}, vr(VR::AE), vm_1, "FindLocation", "Find Location", true},
     tag_info{dicom_tag{0x0000, 0x0600}, vr(VR::AE), vm_1, "MoveDestination", "Move Destination", false},
     tag_info{dicom_tag{0x0000, 0x0700}, vr(VR::US), vm_1, "Priority", "Priority", false},
     tag_info{dicom_tag{0x0000, 0x0800}, vr(VR::US), vm_1, "CommandDataSetType", "Command Data Set Type", false},
+    tag_info{dicom_tag{0x0000, 0x0850}, vr(VR::US), vm_1, "NumberOfMatches", "Number of Matches", true},
+    tag_info{dicom_tag{0x0000, 0x0860}, vr(VR::US), vm_1, "ResponseSequenceNumber", "Response Sequence Number", true},
     tag_info{dicom_tag{0x0000, 0x0900}, vr(VR::US), vm_1, "Status", "Status", false},
+    tag_info{dicom_tag{0x0000, 0x0901}, vr(VR::AT), vm_1_n, "OffendingElement", "Offending Element", false},
+    tag_info{dicom_tag{0x0000, 0x0902}, vr(VR::LO), vm_1, "ErrorComment", "Error Comment", false},
+    tag_info{dicom_tag{0x0000, 0x0903}, vr(VR::US), vm_1, "ErrorID", "Error ID", false},
     tag_info{dicom_tag{0x0000, 0x1000}, vr(VR::UI), vm_1, "AffectedSOPInstanceUID", "Affected SOP Instance UID", false},
+    tag_info{dicom_tag{0x0000, 0x1001}, vr(VR::UI), vm_1, "RequestedSOPInstanceUID", "Requested SOP Instance UID", false},
+    tag_info{dicom_tag{0x0000, 0x1002}, vr(VR::US), vm_1, "EventTypeID", "Event Type ID", false},
+    tag_info{dicom_tag{0x0000, 0x1005}, vr(VR::AT), vm_1_n, "AttributeIdentifierList", "Attribute Identifier List", false},
+    tag_info{dicom_tag{0x0000, 0x1008}, vr(VR::US), vm_1, "ActionTypeID", "Action Type ID", false},
     tag_info{dicom_tag{0x0000, 0x1020}, vr(VR::US), vm_1, "NumberOfRemainingSuboperations", "Number of Remaining Sub-operations", false},
     tag_info{dicom_tag{0x0000, 0x1021}, vr(VR::US), vm_1, "NumberOfCompletedSuboperations", "Number of Completed Sub-operations", false},
     tag_info{dicom_tag{0x0000, 0x1022}, vr(VR::US), vm_1, "NumberOfFailedSuboperations", "Number of Failed Sub-operations", false},
     tag_info{dicom_tag{0x0000, 0x1023}, vr(VR::US), vm_1, "NumberOfWarningSuboperations", "Number of Warning Sub-operations", false},
-
-    // ========================================================================
-    // File Meta Information (0x0002)
-    // ========================================================================
+    tag_info{dicom_tag{0x0000, 0x1030}, vr(VR::AE), vm_1, "MoveOriginatorApplicationEntityTitle", "Move Originator Application Entity Title", false},
+    tag_info{dicom_tag{0x0000, 0x1031}, vr(VR::US), vm_1, "MoveOriginatorMessageID", "Move Originator Message ID", false},
+    tag_info{dicom_tag{0x0000, 0x4000}, vr(VR::LT), vm_1, "DialogReceiver", "Dialog Receiver", true},
+    tag_info{dicom_tag{0x0000, 0x4010}, vr(VR::LT), vm_1, "TerminalType", "Terminal Type", true},
+    tag_info{dicom_tag{0x0000, 0x5010}, vr(VR::SH), vm_1, "MessageSetID", "Message Set ID", true},
+    tag_info{dicom_tag{0x0000, 0x5020}, vr(VR::SH), vm_1, "EndMessageID", "End Message ID", true},
+    tag_info{dicom_tag{0x0000, 0x5110}, vr(VR::LT), vm_1, "DisplayFormat", "Display Format", true},
+    tag_info{dicom_tag{0x0000, 0x5120}, vr(VR::LT), vm_1, "PagePositionID", "Page Position ID", true},
+    tag_info{dicom_tag{0x0000, 0x5130}, vr(VR::CS), vm_1, "TextFormatID", "Text Format ID", true},
+    tag_info{dicom_tag{0x0000, 0x5140}, vr(VR::CS), vm_1, "NormalReverse", "Normal/Reverse", true},
+    tag_info{dicom_tag{0x0000, 0x5150}, vr(VR::CS), vm_1, "AddGrayScale", "Add Gray Scale", true},
+    tag_info{dicom_tag{0x0000, 0x5160}, vr(VR::CS), vm_1, "Borders", "Borders", true},
+    tag_info{dicom_tag{0x0000, 0x5170}, vr(VR::IS), vm_1, "Copies", "Copies", true},
+    tag_info{dicom_tag{0x0000, 0x5180}, vr(VR::CS), vm_1, "CommandMagnificationType", "Command Magnification Type", true},
+    tag_info{dicom_tag{0x0000, 0x5190}, vr(VR::CS), vm_1, "Erase", "Erase", true},
+    tag_info{dicom_tag{0x0000, 0x51A0}, vr(VR::CS), vm_1, "Print", "Print", true},
+    tag_info{dicom_tag{0x0000, 0x51B0}, vr(VR::US), vm_1_n, "Overlays", "Overlays", true},
     tag_info{dicom_tag{0x0002, 0x0000}, vr(VR::UL), vm_1, "FileMetaInformationGroupLength", "File Meta Information Group Length", false},
     tag_info{dicom_tag{0x0002, 0x0001}, vr(VR::OB), vm_1, "FileMetaInformationVersion", "File Meta Information Version", false},
     tag_info{dicom_tag{0x0002, 0x0002}, vr(VR::UI), vm_1, "MediaStorageSOPClassUID", "Media Storage SOP Class UID", false},
@@ -75,38 +126,81 @@ static constexpr std::array<tag_info, 298> standard_tags = {{
     tag_info{dicom_tag{0x0002, 0x0016}, vr(VR::AE), vm_1, "SourceApplicationEntityTitle", "Source Application Entity Title", false},
     tag_info{dicom_tag{0x0002, 0x0017}, vr(VR::AE), vm_1, "SendingApplicationEntityTitle", "Sending Application Entity Title", false},
     tag_info{dicom_tag{0x0002, 0x0018}, vr(VR::AE), vm_1, "ReceivingApplicationEntityTitle", "Receiving Application Entity Title", false},
+    tag_info{dicom_tag{0x0002, 0x0026}, vr(VR::UR), vm_1, "SourcePresentationAddress", "Source Presentation Address", false},
+    tag_info{dicom_tag{0x0002, 0x0027}, vr(VR::UR), vm_1, "SendingPresentationAddress", "Sending Presentation Address", false},
+    tag_info{dicom_tag{0x0002, 0x0028}, vr(VR::UR), vm_1, "ReceivingPresentationAddress", "Receiving Presentation Address", false},
+    tag_info{dicom_tag{0x0002, 0x0031}, vr(VR::OB), vm_1, "RTVMetaInformationVersion", "RTV Meta Information Version", false},
+    tag_info{dicom_tag{0x0002, 0x0032}, vr(VR::UI), vm_1, "RTVCommunicationSOPClassUID", "RTV Communication SOP Class UID", false},
+    tag_info{dicom_tag{0x0002, 0x0033}, vr(VR::UI), vm_1, "RTVCommunicationSOPInstanceUID", "RTV Communication SOP Instance UID", false},
+    tag_info{dicom_tag{0x0002, 0x0035}, vr(VR::OB), vm_1, "RTVSourceIdentifier", "RTV Source Identifier", false},
+    tag_info{dicom_tag{0x0002, 0x0036}, vr(VR::OB), vm_1, "RTVFlowIdentifier", "RTV Flow Identifier", false},
+    tag_info{dicom_tag{0x0002, 0x0037}, vr(VR::UL), vm_1, "RTVFlowRTPSamplingRate", "RTV Flow RTP Sampling Rate", false},
+    tag_info{dicom_tag{0x0002, 0x0038}, vr(VR::FD), vm_1, "RTVFlowActualFrameDuration", "RTV Flow Actual Frame Duration", false},
     tag_info{dicom_tag{0x0002, 0x0100}, vr(VR::UI), vm_1, "PrivateInformationCreatorUID", "Private Information Creator UID", false},
     tag_info{dicom_tag{0x0002, 0x0102}, vr(VR::OB), vm_1, "PrivateInformation", "Private Information", false},
-
-    // ========================================================================
-    // SOP Common Module (0x0008)
-    // ========================================================================
+    tag_info{dicom_tag{0x0004, 0x1130}, vr(VR::CS), vm_1, "FileSetID", "File-set ID", false},
+    tag_info{dicom_tag{0x0004, 0x1141}, vr(VR::CS), vm_1_8, "FileSetDescriptorFileID", "File-set Descriptor File ID", false},
+    tag_info{dicom_tag{0x0004, 0x1142}, vr(VR::CS), vm_1, "SpecificCharacterSetOfFileSetDescriptorFile", "Specific Character Set of File-set Descriptor File", false},
+    tag_info{dicom_tag{0x0004, 0x1200}, vr(VR::UL), vm_1, "OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity", "Offset of the First Directory Record of the Root Directory Entity", false},
+    tag_info{dicom_tag{0x0004, 0x1202}, vr(VR::UL), vm_1, "OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity", "Offset of the Last Directory Record of the Root Directory Entity", false},
+    tag_info{dicom_tag{0x0004, 0x1212}, vr(VR::US), vm_1, "FileSetConsistencyFlag", "File-set Consistency Flag", false},
+    tag_info{dicom_tag{0x0004, 0x1220}, vr(VR::SQ), vm_1, "DirectoryRecordSequence", "Directory Record Sequence", false},
+    tag_info{dicom_tag{0x0004, 0x1400}, vr(VR::UL), vm_1, "OffsetOfTheNextDirectoryRecord", "Offset of the Next Directory Record", false},
+    tag_info{dicom_tag{0x0004, 0x1410}, vr(VR::US), vm_1, "RecordInUseFlag", "Record In-use Flag", false},
+    tag_info{dicom_tag{0x0004, 0x1420}, vr(VR::UL), vm_1, "OffsetOfReferencedLowerLevelDirectoryEntity", "Offset of Referenced Lower-Level Directory Entity", false},
+    tag_info{dicom_tag{0x0004, 0x1430}, vr(VR::CS), vm_1, "DirectoryRecordType", "Directory Record Type", false},
+    tag_info{dicom_tag{0x0004, 0x1432}, vr(VR::UI), vm_1, "PrivateRecordUID", "Private Record UID", false},
+    tag_info{dicom_tag{0x0004, 0x1500}, vr(VR::CS), vm_1_8, "ReferencedFileID", "Referenced File ID", false},
+    tag_info{dicom_tag{0x0004, 0x1504}, vr(VR::UL), vm_1, "MRDRDirectoryRecordOffset", "MRDR Directory Record Offset", true},
+    tag_info{dicom_tag{0x0004, 0x1510}, vr(VR::UI), vm_1, "ReferencedSOPClassUIDInFile", "Referenced SOP Class UID in File", false},
+    tag_info{dicom_tag{0x0004, 0x1511}, vr(VR::UI), vm_1, "ReferencedSOPInstanceUIDInFile", "Referenced SOP Instance UID in File", false},
+    tag_info{dicom_tag{0x0004, 0x1512}, vr(VR::UI), vm_1, "ReferencedTransferSyntaxUIDInFile", "Referenced Transfer Syntax UID in File", false},
+    tag_info{dicom_tag{0x0004, 0x151A}, vr(VR::UI), vm_1_n, "ReferencedRelatedGeneralSOPClassUIDInFile", "Referenced Related General SOP Class UID in File", false},
+    tag_info{dicom_tag{0x0004, 0x1600}, vr(VR::UL), vm_1, "NumberOfReferences", "Number of References", true},
+    tag_info{dicom_tag{0x0008, 0x0001}, vr(VR::UL), vm_1, "LengthToEnd", "Length to End", true},
     tag_info{dicom_tag{0x0008, 0x0005}, vr(VR::CS), vm_1_n, "SpecificCharacterSet", "Specific Character Set", false},
     tag_info{dicom_tag{0x0008, 0x0006}, vr(VR::SQ), vm_1, "LanguageCodeSequence", "Language Code Sequence", false},
     tag_info{dicom_tag{0x0008, 0x0008}, vr(VR::CS), vm_2_n, "ImageType", "Image Type", false},
+    tag_info{dicom_tag{0x0008, 0x0010}, vr(VR::SH), vm_1, "RecognitionCode", "Recognition Code", true},
     tag_info{dicom_tag{0x0008, 0x0012}, vr(VR::DA), vm_1, "InstanceCreationDate", "Instance Creation Date", false},
     tag_info{dicom_tag{0x0008, 0x0013}, vr(VR::TM), vm_1, "InstanceCreationTime", "Instance Creation Time", false},
     tag_info{dicom_tag{0x0008, 0x0014}, vr(VR::UI), vm_1, "InstanceCreatorUID", "Instance Creator UID", false},
+    tag_info{dicom_tag{0x0008, 0x0015}, vr(VR::DT), vm_1, "InstanceCoercionDateTime", "Instance Coercion DateTime", false},
     tag_info{dicom_tag{0x0008, 0x0016}, vr(VR::UI), vm_1, "SOPClassUID", "SOP Class UID", false},
+    tag_info{dicom_tag{0x0008, 0x0017}, vr(VR::UI), vm_1, "AcquisitionUID", "Acquisition UID", false},
     tag_info{dicom_tag{0x0008, 0x0018}, vr(VR::UI), vm_1, "SOPInstanceUID", "SOP Instance UID", false},
+    tag_info{dicom_tag{0x0008, 0x0019}, vr(VR::UI), vm_1, "PyramidUID", "Pyramid UID", false},
     tag_info{dicom_tag{0x0008, 0x001A}, vr(VR::UI), vm_1_n, "RelatedGeneralSOPClassUID", "Related General SOP Class UID", false},
     tag_info{dicom_tag{0x0008, 0x001B}, vr(VR::UI), vm_1, "OriginalSpecializedSOPClassUID", "Original Specialized SOP Class UID", false},
+    tag_info{dicom_tag{0x0008, 0x001C}, vr(VR::CS), vm_1, "SyntheticData", "Synthetic Data", false},
     tag_info{dicom_tag{0x0008, 0x0020}, vr(VR::DA), vm_1, "StudyDate", "Study Date", false},
     tag_info{dicom_tag{0x0008, 0x0021}, vr(VR::DA), vm_1, "SeriesDate", "Series Date", false},
     tag_info{dicom_tag{0x0008, 0x0022}, vr(VR::DA), vm_1, "AcquisitionDate", "Acquisition Date", false},
     tag_info{dicom_tag{0x0008, 0x0023}, vr(VR::DA), vm_1, "ContentDate", "Content Date", false},
+    tag_info{dicom_tag{0x0008, 0x0024}, vr(VR::DA), vm_1, "OverlayDate", "Overlay Date", true},
+    tag_info{dicom_tag{0x0008, 0x0025}, vr(VR::DA), vm_1, "CurveDate", "Curve Date", true},
+    tag_info{dicom_tag{0x0008, 0x002A}, vr(VR::DT), vm_1, "AcquisitionDateTime", "Acquisition DateTime", false},
     tag_info{dicom_tag{0x0008, 0x0030}, vr(VR::TM), vm_1, "StudyTime", "Study Time", false},
     tag_info{dicom_tag{0x0008, 0x0031}, vr(VR::TM), vm_1, "SeriesTime", "Series Time", false},
     tag_info{dicom_tag{0x0008, 0x0032}, vr(VR::TM), vm_1, "AcquisitionTime", "Acquisition Time", false},
     tag_info{dicom_tag{0x0008, 0x0033}, vr(VR::TM), vm_1, "ContentTime", "Content Time", false},
+    tag_info{dicom_tag{0x0008, 0x0034}, vr(VR::TM), vm_1, "OverlayTime", "Overlay Time", true},
+    tag_info{dicom_tag{0x0008, 0x0035}, vr(VR::TM), vm_1, "CurveTime", "Curve Time", true},
+    tag_info{dicom_tag{0x0008, 0x0040}, vr(VR::US), vm_1, "DataSetType", "Data Set Type", true},
+    tag_info{dicom_tag{0x0008, 0x0041}, vr(VR::LO), vm_1, "DataSetSubtype", "Data Set Subtype", true},
+    tag_info{dicom_tag{0x0008, 0x0042}, vr(VR::CS), vm_1, "NuclearMedicineSeriesType", "Nuclear Medicine Series Type", true},
     tag_info{dicom_tag{0x0008, 0x0050}, vr(VR::SH), vm_1, "AccessionNumber", "Accession Number", false},
+    tag_info{dicom_tag{0x0008, 0x0051}, vr(VR::SQ), vm_1, "IssuerOfAccessionNumberSequence", "Issuer of Accession Number Sequence", false},
     tag_info{dicom_tag{0x0008, 0x0052}, vr(VR::CS), vm_1, "QueryRetrieveLevel", "Query/Retrieve Level", false},
+    tag_info{dicom_tag{0x0008, 0x0053}, vr(VR::CS), vm_1, "QueryRetrieveView", "Query/Retrieve View", false},
     tag_info{dicom_tag{0x0008, 0x0054}, vr(VR::AE), vm_1_n, "RetrieveAETitle", "Retrieve AE Title", false},
+    tag_info{dicom_tag{0x0008, 0x0055}, vr(VR::AE), vm_1, "StationAETitle", "Station AE Title", false},
     tag_info{dicom_tag{0x0008, 0x0056}, vr(VR::CS), vm_1, "InstanceAvailability", "Instance Availability", false},
     tag_info{dicom_tag{0x0008, 0x0058}, vr(VR::UI), vm_1_n, "FailedSOPInstanceUIDList", "Failed SOP Instance UID List", false},
     tag_info{dicom_tag{0x0008, 0x0060}, vr(VR::CS), vm_1, "Modality", "Modality", false},
     tag_info{dicom_tag{0x0008, 0x0061}, vr(VR::CS), vm_1_n, "ModalitiesInStudy", "Modalities in Study", false},
     tag_info{dicom_tag{0x0008, 0x0062}, vr(VR::UI), vm_1_n, "SOPClassesInStudy", "SOP Classes in Study", false},
+    tag_info{dicom_tag{0x0008, 0x0063}, vr(VR::SQ), vm_1, "AnatomicRegionsInStudyCodeSequence", "Anatomic Regions in Study Code Sequence", false},
     tag_info{dicom_tag{0x0008, 0x0064}, vr(VR::CS), vm_1, "ConversionType", "Conversion Type", false},
     tag_info{dicom_tag{0x0008, 0x0068}, vr(VR::CS), vm_1, "PresentationIntentType", "Presentation Intent Type", false},
     tag_info{dicom_tag{0x0008, 0x0070}, vr(VR::LO), vm_1, "Manufacturer", "Manufacturer", false},
@@ -117,126 +211,2024 @@ static constexpr std::array<tag_info, 298> standard_tags = {{
     tag_info{dicom_tag{0x0008, 0x0092}, vr(VR::ST), vm_1, "ReferringPhysicianAddress", "Referring Physician's Address", false},
     tag_info{dicom_tag{0x0008, 0x0094}, vr(VR::SH), vm_1_n, "ReferringPhysicianTelephoneNumbers", "Referring Physician's Telephone Numbers", false},
     tag_info{dicom_tag{0x0008, 0x0096}, vr(VR::SQ), vm_1, "ReferringPhysicianIdentificationSequence", "Referring Physician Identification Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x009C}, vr(VR::PN), vm_1_n, "ConsultingPhysicianName", "Consulting Physician's Name", false},
+    tag_info{dicom_tag{0x0008, 0x009D}, vr(VR::SQ), vm_1, "ConsultingPhysicianIdentificationSequence", "Consulting Physician Identification Sequence", false},
     tag_info{dicom_tag{0x0008, 0x0100}, vr(VR::SH), vm_1, "CodeValue", "Code Value", false},
+    tag_info{dicom_tag{0x0008, 0x0101}, vr(VR::LO), vm_1, "ExtendedCodeValue", "Extended Code Value", false},
     tag_info{dicom_tag{0x0008, 0x0102}, vr(VR::SH), vm_1, "CodingSchemeDesignator", "Coding Scheme Designator", false},
     tag_info{dicom_tag{0x0008, 0x0103}, vr(VR::SH), vm_1, "CodingSchemeVersion", "Coding Scheme Version", false},
     tag_info{dicom_tag{0x0008, 0x0104}, vr(VR::LO), vm_1, "CodeMeaning", "Code Meaning", false},
     tag_info{dicom_tag{0x0008, 0x0105}, vr(VR::CS), vm_1, "MappingResource", "Mapping Resource", false},
     tag_info{dicom_tag{0x0008, 0x0106}, vr(VR::DT), vm_1, "ContextGroupVersion", "Context Group Version", false},
+    tag_info{dicom_tag{0x0008, 0x0107}, vr(VR::DT), vm_1, "ContextGroupLocalVersion", "Context Group Local Version", false},
+    tag_info{dicom_tag{0x0008, 0x0108}, vr(VR::LT), vm_1, "ExtendedCodeMeaning", "Extended Code Meaning", false},
+    tag_info{dicom_tag{0x0008, 0x0109}, vr(VR::SQ), vm_1, "CodingSchemeResourcesSequence", "Coding Scheme Resources Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x010A}, vr(VR::CS), vm_1, "CodingSchemeURLType", "Coding Scheme URL Type", false},
+    tag_info{dicom_tag{0x0008, 0x010B}, vr(VR::CS), vm_1, "ContextGroupExtensionFlag", "Context Group Extension Flag", false},
+    tag_info{dicom_tag{0x0008, 0x010C}, vr(VR::UI), vm_1, "CodingSchemeUID", "Coding Scheme UID", false},
+    tag_info{dicom_tag{0x0008, 0x010D}, vr(VR::UI), vm_1, "ContextGroupExtensionCreatorUID", "Context Group Extension Creator UID", false},
+    tag_info{dicom_tag{0x0008, 0x010E}, vr(VR::UR), vm_1, "CodingSchemeURL", "Coding Scheme URL", false},
     tag_info{dicom_tag{0x0008, 0x010F}, vr(VR::CS), vm_1, "ContextIdentifier", "Context Identifier", false},
     tag_info{dicom_tag{0x0008, 0x0110}, vr(VR::SQ), vm_1, "CodingSchemeIdentificationSequence", "Coding Scheme Identification Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0112}, vr(VR::LO), vm_1, "CodingSchemeRegistry", "Coding Scheme Registry", false},
+    tag_info{dicom_tag{0x0008, 0x0114}, vr(VR::ST), vm_1, "CodingSchemeExternalID", "Coding Scheme External ID", false},
+    tag_info{dicom_tag{0x0008, 0x0115}, vr(VR::ST), vm_1, "CodingSchemeName", "Coding Scheme Name", false},
+    tag_info{dicom_tag{0x0008, 0x0116}, vr(VR::ST), vm_1, "CodingSchemeResponsibleOrganization", "Coding Scheme Responsible Organization", false},
+    tag_info{dicom_tag{0x0008, 0x0117}, vr(VR::UI), vm_1, "ContextUID", "Context UID", false},
+    tag_info{dicom_tag{0x0008, 0x0118}, vr(VR::UI), vm_1, "MappingResourceUID", "Mapping Resource UID", false},
+    tag_info{dicom_tag{0x0008, 0x0119}, vr(VR::UC), vm_1, "LongCodeValue", "Long Code Value", false},
+    tag_info{dicom_tag{0x0008, 0x0120}, vr(VR::UR), vm_1, "URNCodeValue", "URN Code Value", false},
+    tag_info{dicom_tag{0x0008, 0x0121}, vr(VR::SQ), vm_1, "EquivalentCodeSequence", "Equivalent Code Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0122}, vr(VR::LO), vm_1, "MappingResourceName", "Mapping Resource Name", false},
+    tag_info{dicom_tag{0x0008, 0x0123}, vr(VR::SQ), vm_1, "ContextGroupIdentificationSequence", "Context Group Identification Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0124}, vr(VR::SQ), vm_1, "MappingResourceIdentificationSequence", "Mapping Resource Identification Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0201}, vr(VR::SH), vm_1, "TimezoneOffsetFromUTC", "Timezone Offset From UTC", false},
+    tag_info{dicom_tag{0x0008, 0x0202}, vr(VR::OB), vm_1, "", "Retired-blank", true},
+    tag_info{dicom_tag{0x0008, 0x0220}, vr(VR::SQ), vm_1, "ResponsibleGroupCodeSequence", "Responsible Group Code Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0221}, vr(VR::CS), vm_1, "EquipmentModality", "Equipment Modality", false},
+    tag_info{dicom_tag{0x0008, 0x0222}, vr(VR::LO), vm_1, "ManufacturerRelatedModelGroup", "Manufacturer's Related Model Group", false},
+    tag_info{dicom_tag{0x0008, 0x0300}, vr(VR::SQ), vm_1, "PrivateDataElementCharacteristicsSequence", "Private Data Element Characteristics Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0301}, vr(VR::US), vm_1, "PrivateGroupReference", "Private Group Reference", false},
+    tag_info{dicom_tag{0x0008, 0x0302}, vr(VR::LO), vm_1, "PrivateCreatorReference", "Private Creator Reference", false},
+    tag_info{dicom_tag{0x0008, 0x0303}, vr(VR::CS), vm_1, "BlockIdentifyingInformationStatus", "Block Identifying Information Status", false},
+    tag_info{dicom_tag{0x0008, 0x0304}, vr(VR::US), vm_1_n, "NonidentifyingPrivateElements", "Nonidentifying Private Elements", false},
+    tag_info{dicom_tag{0x0008, 0x0305}, vr(VR::SQ), vm_1, "DeidentificationActionSequence", "Deidentification Action Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0306}, vr(VR::US), vm_1_n, "IdentifyingPrivateElements", "Identifying Private Elements", false},
+    tag_info{dicom_tag{0x0008, 0x0307}, vr(VR::CS), vm_1, "DeidentificationAction", "Deidentification Action", false},
+    tag_info{dicom_tag{0x0008, 0x0308}, vr(VR::US), vm_1, "PrivateDataElement", "Private Data Element", false},
+    tag_info{dicom_tag{0x0008, 0x0309}, vr(VR::UL), vm_1_3, "PrivateDataElementValueMultiplicity", "Private Data Element Value Multiplicity", false},
+    tag_info{dicom_tag{0x0008, 0x030A}, vr(VR::CS), vm_1, "PrivateDataElementValueRepresentation", "Private Data Element Value Representation", false},
+    tag_info{dicom_tag{0x0008, 0x030B}, vr(VR::UL), vm_1_2, "PrivateDataElementNumberOfItems", "Private Data Element Number of Items", false},
+    tag_info{dicom_tag{0x0008, 0x030C}, vr(VR::UC), vm_1, "PrivateDataElementName", "Private Data Element Name", false},
+    tag_info{dicom_tag{0x0008, 0x030D}, vr(VR::UC), vm_1, "PrivateDataElementKeyword", "Private Data Element Keyword", false},
+    tag_info{dicom_tag{0x0008, 0x030E}, vr(VR::UT), vm_1, "PrivateDataElementDescription", "Private Data Element Description", false},
+    tag_info{dicom_tag{0x0008, 0x030F}, vr(VR::UT), vm_1, "PrivateDataElementEncoding", "Private Data Element Encoding", false},
+    tag_info{dicom_tag{0x0008, 0x0310}, vr(VR::SQ), vm_1, "PrivateDataElementDefinitionSequence", "Private Data Element Definition Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0400}, vr(VR::SQ), vm_1, "ScopeOfInventorySequence", "Scope of Inventory Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0401}, vr(VR::LT), vm_1, "InventoryPurpose", "Inventory Purpose", false},
+    tag_info{dicom_tag{0x0008, 0x0402}, vr(VR::LT), vm_1, "InventoryInstanceDescription", "Inventory Instance Description", false},
+    tag_info{dicom_tag{0x0008, 0x0403}, vr(VR::CS), vm_1, "InventoryLevel", "Inventory Level", false},
+    tag_info{dicom_tag{0x0008, 0x0404}, vr(VR::DT), vm_1, "ItemInventoryDateTime", "Item Inventory DateTime", false},
+    tag_info{dicom_tag{0x0008, 0x0405}, vr(VR::CS), vm_1, "RemovedFromOperationalUse", "Removed from Operational Use", false},
+    tag_info{dicom_tag{0x0008, 0x0406}, vr(VR::SQ), vm_1, "ReasonForRemovalCodeSequence", "Reason for Removal Code Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0407}, vr(VR::UR), vm_1, "StoredInstanceBaseURI", "Stored Instance Base URI", false},
+    tag_info{dicom_tag{0x0008, 0x0408}, vr(VR::UR), vm_1, "FolderAccessURI", "Folder Access URI", false},
+    tag_info{dicom_tag{0x0008, 0x0409}, vr(VR::UR), vm_1, "FileAccessURI", "File Access URI", false},
+    tag_info{dicom_tag{0x0008, 0x040A}, vr(VR::CS), vm_1, "ContainerFileType", "Container File Type", false},
+    tag_info{dicom_tag{0x0008, 0x040B}, vr(VR::UR), vm_1, "FilenameInContainer", "Filename in Container", false},
+    tag_info{dicom_tag{0x0008, 0x040C}, vr(VR::UV), vm_1, "FileOffsetInContainer", "File Offset in Container", false},
+    tag_info{dicom_tag{0x0008, 0x040D}, vr(VR::UV), vm_1, "FileLengthInContainer", "File Length in Container", false},
+    tag_info{dicom_tag{0x0008, 0x040E}, vr(VR::UI), vm_1, "StoredInstanceTransferSyntaxUID", "Stored Instance Transfer Syntax UID", false},
+    tag_info{dicom_tag{0x0008, 0x040F}, vr(VR::CS), vm_1_n, "ExtendedMatchingMechanisms", "Extended Matching Mechanisms", false},
+    tag_info{dicom_tag{0x0008, 0x0410}, vr(VR::SQ), vm_1, "RangeMatchingSequence", "Range Matching Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0411}, vr(VR::SQ), vm_1, "ListOfUIDMatchingSequence", "List of UID Matching Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0412}, vr(VR::SQ), vm_1, "EmptyValueMatchingSequence", "Empty Value Matching Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0413}, vr(VR::SQ), vm_1, "GeneralMatchingSequence", "General Matching Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0414}, vr(VR::US), vm_1, "RequestedStatusInterval", "Requested Status Interval", false},
+    tag_info{dicom_tag{0x0008, 0x0415}, vr(VR::CS), vm_1, "RetainInstances", "Retain Instances", false},
+    tag_info{dicom_tag{0x0008, 0x0416}, vr(VR::DT), vm_1, "ExpirationDateTime", "Expiration DateTime", false},
+    tag_info{dicom_tag{0x0008, 0x0417}, vr(VR::CS), vm_1, "TransactionStatus", "Transaction Status", false},
+    tag_info{dicom_tag{0x0008, 0x0418}, vr(VR::LT), vm_1, "TransactionStatusComment", "Transaction Status Comment", false},
+    tag_info{dicom_tag{0x0008, 0x0419}, vr(VR::SQ), vm_1, "FileSetAccessSequence", "File Set Access Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x041A}, vr(VR::SQ), vm_1, "FileAccessSequence", "File Access Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x041B}, vr(VR::OB), vm_1, "RecordKey", "Record Key", false},
+    tag_info{dicom_tag{0x0008, 0x041C}, vr(VR::OB), vm_1, "PriorRecordKey", "Prior Record Key", false},
+    tag_info{dicom_tag{0x0008, 0x041D}, vr(VR::SQ), vm_1, "MetadataSequence", "Metadata Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x041E}, vr(VR::SQ), vm_1, "UpdatedMetadataSequence", "Updated Metadata Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x041F}, vr(VR::DT), vm_1, "StudyUpdateDateTime", "Study Update DateTime", false},
+    tag_info{dicom_tag{0x0008, 0x0420}, vr(VR::SQ), vm_1, "InventoryAccessEndPointsSequence", "Inventory Access End Points Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0421}, vr(VR::SQ), vm_1, "StudyAccessEndPointsSequence", "Study Access End Points Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0422}, vr(VR::SQ), vm_1, "IncorporatedInventoryInstanceSequence", "Incorporated Inventory Instance Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0423}, vr(VR::SQ), vm_1, "InventoriedStudiesSequence", "Inventoried Studies Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0424}, vr(VR::SQ), vm_1, "InventoriedSeriesSequence", "Inventoried Series Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0425}, vr(VR::SQ), vm_1, "InventoriedInstancesSequence", "Inventoried Instances Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x0426}, vr(VR::CS), vm_1, "InventoryCompletionStatus", "Inventory Completion Status", false},
+    tag_info{dicom_tag{0x0008, 0x0427}, vr(VR::UL), vm_1, "NumberOfStudyRecordsInInstance", "Number of Study Records in Instance", false},
+    tag_info{dicom_tag{0x0008, 0x0428}, vr(VR::UV), vm_1, "TotalNumberOfStudyRecords", "Total Number of Study Records", false},
+    tag_info{dicom_tag{0x0008, 0x0429}, vr(VR::UV), vm_1, "MaximumNumberOfRecords", "Maximum Number of Records", false},
+    tag_info{dicom_tag{0x0008, 0x1000}, vr(VR::AE), vm_1, "NetworkID", "Network ID", true},
     tag_info{dicom_tag{0x0008, 0x1010}, vr(VR::SH), vm_1, "StationName", "Station Name", false},
     tag_info{dicom_tag{0x0008, 0x1030}, vr(VR::LO), vm_1, "StudyDescription", "Study Description", false},
+    tag_info{dicom_tag{0x0008, 0x1032}, vr(VR::SQ), vm_1, "ProcedureCodeSequence", "Procedure Code Sequence", false},
     tag_info{dicom_tag{0x0008, 0x103E}, vr(VR::LO), vm_1, "SeriesDescription", "Series Description", false},
+    tag_info{dicom_tag{0x0008, 0x103F}, vr(VR::SQ), vm_1, "SeriesDescriptionCodeSequence", "Series Description Code Sequence", false},
     tag_info{dicom_tag{0x0008, 0x1040}, vr(VR::LO), vm_1, "InstitutionalDepartmentName", "Institutional Department Name", false},
+    tag_info{dicom_tag{0x0008, 0x1041}, vr(VR::SQ), vm_1, "InstitutionalDepartmentTypeCodeSequence", "Institutional Department Type Code Sequence", false},
     tag_info{dicom_tag{0x0008, 0x1048}, vr(VR::PN), vm_1_n, "PhysiciansOfRecord", "Physician(s) of Record", false},
+    tag_info{dicom_tag{0x0008, 0x1049}, vr(VR::SQ), vm_1, "PhysiciansOfRecordIdentificationSequence", "Physician(s) of Record Identification Sequence", false},
     tag_info{dicom_tag{0x0008, 0x1050}, vr(VR::PN), vm_1_n, "PerformingPhysicianName", "Performing Physician's Name", false},
+    tag_info{dicom_tag{0x0008, 0x1052}, vr(VR::SQ), vm_1, "PerformingPhysicianIdentificationSequence", "Performing Physician Identification Sequence", false},
     tag_info{dicom_tag{0x0008, 0x1060}, vr(VR::PN), vm_1_n, "NameOfPhysiciansReadingStudy", "Name of Physician(s) Reading Study", false},
+    tag_info{dicom_tag{0x0008, 0x1062}, vr(VR::SQ), vm_1, "PhysiciansReadingStudyIdentificationSequence", "Physician(s) Reading Study Identification Sequence", false},
     tag_info{dicom_tag{0x0008, 0x1070}, vr(VR::PN), vm_1_n, "OperatorsName", "Operators' Name", false},
+    tag_info{dicom_tag{0x0008, 0x1072}, vr(VR::SQ), vm_1, "OperatorIdentificationSequence", "Operator Identification Sequence", false},
     tag_info{dicom_tag{0x0008, 0x1080}, vr(VR::LO), vm_1_n, "AdmittingDiagnosesDescription", "Admitting Diagnoses Description", false},
     tag_info{dicom_tag{0x0008, 0x1084}, vr(VR::SQ), vm_1, "AdmittingDiagnosesCodeSequence", "Admitting Diagnoses Code Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x1088}, vr(VR::LO), vm_1, "PyramidDescription", "Pyramid Description", false},
     tag_info{dicom_tag{0x0008, 0x1090}, vr(VR::LO), vm_1, "ManufacturerModelName", "Manufacturer's Model Name", false},
+    tag_info{dicom_tag{0x0008, 0x1100}, vr(VR::SQ), vm_1, "ReferencedResultsSequence", "Referenced Results Sequence", true},
     tag_info{dicom_tag{0x0008, 0x1110}, vr(VR::SQ), vm_1, "ReferencedStudySequence", "Referenced Study Sequence", false},
     tag_info{dicom_tag{0x0008, 0x1111}, vr(VR::SQ), vm_1, "ReferencedPerformedProcedureStepSequence", "Referenced Performed Procedure Step Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x1112}, vr(VR::SQ), vm_1, "ReferencedInstancesBySOPClassSequence", "Referenced Instances by SOP Class Sequence", false},
     tag_info{dicom_tag{0x0008, 0x1115}, vr(VR::SQ), vm_1, "ReferencedSeriesSequence", "Referenced Series Sequence", false},
     tag_info{dicom_tag{0x0008, 0x1120}, vr(VR::SQ), vm_1, "ReferencedPatientSequence", "Referenced Patient Sequence", false},
     tag_info{dicom_tag{0x0008, 0x1125}, vr(VR::SQ), vm_1, "ReferencedVisitSequence", "Referenced Visit Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x1130}, vr(VR::SQ), vm_1, "ReferencedOverlaySequence", "Referenced Overlay Sequence", true},
+    tag_info{dicom_tag{0x0008, 0x1134}, vr(VR::SQ), vm_1, "ReferencedStereometricInstanceSequence", "Referenced Stereometric Instance Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x113A}, vr(VR::SQ), vm_1, "ReferencedWaveformSequence", "Referenced Waveform Sequence", false},
     tag_info{dicom_tag{0x0008, 0x1140}, vr(VR::SQ), vm_1, "ReferencedImageSequence", "Referenced Image Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x1145}, vr(VR::SQ), vm_1, "ReferencedCurveSequence", "Referenced Curve Sequence", true},
+    tag_info{dicom_tag{0x0008, 0x114A}, vr(VR::SQ), vm_1, "ReferencedInstanceSequence", "Referenced Instance Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x114B}, vr(VR::SQ), vm_1, "ReferencedRealWorldValueMappingInstanceSequence", "Referenced Real World Value Mapping Instance Sequence", false},
     tag_info{dicom_tag{0x0008, 0x1150}, vr(VR::UI), vm_1, "ReferencedSOPClassUID", "Referenced SOP Class UID", false},
     tag_info{dicom_tag{0x0008, 0x1155}, vr(VR::UI), vm_1, "ReferencedSOPInstanceUID", "Referenced SOP Instance UID", false},
+    tag_info{dicom_tag{0x0008, 0x1156}, vr(VR::SQ), vm_1, "DefinitionSourceSequence", "Definition Source Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x115A}, vr(VR::UI), vm_1_n, "SOPClassesSupported", "SOP Classes Supported", false},
+    tag_info{dicom_tag{0x0008, 0x1160}, vr(VR::IS), vm_1_n, "ReferencedFrameNumber", "Referenced Frame Number", false},
+    tag_info{dicom_tag{0x0008, 0x1161}, vr(VR::UL), vm_1_n, "SimpleFrameList", "Simple Frame List", false},
+    tag_info{dicom_tag{0x0008, 0x1162}, vr(VR::UL), vm_3_3n, "CalculatedFrameList", "Calculated Frame List", false},
+    tag_info{dicom_tag{0x0008, 0x1163}, vr(VR::FD), vm_2, "TimeRange", "Time Range", false},
+    tag_info{dicom_tag{0x0008, 0x1164}, vr(VR::SQ), vm_1, "FrameExtractionSequence", "Frame Extraction Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x1167}, vr(VR::UI), vm_1, "MultiFrameSourceSOPInstanceUID", "Multi-frame Source SOP Instance UID", false},
+    tag_info{dicom_tag{0x0008, 0x1190}, vr(VR::UR), vm_1, "RetrieveURL", "Retrieve URL", false},
+    tag_info{dicom_tag{0x0008, 0x1195}, vr(VR::UI), vm_1, "TransactionUID", "Transaction UID", false},
+    tag_info{dicom_tag{0x0008, 0x1196}, vr(VR::US), vm_1, "WarningReason", "Warning Reason", false},
+    tag_info{dicom_tag{0x0008, 0x1197}, vr(VR::US), vm_1, "FailureReason", "Failure Reason", false},
+    tag_info{dicom_tag{0x0008, 0x1198}, vr(VR::SQ), vm_1, "FailedSOPSequence", "Failed SOP Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x1199}, vr(VR::SQ), vm_1, "ReferencedSOPSequence", "Referenced SOP Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x119A}, vr(VR::SQ), vm_1, "OtherFailuresSequence", "Other Failures Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x119B}, vr(VR::SQ), vm_1, "FailedStudySequence", "Failed Study Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x1200}, vr(VR::SQ), vm_1, "StudiesContainingOtherReferencedInstancesSequence", "Studies Containing Other Referenced Instances Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x1250}, vr(VR::SQ), vm_1, "RelatedSeriesSequence", "Related Series Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x2110}, vr(VR::CS), vm_1, "LossyImageCompressionRetired", "Lossy Image Compression (Retired)", true},
     tag_info{dicom_tag{0x0008, 0x2111}, vr(VR::ST), vm_1, "DerivationDescription", "Derivation Description", false},
     tag_info{dicom_tag{0x0008, 0x2112}, vr(VR::SQ), vm_1, "SourceImageSequence", "Source Image Sequence", false},
-
-    // ========================================================================
-    // Patient Module (0x0010)
-    // ========================================================================
+    tag_info{dicom_tag{0x0008, 0x2120}, vr(VR::SH), vm_1, "StageName", "Stage Name", false},
+    tag_info{dicom_tag{0x0008, 0x2122}, vr(VR::IS), vm_1, "StageNumber", "Stage Number", false},
+    tag_info{dicom_tag{0x0008, 0x2124}, vr(VR::IS), vm_1, "NumberOfStages", "Number of Stages", false},
+    tag_info{dicom_tag{0x0008, 0x2127}, vr(VR::SH), vm_1, "ViewName", "View Name", false},
+    tag_info{dicom_tag{0x0008, 0x2128}, vr(VR::IS), vm_1, "ViewNumber", "View Number", false},
+    tag_info{dicom_tag{0x0008, 0x2129}, vr(VR::IS), vm_1, "NumberOfEventTimers", "Number of Event Timers", false},
+    tag_info{dicom_tag{0x0008, 0x212A}, vr(VR::IS), vm_1, "NumberOfViewsInStage", "Number of Views in Stage", false},
+    tag_info{dicom_tag{0x0008, 0x2130}, vr(VR::DS), vm_1_n, "EventElapsedTimes", "Event Elapsed Time(s)", false},
+    tag_info{dicom_tag{0x0008, 0x2132}, vr(VR::LO), vm_1_n, "EventTimerNames", "Event Timer Name(s)", false},
+    tag_info{dicom_tag{0x0008, 0x2133}, vr(VR::SQ), vm_1, "EventTimerSequence", "Event Timer Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x2134}, vr(VR::FD), vm_1, "EventTimeOffset", "Event Time Offset", false},
+    tag_info{dicom_tag{0x0008, 0x2135}, vr(VR::SQ), vm_1, "EventCodeSequence", "Event Code Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x2142}, vr(VR::IS), vm_1, "StartTrim", "Start Trim", false},
+    tag_info{dicom_tag{0x0008, 0x2143}, vr(VR::IS), vm_1, "StopTrim", "Stop Trim", false},
+    tag_info{dicom_tag{0x0008, 0x2144}, vr(VR::IS), vm_1, "RecommendedDisplayFrameRate", "Recommended Display Frame Rate", false},
+    tag_info{dicom_tag{0x0008, 0x2200}, vr(VR::CS), vm_1, "TransducerPosition", "Transducer Position", true},
+    tag_info{dicom_tag{0x0008, 0x2204}, vr(VR::CS), vm_1, "TransducerOrientation", "Transducer Orientation", true},
+    tag_info{dicom_tag{0x0008, 0x2208}, vr(VR::CS), vm_1, "AnatomicStructure", "Anatomic Structure", true},
+    tag_info{dicom_tag{0x0008, 0x2218}, vr(VR::SQ), vm_1, "AnatomicRegionSequence", "Anatomic Region Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x2220}, vr(VR::SQ), vm_1, "AnatomicRegionModifierSequence", "Anatomic Region Modifier Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x2228}, vr(VR::SQ), vm_1, "PrimaryAnatomicStructureSequence", "Primary Anatomic Structure Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x2229}, vr(VR::SQ), vm_1, "AnatomicStructureSpaceOrRegionSequence", "Anatomic Structure, Space or Region Sequence", true},
+    tag_info{dicom_tag{0x0008, 0x2230}, vr(VR::SQ), vm_1, "PrimaryAnatomicStructureModifierSequence", "Primary Anatomic Structure Modifier Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x2240}, vr(VR::SQ), vm_1, "TransducerPositionSequence", "Transducer Position Sequence", true},
+    tag_info{dicom_tag{0x0008, 0x2242}, vr(VR::SQ), vm_1, "TransducerPositionModifierSequence", "Transducer Position Modifier Sequence", true},
+    tag_info{dicom_tag{0x0008, 0x2244}, vr(VR::SQ), vm_1, "TransducerOrientationSequence", "Transducer Orientation Sequence", true},
+    tag_info{dicom_tag{0x0008, 0x2246}, vr(VR::SQ), vm_1, "TransducerOrientationModifierSequence", "Transducer Orientation Modifier Sequence", true},
+    tag_info{dicom_tag{0x0008, 0x2251}, vr(VR::SQ), vm_1, "AnatomicStructureSpaceOrRegionCodeSequenceTrial", "Anatomic Structure Space Or Region Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0008, 0x2253}, vr(VR::SQ), vm_1, "AnatomicPortalOfEntranceCodeSequenceTrial", "Anatomic Portal Of Entrance Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0008, 0x2255}, vr(VR::SQ), vm_1, "AnatomicApproachDirectionCodeSequenceTrial", "Anatomic Approach Direction Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0008, 0x2256}, vr(VR::ST), vm_1, "AnatomicPerspectiveDescriptionTrial", "Anatomic Perspective Description (Trial)", true},
+    tag_info{dicom_tag{0x0008, 0x2257}, vr(VR::SQ), vm_1, "AnatomicPerspectiveCodeSequenceTrial", "Anatomic Perspective Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0008, 0x2258}, vr(VR::ST), vm_1, "AnatomicLocationOfExaminingInstrumentDescriptionTrial", "Anatomic Location Of Examining Instrument Description (Trial)", true},
+    tag_info{dicom_tag{0x0008, 0x2259}, vr(VR::SQ), vm_1, "AnatomicLocationOfExaminingInstrumentCodeSequenceTrial", "Anatomic Location Of Examining Instrument Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0008, 0x225A}, vr(VR::SQ), vm_1, "AnatomicStructureSpaceOrRegionModifierCodeSequenceTrial", "Anatomic Structure Space Or Region Modifier Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0008, 0x225C}, vr(VR::SQ), vm_1, "OnAxisBackgroundAnatomicStructureCodeSequenceTrial", "On Axis Background Anatomic Structure Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0008, 0x3001}, vr(VR::SQ), vm_1, "AlternateRepresentationSequence", "Alternate Representation Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x3002}, vr(VR::UI), vm_1_n, "AvailableTransferSyntaxUID", "Available Transfer Syntax UID", false},
+    tag_info{dicom_tag{0x0008, 0x3010}, vr(VR::UI), vm_1_n, "IrradiationEventUID", "Irradiation Event UID", false},
+    tag_info{dicom_tag{0x0008, 0x3011}, vr(VR::SQ), vm_1, "SourceIrradiationEventSequence", "Source Irradiation Event Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x3012}, vr(VR::UI), vm_1, "RadiopharmaceuticalAdministrationEventUID", "Radiopharmaceutical Administration Event UID", false},
+    tag_info{dicom_tag{0x0008, 0x4000}, vr(VR::LT), vm_1, "IdentifyingComments", "Identifying Comments", true},
+    tag_info{dicom_tag{0x0008, 0x9007}, vr(VR::CS), vm_4_5, "FrameType", "Frame Type", false},
+    tag_info{dicom_tag{0x0008, 0x9092}, vr(VR::SQ), vm_1, "ReferencedImageEvidenceSequence", "Referenced Image Evidence Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x9121}, vr(VR::SQ), vm_1, "ReferencedRawDataSequence", "Referenced Raw Data Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x9123}, vr(VR::UI), vm_1, "CreatorVersionUID", "Creator-Version UID", false},
+    tag_info{dicom_tag{0x0008, 0x9124}, vr(VR::SQ), vm_1, "DerivationImageSequence", "Derivation Image Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x9154}, vr(VR::SQ), vm_1, "SourceImageEvidenceSequence", "Source Image Evidence Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x9205}, vr(VR::CS), vm_1, "PixelPresentation", "Pixel Presentation", false},
+    tag_info{dicom_tag{0x0008, 0x9206}, vr(VR::CS), vm_1, "VolumetricProperties", "Volumetric Properties", false},
+    tag_info{dicom_tag{0x0008, 0x9207}, vr(VR::CS), vm_1, "VolumeBasedCalculationTechnique", "Volume Based Calculation Technique", false},
+    tag_info{dicom_tag{0x0008, 0x9208}, vr(VR::CS), vm_1, "ComplexImageComponent", "Complex Image Component", false},
+    tag_info{dicom_tag{0x0008, 0x9209}, vr(VR::CS), vm_1, "AcquisitionContrast", "Acquisition Contrast", false},
+    tag_info{dicom_tag{0x0008, 0x9215}, vr(VR::SQ), vm_1, "DerivationCodeSequence", "Derivation Code Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x9237}, vr(VR::SQ), vm_1, "ReferencedPresentationStateSequence", "Referenced Presentation State Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x9410}, vr(VR::SQ), vm_1, "ReferencedOtherPlaneSequence", "Referenced Other Plane Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x9458}, vr(VR::SQ), vm_1, "FrameDisplaySequence", "Frame Display Sequence", false},
+    tag_info{dicom_tag{0x0008, 0x9459}, vr(VR::FL), vm_1, "RecommendedDisplayFrameRateInFloat", "Recommended Display Frame Rate in Float", false},
+    tag_info{dicom_tag{0x0008, 0x9460}, vr(VR::CS), vm_1, "SkipFrameRangeFlag", "Skip Frame Range Flag", false},
     tag_info{dicom_tag{0x0010, 0x0010}, vr(VR::PN), vm_1, "PatientName", "Patient's Name", false},
     tag_info{dicom_tag{0x0010, 0x0020}, vr(VR::LO), vm_1, "PatientID", "Patient ID", false},
     tag_info{dicom_tag{0x0010, 0x0021}, vr(VR::LO), vm_1, "IssuerOfPatientID", "Issuer of Patient ID", false},
     tag_info{dicom_tag{0x0010, 0x0022}, vr(VR::CS), vm_1, "TypeOfPatientID", "Type of Patient ID", false},
     tag_info{dicom_tag{0x0010, 0x0024}, vr(VR::SQ), vm_1, "IssuerOfPatientIDQualifiersSequence", "Issuer of Patient ID Qualifiers Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x0026}, vr(VR::SQ), vm_1, "SourcePatientGroupIdentificationSequence", "Source Patient Group Identification Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x0027}, vr(VR::SQ), vm_1, "GroupOfPatientsIdentificationSequence", "Group of Patients Identification Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x0028}, vr(VR::US), vm_3, "SubjectRelativePositionInImage", "Subject Relative Position in Image", false},
     tag_info{dicom_tag{0x0010, 0x0030}, vr(VR::DA), vm_1, "PatientBirthDate", "Patient's Birth Date", false},
     tag_info{dicom_tag{0x0010, 0x0032}, vr(VR::TM), vm_1, "PatientBirthTime", "Patient's Birth Time", false},
+    tag_info{dicom_tag{0x0010, 0x0033}, vr(VR::LO), vm_1, "PatientBirthDateInAlternativeCalendar", "Patient's Birth Date in Alternative Calendar", false},
+    tag_info{dicom_tag{0x0010, 0x0034}, vr(VR::LO), vm_1, "PatientDeathDateInAlternativeCalendar", "Patient's Death Date in Alternative Calendar", false},
+    tag_info{dicom_tag{0x0010, 0x0035}, vr(VR::CS), vm_1, "PatientAlternativeCalendar", "Patient's Alternative Calendar", false},
     tag_info{dicom_tag{0x0010, 0x0040}, vr(VR::CS), vm_1, "PatientSex", "Patient's Sex", false},
     tag_info{dicom_tag{0x0010, 0x0050}, vr(VR::SQ), vm_1, "PatientInsurancePlanCodeSequence", "Patient's Insurance Plan Code Sequence", false},
     tag_info{dicom_tag{0x0010, 0x0101}, vr(VR::SQ), vm_1, "PatientPrimaryLanguageCodeSequence", "Patient's Primary Language Code Sequence", false},
     tag_info{dicom_tag{0x0010, 0x0102}, vr(VR::SQ), vm_1, "PatientPrimaryLanguageModifierCodeSequence", "Patient's Primary Language Modifier Code Sequence", false},
-    tag_info{dicom_tag{0x0010, 0x1000}, vr(VR::LO), vm_1_n, "OtherPatientIDs", "Other Patient IDs", true},  // Retired
+    tag_info{dicom_tag{0x0010, 0x0200}, vr(VR::CS), vm_1, "QualityControlSubject", "Quality Control Subject", false},
+    tag_info{dicom_tag{0x0010, 0x0201}, vr(VR::SQ), vm_1, "QualityControlSubjectTypeCodeSequence", "Quality Control Subject Type Code Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x0212}, vr(VR::UC), vm_1, "StrainDescription", "Strain Description", false},
+    tag_info{dicom_tag{0x0010, 0x0213}, vr(VR::LO), vm_1, "StrainNomenclature", "Strain Nomenclature", false},
+    tag_info{dicom_tag{0x0010, 0x0214}, vr(VR::LO), vm_1, "StrainStockNumber", "Strain Stock Number", false},
+    tag_info{dicom_tag{0x0010, 0x0215}, vr(VR::SQ), vm_1, "StrainSourceRegistryCodeSequence", "Strain Source Registry Code Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x0216}, vr(VR::SQ), vm_1, "StrainStockSequence", "Strain Stock Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x0217}, vr(VR::LO), vm_1, "StrainSource", "Strain Source", false},
+    tag_info{dicom_tag{0x0010, 0x0218}, vr(VR::UT), vm_1, "StrainAdditionalInformation", "Strain Additional Information", false},
+    tag_info{dicom_tag{0x0010, 0x0219}, vr(VR::SQ), vm_1, "StrainCodeSequence", "Strain Code Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x0221}, vr(VR::SQ), vm_1, "GeneticModificationsSequence", "Genetic Modifications Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x0222}, vr(VR::UC), vm_1, "GeneticModificationsDescription", "Genetic Modifications Description", false},
+    tag_info{dicom_tag{0x0010, 0x0223}, vr(VR::LO), vm_1, "GeneticModificationsNomenclature", "Genetic Modifications Nomenclature", false},
+    tag_info{dicom_tag{0x0010, 0x0229}, vr(VR::SQ), vm_1, "GeneticModificationsCodeSequence", "Genetic Modifications Code Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x1000}, vr(VR::LO), vm_1_n, "OtherPatientIDs", "Other Patient IDs", true},
     tag_info{dicom_tag{0x0010, 0x1001}, vr(VR::PN), vm_1_n, "OtherPatientNames", "Other Patient Names", false},
     tag_info{dicom_tag{0x0010, 0x1002}, vr(VR::SQ), vm_1, "OtherPatientIDsSequence", "Other Patient IDs Sequence", false},
     tag_info{dicom_tag{0x0010, 0x1005}, vr(VR::PN), vm_1, "PatientBirthName", "Patient's Birth Name", false},
     tag_info{dicom_tag{0x0010, 0x1010}, vr(VR::AS), vm_1, "PatientAge", "Patient's Age", false},
     tag_info{dicom_tag{0x0010, 0x1020}, vr(VR::DS), vm_1, "PatientSize", "Patient's Size", false},
+    tag_info{dicom_tag{0x0010, 0x1021}, vr(VR::SQ), vm_1, "PatientSizeCodeSequence", "Patient's Size Code Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x1022}, vr(VR::DS), vm_1, "PatientBodyMassIndex", "Patient's Body Mass Index", false},
+    tag_info{dicom_tag{0x0010, 0x1023}, vr(VR::DS), vm_1, "MeasuredAPDimension", "Measured AP Dimension", false},
+    tag_info{dicom_tag{0x0010, 0x1024}, vr(VR::DS), vm_1, "MeasuredLateralDimension", "Measured Lateral Dimension", false},
     tag_info{dicom_tag{0x0010, 0x1030}, vr(VR::DS), vm_1, "PatientWeight", "Patient's Weight", false},
     tag_info{dicom_tag{0x0010, 0x1040}, vr(VR::LO), vm_1, "PatientAddress", "Patient's Address", false},
+    tag_info{dicom_tag{0x0010, 0x1050}, vr(VR::LO), vm_1_n, "InsurancePlanIdentification", "Insurance Plan Identification", true},
+    tag_info{dicom_tag{0x0010, 0x1060}, vr(VR::PN), vm_1, "PatientMotherBirthName", "Patient's Mother's Birth Name", false},
+    tag_info{dicom_tag{0x0010, 0x1080}, vr(VR::LO), vm_1, "MilitaryRank", "Military Rank", false},
+    tag_info{dicom_tag{0x0010, 0x1081}, vr(VR::LO), vm_1, "BranchOfService", "Branch of Service", false},
+    tag_info{dicom_tag{0x0010, 0x1090}, vr(VR::LO), vm_1, "MedicalRecordLocator", "Medical Record Locator", true},
+    tag_info{dicom_tag{0x0010, 0x1100}, vr(VR::SQ), vm_1, "ReferencedPatientPhotoSequence", "Referenced Patient Photo Sequence", false},
     tag_info{dicom_tag{0x0010, 0x2000}, vr(VR::LO), vm_1_n, "MedicalAlerts", "Medical Alerts", false},
     tag_info{dicom_tag{0x0010, 0x2110}, vr(VR::LO), vm_1_n, "Allergies", "Allergies", false},
     tag_info{dicom_tag{0x0010, 0x2150}, vr(VR::LO), vm_1, "CountryOfResidence", "Country of Residence", false},
     tag_info{dicom_tag{0x0010, 0x2152}, vr(VR::LO), vm_1, "RegionOfResidence", "Region of Residence", false},
     tag_info{dicom_tag{0x0010, 0x2154}, vr(VR::SH), vm_1_n, "PatientTelephoneNumbers", "Patient's Telephone Numbers", false},
+    tag_info{dicom_tag{0x0010, 0x2155}, vr(VR::LT), vm_1, "PatientTelecomInformation", "Patient's Telecom Information", false},
     tag_info{dicom_tag{0x0010, 0x2160}, vr(VR::SH), vm_1, "EthnicGroup", "Ethnic Group", false},
+    tag_info{dicom_tag{0x0010, 0x2161}, vr(VR::SQ), vm_1, "EthnicGroupCodeSequence", "Ethnic Group Code Sequence", false},
     tag_info{dicom_tag{0x0010, 0x2180}, vr(VR::SH), vm_1, "Occupation", "Occupation", false},
     tag_info{dicom_tag{0x0010, 0x21A0}, vr(VR::CS), vm_1, "SmokingStatus", "Smoking Status", false},
     tag_info{dicom_tag{0x0010, 0x21B0}, vr(VR::LT), vm_1, "AdditionalPatientHistory", "Additional Patient History", false},
     tag_info{dicom_tag{0x0010, 0x21C0}, vr(VR::US), vm_1, "PregnancyStatus", "Pregnancy Status", false},
     tag_info{dicom_tag{0x0010, 0x21D0}, vr(VR::DA), vm_1, "LastMenstrualDate", "Last Menstrual Date", false},
     tag_info{dicom_tag{0x0010, 0x21F0}, vr(VR::LO), vm_1, "PatientReligiousPreference", "Patient's Religious Preference", false},
+    tag_info{dicom_tag{0x0010, 0x2201}, vr(VR::LO), vm_1, "PatientSpeciesDescription", "Patient Species Description", false},
+    tag_info{dicom_tag{0x0010, 0x2202}, vr(VR::SQ), vm_1, "PatientSpeciesCodeSequence", "Patient Species Code Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x2203}, vr(VR::CS), vm_1, "PatientSexNeutered", "Patient's Sex Neutered", false},
+    tag_info{dicom_tag{0x0010, 0x2210}, vr(VR::CS), vm_1, "AnatomicalOrientationType", "Anatomical Orientation Type", false},
+    tag_info{dicom_tag{0x0010, 0x2292}, vr(VR::LO), vm_1, "PatientBreedDescription", "Patient Breed Description", false},
+    tag_info{dicom_tag{0x0010, 0x2293}, vr(VR::SQ), vm_1, "PatientBreedCodeSequence", "Patient Breed Code Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x2294}, vr(VR::SQ), vm_1, "BreedRegistrationSequence", "Breed Registration Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x2295}, vr(VR::LO), vm_1, "BreedRegistrationNumber", "Breed Registration Number", false},
+    tag_info{dicom_tag{0x0010, 0x2296}, vr(VR::SQ), vm_1, "BreedRegistryCodeSequence", "Breed Registry Code Sequence", false},
+    tag_info{dicom_tag{0x0010, 0x2297}, vr(VR::PN), vm_1, "ResponsiblePerson", "Responsible Person", false},
+    tag_info{dicom_tag{0x0010, 0x2298}, vr(VR::CS), vm_1, "ResponsiblePersonRole", "Responsible Person Role", false},
+    tag_info{dicom_tag{0x0010, 0x2299}, vr(VR::LO), vm_1, "ResponsibleOrganization", "Responsible Organization", false},
     tag_info{dicom_tag{0x0010, 0x4000}, vr(VR::LT), vm_1, "PatientComments", "Patient Comments", false},
-
-    // ========================================================================
-    // Study and Series Identification (0x0020)
-    // ========================================================================
+    tag_info{dicom_tag{0x0010, 0x9431}, vr(VR::FL), vm_1, "ExaminedBodyThickness", "Examined Body Thickness", false},
+    tag_info{dicom_tag{0x0012, 0x0010}, vr(VR::LO), vm_1, "ClinicalTrialSponsorName", "Clinical Trial Sponsor Name", false},
+    tag_info{dicom_tag{0x0012, 0x0020}, vr(VR::LO), vm_1, "ClinicalTrialProtocolID", "Clinical Trial Protocol ID", false},
+    tag_info{dicom_tag{0x0012, 0x0021}, vr(VR::LO), vm_1, "ClinicalTrialProtocolName", "Clinical Trial Protocol Name", false},
+    tag_info{dicom_tag{0x0012, 0x0022}, vr(VR::LO), vm_1, "IssuerOfClinicalTrialProtocolID", "Issuer of Clinical Trial Protocol ID", false},
+    tag_info{dicom_tag{0x0012, 0x0023}, vr(VR::SQ), vm_1, "OtherClinicalTrialProtocolIDsSequence", "Other Clinical Trial Protocol IDs Sequence", false},
+    tag_info{dicom_tag{0x0012, 0x0030}, vr(VR::LO), vm_1, "ClinicalTrialSiteID", "Clinical Trial Site ID", false},
+    tag_info{dicom_tag{0x0012, 0x0031}, vr(VR::LO), vm_1, "ClinicalTrialSiteName", "Clinical Trial Site Name", false},
+    tag_info{dicom_tag{0x0012, 0x0032}, vr(VR::LO), vm_1, "IssuerOfClinicalTrialSiteID", "Issuer of Clinical Trial Site ID", false},
+    tag_info{dicom_tag{0x0012, 0x0040}, vr(VR::LO), vm_1, "ClinicalTrialSubjectID", "Clinical Trial Subject ID", false},
+    tag_info{dicom_tag{0x0012, 0x0041}, vr(VR::LO), vm_1, "IssuerOfClinicalTrialSubjectID", "Issuer of Clinical Trial Subject ID", false},
+    tag_info{dicom_tag{0x0012, 0x0042}, vr(VR::LO), vm_1, "ClinicalTrialSubjectReadingID", "Clinical Trial Subject Reading ID", false},
+    tag_info{dicom_tag{0x0012, 0x0043}, vr(VR::LO), vm_1, "IssuerOfClinicalTrialSubjectReadingID", "Issuer of Clinical Trial Subject Reading ID", false},
+    tag_info{dicom_tag{0x0012, 0x0050}, vr(VR::LO), vm_1, "ClinicalTrialTimePointID", "Clinical Trial Time Point ID", false},
+    tag_info{dicom_tag{0x0012, 0x0051}, vr(VR::ST), vm_1, "ClinicalTrialTimePointDescription", "Clinical Trial Time Point Description", false},
+    tag_info{dicom_tag{0x0012, 0x0052}, vr(VR::FD), vm_1, "LongitudinalTemporalOffsetFromEvent", "Longitudinal Temporal Offset from Event", false},
+    tag_info{dicom_tag{0x0012, 0x0053}, vr(VR::CS), vm_1, "LongitudinalTemporalEventType", "Longitudinal Temporal Event Type", false},
+    tag_info{dicom_tag{0x0012, 0x0054}, vr(VR::SQ), vm_1, "ClinicalTrialTimePointTypeCodeSequence", "Clinical Trial Time Point Type Code Sequence", false},
+    tag_info{dicom_tag{0x0012, 0x0055}, vr(VR::LO), vm_1, "IssuerOfClinicalTrialTimePointID", "Issuer of Clinical Trial Time Point ID", false},
+    tag_info{dicom_tag{0x0012, 0x0060}, vr(VR::LO), vm_1, "ClinicalTrialCoordinatingCenterName", "Clinical Trial Coordinating Center Name", false},
+    tag_info{dicom_tag{0x0012, 0x0062}, vr(VR::CS), vm_1, "PatientIdentityRemoved", "Patient Identity Removed", false},
+    tag_info{dicom_tag{0x0012, 0x0063}, vr(VR::LO), vm_1_n, "DeidentificationMethod", "De-identification Method", false},
+    tag_info{dicom_tag{0x0012, 0x0064}, vr(VR::SQ), vm_1, "DeidentificationMethodCodeSequence", "De-identification Method Code Sequence", false},
+    tag_info{dicom_tag{0x0012, 0x0071}, vr(VR::LO), vm_1, "ClinicalTrialSeriesID", "Clinical Trial Series ID", false},
+    tag_info{dicom_tag{0x0012, 0x0072}, vr(VR::LO), vm_1, "ClinicalTrialSeriesDescription", "Clinical Trial Series Description", false},
+    tag_info{dicom_tag{0x0012, 0x0073}, vr(VR::LO), vm_1, "IssuerOfClinicalTrialSeriesID", "Issuer of Clinical Trial Series ID", false},
+    tag_info{dicom_tag{0x0012, 0x0081}, vr(VR::LO), vm_1, "ClinicalTrialProtocolEthicsCommitteeName", "Clinical Trial Protocol Ethics Committee Name", false},
+    tag_info{dicom_tag{0x0012, 0x0082}, vr(VR::LO), vm_1, "ClinicalTrialProtocolEthicsCommitteeApprovalNumber", "Clinical Trial Protocol Ethics Committee Approval Number", false},
+    tag_info{dicom_tag{0x0012, 0x0083}, vr(VR::SQ), vm_1, "ConsentForClinicalTrialUseSequence", "Consent for Clinical Trial Use Sequence", false},
+    tag_info{dicom_tag{0x0012, 0x0084}, vr(VR::CS), vm_1, "DistributionType", "Distribution Type", false},
+    tag_info{dicom_tag{0x0012, 0x0085}, vr(VR::CS), vm_1, "ConsentForDistributionFlag", "Consent for Distribution Flag", false},
+    tag_info{dicom_tag{0x0012, 0x0086}, vr(VR::DA), vm_1, "EthicsCommitteeApprovalEffectivenessStartDate", "Ethics Committee Approval Effectiveness Start Date", false},
+    tag_info{dicom_tag{0x0012, 0x0087}, vr(VR::DA), vm_1, "EthicsCommitteeApprovalEffectivenessEndDate", "Ethics Committee Approval Effectiveness End Date", false},
+    tag_info{dicom_tag{0x0014, 0x0023}, vr(VR::ST), vm_1, "CADFileFormat", "CAD File Format", true},
+    tag_info{dicom_tag{0x0014, 0x0024}, vr(VR::ST), vm_1, "ComponentReferenceSystem", "Component Reference System", true},
+    tag_info{dicom_tag{0x0014, 0x0025}, vr(VR::ST), vm_1, "ComponentManufacturingProcedure", "Component Manufacturing Procedure", false},
+    tag_info{dicom_tag{0x0014, 0x0028}, vr(VR::ST), vm_1, "ComponentManufacturer", "Component Manufacturer", false},
+    tag_info{dicom_tag{0x0014, 0x0030}, vr(VR::DS), vm_1_n, "MaterialThickness", "Material Thickness", false},
+    tag_info{dicom_tag{0x0014, 0x0032}, vr(VR::DS), vm_1_n, "MaterialPipeDiameter", "Material Pipe Diameter", false},
+    tag_info{dicom_tag{0x0014, 0x0034}, vr(VR::DS), vm_1_n, "MaterialIsolationDiameter", "Material Isolation Diameter", false},
+    tag_info{dicom_tag{0x0014, 0x0042}, vr(VR::ST), vm_1, "MaterialGrade", "Material Grade", false},
+    tag_info{dicom_tag{0x0014, 0x0044}, vr(VR::ST), vm_1, "MaterialPropertiesDescription", "Material Properties Description", false},
+    tag_info{dicom_tag{0x0014, 0x0045}, vr(VR::ST), vm_1, "MaterialPropertiesFileFormatRetired", "Material Properties File Format (Retired)", true},
+    tag_info{dicom_tag{0x0014, 0x0046}, vr(VR::LT), vm_1, "MaterialNotes", "Material Notes", false},
+    tag_info{dicom_tag{0x0014, 0x0050}, vr(VR::CS), vm_1, "ComponentShape", "Component Shape", false},
+    tag_info{dicom_tag{0x0014, 0x0052}, vr(VR::CS), vm_1, "CurvatureType", "Curvature Type", false},
+    tag_info{dicom_tag{0x0014, 0x0054}, vr(VR::DS), vm_1, "OuterDiameter", "Outer Diameter", false},
+    tag_info{dicom_tag{0x0014, 0x0056}, vr(VR::DS), vm_1, "InnerDiameter", "Inner Diameter", false},
+    tag_info{dicom_tag{0x0014, 0x0100}, vr(VR::LO), vm_1_n, "ComponentWelderIDs", "Component Welder IDs", false},
+    tag_info{dicom_tag{0x0014, 0x0101}, vr(VR::CS), vm_1, "SecondaryApprovalStatus", "Secondary Approval Status", false},
+    tag_info{dicom_tag{0x0014, 0x0102}, vr(VR::DA), vm_1, "SecondaryReviewDate", "Secondary Review Date", false},
+    tag_info{dicom_tag{0x0014, 0x0103}, vr(VR::TM), vm_1, "SecondaryReviewTime", "Secondary Review Time", false},
+    tag_info{dicom_tag{0x0014, 0x0104}, vr(VR::PN), vm_1, "SecondaryReviewerName", "Secondary Reviewer Name", false},
+    tag_info{dicom_tag{0x0014, 0x0105}, vr(VR::ST), vm_1, "RepairID", "Repair ID", false},
+    tag_info{dicom_tag{0x0014, 0x0106}, vr(VR::SQ), vm_1, "MultipleComponentApprovalSequence", "Multiple Component Approval Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x0107}, vr(VR::CS), vm_1_n, "OtherApprovalStatus", "Other Approval Status", false},
+    tag_info{dicom_tag{0x0014, 0x0108}, vr(VR::CS), vm_1_n, "OtherSecondaryApprovalStatus", "Other Secondary Approval Status", false},
+    tag_info{dicom_tag{0x0014, 0x0200}, vr(VR::SQ), vm_1, "DataElementLabelSequence", "Data Element Label Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x0201}, vr(VR::SQ), vm_1, "DataElementLabelItemSequence", "Data Element Label Item Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x0202}, vr(VR::AT), vm_1, "DataElement", "Data Element", false},
+    tag_info{dicom_tag{0x0014, 0x0203}, vr(VR::LO), vm_1, "DataElementName", "Data Element Name", false},
+    tag_info{dicom_tag{0x0014, 0x0204}, vr(VR::LO), vm_1, "DataElementDescription", "Data Element Description", false},
+    tag_info{dicom_tag{0x0014, 0x0205}, vr(VR::CS), vm_1, "DataElementConditionality", "Data Element Conditionality", false},
+    tag_info{dicom_tag{0x0014, 0x0206}, vr(VR::IS), vm_1, "DataElementMinimumCharacters", "Data Element Minimum Characters", false},
+    tag_info{dicom_tag{0x0014, 0x0207}, vr(VR::IS), vm_1, "DataElementMaximumCharacters", "Data Element Maximum Characters", false},
+    tag_info{dicom_tag{0x0014, 0x1010}, vr(VR::ST), vm_1, "ActualEnvironmentalConditions", "Actual Environmental Conditions", false},
+    tag_info{dicom_tag{0x0014, 0x1020}, vr(VR::DA), vm_1, "ExpiryDate", "Expiry Date", false},
+    tag_info{dicom_tag{0x0014, 0x1040}, vr(VR::ST), vm_1, "EnvironmentalConditions", "Environmental Conditions", false},
+    tag_info{dicom_tag{0x0014, 0x2002}, vr(VR::SQ), vm_1, "EvaluatorSequence", "Evaluator Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x2004}, vr(VR::IS), vm_1, "EvaluatorNumber", "Evaluator Number", false},
+    tag_info{dicom_tag{0x0014, 0x2006}, vr(VR::PN), vm_1, "EvaluatorName", "Evaluator Name", false},
+    tag_info{dicom_tag{0x0014, 0x2008}, vr(VR::IS), vm_1, "EvaluationAttempt", "Evaluation Attempt", false},
+    tag_info{dicom_tag{0x0014, 0x2012}, vr(VR::SQ), vm_1, "IndicationSequence", "Indication Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x2014}, vr(VR::IS), vm_1, "IndicationNumber", "Indication Number", false},
+    tag_info{dicom_tag{0x0014, 0x2016}, vr(VR::SH), vm_1, "IndicationLabel", "Indication Label", false},
+    tag_info{dicom_tag{0x0014, 0x2018}, vr(VR::ST), vm_1, "IndicationDescription", "Indication Description", false},
+    tag_info{dicom_tag{0x0014, 0x201A}, vr(VR::CS), vm_1_n, "IndicationType", "Indication Type", false},
+    tag_info{dicom_tag{0x0014, 0x201C}, vr(VR::CS), vm_1, "IndicationDisposition", "Indication Disposition", false},
+    tag_info{dicom_tag{0x0014, 0x201E}, vr(VR::SQ), vm_1, "IndicationROISequence", "Indication ROI Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x2030}, vr(VR::SQ), vm_1, "IndicationPhysicalPropertySequence", "Indication Physical Property Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x2032}, vr(VR::SH), vm_1, "PropertyLabel", "Property Label", false},
+    tag_info{dicom_tag{0x0014, 0x2202}, vr(VR::IS), vm_1, "CoordinateSystemNumberOfAxes", "Coordinate System Number of Axes", false},
+    tag_info{dicom_tag{0x0014, 0x2204}, vr(VR::SQ), vm_1, "CoordinateSystemAxesSequence", "Coordinate System Axes Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x2206}, vr(VR::ST), vm_1, "CoordinateSystemAxisDescription", "Coordinate System Axis Description", false},
+    tag_info{dicom_tag{0x0014, 0x2208}, vr(VR::CS), vm_1, "CoordinateSystemDataSetMapping", "Coordinate System Data Set Mapping", false},
+    tag_info{dicom_tag{0x0014, 0x220A}, vr(VR::IS), vm_1, "CoordinateSystemAxisNumber", "Coordinate System Axis Number", false},
+    tag_info{dicom_tag{0x0014, 0x220C}, vr(VR::CS), vm_1, "CoordinateSystemAxisType", "Coordinate System Axis Type", false},
+    tag_info{dicom_tag{0x0014, 0x220E}, vr(VR::CS), vm_1, "CoordinateSystemAxisUnits", "Coordinate System Axis Units", false},
+    tag_info{dicom_tag{0x0014, 0x2210}, vr(VR::OB), vm_1, "CoordinateSystemAxisValues", "Coordinate System Axis Values", false},
+    tag_info{dicom_tag{0x0014, 0x2220}, vr(VR::SQ), vm_1, "CoordinateSystemTransformSequence", "Coordinate System Transform Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x2222}, vr(VR::ST), vm_1, "TransformDescription", "Transform Description", false},
+    tag_info{dicom_tag{0x0014, 0x2224}, vr(VR::IS), vm_1, "TransformNumberOfAxes", "Transform Number of Axes", false},
+    tag_info{dicom_tag{0x0014, 0x2226}, vr(VR::IS), vm_1_n, "TransformOrderOfAxes", "Transform Order of Axes", false},
+    tag_info{dicom_tag{0x0014, 0x2228}, vr(VR::CS), vm_1, "TransformedAxisUnits", "Transformed Axis Units", false},
+    tag_info{dicom_tag{0x0014, 0x222A}, vr(VR::DS), vm_1_n, "CoordinateSystemTransformRotationAndScaleMatrix", "Coordinate System Transform Rotation and Scale Matrix", false},
+    tag_info{dicom_tag{0x0014, 0x222C}, vr(VR::DS), vm_1_n, "CoordinateSystemTransformTranslationMatrix", "Coordinate System Transform Translation Matrix", false},
+    tag_info{dicom_tag{0x0014, 0x3011}, vr(VR::DS), vm_1, "InternalDetectorFrameTime", "Internal Detector Frame Time", false},
+    tag_info{dicom_tag{0x0014, 0x3012}, vr(VR::DS), vm_1, "NumberOfFramesIntegrated", "Number of Frames Integrated", false},
+    tag_info{dicom_tag{0x0014, 0x3020}, vr(VR::SQ), vm_1, "DetectorTemperatureSequence", "Detector Temperature Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x3022}, vr(VR::ST), vm_1, "SensorName", "Sensor Name", false},
+    tag_info{dicom_tag{0x0014, 0x3024}, vr(VR::DS), vm_1, "HorizontalOffsetOfSensor", "Horizontal Offset of Sensor", false},
+    tag_info{dicom_tag{0x0014, 0x3026}, vr(VR::DS), vm_1, "VerticalOffsetOfSensor", "Vertical Offset of Sensor", false},
+    tag_info{dicom_tag{0x0014, 0x3028}, vr(VR::DS), vm_1, "SensorTemperature", "Sensor Temperature", false},
+    tag_info{dicom_tag{0x0014, 0x3040}, vr(VR::SQ), vm_1, "DarkCurrentSequence", "Dark Current Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x3050}, vr(VR::OW), vm_1, "DarkCurrentCounts", "Dark Current Counts", false},
+    tag_info{dicom_tag{0x0014, 0x3060}, vr(VR::SQ), vm_1, "GainCorrectionReferenceSequence", "Gain Correction Reference Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x3070}, vr(VR::OW), vm_1, "AirCounts", "Air Counts", false},
+    tag_info{dicom_tag{0x0014, 0x3071}, vr(VR::DS), vm_1, "KVUsedInGainCalibration", "KV Used in Gain Calibration", false},
+    tag_info{dicom_tag{0x0014, 0x3072}, vr(VR::DS), vm_1, "MAUsedInGainCalibration", "MA Used in Gain Calibration", false},
+    tag_info{dicom_tag{0x0014, 0x3073}, vr(VR::DS), vm_1, "NumberOfFramesUsedForIntegration", "Number of Frames Used for Integration", false},
+    tag_info{dicom_tag{0x0014, 0x3074}, vr(VR::LO), vm_1, "FilterMaterialUsedInGainCalibration", "Filter Material Used in Gain Calibration", false},
+    tag_info{dicom_tag{0x0014, 0x3075}, vr(VR::DS), vm_1, "FilterThicknessUsedInGainCalibration", "Filter Thickness Used in Gain Calibration", false},
+    tag_info{dicom_tag{0x0014, 0x3076}, vr(VR::DA), vm_1, "DateOfGainCalibration", "Date of Gain Calibration", false},
+    tag_info{dicom_tag{0x0014, 0x3077}, vr(VR::TM), vm_1, "TimeOfGainCalibration", "Time of Gain Calibration", false},
+    tag_info{dicom_tag{0x0014, 0x3080}, vr(VR::OB), vm_1, "BadPixelImage", "Bad Pixel Image", false},
+    tag_info{dicom_tag{0x0014, 0x3099}, vr(VR::LT), vm_1, "CalibrationNotes", "Calibration Notes", false},
+    tag_info{dicom_tag{0x0014, 0x3100}, vr(VR::LT), vm_1, "LinearityCorrectionTechnique", "Linearity Correction Technique", false},
+    tag_info{dicom_tag{0x0014, 0x3101}, vr(VR::LT), vm_1, "BeamHardeningCorrectionTechnique", "Beam Hardening Correction Technique", false},
+    tag_info{dicom_tag{0x0014, 0x4002}, vr(VR::SQ), vm_1, "PulserEquipmentSequence", "Pulser Equipment Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4004}, vr(VR::CS), vm_1, "PulserType", "Pulser Type", false},
+    tag_info{dicom_tag{0x0014, 0x4006}, vr(VR::LT), vm_1, "PulserNotes", "Pulser Notes", false},
+    tag_info{dicom_tag{0x0014, 0x4008}, vr(VR::SQ), vm_1, "ReceiverEquipmentSequence", "Receiver Equipment Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x400A}, vr(VR::CS), vm_1, "AmplifierType", "Amplifier Type", false},
+    tag_info{dicom_tag{0x0014, 0x400C}, vr(VR::LT), vm_1, "ReceiverNotes", "Receiver Notes", false},
+    tag_info{dicom_tag{0x0014, 0x400E}, vr(VR::SQ), vm_1, "PreAmplifierEquipmentSequence", "Pre-Amplifier Equipment Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x400F}, vr(VR::LT), vm_1, "PreAmplifierNotes", "Pre-Amplifier Notes", false},
+    tag_info{dicom_tag{0x0014, 0x4010}, vr(VR::SQ), vm_1, "TransmitTransducerSequence", "Transmit Transducer Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4011}, vr(VR::SQ), vm_1, "ReceiveTransducerSequence", "Receive Transducer Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4012}, vr(VR::US), vm_1, "NumberOfElements", "Number of Elements", false},
+    tag_info{dicom_tag{0x0014, 0x4013}, vr(VR::CS), vm_1, "ElementShape", "Element Shape", false},
+    tag_info{dicom_tag{0x0014, 0x4014}, vr(VR::DS), vm_1, "ElementDimensionA", "Element Dimension A", false},
+    tag_info{dicom_tag{0x0014, 0x4015}, vr(VR::DS), vm_1, "ElementDimensionB", "Element Dimension B", false},
+    tag_info{dicom_tag{0x0014, 0x4016}, vr(VR::DS), vm_1, "ElementPitchA", "Element Pitch A", false},
+    tag_info{dicom_tag{0x0014, 0x4017}, vr(VR::DS), vm_1, "MeasuredBeamDimensionA", "Measured Beam Dimension A", false},
+    tag_info{dicom_tag{0x0014, 0x4018}, vr(VR::DS), vm_1, "MeasuredBeamDimensionB", "Measured Beam Dimension B", false},
+    tag_info{dicom_tag{0x0014, 0x4019}, vr(VR::DS), vm_1, "LocationOfMeasuredBeamDiameter", "Location of Measured Beam Diameter", false},
+    tag_info{dicom_tag{0x0014, 0x401A}, vr(VR::DS), vm_1, "NominalFrequency", "Nominal Frequency", false},
+    tag_info{dicom_tag{0x0014, 0x401B}, vr(VR::DS), vm_1, "MeasuredCenterFrequency", "Measured Center Frequency", false},
+    tag_info{dicom_tag{0x0014, 0x401C}, vr(VR::DS), vm_1, "MeasuredBandwidth", "Measured Bandwidth", false},
+    tag_info{dicom_tag{0x0014, 0x401D}, vr(VR::DS), vm_1, "ElementPitchB", "Element Pitch B", false},
+    tag_info{dicom_tag{0x0014, 0x4020}, vr(VR::SQ), vm_1, "PulserSettingsSequence", "Pulser Settings Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4022}, vr(VR::DS), vm_1, "PulseWidth", "Pulse Width", false},
+    tag_info{dicom_tag{0x0014, 0x4024}, vr(VR::DS), vm_1, "ExcitationFrequency", "Excitation Frequency", false},
+    tag_info{dicom_tag{0x0014, 0x4026}, vr(VR::CS), vm_1, "ModulationType", "Modulation Type", false},
+    tag_info{dicom_tag{0x0014, 0x4028}, vr(VR::DS), vm_1, "Damping", "Damping", false},
+    tag_info{dicom_tag{0x0014, 0x4030}, vr(VR::SQ), vm_1, "ReceiverSettingsSequence", "Receiver Settings Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4031}, vr(VR::DS), vm_1, "AcquiredSoundpathLength", "Acquired Soundpath Length", false},
+    tag_info{dicom_tag{0x0014, 0x4032}, vr(VR::CS), vm_1, "AcquisitionCompressionType", "Acquisition Compression Type", false},
+    tag_info{dicom_tag{0x0014, 0x4033}, vr(VR::IS), vm_1, "AcquisitionSampleSize", "Acquisition Sample Size", false},
+    tag_info{dicom_tag{0x0014, 0x4034}, vr(VR::DS), vm_1, "RectifierSmoothing", "Rectifier Smoothing", false},
+    tag_info{dicom_tag{0x0014, 0x4035}, vr(VR::SQ), vm_1, "DACSequence", "DAC Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4036}, vr(VR::CS), vm_1, "DACType", "DAC Type", false},
+    tag_info{dicom_tag{0x0014, 0x4038}, vr(VR::DS), vm_1_n, "DACGainPoints", "DAC Gain Points", false},
+    tag_info{dicom_tag{0x0014, 0x403A}, vr(VR::DS), vm_1_n, "DACTimePoints", "DAC Time Points", false},
+    tag_info{dicom_tag{0x0014, 0x403C}, vr(VR::DS), vm_1_n, "DACAmplitude", "DAC Amplitude", false},
+    tag_info{dicom_tag{0x0014, 0x4040}, vr(VR::SQ), vm_1, "PreAmplifierSettingsSequence", "Pre-Amplifier Settings Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4050}, vr(VR::SQ), vm_1, "TransmitTransducerSettingsSequence", "Transmit Transducer Settings Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4051}, vr(VR::SQ), vm_1, "ReceiveTransducerSettingsSequence", "Receive Transducer Settings Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4052}, vr(VR::DS), vm_1, "IncidentAngle", "Incident Angle", false},
+    tag_info{dicom_tag{0x0014, 0x4054}, vr(VR::ST), vm_1, "CouplingTechnique", "Coupling Technique", false},
+    tag_info{dicom_tag{0x0014, 0x4056}, vr(VR::ST), vm_1, "CouplingMedium", "Coupling Medium", false},
+    tag_info{dicom_tag{0x0014, 0x4057}, vr(VR::DS), vm_1, "CouplingVelocity", "Coupling Velocity", false},
+    tag_info{dicom_tag{0x0014, 0x4058}, vr(VR::DS), vm_1, "ProbeCenterLocationX", "Probe Center Location X", false},
+    tag_info{dicom_tag{0x0014, 0x4059}, vr(VR::DS), vm_1, "ProbeCenterLocationZ", "Probe Center Location Z", false},
+    tag_info{dicom_tag{0x0014, 0x405A}, vr(VR::DS), vm_1, "SoundPathLength", "Sound Path Length", false},
+    tag_info{dicom_tag{0x0014, 0x405C}, vr(VR::ST), vm_1, "DelayLawIdentifier", "Delay Law Identifier", false},
+    tag_info{dicom_tag{0x0014, 0x4060}, vr(VR::SQ), vm_1, "GateSettingsSequence", "Gate Settings Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4062}, vr(VR::DS), vm_1, "GateThreshold", "Gate Threshold", false},
+    tag_info{dicom_tag{0x0014, 0x4064}, vr(VR::DS), vm_1, "VelocityOfSound", "Velocity of Sound", false},
+    tag_info{dicom_tag{0x0014, 0x4070}, vr(VR::SQ), vm_1, "CalibrationSettingsSequence", "Calibration Settings Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4072}, vr(VR::ST), vm_1, "CalibrationProcedure", "Calibration Procedure", false},
+    tag_info{dicom_tag{0x0014, 0x4074}, vr(VR::SH), vm_1, "ProcedureVersion", "Procedure Version", false},
+    tag_info{dicom_tag{0x0014, 0x4076}, vr(VR::DA), vm_1, "ProcedureCreationDate", "Procedure Creation Date", false},
+    tag_info{dicom_tag{0x0014, 0x4078}, vr(VR::DA), vm_1, "ProcedureExpirationDate", "Procedure Expiration Date", false},
+    tag_info{dicom_tag{0x0014, 0x407A}, vr(VR::DA), vm_1, "ProcedureLastModifiedDate", "Procedure Last Modified Date", false},
+    tag_info{dicom_tag{0x0014, 0x407C}, vr(VR::TM), vm_1_n, "CalibrationTime", "Calibration Time", false},
+    tag_info{dicom_tag{0x0014, 0x407E}, vr(VR::DA), vm_1_n, "CalibrationDate", "Calibration Date", false},
+    tag_info{dicom_tag{0x0014, 0x4080}, vr(VR::SQ), vm_1, "ProbeDriveEquipmentSequence", "Probe Drive Equipment Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4081}, vr(VR::CS), vm_1, "DriveType", "Drive Type", false},
+    tag_info{dicom_tag{0x0014, 0x4082}, vr(VR::LT), vm_1, "ProbeDriveNotes", "Probe Drive Notes", false},
+    tag_info{dicom_tag{0x0014, 0x4083}, vr(VR::SQ), vm_1, "DriveProbeSequence", "Drive Probe Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4084}, vr(VR::DS), vm_1, "ProbeInductance", "Probe Inductance", false},
+    tag_info{dicom_tag{0x0014, 0x4085}, vr(VR::DS), vm_1, "ProbeResistance", "Probe Resistance", false},
+    tag_info{dicom_tag{0x0014, 0x4086}, vr(VR::SQ), vm_1, "ReceiveProbeSequence", "Receive Probe Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4087}, vr(VR::SQ), vm_1, "ProbeDriveSettingsSequence", "Probe Drive Settings Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4088}, vr(VR::DS), vm_1, "BridgeResistors", "Bridge Resistors", false},
+    tag_info{dicom_tag{0x0014, 0x4089}, vr(VR::DS), vm_1, "ProbeOrientationAngle", "Probe Orientation Angle", false},
+    tag_info{dicom_tag{0x0014, 0x408B}, vr(VR::DS), vm_1, "UserSelectedGainY", "User Selected Gain Y", false},
+    tag_info{dicom_tag{0x0014, 0x408C}, vr(VR::DS), vm_1, "UserSelectedPhase", "User Selected Phase", false},
+    tag_info{dicom_tag{0x0014, 0x408D}, vr(VR::DS), vm_1, "UserSelectedOffsetX", "User Selected Offset X", false},
+    tag_info{dicom_tag{0x0014, 0x408E}, vr(VR::DS), vm_1, "UserSelectedOffsetY", "User Selected Offset Y", false},
+    tag_info{dicom_tag{0x0014, 0x4091}, vr(VR::SQ), vm_1, "ChannelSettingsSequence", "Channel Settings Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x4092}, vr(VR::DS), vm_1, "ChannelThreshold", "Channel Threshold", false},
+    tag_info{dicom_tag{0x0014, 0x409A}, vr(VR::SQ), vm_1, "ScannerSettingsSequence", "Scanner Settings Sequence", false},
+    tag_info{dicom_tag{0x0014, 0x409B}, vr(VR::ST), vm_1, "ScanProcedure", "Scan Procedure", false},
+    tag_info{dicom_tag{0x0014, 0x409C}, vr(VR::DS), vm_1, "TranslationRateX", "Translation Rate X", false},
+    tag_info{dicom_tag{0x0014, 0x409D}, vr(VR::DS), vm_1, "TranslationRateY", "Translation Rate Y", false},
+    tag_info{dicom_tag{0x0014, 0x409F}, vr(VR::DS), vm_1, "ChannelOverlap", "Channel Overlap", false},
+    tag_info{dicom_tag{0x0014, 0x40A0}, vr(VR::LO), vm_1_n, "ImageQualityIndicatorType", "Image Quality Indicator Type", false},
+    tag_info{dicom_tag{0x0014, 0x40A1}, vr(VR::LO), vm_1_n, "ImageQualityIndicatorMaterial", "Image Quality Indicator Material", false},
+    tag_info{dicom_tag{0x0014, 0x40A2}, vr(VR::LO), vm_1_n, "ImageQualityIndicatorSize", "Image Quality Indicator Size", false},
+    tag_info{dicom_tag{0x0014, 0x5002}, vr(VR::IS), vm_1, "LINACEnergy", "LINAC Energy", false},
+    tag_info{dicom_tag{0x0014, 0x5004}, vr(VR::IS), vm_1, "LINACOutput", "LINAC Output", false},
+    tag_info{dicom_tag{0x0014, 0x5100}, vr(VR::US), vm_1, "ActiveAperture", "Active Aperture", false},
+    tag_info{dicom_tag{0x0014, 0x5101}, vr(VR::DS), vm_1, "TotalAperture", "Total Aperture", false},
+    tag_info{dicom_tag{0x0014, 0x5102}, vr(VR::DS), vm_1, "ApertureElevation", "Aperture Elevation", false},
+    tag_info{dicom_tag{0x0014, 0x5103}, vr(VR::DS), vm_1, "MainLobeAngle", "Main Lobe Angle", false},
+    tag_info{dicom_tag{0x0014, 0x5104}, vr(VR::DS), vm_1, "MainRoofAngle", "Main Roof Angle", false},
+    tag_info{dicom_tag{0x0014, 0x5105}, vr(VR::CS), vm_1, "ConnectorType", "Connector Type", false},
+    tag_info{dicom_tag{0x0014, 0x5106}, vr(VR::SH), vm_1, "WedgeModelNumber", "Wedge Model Number", false},
+    tag_info{dicom_tag{0x0014, 0x5107}, vr(VR::DS), vm_1, "WedgeAngleFloat", "Wedge Angle Float", false},
+    tag_info{dicom_tag{0x0014, 0x5108}, vr(VR::DS), vm_1, "WedgeRoofAngle", "Wedge Roof Angle", false},
+    tag_info{dicom_tag{0x0014, 0x5109}, vr(VR::CS), vm_1, "WedgeElement1Position", "Wedge Element 1 Position", false},
+    tag_info{dicom_tag{0x0014, 0x510A}, vr(VR::DS), vm_1, "WedgeMaterialVelocity", "Wedge Material Velocity", false},
+    tag_info{dicom_tag{0x0014, 0x510B}, vr(VR::SH), vm_1, "WedgeMaterial", "Wedge Material", false},
+    tag_info{dicom_tag{0x0014, 0x510C}, vr(VR::DS), vm_1, "WedgeOffsetZ", "Wedge Offset Z", false},
+    tag_info{dicom_tag{0x0014, 0x510D}, vr(VR::DS), vm_1, "WedgeOriginOffsetX", "Wedge Origin Offset X", false},
+    tag_info{dicom_tag{0x0014, 0x510E}, vr(VR::DS), vm_1, "WedgeTimeDelay", "Wedge Time Delay", false},
+    tag_info{dicom_tag{0x0014, 0x510F}, vr(VR::SH), vm_1, "WedgeName", "Wedge Name", false},
+    tag_info{dicom_tag{0x0014, 0x5110}, vr(VR::SH), vm_1, "WedgeManufacturerName", "Wedge Manufacturer Name", false},
+    tag_info{dicom_tag{0x0014, 0x5111}, vr(VR::LO), vm_1, "WedgeDescription", "Wedge Description", false},
+    tag_info{dicom_tag{0x0014, 0x5112}, vr(VR::DS), vm_1, "NominalBeamAngle", "Nominal Beam Angle", false},
+    tag_info{dicom_tag{0x0014, 0x5113}, vr(VR::DS), vm_1, "WedgeOffsetX", "Wedge Offset X", false},
+    tag_info{dicom_tag{0x0014, 0x5114}, vr(VR::DS), vm_1, "WedgeOffsetY", "Wedge Offset Y", false},
+    tag_info{dicom_tag{0x0014, 0x5115}, vr(VR::DS), vm_1, "WedgeTotalLength", "Wedge Total Length", false},
+    tag_info{dicom_tag{0x0014, 0x5116}, vr(VR::DS), vm_1, "WedgeInContactLength", "Wedge In Contact Length", false},
+    tag_info{dicom_tag{0x0014, 0x5117}, vr(VR::DS), vm_1, "WedgeFrontGap", "Wedge Front Gap", false},
+    tag_info{dicom_tag{0x0014, 0x5118}, vr(VR::DS), vm_1, "WedgeTotalHeight", "Wedge Total Height", false},
+    tag_info{dicom_tag{0x0014, 0x5119}, vr(VR::DS), vm_1, "WedgeFrontHeight", "Wedge Front Height", false},
+    tag_info{dicom_tag{0x0014, 0x511A}, vr(VR::DS), vm_1, "WedgeRearHeight", "Wedge Rear Height", false},
+    tag_info{dicom_tag{0x0014, 0x511B}, vr(VR::DS), vm_1, "WedgeTotalWidth", "Wedge Total Width", false},
+    tag_info{dicom_tag{0x0014, 0x511C}, vr(VR::DS), vm_1, "WedgeInContactWidth", "Wedge In Contact Width", false},
+    tag_info{dicom_tag{0x0014, 0x511D}, vr(VR::DS), vm_1, "WedgeChamferHeight", "Wedge Chamfer Height", false},
+    tag_info{dicom_tag{0x0014, 0x511E}, vr(VR::CS), vm_1, "WedgeCurve", "Wedge Curve", false},
+    tag_info{dicom_tag{0x0014, 0x511F}, vr(VR::DS), vm_1, "RadiusAlongWedge", "Radius Along the Wedge", false},
+    tag_info{dicom_tag{0x0016, 0x0001}, vr(VR::DS), vm_1, "WhitePoint", "White Point", false},
+    tag_info{dicom_tag{0x0016, 0x0002}, vr(VR::DS), vm_3, "PrimaryChromaticities", "Primary Chromaticities", false},
+    tag_info{dicom_tag{0x0016, 0x0003}, vr(VR::UT), vm_1, "BatteryLevel", "Battery Level", false},
+    tag_info{dicom_tag{0x0016, 0x0004}, vr(VR::DS), vm_1, "ExposureTimeInSeconds", "Exposure Time in Seconds", false},
+    tag_info{dicom_tag{0x0016, 0x0005}, vr(VR::DS), vm_1, "FNumber", "F-Number", false},
+    tag_info{dicom_tag{0x0016, 0x0006}, vr(VR::IS), vm_1, "OECFRows", "OECF Rows", false},
+    tag_info{dicom_tag{0x0016, 0x0007}, vr(VR::IS), vm_1, "OECFColumns", "OECF Columns", false},
+    tag_info{dicom_tag{0x0016, 0x0008}, vr(VR::UC), vm_1_n, "OECFColumnNames", "OECF Column Names", false},
+    tag_info{dicom_tag{0x0016, 0x0009}, vr(VR::DS), vm_1_n, "OECFValues", "OECF Values", false},
+    tag_info{dicom_tag{0x0016, 0x000A}, vr(VR::IS), vm_1, "SpatialFrequencyResponseRows", "Spatial Frequency Response Rows", false},
+    tag_info{dicom_tag{0x0016, 0x000B}, vr(VR::IS), vm_1, "SpatialFrequencyResponseColumns", "Spatial Frequency Response Columns", false},
+    tag_info{dicom_tag{0x0016, 0x000C}, vr(VR::UC), vm_1_n, "SpatialFrequencyResponseColumnNames", "Spatial Frequency Response Column Names", false},
+    tag_info{dicom_tag{0x0016, 0x000D}, vr(VR::DS), vm_1_n, "SpatialFrequencyResponseValues", "Spatial Frequency Response Values", false},
+    tag_info{dicom_tag{0x0016, 0x000E}, vr(VR::IS), vm_1, "ColorFilterArrayPatternRows", "Color Filter Array Pattern Rows", false},
+    tag_info{dicom_tag{0x0016, 0x000F}, vr(VR::IS), vm_1, "ColorFilterArrayPatternColumns", "Color Filter Array Pattern Columns", false},
+    tag_info{dicom_tag{0x0016, 0x0010}, vr(VR::DS), vm_1_n, "ColorFilterArrayPatternValues", "Color Filter Array Pattern Values", false},
+    tag_info{dicom_tag{0x0016, 0x0011}, vr(VR::US), vm_1, "FlashFiringStatus", "Flash Firing Status", false},
+    tag_info{dicom_tag{0x0016, 0x0012}, vr(VR::US), vm_1, "FlashReturnStatus", "Flash Return Status", false},
+    tag_info{dicom_tag{0x0016, 0x0013}, vr(VR::US), vm_1, "FlashMode", "Flash Mode", false},
+    tag_info{dicom_tag{0x0016, 0x0014}, vr(VR::US), vm_1, "FlashFunctionPresent", "Flash Function Present", false},
+    tag_info{dicom_tag{0x0016, 0x0015}, vr(VR::US), vm_1, "FlashRedEyeMode", "Flash Red Eye Mode", false},
+    tag_info{dicom_tag{0x0016, 0x0016}, vr(VR::US), vm_1, "ExposureProgram", "Exposure Program", false},
+    tag_info{dicom_tag{0x0016, 0x0017}, vr(VR::UT), vm_1, "SpectralSensitivity", "Spectral Sensitivity", false},
+    tag_info{dicom_tag{0x0016, 0x0018}, vr(VR::IS), vm_1, "PhotographicSensitivity", "Photographic Sensitivity", false},
+    tag_info{dicom_tag{0x0016, 0x0019}, vr(VR::IS), vm_1, "SelfTimerMode", "Self Timer Mode", false},
+    tag_info{dicom_tag{0x0016, 0x001A}, vr(VR::US), vm_1, "SensitivityType", "Sensitivity Type", false},
+    tag_info{dicom_tag{0x0016, 0x001B}, vr(VR::IS), vm_1, "StandardOutputSensitivity", "Standard Output Sensitivity", false},
+    tag_info{dicom_tag{0x0016, 0x001C}, vr(VR::IS), vm_1, "RecommendedExposureIndex", "Recommended Exposure Index", false},
+    tag_info{dicom_tag{0x0016, 0x001D}, vr(VR::IS), vm_1, "ISOSpeed", "ISO Speed", false},
+    tag_info{dicom_tag{0x0016, 0x001E}, vr(VR::IS), vm_1, "ISOSpeedLatitudeyyy", "ISO Speed Latitude yyy", false},
+    tag_info{dicom_tag{0x0016, 0x001F}, vr(VR::IS), vm_1, "ISOSpeedLatitudezzz", "ISO Speed Latitude zzz", false},
+    tag_info{dicom_tag{0x0016, 0x0020}, vr(VR::UT), vm_1, "EXIFVersion", "EXIF Version", false},
+    tag_info{dicom_tag{0x0016, 0x0021}, vr(VR::DS), vm_1, "ShutterSpeedValue", "Shutter Speed Value", false},
+    tag_info{dicom_tag{0x0016, 0x0022}, vr(VR::DS), vm_1, "ApertureValue", "Aperture Value", false},
+    tag_info{dicom_tag{0x0016, 0x0023}, vr(VR::DS), vm_1, "BrightnessValue", "Brightness Value", false},
+    tag_info{dicom_tag{0x0016, 0x0024}, vr(VR::DS), vm_1, "ExposureBiasValue", "Exposure Bias Value", false},
+    tag_info{dicom_tag{0x0016, 0x0025}, vr(VR::DS), vm_1, "MaxApertureValue", "Max Aperture Value", false},
+    tag_info{dicom_tag{0x0016, 0x0026}, vr(VR::DS), vm_1, "SubjectDistance", "Subject Distance", false},
+    tag_info{dicom_tag{0x0016, 0x0027}, vr(VR::US), vm_1, "MeteringMode", "Metering Mode", false},
+    tag_info{dicom_tag{0x0016, 0x0028}, vr(VR::US), vm_1, "LightSource", "Light Source", false},
+    tag_info{dicom_tag{0x0016, 0x0029}, vr(VR::DS), vm_1, "FocalLength", "Focal Length", false},
+    tag_info{dicom_tag{0x0016, 0x002A}, vr(VR::IS), vm_2_4, "SubjectArea", "Subject Area", false},
+    tag_info{dicom_tag{0x0016, 0x002B}, vr(VR::OB), vm_1, "MakerNote", "Maker Note", false},
+    tag_info{dicom_tag{0x0016, 0x0030}, vr(VR::DS), vm_1, "Temperature", "Temperature", false},
+    tag_info{dicom_tag{0x0016, 0x0031}, vr(VR::DS), vm_1, "Humidity", "Humidity", false},
+    tag_info{dicom_tag{0x0016, 0x0032}, vr(VR::DS), vm_1, "Pressure", "Pressure", false},
+    tag_info{dicom_tag{0x0016, 0x0033}, vr(VR::DS), vm_1, "WaterDepth", "Water Depth", false},
+    tag_info{dicom_tag{0x0016, 0x0034}, vr(VR::DS), vm_1, "Acceleration", "Acceleration", false},
+    tag_info{dicom_tag{0x0016, 0x0035}, vr(VR::DS), vm_1, "CameraElevationAngle", "Camera Elevation Angle", false},
+    tag_info{dicom_tag{0x0016, 0x0036}, vr(VR::DS), vm_1_2, "FlashEnergy", "Flash Energy", false},
+    tag_info{dicom_tag{0x0016, 0x0037}, vr(VR::IS), vm_2, "SubjectLocation", "Subject Location", false},
+    tag_info{dicom_tag{0x0016, 0x0038}, vr(VR::DS), vm_1, "PhotographicExposureIndex", "Photographic Exposure Index", false},
+    tag_info{dicom_tag{0x0016, 0x0039}, vr(VR::US), vm_1, "SensingMethod", "Sensing Method", false},
+    tag_info{dicom_tag{0x0016, 0x003A}, vr(VR::US), vm_1, "FileSource", "File Source", false},
+    tag_info{dicom_tag{0x0016, 0x003B}, vr(VR::US), vm_1, "SceneType", "Scene Type", false},
+    tag_info{dicom_tag{0x0016, 0x0041}, vr(VR::US), vm_1, "CustomRendered", "Custom Rendered", false},
+    tag_info{dicom_tag{0x0016, 0x0042}, vr(VR::US), vm_1, "ExposureMode", "Exposure Mode", false},
+    tag_info{dicom_tag{0x0016, 0x0043}, vr(VR::US), vm_1, "WhiteBalance", "White Balance", false},
+    tag_info{dicom_tag{0x0016, 0x0044}, vr(VR::DS), vm_1, "DigitalZoomRatio", "Digital Zoom Ratio", false},
+    tag_info{dicom_tag{0x0016, 0x0045}, vr(VR::IS), vm_1, "FocalLengthIn35mmFilm", "Focal Length In 35mm Film", false},
+    tag_info{dicom_tag{0x0016, 0x0046}, vr(VR::US), vm_1, "SceneCaptureType", "Scene Capture Type", false},
+    tag_info{dicom_tag{0x0016, 0x0047}, vr(VR::US), vm_1, "GainControl", "Gain Control", false},
+    tag_info{dicom_tag{0x0016, 0x0048}, vr(VR::US), vm_1, "Contrast", "Contrast", false},
+    tag_info{dicom_tag{0x0016, 0x0049}, vr(VR::US), vm_1, "Saturation", "Saturation", false},
+    tag_info{dicom_tag{0x0016, 0x004A}, vr(VR::US), vm_1, "Sharpness", "Sharpness", false},
+    tag_info{dicom_tag{0x0016, 0x004B}, vr(VR::OB), vm_1, "DeviceSettingDescription", "Device Setting Description", false},
+    tag_info{dicom_tag{0x0016, 0x004C}, vr(VR::US), vm_1, "SubjectDistanceRange", "Subject Distance Range", false},
+    tag_info{dicom_tag{0x0016, 0x004D}, vr(VR::UT), vm_1, "CameraOwnerName", "Camera Owner Name", false},
+    tag_info{dicom_tag{0x0016, 0x004E}, vr(VR::DS), vm_4, "LensSpecification", "Lens Specification", false},
+    tag_info{dicom_tag{0x0016, 0x004F}, vr(VR::UT), vm_1, "LensMake", "Lens Make", false},
+    tag_info{dicom_tag{0x0016, 0x0050}, vr(VR::UT), vm_1, "LensModel", "Lens Model", false},
+    tag_info{dicom_tag{0x0016, 0x0051}, vr(VR::UT), vm_1, "LensSerialNumber", "Lens Serial Number", false},
+    tag_info{dicom_tag{0x0016, 0x0061}, vr(VR::CS), vm_1, "InteroperabilityIndex", "Interoperability Index", false},
+    tag_info{dicom_tag{0x0016, 0x0062}, vr(VR::OB), vm_1, "InteroperabilityVersion", "Interoperability Version", false},
+    tag_info{dicom_tag{0x0016, 0x0070}, vr(VR::OB), vm_1, "GPSVersionID", "GPS Version ID", false},
+    tag_info{dicom_tag{0x0016, 0x0071}, vr(VR::CS), vm_1, "GPSLatitudeRef", "GPS Latitude Ref", false},
+    tag_info{dicom_tag{0x0016, 0x0072}, vr(VR::DS), vm_3, "GPSLatitude", "GPS Latitude", false},
+    tag_info{dicom_tag{0x0016, 0x0073}, vr(VR::CS), vm_1, "GPSLongitudeRef", "GPS Longitude Ref", false},
+    tag_info{dicom_tag{0x0016, 0x0074}, vr(VR::DS), vm_3, "GPSLongitude", "GPS Longitude", false},
+    tag_info{dicom_tag{0x0016, 0x0075}, vr(VR::US), vm_1, "GPSAltitudeRef", "GPS Altitude Ref", false},
+    tag_info{dicom_tag{0x0016, 0x0076}, vr(VR::DS), vm_1, "GPSAltitude", "GPS Altitude", false},
+    tag_info{dicom_tag{0x0016, 0x0077}, vr(VR::DT), vm_1, "GPSTimeStamp", "GPS Time Stamp", false},
+    tag_info{dicom_tag{0x0016, 0x0078}, vr(VR::UT), vm_1, "GPSSatellites", "GPS Satellites", false},
+    tag_info{dicom_tag{0x0016, 0x0079}, vr(VR::CS), vm_1, "GPSStatus", "GPS Status", false},
+    tag_info{dicom_tag{0x0016, 0x007A}, vr(VR::CS), vm_1, "GPSMeasureMode", "GPS Measure Mode", false},
+    tag_info{dicom_tag{0x0016, 0x007B}, vr(VR::DS), vm_1, "GPSDOP", "GPS DOP", false},
+    tag_info{dicom_tag{0x0016, 0x007C}, vr(VR::CS), vm_1, "GPSSpeedRef", "GPS Speed Ref", false},
+    tag_info{dicom_tag{0x0016, 0x007D}, vr(VR::DS), vm_1, "GPSSpeed", "GPS Speed", false},
+    tag_info{dicom_tag{0x0016, 0x007E}, vr(VR::CS), vm_1, "GPSTrackRef", "GPS Track Ref", false},
+    tag_info{dicom_tag{0x0016, 0x007F}, vr(VR::DS), vm_1, "GPSTrack", "GPS Track", false},
+    tag_info{dicom_tag{0x0016, 0x0080}, vr(VR::CS), vm_1, "GPSImgDirectionRef", "GPS Img Direction Ref", false},
+    tag_info{dicom_tag{0x0016, 0x0081}, vr(VR::DS), vm_1, "GPSImgDirection", "GPS Img Direction", false},
+    tag_info{dicom_tag{0x0016, 0x0082}, vr(VR::UT), vm_1, "GPSMapDatum", "GPS Map Datum", false},
+    tag_info{dicom_tag{0x0016, 0x0083}, vr(VR::CS), vm_1, "GPSDestLatitudeRef", "GPS Dest Latitude Ref", false},
+    tag_info{dicom_tag{0x0016, 0x0084}, vr(VR::DS), vm_3, "GPSDestLatitude", "GPS Dest Latitude", false},
+    tag_info{dicom_tag{0x0016, 0x0085}, vr(VR::CS), vm_1, "GPSDestLongitudeRef", "GPS Dest Longitude Ref", false},
+    tag_info{dicom_tag{0x0016, 0x0086}, vr(VR::DS), vm_3, "GPSDestLongitude", "GPS Dest Longitude", false},
+    tag_info{dicom_tag{0x0016, 0x0087}, vr(VR::CS), vm_1, "GPSDestBearingRef", "GPS Dest Bearing Ref", false},
+    tag_info{dicom_tag{0x0016, 0x0088}, vr(VR::DS), vm_1, "GPSDestBearing", "GPS Dest Bearing", false},
+    tag_info{dicom_tag{0x0016, 0x0089}, vr(VR::CS), vm_1, "GPSDestDistanceRef", "GPS Dest Distance Ref", false},
+    tag_info{dicom_tag{0x0016, 0x008A}, vr(VR::DS), vm_1, "GPSDestDistance", "GPS Dest Distance", false},
+    tag_info{dicom_tag{0x0016, 0x008B}, vr(VR::OB), vm_1, "GPSProcessingMethod", "GPS Processing Method", false},
+    tag_info{dicom_tag{0x0016, 0x008C}, vr(VR::OB), vm_1, "GPSAreaInformation", "GPS Area Information", false},
+    tag_info{dicom_tag{0x0016, 0x008D}, vr(VR::DT), vm_1, "GPSDateStamp", "GPS Date Stamp", false},
+    tag_info{dicom_tag{0x0016, 0x008E}, vr(VR::IS), vm_1, "GPSDifferential", "GPS Differential", false},
+    tag_info{dicom_tag{0x0016, 0x1001}, vr(VR::CS), vm_1, "LightSourcePolarization", "Light Source Polarization", false},
+    tag_info{dicom_tag{0x0016, 0x1002}, vr(VR::DS), vm_1, "EmitterColorTemperature", "Emitter Color Temperature", false},
+    tag_info{dicom_tag{0x0016, 0x1003}, vr(VR::CS), vm_1, "ContactMethod", "Contact Method", false},
+    tag_info{dicom_tag{0x0016, 0x1004}, vr(VR::CS), vm_1_n, "ImmersionMedia", "Immersion Media", false},
+    tag_info{dicom_tag{0x0016, 0x1005}, vr(VR::DS), vm_1, "OpticalMagnificationFactor", "Optical Magnification Factor", false},
+    tag_info{dicom_tag{0x0018, 0x0010}, vr(VR::LO), vm_1, "ContrastBolusAgent", "Contrast/Bolus Agent", false},
+    tag_info{dicom_tag{0x0018, 0x0012}, vr(VR::SQ), vm_1, "ContrastBolusAgentSequence", "Contrast/Bolus Agent Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x0013}, vr(VR::FL), vm_1, "ContrastBolusT1Relaxivity", "Contrast/Bolus T1 Relaxivity", false},
+    tag_info{dicom_tag{0x0018, 0x0014}, vr(VR::SQ), vm_1, "ContrastBolusAdministrationRouteSequence", "Contrast/Bolus Administration Route Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x0015}, vr(VR::CS), vm_1, "BodyPartExamined", "Body Part Examined", false},
+    tag_info{dicom_tag{0x0018, 0x0020}, vr(VR::CS), vm_1_n, "ScanningSequence", "Scanning Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x0021}, vr(VR::CS), vm_1_n, "SequenceVariant", "Sequence Variant", false},
+    tag_info{dicom_tag{0x0018, 0x0022}, vr(VR::CS), vm_1_n, "ScanOptions", "Scan Options", false},
+    tag_info{dicom_tag{0x0018, 0x0023}, vr(VR::CS), vm_1, "MRAcquisitionType", "MR Acquisition Type", false},
+    tag_info{dicom_tag{0x0018, 0x0024}, vr(VR::SH), vm_1, "SequenceName", "Sequence Name", false},
+    tag_info{dicom_tag{0x0018, 0x0025}, vr(VR::CS), vm_1, "AngioFlag", "Angio Flag", false},
+    tag_info{dicom_tag{0x0018, 0x0026}, vr(VR::SQ), vm_1, "InterventionDrugInformationSequence", "Intervention Drug Information Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x0027}, vr(VR::TM), vm_1, "InterventionDrugStopTime", "Intervention Drug Stop Time", false},
+    tag_info{dicom_tag{0x0018, 0x0028}, vr(VR::DS), vm_1, "InterventionDrugDose", "Intervention Drug Dose", false},
+    tag_info{dicom_tag{0x0018, 0x0029}, vr(VR::SQ), vm_1, "InterventionDrugCodeSequence", "Intervention Drug Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x002A}, vr(VR::SQ), vm_1, "AdditionalDrugSequence", "Additional Drug Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x0030}, vr(VR::LO), vm_1_n, "Radionuclide", "Radionuclide", true},
+    tag_info{dicom_tag{0x0018, 0x0031}, vr(VR::LO), vm_1, "Radiopharmaceutical", "Radiopharmaceutical", false},
+    tag_info{dicom_tag{0x0018, 0x0032}, vr(VR::DS), vm_1, "EnergyWindowCenterline", "Energy Window Centerline", true},
+    tag_info{dicom_tag{0x0018, 0x0033}, vr(VR::DS), vm_1_n, "EnergyWindowTotalWidth", "Energy Window Total Width", true},
+    tag_info{dicom_tag{0x0018, 0x0034}, vr(VR::LO), vm_1, "InterventionDrugName", "Intervention Drug Name", false},
+    tag_info{dicom_tag{0x0018, 0x0035}, vr(VR::TM), vm_1, "InterventionDrugStartTime", "Intervention Drug Start Time", false},
+    tag_info{dicom_tag{0x0018, 0x0036}, vr(VR::SQ), vm_1, "InterventionSequence", "Intervention Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x0037}, vr(VR::CS), vm_1, "TherapyType", "Therapy Type", true},
+    tag_info{dicom_tag{0x0018, 0x0038}, vr(VR::CS), vm_1, "InterventionStatus", "Intervention Status", false},
+    tag_info{dicom_tag{0x0018, 0x0039}, vr(VR::CS), vm_1, "TherapyDescription", "Therapy Description", true},
+    tag_info{dicom_tag{0x0018, 0x003A}, vr(VR::ST), vm_1, "InterventionDescription", "Intervention Description", false},
+    tag_info{dicom_tag{0x0018, 0x0040}, vr(VR::IS), vm_1, "CineRate", "Cine Rate", false},
+    tag_info{dicom_tag{0x0018, 0x0042}, vr(VR::CS), vm_1, "InitialCineRunState", "Initial Cine Run State", false},
+    tag_info{dicom_tag{0x0018, 0x0050}, vr(VR::DS), vm_1, "SliceThickness", "Slice Thickness", false},
+    tag_info{dicom_tag{0x0018, 0x0060}, vr(VR::DS), vm_1, "KVP", "KVP", false},
+    tag_info{dicom_tag{0x0018, 0x0061}, vr(VR::DS), vm_1, "", "", true},
+    tag_info{dicom_tag{0x0018, 0x0070}, vr(VR::IS), vm_1, "CountsAccumulated", "Counts Accumulated", false},
+    tag_info{dicom_tag{0x0018, 0x0071}, vr(VR::CS), vm_1, "AcquisitionTerminationCondition", "Acquisition Termination Condition", false},
+    tag_info{dicom_tag{0x0018, 0x0072}, vr(VR::DS), vm_1, "EffectiveDuration", "Effective Duration", false},
+    tag_info{dicom_tag{0x0018, 0x0073}, vr(VR::CS), vm_1, "AcquisitionStartCondition", "Acquisition Start Condition", false},
+    tag_info{dicom_tag{0x0018, 0x0074}, vr(VR::IS), vm_1, "AcquisitionStartConditionData", "Acquisition Start Condition Data", false},
+    tag_info{dicom_tag{0x0018, 0x0075}, vr(VR::IS), vm_1, "AcquisitionTerminationConditionData", "Acquisition Termination Condition Data", false},
+    tag_info{dicom_tag{0x0018, 0x0080}, vr(VR::DS), vm_1, "RepetitionTime", "Repetition Time", false},
+    tag_info{dicom_tag{0x0018, 0x0081}, vr(VR::DS), vm_1, "EchoTime", "Echo Time", false},
+    tag_info{dicom_tag{0x0018, 0x0082}, vr(VR::DS), vm_1, "InversionTime", "Inversion Time", false},
+    tag_info{dicom_tag{0x0018, 0x0083}, vr(VR::DS), vm_1, "NumberOfAverages", "Number of Averages", false},
+    tag_info{dicom_tag{0x0018, 0x0084}, vr(VR::DS), vm_1, "ImagingFrequency", "Imaging Frequency", false},
+    tag_info{dicom_tag{0x0018, 0x0085}, vr(VR::SH), vm_1, "ImagedNucleus", "Imaged Nucleus", false},
+    tag_info{dicom_tag{0x0018, 0x0086}, vr(VR::IS), vm_1_n, "EchoNumbers", "Echo Number(s)", false},
+    tag_info{dicom_tag{0x0018, 0x0087}, vr(VR::DS), vm_1, "MagneticFieldStrength", "Magnetic Field Strength", false},
+    tag_info{dicom_tag{0x0018, 0x0088}, vr(VR::DS), vm_1, "SpacingBetweenSlices", "Spacing Between Slices", false},
+    tag_info{dicom_tag{0x0018, 0x0089}, vr(VR::IS), vm_1, "NumberOfPhaseEncodingSteps", "Number of Phase Encoding Steps", false},
+    tag_info{dicom_tag{0x0018, 0x0090}, vr(VR::DS), vm_1, "DataCollectionDiameter", "Data Collection Diameter", false},
+    tag_info{dicom_tag{0x0018, 0x0091}, vr(VR::IS), vm_1, "EchoTrainLength", "Echo Train Length", false},
+    tag_info{dicom_tag{0x0018, 0x0093}, vr(VR::DS), vm_1, "PercentSampling", "Percent Sampling", false},
+    tag_info{dicom_tag{0x0018, 0x0094}, vr(VR::DS), vm_1, "PercentPhaseFieldOfView", "Percent Phase Field of View", false},
+    tag_info{dicom_tag{0x0018, 0x0095}, vr(VR::DS), vm_1, "PixelBandwidth", "Pixel Bandwidth", false},
+    tag_info{dicom_tag{0x0018, 0x1000}, vr(VR::LO), vm_1, "DeviceSerialNumber", "Device Serial Number", false},
+    tag_info{dicom_tag{0x0018, 0x1002}, vr(VR::UI), vm_1, "DeviceUID", "Device UID", false},
+    tag_info{dicom_tag{0x0018, 0x1003}, vr(VR::LO), vm_1, "DeviceID", "Device ID", false},
+    tag_info{dicom_tag{0x0018, 0x1004}, vr(VR::LO), vm_1, "PlateID", "Plate ID", false},
+    tag_info{dicom_tag{0x0018, 0x1005}, vr(VR::LO), vm_1, "GeneratorID", "Generator ID", false},
+    tag_info{dicom_tag{0x0018, 0x1006}, vr(VR::LO), vm_1, "GridID", "Grid ID", false},
+    tag_info{dicom_tag{0x0018, 0x1007}, vr(VR::LO), vm_1, "CassetteID", "Cassette ID", false},
+    tag_info{dicom_tag{0x0018, 0x1008}, vr(VR::LO), vm_1, "GantryID", "Gantry ID", false},
+    tag_info{dicom_tag{0x0018, 0x1009}, vr(VR::UT), vm_1, "UniqueDeviceIdentifier", "Unique Device Identifier", false},
+    tag_info{dicom_tag{0x0018, 0x100A}, vr(VR::SQ), vm_1, "UDISequence", "UDI Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x100B}, vr(VR::UI), vm_1_n, "ManufacturerDeviceClassUID", "Manufacturer's Device Class UID", false},
+    tag_info{dicom_tag{0x0018, 0x1010}, vr(VR::LO), vm_1, "SecondaryCaptureDeviceID", "Secondary Capture Device ID", false},
+    tag_info{dicom_tag{0x0018, 0x1011}, vr(VR::LO), vm_1, "HardcopyCreationDeviceID", "Hardcopy Creation Device ID", true},
+    tag_info{dicom_tag{0x0018, 0x1012}, vr(VR::DA), vm_1, "DateOfSecondaryCapture", "Date of Secondary Capture", false},
+    tag_info{dicom_tag{0x0018, 0x1014}, vr(VR::TM), vm_1, "TimeOfSecondaryCapture", "Time of Secondary Capture", false},
+    tag_info{dicom_tag{0x0018, 0x1016}, vr(VR::LO), vm_1, "SecondaryCaptureDeviceManufacturer", "Secondary Capture Device Manufacturer", false},
+    tag_info{dicom_tag{0x0018, 0x1017}, vr(VR::LO), vm_1, "HardcopyDeviceManufacturer", "Hardcopy Device Manufacturer", true},
+    tag_info{dicom_tag{0x0018, 0x1018}, vr(VR::LO), vm_1, "SecondaryCaptureDeviceManufacturerModelName", "Secondary Capture Device Manufacturer's Model Name", false},
+    tag_info{dicom_tag{0x0018, 0x1019}, vr(VR::LO), vm_1_n, "SecondaryCaptureDeviceSoftwareVersions", "Secondary Capture Device Software Versions", false},
+    tag_info{dicom_tag{0x0018, 0x101A}, vr(VR::LO), vm_1_n, "HardcopyDeviceSoftwareVersion", "Hardcopy Device Software Version", true},
+    tag_info{dicom_tag{0x0018, 0x101B}, vr(VR::LO), vm_1, "HardcopyDeviceManufacturerModelName", "Hardcopy Device Manufacturer's Model Name", true},
+    tag_info{dicom_tag{0x0018, 0x1020}, vr(VR::LO), vm_1_n, "SoftwareVersions", "Software Versions", false},
+    tag_info{dicom_tag{0x0018, 0x1022}, vr(VR::SH), vm_1, "VideoImageFormatAcquired", "Video Image Format Acquired", false},
+    tag_info{dicom_tag{0x0018, 0x1023}, vr(VR::LO), vm_1, "DigitalImageFormatAcquired", "Digital Image Format Acquired", false},
+    tag_info{dicom_tag{0x0018, 0x1030}, vr(VR::LO), vm_1, "ProtocolName", "Protocol Name", false},
+    tag_info{dicom_tag{0x0018, 0x1040}, vr(VR::LO), vm_1, "ContrastBolusRoute", "Contrast/Bolus Route", false},
+    tag_info{dicom_tag{0x0018, 0x1041}, vr(VR::DS), vm_1, "ContrastBolusVolume", "Contrast/Bolus Volume", false},
+    tag_info{dicom_tag{0x0018, 0x1042}, vr(VR::TM), vm_1, "ContrastBolusStartTime", "Contrast/Bolus Start Time", false},
+    tag_info{dicom_tag{0x0018, 0x1043}, vr(VR::TM), vm_1, "ContrastBolusStopTime", "Contrast/Bolus Stop Time", false},
+    tag_info{dicom_tag{0x0018, 0x1044}, vr(VR::DS), vm_1, "ContrastBolusTotalDose", "Contrast/Bolus Total Dose", false},
+    tag_info{dicom_tag{0x0018, 0x1045}, vr(VR::IS), vm_1, "SyringeCounts", "Syringe Counts", false},
+    tag_info{dicom_tag{0x0018, 0x1046}, vr(VR::DS), vm_1_n, "ContrastFlowRate", "Contrast Flow Rate", false},
+    tag_info{dicom_tag{0x0018, 0x1047}, vr(VR::DS), vm_1_n, "ContrastFlowDuration", "Contrast Flow Duration", false},
+    tag_info{dicom_tag{0x0018, 0x1048}, vr(VR::CS), vm_1, "ContrastBolusIngredient", "Contrast/Bolus Ingredient", false},
+    tag_info{dicom_tag{0x0018, 0x1049}, vr(VR::DS), vm_1, "ContrastBolusIngredientConcentration", "Contrast/Bolus Ingredient Concentration", false},
+    tag_info{dicom_tag{0x0018, 0x1050}, vr(VR::DS), vm_1, "SpatialResolution", "Spatial Resolution", false},
+    tag_info{dicom_tag{0x0018, 0x1060}, vr(VR::DS), vm_1, "TriggerTime", "Trigger Time", false},
+    tag_info{dicom_tag{0x0018, 0x1061}, vr(VR::LO), vm_1, "TriggerSourceOrType", "Trigger Source or Type", false},
+    tag_info{dicom_tag{0x0018, 0x1062}, vr(VR::IS), vm_1, "NominalInterval", "Nominal Interval", false},
+    tag_info{dicom_tag{0x0018, 0x1063}, vr(VR::DS), vm_1, "FrameTime", "Frame Time", false},
+    tag_info{dicom_tag{0x0018, 0x1064}, vr(VR::LO), vm_1, "CardiacFramingType", "Cardiac Framing Type", false},
+    tag_info{dicom_tag{0x0018, 0x1065}, vr(VR::DS), vm_1_n, "FrameTimeVector", "Frame Time Vector", false},
+    tag_info{dicom_tag{0x0018, 0x1066}, vr(VR::DS), vm_1, "FrameDelay", "Frame Delay", false},
+    tag_info{dicom_tag{0x0018, 0x1067}, vr(VR::DS), vm_1, "ImageTriggerDelay", "Image Trigger Delay", false},
+    tag_info{dicom_tag{0x0018, 0x1068}, vr(VR::DS), vm_1, "MultiplexGroupTimeOffset", "Multiplex Group Time Offset", false},
+    tag_info{dicom_tag{0x0018, 0x1069}, vr(VR::DS), vm_1, "TriggerTimeOffset", "Trigger Time Offset", false},
+    tag_info{dicom_tag{0x0018, 0x106A}, vr(VR::CS), vm_1, "SynchronizationTrigger", "Synchronization Trigger", false},
+    tag_info{dicom_tag{0x0018, 0x106C}, vr(VR::US), vm_2, "SynchronizationChannel", "Synchronization Channel", false},
+    tag_info{dicom_tag{0x0018, 0x106E}, vr(VR::UL), vm_1, "TriggerSamplePosition", "Trigger Sample Position", false},
+    tag_info{dicom_tag{0x0018, 0x1070}, vr(VR::LO), vm_1, "RadiopharmaceuticalRoute", "Radiopharmaceutical Route", false},
+    tag_info{dicom_tag{0x0018, 0x1071}, vr(VR::DS), vm_1, "RadiopharmaceuticalVolume", "Radiopharmaceutical Volume", false},
+    tag_info{dicom_tag{0x0018, 0x1072}, vr(VR::TM), vm_1, "RadiopharmaceuticalStartTime", "Radiopharmaceutical Start Time", false},
+    tag_info{dicom_tag{0x0018, 0x1073}, vr(VR::TM), vm_1, "RadiopharmaceuticalStopTime", "Radiopharmaceutical Stop Time", false},
+    tag_info{dicom_tag{0x0018, 0x1074}, vr(VR::DS), vm_1, "RadionuclideTotalDose", "Radionuclide Total Dose", false},
+    tag_info{dicom_tag{0x0018, 0x1075}, vr(VR::DS), vm_1, "RadionuclideHalfLife", "Radionuclide Half Life", false},
+    tag_info{dicom_tag{0x0018, 0x1076}, vr(VR::DS), vm_1, "RadionuclidePositronFraction", "Radionuclide Positron Fraction", false},
+    tag_info{dicom_tag{0x0018, 0x1077}, vr(VR::DS), vm_1, "RadiopharmaceuticalSpecificActivity", "Radiopharmaceutical Specific Activity", false},
+    tag_info{dicom_tag{0x0018, 0x1078}, vr(VR::DT), vm_1, "RadiopharmaceuticalStartDateTime", "Radiopharmaceutical Start DateTime", false},
+    tag_info{dicom_tag{0x0018, 0x1079}, vr(VR::DT), vm_1, "RadiopharmaceuticalStopDateTime", "Radiopharmaceutical Stop DateTime", false},
+    tag_info{dicom_tag{0x0018, 0x1080}, vr(VR::CS), vm_1, "BeatRejectionFlag", "Beat Rejection Flag", false},
+    tag_info{dicom_tag{0x0018, 0x1081}, vr(VR::IS), vm_1, "LowRRValue", "Low R-R Value", false},
+    tag_info{dicom_tag{0x0018, 0x1082}, vr(VR::IS), vm_1, "HighRRValue", "High R-R Value", false},
+    tag_info{dicom_tag{0x0018, 0x1083}, vr(VR::IS), vm_1, "IntervalsAcquired", "Intervals Acquired", false},
+    tag_info{dicom_tag{0x0018, 0x1084}, vr(VR::IS), vm_1, "IntervalsRejected", "Intervals Rejected", false},
+    tag_info{dicom_tag{0x0018, 0x1085}, vr(VR::LO), vm_1, "PVCRejection", "PVC Rejection", false},
+    tag_info{dicom_tag{0x0018, 0x1086}, vr(VR::IS), vm_1, "SkipBeats", "Skip Beats", false},
+    tag_info{dicom_tag{0x0018, 0x1088}, vr(VR::IS), vm_1, "HeartRate", "Heart Rate", false},
+    tag_info{dicom_tag{0x0018, 0x1090}, vr(VR::IS), vm_1, "CardiacNumberOfImages", "Cardiac Number of Images", false},
+    tag_info{dicom_tag{0x0018, 0x1094}, vr(VR::IS), vm_1, "TriggerWindow", "Trigger Window", false},
+    tag_info{dicom_tag{0x0018, 0x1100}, vr(VR::DS), vm_1, "ReconstructionDiameter", "Reconstruction Diameter", false},
+    tag_info{dicom_tag{0x0018, 0x1110}, vr(VR::DS), vm_1, "DistanceSourceToDetector", "Distance Source to Detector", false},
+    tag_info{dicom_tag{0x0018, 0x1111}, vr(VR::DS), vm_1, "DistanceSourceToPatient", "Distance Source to Patient", false},
+    tag_info{dicom_tag{0x0018, 0x1114}, vr(VR::DS), vm_1, "EstimatedRadiographicMagnificationFactor", "Estimated Radiographic Magnification Factor", false},
+    tag_info{dicom_tag{0x0018, 0x1120}, vr(VR::DS), vm_1, "GantryDetectorTilt", "Gantry/Detector Tilt", false},
+    tag_info{dicom_tag{0x0018, 0x1121}, vr(VR::DS), vm_1, "GantryDetectorSlew", "Gantry/Detector Slew", false},
+    tag_info{dicom_tag{0x0018, 0x1130}, vr(VR::DS), vm_1, "TableHeight", "Table Height", false},
+    tag_info{dicom_tag{0x0018, 0x1131}, vr(VR::DS), vm_1, "TableTraverse", "Table Traverse", false},
+    tag_info{dicom_tag{0x0018, 0x1134}, vr(VR::CS), vm_1, "TableMotion", "Table Motion", false},
+    tag_info{dicom_tag{0x0018, 0x1135}, vr(VR::DS), vm_1_n, "TableVerticalIncrement", "Table Vertical Increment", false},
+    tag_info{dicom_tag{0x0018, 0x1136}, vr(VR::DS), vm_1_n, "TableLateralIncrement", "Table Lateral Increment", false},
+    tag_info{dicom_tag{0x0018, 0x1137}, vr(VR::DS), vm_1_n, "TableLongitudinalIncrement", "Table Longitudinal Increment", false},
+    tag_info{dicom_tag{0x0018, 0x1138}, vr(VR::DS), vm_1, "TableAngle", "Table Angle", false},
+    tag_info{dicom_tag{0x0018, 0x113A}, vr(VR::CS), vm_1, "TableType", "Table Type", false},
+    tag_info{dicom_tag{0x0018, 0x1140}, vr(VR::CS), vm_1, "RotationDirection", "Rotation Direction", false},
+    tag_info{dicom_tag{0x0018, 0x1141}, vr(VR::DS), vm_1, "AngularPosition", "Angular Position", true},
+    tag_info{dicom_tag{0x0018, 0x1142}, vr(VR::DS), vm_1_n, "RadialPosition", "Radial Position", false},
+    tag_info{dicom_tag{0x0018, 0x1143}, vr(VR::DS), vm_1, "ScanArc", "Scan Arc", false},
+    tag_info{dicom_tag{0x0018, 0x1144}, vr(VR::DS), vm_1, "AngularStep", "Angular Step", false},
+    tag_info{dicom_tag{0x0018, 0x1145}, vr(VR::DS), vm_1, "CenterOfRotationOffset", "Center of Rotation Offset", false},
+    tag_info{dicom_tag{0x0018, 0x1146}, vr(VR::DS), vm_1_n, "RotationOffset", "Rotation Offset", true},
+    tag_info{dicom_tag{0x0018, 0x1147}, vr(VR::CS), vm_1, "FieldOfViewShape", "Field of View Shape", false},
+    tag_info{dicom_tag{0x0018, 0x1149}, vr(VR::IS), vm_1_2, "FieldOfViewDimensions", "Field of View Dimension(s)", false},
+    tag_info{dicom_tag{0x0018, 0x1150}, vr(VR::IS), vm_1, "ExposureTime", "Exposure Time", false},
+    tag_info{dicom_tag{0x0018, 0x1151}, vr(VR::IS), vm_1, "XRayTubeCurrent", "X-Ray Tube Current", false},
+    tag_info{dicom_tag{0x0018, 0x1152}, vr(VR::IS), vm_1, "Exposure", "Exposure", false},
+    tag_info{dicom_tag{0x0018, 0x1153}, vr(VR::IS), vm_1, "ExposureInuAs", "Exposure in uAs", false},
+    tag_info{dicom_tag{0x0018, 0x1154}, vr(VR::DS), vm_1, "AveragePulseWidth", "Average Pulse Width", false},
+    tag_info{dicom_tag{0x0018, 0x1155}, vr(VR::CS), vm_1, "RadiationSetting", "Radiation Setting", false},
+    tag_info{dicom_tag{0x0018, 0x1156}, vr(VR::CS), vm_1, "RectificationType", "Rectification Type", false},
+    tag_info{dicom_tag{0x0018, 0x115A}, vr(VR::CS), vm_1, "RadiationMode", "Radiation Mode", false},
+    tag_info{dicom_tag{0x0018, 0x115E}, vr(VR::DS), vm_1, "ImageAndFluoroscopyAreaDoseProduct", "Image and Fluoroscopy Area Dose Product", false},
+    tag_info{dicom_tag{0x0018, 0x1160}, vr(VR::SH), vm_1, "FilterType", "Filter Type", false},
+    tag_info{dicom_tag{0x0018, 0x1161}, vr(VR::LO), vm_1_n, "TypeOfFilters", "Type of Filters", false},
+    tag_info{dicom_tag{0x0018, 0x1162}, vr(VR::DS), vm_1, "IntensifierSize", "Intensifier Size", false},
+    tag_info{dicom_tag{0x0018, 0x1164}, vr(VR::DS), vm_2, "ImagerPixelSpacing", "Imager Pixel Spacing", false},
+    tag_info{dicom_tag{0x0018, 0x1166}, vr(VR::CS), vm_1_n, "Grid", "Grid", false},
+    tag_info{dicom_tag{0x0018, 0x1170}, vr(VR::IS), vm_1, "GeneratorPower", "Generator Power", false},
+    tag_info{dicom_tag{0x0018, 0x1180}, vr(VR::SH), vm_1, "CollimatorGridName", "Collimator/grid Name", false},
+    tag_info{dicom_tag{0x0018, 0x1181}, vr(VR::CS), vm_1, "CollimatorType", "Collimator Type", false},
+    tag_info{dicom_tag{0x0018, 0x1182}, vr(VR::IS), vm_1_2, "FocalDistance", "Focal Distance", false},
+    tag_info{dicom_tag{0x0018, 0x1183}, vr(VR::DS), vm_1_2, "XFocusCenter", "X Focus Center", false},
+    tag_info{dicom_tag{0x0018, 0x1184}, vr(VR::DS), vm_1_2, "YFocusCenter", "Y Focus Center", false},
+    tag_info{dicom_tag{0x0018, 0x1190}, vr(VR::DS), vm_1_n, "FocalSpots", "Focal Spot(s)", false},
+    tag_info{dicom_tag{0x0018, 0x1191}, vr(VR::CS), vm_1, "AnodeTargetMaterial", "Anode Target Material", false},
+    tag_info{dicom_tag{0x0018, 0x11A0}, vr(VR::DS), vm_1, "BodyPartThickness", "Body Part Thickness", false},
+    tag_info{dicom_tag{0x0018, 0x11A2}, vr(VR::DS), vm_1, "CompressionForce", "Compression Force", false},
+    tag_info{dicom_tag{0x0018, 0x11A3}, vr(VR::DS), vm_1, "CompressionPressure", "Compression Pressure", false},
+    tag_info{dicom_tag{0x0018, 0x11A4}, vr(VR::LO), vm_1, "PaddleDescription", "Paddle Description", false},
+    tag_info{dicom_tag{0x0018, 0x11A5}, vr(VR::DS), vm_1, "CompressionContactArea", "Compression Contact Area", false},
+    tag_info{dicom_tag{0x0018, 0x11B0}, vr(VR::LO), vm_1, "AcquisitionMode", "Acquisition Mode", false},
+    tag_info{dicom_tag{0x0018, 0x11B1}, vr(VR::LO), vm_1, "DoseModeName", "Dose Mode Name", false},
+    tag_info{dicom_tag{0x0018, 0x11B2}, vr(VR::CS), vm_1, "AcquiredSubtractionMaskFlag", "Acquired Subtraction Mask Flag", false},
+    tag_info{dicom_tag{0x0018, 0x11B3}, vr(VR::CS), vm_1, "FluoroscopyPersistenceFlag", "Fluoroscopy Persistence Flag", false},
+    tag_info{dicom_tag{0x0018, 0x11B4}, vr(VR::CS), vm_1, "FluoroscopyLastImageHoldPersistenceFlag", "Fluoroscopy Last Image Hold Persistence Flag", false},
+    tag_info{dicom_tag{0x0018, 0x11B5}, vr(VR::IS), vm_1, "UpperLimitNumberOfPersistentFluoroscopyFrames", "Upper Limit Number Of Persistent Fluoroscopy Frames", false},
+    tag_info{dicom_tag{0x0018, 0x11B6}, vr(VR::CS), vm_1, "ContrastBolusAutoInjectionTriggerFlag", "Contrast/Bolus Auto Injection Trigger Flag", false},
+    tag_info{dicom_tag{0x0018, 0x11B7}, vr(VR::FD), vm_1, "ContrastBolusInjectionDelay", "Contrast/Bolus Injection Delay", false},
+    tag_info{dicom_tag{0x0018, 0x11B8}, vr(VR::SQ), vm_1, "XAAcquisitionPhaseDetailsSequence", "XA Acquisition Phase Details Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x11B9}, vr(VR::FD), vm_1, "XAAcquisitionFrameRate", "XA Acquisition Frame Rate", false},
+    tag_info{dicom_tag{0x0018, 0x11BA}, vr(VR::SQ), vm_1, "XAPlaneDetailsSequence", "XA Plane Details Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x11BB}, vr(VR::LO), vm_1, "AcquisitionFieldOfViewLabel", "Acquisition Field of View Label", false},
+    tag_info{dicom_tag{0x0018, 0x11BC}, vr(VR::SQ), vm_1, "XRayFilterDetailsSequence", "X-Ray Filter Details Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x11BD}, vr(VR::FD), vm_1, "XAAcquisitionDuration", "XA Acquisition Duration", false},
+    tag_info{dicom_tag{0x0018, 0x11BE}, vr(VR::CS), vm_1, "ReconstructionPipelineType", "Reconstruction Pipeline Type", false},
+    tag_info{dicom_tag{0x0018, 0x11BF}, vr(VR::SQ), vm_1, "ImageFilterDetailsSequence", "Image Filter Details Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x11C0}, vr(VR::CS), vm_1, "AppliedMaskSubtractionFlag", "Applied Mask Subtraction Flag", false},
+    tag_info{dicom_tag{0x0018, 0x11C1}, vr(VR::SQ), vm_1, "RequestedSeriesDescriptionCodeSequence", "Requested Series Description Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x1200}, vr(VR::DA), vm_1_n, "DateOfLastCalibration", "Date of Last Calibration", false},
+    tag_info{dicom_tag{0x0018, 0x1201}, vr(VR::TM), vm_1_n, "TimeOfLastCalibration", "Time of Last Calibration", false},
+    tag_info{dicom_tag{0x0018, 0x1202}, vr(VR::DT), vm_1, "DateTimeOfLastCalibration", "DateTime of Last Calibration", false},
+    tag_info{dicom_tag{0x0018, 0x1203}, vr(VR::DT), vm_1, "CalibrationDateTime", "Calibration DateTime", false},
+    tag_info{dicom_tag{0x0018, 0x1204}, vr(VR::DA), vm_1, "DateOfManufacture", "Date of Manufacture", false},
+    tag_info{dicom_tag{0x0018, 0x1205}, vr(VR::DA), vm_1, "DateOfInstallation", "Date of Installation", false},
+    tag_info{dicom_tag{0x0018, 0x1210}, vr(VR::SH), vm_1_n, "ConvolutionKernel", "Convolution Kernel", false},
+    tag_info{dicom_tag{0x0018, 0x1240}, vr(VR::IS), vm_1_n, "UpperLowerPixelValues", "Upper/Lower Pixel Values", true},
+    tag_info{dicom_tag{0x0018, 0x1242}, vr(VR::IS), vm_1, "ActualFrameDuration", "Actual Frame Duration", false},
+    tag_info{dicom_tag{0x0018, 0x1243}, vr(VR::IS), vm_1, "CountRate", "Count Rate", false},
+    tag_info{dicom_tag{0x0018, 0x1244}, vr(VR::US), vm_1, "PreferredPlaybackSequencing", "Preferred Playback Sequencing", false},
+    tag_info{dicom_tag{0x0018, 0x1250}, vr(VR::SH), vm_1, "ReceiveCoilName", "Receive Coil Name", false},
+    tag_info{dicom_tag{0x0018, 0x1251}, vr(VR::SH), vm_1, "TransmitCoilName", "Transmit Coil Name", false},
+    tag_info{dicom_tag{0x0018, 0x1260}, vr(VR::SH), vm_1, "PlateType", "Plate Type", false},
+    tag_info{dicom_tag{0x0018, 0x1261}, vr(VR::LO), vm_1, "PhosphorType", "Phosphor Type", false},
+    tag_info{dicom_tag{0x0018, 0x1271}, vr(VR::FD), vm_1, "WaterEquivalentDiameter", "Water Equivalent Diameter", false},
+    tag_info{dicom_tag{0x0018, 0x1272}, vr(VR::SQ), vm_1, "WaterEquivalentDiameterCalculationMethodCodeSequence", "Water Equivalent Diameter Calculation Method Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x1300}, vr(VR::DS), vm_1, "ScanVelocity", "Scan Velocity", false},
+    tag_info{dicom_tag{0x0018, 0x1301}, vr(VR::CS), vm_1_n, "WholeBodyTechnique", "Whole Body Technique", false},
+    tag_info{dicom_tag{0x0018, 0x1302}, vr(VR::IS), vm_1, "ScanLength", "Scan Length", false},
+    tag_info{dicom_tag{0x0018, 0x1310}, vr(VR::US), vm_4, "AcquisitionMatrix", "Acquisition Matrix", false},
+    tag_info{dicom_tag{0x0018, 0x1312}, vr(VR::CS), vm_1, "InPlanePhaseEncodingDirection", "In-plane Phase Encoding Direction", false},
+    tag_info{dicom_tag{0x0018, 0x1314}, vr(VR::DS), vm_1, "FlipAngle", "Flip Angle", false},
+    tag_info{dicom_tag{0x0018, 0x1315}, vr(VR::CS), vm_1, "VariableFlipAngleFlag", "Variable Flip Angle Flag", false},
+    tag_info{dicom_tag{0x0018, 0x1316}, vr(VR::DS), vm_1, "SAR", "SAR", false},
+    tag_info{dicom_tag{0x0018, 0x1318}, vr(VR::DS), vm_1, "dBdt", "dB/dt", false},
+    tag_info{dicom_tag{0x0018, 0x1320}, vr(VR::FL), vm_1, "B1rms", "B1rms", false},
+    tag_info{dicom_tag{0x0018, 0x1400}, vr(VR::LO), vm_1, "AcquisitionDeviceProcessingDescription", "Acquisition Device Processing Description", false},
+    tag_info{dicom_tag{0x0018, 0x1401}, vr(VR::LO), vm_1, "AcquisitionDeviceProcessingCode", "Acquisition Device Processing Code", false},
+    tag_info{dicom_tag{0x0018, 0x1402}, vr(VR::CS), vm_1, "CassetteOrientation", "Cassette Orientation", false},
+    tag_info{dicom_tag{0x0018, 0x1403}, vr(VR::CS), vm_1, "CassetteSize", "Cassette Size", false},
+    tag_info{dicom_tag{0x0018, 0x1404}, vr(VR::US), vm_1, "ExposuresOnPlate", "Exposures on Plate", false},
+    tag_info{dicom_tag{0x0018, 0x1405}, vr(VR::IS), vm_1, "RelativeXRayExposure", "Relative X-Ray Exposure", false},
+    tag_info{dicom_tag{0x0018, 0x1411}, vr(VR::DS), vm_1, "ExposureIndex", "Exposure Index", false},
+    tag_info{dicom_tag{0x0018, 0x1412}, vr(VR::DS), vm_1, "TargetExposureIndex", "Target Exposure Index", false},
+    tag_info{dicom_tag{0x0018, 0x1413}, vr(VR::DS), vm_1, "DeviationIndex", "Deviation Index", false},
+    tag_info{dicom_tag{0x0018, 0x1450}, vr(VR::DS), vm_1, "ColumnAngulation", "Column Angulation", false},
+    tag_info{dicom_tag{0x0018, 0x1460}, vr(VR::DS), vm_1, "TomoLayerHeight", "Tomo Layer Height", false},
+    tag_info{dicom_tag{0x0018, 0x1470}, vr(VR::DS), vm_1, "TomoAngle", "Tomo Angle", false},
+    tag_info{dicom_tag{0x0018, 0x1480}, vr(VR::DS), vm_1, "TomoTime", "Tomo Time", false},
+    tag_info{dicom_tag{0x0018, 0x1490}, vr(VR::CS), vm_1, "TomoType", "Tomo Type", false},
+    tag_info{dicom_tag{0x0018, 0x1491}, vr(VR::CS), vm_1, "TomoClass", "Tomo Class", false},
+    tag_info{dicom_tag{0x0018, 0x1495}, vr(VR::IS), vm_1, "NumberOfTomosynthesisSourceImages", "Number of Tomosynthesis Source Images", false},
+    tag_info{dicom_tag{0x0018, 0x1500}, vr(VR::CS), vm_1, "PositionerMotion", "Positioner Motion", false},
+    tag_info{dicom_tag{0x0018, 0x1508}, vr(VR::CS), vm_1, "PositionerType", "Positioner Type", false},
+    tag_info{dicom_tag{0x0018, 0x1510}, vr(VR::DS), vm_1, "PositionerPrimaryAngle", "Positioner Primary Angle", false},
+    tag_info{dicom_tag{0x0018, 0x1511}, vr(VR::DS), vm_1, "PositionerSecondaryAngle", "Positioner Secondary Angle", false},
+    tag_info{dicom_tag{0x0018, 0x1520}, vr(VR::DS), vm_1_n, "PositionerPrimaryAngleIncrement", "Positioner Primary Angle Increment", false},
+    tag_info{dicom_tag{0x0018, 0x1521}, vr(VR::DS), vm_1_n, "PositionerSecondaryAngleIncrement", "Positioner Secondary Angle Increment", false},
+    tag_info{dicom_tag{0x0018, 0x1530}, vr(VR::DS), vm_1, "DetectorPrimaryAngle", "Detector Primary Angle", false},
+    tag_info{dicom_tag{0x0018, 0x1531}, vr(VR::DS), vm_1, "DetectorSecondaryAngle", "Detector Secondary Angle", false},
+    tag_info{dicom_tag{0x0018, 0x1600}, vr(VR::CS), vm_1_3, "ShutterShape", "Shutter Shape", false},
+    tag_info{dicom_tag{0x0018, 0x1602}, vr(VR::IS), vm_1, "ShutterLeftVerticalEdge", "Shutter Left Vertical Edge", false},
+    tag_info{dicom_tag{0x0018, 0x1604}, vr(VR::IS), vm_1, "ShutterRightVerticalEdge", "Shutter Right Vertical Edge", false},
+    tag_info{dicom_tag{0x0018, 0x1606}, vr(VR::IS), vm_1, "ShutterUpperHorizontalEdge", "Shutter Upper Horizontal Edge", false},
+    tag_info{dicom_tag{0x0018, 0x1608}, vr(VR::IS), vm_1, "ShutterLowerHorizontalEdge", "Shutter Lower Horizontal Edge", false},
+    tag_info{dicom_tag{0x0018, 0x1610}, vr(VR::IS), vm_2, "CenterOfCircularShutter", "Center of Circular Shutter", false},
+    tag_info{dicom_tag{0x0018, 0x1612}, vr(VR::IS), vm_1, "RadiusOfCircularShutter", "Radius of Circular Shutter", false},
+    tag_info{dicom_tag{0x0018, 0x1620}, vr(VR::IS), vm_2_2n, "VerticesOfThePolygonalShutter", "Vertices of the Polygonal Shutter", false},
+    tag_info{dicom_tag{0x0018, 0x1622}, vr(VR::US), vm_1, "ShutterPresentationValue", "Shutter Presentation Value", false},
+    tag_info{dicom_tag{0x0018, 0x1623}, vr(VR::US), vm_1, "ShutterOverlayGroup", "Shutter Overlay Group", false},
+    tag_info{dicom_tag{0x0018, 0x1624}, vr(VR::US), vm_3, "ShutterPresentationColorCIELabValue", "Shutter Presentation Color CIELab Value", false},
+    tag_info{dicom_tag{0x0018, 0x1630}, vr(VR::CS), vm_1, "OutlineShapeType", "Outline Shape Type", false},
+    tag_info{dicom_tag{0x0018, 0x1631}, vr(VR::FD), vm_1, "OutlineLeftVerticalEdge", "Outline Left Vertical Edge", false},
+    tag_info{dicom_tag{0x0018, 0x1632}, vr(VR::FD), vm_1, "OutlineRightVerticalEdge", "Outline Right Vertical Edge", false},
+    tag_info{dicom_tag{0x0018, 0x1633}, vr(VR::FD), vm_1, "OutlineUpperHorizontalEdge", "Outline Upper Horizontal Edge", false},
+    tag_info{dicom_tag{0x0018, 0x1634}, vr(VR::FD), vm_1, "OutlineLowerHorizontalEdge", "Outline Lower Horizontal Edge", false},
+    tag_info{dicom_tag{0x0018, 0x1635}, vr(VR::FD), vm_2, "CenterOfCircularOutline", "Center of Circular Outline", false},
+    tag_info{dicom_tag{0x0018, 0x1636}, vr(VR::FD), vm_1, "DiameterOfCircularOutline", "Diameter of Circular Outline", false},
+    tag_info{dicom_tag{0x0018, 0x1637}, vr(VR::UL), vm_1, "NumberOfPolygonalVertices", "Number of Polygonal Vertices", false},
+    tag_info{dicom_tag{0x0018, 0x1638}, vr(VR::OF), vm_1, "VerticesOfThePolygonalOutline", "Vertices of the Polygonal Outline", false},
+    tag_info{dicom_tag{0x0018, 0x1700}, vr(VR::CS), vm_1_3, "CollimatorShape", "Collimator Shape", false},
+    tag_info{dicom_tag{0x0018, 0x1702}, vr(VR::IS), vm_1, "CollimatorLeftVerticalEdge", "Collimator Left Vertical Edge", false},
+    tag_info{dicom_tag{0x0018, 0x1704}, vr(VR::IS), vm_1, "CollimatorRightVerticalEdge", "Collimator Right Vertical Edge", false},
+    tag_info{dicom_tag{0x0018, 0x1706}, vr(VR::IS), vm_1, "CollimatorUpperHorizontalEdge", "Collimator Upper Horizontal Edge", false},
+    tag_info{dicom_tag{0x0018, 0x1708}, vr(VR::IS), vm_1, "CollimatorLowerHorizontalEdge", "Collimator Lower Horizontal Edge", false},
+    tag_info{dicom_tag{0x0018, 0x1710}, vr(VR::IS), vm_2, "CenterOfCircularCollimator", "Center of Circular Collimator", false},
+    tag_info{dicom_tag{0x0018, 0x1712}, vr(VR::IS), vm_1, "RadiusOfCircularCollimator", "Radius of Circular Collimator", false},
+    tag_info{dicom_tag{0x0018, 0x1720}, vr(VR::IS), vm_2_2n, "VerticesOfThePolygonalCollimator", "Vertices of the Polygonal Collimator", false},
+    tag_info{dicom_tag{0x0018, 0x1800}, vr(VR::CS), vm_1, "AcquisitionTimeSynchronized", "Acquisition Time Synchronized", false},
+    tag_info{dicom_tag{0x0018, 0x1801}, vr(VR::SH), vm_1, "TimeSource", "Time Source", false},
+    tag_info{dicom_tag{0x0018, 0x1802}, vr(VR::CS), vm_1, "TimeDistributionProtocol", "Time Distribution Protocol", false},
+    tag_info{dicom_tag{0x0018, 0x1803}, vr(VR::LO), vm_1, "NTPSourceAddress", "NTP Source Address", false},
+    tag_info{dicom_tag{0x0018, 0x2001}, vr(VR::IS), vm_1_n, "PageNumberVector", "Page Number Vector", false},
+    tag_info{dicom_tag{0x0018, 0x2002}, vr(VR::SH), vm_1_n, "FrameLabelVector", "Frame Label Vector", false},
+    tag_info{dicom_tag{0x0018, 0x2003}, vr(VR::DS), vm_1_n, "FramePrimaryAngleVector", "Frame Primary Angle Vector", false},
+    tag_info{dicom_tag{0x0018, 0x2004}, vr(VR::DS), vm_1_n, "FrameSecondaryAngleVector", "Frame Secondary Angle Vector", false},
+    tag_info{dicom_tag{0x0018, 0x2005}, vr(VR::DS), vm_1_n, "SliceLocationVector", "Slice Location Vector", false},
+    tag_info{dicom_tag{0x0018, 0x2006}, vr(VR::SH), vm_1_n, "DisplayWindowLabelVector", "Display Window Label Vector", false},
+    tag_info{dicom_tag{0x0018, 0x2010}, vr(VR::DS), vm_2, "NominalScannedPixelSpacing", "Nominal Scanned Pixel Spacing", false},
+    tag_info{dicom_tag{0x0018, 0x2020}, vr(VR::CS), vm_1, "DigitizingDeviceTransportDirection", "Digitizing Device Transport Direction", false},
+    tag_info{dicom_tag{0x0018, 0x2030}, vr(VR::DS), vm_1, "RotationOfScannedFilm", "Rotation of Scanned Film", false},
+    tag_info{dicom_tag{0x0018, 0x2041}, vr(VR::SQ), vm_1, "BiopsyTargetSequence", "Biopsy Target Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x2042}, vr(VR::UI), vm_1, "TargetUID", "Target UID", false},
+    tag_info{dicom_tag{0x0018, 0x2043}, vr(VR::FL), vm_2, "LocalizingCursorPosition", "Localizing Cursor Position", false},
+    tag_info{dicom_tag{0x0018, 0x2044}, vr(VR::FL), vm_3, "CalculatedTargetPosition", "Calculated Target Position", false},
+    tag_info{dicom_tag{0x0018, 0x2045}, vr(VR::SH), vm_1, "TargetLabel", "Target Label", false},
+    tag_info{dicom_tag{0x0018, 0x2046}, vr(VR::FL), vm_1, "DisplayedZValue", "Displayed Z Value", false},
+    tag_info{dicom_tag{0x0018, 0x3100}, vr(VR::CS), vm_1, "IVUSAcquisition", "IVUS Acquisition", false},
+    tag_info{dicom_tag{0x0018, 0x3101}, vr(VR::DS), vm_1, "IVUSPullbackRate", "IVUS Pullback Rate", false},
+    tag_info{dicom_tag{0x0018, 0x3102}, vr(VR::DS), vm_1, "IVUSGatedRate", "IVUS Gated Rate", false},
+    tag_info{dicom_tag{0x0018, 0x3103}, vr(VR::IS), vm_1, "IVUSPullbackStartFrameNumber", "IVUS Pullback Start Frame Number", false},
+    tag_info{dicom_tag{0x0018, 0x3104}, vr(VR::IS), vm_1, "IVUSPullbackStopFrameNumber", "IVUS Pullback Stop Frame Number", false},
+    tag_info{dicom_tag{0x0018, 0x3105}, vr(VR::IS), vm_1_n, "LesionNumber", "Lesion Number", false},
+    tag_info{dicom_tag{0x0018, 0x4000}, vr(VR::LT), vm_1, "AcquisitionComments", "Acquisition Comments", true},
+    tag_info{dicom_tag{0x0018, 0x5000}, vr(VR::SH), vm_1_n, "OutputPower", "Output Power", false},
+    tag_info{dicom_tag{0x0018, 0x5010}, vr(VR::LO), vm_1_n, "TransducerData", "Transducer Data", false},
+    tag_info{dicom_tag{0x0018, 0x5011}, vr(VR::SQ), vm_1, "TransducerIdentificationSequence", "Transducer Identification Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x5012}, vr(VR::DS), vm_1, "FocusDepth", "Focus Depth", false},
+    tag_info{dicom_tag{0x0018, 0x5020}, vr(VR::LO), vm_1, "ProcessingFunction", "Processing Function", false},
+    tag_info{dicom_tag{0x0018, 0x5021}, vr(VR::LO), vm_1, "PostprocessingFunction", "Postprocessing Function", true},
+    tag_info{dicom_tag{0x0018, 0x5022}, vr(VR::DS), vm_1, "MechanicalIndex", "Mechanical Index", false},
+    tag_info{dicom_tag{0x0018, 0x5024}, vr(VR::DS), vm_1, "BoneThermalIndex", "Bone Thermal Index", false},
+    tag_info{dicom_tag{0x0018, 0x5026}, vr(VR::DS), vm_1, "CranialThermalIndex", "Cranial Thermal Index", false},
+    tag_info{dicom_tag{0x0018, 0x5027}, vr(VR::DS), vm_1, "SoftTissueThermalIndex", "Soft Tissue Thermal Index", false},
+    tag_info{dicom_tag{0x0018, 0x5028}, vr(VR::DS), vm_1, "SoftTissueFocusThermalIndex", "Soft Tissue-focus Thermal Index", false},
+    tag_info{dicom_tag{0x0018, 0x5029}, vr(VR::DS), vm_1, "SoftTissueSurfaceThermalIndex", "Soft Tissue-surface Thermal Index", false},
+    tag_info{dicom_tag{0x0018, 0x5030}, vr(VR::DS), vm_1, "DynamicRange", "Dynamic Range", true},
+    tag_info{dicom_tag{0x0018, 0x5040}, vr(VR::DS), vm_1, "TotalGain", "Total Gain", true},
+    tag_info{dicom_tag{0x0018, 0x5050}, vr(VR::IS), vm_1, "DepthOfScanField", "Depth of Scan Field", false},
+    tag_info{dicom_tag{0x0018, 0x5100}, vr(VR::CS), vm_1, "PatientPosition", "Patient Position", false},
+    tag_info{dicom_tag{0x0018, 0x5101}, vr(VR::CS), vm_1, "ViewPosition", "View Position", false},
+    tag_info{dicom_tag{0x0018, 0x5104}, vr(VR::SQ), vm_1, "ProjectionEponymousNameCodeSequence", "Projection Eponymous Name Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x5210}, vr(VR::DS), vm_6, "ImageTransformationMatrix", "Image Transformation Matrix", true},
+    tag_info{dicom_tag{0x0018, 0x5212}, vr(VR::DS), vm_3, "ImageTranslationVector", "Image Translation Vector", true},
+    tag_info{dicom_tag{0x0018, 0x6000}, vr(VR::DS), vm_1, "Sensitivity", "Sensitivity", false},
+    tag_info{dicom_tag{0x0018, 0x6011}, vr(VR::SQ), vm_1, "SequenceOfUltrasoundRegions", "Sequence of Ultrasound Regions", false},
+    tag_info{dicom_tag{0x0018, 0x6012}, vr(VR::US), vm_1, "RegionSpatialFormat", "Region Spatial Format", false},
+    tag_info{dicom_tag{0x0018, 0x6014}, vr(VR::US), vm_1, "RegionDataType", "Region Data Type", false},
+    tag_info{dicom_tag{0x0018, 0x6016}, vr(VR::UL), vm_1, "RegionFlags", "Region Flags", false},
+    tag_info{dicom_tag{0x0018, 0x6018}, vr(VR::UL), vm_1, "RegionLocationMinX0", "Region Location Min X0", false},
+    tag_info{dicom_tag{0x0018, 0x601A}, vr(VR::UL), vm_1, "RegionLocationMinY0", "Region Location Min Y0", false},
+    tag_info{dicom_tag{0x0018, 0x601C}, vr(VR::UL), vm_1, "RegionLocationMaxX1", "Region Location Max X1", false},
+    tag_info{dicom_tag{0x0018, 0x601E}, vr(VR::UL), vm_1, "RegionLocationMaxY1", "Region Location Max Y1", false},
+    tag_info{dicom_tag{0x0018, 0x6020}, vr(VR::SL), vm_1, "ReferencePixelX0", "Reference Pixel X0", false},
+    tag_info{dicom_tag{0x0018, 0x6022}, vr(VR::SL), vm_1, "ReferencePixelY0", "Reference Pixel Y0", false},
+    tag_info{dicom_tag{0x0018, 0x6024}, vr(VR::US), vm_1, "PhysicalUnitsXDirection", "Physical Units X Direction", false},
+    tag_info{dicom_tag{0x0018, 0x6026}, vr(VR::US), vm_1, "PhysicalUnitsYDirection", "Physical Units Y Direction", false},
+    tag_info{dicom_tag{0x0018, 0x6028}, vr(VR::FD), vm_1, "ReferencePixelPhysicalValueX", "Reference Pixel Physical Value X", false},
+    tag_info{dicom_tag{0x0018, 0x602A}, vr(VR::FD), vm_1, "ReferencePixelPhysicalValueY", "Reference Pixel Physical Value Y", false},
+    tag_info{dicom_tag{0x0018, 0x602C}, vr(VR::FD), vm_1, "PhysicalDeltaX", "Physical Delta X", false},
+    tag_info{dicom_tag{0x0018, 0x602E}, vr(VR::FD), vm_1, "PhysicalDeltaY", "Physical Delta Y", false},
+    tag_info{dicom_tag{0x0018, 0x6030}, vr(VR::UL), vm_1, "TransducerFrequency", "Transducer Frequency", false},
+    tag_info{dicom_tag{0x0018, 0x6031}, vr(VR::CS), vm_1, "TransducerType", "Transducer Type", false},
+    tag_info{dicom_tag{0x0018, 0x6032}, vr(VR::UL), vm_1, "PulseRepetitionFrequency", "Pulse Repetition Frequency", false},
+    tag_info{dicom_tag{0x0018, 0x6034}, vr(VR::FD), vm_1, "DopplerCorrectionAngle", "Doppler Correction Angle", false},
+    tag_info{dicom_tag{0x0018, 0x6036}, vr(VR::FD), vm_1, "SteeringAngle", "Steering Angle", false},
+    tag_info{dicom_tag{0x0018, 0x6038}, vr(VR::UL), vm_1, "DopplerSampleVolumeXPositionRetired", "Doppler Sample Volume X Position (Retired)", true},
+    tag_info{dicom_tag{0x0018, 0x6039}, vr(VR::SL), vm_1, "DopplerSampleVolumeXPosition", "Doppler Sample Volume X Position", false},
+    tag_info{dicom_tag{0x0018, 0x603A}, vr(VR::UL), vm_1, "DopplerSampleVolumeYPositionRetired", "Doppler Sample Volume Y Position (Retired)", true},
+    tag_info{dicom_tag{0x0018, 0x603B}, vr(VR::SL), vm_1, "DopplerSampleVolumeYPosition", "Doppler Sample Volume Y Position", false},
+    tag_info{dicom_tag{0x0018, 0x603C}, vr(VR::UL), vm_1, "TMLinePositionX0Retired", "TM-Line Position X0 (Retired)", true},
+    tag_info{dicom_tag{0x0018, 0x603D}, vr(VR::SL), vm_1, "TMLinePositionX0", "TM-Line Position X0", false},
+    tag_info{dicom_tag{0x0018, 0x603E}, vr(VR::UL), vm_1, "TMLinePositionY0Retired", "TM-Line Position Y0 (Retired)", true},
+    tag_info{dicom_tag{0x0018, 0x603F}, vr(VR::SL), vm_1, "TMLinePositionY0", "TM-Line Position Y0", false},
+    tag_info{dicom_tag{0x0018, 0x6040}, vr(VR::UL), vm_1, "TMLinePositionX1Retired", "TM-Line Position X1 (Retired)", true},
+    tag_info{dicom_tag{0x0018, 0x6041}, vr(VR::SL), vm_1, "TMLinePositionX1", "TM-Line Position X1", false},
+    tag_info{dicom_tag{0x0018, 0x6042}, vr(VR::UL), vm_1, "TMLinePositionY1Retired", "TM-Line Position Y1 (Retired)", true},
+    tag_info{dicom_tag{0x0018, 0x6043}, vr(VR::SL), vm_1, "TMLinePositionY1", "TM-Line Position Y1", false},
+    tag_info{dicom_tag{0x0018, 0x6044}, vr(VR::US), vm_1, "PixelComponentOrganization", "Pixel Component Organization", false},
+    tag_info{dicom_tag{0x0018, 0x6046}, vr(VR::UL), vm_1, "PixelComponentMask", "Pixel Component Mask", false},
+    tag_info{dicom_tag{0x0018, 0x6048}, vr(VR::UL), vm_1, "PixelComponentRangeStart", "Pixel Component Range Start", false},
+    tag_info{dicom_tag{0x0018, 0x604A}, vr(VR::UL), vm_1, "PixelComponentRangeStop", "Pixel Component Range Stop", false},
+    tag_info{dicom_tag{0x0018, 0x604C}, vr(VR::US), vm_1, "PixelComponentPhysicalUnits", "Pixel Component Physical Units", false},
+    tag_info{dicom_tag{0x0018, 0x604E}, vr(VR::US), vm_1, "PixelComponentDataType", "Pixel Component Data Type", false},
+    tag_info{dicom_tag{0x0018, 0x6050}, vr(VR::UL), vm_1, "NumberOfTableBreakPoints", "Number of Table Break Points", false},
+    tag_info{dicom_tag{0x0018, 0x6052}, vr(VR::UL), vm_1_n, "TableOfXBreakPoints", "Table of X Break Points", false},
+    tag_info{dicom_tag{0x0018, 0x6054}, vr(VR::FD), vm_1_n, "TableOfYBreakPoints", "Table of Y Break Points", false},
+    tag_info{dicom_tag{0x0018, 0x6056}, vr(VR::UL), vm_1, "NumberOfTableEntries", "Number of Table Entries", false},
+    tag_info{dicom_tag{0x0018, 0x6058}, vr(VR::UL), vm_1_n, "TableOfPixelValues", "Table of Pixel Values", false},
+    tag_info{dicom_tag{0x0018, 0x605A}, vr(VR::FL), vm_1_n, "TableOfParameterValues", "Table of Parameter Values", false},
+    tag_info{dicom_tag{0x0018, 0x6060}, vr(VR::FL), vm_1_n, "RWaveTimeVector", "R Wave Time Vector", false},
+    tag_info{dicom_tag{0x0018, 0x6070}, vr(VR::US), vm_1, "ActiveImageAreaOverlayGroup", "Active Image Area Overlay Group", false},
+    tag_info{dicom_tag{0x0018, 0x7000}, vr(VR::CS), vm_1, "DetectorConditionsNominalFlag", "Detector Conditions Nominal Flag", false},
+    tag_info{dicom_tag{0x0018, 0x7001}, vr(VR::DS), vm_1, "DetectorTemperature", "Detector Temperature", false},
+    tag_info{dicom_tag{0x0018, 0x7004}, vr(VR::CS), vm_1, "DetectorType", "Detector Type", false},
+    tag_info{dicom_tag{0x0018, 0x7005}, vr(VR::CS), vm_1, "DetectorConfiguration", "Detector Configuration", false},
+    tag_info{dicom_tag{0x0018, 0x7006}, vr(VR::LT), vm_1, "DetectorDescription", "Detector Description", false},
+    tag_info{dicom_tag{0x0018, 0x7008}, vr(VR::LT), vm_1, "DetectorMode", "Detector Mode", false},
+    tag_info{dicom_tag{0x0018, 0x700A}, vr(VR::SH), vm_1, "DetectorID", "Detector ID", false},
+    tag_info{dicom_tag{0x0018, 0x700C}, vr(VR::DA), vm_1, "DateOfLastDetectorCalibration", "Date of Last Detector Calibration", false},
+    tag_info{dicom_tag{0x0018, 0x700E}, vr(VR::TM), vm_1, "TimeOfLastDetectorCalibration", "Time of Last Detector Calibration", false},
+    tag_info{dicom_tag{0x0018, 0x7010}, vr(VR::IS), vm_1, "ExposuresOnDetectorSinceLastCalibration", "Exposures on Detector Since Last Calibration", false},
+    tag_info{dicom_tag{0x0018, 0x7011}, vr(VR::IS), vm_1, "ExposuresOnDetectorSinceManufactured", "Exposures on Detector Since Manufactured", false},
+    tag_info{dicom_tag{0x0018, 0x7012}, vr(VR::DS), vm_1, "DetectorTimeSinceLastExposure", "Detector Time Since Last Exposure", false},
+    tag_info{dicom_tag{0x0018, 0x7014}, vr(VR::DS), vm_1, "DetectorActiveTime", "Detector Active Time", false},
+    tag_info{dicom_tag{0x0018, 0x7016}, vr(VR::DS), vm_1, "DetectorActivationOffsetFromExposure", "Detector Activation Offset From Exposure", false},
+    tag_info{dicom_tag{0x0018, 0x701A}, vr(VR::DS), vm_2, "DetectorBinning", "Detector Binning", false},
+    tag_info{dicom_tag{0x0018, 0x7020}, vr(VR::DS), vm_2, "DetectorElementPhysicalSize", "Detector Element Physical Size", false},
+    tag_info{dicom_tag{0x0018, 0x7022}, vr(VR::DS), vm_2, "DetectorElementSpacing", "Detector Element Spacing", false},
+    tag_info{dicom_tag{0x0018, 0x7024}, vr(VR::CS), vm_1, "DetectorActiveShape", "Detector Active Shape", false},
+    tag_info{dicom_tag{0x0018, 0x7026}, vr(VR::DS), vm_1_2, "DetectorActiveDimensions", "Detector Active Dimension(s)", false},
+    tag_info{dicom_tag{0x0018, 0x7028}, vr(VR::DS), vm_2, "DetectorActiveOrigin", "Detector Active Origin", false},
+    tag_info{dicom_tag{0x0018, 0x702A}, vr(VR::LO), vm_1, "DetectorManufacturerName", "Detector Manufacturer Name", false},
+    tag_info{dicom_tag{0x0018, 0x702B}, vr(VR::LO), vm_1, "DetectorManufacturerModelName", "Detector Manufacturer's Model Name", false},
+    tag_info{dicom_tag{0x0018, 0x7030}, vr(VR::DS), vm_2, "FieldOfViewOrigin", "Field of View Origin", false},
+    tag_info{dicom_tag{0x0018, 0x7032}, vr(VR::DS), vm_1, "FieldOfViewRotation", "Field of View Rotation", false},
+    tag_info{dicom_tag{0x0018, 0x7034}, vr(VR::CS), vm_1, "FieldOfViewHorizontalFlip", "Field of View Horizontal Flip", false},
+    tag_info{dicom_tag{0x0018, 0x7036}, vr(VR::FL), vm_2, "PixelDataAreaOriginRelativeToFOV", "Pixel Data Area Origin Relative To FOV", false},
+    tag_info{dicom_tag{0x0018, 0x7038}, vr(VR::FL), vm_1, "PixelDataAreaRotationAngleRelativeToFOV", "Pixel Data Area Rotation Angle Relative To FOV", false},
+    tag_info{dicom_tag{0x0018, 0x7040}, vr(VR::LT), vm_1, "GridAbsorbingMaterial", "Grid Absorbing Material", false},
+    tag_info{dicom_tag{0x0018, 0x7041}, vr(VR::LT), vm_1, "GridSpacingMaterial", "Grid Spacing Material", false},
+    tag_info{dicom_tag{0x0018, 0x7042}, vr(VR::DS), vm_1, "GridThickness", "Grid Thickness", false},
+    tag_info{dicom_tag{0x0018, 0x7044}, vr(VR::DS), vm_1, "GridPitch", "Grid Pitch", false},
+    tag_info{dicom_tag{0x0018, 0x7046}, vr(VR::IS), vm_2, "GridAspectRatio", "Grid Aspect Ratio", false},
+    tag_info{dicom_tag{0x0018, 0x7048}, vr(VR::DS), vm_1, "GridPeriod", "Grid Period", false},
+    tag_info{dicom_tag{0x0018, 0x704C}, vr(VR::DS), vm_1, "GridFocalDistance", "Grid Focal Distance", false},
+    tag_info{dicom_tag{0x0018, 0x7050}, vr(VR::CS), vm_1_n, "FilterMaterial", "Filter Material", false},
+    tag_info{dicom_tag{0x0018, 0x7052}, vr(VR::DS), vm_1_n, "FilterThicknessMinimum", "Filter Thickness Minimum", false},
+    tag_info{dicom_tag{0x0018, 0x7054}, vr(VR::DS), vm_1_n, "FilterThicknessMaximum", "Filter Thickness Maximum", false},
+    tag_info{dicom_tag{0x0018, 0x7056}, vr(VR::FL), vm_1_n, "FilterBeamPathLengthMinimum", "Filter Beam Path Length Minimum", false},
+    tag_info{dicom_tag{0x0018, 0x7058}, vr(VR::FL), vm_1_n, "FilterBeamPathLengthMaximum", "Filter Beam Path Length Maximum", false},
+    tag_info{dicom_tag{0x0018, 0x7060}, vr(VR::CS), vm_1, "ExposureControlMode", "Exposure Control Mode", false},
+    tag_info{dicom_tag{0x0018, 0x7062}, vr(VR::LT), vm_1, "ExposureControlModeDescription", "Exposure Control Mode Description", false},
+    tag_info{dicom_tag{0x0018, 0x7064}, vr(VR::CS), vm_1, "ExposureStatus", "Exposure Status", false},
+    tag_info{dicom_tag{0x0018, 0x7065}, vr(VR::DS), vm_1, "PhototimerSetting", "Phototimer Setting", false},
+    tag_info{dicom_tag{0x0018, 0x8150}, vr(VR::DS), vm_1, "ExposureTimeInuS", "Exposure Time in uS", false},
+    tag_info{dicom_tag{0x0018, 0x8151}, vr(VR::DS), vm_1, "XRayTubeCurrentInuA", "X-Ray Tube Current in uA", false},
+    tag_info{dicom_tag{0x0018, 0x9004}, vr(VR::CS), vm_1, "ContentQualification", "Content Qualification", false},
+    tag_info{dicom_tag{0x0018, 0x9005}, vr(VR::SH), vm_1, "PulseSequenceName", "Pulse Sequence Name", false},
+    tag_info{dicom_tag{0x0018, 0x9006}, vr(VR::SQ), vm_1, "MRImagingModifierSequence", "MR Imaging Modifier Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9008}, vr(VR::CS), vm_1, "EchoPulseSequence", "Echo Pulse Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9009}, vr(VR::CS), vm_1, "InversionRecovery", "Inversion Recovery", false},
+    tag_info{dicom_tag{0x0018, 0x9010}, vr(VR::CS), vm_1, "FlowCompensation", "Flow Compensation", false},
+    tag_info{dicom_tag{0x0018, 0x9011}, vr(VR::CS), vm_1, "MultipleSpinEcho", "Multiple Spin Echo", false},
+    tag_info{dicom_tag{0x0018, 0x9012}, vr(VR::CS), vm_1, "MultiPlanarExcitation", "Multi-planar Excitation", false},
+    tag_info{dicom_tag{0x0018, 0x9014}, vr(VR::CS), vm_1, "PhaseContrast", "Phase Contrast", false},
+    tag_info{dicom_tag{0x0018, 0x9015}, vr(VR::CS), vm_1, "TimeOfFlightContrast", "Time of Flight Contrast", false},
+    tag_info{dicom_tag{0x0018, 0x9016}, vr(VR::CS), vm_1, "Spoiling", "Spoiling", false},
+    tag_info{dicom_tag{0x0018, 0x9017}, vr(VR::CS), vm_1, "SteadyStatePulseSequence", "Steady State Pulse Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9018}, vr(VR::CS), vm_1, "EchoPlanarPulseSequence", "Echo Planar Pulse Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9019}, vr(VR::FD), vm_1, "TagAngleFirstAxis", "Tag Angle First Axis", false},
+    tag_info{dicom_tag{0x0018, 0x9020}, vr(VR::CS), vm_1, "MagnetizationTransfer", "Magnetization Transfer", false},
+    tag_info{dicom_tag{0x0018, 0x9021}, vr(VR::CS), vm_1, "T2Preparation", "T2 Preparation", false},
+    tag_info{dicom_tag{0x0018, 0x9022}, vr(VR::CS), vm_1, "BloodSignalNulling", "Blood Signal Nulling", false},
+    tag_info{dicom_tag{0x0018, 0x9024}, vr(VR::CS), vm_1, "SaturationRecovery", "Saturation Recovery", false},
+    tag_info{dicom_tag{0x0018, 0x9025}, vr(VR::CS), vm_1, "SpectrallySelectedSuppression", "Spectrally Selected Suppression", false},
+    tag_info{dicom_tag{0x0018, 0x9026}, vr(VR::CS), vm_1, "SpectrallySelectedExcitation", "Spectrally Selected Excitation", false},
+    tag_info{dicom_tag{0x0018, 0x9027}, vr(VR::CS), vm_1, "SpatialPresaturation", "Spatial Pre-saturation", false},
+    tag_info{dicom_tag{0x0018, 0x9028}, vr(VR::CS), vm_1, "Tagging", "Tagging", false},
+    tag_info{dicom_tag{0x0018, 0x9029}, vr(VR::CS), vm_1, "OversamplingPhase", "Oversampling Phase", false},
+    tag_info{dicom_tag{0x0018, 0x9030}, vr(VR::FD), vm_1, "TagSpacingFirstDimension", "Tag Spacing First Dimension", false},
+    tag_info{dicom_tag{0x0018, 0x9032}, vr(VR::CS), vm_1, "GeometryOfKSpaceTraversal", "Geometry of k-Space Traversal", false},
+    tag_info{dicom_tag{0x0018, 0x9033}, vr(VR::CS), vm_1, "SegmentedKSpaceTraversal", "Segmented k-Space Traversal", false},
+    tag_info{dicom_tag{0x0018, 0x9034}, vr(VR::CS), vm_1, "RectilinearPhaseEncodeReordering", "Rectilinear Phase Encode Reordering", false},
+    tag_info{dicom_tag{0x0018, 0x9035}, vr(VR::FD), vm_1, "TagThickness", "Tag Thickness", false},
+    tag_info{dicom_tag{0x0018, 0x9036}, vr(VR::CS), vm_1, "PartialFourierDirection", "Partial Fourier Direction", false},
+    tag_info{dicom_tag{0x0018, 0x9037}, vr(VR::CS), vm_1, "CardiacSynchronizationTechnique", "Cardiac Synchronization Technique", false},
+    tag_info{dicom_tag{0x0018, 0x9041}, vr(VR::LO), vm_1, "ReceiveCoilManufacturerName", "Receive Coil Manufacturer Name", false},
+    tag_info{dicom_tag{0x0018, 0x9042}, vr(VR::SQ), vm_1, "MRReceiveCoilSequence", "MR Receive Coil Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9043}, vr(VR::CS), vm_1, "ReceiveCoilType", "Receive Coil Type", false},
+    tag_info{dicom_tag{0x0018, 0x9044}, vr(VR::CS), vm_1, "QuadratureReceiveCoil", "Quadrature Receive Coil", false},
+    tag_info{dicom_tag{0x0018, 0x9045}, vr(VR::SQ), vm_1, "MultiCoilDefinitionSequence", "Multi-Coil Definition Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9046}, vr(VR::LO), vm_1, "MultiCoilConfiguration", "Multi-Coil Configuration", false},
+    tag_info{dicom_tag{0x0018, 0x9047}, vr(VR::SH), vm_1, "MultiCoilElementName", "Multi-Coil Element Name", false},
+    tag_info{dicom_tag{0x0018, 0x9048}, vr(VR::CS), vm_1, "MultiCoilElementUsed", "Multi-Coil Element Used", false},
+    tag_info{dicom_tag{0x0018, 0x9049}, vr(VR::SQ), vm_1, "MRTransmitCoilSequence", "MR Transmit Coil Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9050}, vr(VR::LO), vm_1, "TransmitCoilManufacturerName", "Transmit Coil Manufacturer Name", false},
+    tag_info{dicom_tag{0x0018, 0x9051}, vr(VR::CS), vm_1, "TransmitCoilType", "Transmit Coil Type", false},
+    tag_info{dicom_tag{0x0018, 0x9052}, vr(VR::FD), vm_1_2, "SpectralWidth", "Spectral Width", false},
+    tag_info{dicom_tag{0x0018, 0x9053}, vr(VR::FD), vm_1_2, "ChemicalShiftReference", "Chemical Shift Reference", false},
+    tag_info{dicom_tag{0x0018, 0x9054}, vr(VR::CS), vm_1, "VolumeLocalizationTechnique", "Volume Localization Technique", false},
+    tag_info{dicom_tag{0x0018, 0x9058}, vr(VR::US), vm_1, "MRAcquisitionFrequencyEncodingSteps", "MR Acquisition Frequency Encoding Steps", false},
+    tag_info{dicom_tag{0x0018, 0x9059}, vr(VR::CS), vm_1, "Decoupling", "De-coupling", false},
+    tag_info{dicom_tag{0x0018, 0x9060}, vr(VR::CS), vm_1_2, "DecoupledNucleus", "De-coupled Nucleus", false},
+    tag_info{dicom_tag{0x0018, 0x9061}, vr(VR::FD), vm_1_2, "DecouplingFrequency", "De-coupling Frequency", false},
+    tag_info{dicom_tag{0x0018, 0x9062}, vr(VR::CS), vm_1, "DecouplingMethod", "De-coupling Method", false},
+    tag_info{dicom_tag{0x0018, 0x9063}, vr(VR::FD), vm_1_2, "DecouplingChemicalShiftReference", "De-coupling Chemical Shift Reference", false},
+    tag_info{dicom_tag{0x0018, 0x9064}, vr(VR::CS), vm_1, "KSpaceFiltering", "k-space Filtering", false},
+    tag_info{dicom_tag{0x0018, 0x9065}, vr(VR::CS), vm_1_2, "TimeDomainFiltering", "Time Domain Filtering", false},
+    tag_info{dicom_tag{0x0018, 0x9066}, vr(VR::US), vm_1_2, "NumberOfZeroFills", "Number of Zero Fills", false},
+    tag_info{dicom_tag{0x0018, 0x9067}, vr(VR::CS), vm_1, "BaselineCorrection", "Baseline Correction", false},
+    tag_info{dicom_tag{0x0018, 0x9069}, vr(VR::FD), vm_1, "ParallelReductionFactorInPlane", "Parallel Reduction Factor In-plane", false},
+    tag_info{dicom_tag{0x0018, 0x9070}, vr(VR::FD), vm_1, "CardiacRRIntervalSpecified", "Cardiac R-R Interval Specified", false},
+    tag_info{dicom_tag{0x0018, 0x9073}, vr(VR::FD), vm_1, "AcquisitionDuration", "Acquisition Duration", false},
+    tag_info{dicom_tag{0x0018, 0x9074}, vr(VR::DT), vm_1, "FrameAcquisitionDateTime", "Frame Acquisition DateTime", false},
+    tag_info{dicom_tag{0x0018, 0x9075}, vr(VR::CS), vm_1, "DiffusionDirectionality", "Diffusion Directionality", false},
+    tag_info{dicom_tag{0x0018, 0x9076}, vr(VR::SQ), vm_1, "DiffusionGradientDirectionSequence", "Diffusion Gradient Direction Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9077}, vr(VR::CS), vm_1, "ParallelAcquisition", "Parallel Acquisition", false},
+    tag_info{dicom_tag{0x0018, 0x9078}, vr(VR::CS), vm_1, "ParallelAcquisitionTechnique", "Parallel Acquisition Technique", false},
+    tag_info{dicom_tag{0x0018, 0x9079}, vr(VR::FD), vm_1_n, "InversionTimes", "Inversion Times", false},
+    tag_info{dicom_tag{0x0018, 0x9080}, vr(VR::ST), vm_1, "MetaboliteMapDescription", "Metabolite Map Description", false},
+    tag_info{dicom_tag{0x0018, 0x9081}, vr(VR::CS), vm_1, "PartialFourier", "Partial Fourier", false},
+    tag_info{dicom_tag{0x0018, 0x9082}, vr(VR::FD), vm_1, "EffectiveEchoTime", "Effective Echo Time", false},
+    tag_info{dicom_tag{0x0018, 0x9083}, vr(VR::SQ), vm_1, "MetaboliteMapCodeSequence", "Metabolite Map Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9084}, vr(VR::SQ), vm_1, "ChemicalShiftSequence", "Chemical Shift Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9085}, vr(VR::CS), vm_1, "CardiacSignalSource", "Cardiac Signal Source", false},
+    tag_info{dicom_tag{0x0018, 0x9087}, vr(VR::FD), vm_1, "DiffusionBValue", "Diffusion b-value", false},
+    tag_info{dicom_tag{0x0018, 0x9089}, vr(VR::FD), vm_3, "DiffusionGradientOrientation", "Diffusion Gradient Orientation", false},
+    tag_info{dicom_tag{0x0018, 0x9090}, vr(VR::FD), vm_3, "VelocityEncodingDirection", "Velocity Encoding Direction", false},
+    tag_info{dicom_tag{0x0018, 0x9091}, vr(VR::FD), vm_1, "VelocityEncodingMinimumValue", "Velocity Encoding Minimum Value", false},
+    tag_info{dicom_tag{0x0018, 0x9092}, vr(VR::SQ), vm_1, "VelocityEncodingAcquisitionSequence", "Velocity Encoding Acquisition Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9093}, vr(VR::US), vm_1, "NumberOfKSpaceTrajectories", "Number of k-Space Trajectories", false},
+    tag_info{dicom_tag{0x0018, 0x9094}, vr(VR::CS), vm_1, "CoverageOfKSpace", "Coverage of k-Space", false},
+    tag_info{dicom_tag{0x0018, 0x9095}, vr(VR::UL), vm_1, "SpectroscopyAcquisitionPhaseRows", "Spectroscopy Acquisition Phase Rows", false},
+    tag_info{dicom_tag{0x0018, 0x9096}, vr(VR::FD), vm_1, "ParallelReductionFactorInPlaneRetired", "Parallel Reduction Factor In-plane (Retired)", true},
+    tag_info{dicom_tag{0x0018, 0x9098}, vr(VR::FD), vm_1_2, "TransmitterFrequency", "Transmitter Frequency", false},
+    tag_info{dicom_tag{0x0018, 0x9100}, vr(VR::CS), vm_1_2, "ResonantNucleus", "Resonant Nucleus", false},
+    tag_info{dicom_tag{0x0018, 0x9101}, vr(VR::CS), vm_1, "FrequencyCorrection", "Frequency Correction", false},
+    tag_info{dicom_tag{0x0018, 0x9103}, vr(VR::SQ), vm_1, "MRSpectroscopyFOVGeometrySequence", "MR Spectroscopy FOV/Geometry Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9104}, vr(VR::FD), vm_1, "SlabThickness", "Slab Thickness", false},
+    tag_info{dicom_tag{0x0018, 0x9105}, vr(VR::FD), vm_3, "SlabOrientation", "Slab Orientation", false},
+    tag_info{dicom_tag{0x0018, 0x9106}, vr(VR::FD), vm_3, "MidSlabPosition", "Mid Slab Position", false},
+    tag_info{dicom_tag{0x0018, 0x9107}, vr(VR::SQ), vm_1, "MRSpatialSaturationSequence", "MR Spatial Saturation Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9112}, vr(VR::SQ), vm_1, "MRTimingAndRelatedParametersSequence", "MR Timing and Related Parameters Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9114}, vr(VR::SQ), vm_1, "MREchoSequence", "MR Echo Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9115}, vr(VR::SQ), vm_1, "MRModifierSequence", "MR Modifier Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9117}, vr(VR::SQ), vm_1, "MRDiffusionSequence", "MR Diffusion Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9118}, vr(VR::SQ), vm_1, "CardiacSynchronizationSequence", "Cardiac Synchronization Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9119}, vr(VR::SQ), vm_1, "MRAveragesSequence", "MR Averages Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9125}, vr(VR::SQ), vm_1, "MRFOVGeometrySequence", "MR FOV/Geometry Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9126}, vr(VR::SQ), vm_1, "VolumeLocalizationSequence", "Volume Localization Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9127}, vr(VR::UL), vm_1, "SpectroscopyAcquisitionDataColumns", "Spectroscopy Acquisition Data Columns", false},
+    tag_info{dicom_tag{0x0018, 0x9147}, vr(VR::CS), vm_1, "DiffusionAnisotropyType", "Diffusion Anisotropy Type", false},
+    tag_info{dicom_tag{0x0018, 0x9151}, vr(VR::DT), vm_1, "FrameReferenceDateTime", "Frame Reference DateTime", false},
+    tag_info{dicom_tag{0x0018, 0x9152}, vr(VR::SQ), vm_1, "MRMetaboliteMapSequence", "MR Metabolite Map Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9155}, vr(VR::FD), vm_1, "ParallelReductionFactorOutOfPlane", "Parallel Reduction Factor out-of-plane", false},
+    tag_info{dicom_tag{0x0018, 0x9159}, vr(VR::UL), vm_1, "SpectroscopyAcquisitionOutOfPlanePhaseSteps", "Spectroscopy Acquisition Out-of-plane Phase Steps", false},
+    tag_info{dicom_tag{0x0018, 0x9166}, vr(VR::CS), vm_1, "BulkMotionStatus", "Bulk Motion Status", true},
+    tag_info{dicom_tag{0x0018, 0x9168}, vr(VR::FD), vm_1, "ParallelReductionFactorSecondInPlane", "Parallel Reduction Factor Second In-plane", false},
+    tag_info{dicom_tag{0x0018, 0x9169}, vr(VR::CS), vm_1, "CardiacBeatRejectionTechnique", "Cardiac Beat Rejection Technique", false},
+    tag_info{dicom_tag{0x0018, 0x9170}, vr(VR::CS), vm_1, "RespiratoryMotionCompensationTechnique", "Respiratory Motion Compensation Technique", false},
+    tag_info{dicom_tag{0x0018, 0x9171}, vr(VR::CS), vm_1, "RespiratorySignalSource", "Respiratory Signal Source", false},
+    tag_info{dicom_tag{0x0018, 0x9172}, vr(VR::CS), vm_1, "BulkMotionCompensationTechnique", "Bulk Motion Compensation Technique", false},
+    tag_info{dicom_tag{0x0018, 0x9173}, vr(VR::CS), vm_1, "BulkMotionSignalSource", "Bulk Motion Signal Source", false},
+    tag_info{dicom_tag{0x0018, 0x9174}, vr(VR::CS), vm_1, "ApplicableSafetyStandardAgency", "Applicable Safety Standard Agency", false},
+    tag_info{dicom_tag{0x0018, 0x9175}, vr(VR::LO), vm_1, "ApplicableSafetyStandardDescription", "Applicable Safety Standard Description", false},
+    tag_info{dicom_tag{0x0018, 0x9176}, vr(VR::SQ), vm_1, "OperatingModeSequence", "Operating Mode Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9177}, vr(VR::CS), vm_1, "OperatingModeType", "Operating Mode Type", false},
+    tag_info{dicom_tag{0x0018, 0x9178}, vr(VR::CS), vm_1, "OperatingMode", "Operating Mode", false},
+    tag_info{dicom_tag{0x0018, 0x9179}, vr(VR::CS), vm_1, "SpecificAbsorptionRateDefinition", "Specific Absorption Rate Definition", false},
+    tag_info{dicom_tag{0x0018, 0x9180}, vr(VR::CS), vm_1, "GradientOutputType", "Gradient Output Type", false},
+    tag_info{dicom_tag{0x0018, 0x9181}, vr(VR::FD), vm_1, "SpecificAbsorptionRateValue", "Specific Absorption Rate Value", false},
+    tag_info{dicom_tag{0x0018, 0x9182}, vr(VR::FD), vm_1, "GradientOutput", "Gradient Output", false},
+    tag_info{dicom_tag{0x0018, 0x9183}, vr(VR::CS), vm_1, "FlowCompensationDirection", "Flow Compensation Direction", false},
+    tag_info{dicom_tag{0x0018, 0x9184}, vr(VR::FD), vm_1, "TaggingDelay", "Tagging Delay", false},
+    tag_info{dicom_tag{0x0018, 0x9185}, vr(VR::ST), vm_1, "RespiratoryMotionCompensationTechniqueDescription", "Respiratory Motion Compensation Technique Description", false},
+    tag_info{dicom_tag{0x0018, 0x9186}, vr(VR::SH), vm_1, "RespiratorySignalSourceID", "Respiratory Signal Source ID", false},
+    tag_info{dicom_tag{0x0018, 0x9195}, vr(VR::FD), vm_1, "ChemicalShiftMinimumIntegrationLimitInHz", "Chemical Shift Minimum Integration Limit in Hz", true},
+    tag_info{dicom_tag{0x0018, 0x9196}, vr(VR::FD), vm_1, "ChemicalShiftMaximumIntegrationLimitInHz", "Chemical Shift Maximum Integration Limit in Hz", true},
+    tag_info{dicom_tag{0x0018, 0x9197}, vr(VR::SQ), vm_1, "MRVelocityEncodingSequence", "MR Velocity Encoding Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9198}, vr(VR::CS), vm_1, "FirstOrderPhaseCorrection", "First Order Phase Correction", false},
+    tag_info{dicom_tag{0x0018, 0x9199}, vr(VR::CS), vm_1, "WaterReferencedPhaseCorrection", "Water Referenced Phase Correction", false},
+    tag_info{dicom_tag{0x0018, 0x9200}, vr(VR::CS), vm_1, "MRSpectroscopyAcquisitionType", "MR Spectroscopy Acquisition Type", false},
+    tag_info{dicom_tag{0x0018, 0x9214}, vr(VR::CS), vm_1, "RespiratoryCyclePosition", "Respiratory Cycle Position", false},
+    tag_info{dicom_tag{0x0018, 0x9217}, vr(VR::FD), vm_1, "VelocityEncodingMaximumValue", "Velocity Encoding Maximum Value", false},
+    tag_info{dicom_tag{0x0018, 0x9218}, vr(VR::FD), vm_1, "TagSpacingSecondDimension", "Tag Spacing Second Dimension", false},
+    tag_info{dicom_tag{0x0018, 0x9219}, vr(VR::SS), vm_1, "TagAngleSecondAxis", "Tag Angle Second Axis", false},
+    tag_info{dicom_tag{0x0018, 0x9220}, vr(VR::FD), vm_1, "FrameAcquisitionDuration", "Frame Acquisition Duration", false},
+    tag_info{dicom_tag{0x0018, 0x9226}, vr(VR::SQ), vm_1, "MRImageFrameTypeSequence", "MR Image Frame Type Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9227}, vr(VR::SQ), vm_1, "MRSpectroscopyFrameTypeSequence", "MR Spectroscopy Frame Type Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9231}, vr(VR::US), vm_1, "MRAcquisitionPhaseEncodingStepsInPlane", "MR Acquisition Phase Encoding Steps in-plane", false},
+    tag_info{dicom_tag{0x0018, 0x9232}, vr(VR::US), vm_1, "MRAcquisitionPhaseEncodingStepsOutOfPlane", "MR Acquisition Phase Encoding Steps out-of-plane", false},
+    tag_info{dicom_tag{0x0018, 0x9234}, vr(VR::UL), vm_1, "SpectroscopyAcquisitionPhaseColumns", "Spectroscopy Acquisition Phase Columns", false},
+    tag_info{dicom_tag{0x0018, 0x9236}, vr(VR::CS), vm_1, "CardiacCyclePosition", "Cardiac Cycle Position", false},
+    tag_info{dicom_tag{0x0018, 0x9239}, vr(VR::SQ), vm_1, "SpecificAbsorptionRateSequence", "Specific Absorption Rate Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9240}, vr(VR::US), vm_1, "RFEchoTrainLength", "RF Echo Train Length", false},
+    tag_info{dicom_tag{0x0018, 0x9241}, vr(VR::US), vm_1, "GradientEchoTrainLength", "Gradient Echo Train Length", false},
+    tag_info{dicom_tag{0x0018, 0x9250}, vr(VR::CS), vm_1, "ArterialSpinLabelingContrast", "Arterial Spin Labeling Contrast", false},
+    tag_info{dicom_tag{0x0018, 0x9251}, vr(VR::SQ), vm_1, "MRArterialSpinLabelingSequence", "MR Arterial Spin Labeling Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9252}, vr(VR::LO), vm_1, "ASLTechniqueDescription", "ASL Technique Description", false},
+    tag_info{dicom_tag{0x0018, 0x9253}, vr(VR::US), vm_1, "ASLSlabNumber", "ASL Slab Number", false},
+    tag_info{dicom_tag{0x0018, 0x9254}, vr(VR::FD), vm_1, "ASLSlabThickness", "ASL Slab Thickness", false},
+    tag_info{dicom_tag{0x0018, 0x9255}, vr(VR::FD), vm_3, "ASLSlabOrientation", "ASL Slab Orientation", false},
+    tag_info{dicom_tag{0x0018, 0x9256}, vr(VR::FD), vm_3, "ASLMidSlabPosition", "ASL Mid Slab Position", false},
+    tag_info{dicom_tag{0x0018, 0x9257}, vr(VR::CS), vm_1, "ASLContext", "ASL Context", false},
+    tag_info{dicom_tag{0x0018, 0x9258}, vr(VR::UL), vm_1, "ASLPulseTrainDuration", "ASL Pulse Train Duration", false},
+    tag_info{dicom_tag{0x0018, 0x9259}, vr(VR::CS), vm_1, "ASLCrusherFlag", "ASL Crusher Flag", false},
+    tag_info{dicom_tag{0x0018, 0x925A}, vr(VR::FD), vm_1, "ASLCrusherFlowLimit", "ASL Crusher Flow Limit", false},
+    tag_info{dicom_tag{0x0018, 0x925B}, vr(VR::LO), vm_1, "ASLCrusherDescription", "ASL Crusher Description", false},
+    tag_info{dicom_tag{0x0018, 0x925C}, vr(VR::CS), vm_1, "ASLBolusCutoffFlag", "ASL Bolus Cut-off Flag", false},
+    tag_info{dicom_tag{0x0018, 0x925D}, vr(VR::SQ), vm_1, "ASLBolusCutoffTimingSequence", "ASL Bolus Cut-off Timing Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x925E}, vr(VR::LO), vm_1, "ASLBolusCutoffTechnique", "ASL Bolus Cut-off Technique", false},
+    tag_info{dicom_tag{0x0018, 0x925F}, vr(VR::UL), vm_1, "ASLBolusCutoffDelayTime", "ASL Bolus Cut-off Delay Time", false},
+    tag_info{dicom_tag{0x0018, 0x9260}, vr(VR::SQ), vm_1, "ASLSlabSequence", "ASL Slab Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9295}, vr(VR::FD), vm_1, "ChemicalShiftMinimumIntegrationLimitInppm", "Chemical Shift Minimum Integration Limit in ppm", false},
+    tag_info{dicom_tag{0x0018, 0x9296}, vr(VR::FD), vm_1, "ChemicalShiftMaximumIntegrationLimitInppm", "Chemical Shift Maximum Integration Limit in ppm", false},
+    tag_info{dicom_tag{0x0018, 0x9297}, vr(VR::CS), vm_1, "WaterReferenceAcquisition", "Water Reference Acquisition", false},
+    tag_info{dicom_tag{0x0018, 0x9298}, vr(VR::IS), vm_1, "EchoPeakPosition", "Echo Peak Position", false},
+    tag_info{dicom_tag{0x0018, 0x9301}, vr(VR::SQ), vm_1, "CTAcquisitionTypeSequence", "CT Acquisition Type Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9302}, vr(VR::CS), vm_1, "AcquisitionType", "Acquisition Type", false},
+    tag_info{dicom_tag{0x0018, 0x9303}, vr(VR::FD), vm_1, "TubeAngle", "Tube Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9304}, vr(VR::SQ), vm_1, "CTAcquisitionDetailsSequence", "CT Acquisition Details Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9305}, vr(VR::FD), vm_1, "RevolutionTime", "Revolution Time", false},
+    tag_info{dicom_tag{0x0018, 0x9306}, vr(VR::FD), vm_1, "SingleCollimationWidth", "Single Collimation Width", false},
+    tag_info{dicom_tag{0x0018, 0x9307}, vr(VR::FD), vm_1, "TotalCollimationWidth", "Total Collimation Width", false},
+    tag_info{dicom_tag{0x0018, 0x9308}, vr(VR::SQ), vm_1, "CTTableDynamicsSequence", "CT Table Dynamics Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9309}, vr(VR::FD), vm_1, "TableSpeed", "Table Speed", false},
+    tag_info{dicom_tag{0x0018, 0x9310}, vr(VR::FD), vm_1, "TableFeedPerRotation", "Table Feed per Rotation", false},
+    tag_info{dicom_tag{0x0018, 0x9311}, vr(VR::FD), vm_1, "SpiralPitchFactor", "Spiral Pitch Factor", false},
+    tag_info{dicom_tag{0x0018, 0x9312}, vr(VR::SQ), vm_1, "CTGeometrySequence", "CT Geometry Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9313}, vr(VR::FD), vm_3, "DataCollectionCenterPatient", "Data Collection Center (Patient)", false},
+    tag_info{dicom_tag{0x0018, 0x9314}, vr(VR::SQ), vm_1, "CTReconstructionSequence", "CT Reconstruction Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9315}, vr(VR::CS), vm_1, "ReconstructionAlgorithm", "Reconstruction Algorithm", false},
+    tag_info{dicom_tag{0x0018, 0x9316}, vr(VR::CS), vm_1, "ConvolutionKernelGroup", "Convolution Kernel Group", false},
+    tag_info{dicom_tag{0x0018, 0x9317}, vr(VR::FD), vm_2, "ReconstructionFieldOfView", "Reconstruction Field of View", false},
+    tag_info{dicom_tag{0x0018, 0x9318}, vr(VR::FD), vm_3, "ReconstructionTargetCenterPatient", "Reconstruction Target Center (Patient)", false},
+    tag_info{dicom_tag{0x0018, 0x9319}, vr(VR::FD), vm_1, "ReconstructionAngle", "Reconstruction Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9320}, vr(VR::SH), vm_1, "ImageFilter", "Image Filter", false},
+    tag_info{dicom_tag{0x0018, 0x9321}, vr(VR::SQ), vm_1, "CTExposureSequence", "CT Exposure Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9322}, vr(VR::FD), vm_2, "ReconstructionPixelSpacing", "Reconstruction Pixel Spacing", false},
+    tag_info{dicom_tag{0x0018, 0x9323}, vr(VR::CS), vm_1_n, "ExposureModulationType", "Exposure Modulation Type", false},
+    tag_info{dicom_tag{0x0018, 0x9324}, vr(VR::FD), vm_1, "EstimatedDoseSaving", "Estimated Dose Saving", true},
+    tag_info{dicom_tag{0x0018, 0x9325}, vr(VR::SQ), vm_1, "CTXRayDetailsSequence", "CT X-Ray Details Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9326}, vr(VR::SQ), vm_1, "CTPositionSequence", "CT Position Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9327}, vr(VR::FD), vm_1, "TablePosition", "Table Position", false},
+    tag_info{dicom_tag{0x0018, 0x9328}, vr(VR::FD), vm_1, "ExposureTimeInms", "Exposure Time in ms", false},
+    tag_info{dicom_tag{0x0018, 0x9329}, vr(VR::SQ), vm_1, "CTImageFrameTypeSequence", "CT Image Frame Type Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9330}, vr(VR::FD), vm_1, "XRayTubeCurrentInmA", "X-Ray Tube Current in mA", false},
+    tag_info{dicom_tag{0x0018, 0x9332}, vr(VR::FD), vm_1, "ExposureInmAs", "Exposure in mAs", false},
+    tag_info{dicom_tag{0x0018, 0x9333}, vr(VR::CS), vm_1, "ConstantVolumeFlag", "Constant Volume Flag", false},
+    tag_info{dicom_tag{0x0018, 0x9334}, vr(VR::CS), vm_1, "FluoroscopyFlag", "Fluoroscopy Flag", false},
+    tag_info{dicom_tag{0x0018, 0x9335}, vr(VR::FD), vm_1, "DistanceSourceToDataCollectionCenter", "Distance Source to Data Collection Center", false},
+    tag_info{dicom_tag{0x0018, 0x9337}, vr(VR::US), vm_1, "ContrastBolusAgentNumber", "Contrast/Bolus Agent Number", false},
+    tag_info{dicom_tag{0x0018, 0x9338}, vr(VR::SQ), vm_1, "ContrastBolusIngredientCodeSequence", "Contrast/Bolus Ingredient Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9340}, vr(VR::SQ), vm_1, "ContrastAdministrationProfileSequence", "Contrast Administration Profile Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9341}, vr(VR::SQ), vm_1, "ContrastBolusUsageSequence", "Contrast/Bolus Usage Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9342}, vr(VR::CS), vm_1, "ContrastBolusAgentAdministered", "Contrast/Bolus Agent Administered", false},
+    tag_info{dicom_tag{0x0018, 0x9343}, vr(VR::CS), vm_1, "ContrastBolusAgentDetected", "Contrast/Bolus Agent Detected", false},
+    tag_info{dicom_tag{0x0018, 0x9344}, vr(VR::CS), vm_1, "ContrastBolusAgentPhase", "Contrast/Bolus Agent Phase", false},
+    tag_info{dicom_tag{0x0018, 0x9345}, vr(VR::FD), vm_1, "CTDIvol", "CTDIvol", false},
+    tag_info{dicom_tag{0x0018, 0x9346}, vr(VR::SQ), vm_1, "CTDIPhantomTypeCodeSequence", "CTDI Phantom Type Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9351}, vr(VR::FL), vm_1, "CalciumScoringMassFactorPatient", "Calcium Scoring Mass Factor Patient", false},
+    tag_info{dicom_tag{0x0018, 0x9352}, vr(VR::FL), vm_3, "CalciumScoringMassFactorDevice", "Calcium Scoring Mass Factor Device", false},
+    tag_info{dicom_tag{0x0018, 0x9353}, vr(VR::FL), vm_1, "EnergyWeightingFactor", "Energy Weighting Factor", false},
+    tag_info{dicom_tag{0x0018, 0x9360}, vr(VR::SQ), vm_1, "CTAdditionalXRaySourceSequence", "CT Additional X-Ray Source Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9361}, vr(VR::CS), vm_1, "MultienergyCTAcquisition", "Multi-energy CT Acquisition", false},
+    tag_info{dicom_tag{0x0018, 0x9362}, vr(VR::SQ), vm_1, "MultienergyCTAcquisitionSequence", "Multi-energy CT Acquisition Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9363}, vr(VR::SQ), vm_1, "MultienergyCTProcessingSequence", "Multi-energy CT Processing Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9364}, vr(VR::SQ), vm_1, "MultienergyCTCharacteristicsSequence", "Multi-energy CT Characteristics Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9365}, vr(VR::SQ), vm_1, "MultienergyCTXRaySourceSequence", "Multi-energy CT X-Ray Source Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9366}, vr(VR::US), vm_1, "XRaySourceIndex", "X-Ray Source Index", false},
+    tag_info{dicom_tag{0x0018, 0x9367}, vr(VR::UC), vm_1, "XRaySourceID", "X-Ray Source ID", false},
+    tag_info{dicom_tag{0x0018, 0x9368}, vr(VR::CS), vm_1, "MultienergySourceTechnique", "Multi-energy Source Technique", false},
+    tag_info{dicom_tag{0x0018, 0x9369}, vr(VR::DT), vm_1, "SourceStartDateTime", "Source Start DateTime", false},
+    tag_info{dicom_tag{0x0018, 0x936A}, vr(VR::DT), vm_1, "SourceEndDateTime", "Source End DateTime", false},
+    tag_info{dicom_tag{0x0018, 0x936B}, vr(VR::US), vm_1, "SwitchingPhaseNumber", "Switching Phase Number", false},
+    tag_info{dicom_tag{0x0018, 0x936C}, vr(VR::DS), vm_1, "SwitchingPhaseNominalDuration", "Switching Phase Nominal Duration", false},
+    tag_info{dicom_tag{0x0018, 0x936D}, vr(VR::DS), vm_1, "SwitchingPhaseTransitionDuration", "Switching Phase Transition Duration", false},
+    tag_info{dicom_tag{0x0018, 0x936E}, vr(VR::DS), vm_1, "EffectiveBinEnergy", "Effective Bin Energy", false},
+    tag_info{dicom_tag{0x0018, 0x936F}, vr(VR::SQ), vm_1, "MultienergyCTXRayDetectorSequence", "Multi-energy CT X-Ray Detector Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9370}, vr(VR::US), vm_1, "XRayDetectorIndex", "X-Ray Detector Index", false},
+    tag_info{dicom_tag{0x0018, 0x9371}, vr(VR::UC), vm_1, "XRayDetectorID", "X-Ray Detector ID", false},
+    tag_info{dicom_tag{0x0018, 0x9372}, vr(VR::CS), vm_1, "MultienergyDetectorType", "Multi-energy Detector Type", false},
+    tag_info{dicom_tag{0x0018, 0x9373}, vr(VR::ST), vm_1, "XRayDetectorLabel", "X-Ray Detector Label", false},
+    tag_info{dicom_tag{0x0018, 0x9374}, vr(VR::DS), vm_1, "NominalMaxEnergy", "Nominal Max Energy", false},
+    tag_info{dicom_tag{0x0018, 0x9375}, vr(VR::DS), vm_1, "NominalMinEnergy", "Nominal Min Energy", false},
+    tag_info{dicom_tag{0x0018, 0x9376}, vr(VR::US), vm_1_n, "ReferencedXRayDetectorIndex", "Referenced X-Ray Detector Index", false},
+    tag_info{dicom_tag{0x0018, 0x9377}, vr(VR::US), vm_1_n, "ReferencedXRaySourceIndex", "Referenced X-Ray Source Index", false},
+    tag_info{dicom_tag{0x0018, 0x9378}, vr(VR::US), vm_1_n, "ReferencedPathIndex", "Referenced Path Index", false},
+    tag_info{dicom_tag{0x0018, 0x9379}, vr(VR::SQ), vm_1, "MultienergyCTPathSequence", "Multi-energy CT Path Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x937A}, vr(VR::US), vm_1, "MultienergyCTPathIndex", "Multi-energy CT Path Index", false},
+    tag_info{dicom_tag{0x0018, 0x937B}, vr(VR::UT), vm_1, "MultienergyAcquisitionDescription", "Multi-energy Acquisition Description", false},
+    tag_info{dicom_tag{0x0018, 0x937C}, vr(VR::FD), vm_1, "MonoenergeticEnergyEquivalent", "Monoenergetic Energy Equivalent", false},
+    tag_info{dicom_tag{0x0018, 0x937D}, vr(VR::SQ), vm_1, "MaterialCodeSequence", "Material Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x937E}, vr(VR::CS), vm_1, "DecompositionMethod", "Decomposition Method", false},
+    tag_info{dicom_tag{0x0018, 0x937F}, vr(VR::UT), vm_1, "DecompositionDescription", "Decomposition Description", false},
+    tag_info{dicom_tag{0x0018, 0x9380}, vr(VR::SQ), vm_1, "DecompositionAlgorithmIdentificationSequence", "Decomposition Algorithm Identification Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9381}, vr(VR::SQ), vm_1, "DecompositionMaterialSequence", "Decomposition Material Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9382}, vr(VR::SQ), vm_1, "MaterialAttenuationSequence", "Material Attenuation Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9383}, vr(VR::DS), vm_1, "PhotonEnergy", "Photon Energy", false},
+    tag_info{dicom_tag{0x0018, 0x9384}, vr(VR::DS), vm_1, "XRayMassAttenuationCoefficient", "X-Ray Mass Attenuation Coefficient", false},
+    tag_info{dicom_tag{0x0018, 0x9401}, vr(VR::SQ), vm_1, "ProjectionPixelCalibrationSequence", "Projection Pixel Calibration Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9402}, vr(VR::FL), vm_1, "DistanceSourceToIsocenter", "Distance Source to Isocenter", false},
+    tag_info{dicom_tag{0x0018, 0x9403}, vr(VR::FL), vm_1, "DistanceObjectToTableTop", "Distance Object to Table Top", false},
+    tag_info{dicom_tag{0x0018, 0x9404}, vr(VR::FL), vm_2, "ObjectPixelSpacingInCenterOfBeam", "Object Pixel Spacing in Center of Beam", false},
+    tag_info{dicom_tag{0x0018, 0x9405}, vr(VR::SQ), vm_1, "PositionerPositionSequence", "Positioner Position Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9406}, vr(VR::SQ), vm_1, "TablePositionSequence", "Table Position Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9407}, vr(VR::SQ), vm_1, "CollimatorShapeSequence", "Collimator Shape Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9410}, vr(VR::CS), vm_1, "PlanesInAcquisition", "Planes in Acquisition", false},
+    tag_info{dicom_tag{0x0018, 0x9412}, vr(VR::SQ), vm_1, "XAXRFFrameCharacteristicsSequence", "XA/XRF Frame Characteristics Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9417}, vr(VR::SQ), vm_1, "FrameAcquisitionSequence", "Frame Acquisition Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9420}, vr(VR::CS), vm_1, "XRayReceptorType", "X-Ray Receptor Type", false},
+    tag_info{dicom_tag{0x0018, 0x9423}, vr(VR::LO), vm_1, "AcquisitionProtocolName", "Acquisition Protocol Name", false},
+    tag_info{dicom_tag{0x0018, 0x9424}, vr(VR::LT), vm_1, "AcquisitionProtocolDescription", "Acquisition Protocol Description", false},
+    tag_info{dicom_tag{0x0018, 0x9425}, vr(VR::CS), vm_1, "ContrastBolusIngredientOpaque", "Contrast/Bolus Ingredient Opaque", false},
+    tag_info{dicom_tag{0x0018, 0x9426}, vr(VR::FL), vm_1, "DistanceReceptorPlaneToDetectorHousing", "Distance Receptor Plane to Detector Housing", false},
+    tag_info{dicom_tag{0x0018, 0x9427}, vr(VR::CS), vm_1, "IntensifierActiveShape", "Intensifier Active Shape", false},
+    tag_info{dicom_tag{0x0018, 0x9428}, vr(VR::FL), vm_1_2, "IntensifierActiveDimensions", "Intensifier Active Dimension(s)", false},
+    tag_info{dicom_tag{0x0018, 0x9429}, vr(VR::FL), vm_2, "PhysicalDetectorSize", "Physical Detector Size", false},
+    tag_info{dicom_tag{0x0018, 0x9430}, vr(VR::FL), vm_2, "PositionOfIsocenterProjection", "Position of Isocenter Projection", false},
+    tag_info{dicom_tag{0x0018, 0x9432}, vr(VR::SQ), vm_1, "FieldOfViewSequence", "Field of View Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9433}, vr(VR::LO), vm_1, "FieldOfViewDescription", "Field of View Description", false},
+    tag_info{dicom_tag{0x0018, 0x9434}, vr(VR::SQ), vm_1, "ExposureControlSensingRegionsSequence", "Exposure Control Sensing Regions Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9435}, vr(VR::CS), vm_1, "ExposureControlSensingRegionShape", "Exposure Control Sensing Region Shape", false},
+    tag_info{dicom_tag{0x0018, 0x9436}, vr(VR::SS), vm_1, "ExposureControlSensingRegionLeftVerticalEdge", "Exposure Control Sensing Region Left Vertical Edge", false},
+    tag_info{dicom_tag{0x0018, 0x9437}, vr(VR::SS), vm_1, "ExposureControlSensingRegionRightVerticalEdge", "Exposure Control Sensing Region Right Vertical Edge", false},
+    tag_info{dicom_tag{0x0018, 0x9438}, vr(VR::SS), vm_1, "ExposureControlSensingRegionUpperHorizontalEdge", "Exposure Control Sensing Region Upper Horizontal Edge", false},
+    tag_info{dicom_tag{0x0018, 0x9439}, vr(VR::SS), vm_1, "ExposureControlSensingRegionLowerHorizontalEdge", "Exposure Control Sensing Region Lower Horizontal Edge", false},
+    tag_info{dicom_tag{0x0018, 0x9440}, vr(VR::SS), vm_2, "CenterOfCircularExposureControlSensingRegion", "Center of Circular Exposure Control Sensing Region", false},
+    tag_info{dicom_tag{0x0018, 0x9441}, vr(VR::US), vm_1, "RadiusOfCircularExposureControlSensingRegion", "Radius of Circular Exposure Control Sensing Region", false},
+    tag_info{dicom_tag{0x0018, 0x9442}, vr(VR::SS), vm_2_n, "VerticesOfThePolygonalExposureControlSensingRegion", "Vertices of the Polygonal Exposure Control Sensing Region", false},
+    tag_info{dicom_tag{0x0018, 0x9445}, vr(VR::OB), vm_1, "", "Retired-blank", true},
+    tag_info{dicom_tag{0x0018, 0x9447}, vr(VR::FL), vm_1, "ColumnAngulationPatient", "Column Angulation (Patient)", false},
+    tag_info{dicom_tag{0x0018, 0x9449}, vr(VR::FL), vm_1, "BeamAngle", "Beam Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9451}, vr(VR::SQ), vm_1, "FrameDetectorParametersSequence", "Frame Detector Parameters Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9452}, vr(VR::FL), vm_1, "CalculatedAnatomyThickness", "Calculated Anatomy Thickness", false},
+    tag_info{dicom_tag{0x0018, 0x9455}, vr(VR::SQ), vm_1, "CalibrationSequence", "Calibration Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9456}, vr(VR::SQ), vm_1, "ObjectThicknessSequence", "Object Thickness Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9457}, vr(VR::CS), vm_1, "PlaneIdentification", "Plane Identification", false},
+    tag_info{dicom_tag{0x0018, 0x9461}, vr(VR::FL), vm_1_2, "FieldOfViewDimensionsInFloat", "Field of View Dimension(s) in Float", false},
+    tag_info{dicom_tag{0x0018, 0x9462}, vr(VR::SQ), vm_1, "IsocenterReferenceSystemSequence", "Isocenter Reference System Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9463}, vr(VR::FL), vm_1, "PositionerIsocenterPrimaryAngle", "Positioner Isocenter Primary Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9464}, vr(VR::FL), vm_1, "PositionerIsocenterSecondaryAngle", "Positioner Isocenter Secondary Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9465}, vr(VR::FL), vm_1, "PositionerIsocenterDetectorRotationAngle", "Positioner Isocenter Detector Rotation Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9466}, vr(VR::FL), vm_1, "TableXPositionToIsocenter", "Table X Position to Isocenter", false},
+    tag_info{dicom_tag{0x0018, 0x9467}, vr(VR::FL), vm_1, "TableYPositionToIsocenter", "Table Y Position to Isocenter", false},
+    tag_info{dicom_tag{0x0018, 0x9468}, vr(VR::FL), vm_1, "TableZPositionToIsocenter", "Table Z Position to Isocenter", false},
+    tag_info{dicom_tag{0x0018, 0x9469}, vr(VR::FL), vm_1, "TableHorizontalRotationAngle", "Table Horizontal Rotation Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9470}, vr(VR::FL), vm_1, "TableHeadTiltAngle", "Table Head Tilt Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9471}, vr(VR::FL), vm_1, "TableCradleTiltAngle", "Table Cradle Tilt Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9472}, vr(VR::SQ), vm_1, "FrameDisplayShutterSequence", "Frame Display Shutter Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9473}, vr(VR::FL), vm_1, "AcquiredImageAreaDoseProduct", "Acquired Image Area Dose Product", false},
+    tag_info{dicom_tag{0x0018, 0x9474}, vr(VR::CS), vm_1, "CArmPositionerTabletopRelationship", "C-arm Positioner Tabletop Relationship", false},
+    tag_info{dicom_tag{0x0018, 0x9476}, vr(VR::SQ), vm_1, "XRayGeometrySequence", "X-Ray Geometry Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9477}, vr(VR::SQ), vm_1, "IrradiationEventIdentificationSequence", "Irradiation Event Identification Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9504}, vr(VR::SQ), vm_1, "XRay3DFrameTypeSequence", "X-Ray 3D Frame Type Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9506}, vr(VR::SQ), vm_1, "ContributingSourcesSequence", "Contributing Sources Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9507}, vr(VR::SQ), vm_1, "XRay3DAcquisitionSequence", "X-Ray 3D Acquisition Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9508}, vr(VR::FL), vm_1, "PrimaryPositionerScanArc", "Primary Positioner Scan Arc", false},
+    tag_info{dicom_tag{0x0018, 0x9509}, vr(VR::FL), vm_1, "SecondaryPositionerScanArc", "Secondary Positioner Scan Arc", false},
+    tag_info{dicom_tag{0x0018, 0x9510}, vr(VR::FL), vm_1, "PrimaryPositionerScanStartAngle", "Primary Positioner Scan Start Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9511}, vr(VR::FL), vm_1, "SecondaryPositionerScanStartAngle", "Secondary Positioner Scan Start Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9514}, vr(VR::FL), vm_1, "PrimaryPositionerIncrement", "Primary Positioner Increment", false},
+    tag_info{dicom_tag{0x0018, 0x9515}, vr(VR::FL), vm_1, "SecondaryPositionerIncrement", "Secondary Positioner Increment", false},
+    tag_info{dicom_tag{0x0018, 0x9516}, vr(VR::DT), vm_1, "StartAcquisitionDateTime", "Start Acquisition DateTime", false},
+    tag_info{dicom_tag{0x0018, 0x9517}, vr(VR::DT), vm_1, "EndAcquisitionDateTime", "End Acquisition DateTime", false},
+    tag_info{dicom_tag{0x0018, 0x9518}, vr(VR::SS), vm_1, "PrimaryPositionerIncrementSign", "Primary Positioner Increment Sign", false},
+    tag_info{dicom_tag{0x0018, 0x9519}, vr(VR::SS), vm_1, "SecondaryPositionerIncrementSign", "Secondary Positioner Increment Sign", false},
+    tag_info{dicom_tag{0x0018, 0x9524}, vr(VR::LO), vm_1, "ApplicationName", "Application Name", false},
+    tag_info{dicom_tag{0x0018, 0x9525}, vr(VR::LO), vm_1, "ApplicationVersion", "Application Version", false},
+    tag_info{dicom_tag{0x0018, 0x9526}, vr(VR::LO), vm_1, "ApplicationManufacturer", "Application Manufacturer", false},
+    tag_info{dicom_tag{0x0018, 0x9527}, vr(VR::CS), vm_1, "AlgorithmType", "Algorithm Type", false},
+    tag_info{dicom_tag{0x0018, 0x9528}, vr(VR::LO), vm_1, "AlgorithmDescription", "Algorithm Description", false},
+    tag_info{dicom_tag{0x0018, 0x9530}, vr(VR::SQ), vm_1, "XRay3DReconstructionSequence", "X-Ray 3D Reconstruction Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9531}, vr(VR::LO), vm_1, "ReconstructionDescription", "Reconstruction Description", false},
+    tag_info{dicom_tag{0x0018, 0x9538}, vr(VR::SQ), vm_1, "PerProjectionAcquisitionSequence", "Per Projection Acquisition Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9541}, vr(VR::SQ), vm_1, "DetectorPositionSequence", "Detector Position Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9542}, vr(VR::SQ), vm_1, "XRayAcquisitionDoseSequence", "X-Ray Acquisition Dose Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9543}, vr(VR::FD), vm_1, "XRaySourceIsocenterPrimaryAngle", "X-Ray Source Isocenter Primary Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9544}, vr(VR::FD), vm_1, "XRaySourceIsocenterSecondaryAngle", "X-Ray Source Isocenter Secondary Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9545}, vr(VR::FD), vm_1, "BreastSupportIsocenterPrimaryAngle", "Breast Support Isocenter Primary Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9546}, vr(VR::FD), vm_1, "BreastSupportIsocenterSecondaryAngle", "Breast Support Isocenter Secondary Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9547}, vr(VR::FD), vm_1, "BreastSupportXPositionToIsocenter", "Breast Support X Position to Isocenter", false},
+    tag_info{dicom_tag{0x0018, 0x9548}, vr(VR::FD), vm_1, "BreastSupportYPositionToIsocenter", "Breast Support Y Position to Isocenter", false},
+    tag_info{dicom_tag{0x0018, 0x9549}, vr(VR::FD), vm_1, "BreastSupportZPositionToIsocenter", "Breast Support Z Position to Isocenter", false},
+    tag_info{dicom_tag{0x0018, 0x9550}, vr(VR::FD), vm_1, "DetectorIsocenterPrimaryAngle", "Detector Isocenter Primary Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9551}, vr(VR::FD), vm_1, "DetectorIsocenterSecondaryAngle", "Detector Isocenter Secondary Angle", false},
+    tag_info{dicom_tag{0x0018, 0x9552}, vr(VR::FD), vm_1, "DetectorXPositionToIsocenter", "Detector X Position to Isocenter", false},
+    tag_info{dicom_tag{0x0018, 0x9553}, vr(VR::FD), vm_1, "DetectorYPositionToIsocenter", "Detector Y Position to Isocenter", false},
+    tag_info{dicom_tag{0x0018, 0x9554}, vr(VR::FD), vm_1, "DetectorZPositionToIsocenter", "Detector Z Position to Isocenter", false},
+    tag_info{dicom_tag{0x0018, 0x9555}, vr(VR::SQ), vm_1, "XRayGridSequence", "X-Ray Grid Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9556}, vr(VR::SQ), vm_1, "XRayFilterSequence", "X-Ray Filter Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9557}, vr(VR::FD), vm_3, "DetectorActiveAreaTLHCPosition", "Detector Active Area TLHC Position", false},
+    tag_info{dicom_tag{0x0018, 0x9558}, vr(VR::FD), vm_6, "DetectorActiveAreaOrientation", "Detector Active Area Orientation", false},
+    tag_info{dicom_tag{0x0018, 0x9559}, vr(VR::CS), vm_1, "PositionerPrimaryAngleDirection", "Positioner Primary Angle Direction", false},
+    tag_info{dicom_tag{0x0018, 0x9601}, vr(VR::SQ), vm_1, "DiffusionBMatrixSequence", "Diffusion b-matrix Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9602}, vr(VR::FD), vm_1, "DiffusionBValueXX", "Diffusion b-value XX", false},
+    tag_info{dicom_tag{0x0018, 0x9603}, vr(VR::FD), vm_1, "DiffusionBValueXY", "Diffusion b-value XY", false},
+    tag_info{dicom_tag{0x0018, 0x9604}, vr(VR::FD), vm_1, "DiffusionBValueXZ", "Diffusion b-value XZ", false},
+    tag_info{dicom_tag{0x0018, 0x9605}, vr(VR::FD), vm_1, "DiffusionBValueYY", "Diffusion b-value YY", false},
+    tag_info{dicom_tag{0x0018, 0x9606}, vr(VR::FD), vm_1, "DiffusionBValueYZ", "Diffusion b-value YZ", false},
+    tag_info{dicom_tag{0x0018, 0x9607}, vr(VR::FD), vm_1, "DiffusionBValueZZ", "Diffusion b-value ZZ", false},
+    tag_info{dicom_tag{0x0018, 0x9621}, vr(VR::SQ), vm_1, "FunctionalMRSequence", "Functional MR Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9622}, vr(VR::CS), vm_1, "FunctionalSettlingPhaseFramesPresent", "Functional Settling Phase Frames Present", false},
+    tag_info{dicom_tag{0x0018, 0x9623}, vr(VR::DT), vm_1, "FunctionalSyncPulse", "Functional Sync Pulse", false},
+    tag_info{dicom_tag{0x0018, 0x9624}, vr(VR::CS), vm_1, "SettlingPhaseFrame", "Settling Phase Frame", false},
+    tag_info{dicom_tag{0x0018, 0x9701}, vr(VR::DT), vm_1, "DecayCorrectionDateTime", "Decay Correction DateTime", false},
+    tag_info{dicom_tag{0x0018, 0x9715}, vr(VR::FD), vm_1, "StartDensityThreshold", "Start Density Threshold", false},
+    tag_info{dicom_tag{0x0018, 0x9716}, vr(VR::FD), vm_1, "StartRelativeDensityDifferenceThreshold", "Start Relative Density Difference Threshold", false},
+    tag_info{dicom_tag{0x0018, 0x9717}, vr(VR::FD), vm_1, "StartCardiacTriggerCountThreshold", "Start Cardiac Trigger Count Threshold", false},
+    tag_info{dicom_tag{0x0018, 0x9718}, vr(VR::FD), vm_1, "StartRespiratoryTriggerCountThreshold", "Start Respiratory Trigger Count Threshold", false},
+    tag_info{dicom_tag{0x0018, 0x9719}, vr(VR::FD), vm_1, "TerminationCountsThreshold", "Termination Counts Threshold", false},
+    tag_info{dicom_tag{0x0018, 0x9720}, vr(VR::FD), vm_1, "TerminationDensityThreshold", "Termination Density Threshold", false},
+    tag_info{dicom_tag{0x0018, 0x9721}, vr(VR::FD), vm_1, "TerminationRelativeDensityThreshold", "Termination Relative Density Threshold", false},
+    tag_info{dicom_tag{0x0018, 0x9722}, vr(VR::FD), vm_1, "TerminationTimeThreshold", "Termination Time Threshold", false},
+    tag_info{dicom_tag{0x0018, 0x9723}, vr(VR::FD), vm_1, "TerminationCardiacTriggerCountThreshold", "Termination Cardiac Trigger Count Threshold", false},
+    tag_info{dicom_tag{0x0018, 0x9724}, vr(VR::FD), vm_1, "TerminationRespiratoryTriggerCountThreshold", "Termination Respiratory Trigger Count Threshold", false},
+    tag_info{dicom_tag{0x0018, 0x9725}, vr(VR::CS), vm_1, "DetectorGeometry", "Detector Geometry", false},
+    tag_info{dicom_tag{0x0018, 0x9726}, vr(VR::FD), vm_1, "TransverseDetectorSeparation", "Transverse Detector Separation", false},
+    tag_info{dicom_tag{0x0018, 0x9727}, vr(VR::FD), vm_1, "AxialDetectorDimension", "Axial Detector Dimension", false},
+    tag_info{dicom_tag{0x0018, 0x9729}, vr(VR::US), vm_1, "RadiopharmaceuticalAgentNumber", "Radiopharmaceutical Agent Number", false},
+    tag_info{dicom_tag{0x0018, 0x9732}, vr(VR::SQ), vm_1, "PETFrameAcquisitionSequence", "PET Frame Acquisition Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9733}, vr(VR::SQ), vm_1, "PETDetectorMotionDetailsSequence", "PET Detector Motion Details Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9734}, vr(VR::SQ), vm_1, "PETTableDynamicsSequence", "PET Table Dynamics Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9735}, vr(VR::SQ), vm_1, "PETPositionSequence", "PET Position Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9736}, vr(VR::SQ), vm_1, "PETFrameCorrectionFactorsSequence", "PET Frame Correction Factors Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9737}, vr(VR::SQ), vm_1, "RadiopharmaceuticalUsageSequence", "Radiopharmaceutical Usage Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9738}, vr(VR::CS), vm_1, "AttenuationCorrectionSource", "Attenuation Correction Source", false},
+    tag_info{dicom_tag{0x0018, 0x9739}, vr(VR::US), vm_1, "NumberOfIterations", "Number of Iterations", false},
+    tag_info{dicom_tag{0x0018, 0x9740}, vr(VR::US), vm_1, "NumberOfSubsets", "Number of Subsets", false},
+    tag_info{dicom_tag{0x0018, 0x9749}, vr(VR::SQ), vm_1, "PETReconstructionSequence", "PET Reconstruction Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9751}, vr(VR::SQ), vm_1, "PETFrameTypeSequence", "PET Frame Type Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9755}, vr(VR::CS), vm_1, "TimeOfFlightInformationUsed", "Time of Flight Information Used", false},
+    tag_info{dicom_tag{0x0018, 0x9756}, vr(VR::CS), vm_1, "ReconstructionType", "Reconstruction Type", false},
+    tag_info{dicom_tag{0x0018, 0x9758}, vr(VR::CS), vm_1, "DecayCorrected", "Decay Corrected", false},
+    tag_info{dicom_tag{0x0018, 0x9759}, vr(VR::CS), vm_1, "AttenuationCorrected", "Attenuation Corrected", false},
+    tag_info{dicom_tag{0x0018, 0x9760}, vr(VR::CS), vm_1, "ScatterCorrected", "Scatter Corrected", false},
+    tag_info{dicom_tag{0x0018, 0x9761}, vr(VR::CS), vm_1, "DeadTimeCorrected", "Dead Time Corrected", false},
+    tag_info{dicom_tag{0x0018, 0x9762}, vr(VR::CS), vm_1, "GantryMotionCorrected", "Gantry Motion Corrected", false},
+    tag_info{dicom_tag{0x0018, 0x9763}, vr(VR::CS), vm_1, "PatientMotionCorrected", "Patient Motion Corrected", false},
+    tag_info{dicom_tag{0x0018, 0x9764}, vr(VR::CS), vm_1, "CountLossNormalizationCorrected", "Count Loss Normalization Corrected", false},
+    tag_info{dicom_tag{0x0018, 0x9765}, vr(VR::CS), vm_1, "RandomsCorrected", "Randoms Corrected", false},
+    tag_info{dicom_tag{0x0018, 0x9766}, vr(VR::CS), vm_1, "NonUniformRadialSamplingCorrected", "Non-uniform Radial Sampling Corrected", false},
+    tag_info{dicom_tag{0x0018, 0x9767}, vr(VR::CS), vm_1, "SensitivityCalibrated", "Sensitivity Calibrated", false},
+    tag_info{dicom_tag{0x0018, 0x9768}, vr(VR::CS), vm_1, "DetectorNormalizationCorrection", "Detector Normalization Correction", false},
+    tag_info{dicom_tag{0x0018, 0x9769}, vr(VR::CS), vm_1, "IterativeReconstructionMethod", "Iterative Reconstruction Method", false},
+    tag_info{dicom_tag{0x0018, 0x9770}, vr(VR::CS), vm_1, "AttenuationCorrectionTemporalRelationship", "Attenuation Correction Temporal Relationship", false},
+    tag_info{dicom_tag{0x0018, 0x9771}, vr(VR::SQ), vm_1, "PatientPhysiologicalStateSequence", "Patient Physiological State Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9772}, vr(VR::SQ), vm_1, "PatientPhysiologicalStateCodeSequence", "Patient Physiological State Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9801}, vr(VR::FD), vm_1_n, "DepthsOfFocus", "Depth(s) of Focus", false},
+    tag_info{dicom_tag{0x0018, 0x9803}, vr(VR::SQ), vm_1, "ExcludedIntervalsSequence", "Excluded Intervals Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9804}, vr(VR::DT), vm_1, "ExclusionStartDateTime", "Exclusion Start DateTime", false},
+    tag_info{dicom_tag{0x0018, 0x9805}, vr(VR::FD), vm_1, "ExclusionDuration", "Exclusion Duration", false},
+    tag_info{dicom_tag{0x0018, 0x9806}, vr(VR::SQ), vm_1, "USImageDescriptionSequence", "US Image Description Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9807}, vr(VR::SQ), vm_1, "ImageDataTypeSequence", "Image Data Type Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9808}, vr(VR::CS), vm_1, "DataType", "Data Type", false},
+    tag_info{dicom_tag{0x0018, 0x9809}, vr(VR::SQ), vm_1, "TransducerScanPatternCodeSequence", "Transducer Scan Pattern Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x980B}, vr(VR::CS), vm_1, "AliasedDataType", "Aliased Data Type", false},
+    tag_info{dicom_tag{0x0018, 0x980C}, vr(VR::CS), vm_1, "PositionMeasuringDeviceUsed", "Position Measuring Device Used", false},
+    tag_info{dicom_tag{0x0018, 0x980D}, vr(VR::SQ), vm_1, "TransducerGeometryCodeSequence", "Transducer Geometry Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x980E}, vr(VR::SQ), vm_1, "TransducerBeamSteeringCodeSequence", "Transducer Beam Steering Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x980F}, vr(VR::SQ), vm_1, "TransducerApplicationCodeSequence", "Transducer Application Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9810}, vr(VR::US), vm_1, "ZeroVelocityPixelValue", "Zero Velocity Pixel Value", false},
+    tag_info{dicom_tag{0x0018, 0x9821}, vr(VR::SQ), vm_1, "PhotoacousticExcitationCharacteristicsSequence", "Photoacoustic Excitation Characteristics Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9822}, vr(VR::FD), vm_1, "ExcitationSpectralWidth", "Excitation Spectral Width", false},
+    tag_info{dicom_tag{0x0018, 0x9823}, vr(VR::FD), vm_1, "ExcitationEnergy", "Excitation Energy", false},
+    tag_info{dicom_tag{0x0018, 0x9824}, vr(VR::FD), vm_1, "ExcitationPulseDuration", "Excitation Pulse Duration", false},
+    tag_info{dicom_tag{0x0018, 0x9825}, vr(VR::SQ), vm_1, "ExcitationWavelengthSequence", "Excitation Wavelength Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9826}, vr(VR::FD), vm_1, "ExcitationWavelength", "Excitation Wavelength", false},
+    tag_info{dicom_tag{0x0018, 0x9828}, vr(VR::CS), vm_1, "IlluminationTranslationFlag", "Illumination Translation Flag", false},
+    tag_info{dicom_tag{0x0018, 0x9829}, vr(VR::CS), vm_1, "AcousticCouplingMediumFlag", "Acoustic Coupling Medium Flag", false},
+    tag_info{dicom_tag{0x0018, 0x982A}, vr(VR::SQ), vm_1, "AcousticCouplingMediumCodeSequence", "Acoustic Coupling Medium Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x982B}, vr(VR::FD), vm_1, "AcousticCouplingMediumTemperature", "Acoustic Coupling Medium Temperature", false},
+    tag_info{dicom_tag{0x0018, 0x982C}, vr(VR::SQ), vm_1, "TransducerResponseSequence", "Transducer Response Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x982D}, vr(VR::FD), vm_1, "CenterFrequency", "Center Frequency", false},
+    tag_info{dicom_tag{0x0018, 0x982E}, vr(VR::FD), vm_1, "FractionalBandwidth", "Fractional Bandwidth", false},
+    tag_info{dicom_tag{0x0018, 0x982F}, vr(VR::FD), vm_1, "LowerCutoffFrequency", "Lower Cutoff Frequency", false},
+    tag_info{dicom_tag{0x0018, 0x9830}, vr(VR::FD), vm_1, "UpperCutoffFrequency", "Upper Cutoff Frequency", false},
+    tag_info{dicom_tag{0x0018, 0x9831}, vr(VR::SQ), vm_1, "TransducerTechnologySequence", "Transducer Technology Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9832}, vr(VR::SQ), vm_1, "SoundSpeedCorrectionMechanismCodeSequence", "Sound Speed Correction Mechanism Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9833}, vr(VR::FD), vm_1, "ObjectSoundSpeed", "Object Sound Speed", false},
+    tag_info{dicom_tag{0x0018, 0x9834}, vr(VR::FD), vm_1, "AcousticCouplingMediumSoundSpeed", "Acoustic Coupling Medium Sound Speed", false},
+    tag_info{dicom_tag{0x0018, 0x9835}, vr(VR::SQ), vm_1, "PhotoacousticImageFrameTypeSequence", "Photoacoustic Image Frame Type Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9836}, vr(VR::SQ), vm_1, "ImageDataTypeCodeSequence", "Image Data Type Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9900}, vr(VR::LO), vm_1, "ReferenceLocationLabel", "Reference Location Label", false},
+    tag_info{dicom_tag{0x0018, 0x9901}, vr(VR::UT), vm_1, "ReferenceLocationDescription", "Reference Location Description", false},
+    tag_info{dicom_tag{0x0018, 0x9902}, vr(VR::SQ), vm_1, "ReferenceBasisCodeSequence", "Reference Basis Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9903}, vr(VR::SQ), vm_1, "ReferenceGeometryCodeSequence", "Reference Geometry Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9904}, vr(VR::DS), vm_1, "OffsetDistance", "Offset Distance", false},
+    tag_info{dicom_tag{0x0018, 0x9905}, vr(VR::CS), vm_1, "OffsetDirection", "Offset Direction", false},
+    tag_info{dicom_tag{0x0018, 0x9906}, vr(VR::SQ), vm_1, "PotentialScheduledProtocolCodeSequence", "Potential Scheduled Protocol Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9907}, vr(VR::SQ), vm_1, "PotentialRequestedProcedureCodeSequence", "Potential Requested Procedure Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9908}, vr(VR::UC), vm_1_n, "PotentialReasonsForProcedure", "Potential Reasons for Procedure", false},
+    tag_info{dicom_tag{0x0018, 0x9909}, vr(VR::SQ), vm_1, "PotentialReasonsForProcedureCodeSequence", "Potential Reasons for Procedure Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x990A}, vr(VR::UC), vm_1_n, "PotentialDiagnosticTasks", "Potential Diagnostic Tasks", false},
+    tag_info{dicom_tag{0x0018, 0x990B}, vr(VR::SQ), vm_1, "ContraindicationsCodeSequence", "Contraindications Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x990C}, vr(VR::SQ), vm_1, "ReferencedDefinedProtocolSequence", "Referenced Defined Protocol Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x990D}, vr(VR::SQ), vm_1, "ReferencedPerformedProtocolSequence", "Referenced Performed Protocol Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x990E}, vr(VR::SQ), vm_1, "PredecessorProtocolSequence", "Predecessor Protocol Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x990F}, vr(VR::UT), vm_1, "ProtocolPlanningInformation", "Protocol Planning Information", false},
+    tag_info{dicom_tag{0x0018, 0x9910}, vr(VR::UT), vm_1, "ProtocolDesignRationale", "Protocol Design Rationale", false},
+    tag_info{dicom_tag{0x0018, 0x9911}, vr(VR::SQ), vm_1, "PatientSpecificationSequence", "Patient Specification Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9912}, vr(VR::SQ), vm_1, "ModelSpecificationSequence", "Model Specification Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9913}, vr(VR::SQ), vm_1, "ParametersSpecificationSequence", "Parameters Specification Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9914}, vr(VR::SQ), vm_1, "InstructionSequence", "Instruction Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9915}, vr(VR::US), vm_1, "InstructionIndex", "Instruction Index", false},
+    tag_info{dicom_tag{0x0018, 0x9916}, vr(VR::LO), vm_1, "InstructionText", "Instruction Text", false},
+    tag_info{dicom_tag{0x0018, 0x9917}, vr(VR::UT), vm_1, "InstructionDescription", "Instruction Description", false},
+    tag_info{dicom_tag{0x0018, 0x9918}, vr(VR::CS), vm_1, "InstructionPerformedFlag", "Instruction Performed Flag", false},
+    tag_info{dicom_tag{0x0018, 0x9919}, vr(VR::DT), vm_1, "InstructionPerformedDateTime", "Instruction Performed DateTime", false},
+    tag_info{dicom_tag{0x0018, 0x991A}, vr(VR::UT), vm_1, "InstructionPerformanceComment", "Instruction Performance Comment", false},
+    tag_info{dicom_tag{0x0018, 0x991B}, vr(VR::SQ), vm_1, "PatientPositioningInstructionSequence", "Patient Positioning Instruction Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x991C}, vr(VR::SQ), vm_1, "PositioningMethodCodeSequence", "Positioning Method Code Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x991D}, vr(VR::SQ), vm_1, "PositioningLandmarkSequence", "Positioning Landmark Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x991E}, vr(VR::UI), vm_1, "TargetFrameOfReferenceUID", "Target Frame of Reference UID", false},
+    tag_info{dicom_tag{0x0018, 0x991F}, vr(VR::SQ), vm_1, "AcquisitionProtocolElementSpecificationSequence", "Acquisition Protocol Element Specification Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9920}, vr(VR::SQ), vm_1, "AcquisitionProtocolElementSequence", "Acquisition Protocol Element Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9921}, vr(VR::US), vm_1, "ProtocolElementNumber", "Protocol Element Number", false},
+    tag_info{dicom_tag{0x0018, 0x9922}, vr(VR::LO), vm_1, "ProtocolElementName", "Protocol Element Name", false},
+    tag_info{dicom_tag{0x0018, 0x9923}, vr(VR::UT), vm_1, "ProtocolElementCharacteristicsSummary", "Protocol Element Characteristics Summary", false},
+    tag_info{dicom_tag{0x0018, 0x9924}, vr(VR::UT), vm_1, "ProtocolElementPurpose", "Protocol Element Purpose", false},
+    tag_info{dicom_tag{0x0018, 0x9930}, vr(VR::CS), vm_1, "AcquisitionMotion", "Acquisition Motion", false},
+    tag_info{dicom_tag{0x0018, 0x9931}, vr(VR::SQ), vm_1, "AcquisitionStartLocationSequence", "Acquisition Start Location Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9932}, vr(VR::SQ), vm_1, "AcquisitionEndLocationSequence", "Acquisition End Location Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9933}, vr(VR::SQ), vm_1, "ReconstructionProtocolElementSpecificationSequence", "Reconstruction Protocol Element Specification Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9934}, vr(VR::SQ), vm_1, "ReconstructionProtocolElementSequence", "Reconstruction Protocol Element Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9935}, vr(VR::SQ), vm_1, "StorageProtocolElementSpecificationSequence", "Storage Protocol Element Specification Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9936}, vr(VR::SQ), vm_1, "StorageProtocolElementSequence", "Storage Protocol Element Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9937}, vr(VR::LO), vm_1, "RequestedSeriesDescription", "Requested Series Description", false},
+    tag_info{dicom_tag{0x0018, 0x9938}, vr(VR::US), vm_1_n, "SourceAcquisitionProtocolElementNumber", "Source Acquisition Protocol Element Number", false},
+    tag_info{dicom_tag{0x0018, 0x9939}, vr(VR::US), vm_1_n, "SourceAcquisitionBeamNumber", "Source Acquisition Beam Number", false},
+    tag_info{dicom_tag{0x0018, 0x993A}, vr(VR::US), vm_1_n, "SourceReconstructionProtocolElementNumber", "Source Reconstruction Protocol Element Number", false},
+    tag_info{dicom_tag{0x0018, 0x993B}, vr(VR::SQ), vm_1, "ReconstructionStartLocationSequence", "Reconstruction Start Location Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x993C}, vr(VR::SQ), vm_1, "ReconstructionEndLocationSequence", "Reconstruction End Location Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x993D}, vr(VR::SQ), vm_1, "ReconstructionAlgorithmSequence", "Reconstruction Algorithm Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x993E}, vr(VR::SQ), vm_1, "ReconstructionTargetCenterLocationSequence", "Reconstruction Target Center Location Sequence", false},
+    tag_info{dicom_tag{0x0018, 0x9941}, vr(VR::UT), vm_1, "ImageFilterDescription", "Image Filter Description", false},
+    tag_info{dicom_tag{0x0018, 0x9942}, vr(VR::FD), vm_1, "CTDIvolNotificationTrigger", "CTDIvol Notification Trigger", false},
+    tag_info{dicom_tag{0x0018, 0x9943}, vr(VR::FD), vm_1, "DLPNotificationTrigger", "DLP Notification Trigger", false},
+    tag_info{dicom_tag{0x0018, 0x9944}, vr(VR::CS), vm_1, "AutoKVPSelectionType", "Auto KVP Selection Type", false},
+    tag_info{dicom_tag{0x0018, 0x9945}, vr(VR::FD), vm_1, "AutoKVPUpperBound", "Auto KVP Upper Bound", false},
+    tag_info{dicom_tag{0x0018, 0x9946}, vr(VR::FD), vm_1, "AutoKVPLowerBound", "Auto KVP Lower Bound", false},
+    tag_info{dicom_tag{0x0018, 0x9947}, vr(VR::CS), vm_1, "ProtocolDefinedPatientPosition", "Protocol Defined Patient Position", false},
+    tag_info{dicom_tag{0x0018, 0xA001}, vr(VR::SQ), vm_1, "ContributingEquipmentSequence", "Contributing Equipment Sequence", false},
+    tag_info{dicom_tag{0x0018, 0xA002}, vr(VR::DT), vm_1, "ContributionDateTime", "Contribution DateTime", false},
+    tag_info{dicom_tag{0x0018, 0xA003}, vr(VR::ST), vm_1, "ContributionDescription", "Contribution Description", false},
     tag_info{dicom_tag{0x0020, 0x000D}, vr(VR::UI), vm_1, "StudyInstanceUID", "Study Instance UID", false},
     tag_info{dicom_tag{0x0020, 0x000E}, vr(VR::UI), vm_1, "SeriesInstanceUID", "Series Instance UID", false},
     tag_info{dicom_tag{0x0020, 0x0010}, vr(VR::SH), vm_1, "StudyID", "Study ID", false},
     tag_info{dicom_tag{0x0020, 0x0011}, vr(VR::IS), vm_1, "SeriesNumber", "Series Number", false},
     tag_info{dicom_tag{0x0020, 0x0012}, vr(VR::IS), vm_1, "AcquisitionNumber", "Acquisition Number", false},
     tag_info{dicom_tag{0x0020, 0x0013}, vr(VR::IS), vm_1, "InstanceNumber", "Instance Number", false},
+    tag_info{dicom_tag{0x0020, 0x0014}, vr(VR::IS), vm_1, "IsotopeNumber", "Isotope Number", true},
+    tag_info{dicom_tag{0x0020, 0x0015}, vr(VR::IS), vm_1, "PhaseNumber", "Phase Number", true},
+    tag_info{dicom_tag{0x0020, 0x0016}, vr(VR::IS), vm_1, "IntervalNumber", "Interval Number", true},
+    tag_info{dicom_tag{0x0020, 0x0017}, vr(VR::IS), vm_1, "TimeSlotNumber", "Time Slot Number", true},
+    tag_info{dicom_tag{0x0020, 0x0018}, vr(VR::IS), vm_1, "AngleNumber", "Angle Number", true},
+    tag_info{dicom_tag{0x0020, 0x0019}, vr(VR::IS), vm_1, "ItemNumber", "Item Number", false},
     tag_info{dicom_tag{0x0020, 0x0020}, vr(VR::CS), vm_2, "PatientOrientation", "Patient Orientation", false},
+    tag_info{dicom_tag{0x0020, 0x0022}, vr(VR::IS), vm_1, "OverlayNumber", "Overlay Number", true},
+    tag_info{dicom_tag{0x0020, 0x0024}, vr(VR::IS), vm_1, "CurveNumber", "Curve Number", true},
+    tag_info{dicom_tag{0x0020, 0x0026}, vr(VR::IS), vm_1, "LUTNumber", "LUT Number", true},
+    tag_info{dicom_tag{0x0020, 0x0027}, vr(VR::LO), vm_1, "PyramidLabel", "Pyramid Label", false},
+    tag_info{dicom_tag{0x0020, 0x0030}, vr(VR::DS), vm_3, "ImagePosition", "Image Position", true},
     tag_info{dicom_tag{0x0020, 0x0032}, vr(VR::DS), vm_3, "ImagePositionPatient", "Image Position (Patient)", false},
+    tag_info{dicom_tag{0x0020, 0x0035}, vr(VR::DS), vm_6, "ImageOrientation", "Image Orientation", true},
     tag_info{dicom_tag{0x0020, 0x0037}, vr(VR::DS), vm_6, "ImageOrientationPatient", "Image Orientation (Patient)", false},
+    tag_info{dicom_tag{0x0020, 0x0050}, vr(VR::DS), vm_1, "Location", "Location", true},
     tag_info{dicom_tag{0x0020, 0x0052}, vr(VR::UI), vm_1, "FrameOfReferenceUID", "Frame of Reference UID", false},
     tag_info{dicom_tag{0x0020, 0x0060}, vr(VR::CS), vm_1, "Laterality", "Laterality", false},
     tag_info{dicom_tag{0x0020, 0x0062}, vr(VR::CS), vm_1, "ImageLaterality", "Image Laterality", false},
+    tag_info{dicom_tag{0x0020, 0x0070}, vr(VR::LO), vm_1, "ImageGeometryType", "Image Geometry Type", true},
+    tag_info{dicom_tag{0x0020, 0x0080}, vr(VR::CS), vm_1_n, "MaskingImage", "Masking Image", true},
+    tag_info{dicom_tag{0x0020, 0x00AA}, vr(VR::IS), vm_1, "ReportNumber", "Report Number", true},
     tag_info{dicom_tag{0x0020, 0x0100}, vr(VR::IS), vm_1, "TemporalPositionIdentifier", "Temporal Position Identifier", false},
     tag_info{dicom_tag{0x0020, 0x0105}, vr(VR::IS), vm_1, "NumberOfTemporalPositions", "Number of Temporal Positions", false},
     tag_info{dicom_tag{0x0020, 0x0110}, vr(VR::DS), vm_1, "TemporalResolution", "Temporal Resolution", false},
     tag_info{dicom_tag{0x0020, 0x0200}, vr(VR::UI), vm_1, "SynchronizationFrameOfReferenceUID", "Synchronization Frame of Reference UID", false},
+    tag_info{dicom_tag{0x0020, 0x0242}, vr(VR::UI), vm_1, "SOPInstanceUIDOfConcatenationSource", "SOP Instance UID of Concatenation Source", false},
+    tag_info{dicom_tag{0x0020, 0x1000}, vr(VR::IS), vm_1, "SeriesInStudy", "Series in Study", true},
+    tag_info{dicom_tag{0x0020, 0x1001}, vr(VR::IS), vm_1, "AcquisitionsInSeries", "Acquisitions in Series", true},
+    tag_info{dicom_tag{0x0020, 0x1002}, vr(VR::IS), vm_1, "ImagesInAcquisition", "Images in Acquisition", false},
+    tag_info{dicom_tag{0x0020, 0x1003}, vr(VR::IS), vm_1, "ImagesInSeries", "Images in Series", true},
+    tag_info{dicom_tag{0x0020, 0x1004}, vr(VR::IS), vm_1, "AcquisitionsInStudy", "Acquisitions in Study", true},
+    tag_info{dicom_tag{0x0020, 0x1005}, vr(VR::IS), vm_1, "ImagesInStudy", "Images in Study", true},
+    tag_info{dicom_tag{0x0020, 0x1020}, vr(VR::LO), vm_1_n, "Reference", "Reference", true},
+    tag_info{dicom_tag{0x0020, 0x103F}, vr(VR::LO), vm_1, "TargetPositionReferenceIndicator", "Target Position Reference Indicator", false},
     tag_info{dicom_tag{0x0020, 0x1040}, vr(VR::LO), vm_1, "PositionReferenceIndicator", "Position Reference Indicator", false},
     tag_info{dicom_tag{0x0020, 0x1041}, vr(VR::DS), vm_1, "SliceLocation", "Slice Location", false},
+    tag_info{dicom_tag{0x0020, 0x1070}, vr(VR::IS), vm_1_n, "OtherStudyNumbers", "Other Study Numbers", true},
     tag_info{dicom_tag{0x0020, 0x1200}, vr(VR::IS), vm_1, "NumberOfPatientRelatedStudies", "Number of Patient Related Studies", false},
     tag_info{dicom_tag{0x0020, 0x1202}, vr(VR::IS), vm_1, "NumberOfPatientRelatedSeries", "Number of Patient Related Series", false},
     tag_info{dicom_tag{0x0020, 0x1204}, vr(VR::IS), vm_1, "NumberOfPatientRelatedInstances", "Number of Patient Related Instances", false},
     tag_info{dicom_tag{0x0020, 0x1206}, vr(VR::IS), vm_1, "NumberOfStudyRelatedSeries", "Number of Study Related Series", false},
     tag_info{dicom_tag{0x0020, 0x1208}, vr(VR::IS), vm_1, "NumberOfStudyRelatedInstances", "Number of Study Related Instances", false},
     tag_info{dicom_tag{0x0020, 0x1209}, vr(VR::IS), vm_1, "NumberOfSeriesRelatedInstances", "Number of Series Related Instances", false},
+    tag_info{dicom_tag{0x0020, 0x3100}, vr(VR::CS), vm_1_n, "SourceImageIDs", "Source Image IDs", true},  // (0020,31xx)
+    tag_info{dicom_tag{0x0020, 0x3401}, vr(VR::CS), vm_1, "ModifyingDeviceID", "Modifying Device ID", true},
+    tag_info{dicom_tag{0x0020, 0x3402}, vr(VR::CS), vm_1, "ModifiedImageID", "Modified Image ID", true},
+    tag_info{dicom_tag{0x0020, 0x3403}, vr(VR::DA), vm_1, "ModifiedImageDate", "Modified Image Date", true},
+    tag_info{dicom_tag{0x0020, 0x3404}, vr(VR::LO), vm_1, "ModifyingDeviceManufacturer", "Modifying Device Manufacturer", true},
+    tag_info{dicom_tag{0x0020, 0x3405}, vr(VR::TM), vm_1, "ModifiedImageTime", "Modified Image Time", true},
+    tag_info{dicom_tag{0x0020, 0x3406}, vr(VR::LO), vm_1, "ModifiedImageDescription", "Modified Image Description", true},
     tag_info{dicom_tag{0x0020, 0x4000}, vr(VR::LT), vm_1, "ImageComments", "Image Comments", false},
-
-    // ========================================================================
-    // Image Pixel Module (0x0028)
-    // ========================================================================
+    tag_info{dicom_tag{0x0020, 0x5000}, vr(VR::AT), vm_1_n, "OriginalImageIdentification", "Original Image Identification", true},
+    tag_info{dicom_tag{0x0020, 0x5002}, vr(VR::LO), vm_1_n, "OriginalImageIdentificationNomenclature", "Original Image Identification Nomenclature", true},
+    tag_info{dicom_tag{0x0020, 0x9056}, vr(VR::SH), vm_1, "StackID", "Stack ID", false},
+    tag_info{dicom_tag{0x0020, 0x9057}, vr(VR::UL), vm_1, "InStackPositionNumber", "In-Stack Position Number", false},
+    tag_info{dicom_tag{0x0020, 0x9071}, vr(VR::SQ), vm_1, "FrameAnatomySequence", "Frame Anatomy Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9072}, vr(VR::CS), vm_1, "FrameLaterality", "Frame Laterality", false},
+    tag_info{dicom_tag{0x0020, 0x9111}, vr(VR::SQ), vm_1, "FrameContentSequence", "Frame Content Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9113}, vr(VR::SQ), vm_1, "PlanePositionSequence", "Plane Position Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9116}, vr(VR::SQ), vm_1, "PlaneOrientationSequence", "Plane Orientation Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9128}, vr(VR::UL), vm_1, "TemporalPositionIndex", "Temporal Position Index", false},
+    tag_info{dicom_tag{0x0020, 0x9153}, vr(VR::FD), vm_1, "NominalCardiacTriggerDelayTime", "Nominal Cardiac Trigger Delay Time", false},
+    tag_info{dicom_tag{0x0020, 0x9154}, vr(VR::FL), vm_1, "NominalCardiacTriggerTimePriorToRPeak", "Nominal Cardiac Trigger Time Prior To R-Peak", false},
+    tag_info{dicom_tag{0x0020, 0x9155}, vr(VR::FL), vm_1, "ActualCardiacTriggerTimePriorToRPeak", "Actual Cardiac Trigger Time Prior To R-Peak", false},
+    tag_info{dicom_tag{0x0020, 0x9156}, vr(VR::US), vm_1, "FrameAcquisitionNumber", "Frame Acquisition Number", false},
+    tag_info{dicom_tag{0x0020, 0x9157}, vr(VR::UL), vm_1_n, "DimensionIndexValues", "Dimension Index Values", false},
+    tag_info{dicom_tag{0x0020, 0x9158}, vr(VR::LT), vm_1, "FrameComments", "Frame Comments", false},
+    tag_info{dicom_tag{0x0020, 0x9161}, vr(VR::UI), vm_1, "ConcatenationUID", "Concatenation UID", false},
+    tag_info{dicom_tag{0x0020, 0x9162}, vr(VR::US), vm_1, "InConcatenationNumber", "In-concatenation Number", false},
+    tag_info{dicom_tag{0x0020, 0x9163}, vr(VR::US), vm_1, "InConcatenationTotalNumber", "In-concatenation Total Number", false},
+    tag_info{dicom_tag{0x0020, 0x9164}, vr(VR::UI), vm_1, "DimensionOrganizationUID", "Dimension Organization UID", false},
+    tag_info{dicom_tag{0x0020, 0x9165}, vr(VR::AT), vm_1, "DimensionIndexPointer", "Dimension Index Pointer", false},
+    tag_info{dicom_tag{0x0020, 0x9167}, vr(VR::AT), vm_1, "FunctionalGroupPointer", "Functional Group Pointer", false},
+    tag_info{dicom_tag{0x0020, 0x9170}, vr(VR::SQ), vm_1, "UnassignedSharedConvertedAttributesSequence", "Unassigned Shared Converted Attributes Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9171}, vr(VR::SQ), vm_1, "UnassignedPerFrameConvertedAttributesSequence", "Unassigned Per-Frame Converted Attributes Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9172}, vr(VR::SQ), vm_1, "ConversionSourceAttributesSequence", "Conversion Source Attributes Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9213}, vr(VR::LO), vm_1, "DimensionIndexPrivateCreator", "Dimension Index Private Creator", false},
+    tag_info{dicom_tag{0x0020, 0x9221}, vr(VR::SQ), vm_1, "DimensionOrganizationSequence", "Dimension Organization Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9222}, vr(VR::SQ), vm_1, "DimensionIndexSequence", "Dimension Index Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9228}, vr(VR::UL), vm_1, "ConcatenationFrameOffsetNumber", "Concatenation Frame Offset Number", false},
+    tag_info{dicom_tag{0x0020, 0x9238}, vr(VR::LO), vm_1, "FunctionalGroupPrivateCreator", "Functional Group Private Creator", false},
+    tag_info{dicom_tag{0x0020, 0x9241}, vr(VR::FL), vm_1, "NominalPercentageOfCardiacPhase", "Nominal Percentage of Cardiac Phase", false},
+    tag_info{dicom_tag{0x0020, 0x9245}, vr(VR::FL), vm_1, "NominalPercentageOfRespiratoryPhase", "Nominal Percentage of Respiratory Phase", false},
+    tag_info{dicom_tag{0x0020, 0x9246}, vr(VR::FL), vm_1, "StartingRespiratoryAmplitude", "Starting Respiratory Amplitude", false},
+    tag_info{dicom_tag{0x0020, 0x9247}, vr(VR::CS), vm_1, "StartingRespiratoryPhase", "Starting Respiratory Phase", false},
+    tag_info{dicom_tag{0x0020, 0x9248}, vr(VR::FL), vm_1, "EndingRespiratoryAmplitude", "Ending Respiratory Amplitude", false},
+    tag_info{dicom_tag{0x0020, 0x9249}, vr(VR::CS), vm_1, "EndingRespiratoryPhase", "Ending Respiratory Phase", false},
+    tag_info{dicom_tag{0x0020, 0x9250}, vr(VR::CS), vm_1, "RespiratoryTriggerType", "Respiratory Trigger Type", false},
+    tag_info{dicom_tag{0x0020, 0x9251}, vr(VR::FD), vm_1, "RRIntervalTimeNominal", "R-R Interval Time Nominal", false},
+    tag_info{dicom_tag{0x0020, 0x9252}, vr(VR::FD), vm_1, "ActualCardiacTriggerDelayTime", "Actual Cardiac Trigger Delay Time", false},
+    tag_info{dicom_tag{0x0020, 0x9253}, vr(VR::SQ), vm_1, "RespiratorySynchronizationSequence", "Respiratory Synchronization Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9254}, vr(VR::FD), vm_1, "RespiratoryIntervalTime", "Respiratory Interval Time", false},
+    tag_info{dicom_tag{0x0020, 0x9255}, vr(VR::FD), vm_1, "NominalRespiratoryTriggerDelayTime", "Nominal Respiratory Trigger Delay Time", false},
+    tag_info{dicom_tag{0x0020, 0x9256}, vr(VR::FD), vm_1, "RespiratoryTriggerDelayThreshold", "Respiratory Trigger Delay Threshold", false},
+    tag_info{dicom_tag{0x0020, 0x9257}, vr(VR::FD), vm_1, "ActualRespiratoryTriggerDelayTime", "Actual Respiratory Trigger Delay Time", false},
+    tag_info{dicom_tag{0x0020, 0x9301}, vr(VR::FD), vm_3, "ImagePositionVolume", "Image Position (Volume)", false},
+    tag_info{dicom_tag{0x0020, 0x9302}, vr(VR::FD), vm_6, "ImageOrientationVolume", "Image Orientation (Volume)", false},
+    tag_info{dicom_tag{0x0020, 0x9307}, vr(VR::CS), vm_1, "UltrasoundAcquisitionGeometry", "Ultrasound Acquisition Geometry", false},
+    tag_info{dicom_tag{0x0020, 0x9308}, vr(VR::FD), vm_3, "ApexPosition", "Apex Position", false},
+    tag_info{dicom_tag{0x0020, 0x9309}, vr(VR::FD), vm_16, "VolumeToTransducerMappingMatrix", "Volume to Transducer Mapping Matrix", false},
+    tag_info{dicom_tag{0x0020, 0x930A}, vr(VR::FD), vm_16, "VolumeToTableMappingMatrix", "Volume to Table Mapping Matrix", false},
+    tag_info{dicom_tag{0x0020, 0x930B}, vr(VR::CS), vm_1, "VolumeToTransducerRelationship", "Volume to Transducer Relationship", false},
+    tag_info{dicom_tag{0x0020, 0x930C}, vr(VR::CS), vm_1, "PatientFrameOfReferenceSource", "Patient Frame of Reference Source", false},
+    tag_info{dicom_tag{0x0020, 0x930D}, vr(VR::FD), vm_1, "TemporalPositionTimeOffset", "Temporal Position Time Offset", false},
+    tag_info{dicom_tag{0x0020, 0x930E}, vr(VR::SQ), vm_1, "PlanePositionVolumeSequence", "Plane Position (Volume) Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x930F}, vr(VR::SQ), vm_1, "PlaneOrientationVolumeSequence", "Plane Orientation (Volume) Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9310}, vr(VR::SQ), vm_1, "TemporalPositionSequence", "Temporal Position Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9311}, vr(VR::CS), vm_1, "DimensionOrganizationType", "Dimension Organization Type", false},
+    tag_info{dicom_tag{0x0020, 0x9312}, vr(VR::UI), vm_1, "VolumeFrameOfReferenceUID", "Volume Frame of Reference UID", false},
+    tag_info{dicom_tag{0x0020, 0x9313}, vr(VR::UI), vm_1, "TableFrameOfReferenceUID", "Table Frame of Reference UID", false},
+    tag_info{dicom_tag{0x0020, 0x9421}, vr(VR::LO), vm_1, "DimensionDescriptionLabel", "Dimension Description Label", false},
+    tag_info{dicom_tag{0x0020, 0x9450}, vr(VR::SQ), vm_1, "PatientOrientationInFrameSequence", "Patient Orientation in Frame Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9453}, vr(VR::LO), vm_1, "FrameLabel", "Frame Label", false},
+    tag_info{dicom_tag{0x0020, 0x9518}, vr(VR::US), vm_1_n, "AcquisitionIndex", "Acquisition Index", false},
+    tag_info{dicom_tag{0x0020, 0x9529}, vr(VR::SQ), vm_1, "ContributingSOPInstancesReferenceSequence", "Contributing SOP Instances Reference Sequence", false},
+    tag_info{dicom_tag{0x0020, 0x9536}, vr(VR::US), vm_1, "ReconstructionIndex", "Reconstruction Index", false},
+    tag_info{dicom_tag{0x0022, 0x0001}, vr(VR::US), vm_1, "LightPathFilterPassThroughWavelength", "Light Path Filter Pass-Through Wavelength", false},
+    tag_info{dicom_tag{0x0022, 0x0002}, vr(VR::US), vm_2, "LightPathFilterPassBand", "Light Path Filter Pass Band", false},
+    tag_info{dicom_tag{0x0022, 0x0003}, vr(VR::US), vm_1, "ImagePathFilterPassThroughWavelength", "Image Path Filter Pass-Through Wavelength", false},
+    tag_info{dicom_tag{0x0022, 0x0004}, vr(VR::US), vm_2, "ImagePathFilterPassBand", "Image Path Filter Pass Band", false},
+    tag_info{dicom_tag{0x0022, 0x0005}, vr(VR::CS), vm_1, "PatientEyeMovementCommanded", "Patient Eye Movement Commanded", false},
+    tag_info{dicom_tag{0x0022, 0x0006}, vr(VR::SQ), vm_1, "PatientEyeMovementCommandCodeSequence", "Patient Eye Movement Command Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x0007}, vr(VR::FL), vm_1, "SphericalLensPower", "Spherical Lens Power", false},
+    tag_info{dicom_tag{0x0022, 0x0008}, vr(VR::FL), vm_1, "CylinderLensPower", "Cylinder Lens Power", false},
+    tag_info{dicom_tag{0x0022, 0x0009}, vr(VR::FL), vm_1, "CylinderAxis", "Cylinder Axis", false},
+    tag_info{dicom_tag{0x0022, 0x000A}, vr(VR::FL), vm_1, "EmmetropicMagnification", "Emmetropic Magnification", false},
+    tag_info{dicom_tag{0x0022, 0x000B}, vr(VR::FL), vm_1, "IntraOcularPressure", "Intra Ocular Pressure", false},
+    tag_info{dicom_tag{0x0022, 0x000C}, vr(VR::FL), vm_1, "HorizontalFieldOfView", "Horizontal Field of View", false},
+    tag_info{dicom_tag{0x0022, 0x000D}, vr(VR::CS), vm_1, "PupilDilated", "Pupil Dilated", false},
+    tag_info{dicom_tag{0x0022, 0x000E}, vr(VR::FL), vm_1, "DegreeOfDilation", "Degree of Dilation", false},
+    tag_info{dicom_tag{0x0022, 0x000F}, vr(VR::FD), vm_1, "VertexDistance", "Vertex Distance", false},
+    tag_info{dicom_tag{0x0022, 0x0010}, vr(VR::FL), vm_1, "StereoBaselineAngle", "Stereo Baseline Angle", false},
+    tag_info{dicom_tag{0x0022, 0x0011}, vr(VR::FL), vm_1, "StereoBaselineDisplacement", "Stereo Baseline Displacement", false},
+    tag_info{dicom_tag{0x0022, 0x0012}, vr(VR::FL), vm_1, "StereoHorizontalPixelOffset", "Stereo Horizontal Pixel Offset", false},
+    tag_info{dicom_tag{0x0022, 0x0013}, vr(VR::FL), vm_1, "StereoVerticalPixelOffset", "Stereo Vertical Pixel Offset", false},
+    tag_info{dicom_tag{0x0022, 0x0014}, vr(VR::FL), vm_1, "StereoRotation", "Stereo Rotation", false},
+    tag_info{dicom_tag{0x0022, 0x0015}, vr(VR::SQ), vm_1, "AcquisitionDeviceTypeCodeSequence", "Acquisition Device Type Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x0016}, vr(VR::SQ), vm_1, "IlluminationTypeCodeSequence", "Illumination Type Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x0017}, vr(VR::SQ), vm_1, "LightPathFilterTypeStackCodeSequence", "Light Path Filter Type Stack Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x0018}, vr(VR::SQ), vm_1, "ImagePathFilterTypeStackCodeSequence", "Image Path Filter Type Stack Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x0019}, vr(VR::SQ), vm_1, "LensesCodeSequence", "Lenses Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x001A}, vr(VR::SQ), vm_1, "ChannelDescriptionCodeSequence", "Channel Description Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x001B}, vr(VR::SQ), vm_1, "RefractiveStateSequence", "Refractive State Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x001C}, vr(VR::SQ), vm_1, "MydriaticAgentCodeSequence", "Mydriatic Agent Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x001D}, vr(VR::SQ), vm_1, "RelativeImagePositionCodeSequence", "Relative Image Position Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x001E}, vr(VR::FL), vm_1, "CameraAngleOfView", "Camera Angle of View", false},
+    tag_info{dicom_tag{0x0022, 0x0020}, vr(VR::SQ), vm_1, "StereoPairsSequence", "Stereo Pairs Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x0021}, vr(VR::SQ), vm_1, "LeftImageSequence", "Left Image Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x0022}, vr(VR::SQ), vm_1, "RightImageSequence", "Right Image Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x0028}, vr(VR::CS), vm_1, "StereoPairsPresent", "Stereo Pairs Present", false},
+    tag_info{dicom_tag{0x0022, 0x0030}, vr(VR::FL), vm_1, "AxialLengthOfTheEye", "Axial Length of the Eye", false},
+    tag_info{dicom_tag{0x0022, 0x0031}, vr(VR::SQ), vm_1, "OphthalmicFrameLocationSequence", "Ophthalmic Frame Location Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x0032}, vr(VR::FL), vm_2_2n, "ReferenceCoordinates", "Reference Coordinates", false},
+    tag_info{dicom_tag{0x0022, 0x0035}, vr(VR::FL), vm_1, "DepthSpatialResolution", "Depth Spatial Resolution", false},
+    tag_info{dicom_tag{0x0022, 0x0036}, vr(VR::FL), vm_1, "MaximumDepthDistortion", "Maximum Depth Distortion", false},
+    tag_info{dicom_tag{0x0022, 0x0037}, vr(VR::FL), vm_1, "AlongScanSpatialResolution", "Along-scan Spatial Resolution", false},
+    tag_info{dicom_tag{0x0022, 0x0038}, vr(VR::FL), vm_1, "MaximumAlongScanDistortion", "Maximum Along-scan Distortion", false},
+    tag_info{dicom_tag{0x0022, 0x0039}, vr(VR::CS), vm_1, "OphthalmicImageOrientation", "Ophthalmic Image Orientation", false},
+    tag_info{dicom_tag{0x0022, 0x0041}, vr(VR::FL), vm_1, "DepthOfTransverseImage", "Depth of Transverse Image", false},
+    tag_info{dicom_tag{0x0022, 0x0042}, vr(VR::SQ), vm_1, "MydriaticAgentConcentrationUnitsSequence", "Mydriatic Agent Concentration Units Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x0048}, vr(VR::FL), vm_1, "AcrossScanSpatialResolution", "Across-scan Spatial Resolution", false},
+    tag_info{dicom_tag{0x0022, 0x0049}, vr(VR::FL), vm_1, "MaximumAcrossScanDistortion", "Maximum Across-scan Distortion", false},
+    tag_info{dicom_tag{0x0022, 0x004E}, vr(VR::DS), vm_1, "MydriaticAgentConcentration", "Mydriatic Agent Concentration", false},
+    tag_info{dicom_tag{0x0022, 0x0055}, vr(VR::FL), vm_1, "IlluminationWaveLength", "Illumination Wave Length", false},
+    tag_info{dicom_tag{0x0022, 0x0056}, vr(VR::FL), vm_1, "IlluminationPower", "Illumination Power", false},
+    tag_info{dicom_tag{0x0022, 0x0057}, vr(VR::FL), vm_1, "IlluminationBandwidth", "Illumination Bandwidth", false},
+    tag_info{dicom_tag{0x0022, 0x0058}, vr(VR::SQ), vm_1, "MydriaticAgentSequence", "Mydriatic Agent Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1007}, vr(VR::SQ), vm_1, "OphthalmicAxialMeasurementsRightEyeSequence", "Ophthalmic Axial Measurements Right Eye Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1008}, vr(VR::SQ), vm_1, "OphthalmicAxialMeasurementsLeftEyeSequence", "Ophthalmic Axial Measurements Left Eye Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1009}, vr(VR::CS), vm_1, "OphthalmicAxialMeasurementsDeviceType", "Ophthalmic Axial Measurements Device Type", false},
+    tag_info{dicom_tag{0x0022, 0x1010}, vr(VR::CS), vm_1, "OphthalmicAxialLengthMeasurementsType", "Ophthalmic Axial Length Measurements Type", false},
+    tag_info{dicom_tag{0x0022, 0x1012}, vr(VR::SQ), vm_1, "OphthalmicAxialLengthSequence", "Ophthalmic Axial Length Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1019}, vr(VR::FL), vm_1, "OphthalmicAxialLength", "Ophthalmic Axial Length", false},
+    tag_info{dicom_tag{0x0022, 0x1024}, vr(VR::SQ), vm_1, "LensStatusCodeSequence", "Lens Status Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1025}, vr(VR::SQ), vm_1, "VitreousStatusCodeSequence", "Vitreous Status Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1028}, vr(VR::SQ), vm_1, "IOLFormulaCodeSequence", "IOL Formula Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1029}, vr(VR::LO), vm_1, "IOLFormulaDetail", "IOL Formula Detail", false},
+    tag_info{dicom_tag{0x0022, 0x1033}, vr(VR::FL), vm_1, "KeratometerIndex", "Keratometer Index", false},
+    tag_info{dicom_tag{0x0022, 0x1035}, vr(VR::SQ), vm_1, "SourceOfOphthalmicAxialLengthCodeSequence", "Source of Ophthalmic Axial Length Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1036}, vr(VR::SQ), vm_1, "SourceOfCornealSizeDataCodeSequence", "Source of Corneal Size Data Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1037}, vr(VR::FL), vm_1, "TargetRefraction", "Target Refraction", false},
+    tag_info{dicom_tag{0x0022, 0x1039}, vr(VR::CS), vm_1, "RefractiveProcedureOccurred", "Refractive Procedure Occurred", false},
+    tag_info{dicom_tag{0x0022, 0x1040}, vr(VR::SQ), vm_1, "RefractiveSurgeryTypeCodeSequence", "Refractive Surgery Type Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1044}, vr(VR::SQ), vm_1, "OphthalmicUltrasoundMethodCodeSequence", "Ophthalmic Ultrasound Method Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1045}, vr(VR::SQ), vm_1, "SurgicallyInducedAstigmatismSequence", "Surgically Induced Astigmatism Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1046}, vr(VR::CS), vm_1, "TypeOfOpticalCorrection", "Type of Optical Correction", false},
+    tag_info{dicom_tag{0x0022, 0x1047}, vr(VR::SQ), vm_1, "ToricIOLPowerSequence", "Toric IOL Power Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1048}, vr(VR::SQ), vm_1, "PredictedToricErrorSequence", "Predicted Toric Error Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1049}, vr(VR::CS), vm_1, "PreSelectedForImplantation", "Pre-Selected for Implantation", false},
+    tag_info{dicom_tag{0x0022, 0x104A}, vr(VR::SQ), vm_1, "ToricIOLPowerForExactEmmetropiaSequence", "Toric IOL Power for Exact Emmetropia Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x104B}, vr(VR::SQ), vm_1, "ToricIOLPowerForExactTargetRefractionSequence", "Toric IOL Power for Exact Target Refraction Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1050}, vr(VR::SQ), vm_1, "OphthalmicAxialLengthMeasurementsSequence", "Ophthalmic Axial Length Measurements Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1053}, vr(VR::FL), vm_1, "IOLPower", "IOL Power", false},
+    tag_info{dicom_tag{0x0022, 0x1054}, vr(VR::FL), vm_1, "PredictedRefractiveError", "Predicted Refractive Error", false},
+    tag_info{dicom_tag{0x0022, 0x1059}, vr(VR::FL), vm_1, "OphthalmicAxialLengthVelocity", "Ophthalmic Axial Length Velocity", false},
+    tag_info{dicom_tag{0x0022, 0x1065}, vr(VR::LO), vm_1, "LensStatusDescription", "Lens Status Description", false},
+    tag_info{dicom_tag{0x0022, 0x1066}, vr(VR::LO), vm_1, "VitreousStatusDescription", "Vitreous Status Description", false},
+    tag_info{dicom_tag{0x0022, 0x1090}, vr(VR::SQ), vm_1, "IOLPowerSequence", "IOL Power Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1092}, vr(VR::SQ), vm_1, "LensConstantSequence", "Lens Constant Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1093}, vr(VR::LO), vm_1, "IOLManufacturer", "IOL Manufacturer", false},
+    tag_info{dicom_tag{0x0022, 0x1094}, vr(VR::LO), vm_1, "LensConstantDescription", "Lens Constant Description", true},
+    tag_info{dicom_tag{0x0022, 0x1095}, vr(VR::LO), vm_1, "ImplantName", "Implant Name", false},
+    tag_info{dicom_tag{0x0022, 0x1096}, vr(VR::SQ), vm_1, "KeratometryMeasurementTypeCodeSequence", "Keratometry Measurement Type Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1097}, vr(VR::LO), vm_1, "ImplantPartNumber", "Implant Part Number", false},
+    tag_info{dicom_tag{0x0022, 0x1100}, vr(VR::SQ), vm_1, "ReferencedOphthalmicAxialMeasurementsSequence", "Referenced Ophthalmic Axial Measurements Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1101}, vr(VR::SQ), vm_1, "OphthalmicAxialLengthMeasurementsSegmentNameCodeSequence", "Ophthalmic Axial Length Measurements Segment Name Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1103}, vr(VR::SQ), vm_1, "RefractiveErrorBeforeRefractiveSurgeryCodeSequence", "Refractive Error Before Refractive Surgery Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1121}, vr(VR::FL), vm_1, "IOLPowerForExactEmmetropia", "IOL Power For Exact Emmetropia", false},
+    tag_info{dicom_tag{0x0022, 0x1122}, vr(VR::FL), vm_1, "IOLPowerForExactTargetRefraction", "IOL Power For Exact Target Refraction", false},
+    tag_info{dicom_tag{0x0022, 0x1125}, vr(VR::SQ), vm_1, "AnteriorChamberDepthDefinitionCodeSequence", "Anterior Chamber Depth Definition Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1127}, vr(VR::SQ), vm_1, "LensThicknessSequence", "Lens Thickness Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1128}, vr(VR::SQ), vm_1, "AnteriorChamberDepthSequence", "Anterior Chamber Depth Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x112A}, vr(VR::SQ), vm_1, "CalculationCommentSequence", "Calculation Comment Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x112B}, vr(VR::CS), vm_1, "CalculationCommentType", "Calculation Comment Type", false},
+    tag_info{dicom_tag{0x0022, 0x112C}, vr(VR::LT), vm_1, "CalculationComment", "Calculation Comment", false},
+    tag_info{dicom_tag{0x0022, 0x1130}, vr(VR::FL), vm_1, "LensThickness", "Lens Thickness", false},
+    tag_info{dicom_tag{0x0022, 0x1131}, vr(VR::FL), vm_1, "AnteriorChamberDepth", "Anterior Chamber Depth", false},
+    tag_info{dicom_tag{0x0022, 0x1132}, vr(VR::SQ), vm_1, "SourceOfLensThicknessDataCodeSequence", "Source of Lens Thickness Data Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1133}, vr(VR::SQ), vm_1, "SourceOfAnteriorChamberDepthDataCodeSequence", "Source of Anterior Chamber Depth Data Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1134}, vr(VR::SQ), vm_1, "SourceOfRefractiveMeasurementsSequence", "Source of Refractive Measurements Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1135}, vr(VR::SQ), vm_1, "SourceOfRefractiveMeasurementsCodeSequence", "Source of Refractive Measurements Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1140}, vr(VR::CS), vm_1, "OphthalmicAxialLengthMeasurementModified", "Ophthalmic Axial Length Measurement Modified", false},
+    tag_info{dicom_tag{0x0022, 0x1150}, vr(VR::SQ), vm_1, "OphthalmicAxialLengthDataSourceCodeSequence", "Ophthalmic Axial Length Data Source Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1153}, vr(VR::SQ), vm_1, "OphthalmicAxialLengthAcquisitionMethodCodeSequence", "Ophthalmic Axial Length Acquisition Method Code Sequence", true},
+    tag_info{dicom_tag{0x0022, 0x1155}, vr(VR::FL), vm_1, "SignalToNoiseRatio", "Signal to Noise Ratio", false},
+    tag_info{dicom_tag{0x0022, 0x1159}, vr(VR::LO), vm_1, "OphthalmicAxialLengthDataSourceDescription", "Ophthalmic Axial Length Data Source Description", false},
+    tag_info{dicom_tag{0x0022, 0x1210}, vr(VR::SQ), vm_1, "OphthalmicAxialLengthMeasurementsTotalLengthSequence", "Ophthalmic Axial Length Measurements Total Length Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1211}, vr(VR::SQ), vm_1, "OphthalmicAxialLengthMeasurementsSegmentalLengthSequence", "Ophthalmic Axial Length Measurements Segmental Length Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1212}, vr(VR::SQ), vm_1, "OphthalmicAxialLengthMeasurementsLengthSummationSequence", "Ophthalmic Axial Length Measurements Length Summation Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1220}, vr(VR::SQ), vm_1, "UltrasoundOphthalmicAxialLengthMeasurementsSequence", "Ultrasound Ophthalmic Axial Length Measurements Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1225}, vr(VR::SQ), vm_1, "OpticalOphthalmicAxialLengthMeasurementsSequence", "Optical Ophthalmic Axial Length Measurements Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1230}, vr(VR::SQ), vm_1, "UltrasoundSelectedOphthalmicAxialLengthSequence", "Ultrasound Selected Ophthalmic Axial Length Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1250}, vr(VR::SQ), vm_1, "OphthalmicAxialLengthSelectionMethodCodeSequence", "Ophthalmic Axial Length Selection Method Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1255}, vr(VR::SQ), vm_1, "OpticalSelectedOphthalmicAxialLengthSequence", "Optical Selected Ophthalmic Axial Length Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1257}, vr(VR::SQ), vm_1, "SelectedSegmentalOphthalmicAxialLengthSequence", "Selected Segmental Ophthalmic Axial Length Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1260}, vr(VR::SQ), vm_1, "SelectedTotalOphthalmicAxialLengthSequence", "Selected Total Ophthalmic Axial Length Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1262}, vr(VR::SQ), vm_1, "OphthalmicAxialLengthQualityMetricSequence", "Ophthalmic Axial Length Quality Metric Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1265}, vr(VR::SQ), vm_1, "OphthalmicAxialLengthQualityMetricTypeCodeSequence", "Ophthalmic Axial Length Quality Metric Type Code Sequence", true},
+    tag_info{dicom_tag{0x0022, 0x1273}, vr(VR::LO), vm_1, "OphthalmicAxialLengthQualityMetricTypeDescription", "Ophthalmic Axial Length Quality Metric Type Description", true},
+    tag_info{dicom_tag{0x0022, 0x1300}, vr(VR::SQ), vm_1, "IntraocularLensCalculationsRightEyeSequence", "Intraocular Lens Calculations Right Eye Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1310}, vr(VR::SQ), vm_1, "IntraocularLensCalculationsLeftEyeSequence", "Intraocular Lens Calculations Left Eye Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1330}, vr(VR::SQ), vm_1, "ReferencedOphthalmicAxialLengthMeasurementQCImageSequence", "Referenced Ophthalmic Axial Length Measurement QC Image Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1415}, vr(VR::CS), vm_1, "OphthalmicMappingDeviceType", "Ophthalmic Mapping Device Type", false},
+    tag_info{dicom_tag{0x0022, 0x1420}, vr(VR::SQ), vm_1, "AcquisitionMethodCodeSequence", "Acquisition Method Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1423}, vr(VR::SQ), vm_1, "AcquisitionMethodAlgorithmSequence", "Acquisition Method Algorithm Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1436}, vr(VR::SQ), vm_1, "OphthalmicThicknessMapTypeCodeSequence", "Ophthalmic Thickness Map Type Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1443}, vr(VR::SQ), vm_1, "OphthalmicThicknessMappingNormalsSequence", "Ophthalmic Thickness Mapping Normals Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1445}, vr(VR::SQ), vm_1, "RetinalThicknessDefinitionCodeSequence", "Retinal Thickness Definition Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1450}, vr(VR::SQ), vm_1, "PixelValueMappingToCodedConceptSequence", "Pixel Value Mapping to Coded Concept Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1452}, vr(VR::US), vm_1, "MappedPixelValue", "Mapped Pixel Value", false},
+    tag_info{dicom_tag{0x0022, 0x1454}, vr(VR::LO), vm_1, "PixelValueMappingExplanation", "Pixel Value Mapping Explanation", false},
+    tag_info{dicom_tag{0x0022, 0x1458}, vr(VR::SQ), vm_1, "OphthalmicThicknessMapQualityThresholdSequence", "Ophthalmic Thickness Map Quality Threshold Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1460}, vr(VR::FL), vm_1, "OphthalmicThicknessMapThresholdQualityRating", "Ophthalmic Thickness Map Threshold Quality Rating", false},
+    tag_info{dicom_tag{0x0022, 0x1463}, vr(VR::FL), vm_2, "AnatomicStructureReferencePoint", "Anatomic Structure Reference Point", false},
+    tag_info{dicom_tag{0x0022, 0x1465}, vr(VR::SQ), vm_1, "RegistrationToLocalizerSequence", "Registration to Localizer Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1466}, vr(VR::CS), vm_1, "RegisteredLocalizerUnits", "Registered Localizer Units", false},
+    tag_info{dicom_tag{0x0022, 0x1467}, vr(VR::FL), vm_2, "RegisteredLocalizerTopLeftHandCorner", "Registered Localizer Top Left Hand Corner", false},
+    tag_info{dicom_tag{0x0022, 0x1468}, vr(VR::FL), vm_2, "RegisteredLocalizerBottomRightHandCorner", "Registered Localizer Bottom Right Hand Corner", false},
+    tag_info{dicom_tag{0x0022, 0x1470}, vr(VR::SQ), vm_1, "OphthalmicThicknessMapQualityRatingSequence", "Ophthalmic Thickness Map Quality Rating Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1472}, vr(VR::SQ), vm_1, "RelevantOPTAttributesSequence", "Relevant OPT Attributes Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1512}, vr(VR::SQ), vm_1, "TransformationMethodCodeSequence", "Transformation Method Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1513}, vr(VR::SQ), vm_1, "TransformationAlgorithmSequence", "Transformation Algorithm Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1515}, vr(VR::CS), vm_1, "OphthalmicAxialLengthMethod", "Ophthalmic Axial Length Method", false},
+    tag_info{dicom_tag{0x0022, 0x1517}, vr(VR::FL), vm_1, "OphthalmicFOV", "Ophthalmic FOV", false},
+    tag_info{dicom_tag{0x0022, 0x1518}, vr(VR::SQ), vm_1, "TwoDimensionalToThreeDimensionalMapSequence", "Two Dimensional to Three Dimensional Map Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1525}, vr(VR::SQ), vm_1, "WideFieldOphthalmicPhotographyQualityRatingSequence", "Wide Field Ophthalmic Photography Quality Rating Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1526}, vr(VR::SQ), vm_1, "WideFieldOphthalmicPhotographyQualityThresholdSequence", "Wide Field Ophthalmic Photography Quality Threshold Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1527}, vr(VR::FL), vm_1, "WideFieldOphthalmicPhotographyThresholdQualityRating", "Wide Field Ophthalmic Photography Threshold Quality Rating", false},
+    tag_info{dicom_tag{0x0022, 0x1528}, vr(VR::FL), vm_1, "XCoordinatesCenterPixelViewAngle", "X Coordinates Center Pixel View Angle", false},
+    tag_info{dicom_tag{0x0022, 0x1529}, vr(VR::FL), vm_1, "YCoordinatesCenterPixelViewAngle", "Y Coordinates Center Pixel View Angle", false},
+    tag_info{dicom_tag{0x0022, 0x1530}, vr(VR::UL), vm_1, "NumberOfMapPoints", "Number of Map Points", false},
+    tag_info{dicom_tag{0x0022, 0x1531}, vr(VR::OF), vm_1, "TwoDimensionalToThreeDimensionalMapData", "Two Dimensional to Three Dimensional Map Data", false},
+    tag_info{dicom_tag{0x0022, 0x1612}, vr(VR::SQ), vm_1, "DerivationAlgorithmSequence", "Derivation Algorithm Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1615}, vr(VR::SQ), vm_1, "OphthalmicImageTypeCodeSequence", "Ophthalmic Image Type Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1616}, vr(VR::LO), vm_1, "OphthalmicImageTypeDescription", "Ophthalmic Image Type Description", false},
+    tag_info{dicom_tag{0x0022, 0x1618}, vr(VR::SQ), vm_1, "ScanPatternTypeCodeSequence", "Scan Pattern Type Code Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1620}, vr(VR::SQ), vm_1, "ReferencedSurfaceMeshIdentificationSequence", "Referenced Surface Mesh Identification Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1622}, vr(VR::CS), vm_1, "OphthalmicVolumetricPropertiesFlag", "Ophthalmic Volumetric Properties Flag", false},
+    tag_info{dicom_tag{0x0022, 0x1624}, vr(VR::FL), vm_1, "OphthalmicAnatomicReferencePointXCoordinate", "Ophthalmic Anatomic Reference Point X-Coordinate", false},
+    tag_info{dicom_tag{0x0022, 0x1626}, vr(VR::FL), vm_1, "OphthalmicAnatomicReferencePointYCoordinate", "Ophthalmic Anatomic Reference Point Y-Coordinate", false},
+    tag_info{dicom_tag{0x0022, 0x1628}, vr(VR::SQ), vm_1, "OphthalmicEnFaceImageQualityRatingSequence", "Ophthalmic En Face Image Quality Rating Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1630}, vr(VR::DS), vm_1, "QualityThreshold", "Quality Threshold", false},
+    tag_info{dicom_tag{0x0022, 0x1640}, vr(VR::SQ), vm_1, "OCTBscanAnalysisAcquisitionParametersSequence", "OCT B-scan Analysis Acquisition Parameters Sequence", false},
+    tag_info{dicom_tag{0x0022, 0x1642}, vr(VR::UL), vm_1, "NumberOfBscansPerFrame", "Number of B-scans Per Frame", false},
+    tag_info{dicom_tag{0x0022, 0x1643}, vr(VR::FL), vm_1, "BscanSlabThickness", "B-scan Slab Thickness", false},
+    tag_info{dicom_tag{0x0022, 0x1644}, vr(VR::FL), vm_1, "DistanceBetweenBscanSlabs", "Distance Between B-scan Slabs", false},
+    tag_info{dicom_tag{0x0022, 0x1645}, vr(VR::FL), vm_1, "BscanCycleTime", "B-scan Cycle Time", false},
+    tag_info{dicom_tag{0x0022, 0x1646}, vr(VR::FL), vm_1_n, "BscanCycleTimeVector", "B-scan Cycle Time Vector", false},
+    tag_info{dicom_tag{0x0022, 0x1649}, vr(VR::FL), vm_1, "AscanRate", "A-scan Rate", false},
+    tag_info{dicom_tag{0x0022, 0x1650}, vr(VR::FL), vm_1, "BscanRate", "B-scan Rate", false},
+    tag_info{dicom_tag{0x0022, 0x1658}, vr(VR::UL), vm_1, "SurfaceMeshZPixelOffset", "Surface Mesh Z-Pixel Offset", false},
+    tag_info{dicom_tag{0x0024, 0x0010}, vr(VR::FL), vm_1, "VisualFieldHorizontalExtent", "Visual Field Horizontal Extent", false},
+    tag_info{dicom_tag{0x0024, 0x0011}, vr(VR::FL), vm_1, "VisualFieldVerticalExtent", "Visual Field Vertical Extent", false},
+    tag_info{dicom_tag{0x0024, 0x0012}, vr(VR::CS), vm_1, "VisualFieldShape", "Visual Field Shape", false},
+    tag_info{dicom_tag{0x0024, 0x0016}, vr(VR::SQ), vm_1, "ScreeningTestModeCodeSequence", "Screening Test Mode Code Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0018}, vr(VR::FL), vm_1, "MaximumStimulusLuminance", "Maximum Stimulus Luminance", false},
+    tag_info{dicom_tag{0x0024, 0x0020}, vr(VR::FL), vm_1, "BackgroundLuminance", "Background Luminance", false},
+    tag_info{dicom_tag{0x0024, 0x0021}, vr(VR::SQ), vm_1, "StimulusColorCodeSequence", "Stimulus Color Code Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0024}, vr(VR::SQ), vm_1, "BackgroundIlluminationColorCodeSequence", "Background Illumination Color Code Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0025}, vr(VR::FL), vm_1, "StimulusArea", "Stimulus Area", false},
+    tag_info{dicom_tag{0x0024, 0x0028}, vr(VR::FL), vm_1, "StimulusPresentationTime", "Stimulus Presentation Time", false},
+    tag_info{dicom_tag{0x0024, 0x0032}, vr(VR::SQ), vm_1, "FixationSequence", "Fixation Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0033}, vr(VR::SQ), vm_1, "FixationMonitoringCodeSequence", "Fixation Monitoring Code Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0034}, vr(VR::SQ), vm_1, "VisualFieldCatchTrialSequence", "Visual Field Catch Trial Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0035}, vr(VR::US), vm_1, "FixationCheckedQuantity", "Fixation Checked Quantity", false},
+    tag_info{dicom_tag{0x0024, 0x0036}, vr(VR::US), vm_1, "PatientNotProperlyFixatedQuantity", "Patient Not Properly Fixated Quantity", false},
+    tag_info{dicom_tag{0x0024, 0x0037}, vr(VR::CS), vm_1, "PresentedVisualStimuliDataFlag", "Presented Visual Stimuli Data Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0038}, vr(VR::US), vm_1, "NumberOfVisualStimuli", "Number of Visual Stimuli", false},
+    tag_info{dicom_tag{0x0024, 0x0039}, vr(VR::CS), vm_1, "ExcessiveFixationLossesDataFlag", "Excessive Fixation Losses Data Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0040}, vr(VR::CS), vm_1, "ExcessiveFixationLosses", "Excessive Fixation Losses", false},
+    tag_info{dicom_tag{0x0024, 0x0042}, vr(VR::US), vm_1, "StimuliRetestingQuantity", "Stimuli Retesting Quantity", false},
+    tag_info{dicom_tag{0x0024, 0x0044}, vr(VR::LT), vm_1, "CommentsOnPatientPerformanceOfVisualField", "Comments on Patient's Performance of Visual Field", false},
+    tag_info{dicom_tag{0x0024, 0x0045}, vr(VR::CS), vm_1, "FalseNegativesEstimateFlag", "False Negatives Estimate Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0046}, vr(VR::FL), vm_1, "FalseNegativesEstimate", "False Negatives Estimate", false},
+    tag_info{dicom_tag{0x0024, 0x0048}, vr(VR::US), vm_1, "NegativeCatchTrialsQuantity", "Negative Catch Trials Quantity", false},
+    tag_info{dicom_tag{0x0024, 0x0050}, vr(VR::US), vm_1, "FalseNegativesQuantity", "False Negatives Quantity", false},
+    tag_info{dicom_tag{0x0024, 0x0051}, vr(VR::CS), vm_1, "ExcessiveFalseNegativesDataFlag", "Excessive False Negatives Data Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0052}, vr(VR::CS), vm_1, "ExcessiveFalseNegatives", "Excessive False Negatives", false},
+    tag_info{dicom_tag{0x0024, 0x0053}, vr(VR::CS), vm_1, "FalsePositivesEstimateFlag", "False Positives Estimate Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0054}, vr(VR::FL), vm_1, "FalsePositivesEstimate", "False Positives Estimate", false},
+    tag_info{dicom_tag{0x0024, 0x0055}, vr(VR::CS), vm_1, "CatchTrialsDataFlag", "Catch Trials Data Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0056}, vr(VR::US), vm_1, "PositiveCatchTrialsQuantity", "Positive Catch Trials Quantity", false},
+    tag_info{dicom_tag{0x0024, 0x0057}, vr(VR::CS), vm_1, "TestPointNormalsDataFlag", "Test Point Normals Data Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0058}, vr(VR::SQ), vm_1, "TestPointNormalsSequence", "Test Point Normals Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0059}, vr(VR::CS), vm_1, "GlobalDeviationProbabilityNormalsFlag", "Global Deviation Probability Normals Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0060}, vr(VR::US), vm_1, "FalsePositivesQuantity", "False Positives Quantity", false},
+    tag_info{dicom_tag{0x0024, 0x0061}, vr(VR::CS), vm_1, "ExcessiveFalsePositivesDataFlag", "Excessive False Positives Data Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0062}, vr(VR::CS), vm_1, "ExcessiveFalsePositives", "Excessive False Positives", false},
+    tag_info{dicom_tag{0x0024, 0x0063}, vr(VR::CS), vm_1, "VisualFieldTestNormalsFlag", "Visual Field Test Normals Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0064}, vr(VR::SQ), vm_1, "ResultsNormalsSequence", "Results Normals Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0065}, vr(VR::SQ), vm_1, "AgeCorrectedSensitivityDeviationAlgorithmSequence", "Age Corrected Sensitivity Deviation Algorithm Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0066}, vr(VR::FL), vm_1, "GlobalDeviationFromNormal", "Global Deviation From Normal", false},
+    tag_info{dicom_tag{0x0024, 0x0067}, vr(VR::SQ), vm_1, "GeneralizedDefectSensitivityDeviationAlgorithmSequence", "Generalized Defect Sensitivity Deviation Algorithm Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0068}, vr(VR::FL), vm_1, "LocalizedDeviationFromNormal", "Localized Deviation From Normal", false},
+    tag_info{dicom_tag{0x0024, 0x0069}, vr(VR::LO), vm_1, "PatientReliabilityIndicator", "Patient Reliability Indicator", false},
+    tag_info{dicom_tag{0x0024, 0x0070}, vr(VR::FL), vm_1, "VisualFieldMeanSensitivity", "Visual Field Mean Sensitivity", false},
+    tag_info{dicom_tag{0x0024, 0x0071}, vr(VR::FL), vm_1, "GlobalDeviationProbability", "Global Deviation Probability", false},
+    tag_info{dicom_tag{0x0024, 0x0072}, vr(VR::CS), vm_1, "LocalDeviationProbabilityNormalsFlag", "Local Deviation Probability Normals Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0073}, vr(VR::FL), vm_1, "LocalizedDeviationProbability", "Localized Deviation Probability", false},
+    tag_info{dicom_tag{0x0024, 0x0074}, vr(VR::CS), vm_1, "ShortTermFluctuationCalculated", "Short Term Fluctuation Calculated", false},
+    tag_info{dicom_tag{0x0024, 0x0075}, vr(VR::FL), vm_1, "ShortTermFluctuation", "Short Term Fluctuation", false},
+    tag_info{dicom_tag{0x0024, 0x0076}, vr(VR::CS), vm_1, "ShortTermFluctuationProbabilityCalculated", "Short Term Fluctuation Probability Calculated", false},
+    tag_info{dicom_tag{0x0024, 0x0077}, vr(VR::FL), vm_1, "ShortTermFluctuationProbability", "Short Term Fluctuation Probability", false},
+    tag_info{dicom_tag{0x0024, 0x0078}, vr(VR::CS), vm_1, "CorrectedLocalizedDeviationFromNormalCalculated", "Corrected Localized Deviation From Normal Calculated", false},
+    tag_info{dicom_tag{0x0024, 0x0079}, vr(VR::FL), vm_1, "CorrectedLocalizedDeviationFromNormal", "Corrected Localized Deviation From Normal", false},
+    tag_info{dicom_tag{0x0024, 0x0080}, vr(VR::CS), vm_1, "CorrectedLocalizedDeviationFromNormalProbabilityCalculated", "Corrected Localized Deviation From Normal Probability Calculated", false},
+    tag_info{dicom_tag{0x0024, 0x0081}, vr(VR::FL), vm_1, "CorrectedLocalizedDeviationFromNormalProbability", "Corrected Localized Deviation From Normal Probability", false},
+    tag_info{dicom_tag{0x0024, 0x0083}, vr(VR::SQ), vm_1, "GlobalDeviationProbabilitySequence", "Global Deviation Probability Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0085}, vr(VR::SQ), vm_1, "LocalizedDeviationProbabilitySequence", "Localized Deviation Probability Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0086}, vr(VR::CS), vm_1, "FovealSensitivityMeasured", "Foveal Sensitivity Measured", false},
+    tag_info{dicom_tag{0x0024, 0x0087}, vr(VR::FL), vm_1, "FovealSensitivity", "Foveal Sensitivity", false},
+    tag_info{dicom_tag{0x0024, 0x0088}, vr(VR::FL), vm_1, "VisualFieldTestDuration", "Visual Field Test Duration", false},
+    tag_info{dicom_tag{0x0024, 0x0089}, vr(VR::SQ), vm_1, "VisualFieldTestPointSequence", "Visual Field Test Point Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0090}, vr(VR::FL), vm_1, "VisualFieldTestPointXCoordinate", "Visual Field Test Point X-Coordinate", false},
+    tag_info{dicom_tag{0x0024, 0x0091}, vr(VR::FL), vm_1, "VisualFieldTestPointYCoordinate", "Visual Field Test Point Y-Coordinate", false},
+    tag_info{dicom_tag{0x0024, 0x0092}, vr(VR::FL), vm_1, "AgeCorrectedSensitivityDeviationValue", "Age Corrected Sensitivity Deviation Value", false},
+    tag_info{dicom_tag{0x0024, 0x0093}, vr(VR::CS), vm_1, "StimulusResults", "Stimulus Results", false},
+    tag_info{dicom_tag{0x0024, 0x0094}, vr(VR::FL), vm_1, "SensitivityValue", "Sensitivity Value", false},
+    tag_info{dicom_tag{0x0024, 0x0095}, vr(VR::CS), vm_1, "RetestStimulusSeen", "Retest Stimulus Seen", false},
+    tag_info{dicom_tag{0x0024, 0x0096}, vr(VR::FL), vm_1, "RetestSensitivityValue", "Retest Sensitivity Value", false},
+    tag_info{dicom_tag{0x0024, 0x0097}, vr(VR::SQ), vm_1, "VisualFieldTestPointNormalsSequence", "Visual Field Test Point Normals Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0098}, vr(VR::FL), vm_1, "QuantifiedDefect", "Quantified Defect", false},
+    tag_info{dicom_tag{0x0024, 0x0100}, vr(VR::FL), vm_1, "AgeCorrectedSensitivityDeviationProbabilityValue", "Age Corrected Sensitivity Deviation Probability Value", false},
+    tag_info{dicom_tag{0x0024, 0x0102}, vr(VR::CS), vm_1, "GeneralizedDefectCorrectedSensitivityDeviationFlag", "Generalized Defect Corrected Sensitivity Deviation Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0103}, vr(VR::FL), vm_1, "GeneralizedDefectCorrectedSensitivityDeviationValue", "Generalized Defect Corrected Sensitivity Deviation Value", false},
+    tag_info{dicom_tag{0x0024, 0x0104}, vr(VR::FL), vm_1, "GeneralizedDefectCorrectedSensitivityDeviationProbabilityValue", "Generalized Defect Corrected Sensitivity Deviation Probability Value", false},
+    tag_info{dicom_tag{0x0024, 0x0105}, vr(VR::FL), vm_1, "MinimumSensitivityValue", "Minimum Sensitivity Value", false},
+    tag_info{dicom_tag{0x0024, 0x0106}, vr(VR::CS), vm_1, "BlindSpotLocalized", "Blind Spot Localized", false},
+    tag_info{dicom_tag{0x0024, 0x0107}, vr(VR::FL), vm_1, "BlindSpotXCoordinate", "Blind Spot X-Coordinate", false},
+    tag_info{dicom_tag{0x0024, 0x0108}, vr(VR::FL), vm_1, "BlindSpotYCoordinate", "Blind Spot Y-Coordinate", false},
+    tag_info{dicom_tag{0x0024, 0x0110}, vr(VR::SQ), vm_1, "VisualAcuityMeasurementSequence", "Visual Acuity Measurement Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0112}, vr(VR::SQ), vm_1, "RefractiveParametersUsedOnPatientSequence", "Refractive Parameters Used on Patient Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0113}, vr(VR::CS), vm_1, "MeasurementLaterality", "Measurement Laterality", false},
+    tag_info{dicom_tag{0x0024, 0x0114}, vr(VR::SQ), vm_1, "OphthalmicPatientClinicalInformationLeftEyeSequence", "Ophthalmic Patient Clinical Information Left Eye Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0115}, vr(VR::SQ), vm_1, "OphthalmicPatientClinicalInformationRightEyeSequence", "Ophthalmic Patient Clinical Information Right Eye Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0117}, vr(VR::CS), vm_1, "FovealPointNormativeDataFlag", "Foveal Point Normative Data Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0118}, vr(VR::FL), vm_1, "FovealPointProbabilityValue", "Foveal Point Probability Value", false},
+    tag_info{dicom_tag{0x0024, 0x0120}, vr(VR::CS), vm_1, "ScreeningBaselineMeasured", "Screening Baseline Measured", false},
+    tag_info{dicom_tag{0x0024, 0x0122}, vr(VR::SQ), vm_1, "ScreeningBaselineMeasuredSequence", "Screening Baseline Measured Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0124}, vr(VR::CS), vm_1, "ScreeningBaselineType", "Screening Baseline Type", false},
+    tag_info{dicom_tag{0x0024, 0x0126}, vr(VR::FL), vm_1, "ScreeningBaselineValue", "Screening Baseline Value", false},
+    tag_info{dicom_tag{0x0024, 0x0202}, vr(VR::LO), vm_1, "AlgorithmSource", "Algorithm Source", false},
+    tag_info{dicom_tag{0x0024, 0x0306}, vr(VR::LO), vm_1, "DataSetName", "Data Set Name", false},
+    tag_info{dicom_tag{0x0024, 0x0307}, vr(VR::LO), vm_1, "DataSetVersion", "Data Set Version", false},
+    tag_info{dicom_tag{0x0024, 0x0308}, vr(VR::LO), vm_1, "DataSetSource", "Data Set Source", false},
+    tag_info{dicom_tag{0x0024, 0x0309}, vr(VR::LO), vm_1, "DataSetDescription", "Data Set Description", false},
+    tag_info{dicom_tag{0x0024, 0x0317}, vr(VR::SQ), vm_1, "VisualFieldTestReliabilityGlobalIndexSequence", "Visual Field Test Reliability Global Index Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0320}, vr(VR::SQ), vm_1, "VisualFieldGlobalResultsIndexSequence", "Visual Field Global Results Index Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0325}, vr(VR::SQ), vm_1, "DataObservationSequence", "Data Observation Sequence", false},
+    tag_info{dicom_tag{0x0024, 0x0338}, vr(VR::CS), vm_1, "IndexNormalsFlag", "Index Normals Flag", false},
+    tag_info{dicom_tag{0x0024, 0x0341}, vr(VR::FL), vm_1, "IndexProbability", "Index Probability", false},
+    tag_info{dicom_tag{0x0024, 0x0344}, vr(VR::SQ), vm_1, "IndexProbabilitySequence", "Index Probability Sequence", false},
     tag_info{dicom_tag{0x0028, 0x0002}, vr(VR::US), vm_1, "SamplesPerPixel", "Samples per Pixel", false},
     tag_info{dicom_tag{0x0028, 0x0003}, vr(VR::US), vm_1, "SamplesPerPixelUsed", "Samples per Pixel Used", false},
     tag_info{dicom_tag{0x0028, 0x0004}, vr(VR::CS), vm_1, "PhotometricInterpretation", "Photometric Interpretation", false},
+    tag_info{dicom_tag{0x0028, 0x0005}, vr(VR::US), vm_1, "ImageDimensions", "Image Dimensions", true},
     tag_info{dicom_tag{0x0028, 0x0006}, vr(VR::US), vm_1, "PlanarConfiguration", "Planar Configuration", false},
     tag_info{dicom_tag{0x0028, 0x0008}, vr(VR::IS), vm_1, "NumberOfFrames", "Number of Frames", false},
     tag_info{dicom_tag{0x0028, 0x0009}, vr(VR::AT), vm_1_n, "FrameIncrementPointer", "Frame Increment Pointer", false},
+    tag_info{dicom_tag{0x0028, 0x000A}, vr(VR::AT), vm_1_n, "FrameDimensionPointer", "Frame Dimension Pointer", false},
     tag_info{dicom_tag{0x0028, 0x0010}, vr(VR::US), vm_1, "Rows", "Rows", false},
     tag_info{dicom_tag{0x0028, 0x0011}, vr(VR::US), vm_1, "Columns", "Columns", false},
+    tag_info{dicom_tag{0x0028, 0x0012}, vr(VR::US), vm_1, "Planes", "Planes", true},
+    tag_info{dicom_tag{0x0028, 0x0014}, vr(VR::US), vm_1, "UltrasoundColorDataPresent", "Ultrasound Color Data Present", false},
+    tag_info{dicom_tag{0x0028, 0x0020}, vr(VR::OB), vm_1, "", "Retired-blank", true},
     tag_info{dicom_tag{0x0028, 0x0030}, vr(VR::DS), vm_2, "PixelSpacing", "Pixel Spacing", false},
+    tag_info{dicom_tag{0x0028, 0x0031}, vr(VR::DS), vm_2, "ZoomFactor", "Zoom Factor", false},
+    tag_info{dicom_tag{0x0028, 0x0032}, vr(VR::DS), vm_2, "ZoomCenter", "Zoom Center", false},
     tag_info{dicom_tag{0x0028, 0x0034}, vr(VR::IS), vm_2, "PixelAspectRatio", "Pixel Aspect Ratio", false},
+    tag_info{dicom_tag{0x0028, 0x0040}, vr(VR::CS), vm_1, "ImageFormat", "Image Format", true},
+    tag_info{dicom_tag{0x0028, 0x0050}, vr(VR::LO), vm_1_n, "ManipulatedImage", "Manipulated Image", true},
+    tag_info{dicom_tag{0x0028, 0x0051}, vr(VR::CS), vm_1_n, "CorrectedImage", "Corrected Image", false},
+    tag_info{dicom_tag{0x0028, 0x005F}, vr(VR::LO), vm_1, "CompressionRecognitionCode", "Compression Recognition Code", true},
+    tag_info{dicom_tag{0x0028, 0x0060}, vr(VR::CS), vm_1, "CompressionCode", "Compression Code", true},
+    tag_info{dicom_tag{0x0028, 0x0061}, vr(VR::SH), vm_1, "CompressionOriginator", "Compression Originator", true},
+    tag_info{dicom_tag{0x0028, 0x0062}, vr(VR::LO), vm_1, "CompressionLabel", "Compression Label", true},
+    tag_info{dicom_tag{0x0028, 0x0063}, vr(VR::SH), vm_1, "CompressionDescription", "Compression Description", true},
+    tag_info{dicom_tag{0x0028, 0x0065}, vr(VR::CS), vm_1_n, "CompressionSequence", "Compression Sequence", true},
+    tag_info{dicom_tag{0x0028, 0x0066}, vr(VR::AT), vm_1_n, "CompressionStepPointers", "Compression Step Pointers", true},
+    tag_info{dicom_tag{0x0028, 0x0068}, vr(VR::US), vm_1, "RepeatInterval", "Repeat Interval", true},
+    tag_info{dicom_tag{0x0028, 0x0069}, vr(VR::US), vm_1, "BitsGrouped", "Bits Grouped", true},
+    tag_info{dicom_tag{0x0028, 0x0070}, vr(VR::US), vm_1_n, "PerimeterTable", "Perimeter Table", true},
+    tag_info{dicom_tag{0x0028, 0x0071}, vr(VR::US), vm_1, "PerimeterValue", "Perimeter Value", true},
+    tag_info{dicom_tag{0x0028, 0x0080}, vr(VR::US), vm_1, "PredictorRows", "Predictor Rows", true},
+    tag_info{dicom_tag{0x0028, 0x0081}, vr(VR::US), vm_1, "PredictorColumns", "Predictor Columns", true},
+    tag_info{dicom_tag{0x0028, 0x0082}, vr(VR::US), vm_1_n, "PredictorConstants", "Predictor Constants", true},
+    tag_info{dicom_tag{0x0028, 0x0090}, vr(VR::CS), vm_1, "BlockedPixels", "Blocked Pixels", true},
+    tag_info{dicom_tag{0x0028, 0x0091}, vr(VR::US), vm_1, "BlockRows", "Block Rows", true},
+    tag_info{dicom_tag{0x0028, 0x0092}, vr(VR::US), vm_1, "BlockColumns", "Block Columns", true},
+    tag_info{dicom_tag{0x0028, 0x0093}, vr(VR::US), vm_1, "RowOverlap", "Row Overlap", true},
+    tag_info{dicom_tag{0x0028, 0x0094}, vr(VR::US), vm_1, "ColumnOverlap", "Column Overlap", true},
     tag_info{dicom_tag{0x0028, 0x0100}, vr(VR::US), vm_1, "BitsAllocated", "Bits Allocated", false},
     tag_info{dicom_tag{0x0028, 0x0101}, vr(VR::US), vm_1, "BitsStored", "Bits Stored", false},
     tag_info{dicom_tag{0x0028, 0x0102}, vr(VR::US), vm_1, "HighBit", "High Bit", false},
     tag_info{dicom_tag{0x0028, 0x0103}, vr(VR::US), vm_1, "PixelRepresentation", "Pixel Representation", false},
+    tag_info{dicom_tag{0x0028, 0x0104}, vr(VR::US), vm_1, "SmallestValidPixelValue", "Smallest Valid Pixel Value", true},
+    tag_info{dicom_tag{0x0028, 0x0105}, vr(VR::US), vm_1, "LargestValidPixelValue", "Largest Valid Pixel Value", true},
     tag_info{dicom_tag{0x0028, 0x0106}, vr(VR::US), vm_1, "SmallestImagePixelValue", "Smallest Image Pixel Value", false},
     tag_info{dicom_tag{0x0028, 0x0107}, vr(VR::US), vm_1, "LargestImagePixelValue", "Largest Image Pixel Value", false},
     tag_info{dicom_tag{0x0028, 0x0108}, vr(VR::US), vm_1, "SmallestPixelValueInSeries", "Smallest Pixel Value in Series", false},
     tag_info{dicom_tag{0x0028, 0x0109}, vr(VR::US), vm_1, "LargestPixelValueInSeries", "Largest Pixel Value in Series", false},
+    tag_info{dicom_tag{0x0028, 0x0110}, vr(VR::US), vm_1, "SmallestImagePixelValueInPlane", "Smallest Image Pixel Value in Plane", true},
+    tag_info{dicom_tag{0x0028, 0x0111}, vr(VR::US), vm_1, "LargestImagePixelValueInPlane", "Largest Image Pixel Value in Plane", true},
     tag_info{dicom_tag{0x0028, 0x0120}, vr(VR::US), vm_1, "PixelPaddingValue", "Pixel Padding Value", false},
     tag_info{dicom_tag{0x0028, 0x0121}, vr(VR::US), vm_1, "PixelPaddingRangeLimit", "Pixel Padding Range Limit", false},
+    tag_info{dicom_tag{0x0028, 0x0122}, vr(VR::FL), vm_1, "FloatPixelPaddingValue", "Float Pixel Padding Value", false},
+    tag_info{dicom_tag{0x0028, 0x0123}, vr(VR::FD), vm_1, "DoubleFloatPixelPaddingValue", "Double Float Pixel Padding Value", false},
+    tag_info{dicom_tag{0x0028, 0x0124}, vr(VR::FL), vm_1, "FloatPixelPaddingRangeLimit", "Float Pixel Padding Range Limit", false},
+    tag_info{dicom_tag{0x0028, 0x0125}, vr(VR::FD), vm_1, "DoubleFloatPixelPaddingRangeLimit", "Double Float Pixel Padding Range Limit", false},
+    tag_info{dicom_tag{0x0028, 0x0200}, vr(VR::US), vm_1, "ImageLocation", "Image Location", true},
     tag_info{dicom_tag{0x0028, 0x0300}, vr(VR::CS), vm_1, "QualityControlImage", "Quality Control Image", false},
     tag_info{dicom_tag{0x0028, 0x0301}, vr(VR::CS), vm_1, "BurnedInAnnotation", "Burned In Annotation", false},
+    tag_info{dicom_tag{0x0028, 0x0302}, vr(VR::CS), vm_1, "RecognizableVisualFeatures", "Recognizable Visual Features", false},
+    tag_info{dicom_tag{0x0028, 0x0303}, vr(VR::CS), vm_1, "LongitudinalTemporalInformationModified", "Longitudinal Temporal Information Modified", false},
+    tag_info{dicom_tag{0x0028, 0x0304}, vr(VR::UI), vm_1, "ReferencedColorPaletteInstanceUID", "Referenced Color Palette Instance UID", false},
+    tag_info{dicom_tag{0x0028, 0x0400}, vr(VR::LO), vm_1, "TransformLabel", "Transform Label", true},
+    tag_info{dicom_tag{0x0028, 0x0401}, vr(VR::LO), vm_1, "TransformVersionNumber", "Transform Version Number", true},
+    tag_info{dicom_tag{0x0028, 0x0402}, vr(VR::US), vm_1, "NumberOfTransformSteps", "Number of Transform Steps", true},
+    tag_info{dicom_tag{0x0028, 0x0403}, vr(VR::LO), vm_1_n, "SequenceOfCompressedData", "Sequence of Compressed Data", true},
+    tag_info{dicom_tag{0x0028, 0x0404}, vr(VR::AT), vm_1_n, "DetailsOfCoefficients", "Details of Coefficients", true},
+    tag_info{dicom_tag{0x0028, 0x0410}, vr(VR::US), vm_1, "RowsForNthOrderCoefficients", "Rows For Nth Order Coefficients", true},  // (0028,04x0)
+    tag_info{dicom_tag{0x0028, 0x0411}, vr(VR::US), vm_1, "ColumnsForNthOrderCoefficients", "Columns For Nth Order Coefficients", true},  // (0028,04x1)
+    tag_info{dicom_tag{0x0028, 0x0412}, vr(VR::LO), vm_1_n, "CoefficientCoding", "Coefficient Coding", true},  // (0028,04x2)
+    tag_info{dicom_tag{0x0028, 0x0413}, vr(VR::AT), vm_1_n, "CoefficientCodingPointers", "Coefficient Coding Pointers", true},  // (0028,04x3)
+    tag_info{dicom_tag{0x0028, 0x0700}, vr(VR::LO), vm_1, "DCTLabel", "DCT Label", true},
+    tag_info{dicom_tag{0x0028, 0x0701}, vr(VR::CS), vm_1_n, "DataBlockDescription", "Data Block Description", true},
+    tag_info{dicom_tag{0x0028, 0x0702}, vr(VR::AT), vm_1_n, "DataBlock", "Data Block", true},
+    tag_info{dicom_tag{0x0028, 0x0710}, vr(VR::US), vm_1, "NormalizationFactorFormat", "Normalization Factor Format", true},
+    tag_info{dicom_tag{0x0028, 0x0720}, vr(VR::US), vm_1, "ZonalMapNumberFormat", "Zonal Map Number Format", true},
+    tag_info{dicom_tag{0x0028, 0x0721}, vr(VR::AT), vm_1_n, "ZonalMapLocation", "Zonal Map Location", true},
+    tag_info{dicom_tag{0x0028, 0x0722}, vr(VR::US), vm_1, "ZonalMapFormat", "Zonal Map Format", true},
+    tag_info{dicom_tag{0x0028, 0x0730}, vr(VR::US), vm_1, "AdaptiveMapFormat", "Adaptive Map Format", true},
+    tag_info{dicom_tag{0x0028, 0x0740}, vr(VR::US), vm_1, "CodeNumberFormat", "Code Number Format", true},
+    tag_info{dicom_tag{0x0028, 0x0800}, vr(VR::CS), vm_1_n, "CodeLabel", "Code Label", true},  // (0028,08x0)
+    tag_info{dicom_tag{0x0028, 0x0802}, vr(VR::US), vm_1, "NumberOfTables", "Number of Tables", true},  // (0028,08x2)
+    tag_info{dicom_tag{0x0028, 0x0803}, vr(VR::AT), vm_1_n, "CodeTableLocation", "Code Table Location", true},  // (0028,08x3)
+    tag_info{dicom_tag{0x0028, 0x0804}, vr(VR::US), vm_1, "BitsForCodeWord", "Bits For Code Word", true},  // (0028,08x4)
+    tag_info{dicom_tag{0x0028, 0x0808}, vr(VR::AT), vm_1_n, "ImageDataLocation", "Image Data Location", true},  // (0028,08x8)
+    tag_info{dicom_tag{0x0028, 0x0A02}, vr(VR::CS), vm_1, "PixelSpacingCalibrationType", "Pixel Spacing Calibration Type", false},
+    tag_info{dicom_tag{0x0028, 0x0A04}, vr(VR::LO), vm_1, "PixelSpacingCalibrationDescription", "Pixel Spacing Calibration Description", false},
+    tag_info{dicom_tag{0x0028, 0x1040}, vr(VR::CS), vm_1, "PixelIntensityRelationship", "Pixel Intensity Relationship", false},
+    tag_info{dicom_tag{0x0028, 0x1041}, vr(VR::SS), vm_1, "PixelIntensityRelationshipSign", "Pixel Intensity Relationship Sign", false},
     tag_info{dicom_tag{0x0028, 0x1050}, vr(VR::DS), vm_1_n, "WindowCenter", "Window Center", false},
     tag_info{dicom_tag{0x0028, 0x1051}, vr(VR::DS), vm_1_n, "WindowWidth", "Window Width", false},
     tag_info{dicom_tag{0x0028, 0x1052}, vr(VR::DS), vm_1, "RescaleIntercept", "Rescale Intercept", false},
@@ -244,22 +2236,292 @@ static constexpr std::array<tag_info, 298> standard_tags = {{
     tag_info{dicom_tag{0x0028, 0x1054}, vr(VR::LO), vm_1, "RescaleType", "Rescale Type", false},
     tag_info{dicom_tag{0x0028, 0x1055}, vr(VR::LO), vm_1_n, "WindowCenterWidthExplanation", "Window Center & Width Explanation", false},
     tag_info{dicom_tag{0x0028, 0x1056}, vr(VR::CS), vm_1, "VOILUTFunction", "VOI LUT Function", false},
+    tag_info{dicom_tag{0x0028, 0x1080}, vr(VR::CS), vm_1, "GrayScale", "Gray Scale", true},
+    tag_info{dicom_tag{0x0028, 0x1090}, vr(VR::CS), vm_1, "RecommendedViewingMode", "Recommended Viewing Mode", false},
+    tag_info{dicom_tag{0x0028, 0x1100}, vr(VR::US), vm_3, "GrayLookupTableDescriptor", "Gray Lookup Table Descriptor", true},
     tag_info{dicom_tag{0x0028, 0x1101}, vr(VR::US), vm_3, "RedPaletteColorLookupTableDescriptor", "Red Palette Color Lookup Table Descriptor", false},
     tag_info{dicom_tag{0x0028, 0x1102}, vr(VR::US), vm_3, "GreenPaletteColorLookupTableDescriptor", "Green Palette Color Lookup Table Descriptor", false},
     tag_info{dicom_tag{0x0028, 0x1103}, vr(VR::US), vm_3, "BluePaletteColorLookupTableDescriptor", "Blue Palette Color Lookup Table Descriptor", false},
+    tag_info{dicom_tag{0x0028, 0x1104}, vr(VR::US), vm_3, "AlphaPaletteColorLookupTableDescriptor", "Alpha Palette Color Lookup Table Descriptor", false},
+    tag_info{dicom_tag{0x0028, 0x1111}, vr(VR::US), vm_4, "LargeRedPaletteColorLookupTableDescriptor", "Large Red Palette Color Lookup Table Descriptor", true},
+    tag_info{dicom_tag{0x0028, 0x1112}, vr(VR::US), vm_4, "LargeGreenPaletteColorLookupTableDescriptor", "Large Green Palette Color Lookup Table Descriptor", true},
+    tag_info{dicom_tag{0x0028, 0x1113}, vr(VR::US), vm_4, "LargeBluePaletteColorLookupTableDescriptor", "Large Blue Palette Color Lookup Table Descriptor", true},
     tag_info{dicom_tag{0x0028, 0x1199}, vr(VR::UI), vm_1, "PaletteColorLookupTableUID", "Palette Color Lookup Table UID", false},
+    tag_info{dicom_tag{0x0028, 0x1200}, vr(VR::US), vm_1_n, "GrayLookupTableData", "Gray Lookup Table Data", true},
     tag_info{dicom_tag{0x0028, 0x1201}, vr(VR::OW), vm_1, "RedPaletteColorLookupTableData", "Red Palette Color Lookup Table Data", false},
     tag_info{dicom_tag{0x0028, 0x1202}, vr(VR::OW), vm_1, "GreenPaletteColorLookupTableData", "Green Palette Color Lookup Table Data", false},
     tag_info{dicom_tag{0x0028, 0x1203}, vr(VR::OW), vm_1, "BluePaletteColorLookupTableData", "Blue Palette Color Lookup Table Data", false},
+    tag_info{dicom_tag{0x0028, 0x1204}, vr(VR::OW), vm_1, "AlphaPaletteColorLookupTableData", "Alpha Palette Color Lookup Table Data", false},
+    tag_info{dicom_tag{0x0028, 0x1211}, vr(VR::OW), vm_1, "LargeRedPaletteColorLookupTableData", "Large Red Palette Color Lookup Table Data", true},
+    tag_info{dicom_tag{0x0028, 0x1212}, vr(VR::OW), vm_1, "LargeGreenPaletteColorLookupTableData", "Large Green Palette Color Lookup Table Data", true},
+    tag_info{dicom_tag{0x0028, 0x1213}, vr(VR::OW), vm_1, "LargeBluePaletteColorLookupTableData", "Large Blue Palette Color Lookup Table Data", true},
+    tag_info{dicom_tag{0x0028, 0x1214}, vr(VR::UI), vm_1, "LargePaletteColorLookupTableUID", "Large Palette Color Lookup Table UID", true},
+    tag_info{dicom_tag{0x0028, 0x1221}, vr(VR::OW), vm_1, "SegmentedRedPaletteColorLookupTableData", "Segmented Red Palette Color Lookup Table Data", false},
+    tag_info{dicom_tag{0x0028, 0x1222}, vr(VR::OW), vm_1, "SegmentedGreenPaletteColorLookupTableData", "Segmented Green Palette Color Lookup Table Data", false},
+    tag_info{dicom_tag{0x0028, 0x1223}, vr(VR::OW), vm_1, "SegmentedBluePaletteColorLookupTableData", "Segmented Blue Palette Color Lookup Table Data", false},
+    tag_info{dicom_tag{0x0028, 0x1224}, vr(VR::OW), vm_1, "SegmentedAlphaPaletteColorLookupTableData", "Segmented Alpha Palette Color Lookup Table Data", false},
+    tag_info{dicom_tag{0x0028, 0x1230}, vr(VR::SQ), vm_1, "StoredValueColorRangeSequence", "Stored Value Color Range Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x1231}, vr(VR::FD), vm_1, "MinimumStoredValueMapped", "Minimum Stored Value Mapped", false},
+    tag_info{dicom_tag{0x0028, 0x1232}, vr(VR::FD), vm_1, "MaximumStoredValueMapped", "Maximum Stored Value Mapped", false},
+    tag_info{dicom_tag{0x0028, 0x1300}, vr(VR::CS), vm_1, "BreastImplantPresent", "Breast Implant Present", false},
+    tag_info{dicom_tag{0x0028, 0x1350}, vr(VR::CS), vm_1, "PartialView", "Partial View", false},
+    tag_info{dicom_tag{0x0028, 0x1351}, vr(VR::ST), vm_1, "PartialViewDescription", "Partial View Description", false},
+    tag_info{dicom_tag{0x0028, 0x1352}, vr(VR::SQ), vm_1, "PartialViewCodeSequence", "Partial View Code Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x135A}, vr(VR::CS), vm_1, "SpatialLocationsPreserved", "Spatial Locations Preserved", false},
+    tag_info{dicom_tag{0x0028, 0x1401}, vr(VR::SQ), vm_1, "DataFrameAssignmentSequence", "Data Frame Assignment Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x1402}, vr(VR::CS), vm_1, "DataPathAssignment", "Data Path Assignment", false},
+    tag_info{dicom_tag{0x0028, 0x1403}, vr(VR::US), vm_1, "BitsMappedToColorLookupTable", "Bits Mapped to Color Lookup Table", false},
+    tag_info{dicom_tag{0x0028, 0x1404}, vr(VR::SQ), vm_1, "BlendingLUT1Sequence", "Blending LUT 1 Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x1405}, vr(VR::CS), vm_1, "BlendingLUT1TransferFunction", "Blending LUT 1 Transfer Function", false},
+    tag_info{dicom_tag{0x0028, 0x1406}, vr(VR::FD), vm_1, "BlendingWeightConstant", "Blending Weight Constant", false},
+    tag_info{dicom_tag{0x0028, 0x1407}, vr(VR::US), vm_3, "BlendingLookupTableDescriptor", "Blending Lookup Table Descriptor", false},
+    tag_info{dicom_tag{0x0028, 0x1408}, vr(VR::OW), vm_1, "BlendingLookupTableData", "Blending Lookup Table Data", false},
+    tag_info{dicom_tag{0x0028, 0x140B}, vr(VR::SQ), vm_1, "EnhancedPaletteColorLookupTableSequence", "Enhanced Palette Color Lookup Table Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x140C}, vr(VR::SQ), vm_1, "BlendingLUT2Sequence", "Blending LUT 2 Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x140D}, vr(VR::CS), vm_1, "BlendingLUT2TransferFunction", "Blending LUT 2 Transfer Function", false},
+    tag_info{dicom_tag{0x0028, 0x140E}, vr(VR::CS), vm_1, "DataPathID", "Data Path ID", false},
+    tag_info{dicom_tag{0x0028, 0x140F}, vr(VR::CS), vm_1, "RGBLUTTransferFunction", "RGB LUT Transfer Function", false},
+    tag_info{dicom_tag{0x0028, 0x1410}, vr(VR::CS), vm_1, "AlphaLUTTransferFunction", "Alpha LUT Transfer Function", false},
+    tag_info{dicom_tag{0x0028, 0x2000}, vr(VR::OB), vm_1, "ICCProfile", "ICC Profile", false},
+    tag_info{dicom_tag{0x0028, 0x2002}, vr(VR::CS), vm_1, "ColorSpace", "Color Space", false},
     tag_info{dicom_tag{0x0028, 0x2110}, vr(VR::CS), vm_1, "LossyImageCompression", "Lossy Image Compression", false},
     tag_info{dicom_tag{0x0028, 0x2112}, vr(VR::DS), vm_1_n, "LossyImageCompressionRatio", "Lossy Image Compression Ratio", false},
     tag_info{dicom_tag{0x0028, 0x2114}, vr(VR::CS), vm_1_n, "LossyImageCompressionMethod", "Lossy Image Compression Method", false},
     tag_info{dicom_tag{0x0028, 0x3000}, vr(VR::SQ), vm_1, "ModalityLUTSequence", "Modality LUT Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x3001}, vr(VR::SQ), vm_1, "VariableModalityLUTSequence", "Variable Modality LUT Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x3002}, vr(VR::US), vm_3, "LUTDescriptor", "LUT Descriptor", false},
+    tag_info{dicom_tag{0x0028, 0x3003}, vr(VR::LO), vm_1, "LUTExplanation", "LUT Explanation", false},
+    tag_info{dicom_tag{0x0028, 0x3004}, vr(VR::LO), vm_1, "ModalityLUTType", "Modality LUT Type", false},
+    tag_info{dicom_tag{0x0028, 0x3006}, vr(VR::US), vm_1_n, "LUTData", "LUT Data", false},
     tag_info{dicom_tag{0x0028, 0x3010}, vr(VR::SQ), vm_1, "VOILUTSequence", "VOI LUT Sequence", false},
-
-    // ========================================================================
-    // Scheduled Procedure Step (0x0040)
-    // ========================================================================
+    tag_info{dicom_tag{0x0028, 0x3110}, vr(VR::SQ), vm_1, "SoftcopyVOILUTSequence", "Softcopy VOI LUT Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x4000}, vr(VR::LT), vm_1, "ImagePresentationComments", "Image Presentation Comments", true},
+    tag_info{dicom_tag{0x0028, 0x5000}, vr(VR::SQ), vm_1, "BiPlaneAcquisitionSequence", "Bi-Plane Acquisition Sequence", true},
+    tag_info{dicom_tag{0x0028, 0x6010}, vr(VR::US), vm_1, "RepresentativeFrameNumber", "Representative Frame Number", false},
+    tag_info{dicom_tag{0x0028, 0x6020}, vr(VR::US), vm_1_n, "FrameNumbersOfInterest", "Frame Numbers of Interest (FOI)", false},
+    tag_info{dicom_tag{0x0028, 0x6022}, vr(VR::LO), vm_1_n, "FrameOfInterestDescription", "Frame of Interest Description", false},
+    tag_info{dicom_tag{0x0028, 0x6023}, vr(VR::CS), vm_1_n, "FrameOfInterestType", "Frame of Interest Type", false},
+    tag_info{dicom_tag{0x0028, 0x6030}, vr(VR::US), vm_1_n, "MaskPointers", "Mask Pointer(s)", true},
+    tag_info{dicom_tag{0x0028, 0x6040}, vr(VR::US), vm_1_n, "RWavePointer", "R Wave Pointer", false},
+    tag_info{dicom_tag{0x0028, 0x6100}, vr(VR::SQ), vm_1, "MaskSubtractionSequence", "Mask Subtraction Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x6101}, vr(VR::CS), vm_1, "MaskOperation", "Mask Operation", false},
+    tag_info{dicom_tag{0x0028, 0x6102}, vr(VR::US), vm_2_2n, "ApplicableFrameRange", "Applicable Frame Range", false},
+    tag_info{dicom_tag{0x0028, 0x6110}, vr(VR::US), vm_1_n, "MaskFrameNumbers", "Mask Frame Numbers", false},
+    tag_info{dicom_tag{0x0028, 0x6112}, vr(VR::US), vm_1, "ContrastFrameAveraging", "Contrast Frame Averaging", false},
+    tag_info{dicom_tag{0x0028, 0x6114}, vr(VR::FL), vm_2, "MaskSubPixelShift", "Mask Sub-pixel Shift", false},
+    tag_info{dicom_tag{0x0028, 0x6120}, vr(VR::SS), vm_1, "TIDOffset", "TID Offset", false},
+    tag_info{dicom_tag{0x0028, 0x6190}, vr(VR::ST), vm_1, "MaskOperationExplanation", "Mask Operation Explanation", false},
+    tag_info{dicom_tag{0x0028, 0x7000}, vr(VR::SQ), vm_1, "EquipmentAdministratorSequence", "Equipment Administrator Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7001}, vr(VR::US), vm_1, "NumberOfDisplaySubsystems", "Number of Display Subsystems", false},
+    tag_info{dicom_tag{0x0028, 0x7002}, vr(VR::US), vm_1, "CurrentConfigurationID", "Current Configuration ID", false},
+    tag_info{dicom_tag{0x0028, 0x7003}, vr(VR::US), vm_1, "DisplaySubsystemID", "Display Subsystem ID", false},
+    tag_info{dicom_tag{0x0028, 0x7004}, vr(VR::SH), vm_1, "DisplaySubsystemName", "Display Subsystem Name", false},
+    tag_info{dicom_tag{0x0028, 0x7005}, vr(VR::LO), vm_1, "DisplaySubsystemDescription", "Display Subsystem Description", false},
+    tag_info{dicom_tag{0x0028, 0x7006}, vr(VR::CS), vm_1, "SystemStatus", "System Status", false},
+    tag_info{dicom_tag{0x0028, 0x7007}, vr(VR::LO), vm_1, "SystemStatusComment", "System Status Comment", false},
+    tag_info{dicom_tag{0x0028, 0x7008}, vr(VR::SQ), vm_1, "TargetLuminanceCharacteristicsSequence", "Target Luminance Characteristics Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7009}, vr(VR::US), vm_1, "LuminanceCharacteristicsID", "Luminance Characteristics ID", false},
+    tag_info{dicom_tag{0x0028, 0x700A}, vr(VR::SQ), vm_1, "DisplaySubsystemConfigurationSequence", "Display Subsystem Configuration Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x700B}, vr(VR::US), vm_1, "ConfigurationID", "Configuration ID", false},
+    tag_info{dicom_tag{0x0028, 0x700C}, vr(VR::SH), vm_1, "ConfigurationName", "Configuration Name", false},
+    tag_info{dicom_tag{0x0028, 0x700D}, vr(VR::LO), vm_1, "ConfigurationDescription", "Configuration Description", false},
+    tag_info{dicom_tag{0x0028, 0x700E}, vr(VR::US), vm_1, "ReferencedTargetLuminanceCharacteristicsID", "Referenced Target Luminance Characteristics ID", false},
+    tag_info{dicom_tag{0x0028, 0x700F}, vr(VR::SQ), vm_1, "QAResultsSequence", "QA Results Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7010}, vr(VR::SQ), vm_1, "DisplaySubsystemQAResultsSequence", "Display Subsystem QA Results Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7011}, vr(VR::SQ), vm_1, "ConfigurationQAResultsSequence", "Configuration QA Results Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7012}, vr(VR::SQ), vm_1, "MeasurementEquipmentSequence", "Measurement Equipment Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7013}, vr(VR::CS), vm_1_n, "MeasurementFunctions", "Measurement Functions", false},
+    tag_info{dicom_tag{0x0028, 0x7014}, vr(VR::CS), vm_1, "MeasurementEquipmentType", "Measurement Equipment Type", false},
+    tag_info{dicom_tag{0x0028, 0x7015}, vr(VR::SQ), vm_1, "VisualEvaluationResultSequence", "Visual Evaluation Result Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7016}, vr(VR::SQ), vm_1, "DisplayCalibrationResultSequence", "Display Calibration Result Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7017}, vr(VR::US), vm_1, "DDLValue", "DDL Value", false},
+    tag_info{dicom_tag{0x0028, 0x7018}, vr(VR::FL), vm_2, "CIExyWhitePoint", "CIExy White Point", false},
+    tag_info{dicom_tag{0x0028, 0x7019}, vr(VR::CS), vm_1, "DisplayFunctionType", "Display Function Type", false},
+    tag_info{dicom_tag{0x0028, 0x701A}, vr(VR::FL), vm_1, "GammaValue", "Gamma Value", false},
+    tag_info{dicom_tag{0x0028, 0x701B}, vr(VR::US), vm_1, "NumberOfLuminancePoints", "Number of Luminance Points", false},
+    tag_info{dicom_tag{0x0028, 0x701C}, vr(VR::SQ), vm_1, "LuminanceResponseSequence", "Luminance Response Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x701D}, vr(VR::FL), vm_1, "TargetMinimumLuminance", "Target Minimum Luminance", false},
+    tag_info{dicom_tag{0x0028, 0x701E}, vr(VR::FL), vm_1, "TargetMaximumLuminance", "Target Maximum Luminance", false},
+    tag_info{dicom_tag{0x0028, 0x701F}, vr(VR::FL), vm_1, "LuminanceValue", "Luminance Value", false},
+    tag_info{dicom_tag{0x0028, 0x7020}, vr(VR::LO), vm_1, "LuminanceResponseDescription", "Luminance Response Description", false},
+    tag_info{dicom_tag{0x0028, 0x7021}, vr(VR::CS), vm_1, "WhitePointFlag", "White Point Flag", false},
+    tag_info{dicom_tag{0x0028, 0x7022}, vr(VR::SQ), vm_1, "DisplayDeviceTypeCodeSequence", "Display Device Type Code Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7023}, vr(VR::SQ), vm_1, "DisplaySubsystemSequence", "Display Subsystem Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7024}, vr(VR::SQ), vm_1, "LuminanceResultSequence", "Luminance Result Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7025}, vr(VR::CS), vm_1, "AmbientLightValueSource", "Ambient Light Value Source", false},
+    tag_info{dicom_tag{0x0028, 0x7026}, vr(VR::CS), vm_1_n, "MeasuredCharacteristics", "Measured Characteristics", false},
+    tag_info{dicom_tag{0x0028, 0x7027}, vr(VR::SQ), vm_1, "LuminanceUniformityResultSequence", "Luminance Uniformity Result Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7028}, vr(VR::SQ), vm_1, "VisualEvaluationTestSequence", "Visual Evaluation Test Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7029}, vr(VR::CS), vm_1, "TestResult", "Test Result", false},
+    tag_info{dicom_tag{0x0028, 0x702A}, vr(VR::LO), vm_1, "TestResultComment", "Test Result Comment", false},
+    tag_info{dicom_tag{0x0028, 0x702B}, vr(VR::CS), vm_1, "TestImageValidation", "Test Image Validation", false},
+    tag_info{dicom_tag{0x0028, 0x702C}, vr(VR::SQ), vm_1, "TestPatternCodeSequence", "Test Pattern Code Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x702D}, vr(VR::SQ), vm_1, "MeasurementPatternCodeSequence", "Measurement Pattern Code Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x702E}, vr(VR::SQ), vm_1, "VisualEvaluationMethodCodeSequence", "Visual Evaluation Method Code Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x7FE0}, vr(VR::UR), vm_1, "PixelDataProviderURL", "Pixel Data Provider URL", false},
+    tag_info{dicom_tag{0x0028, 0x9001}, vr(VR::UL), vm_1, "DataPointRows", "Data Point Rows", false},
+    tag_info{dicom_tag{0x0028, 0x9002}, vr(VR::UL), vm_1, "DataPointColumns", "Data Point Columns", false},
+    tag_info{dicom_tag{0x0028, 0x9003}, vr(VR::CS), vm_1, "SignalDomainColumns", "Signal Domain Columns", false},
+    tag_info{dicom_tag{0x0028, 0x9099}, vr(VR::US), vm_1, "LargestMonochromePixelValue", "Largest Monochrome Pixel Value", true},
+    tag_info{dicom_tag{0x0028, 0x9108}, vr(VR::CS), vm_1, "DataRepresentation", "Data Representation", false},
+    tag_info{dicom_tag{0x0028, 0x9110}, vr(VR::SQ), vm_1, "PixelMeasuresSequence", "Pixel Measures Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x9132}, vr(VR::SQ), vm_1, "FrameVOILUTSequence", "Frame VOI LUT Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x9145}, vr(VR::SQ), vm_1, "PixelValueTransformationSequence", "Pixel Value Transformation Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x9235}, vr(VR::CS), vm_1, "SignalDomainRows", "Signal Domain Rows", false},
+    tag_info{dicom_tag{0x0028, 0x9411}, vr(VR::FL), vm_1, "DisplayFilterPercentage", "Display Filter Percentage", false},
+    tag_info{dicom_tag{0x0028, 0x9415}, vr(VR::SQ), vm_1, "FramePixelShiftSequence", "Frame Pixel Shift Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x9416}, vr(VR::US), vm_1, "SubtractionItemID", "Subtraction Item ID", false},
+    tag_info{dicom_tag{0x0028, 0x9422}, vr(VR::SQ), vm_1, "PixelIntensityRelationshipLUTSequence", "Pixel Intensity Relationship LUT Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x9443}, vr(VR::SQ), vm_1, "FramePixelDataPropertiesSequence", "Frame Pixel Data Properties Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x9444}, vr(VR::CS), vm_1, "GeometricalProperties", "Geometrical Properties", false},
+    tag_info{dicom_tag{0x0028, 0x9445}, vr(VR::FL), vm_1, "GeometricMaximumDistortion", "Geometric Maximum Distortion", false},
+    tag_info{dicom_tag{0x0028, 0x9446}, vr(VR::CS), vm_1_n, "ImageProcessingApplied", "Image Processing Applied", false},
+    tag_info{dicom_tag{0x0028, 0x9454}, vr(VR::CS), vm_1, "MaskSelectionMode", "Mask Selection Mode", false},
+    tag_info{dicom_tag{0x0028, 0x9474}, vr(VR::CS), vm_1, "LUTFunction", "LUT Function", false},
+    tag_info{dicom_tag{0x0028, 0x9478}, vr(VR::FL), vm_1, "MaskVisibilityPercentage", "Mask Visibility Percentage", false},
+    tag_info{dicom_tag{0x0028, 0x9501}, vr(VR::SQ), vm_1, "PixelShiftSequence", "Pixel Shift Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x9502}, vr(VR::SQ), vm_1, "RegionPixelShiftSequence", "Region Pixel Shift Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x9503}, vr(VR::SS), vm_2_2n, "VerticesOfTheRegion", "Vertices of the Region", false},
+    tag_info{dicom_tag{0x0028, 0x9505}, vr(VR::SQ), vm_1, "MultiFramePresentationSequence", "Multi-frame Presentation Sequence", false},
+    tag_info{dicom_tag{0x0028, 0x9506}, vr(VR::US), vm_2_2n, "PixelShiftFrameRange", "Pixel Shift Frame Range", false},
+    tag_info{dicom_tag{0x0028, 0x9507}, vr(VR::US), vm_2_2n, "LUTFrameRange", "LUT Frame Range", false},
+    tag_info{dicom_tag{0x0028, 0x9520}, vr(VR::DS), vm_16, "ImageToEquipmentMappingMatrix", "Image to Equipment Mapping Matrix", false},
+    tag_info{dicom_tag{0x0028, 0x9537}, vr(VR::CS), vm_1, "EquipmentCoordinateSystemIdentification", "Equipment Coordinate System Identification", false},
+    tag_info{dicom_tag{0x0032, 0x000A}, vr(VR::CS), vm_1, "StudyStatusID", "Study Status ID", true},
+    tag_info{dicom_tag{0x0032, 0x000C}, vr(VR::CS), vm_1, "StudyPriorityID", "Study Priority ID", true},
+    tag_info{dicom_tag{0x0032, 0x0012}, vr(VR::LO), vm_1, "StudyIDIssuer", "Study ID Issuer", true},
+    tag_info{dicom_tag{0x0032, 0x0032}, vr(VR::DA), vm_1, "StudyVerifiedDate", "Study Verified Date", true},
+    tag_info{dicom_tag{0x0032, 0x0033}, vr(VR::TM), vm_1, "StudyVerifiedTime", "Study Verified Time", true},
+    tag_info{dicom_tag{0x0032, 0x0034}, vr(VR::DA), vm_1, "StudyReadDate", "Study Read Date", true},
+    tag_info{dicom_tag{0x0032, 0x0035}, vr(VR::TM), vm_1, "StudyReadTime", "Study Read Time", true},
+    tag_info{dicom_tag{0x0032, 0x1000}, vr(VR::DA), vm_1, "ScheduledStudyStartDate", "Scheduled Study Start Date", true},
+    tag_info{dicom_tag{0x0032, 0x1001}, vr(VR::TM), vm_1, "ScheduledStudyStartTime", "Scheduled Study Start Time", true},
+    tag_info{dicom_tag{0x0032, 0x1010}, vr(VR::DA), vm_1, "ScheduledStudyStopDate", "Scheduled Study Stop Date", true},
+    tag_info{dicom_tag{0x0032, 0x1011}, vr(VR::TM), vm_1, "ScheduledStudyStopTime", "Scheduled Study Stop Time", true},
+    tag_info{dicom_tag{0x0032, 0x1020}, vr(VR::LO), vm_1, "ScheduledStudyLocation", "Scheduled Study Location", true},
+    tag_info{dicom_tag{0x0032, 0x1021}, vr(VR::AE), vm_1_n, "ScheduledStudyLocationAETitle", "Scheduled Study Location AE Title", true},
+    tag_info{dicom_tag{0x0032, 0x1030}, vr(VR::LO), vm_1, "ReasonForStudy", "Reason for Study", true},
+    tag_info{dicom_tag{0x0032, 0x1031}, vr(VR::SQ), vm_1, "RequestingPhysicianIdentificationSequence", "Requesting Physician Identification Sequence", false},
+    tag_info{dicom_tag{0x0032, 0x1032}, vr(VR::PN), vm_1, "RequestingPhysician", "Requesting Physician", false},
+    tag_info{dicom_tag{0x0032, 0x1033}, vr(VR::LO), vm_1, "RequestingService", "Requesting Service", false},
+    tag_info{dicom_tag{0x0032, 0x1034}, vr(VR::SQ), vm_1, "RequestingServiceCodeSequence", "Requesting Service Code Sequence", false},
+    tag_info{dicom_tag{0x0032, 0x1040}, vr(VR::DA), vm_1, "StudyArrivalDate", "Study Arrival Date", true},
+    tag_info{dicom_tag{0x0032, 0x1041}, vr(VR::TM), vm_1, "StudyArrivalTime", "Study Arrival Time", true},
+    tag_info{dicom_tag{0x0032, 0x1050}, vr(VR::DA), vm_1, "StudyCompletionDate", "Study Completion Date", true},
+    tag_info{dicom_tag{0x0032, 0x1051}, vr(VR::TM), vm_1, "StudyCompletionTime", "Study Completion Time", true},
+    tag_info{dicom_tag{0x0032, 0x1055}, vr(VR::CS), vm_1, "StudyComponentStatusID", "Study Component Status ID", true},
+    tag_info{dicom_tag{0x0032, 0x1060}, vr(VR::LO), vm_1, "RequestedProcedureDescription", "Requested Procedure Description", false},
+    tag_info{dicom_tag{0x0032, 0x1064}, vr(VR::SQ), vm_1, "RequestedProcedureCodeSequence", "Requested Procedure Code Sequence", false},
+    tag_info{dicom_tag{0x0032, 0x1065}, vr(VR::SQ), vm_1, "RequestedLateralityCodeSequence", "Requested Laterality Code Sequence", false},
+    tag_info{dicom_tag{0x0032, 0x1066}, vr(VR::UT), vm_1, "ReasonForVisit", "Reason for Visit", false},
+    tag_info{dicom_tag{0x0032, 0x1067}, vr(VR::SQ), vm_1, "ReasonForVisitCodeSequence", "Reason for Visit Code Sequence", false},
+    tag_info{dicom_tag{0x0032, 0x1070}, vr(VR::LO), vm_1, "RequestedContrastAgent", "Requested Contrast Agent", false},
+    tag_info{dicom_tag{0x0032, 0x4000}, vr(VR::LT), vm_1, "StudyComments", "Study Comments", true},
+    tag_info{dicom_tag{0x0034, 0x0001}, vr(VR::SQ), vm_1, "FlowIdentifierSequence", "Flow Identifier Sequence", false},
+    tag_info{dicom_tag{0x0034, 0x0002}, vr(VR::OB), vm_1, "FlowIdentifier", "Flow Identifier", false},
+    tag_info{dicom_tag{0x0034, 0x0003}, vr(VR::UI), vm_1, "FlowTransferSyntaxUID", "Flow Transfer Syntax UID", false},
+    tag_info{dicom_tag{0x0034, 0x0004}, vr(VR::UL), vm_1, "FlowRTPSamplingRate", "Flow RTP Sampling Rate", false},
+    tag_info{dicom_tag{0x0034, 0x0005}, vr(VR::OB), vm_1, "SourceIdentifier", "Source Identifier", false},
+    tag_info{dicom_tag{0x0034, 0x0007}, vr(VR::OB), vm_1, "FrameOriginTimestamp", "Frame Origin Timestamp", false},
+    tag_info{dicom_tag{0x0034, 0x0008}, vr(VR::CS), vm_1, "IncludesImagingSubject", "Includes Imaging Subject", false},
+    tag_info{dicom_tag{0x0034, 0x0009}, vr(VR::SQ), vm_1, "FrameUsefulnessGroupSequence", "Frame Usefulness Group Sequence", false},
+    tag_info{dicom_tag{0x0034, 0x000A}, vr(VR::SQ), vm_1, "RealTimeBulkDataFlowSequence", "Real-Time Bulk Data Flow Sequence", false},
+    tag_info{dicom_tag{0x0034, 0x000B}, vr(VR::SQ), vm_1, "CameraPositionGroupSequence", "Camera Position Group Sequence", false},
+    tag_info{dicom_tag{0x0034, 0x000C}, vr(VR::CS), vm_1, "IncludesInformation", "Includes Information", false},
+    tag_info{dicom_tag{0x0034, 0x000D}, vr(VR::SQ), vm_1, "TimeOfFrameGroupSequence", "Time of Frame Group Sequence", false},
+    tag_info{dicom_tag{0x0038, 0x0004}, vr(VR::SQ), vm_1, "ReferencedPatientAliasSequence", "Referenced Patient Alias Sequence", true},
+    tag_info{dicom_tag{0x0038, 0x0008}, vr(VR::CS), vm_1, "VisitStatusID", "Visit Status ID", false},
+    tag_info{dicom_tag{0x0038, 0x0010}, vr(VR::LO), vm_1, "AdmissionID", "Admission ID", false},
+    tag_info{dicom_tag{0x0038, 0x0011}, vr(VR::LO), vm_1, "IssuerOfAdmissionID", "Issuer of Admission ID", true},
+    tag_info{dicom_tag{0x0038, 0x0014}, vr(VR::SQ), vm_1, "IssuerOfAdmissionIDSequence", "Issuer of Admission ID Sequence", false},
+    tag_info{dicom_tag{0x0038, 0x0016}, vr(VR::LO), vm_1, "RouteOfAdmissions", "Route of Admissions", false},
+    tag_info{dicom_tag{0x0038, 0x001A}, vr(VR::DA), vm_1, "ScheduledAdmissionDate", "Scheduled Admission Date", true},
+    tag_info{dicom_tag{0x0038, 0x001B}, vr(VR::TM), vm_1, "ScheduledAdmissionTime", "Scheduled Admission Time", true},
+    tag_info{dicom_tag{0x0038, 0x001C}, vr(VR::DA), vm_1, "ScheduledDischargeDate", "Scheduled Discharge Date", true},
+    tag_info{dicom_tag{0x0038, 0x001D}, vr(VR::TM), vm_1, "ScheduledDischargeTime", "Scheduled Discharge Time", true},
+    tag_info{dicom_tag{0x0038, 0x001E}, vr(VR::LO), vm_1, "ScheduledPatientInstitutionResidence", "Scheduled Patient Institution Residence", true},
+    tag_info{dicom_tag{0x0038, 0x0020}, vr(VR::DA), vm_1, "AdmittingDate", "Admitting Date", false},
+    tag_info{dicom_tag{0x0038, 0x0021}, vr(VR::TM), vm_1, "AdmittingTime", "Admitting Time", false},
+    tag_info{dicom_tag{0x0038, 0x0030}, vr(VR::DA), vm_1, "DischargeDate", "Discharge Date", true},
+    tag_info{dicom_tag{0x0038, 0x0032}, vr(VR::TM), vm_1, "DischargeTime", "Discharge Time", true},
+    tag_info{dicom_tag{0x0038, 0x0040}, vr(VR::LO), vm_1, "DischargeDiagnosisDescription", "Discharge Diagnosis Description", true},
+    tag_info{dicom_tag{0x0038, 0x0044}, vr(VR::SQ), vm_1, "DischargeDiagnosisCodeSequence", "Discharge Diagnosis Code Sequence", true},
+    tag_info{dicom_tag{0x0038, 0x0050}, vr(VR::LO), vm_1, "SpecialNeeds", "Special Needs", false},
+    tag_info{dicom_tag{0x0038, 0x0060}, vr(VR::LO), vm_1, "ServiceEpisodeID", "Service Episode ID", false},
+    tag_info{dicom_tag{0x0038, 0x0061}, vr(VR::LO), vm_1, "IssuerOfServiceEpisodeID", "Issuer of Service Episode ID", true},
+    tag_info{dicom_tag{0x0038, 0x0062}, vr(VR::LO), vm_1, "ServiceEpisodeDescription", "Service Episode Description", false},
+    tag_info{dicom_tag{0x0038, 0x0064}, vr(VR::SQ), vm_1, "IssuerOfServiceEpisodeIDSequence", "Issuer of Service Episode ID Sequence", false},
+    tag_info{dicom_tag{0x0038, 0x0100}, vr(VR::SQ), vm_1, "PertinentDocumentsSequence", "Pertinent Documents Sequence", false},
+    tag_info{dicom_tag{0x0038, 0x0101}, vr(VR::SQ), vm_1, "PertinentResourcesSequence", "Pertinent Resources Sequence", false},
+    tag_info{dicom_tag{0x0038, 0x0102}, vr(VR::LO), vm_1, "ResourceDescription", "Resource Description", false},
+    tag_info{dicom_tag{0x0038, 0x0300}, vr(VR::LO), vm_1, "CurrentPatientLocation", "Current Patient Location", false},
+    tag_info{dicom_tag{0x0038, 0x0400}, vr(VR::LO), vm_1, "PatientInstitutionResidence", "Patient's Institution Residence", false},
+    tag_info{dicom_tag{0x0038, 0x0500}, vr(VR::LO), vm_1, "PatientState", "Patient State", false},
+    tag_info{dicom_tag{0x0038, 0x0502}, vr(VR::SQ), vm_1, "PatientClinicalTrialParticipationSequence", "Patient Clinical Trial Participation Sequence", false},
+    tag_info{dicom_tag{0x0038, 0x4000}, vr(VR::LT), vm_1, "VisitComments", "Visit Comments", false},
+    tag_info{dicom_tag{0x003A, 0x0004}, vr(VR::CS), vm_1, "WaveformOriginality", "Waveform Originality", false},
+    tag_info{dicom_tag{0x003A, 0x0005}, vr(VR::US), vm_1, "NumberOfWaveformChannels", "Number of Waveform Channels", false},
+    tag_info{dicom_tag{0x003A, 0x0010}, vr(VR::UL), vm_1, "NumberOfWaveformSamples", "Number of Waveform Samples", false},
+    tag_info{dicom_tag{0x003A, 0x001A}, vr(VR::DS), vm_1, "SamplingFrequency", "Sampling Frequency", false},
+    tag_info{dicom_tag{0x003A, 0x0020}, vr(VR::SH), vm_1, "MultiplexGroupLabel", "Multiplex Group Label", false},
+    tag_info{dicom_tag{0x003A, 0x0200}, vr(VR::SQ), vm_1, "ChannelDefinitionSequence", "Channel Definition Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0202}, vr(VR::IS), vm_1, "WaveformChannelNumber", "Waveform Channel Number", false},
+    tag_info{dicom_tag{0x003A, 0x0203}, vr(VR::SH), vm_1, "ChannelLabel", "Channel Label", false},
+    tag_info{dicom_tag{0x003A, 0x0205}, vr(VR::CS), vm_1_n, "ChannelStatus", "Channel Status", false},
+    tag_info{dicom_tag{0x003A, 0x0208}, vr(VR::SQ), vm_1, "ChannelSourceSequence", "Channel Source Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0209}, vr(VR::SQ), vm_1, "ChannelSourceModifiersSequence", "Channel Source Modifiers Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x020A}, vr(VR::SQ), vm_1, "SourceWaveformSequence", "Source Waveform Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x020C}, vr(VR::LO), vm_1, "ChannelDerivationDescription", "Channel Derivation Description", false},
+    tag_info{dicom_tag{0x003A, 0x0210}, vr(VR::DS), vm_1, "ChannelSensitivity", "Channel Sensitivity", false},
+    tag_info{dicom_tag{0x003A, 0x0211}, vr(VR::SQ), vm_1, "ChannelSensitivityUnitsSequence", "Channel Sensitivity Units Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0212}, vr(VR::DS), vm_1, "ChannelSensitivityCorrectionFactor", "Channel Sensitivity Correction Factor", false},
+    tag_info{dicom_tag{0x003A, 0x0213}, vr(VR::DS), vm_1, "ChannelBaseline", "Channel Baseline", false},
+    tag_info{dicom_tag{0x003A, 0x0214}, vr(VR::DS), vm_1, "ChannelTimeSkew", "Channel Time Skew", false},
+    tag_info{dicom_tag{0x003A, 0x0215}, vr(VR::DS), vm_1, "ChannelSampleSkew", "Channel Sample Skew", false},
+    tag_info{dicom_tag{0x003A, 0x0218}, vr(VR::DS), vm_1, "ChannelOffset", "Channel Offset", false},
+    tag_info{dicom_tag{0x003A, 0x021A}, vr(VR::US), vm_1, "WaveformBitsStored", "Waveform Bits Stored", false},
+    tag_info{dicom_tag{0x003A, 0x0220}, vr(VR::DS), vm_1, "FilterLowFrequency", "Filter Low Frequency", false},
+    tag_info{dicom_tag{0x003A, 0x0221}, vr(VR::DS), vm_1, "FilterHighFrequency", "Filter High Frequency", false},
+    tag_info{dicom_tag{0x003A, 0x0222}, vr(VR::DS), vm_1, "NotchFilterFrequency", "Notch Filter Frequency", false},
+    tag_info{dicom_tag{0x003A, 0x0223}, vr(VR::DS), vm_1, "NotchFilterBandwidth", "Notch Filter Bandwidth", false},
+    tag_info{dicom_tag{0x003A, 0x0230}, vr(VR::FL), vm_1, "WaveformDataDisplayScale", "Waveform Data Display Scale", false},
+    tag_info{dicom_tag{0x003A, 0x0231}, vr(VR::US), vm_3, "WaveformDisplayBackgroundCIELabValue", "Waveform Display Background CIELab Value", false},
+    tag_info{dicom_tag{0x003A, 0x0240}, vr(VR::SQ), vm_1, "WaveformPresentationGroupSequence", "Waveform Presentation Group Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0241}, vr(VR::US), vm_1, "PresentationGroupNumber", "Presentation Group Number", false},
+    tag_info{dicom_tag{0x003A, 0x0242}, vr(VR::SQ), vm_1, "ChannelDisplaySequence", "Channel Display Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0244}, vr(VR::US), vm_3, "ChannelRecommendedDisplayCIELabValue", "Channel Recommended Display CIELab Value", false},
+    tag_info{dicom_tag{0x003A, 0x0245}, vr(VR::FL), vm_1, "ChannelPosition", "Channel Position", false},
+    tag_info{dicom_tag{0x003A, 0x0246}, vr(VR::CS), vm_1, "DisplayShadingFlag", "Display Shading Flag", false},
+    tag_info{dicom_tag{0x003A, 0x0247}, vr(VR::FL), vm_1, "FractionalChannelDisplayScale", "Fractional Channel Display Scale", false},
+    tag_info{dicom_tag{0x003A, 0x0248}, vr(VR::FL), vm_1, "AbsoluteChannelDisplayScale", "Absolute Channel Display Scale", false},
+    tag_info{dicom_tag{0x003A, 0x0300}, vr(VR::SQ), vm_1, "MultiplexedAudioChannelsDescriptionCodeSequence", "Multiplexed Audio Channels Description Code Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0301}, vr(VR::IS), vm_1, "ChannelIdentificationCode", "Channel Identification Code", false},
+    tag_info{dicom_tag{0x003A, 0x0302}, vr(VR::CS), vm_1, "ChannelMode", "Channel Mode", false},
+    tag_info{dicom_tag{0x003A, 0x0310}, vr(VR::UI), vm_1, "MultiplexGroupUID", "Multiplex Group UID", false},
+    tag_info{dicom_tag{0x003A, 0x0311}, vr(VR::DS), vm_1, "PowerlineFrequency", "Powerline Frequency", false},
+    tag_info{dicom_tag{0x003A, 0x0312}, vr(VR::SQ), vm_1, "ChannelImpedanceSequence", "Channel Impedance Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0313}, vr(VR::DS), vm_1, "ImpedanceValue", "Impedance Value", false},
+    tag_info{dicom_tag{0x003A, 0x0314}, vr(VR::DT), vm_1, "ImpedanceMeasurementDateTime", "Impedance Measurement DateTime", false},
+    tag_info{dicom_tag{0x003A, 0x0315}, vr(VR::DS), vm_1, "ImpedanceMeasurementFrequency", "Impedance Measurement Frequency", false},
+    tag_info{dicom_tag{0x003A, 0x0316}, vr(VR::CS), vm_1, "ImpedanceMeasurementCurrentType", "Impedance Measurement Current Type", false},
+    tag_info{dicom_tag{0x003A, 0x0317}, vr(VR::CS), vm_1, "WaveformAmplifierType", "Waveform Amplifier Type", false},
+    tag_info{dicom_tag{0x003A, 0x0318}, vr(VR::SQ), vm_1, "FilterLowFrequencyCharacteristicsSequence", "Filter Low Frequency Characteristics Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0319}, vr(VR::SQ), vm_1, "FilterHighFrequencyCharacteristicsSequence", "Filter High Frequency Characteristics Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0320}, vr(VR::SQ), vm_1, "SummarizedFilterLookupTable", "Summarized Filter Lookup Table Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0321}, vr(VR::SQ), vm_1, "NotchFilterCharacteristicsSequence", "Notch Filter Characteristics Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0322}, vr(VR::CS), vm_1, "WaveformFilterType", "Waveform Filter Type", false},
+    tag_info{dicom_tag{0x003A, 0x0323}, vr(VR::SQ), vm_1, "AnalogFilterCharacteristicsSequence", "Analog Filter Characteristics Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0324}, vr(VR::DS), vm_1, "AnalogFilterRollOff", "Analog Filter Roll Off", false},
+    tag_info{dicom_tag{0x003A, 0x0325}, vr(VR::SQ), vm_1, "AnalogFilterType", "Analog Filter Type Code Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0326}, vr(VR::SQ), vm_1, "DigitalFilterCharacteristicsSequence", "Digital Filter Characteristics Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0327}, vr(VR::IS), vm_1, "DigitalFilterOrder", "Digital Filter Order", false},
+    tag_info{dicom_tag{0x003A, 0x0328}, vr(VR::SQ), vm_1, "DigitalFilterTypeCodeSequence", "Digital Filter Type Code Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x0329}, vr(VR::ST), vm_1, "WaveformFilterDescription", "Waveform Filter Description", false},
+    tag_info{dicom_tag{0x003A, 0x032A}, vr(VR::SQ), vm_1, "FilterLookupTableSequence", "Filter Lookup Table Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x032B}, vr(VR::ST), vm_1, "FilterLookupTableDescription", "Filter Lookup Table Description", false},
+    tag_info{dicom_tag{0x003A, 0x032C}, vr(VR::SQ), vm_1, "FrequencyEncodingCodeSequence", "Frequency Encoding Code Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x032D}, vr(VR::SQ), vm_1, "MagnitudeEncodingCodeSequence", "Magnitude Encoding Code Sequence", false},
+    tag_info{dicom_tag{0x003A, 0x032E}, vr(VR::OD), vm_1, "FilterLookupTableData", "Filter Lookup Table Data", false},
     tag_info{dicom_tag{0x0040, 0x0001}, vr(VR::AE), vm_1_n, "ScheduledStationAETitle", "Scheduled Station AE Title", false},
     tag_info{dicom_tag{0x0040, 0x0002}, vr(VR::DA), vm_1, "ScheduledProcedureStepStartDate", "Scheduled Procedure Step Start Date", false},
     tag_info{dicom_tag{0x0040, 0x0003}, vr(VR::TM), vm_1, "ScheduledProcedureStepStartTime", "Scheduled Procedure Step Start Time", false},
@@ -275,6 +2537,15 @@ static constexpr std::array<tag_info, 298> standard_tags = {{
     tag_info{dicom_tag{0x0040, 0x0011}, vr(VR::SH), vm_1, "ScheduledProcedureStepLocation", "Scheduled Procedure Step Location", false},
     tag_info{dicom_tag{0x0040, 0x0012}, vr(VR::LO), vm_1, "PreMedication", "Pre-Medication", false},
     tag_info{dicom_tag{0x0040, 0x0020}, vr(VR::CS), vm_1, "ScheduledProcedureStepStatus", "Scheduled Procedure Step Status", false},
+    tag_info{dicom_tag{0x0040, 0x0026}, vr(VR::SQ), vm_1, "OrderPlacerIdentifierSequence", "Order Placer Identifier Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0027}, vr(VR::SQ), vm_1, "OrderFillerIdentifierSequence", "Order Filler Identifier Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0031}, vr(VR::UT), vm_1, "LocalNamespaceEntityID", "Local Namespace Entity ID", false},
+    tag_info{dicom_tag{0x0040, 0x0032}, vr(VR::UT), vm_1, "UniversalEntityID", "Universal Entity ID", false},
+    tag_info{dicom_tag{0x0040, 0x0033}, vr(VR::CS), vm_1, "UniversalEntityIDType", "Universal Entity ID Type", false},
+    tag_info{dicom_tag{0x0040, 0x0035}, vr(VR::CS), vm_1, "IdentifierTypeCode", "Identifier Type Code", false},
+    tag_info{dicom_tag{0x0040, 0x0036}, vr(VR::SQ), vm_1, "AssigningFacilitySequence", "Assigning Facility Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0039}, vr(VR::SQ), vm_1, "AssigningJurisdictionCodeSequence", "Assigning Jurisdiction Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x003A}, vr(VR::SQ), vm_1, "AssigningAgencyOrDepartmentCodeSequence", "Assigning Agency or Department Code Sequence", false},
     tag_info{dicom_tag{0x0040, 0x0100}, vr(VR::SQ), vm_1, "ScheduledProcedureStepSequence", "Scheduled Procedure Step Sequence", false},
     tag_info{dicom_tag{0x0040, 0x0220}, vr(VR::SQ), vm_1, "ReferencedNonImageCompositeSOPInstanceSequence", "Referenced Non-Image Composite SOP Instance Sequence", false},
     tag_info{dicom_tag{0x0040, 0x0241}, vr(VR::AE), vm_1, "PerformedStationAETitle", "Performed Station AE Title", false},
@@ -289,102 +2560,4422 @@ static constexpr std::array<tag_info, 298> standard_tags = {{
     tag_info{dicom_tag{0x0040, 0x0254}, vr(VR::LO), vm_1, "PerformedProcedureStepDescription", "Performed Procedure Step Description", false},
     tag_info{dicom_tag{0x0040, 0x0255}, vr(VR::LO), vm_1, "PerformedProcedureTypeDescription", "Performed Procedure Type Description", false},
     tag_info{dicom_tag{0x0040, 0x0260}, vr(VR::SQ), vm_1, "PerformedProtocolCodeSequence", "Performed Protocol Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0261}, vr(VR::CS), vm_1, "PerformedProtocolType", "Performed Protocol Type", false},
     tag_info{dicom_tag{0x0040, 0x0270}, vr(VR::SQ), vm_1, "ScheduledStepAttributesSequence", "Scheduled Step Attributes Sequence", false},
     tag_info{dicom_tag{0x0040, 0x0275}, vr(VR::SQ), vm_1, "RequestAttributesSequence", "Request Attributes Sequence", false},
     tag_info{dicom_tag{0x0040, 0x0280}, vr(VR::ST), vm_1, "CommentsOnThePerformedProcedureStep", "Comments on the Performed Procedure Step", false},
+    tag_info{dicom_tag{0x0040, 0x0281}, vr(VR::SQ), vm_1, "PerformedProcedureStepDiscontinuationReasonCodeSequence", "Performed Procedure Step Discontinuation Reason Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0293}, vr(VR::SQ), vm_1, "QuantitySequence", "Quantity Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0294}, vr(VR::DS), vm_1, "Quantity", "Quantity", false},
+    tag_info{dicom_tag{0x0040, 0x0295}, vr(VR::SQ), vm_1, "MeasuringUnitsSequence", "Measuring Units Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0296}, vr(VR::SQ), vm_1, "BillingItemSequence", "Billing Item Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0300}, vr(VR::US), vm_1, "TotalTimeOfFluoroscopy", "Total Time of Fluoroscopy", true},
+    tag_info{dicom_tag{0x0040, 0x0301}, vr(VR::US), vm_1, "TotalNumberOfExposures", "Total Number of Exposures", true},
+    tag_info{dicom_tag{0x0040, 0x0302}, vr(VR::US), vm_1, "EntranceDose", "Entrance Dose", false},
+    tag_info{dicom_tag{0x0040, 0x0303}, vr(VR::US), vm_1_2, "ExposedArea", "Exposed Area", false},
+    tag_info{dicom_tag{0x0040, 0x0306}, vr(VR::DS), vm_1, "DistanceSourceToEntrance", "Distance Source to Entrance", false},
+    tag_info{dicom_tag{0x0040, 0x0307}, vr(VR::DS), vm_1, "DistanceSourceToSupport", "Distance Source to Support", true},
+    tag_info{dicom_tag{0x0040, 0x030E}, vr(VR::SQ), vm_1, "ExposureDoseSequence", "Exposure Dose Sequence", true},
+    tag_info{dicom_tag{0x0040, 0x0310}, vr(VR::ST), vm_1, "CommentsOnRadiationDose", "Comments on Radiation Dose", false},
+    tag_info{dicom_tag{0x0040, 0x0312}, vr(VR::DS), vm_1, "XRayOutput", "X-Ray Output", false},
+    tag_info{dicom_tag{0x0040, 0x0314}, vr(VR::DS), vm_1, "HalfValueLayer", "Half Value Layer", false},
+    tag_info{dicom_tag{0x0040, 0x0316}, vr(VR::DS), vm_1, "OrganDose", "Organ Dose", false},
+    tag_info{dicom_tag{0x0040, 0x0318}, vr(VR::CS), vm_1, "OrganExposed", "Organ Exposed", false},
+    tag_info{dicom_tag{0x0040, 0x0320}, vr(VR::SQ), vm_1, "BillingProcedureStepSequence", "Billing Procedure Step Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0321}, vr(VR::SQ), vm_1, "FilmConsumptionSequence", "Film Consumption Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0324}, vr(VR::SQ), vm_1, "BillingSuppliesAndDevicesSequence", "Billing Supplies and Devices Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0330}, vr(VR::SQ), vm_1, "ReferencedProcedureStepSequence", "Referenced Procedure Step Sequence", true},
     tag_info{dicom_tag{0x0040, 0x0340}, vr(VR::SQ), vm_1, "PerformedSeriesSequence", "Performed Series Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0400}, vr(VR::LT), vm_1, "CommentsOnTheScheduledProcedureStep", "Comments on the Scheduled Procedure Step", false},
+    tag_info{dicom_tag{0x0040, 0x0440}, vr(VR::SQ), vm_1, "ProtocolContextSequence", "Protocol Context Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0441}, vr(VR::SQ), vm_1, "ContentItemModifierSequence", "Content Item Modifier Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0500}, vr(VR::SQ), vm_1, "ScheduledSpecimenSequence", "Scheduled Specimen Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x050A}, vr(VR::LO), vm_1, "SpecimenAccessionNumber", "Specimen Accession Number", true},
+    tag_info{dicom_tag{0x0040, 0x0512}, vr(VR::LO), vm_1, "ContainerIdentifier", "Container Identifier", false},
+    tag_info{dicom_tag{0x0040, 0x0513}, vr(VR::SQ), vm_1, "IssuerOfTheContainerIdentifierSequence", "Issuer of the Container Identifier Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0515}, vr(VR::SQ), vm_1, "AlternateContainerIdentifierSequence", "Alternate Container Identifier Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0518}, vr(VR::SQ), vm_1, "ContainerTypeCodeSequence", "Container Type Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x051A}, vr(VR::LO), vm_1, "ContainerDescription", "Container Description", false},
+    tag_info{dicom_tag{0x0040, 0x0520}, vr(VR::SQ), vm_1, "ContainerComponentSequence", "Container Component Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0550}, vr(VR::SQ), vm_1, "SpecimenSequence", "Specimen Sequence", true},
+    tag_info{dicom_tag{0x0040, 0x0551}, vr(VR::LO), vm_1, "SpecimenIdentifier", "Specimen Identifier", false},
+    tag_info{dicom_tag{0x0040, 0x0552}, vr(VR::SQ), vm_1, "SpecimenDescriptionSequenceTrial", "Specimen Description Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0x0553}, vr(VR::ST), vm_1, "SpecimenDescriptionTrial", "Specimen Description (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0x0554}, vr(VR::UI), vm_1, "SpecimenUID", "Specimen UID", false},
+    tag_info{dicom_tag{0x0040, 0x0555}, vr(VR::SQ), vm_1, "AcquisitionContextSequence", "Acquisition Context Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0556}, vr(VR::ST), vm_1, "AcquisitionContextDescription", "Acquisition Context Description", false},
+    tag_info{dicom_tag{0x0040, 0x0560}, vr(VR::SQ), vm_1, "SpecimenDescriptionSequence", "Specimen Description Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0562}, vr(VR::SQ), vm_1, "IssuerOfTheSpecimenIdentifierSequence", "Issuer of the Specimen Identifier Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x059A}, vr(VR::SQ), vm_1, "SpecimenTypeCodeSequence", "Specimen Type Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0600}, vr(VR::LO), vm_1, "SpecimenShortDescription", "Specimen Short Description", false},
+    tag_info{dicom_tag{0x0040, 0x0602}, vr(VR::UT), vm_1, "SpecimenDetailedDescription", "Specimen Detailed Description", false},
+    tag_info{dicom_tag{0x0040, 0x0610}, vr(VR::SQ), vm_1, "SpecimenPreparationSequence", "Specimen Preparation Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0612}, vr(VR::SQ), vm_1, "SpecimenPreparationStepContentItemSequence", "Specimen Preparation Step Content Item Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x0620}, vr(VR::SQ), vm_1, "SpecimenLocalizationContentItemSequence", "Specimen Localization Content Item Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x06FA}, vr(VR::LO), vm_1, "SlideIdentifier", "Slide Identifier", true},
+    tag_info{dicom_tag{0x0040, 0x0710}, vr(VR::SQ), vm_1, "WholeSlideMicroscopyImageFrameTypeSequence", "Whole Slide Microscopy Image Frame Type Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x071A}, vr(VR::SQ), vm_1, "ImageCenterPointCoordinatesSequence", "Image Center Point Coordinates Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x072A}, vr(VR::DS), vm_1, "XOffsetInSlideCoordinateSystem", "X Offset in Slide Coordinate System", false},
+    tag_info{dicom_tag{0x0040, 0x073A}, vr(VR::DS), vm_1, "YOffsetInSlideCoordinateSystem", "Y Offset in Slide Coordinate System", false},
+    tag_info{dicom_tag{0x0040, 0x074A}, vr(VR::DS), vm_1, "ZOffsetInSlideCoordinateSystem", "Z Offset in Slide Coordinate System", false},
+    tag_info{dicom_tag{0x0040, 0x08D8}, vr(VR::SQ), vm_1, "PixelSpacingSequence", "Pixel Spacing Sequence", true},
+    tag_info{dicom_tag{0x0040, 0x08DA}, vr(VR::SQ), vm_1, "CoordinateSystemAxisCodeSequence", "Coordinate System Axis Code Sequence", true},
+    tag_info{dicom_tag{0x0040, 0x08EA}, vr(VR::SQ), vm_1, "MeasurementUnitsCodeSequence", "Measurement Units Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x09F8}, vr(VR::SQ), vm_1, "VitalStainCodeSequenceTrial", "Vital Stain Code Sequence (Trial)", true},
     tag_info{dicom_tag{0x0040, 0x1001}, vr(VR::SH), vm_1, "RequestedProcedureID", "Requested Procedure ID", false},
     tag_info{dicom_tag{0x0040, 0x1002}, vr(VR::LO), vm_1, "ReasonForTheRequestedProcedure", "Reason for the Requested Procedure", false},
     tag_info{dicom_tag{0x0040, 0x1003}, vr(VR::SH), vm_1, "RequestedProcedurePriority", "Requested Procedure Priority", false},
     tag_info{dicom_tag{0x0040, 0x1004}, vr(VR::LO), vm_1, "PatientTransportArrangements", "Patient Transport Arrangements", false},
     tag_info{dicom_tag{0x0040, 0x1005}, vr(VR::LO), vm_1, "RequestedProcedureLocation", "Requested Procedure Location", false},
+    tag_info{dicom_tag{0x0040, 0x1006}, vr(VR::SH), vm_1, "PlacerOrderNumberProcedure", "Placer Order Number / Procedure", true},
+    tag_info{dicom_tag{0x0040, 0x1007}, vr(VR::SH), vm_1, "FillerOrderNumberProcedure", "Filler Order Number / Procedure", true},
     tag_info{dicom_tag{0x0040, 0x1008}, vr(VR::LO), vm_1, "ConfidentialityCode", "Confidentiality Code", false},
     tag_info{dicom_tag{0x0040, 0x1009}, vr(VR::SH), vm_1, "ReportingPriority", "Reporting Priority", false},
     tag_info{dicom_tag{0x0040, 0x100A}, vr(VR::SQ), vm_1, "ReasonForRequestedProcedureCodeSequence", "Reason for Requested Procedure Code Sequence", false},
     tag_info{dicom_tag{0x0040, 0x1010}, vr(VR::PN), vm_1_n, "NamesOfIntendedRecipientsOfResults", "Names of Intended Recipients of Results", false},
     tag_info{dicom_tag{0x0040, 0x1011}, vr(VR::SQ), vm_1, "IntendedRecipientsOfResultsIdentificationSequence", "Intended Recipients of Results Identification Sequence", false},
     tag_info{dicom_tag{0x0040, 0x1012}, vr(VR::SQ), vm_1, "ReasonForPerformedProcedureCodeSequence", "Reason For Performed Procedure Code Sequence", false},
-    tag_info{dicom_tag{0x0040, 0x2001}, vr(VR::LO), vm_1, "ReasonForTheImagingServiceRequest", "Reason for the Imaging Service Request", true},  // Retired
+    tag_info{dicom_tag{0x0040, 0x1060}, vr(VR::LO), vm_1, "RequestedProcedureDescriptionTrial", "Requested Procedure Description (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0x1101}, vr(VR::SQ), vm_1, "PersonIdentificationCodeSequence", "Person Identification Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x1102}, vr(VR::ST), vm_1, "PersonAddress", "Person's Address", false},
+    tag_info{dicom_tag{0x0040, 0x1103}, vr(VR::LO), vm_1_n, "PersonTelephoneNumbers", "Person's Telephone Numbers", false},
+    tag_info{dicom_tag{0x0040, 0x1104}, vr(VR::LT), vm_1, "PersonTelecomInformation", "Person's Telecom Information", false},
+    tag_info{dicom_tag{0x0040, 0x1400}, vr(VR::LT), vm_1, "RequestedProcedureComments", "Requested Procedure Comments", false},
+    tag_info{dicom_tag{0x0040, 0x2001}, vr(VR::LO), vm_1, "ReasonForTheImagingServiceRequest", "Reason for the Imaging Service Request", true},
     tag_info{dicom_tag{0x0040, 0x2004}, vr(VR::DA), vm_1, "IssueDateOfImagingServiceRequest", "Issue Date of Imaging Service Request", false},
     tag_info{dicom_tag{0x0040, 0x2005}, vr(VR::TM), vm_1, "IssueTimeOfImagingServiceRequest", "Issue Time of Imaging Service Request", false},
+    tag_info{dicom_tag{0x0040, 0x2006}, vr(VR::SH), vm_1, "PlacerOrderNumberImagingServiceRequestRetired", "Placer Order Number / Imaging Service Request (Retired)", true},
+    tag_info{dicom_tag{0x0040, 0x2007}, vr(VR::SH), vm_1, "FillerOrderNumberImagingServiceRequestRetired", "Filler Order Number / Imaging Service Request (Retired)", true},
     tag_info{dicom_tag{0x0040, 0x2008}, vr(VR::PN), vm_1, "OrderEnteredBy", "Order Entered By", false},
     tag_info{dicom_tag{0x0040, 0x2009}, vr(VR::SH), vm_1, "OrderEntererLocation", "Order Enterer's Location", false},
     tag_info{dicom_tag{0x0040, 0x2010}, vr(VR::SH), vm_1, "OrderCallbackPhoneNumber", "Order Callback Phone Number", false},
+    tag_info{dicom_tag{0x0040, 0x2011}, vr(VR::LT), vm_1, "OrderCallbackTelecomInformation", "Order Callback Telecom Information", false},
     tag_info{dicom_tag{0x0040, 0x2016}, vr(VR::LO), vm_1, "PlacerOrderNumberImagingServiceRequest", "Placer Order Number / Imaging Service Request", false},
     tag_info{dicom_tag{0x0040, 0x2017}, vr(VR::LO), vm_1, "FillerOrderNumberImagingServiceRequest", "Filler Order Number / Imaging Service Request", false},
     tag_info{dicom_tag{0x0040, 0x2400}, vr(VR::LT), vm_1, "ImagingServiceRequestComments", "Imaging Service Request Comments", false},
     tag_info{dicom_tag{0x0040, 0x3001}, vr(VR::LO), vm_1, "ConfidentialityConstraintOnPatientDataDescription", "Confidentiality Constraint on Patient Data Description", false},
+    tag_info{dicom_tag{0x0040, 0x4001}, vr(VR::CS), vm_1, "GeneralPurposeScheduledProcedureStepStatus", "General Purpose Scheduled Procedure Step Status", true},
+    tag_info{dicom_tag{0x0040, 0x4002}, vr(VR::CS), vm_1, "GeneralPurposePerformedProcedureStepStatus", "General Purpose Performed Procedure Step Status", true},
+    tag_info{dicom_tag{0x0040, 0x4003}, vr(VR::CS), vm_1, "GeneralPurposeScheduledProcedureStepPriority", "General Purpose Scheduled Procedure Step Priority", true},
+    tag_info{dicom_tag{0x0040, 0x4004}, vr(VR::SQ), vm_1, "ScheduledProcessingApplicationsCodeSequence", "Scheduled Processing Applications Code Sequence", true},
+    tag_info{dicom_tag{0x0040, 0x4005}, vr(VR::DT), vm_1, "ScheduledProcedureStepStartDateTime", "Scheduled Procedure Step Start DateTime", false},
+    tag_info{dicom_tag{0x0040, 0x4006}, vr(VR::CS), vm_1, "MultipleCopiesFlag", "Multiple Copies Flag", true},
+    tag_info{dicom_tag{0x0040, 0x4007}, vr(VR::SQ), vm_1, "PerformedProcessingApplicationsCodeSequence", "Performed Processing Applications Code Sequence", true},
+    tag_info{dicom_tag{0x0040, 0x4008}, vr(VR::DT), vm_1, "ScheduledProcedureStepExpirationDateTime", "Scheduled Procedure Step Expiration DateTime", false},
+    tag_info{dicom_tag{0x0040, 0x4009}, vr(VR::SQ), vm_1, "HumanPerformerCodeSequence", "Human Performer Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4010}, vr(VR::DT), vm_1, "ScheduledProcedureStepModificationDateTime", "Scheduled Procedure Step Modification DateTime", false},
+    tag_info{dicom_tag{0x0040, 0x4011}, vr(VR::DT), vm_1, "ExpectedCompletionDateTime", "Expected Completion DateTime", false},
+    tag_info{dicom_tag{0x0040, 0x4015}, vr(VR::SQ), vm_1, "ResultingGeneralPurposePerformedProcedureStepsSequence", "Resulting General Purpose Performed Procedure Steps Sequence", true},
+    tag_info{dicom_tag{0x0040, 0x4016}, vr(VR::SQ), vm_1, "ReferencedGeneralPurposeScheduledProcedureStepSequence", "Referenced General Purpose Scheduled Procedure Step Sequence", true},
+    tag_info{dicom_tag{0x0040, 0x4018}, vr(VR::SQ), vm_1, "ScheduledWorkitemCodeSequence", "Scheduled Workitem Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4019}, vr(VR::SQ), vm_1, "PerformedWorkitemCodeSequence", "Performed Workitem Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4020}, vr(VR::CS), vm_1, "InputAvailabilityFlag", "Input Availability Flag", true},
+    tag_info{dicom_tag{0x0040, 0x4021}, vr(VR::SQ), vm_1, "InputInformationSequence", "Input Information Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4022}, vr(VR::SQ), vm_1, "RelevantInformationSequence", "Relevant Information Sequence", true},
+    tag_info{dicom_tag{0x0040, 0x4023}, vr(VR::UI), vm_1, "ReferencedGeneralPurposeScheduledProcedureStepTransactionUID", "Referenced General Purpose Scheduled Procedure Step Transaction UID", true},
+    tag_info{dicom_tag{0x0040, 0x4025}, vr(VR::SQ), vm_1, "ScheduledStationNameCodeSequence", "Scheduled Station Name Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4026}, vr(VR::SQ), vm_1, "ScheduledStationClassCodeSequence", "Scheduled Station Class Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4027}, vr(VR::SQ), vm_1, "ScheduledStationGeographicLocationCodeSequence", "Scheduled Station Geographic Location Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4028}, vr(VR::SQ), vm_1, "PerformedStationNameCodeSequence", "Performed Station Name Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4029}, vr(VR::SQ), vm_1, "PerformedStationClassCodeSequence", "Performed Station Class Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4030}, vr(VR::SQ), vm_1, "PerformedStationGeographicLocationCodeSequence", "Performed Station Geographic Location Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4031}, vr(VR::SQ), vm_1, "RequestedSubsequentWorkitemCodeSequence", "Requested Subsequent Workitem Code Sequence", true},
+    tag_info{dicom_tag{0x0040, 0x4032}, vr(VR::SQ), vm_1, "NonDICOMOutputCodeSequence", "Non-DICOM Output Code Sequence", true},
+    tag_info{dicom_tag{0x0040, 0x4033}, vr(VR::SQ), vm_1, "OutputInformationSequence", "Output Information Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4034}, vr(VR::SQ), vm_1, "ScheduledHumanPerformersSequence", "Scheduled Human Performers Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4035}, vr(VR::SQ), vm_1, "ActualHumanPerformersSequence", "Actual Human Performers Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4036}, vr(VR::LO), vm_1, "HumanPerformerOrganization", "Human Performer's Organization", false},
+    tag_info{dicom_tag{0x0040, 0x4037}, vr(VR::PN), vm_1, "HumanPerformerName", "Human Performer's Name", false},
+    tag_info{dicom_tag{0x0040, 0x4040}, vr(VR::CS), vm_1, "RawDataHandling", "Raw Data Handling", false},
+    tag_info{dicom_tag{0x0040, 0x4041}, vr(VR::CS), vm_1, "InputReadinessState", "Input Readiness State", false},
+    tag_info{dicom_tag{0x0040, 0x4050}, vr(VR::DT), vm_1, "PerformedProcedureStepStartDateTime", "Performed Procedure Step Start DateTime", false},
+    tag_info{dicom_tag{0x0040, 0x4051}, vr(VR::DT), vm_1, "PerformedProcedureStepEndDateTime", "Performed Procedure Step End DateTime", false},
+    tag_info{dicom_tag{0x0040, 0x4052}, vr(VR::DT), vm_1, "ProcedureStepCancellationDateTime", "Procedure Step Cancellation DateTime", false},
+    tag_info{dicom_tag{0x0040, 0x4070}, vr(VR::SQ), vm_1, "OutputDestinationSequence", "Output Destination Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4071}, vr(VR::SQ), vm_1, "DICOMStorageSequence", "DICOM Storage Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4072}, vr(VR::SQ), vm_1, "STOWRSStorageSequence", "STOW-RS Storage Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x4073}, vr(VR::UR), vm_1, "StorageURL", "Storage URL", false},
+    tag_info{dicom_tag{0x0040, 0x4074}, vr(VR::SQ), vm_1, "XDSStorageSequence", "XDS Storage Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x8302}, vr(VR::DS), vm_1, "EntranceDoseInmGy", "Entrance Dose in mGy", false},
+    tag_info{dicom_tag{0x0040, 0x8303}, vr(VR::CS), vm_1, "EntranceDoseDerivation", "Entrance Dose Derivation", false},
+    tag_info{dicom_tag{0x0040, 0x9092}, vr(VR::SQ), vm_1, "ParametricMapFrameTypeSequence", "Parametric Map Frame Type Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x9094}, vr(VR::SQ), vm_1, "ReferencedImageRealWorldValueMappingSequence", "Referenced Image Real World Value Mapping Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x9096}, vr(VR::SQ), vm_1, "RealWorldValueMappingSequence", "Real World Value Mapping Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x9098}, vr(VR::SQ), vm_1, "PixelValueMappingCodeSequence", "Pixel Value Mapping Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x9210}, vr(VR::SH), vm_1, "LUTLabel", "LUT Label", false},
+    tag_info{dicom_tag{0x0040, 0x9211}, vr(VR::US), vm_1, "RealWorldValueLastValueMapped", "Real World Value Last Value Mapped", false},
+    tag_info{dicom_tag{0x0040, 0x9212}, vr(VR::FD), vm_1_n, "RealWorldValueLUTData", "Real World Value LUT Data", false},
+    tag_info{dicom_tag{0x0040, 0x9213}, vr(VR::FD), vm_1, "DoubleFloatRealWorldValueLastValueMapped", "Double Float Real World Value Last Value Mapped", false},
+    tag_info{dicom_tag{0x0040, 0x9214}, vr(VR::FD), vm_1, "DoubleFloatRealWorldValueFirstValueMapped", "Double Float Real World Value First Value Mapped", false},
+    tag_info{dicom_tag{0x0040, 0x9216}, vr(VR::US), vm_1, "RealWorldValueFirstValueMapped", "Real World Value First Value Mapped", false},
+    tag_info{dicom_tag{0x0040, 0x9220}, vr(VR::SQ), vm_1, "QuantityDefinitionSequence", "Quantity Definition Sequence", false},
+    tag_info{dicom_tag{0x0040, 0x9224}, vr(VR::FD), vm_1, "RealWorldValueIntercept", "Real World Value Intercept", false},
+    tag_info{dicom_tag{0x0040, 0x9225}, vr(VR::FD), vm_1, "RealWorldValueSlope", "Real World Value Slope", false},
+    tag_info{dicom_tag{0x0040, 0xA007}, vr(VR::CS), vm_1, "FindingsFlagTrial", "Findings Flag (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA010}, vr(VR::CS), vm_1, "RelationshipType", "Relationship Type", false},
+    tag_info{dicom_tag{0x0040, 0xA020}, vr(VR::SQ), vm_1, "FindingsSequenceTrial", "Findings Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA021}, vr(VR::UI), vm_1, "FindingsGroupUIDTrial", "Findings Group UID (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA022}, vr(VR::UI), vm_1, "ReferencedFindingsGroupUIDTrial", "Referenced Findings Group UID (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA023}, vr(VR::DA), vm_1, "FindingsGroupRecordingDateTrial", "Findings Group Recording Date (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA024}, vr(VR::TM), vm_1, "FindingsGroupRecordingTimeTrial", "Findings Group Recording Time (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA026}, vr(VR::SQ), vm_1, "FindingsSourceCategoryCodeSequenceTrial", "Findings Source Category Code Sequence (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA027}, vr(VR::LO), vm_1, "VerifyingOrganization", "Verifying Organization", false},
-    tag_info{dicom_tag{0x0040, 0xA030}, vr(VR::DT), vm_1, "VerificationDateTime", "Verification Date Time", false},
+    tag_info{dicom_tag{0x0040, 0xA028}, vr(VR::SQ), vm_1, "DocumentingOrganizationIdentifierCodeSequenceTrial", "Documenting Organization Identifier Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA030}, vr(VR::DT), vm_1, "VerificationDateTime", "Verification DateTime", false},
     tag_info{dicom_tag{0x0040, 0xA032}, vr(VR::DT), vm_1, "ObservationDateTime", "Observation DateTime", false},
+    tag_info{dicom_tag{0x0040, 0xA033}, vr(VR::DT), vm_1, "ObservationStartDateTime", "Observation Start DateTime", false},
     tag_info{dicom_tag{0x0040, 0xA040}, vr(VR::CS), vm_1, "ValueType", "Value Type", false},
     tag_info{dicom_tag{0x0040, 0xA043}, vr(VR::SQ), vm_1, "ConceptNameCodeSequence", "Concept Name Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA047}, vr(VR::LO), vm_1, "MeasurementPrecisionDescriptionTrial", "Measurement Precision Description (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA050}, vr(VR::CS), vm_1, "ContinuityOfContent", "Continuity Of Content", false},
+    tag_info{dicom_tag{0x0040, 0xA057}, vr(VR::CS), vm_1_n, "UrgencyOrPriorityAlertsTrial", "Urgency or Priority Alerts (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA060}, vr(VR::LO), vm_1, "SequencingIndicatorTrial", "Sequencing Indicator (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA066}, vr(VR::SQ), vm_1, "DocumentIdentifierCodeSequenceTrial", "Document Identifier Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA067}, vr(VR::PN), vm_1, "DocumentAuthorTrial", "Document Author (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA068}, vr(VR::SQ), vm_1, "DocumentAuthorIdentifierCodeSequenceTrial", "Document Author Identifier Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA070}, vr(VR::SQ), vm_1, "IdentifierCodeSequenceTrial", "Identifier Code Sequence (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA073}, vr(VR::SQ), vm_1, "VerifyingObserverSequence", "Verifying Observer Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA074}, vr(VR::OB), vm_1, "ObjectBinaryIdentifierTrial", "Object Binary Identifier (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA075}, vr(VR::PN), vm_1, "VerifyingObserverName", "Verifying Observer Name", false},
+    tag_info{dicom_tag{0x0040, 0xA076}, vr(VR::SQ), vm_1, "DocumentingObserverIdentifierCodeSequenceTrial", "Documenting Observer Identifier Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA078}, vr(VR::SQ), vm_1, "AuthorObserverSequence", "Author Observer Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA07A}, vr(VR::SQ), vm_1, "ParticipantSequence", "Participant Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA07C}, vr(VR::SQ), vm_1, "CustodialOrganizationSequence", "Custodial Organization Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA080}, vr(VR::CS), vm_1, "ParticipationType", "Participation Type", false},
+    tag_info{dicom_tag{0x0040, 0xA082}, vr(VR::DT), vm_1, "ParticipationDateTime", "Participation DateTime", false},
+    tag_info{dicom_tag{0x0040, 0xA084}, vr(VR::CS), vm_1, "ObserverType", "Observer Type", false},
+    tag_info{dicom_tag{0x0040, 0xA085}, vr(VR::SQ), vm_1, "ProcedureIdentifierCodeSequenceTrial", "Procedure Identifier Code Sequence (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA088}, vr(VR::SQ), vm_1, "VerifyingObserverIdentificationCodeSequence", "Verifying Observer Identification Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA089}, vr(VR::OB), vm_1, "ObjectDirectoryBinaryIdentifierTrial", "Object Directory Binary Identifier (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA090}, vr(VR::SQ), vm_1, "EquivalentCDADocumentSequence", "Equivalent CDA Document Sequence", true},
+    tag_info{dicom_tag{0x0040, 0xA0B0}, vr(VR::US), vm_2_2n, "ReferencedWaveformChannels", "Referenced Waveform Channels", false},
+    tag_info{dicom_tag{0x0040, 0xA110}, vr(VR::DA), vm_1, "DateOfDocumentOrVerbalTransactionTrial", "Date of Document or Verbal Transaction (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA112}, vr(VR::TM), vm_1, "TimeOfDocumentCreationOrVerbalTransactionTrial", "Time of Document Creation or Verbal Transaction (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA120}, vr(VR::DT), vm_1, "DateTime", "DateTime", false},
     tag_info{dicom_tag{0x0040, 0xA121}, vr(VR::DA), vm_1, "Date", "Date", false},
     tag_info{dicom_tag{0x0040, 0xA122}, vr(VR::TM), vm_1, "Time", "Time", false},
     tag_info{dicom_tag{0x0040, 0xA123}, vr(VR::PN), vm_1, "PersonName", "Person Name", false},
     tag_info{dicom_tag{0x0040, 0xA124}, vr(VR::UI), vm_1, "UID", "UID", false},
+    tag_info{dicom_tag{0x0040, 0xA125}, vr(VR::CS), vm_2, "ReportStatusIDTrial", "Report Status ID (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA130}, vr(VR::CS), vm_1, "TemporalRangeType", "Temporal Range Type", false},
     tag_info{dicom_tag{0x0040, 0xA132}, vr(VR::UL), vm_1_n, "ReferencedSamplePositions", "Referenced Sample Positions", false},
-    tag_info{dicom_tag{0x0040, 0xA136}, vr(VR::US), vm_1_n, "ReferencedFrameNumbers", "Referenced Frame Numbers", false},
+    tag_info{dicom_tag{0x0040, 0xA136}, vr(VR::US), vm_1_n, "ReferencedFrameNumbers", "Referenced Frame Numbers", true},
     tag_info{dicom_tag{0x0040, 0xA138}, vr(VR::DS), vm_1_n, "ReferencedTimeOffsets", "Referenced Time Offsets", false},
     tag_info{dicom_tag{0x0040, 0xA13A}, vr(VR::DT), vm_1_n, "ReferencedDateTime", "Referenced DateTime", false},
     tag_info{dicom_tag{0x0040, 0xA160}, vr(VR::UT), vm_1, "TextValue", "Text Value", false},
+    tag_info{dicom_tag{0x0040, 0xA161}, vr(VR::FD), vm_1_n, "FloatingPointValue", "Floating Point Value", false},
+    tag_info{dicom_tag{0x0040, 0xA162}, vr(VR::SL), vm_1_n, "RationalNumeratorValue", "Rational Numerator Value", false},
+    tag_info{dicom_tag{0x0040, 0xA163}, vr(VR::UL), vm_1_n, "RationalDenominatorValue", "Rational Denominator Value", false},
+    tag_info{dicom_tag{0x0040, 0xA167}, vr(VR::SQ), vm_1, "ObservationCategoryCodeSequenceTrial", "Observation Category Code Sequence (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA168}, vr(VR::SQ), vm_1, "ConceptCodeSequence", "Concept Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA16A}, vr(VR::ST), vm_1, "BibliographicCitationTrial", "Bibliographic Citation (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA170}, vr(VR::SQ), vm_1, "PurposeOfReferenceCodeSequence", "Purpose of Reference Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA171}, vr(VR::UI), vm_1, "ObservationUID", "Observation UID", false},
+    tag_info{dicom_tag{0x0040, 0xA172}, vr(VR::UI), vm_1, "ReferencedObservationUIDTrial", "Referenced Observation UID (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA173}, vr(VR::CS), vm_1, "ReferencedObservationClassTrial", "Referenced Observation Class (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA174}, vr(VR::CS), vm_1, "ReferencedObjectObservationClassTrial", "Referenced Object Observation Class (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA180}, vr(VR::US), vm_1, "AnnotationGroupNumber", "Annotation Group Number", false},
+    tag_info{dicom_tag{0x0040, 0xA192}, vr(VR::DA), vm_1, "ObservationDateTrial", "Observation Date (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA193}, vr(VR::TM), vm_1, "ObservationTimeTrial", "Observation Time (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA194}, vr(VR::CS), vm_1, "MeasurementAutomationTrial", "Measurement Automation (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA195}, vr(VR::SQ), vm_1, "ModifierCodeSequence", "Modifier Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA224}, vr(VR::ST), vm_1, "IdentificationDescriptionTrial", "Identification Description (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA290}, vr(VR::CS), vm_1, "CoordinatesSetGeometricTypeTrial", "Coordinates Set Geometric Type (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA296}, vr(VR::SQ), vm_1, "AlgorithmCodeSequenceTrial", "Algorithm Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA297}, vr(VR::ST), vm_1, "AlgorithmDescriptionTrial", "Algorithm Description (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA29A}, vr(VR::SL), vm_2_2n, "PixelCoordinatesSetTrial", "Pixel Coordinates Set (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA300}, vr(VR::SQ), vm_1, "MeasuredValueSequence", "Measured Value Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA301}, vr(VR::SQ), vm_1, "NumericValueQualifierCodeSequence", "Numeric Value Qualifier Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA307}, vr(VR::PN), vm_1, "CurrentObserverTrial", "Current Observer (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA30A}, vr(VR::DS), vm_1_n, "NumericValue", "Numeric Value", false},
+    tag_info{dicom_tag{0x0040, 0xA313}, vr(VR::SQ), vm_1, "ReferencedAccessionSequenceTrial", "Referenced Accession Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA33A}, vr(VR::ST), vm_1, "ReportStatusCommentTrial", "Report Status Comment (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA340}, vr(VR::SQ), vm_1, "ProcedureContextSequenceTrial", "Procedure Context Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA352}, vr(VR::PN), vm_1, "VerbalSourceTrial", "Verbal Source (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA353}, vr(VR::ST), vm_1, "AddressTrial", "Address (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA354}, vr(VR::LO), vm_1, "TelephoneNumberTrial", "Telephone Number (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA358}, vr(VR::SQ), vm_1, "VerbalSourceIdentifierCodeSequenceTrial", "Verbal Source Identifier Code Sequence (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA360}, vr(VR::SQ), vm_1, "PredecessorDocumentsSequence", "Predecessor Documents Sequence", false},
     tag_info{dicom_tag{0x0040, 0xA370}, vr(VR::SQ), vm_1, "ReferencedRequestSequence", "Referenced Request Sequence", false},
     tag_info{dicom_tag{0x0040, 0xA372}, vr(VR::SQ), vm_1, "PerformedProcedureCodeSequence", "Performed Procedure Code Sequence", false},
     tag_info{dicom_tag{0x0040, 0xA375}, vr(VR::SQ), vm_1, "CurrentRequestedProcedureEvidenceSequence", "Current Requested Procedure Evidence Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA380}, vr(VR::SQ), vm_1, "ReportDetailSequenceTrial", "Report Detail Sequence (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA385}, vr(VR::SQ), vm_1, "PertinentOtherEvidenceSequence", "Pertinent Other Evidence Sequence", false},
     tag_info{dicom_tag{0x0040, 0xA390}, vr(VR::SQ), vm_1, "HL7StructuredDocumentReferenceSequence", "HL7 Structured Document Reference Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA402}, vr(VR::UI), vm_1, "ObservationSubjectUIDTrial", "Observation Subject UID (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA403}, vr(VR::CS), vm_1, "ObservationSubjectClassTrial", "Observation Subject Class (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA404}, vr(VR::SQ), vm_1, "ObservationSubjectTypeCodeSequenceTrial", "Observation Subject Type Code Sequence (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA491}, vr(VR::CS), vm_1, "CompletionFlag", "Completion Flag", false},
     tag_info{dicom_tag{0x0040, 0xA492}, vr(VR::LO), vm_1, "CompletionFlagDescription", "Completion Flag Description", false},
     tag_info{dicom_tag{0x0040, 0xA493}, vr(VR::CS), vm_1, "VerificationFlag", "Verification Flag", false},
+    tag_info{dicom_tag{0x0040, 0xA494}, vr(VR::CS), vm_1, "ArchiveRequested", "Archive Requested", false},
+    tag_info{dicom_tag{0x0040, 0xA496}, vr(VR::CS), vm_1, "PreliminaryFlag", "Preliminary Flag", false},
     tag_info{dicom_tag{0x0040, 0xA504}, vr(VR::SQ), vm_1, "ContentTemplateSequence", "Content Template Sequence", false},
     tag_info{dicom_tag{0x0040, 0xA525}, vr(VR::SQ), vm_1, "IdenticalDocumentsSequence", "Identical Documents Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA600}, vr(VR::CS), vm_1, "ObservationSubjectContextFlagTrial", "Observation Subject Context Flag (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA601}, vr(VR::CS), vm_1, "ObserverContextFlagTrial", "Observer Context Flag (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA603}, vr(VR::CS), vm_1, "ProcedureContextFlagTrial", "Procedure Context Flag (Trial)", true},
     tag_info{dicom_tag{0x0040, 0xA730}, vr(VR::SQ), vm_1, "ContentSequence", "Content Sequence", false},
-
-    // ========================================================================
-    // Device Information (0x0050)
-    // ========================================================================
+    tag_info{dicom_tag{0x0040, 0xA731}, vr(VR::SQ), vm_1, "RelationshipSequenceTrial", "Relationship Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA732}, vr(VR::SQ), vm_1, "RelationshipTypeCodeSequenceTrial", "Relationship Type Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA744}, vr(VR::SQ), vm_1, "LanguageCodeSequenceTrial", "Language Code Sequence (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xA801}, vr(VR::SQ), vm_1, "TabulatedValuesSequence", "Tabulated Values Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA802}, vr(VR::UL), vm_1, "NumberOfTableRows", "Number of Table Rows", false},
+    tag_info{dicom_tag{0x0040, 0xA803}, vr(VR::UL), vm_1, "NumberOfTableColumns", "Number of Table Columns", false},
+    tag_info{dicom_tag{0x0040, 0xA804}, vr(VR::UL), vm_1, "TableRowNumber", "Table Row Number", false},
+    tag_info{dicom_tag{0x0040, 0xA805}, vr(VR::UL), vm_1, "TableColumnNumber", "Table Column Number", false},
+    tag_info{dicom_tag{0x0040, 0xA806}, vr(VR::SQ), vm_1, "TableRowDefinitionSequence", "Table Row Definition Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA807}, vr(VR::SQ), vm_1, "TableColumnDefinitionSequence", "Table Column Definition Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA808}, vr(VR::SQ), vm_1, "CellValuesSequence", "Cell Values Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xA992}, vr(VR::ST), vm_1, "UniformResourceLocatorTrial", "Uniform Resource Locator (Trial)", true},
+    tag_info{dicom_tag{0x0040, 0xB020}, vr(VR::SQ), vm_1, "WaveformAnnotationSequence", "Waveform Annotation Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xDB00}, vr(VR::CS), vm_1, "TemplateIdentifier", "Template Identifier", false},
+    tag_info{dicom_tag{0x0040, 0xDB06}, vr(VR::DT), vm_1, "TemplateVersion", "Template Version", true},
+    tag_info{dicom_tag{0x0040, 0xDB07}, vr(VR::DT), vm_1, "TemplateLocalVersion", "Template Local Version", true},
+    tag_info{dicom_tag{0x0040, 0xDB0B}, vr(VR::CS), vm_1, "TemplateExtensionFlag", "Template Extension Flag", true},
+    tag_info{dicom_tag{0x0040, 0xDB0C}, vr(VR::UI), vm_1, "TemplateExtensionOrganizationUID", "Template Extension Organization UID", true},
+    tag_info{dicom_tag{0x0040, 0xDB0D}, vr(VR::UI), vm_1, "TemplateExtensionCreatorUID", "Template Extension Creator UID", true},
+    tag_info{dicom_tag{0x0040, 0xDB73}, vr(VR::UL), vm_1_n, "ReferencedContentItemIdentifier", "Referenced Content Item Identifier", false},
+    tag_info{dicom_tag{0x0040, 0xE001}, vr(VR::ST), vm_1, "HL7InstanceIdentifier", "HL7 Instance Identifier", false},
+    tag_info{dicom_tag{0x0040, 0xE004}, vr(VR::DT), vm_1, "HL7DocumentEffectiveTime", "HL7 Document Effective Time", false},
+    tag_info{dicom_tag{0x0040, 0xE006}, vr(VR::SQ), vm_1, "HL7DocumentTypeCodeSequence", "HL7 Document Type Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xE008}, vr(VR::SQ), vm_1, "DocumentClassCodeSequence", "Document Class Code Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xE010}, vr(VR::UR), vm_1, "RetrieveURI", "Retrieve URI", false},
+    tag_info{dicom_tag{0x0040, 0xE011}, vr(VR::UI), vm_1, "RetrieveLocationUID", "Retrieve Location UID", false},
+    tag_info{dicom_tag{0x0040, 0xE020}, vr(VR::CS), vm_1, "TypeOfInstances", "Type of Instances", false},
+    tag_info{dicom_tag{0x0040, 0xE021}, vr(VR::SQ), vm_1, "DICOMRetrievalSequence", "DICOM Retrieval Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xE022}, vr(VR::SQ), vm_1, "DICOMMediaRetrievalSequence", "DICOM Media Retrieval Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xE023}, vr(VR::SQ), vm_1, "WADORetrievalSequence", "WADO Retrieval Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xE024}, vr(VR::SQ), vm_1, "XDSRetrievalSequence", "XDS Retrieval Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xE025}, vr(VR::SQ), vm_1, "WADORSRetrievalSequence", "WADO-RS Retrieval Sequence", false},
+    tag_info{dicom_tag{0x0040, 0xE030}, vr(VR::UI), vm_1, "RepositoryUniqueID", "Repository Unique ID", false},
+    tag_info{dicom_tag{0x0040, 0xE031}, vr(VR::UI), vm_1, "HomeCommunityID", "Home Community ID", false},
+    tag_info{dicom_tag{0x0042, 0x0010}, vr(VR::ST), vm_1, "DocumentTitle", "Document Title", false},
+    tag_info{dicom_tag{0x0042, 0x0011}, vr(VR::OB), vm_1, "EncapsulatedDocument", "Encapsulated Document", false},
+    tag_info{dicom_tag{0x0042, 0x0012}, vr(VR::LO), vm_1, "MIMETypeOfEncapsulatedDocument", "MIME Type of Encapsulated Document", false},
+    tag_info{dicom_tag{0x0042, 0x0013}, vr(VR::SQ), vm_1, "SourceInstanceSequence", "Source Instance Sequence", false},
+    tag_info{dicom_tag{0x0042, 0x0014}, vr(VR::LO), vm_1_n, "ListOfMIMETypes", "List of MIME Types", false},
+    tag_info{dicom_tag{0x0042, 0x0015}, vr(VR::UL), vm_1, "EncapsulatedDocumentLength", "Encapsulated Document Length", false},
+    tag_info{dicom_tag{0x0044, 0x0001}, vr(VR::ST), vm_1, "ProductPackageIdentifier", "Product Package Identifier", false},
+    tag_info{dicom_tag{0x0044, 0x0002}, vr(VR::CS), vm_1, "SubstanceAdministrationApproval", "Substance Administration Approval", false},
+    tag_info{dicom_tag{0x0044, 0x0003}, vr(VR::LT), vm_1, "ApprovalStatusFurtherDescription", "Approval Status Further Description", false},
+    tag_info{dicom_tag{0x0044, 0x0004}, vr(VR::DT), vm_1, "ApprovalStatusDateTime", "Approval Status DateTime", false},
+    tag_info{dicom_tag{0x0044, 0x0007}, vr(VR::SQ), vm_1, "ProductTypeCodeSequence", "Product Type Code Sequence", false},
+    tag_info{dicom_tag{0x0044, 0x0008}, vr(VR::LO), vm_1_n, "ProductName", "Product Name", false},
+    tag_info{dicom_tag{0x0044, 0x0009}, vr(VR::LT), vm_1, "ProductDescription", "Product Description", false},
+    tag_info{dicom_tag{0x0044, 0x000A}, vr(VR::LO), vm_1, "ProductLotIdentifier", "Product Lot Identifier", false},
+    tag_info{dicom_tag{0x0044, 0x000B}, vr(VR::DT), vm_1, "ProductExpirationDateTime", "Product Expiration DateTime", false},
+    tag_info{dicom_tag{0x0044, 0x0010}, vr(VR::DT), vm_1, "SubstanceAdministrationDateTime", "Substance Administration DateTime", false},
+    tag_info{dicom_tag{0x0044, 0x0011}, vr(VR::LO), vm_1, "SubstanceAdministrationNotes", "Substance Administration Notes", false},
+    tag_info{dicom_tag{0x0044, 0x0012}, vr(VR::LO), vm_1, "SubstanceAdministrationDeviceID", "Substance Administration Device ID", false},
+    tag_info{dicom_tag{0x0044, 0x0013}, vr(VR::SQ), vm_1, "ProductParameterSequence", "Product Parameter Sequence", false},
+    tag_info{dicom_tag{0x0044, 0x0019}, vr(VR::SQ), vm_1, "SubstanceAdministrationParameterSequence", "Substance Administration Parameter Sequence", false},
+    tag_info{dicom_tag{0x0044, 0x0100}, vr(VR::SQ), vm_1, "ApprovalSequence", "Approval Sequence", false},
+    tag_info{dicom_tag{0x0044, 0x0101}, vr(VR::SQ), vm_1, "AssertionCodeSequence", "Assertion Code Sequence", false},
+    tag_info{dicom_tag{0x0044, 0x0102}, vr(VR::UI), vm_1, "AssertionUID", "Assertion UID", false},
+    tag_info{dicom_tag{0x0044, 0x0103}, vr(VR::SQ), vm_1, "AsserterIdentificationSequence", "Asserter Identification Sequence", false},
+    tag_info{dicom_tag{0x0044, 0x0104}, vr(VR::DT), vm_1, "AssertionDateTime", "Assertion DateTime", false},
+    tag_info{dicom_tag{0x0044, 0x0105}, vr(VR::DT), vm_1, "AssertionExpirationDateTime", "Assertion Expiration DateTime", false},
+    tag_info{dicom_tag{0x0044, 0x0106}, vr(VR::UT), vm_1, "AssertionComments", "Assertion Comments", false},
+    tag_info{dicom_tag{0x0044, 0x0107}, vr(VR::SQ), vm_1, "RelatedAssertionSequence", "Related Assertion Sequence", false},
+    tag_info{dicom_tag{0x0044, 0x0108}, vr(VR::UI), vm_1, "ReferencedAssertionUID", "Referenced Assertion UID", false},
+    tag_info{dicom_tag{0x0044, 0x0109}, vr(VR::SQ), vm_1, "ApprovalSubjectSequence", "Approval Subject Sequence", false},
+    tag_info{dicom_tag{0x0044, 0x010A}, vr(VR::SQ), vm_1, "OrganizationalRoleCodeSequence", "Organizational Role Code Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0012}, vr(VR::LO), vm_1, "LensDescription", "Lens Description", false},
+    tag_info{dicom_tag{0x0046, 0x0014}, vr(VR::SQ), vm_1, "RightLensSequence", "Right Lens Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0015}, vr(VR::SQ), vm_1, "LeftLensSequence", "Left Lens Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0016}, vr(VR::SQ), vm_1, "UnspecifiedLateralityLensSequence", "Unspecified Laterality Lens Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0018}, vr(VR::SQ), vm_1, "CylinderSequence", "Cylinder Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0028}, vr(VR::SQ), vm_1, "PrismSequence", "Prism Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0030}, vr(VR::FD), vm_1, "HorizontalPrismPower", "Horizontal Prism Power", false},
+    tag_info{dicom_tag{0x0046, 0x0032}, vr(VR::CS), vm_1, "HorizontalPrismBase", "Horizontal Prism Base", false},
+    tag_info{dicom_tag{0x0046, 0x0034}, vr(VR::FD), vm_1, "VerticalPrismPower", "Vertical Prism Power", false},
+    tag_info{dicom_tag{0x0046, 0x0036}, vr(VR::CS), vm_1, "VerticalPrismBase", "Vertical Prism Base", false},
+    tag_info{dicom_tag{0x0046, 0x0038}, vr(VR::CS), vm_1, "LensSegmentType", "Lens Segment Type", false},
+    tag_info{dicom_tag{0x0046, 0x0040}, vr(VR::FD), vm_1, "OpticalTransmittance", "Optical Transmittance", false},
+    tag_info{dicom_tag{0x0046, 0x0042}, vr(VR::FD), vm_1, "ChannelWidth", "Channel Width", false},
+    tag_info{dicom_tag{0x0046, 0x0044}, vr(VR::FD), vm_1, "PupilSize", "Pupil Size", false},
+    tag_info{dicom_tag{0x0046, 0x0046}, vr(VR::FD), vm_1, "CornealSize", "Corneal Size", false},
+    tag_info{dicom_tag{0x0046, 0x0047}, vr(VR::SQ), vm_1, "CornealSizeSequence", "Corneal Size Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0050}, vr(VR::SQ), vm_1, "AutorefractionRightEyeSequence", "Autorefraction Right Eye Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0052}, vr(VR::SQ), vm_1, "AutorefractionLeftEyeSequence", "Autorefraction Left Eye Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0060}, vr(VR::FD), vm_1, "DistancePupillaryDistance", "Distance Pupillary Distance", false},
+    tag_info{dicom_tag{0x0046, 0x0062}, vr(VR::FD), vm_1, "NearPupillaryDistance", "Near Pupillary Distance", false},
+    tag_info{dicom_tag{0x0046, 0x0063}, vr(VR::FD), vm_1, "IntermediatePupillaryDistance", "Intermediate Pupillary Distance", false},
+    tag_info{dicom_tag{0x0046, 0x0064}, vr(VR::FD), vm_1, "OtherPupillaryDistance", "Other Pupillary Distance", false},
+    tag_info{dicom_tag{0x0046, 0x0070}, vr(VR::SQ), vm_1, "KeratometryRightEyeSequence", "Keratometry Right Eye Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0071}, vr(VR::SQ), vm_1, "KeratometryLeftEyeSequence", "Keratometry Left Eye Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0074}, vr(VR::SQ), vm_1, "SteepKeratometricAxisSequence", "Steep Keratometric Axis Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0075}, vr(VR::FD), vm_1, "RadiusOfCurvature", "Radius of Curvature", false},
+    tag_info{dicom_tag{0x0046, 0x0076}, vr(VR::FD), vm_1, "KeratometricPower", "Keratometric Power", false},
+    tag_info{dicom_tag{0x0046, 0x0077}, vr(VR::FD), vm_1, "KeratometricAxis", "Keratometric Axis", false},
+    tag_info{dicom_tag{0x0046, 0x0080}, vr(VR::SQ), vm_1, "FlatKeratometricAxisSequence", "Flat Keratometric Axis Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0092}, vr(VR::CS), vm_1, "BackgroundColor", "Background Color", false},
+    tag_info{dicom_tag{0x0046, 0x0094}, vr(VR::CS), vm_1, "Optotype", "Optotype", false},
+    tag_info{dicom_tag{0x0046, 0x0095}, vr(VR::CS), vm_1, "OptotypePresentation", "Optotype Presentation", false},
+    tag_info{dicom_tag{0x0046, 0x0097}, vr(VR::SQ), vm_1, "SubjectiveRefractionRightEyeSequence", "Subjective Refraction Right Eye Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0098}, vr(VR::SQ), vm_1, "SubjectiveRefractionLeftEyeSequence", "Subjective Refraction Left Eye Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0100}, vr(VR::SQ), vm_1, "AddNearSequence", "Add Near Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0101}, vr(VR::SQ), vm_1, "AddIntermediateSequence", "Add Intermediate Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0102}, vr(VR::SQ), vm_1, "AddOtherSequence", "Add Other Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0104}, vr(VR::FD), vm_1, "AddPower", "Add Power", false},
+    tag_info{dicom_tag{0x0046, 0x0106}, vr(VR::FD), vm_1, "ViewingDistance", "Viewing Distance", false},
+    tag_info{dicom_tag{0x0046, 0x0110}, vr(VR::SQ), vm_1, "CorneaMeasurementsSequence", "Cornea Measurements Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0111}, vr(VR::SQ), vm_1, "SourceOfCorneaMeasurementDataCodeSequence", "Source of Cornea Measurement Data Code Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0112}, vr(VR::SQ), vm_1, "SteepCornealAxisSequence", "Steep Corneal Axis Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0113}, vr(VR::SQ), vm_1, "FlatCornealAxisSequence", "Flat Corneal Axis Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0114}, vr(VR::FD), vm_1, "CornealPower", "Corneal Power", false},
+    tag_info{dicom_tag{0x0046, 0x0115}, vr(VR::FD), vm_1, "CornealAxis", "Corneal Axis", false},
+    tag_info{dicom_tag{0x0046, 0x0116}, vr(VR::SQ), vm_1, "CorneaMeasurementMethodCodeSequence", "Cornea Measurement Method Code Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0117}, vr(VR::FL), vm_1, "RefractiveIndexOfCornea", "Refractive Index of Cornea", false},
+    tag_info{dicom_tag{0x0046, 0x0118}, vr(VR::FL), vm_1, "RefractiveIndexOfAqueousHumor", "Refractive Index of Aqueous Humor", false},
+    tag_info{dicom_tag{0x0046, 0x0121}, vr(VR::SQ), vm_1, "VisualAcuityTypeCodeSequence", "Visual Acuity Type Code Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0122}, vr(VR::SQ), vm_1, "VisualAcuityRightEyeSequence", "Visual Acuity Right Eye Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0123}, vr(VR::SQ), vm_1, "VisualAcuityLeftEyeSequence", "Visual Acuity Left Eye Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0124}, vr(VR::SQ), vm_1, "VisualAcuityBothEyesOpenSequence", "Visual Acuity Both Eyes Open Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0125}, vr(VR::CS), vm_1, "ViewingDistanceType", "Viewing Distance Type", false},
+    tag_info{dicom_tag{0x0046, 0x0135}, vr(VR::SS), vm_2, "VisualAcuityModifiers", "Visual Acuity Modifiers", false},
+    tag_info{dicom_tag{0x0046, 0x0137}, vr(VR::FD), vm_1, "DecimalVisualAcuity", "Decimal Visual Acuity", false},
+    tag_info{dicom_tag{0x0046, 0x0139}, vr(VR::LO), vm_1, "OptotypeDetailedDefinition", "Optotype Detailed Definition", false},
+    tag_info{dicom_tag{0x0046, 0x0145}, vr(VR::SQ), vm_1, "ReferencedRefractiveMeasurementsSequence", "Referenced Refractive Measurements Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0146}, vr(VR::FD), vm_1, "SpherePower", "Sphere Power", false},
+    tag_info{dicom_tag{0x0046, 0x0147}, vr(VR::FD), vm_1, "CylinderPower", "Cylinder Power", false},
+    tag_info{dicom_tag{0x0046, 0x0201}, vr(VR::CS), vm_1, "CornealTopographySurface", "Corneal Topography Surface", false},
+    tag_info{dicom_tag{0x0046, 0x0202}, vr(VR::FL), vm_2, "CornealVertexLocation", "Corneal Vertex Location", false},
+    tag_info{dicom_tag{0x0046, 0x0203}, vr(VR::FL), vm_1, "PupilCentroidXCoordinate", "Pupil Centroid X-Coordinate", false},
+    tag_info{dicom_tag{0x0046, 0x0204}, vr(VR::FL), vm_1, "PupilCentroidYCoordinate", "Pupil Centroid Y-Coordinate", false},
+    tag_info{dicom_tag{0x0046, 0x0205}, vr(VR::FL), vm_1, "EquivalentPupilRadius", "Equivalent Pupil Radius", false},
+    tag_info{dicom_tag{0x0046, 0x0207}, vr(VR::SQ), vm_1, "CornealTopographyMapTypeCodeSequence", "Corneal Topography Map Type Code Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0208}, vr(VR::IS), vm_2_2n, "VerticesOfTheOutlineOfPupil", "Vertices of the Outline of Pupil", false},
+    tag_info{dicom_tag{0x0046, 0x0210}, vr(VR::SQ), vm_1, "CornealTopographyMappingNormalsSequence", "Corneal Topography Mapping Normals Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0211}, vr(VR::SQ), vm_1, "MaximumCornealCurvatureSequence", "Maximum Corneal Curvature Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0212}, vr(VR::FL), vm_1, "MaximumCornealCurvature", "Maximum Corneal Curvature", false},
+    tag_info{dicom_tag{0x0046, 0x0213}, vr(VR::FL), vm_2, "MaximumCornealCurvatureLocation", "Maximum Corneal Curvature Location", false},
+    tag_info{dicom_tag{0x0046, 0x0215}, vr(VR::SQ), vm_1, "MinimumKeratometricSequence", "Minimum Keratometric Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0218}, vr(VR::SQ), vm_1, "SimulatedKeratometricCylinderSequence", "Simulated Keratometric Cylinder Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0220}, vr(VR::FL), vm_1, "AverageCornealPower", "Average Corneal Power", false},
+    tag_info{dicom_tag{0x0046, 0x0224}, vr(VR::FL), vm_1, "CornealISValue", "Corneal I-S Value", false},
+    tag_info{dicom_tag{0x0046, 0x0227}, vr(VR::FL), vm_1, "AnalyzedArea", "Analyzed Area", false},
+    tag_info{dicom_tag{0x0046, 0x0230}, vr(VR::FL), vm_1, "SurfaceRegularityIndex", "Surface Regularity Index", false},
+    tag_info{dicom_tag{0x0046, 0x0232}, vr(VR::FL), vm_1, "SurfaceAsymmetryIndex", "Surface Asymmetry Index", false},
+    tag_info{dicom_tag{0x0046, 0x0234}, vr(VR::FL), vm_1, "CornealEccentricityIndex", "Corneal Eccentricity Index", false},
+    tag_info{dicom_tag{0x0046, 0x0236}, vr(VR::FL), vm_1, "KeratoconusPredictionIndex", "Keratoconus Prediction Index", false},
+    tag_info{dicom_tag{0x0046, 0x0238}, vr(VR::FL), vm_1, "DecimalPotentialVisualAcuity", "Decimal Potential Visual Acuity", false},
+    tag_info{dicom_tag{0x0046, 0x0242}, vr(VR::CS), vm_1, "CornealTopographyMapQualityEvaluation", "Corneal Topography Map Quality Evaluation", false},
+    tag_info{dicom_tag{0x0046, 0x0244}, vr(VR::SQ), vm_1, "SourceImageCornealProcessedDataSequence", "Source Image Corneal Processed Data Sequence", false},
+    tag_info{dicom_tag{0x0046, 0x0247}, vr(VR::FL), vm_3, "CornealPointLocation", "Corneal Point Location", false},
+    tag_info{dicom_tag{0x0046, 0x0248}, vr(VR::CS), vm_1, "CornealPointEstimated", "Corneal Point Estimated", false},
+    tag_info{dicom_tag{0x0046, 0x0249}, vr(VR::FL), vm_1, "AxialPower", "Axial Power", false},
+    tag_info{dicom_tag{0x0046, 0x0250}, vr(VR::FL), vm_1, "TangentialPower", "Tangential Power", false},
+    tag_info{dicom_tag{0x0046, 0x0251}, vr(VR::FL), vm_1, "RefractivePower", "Refractive Power", false},
+    tag_info{dicom_tag{0x0046, 0x0252}, vr(VR::FL), vm_1, "RelativeElevation", "Relative Elevation", false},
+    tag_info{dicom_tag{0x0046, 0x0253}, vr(VR::FL), vm_1, "CornealWavefront", "Corneal Wavefront", false},
+    tag_info{dicom_tag{0x0048, 0x0001}, vr(VR::FL), vm_1, "ImagedVolumeWidth", "Imaged Volume Width", false},
+    tag_info{dicom_tag{0x0048, 0x0002}, vr(VR::FL), vm_1, "ImagedVolumeHeight", "Imaged Volume Height", false},
+    tag_info{dicom_tag{0x0048, 0x0003}, vr(VR::FL), vm_1, "ImagedVolumeDepth", "Imaged Volume Depth", false},
+    tag_info{dicom_tag{0x0048, 0x0006}, vr(VR::UL), vm_1, "TotalPixelMatrixColumns", "Total Pixel Matrix Columns", false},
+    tag_info{dicom_tag{0x0048, 0x0007}, vr(VR::UL), vm_1, "TotalPixelMatrixRows", "Total Pixel Matrix Rows", false},
+    tag_info{dicom_tag{0x0048, 0x0008}, vr(VR::SQ), vm_1, "TotalPixelMatrixOriginSequence", "Total Pixel Matrix Origin Sequence", false},
+    tag_info{dicom_tag{0x0048, 0x0010}, vr(VR::CS), vm_1, "SpecimenLabelInImage", "Specimen Label in Image", false},
+    tag_info{dicom_tag{0x0048, 0x0011}, vr(VR::CS), vm_1, "FocusMethod", "Focus Method", false},
+    tag_info{dicom_tag{0x0048, 0x0012}, vr(VR::CS), vm_1, "ExtendedDepthOfField", "Extended Depth of Field", false},
+    tag_info{dicom_tag{0x0048, 0x0013}, vr(VR::US), vm_1, "NumberOfFocalPlanes", "Number of Focal Planes", false},
+    tag_info{dicom_tag{0x0048, 0x0014}, vr(VR::FL), vm_1, "DistanceBetweenFocalPlanes", "Distance Between Focal Planes", false},
+    tag_info{dicom_tag{0x0048, 0x0015}, vr(VR::US), vm_3, "RecommendedAbsentPixelCIELabValue", "Recommended Absent Pixel CIELab Value", false},
+    tag_info{dicom_tag{0x0048, 0x0100}, vr(VR::SQ), vm_1, "IlluminatorTypeCodeSequence", "Illuminator Type Code Sequence", false},
+    tag_info{dicom_tag{0x0048, 0x0102}, vr(VR::DS), vm_6, "ImageOrientationSlide", "Image Orientation (Slide)", false},
+    tag_info{dicom_tag{0x0048, 0x0105}, vr(VR::SQ), vm_1, "OpticalPathSequence", "Optical Path Sequence", false},
+    tag_info{dicom_tag{0x0048, 0x0106}, vr(VR::SH), vm_1, "OpticalPathIdentifier", "Optical Path Identifier", false},
+    tag_info{dicom_tag{0x0048, 0x0107}, vr(VR::ST), vm_1, "OpticalPathDescription", "Optical Path Description", false},
+    tag_info{dicom_tag{0x0048, 0x0108}, vr(VR::SQ), vm_1, "IlluminationColorCodeSequence", "Illumination Color Code Sequence", false},
+    tag_info{dicom_tag{0x0048, 0x0110}, vr(VR::SQ), vm_1, "SpecimenReferenceSequence", "Specimen Reference Sequence", false},
+    tag_info{dicom_tag{0x0048, 0x0111}, vr(VR::DS), vm_1, "CondenserLensPower", "Condenser Lens Power", false},
+    tag_info{dicom_tag{0x0048, 0x0112}, vr(VR::DS), vm_1, "ObjectiveLensPower", "Objective Lens Power", false},
+    tag_info{dicom_tag{0x0048, 0x0113}, vr(VR::DS), vm_1, "ObjectiveLensNumericalAperture", "Objective Lens Numerical Aperture", false},
+    tag_info{dicom_tag{0x0048, 0x0114}, vr(VR::CS), vm_1, "ConfocalMode", "Confocal Mode", false},
+    tag_info{dicom_tag{0x0048, 0x0115}, vr(VR::CS), vm_1, "TissueLocation", "Tissue Location", false},
+    tag_info{dicom_tag{0x0048, 0x0116}, vr(VR::SQ), vm_1, "ConfocalMicroscopyImageFrameTypeSequence", "Confocal Microscopy Image Frame Type Sequence", false},
+    tag_info{dicom_tag{0x0048, 0x0117}, vr(VR::FD), vm_1, "ImageAcquisitionDepth", "Image Acquisition Depth", false},
+    tag_info{dicom_tag{0x0048, 0x0120}, vr(VR::SQ), vm_1, "PaletteColorLookupTableSequence", "Palette Color Lookup Table Sequence", false},
+    tag_info{dicom_tag{0x0048, 0x0200}, vr(VR::SQ), vm_1, "ReferencedImageNavigationSequence", "Referenced Image Navigation Sequence", true},
+    tag_info{dicom_tag{0x0048, 0x0201}, vr(VR::US), vm_2, "TopLeftHandCornerOfLocalizerArea", "Top Left Hand Corner of Localizer Area", true},
+    tag_info{dicom_tag{0x0048, 0x0202}, vr(VR::US), vm_2, "BottomRightHandCornerOfLocalizerArea", "Bottom Right Hand Corner of Localizer Area", true},
+    tag_info{dicom_tag{0x0048, 0x0207}, vr(VR::SQ), vm_1, "OpticalPathIdentificationSequence", "Optical Path Identification Sequence", false},
+    tag_info{dicom_tag{0x0048, 0x021A}, vr(VR::SQ), vm_1, "PlanePositionSlideSequence", "Plane Position (Slide) Sequence", false},
+    tag_info{dicom_tag{0x0048, 0x021E}, vr(VR::SL), vm_1, "ColumnPositionInTotalImagePixelMatrix", "Column Position In Total Image Pixel Matrix", false},
+    tag_info{dicom_tag{0x0048, 0x021F}, vr(VR::SL), vm_1, "RowPositionInTotalImagePixelMatrix", "Row Position In Total Image Pixel Matrix", false},
+    tag_info{dicom_tag{0x0048, 0x0301}, vr(VR::CS), vm_1, "PixelOriginInterpretation", "Pixel Origin Interpretation", false},
+    tag_info{dicom_tag{0x0048, 0x0302}, vr(VR::UL), vm_1, "NumberOfOpticalPaths", "Number of Optical Paths", false},
+    tag_info{dicom_tag{0x0048, 0x0303}, vr(VR::UL), vm_1, "TotalPixelMatrixFocalPlanes", "Total Pixel Matrix Focal Planes", false},
     tag_info{dicom_tag{0x0050, 0x0004}, vr(VR::CS), vm_1, "CalibrationImage", "Calibration Image", false},
     tag_info{dicom_tag{0x0050, 0x0010}, vr(VR::SQ), vm_1, "DeviceSequence", "Device Sequence", false},
+    tag_info{dicom_tag{0x0050, 0x0012}, vr(VR::SQ), vm_1, "ContainerComponentTypeCodeSequence", "Container Component Type Code Sequence", false},
+    tag_info{dicom_tag{0x0050, 0x0013}, vr(VR::FD), vm_1, "ContainerComponentThickness", "Container Component Thickness", false},
     tag_info{dicom_tag{0x0050, 0x0014}, vr(VR::DS), vm_1, "DeviceLength", "Device Length", false},
+    tag_info{dicom_tag{0x0050, 0x0015}, vr(VR::FD), vm_1, "ContainerComponentWidth", "Container Component Width", false},
     tag_info{dicom_tag{0x0050, 0x0016}, vr(VR::DS), vm_1, "DeviceDiameter", "Device Diameter", false},
     tag_info{dicom_tag{0x0050, 0x0017}, vr(VR::CS), vm_1, "DeviceDiameterUnits", "Device Diameter Units", false},
     tag_info{dicom_tag{0x0050, 0x0018}, vr(VR::DS), vm_1, "DeviceVolume", "Device Volume", false},
     tag_info{dicom_tag{0x0050, 0x0019}, vr(VR::DS), vm_1, "InterMarkerDistance", "Inter-Marker Distance", false},
+    tag_info{dicom_tag{0x0050, 0x001A}, vr(VR::CS), vm_1, "ContainerComponentMaterial", "Container Component Material", false},
+    tag_info{dicom_tag{0x0050, 0x001B}, vr(VR::LO), vm_1, "ContainerComponentID", "Container Component ID", false},
+    tag_info{dicom_tag{0x0050, 0x001C}, vr(VR::FD), vm_1, "ContainerComponentLength", "Container Component Length", false},
+    tag_info{dicom_tag{0x0050, 0x001D}, vr(VR::FD), vm_1, "ContainerComponentDiameter", "Container Component Diameter", false},
+    tag_info{dicom_tag{0x0050, 0x001E}, vr(VR::LO), vm_1, "ContainerComponentDescription", "Container Component Description", false},
     tag_info{dicom_tag{0x0050, 0x0020}, vr(VR::LO), vm_1, "DeviceDescription", "Device Description", false},
-
-    // ========================================================================
-    // Pixel Data (0x7FE0)
-    // ========================================================================
+    tag_info{dicom_tag{0x0050, 0x0021}, vr(VR::ST), vm_1, "LongDeviceDescription", "Long Device Description", false},
+    tag_info{dicom_tag{0x0052, 0x0001}, vr(VR::FL), vm_1, "ContrastBolusIngredientPercentByVolume", "Contrast/Bolus Ingredient Percent by Volume", false},
+    tag_info{dicom_tag{0x0052, 0x0002}, vr(VR::FD), vm_1, "OCTFocalDistance", "OCT Focal Distance", false},
+    tag_info{dicom_tag{0x0052, 0x0003}, vr(VR::FD), vm_1, "BeamSpotSize", "Beam Spot Size", false},
+    tag_info{dicom_tag{0x0052, 0x0004}, vr(VR::FD), vm_1, "EffectiveRefractiveIndex", "Effective Refractive Index", false},
+    tag_info{dicom_tag{0x0052, 0x0006}, vr(VR::CS), vm_1, "OCTAcquisitionDomain", "OCT Acquisition Domain", false},
+    tag_info{dicom_tag{0x0052, 0x0007}, vr(VR::FD), vm_1, "OCTOpticalCenterWavelength", "OCT Optical Center Wavelength", false},
+    tag_info{dicom_tag{0x0052, 0x0008}, vr(VR::FD), vm_1, "AxialResolution", "Axial Resolution", false},
+    tag_info{dicom_tag{0x0052, 0x0009}, vr(VR::FD), vm_1, "RangingDepth", "Ranging Depth", false},
+    tag_info{dicom_tag{0x0052, 0x0011}, vr(VR::FD), vm_1, "ALineRate", "A-line Rate", false},
+    tag_info{dicom_tag{0x0052, 0x0012}, vr(VR::US), vm_1, "ALinesPerFrame", "A-lines Per Frame", false},
+    tag_info{dicom_tag{0x0052, 0x0013}, vr(VR::FD), vm_1, "CatheterRotationalRate", "Catheter Rotational Rate", false},
+    tag_info{dicom_tag{0x0052, 0x0014}, vr(VR::FD), vm_1, "ALinePixelSpacing", "A-line Pixel Spacing", false},
+    tag_info{dicom_tag{0x0052, 0x0016}, vr(VR::SQ), vm_1, "ModeOfPercutaneousAccessSequence", "Mode of Percutaneous Access Sequence", false},
+    tag_info{dicom_tag{0x0052, 0x0025}, vr(VR::SQ), vm_1, "IntravascularOCTFrameTypeSequence", "Intravascular OCT Frame Type Sequence", false},
+    tag_info{dicom_tag{0x0052, 0x0026}, vr(VR::CS), vm_1, "OCTZOffsetApplied", "OCT Z Offset Applied", false},
+    tag_info{dicom_tag{0x0052, 0x0027}, vr(VR::SQ), vm_1, "IntravascularFrameContentSequence", "Intravascular Frame Content Sequence", false},
+    tag_info{dicom_tag{0x0052, 0x0028}, vr(VR::FD), vm_1, "IntravascularLongitudinalDistance", "Intravascular Longitudinal Distance", false},
+    tag_info{dicom_tag{0x0052, 0x0029}, vr(VR::SQ), vm_1, "IntravascularOCTFrameContentSequence", "Intravascular OCT Frame Content Sequence", false},
+    tag_info{dicom_tag{0x0052, 0x0030}, vr(VR::SS), vm_1, "OCTZOffsetCorrection", "OCT Z Offset Correction", false},
+    tag_info{dicom_tag{0x0052, 0x0031}, vr(VR::CS), vm_1, "CatheterDirectionOfRotation", "Catheter Direction of Rotation", false},
+    tag_info{dicom_tag{0x0052, 0x0033}, vr(VR::FD), vm_1, "SeamLineLocation", "Seam Line Location", false},
+    tag_info{dicom_tag{0x0052, 0x0034}, vr(VR::FD), vm_1, "FirstALineLocation", "First A-line Location", false},
+    tag_info{dicom_tag{0x0052, 0x0036}, vr(VR::US), vm_1, "SeamLineIndex", "Seam Line Index", false},
+    tag_info{dicom_tag{0x0052, 0x0038}, vr(VR::US), vm_1, "NumberOfPaddedALines", "Number of Padded A-lines", false},
+    tag_info{dicom_tag{0x0052, 0x0039}, vr(VR::CS), vm_1, "InterpolationType", "Interpolation Type", false},
+    tag_info{dicom_tag{0x0052, 0x003A}, vr(VR::CS), vm_1, "RefractiveIndexApplied", "Refractive Index Applied", false},
+    tag_info{dicom_tag{0x0054, 0x0010}, vr(VR::US), vm_1_n, "EnergyWindowVector", "Energy Window Vector", false},
+    tag_info{dicom_tag{0x0054, 0x0011}, vr(VR::US), vm_1, "NumberOfEnergyWindows", "Number of Energy Windows", false},
+    tag_info{dicom_tag{0x0054, 0x0012}, vr(VR::SQ), vm_1, "EnergyWindowInformationSequence", "Energy Window Information Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0013}, vr(VR::SQ), vm_1, "EnergyWindowRangeSequence", "Energy Window Range Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0014}, vr(VR::DS), vm_1, "EnergyWindowLowerLimit", "Energy Window Lower Limit", false},
+    tag_info{dicom_tag{0x0054, 0x0015}, vr(VR::DS), vm_1, "EnergyWindowUpperLimit", "Energy Window Upper Limit", false},
+    tag_info{dicom_tag{0x0054, 0x0016}, vr(VR::SQ), vm_1, "RadiopharmaceuticalInformationSequence", "Radiopharmaceutical Information Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0017}, vr(VR::IS), vm_1, "ResidualSyringeCounts", "Residual Syringe Counts", false},
+    tag_info{dicom_tag{0x0054, 0x0018}, vr(VR::SH), vm_1, "EnergyWindowName", "Energy Window Name", false},
+    tag_info{dicom_tag{0x0054, 0x0020}, vr(VR::US), vm_1_n, "DetectorVector", "Detector Vector", false},
+    tag_info{dicom_tag{0x0054, 0x0021}, vr(VR::US), vm_1, "NumberOfDetectors", "Number of Detectors", false},
+    tag_info{dicom_tag{0x0054, 0x0022}, vr(VR::SQ), vm_1, "DetectorInformationSequence", "Detector Information Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0030}, vr(VR::US), vm_1_n, "PhaseVector", "Phase Vector", false},
+    tag_info{dicom_tag{0x0054, 0x0031}, vr(VR::US), vm_1, "NumberOfPhases", "Number of Phases", false},
+    tag_info{dicom_tag{0x0054, 0x0032}, vr(VR::SQ), vm_1, "PhaseInformationSequence", "Phase Information Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0033}, vr(VR::US), vm_1, "NumberOfFramesInPhase", "Number of Frames in Phase", false},
+    tag_info{dicom_tag{0x0054, 0x0036}, vr(VR::IS), vm_1, "PhaseDelay", "Phase Delay", false},
+    tag_info{dicom_tag{0x0054, 0x0038}, vr(VR::IS), vm_1, "PauseBetweenFrames", "Pause Between Frames", false},
+    tag_info{dicom_tag{0x0054, 0x0039}, vr(VR::CS), vm_1, "PhaseDescription", "Phase Description", false},
+    tag_info{dicom_tag{0x0054, 0x0050}, vr(VR::US), vm_1_n, "RotationVector", "Rotation Vector", false},
+    tag_info{dicom_tag{0x0054, 0x0051}, vr(VR::US), vm_1, "NumberOfRotations", "Number of Rotations", false},
+    tag_info{dicom_tag{0x0054, 0x0052}, vr(VR::SQ), vm_1, "RotationInformationSequence", "Rotation Information Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0053}, vr(VR::US), vm_1, "NumberOfFramesInRotation", "Number of Frames in Rotation", false},
+    tag_info{dicom_tag{0x0054, 0x0060}, vr(VR::US), vm_1_n, "RRIntervalVector", "R-R Interval Vector", false},
+    tag_info{dicom_tag{0x0054, 0x0061}, vr(VR::US), vm_1, "NumberOfRRIntervals", "Number of R-R Intervals", false},
+    tag_info{dicom_tag{0x0054, 0x0062}, vr(VR::SQ), vm_1, "GatedInformationSequence", "Gated Information Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0063}, vr(VR::SQ), vm_1, "DataInformationSequence", "Data Information Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0070}, vr(VR::US), vm_1_n, "TimeSlotVector", "Time Slot Vector", false},
+    tag_info{dicom_tag{0x0054, 0x0071}, vr(VR::US), vm_1, "NumberOfTimeSlots", "Number of Time Slots", false},
+    tag_info{dicom_tag{0x0054, 0x0072}, vr(VR::SQ), vm_1, "TimeSlotInformationSequence", "Time Slot Information Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0073}, vr(VR::DS), vm_1, "TimeSlotTime", "Time Slot Time", false},
+    tag_info{dicom_tag{0x0054, 0x0080}, vr(VR::US), vm_1_n, "SliceVector", "Slice Vector", false},
+    tag_info{dicom_tag{0x0054, 0x0081}, vr(VR::US), vm_1, "NumberOfSlices", "Number of Slices", false},
+    tag_info{dicom_tag{0x0054, 0x0090}, vr(VR::US), vm_1_n, "AngularViewVector", "Angular View Vector", false},
+    tag_info{dicom_tag{0x0054, 0x0100}, vr(VR::US), vm_1_n, "TimeSliceVector", "Time Slice Vector", false},
+    tag_info{dicom_tag{0x0054, 0x0101}, vr(VR::US), vm_1, "NumberOfTimeSlices", "Number of Time Slices", false},
+    tag_info{dicom_tag{0x0054, 0x0200}, vr(VR::DS), vm_1, "StartAngle", "Start Angle", false},
+    tag_info{dicom_tag{0x0054, 0x0202}, vr(VR::CS), vm_1, "TypeOfDetectorMotion", "Type of Detector Motion", false},
+    tag_info{dicom_tag{0x0054, 0x0210}, vr(VR::IS), vm_1_n, "TriggerVector", "Trigger Vector", false},
+    tag_info{dicom_tag{0x0054, 0x0211}, vr(VR::US), vm_1, "NumberOfTriggersInPhase", "Number of Triggers in Phase", false},
+    tag_info{dicom_tag{0x0054, 0x0220}, vr(VR::SQ), vm_1, "ViewCodeSequence", "View Code Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0222}, vr(VR::SQ), vm_1, "ViewModifierCodeSequence", "View Modifier Code Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0300}, vr(VR::SQ), vm_1, "RadionuclideCodeSequence", "Radionuclide Code Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0302}, vr(VR::SQ), vm_1, "AdministrationRouteCodeSequence", "Administration Route Code Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0304}, vr(VR::SQ), vm_1, "RadiopharmaceuticalCodeSequence", "Radiopharmaceutical Code Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0306}, vr(VR::SQ), vm_1, "CalibrationDataSequence", "Calibration Data Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0308}, vr(VR::US), vm_1, "EnergyWindowNumber", "Energy Window Number", false},
+    tag_info{dicom_tag{0x0054, 0x0400}, vr(VR::SH), vm_1, "ImageID", "Image ID", false},
+    tag_info{dicom_tag{0x0054, 0x0410}, vr(VR::SQ), vm_1, "PatientOrientationCodeSequence", "Patient Orientation Code Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0412}, vr(VR::SQ), vm_1, "PatientOrientationModifierCodeSequence", "Patient Orientation Modifier Code Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0414}, vr(VR::SQ), vm_1, "PatientGantryRelationshipCodeSequence", "Patient Gantry Relationship Code Sequence", false},
+    tag_info{dicom_tag{0x0054, 0x0500}, vr(VR::CS), vm_1, "SliceProgressionDirection", "Slice Progression Direction", false},
+    tag_info{dicom_tag{0x0054, 0x0501}, vr(VR::CS), vm_1, "ScanProgressionDirection", "Scan Progression Direction", false},
+    tag_info{dicom_tag{0x0054, 0x1000}, vr(VR::CS), vm_2, "SeriesType", "Series Type", false},
+    tag_info{dicom_tag{0x0054, 0x1001}, vr(VR::CS), vm_1, "Units", "Units", false},
+    tag_info{dicom_tag{0x0054, 0x1002}, vr(VR::CS), vm_1, "CountsSource", "Counts Source", false},
+    tag_info{dicom_tag{0x0054, 0x1004}, vr(VR::CS), vm_1, "ReprojectionMethod", "Reprojection Method", false},
+    tag_info{dicom_tag{0x0054, 0x1006}, vr(VR::CS), vm_1, "SUVType", "SUV Type", false},
+    tag_info{dicom_tag{0x0054, 0x1100}, vr(VR::CS), vm_1, "RandomsCorrectionMethod", "Randoms Correction Method", false},
+    tag_info{dicom_tag{0x0054, 0x1101}, vr(VR::LO), vm_1, "AttenuationCorrectionMethod", "Attenuation Correction Method", false},
+    tag_info{dicom_tag{0x0054, 0x1102}, vr(VR::CS), vm_1, "DecayCorrection", "Decay Correction", false},
+    tag_info{dicom_tag{0x0054, 0x1103}, vr(VR::LO), vm_1, "ReconstructionMethod", "Reconstruction Method", false},
+    tag_info{dicom_tag{0x0054, 0x1104}, vr(VR::LO), vm_1, "DetectorLinesOfResponseUsed", "Detector Lines of Response Used", false},
+    tag_info{dicom_tag{0x0054, 0x1105}, vr(VR::LO), vm_1, "ScatterCorrectionMethod", "Scatter Correction Method", false},
+    tag_info{dicom_tag{0x0054, 0x1200}, vr(VR::DS), vm_1, "AxialAcceptance", "Axial Acceptance", false},
+    tag_info{dicom_tag{0x0054, 0x1201}, vr(VR::IS), vm_2, "AxialMash", "Axial Mash", false},
+    tag_info{dicom_tag{0x0054, 0x1202}, vr(VR::IS), vm_1, "TransverseMash", "Transverse Mash", false},
+    tag_info{dicom_tag{0x0054, 0x1203}, vr(VR::DS), vm_2, "DetectorElementSize", "Detector Element Size", false},
+    tag_info{dicom_tag{0x0054, 0x1210}, vr(VR::DS), vm_1, "CoincidenceWindowWidth", "Coincidence Window Width", false},
+    tag_info{dicom_tag{0x0054, 0x1220}, vr(VR::CS), vm_1_n, "SecondaryCountsType", "Secondary Counts Type", false},
+    tag_info{dicom_tag{0x0054, 0x1300}, vr(VR::DS), vm_1, "FrameReferenceTime", "Frame Reference Time", false},
+    tag_info{dicom_tag{0x0054, 0x1310}, vr(VR::IS), vm_1, "PrimaryPromptsCountsAccumulated", "Primary (Prompts) Counts Accumulated", false},
+    tag_info{dicom_tag{0x0054, 0x1311}, vr(VR::IS), vm_1_n, "SecondaryCountsAccumulated", "Secondary Counts Accumulated", false},
+    tag_info{dicom_tag{0x0054, 0x1320}, vr(VR::DS), vm_1, "SliceSensitivityFactor", "Slice Sensitivity Factor", false},
+    tag_info{dicom_tag{0x0054, 0x1321}, vr(VR::DS), vm_1, "DecayFactor", "Decay Factor", false},
+    tag_info{dicom_tag{0x0054, 0x1322}, vr(VR::DS), vm_1, "DoseCalibrationFactor", "Dose Calibration Factor", false},
+    tag_info{dicom_tag{0x0054, 0x1323}, vr(VR::DS), vm_1, "ScatterFractionFactor", "Scatter Fraction Factor", false},
+    tag_info{dicom_tag{0x0054, 0x1324}, vr(VR::DS), vm_1, "DeadTimeFactor", "Dead Time Factor", false},
+    tag_info{dicom_tag{0x0054, 0x1330}, vr(VR::US), vm_1, "ImageIndex", "Image Index", false},
+    tag_info{dicom_tag{0x0054, 0x1400}, vr(VR::CS), vm_1_n, "CountsIncluded", "Counts Included", true},
+    tag_info{dicom_tag{0x0054, 0x1401}, vr(VR::CS), vm_1, "DeadTimeCorrectionFlag", "Dead Time Correction Flag", true},
+    tag_info{dicom_tag{0x0060, 0x3000}, vr(VR::SQ), vm_1, "HistogramSequence", "Histogram Sequence", false},
+    tag_info{dicom_tag{0x0060, 0x3002}, vr(VR::US), vm_1, "HistogramNumberOfBins", "Histogram Number of Bins", false},
+    tag_info{dicom_tag{0x0060, 0x3004}, vr(VR::US), vm_1, "HistogramFirstBinValue", "Histogram First Bin Value", false},
+    tag_info{dicom_tag{0x0060, 0x3006}, vr(VR::US), vm_1, "HistogramLastBinValue", "Histogram Last Bin Value", false},
+    tag_info{dicom_tag{0x0060, 0x3008}, vr(VR::US), vm_1, "HistogramBinWidth", "Histogram Bin Width", false},
+    tag_info{dicom_tag{0x0060, 0x3010}, vr(VR::LO), vm_1, "HistogramExplanation", "Histogram Explanation", false},
+    tag_info{dicom_tag{0x0060, 0x3020}, vr(VR::UL), vm_1_n, "HistogramData", "Histogram Data", false},
+    tag_info{dicom_tag{0x0062, 0x0001}, vr(VR::CS), vm_1, "SegmentationType", "Segmentation Type", false},
+    tag_info{dicom_tag{0x0062, 0x0002}, vr(VR::SQ), vm_1, "SegmentSequence", "Segment Sequence", false},
+    tag_info{dicom_tag{0x0062, 0x0003}, vr(VR::SQ), vm_1, "SegmentedPropertyCategoryCodeSequence", "Segmented Property Category Code Sequence", false},
+    tag_info{dicom_tag{0x0062, 0x0004}, vr(VR::US), vm_1, "SegmentNumber", "Segment Number", false},
+    tag_info{dicom_tag{0x0062, 0x0005}, vr(VR::LO), vm_1, "SegmentLabel", "Segment Label", false},
+    tag_info{dicom_tag{0x0062, 0x0006}, vr(VR::ST), vm_1, "SegmentDescription", "Segment Description", false},
+    tag_info{dicom_tag{0x0062, 0x0007}, vr(VR::SQ), vm_1, "SegmentationAlgorithmIdentificationSequence", "Segmentation Algorithm Identification Sequence", false},
+    tag_info{dicom_tag{0x0062, 0x0008}, vr(VR::CS), vm_1, "SegmentAlgorithmType", "Segment Algorithm Type", false},
+    tag_info{dicom_tag{0x0062, 0x0009}, vr(VR::LO), vm_1_n, "SegmentAlgorithmName", "Segment Algorithm Name", false},
+    tag_info{dicom_tag{0x0062, 0x000A}, vr(VR::SQ), vm_1, "SegmentIdentificationSequence", "Segment Identification Sequence", false},
+    tag_info{dicom_tag{0x0062, 0x000B}, vr(VR::US), vm_1_n, "ReferencedSegmentNumber", "Referenced Segment Number", false},
+    tag_info{dicom_tag{0x0062, 0x000C}, vr(VR::US), vm_1, "RecommendedDisplayGrayscaleValue", "Recommended Display Grayscale Value", false},
+    tag_info{dicom_tag{0x0062, 0x000D}, vr(VR::US), vm_3, "RecommendedDisplayCIELabValue", "Recommended Display CIELab Value", false},
+    tag_info{dicom_tag{0x0062, 0x000E}, vr(VR::US), vm_1, "MaximumFractionalValue", "Maximum Fractional Value", false},
+    tag_info{dicom_tag{0x0062, 0x000F}, vr(VR::SQ), vm_1, "SegmentedPropertyTypeCodeSequence", "Segmented Property Type Code Sequence", false},
+    tag_info{dicom_tag{0x0062, 0x0010}, vr(VR::CS), vm_1, "SegmentationFractionalType", "Segmentation Fractional Type", false},
+    tag_info{dicom_tag{0x0062, 0x0011}, vr(VR::SQ), vm_1, "SegmentedPropertyTypeModifierCodeSequence", "Segmented Property Type Modifier Code Sequence", false},
+    tag_info{dicom_tag{0x0062, 0x0012}, vr(VR::SQ), vm_1, "UsedSegmentsSequence", "Used Segments Sequence", false},
+    tag_info{dicom_tag{0x0062, 0x0013}, vr(VR::CS), vm_1, "SegmentsOverlap", "Segments Overlap", false},
+    tag_info{dicom_tag{0x0062, 0x0020}, vr(VR::UT), vm_1, "TrackingID", "Tracking ID", false},
+    tag_info{dicom_tag{0x0062, 0x0021}, vr(VR::UI), vm_1, "TrackingUID", "Tracking UID", false},
+    tag_info{dicom_tag{0x0064, 0x0002}, vr(VR::SQ), vm_1, "DeformableRegistrationSequence", "Deformable Registration Sequence", false},
+    tag_info{dicom_tag{0x0064, 0x0003}, vr(VR::UI), vm_1, "SourceFrameOfReferenceUID", "Source Frame of Reference UID", false},
+    tag_info{dicom_tag{0x0064, 0x0005}, vr(VR::SQ), vm_1, "DeformableRegistrationGridSequence", "Deformable Registration Grid Sequence", false},
+    tag_info{dicom_tag{0x0064, 0x0007}, vr(VR::UL), vm_3, "GridDimensions", "Grid Dimensions", false},
+    tag_info{dicom_tag{0x0064, 0x0008}, vr(VR::FD), vm_3, "GridResolution", "Grid Resolution", false},
+    tag_info{dicom_tag{0x0064, 0x0009}, vr(VR::OF), vm_1, "VectorGridData", "Vector Grid Data", false},
+    tag_info{dicom_tag{0x0064, 0x000F}, vr(VR::SQ), vm_1, "PreDeformationMatrixRegistrationSequence", "Pre Deformation Matrix Registration Sequence", false},
+    tag_info{dicom_tag{0x0064, 0x0010}, vr(VR::SQ), vm_1, "PostDeformationMatrixRegistrationSequence", "Post Deformation Matrix Registration Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0001}, vr(VR::UL), vm_1, "NumberOfSurfaces", "Number of Surfaces", false},
+    tag_info{dicom_tag{0x0066, 0x0002}, vr(VR::SQ), vm_1, "SurfaceSequence", "Surface Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0003}, vr(VR::UL), vm_1, "SurfaceNumber", "Surface Number", false},
+    tag_info{dicom_tag{0x0066, 0x0004}, vr(VR::LT), vm_1, "SurfaceComments", "Surface Comments", false},
+    tag_info{dicom_tag{0x0066, 0x0009}, vr(VR::CS), vm_1, "SurfaceProcessing", "Surface Processing", false},
+    tag_info{dicom_tag{0x0066, 0x000A}, vr(VR::FL), vm_1, "SurfaceProcessingRatio", "Surface Processing Ratio", false},
+    tag_info{dicom_tag{0x0066, 0x000B}, vr(VR::LO), vm_1, "SurfaceProcessingDescription", "Surface Processing Description", false},
+    tag_info{dicom_tag{0x0066, 0x000C}, vr(VR::FL), vm_1, "RecommendedPresentationOpacity", "Recommended Presentation Opacity", false},
+    tag_info{dicom_tag{0x0066, 0x000D}, vr(VR::CS), vm_1, "RecommendedPresentationType", "Recommended Presentation Type", false},
+    tag_info{dicom_tag{0x0066, 0x000E}, vr(VR::CS), vm_1, "FiniteVolume", "Finite Volume", false},
+    tag_info{dicom_tag{0x0066, 0x0010}, vr(VR::CS), vm_1, "Manifold", "Manifold", false},
+    tag_info{dicom_tag{0x0066, 0x0011}, vr(VR::SQ), vm_1, "SurfacePointsSequence", "Surface Points Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0012}, vr(VR::SQ), vm_1, "SurfacePointsNormalsSequence", "Surface Points Normals Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0013}, vr(VR::SQ), vm_1, "SurfaceMeshPrimitivesSequence", "Surface Mesh Primitives Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0015}, vr(VR::UL), vm_1, "NumberOfSurfacePoints", "Number of Surface Points", false},
+    tag_info{dicom_tag{0x0066, 0x0016}, vr(VR::OF), vm_1, "PointCoordinatesData", "Point Coordinates Data", false},
+    tag_info{dicom_tag{0x0066, 0x0017}, vr(VR::FL), vm_3, "PointPositionAccuracy", "Point Position Accuracy", false},
+    tag_info{dicom_tag{0x0066, 0x0018}, vr(VR::FL), vm_1, "MeanPointDistance", "Mean Point Distance", false},
+    tag_info{dicom_tag{0x0066, 0x0019}, vr(VR::FL), vm_1, "MaximumPointDistance", "Maximum Point Distance", false},
+    tag_info{dicom_tag{0x0066, 0x001A}, vr(VR::FL), vm_6, "PointsBoundingBoxCoordinates", "Points Bounding Box Coordinates", false},
+    tag_info{dicom_tag{0x0066, 0x001B}, vr(VR::FL), vm_3, "AxisOfRotation", "Axis of Rotation", false},
+    tag_info{dicom_tag{0x0066, 0x001C}, vr(VR::FL), vm_3, "CenterOfRotation", "Center of Rotation", false},
+    tag_info{dicom_tag{0x0066, 0x001E}, vr(VR::UL), vm_1, "NumberOfVectors", "Number of Vectors", false},
+    tag_info{dicom_tag{0x0066, 0x001F}, vr(VR::US), vm_1, "VectorDimensionality", "Vector Dimensionality", false},
+    tag_info{dicom_tag{0x0066, 0x0020}, vr(VR::FL), vm_1_n, "VectorAccuracy", "Vector Accuracy", false},
+    tag_info{dicom_tag{0x0066, 0x0021}, vr(VR::OF), vm_1, "VectorCoordinateData", "Vector Coordinate Data", false},
+    tag_info{dicom_tag{0x0066, 0x0022}, vr(VR::OD), vm_1, "DoublePointCoordinatesData", "Double Point Coordinates Data", false},
+    tag_info{dicom_tag{0x0066, 0x0023}, vr(VR::OW), vm_1, "TrianglePointIndexList", "Triangle Point Index List", true},
+    tag_info{dicom_tag{0x0066, 0x0024}, vr(VR::OW), vm_1, "EdgePointIndexList", "Edge Point Index List", true},
+    tag_info{dicom_tag{0x0066, 0x0025}, vr(VR::OW), vm_1, "VertexPointIndexList", "Vertex Point Index List", true},
+    tag_info{dicom_tag{0x0066, 0x0026}, vr(VR::SQ), vm_1, "TriangleStripSequence", "Triangle Strip Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0027}, vr(VR::SQ), vm_1, "TriangleFanSequence", "Triangle Fan Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0028}, vr(VR::SQ), vm_1, "LineSequence", "Line Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0029}, vr(VR::OW), vm_1, "PrimitivePointIndexList", "Primitive Point Index List", true},
+    tag_info{dicom_tag{0x0066, 0x002A}, vr(VR::UL), vm_1, "SurfaceCount", "Surface Count", false},
+    tag_info{dicom_tag{0x0066, 0x002B}, vr(VR::SQ), vm_1, "ReferencedSurfaceSequence", "Referenced Surface Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x002C}, vr(VR::UL), vm_1, "ReferencedSurfaceNumber", "Referenced Surface Number", false},
+    tag_info{dicom_tag{0x0066, 0x002D}, vr(VR::SQ), vm_1, "SegmentSurfaceGenerationAlgorithmIdentificationSequence", "Segment Surface Generation Algorithm Identification Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x002E}, vr(VR::SQ), vm_1, "SegmentSurfaceSourceInstanceSequence", "Segment Surface Source Instance Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x002F}, vr(VR::SQ), vm_1, "AlgorithmFamilyCodeSequence", "Algorithm Family Code Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0030}, vr(VR::SQ), vm_1, "AlgorithmNameCodeSequence", "Algorithm Name Code Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0031}, vr(VR::LO), vm_1, "AlgorithmVersion", "Algorithm Version", false},
+    tag_info{dicom_tag{0x0066, 0x0032}, vr(VR::LT), vm_1, "AlgorithmParameters", "Algorithm Parameters", false},
+    tag_info{dicom_tag{0x0066, 0x0034}, vr(VR::SQ), vm_1, "FacetSequence", "Facet Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0035}, vr(VR::SQ), vm_1, "SurfaceProcessingAlgorithmIdentificationSequence", "Surface Processing Algorithm Identification Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0036}, vr(VR::LO), vm_1, "AlgorithmName", "Algorithm Name", false},
+    tag_info{dicom_tag{0x0066, 0x0037}, vr(VR::FL), vm_1, "RecommendedPointRadius", "Recommended Point Radius", false},
+    tag_info{dicom_tag{0x0066, 0x0038}, vr(VR::FL), vm_1, "RecommendedLineThickness", "Recommended Line Thickness", false},
+    tag_info{dicom_tag{0x0066, 0x0040}, vr(VR::OL), vm_1, "LongPrimitivePointIndexList", "Long Primitive Point Index List", false},
+    tag_info{dicom_tag{0x0066, 0x0041}, vr(VR::OL), vm_1, "LongTrianglePointIndexList", "Long Triangle Point Index List", false},
+    tag_info{dicom_tag{0x0066, 0x0042}, vr(VR::OL), vm_1, "LongEdgePointIndexList", "Long Edge Point Index List", false},
+    tag_info{dicom_tag{0x0066, 0x0043}, vr(VR::OL), vm_1, "LongVertexPointIndexList", "Long Vertex Point Index List", false},
+    tag_info{dicom_tag{0x0066, 0x0101}, vr(VR::SQ), vm_1, "TrackSetSequence", "Track Set Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0102}, vr(VR::SQ), vm_1, "TrackSequence", "Track Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0103}, vr(VR::OW), vm_1, "RecommendedDisplayCIELabValueList", "Recommended Display CIELab Value List", false},
+    tag_info{dicom_tag{0x0066, 0x0104}, vr(VR::SQ), vm_1, "TrackingAlgorithmIdentificationSequence", "Tracking Algorithm Identification Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0105}, vr(VR::UL), vm_1, "TrackSetNumber", "Track Set Number", false},
+    tag_info{dicom_tag{0x0066, 0x0106}, vr(VR::LO), vm_1, "TrackSetLabel", "Track Set Label", false},
+    tag_info{dicom_tag{0x0066, 0x0107}, vr(VR::UT), vm_1, "TrackSetDescription", "Track Set Description", false},
+    tag_info{dicom_tag{0x0066, 0x0108}, vr(VR::SQ), vm_1, "TrackSetAnatomicalTypeCodeSequence", "Track Set Anatomical Type Code Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0121}, vr(VR::SQ), vm_1, "MeasurementsSequence", "Measurements Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0124}, vr(VR::SQ), vm_1, "TrackSetStatisticsSequence", "Track Set Statistics Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0125}, vr(VR::OF), vm_1, "FloatingPointValues", "Floating Point Values", false},
+    tag_info{dicom_tag{0x0066, 0x0129}, vr(VR::OL), vm_1, "TrackPointIndexList", "Track Point Index List", false},
+    tag_info{dicom_tag{0x0066, 0x0130}, vr(VR::SQ), vm_1, "TrackStatisticsSequence", "Track Statistics Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0132}, vr(VR::SQ), vm_1, "MeasurementValuesSequence", "Measurement Values Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0133}, vr(VR::SQ), vm_1, "DiffusionAcquisitionCodeSequence", "Diffusion Acquisition Code Sequence", false},
+    tag_info{dicom_tag{0x0066, 0x0134}, vr(VR::SQ), vm_1, "DiffusionModelCodeSequence", "Diffusion Model Code Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6210}, vr(VR::LO), vm_1, "ImplantSize", "Implant Size", false},
+    tag_info{dicom_tag{0x0068, 0x6221}, vr(VR::LO), vm_1, "ImplantTemplateVersion", "Implant Template Version", false},
+    tag_info{dicom_tag{0x0068, 0x6222}, vr(VR::SQ), vm_1, "ReplacedImplantTemplateSequence", "Replaced Implant Template Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6223}, vr(VR::CS), vm_1, "ImplantType", "Implant Type", false},
+    tag_info{dicom_tag{0x0068, 0x6224}, vr(VR::SQ), vm_1, "DerivationImplantTemplateSequence", "Derivation Implant Template Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6225}, vr(VR::SQ), vm_1, "OriginalImplantTemplateSequence", "Original Implant Template Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6226}, vr(VR::DT), vm_1, "EffectiveDateTime", "Effective DateTime", false},
+    tag_info{dicom_tag{0x0068, 0x6230}, vr(VR::SQ), vm_1, "ImplantTargetAnatomySequence", "Implant Target Anatomy Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6260}, vr(VR::SQ), vm_1, "InformationFromManufacturerSequence", "Information From Manufacturer Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6265}, vr(VR::SQ), vm_1, "NotificationFromManufacturerSequence", "Notification From Manufacturer Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6270}, vr(VR::DT), vm_1, "InformationIssueDateTime", "Information Issue DateTime", false},
+    tag_info{dicom_tag{0x0068, 0x6280}, vr(VR::ST), vm_1, "InformationSummary", "Information Summary", false},
+    tag_info{dicom_tag{0x0068, 0x62A0}, vr(VR::SQ), vm_1, "ImplantRegulatoryDisapprovalCodeSequence", "Implant Regulatory Disapproval Code Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x62A5}, vr(VR::FD), vm_1, "OverallTemplateSpatialTolerance", "Overall Template Spatial Tolerance", false},
+    tag_info{dicom_tag{0x0068, 0x62C0}, vr(VR::SQ), vm_1, "HPGLDocumentSequence", "HPGL Document Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x62D0}, vr(VR::US), vm_1, "HPGLDocumentID", "HPGL Document ID", false},
+    tag_info{dicom_tag{0x0068, 0x62D5}, vr(VR::LO), vm_1, "HPGLDocumentLabel", "HPGL Document Label", false},
+    tag_info{dicom_tag{0x0068, 0x62E0}, vr(VR::SQ), vm_1, "ViewOrientationCodeSequence", "View Orientation Code Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x62F0}, vr(VR::SQ), vm_1, "ViewOrientationModifierCodeSequence", "View Orientation Modifier Code Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x62F2}, vr(VR::FD), vm_1, "HPGLDocumentScaling", "HPGL Document Scaling", false},
+    tag_info{dicom_tag{0x0068, 0x6300}, vr(VR::OB), vm_1, "HPGLDocument", "HPGL Document", false},
+    tag_info{dicom_tag{0x0068, 0x6310}, vr(VR::US), vm_1, "HPGLContourPenNumber", "HPGL Contour Pen Number", false},
+    tag_info{dicom_tag{0x0068, 0x6320}, vr(VR::SQ), vm_1, "HPGLPenSequence", "HPGL Pen Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6330}, vr(VR::US), vm_1, "HPGLPenNumber", "HPGL Pen Number", false},
+    tag_info{dicom_tag{0x0068, 0x6340}, vr(VR::LO), vm_1, "HPGLPenLabel", "HPGL Pen Label", false},
+    tag_info{dicom_tag{0x0068, 0x6345}, vr(VR::ST), vm_1, "HPGLPenDescription", "HPGL Pen Description", false},
+    tag_info{dicom_tag{0x0068, 0x6346}, vr(VR::FD), vm_2, "RecommendedRotationPoint", "Recommended Rotation Point", false},
+    tag_info{dicom_tag{0x0068, 0x6347}, vr(VR::FD), vm_4, "BoundingRectangle", "Bounding Rectangle", false},
+    tag_info{dicom_tag{0x0068, 0x6350}, vr(VR::US), vm_1_n, "ImplantTemplate3DModelSurfaceNumber", "Implant Template 3D Model Surface Number", false},
+    tag_info{dicom_tag{0x0068, 0x6360}, vr(VR::SQ), vm_1, "SurfaceModelDescriptionSequence", "Surface Model Description Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6380}, vr(VR::LO), vm_1, "SurfaceModelLabel", "Surface Model Label", false},
+    tag_info{dicom_tag{0x0068, 0x6390}, vr(VR::FD), vm_1, "SurfaceModelScalingFactor", "Surface Model Scaling Factor", false},
+    tag_info{dicom_tag{0x0068, 0x63A0}, vr(VR::SQ), vm_1, "MaterialsCodeSequence", "Materials Code Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x63A4}, vr(VR::SQ), vm_1, "CoatingMaterialsCodeSequence", "Coating Materials Code Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x63A8}, vr(VR::SQ), vm_1, "ImplantTypeCodeSequence", "Implant Type Code Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x63AC}, vr(VR::SQ), vm_1, "FixationMethodCodeSequence", "Fixation Method Code Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x63B0}, vr(VR::SQ), vm_1, "MatingFeatureSetsSequence", "Mating Feature Sets Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x63C0}, vr(VR::US), vm_1, "MatingFeatureSetID", "Mating Feature Set ID", false},
+    tag_info{dicom_tag{0x0068, 0x63D0}, vr(VR::LO), vm_1, "MatingFeatureSetLabel", "Mating Feature Set Label", false},
+    tag_info{dicom_tag{0x0068, 0x63E0}, vr(VR::SQ), vm_1, "MatingFeatureSequence", "Mating Feature Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x63F0}, vr(VR::US), vm_1, "MatingFeatureID", "Mating Feature ID", false},
+    tag_info{dicom_tag{0x0068, 0x6400}, vr(VR::SQ), vm_1, "MatingFeatureDegreeOfFreedomSequence", "Mating Feature Degree of Freedom Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6410}, vr(VR::US), vm_1, "DegreeOfFreedomID", "Degree of Freedom ID", false},
+    tag_info{dicom_tag{0x0068, 0x6420}, vr(VR::CS), vm_1, "DegreeOfFreedomType", "Degree of Freedom Type", false},
+    tag_info{dicom_tag{0x0068, 0x6430}, vr(VR::SQ), vm_1, "TwoDMatingFeatureCoordinatesSequence", "2D Mating Feature Coordinates Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6440}, vr(VR::US), vm_1, "ReferencedHPGLDocumentID", "Referenced HPGL Document ID", false},
+    tag_info{dicom_tag{0x0068, 0x6450}, vr(VR::FD), vm_2, "TwoDMatingPoint", "2D Mating Point", false},
+    tag_info{dicom_tag{0x0068, 0x6460}, vr(VR::FD), vm_4, "TwoDMatingAxes", "2D Mating Axes", false},
+    tag_info{dicom_tag{0x0068, 0x6470}, vr(VR::SQ), vm_1, "TwoDDegreeOfFreedomSequence", "2D Degree of Freedom Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6490}, vr(VR::FD), vm_3, "ThreeDDegreeOfFreedomAxis", "3D Degree of Freedom Axis", false},
+    tag_info{dicom_tag{0x0068, 0x64A0}, vr(VR::FD), vm_2, "RangeOfFreedom", "Range of Freedom", false},
+    tag_info{dicom_tag{0x0068, 0x64C0}, vr(VR::FD), vm_3, "ThreeDMatingPoint", "3D Mating Point", false},
+    tag_info{dicom_tag{0x0068, 0x64D0}, vr(VR::FD), vm_9, "ThreeDMatingAxes", "3D Mating Axes", false},
+    tag_info{dicom_tag{0x0068, 0x64F0}, vr(VR::FD), vm_3, "TwoDDegreeOfFreedomAxis", "2D Degree of Freedom Axis", false},
+    tag_info{dicom_tag{0x0068, 0x6500}, vr(VR::SQ), vm_1, "PlanningLandmarkPointSequence", "Planning Landmark Point Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6510}, vr(VR::SQ), vm_1, "PlanningLandmarkLineSequence", "Planning Landmark Line Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6520}, vr(VR::SQ), vm_1, "PlanningLandmarkPlaneSequence", "Planning Landmark Plane Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6530}, vr(VR::US), vm_1, "PlanningLandmarkID", "Planning Landmark ID", false},
+    tag_info{dicom_tag{0x0068, 0x6540}, vr(VR::LO), vm_1, "PlanningLandmarkDescription", "Planning Landmark Description", false},
+    tag_info{dicom_tag{0x0068, 0x6545}, vr(VR::SQ), vm_1, "PlanningLandmarkIdentificationCodeSequence", "Planning Landmark Identification Code Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6550}, vr(VR::SQ), vm_1, "TwoDPointCoordinatesSequence", "2D Point Coordinates Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x6560}, vr(VR::FD), vm_2, "TwoDPointCoordinates", "2D Point Coordinates", false},
+    tag_info{dicom_tag{0x0068, 0x6590}, vr(VR::FD), vm_3, "ThreeDPointCoordinates", "3D Point Coordinates", false},
+    tag_info{dicom_tag{0x0068, 0x65A0}, vr(VR::SQ), vm_1, "TwoDLineCoordinatesSequence", "2D Line Coordinates Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x65B0}, vr(VR::FD), vm_4, "TwoDLineCoordinates", "2D Line Coordinates", false},
+    tag_info{dicom_tag{0x0068, 0x65D0}, vr(VR::FD), vm_6, "ThreeDLineCoordinates", "3D Line Coordinates", false},
+    tag_info{dicom_tag{0x0068, 0x65E0}, vr(VR::SQ), vm_1, "TwoDPlaneCoordinatesSequence", "2D Plane Coordinates Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x65F0}, vr(VR::FD), vm_4, "TwoDPlaneIntersection", "2D Plane Intersection", false},
+    tag_info{dicom_tag{0x0068, 0x6610}, vr(VR::FD), vm_3, "ThreeDPlaneOrigin", "3D Plane Origin", false},
+    tag_info{dicom_tag{0x0068, 0x6620}, vr(VR::FD), vm_3, "ThreeDPlaneNormal", "3D Plane Normal", false},
+    tag_info{dicom_tag{0x0068, 0x7001}, vr(VR::CS), vm_1, "ModelModification", "Model Modification", false},
+    tag_info{dicom_tag{0x0068, 0x7002}, vr(VR::CS), vm_1, "ModelMirroring", "Model Mirroring", false},
+    tag_info{dicom_tag{0x0068, 0x7003}, vr(VR::SQ), vm_1, "ModelUsageCodeSequence", "Model Usage Code Sequence", false},
+    tag_info{dicom_tag{0x0068, 0x7004}, vr(VR::UI), vm_1, "ModelGroupUID", "Model Group UID", false},
+    tag_info{dicom_tag{0x0068, 0x7005}, vr(VR::UR), vm_1, "RelativeURIReferenceWithinEncapsulatedDocument", "Relative URI Reference Within Encapsulated Document", false},
+    tag_info{dicom_tag{0x006A, 0x0001}, vr(VR::CS), vm_1, "AnnotationCoordinateType", "Annotation Coordinate Type", false},
+    tag_info{dicom_tag{0x006A, 0x0002}, vr(VR::SQ), vm_1, "AnnotationGroupSequence", "Annotation Group Sequence", false},
+    tag_info{dicom_tag{0x006A, 0x0003}, vr(VR::UI), vm_1, "AnnotationGroupUID", "Annotation Group UID", false},
+    tag_info{dicom_tag{0x006A, 0x0005}, vr(VR::LO), vm_1, "AnnotationGroupLabel", "Annotation Group Label", false},
+    tag_info{dicom_tag{0x006A, 0x0006}, vr(VR::UT), vm_1, "AnnotationGroupDescription", "Annotation Group Description", false},
+    tag_info{dicom_tag{0x006A, 0x0007}, vr(VR::CS), vm_1, "AnnotationGroupGenerationType", "Annotation Group Generation Type", false},
+    tag_info{dicom_tag{0x006A, 0x0008}, vr(VR::SQ), vm_1, "AnnotationGroupAlgorithmIdentificationSequence", "Annotation Group Algorithm Identification Sequence", false},
+    tag_info{dicom_tag{0x006A, 0x0009}, vr(VR::SQ), vm_1, "AnnotationPropertyCategoryCodeSequence", "Annotation Property Category Code Sequence", false},
+    tag_info{dicom_tag{0x006A, 0x000A}, vr(VR::SQ), vm_1, "AnnotationPropertyTypeCodeSequence", "Annotation Property Type Code Sequence", false},
+    tag_info{dicom_tag{0x006A, 0x000B}, vr(VR::SQ), vm_1, "AnnotationPropertyTypeModifierCodeSequence", "Annotation Property Type Modifier Code Sequence", false},
+    tag_info{dicom_tag{0x006A, 0x000C}, vr(VR::UL), vm_1, "NumberOfAnnotations", "Number of Annotations", false},
+    tag_info{dicom_tag{0x006A, 0x000D}, vr(VR::CS), vm_1, "AnnotationAppliesToAllOpticalPaths", "Annotation Applies to All Optical Paths", false},
+    tag_info{dicom_tag{0x006A, 0x000E}, vr(VR::SH), vm_1_n, "ReferencedOpticalPathIdentifier", "Referenced Optical Path Identifier", false},
+    tag_info{dicom_tag{0x006A, 0x000F}, vr(VR::CS), vm_1, "AnnotationAppliesToAllZPlanes", "Annotation Applies to All Z Planes", false},
+    tag_info{dicom_tag{0x006A, 0x0010}, vr(VR::FD), vm_1_n, "CommonZCoordinateValue", "Common Z Coordinate Value", false},
+    tag_info{dicom_tag{0x006A, 0x0011}, vr(VR::OL), vm_1, "AnnotationIndexList", "Annotation Index List", false},
+    tag_info{dicom_tag{0x0070, 0x0001}, vr(VR::SQ), vm_1, "GraphicAnnotationSequence", "Graphic Annotation Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0002}, vr(VR::CS), vm_1, "GraphicLayer", "Graphic Layer", false},
+    tag_info{dicom_tag{0x0070, 0x0003}, vr(VR::CS), vm_1, "BoundingBoxAnnotationUnits", "Bounding Box Annotation Units", false},
+    tag_info{dicom_tag{0x0070, 0x0004}, vr(VR::CS), vm_1, "AnchorPointAnnotationUnits", "Anchor Point Annotation Units", false},
+    tag_info{dicom_tag{0x0070, 0x0005}, vr(VR::CS), vm_1, "GraphicAnnotationUnits", "Graphic Annotation Units", false},
+    tag_info{dicom_tag{0x0070, 0x0006}, vr(VR::ST), vm_1, "UnformattedTextValue", "Unformatted Text Value", false},
+    tag_info{dicom_tag{0x0070, 0x0008}, vr(VR::SQ), vm_1, "TextObjectSequence", "Text Object Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0009}, vr(VR::SQ), vm_1, "GraphicObjectSequence", "Graphic Object Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0010}, vr(VR::FL), vm_2, "BoundingBoxTopLeftHandCorner", "Bounding Box Top Left Hand Corner", false},
+    tag_info{dicom_tag{0x0070, 0x0011}, vr(VR::FL), vm_2, "BoundingBoxBottomRightHandCorner", "Bounding Box Bottom Right Hand Corner", false},
+    tag_info{dicom_tag{0x0070, 0x0012}, vr(VR::CS), vm_1, "BoundingBoxTextHorizontalJustification", "Bounding Box Text Horizontal Justification", false},
+    tag_info{dicom_tag{0x0070, 0x0014}, vr(VR::FL), vm_2, "AnchorPoint", "Anchor Point", false},
+    tag_info{dicom_tag{0x0070, 0x0015}, vr(VR::CS), vm_1, "AnchorPointVisibility", "Anchor Point Visibility", false},
+    tag_info{dicom_tag{0x0070, 0x0020}, vr(VR::US), vm_1, "GraphicDimensions", "Graphic Dimensions", false},
+    tag_info{dicom_tag{0x0070, 0x0021}, vr(VR::US), vm_1, "NumberOfGraphicPoints", "Number of Graphic Points", false},
+    tag_info{dicom_tag{0x0070, 0x0022}, vr(VR::FL), vm_2_n, "GraphicData", "Graphic Data", false},
+    tag_info{dicom_tag{0x0070, 0x0023}, vr(VR::CS), vm_1, "GraphicType", "Graphic Type", false},
+    tag_info{dicom_tag{0x0070, 0x0024}, vr(VR::CS), vm_1, "GraphicFilled", "Graphic Filled", false},
+    tag_info{dicom_tag{0x0070, 0x0040}, vr(VR::IS), vm_1, "ImageRotationRetired", "Image Rotation (Retired)", true},
+    tag_info{dicom_tag{0x0070, 0x0041}, vr(VR::CS), vm_1, "ImageHorizontalFlip", "Image Horizontal Flip", false},
+    tag_info{dicom_tag{0x0070, 0x0042}, vr(VR::US), vm_1, "ImageRotation", "Image Rotation", false},
+    tag_info{dicom_tag{0x0070, 0x0050}, vr(VR::US), vm_2, "DisplayedAreaTopLeftHandCornerTrial", "Displayed Area Top Left Hand Corner (Trial)", true},
+    tag_info{dicom_tag{0x0070, 0x0051}, vr(VR::US), vm_2, "DisplayedAreaBottomRightHandCornerTrial", "Displayed Area Bottom Right Hand Corner (Trial)", true},
+    tag_info{dicom_tag{0x0070, 0x0052}, vr(VR::SL), vm_2, "DisplayedAreaTopLeftHandCorner", "Displayed Area Top Left Hand Corner", false},
+    tag_info{dicom_tag{0x0070, 0x0053}, vr(VR::SL), vm_2, "DisplayedAreaBottomRightHandCorner", "Displayed Area Bottom Right Hand Corner", false},
+    tag_info{dicom_tag{0x0070, 0x005A}, vr(VR::SQ), vm_1, "DisplayedAreaSelectionSequence", "Displayed Area Selection Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0060}, vr(VR::SQ), vm_1, "GraphicLayerSequence", "Graphic Layer Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0062}, vr(VR::IS), vm_1, "GraphicLayerOrder", "Graphic Layer Order", false},
+    tag_info{dicom_tag{0x0070, 0x0066}, vr(VR::US), vm_1, "GraphicLayerRecommendedDisplayGrayscaleValue", "Graphic Layer Recommended Display Grayscale Value", false},
+    tag_info{dicom_tag{0x0070, 0x0067}, vr(VR::US), vm_3, "GraphicLayerRecommendedDisplayRGBValue", "Graphic Layer Recommended Display RGB Value", true},
+    tag_info{dicom_tag{0x0070, 0x0068}, vr(VR::LO), vm_1, "GraphicLayerDescription", "Graphic Layer Description", false},
+    tag_info{dicom_tag{0x0070, 0x0080}, vr(VR::CS), vm_1, "ContentLabel", "Content Label", false},
+    tag_info{dicom_tag{0x0070, 0x0081}, vr(VR::LO), vm_1, "ContentDescription", "Content Description", false},
+    tag_info{dicom_tag{0x0070, 0x0082}, vr(VR::DA), vm_1, "PresentationCreationDate", "Presentation Creation Date", false},
+    tag_info{dicom_tag{0x0070, 0x0083}, vr(VR::TM), vm_1, "PresentationCreationTime", "Presentation Creation Time", false},
+    tag_info{dicom_tag{0x0070, 0x0084}, vr(VR::PN), vm_1, "ContentCreatorName", "Content Creator's Name", false},
+    tag_info{dicom_tag{0x0070, 0x0086}, vr(VR::SQ), vm_1, "ContentCreatorIdentificationCodeSequence", "Content Creator's Identification Code Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0087}, vr(VR::SQ), vm_1, "AlternateContentDescriptionSequence", "Alternate Content Description Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0100}, vr(VR::CS), vm_1, "PresentationSizeMode", "Presentation Size Mode", false},
+    tag_info{dicom_tag{0x0070, 0x0101}, vr(VR::DS), vm_2, "PresentationPixelSpacing", "Presentation Pixel Spacing", false},
+    tag_info{dicom_tag{0x0070, 0x0102}, vr(VR::IS), vm_2, "PresentationPixelAspectRatio", "Presentation Pixel Aspect Ratio", false},
+    tag_info{dicom_tag{0x0070, 0x0103}, vr(VR::FL), vm_1, "PresentationPixelMagnificationRatio", "Presentation Pixel Magnification Ratio", false},
+    tag_info{dicom_tag{0x0070, 0x0207}, vr(VR::LO), vm_1, "GraphicGroupLabel", "Graphic Group Label", false},
+    tag_info{dicom_tag{0x0070, 0x0208}, vr(VR::ST), vm_1, "GraphicGroupDescription", "Graphic Group Description", false},
+    tag_info{dicom_tag{0x0070, 0x0209}, vr(VR::SQ), vm_1, "CompoundGraphicSequence", "Compound Graphic Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0226}, vr(VR::UL), vm_1, "CompoundGraphicInstanceID", "Compound Graphic Instance ID", false},
+    tag_info{dicom_tag{0x0070, 0x0227}, vr(VR::LO), vm_1, "FontName", "Font Name", false},
+    tag_info{dicom_tag{0x0070, 0x0228}, vr(VR::CS), vm_1, "FontNameType", "Font Name Type", false},
+    tag_info{dicom_tag{0x0070, 0x0229}, vr(VR::LO), vm_1, "CSSFontName", "CSS Font Name", false},
+    tag_info{dicom_tag{0x0070, 0x0230}, vr(VR::FD), vm_1, "RotationAngle", "Rotation Angle", false},
+    tag_info{dicom_tag{0x0070, 0x0231}, vr(VR::SQ), vm_1, "TextStyleSequence", "Text Style Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0232}, vr(VR::SQ), vm_1, "LineStyleSequence", "Line Style Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0233}, vr(VR::SQ), vm_1, "FillStyleSequence", "Fill Style Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0234}, vr(VR::SQ), vm_1, "GraphicGroupSequence", "Graphic Group Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0241}, vr(VR::US), vm_3, "TextColorCIELabValue", "Text Color CIELab Value", false},
+    tag_info{dicom_tag{0x0070, 0x0242}, vr(VR::CS), vm_1, "HorizontalAlignment", "Horizontal Alignment", false},
+    tag_info{dicom_tag{0x0070, 0x0243}, vr(VR::CS), vm_1, "VerticalAlignment", "Vertical Alignment", false},
+    tag_info{dicom_tag{0x0070, 0x0244}, vr(VR::CS), vm_1, "ShadowStyle", "Shadow Style", false},
+    tag_info{dicom_tag{0x0070, 0x0245}, vr(VR::FL), vm_1, "ShadowOffsetX", "Shadow Offset X", false},
+    tag_info{dicom_tag{0x0070, 0x0246}, vr(VR::FL), vm_1, "ShadowOffsetY", "Shadow Offset Y", false},
+    tag_info{dicom_tag{0x0070, 0x0247}, vr(VR::US), vm_3, "ShadowColorCIELabValue", "Shadow Color CIELab Value", false},
+    tag_info{dicom_tag{0x0070, 0x0248}, vr(VR::CS), vm_1, "Underlined", "Underlined", false},
+    tag_info{dicom_tag{0x0070, 0x0249}, vr(VR::CS), vm_1, "Bold", "Bold", false},
+    tag_info{dicom_tag{0x0070, 0x0250}, vr(VR::CS), vm_1, "Italic", "Italic", false},
+    tag_info{dicom_tag{0x0070, 0x0251}, vr(VR::US), vm_3, "PatternOnColorCIELabValue", "Pattern On Color CIELab Value", false},
+    tag_info{dicom_tag{0x0070, 0x0252}, vr(VR::US), vm_3, "PatternOffColorCIELabValue", "Pattern Off Color CIELab Value", false},
+    tag_info{dicom_tag{0x0070, 0x0253}, vr(VR::FL), vm_1, "LineThickness", "Line Thickness", false},
+    tag_info{dicom_tag{0x0070, 0x0254}, vr(VR::CS), vm_1, "LineDashingStyle", "Line Dashing Style", false},
+    tag_info{dicom_tag{0x0070, 0x0255}, vr(VR::UL), vm_1, "LinePattern", "Line Pattern", false},
+    tag_info{dicom_tag{0x0070, 0x0256}, vr(VR::OB), vm_1, "FillPattern", "Fill Pattern", false},
+    tag_info{dicom_tag{0x0070, 0x0257}, vr(VR::CS), vm_1, "FillMode", "Fill Mode", false},
+    tag_info{dicom_tag{0x0070, 0x0258}, vr(VR::FL), vm_1, "ShadowOpacity", "Shadow Opacity", false},
+    tag_info{dicom_tag{0x0070, 0x0261}, vr(VR::FL), vm_1, "GapLength", "Gap Length", false},
+    tag_info{dicom_tag{0x0070, 0x0262}, vr(VR::FL), vm_1, "DiameterOfVisibility", "Diameter of Visibility", false},
+    tag_info{dicom_tag{0x0070, 0x0273}, vr(VR::FL), vm_2, "RotationPoint", "Rotation Point", false},
+    tag_info{dicom_tag{0x0070, 0x0274}, vr(VR::CS), vm_1, "TickAlignment", "Tick Alignment", false},
+    tag_info{dicom_tag{0x0070, 0x0278}, vr(VR::CS), vm_1, "ShowTickLabel", "Show Tick Label", false},
+    tag_info{dicom_tag{0x0070, 0x0279}, vr(VR::CS), vm_1, "TickLabelAlignment", "Tick Label Alignment", false},
+    tag_info{dicom_tag{0x0070, 0x0282}, vr(VR::CS), vm_1, "CompoundGraphicUnits", "Compound Graphic Units", false},
+    tag_info{dicom_tag{0x0070, 0x0284}, vr(VR::FL), vm_1, "PatternOnOpacity", "Pattern On Opacity", false},
+    tag_info{dicom_tag{0x0070, 0x0285}, vr(VR::FL), vm_1, "PatternOffOpacity", "Pattern Off Opacity", false},
+    tag_info{dicom_tag{0x0070, 0x0287}, vr(VR::SQ), vm_1, "MajorTicksSequence", "Major Ticks Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0288}, vr(VR::FL), vm_1, "TickPosition", "Tick Position", false},
+    tag_info{dicom_tag{0x0070, 0x0289}, vr(VR::SH), vm_1, "TickLabel", "Tick Label", false},
+    tag_info{dicom_tag{0x0070, 0x0294}, vr(VR::CS), vm_1, "CompoundGraphicType", "Compound Graphic Type", false},
+    tag_info{dicom_tag{0x0070, 0x0295}, vr(VR::UL), vm_1, "GraphicGroupID", "Graphic Group ID", false},
+    tag_info{dicom_tag{0x0070, 0x0306}, vr(VR::CS), vm_1, "ShapeType", "Shape Type", false},
+    tag_info{dicom_tag{0x0070, 0x0308}, vr(VR::SQ), vm_1, "RegistrationSequence", "Registration Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0309}, vr(VR::SQ), vm_1, "MatrixRegistrationSequence", "Matrix Registration Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x030A}, vr(VR::SQ), vm_1, "MatrixSequence", "Matrix Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x030B}, vr(VR::FD), vm_16, "FrameOfReferenceToDisplayedCoordinateSystemTransformationMatrix", "Frame of Reference to Displayed Coordinate System Transformation Matrix", false},
+    tag_info{dicom_tag{0x0070, 0x030C}, vr(VR::CS), vm_1, "FrameOfReferenceTransformationMatrixType", "Frame of Reference Transformation Matrix Type", false},
+    tag_info{dicom_tag{0x0070, 0x030D}, vr(VR::SQ), vm_1, "RegistrationTypeCodeSequence", "Registration Type Code Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x030F}, vr(VR::ST), vm_1, "FiducialDescription", "Fiducial Description", false},
+    tag_info{dicom_tag{0x0070, 0x0310}, vr(VR::SH), vm_1, "FiducialIdentifier", "Fiducial Identifier", false},
+    tag_info{dicom_tag{0x0070, 0x0311}, vr(VR::SQ), vm_1, "FiducialIdentifierCodeSequence", "Fiducial Identifier Code Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0312}, vr(VR::FD), vm_1, "ContourUncertaintyRadius", "Contour Uncertainty Radius", false},
+    tag_info{dicom_tag{0x0070, 0x0314}, vr(VR::SQ), vm_1, "UsedFiducialsSequence", "Used Fiducials Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0315}, vr(VR::SQ), vm_1, "UsedRTStructureSetROISequence", "Used RT Structure Set ROI Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0318}, vr(VR::SQ), vm_1, "GraphicCoordinatesDataSequence", "Graphic Coordinates Data Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x031A}, vr(VR::UI), vm_1, "FiducialUID", "Fiducial UID", false},
+    tag_info{dicom_tag{0x0070, 0x031B}, vr(VR::UI), vm_1, "ReferencedFiducialUID", "Referenced Fiducial UID", false},
+    tag_info{dicom_tag{0x0070, 0x031C}, vr(VR::SQ), vm_1, "FiducialSetSequence", "Fiducial Set Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x031E}, vr(VR::SQ), vm_1, "FiducialSequence", "Fiducial Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x031F}, vr(VR::SQ), vm_1, "FiducialsPropertyCategoryCodeSequence", "Fiducials Property Category Code Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0401}, vr(VR::US), vm_3, "GraphicLayerRecommendedDisplayCIELabValue", "Graphic Layer Recommended Display CIELab Value", false},
+    tag_info{dicom_tag{0x0070, 0x0402}, vr(VR::SQ), vm_1, "BlendingSequence", "Blending Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0403}, vr(VR::FL), vm_1, "RelativeOpacity", "Relative Opacity", false},
+    tag_info{dicom_tag{0x0070, 0x0404}, vr(VR::SQ), vm_1, "ReferencedSpatialRegistrationSequence", "Referenced Spatial Registration Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x0405}, vr(VR::CS), vm_1, "BlendingPosition", "Blending Position", false},
+    tag_info{dicom_tag{0x0070, 0x1101}, vr(VR::UI), vm_1, "PresentationDisplayCollectionUID", "Presentation Display Collection UID", false},
+    tag_info{dicom_tag{0x0070, 0x1102}, vr(VR::UI), vm_1, "PresentationSequenceCollectionUID", "Presentation Sequence Collection UID", false},
+    tag_info{dicom_tag{0x0070, 0x1103}, vr(VR::US), vm_1, "PresentationSequencePositionIndex", "Presentation Sequence Position Index", false},
+    tag_info{dicom_tag{0x0070, 0x1104}, vr(VR::SQ), vm_1, "RenderedImageReferenceSequence", "Rendered Image Reference Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1201}, vr(VR::SQ), vm_1, "VolumetricPresentationStateInputSequence", "Volumetric Presentation State Input Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1202}, vr(VR::CS), vm_1, "PresentationInputType", "Presentation Input Type", false},
+    tag_info{dicom_tag{0x0070, 0x1203}, vr(VR::US), vm_1, "InputSequencePositionIndex", "Input Sequence Position Index", false},
+    tag_info{dicom_tag{0x0070, 0x1204}, vr(VR::CS), vm_1, "Crop", "Crop", false},
+    tag_info{dicom_tag{0x0070, 0x1205}, vr(VR::US), vm_1_n, "CroppingSpecificationIndex", "Cropping Specification Index", false},
+    tag_info{dicom_tag{0x0070, 0x1206}, vr(VR::CS), vm_1, "CompositingMethod", "Compositing Method", true},
+    tag_info{dicom_tag{0x0070, 0x1207}, vr(VR::US), vm_1, "VolumetricPresentationInputNumber", "Volumetric Presentation Input Number", false},
+    tag_info{dicom_tag{0x0070, 0x1208}, vr(VR::CS), vm_1, "ImageVolumeGeometry", "Image Volume Geometry", false},
+    tag_info{dicom_tag{0x0070, 0x1209}, vr(VR::UI), vm_1, "VolumetricPresentationInputSetUID", "Volumetric Presentation Input Set UID", false},
+    tag_info{dicom_tag{0x0070, 0x120A}, vr(VR::SQ), vm_1, "VolumetricPresentationInputSetSequence", "Volumetric Presentation Input Set Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x120B}, vr(VR::CS), vm_1, "GlobalCrop", "Global Crop", false},
+    tag_info{dicom_tag{0x0070, 0x120C}, vr(VR::US), vm_1_n, "GlobalCroppingSpecificationIndex", "Global Cropping Specification Index", false},
+    tag_info{dicom_tag{0x0070, 0x120D}, vr(VR::CS), vm_1, "RenderingMethod", "Rendering Method", false},
+    tag_info{dicom_tag{0x0070, 0x1301}, vr(VR::SQ), vm_1, "VolumeCroppingSequence", "Volume Cropping Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1302}, vr(VR::CS), vm_1, "VolumeCroppingMethod", "Volume Cropping Method", false},
+    tag_info{dicom_tag{0x0070, 0x1303}, vr(VR::FD), vm_6, "BoundingBoxCrop", "Bounding Box Crop", false},
+    tag_info{dicom_tag{0x0070, 0x1304}, vr(VR::SQ), vm_1, "ObliqueCroppingPlaneSequence", "Oblique Cropping Plane Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1305}, vr(VR::FD), vm_4, "Plane", "Plane", false},
+    tag_info{dicom_tag{0x0070, 0x1306}, vr(VR::FD), vm_3, "PlaneNormal", "Plane Normal", false},
+    tag_info{dicom_tag{0x0070, 0x1309}, vr(VR::US), vm_1, "CroppingSpecificationNumber", "Cropping Specification Number", false},
+    tag_info{dicom_tag{0x0070, 0x1501}, vr(VR::CS), vm_1, "MultiPlanarReconstructionStyle", "Multi-Planar Reconstruction Style", false},
+    tag_info{dicom_tag{0x0070, 0x1502}, vr(VR::CS), vm_1, "MPRThicknessType", "MPR Thickness Type", false},
+    tag_info{dicom_tag{0x0070, 0x1503}, vr(VR::FD), vm_1, "MPRSlabThickness", "MPR Slab Thickness", false},
+    tag_info{dicom_tag{0x0070, 0x1505}, vr(VR::FD), vm_3, "MPRTopLeftHandCorner", "MPR Top Left Hand Corner", false},
+    tag_info{dicom_tag{0x0070, 0x1507}, vr(VR::FD), vm_3, "MPRViewWidthDirection", "MPR View Width Direction", false},
+    tag_info{dicom_tag{0x0070, 0x1508}, vr(VR::FD), vm_1, "MPRViewWidth", "MPR View Width", false},
+    tag_info{dicom_tag{0x0070, 0x150C}, vr(VR::UL), vm_1, "NumberOfVolumetricCurvePoints", "Number of Volumetric Curve Points", false},
+    tag_info{dicom_tag{0x0070, 0x150D}, vr(VR::OD), vm_1, "VolumetricCurvePoints", "Volumetric Curve Points", false},
+    tag_info{dicom_tag{0x0070, 0x1511}, vr(VR::FD), vm_3, "MPRViewHeightDirection", "MPR View Height Direction", false},
+    tag_info{dicom_tag{0x0070, 0x1512}, vr(VR::FD), vm_1, "MPRViewHeight", "MPR View Height", false},
+    tag_info{dicom_tag{0x0070, 0x1602}, vr(VR::CS), vm_1, "RenderProjection", "Render Projection", false},
+    tag_info{dicom_tag{0x0070, 0x1603}, vr(VR::FD), vm_3, "ViewpointPosition", "Viewpoint Position", false},
+    tag_info{dicom_tag{0x0070, 0x1604}, vr(VR::FD), vm_3, "ViewpointLookAtPoint", "Viewpoint LookAt Point", false},
+    tag_info{dicom_tag{0x0070, 0x1605}, vr(VR::FD), vm_3, "ViewpointUpDirection", "Viewpoint Up Direction", false},
+    tag_info{dicom_tag{0x0070, 0x1606}, vr(VR::FD), vm_6, "RenderFieldOfView", "Render Field of View", false},
+    tag_info{dicom_tag{0x0070, 0x1607}, vr(VR::FD), vm_1, "SamplingStepSize", "Sampling Step Size", false},
+    tag_info{dicom_tag{0x0070, 0x1701}, vr(VR::CS), vm_1, "ShadingStyle", "Shading Style", false},
+    tag_info{dicom_tag{0x0070, 0x1702}, vr(VR::FD), vm_1, "AmbientReflectionIntensity", "Ambient Reflection Intensity", false},
+    tag_info{dicom_tag{0x0070, 0x1703}, vr(VR::FD), vm_3, "LightDirection", "Light Direction", false},
+    tag_info{dicom_tag{0x0070, 0x1704}, vr(VR::FD), vm_1, "DiffuseReflectionIntensity", "Diffuse Reflection Intensity", false},
+    tag_info{dicom_tag{0x0070, 0x1705}, vr(VR::FD), vm_1, "SpecularReflectionIntensity", "Specular Reflection Intensity", false},
+    tag_info{dicom_tag{0x0070, 0x1706}, vr(VR::FD), vm_1, "Shininess", "Shininess", false},
+    tag_info{dicom_tag{0x0070, 0x1801}, vr(VR::SQ), vm_1, "PresentationStateClassificationComponentSequence", "Presentation State Classification Component Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1802}, vr(VR::CS), vm_1, "ComponentType", "Component Type", false},
+    tag_info{dicom_tag{0x0070, 0x1803}, vr(VR::SQ), vm_1, "ComponentInputSequence", "Component Input Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1804}, vr(VR::US), vm_1, "VolumetricPresentationInputIndex", "Volumetric Presentation Input Index", false},
+    tag_info{dicom_tag{0x0070, 0x1805}, vr(VR::SQ), vm_1, "PresentationStateCompositorComponentSequence", "Presentation State Compositor Component Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1806}, vr(VR::SQ), vm_1, "WeightingTransferFunctionSequence", "Weighting Transfer Function Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1807}, vr(VR::US), vm_3, "WeightingLookupTableDescriptor", "Weighting Lookup Table Descriptor", true},
+    tag_info{dicom_tag{0x0070, 0x1808}, vr(VR::OB), vm_1, "WeightingLookupTableData", "Weighting Lookup Table Data", true},
+    tag_info{dicom_tag{0x0070, 0x1901}, vr(VR::SQ), vm_1, "VolumetricAnnotationSequence", "Volumetric Annotation Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1903}, vr(VR::SQ), vm_1, "ReferencedStructuredContextSequence", "Referenced Structured Context Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1904}, vr(VR::UI), vm_1, "ReferencedContentItem", "Referenced Content Item", false},
+    tag_info{dicom_tag{0x0070, 0x1905}, vr(VR::SQ), vm_1, "VolumetricPresentationInputAnnotationSequence", "Volumetric Presentation Input Annotation Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1907}, vr(VR::CS), vm_1, "AnnotationClipping", "Annotation Clipping", false},
+    tag_info{dicom_tag{0x0070, 0x1A01}, vr(VR::CS), vm_1, "PresentationAnimationStyle", "Presentation Animation Style", false},
+    tag_info{dicom_tag{0x0070, 0x1A03}, vr(VR::FD), vm_1, "RecommendedAnimationRate", "Recommended Animation Rate", false},
+    tag_info{dicom_tag{0x0070, 0x1A04}, vr(VR::SQ), vm_1, "AnimationCurveSequence", "Animation Curve Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1A05}, vr(VR::FD), vm_1, "AnimationStepSize", "Animation Step Size", false},
+    tag_info{dicom_tag{0x0070, 0x1A06}, vr(VR::FD), vm_1, "SwivelRange", "Swivel Range", false},
+    tag_info{dicom_tag{0x0070, 0x1A07}, vr(VR::OD), vm_1, "VolumetricCurveUpDirections", "Volumetric Curve Up Directions", false},
+    tag_info{dicom_tag{0x0070, 0x1A08}, vr(VR::SQ), vm_1, "VolumeStreamSequence", "Volume Stream Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1A09}, vr(VR::LO), vm_1, "RGBATransferFunctionDescription", "RGBA Transfer Function Description", false},
+    tag_info{dicom_tag{0x0070, 0x1B01}, vr(VR::SQ), vm_1, "AdvancedBlendingSequence", "Advanced Blending Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1B02}, vr(VR::US), vm_1, "BlendingInputNumber", "Blending Input Number", false},
+    tag_info{dicom_tag{0x0070, 0x1B03}, vr(VR::SQ), vm_1, "BlendingDisplayInputSequence", "Blending Display Input Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1B04}, vr(VR::SQ), vm_1, "BlendingDisplaySequence", "Blending Display Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1B06}, vr(VR::CS), vm_1, "BlendingMode", "Blending Mode", false},
+    tag_info{dicom_tag{0x0070, 0x1B07}, vr(VR::CS), vm_1, "TimeSeriesBlending", "Time Series Blending", false},
+    tag_info{dicom_tag{0x0070, 0x1B08}, vr(VR::CS), vm_1, "GeometryForDisplay", "Geometry for Display", false},
+    tag_info{dicom_tag{0x0070, 0x1B11}, vr(VR::SQ), vm_1, "ThresholdSequence", "Threshold Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1B12}, vr(VR::SQ), vm_1, "ThresholdValueSequence", "Threshold Value Sequence", false},
+    tag_info{dicom_tag{0x0070, 0x1B13}, vr(VR::CS), vm_1, "ThresholdType", "Threshold Type", false},
+    tag_info{dicom_tag{0x0070, 0x1B14}, vr(VR::FD), vm_1, "ThresholdValue", "Threshold Value", false},
+    tag_info{dicom_tag{0x0072, 0x0002}, vr(VR::SH), vm_1, "HangingProtocolName", "Hanging Protocol Name", false},
+    tag_info{dicom_tag{0x0072, 0x0004}, vr(VR::LO), vm_1, "HangingProtocolDescription", "Hanging Protocol Description", false},
+    tag_info{dicom_tag{0x0072, 0x0006}, vr(VR::CS), vm_1, "HangingProtocolLevel", "Hanging Protocol Level", false},
+    tag_info{dicom_tag{0x0072, 0x0008}, vr(VR::LO), vm_1, "HangingProtocolCreator", "Hanging Protocol Creator", false},
+    tag_info{dicom_tag{0x0072, 0x000A}, vr(VR::DT), vm_1, "HangingProtocolCreationDateTime", "Hanging Protocol Creation DateTime", false},
+    tag_info{dicom_tag{0x0072, 0x000C}, vr(VR::SQ), vm_1, "HangingProtocolDefinitionSequence", "Hanging Protocol Definition Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x000E}, vr(VR::SQ), vm_1, "HangingProtocolUserIdentificationCodeSequence", "Hanging Protocol User Identification Code Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0010}, vr(VR::LO), vm_1, "HangingProtocolUserGroupName", "Hanging Protocol User Group Name", false},
+    tag_info{dicom_tag{0x0072, 0x0012}, vr(VR::SQ), vm_1, "SourceHangingProtocolSequence", "Source Hanging Protocol Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0014}, vr(VR::US), vm_1, "NumberOfPriorsReferenced", "Number of Priors Referenced", false},
+    tag_info{dicom_tag{0x0072, 0x0020}, vr(VR::SQ), vm_1, "ImageSetsSequence", "Image Sets Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0022}, vr(VR::SQ), vm_1, "ImageSetSelectorSequence", "Image Set Selector Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0024}, vr(VR::CS), vm_1, "ImageSetSelectorUsageFlag", "Image Set Selector Usage Flag", false},
+    tag_info{dicom_tag{0x0072, 0x0026}, vr(VR::AT), vm_1, "SelectorAttribute", "Selector Attribute", false},
+    tag_info{dicom_tag{0x0072, 0x0028}, vr(VR::US), vm_1, "SelectorValueNumber", "Selector Value Number", false},
+    tag_info{dicom_tag{0x0072, 0x0030}, vr(VR::SQ), vm_1, "TimeBasedImageSetsSequence", "Time Based Image Sets Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0032}, vr(VR::US), vm_1, "ImageSetNumber", "Image Set Number", false},
+    tag_info{dicom_tag{0x0072, 0x0034}, vr(VR::CS), vm_1, "ImageSetSelectorCategory", "Image Set Selector Category", false},
+    tag_info{dicom_tag{0x0072, 0x0038}, vr(VR::US), vm_2, "RelativeTime", "Relative Time", false},
+    tag_info{dicom_tag{0x0072, 0x003A}, vr(VR::CS), vm_1, "RelativeTimeUnits", "Relative Time Units", false},
+    tag_info{dicom_tag{0x0072, 0x003C}, vr(VR::SS), vm_2, "AbstractPriorValue", "Abstract Prior Value", false},
+    tag_info{dicom_tag{0x0072, 0x003E}, vr(VR::SQ), vm_1, "AbstractPriorCodeSequence", "Abstract Prior Code Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0040}, vr(VR::LO), vm_1, "ImageSetLabel", "Image Set Label", false},
+    tag_info{dicom_tag{0x0072, 0x0050}, vr(VR::CS), vm_1, "SelectorAttributeVR", "Selector Attribute VR", false},
+    tag_info{dicom_tag{0x0072, 0x0052}, vr(VR::AT), vm_1_n, "SelectorSequencePointer", "Selector Sequence Pointer", false},
+    tag_info{dicom_tag{0x0072, 0x0054}, vr(VR::LO), vm_1_n, "SelectorSequencePointerPrivateCreator", "Selector Sequence Pointer Private Creator", false},
+    tag_info{dicom_tag{0x0072, 0x0056}, vr(VR::LO), vm_1, "SelectorAttributePrivateCreator", "Selector Attribute Private Creator", false},
+    tag_info{dicom_tag{0x0072, 0x005E}, vr(VR::AE), vm_1_n, "SelectorAEValue", "Selector AE Value", false},
+    tag_info{dicom_tag{0x0072, 0x005F}, vr(VR::AS), vm_1_n, "SelectorASValue", "Selector AS Value", false},
+    tag_info{dicom_tag{0x0072, 0x0060}, vr(VR::AT), vm_1_n, "SelectorATValue", "Selector AT Value", false},
+    tag_info{dicom_tag{0x0072, 0x0061}, vr(VR::DA), vm_1_n, "SelectorDAValue", "Selector DA Value", false},
+    tag_info{dicom_tag{0x0072, 0x0062}, vr(VR::CS), vm_1_n, "SelectorCSValue", "Selector CS Value", false},
+    tag_info{dicom_tag{0x0072, 0x0063}, vr(VR::DT), vm_1_n, "SelectorDTValue", "Selector DT Value", false},
+    tag_info{dicom_tag{0x0072, 0x0064}, vr(VR::IS), vm_1_n, "SelectorISValue", "Selector IS Value", false},
+    tag_info{dicom_tag{0x0072, 0x0065}, vr(VR::OB), vm_1, "SelectorOBValue", "Selector OB Value", false},
+    tag_info{dicom_tag{0x0072, 0x0066}, vr(VR::LO), vm_1_n, "SelectorLOValue", "Selector LO Value", false},
+    tag_info{dicom_tag{0x0072, 0x0067}, vr(VR::OF), vm_1, "SelectorOFValue", "Selector OF Value", false},
+    tag_info{dicom_tag{0x0072, 0x0068}, vr(VR::LT), vm_1, "SelectorLTValue", "Selector LT Value", false},
+    tag_info{dicom_tag{0x0072, 0x0069}, vr(VR::OW), vm_1, "SelectorOWValue", "Selector OW Value", false},
+    tag_info{dicom_tag{0x0072, 0x006A}, vr(VR::PN), vm_1_n, "SelectorPNValue", "Selector PN Value", false},
+    tag_info{dicom_tag{0x0072, 0x006B}, vr(VR::TM), vm_1_n, "SelectorTMValue", "Selector TM Value", false},
+    tag_info{dicom_tag{0x0072, 0x006C}, vr(VR::SH), vm_1_n, "SelectorSHValue", "Selector SH Value", false},
+    tag_info{dicom_tag{0x0072, 0x006D}, vr(VR::UN), vm_1, "SelectorUNValue", "Selector UN Value", false},
+    tag_info{dicom_tag{0x0072, 0x006E}, vr(VR::ST), vm_1, "SelectorSTValue", "Selector ST Value", false},
+    tag_info{dicom_tag{0x0072, 0x006F}, vr(VR::UC), vm_1_n, "SelectorUCValue", "Selector UC Value", false},
+    tag_info{dicom_tag{0x0072, 0x0070}, vr(VR::UT), vm_1, "SelectorUTValue", "Selector UT Value", false},
+    tag_info{dicom_tag{0x0072, 0x0071}, vr(VR::UR), vm_1, "SelectorURValue", "Selector UR Value", false},
+    tag_info{dicom_tag{0x0072, 0x0072}, vr(VR::DS), vm_1_n, "SelectorDSValue", "Selector DS Value", false},
+    tag_info{dicom_tag{0x0072, 0x0073}, vr(VR::OD), vm_1, "SelectorODValue", "Selector OD Value", false},
+    tag_info{dicom_tag{0x0072, 0x0074}, vr(VR::FD), vm_1_n, "SelectorFDValue", "Selector FD Value", false},
+    tag_info{dicom_tag{0x0072, 0x0075}, vr(VR::OL), vm_1, "SelectorOLValue", "Selector OL Value", false},
+    tag_info{dicom_tag{0x0072, 0x0076}, vr(VR::FL), vm_1_n, "SelectorFLValue", "Selector FL Value", false},
+    tag_info{dicom_tag{0x0072, 0x0078}, vr(VR::UL), vm_1_n, "SelectorULValue", "Selector UL Value", false},
+    tag_info{dicom_tag{0x0072, 0x007A}, vr(VR::US), vm_1_n, "SelectorUSValue", "Selector US Value", false},
+    tag_info{dicom_tag{0x0072, 0x007C}, vr(VR::SL), vm_1_n, "SelectorSLValue", "Selector SL Value", false},
+    tag_info{dicom_tag{0x0072, 0x007E}, vr(VR::SS), vm_1_n, "SelectorSSValue", "Selector SS Value", false},
+    tag_info{dicom_tag{0x0072, 0x007F}, vr(VR::UI), vm_1_n, "SelectorUIValue", "Selector UI Value", false},
+    tag_info{dicom_tag{0x0072, 0x0080}, vr(VR::SQ), vm_1, "SelectorCodeSequenceValue", "Selector Code Sequence Value", false},
+    tag_info{dicom_tag{0x0072, 0x0081}, vr(VR::OV), vm_1, "SelectorOVValue", "Selector OV Value", false},
+    tag_info{dicom_tag{0x0072, 0x0082}, vr(VR::SV), vm_1_n, "SelectorSVValue", "Selector SV Value", false},
+    tag_info{dicom_tag{0x0072, 0x0083}, vr(VR::UV), vm_1_n, "SelectorUVValue", "Selector UV Value", false},
+    tag_info{dicom_tag{0x0072, 0x0100}, vr(VR::US), vm_1, "NumberOfScreens", "Number of Screens", false},
+    tag_info{dicom_tag{0x0072, 0x0102}, vr(VR::SQ), vm_1, "NominalScreenDefinitionSequence", "Nominal Screen Definition Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0104}, vr(VR::US), vm_1, "NumberOfVerticalPixels", "Number of Vertical Pixels", false},
+    tag_info{dicom_tag{0x0072, 0x0106}, vr(VR::US), vm_1, "NumberOfHorizontalPixels", "Number of Horizontal Pixels", false},
+    tag_info{dicom_tag{0x0072, 0x0108}, vr(VR::FD), vm_4, "DisplayEnvironmentSpatialPosition", "Display Environment Spatial Position", false},
+    tag_info{dicom_tag{0x0072, 0x010A}, vr(VR::US), vm_1, "ScreenMinimumGrayscaleBitDepth", "Screen Minimum Grayscale Bit Depth", false},
+    tag_info{dicom_tag{0x0072, 0x010C}, vr(VR::US), vm_1, "ScreenMinimumColorBitDepth", "Screen Minimum Color Bit Depth", false},
+    tag_info{dicom_tag{0x0072, 0x010E}, vr(VR::US), vm_1, "ApplicationMaximumRepaintTime", "Application Maximum Repaint Time", false},
+    tag_info{dicom_tag{0x0072, 0x0200}, vr(VR::SQ), vm_1, "DisplaySetsSequence", "Display Sets Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0202}, vr(VR::US), vm_1, "DisplaySetNumber", "Display Set Number", false},
+    tag_info{dicom_tag{0x0072, 0x0203}, vr(VR::LO), vm_1, "DisplaySetLabel", "Display Set Label", false},
+    tag_info{dicom_tag{0x0072, 0x0204}, vr(VR::US), vm_1, "DisplaySetPresentationGroup", "Display Set Presentation Group", false},
+    tag_info{dicom_tag{0x0072, 0x0206}, vr(VR::LO), vm_1, "DisplaySetPresentationGroupDescription", "Display Set Presentation Group Description", false},
+    tag_info{dicom_tag{0x0072, 0x0208}, vr(VR::CS), vm_1, "PartialDataDisplayHandling", "Partial Data Display Handling", false},
+    tag_info{dicom_tag{0x0072, 0x0210}, vr(VR::SQ), vm_1, "SynchronizedScrollingSequence", "Synchronized Scrolling Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0212}, vr(VR::US), vm_2_n, "DisplaySetScrollingGroup", "Display Set Scrolling Group", false},
+    tag_info{dicom_tag{0x0072, 0x0214}, vr(VR::SQ), vm_1, "NavigationIndicatorSequence", "Navigation Indicator Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0216}, vr(VR::US), vm_1, "NavigationDisplaySet", "Navigation Display Set", false},
+    tag_info{dicom_tag{0x0072, 0x0218}, vr(VR::US), vm_1_n, "ReferenceDisplaySets", "Reference Display Sets", false},
+    tag_info{dicom_tag{0x0072, 0x0300}, vr(VR::SQ), vm_1, "ImageBoxesSequence", "Image Boxes Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0302}, vr(VR::US), vm_1, "ImageBoxNumber", "Image Box Number", false},
+    tag_info{dicom_tag{0x0072, 0x0304}, vr(VR::CS), vm_1, "ImageBoxLayoutType", "Image Box Layout Type", false},
+    tag_info{dicom_tag{0x0072, 0x0306}, vr(VR::US), vm_1, "ImageBoxTileHorizontalDimension", "Image Box Tile Horizontal Dimension", false},
+    tag_info{dicom_tag{0x0072, 0x0308}, vr(VR::US), vm_1, "ImageBoxTileVerticalDimension", "Image Box Tile Vertical Dimension", false},
+    tag_info{dicom_tag{0x0072, 0x0310}, vr(VR::CS), vm_1, "ImageBoxScrollDirection", "Image Box Scroll Direction", false},
+    tag_info{dicom_tag{0x0072, 0x0312}, vr(VR::CS), vm_1, "ImageBoxSmallScrollType", "Image Box Small Scroll Type", false},
+    tag_info{dicom_tag{0x0072, 0x0314}, vr(VR::US), vm_1, "ImageBoxSmallScrollAmount", "Image Box Small Scroll Amount", false},
+    tag_info{dicom_tag{0x0072, 0x0316}, vr(VR::CS), vm_1, "ImageBoxLargeScrollType", "Image Box Large Scroll Type", false},
+    tag_info{dicom_tag{0x0072, 0x0318}, vr(VR::US), vm_1, "ImageBoxLargeScrollAmount", "Image Box Large Scroll Amount", false},
+    tag_info{dicom_tag{0x0072, 0x0320}, vr(VR::US), vm_1, "ImageBoxOverlapPriority", "Image Box Overlap Priority", false},
+    tag_info{dicom_tag{0x0072, 0x0330}, vr(VR::FD), vm_1, "CineRelativeToRealTime", "Cine Relative to Real-Time", false},
+    tag_info{dicom_tag{0x0072, 0x0400}, vr(VR::SQ), vm_1, "FilterOperationsSequence", "Filter Operations Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0402}, vr(VR::CS), vm_1, "FilterByCategory", "Filter-by Category", false},
+    tag_info{dicom_tag{0x0072, 0x0404}, vr(VR::CS), vm_1, "FilterByAttributePresence", "Filter-by Attribute Presence", false},
+    tag_info{dicom_tag{0x0072, 0x0406}, vr(VR::CS), vm_1, "FilterByOperator", "Filter-by Operator", false},
+    tag_info{dicom_tag{0x0072, 0x0420}, vr(VR::US), vm_3, "StructuredDisplayBackgroundCIELabValue", "Structured Display Background CIELab Value", false},
+    tag_info{dicom_tag{0x0072, 0x0421}, vr(VR::US), vm_3, "EmptyImageBoxCIELabValue", "Empty Image Box CIELab Value", false},
+    tag_info{dicom_tag{0x0072, 0x0422}, vr(VR::SQ), vm_1, "StructuredDisplayImageBoxSequence", "Structured Display Image Box Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0424}, vr(VR::SQ), vm_1, "StructuredDisplayTextBoxSequence", "Structured Display Text Box Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0427}, vr(VR::SQ), vm_1, "ReferencedFirstFrameSequence", "Referenced First Frame Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0430}, vr(VR::SQ), vm_1, "ImageBoxSynchronizationSequence", "Image Box Synchronization Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0432}, vr(VR::US), vm_2_n, "SynchronizedImageBoxList", "Synchronized Image Box List", false},
+    tag_info{dicom_tag{0x0072, 0x0434}, vr(VR::CS), vm_1, "TypeOfSynchronization", "Type of Synchronization", false},
+    tag_info{dicom_tag{0x0072, 0x0500}, vr(VR::CS), vm_1, "BlendingOperationType", "Blending Operation Type", false},
+    tag_info{dicom_tag{0x0072, 0x0510}, vr(VR::CS), vm_1, "ReformattingOperationType", "Reformatting Operation Type", false},
+    tag_info{dicom_tag{0x0072, 0x0512}, vr(VR::FD), vm_1, "ReformattingThickness", "Reformatting Thickness", false},
+    tag_info{dicom_tag{0x0072, 0x0514}, vr(VR::FD), vm_1, "ReformattingInterval", "Reformatting Interval", false},
+    tag_info{dicom_tag{0x0072, 0x0516}, vr(VR::CS), vm_1, "ReformattingOperationInitialViewDirection", "Reformatting Operation Initial View Direction", false},
+    tag_info{dicom_tag{0x0072, 0x0520}, vr(VR::CS), vm_1_n, "ThreeDRenderingType", "3D Rendering Type", false},
+    tag_info{dicom_tag{0x0072, 0x0600}, vr(VR::SQ), vm_1, "SortingOperationsSequence", "Sorting Operations Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0602}, vr(VR::CS), vm_1, "SortByCategory", "Sort-by Category", false},
+    tag_info{dicom_tag{0x0072, 0x0604}, vr(VR::CS), vm_1, "SortingDirection", "Sorting Direction", false},
+    tag_info{dicom_tag{0x0072, 0x0700}, vr(VR::CS), vm_2, "DisplaySetPatientOrientation", "Display Set Patient Orientation", false},
+    tag_info{dicom_tag{0x0072, 0x0702}, vr(VR::CS), vm_1, "VOIType", "VOI Type", false},
+    tag_info{dicom_tag{0x0072, 0x0704}, vr(VR::CS), vm_1, "PseudoColorType", "Pseudo-Color Type", false},
+    tag_info{dicom_tag{0x0072, 0x0705}, vr(VR::SQ), vm_1, "PseudoColorPaletteInstanceReferenceSequence", "Pseudo-Color Palette Instance Reference Sequence", false},
+    tag_info{dicom_tag{0x0072, 0x0706}, vr(VR::CS), vm_1, "ShowGrayscaleInverted", "Show Grayscale Inverted", false},
+    tag_info{dicom_tag{0x0072, 0x0710}, vr(VR::CS), vm_1, "ShowImageTrueSizeFlag", "Show Image True Size Flag", false},
+    tag_info{dicom_tag{0x0072, 0x0712}, vr(VR::CS), vm_1, "ShowGraphicAnnotationFlag", "Show Graphic Annotation Flag", false},
+    tag_info{dicom_tag{0x0072, 0x0714}, vr(VR::CS), vm_1, "ShowPatientDemographicsFlag", "Show Patient Demographics Flag", false},
+    tag_info{dicom_tag{0x0072, 0x0716}, vr(VR::CS), vm_1, "ShowAcquisitionTechniquesFlag", "Show Acquisition Techniques Flag", false},
+    tag_info{dicom_tag{0x0072, 0x0717}, vr(VR::CS), vm_1, "DisplaySetHorizontalJustification", "Display Set Horizontal Justification", false},
+    tag_info{dicom_tag{0x0072, 0x0718}, vr(VR::CS), vm_1, "DisplaySetVerticalJustification", "Display Set Vertical Justification", false},
+    tag_info{dicom_tag{0x0074, 0x0120}, vr(VR::FD), vm_1, "ContinuationStartMeterset", "Continuation Start Meterset", false},
+    tag_info{dicom_tag{0x0074, 0x0121}, vr(VR::FD), vm_1, "ContinuationEndMeterset", "Continuation End Meterset", false},
+    tag_info{dicom_tag{0x0074, 0x1000}, vr(VR::CS), vm_1, "ProcedureStepState", "Procedure Step State", false},
+    tag_info{dicom_tag{0x0074, 0x1002}, vr(VR::SQ), vm_1, "ProcedureStepProgressInformationSequence", "Procedure Step Progress Information Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1004}, vr(VR::DS), vm_1, "ProcedureStepProgress", "Procedure Step Progress", false},
+    tag_info{dicom_tag{0x0074, 0x1006}, vr(VR::ST), vm_1, "ProcedureStepProgressDescription", "Procedure Step Progress Description", false},
+    tag_info{dicom_tag{0x0074, 0x1007}, vr(VR::SQ), vm_1, "ProcedureStepProgressParametersSequence", "Procedure Step Progress Parameters Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1008}, vr(VR::SQ), vm_1, "ProcedureStepCommunicationsURISequence", "Procedure Step Communications URI Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x100A}, vr(VR::UR), vm_1, "ContactURI", "Contact URI", false},
+    tag_info{dicom_tag{0x0074, 0x100C}, vr(VR::LO), vm_1, "ContactDisplayName", "Contact Display Name", false},
+    tag_info{dicom_tag{0x0074, 0x100E}, vr(VR::SQ), vm_1, "ProcedureStepDiscontinuationReasonCodeSequence", "Procedure Step Discontinuation Reason Code Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1020}, vr(VR::SQ), vm_1, "BeamTaskSequence", "Beam Task Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1022}, vr(VR::CS), vm_1, "BeamTaskType", "Beam Task Type", false},
+    tag_info{dicom_tag{0x0074, 0x1024}, vr(VR::IS), vm_1, "BeamOrderIndexTrial", "Beam Order Index (Trial)", true},
+    tag_info{dicom_tag{0x0074, 0x1025}, vr(VR::CS), vm_1, "AutosequenceFlag", "Autosequence Flag", false},
+    tag_info{dicom_tag{0x0074, 0x1026}, vr(VR::FD), vm_1, "TableTopVerticalAdjustedPosition", "Table Top Vertical Adjusted Position", false},
+    tag_info{dicom_tag{0x0074, 0x1027}, vr(VR::FD), vm_1, "TableTopLongitudinalAdjustedPosition", "Table Top Longitudinal Adjusted Position", false},
+    tag_info{dicom_tag{0x0074, 0x1028}, vr(VR::FD), vm_1, "TableTopLateralAdjustedPosition", "Table Top Lateral Adjusted Position", false},
+    tag_info{dicom_tag{0x0074, 0x102A}, vr(VR::FD), vm_1, "PatientSupportAdjustedAngle", "Patient Support Adjusted Angle", false},
+    tag_info{dicom_tag{0x0074, 0x102B}, vr(VR::FD), vm_1, "TableTopEccentricAdjustedAngle", "Table Top Eccentric Adjusted Angle", false},
+    tag_info{dicom_tag{0x0074, 0x102C}, vr(VR::FD), vm_1, "TableTopPitchAdjustedAngle", "Table Top Pitch Adjusted Angle", false},
+    tag_info{dicom_tag{0x0074, 0x102D}, vr(VR::FD), vm_1, "TableTopRollAdjustedAngle", "Table Top Roll Adjusted Angle", false},
+    tag_info{dicom_tag{0x0074, 0x1030}, vr(VR::SQ), vm_1, "DeliveryVerificationImageSequence", "Delivery Verification Image Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1032}, vr(VR::CS), vm_1, "VerificationImageTiming", "Verification Image Timing", false},
+    tag_info{dicom_tag{0x0074, 0x1034}, vr(VR::CS), vm_1, "DoubleExposureFlag", "Double Exposure Flag", false},
+    tag_info{dicom_tag{0x0074, 0x1036}, vr(VR::CS), vm_1, "DoubleExposureOrdering", "Double Exposure Ordering", false},
+    tag_info{dicom_tag{0x0074, 0x1038}, vr(VR::DS), vm_1, "DoubleExposureMetersetTrial", "Double Exposure Meterset (Trial)", true},
+    tag_info{dicom_tag{0x0074, 0x103A}, vr(VR::DS), vm_4, "DoubleExposureFieldDeltaTrial", "Double Exposure Field Delta (Trial)", true},
+    tag_info{dicom_tag{0x0074, 0x1040}, vr(VR::SQ), vm_1, "RelatedReferenceRTImageSequence", "Related Reference RT Image Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1042}, vr(VR::SQ), vm_1, "GeneralMachineVerificationSequence", "General Machine Verification Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1044}, vr(VR::SQ), vm_1, "ConventionalMachineVerificationSequence", "Conventional Machine Verification Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1046}, vr(VR::SQ), vm_1, "IonMachineVerificationSequence", "Ion Machine Verification Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1048}, vr(VR::SQ), vm_1, "FailedAttributesSequence", "Failed Attributes Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x104A}, vr(VR::SQ), vm_1, "OverriddenAttributesSequence", "Overridden Attributes Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x104C}, vr(VR::SQ), vm_1, "ConventionalControlPointVerificationSequence", "Conventional Control Point Verification Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x104E}, vr(VR::SQ), vm_1, "IonControlPointVerificationSequence", "Ion Control Point Verification Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1050}, vr(VR::SQ), vm_1, "AttributeOccurrenceSequence", "Attribute Occurrence Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1052}, vr(VR::AT), vm_1, "AttributeOccurrencePointer", "Attribute Occurrence Pointer", false},
+    tag_info{dicom_tag{0x0074, 0x1054}, vr(VR::UL), vm_1, "AttributeItemSelector", "Attribute Item Selector", false},
+    tag_info{dicom_tag{0x0074, 0x1056}, vr(VR::LO), vm_1, "AttributeOccurrencePrivateCreator", "Attribute Occurrence Private Creator", false},
+    tag_info{dicom_tag{0x0074, 0x1057}, vr(VR::IS), vm_1_n, "SelectorSequencePointerItems", "Selector Sequence Pointer Items", false},
+    tag_info{dicom_tag{0x0074, 0x1200}, vr(VR::CS), vm_1, "ScheduledProcedureStepPriority", "Scheduled Procedure Step Priority", false},
+    tag_info{dicom_tag{0x0074, 0x1202}, vr(VR::LO), vm_1, "WorklistLabel", "Worklist Label", false},
+    tag_info{dicom_tag{0x0074, 0x1204}, vr(VR::LO), vm_1, "ProcedureStepLabel", "Procedure Step Label", false},
+    tag_info{dicom_tag{0x0074, 0x1210}, vr(VR::SQ), vm_1, "ScheduledProcessingParametersSequence", "Scheduled Processing Parameters Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1212}, vr(VR::SQ), vm_1, "PerformedProcessingParametersSequence", "Performed Processing Parameters Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1216}, vr(VR::SQ), vm_1, "UnifiedProcedureStepPerformedProcedureSequence", "Unified Procedure Step Performed Procedure Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1220}, vr(VR::SQ), vm_1, "RelatedProcedureStepSequence", "Related Procedure Step Sequence", true},
+    tag_info{dicom_tag{0x0074, 0x1222}, vr(VR::LO), vm_1, "ProcedureStepRelationshipType", "Procedure Step Relationship Type", true},
+    tag_info{dicom_tag{0x0074, 0x1224}, vr(VR::SQ), vm_1, "ReplacedProcedureStepSequence", "Replaced Procedure Step Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1230}, vr(VR::LO), vm_1, "DeletionLock", "Deletion Lock", false},
+    tag_info{dicom_tag{0x0074, 0x1234}, vr(VR::AE), vm_1, "ReceivingAE", "Receiving AE", false},
+    tag_info{dicom_tag{0x0074, 0x1236}, vr(VR::AE), vm_1, "RequestingAE", "Requesting AE", false},
+    tag_info{dicom_tag{0x0074, 0x1238}, vr(VR::LT), vm_1, "ReasonForCancellation", "Reason for Cancellation", false},
+    tag_info{dicom_tag{0x0074, 0x1242}, vr(VR::CS), vm_1, "SCPStatus", "SCP Status", false},
+    tag_info{dicom_tag{0x0074, 0x1244}, vr(VR::CS), vm_1, "SubscriptionListStatus", "Subscription List Status", false},
+    tag_info{dicom_tag{0x0074, 0x1246}, vr(VR::CS), vm_1, "UnifiedProcedureStepListStatus", "Unified Procedure Step List Status", false},
+    tag_info{dicom_tag{0x0074, 0x1324}, vr(VR::UL), vm_1, "BeamOrderIndex", "Beam Order Index", false},
+    tag_info{dicom_tag{0x0074, 0x1338}, vr(VR::FD), vm_1, "DoubleExposureMeterset", "Double Exposure Meterset", false},
+    tag_info{dicom_tag{0x0074, 0x133A}, vr(VR::FD), vm_4, "DoubleExposureFieldDelta", "Double Exposure Field Delta", false},
+    tag_info{dicom_tag{0x0074, 0x1401}, vr(VR::SQ), vm_1, "BrachyTaskSequence", "Brachy Task Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1402}, vr(VR::DS), vm_1, "ContinuationStartTotalReferenceAirKerma", "Continuation Start Total Reference Air Kerma", false},
+    tag_info{dicom_tag{0x0074, 0x1403}, vr(VR::DS), vm_1, "ContinuationEndTotalReferenceAirKerma", "Continuation End Total Reference Air Kerma", false},
+    tag_info{dicom_tag{0x0074, 0x1404}, vr(VR::IS), vm_1, "ContinuationPulseNumber", "Continuation Pulse Number", false},
+    tag_info{dicom_tag{0x0074, 0x1405}, vr(VR::SQ), vm_1, "ChannelDeliveryOrderSequence", "Channel Delivery Order Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x1406}, vr(VR::IS), vm_1, "ReferencedChannelNumber", "Referenced Channel Number", false},
+    tag_info{dicom_tag{0x0074, 0x1407}, vr(VR::DS), vm_1, "StartCumulativeTimeWeight", "Start Cumulative Time Weight", false},
+    tag_info{dicom_tag{0x0074, 0x1408}, vr(VR::DS), vm_1, "EndCumulativeTimeWeight", "End Cumulative Time Weight", false},
+    tag_info{dicom_tag{0x0074, 0x1409}, vr(VR::SQ), vm_1, "OmittedChannelSequence", "Omitted Channel Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x140A}, vr(VR::CS), vm_1, "ReasonForChannelOmission", "Reason for Channel Omission", false},
+    tag_info{dicom_tag{0x0074, 0x140B}, vr(VR::LO), vm_1, "ReasonForChannelOmissionDescription", "Reason for Channel Omission Description", false},
+    tag_info{dicom_tag{0x0074, 0x140C}, vr(VR::IS), vm_1, "ChannelDeliveryOrderIndex", "Channel Delivery Order Index", false},
+    tag_info{dicom_tag{0x0074, 0x140D}, vr(VR::SQ), vm_1, "ChannelDeliveryContinuationSequence", "Channel Delivery Continuation Sequence", false},
+    tag_info{dicom_tag{0x0074, 0x140E}, vr(VR::SQ), vm_1, "OmittedApplicationSetupSequence", "Omitted Application Setup Sequence", false},
+    tag_info{dicom_tag{0x0076, 0x0001}, vr(VR::LO), vm_1, "ImplantAssemblyTemplateName", "Implant Assembly Template Name", false},
+    tag_info{dicom_tag{0x0076, 0x0003}, vr(VR::LO), vm_1, "ImplantAssemblyTemplateIssuer", "Implant Assembly Template Issuer", false},
+    tag_info{dicom_tag{0x0076, 0x0006}, vr(VR::LO), vm_1, "ImplantAssemblyTemplateVersion", "Implant Assembly Template Version", false},
+    tag_info{dicom_tag{0x0076, 0x0008}, vr(VR::SQ), vm_1, "ReplacedImplantAssemblyTemplateSequence", "Replaced Implant Assembly Template Sequence", false},
+    tag_info{dicom_tag{0x0076, 0x000A}, vr(VR::CS), vm_1, "ImplantAssemblyTemplateType", "Implant Assembly Template Type", false},
+    tag_info{dicom_tag{0x0076, 0x000C}, vr(VR::SQ), vm_1, "OriginalImplantAssemblyTemplateSequence", "Original Implant Assembly Template Sequence", false},
+    tag_info{dicom_tag{0x0076, 0x000E}, vr(VR::SQ), vm_1, "DerivationImplantAssemblyTemplateSequence", "Derivation Implant Assembly Template Sequence", false},
+    tag_info{dicom_tag{0x0076, 0x0010}, vr(VR::SQ), vm_1, "ImplantAssemblyTemplateTargetAnatomySequence", "Implant Assembly Template Target Anatomy Sequence", false},
+    tag_info{dicom_tag{0x0076, 0x0020}, vr(VR::SQ), vm_1, "ProcedureTypeCodeSequence", "Procedure Type Code Sequence", false},
+    tag_info{dicom_tag{0x0076, 0x0030}, vr(VR::LO), vm_1, "SurgicalTechnique", "Surgical Technique", false},
+    tag_info{dicom_tag{0x0076, 0x0032}, vr(VR::SQ), vm_1, "ComponentTypesSequence", "Component Types Sequence", false},
+    tag_info{dicom_tag{0x0076, 0x0034}, vr(VR::SQ), vm_1, "ComponentTypeCodeSequence", "Component Type Code Sequence", false},
+    tag_info{dicom_tag{0x0076, 0x0036}, vr(VR::CS), vm_1, "ExclusiveComponentType", "Exclusive Component Type", false},
+    tag_info{dicom_tag{0x0076, 0x0038}, vr(VR::CS), vm_1, "MandatoryComponentType", "Mandatory Component Type", false},
+    tag_info{dicom_tag{0x0076, 0x0040}, vr(VR::SQ), vm_1, "ComponentSequence", "Component Sequence", false},
+    tag_info{dicom_tag{0x0076, 0x0055}, vr(VR::US), vm_1, "ComponentID", "Component ID", false},
+    tag_info{dicom_tag{0x0076, 0x0060}, vr(VR::SQ), vm_1, "ComponentAssemblySequence", "Component Assembly Sequence", false},
+    tag_info{dicom_tag{0x0076, 0x0070}, vr(VR::US), vm_1, "Component1ReferencedID", "Component 1 Referenced ID", false},
+    tag_info{dicom_tag{0x0076, 0x0080}, vr(VR::US), vm_1, "Component1ReferencedMatingFeatureSetID", "Component 1 Referenced Mating Feature Set ID", false},
+    tag_info{dicom_tag{0x0076, 0x0090}, vr(VR::US), vm_1, "Component1ReferencedMatingFeatureID", "Component 1 Referenced Mating Feature ID", false},
+    tag_info{dicom_tag{0x0076, 0x00A0}, vr(VR::US), vm_1, "Component2ReferencedID", "Component 2 Referenced ID", false},
+    tag_info{dicom_tag{0x0076, 0x00B0}, vr(VR::US), vm_1, "Component2ReferencedMatingFeatureSetID", "Component 2 Referenced Mating Feature Set ID", false},
+    tag_info{dicom_tag{0x0076, 0x00C0}, vr(VR::US), vm_1, "Component2ReferencedMatingFeatureID", "Component 2 Referenced Mating Feature ID", false},
+    tag_info{dicom_tag{0x0078, 0x0001}, vr(VR::LO), vm_1, "ImplantTemplateGroupName", "Implant Template Group Name", false},
+    tag_info{dicom_tag{0x0078, 0x0010}, vr(VR::ST), vm_1, "ImplantTemplateGroupDescription", "Implant Template Group Description", false},
+    tag_info{dicom_tag{0x0078, 0x0020}, vr(VR::LO), vm_1, "ImplantTemplateGroupIssuer", "Implant Template Group Issuer", false},
+    tag_info{dicom_tag{0x0078, 0x0024}, vr(VR::LO), vm_1, "ImplantTemplateGroupVersion", "Implant Template Group Version", false},
+    tag_info{dicom_tag{0x0078, 0x0026}, vr(VR::SQ), vm_1, "ReplacedImplantTemplateGroupSequence", "Replaced Implant Template Group Sequence", false},
+    tag_info{dicom_tag{0x0078, 0x0028}, vr(VR::SQ), vm_1, "ImplantTemplateGroupTargetAnatomySequence", "Implant Template Group Target Anatomy Sequence", false},
+    tag_info{dicom_tag{0x0078, 0x002A}, vr(VR::SQ), vm_1, "ImplantTemplateGroupMembersSequence", "Implant Template Group Members Sequence", false},
+    tag_info{dicom_tag{0x0078, 0x002E}, vr(VR::US), vm_1, "ImplantTemplateGroupMemberID", "Implant Template Group Member ID", false},
+    tag_info{dicom_tag{0x0078, 0x0050}, vr(VR::FD), vm_3, "ThreeDImplantTemplateGroupMemberMatchingPoint", "3D Implant Template Group Member Matching Point", false},
+    tag_info{dicom_tag{0x0078, 0x0060}, vr(VR::FD), vm_9, "ThreeDImplantTemplateGroupMemberMatchingAxes", "3D Implant Template Group Member Matching Axes", false},
+    tag_info{dicom_tag{0x0078, 0x0070}, vr(VR::SQ), vm_1, "ImplantTemplateGroupMemberMatching2DCoordinatesSequence", "Implant Template Group Member Matching 2D Coordinates Sequence", false},
+    tag_info{dicom_tag{0x0078, 0x0090}, vr(VR::FD), vm_2, "TwoDImplantTemplateGroupMemberMatchingPoint", "2D Implant Template Group Member Matching Point", false},
+    tag_info{dicom_tag{0x0078, 0x00A0}, vr(VR::FD), vm_4, "TwoDImplantTemplateGroupMemberMatchingAxes", "2D Implant Template Group Member Matching Axes", false},
+    tag_info{dicom_tag{0x0078, 0x00B0}, vr(VR::SQ), vm_1, "ImplantTemplateGroupVariationDimensionSequence", "Implant Template Group Variation Dimension Sequence", false},
+    tag_info{dicom_tag{0x0078, 0x00B2}, vr(VR::LO), vm_1, "ImplantTemplateGroupVariationDimensionName", "Implant Template Group Variation Dimension Name", false},
+    tag_info{dicom_tag{0x0078, 0x00B4}, vr(VR::SQ), vm_1, "ImplantTemplateGroupVariationDimensionRankSequence", "Implant Template Group Variation Dimension Rank Sequence", false},
+    tag_info{dicom_tag{0x0078, 0x00B6}, vr(VR::US), vm_1, "ReferencedImplantTemplateGroupMemberID", "Referenced Implant Template Group Member ID", false},
+    tag_info{dicom_tag{0x0078, 0x00B8}, vr(VR::US), vm_1, "ImplantTemplateGroupVariationDimensionRank", "Implant Template Group Variation Dimension Rank", false},
+    tag_info{dicom_tag{0x0080, 0x0001}, vr(VR::SQ), vm_1, "SurfaceScanAcquisitionTypeCodeSequence", "Surface Scan Acquisition Type Code Sequence", false},
+    tag_info{dicom_tag{0x0080, 0x0002}, vr(VR::SQ), vm_1, "SurfaceScanModeCodeSequence", "Surface Scan Mode Code Sequence", false},
+    tag_info{dicom_tag{0x0080, 0x0003}, vr(VR::SQ), vm_1, "RegistrationMethodCodeSequence", "Registration Method Code Sequence", false},
+    tag_info{dicom_tag{0x0080, 0x0004}, vr(VR::FD), vm_1, "ShotDurationTime", "Shot Duration Time", false},
+    tag_info{dicom_tag{0x0080, 0x0005}, vr(VR::FD), vm_1, "ShotOffsetTime", "Shot Offset Time", false},
+    tag_info{dicom_tag{0x0080, 0x0006}, vr(VR::US), vm_1_n, "SurfacePointPresentationValueData", "Surface Point Presentation Value Data", false},
+    tag_info{dicom_tag{0x0080, 0x0007}, vr(VR::US), vm_3_3n, "SurfacePointColorCIELabValueData", "Surface Point Color CIELab Value Data", false},
+    tag_info{dicom_tag{0x0080, 0x0008}, vr(VR::SQ), vm_1, "UVMappingSequence", "UV Mapping Sequence", false},
+    tag_info{dicom_tag{0x0080, 0x0009}, vr(VR::SH), vm_1, "TextureLabel", "Texture Label", false},
+    tag_info{dicom_tag{0x0080, 0x0010}, vr(VR::OF), vm_1, "UValueData", "U Value Data", false},
+    tag_info{dicom_tag{0x0080, 0x0011}, vr(VR::OF), vm_1, "VValueData", "V Value Data", false},
+    tag_info{dicom_tag{0x0080, 0x0012}, vr(VR::SQ), vm_1, "ReferencedTextureSequence", "Referenced Texture Sequence", false},
+    tag_info{dicom_tag{0x0080, 0x0013}, vr(VR::SQ), vm_1, "ReferencedSurfaceDataSequence", "Referenced Surface Data Sequence", false},
+    tag_info{dicom_tag{0x0082, 0x0001}, vr(VR::CS), vm_1, "AssessmentSummary", "Assessment Summary", false},
+    tag_info{dicom_tag{0x0082, 0x0003}, vr(VR::UT), vm_1, "AssessmentSummaryDescription", "Assessment Summary Description", false},
+    tag_info{dicom_tag{0x0082, 0x0004}, vr(VR::SQ), vm_1, "AssessedSOPInstanceSequence", "Assessed SOP Instance Sequence", false},
+    tag_info{dicom_tag{0x0082, 0x0005}, vr(VR::SQ), vm_1, "ReferencedComparisonSOPInstanceSequence", "Referenced Comparison SOP Instance Sequence", false},
+    tag_info{dicom_tag{0x0082, 0x0006}, vr(VR::UL), vm_1, "NumberOfAssessmentObservations", "Number of Assessment Observations", false},
+    tag_info{dicom_tag{0x0082, 0x0007}, vr(VR::SQ), vm_1, "AssessmentObservationsSequence", "Assessment Observations Sequence", false},
+    tag_info{dicom_tag{0x0082, 0x0008}, vr(VR::CS), vm_1, "ObservationSignificance", "Observation Significance", false},
+    tag_info{dicom_tag{0x0082, 0x000A}, vr(VR::UT), vm_1, "ObservationDescription", "Observation Description", false},
+    tag_info{dicom_tag{0x0082, 0x000C}, vr(VR::SQ), vm_1, "StructuredConstraintObservationSequence", "Structured Constraint Observation Sequence", false},
+    tag_info{dicom_tag{0x0082, 0x0010}, vr(VR::SQ), vm_1, "AssessedAttributeValueSequence", "Assessed Attribute Value Sequence", false},
+    tag_info{dicom_tag{0x0082, 0x0016}, vr(VR::LO), vm_1, "AssessmentSetID", "Assessment Set ID", false},
+    tag_info{dicom_tag{0x0082, 0x0017}, vr(VR::SQ), vm_1, "AssessmentRequesterSequence", "Assessment Requester Sequence", false},
+    tag_info{dicom_tag{0x0082, 0x0018}, vr(VR::LO), vm_1, "SelectorAttributeName", "Selector Attribute Name", false},
+    tag_info{dicom_tag{0x0082, 0x0019}, vr(VR::LO), vm_1, "SelectorAttributeKeyword", "Selector Attribute Keyword", false},
+    tag_info{dicom_tag{0x0082, 0x0021}, vr(VR::SQ), vm_1, "AssessmentTypeCodeSequence", "Assessment Type Code Sequence", false},
+    tag_info{dicom_tag{0x0082, 0x0022}, vr(VR::SQ), vm_1, "ObservationBasisCodeSequence", "Observation Basis Code Sequence", false},
+    tag_info{dicom_tag{0x0082, 0x0023}, vr(VR::LO), vm_1, "AssessmentLabel", "Assessment Label", false},
+    tag_info{dicom_tag{0x0082, 0x0032}, vr(VR::CS), vm_1, "ConstraintType", "Constraint Type", false},
+    tag_info{dicom_tag{0x0082, 0x0033}, vr(VR::UT), vm_1, "SpecificationSelectionGuidance", "Specification Selection Guidance", false},
+    tag_info{dicom_tag{0x0082, 0x0034}, vr(VR::SQ), vm_1, "ConstraintValueSequence", "Constraint Value Sequence", false},
+    tag_info{dicom_tag{0x0082, 0x0035}, vr(VR::SQ), vm_1, "RecommendedDefaultValueSequence", "Recommended Default Value Sequence", false},
+    tag_info{dicom_tag{0x0082, 0x0036}, vr(VR::CS), vm_1, "ConstraintViolationSignificance", "Constraint Violation Significance", false},
+    tag_info{dicom_tag{0x0082, 0x0037}, vr(VR::UT), vm_1, "ConstraintViolationCondition", "Constraint Violation Condition", false},
+    tag_info{dicom_tag{0x0082, 0x0038}, vr(VR::CS), vm_1, "ModifiableConstraintFlag", "Modifiable Constraint Flag", false},
+    tag_info{dicom_tag{0x0088, 0x0130}, vr(VR::SH), vm_1, "StorageMediaFileSetID", "Storage Media File-set ID", false},
+    tag_info{dicom_tag{0x0088, 0x0140}, vr(VR::UI), vm_1, "StorageMediaFileSetUID", "Storage Media File-set UID", false},
+    tag_info{dicom_tag{0x0088, 0x0200}, vr(VR::SQ), vm_1, "IconImageSequence", "Icon Image Sequence", false},
+    tag_info{dicom_tag{0x0088, 0x0904}, vr(VR::LO), vm_1, "TopicTitle", "Topic Title", true},
+    tag_info{dicom_tag{0x0088, 0x0906}, vr(VR::ST), vm_1, "TopicSubject", "Topic Subject", true},
+    tag_info{dicom_tag{0x0088, 0x0910}, vr(VR::LO), vm_1, "TopicAuthor", "Topic Author", true},
+    tag_info{dicom_tag{0x0088, 0x0912}, vr(VR::LO), vm_1_32, "TopicKeywords", "Topic Keywords", true},
+    tag_info{dicom_tag{0x0100, 0x0410}, vr(VR::CS), vm_1, "SOPInstanceStatus", "SOP Instance Status", false},
+    tag_info{dicom_tag{0x0100, 0x0420}, vr(VR::DT), vm_1, "SOPAuthorizationDateTime", "SOP Authorization DateTime", false},
+    tag_info{dicom_tag{0x0100, 0x0424}, vr(VR::LT), vm_1, "SOPAuthorizationComment", "SOP Authorization Comment", false},
+    tag_info{dicom_tag{0x0100, 0x0426}, vr(VR::LO), vm_1, "AuthorizationEquipmentCertificationNumber", "Authorization Equipment Certification Number", false},
+    tag_info{dicom_tag{0x0400, 0x0005}, vr(VR::US), vm_1, "MACIDNumber", "MAC ID Number", false},
+    tag_info{dicom_tag{0x0400, 0x0010}, vr(VR::UI), vm_1, "MACCalculationTransferSyntaxUID", "MAC Calculation Transfer Syntax UID", false},
+    tag_info{dicom_tag{0x0400, 0x0015}, vr(VR::CS), vm_1, "MACAlgorithm", "MAC Algorithm", false},
+    tag_info{dicom_tag{0x0400, 0x0020}, vr(VR::AT), vm_1_n, "DataElementsSigned", "Data Elements Signed", false},
+    tag_info{dicom_tag{0x0400, 0x0100}, vr(VR::UI), vm_1, "DigitalSignatureUID", "Digital Signature UID", false},
+    tag_info{dicom_tag{0x0400, 0x0105}, vr(VR::DT), vm_1, "DigitalSignatureDateTime", "Digital Signature DateTime", false},
+    tag_info{dicom_tag{0x0400, 0x0110}, vr(VR::CS), vm_1, "CertificateType", "Certificate Type", false},
+    tag_info{dicom_tag{0x0400, 0x0115}, vr(VR::OB), vm_1, "CertificateOfSigner", "Certificate of Signer", false},
+    tag_info{dicom_tag{0x0400, 0x0120}, vr(VR::OB), vm_1, "Signature", "Signature", false},
+    tag_info{dicom_tag{0x0400, 0x0305}, vr(VR::CS), vm_1, "CertifiedTimestampType", "Certified Timestamp Type", false},
+    tag_info{dicom_tag{0x0400, 0x0310}, vr(VR::OB), vm_1, "CertifiedTimestamp", "Certified Timestamp", false},
+    tag_info{dicom_tag{0x0400, 0x0315}, vr(VR::FL), vm_1, "", "", true},
+    tag_info{dicom_tag{0x0400, 0x0401}, vr(VR::SQ), vm_1, "DigitalSignaturePurposeCodeSequence", "Digital Signature Purpose Code Sequence", false},
+    tag_info{dicom_tag{0x0400, 0x0402}, vr(VR::SQ), vm_1, "ReferencedDigitalSignatureSequence", "Referenced Digital Signature Sequence", false},
+    tag_info{dicom_tag{0x0400, 0x0403}, vr(VR::SQ), vm_1, "ReferencedSOPInstanceMACSequence", "Referenced SOP Instance MAC Sequence", false},
+    tag_info{dicom_tag{0x0400, 0x0404}, vr(VR::OB), vm_1, "MAC", "MAC", false},
+    tag_info{dicom_tag{0x0400, 0x0500}, vr(VR::SQ), vm_1, "EncryptedAttributesSequence", "Encrypted Attributes Sequence", false},
+    tag_info{dicom_tag{0x0400, 0x0510}, vr(VR::UI), vm_1, "EncryptedContentTransferSyntaxUID", "Encrypted Content Transfer Syntax UID", false},
+    tag_info{dicom_tag{0x0400, 0x0520}, vr(VR::OB), vm_1, "EncryptedContent", "Encrypted Content", false},
+    tag_info{dicom_tag{0x0400, 0x0550}, vr(VR::SQ), vm_1, "ModifiedAttributesSequence", "Modified Attributes Sequence", false},
+    tag_info{dicom_tag{0x0400, 0x0551}, vr(VR::SQ), vm_1, "NonconformingModifiedAttributesSequence", "Nonconforming Modified Attributes Sequence", false},
+    tag_info{dicom_tag{0x0400, 0x0552}, vr(VR::OB), vm_1, "NonconformingDataElementValue", "Nonconforming Data Element Value", false},
+    tag_info{dicom_tag{0x0400, 0x0561}, vr(VR::SQ), vm_1, "OriginalAttributesSequence", "Original Attributes Sequence", false},
+    tag_info{dicom_tag{0x0400, 0x0562}, vr(VR::DT), vm_1, "AttributeModificationDateTime", "Attribute Modification DateTime", false},
+    tag_info{dicom_tag{0x0400, 0x0563}, vr(VR::LO), vm_1, "ModifyingSystem", "Modifying System", false},
+    tag_info{dicom_tag{0x0400, 0x0564}, vr(VR::LO), vm_1, "SourceOfPreviousValues", "Source of Previous Values", false},
+    tag_info{dicom_tag{0x0400, 0x0565}, vr(VR::CS), vm_1, "ReasonForTheAttributeModification", "Reason for the Attribute Modification", false},
+    tag_info{dicom_tag{0x0400, 0x0600}, vr(VR::CS), vm_1, "InstanceOriginStatus", "Instance Origin Status", false},
+    tag_info{dicom_tag{0x1000, 0x0000}, vr(VR::US), vm_3, "EscapeTriplet", "Escape Triplet", true},  // (1000,xxx0)
+    tag_info{dicom_tag{0x1000, 0x0001}, vr(VR::US), vm_3, "RunLengthTriplet", "Run Length Triplet", true},  // (1000,xxx1)
+    tag_info{dicom_tag{0x1000, 0x0002}, vr(VR::US), vm_1, "HuffmanTableSize", "Huffman Table Size", true},  // (1000,xxx2)
+    tag_info{dicom_tag{0x1000, 0x0003}, vr(VR::US), vm_3, "HuffmanTableTriplet", "Huffman Table Triplet", true},  // (1000,xxx3)
+    tag_info{dicom_tag{0x1000, 0x0004}, vr(VR::US), vm_1, "ShiftTableSize", "Shift Table Size", true},  // (1000,xxx4)
+    tag_info{dicom_tag{0x1000, 0x0005}, vr(VR::US), vm_3, "ShiftTableTriplet", "Shift Table Triplet", true},  // (1000,xxx5)
+    tag_info{dicom_tag{0x1010, 0x0000}, vr(VR::US), vm_1_n, "ZonalMap", "Zonal Map", true},  // (1010,xxxx)
+    tag_info{dicom_tag{0x2000, 0x0010}, vr(VR::IS), vm_1, "NumberOfCopies", "Number of Copies", false},
+    tag_info{dicom_tag{0x2000, 0x001E}, vr(VR::SQ), vm_1, "PrinterConfigurationSequence", "Printer Configuration Sequence", false},
+    tag_info{dicom_tag{0x2000, 0x0020}, vr(VR::CS), vm_1, "PrintPriority", "Print Priority", false},
+    tag_info{dicom_tag{0x2000, 0x0030}, vr(VR::CS), vm_1, "MediumType", "Medium Type", false},
+    tag_info{dicom_tag{0x2000, 0x0040}, vr(VR::CS), vm_1, "FilmDestination", "Film Destination", false},
+    tag_info{dicom_tag{0x2000, 0x0050}, vr(VR::LO), vm_1, "FilmSessionLabel", "Film Session Label", false},
+    tag_info{dicom_tag{0x2000, 0x0060}, vr(VR::IS), vm_1, "MemoryAllocation", "Memory Allocation", false},
+    tag_info{dicom_tag{0x2000, 0x0061}, vr(VR::IS), vm_1, "MaximumMemoryAllocation", "Maximum Memory Allocation", false},
+    tag_info{dicom_tag{0x2000, 0x0062}, vr(VR::CS), vm_1, "ColorImagePrintingFlag", "Color Image Printing Flag", true},
+    tag_info{dicom_tag{0x2000, 0x0063}, vr(VR::CS), vm_1, "CollationFlag", "Collation Flag", true},
+    tag_info{dicom_tag{0x2000, 0x0065}, vr(VR::CS), vm_1, "AnnotationFlag", "Annotation Flag", true},
+    tag_info{dicom_tag{0x2000, 0x0067}, vr(VR::CS), vm_1, "ImageOverlayFlag", "Image Overlay Flag", true},
+    tag_info{dicom_tag{0x2000, 0x0069}, vr(VR::CS), vm_1, "PresentationLUTFlag", "Presentation LUT Flag", true},
+    tag_info{dicom_tag{0x2000, 0x006A}, vr(VR::CS), vm_1, "ImageBoxPresentationLUTFlag", "Image Box Presentation LUT Flag", true},
+    tag_info{dicom_tag{0x2000, 0x00A0}, vr(VR::US), vm_1, "MemoryBitDepth", "Memory Bit Depth", false},
+    tag_info{dicom_tag{0x2000, 0x00A1}, vr(VR::US), vm_1, "PrintingBitDepth", "Printing Bit Depth", false},
+    tag_info{dicom_tag{0x2000, 0x00A2}, vr(VR::SQ), vm_1, "MediaInstalledSequence", "Media Installed Sequence", false},
+    tag_info{dicom_tag{0x2000, 0x00A4}, vr(VR::SQ), vm_1, "OtherMediaAvailableSequence", "Other Media Available Sequence", false},
+    tag_info{dicom_tag{0x2000, 0x00A8}, vr(VR::SQ), vm_1, "SupportedImageDisplayFormatsSequence", "Supported Image Display Formats Sequence", false},
+    tag_info{dicom_tag{0x2000, 0x0500}, vr(VR::SQ), vm_1, "ReferencedFilmBoxSequence", "Referenced Film Box Sequence", false},
+    tag_info{dicom_tag{0x2000, 0x0510}, vr(VR::SQ), vm_1, "ReferencedStoredPrintSequence", "Referenced Stored Print Sequence", true},
+    tag_info{dicom_tag{0x2010, 0x0010}, vr(VR::ST), vm_1, "ImageDisplayFormat", "Image Display Format", false},
+    tag_info{dicom_tag{0x2010, 0x0030}, vr(VR::CS), vm_1, "AnnotationDisplayFormatID", "Annotation Display Format ID", false},
+    tag_info{dicom_tag{0x2010, 0x0040}, vr(VR::CS), vm_1, "FilmOrientation", "Film Orientation", false},
+    tag_info{dicom_tag{0x2010, 0x0050}, vr(VR::CS), vm_1, "FilmSizeID", "Film Size ID", false},
+    tag_info{dicom_tag{0x2010, 0x0052}, vr(VR::CS), vm_1, "PrinterResolutionID", "Printer Resolution ID", false},
+    tag_info{dicom_tag{0x2010, 0x0054}, vr(VR::CS), vm_1, "DefaultPrinterResolutionID", "Default Printer Resolution ID", false},
+    tag_info{dicom_tag{0x2010, 0x0060}, vr(VR::CS), vm_1, "MagnificationType", "Magnification Type", false},
+    tag_info{dicom_tag{0x2010, 0x0080}, vr(VR::CS), vm_1, "SmoothingType", "Smoothing Type", false},
+    tag_info{dicom_tag{0x2010, 0x00A6}, vr(VR::CS), vm_1, "DefaultMagnificationType", "Default Magnification Type", false},
+    tag_info{dicom_tag{0x2010, 0x00A7}, vr(VR::CS), vm_1_n, "OtherMagnificationTypesAvailable", "Other Magnification Types Available", false},
+    tag_info{dicom_tag{0x2010, 0x00A8}, vr(VR::CS), vm_1, "DefaultSmoothingType", "Default Smoothing Type", false},
+    tag_info{dicom_tag{0x2010, 0x00A9}, vr(VR::CS), vm_1_n, "OtherSmoothingTypesAvailable", "Other Smoothing Types Available", false},
+    tag_info{dicom_tag{0x2010, 0x0100}, vr(VR::CS), vm_1, "BorderDensity", "Border Density", false},
+    tag_info{dicom_tag{0x2010, 0x0110}, vr(VR::CS), vm_1, "EmptyImageDensity", "Empty Image Density", false},
+    tag_info{dicom_tag{0x2010, 0x0120}, vr(VR::US), vm_1, "MinDensity", "Min Density", false},
+    tag_info{dicom_tag{0x2010, 0x0130}, vr(VR::US), vm_1, "MaxDensity", "Max Density", false},
+    tag_info{dicom_tag{0x2010, 0x0140}, vr(VR::CS), vm_1, "Trim", "Trim", false},
+    tag_info{dicom_tag{0x2010, 0x0150}, vr(VR::ST), vm_1, "ConfigurationInformation", "Configuration Information", false},
+    tag_info{dicom_tag{0x2010, 0x0152}, vr(VR::LT), vm_1, "ConfigurationInformationDescription", "Configuration Information Description", false},
+    tag_info{dicom_tag{0x2010, 0x0154}, vr(VR::IS), vm_1, "MaximumCollatedFilms", "Maximum Collated Films", false},
+    tag_info{dicom_tag{0x2010, 0x015E}, vr(VR::US), vm_1, "Illumination", "Illumination", false},
+    tag_info{dicom_tag{0x2010, 0x0160}, vr(VR::US), vm_1, "ReflectedAmbientLight", "Reflected Ambient Light", false},
+    tag_info{dicom_tag{0x2010, 0x0376}, vr(VR::DS), vm_2, "PrinterPixelSpacing", "Printer Pixel Spacing", false},
+    tag_info{dicom_tag{0x2010, 0x0500}, vr(VR::SQ), vm_1, "ReferencedFilmSessionSequence", "Referenced Film Session Sequence", false},
+    tag_info{dicom_tag{0x2010, 0x0510}, vr(VR::SQ), vm_1, "ReferencedImageBoxSequence", "Referenced Image Box Sequence", false},
+    tag_info{dicom_tag{0x2010, 0x0520}, vr(VR::SQ), vm_1, "ReferencedBasicAnnotationBoxSequence", "Referenced Basic Annotation Box Sequence", false},
+    tag_info{dicom_tag{0x2020, 0x0010}, vr(VR::US), vm_1, "ImageBoxPosition", "Image Box Position", false},
+    tag_info{dicom_tag{0x2020, 0x0020}, vr(VR::CS), vm_1, "Polarity", "Polarity", false},
+    tag_info{dicom_tag{0x2020, 0x0030}, vr(VR::DS), vm_1, "RequestedImageSize", "Requested Image Size", false},
+    tag_info{dicom_tag{0x2020, 0x0040}, vr(VR::CS), vm_1, "RequestedDecimateCropBehavior", "Requested Decimate/Crop Behavior", false},
+    tag_info{dicom_tag{0x2020, 0x0050}, vr(VR::CS), vm_1, "RequestedResolutionID", "Requested Resolution ID", false},
+    tag_info{dicom_tag{0x2020, 0x00A0}, vr(VR::CS), vm_1, "RequestedImageSizeFlag", "Requested Image Size Flag", false},
+    tag_info{dicom_tag{0x2020, 0x00A2}, vr(VR::CS), vm_1, "DecimateCropResult", "Decimate/Crop Result", false},
+    tag_info{dicom_tag{0x2020, 0x0110}, vr(VR::SQ), vm_1, "BasicGrayscaleImageSequence", "Basic Grayscale Image Sequence", false},
+    tag_info{dicom_tag{0x2020, 0x0111}, vr(VR::SQ), vm_1, "BasicColorImageSequence", "Basic Color Image Sequence", false},
+    tag_info{dicom_tag{0x2020, 0x0130}, vr(VR::SQ), vm_1, "ReferencedImageOverlayBoxSequence", "Referenced Image Overlay Box Sequence", true},
+    tag_info{dicom_tag{0x2020, 0x0140}, vr(VR::SQ), vm_1, "ReferencedVOILUTBoxSequence", "Referenced VOI LUT Box Sequence", true},
+    tag_info{dicom_tag{0x2030, 0x0010}, vr(VR::US), vm_1, "AnnotationPosition", "Annotation Position", false},
+    tag_info{dicom_tag{0x2030, 0x0020}, vr(VR::LO), vm_1, "TextString", "Text String", false},
+    tag_info{dicom_tag{0x2040, 0x0010}, vr(VR::SQ), vm_1, "ReferencedOverlayPlaneSequence", "Referenced Overlay Plane Sequence", true},
+    tag_info{dicom_tag{0x2040, 0x0011}, vr(VR::US), vm_1_99, "ReferencedOverlayPlaneGroups", "Referenced Overlay Plane Groups", true},
+    tag_info{dicom_tag{0x2040, 0x0020}, vr(VR::SQ), vm_1, "OverlayPixelDataSequence", "Overlay Pixel Data Sequence", true},
+    tag_info{dicom_tag{0x2040, 0x0060}, vr(VR::CS), vm_1, "OverlayMagnificationType", "Overlay Magnification Type", true},
+    tag_info{dicom_tag{0x2040, 0x0070}, vr(VR::CS), vm_1, "OverlaySmoothingType", "Overlay Smoothing Type", true},
+    tag_info{dicom_tag{0x2040, 0x0072}, vr(VR::CS), vm_1, "OverlayOrImageMagnification", "Overlay or Image Magnification", true},
+    tag_info{dicom_tag{0x2040, 0x0074}, vr(VR::US), vm_1, "MagnifyToNumberOfColumns", "Magnify to Number of Columns", true},
+    tag_info{dicom_tag{0x2040, 0x0080}, vr(VR::CS), vm_1, "OverlayForegroundDensity", "Overlay Foreground Density", true},
+    tag_info{dicom_tag{0x2040, 0x0082}, vr(VR::CS), vm_1, "OverlayBackgroundDensity", "Overlay Background Density", true},
+    tag_info{dicom_tag{0x2040, 0x0090}, vr(VR::CS), vm_1, "OverlayMode", "Overlay Mode", true},
+    tag_info{dicom_tag{0x2040, 0x0100}, vr(VR::CS), vm_1, "ThresholdDensity", "Threshold Density", true},
+    tag_info{dicom_tag{0x2040, 0x0500}, vr(VR::SQ), vm_1, "ReferencedImageBoxSequenceRetired", "Referenced Image Box Sequence (Retired)", true},
+    tag_info{dicom_tag{0x2050, 0x0010}, vr(VR::SQ), vm_1, "PresentationLUTSequence", "Presentation LUT Sequence", false},
+    tag_info{dicom_tag{0x2050, 0x0020}, vr(VR::CS), vm_1, "PresentationLUTShape", "Presentation LUT Shape", false},
+    tag_info{dicom_tag{0x2050, 0x0500}, vr(VR::SQ), vm_1, "ReferencedPresentationLUTSequence", "Referenced Presentation LUT Sequence", false},
+    tag_info{dicom_tag{0x2100, 0x0010}, vr(VR::SH), vm_1, "PrintJobID", "Print Job ID", true},
+    tag_info{dicom_tag{0x2100, 0x0020}, vr(VR::CS), vm_1, "ExecutionStatus", "Execution Status", false},
+    tag_info{dicom_tag{0x2100, 0x0030}, vr(VR::CS), vm_1, "ExecutionStatusInfo", "Execution Status Info", false},
+    tag_info{dicom_tag{0x2100, 0x0040}, vr(VR::DA), vm_1, "CreationDate", "Creation Date", false},
+    tag_info{dicom_tag{0x2100, 0x0050}, vr(VR::TM), vm_1, "CreationTime", "Creation Time", false},
+    tag_info{dicom_tag{0x2100, 0x0070}, vr(VR::AE), vm_1, "Originator", "Originator", false},
+    tag_info{dicom_tag{0x2100, 0x0140}, vr(VR::AE), vm_1, "DestinationAE", "Destination AE", false},
+    tag_info{dicom_tag{0x2100, 0x0160}, vr(VR::SH), vm_1, "OwnerID", "Owner ID", false},
+    tag_info{dicom_tag{0x2100, 0x0170}, vr(VR::IS), vm_1, "NumberOfFilms", "Number of Films", false},
+    tag_info{dicom_tag{0x2100, 0x0500}, vr(VR::SQ), vm_1, "ReferencedPrintJobSequencePullStoredPrint", "Referenced Print Job Sequence (Pull Stored Print)", true},
+    tag_info{dicom_tag{0x2110, 0x0010}, vr(VR::CS), vm_1, "PrinterStatus", "Printer Status", false},
+    tag_info{dicom_tag{0x2110, 0x0020}, vr(VR::CS), vm_1, "PrinterStatusInfo", "Printer Status Info", false},
+    tag_info{dicom_tag{0x2110, 0x0030}, vr(VR::LO), vm_1, "PrinterName", "Printer Name", false},
+    tag_info{dicom_tag{0x2110, 0x0099}, vr(VR::SH), vm_1, "PrintQueueID", "Print Queue ID", true},
+    tag_info{dicom_tag{0x2120, 0x0010}, vr(VR::CS), vm_1, "QueueStatus", "Queue Status", true},
+    tag_info{dicom_tag{0x2120, 0x0050}, vr(VR::SQ), vm_1, "PrintJobDescriptionSequence", "Print Job Description Sequence", true},
+    tag_info{dicom_tag{0x2120, 0x0070}, vr(VR::SQ), vm_1, "ReferencedPrintJobSequence", "Referenced Print Job Sequence", true},
+    tag_info{dicom_tag{0x2130, 0x0010}, vr(VR::SQ), vm_1, "PrintManagementCapabilitiesSequence", "Print Management Capabilities Sequence", true},
+    tag_info{dicom_tag{0x2130, 0x0015}, vr(VR::SQ), vm_1, "PrinterCharacteristicsSequence", "Printer Characteristics Sequence", true},
+    tag_info{dicom_tag{0x2130, 0x0030}, vr(VR::SQ), vm_1, "FilmBoxContentSequence", "Film Box Content Sequence", true},
+    tag_info{dicom_tag{0x2130, 0x0040}, vr(VR::SQ), vm_1, "ImageBoxContentSequence", "Image Box Content Sequence", true},
+    tag_info{dicom_tag{0x2130, 0x0050}, vr(VR::SQ), vm_1, "AnnotationContentSequence", "Annotation Content Sequence", true},
+    tag_info{dicom_tag{0x2130, 0x0060}, vr(VR::SQ), vm_1, "ImageOverlayBoxContentSequence", "Image Overlay Box Content Sequence", true},
+    tag_info{dicom_tag{0x2130, 0x0080}, vr(VR::SQ), vm_1, "PresentationLUTContentSequence", "Presentation LUT Content Sequence", true},
+    tag_info{dicom_tag{0x2130, 0x00A0}, vr(VR::SQ), vm_1, "ProposedStudySequence", "Proposed Study Sequence", false},
+    tag_info{dicom_tag{0x2130, 0x00C0}, vr(VR::SQ), vm_1, "OriginalImageSequence", "Original Image Sequence", false},
+    tag_info{dicom_tag{0x2200, 0x0001}, vr(VR::CS), vm_1, "LabelUsingInformationExtractedFromInstances", "Label Using Information Extracted From Instances", false},
+    tag_info{dicom_tag{0x2200, 0x0002}, vr(VR::UT), vm_1, "LabelText", "Label Text", false},
+    tag_info{dicom_tag{0x2200, 0x0003}, vr(VR::CS), vm_1, "LabelStyleSelection", "Label Style Selection", false},
+    tag_info{dicom_tag{0x2200, 0x0004}, vr(VR::LT), vm_1, "MediaDisposition", "Media Disposition", false},
+    tag_info{dicom_tag{0x2200, 0x0005}, vr(VR::LT), vm_1, "BarcodeValue", "Barcode Value", false},
+    tag_info{dicom_tag{0x2200, 0x0006}, vr(VR::CS), vm_1, "BarcodeSymbology", "Barcode Symbology", false},
+    tag_info{dicom_tag{0x2200, 0x0007}, vr(VR::CS), vm_1, "AllowMediaSplitting", "Allow Media Splitting", false},
+    tag_info{dicom_tag{0x2200, 0x0008}, vr(VR::CS), vm_1, "IncludeNonDICOMObjects", "Include Non-DICOM Objects", false},
+    tag_info{dicom_tag{0x2200, 0x0009}, vr(VR::CS), vm_1, "IncludeDisplayApplication", "Include Display Application", false},
+    tag_info{dicom_tag{0x2200, 0x000A}, vr(VR::CS), vm_1, "PreserveCompositeInstancesAfterMediaCreation", "Preserve Composite Instances After Media Creation", false},
+    tag_info{dicom_tag{0x2200, 0x000B}, vr(VR::US), vm_1, "TotalNumberOfPiecesOfMediaCreated", "Total Number of Pieces of Media Created", false},
+    tag_info{dicom_tag{0x2200, 0x000C}, vr(VR::LO), vm_1, "RequestedMediaApplicationProfile", "Requested Media Application Profile", false},
+    tag_info{dicom_tag{0x2200, 0x000D}, vr(VR::SQ), vm_1, "ReferencedStorageMediaSequence", "Referenced Storage Media Sequence", false},
+    tag_info{dicom_tag{0x2200, 0x000E}, vr(VR::AT), vm_1_n, "FailureAttributes", "Failure Attributes", false},
+    tag_info{dicom_tag{0x2200, 0x000F}, vr(VR::CS), vm_1, "AllowLossyCompression", "Allow Lossy Compression", false},
+    tag_info{dicom_tag{0x2200, 0x0020}, vr(VR::CS), vm_1, "RequestPriority", "Request Priority", false},
+    tag_info{dicom_tag{0x3002, 0x0002}, vr(VR::SH), vm_1, "RTImageLabel", "RT Image Label", false},
+    tag_info{dicom_tag{0x3002, 0x0003}, vr(VR::LO), vm_1, "RTImageName", "RT Image Name", false},
+    tag_info{dicom_tag{0x3002, 0x0004}, vr(VR::ST), vm_1, "RTImageDescription", "RT Image Description", false},
+    tag_info{dicom_tag{0x3002, 0x000A}, vr(VR::CS), vm_1, "ReportedValuesOrigin", "Reported Values Origin", false},
+    tag_info{dicom_tag{0x3002, 0x000C}, vr(VR::CS), vm_1, "RTImagePlane", "RT Image Plane", false},
+    tag_info{dicom_tag{0x3002, 0x000D}, vr(VR::DS), vm_3, "XRayImageReceptorTranslation", "X-Ray Image Receptor Translation", false},
+    tag_info{dicom_tag{0x3002, 0x000E}, vr(VR::DS), vm_1, "XRayImageReceptorAngle", "X-Ray Image Receptor Angle", false},
+    tag_info{dicom_tag{0x3002, 0x0010}, vr(VR::DS), vm_6, "RTImageOrientation", "RT Image Orientation", false},
+    tag_info{dicom_tag{0x3002, 0x0011}, vr(VR::DS), vm_2, "ImagePlanePixelSpacing", "Image Plane Pixel Spacing", false},
+    tag_info{dicom_tag{0x3002, 0x0012}, vr(VR::DS), vm_2, "RTImagePosition", "RT Image Position", false},
+    tag_info{dicom_tag{0x3002, 0x0020}, vr(VR::SH), vm_1, "RadiationMachineName", "Radiation Machine Name", false},
+    tag_info{dicom_tag{0x3002, 0x0022}, vr(VR::DS), vm_1, "RadiationMachineSAD", "Radiation Machine SAD", false},
+    tag_info{dicom_tag{0x3002, 0x0024}, vr(VR::DS), vm_1, "RadiationMachineSSD", "Radiation Machine SSD", false},
+    tag_info{dicom_tag{0x3002, 0x0026}, vr(VR::DS), vm_1, "RTImageSID", "RT Image SID", false},
+    tag_info{dicom_tag{0x3002, 0x0028}, vr(VR::DS), vm_1, "SourceToReferenceObjectDistance", "Source to Reference Object Distance", false},
+    tag_info{dicom_tag{0x3002, 0x0029}, vr(VR::IS), vm_1, "FractionNumber", "Fraction Number", false},
+    tag_info{dicom_tag{0x3002, 0x0030}, vr(VR::SQ), vm_1, "ExposureSequence", "Exposure Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0032}, vr(VR::DS), vm_1, "MetersetExposure", "Meterset Exposure", false},
+    tag_info{dicom_tag{0x3002, 0x0034}, vr(VR::DS), vm_4, "DiaphragmPosition", "Diaphragm Position", false},
+    tag_info{dicom_tag{0x3002, 0x0040}, vr(VR::SQ), vm_1, "FluenceMapSequence", "Fluence Map Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0041}, vr(VR::CS), vm_1, "FluenceDataSource", "Fluence Data Source", false},
+    tag_info{dicom_tag{0x3002, 0x0042}, vr(VR::DS), vm_1, "FluenceDataScale", "Fluence Data Scale", false},
+    tag_info{dicom_tag{0x3002, 0x0050}, vr(VR::SQ), vm_1, "PrimaryFluenceModeSequence", "Primary Fluence Mode Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0051}, vr(VR::CS), vm_1, "FluenceMode", "Fluence Mode", false},
+    tag_info{dicom_tag{0x3002, 0x0052}, vr(VR::SH), vm_1, "FluenceModeID", "Fluence Mode ID", false},
+    tag_info{dicom_tag{0x3002, 0x0100}, vr(VR::IS), vm_1, "SelectedFrameNumber", "Selected Frame Number", false},
+    tag_info{dicom_tag{0x3002, 0x0101}, vr(VR::SQ), vm_1, "SelectedFrameFunctionalGroupsSequence", "Selected Frame Functional Groups Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0102}, vr(VR::SQ), vm_1, "RTImageFrameGeneralContentSequence", "RT Image Frame General Content Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0103}, vr(VR::SQ), vm_1, "RTImageFrameContextSequence", "RT Image Frame Context Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0104}, vr(VR::SQ), vm_1, "RTImageScopeSequence", "RT Image Scope Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0105}, vr(VR::CS), vm_1, "BeamModifierCoordinatesPresenceFlag", "Beam Modifier Coordinates Presence Flag", false},
+    tag_info{dicom_tag{0x3002, 0x0106}, vr(VR::FD), vm_1, "StartCumulativeMeterset", "Start Cumulative Meterset", false},
+    tag_info{dicom_tag{0x3002, 0x0107}, vr(VR::FD), vm_1, "StopCumulativeMeterset", "Stop Cumulative Meterset", false},
+    tag_info{dicom_tag{0x3002, 0x0108}, vr(VR::SQ), vm_1, "RTAcquisitionPatientPositionSequence", "RT Acquisition Patient Position Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0109}, vr(VR::SQ), vm_1, "RTImageFrameImagingDevicePositionSequence", "RT Image Frame Imaging Device Position Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x010A}, vr(VR::SQ), vm_1, "RTImageFramekVRadiationAcquisitionSequence", "RT Image Frame kV Radiation Acquisition Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x010B}, vr(VR::SQ), vm_1, "RTImageFrameMVRadiationAcquisitionSequence", "RT Image Frame MV Radiation Acquisition Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x010C}, vr(VR::SQ), vm_1, "RTImageFrameRadiationAcquisitionSequence", "RT Image Frame Radiation Acquisition Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x010D}, vr(VR::SQ), vm_1, "ImagingSourcePositionSequence", "Imaging Source Position Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x010E}, vr(VR::SQ), vm_1, "ImageReceptorPositionSequence", "Image Receptor Position Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x010F}, vr(VR::FD), vm_16, "DevicePositionToEquipmentMappingMatrix", "Device Position to Equipment Mapping Matrix", false},
+    tag_info{dicom_tag{0x3002, 0x0110}, vr(VR::SQ), vm_1, "DevicePositionParameterSequence", "Device Position Parameter Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0111}, vr(VR::CS), vm_1, "ImagingSourceLocationSpecificationType", "Imaging Source Location Specification Type", false},
+    tag_info{dicom_tag{0x3002, 0x0112}, vr(VR::SQ), vm_1, "ImagingDeviceLocationMatrixSequence", "Imaging Device Location Matrix Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0113}, vr(VR::SQ), vm_1, "ImagingDeviceLocationParameterSequence", "Imaging Device Location Parameter Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0114}, vr(VR::SQ), vm_1, "ImagingApertureSequence", "Imaging Aperture Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0115}, vr(VR::CS), vm_1, "ImagingApertureSpecificationType", "Imaging Aperture Specification Type", false},
+    tag_info{dicom_tag{0x3002, 0x0116}, vr(VR::US), vm_1, "NumberOfAcquisitionDevices", "Number of Acquisition Devices", false},
+    tag_info{dicom_tag{0x3002, 0x0117}, vr(VR::SQ), vm_1, "AcquisitionDeviceSequence", "Acquisition Device Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0118}, vr(VR::SQ), vm_1, "AcquisitionTaskSequence", "Acquisition Task Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0119}, vr(VR::SQ), vm_1, "AcquisitionTaskWorkitemCodeSequence", "Acquisition Task Workitem Code Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x011A}, vr(VR::SQ), vm_1, "AcquisitionSubtaskSequence", "Acquisition Subtask Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x011B}, vr(VR::SQ), vm_1, "SubtaskWorkitemCodeSequence", "Subtask Workitem Code Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x011C}, vr(VR::US), vm_1, "AcquisitionTaskIndex", "Acquisition Task Index", false},
+    tag_info{dicom_tag{0x3002, 0x011D}, vr(VR::US), vm_1, "AcquisitionSubtaskIndex", "Acquisition Subtask Index", false},
+    tag_info{dicom_tag{0x3002, 0x011E}, vr(VR::SQ), vm_1, "ReferencedBaselineParametersRTRadiationInstanceSequence", "Referenced Baseline Parameters RT Radiation Instance Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x011F}, vr(VR::SQ), vm_1, "PositionAcquisitionTemplateIdentificationSequence", "Position Acquisition Template Identification Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0120}, vr(VR::ST), vm_1, "PositionAcquisitionTemplateID", "Position Acquisition Template ID", false},
+    tag_info{dicom_tag{0x3002, 0x0121}, vr(VR::LO), vm_1, "PositionAcquisitionTemplateName", "Position Acquisition Template Name", false},
+    tag_info{dicom_tag{0x3002, 0x0122}, vr(VR::SQ), vm_1, "PositionAcquisitionTemplateCodeSequence", "Position Acquisition Template Code Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0123}, vr(VR::LT), vm_1, "PositionAcquisitionTemplateDescription", "Position Acquisition Template Description", false},
+    tag_info{dicom_tag{0x3002, 0x0124}, vr(VR::SQ), vm_1, "AcquisitionTaskApplicabilitySequence", "Acquisition Task Applicability Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0125}, vr(VR::SQ), vm_1, "ProjectionImagingAcquisitionParameterSequence", "Projection Imaging Acquisition Parameter Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0126}, vr(VR::SQ), vm_1, "CTImagingAcquisitionParameterSequence", "CT Imaging Acquisition Parameter Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0127}, vr(VR::SQ), vm_1, "KVImagingGenerationParametersSequence", "KV Imaging Generation Parameters Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0128}, vr(VR::SQ), vm_1, "MVImagingGenerationParametersSequence", "MV Imaging Generation Parameters Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0129}, vr(VR::CS), vm_1, "AcquisitionSignalType", "Acquisition Signal Type", false},
+    tag_info{dicom_tag{0x3002, 0x012A}, vr(VR::CS), vm_1, "AcquisitionMethod", "Acquisition Method", false},
+    tag_info{dicom_tag{0x3002, 0x012B}, vr(VR::SQ), vm_1, "ScanStartPositionSequence", "Scan Start Position Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x012C}, vr(VR::SQ), vm_1, "ScanStopPositionSequence", "Scan Stop Position Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x012D}, vr(VR::FD), vm_1, "ImagingSourceToBeamModifierDefinitionPlaneDistance", "Imaging Source to Beam Modifier Definition Plane Distance", false},
+    tag_info{dicom_tag{0x3002, 0x012E}, vr(VR::CS), vm_1, "ScanArcType", "Scan Arc Type", false},
+    tag_info{dicom_tag{0x3002, 0x012F}, vr(VR::CS), vm_1, "DetectorPositioningType", "Detector Positioning Type", false},
+    tag_info{dicom_tag{0x3002, 0x0130}, vr(VR::SQ), vm_1, "AdditionalRTAccessoryDeviceSequence", "Additional RT Accessory Device Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0131}, vr(VR::SQ), vm_1, "DeviceSpecificAcquisitionParameterSequence", "Device-Specific Acquisition Parameter Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0132}, vr(VR::SQ), vm_1, "ReferencedPositionReferenceInstanceSequence", "Referenced Position Reference Instance Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0133}, vr(VR::SQ), vm_1, "EnergyDerivationCodeSequence", "Energy Derivation Code Sequence", false},
+    tag_info{dicom_tag{0x3002, 0x0134}, vr(VR::FD), vm_1, "MaximumCumulativeMetersetExposure", "Maximum Cumulative Meterset Exposure", false},
+    tag_info{dicom_tag{0x3002, 0x0135}, vr(VR::SQ), vm_1, "AcquisitionInitiationSequence", "Acquisition Initiation Sequence", false},
+    tag_info{dicom_tag{0x3004, 0x0001}, vr(VR::CS), vm_1, "DVHType", "DVH Type", false},
+    tag_info{dicom_tag{0x3004, 0x0002}, vr(VR::CS), vm_1, "DoseUnits", "Dose Units", false},
+    tag_info{dicom_tag{0x3004, 0x0004}, vr(VR::CS), vm_1, "DoseType", "Dose Type", false},
+    tag_info{dicom_tag{0x3004, 0x0005}, vr(VR::CS), vm_1, "SpatialTransformOfDose", "Spatial Transform of Dose", false},
+    tag_info{dicom_tag{0x3004, 0x0006}, vr(VR::LO), vm_1, "DoseComment", "Dose Comment", false},
+    tag_info{dicom_tag{0x3004, 0x0008}, vr(VR::DS), vm_3, "NormalizationPoint", "Normalization Point", false},
+    tag_info{dicom_tag{0x3004, 0x000A}, vr(VR::CS), vm_1, "DoseSummationType", "Dose Summation Type", false},
+    tag_info{dicom_tag{0x3004, 0x000C}, vr(VR::DS), vm_2_n, "GridFrameOffsetVector", "Grid Frame Offset Vector", false},
+    tag_info{dicom_tag{0x3004, 0x000E}, vr(VR::DS), vm_1, "DoseGridScaling", "Dose Grid Scaling", false},
+    tag_info{dicom_tag{0x3004, 0x0010}, vr(VR::SQ), vm_1, "RTDoseROISequence", "RT Dose ROI Sequence", true},
+    tag_info{dicom_tag{0x3004, 0x0012}, vr(VR::DS), vm_1, "DoseValue", "Dose Value", true},
+    tag_info{dicom_tag{0x3004, 0x0014}, vr(VR::CS), vm_1_3, "TissueHeterogeneityCorrection", "Tissue Heterogeneity Correction", false},
+    tag_info{dicom_tag{0x3004, 0x0040}, vr(VR::DS), vm_3, "DVHNormalizationPoint", "DVH Normalization Point", false},
+    tag_info{dicom_tag{0x3004, 0x0042}, vr(VR::DS), vm_1, "DVHNormalizationDoseValue", "DVH Normalization Dose Value", false},
+    tag_info{dicom_tag{0x3004, 0x0050}, vr(VR::SQ), vm_1, "DVHSequence", "DVH Sequence", false},
+    tag_info{dicom_tag{0x3004, 0x0052}, vr(VR::DS), vm_1, "DVHDoseScaling", "DVH Dose Scaling", false},
+    tag_info{dicom_tag{0x3004, 0x0054}, vr(VR::CS), vm_1, "DVHVolumeUnits", "DVH Volume Units", false},
+    tag_info{dicom_tag{0x3004, 0x0056}, vr(VR::IS), vm_1, "DVHNumberOfBins", "DVH Number of Bins", false},
+    tag_info{dicom_tag{0x3004, 0x0058}, vr(VR::DS), vm_2_2n, "DVHData", "DVH Data", false},
+    tag_info{dicom_tag{0x3004, 0x0060}, vr(VR::SQ), vm_1, "DVHReferencedROISequence", "DVH Referenced ROI Sequence", false},
+    tag_info{dicom_tag{0x3004, 0x0062}, vr(VR::CS), vm_1, "DVHROIContributionType", "DVH ROI Contribution Type", false},
+    tag_info{dicom_tag{0x3004, 0x0070}, vr(VR::DS), vm_1, "DVHMinimumDose", "DVH Minimum Dose", false},
+    tag_info{dicom_tag{0x3004, 0x0072}, vr(VR::DS), vm_1, "DVHMaximumDose", "DVH Maximum Dose", false},
+    tag_info{dicom_tag{0x3004, 0x0074}, vr(VR::DS), vm_1, "DVHMeanDose", "DVH Mean Dose", false},
+    tag_info{dicom_tag{0x3006, 0x0002}, vr(VR::SH), vm_1, "StructureSetLabel", "Structure Set Label", false},
+    tag_info{dicom_tag{0x3006, 0x0004}, vr(VR::LO), vm_1, "StructureSetName", "Structure Set Name", false},
+    tag_info{dicom_tag{0x3006, 0x0006}, vr(VR::ST), vm_1, "StructureSetDescription", "Structure Set Description", false},
+    tag_info{dicom_tag{0x3006, 0x0008}, vr(VR::DA), vm_1, "StructureSetDate", "Structure Set Date", false},
+    tag_info{dicom_tag{0x3006, 0x0009}, vr(VR::TM), vm_1, "StructureSetTime", "Structure Set Time", false},
+    tag_info{dicom_tag{0x3006, 0x0010}, vr(VR::SQ), vm_1, "ReferencedFrameOfReferenceSequence", "Referenced Frame of Reference Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0012}, vr(VR::SQ), vm_1, "RTReferencedStudySequence", "RT Referenced Study Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0014}, vr(VR::SQ), vm_1, "RTReferencedSeriesSequence", "RT Referenced Series Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0016}, vr(VR::SQ), vm_1, "ContourImageSequence", "Contour Image Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0018}, vr(VR::SQ), vm_1, "PredecessorStructureSetSequence", "Predecessor Structure Set Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0020}, vr(VR::SQ), vm_1, "StructureSetROISequence", "Structure Set ROI Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0022}, vr(VR::IS), vm_1, "ROINumber", "ROI Number", false},
+    tag_info{dicom_tag{0x3006, 0x0024}, vr(VR::UI), vm_1, "ReferencedFrameOfReferenceUID", "Referenced Frame of Reference UID", false},
+    tag_info{dicom_tag{0x3006, 0x0026}, vr(VR::LO), vm_1, "ROIName", "ROI Name", false},
+    tag_info{dicom_tag{0x3006, 0x0028}, vr(VR::ST), vm_1, "ROIDescription", "ROI Description", false},
+    tag_info{dicom_tag{0x3006, 0x002A}, vr(VR::IS), vm_3, "ROIDisplayColor", "ROI Display Color", false},
+    tag_info{dicom_tag{0x3006, 0x002C}, vr(VR::DS), vm_1, "ROIVolume", "ROI Volume", false},
+    tag_info{dicom_tag{0x3006, 0x002D}, vr(VR::DT), vm_1, "ROIDateTime", "ROI DateTime", false},
+    tag_info{dicom_tag{0x3006, 0x002E}, vr(VR::DT), vm_1, "ROIObservationDateTime", "ROI Observation DateTime", false},
+    tag_info{dicom_tag{0x3006, 0x0030}, vr(VR::SQ), vm_1, "RTRelatedROISequence", "RT Related ROI Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0033}, vr(VR::CS), vm_1, "RTROIRelationship", "RT ROI Relationship", false},
+    tag_info{dicom_tag{0x3006, 0x0036}, vr(VR::CS), vm_1, "ROIGenerationAlgorithm", "ROI Generation Algorithm", false},
+    tag_info{dicom_tag{0x3006, 0x0037}, vr(VR::SQ), vm_1, "ROIDerivationAlgorithmIdentificationSequence", "ROI Derivation Algorithm Identification Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0038}, vr(VR::LO), vm_1, "ROIGenerationDescription", "ROI Generation Description", false},
+    tag_info{dicom_tag{0x3006, 0x0039}, vr(VR::SQ), vm_1, "ROIContourSequence", "ROI Contour Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0040}, vr(VR::SQ), vm_1, "ContourSequence", "Contour Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0042}, vr(VR::CS), vm_1, "ContourGeometricType", "Contour Geometric Type", false},
+    tag_info{dicom_tag{0x3006, 0x0044}, vr(VR::DS), vm_1, "ContourSlabThickness", "Contour Slab Thickness", true},
+    tag_info{dicom_tag{0x3006, 0x0045}, vr(VR::DS), vm_3, "ContourOffsetVector", "Contour Offset Vector", true},
+    tag_info{dicom_tag{0x3006, 0x0046}, vr(VR::IS), vm_1, "NumberOfContourPoints", "Number of Contour Points", false},
+    tag_info{dicom_tag{0x3006, 0x0048}, vr(VR::IS), vm_1, "ContourNumber", "Contour Number", false},
+    tag_info{dicom_tag{0x3006, 0x0049}, vr(VR::IS), vm_1_n, "AttachedContours", "Attached Contours", true},
+    tag_info{dicom_tag{0x3006, 0x004A}, vr(VR::SQ), vm_1, "SourcePixelPlanesCharacteristicsSequence", "Source Pixel Planes Characteristics Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x004B}, vr(VR::SQ), vm_1, "SourceSeriesSequence", "Source Series Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x004C}, vr(VR::SQ), vm_1, "SourceSeriesInformationSequence", "Source Series Information Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x004D}, vr(VR::SQ), vm_1, "ROICreatorSequence", "ROI Creator Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x004E}, vr(VR::SQ), vm_1, "ROIInterpreterSequence", "ROI Interpreter Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x004F}, vr(VR::SQ), vm_1, "ROIObservationContextCodeSequence", "ROI Observation Context Code Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0050}, vr(VR::DS), vm_3_3n, "ContourData", "Contour Data", false},
+    tag_info{dicom_tag{0x3006, 0x0080}, vr(VR::SQ), vm_1, "RTROIObservationsSequence", "RT ROI Observations Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0082}, vr(VR::IS), vm_1, "ObservationNumber", "Observation Number", false},
+    tag_info{dicom_tag{0x3006, 0x0084}, vr(VR::IS), vm_1, "ReferencedROINumber", "Referenced ROI Number", false},
+    tag_info{dicom_tag{0x3006, 0x0085}, vr(VR::SH), vm_1, "ROIObservationLabel", "ROI Observation Label", true},
+    tag_info{dicom_tag{0x3006, 0x0086}, vr(VR::SQ), vm_1, "RTROIIdentificationCodeSequence", "RT ROI Identification Code Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x0088}, vr(VR::ST), vm_1, "ROIObservationDescription", "ROI Observation Description", true},
+    tag_info{dicom_tag{0x3006, 0x00A0}, vr(VR::SQ), vm_1, "RelatedRTROIObservationsSequence", "Related RT ROI Observations Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x00A4}, vr(VR::CS), vm_1, "RTROIInterpretedType", "RT ROI Interpreted Type", false},
+    tag_info{dicom_tag{0x3006, 0x00A6}, vr(VR::PN), vm_1, "ROIInterpreter", "ROI Interpreter", false},
+    tag_info{dicom_tag{0x3006, 0x00B0}, vr(VR::SQ), vm_1, "ROIPhysicalPropertiesSequence", "ROI Physical Properties Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x00B2}, vr(VR::CS), vm_1, "ROIPhysicalProperty", "ROI Physical Property", false},
+    tag_info{dicom_tag{0x3006, 0x00B4}, vr(VR::DS), vm_1, "ROIPhysicalPropertyValue", "ROI Physical Property Value", false},
+    tag_info{dicom_tag{0x3006, 0x00B6}, vr(VR::SQ), vm_1, "ROIElementalCompositionSequence", "ROI Elemental Composition Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x00B7}, vr(VR::US), vm_1, "ROIElementalCompositionAtomicNumber", "ROI Elemental Composition Atomic Number", false},
+    tag_info{dicom_tag{0x3006, 0x00B8}, vr(VR::FL), vm_1, "ROIElementalCompositionAtomicMassFraction", "ROI Elemental Composition Atomic Mass Fraction", false},
+    tag_info{dicom_tag{0x3006, 0x00B9}, vr(VR::SQ), vm_1, "AdditionalRTROIIdentificationCodeSequence", "Additional RT ROI Identification Code Sequence", true},
+    tag_info{dicom_tag{0x3006, 0x00C0}, vr(VR::SQ), vm_1, "FrameOfReferenceRelationshipSequence", "Frame of Reference Relationship Sequence", true},
+    tag_info{dicom_tag{0x3006, 0x00C2}, vr(VR::UI), vm_1, "RelatedFrameOfReferenceUID", "Related Frame of Reference UID", true},
+    tag_info{dicom_tag{0x3006, 0x00C4}, vr(VR::CS), vm_1, "FrameOfReferenceTransformationType", "Frame of Reference Transformation Type", true},
+    tag_info{dicom_tag{0x3006, 0x00C6}, vr(VR::DS), vm_16, "FrameOfReferenceTransformationMatrix", "Frame of Reference Transformation Matrix", false},
+    tag_info{dicom_tag{0x3006, 0x00C8}, vr(VR::LO), vm_1, "FrameOfReferenceTransformationComment", "Frame of Reference Transformation Comment", false},
+    tag_info{dicom_tag{0x3006, 0x00C9}, vr(VR::SQ), vm_1, "PatientLocationCoordinatesSequence", "Patient Location Coordinates Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x00CA}, vr(VR::SQ), vm_1, "PatientLocationCoordinatesCodeSequence", "Patient Location Coordinates Code Sequence", false},
+    tag_info{dicom_tag{0x3006, 0x00CB}, vr(VR::SQ), vm_1, "PatientSupportPositionSequence", "Patient Support Position Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0010}, vr(VR::SQ), vm_1, "MeasuredDoseReferenceSequence", "Measured Dose Reference Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0012}, vr(VR::ST), vm_1, "MeasuredDoseDescription", "Measured Dose Description", false},
+    tag_info{dicom_tag{0x3008, 0x0014}, vr(VR::CS), vm_1, "MeasuredDoseType", "Measured Dose Type", false},
+    tag_info{dicom_tag{0x3008, 0x0016}, vr(VR::DS), vm_1, "MeasuredDoseValue", "Measured Dose Value", false},
+    tag_info{dicom_tag{0x3008, 0x0020}, vr(VR::SQ), vm_1, "TreatmentSessionBeamSequence", "Treatment Session Beam Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0021}, vr(VR::SQ), vm_1, "TreatmentSessionIonBeamSequence", "Treatment Session Ion Beam Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0022}, vr(VR::IS), vm_1, "CurrentFractionNumber", "Current Fraction Number", false},
+    tag_info{dicom_tag{0x3008, 0x0024}, vr(VR::DA), vm_1, "TreatmentControlPointDate", "Treatment Control Point Date", false},
+    tag_info{dicom_tag{0x3008, 0x0025}, vr(VR::TM), vm_1, "TreatmentControlPointTime", "Treatment Control Point Time", false},
+    tag_info{dicom_tag{0x3008, 0x002A}, vr(VR::CS), vm_1, "TreatmentTerminationStatus", "Treatment Termination Status", false},
+    tag_info{dicom_tag{0x3008, 0x002B}, vr(VR::SH), vm_1, "TreatmentTerminationCode", "Treatment Termination Code", true},
+    tag_info{dicom_tag{0x3008, 0x002C}, vr(VR::CS), vm_1, "TreatmentVerificationStatus", "Treatment Verification Status", false},
+    tag_info{dicom_tag{0x3008, 0x0030}, vr(VR::SQ), vm_1, "ReferencedTreatmentRecordSequence", "Referenced Treatment Record Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0032}, vr(VR::DS), vm_1, "SpecifiedPrimaryMeterset", "Specified Primary Meterset", false},
+    tag_info{dicom_tag{0x3008, 0x0033}, vr(VR::DS), vm_1, "SpecifiedSecondaryMeterset", "Specified Secondary Meterset", false},
+    tag_info{dicom_tag{0x3008, 0x0036}, vr(VR::DS), vm_1, "DeliveredPrimaryMeterset", "Delivered Primary Meterset", false},
+    tag_info{dicom_tag{0x3008, 0x0037}, vr(VR::DS), vm_1, "DeliveredSecondaryMeterset", "Delivered Secondary Meterset", false},
+    tag_info{dicom_tag{0x3008, 0x003A}, vr(VR::DS), vm_1, "SpecifiedTreatmentTime", "Specified Treatment Time", false},
+    tag_info{dicom_tag{0x3008, 0x003B}, vr(VR::DS), vm_1, "DeliveredTreatmentTime", "Delivered Treatment Time", false},
+    tag_info{dicom_tag{0x3008, 0x0040}, vr(VR::SQ), vm_1, "ControlPointDeliverySequence", "Control Point Delivery Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0041}, vr(VR::SQ), vm_1, "IonControlPointDeliverySequence", "Ion Control Point Delivery Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0042}, vr(VR::DS), vm_1, "SpecifiedMeterset", "Specified Meterset", false},
+    tag_info{dicom_tag{0x3008, 0x0044}, vr(VR::DS), vm_1, "DeliveredMeterset", "Delivered Meterset", false},
+    tag_info{dicom_tag{0x3008, 0x0045}, vr(VR::FL), vm_1, "MetersetRateSet", "Meterset Rate Set", false},
+    tag_info{dicom_tag{0x3008, 0x0046}, vr(VR::FL), vm_1, "MetersetRateDelivered", "Meterset Rate Delivered", false},
+    tag_info{dicom_tag{0x3008, 0x0047}, vr(VR::FL), vm_1_n, "ScanSpotMetersetsDelivered", "Scan Spot Metersets Delivered", false},
+    tag_info{dicom_tag{0x3008, 0x0048}, vr(VR::DS), vm_1, "DoseRateDelivered", "Dose Rate Delivered", false},
+    tag_info{dicom_tag{0x3008, 0x0050}, vr(VR::SQ), vm_1, "TreatmentSummaryCalculatedDoseReferenceSequence", "Treatment Summary Calculated Dose Reference Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0052}, vr(VR::DS), vm_1, "CumulativeDoseToDoseReference", "Cumulative Dose to Dose Reference", false},
+    tag_info{dicom_tag{0x3008, 0x0054}, vr(VR::DA), vm_1, "FirstTreatmentDate", "First Treatment Date", false},
+    tag_info{dicom_tag{0x3008, 0x0056}, vr(VR::DA), vm_1, "MostRecentTreatmentDate", "Most Recent Treatment Date", false},
+    tag_info{dicom_tag{0x3008, 0x005A}, vr(VR::IS), vm_1, "NumberOfFractionsDelivered", "Number of Fractions Delivered", false},
+    tag_info{dicom_tag{0x3008, 0x0060}, vr(VR::SQ), vm_1, "OverrideSequence", "Override Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0061}, vr(VR::AT), vm_1, "ParameterSequencePointer", "Parameter Sequence Pointer", false},
+    tag_info{dicom_tag{0x3008, 0x0062}, vr(VR::AT), vm_1, "OverrideParameterPointer", "Override Parameter Pointer", false},
+    tag_info{dicom_tag{0x3008, 0x0063}, vr(VR::IS), vm_1, "ParameterItemIndex", "Parameter Item Index", false},
+    tag_info{dicom_tag{0x3008, 0x0064}, vr(VR::IS), vm_1, "MeasuredDoseReferenceNumber", "Measured Dose Reference Number", false},
+    tag_info{dicom_tag{0x3008, 0x0065}, vr(VR::AT), vm_1, "ParameterPointer", "Parameter Pointer", false},
+    tag_info{dicom_tag{0x3008, 0x0066}, vr(VR::ST), vm_1, "OverrideReason", "Override Reason", false},
+    tag_info{dicom_tag{0x3008, 0x0067}, vr(VR::US), vm_1, "ParameterValueNumber", "Parameter Value Number", false},
+    tag_info{dicom_tag{0x3008, 0x0068}, vr(VR::SQ), vm_1, "CorrectedParameterSequence", "Corrected Parameter Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x006A}, vr(VR::FL), vm_1, "CorrectionValue", "Correction Value", false},
+    tag_info{dicom_tag{0x3008, 0x0070}, vr(VR::SQ), vm_1, "CalculatedDoseReferenceSequence", "Calculated Dose Reference Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0072}, vr(VR::IS), vm_1, "CalculatedDoseReferenceNumber", "Calculated Dose Reference Number", false},
+    tag_info{dicom_tag{0x3008, 0x0074}, vr(VR::ST), vm_1, "CalculatedDoseReferenceDescription", "Calculated Dose Reference Description", false},
+    tag_info{dicom_tag{0x3008, 0x0076}, vr(VR::DS), vm_1, "CalculatedDoseReferenceDoseValue", "Calculated Dose Reference Dose Value", false},
+    tag_info{dicom_tag{0x3008, 0x0078}, vr(VR::DS), vm_1, "StartMeterset", "Start Meterset", false},
+    tag_info{dicom_tag{0x3008, 0x007A}, vr(VR::DS), vm_1, "EndMeterset", "End Meterset", false},
+    tag_info{dicom_tag{0x3008, 0x0080}, vr(VR::SQ), vm_1, "ReferencedMeasuredDoseReferenceSequence", "Referenced Measured Dose Reference Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0082}, vr(VR::IS), vm_1, "ReferencedMeasuredDoseReferenceNumber", "Referenced Measured Dose Reference Number", false},
+    tag_info{dicom_tag{0x3008, 0x0090}, vr(VR::SQ), vm_1, "ReferencedCalculatedDoseReferenceSequence", "Referenced Calculated Dose Reference Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0092}, vr(VR::IS), vm_1, "ReferencedCalculatedDoseReferenceNumber", "Referenced Calculated Dose Reference Number", false},
+    tag_info{dicom_tag{0x3008, 0x00A0}, vr(VR::SQ), vm_1, "BeamLimitingDeviceLeafPairsSequence", "Beam Limiting Device Leaf Pairs Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x00A1}, vr(VR::SQ), vm_1, "EnhancedRTBeamLimitingDeviceSequence", "Enhanced RT Beam Limiting Device Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x00A2}, vr(VR::SQ), vm_1, "EnhancedRTBeamLimitingOpeningSequence", "Enhanced RT Beam Limiting Opening Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x00A3}, vr(VR::CS), vm_1, "EnhancedRTBeamLimitingDeviceDefinitionFlag", "Enhanced RT Beam Limiting Device Definition Flag", false},
+    tag_info{dicom_tag{0x3008, 0x00A4}, vr(VR::FD), vm_2_2n, "ParallelRTBeamDelimiterOpeningExtents", "Parallel RT Beam Delimiter Opening Extents", false},
+    tag_info{dicom_tag{0x3008, 0x00B0}, vr(VR::SQ), vm_1, "RecordedWedgeSequence", "Recorded Wedge Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x00C0}, vr(VR::SQ), vm_1, "RecordedCompensatorSequence", "Recorded Compensator Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x00D0}, vr(VR::SQ), vm_1, "RecordedBlockSequence", "Recorded Block Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x00D1}, vr(VR::SQ), vm_1, "RecordedBlockSlabSequence", "Recorded Block Slab Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x00E0}, vr(VR::SQ), vm_1, "TreatmentSummaryMeasuredDoseReferenceSequence", "Treatment Summary Measured Dose Reference Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x00F0}, vr(VR::SQ), vm_1, "RecordedSnoutSequence", "Recorded Snout Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x00F2}, vr(VR::SQ), vm_1, "RecordedRangeShifterSequence", "Recorded Range Shifter Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x00F4}, vr(VR::SQ), vm_1, "RecordedLateralSpreadingDeviceSequence", "Recorded Lateral Spreading Device Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x00F6}, vr(VR::SQ), vm_1, "RecordedRangeModulatorSequence", "Recorded Range Modulator Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0100}, vr(VR::SQ), vm_1, "RecordedSourceSequence", "Recorded Source Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0105}, vr(VR::LO), vm_1, "SourceSerialNumber", "Source Serial Number", false},
+    tag_info{dicom_tag{0x3008, 0x0110}, vr(VR::SQ), vm_1, "TreatmentSessionApplicationSetupSequence", "Treatment Session Application Setup Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0116}, vr(VR::CS), vm_1, "ApplicationSetupCheck", "Application Setup Check", false},
+    tag_info{dicom_tag{0x3008, 0x0120}, vr(VR::SQ), vm_1, "RecordedBrachyAccessoryDeviceSequence", "Recorded Brachy Accessory Device Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0122}, vr(VR::IS), vm_1, "ReferencedBrachyAccessoryDeviceNumber", "Referenced Brachy Accessory Device Number", false},
+    tag_info{dicom_tag{0x3008, 0x0130}, vr(VR::SQ), vm_1, "RecordedChannelSequence", "Recorded Channel Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0132}, vr(VR::DS), vm_1, "SpecifiedChannelTotalTime", "Specified Channel Total Time", false},
+    tag_info{dicom_tag{0x3008, 0x0134}, vr(VR::DS), vm_1, "DeliveredChannelTotalTime", "Delivered Channel Total Time", false},
+    tag_info{dicom_tag{0x3008, 0x0136}, vr(VR::IS), vm_1, "SpecifiedNumberOfPulses", "Specified Number of Pulses", false},
+    tag_info{dicom_tag{0x3008, 0x0138}, vr(VR::IS), vm_1, "DeliveredNumberOfPulses", "Delivered Number of Pulses", false},
+    tag_info{dicom_tag{0x3008, 0x013A}, vr(VR::DS), vm_1, "SpecifiedPulseRepetitionInterval", "Specified Pulse Repetition Interval", false},
+    tag_info{dicom_tag{0x3008, 0x013C}, vr(VR::DS), vm_1, "DeliveredPulseRepetitionInterval", "Delivered Pulse Repetition Interval", false},
+    tag_info{dicom_tag{0x3008, 0x0140}, vr(VR::SQ), vm_1, "RecordedSourceApplicatorSequence", "Recorded Source Applicator Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0142}, vr(VR::IS), vm_1, "ReferencedSourceApplicatorNumber", "Referenced Source Applicator Number", false},
+    tag_info{dicom_tag{0x3008, 0x0150}, vr(VR::SQ), vm_1, "RecordedChannelShieldSequence", "Recorded Channel Shield Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0152}, vr(VR::IS), vm_1, "ReferencedChannelShieldNumber", "Referenced Channel Shield Number", false},
+    tag_info{dicom_tag{0x3008, 0x0160}, vr(VR::SQ), vm_1, "BrachyControlPointDeliveredSequence", "Brachy Control Point Delivered Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0162}, vr(VR::DA), vm_1, "SafePositionExitDate", "Safe Position Exit Date", false},
+    tag_info{dicom_tag{0x3008, 0x0164}, vr(VR::TM), vm_1, "SafePositionExitTime", "Safe Position Exit Time", false},
+    tag_info{dicom_tag{0x3008, 0x0166}, vr(VR::DA), vm_1, "SafePositionReturnDate", "Safe Position Return Date", false},
+    tag_info{dicom_tag{0x3008, 0x0168}, vr(VR::TM), vm_1, "SafePositionReturnTime", "Safe Position Return Time", false},
+    tag_info{dicom_tag{0x3008, 0x0171}, vr(VR::SQ), vm_1, "PulseSpecificBrachyControlPointDeliveredSequence", "Pulse Specific Brachy Control Point Delivered Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0172}, vr(VR::US), vm_1, "PulseNumber", "Pulse Number", false},
+    tag_info{dicom_tag{0x3008, 0x0173}, vr(VR::SQ), vm_1, "BrachyPulseControlPointDeliveredSequence", "Brachy Pulse Control Point Delivered Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0200}, vr(VR::CS), vm_1, "CurrentTreatmentStatus", "Current Treatment Status", false},
+    tag_info{dicom_tag{0x3008, 0x0202}, vr(VR::ST), vm_1, "TreatmentStatusComment", "Treatment Status Comment", false},
+    tag_info{dicom_tag{0x3008, 0x0220}, vr(VR::SQ), vm_1, "FractionGroupSummarySequence", "Fraction Group Summary Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0223}, vr(VR::IS), vm_1, "ReferencedFractionNumber", "Referenced Fraction Number", false},
+    tag_info{dicom_tag{0x3008, 0x0224}, vr(VR::CS), vm_1, "FractionGroupType", "Fraction Group Type", false},
+    tag_info{dicom_tag{0x3008, 0x0230}, vr(VR::CS), vm_1, "BeamStopperPosition", "Beam Stopper Position", false},
+    tag_info{dicom_tag{0x3008, 0x0240}, vr(VR::SQ), vm_1, "FractionStatusSummarySequence", "Fraction Status Summary Sequence", false},
+    tag_info{dicom_tag{0x3008, 0x0250}, vr(VR::DA), vm_1, "TreatmentDate", "Treatment Date", false},
+    tag_info{dicom_tag{0x3008, 0x0251}, vr(VR::TM), vm_1, "TreatmentTime", "Treatment Time", false},
+    tag_info{dicom_tag{0x300A, 0x0002}, vr(VR::SH), vm_1, "RTPlanLabel", "RT Plan Label", false},
+    tag_info{dicom_tag{0x300A, 0x0003}, vr(VR::LO), vm_1, "RTPlanName", "RT Plan Name", false},
+    tag_info{dicom_tag{0x300A, 0x0004}, vr(VR::ST), vm_1, "RTPlanDescription", "RT Plan Description", false},
+    tag_info{dicom_tag{0x300A, 0x0006}, vr(VR::DA), vm_1, "RTPlanDate", "RT Plan Date", false},
+    tag_info{dicom_tag{0x300A, 0x0007}, vr(VR::TM), vm_1, "RTPlanTime", "RT Plan Time", false},
+    tag_info{dicom_tag{0x300A, 0x0009}, vr(VR::LO), vm_1_n, "TreatmentProtocols", "Treatment Protocols", false},
+    tag_info{dicom_tag{0x300A, 0x000A}, vr(VR::CS), vm_1, "PlanIntent", "Plan Intent", false},
+    tag_info{dicom_tag{0x300A, 0x000B}, vr(VR::LO), vm_1_n, "TreatmentSites", "Treatment Sites", true},
+    tag_info{dicom_tag{0x300A, 0x000C}, vr(VR::CS), vm_1, "RTPlanGeometry", "RT Plan Geometry", false},
+    tag_info{dicom_tag{0x300A, 0x000E}, vr(VR::ST), vm_1, "PrescriptionDescription", "Prescription Description", false},
+    tag_info{dicom_tag{0x300A, 0x0010}, vr(VR::SQ), vm_1, "DoseReferenceSequence", "Dose Reference Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0012}, vr(VR::IS), vm_1, "DoseReferenceNumber", "Dose Reference Number", false},
+    tag_info{dicom_tag{0x300A, 0x0013}, vr(VR::UI), vm_1, "DoseReferenceUID", "Dose Reference UID", false},
+    tag_info{dicom_tag{0x300A, 0x0014}, vr(VR::CS), vm_1, "DoseReferenceStructureType", "Dose Reference Structure Type", false},
+    tag_info{dicom_tag{0x300A, 0x0015}, vr(VR::CS), vm_1, "NominalBeamEnergyUnit", "Nominal Beam Energy Unit", false},
+    tag_info{dicom_tag{0x300A, 0x0016}, vr(VR::LO), vm_1, "DoseReferenceDescription", "Dose Reference Description", false},
+    tag_info{dicom_tag{0x300A, 0x0018}, vr(VR::DS), vm_3, "DoseReferencePointCoordinates", "Dose Reference Point Coordinates", false},
+    tag_info{dicom_tag{0x300A, 0x001A}, vr(VR::DS), vm_1, "NominalPriorDose", "Nominal Prior Dose", false},
+    tag_info{dicom_tag{0x300A, 0x0020}, vr(VR::CS), vm_1, "DoseReferenceType", "Dose Reference Type", false},
+    tag_info{dicom_tag{0x300A, 0x0021}, vr(VR::DS), vm_1, "ConstraintWeight", "Constraint Weight", false},
+    tag_info{dicom_tag{0x300A, 0x0022}, vr(VR::DS), vm_1, "DeliveryWarningDose", "Delivery Warning Dose", false},
+    tag_info{dicom_tag{0x300A, 0x0023}, vr(VR::DS), vm_1, "DeliveryMaximumDose", "Delivery Maximum Dose", false},
+    tag_info{dicom_tag{0x300A, 0x0025}, vr(VR::DS), vm_1, "TargetMinimumDose", "Target Minimum Dose", false},
+    tag_info{dicom_tag{0x300A, 0x0026}, vr(VR::DS), vm_1, "TargetPrescriptionDose", "Target Prescription Dose", false},
+    tag_info{dicom_tag{0x300A, 0x0027}, vr(VR::DS), vm_1, "TargetMaximumDose", "Target Maximum Dose", false},
+    tag_info{dicom_tag{0x300A, 0x0028}, vr(VR::DS), vm_1, "TargetUnderdoseVolumeFraction", "Target Underdose Volume Fraction", false},
+    tag_info{dicom_tag{0x300A, 0x002A}, vr(VR::DS), vm_1, "OrganAtRiskFullVolumeDose", "Organ at Risk Full-volume Dose", false},
+    tag_info{dicom_tag{0x300A, 0x002B}, vr(VR::DS), vm_1, "OrganAtRiskLimitDose", "Organ at Risk Limit Dose", false},
+    tag_info{dicom_tag{0x300A, 0x002C}, vr(VR::DS), vm_1, "OrganAtRiskMaximumDose", "Organ at Risk Maximum Dose", false},
+    tag_info{dicom_tag{0x300A, 0x002D}, vr(VR::DS), vm_1, "OrganAtRiskOverdoseVolumeFraction", "Organ at Risk Overdose Volume Fraction", false},
+    tag_info{dicom_tag{0x300A, 0x0040}, vr(VR::SQ), vm_1, "ToleranceTableSequence", "Tolerance Table Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0042}, vr(VR::IS), vm_1, "ToleranceTableNumber", "Tolerance Table Number", false},
+    tag_info{dicom_tag{0x300A, 0x0043}, vr(VR::SH), vm_1, "ToleranceTableLabel", "Tolerance Table Label", false},
+    tag_info{dicom_tag{0x300A, 0x0044}, vr(VR::DS), vm_1, "GantryAngleTolerance", "Gantry Angle Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x0046}, vr(VR::DS), vm_1, "BeamLimitingDeviceAngleTolerance", "Beam Limiting Device Angle Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x0048}, vr(VR::SQ), vm_1, "BeamLimitingDeviceToleranceSequence", "Beam Limiting Device Tolerance Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x004A}, vr(VR::DS), vm_1, "BeamLimitingDevicePositionTolerance", "Beam Limiting Device Position Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x004B}, vr(VR::FL), vm_1, "SnoutPositionTolerance", "Snout Position Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x004C}, vr(VR::DS), vm_1, "PatientSupportAngleTolerance", "Patient Support Angle Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x004E}, vr(VR::DS), vm_1, "TableTopEccentricAngleTolerance", "Table Top Eccentric Angle Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x004F}, vr(VR::FL), vm_1, "TableTopPitchAngleTolerance", "Table Top Pitch Angle Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x0050}, vr(VR::FL), vm_1, "TableTopRollAngleTolerance", "Table Top Roll Angle Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x0051}, vr(VR::DS), vm_1, "TableTopVerticalPositionTolerance", "Table Top Vertical Position Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x0052}, vr(VR::DS), vm_1, "TableTopLongitudinalPositionTolerance", "Table Top Longitudinal Position Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x0053}, vr(VR::DS), vm_1, "TableTopLateralPositionTolerance", "Table Top Lateral Position Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x0054}, vr(VR::UI), vm_1, "TableTopPositionAlignmentUID", "Table Top Position Alignment UID", false},
+    tag_info{dicom_tag{0x300A, 0x0055}, vr(VR::CS), vm_1, "RTPlanRelationship", "RT Plan Relationship", false},
+    tag_info{dicom_tag{0x300A, 0x0070}, vr(VR::SQ), vm_1, "FractionGroupSequence", "Fraction Group Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0071}, vr(VR::IS), vm_1, "FractionGroupNumber", "Fraction Group Number", false},
+    tag_info{dicom_tag{0x300A, 0x0072}, vr(VR::LO), vm_1, "FractionGroupDescription", "Fraction Group Description", false},
+    tag_info{dicom_tag{0x300A, 0x0078}, vr(VR::IS), vm_1, "NumberOfFractionsPlanned", "Number of Fractions Planned", false},
+    tag_info{dicom_tag{0x300A, 0x0079}, vr(VR::IS), vm_1, "NumberOfFractionPatternDigitsPerDay", "Number of Fraction Pattern Digits Per Day", false},
+    tag_info{dicom_tag{0x300A, 0x007A}, vr(VR::IS), vm_1, "RepeatFractionCycleLength", "Repeat Fraction Cycle Length", false},
+    tag_info{dicom_tag{0x300A, 0x007B}, vr(VR::LT), vm_1, "FractionPattern", "Fraction Pattern", false},
+    tag_info{dicom_tag{0x300A, 0x0080}, vr(VR::IS), vm_1, "NumberOfBeams", "Number of Beams", false},
+    tag_info{dicom_tag{0x300A, 0x0082}, vr(VR::DS), vm_3, "BeamDoseSpecificationPoint", "Beam Dose Specification Point", true},
+    tag_info{dicom_tag{0x300A, 0x0083}, vr(VR::UI), vm_1, "ReferencedDoseReferenceUID", "Referenced Dose Reference UID", false},
+    tag_info{dicom_tag{0x300A, 0x0084}, vr(VR::DS), vm_1, "BeamDose", "Beam Dose", false},
+    tag_info{dicom_tag{0x300A, 0x0086}, vr(VR::DS), vm_1, "BeamMeterset", "Beam Meterset", false},
+    tag_info{dicom_tag{0x300A, 0x0088}, vr(VR::FL), vm_1, "BeamDosePointDepth", "Beam Dose Point Depth", false},
+    tag_info{dicom_tag{0x300A, 0x0089}, vr(VR::FL), vm_1, "BeamDosePointEquivalentDepth", "Beam Dose Point Equivalent Depth", false},
+    tag_info{dicom_tag{0x300A, 0x008A}, vr(VR::FL), vm_1, "BeamDosePointSSD", "Beam Dose Point SSD", false},
+    tag_info{dicom_tag{0x300A, 0x008B}, vr(VR::CS), vm_1, "BeamDoseMeaning", "Beam Dose Meaning", false},
+    tag_info{dicom_tag{0x300A, 0x008C}, vr(VR::SQ), vm_1, "BeamDoseVerificationControlPointSequence", "Beam Dose Verification Control Point Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x008D}, vr(VR::FL), vm_1, "AverageBeamDosePointDepth", "Average Beam Dose Point Depth", true},
+    tag_info{dicom_tag{0x300A, 0x008E}, vr(VR::FL), vm_1, "AverageBeamDosePointEquivalentDepth", "Average Beam Dose Point Equivalent Depth", true},
+    tag_info{dicom_tag{0x300A, 0x008F}, vr(VR::FL), vm_1, "AverageBeamDosePointSSD", "Average Beam Dose Point SSD", true},
+    tag_info{dicom_tag{0x300A, 0x0090}, vr(VR::CS), vm_1, "BeamDoseType", "Beam Dose Type", false},
+    tag_info{dicom_tag{0x300A, 0x0091}, vr(VR::DS), vm_1, "AlternateBeamDose", "Alternate Beam Dose", false},
+    tag_info{dicom_tag{0x300A, 0x0092}, vr(VR::CS), vm_1, "AlternateBeamDoseType", "Alternate Beam Dose Type", false},
+    tag_info{dicom_tag{0x300A, 0x0093}, vr(VR::CS), vm_1, "DepthValueAveragingFlag", "Depth Value Averaging Flag", false},
+    tag_info{dicom_tag{0x300A, 0x0094}, vr(VR::DS), vm_1, "BeamDosePointSourceToExternalContourDistance", "Beam Dose Point Source to External Contour Distance", false},
+    tag_info{dicom_tag{0x300A, 0x00A0}, vr(VR::IS), vm_1, "NumberOfBrachyApplicationSetups", "Number of Brachy Application Setups", false},
+    tag_info{dicom_tag{0x300A, 0x00A2}, vr(VR::DS), vm_3, "BrachyApplicationSetupDoseSpecificationPoint", "Brachy Application Setup Dose Specification Point", false},
+    tag_info{dicom_tag{0x300A, 0x00A4}, vr(VR::DS), vm_1, "BrachyApplicationSetupDose", "Brachy Application Setup Dose", false},
+    tag_info{dicom_tag{0x300A, 0x00B0}, vr(VR::SQ), vm_1, "BeamSequence", "Beam Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x00B2}, vr(VR::SH), vm_1, "TreatmentMachineName", "Treatment Machine Name", false},
+    tag_info{dicom_tag{0x300A, 0x00B3}, vr(VR::CS), vm_1, "PrimaryDosimeterUnit", "Primary Dosimeter Unit", false},
+    tag_info{dicom_tag{0x300A, 0x00B4}, vr(VR::DS), vm_1, "SourceAxisDistance", "Source-Axis Distance", false},
+    tag_info{dicom_tag{0x300A, 0x00B6}, vr(VR::SQ), vm_1, "BeamLimitingDeviceSequence", "Beam Limiting Device Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x00B8}, vr(VR::CS), vm_1, "RTBeamLimitingDeviceType", "RT Beam Limiting Device Type", false},
+    tag_info{dicom_tag{0x300A, 0x00BA}, vr(VR::DS), vm_1, "SourceToBeamLimitingDeviceDistance", "Source to Beam Limiting Device Distance", false},
+    tag_info{dicom_tag{0x300A, 0x00BB}, vr(VR::FL), vm_1, "IsocenterToBeamLimitingDeviceDistance", "Isocenter to Beam Limiting Device Distance", false},
+    tag_info{dicom_tag{0x300A, 0x00BC}, vr(VR::IS), vm_1, "NumberOfLeafJawPairs", "Number of Leaf/Jaw Pairs", false},
+    tag_info{dicom_tag{0x300A, 0x00BE}, vr(VR::DS), vm_3_n, "LeafPositionBoundaries", "Leaf Position Boundaries", false},
+    tag_info{dicom_tag{0x300A, 0x00C0}, vr(VR::IS), vm_1, "BeamNumber", "Beam Number", false},
+    tag_info{dicom_tag{0x300A, 0x00C2}, vr(VR::LO), vm_1, "BeamName", "Beam Name", false},
+    tag_info{dicom_tag{0x300A, 0x00C3}, vr(VR::ST), vm_1, "BeamDescription", "Beam Description", false},
+    tag_info{dicom_tag{0x300A, 0x00C4}, vr(VR::CS), vm_1, "BeamType", "Beam Type", false},
+    tag_info{dicom_tag{0x300A, 0x00C5}, vr(VR::FD), vm_1, "BeamDeliveryDurationLimit", "Beam Delivery Duration Limit", false},
+    tag_info{dicom_tag{0x300A, 0x00C6}, vr(VR::CS), vm_1, "RadiationType", "Radiation Type", false},
+    tag_info{dicom_tag{0x300A, 0x00C7}, vr(VR::CS), vm_1, "HighDoseTechniqueType", "High-Dose Technique Type", false},
+    tag_info{dicom_tag{0x300A, 0x00C8}, vr(VR::IS), vm_1, "ReferenceImageNumber", "Reference Image Number", false},
+    tag_info{dicom_tag{0x300A, 0x00CA}, vr(VR::SQ), vm_1, "PlannedVerificationImageSequence", "Planned Verification Image Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x00CC}, vr(VR::LO), vm_1_n, "ImagingDeviceSpecificAcquisitionParameters", "Imaging Device-Specific Acquisition Parameters", false},
+    tag_info{dicom_tag{0x300A, 0x00CE}, vr(VR::CS), vm_1, "TreatmentDeliveryType", "Treatment Delivery Type", false},
+    tag_info{dicom_tag{0x300A, 0x00D0}, vr(VR::IS), vm_1, "NumberOfWedges", "Number of Wedges", false},
+    tag_info{dicom_tag{0x300A, 0x00D1}, vr(VR::SQ), vm_1, "WedgeSequence", "Wedge Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x00D2}, vr(VR::IS), vm_1, "WedgeNumber", "Wedge Number", false},
+    tag_info{dicom_tag{0x300A, 0x00D3}, vr(VR::CS), vm_1, "WedgeType", "Wedge Type", false},
+    tag_info{dicom_tag{0x300A, 0x00D4}, vr(VR::SH), vm_1, "WedgeID", "Wedge ID", false},
+    tag_info{dicom_tag{0x300A, 0x00D5}, vr(VR::IS), vm_1, "WedgeAngle", "Wedge Angle", false},
+    tag_info{dicom_tag{0x300A, 0x00D6}, vr(VR::DS), vm_1, "WedgeFactor", "Wedge Factor", false},
+    tag_info{dicom_tag{0x300A, 0x00D7}, vr(VR::FL), vm_1, "TotalWedgeTrayWaterEquivalentThickness", "Total Wedge Tray Water-Equivalent Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x00D8}, vr(VR::DS), vm_1, "WedgeOrientation", "Wedge Orientation", false},
+    tag_info{dicom_tag{0x300A, 0x00D9}, vr(VR::FL), vm_1, "IsocenterToWedgeTrayDistance", "Isocenter to Wedge Tray Distance", false},
+    tag_info{dicom_tag{0x300A, 0x00DA}, vr(VR::DS), vm_1, "SourceToWedgeTrayDistance", "Source to Wedge Tray Distance", false},
+    tag_info{dicom_tag{0x300A, 0x00DB}, vr(VR::FL), vm_1, "WedgeThinEdgePosition", "Wedge Thin Edge Position", false},
+    tag_info{dicom_tag{0x300A, 0x00DC}, vr(VR::SH), vm_1, "BolusID", "Bolus ID", false},
+    tag_info{dicom_tag{0x300A, 0x00DD}, vr(VR::ST), vm_1, "BolusDescription", "Bolus Description", false},
+    tag_info{dicom_tag{0x300A, 0x00DE}, vr(VR::DS), vm_1, "EffectiveWedgeAngle", "Effective Wedge Angle", false},
+    tag_info{dicom_tag{0x300A, 0x00E0}, vr(VR::IS), vm_1, "NumberOfCompensators", "Number of Compensators", false},
+    tag_info{dicom_tag{0x300A, 0x00E1}, vr(VR::SH), vm_1, "MaterialID", "Material ID", false},
+    tag_info{dicom_tag{0x300A, 0x00E2}, vr(VR::DS), vm_1, "TotalCompensatorTrayFactor", "Total Compensator Tray Factor", false},
+    tag_info{dicom_tag{0x300A, 0x00E3}, vr(VR::SQ), vm_1, "CompensatorSequence", "Compensator Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x00E4}, vr(VR::IS), vm_1, "CompensatorNumber", "Compensator Number", false},
+    tag_info{dicom_tag{0x300A, 0x00E5}, vr(VR::SH), vm_1, "CompensatorID", "Compensator ID", false},
+    tag_info{dicom_tag{0x300A, 0x00E6}, vr(VR::DS), vm_1, "SourceToCompensatorTrayDistance", "Source to Compensator Tray Distance", false},
+    tag_info{dicom_tag{0x300A, 0x00E7}, vr(VR::IS), vm_1, "CompensatorRows", "Compensator Rows", false},
+    tag_info{dicom_tag{0x300A, 0x00E8}, vr(VR::IS), vm_1, "CompensatorColumns", "Compensator Columns", false},
+    tag_info{dicom_tag{0x300A, 0x00E9}, vr(VR::DS), vm_2, "CompensatorPixelSpacing", "Compensator Pixel Spacing", false},
+    tag_info{dicom_tag{0x300A, 0x00EA}, vr(VR::DS), vm_2, "CompensatorPosition", "Compensator Position", false},
+    tag_info{dicom_tag{0x300A, 0x00EB}, vr(VR::DS), vm_1_n, "CompensatorTransmissionData", "Compensator Transmission Data", false},
+    tag_info{dicom_tag{0x300A, 0x00EC}, vr(VR::DS), vm_1_n, "CompensatorThicknessData", "Compensator Thickness Data", false},
+    tag_info{dicom_tag{0x300A, 0x00ED}, vr(VR::IS), vm_1, "NumberOfBoli", "Number of Boli", false},
+    tag_info{dicom_tag{0x300A, 0x00EE}, vr(VR::CS), vm_1, "CompensatorType", "Compensator Type", false},
+    tag_info{dicom_tag{0x300A, 0x00EF}, vr(VR::SH), vm_1, "CompensatorTrayID", "Compensator Tray ID", false},
+    tag_info{dicom_tag{0x300A, 0x00F0}, vr(VR::IS), vm_1, "NumberOfBlocks", "Number of Blocks", false},
+    tag_info{dicom_tag{0x300A, 0x00F2}, vr(VR::DS), vm_1, "TotalBlockTrayFactor", "Total Block Tray Factor", false},
+    tag_info{dicom_tag{0x300A, 0x00F3}, vr(VR::FL), vm_1, "TotalBlockTrayWaterEquivalentThickness", "Total Block Tray Water-Equivalent Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x00F4}, vr(VR::SQ), vm_1, "BlockSequence", "Block Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x00F5}, vr(VR::SH), vm_1, "BlockTrayID", "Block Tray ID", false},
+    tag_info{dicom_tag{0x300A, 0x00F6}, vr(VR::DS), vm_1, "SourceToBlockTrayDistance", "Source to Block Tray Distance", false},
+    tag_info{dicom_tag{0x300A, 0x00F7}, vr(VR::FL), vm_1, "IsocenterToBlockTrayDistance", "Isocenter to Block Tray Distance", false},
+    tag_info{dicom_tag{0x300A, 0x00F8}, vr(VR::CS), vm_1, "BlockType", "Block Type", false},
+    tag_info{dicom_tag{0x300A, 0x00F9}, vr(VR::LO), vm_1, "AccessoryCode", "Accessory Code", false},
+    tag_info{dicom_tag{0x300A, 0x00FA}, vr(VR::CS), vm_1, "BlockDivergence", "Block Divergence", false},
+    tag_info{dicom_tag{0x300A, 0x00FB}, vr(VR::CS), vm_1, "BlockMountingPosition", "Block Mounting Position", false},
+    tag_info{dicom_tag{0x300A, 0x00FC}, vr(VR::IS), vm_1, "BlockNumber", "Block Number", false},
+    tag_info{dicom_tag{0x300A, 0x00FE}, vr(VR::LO), vm_1, "BlockName", "Block Name", false},
+    tag_info{dicom_tag{0x300A, 0x0100}, vr(VR::DS), vm_1, "BlockThickness", "Block Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x0102}, vr(VR::DS), vm_1, "BlockTransmission", "Block Transmission", false},
+    tag_info{dicom_tag{0x300A, 0x0104}, vr(VR::IS), vm_1, "BlockNumberOfPoints", "Block Number of Points", false},
+    tag_info{dicom_tag{0x300A, 0x0106}, vr(VR::DS), vm_2_2n, "BlockData", "Block Data", false},
+    tag_info{dicom_tag{0x300A, 0x0107}, vr(VR::SQ), vm_1, "ApplicatorSequence", "Applicator Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0108}, vr(VR::SH), vm_1, "ApplicatorID", "Applicator ID", false},
+    tag_info{dicom_tag{0x300A, 0x0109}, vr(VR::CS), vm_1, "ApplicatorType", "Applicator Type", false},
+    tag_info{dicom_tag{0x300A, 0x010A}, vr(VR::LO), vm_1, "ApplicatorDescription", "Applicator Description", false},
+    tag_info{dicom_tag{0x300A, 0x010C}, vr(VR::DS), vm_1, "CumulativeDoseReferenceCoefficient", "Cumulative Dose Reference Coefficient", false},
+    tag_info{dicom_tag{0x300A, 0x010E}, vr(VR::DS), vm_1, "FinalCumulativeMetersetWeight", "Final Cumulative Meterset Weight", false},
+    tag_info{dicom_tag{0x300A, 0x0110}, vr(VR::IS), vm_1, "NumberOfControlPoints", "Number of Control Points", false},
+    tag_info{dicom_tag{0x300A, 0x0111}, vr(VR::SQ), vm_1, "ControlPointSequence", "Control Point Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0112}, vr(VR::IS), vm_1, "ControlPointIndex", "Control Point Index", false},
+    tag_info{dicom_tag{0x300A, 0x0114}, vr(VR::DS), vm_1, "NominalBeamEnergy", "Nominal Beam Energy", false},
+    tag_info{dicom_tag{0x300A, 0x0115}, vr(VR::DS), vm_1, "DoseRateSet", "Dose Rate Set", false},
+    tag_info{dicom_tag{0x300A, 0x0116}, vr(VR::SQ), vm_1, "WedgePositionSequence", "Wedge Position Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0118}, vr(VR::CS), vm_1, "WedgePosition", "Wedge Position", false},
+    tag_info{dicom_tag{0x300A, 0x011A}, vr(VR::SQ), vm_1, "BeamLimitingDevicePositionSequence", "Beam Limiting Device Position Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x011C}, vr(VR::DS), vm_2_2n, "LeafJawPositions", "Leaf/Jaw Positions", false},
+    tag_info{dicom_tag{0x300A, 0x011E}, vr(VR::DS), vm_1, "GantryAngle", "Gantry Angle", false},
+    tag_info{dicom_tag{0x300A, 0x011F}, vr(VR::CS), vm_1, "GantryRotationDirection", "Gantry Rotation Direction", false},
+    tag_info{dicom_tag{0x300A, 0x0120}, vr(VR::DS), vm_1, "BeamLimitingDeviceAngle", "Beam Limiting Device Angle", false},
+    tag_info{dicom_tag{0x300A, 0x0121}, vr(VR::CS), vm_1, "BeamLimitingDeviceRotationDirection", "Beam Limiting Device Rotation Direction", false},
+    tag_info{dicom_tag{0x300A, 0x0122}, vr(VR::DS), vm_1, "PatientSupportAngle", "Patient Support Angle", false},
+    tag_info{dicom_tag{0x300A, 0x0123}, vr(VR::CS), vm_1, "PatientSupportRotationDirection", "Patient Support Rotation Direction", false},
+    tag_info{dicom_tag{0x300A, 0x0124}, vr(VR::DS), vm_1, "TableTopEccentricAxisDistance", "Table Top Eccentric Axis Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0125}, vr(VR::DS), vm_1, "TableTopEccentricAngle", "Table Top Eccentric Angle", false},
+    tag_info{dicom_tag{0x300A, 0x0126}, vr(VR::CS), vm_1, "TableTopEccentricRotationDirection", "Table Top Eccentric Rotation Direction", false},
+    tag_info{dicom_tag{0x300A, 0x0128}, vr(VR::DS), vm_1, "TableTopVerticalPosition", "Table Top Vertical Position", false},
+    tag_info{dicom_tag{0x300A, 0x0129}, vr(VR::DS), vm_1, "TableTopLongitudinalPosition", "Table Top Longitudinal Position", false},
+    tag_info{dicom_tag{0x300A, 0x012A}, vr(VR::DS), vm_1, "TableTopLateralPosition", "Table Top Lateral Position", false},
+    tag_info{dicom_tag{0x300A, 0x012C}, vr(VR::DS), vm_3, "IsocenterPosition", "Isocenter Position", false},
+    tag_info{dicom_tag{0x300A, 0x012E}, vr(VR::DS), vm_3, "SurfaceEntryPoint", "Surface Entry Point", false},
+    tag_info{dicom_tag{0x300A, 0x0130}, vr(VR::DS), vm_1, "SourceToSurfaceDistance", "Source to Surface Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0131}, vr(VR::FL), vm_1, "AverageBeamDosePointSourceToExternalContourDistance", "Average Beam Dose Point Source to External Contour Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0132}, vr(VR::FL), vm_1, "SourceToExternalContourDistance", "Source to External Contour Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0133}, vr(VR::FL), vm_3, "ExternalContourEntryPoint", "External Contour Entry Point", false},
+    tag_info{dicom_tag{0x300A, 0x0134}, vr(VR::DS), vm_1, "CumulativeMetersetWeight", "Cumulative Meterset Weight", false},
+    tag_info{dicom_tag{0x300A, 0x0140}, vr(VR::FL), vm_1, "TableTopPitchAngle", "Table Top Pitch Angle", false},
+    tag_info{dicom_tag{0x300A, 0x0142}, vr(VR::CS), vm_1, "TableTopPitchRotationDirection", "Table Top Pitch Rotation Direction", false},
+    tag_info{dicom_tag{0x300A, 0x0144}, vr(VR::FL), vm_1, "TableTopRollAngle", "Table Top Roll Angle", false},
+    tag_info{dicom_tag{0x300A, 0x0146}, vr(VR::CS), vm_1, "TableTopRollRotationDirection", "Table Top Roll Rotation Direction", false},
+    tag_info{dicom_tag{0x300A, 0x0148}, vr(VR::FL), vm_1, "HeadFixationAngle", "Head Fixation Angle", false},
+    tag_info{dicom_tag{0x300A, 0x014A}, vr(VR::FL), vm_1, "GantryPitchAngle", "Gantry Pitch Angle", false},
+    tag_info{dicom_tag{0x300A, 0x014C}, vr(VR::CS), vm_1, "GantryPitchRotationDirection", "Gantry Pitch Rotation Direction", false},
+    tag_info{dicom_tag{0x300A, 0x014E}, vr(VR::FL), vm_1, "GantryPitchAngleTolerance", "Gantry Pitch Angle Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x0150}, vr(VR::CS), vm_1, "FixationEye", "Fixation Eye", false},
+    tag_info{dicom_tag{0x300A, 0x0151}, vr(VR::DS), vm_1, "ChairHeadFramePosition", "Chair Head Frame Position", false},
+    tag_info{dicom_tag{0x300A, 0x0152}, vr(VR::DS), vm_1, "HeadFixationAngleTolerance", "Head Fixation Angle Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x0153}, vr(VR::DS), vm_1, "ChairHeadFramePositionTolerance", "Chair Head Frame Position Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x0154}, vr(VR::DS), vm_1, "FixationLightAzimuthalAngleTolerance", "Fixation Light Azimuthal Angle Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x0155}, vr(VR::DS), vm_1, "FixationLightPolarAngleTolerance", "Fixation Light Polar Angle Tolerance", false},
+    tag_info{dicom_tag{0x300A, 0x0180}, vr(VR::SQ), vm_1, "PatientSetupSequence", "Patient Setup Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0182}, vr(VR::IS), vm_1, "PatientSetupNumber", "Patient Setup Number", false},
+    tag_info{dicom_tag{0x300A, 0x0183}, vr(VR::LO), vm_1, "PatientSetupLabel", "Patient Setup Label", false},
+    tag_info{dicom_tag{0x300A, 0x0184}, vr(VR::LO), vm_1, "PatientAdditionalPosition", "Patient Additional Position", false},
+    tag_info{dicom_tag{0x300A, 0x0190}, vr(VR::SQ), vm_1, "FixationDeviceSequence", "Fixation Device Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0192}, vr(VR::CS), vm_1, "FixationDeviceType", "Fixation Device Type", false},
+    tag_info{dicom_tag{0x300A, 0x0194}, vr(VR::SH), vm_1, "FixationDeviceLabel", "Fixation Device Label", false},
+    tag_info{dicom_tag{0x300A, 0x0196}, vr(VR::ST), vm_1, "FixationDeviceDescription", "Fixation Device Description", false},
+    tag_info{dicom_tag{0x300A, 0x0198}, vr(VR::SH), vm_1, "FixationDevicePosition", "Fixation Device Position", false},
+    tag_info{dicom_tag{0x300A, 0x0199}, vr(VR::FL), vm_1, "FixationDevicePitchAngle", "Fixation Device Pitch Angle", false},
+    tag_info{dicom_tag{0x300A, 0x019A}, vr(VR::FL), vm_1, "FixationDeviceRollAngle", "Fixation Device Roll Angle", false},
+    tag_info{dicom_tag{0x300A, 0x01A0}, vr(VR::SQ), vm_1, "ShieldingDeviceSequence", "Shielding Device Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x01A2}, vr(VR::CS), vm_1, "ShieldingDeviceType", "Shielding Device Type", false},
+    tag_info{dicom_tag{0x300A, 0x01A4}, vr(VR::SH), vm_1, "ShieldingDeviceLabel", "Shielding Device Label", false},
+    tag_info{dicom_tag{0x300A, 0x01A6}, vr(VR::ST), vm_1, "ShieldingDeviceDescription", "Shielding Device Description", false},
+    tag_info{dicom_tag{0x300A, 0x01A8}, vr(VR::SH), vm_1, "ShieldingDevicePosition", "Shielding Device Position", false},
+    tag_info{dicom_tag{0x300A, 0x01B0}, vr(VR::CS), vm_1, "SetupTechnique", "Setup Technique", false},
+    tag_info{dicom_tag{0x300A, 0x01B2}, vr(VR::ST), vm_1, "SetupTechniqueDescription", "Setup Technique Description", false},
+    tag_info{dicom_tag{0x300A, 0x01B4}, vr(VR::SQ), vm_1, "SetupDeviceSequence", "Setup Device Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x01B6}, vr(VR::CS), vm_1, "SetupDeviceType", "Setup Device Type", false},
+    tag_info{dicom_tag{0x300A, 0x01B8}, vr(VR::SH), vm_1, "SetupDeviceLabel", "Setup Device Label", false},
+    tag_info{dicom_tag{0x300A, 0x01BA}, vr(VR::ST), vm_1, "SetupDeviceDescription", "Setup Device Description", false},
+    tag_info{dicom_tag{0x300A, 0x01BC}, vr(VR::DS), vm_1, "SetupDeviceParameter", "Setup Device Parameter", false},
+    tag_info{dicom_tag{0x300A, 0x01D0}, vr(VR::ST), vm_1, "SetupReferenceDescription", "Setup Reference Description", false},
+    tag_info{dicom_tag{0x300A, 0x01D2}, vr(VR::DS), vm_1, "TableTopVerticalSetupDisplacement", "Table Top Vertical Setup Displacement", false},
+    tag_info{dicom_tag{0x300A, 0x01D4}, vr(VR::DS), vm_1, "TableTopLongitudinalSetupDisplacement", "Table Top Longitudinal Setup Displacement", false},
+    tag_info{dicom_tag{0x300A, 0x01D6}, vr(VR::DS), vm_1, "TableTopLateralSetupDisplacement", "Table Top Lateral Setup Displacement", false},
+    tag_info{dicom_tag{0x300A, 0x0200}, vr(VR::CS), vm_1, "BrachyTreatmentTechnique", "Brachy Treatment Technique", false},
+    tag_info{dicom_tag{0x300A, 0x0202}, vr(VR::CS), vm_1, "BrachyTreatmentType", "Brachy Treatment Type", false},
+    tag_info{dicom_tag{0x300A, 0x0206}, vr(VR::SQ), vm_1, "TreatmentMachineSequence", "Treatment Machine Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0210}, vr(VR::SQ), vm_1, "SourceSequence", "Source Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0212}, vr(VR::IS), vm_1, "SourceNumber", "Source Number", false},
+    tag_info{dicom_tag{0x300A, 0x0214}, vr(VR::CS), vm_1, "SourceType", "Source Type", false},
+    tag_info{dicom_tag{0x300A, 0x0216}, vr(VR::LO), vm_1, "SourceManufacturer", "Source Manufacturer", false},
+    tag_info{dicom_tag{0x300A, 0x0218}, vr(VR::DS), vm_1, "ActiveSourceDiameter", "Active Source Diameter", false},
+    tag_info{dicom_tag{0x300A, 0x021A}, vr(VR::DS), vm_1, "ActiveSourceLength", "Active Source Length", false},
+    tag_info{dicom_tag{0x300A, 0x021B}, vr(VR::SH), vm_1, "SourceModelID", "Source Model ID", false},
+    tag_info{dicom_tag{0x300A, 0x021C}, vr(VR::LO), vm_1, "SourceDescription", "Source Description", false},
+    tag_info{dicom_tag{0x300A, 0x0222}, vr(VR::DS), vm_1, "SourceEncapsulationNominalThickness", "Source Encapsulation Nominal Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x0224}, vr(VR::DS), vm_1, "SourceEncapsulationNominalTransmission", "Source Encapsulation Nominal Transmission", false},
+    tag_info{dicom_tag{0x300A, 0x0226}, vr(VR::LO), vm_1, "SourceIsotopeName", "Source Isotope Name", false},
+    tag_info{dicom_tag{0x300A, 0x0228}, vr(VR::DS), vm_1, "SourceIsotopeHalfLife", "Source Isotope Half Life", false},
+    tag_info{dicom_tag{0x300A, 0x0229}, vr(VR::CS), vm_1, "SourceStrengthUnits", "Source Strength Units", false},
+    tag_info{dicom_tag{0x300A, 0x022A}, vr(VR::DS), vm_1, "ReferenceAirKermaRate", "Reference Air Kerma Rate", false},
+    tag_info{dicom_tag{0x300A, 0x022B}, vr(VR::DS), vm_1, "SourceStrength", "Source Strength", false},
+    tag_info{dicom_tag{0x300A, 0x022C}, vr(VR::DA), vm_1, "SourceStrengthReferenceDate", "Source Strength Reference Date", false},
+    tag_info{dicom_tag{0x300A, 0x022E}, vr(VR::TM), vm_1, "SourceStrengthReferenceTime", "Source Strength Reference Time", false},
+    tag_info{dicom_tag{0x300A, 0x0230}, vr(VR::SQ), vm_1, "ApplicationSetupSequence", "Application Setup Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0232}, vr(VR::CS), vm_1, "ApplicationSetupType", "Application Setup Type", false},
+    tag_info{dicom_tag{0x300A, 0x0234}, vr(VR::IS), vm_1, "ApplicationSetupNumber", "Application Setup Number", false},
+    tag_info{dicom_tag{0x300A, 0x0236}, vr(VR::LO), vm_1, "ApplicationSetupName", "Application Setup Name", false},
+    tag_info{dicom_tag{0x300A, 0x0238}, vr(VR::LO), vm_1, "ApplicationSetupManufacturer", "Application Setup Manufacturer", false},
+    tag_info{dicom_tag{0x300A, 0x0240}, vr(VR::IS), vm_1, "TemplateNumber", "Template Number", false},
+    tag_info{dicom_tag{0x300A, 0x0242}, vr(VR::SH), vm_1, "TemplateType", "Template Type", false},
+    tag_info{dicom_tag{0x300A, 0x0244}, vr(VR::LO), vm_1, "TemplateName", "Template Name", false},
+    tag_info{dicom_tag{0x300A, 0x0250}, vr(VR::DS), vm_1, "TotalReferenceAirKerma", "Total Reference Air Kerma", false},
+    tag_info{dicom_tag{0x300A, 0x0260}, vr(VR::SQ), vm_1, "BrachyAccessoryDeviceSequence", "Brachy Accessory Device Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0262}, vr(VR::IS), vm_1, "BrachyAccessoryDeviceNumber", "Brachy Accessory Device Number", false},
+    tag_info{dicom_tag{0x300A, 0x0263}, vr(VR::SH), vm_1, "BrachyAccessoryDeviceID", "Brachy Accessory Device ID", false},
+    tag_info{dicom_tag{0x300A, 0x0264}, vr(VR::CS), vm_1, "BrachyAccessoryDeviceType", "Brachy Accessory Device Type", false},
+    tag_info{dicom_tag{0x300A, 0x0266}, vr(VR::LO), vm_1, "BrachyAccessoryDeviceName", "Brachy Accessory Device Name", false},
+    tag_info{dicom_tag{0x300A, 0x026A}, vr(VR::DS), vm_1, "BrachyAccessoryDeviceNominalThickness", "Brachy Accessory Device Nominal Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x026C}, vr(VR::DS), vm_1, "BrachyAccessoryDeviceNominalTransmission", "Brachy Accessory Device Nominal Transmission", false},
+    tag_info{dicom_tag{0x300A, 0x0271}, vr(VR::DS), vm_1, "ChannelEffectiveLength", "Channel Effective Length", false},
+    tag_info{dicom_tag{0x300A, 0x0272}, vr(VR::DS), vm_1, "ChannelInnerLength", "Channel Inner Length", false},
+    tag_info{dicom_tag{0x300A, 0x0273}, vr(VR::SH), vm_1, "AfterloaderChannelID", "Afterloader Channel ID", false},
+    tag_info{dicom_tag{0x300A, 0x0274}, vr(VR::DS), vm_1, "SourceApplicatorTipLength", "Source Applicator Tip Length", false},
+    tag_info{dicom_tag{0x300A, 0x0280}, vr(VR::SQ), vm_1, "ChannelSequence", "Channel Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0282}, vr(VR::IS), vm_1, "ChannelNumber", "Channel Number", false},
+    tag_info{dicom_tag{0x300A, 0x0284}, vr(VR::DS), vm_1, "ChannelLength", "Channel Length", false},
+    tag_info{dicom_tag{0x300A, 0x0286}, vr(VR::DS), vm_1, "ChannelTotalTime", "Channel Total Time", false},
+    tag_info{dicom_tag{0x300A, 0x0288}, vr(VR::CS), vm_1, "SourceMovementType", "Source Movement Type", false},
+    tag_info{dicom_tag{0x300A, 0x028A}, vr(VR::IS), vm_1, "NumberOfPulses", "Number of Pulses", false},
+    tag_info{dicom_tag{0x300A, 0x028C}, vr(VR::DS), vm_1, "PulseRepetitionInterval", "Pulse Repetition Interval", false},
+    tag_info{dicom_tag{0x300A, 0x0290}, vr(VR::IS), vm_1, "SourceApplicatorNumber", "Source Applicator Number", false},
+    tag_info{dicom_tag{0x300A, 0x0291}, vr(VR::SH), vm_1, "SourceApplicatorID", "Source Applicator ID", false},
+    tag_info{dicom_tag{0x300A, 0x0292}, vr(VR::CS), vm_1, "SourceApplicatorType", "Source Applicator Type", false},
+    tag_info{dicom_tag{0x300A, 0x0294}, vr(VR::LO), vm_1, "SourceApplicatorName", "Source Applicator Name", false},
+    tag_info{dicom_tag{0x300A, 0x0296}, vr(VR::DS), vm_1, "SourceApplicatorLength", "Source Applicator Length", false},
+    tag_info{dicom_tag{0x300A, 0x0298}, vr(VR::LO), vm_1, "SourceApplicatorManufacturer", "Source Applicator Manufacturer", false},
+    tag_info{dicom_tag{0x300A, 0x029C}, vr(VR::DS), vm_1, "SourceApplicatorWallNominalThickness", "Source Applicator Wall Nominal Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x029E}, vr(VR::DS), vm_1, "SourceApplicatorWallNominalTransmission", "Source Applicator Wall Nominal Transmission", false},
+    tag_info{dicom_tag{0x300A, 0x02A0}, vr(VR::DS), vm_1, "SourceApplicatorStepSize", "Source Applicator Step Size", false},
+    tag_info{dicom_tag{0x300A, 0x02A1}, vr(VR::IS), vm_1, "ApplicatorShapeReferencedROINumber", "Applicator Shape Referenced ROI Number", false},
+    tag_info{dicom_tag{0x300A, 0x02A2}, vr(VR::IS), vm_1, "TransferTubeNumber", "Transfer Tube Number", false},
+    tag_info{dicom_tag{0x300A, 0x02A4}, vr(VR::DS), vm_1, "TransferTubeLength", "Transfer Tube Length", false},
+    tag_info{dicom_tag{0x300A, 0x02B0}, vr(VR::SQ), vm_1, "ChannelShieldSequence", "Channel Shield Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x02B2}, vr(VR::IS), vm_1, "ChannelShieldNumber", "Channel Shield Number", false},
+    tag_info{dicom_tag{0x300A, 0x02B3}, vr(VR::SH), vm_1, "ChannelShieldID", "Channel Shield ID", false},
+    tag_info{dicom_tag{0x300A, 0x02B4}, vr(VR::LO), vm_1, "ChannelShieldName", "Channel Shield Name", false},
+    tag_info{dicom_tag{0x300A, 0x02B8}, vr(VR::DS), vm_1, "ChannelShieldNominalThickness", "Channel Shield Nominal Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x02BA}, vr(VR::DS), vm_1, "ChannelShieldNominalTransmission", "Channel Shield Nominal Transmission", false},
+    tag_info{dicom_tag{0x300A, 0x02C8}, vr(VR::DS), vm_1, "FinalCumulativeTimeWeight", "Final Cumulative Time Weight", false},
+    tag_info{dicom_tag{0x300A, 0x02D0}, vr(VR::SQ), vm_1, "BrachyControlPointSequence", "Brachy Control Point Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x02D2}, vr(VR::DS), vm_1, "ControlPointRelativePosition", "Control Point Relative Position", false},
+    tag_info{dicom_tag{0x300A, 0x02D4}, vr(VR::DS), vm_3, "ControlPoint3DPosition", "Control Point 3D Position", false},
+    tag_info{dicom_tag{0x300A, 0x02D6}, vr(VR::DS), vm_1, "CumulativeTimeWeight", "Cumulative Time Weight", false},
+    tag_info{dicom_tag{0x300A, 0x02E0}, vr(VR::CS), vm_1, "CompensatorDivergence", "Compensator Divergence", false},
+    tag_info{dicom_tag{0x300A, 0x02E1}, vr(VR::CS), vm_1, "CompensatorMountingPosition", "Compensator Mounting Position", false},
+    tag_info{dicom_tag{0x300A, 0x02E2}, vr(VR::DS), vm_1_n, "SourceToCompensatorDistance", "Source to Compensator Distance", false},
+    tag_info{dicom_tag{0x300A, 0x02E3}, vr(VR::FL), vm_1, "TotalCompensatorTrayWaterEquivalentThickness", "Total Compensator Tray Water-Equivalent Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x02E4}, vr(VR::FL), vm_1, "IsocenterToCompensatorTrayDistance", "Isocenter to Compensator Tray Distance", false},
+    tag_info{dicom_tag{0x300A, 0x02E5}, vr(VR::FL), vm_1, "CompensatorColumnOffset", "Compensator Column Offset", false},
+    tag_info{dicom_tag{0x300A, 0x02E6}, vr(VR::FL), vm_1_n, "IsocenterToCompensatorDistances", "Isocenter to Compensator Distances", false},
+    tag_info{dicom_tag{0x300A, 0x02E7}, vr(VR::FL), vm_1, "CompensatorRelativeStoppingPowerRatio", "Compensator Relative Stopping Power Ratio", false},
+    tag_info{dicom_tag{0x300A, 0x02E8}, vr(VR::FL), vm_1, "CompensatorMillingToolDiameter", "Compensator Milling Tool Diameter", false},
+    tag_info{dicom_tag{0x300A, 0x02EA}, vr(VR::SQ), vm_1, "IonRangeCompensatorSequence", "Ion Range Compensator Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x02EB}, vr(VR::LT), vm_1, "CompensatorDescription", "Compensator Description", false},
+    tag_info{dicom_tag{0x300A, 0x0302}, vr(VR::IS), vm_1, "RadiationMassNumber", "Radiation Mass Number", false},
+    tag_info{dicom_tag{0x300A, 0x0304}, vr(VR::IS), vm_1, "RadiationAtomicNumber", "Radiation Atomic Number", false},
+    tag_info{dicom_tag{0x300A, 0x0306}, vr(VR::SS), vm_1, "RadiationChargeState", "Radiation Charge State", false},
+    tag_info{dicom_tag{0x300A, 0x0308}, vr(VR::CS), vm_1, "ScanMode", "Scan Mode", false},
+    tag_info{dicom_tag{0x300A, 0x0309}, vr(VR::CS), vm_1, "ModulatedScanModeType", "Modulated Scan Mode Type", false},
+    tag_info{dicom_tag{0x300A, 0x030A}, vr(VR::FL), vm_2, "VirtualSourceAxisDistances", "Virtual Source-Axis Distances", false},
+    tag_info{dicom_tag{0x300A, 0x030C}, vr(VR::SQ), vm_1, "SnoutSequence", "Snout Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x030D}, vr(VR::FL), vm_1, "SnoutPosition", "Snout Position", false},
+    tag_info{dicom_tag{0x300A, 0x030F}, vr(VR::SH), vm_1, "SnoutID", "Snout ID", false},
+    tag_info{dicom_tag{0x300A, 0x0312}, vr(VR::IS), vm_1, "NumberOfRangeShifters", "Number of Range Shifters", false},
+    tag_info{dicom_tag{0x300A, 0x0314}, vr(VR::SQ), vm_1, "RangeShifterSequence", "Range Shifter Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0316}, vr(VR::IS), vm_1, "RangeShifterNumber", "Range Shifter Number", false},
+    tag_info{dicom_tag{0x300A, 0x0318}, vr(VR::SH), vm_1, "RangeShifterID", "Range Shifter ID", false},
+    tag_info{dicom_tag{0x300A, 0x0320}, vr(VR::CS), vm_1, "RangeShifterType", "Range Shifter Type", false},
+    tag_info{dicom_tag{0x300A, 0x0322}, vr(VR::LO), vm_1, "RangeShifterDescription", "Range Shifter Description", false},
+    tag_info{dicom_tag{0x300A, 0x0330}, vr(VR::IS), vm_1, "NumberOfLateralSpreadingDevices", "Number of Lateral Spreading Devices", false},
+    tag_info{dicom_tag{0x300A, 0x0332}, vr(VR::SQ), vm_1, "LateralSpreadingDeviceSequence", "Lateral Spreading Device Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0334}, vr(VR::IS), vm_1, "LateralSpreadingDeviceNumber", "Lateral Spreading Device Number", false},
+    tag_info{dicom_tag{0x300A, 0x0336}, vr(VR::SH), vm_1, "LateralSpreadingDeviceID", "Lateral Spreading Device ID", false},
+    tag_info{dicom_tag{0x300A, 0x0338}, vr(VR::CS), vm_1, "LateralSpreadingDeviceType", "Lateral Spreading Device Type", false},
+    tag_info{dicom_tag{0x300A, 0x033A}, vr(VR::LO), vm_1, "LateralSpreadingDeviceDescription", "Lateral Spreading Device Description", false},
+    tag_info{dicom_tag{0x300A, 0x033C}, vr(VR::FL), vm_1, "LateralSpreadingDeviceWaterEquivalentThickness", "Lateral Spreading Device Water Equivalent Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x0340}, vr(VR::IS), vm_1, "NumberOfRangeModulators", "Number of Range Modulators", false},
+    tag_info{dicom_tag{0x300A, 0x0342}, vr(VR::SQ), vm_1, "RangeModulatorSequence", "Range Modulator Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0344}, vr(VR::IS), vm_1, "RangeModulatorNumber", "Range Modulator Number", false},
+    tag_info{dicom_tag{0x300A, 0x0346}, vr(VR::SH), vm_1, "RangeModulatorID", "Range Modulator ID", false},
+    tag_info{dicom_tag{0x300A, 0x0348}, vr(VR::CS), vm_1, "RangeModulatorType", "Range Modulator Type", false},
+    tag_info{dicom_tag{0x300A, 0x034A}, vr(VR::LO), vm_1, "RangeModulatorDescription", "Range Modulator Description", false},
+    tag_info{dicom_tag{0x300A, 0x034C}, vr(VR::SH), vm_1, "BeamCurrentModulationID", "Beam Current Modulation ID", false},
+    tag_info{dicom_tag{0x300A, 0x0350}, vr(VR::CS), vm_1, "PatientSupportType", "Patient Support Type", false},
+    tag_info{dicom_tag{0x300A, 0x0352}, vr(VR::SH), vm_1, "PatientSupportID", "Patient Support ID", false},
+    tag_info{dicom_tag{0x300A, 0x0354}, vr(VR::LO), vm_1, "PatientSupportAccessoryCode", "Patient Support Accessory Code", false},
+    tag_info{dicom_tag{0x300A, 0x0355}, vr(VR::LO), vm_1, "TrayAccessoryCode", "Tray Accessory Code", false},
+    tag_info{dicom_tag{0x300A, 0x0356}, vr(VR::FL), vm_1, "FixationLightAzimuthalAngle", "Fixation Light Azimuthal Angle", false},
+    tag_info{dicom_tag{0x300A, 0x0358}, vr(VR::FL), vm_1, "FixationLightPolarAngle", "Fixation Light Polar Angle", false},
+    tag_info{dicom_tag{0x300A, 0x035A}, vr(VR::FL), vm_1, "MetersetRate", "Meterset Rate", false},
+    tag_info{dicom_tag{0x300A, 0x0360}, vr(VR::SQ), vm_1, "RangeShifterSettingsSequence", "Range Shifter Settings Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0362}, vr(VR::LO), vm_1, "RangeShifterSetting", "Range Shifter Setting", false},
+    tag_info{dicom_tag{0x300A, 0x0364}, vr(VR::FL), vm_1, "IsocenterToRangeShifterDistance", "Isocenter to Range Shifter Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0366}, vr(VR::FL), vm_1, "RangeShifterWaterEquivalentThickness", "Range Shifter Water Equivalent Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x0370}, vr(VR::SQ), vm_1, "LateralSpreadingDeviceSettingsSequence", "Lateral Spreading Device Settings Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0372}, vr(VR::LO), vm_1, "LateralSpreadingDeviceSetting", "Lateral Spreading Device Setting", false},
+    tag_info{dicom_tag{0x300A, 0x0374}, vr(VR::FL), vm_1, "IsocenterToLateralSpreadingDeviceDistance", "Isocenter to Lateral Spreading Device Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0380}, vr(VR::SQ), vm_1, "RangeModulatorSettingsSequence", "Range Modulator Settings Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0382}, vr(VR::FL), vm_1, "RangeModulatorGatingStartValue", "Range Modulator Gating Start Value", false},
+    tag_info{dicom_tag{0x300A, 0x0384}, vr(VR::FL), vm_1, "RangeModulatorGatingStopValue", "Range Modulator Gating Stop Value", false},
+    tag_info{dicom_tag{0x300A, 0x0386}, vr(VR::FL), vm_1, "RangeModulatorGatingStartWaterEquivalentThickness", "Range Modulator Gating Start Water Equivalent Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x0388}, vr(VR::FL), vm_1, "RangeModulatorGatingStopWaterEquivalentThickness", "Range Modulator Gating Stop Water Equivalent Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x038A}, vr(VR::FL), vm_1, "IsocenterToRangeModulatorDistance", "Isocenter to Range Modulator Distance", false},
+    tag_info{dicom_tag{0x300A, 0x038F}, vr(VR::FL), vm_1_n, "ScanSpotTimeOffset", "Scan Spot Time Offset", false},
+    tag_info{dicom_tag{0x300A, 0x0390}, vr(VR::SH), vm_1, "ScanSpotTuneID", "Scan Spot Tune ID", false},
+    tag_info{dicom_tag{0x300A, 0x0391}, vr(VR::IS), vm_1_n, "ScanSpotPrescribedIndices", "Scan Spot Prescribed Indices", false},
+    tag_info{dicom_tag{0x300A, 0x0392}, vr(VR::IS), vm_1, "NumberOfScanSpotPositions", "Number of Scan Spot Positions", false},
+    tag_info{dicom_tag{0x300A, 0x0393}, vr(VR::CS), vm_1, "ScanSpotReordered", "Scan Spot Reordered", false},
+    tag_info{dicom_tag{0x300A, 0x0394}, vr(VR::FL), vm_1_n, "ScanSpotPositionMap", "Scan Spot Position Map", false},
+    tag_info{dicom_tag{0x300A, 0x0395}, vr(VR::CS), vm_1, "ScanSpotReorderingAllowed", "Scan Spot Reordering Allowed", false},
+    tag_info{dicom_tag{0x300A, 0x0396}, vr(VR::FL), vm_1_n, "ScanSpotMetersetWeights", "Scan Spot Meterset Weights", false},
+    tag_info{dicom_tag{0x300A, 0x0398}, vr(VR::FL), vm_2, "ScanningSpotSize", "Scanning Spot Size", false},
+    tag_info{dicom_tag{0x300A, 0x0399}, vr(VR::FL), vm_2_2n, "ScanSpotSizesDelivered", "Scan Spot Sizes Delivered", false},
+    tag_info{dicom_tag{0x300A, 0x039A}, vr(VR::IS), vm_1, "NumberOfPaintings", "Number of Paintings", false},
+    tag_info{dicom_tag{0x300A, 0x03A0}, vr(VR::SQ), vm_1, "IonToleranceTableSequence", "Ion Tolerance Table Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x03A2}, vr(VR::SQ), vm_1, "IonBeamSequence", "Ion Beam Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x03A4}, vr(VR::SQ), vm_1, "IonBeamLimitingDeviceSequence", "Ion Beam Limiting Device Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x03A6}, vr(VR::SQ), vm_1, "IonBlockSequence", "Ion Block Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x03A8}, vr(VR::SQ), vm_1, "IonControlPointSequence", "Ion Control Point Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x03AA}, vr(VR::SQ), vm_1, "IonWedgeSequence", "Ion Wedge Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x03AC}, vr(VR::SQ), vm_1, "IonWedgePositionSequence", "Ion Wedge Position Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0401}, vr(VR::SQ), vm_1, "ReferencedSetupImageSequence", "Referenced Setup Image Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0402}, vr(VR::ST), vm_1, "SetupImageComment", "Setup Image Comment", false},
+    tag_info{dicom_tag{0x300A, 0x0410}, vr(VR::SQ), vm_1, "MotionSynchronizationSequence", "Motion Synchronization Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0412}, vr(VR::FL), vm_3, "ControlPointOrientation", "Control Point Orientation", false},
+    tag_info{dicom_tag{0x300A, 0x0420}, vr(VR::SQ), vm_1, "GeneralAccessorySequence", "General Accessory Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0421}, vr(VR::SH), vm_1, "GeneralAccessoryID", "General Accessory ID", false},
+    tag_info{dicom_tag{0x300A, 0x0422}, vr(VR::ST), vm_1, "GeneralAccessoryDescription", "General Accessory Description", false},
+    tag_info{dicom_tag{0x300A, 0x0423}, vr(VR::CS), vm_1, "GeneralAccessoryType", "General Accessory Type", false},
+    tag_info{dicom_tag{0x300A, 0x0424}, vr(VR::IS), vm_1, "GeneralAccessoryNumber", "General Accessory Number", false},
+    tag_info{dicom_tag{0x300A, 0x0425}, vr(VR::FL), vm_1, "SourceToGeneralAccessoryDistance", "Source to General Accessory Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0426}, vr(VR::DS), vm_1, "IsocenterToGeneralAccessoryDistance", "Isocenter to General Accessory Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0431}, vr(VR::SQ), vm_1, "ApplicatorGeometrySequence", "Applicator Geometry Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0432}, vr(VR::CS), vm_1, "ApplicatorApertureShape", "Applicator Aperture Shape", false},
+    tag_info{dicom_tag{0x300A, 0x0433}, vr(VR::FL), vm_1, "ApplicatorOpening", "Applicator Opening", false},
+    tag_info{dicom_tag{0x300A, 0x0434}, vr(VR::FL), vm_1, "ApplicatorOpeningX", "Applicator Opening X", false},
+    tag_info{dicom_tag{0x300A, 0x0435}, vr(VR::FL), vm_1, "ApplicatorOpeningY", "Applicator Opening Y", false},
+    tag_info{dicom_tag{0x300A, 0x0436}, vr(VR::FL), vm_1, "SourceToApplicatorMountingPositionDistance", "Source to Applicator Mounting Position Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0440}, vr(VR::IS), vm_1, "NumberOfBlockSlabItems", "Number of Block Slab Items", false},
+    tag_info{dicom_tag{0x300A, 0x0441}, vr(VR::SQ), vm_1, "BlockSlabSequence", "Block Slab Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0442}, vr(VR::DS), vm_1, "BlockSlabThickness", "Block Slab Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x0443}, vr(VR::US), vm_1, "BlockSlabNumber", "Block Slab Number", false},
+    tag_info{dicom_tag{0x300A, 0x0450}, vr(VR::SQ), vm_1, "DeviceMotionControlSequence", "Device Motion Control Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0451}, vr(VR::CS), vm_1, "DeviceMotionExecutionMode", "Device Motion Execution Mode", false},
+    tag_info{dicom_tag{0x300A, 0x0452}, vr(VR::CS), vm_1, "DeviceMotionObservationMode", "Device Motion Observation Mode", false},
+    tag_info{dicom_tag{0x300A, 0x0453}, vr(VR::SQ), vm_1, "DeviceMotionParameterCodeSequence", "Device Motion Parameter Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0501}, vr(VR::FL), vm_1, "DistalDepthFraction", "Distal Depth Fraction", false},
+    tag_info{dicom_tag{0x300A, 0x0502}, vr(VR::FL), vm_1, "DistalDepth", "Distal Depth", false},
+    tag_info{dicom_tag{0x300A, 0x0503}, vr(VR::FL), vm_2, "NominalRangeModulationFractions", "Nominal Range Modulation Fractions", false},
+    tag_info{dicom_tag{0x300A, 0x0504}, vr(VR::FL), vm_2, "NominalRangeModulatedRegionDepths", "Nominal Range Modulated Region Depths", false},
+    tag_info{dicom_tag{0x300A, 0x0505}, vr(VR::SQ), vm_1, "DepthDoseParametersSequence", "Depth Dose Parameters Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0506}, vr(VR::SQ), vm_1, "DeliveredDepthDoseParametersSequence", "Delivered Depth Dose Parameters Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0507}, vr(VR::FL), vm_1, "DeliveredDistalDepthFraction", "Delivered Distal Depth Fraction", false},
+    tag_info{dicom_tag{0x300A, 0x0508}, vr(VR::FL), vm_1, "DeliveredDistalDepth", "Delivered Distal Depth", false},
+    tag_info{dicom_tag{0x300A, 0x0509}, vr(VR::FL), vm_2, "DeliveredNominalRangeModulationFractions", "Delivered Nominal Range Modulation Fractions", false},
+    tag_info{dicom_tag{0x300A, 0x0510}, vr(VR::FL), vm_2, "DeliveredNominalRangeModulatedRegionDepths", "Delivered Nominal Range Modulated Region Depths", false},
+    tag_info{dicom_tag{0x300A, 0x0511}, vr(VR::CS), vm_1, "DeliveredReferenceDoseDefinition", "Delivered Reference Dose Definition", false},
+    tag_info{dicom_tag{0x300A, 0x0512}, vr(VR::CS), vm_1, "ReferenceDoseDefinition", "Reference Dose Definition", false},
+    tag_info{dicom_tag{0x300A, 0x0600}, vr(VR::US), vm_1, "RTControlPointIndex", "RT Control Point Index", false},
+    tag_info{dicom_tag{0x300A, 0x0601}, vr(VR::US), vm_1, "RadiationGenerationModeIndex", "Radiation Generation Mode Index", false},
+    tag_info{dicom_tag{0x300A, 0x0602}, vr(VR::US), vm_1, "ReferencedDefinedDeviceIndex", "Referenced Defined Device Index", false},
+    tag_info{dicom_tag{0x300A, 0x0603}, vr(VR::US), vm_1, "RadiationDoseIdentificationIndex", "Radiation Dose Identification Index", false},
+    tag_info{dicom_tag{0x300A, 0x0604}, vr(VR::US), vm_1, "NumberOfRTControlPoints", "Number of RT Control Points", false},
+    tag_info{dicom_tag{0x300A, 0x0605}, vr(VR::US), vm_1, "ReferencedRadiationGenerationModeIndex", "Referenced Radiation Generation Mode Index", false},
+    tag_info{dicom_tag{0x300A, 0x0606}, vr(VR::US), vm_1, "TreatmentPositionIndex", "Treatment Position Index", false},
+    tag_info{dicom_tag{0x300A, 0x0607}, vr(VR::US), vm_1, "ReferencedDeviceIndex", "Referenced Device Index", false},
+    tag_info{dicom_tag{0x300A, 0x0608}, vr(VR::LO), vm_1, "TreatmentPositionGroupLabel", "Treatment Position Group Label", false},
+    tag_info{dicom_tag{0x300A, 0x0609}, vr(VR::UI), vm_1, "TreatmentPositionGroupUID", "Treatment Position Group UID", false},
+    tag_info{dicom_tag{0x300A, 0x060A}, vr(VR::SQ), vm_1, "TreatmentPositionGroupSequence", "Treatment Position Group Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x060B}, vr(VR::US), vm_1, "ReferencedTreatmentPositionIndex", "Referenced Treatment Position Index", false},
+    tag_info{dicom_tag{0x300A, 0x060C}, vr(VR::US), vm_1, "ReferencedRadiationDoseIdentificationIndex", "Referenced Radiation Dose Identification Index", false},
+    tag_info{dicom_tag{0x300A, 0x060D}, vr(VR::FD), vm_1, "RTAccessoryHolderWaterEquivalentThickness", "RT Accessory Holder Water-Equivalent Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x060E}, vr(VR::US), vm_1, "ReferencedRTAccessoryHolderDeviceIndex", "Referenced RT Accessory Holder Device Index", false},
+    tag_info{dicom_tag{0x300A, 0x060F}, vr(VR::CS), vm_1, "RTAccessoryHolderSlotExistenceFlag", "RT Accessory Holder Slot Existence Flag", false},
+    tag_info{dicom_tag{0x300A, 0x0610}, vr(VR::SQ), vm_1, "RTAccessoryHolderSlotSequence", "RT Accessory Holder Slot Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0611}, vr(VR::LO), vm_1, "RTAccessoryHolderSlotID", "RT Accessory Holder Slot ID", false},
+    tag_info{dicom_tag{0x300A, 0x0612}, vr(VR::FD), vm_1, "RTAccessoryHolderSlotDistance", "RT Accessory Holder Slot Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0613}, vr(VR::FD), vm_1, "RTAccessorySlotDistance", "RT Accessory Slot Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0614}, vr(VR::SQ), vm_1, "RTAccessoryHolderDefinitionSequence", "RT Accessory Holder Definition Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0615}, vr(VR::LO), vm_1, "RTAccessoryDeviceSlotID", "RT Accessory Device Slot ID", false},
+    tag_info{dicom_tag{0x300A, 0x0616}, vr(VR::SQ), vm_1, "RTRadiationSequence", "RT Radiation Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0617}, vr(VR::SQ), vm_1, "RadiationDoseSequence", "Radiation Dose Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0618}, vr(VR::SQ), vm_1, "RadiationDoseIdentificationSequence", "Radiation Dose Identification Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0619}, vr(VR::LO), vm_1, "RadiationDoseIdentificationLabel", "Radiation Dose Identification Label", false},
+    tag_info{dicom_tag{0x300A, 0x061A}, vr(VR::CS), vm_1, "ReferenceDoseType", "Reference Dose Type", false},
+    tag_info{dicom_tag{0x300A, 0x061B}, vr(VR::CS), vm_1, "PrimaryDoseValueIndicator", "Primary Dose Value Indicator", false},
+    tag_info{dicom_tag{0x300A, 0x061C}, vr(VR::SQ), vm_1, "DoseValuesSequence", "Dose Values Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x061D}, vr(VR::CS), vm_1_n, "DoseValuePurpose", "Dose Value Purpose", false},
+    tag_info{dicom_tag{0x300A, 0x061E}, vr(VR::FD), vm_3, "ReferenceDosePointCoordinates", "Reference Dose Point Coordinates", false},
+    tag_info{dicom_tag{0x300A, 0x061F}, vr(VR::SQ), vm_1, "RadiationDoseValuesParametersSequence", "Radiation Dose Values Parameters Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0620}, vr(VR::SQ), vm_1, "MetersetToDoseMappingSequence", "Meterset to Dose Mapping Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0621}, vr(VR::SQ), vm_1, "ExpectedInVivoMeasurementValuesSequence", "Expected In-Vivo Measurement Values Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0622}, vr(VR::US), vm_1, "ExpectedInVivoMeasurementValueIndex", "Expected In-Vivo Measurement Value Index", false},
+    tag_info{dicom_tag{0x300A, 0x0623}, vr(VR::LO), vm_1, "RadiationDoseInVivoMeasurementLabel", "Radiation Dose In-Vivo Measurement Label", false},
+    tag_info{dicom_tag{0x300A, 0x0624}, vr(VR::FD), vm_2, "RadiationDoseCentralAxisDisplacement", "Radiation Dose Central Axis Displacement", false},
+    tag_info{dicom_tag{0x300A, 0x0625}, vr(VR::FD), vm_1, "RadiationDoseValue", "Radiation Dose Value", false},
+    tag_info{dicom_tag{0x300A, 0x0626}, vr(VR::FD), vm_1, "RadiationDoseSourceToSkinDistance", "Radiation Dose Source to Skin Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0627}, vr(VR::FD), vm_3, "RadiationDoseMeasurementPointCoordinates", "Radiation Dose Measurement Point Coordinates", false},
+    tag_info{dicom_tag{0x300A, 0x0628}, vr(VR::FD), vm_1, "RadiationDoseSourceToExternalContourDistance", "Radiation Dose Source to External Contour Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0629}, vr(VR::SQ), vm_1, "RTToleranceSetSequence", "RT Tolerance Set Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x062A}, vr(VR::LO), vm_1, "RTToleranceSetLabel", "RT Tolerance Set Label", false},
+    tag_info{dicom_tag{0x300A, 0x062B}, vr(VR::SQ), vm_1, "AttributeToleranceValuesSequence", "Attribute Tolerance Values Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x062C}, vr(VR::FD), vm_1, "ToleranceValue", "Tolerance Value", false},
+    tag_info{dicom_tag{0x300A, 0x062D}, vr(VR::SQ), vm_1, "PatientSupportPositionToleranceSequence", "Patient Support Position Tolerance Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x062E}, vr(VR::FD), vm_1, "TreatmentTimeLimit", "Treatment Time Limit", false},
+    tag_info{dicom_tag{0x300A, 0x062F}, vr(VR::SQ), vm_1, "CArmPhotonElectronControlPointSequence", "C-Arm Photon-Electron Control Point Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0630}, vr(VR::SQ), vm_1, "ReferencedRTRadiationSequence", "Referenced RT Radiation Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0631}, vr(VR::SQ), vm_1, "ReferencedRTInstanceSequence", "Referenced RT Instance Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0632}, vr(VR::SQ), vm_1, "ReferencedRTPatientSetupSequence", "Referenced RT Patient Setup Sequence", true},
+    tag_info{dicom_tag{0x300A, 0x0634}, vr(VR::FD), vm_1, "SourceToPatientSurfaceDistance", "Source to Patient Surface Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0635}, vr(VR::SQ), vm_1, "TreatmentMachineSpecialModeCodeSequence", "Treatment Machine Special Mode Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0636}, vr(VR::US), vm_1, "IntendedNumberOfFractions", "Intended Number of Fractions", false},
+    tag_info{dicom_tag{0x300A, 0x0637}, vr(VR::CS), vm_1, "RTRadiationSetIntent", "RT Radiation Set Intent", false},
+    tag_info{dicom_tag{0x300A, 0x0638}, vr(VR::CS), vm_1, "RTRadiationPhysicalAndGeometricContentDetailFlag", "RT Radiation Physical and Geometric Content Detail Flag", false},
+    tag_info{dicom_tag{0x300A, 0x0639}, vr(VR::CS), vm_1, "RTRecordFlag", "RT Record Flag", false},
+    tag_info{dicom_tag{0x300A, 0x063A}, vr(VR::SQ), vm_1, "TreatmentDeviceIdentificationSequence", "Treatment Device Identification Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x063B}, vr(VR::SQ), vm_1, "ReferencedRTPhysicianIntentSequence", "Referenced RT Physician Intent Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x063C}, vr(VR::FD), vm_1, "CumulativeMeterset", "Cumulative Meterset", false},
+    tag_info{dicom_tag{0x300A, 0x063D}, vr(VR::FD), vm_1, "DeliveryRate", "Delivery Rate", false},
+    tag_info{dicom_tag{0x300A, 0x063E}, vr(VR::SQ), vm_1, "DeliveryRateUnitSequence", "Delivery Rate Unit Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x063F}, vr(VR::SQ), vm_1, "TreatmentPositionSequence", "Treatment Position Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0640}, vr(VR::FD), vm_1, "RadiationSourceAxisDistance", "Radiation Source-Axis Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0641}, vr(VR::US), vm_1, "NumberOfRTBeamLimitingDevices", "Number of RT Beam Limiting Devices", false},
+    tag_info{dicom_tag{0x300A, 0x0642}, vr(VR::FD), vm_1, "RTBeamLimitingDeviceProximalDistance", "RT Beam Limiting Device Proximal Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0643}, vr(VR::FD), vm_1, "RTBeamLimitingDeviceDistalDistance", "RT Beam Limiting Device Distal Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0644}, vr(VR::SQ), vm_1, "ParallelRTBeamDelimiterDeviceOrientationLabelCodeSequence", "Parallel RT Beam Delimiter Device Orientation Label Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0645}, vr(VR::FD), vm_1, "BeamModifierOrientationAngle", "Beam Modifier Orientation Angle", false},
+    tag_info{dicom_tag{0x300A, 0x0646}, vr(VR::SQ), vm_1, "FixedRTBeamDelimiterDeviceSequence", "Fixed RT Beam Delimiter Device Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0647}, vr(VR::SQ), vm_1, "ParallelRTBeamDelimiterDeviceSequence", "Parallel RT Beam Delimiter Device Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0648}, vr(VR::US), vm_1, "NumberOfParallelRTBeamDelimiters", "Number of Parallel RT Beam Delimiters", false},
+    tag_info{dicom_tag{0x300A, 0x0649}, vr(VR::FD), vm_2_n, "ParallelRTBeamDelimiterBoundaries", "Parallel RT Beam Delimiter Boundaries", false},
+    tag_info{dicom_tag{0x300A, 0x064A}, vr(VR::FD), vm_2_n, "ParallelRTBeamDelimiterPositions", "Parallel RT Beam Delimiter Positions", false},
+    tag_info{dicom_tag{0x300A, 0x064B}, vr(VR::FD), vm_2, "RTBeamLimitingDeviceOffset", "RT Beam Limiting Device Offset", false},
+    tag_info{dicom_tag{0x300A, 0x064C}, vr(VR::SQ), vm_1, "RTBeamDelimiterGeometrySequence", "RT Beam Delimiter Geometry Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x064D}, vr(VR::SQ), vm_1, "RTBeamLimitingDeviceDefinitionSequence", "RT Beam Limiting Device Definition Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x064E}, vr(VR::CS), vm_1, "ParallelRTBeamDelimiterOpeningMode", "Parallel RT Beam Delimiter Opening Mode", false},
+    tag_info{dicom_tag{0x300A, 0x064F}, vr(VR::CS), vm_1_n, "ParallelRTBeamDelimiterLeafMountingSide", "Parallel RT Beam Delimiter Leaf Mounting Side", false},
+    tag_info{dicom_tag{0x300A, 0x0650}, vr(VR::UI), vm_1, "PatientSetupUID", "Patient Setup UID", true},
+    tag_info{dicom_tag{0x300A, 0x0651}, vr(VR::SQ), vm_1, "WedgeDefinitionSequence", "Wedge Definition Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0652}, vr(VR::FD), vm_1, "RadiationBeamWedgeAngle", "Radiation Beam Wedge Angle", false},
+    tag_info{dicom_tag{0x300A, 0x0653}, vr(VR::FD), vm_1, "RadiationBeamWedgeThinEdgeDistance", "Radiation Beam Wedge Thin Edge Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0654}, vr(VR::FD), vm_1, "RadiationBeamEffectiveWedgeAngle", "Radiation Beam Effective Wedge Angle", false},
+    tag_info{dicom_tag{0x300A, 0x0655}, vr(VR::US), vm_1, "NumberOfWedgePositions", "Number of Wedge Positions", false},
+    tag_info{dicom_tag{0x300A, 0x0656}, vr(VR::SQ), vm_1, "RTBeamLimitingDeviceOpeningSequence", "RT Beam Limiting Device Opening Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0657}, vr(VR::US), vm_1, "NumberOfRTBeamLimitingDeviceOpenings", "Number of RT Beam Limiting Device Openings", false},
+    tag_info{dicom_tag{0x300A, 0x0658}, vr(VR::SQ), vm_1, "RadiationDosimeterUnitSequence", "Radiation Dosimeter Unit Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0659}, vr(VR::SQ), vm_1, "RTDeviceDistanceReferenceLocationCodeSequence", "RT Device Distance Reference Location Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x065A}, vr(VR::SQ), vm_1, "RadiationDeviceConfigurationAndCommissioningKeySequence", "Radiation Device Configuration and Commissioning Key Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x065B}, vr(VR::SQ), vm_1, "PatientSupportPositionParameterSequence", "Patient Support Position Parameter Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x065C}, vr(VR::CS), vm_1, "PatientSupportPositionSpecificationMethod", "Patient Support Position Specification Method", false},
+    tag_info{dicom_tag{0x300A, 0x065D}, vr(VR::SQ), vm_1, "PatientSupportPositionDeviceParameterSequence", "Patient Support Position Device Parameter Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x065E}, vr(VR::US), vm_1, "DeviceOrderIndex", "Device Order Index", false},
+    tag_info{dicom_tag{0x300A, 0x065F}, vr(VR::US), vm_1, "PatientSupportPositionParameterOrderIndex", "Patient Support Position Parameter Order Index", false},
+    tag_info{dicom_tag{0x300A, 0x0660}, vr(VR::SQ), vm_1, "PatientSupportPositionDeviceToleranceSequence", "Patient Support Position Device Tolerance Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0661}, vr(VR::US), vm_1, "PatientSupportPositionToleranceOrderIndex", "Patient Support Position Tolerance Order Index", false},
+    tag_info{dicom_tag{0x300A, 0x0662}, vr(VR::SQ), vm_1, "CompensatorDefinitionSequence", "Compensator Definition Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0663}, vr(VR::CS), vm_1, "CompensatorMapOrientation", "Compensator Map Orientation", false},
+    tag_info{dicom_tag{0x300A, 0x0664}, vr(VR::OF), vm_1, "CompensatorProximalThicknessMap", "Compensator Proximal Thickness Map", false},
+    tag_info{dicom_tag{0x300A, 0x0665}, vr(VR::OF), vm_1, "CompensatorDistalThicknessMap", "Compensator Distal Thickness Map", false},
+    tag_info{dicom_tag{0x300A, 0x0666}, vr(VR::FD), vm_1, "CompensatorBasePlaneOffset", "Compensator Base Plane Offset", false},
+    tag_info{dicom_tag{0x300A, 0x0667}, vr(VR::SQ), vm_1, "CompensatorShapeFabricationCodeSequence", "Compensator Shape Fabrication Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0668}, vr(VR::SQ), vm_1, "CompensatorShapeSequence", "Compensator Shape Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0669}, vr(VR::FD), vm_1, "RadiationBeamCompensatorMillingToolDiameter", "Radiation Beam Compensator Milling Tool Diameter", false},
+    tag_info{dicom_tag{0x300A, 0x066A}, vr(VR::SQ), vm_1, "BlockDefinitionSequence", "Block Definition Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x066B}, vr(VR::OF), vm_1, "BlockEdgeData", "Block Edge Data", false},
+    tag_info{dicom_tag{0x300A, 0x066C}, vr(VR::CS), vm_1, "BlockOrientation", "Block Orientation", false},
+    tag_info{dicom_tag{0x300A, 0x066D}, vr(VR::FD), vm_1, "RadiationBeamBlockThickness", "Radiation Beam Block Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x066E}, vr(VR::FD), vm_1, "RadiationBeamBlockSlabThickness", "Radiation Beam Block Slab Thickness", false},
+    tag_info{dicom_tag{0x300A, 0x066F}, vr(VR::SQ), vm_1, "BlockEdgeDataSequence", "Block Edge Data Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0670}, vr(VR::US), vm_1, "NumberOfRTAccessoryHolders", "Number of RT Accessory Holders", false},
+    tag_info{dicom_tag{0x300A, 0x0671}, vr(VR::SQ), vm_1, "GeneralAccessoryDefinitionSequence", "General Accessory Definition Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0672}, vr(VR::US), vm_1, "NumberOfGeneralAccessories", "Number of General Accessories", false},
+    tag_info{dicom_tag{0x300A, 0x0673}, vr(VR::SQ), vm_1, "BolusDefinitionSequence", "Bolus Definition Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0674}, vr(VR::US), vm_1, "NumberOfBoluses", "Number of Boluses", false},
+    tag_info{dicom_tag{0x300A, 0x0675}, vr(VR::UI), vm_1, "EquipmentFrameOfReferenceUID", "Equipment Frame of Reference UID", false},
+    tag_info{dicom_tag{0x300A, 0x0676}, vr(VR::ST), vm_1, "EquipmentFrameOfReferenceDescription", "Equipment Frame of Reference Description", false},
+    tag_info{dicom_tag{0x300A, 0x0677}, vr(VR::SQ), vm_1, "EquipmentReferencePointCoordinatesSequence", "Equipment Reference Point Coordinates Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0678}, vr(VR::SQ), vm_1, "EquipmentReferencePointCodeSequence", "Equipment Reference Point Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0679}, vr(VR::FD), vm_1, "RTBeamLimitingDeviceAngle", "RT Beam Limiting Device Angle", false},
+    tag_info{dicom_tag{0x300A, 0x067A}, vr(VR::FD), vm_1, "SourceRollAngle", "Source Roll Angle", false},
+    tag_info{dicom_tag{0x300A, 0x067B}, vr(VR::SQ), vm_1, "RadiationGenerationModeSequence", "Radiation GenerationMode Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x067C}, vr(VR::SH), vm_1, "RadiationGenerationModeLabel", "Radiation GenerationMode Label", false},
+    tag_info{dicom_tag{0x300A, 0x067D}, vr(VR::ST), vm_1, "RadiationGenerationModeDescription", "Radiation GenerationMode Description", false},
+    tag_info{dicom_tag{0x300A, 0x067E}, vr(VR::SQ), vm_1, "RadiationGenerationModeMachineCodeSequence", "Radiation GenerationMode Machine Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x067F}, vr(VR::SQ), vm_1, "RadiationTypeCodeSequence", "Radiation Type Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0680}, vr(VR::DS), vm_1, "NominalEnergy", "Nominal Energy", false},
+    tag_info{dicom_tag{0x300A, 0x0681}, vr(VR::DS), vm_1, "MinimumNominalEnergy", "Minimum Nominal Energy", false},
+    tag_info{dicom_tag{0x300A, 0x0682}, vr(VR::DS), vm_1, "MaximumNominalEnergy", "Maximum Nominal Energy", false},
+    tag_info{dicom_tag{0x300A, 0x0683}, vr(VR::SQ), vm_1, "RadiationFluenceModifierCodeSequence", "Radiation Fluence Modifier Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0684}, vr(VR::SQ), vm_1, "EnergyUnitCodeSequence", "Energy Unit Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0685}, vr(VR::US), vm_1, "NumberOfRadiationGenerationModes", "Number of Radiation GenerationModes", false},
+    tag_info{dicom_tag{0x300A, 0x0686}, vr(VR::SQ), vm_1, "PatientSupportDevicesSequence", "Patient Support Devices Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0687}, vr(VR::US), vm_1, "NumberOfPatientSupportDevices", "Number of Patient Support Devices", false},
+    tag_info{dicom_tag{0x300A, 0x0688}, vr(VR::FD), vm_1, "RTBeamModifierDefinitionDistance", "RT Beam Modifier Definition Distance", false},
+    tag_info{dicom_tag{0x300A, 0x0689}, vr(VR::SQ), vm_1, "BeamAreaLimitSequence", "Beam Area Limit Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x068A}, vr(VR::SQ), vm_1, "ReferencedRTPrescriptionSequence", "Referenced RT Prescription Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x068B}, vr(VR::CS), vm_1, "DoseValueInterpretation", "Dose Value Interpretation", false},
+    tag_info{dicom_tag{0x300A, 0x0700}, vr(VR::UI), vm_1, "TreatmentSessionUID", "Treatment Session UID", false},
+    tag_info{dicom_tag{0x300A, 0x0701}, vr(VR::CS), vm_1, "RTRadiationUsage", "RT Radiation Usage", false},
+    tag_info{dicom_tag{0x300A, 0x0702}, vr(VR::SQ), vm_1, "ReferencedRTRadiationSetSequence", "Referenced RT Radiation Set Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0703}, vr(VR::SQ), vm_1, "ReferencedRTRadiationRecordSequence", "Referenced RT Radiation Record Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0704}, vr(VR::US), vm_1, "RTRadiationSetDeliveryNumber", "RT Radiation Set Delivery Number", false},
+    tag_info{dicom_tag{0x300A, 0x0705}, vr(VR::US), vm_1, "ClinicalFractionNumber", "Clinical Fraction Number", false},
+    tag_info{dicom_tag{0x300A, 0x0706}, vr(VR::CS), vm_1, "RTTreatmentFractionCompletionStatus", "RT Treatment Fraction Completion Status", false},
+    tag_info{dicom_tag{0x300A, 0x0707}, vr(VR::CS), vm_1, "RTRadiationSetUsage", "RT Radiation Set Usage", false},
+    tag_info{dicom_tag{0x300A, 0x0708}, vr(VR::CS), vm_1, "TreatmentDeliveryContinuationFlag", "Treatment Delivery Continuation Flag", false},
+    tag_info{dicom_tag{0x300A, 0x0709}, vr(VR::CS), vm_1, "TreatmentRecordContentOrigin", "Treatment Record Content Origin", false},
+    tag_info{dicom_tag{0x300A, 0x0714}, vr(VR::CS), vm_1, "RTTreatmentTerminationStatus", "RT Treatment Termination Status", false},
+    tag_info{dicom_tag{0x300A, 0x0715}, vr(VR::SQ), vm_1, "RTTreatmentTerminationReasonCodeSequence", "RT Treatment Termination Reason Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0716}, vr(VR::SQ), vm_1, "MachineSpecificTreatmentTerminationCodeSequence", "Machine-Specific Treatment Termination Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0722}, vr(VR::SQ), vm_1, "RTRadiationSalvageRecordControlPointSequence", "RT Radiation Salvage Record Control Point Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0723}, vr(VR::CS), vm_1, "StartingMetersetValueKnownFlag", "Starting Meterset Value Known Flag", false},
+    tag_info{dicom_tag{0x300A, 0x0730}, vr(VR::ST), vm_1, "TreatmentTerminationDescription", "Treatment Termination Description", false},
+    tag_info{dicom_tag{0x300A, 0x0731}, vr(VR::SQ), vm_1, "TreatmentToleranceViolationSequence", "Treatment Tolerance Violation Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0732}, vr(VR::CS), vm_1, "TreatmentToleranceViolationCategory", "Treatment Tolerance Violation Category", false},
+    tag_info{dicom_tag{0x300A, 0x0733}, vr(VR::SQ), vm_1, "TreatmentToleranceViolationAttributeSequence", "Treatment Tolerance Violation Attribute Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0734}, vr(VR::ST), vm_1, "TreatmentToleranceViolationDescription", "Treatment Tolerance Violation Description", false},
+    tag_info{dicom_tag{0x300A, 0x0735}, vr(VR::ST), vm_1, "TreatmentToleranceViolationIdentification", "Treatment Tolerance Violation Identification", false},
+    tag_info{dicom_tag{0x300A, 0x0736}, vr(VR::DT), vm_1, "TreatmentToleranceViolationDateTime", "Treatment Tolerance Violation DateTime", false},
+    tag_info{dicom_tag{0x300A, 0x073A}, vr(VR::DT), vm_1, "RecordedRTControlPointDateTime", "Recorded RT Control Point DateTime", false},
+    tag_info{dicom_tag{0x300A, 0x073B}, vr(VR::US), vm_1, "ReferencedRadiationRTControlPointIndex", "Referenced Radiation RT Control Point Index", false},
+    tag_info{dicom_tag{0x300A, 0x073E}, vr(VR::SQ), vm_1, "AlternateValueSequence", "Alternate Value Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x073F}, vr(VR::SQ), vm_1, "ConfirmationSequence", "Confirmation Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0740}, vr(VR::SQ), vm_1, "InterlockSequence", "Interlock Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0741}, vr(VR::DT), vm_1, "InterlockDateTime", "Interlock DateTime", false},
+    tag_info{dicom_tag{0x300A, 0x0742}, vr(VR::ST), vm_1, "InterlockDescription", "Interlock Description", false},
+    tag_info{dicom_tag{0x300A, 0x0743}, vr(VR::SQ), vm_1, "InterlockOriginatingDeviceSequence", "Interlock Originating Device Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0744}, vr(VR::SQ), vm_1, "InterlockCodeSequence", "Interlock Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0745}, vr(VR::SQ), vm_1, "InterlockResolutionCodeSequence", "Interlock Resolution Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0746}, vr(VR::SQ), vm_1, "InterlockResolutionUserSequence", "Interlock Resolution User Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0760}, vr(VR::DT), vm_1, "OverrideDateTime", "Override DateTime", false},
+    tag_info{dicom_tag{0x300A, 0x0761}, vr(VR::SQ), vm_1, "TreatmentToleranceViolationTypeCodeSequence", "Treatment Tolerance Violation Type Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0762}, vr(VR::SQ), vm_1, "TreatmentToleranceViolationCauseCodeSequence", "Treatment Tolerance Violation Cause Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0772}, vr(VR::SQ), vm_1, "MeasuredMetersetToDoseMappingSequence", "Measured Meterset to Dose Mapping Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0773}, vr(VR::US), vm_1, "ReferencedExpectedInVivoMeasurementValueIndex", "Referenced Expected In-Vivo Measurement Value Index", false},
+    tag_info{dicom_tag{0x300A, 0x0774}, vr(VR::SQ), vm_1, "DoseMeasurementDeviceCodeSequence", "Dose Measurement Device Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0780}, vr(VR::SQ), vm_1, "AdditionalParameterRecordingInstanceSequence", "Additional Parameter Recording Instance Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0782}, vr(VR::US), vm_1, "", "", true},
+    tag_info{dicom_tag{0x300A, 0x0783}, vr(VR::ST), vm_1, "InterlockOriginDescription", "Interlock Origin Description", false},
+    tag_info{dicom_tag{0x300A, 0x0784}, vr(VR::SQ), vm_1, "RTPatientPositionScopeSequence", "RT Patient Position Scope Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0785}, vr(VR::UI), vm_1, "ReferencedTreatmentPositionGroupUID", "Referenced Treatment Position Group UID", false},
+    tag_info{dicom_tag{0x300A, 0x0786}, vr(VR::US), vm_1, "RadiationOrderIndex", "Radiation Order Index", false},
+    tag_info{dicom_tag{0x300A, 0x0787}, vr(VR::SQ), vm_1, "OmittedRadiationSequence", "Omitted Radiation Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0788}, vr(VR::SQ), vm_1, "ReasonForOmissionCodeSequence", "Reason for Omission Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0789}, vr(VR::SQ), vm_1, "RTDeliveryStartPatientPositionSequence", "RT Delivery Start Patient Position Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x078A}, vr(VR::SQ), vm_1, "RTTreatmentPreparationPatientPositionSequence", "RT Treatment Preparation Patient Position Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x078B}, vr(VR::SQ), vm_1, "ReferencedRTTreatmentPreparationSequence", "Referenced RT Treatment Preparation Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x078C}, vr(VR::SQ), vm_1, "ReferencedPatientSetupPhotoSequence", "Referenced Patient Setup Photo Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x078D}, vr(VR::SQ), vm_1, "PatientTreatmentPreparationMethodCodeSequence", "Patient Treatment Preparation Method Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x078E}, vr(VR::LT), vm_1, "PatientTreatmentPreparationProcedureParameterDescription", "Patient Treatment Preparation Procedure Parameter Description", false},
+    tag_info{dicom_tag{0x300A, 0x078F}, vr(VR::SQ), vm_1, "PatientTreatmentPreparationDeviceSequence", "Patient Treatment Preparation Device Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0790}, vr(VR::SQ), vm_1, "PatientTreatmentPreparationProcedureSequence", "Patient Treatment Preparation Procedure Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0791}, vr(VR::SQ), vm_1, "PatientTreatmentPreparationProcedureCodeSequence", "Patient Treatment Preparation Procedure Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0792}, vr(VR::LT), vm_1, "PatientTreatmentPreparationMethodDescription", "Patient Treatment Preparation Method Description", false},
+    tag_info{dicom_tag{0x300A, 0x0793}, vr(VR::SQ), vm_1, "PatientTreatmentPreparationProcedureParameterSequence", "Patient Treatment Preparation Procedure Parameter Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0794}, vr(VR::LT), vm_1, "PatientSetupPhotoDescription", "Patient Setup Photo Description", false},
+    tag_info{dicom_tag{0x300A, 0x0795}, vr(VR::US), vm_1, "PatientTreatmentPreparationProcedureIndex", "Patient Treatment Preparation Procedure Index", false},
+    tag_info{dicom_tag{0x300A, 0x0796}, vr(VR::US), vm_1, "ReferencedPatientSetupProcedureIndex", "Referenced Patient Setup Procedure Index", false},
+    tag_info{dicom_tag{0x300A, 0x0797}, vr(VR::SQ), vm_1, "RTRadiationTaskSequence", "RT Radiation Task Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0798}, vr(VR::SQ), vm_1, "RTPatientPositionDisplacementSequence", "RT Patient Position Displacement Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x0799}, vr(VR::SQ), vm_1, "RTPatientPositionSequence", "RT Patient Position Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x079A}, vr(VR::LO), vm_1, "DisplacementReferenceLabel", "Displacement Reference Label", false},
+    tag_info{dicom_tag{0x300A, 0x079B}, vr(VR::FD), vm_16, "DisplacementMatrix", "Displacement Matrix", false},
+    tag_info{dicom_tag{0x300A, 0x079C}, vr(VR::SQ), vm_1, "PatientSupportDisplacementSequence", "Patient Support Displacement Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x079D}, vr(VR::SQ), vm_1, "DisplacementReferenceLocationCodeSequence", "Displacement Reference Location Code Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x079E}, vr(VR::CS), vm_1, "RTRadiationSetDeliveryUsage", "RT Radiation Set Delivery Usage", false},
+    tag_info{dicom_tag{0x300A, 0x079F}, vr(VR::SQ), vm_1, "PatientTreatmentPreparationSequence", "Patient Treatment Preparation Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x07A0}, vr(VR::SQ), vm_1, "PatientToEquipmentRelationshipSequence", "Patient to Equipment Relationship Sequence", false},
+    tag_info{dicom_tag{0x300A, 0x07A1}, vr(VR::SQ), vm_1, "ImagingEquipmentToTreatmentDeliveryDeviceRelationshipSequence", "Imaging Equipment to Treatment Delivery Device Relationship Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0002}, vr(VR::SQ), vm_1, "ReferencedRTPlanSequence", "Referenced RT Plan Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0004}, vr(VR::SQ), vm_1, "ReferencedBeamSequence", "Referenced Beam Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0006}, vr(VR::IS), vm_1, "ReferencedBeamNumber", "Referenced Beam Number", false},
+    tag_info{dicom_tag{0x300C, 0x0007}, vr(VR::IS), vm_1, "ReferencedReferenceImageNumber", "Referenced Reference Image Number", false},
+    tag_info{dicom_tag{0x300C, 0x0008}, vr(VR::DS), vm_1, "StartCumulativeMetersetWeight", "Start Cumulative Meterset Weight", false},
+    tag_info{dicom_tag{0x300C, 0x0009}, vr(VR::DS), vm_1, "EndCumulativeMetersetWeight", "End Cumulative Meterset Weight", false},
+    tag_info{dicom_tag{0x300C, 0x000A}, vr(VR::SQ), vm_1, "ReferencedBrachyApplicationSetupSequence", "Referenced Brachy Application Setup Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x000C}, vr(VR::IS), vm_1, "ReferencedBrachyApplicationSetupNumber", "Referenced Brachy Application Setup Number", false},
+    tag_info{dicom_tag{0x300C, 0x000E}, vr(VR::IS), vm_1, "ReferencedSourceNumber", "Referenced Source Number", false},
+    tag_info{dicom_tag{0x300C, 0x0020}, vr(VR::SQ), vm_1, "ReferencedFractionGroupSequence", "Referenced Fraction Group Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0022}, vr(VR::IS), vm_1, "ReferencedFractionGroupNumber", "Referenced Fraction Group Number", false},
+    tag_info{dicom_tag{0x300C, 0x0040}, vr(VR::SQ), vm_1, "ReferencedVerificationImageSequence", "Referenced Verification Image Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0042}, vr(VR::SQ), vm_1, "ReferencedReferenceImageSequence", "Referenced Reference Image Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0050}, vr(VR::SQ), vm_1, "ReferencedDoseReferenceSequence", "Referenced Dose Reference Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0051}, vr(VR::IS), vm_1, "ReferencedDoseReferenceNumber", "Referenced Dose Reference Number", false},
+    tag_info{dicom_tag{0x300C, 0x0055}, vr(VR::SQ), vm_1, "BrachyReferencedDoseReferenceSequence", "Brachy Referenced Dose Reference Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0060}, vr(VR::SQ), vm_1, "ReferencedStructureSetSequence", "Referenced Structure Set Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x006A}, vr(VR::IS), vm_1, "ReferencedPatientSetupNumber", "Referenced Patient Setup Number", false},
+    tag_info{dicom_tag{0x300C, 0x0080}, vr(VR::SQ), vm_1, "ReferencedDoseSequence", "Referenced Dose Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x00A0}, vr(VR::IS), vm_1, "ReferencedToleranceTableNumber", "Referenced Tolerance Table Number", false},
+    tag_info{dicom_tag{0x300C, 0x00B0}, vr(VR::SQ), vm_1, "ReferencedBolusSequence", "Referenced Bolus Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x00C0}, vr(VR::IS), vm_1, "ReferencedWedgeNumber", "Referenced Wedge Number", false},
+    tag_info{dicom_tag{0x300C, 0x00D0}, vr(VR::IS), vm_1, "ReferencedCompensatorNumber", "Referenced Compensator Number", false},
+    tag_info{dicom_tag{0x300C, 0x00E0}, vr(VR::IS), vm_1, "ReferencedBlockNumber", "Referenced Block Number", false},
+    tag_info{dicom_tag{0x300C, 0x00F0}, vr(VR::IS), vm_1, "ReferencedControlPointIndex", "Referenced Control Point Index", false},
+    tag_info{dicom_tag{0x300C, 0x00F2}, vr(VR::SQ), vm_1, "ReferencedControlPointSequence", "Referenced Control Point Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x00F4}, vr(VR::IS), vm_1, "ReferencedStartControlPointIndex", "Referenced Start Control Point Index", false},
+    tag_info{dicom_tag{0x300C, 0x00F6}, vr(VR::IS), vm_1, "ReferencedStopControlPointIndex", "Referenced Stop Control Point Index", false},
+    tag_info{dicom_tag{0x300C, 0x0100}, vr(VR::IS), vm_1, "ReferencedRangeShifterNumber", "Referenced Range Shifter Number", false},
+    tag_info{dicom_tag{0x300C, 0x0102}, vr(VR::IS), vm_1, "ReferencedLateralSpreadingDeviceNumber", "Referenced Lateral Spreading Device Number", false},
+    tag_info{dicom_tag{0x300C, 0x0104}, vr(VR::IS), vm_1, "ReferencedRangeModulatorNumber", "Referenced Range Modulator Number", false},
+    tag_info{dicom_tag{0x300C, 0x0111}, vr(VR::SQ), vm_1, "OmittedBeamTaskSequence", "Omitted Beam Task Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0112}, vr(VR::CS), vm_1, "ReasonForOmission", "Reason for Omission", false},
+    tag_info{dicom_tag{0x300C, 0x0113}, vr(VR::LO), vm_1, "ReasonForOmissionDescription", "Reason for Omission Description", false},
+    tag_info{dicom_tag{0x300C, 0x0114}, vr(VR::SQ), vm_1, "PrescriptionOverviewSequence", "Prescription Overview Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0115}, vr(VR::FL), vm_1, "TotalPrescriptionDose", "Total Prescription Dose", false},
+    tag_info{dicom_tag{0x300C, 0x0116}, vr(VR::SQ), vm_1, "PlanOverviewSequence", "Plan Overview Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0117}, vr(VR::US), vm_1, "PlanOverviewIndex", "Plan Overview Index", false},
+    tag_info{dicom_tag{0x300C, 0x0118}, vr(VR::US), vm_1, "ReferencedPlanOverviewIndex", "Referenced Plan Overview Index", false},
+    tag_info{dicom_tag{0x300C, 0x0119}, vr(VR::US), vm_1, "NumberOfFractionsIncluded", "Number of Fractions Included", false},
+    tag_info{dicom_tag{0x300C, 0x0120}, vr(VR::SQ), vm_1, "DoseCalibrationConditionsSequence", "Dose Calibration Conditions Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0121}, vr(VR::FD), vm_1, "AbsorbedDoseToMetersetRatio", "Absorbed Dose to Meterset Ratio", false},
+    tag_info{dicom_tag{0x300C, 0x0122}, vr(VR::FD), vm_2, "DelineatedRadiationFieldSize", "Delineated Radiation Field Size", false},
+    tag_info{dicom_tag{0x300C, 0x0123}, vr(VR::CS), vm_1, "DoseCalibrationConditionsVerifiedFlag", "Dose Calibration Conditions Verified Flag", false},
+    tag_info{dicom_tag{0x300C, 0x0124}, vr(VR::FD), vm_1, "CalibrationReferencePointDepth", "Calibration Reference Point Depth", false},
+    tag_info{dicom_tag{0x300C, 0x0125}, vr(VR::SQ), vm_1, "GatingBeamHoldTransitionSequence", "Gating Beam Hold Transition Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0126}, vr(VR::CS), vm_1, "BeamHoldTransition", "Beam Hold Transition", false},
+    tag_info{dicom_tag{0x300C, 0x0127}, vr(VR::DT), vm_1, "BeamHoldTransitionDateTime", "Beam Hold Transition DateTime", false},
+    tag_info{dicom_tag{0x300C, 0x0128}, vr(VR::SQ), vm_1, "BeamHoldOriginatingDeviceSequence", "Beam Hold Originating Device Sequence", false},
+    tag_info{dicom_tag{0x300C, 0x0129}, vr(VR::CS), vm_1, "BeamHoldTransitionTriggerSource", "Beam Hold Transition Trigger Source", false},
+    tag_info{dicom_tag{0x300E, 0x0002}, vr(VR::CS), vm_1, "ApprovalStatus", "Approval Status", false},
+    tag_info{dicom_tag{0x300E, 0x0004}, vr(VR::DA), vm_1, "ReviewDate", "Review Date", false},
+    tag_info{dicom_tag{0x300E, 0x0005}, vr(VR::TM), vm_1, "ReviewTime", "Review Time", false},
+    tag_info{dicom_tag{0x300E, 0x0008}, vr(VR::PN), vm_1, "ReviewerName", "Reviewer Name", false},
+    tag_info{dicom_tag{0x3010, 0x0001}, vr(VR::SQ), vm_1, "RadiobiologicalDoseEffectSequence", "Radiobiological Dose Effect Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0002}, vr(VR::CS), vm_1, "RadiobiologicalDoseEffectFlag", "Radiobiological Dose Effect Flag", false},
+    tag_info{dicom_tag{0x3010, 0x0003}, vr(VR::SQ), vm_1, "EffectiveDoseCalculationMethodCategoryCodeSequence", "Effective Dose Calculation Method Category Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0004}, vr(VR::SQ), vm_1, "EffectiveDoseCalculationMethodCodeSequence", "Effective Dose Calculation Method Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0005}, vr(VR::LO), vm_1, "EffectiveDoseCalculationMethodDescription", "Effective Dose Calculation Method Description", false},
+    tag_info{dicom_tag{0x3010, 0x0006}, vr(VR::UI), vm_1, "ConceptualVolumeUID", "Conceptual Volume UID", false},
+    tag_info{dicom_tag{0x3010, 0x0007}, vr(VR::SQ), vm_1, "OriginatingSOPInstanceReferenceSequence", "Originating SOP Instance Reference Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0008}, vr(VR::SQ), vm_1, "ConceptualVolumeConstituentSequence", "Conceptual Volume Constituent Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0009}, vr(VR::SQ), vm_1, "EquivalentConceptualVolumeInstanceReferenceSequence", "Equivalent Conceptual Volume Instance Reference Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x000A}, vr(VR::SQ), vm_1, "EquivalentConceptualVolumesSequence", "Equivalent Conceptual Volumes Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x000B}, vr(VR::UI), vm_1, "ReferencedConceptualVolumeUID", "Referenced Conceptual Volume UID", false},
+    tag_info{dicom_tag{0x3010, 0x000C}, vr(VR::UT), vm_1, "ConceptualVolumeCombinationExpression", "Conceptual Volume Combination Expression", false},
+    tag_info{dicom_tag{0x3010, 0x000D}, vr(VR::US), vm_1, "ConceptualVolumeConstituentIndex", "Conceptual Volume Constituent Index", false},
+    tag_info{dicom_tag{0x3010, 0x000E}, vr(VR::CS), vm_1, "ConceptualVolumeCombinationFlag", "Conceptual Volume Combination Flag", false},
+    tag_info{dicom_tag{0x3010, 0x000F}, vr(VR::ST), vm_1, "ConceptualVolumeCombinationDescription", "Conceptual Volume Combination Description", false},
+    tag_info{dicom_tag{0x3010, 0x0010}, vr(VR::CS), vm_1, "ConceptualVolumeSegmentationDefinedFlag", "Conceptual Volume Segmentation Defined Flag", false},
+    tag_info{dicom_tag{0x3010, 0x0011}, vr(VR::SQ), vm_1, "ConceptualVolumeSegmentationReferenceSequence", "Conceptual Volume Segmentation Reference Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0012}, vr(VR::SQ), vm_1, "ConceptualVolumeConstituentSegmentationReferenceSequence", "Conceptual Volume Constituent Segmentation Reference Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0013}, vr(VR::UI), vm_1, "ConstituentConceptualVolumeUID", "Constituent Conceptual Volume UID", false},
+    tag_info{dicom_tag{0x3010, 0x0014}, vr(VR::SQ), vm_1, "DerivationConceptualVolumeSequence", "Derivation Conceptual Volume Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0015}, vr(VR::UI), vm_1, "SourceConceptualVolumeUID", "Source Conceptual Volume UID", false},
+    tag_info{dicom_tag{0x3010, 0x0016}, vr(VR::SQ), vm_1, "ConceptualVolumeDerivationAlgorithmSequence", "Conceptual Volume Derivation Algorithm Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0017}, vr(VR::ST), vm_1, "ConceptualVolumeDescription", "Conceptual Volume Description", false},
+    tag_info{dicom_tag{0x3010, 0x0018}, vr(VR::SQ), vm_1, "SourceConceptualVolumeSequence", "Source Conceptual Volume Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0019}, vr(VR::SQ), vm_1, "AuthorIdentificationSequence", "Author Identification Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x001A}, vr(VR::LO), vm_1, "ManufacturerModelVersion", "Manufacturer's Model Version", false},
+    tag_info{dicom_tag{0x3010, 0x001B}, vr(VR::UC), vm_1, "DeviceAlternateIdentifier", "Device Alternate Identifier", false},
+    tag_info{dicom_tag{0x3010, 0x001C}, vr(VR::CS), vm_1, "DeviceAlternateIdentifierType", "Device Alternate Identifier Type", false},
+    tag_info{dicom_tag{0x3010, 0x001D}, vr(VR::LT), vm_1, "DeviceAlternateIdentifierFormat", "Device Alternate Identifier Format", false},
+    tag_info{dicom_tag{0x3010, 0x001E}, vr(VR::LO), vm_1, "SegmentationCreationTemplateLabel", "Segmentation Creation Template Label", false},
+    tag_info{dicom_tag{0x3010, 0x001F}, vr(VR::UI), vm_1, "SegmentationTemplateUID", "Segmentation Template UID", false},
+    tag_info{dicom_tag{0x3010, 0x0020}, vr(VR::US), vm_1, "ReferencedSegmentReferenceIndex", "Referenced Segment Reference Index", false},
+    tag_info{dicom_tag{0x3010, 0x0021}, vr(VR::SQ), vm_1, "SegmentReferenceSequence", "Segment Reference Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0022}, vr(VR::US), vm_1, "SegmentReferenceIndex", "Segment Reference Index", false},
+    tag_info{dicom_tag{0x3010, 0x0023}, vr(VR::SQ), vm_1, "DirectSegmentReferenceSequence", "Direct Segment Reference Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0024}, vr(VR::SQ), vm_1, "CombinationSegmentReferenceSequence", "Combination Segment Reference Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0025}, vr(VR::SQ), vm_1, "ConceptualVolumeSequence", "Conceptual Volume Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0026}, vr(VR::SQ), vm_1, "SegmentedRTAccessoryDeviceSequence", "Segmented RT Accessory Device Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0027}, vr(VR::SQ), vm_1, "SegmentCharacteristicsSequence", "Segment Characteristics Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0028}, vr(VR::SQ), vm_1, "RelatedSegmentCharacteristicsSequence", "Related Segment Characteristics Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0029}, vr(VR::US), vm_1, "SegmentCharacteristicsPrecedence", "Segment Characteristics Precedence", false},
+    tag_info{dicom_tag{0x3010, 0x002A}, vr(VR::SQ), vm_1, "RTSegmentAnnotationSequence", "RT Segment Annotation Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x002B}, vr(VR::SQ), vm_1, "SegmentAnnotationCategoryCodeSequence", "Segment Annotation Category Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x002C}, vr(VR::SQ), vm_1, "SegmentAnnotationTypeCodeSequence", "Segment Annotation Type Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x002D}, vr(VR::LO), vm_1, "DeviceLabel", "Device Label", false},
+    tag_info{dicom_tag{0x3010, 0x002E}, vr(VR::SQ), vm_1, "DeviceTypeCodeSequence", "Device Type Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x002F}, vr(VR::SQ), vm_1, "SegmentAnnotationTypeModifierCodeSequence", "Segment Annotation Type Modifier Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0030}, vr(VR::SQ), vm_1, "PatientEquipmentRelationshipCodeSequence", "Patient Equipment Relationship Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0031}, vr(VR::UI), vm_1, "ReferencedFiducialsUID", "Referenced Fiducials UID", false},
+    tag_info{dicom_tag{0x3010, 0x0032}, vr(VR::SQ), vm_1, "PatientTreatmentOrientationSequence", "Patient Treatment Orientation Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0033}, vr(VR::SH), vm_1, "UserContentLabel", "User Content Label", false},
+    tag_info{dicom_tag{0x3010, 0x0034}, vr(VR::LO), vm_1, "UserContentLongLabel", "User Content Long Label", false},
+    tag_info{dicom_tag{0x3010, 0x0035}, vr(VR::SH), vm_1, "EntityLabel", "Entity Label", false},
+    tag_info{dicom_tag{0x3010, 0x0036}, vr(VR::LO), vm_1, "EntityName", "Entity Name", false},
+    tag_info{dicom_tag{0x3010, 0x0037}, vr(VR::ST), vm_1, "EntityDescription", "Entity Description", false},
+    tag_info{dicom_tag{0x3010, 0x0038}, vr(VR::LO), vm_1, "EntityLongLabel", "Entity Long Label", false},
+    tag_info{dicom_tag{0x3010, 0x0039}, vr(VR::US), vm_1, "DeviceIndex", "Device Index", false},
+    tag_info{dicom_tag{0x3010, 0x003A}, vr(VR::US), vm_1, "RTTreatmentPhaseIndex", "RT Treatment Phase Index", false},
+    tag_info{dicom_tag{0x3010, 0x003B}, vr(VR::UI), vm_1, "RTTreatmentPhaseUID", "RT Treatment Phase UID", false},
+    tag_info{dicom_tag{0x3010, 0x003C}, vr(VR::US), vm_1, "RTPrescriptionIndex", "RT Prescription Index", false},
+    tag_info{dicom_tag{0x3010, 0x003D}, vr(VR::US), vm_1, "RTSegmentAnnotationIndex", "RT Segment Annotation Index", false},
+    tag_info{dicom_tag{0x3010, 0x003E}, vr(VR::US), vm_1, "BasisRTTreatmentPhaseIndex", "Basis RT Treatment Phase Index", false},
+    tag_info{dicom_tag{0x3010, 0x003F}, vr(VR::US), vm_1, "RelatedRTTreatmentPhaseIndex", "Related RT Treatment Phase Index", false},
+    tag_info{dicom_tag{0x3010, 0x0040}, vr(VR::US), vm_1, "ReferencedRTTreatmentPhaseIndex", "Referenced RT Treatment Phase Index", false},
+    tag_info{dicom_tag{0x3010, 0x0041}, vr(VR::US), vm_1, "ReferencedRTPrescriptionIndex", "Referenced RT Prescription Index", false},
+    tag_info{dicom_tag{0x3010, 0x0042}, vr(VR::US), vm_1, "ReferencedParentRTPrescriptionIndex", "Referenced Parent RT Prescription Index", false},
+    tag_info{dicom_tag{0x3010, 0x0043}, vr(VR::ST), vm_1, "ManufacturerDeviceIdentifier", "Manufacturer's Device Identifier", false},
+    tag_info{dicom_tag{0x3010, 0x0044}, vr(VR::SQ), vm_1, "InstanceLevelReferencedPerformedProcedureStepSequence", "Instance-Level Referenced Performed Procedure Step Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0045}, vr(VR::CS), vm_1, "RTTreatmentPhaseIntentPresenceFlag", "RT Treatment Phase Intent Presence Flag", false},
+    tag_info{dicom_tag{0x3010, 0x0046}, vr(VR::CS), vm_1, "RadiotherapyTreatmentType", "Radiotherapy Treatment Type", false},
+    tag_info{dicom_tag{0x3010, 0x0047}, vr(VR::CS), vm_1_n, "TeletherapyRadiationType", "Teletherapy Radiation Type", false},
+    tag_info{dicom_tag{0x3010, 0x0048}, vr(VR::CS), vm_1_n, "BrachytherapySourceType", "Brachytherapy Source Type", false},
+    tag_info{dicom_tag{0x3010, 0x0049}, vr(VR::SQ), vm_1, "ReferencedRTTreatmentPhaseSequence", "Referenced RT Treatment Phase Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x004A}, vr(VR::SQ), vm_1, "ReferencedDirectSegmentInstanceSequence", "Referenced Direct Segment Instance Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x004B}, vr(VR::SQ), vm_1, "IntendedRTTreatmentPhaseSequence", "Intended RT Treatment Phase Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x004C}, vr(VR::DA), vm_1, "IntendedPhaseStartDate", "Intended Phase Start Date", false},
+    tag_info{dicom_tag{0x3010, 0x004D}, vr(VR::DA), vm_1, "IntendedPhaseEndDate", "Intended Phase End Date", false},
+    tag_info{dicom_tag{0x3010, 0x004E}, vr(VR::SQ), vm_1, "RTTreatmentPhaseIntervalSequence", "RT Treatment Phase Interval Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x004F}, vr(VR::CS), vm_1, "TemporalRelationshipIntervalAnchor", "Temporal Relationship Interval Anchor", false},
+    tag_info{dicom_tag{0x3010, 0x0050}, vr(VR::FD), vm_1, "MinimumNumberOfIntervalDays", "Minimum Number of Interval Days", false},
+    tag_info{dicom_tag{0x3010, 0x0051}, vr(VR::FD), vm_1, "MaximumNumberOfIntervalDays", "Maximum Number of Interval Days", false},
+    tag_info{dicom_tag{0x3010, 0x0052}, vr(VR::UI), vm_1_n, "PertinentSOPClassesInStudy", "Pertinent SOP Classes in Study", false},
+    tag_info{dicom_tag{0x3010, 0x0053}, vr(VR::UI), vm_1_n, "PertinentSOPClassesInSeries", "Pertinent SOP Classes in Series", false},
+    tag_info{dicom_tag{0x3010, 0x0054}, vr(VR::LO), vm_1, "RTPrescriptionLabel", "RT Prescription Label", false},
+    tag_info{dicom_tag{0x3010, 0x0055}, vr(VR::SQ), vm_1, "RTPhysicianIntentPredecessorSequence", "RT Physician Intent Predecessor Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0056}, vr(VR::LO), vm_1, "RTTreatmentApproachLabel", "RT Treatment Approach Label", false},
+    tag_info{dicom_tag{0x3010, 0x0057}, vr(VR::SQ), vm_1, "RTPhysicianIntentSequence", "RT Physician Intent Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0058}, vr(VR::US), vm_1, "RTPhysicianIntentIndex", "RT Physician Intent Index", false},
+    tag_info{dicom_tag{0x3010, 0x0059}, vr(VR::CS), vm_1, "RTTreatmentIntentType", "RT Treatment Intent Type", false},
+    tag_info{dicom_tag{0x3010, 0x005A}, vr(VR::UT), vm_1, "RTPhysicianIntentNarrative", "RT Physician Intent Narrative", false},
+    tag_info{dicom_tag{0x3010, 0x005B}, vr(VR::SQ), vm_1, "RTProtocolCodeSequence", "RT Protocol Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x005C}, vr(VR::ST), vm_1, "ReasonForSuperseding", "Reason for Superseding", false},
+    tag_info{dicom_tag{0x3010, 0x005D}, vr(VR::SQ), vm_1, "RTDiagnosisCodeSequence", "RT Diagnosis Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x005E}, vr(VR::US), vm_1, "ReferencedRTPhysicianIntentIndex", "Referenced RT Physician Intent Index", false},
+    tag_info{dicom_tag{0x3010, 0x005F}, vr(VR::SQ), vm_1, "RTPhysicianIntentInputInstanceSequence", "RT Physician Intent Input Instance Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0060}, vr(VR::SQ), vm_1, "RTAnatomicPrescriptionSequence", "RT Anatomic Prescription Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0061}, vr(VR::UT), vm_1, "PriorTreatmentDoseDescription", "Prior Treatment Dose Description", false},
+    tag_info{dicom_tag{0x3010, 0x0062}, vr(VR::SQ), vm_1, "PriorTreatmentReferenceSequence", "Prior Treatment Reference Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0063}, vr(VR::CS), vm_1, "DosimetricObjectiveEvaluationScope", "Dosimetric Objective Evaluation Scope", false},
+    tag_info{dicom_tag{0x3010, 0x0064}, vr(VR::SQ), vm_1, "TherapeuticRoleCategoryCodeSequence", "Therapeutic Role Category Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0065}, vr(VR::SQ), vm_1, "TherapeuticRoleTypeCodeSequence", "Therapeutic Role Type Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0066}, vr(VR::US), vm_1, "ConceptualVolumeOptimizationPrecedence", "Conceptual Volume Optimization Precedence", false},
+    tag_info{dicom_tag{0x3010, 0x0067}, vr(VR::SQ), vm_1, "ConceptualVolumeCategoryCodeSequence", "Conceptual Volume Category Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0068}, vr(VR::CS), vm_1, "ConceptualVolumeBlockingConstraint", "Conceptual Volume Blocking Constraint", false},
+    tag_info{dicom_tag{0x3010, 0x0069}, vr(VR::SQ), vm_1, "ConceptualVolumeTypeCodeSequence", "Conceptual Volume Type Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x006A}, vr(VR::SQ), vm_1, "ConceptualVolumeTypeModifierCodeSequence", "Conceptual Volume Type Modifier Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x006B}, vr(VR::SQ), vm_1, "RTPrescriptionSequence", "RT Prescription Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x006C}, vr(VR::SQ), vm_1, "DosimetricObjectiveSequence", "Dosimetric Objective Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x006D}, vr(VR::SQ), vm_1, "DosimetricObjectiveTypeCodeSequence", "Dosimetric Objective Type Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x006E}, vr(VR::UI), vm_1, "DosimetricObjectiveUID", "Dosimetric Objective UID", false},
+    tag_info{dicom_tag{0x3010, 0x006F}, vr(VR::UI), vm_1, "ReferencedDosimetricObjectiveUID", "Referenced Dosimetric Objective UID", false},
+    tag_info{dicom_tag{0x3010, 0x0070}, vr(VR::SQ), vm_1, "DosimetricObjectiveParameterSequence", "Dosimetric Objective Parameter Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0071}, vr(VR::SQ), vm_1, "ReferencedDosimetricObjectivesSequence", "Referenced Dosimetric Objectives Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0073}, vr(VR::CS), vm_1, "AbsoluteDosimetricObjectiveFlag", "Absolute Dosimetric Objective Flag", false},
+    tag_info{dicom_tag{0x3010, 0x0074}, vr(VR::FD), vm_1, "DosimetricObjectiveWeight", "Dosimetric Objective Weight", false},
+    tag_info{dicom_tag{0x3010, 0x0075}, vr(VR::CS), vm_1, "DosimetricObjectivePurpose", "Dosimetric Objective Purpose", false},
+    tag_info{dicom_tag{0x3010, 0x0076}, vr(VR::SQ), vm_1, "PlanningInputInformationSequence", "Planning Input Information Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0077}, vr(VR::LO), vm_1, "TreatmentSite", "Treatment Site", false},
+    tag_info{dicom_tag{0x3010, 0x0078}, vr(VR::SQ), vm_1, "TreatmentSiteCodeSequence", "Treatment Site Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0079}, vr(VR::SQ), vm_1, "FractionPatternSequence", "Fraction Pattern Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x007A}, vr(VR::UT), vm_1, "TreatmentTechniqueNotes", "Treatment Technique Notes", false},
+    tag_info{dicom_tag{0x3010, 0x007B}, vr(VR::UT), vm_1, "PrescriptionNotes", "Prescription Notes", false},
+    tag_info{dicom_tag{0x3010, 0x007C}, vr(VR::IS), vm_1, "NumberOfIntervalFractions", "Number of Interval Fractions", false},
+    tag_info{dicom_tag{0x3010, 0x007D}, vr(VR::US), vm_1, "NumberOfFractions", "Number of Fractions", false},
+    tag_info{dicom_tag{0x3010, 0x007E}, vr(VR::US), vm_1, "IntendedDeliveryDuration", "Intended Delivery Duration", false},
+    tag_info{dicom_tag{0x3010, 0x007F}, vr(VR::UT), vm_1, "FractionationNotes", "Fractionation Notes", false},
+    tag_info{dicom_tag{0x3010, 0x0080}, vr(VR::SQ), vm_1, "RTTreatmentTechniqueCodeSequence", "RT Treatment Technique Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0081}, vr(VR::SQ), vm_1, "PrescriptionNotesSequence", "Prescription Notes Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0082}, vr(VR::SQ), vm_1, "FractionBasedRelationshipSequence", "Fraction-Based Relationship Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0083}, vr(VR::CS), vm_1, "FractionBasedRelationshipIntervalAnchor", "Fraction-Based Relationship Interval Anchor", false},
+    tag_info{dicom_tag{0x3010, 0x0084}, vr(VR::FD), vm_1, "MinimumHoursBetweenFractions", "Minimum Hours between Fractions", false},
+    tag_info{dicom_tag{0x3010, 0x0085}, vr(VR::TM), vm_1_n, "IntendedFractionStartTime", "Intended Fraction Start Time", false},
+    tag_info{dicom_tag{0x3010, 0x0086}, vr(VR::LT), vm_1, "IntendedStartDayOfWeek", "Intended Start Day of Week", false},
+    tag_info{dicom_tag{0x3010, 0x0087}, vr(VR::SQ), vm_1, "WeekdayFractionPatternSequence", "Weekday Fraction Pattern Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0088}, vr(VR::SQ), vm_1, "DeliveryTimeStructureCodeSequence", "Delivery Time Structure Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0089}, vr(VR::SQ), vm_1, "TreatmentSiteModifierCodeSequence", "Treatment Site Modifier Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0090}, vr(VR::CS), vm_1, "RoboticBaseLocationIndicator", "Robotic Base Location Indicator", true},
+    tag_info{dicom_tag{0x3010, 0x0091}, vr(VR::SQ), vm_1, "RoboticPathNodeSetCodeSequence", "Robotic Path Node Set Code Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0092}, vr(VR::UL), vm_1, "RoboticNodeIdentifier", "Robotic Node Identifier", false},
+    tag_info{dicom_tag{0x3010, 0x0093}, vr(VR::FD), vm_3, "RTTreatmentSourceCoordinates", "RT Treatment Source Coordinates", false},
+    tag_info{dicom_tag{0x3010, 0x0094}, vr(VR::FD), vm_1, "RadiationSourceCoordinateSystemYawAngle", "Radiation Source Coordinate SystemYaw Angle", false},
+    tag_info{dicom_tag{0x3010, 0x0095}, vr(VR::FD), vm_1, "RadiationSourceCoordinateSystemRollAngle", "Radiation Source Coordinate SystemRoll Angle", false},
+    tag_info{dicom_tag{0x3010, 0x0096}, vr(VR::FD), vm_1, "RadiationSourceCoordinateSystemPitchAngle", "Radiation Source Coordinate System Pitch Angle", false},
+    tag_info{dicom_tag{0x3010, 0x0097}, vr(VR::SQ), vm_1, "RoboticPathControlPointSequence", "Robotic Path Control Point Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0098}, vr(VR::SQ), vm_1, "TomotherapeuticControlPointSequence", "Tomotherapeutic Control Point Sequence", false},
+    tag_info{dicom_tag{0x3010, 0x0099}, vr(VR::FD), vm_1_n, "TomotherapeuticLeafOpenDurations", "Tomotherapeutic Leaf Open Durations", false},
+    tag_info{dicom_tag{0x3010, 0x009A}, vr(VR::FD), vm_1_n, "TomotherapeuticLeafInitialClosedDurations", "Tomotherapeutic Leaf Initial Closed Durations", false},
+    tag_info{dicom_tag{0x3010, 0x00A0}, vr(VR::SQ), vm_1, "ConceptualVolumeIdentificationSequence", "Conceptual Volume Identification Sequence", false},
+    tag_info{dicom_tag{0x4000, 0x0010}, vr(VR::LT), vm_1, "Arbitrary", "Arbitrary", true},
+    tag_info{dicom_tag{0x4000, 0x4000}, vr(VR::LT), vm_1, "TextComments", "Text Comments", true},
+    tag_info{dicom_tag{0x4008, 0x0040}, vr(VR::SH), vm_1, "ResultsID", "Results ID", true},
+    tag_info{dicom_tag{0x4008, 0x0042}, vr(VR::LO), vm_1, "ResultsIDIssuer", "Results ID Issuer", true},
+    tag_info{dicom_tag{0x4008, 0x0050}, vr(VR::SQ), vm_1, "ReferencedInterpretationSequence", "Referenced Interpretation Sequence", true},
+    tag_info{dicom_tag{0x4008, 0x00FF}, vr(VR::CS), vm_1, "ReportProductionStatusTrial", "Report Production Status (Trial)", true},
+    tag_info{dicom_tag{0x4008, 0x0100}, vr(VR::DA), vm_1, "InterpretationRecordedDate", "Interpretation Recorded Date", true},
+    tag_info{dicom_tag{0x4008, 0x0101}, vr(VR::TM), vm_1, "InterpretationRecordedTime", "Interpretation Recorded Time", true},
+    tag_info{dicom_tag{0x4008, 0x0102}, vr(VR::PN), vm_1, "InterpretationRecorder", "Interpretation Recorder", true},
+    tag_info{dicom_tag{0x4008, 0x0103}, vr(VR::LO), vm_1, "ReferenceToRecordedSound", "Reference to Recorded Sound", true},
+    tag_info{dicom_tag{0x4008, 0x0108}, vr(VR::DA), vm_1, "InterpretationTranscriptionDate", "Interpretation Transcription Date", true},
+    tag_info{dicom_tag{0x4008, 0x0109}, vr(VR::TM), vm_1, "InterpretationTranscriptionTime", "Interpretation Transcription Time", true},
+    tag_info{dicom_tag{0x4008, 0x010A}, vr(VR::PN), vm_1, "InterpretationTranscriber", "Interpretation Transcriber", true},
+    tag_info{dicom_tag{0x4008, 0x010B}, vr(VR::ST), vm_1, "InterpretationText", "Interpretation Text", true},
+    tag_info{dicom_tag{0x4008, 0x010C}, vr(VR::PN), vm_1, "InterpretationAuthor", "Interpretation Author", true},
+    tag_info{dicom_tag{0x4008, 0x0111}, vr(VR::SQ), vm_1, "InterpretationApproverSequence", "Interpretation Approver Sequence", true},
+    tag_info{dicom_tag{0x4008, 0x0112}, vr(VR::DA), vm_1, "InterpretationApprovalDate", "Interpretation Approval Date", true},
+    tag_info{dicom_tag{0x4008, 0x0113}, vr(VR::TM), vm_1, "InterpretationApprovalTime", "Interpretation Approval Time", true},
+    tag_info{dicom_tag{0x4008, 0x0114}, vr(VR::PN), vm_1, "PhysicianApprovingInterpretation", "Physician Approving Interpretation", true},
+    tag_info{dicom_tag{0x4008, 0x0115}, vr(VR::LT), vm_1, "InterpretationDiagnosisDescription", "Interpretation Diagnosis Description", true},
+    tag_info{dicom_tag{0x4008, 0x0117}, vr(VR::SQ), vm_1, "InterpretationDiagnosisCodeSequence", "Interpretation Diagnosis Code Sequence", true},
+    tag_info{dicom_tag{0x4008, 0x0118}, vr(VR::SQ), vm_1, "ResultsDistributionListSequence", "Results Distribution List Sequence", true},
+    tag_info{dicom_tag{0x4008, 0x0119}, vr(VR::PN), vm_1, "DistributionName", "Distribution Name", true},
+    tag_info{dicom_tag{0x4008, 0x011A}, vr(VR::LO), vm_1, "DistributionAddress", "Distribution Address", true},
+    tag_info{dicom_tag{0x4008, 0x0200}, vr(VR::SH), vm_1, "InterpretationID", "Interpretation ID", true},
+    tag_info{dicom_tag{0x4008, 0x0202}, vr(VR::LO), vm_1, "InterpretationIDIssuer", "Interpretation ID Issuer", true},
+    tag_info{dicom_tag{0x4008, 0x0210}, vr(VR::CS), vm_1, "InterpretationTypeID", "Interpretation Type ID", true},
+    tag_info{dicom_tag{0x4008, 0x0212}, vr(VR::CS), vm_1, "InterpretationStatusID", "Interpretation Status ID", true},
+    tag_info{dicom_tag{0x4008, 0x0300}, vr(VR::ST), vm_1, "Impressions", "Impressions", true},
+    tag_info{dicom_tag{0x4008, 0x4000}, vr(VR::ST), vm_1, "ResultsComments", "Results Comments", true},
+    tag_info{dicom_tag{0x4010, 0x0001}, vr(VR::CS), vm_1, "LowEnergyDetectors", "Low Energy Detectors", false},
+    tag_info{dicom_tag{0x4010, 0x0002}, vr(VR::CS), vm_1, "HighEnergyDetectors", "High Energy Detectors", false},
+    tag_info{dicom_tag{0x4010, 0x0004}, vr(VR::SQ), vm_1, "DetectorGeometrySequence", "Detector Geometry Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1001}, vr(VR::SQ), vm_1, "ThreatROIVoxelSequence", "Threat ROI Voxel Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1004}, vr(VR::FL), vm_3, "ThreatROIBase", "Threat ROI Base", false},
+    tag_info{dicom_tag{0x4010, 0x1005}, vr(VR::FL), vm_3, "ThreatROIExtents", "Threat ROI Extents", false},
+    tag_info{dicom_tag{0x4010, 0x1006}, vr(VR::OB), vm_1, "ThreatROIBitmap", "Threat ROI Bitmap", false},
+    tag_info{dicom_tag{0x4010, 0x1007}, vr(VR::SH), vm_1, "RouteSegmentID", "Route Segment ID", false},
+    tag_info{dicom_tag{0x4010, 0x1008}, vr(VR::CS), vm_1, "GantryType", "Gantry Type", false},
+    tag_info{dicom_tag{0x4010, 0x1009}, vr(VR::CS), vm_1, "OOIOwnerType", "OOI Owner Type", false},
+    tag_info{dicom_tag{0x4010, 0x100A}, vr(VR::SQ), vm_1, "RouteSegmentSequence", "Route Segment Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1010}, vr(VR::US), vm_1, "PotentialThreatObjectID", "Potential Threat Object ID", false},
+    tag_info{dicom_tag{0x4010, 0x1011}, vr(VR::SQ), vm_1, "ThreatSequence", "Threat Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1012}, vr(VR::CS), vm_1, "ThreatCategory", "Threat Category", false},
+    tag_info{dicom_tag{0x4010, 0x1013}, vr(VR::LT), vm_1, "ThreatCategoryDescription", "Threat Category Description", false},
+    tag_info{dicom_tag{0x4010, 0x1014}, vr(VR::CS), vm_1, "ATDAbilityAssessment", "ATD Ability Assessment", false},
+    tag_info{dicom_tag{0x4010, 0x1015}, vr(VR::CS), vm_1, "ATDAssessmentFlag", "ATD Assessment Flag", false},
+    tag_info{dicom_tag{0x4010, 0x1016}, vr(VR::FL), vm_1, "ATDAssessmentProbability", "ATD Assessment Probability", false},
+    tag_info{dicom_tag{0x4010, 0x1017}, vr(VR::FL), vm_1, "Mass", "Mass", false},
+    tag_info{dicom_tag{0x4010, 0x1018}, vr(VR::FL), vm_1, "Density", "Density", false},
+    tag_info{dicom_tag{0x4010, 0x1019}, vr(VR::FL), vm_1, "ZEffective", "Z Effective", false},
+    tag_info{dicom_tag{0x4010, 0x101A}, vr(VR::SH), vm_1, "BoardingPassID", "Boarding Pass ID", false},
+    tag_info{dicom_tag{0x4010, 0x101B}, vr(VR::FL), vm_3, "CenterOfMass", "Center of Mass", false},
+    tag_info{dicom_tag{0x4010, 0x101C}, vr(VR::FL), vm_3, "CenterOfPTO", "Center of PTO", false},
+    tag_info{dicom_tag{0x4010, 0x101D}, vr(VR::FL), vm_6_n, "BoundingPolygon", "Bounding Polygon", false},
+    tag_info{dicom_tag{0x4010, 0x101E}, vr(VR::SH), vm_1, "RouteSegmentStartLocationID", "Route Segment Start Location ID", false},
+    tag_info{dicom_tag{0x4010, 0x101F}, vr(VR::SH), vm_1, "RouteSegmentEndLocationID", "Route Segment End Location ID", false},
+    tag_info{dicom_tag{0x4010, 0x1020}, vr(VR::CS), vm_1, "RouteSegmentLocationIDType", "Route Segment Location ID Type", false},
+    tag_info{dicom_tag{0x4010, 0x1021}, vr(VR::CS), vm_1_n, "AbortReason", "Abort Reason", false},
+    tag_info{dicom_tag{0x4010, 0x1023}, vr(VR::FL), vm_1, "VolumeOfPTO", "Volume of PTO", false},
+    tag_info{dicom_tag{0x4010, 0x1024}, vr(VR::CS), vm_1, "AbortFlag", "Abort Flag", false},
+    tag_info{dicom_tag{0x4010, 0x1025}, vr(VR::DT), vm_1, "RouteSegmentStartTime", "Route Segment Start Time", false},
+    tag_info{dicom_tag{0x4010, 0x1026}, vr(VR::DT), vm_1, "RouteSegmentEndTime", "Route Segment End Time", false},
+    tag_info{dicom_tag{0x4010, 0x1027}, vr(VR::CS), vm_1, "TDRType", "TDR Type", false},
+    tag_info{dicom_tag{0x4010, 0x1028}, vr(VR::CS), vm_1, "InternationalRouteSegment", "International Route Segment", false},
+    tag_info{dicom_tag{0x4010, 0x1029}, vr(VR::LO), vm_1_n, "ThreatDetectionAlgorithmAndVersion", "Threat Detection Algorithm and Version", false},
+    tag_info{dicom_tag{0x4010, 0x102A}, vr(VR::SH), vm_1, "AssignedLocation", "Assigned Location", false},
+    tag_info{dicom_tag{0x4010, 0x102B}, vr(VR::DT), vm_1, "AlarmDecisionTime", "Alarm Decision Time", false},
+    tag_info{dicom_tag{0x4010, 0x1031}, vr(VR::CS), vm_1, "AlarmDecision", "Alarm Decision", false},
+    tag_info{dicom_tag{0x4010, 0x1033}, vr(VR::US), vm_1, "NumberOfTotalObjects", "Number of Total Objects", false},
+    tag_info{dicom_tag{0x4010, 0x1034}, vr(VR::US), vm_1, "NumberOfAlarmObjects", "Number of Alarm Objects", false},
+    tag_info{dicom_tag{0x4010, 0x1037}, vr(VR::SQ), vm_1, "PTORepresentationSequence", "PTO Representation Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1038}, vr(VR::SQ), vm_1, "ATDAssessmentSequence", "ATD Assessment Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1039}, vr(VR::CS), vm_1, "TIPType", "TIP Type", false},
+    tag_info{dicom_tag{0x4010, 0x103A}, vr(VR::CS), vm_1, "DICOSVersion", "DICOS Version", false},
+    tag_info{dicom_tag{0x4010, 0x1041}, vr(VR::DT), vm_1, "OOIOwnerCreationTime", "OOI Owner Creation Time", false},
+    tag_info{dicom_tag{0x4010, 0x1042}, vr(VR::CS), vm_1, "OOIType", "OOI Type", false},
+    tag_info{dicom_tag{0x4010, 0x1043}, vr(VR::FL), vm_3, "OOISize", "OOI Size", false},
+    tag_info{dicom_tag{0x4010, 0x1044}, vr(VR::CS), vm_1, "AcquisitionStatus", "Acquisition Status", false},
+    tag_info{dicom_tag{0x4010, 0x1045}, vr(VR::SQ), vm_1, "BasisMaterialsCodeSequence", "Basis Materials Code Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1046}, vr(VR::CS), vm_1, "PhantomType", "Phantom Type", false},
+    tag_info{dicom_tag{0x4010, 0x1047}, vr(VR::SQ), vm_1, "OOIOwnerSequence", "OOI Owner Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1048}, vr(VR::CS), vm_1, "ScanType", "Scan Type", false},
+    tag_info{dicom_tag{0x4010, 0x1051}, vr(VR::LO), vm_1, "ItineraryID", "Itinerary ID", false},
+    tag_info{dicom_tag{0x4010, 0x1052}, vr(VR::SH), vm_1, "ItineraryIDType", "Itinerary ID Type", false},
+    tag_info{dicom_tag{0x4010, 0x1053}, vr(VR::LO), vm_1, "ItineraryIDAssigningAuthority", "Itinerary ID Assigning Authority", false},
+    tag_info{dicom_tag{0x4010, 0x1054}, vr(VR::SH), vm_1, "RouteID", "Route ID", false},
+    tag_info{dicom_tag{0x4010, 0x1055}, vr(VR::SH), vm_1, "RouteIDAssigningAuthority", "Route ID Assigning Authority", false},
+    tag_info{dicom_tag{0x4010, 0x1056}, vr(VR::CS), vm_1, "InboundArrivalType", "Inbound Arrival Type", false},
+    tag_info{dicom_tag{0x4010, 0x1058}, vr(VR::SH), vm_1, "CarrierID", "Carrier ID", false},
+    tag_info{dicom_tag{0x4010, 0x1059}, vr(VR::CS), vm_1, "CarrierIDAssigningAuthority", "Carrier ID Assigning Authority", false},
+    tag_info{dicom_tag{0x4010, 0x1060}, vr(VR::FL), vm_3, "SourceOrientation", "Source Orientation", false},
+    tag_info{dicom_tag{0x4010, 0x1061}, vr(VR::FL), vm_3, "SourcePosition", "Source Position", false},
+    tag_info{dicom_tag{0x4010, 0x1062}, vr(VR::FL), vm_1, "BeltHeight", "Belt Height", false},
+    tag_info{dicom_tag{0x4010, 0x1064}, vr(VR::SQ), vm_1, "AlgorithmRoutingCodeSequence", "Algorithm Routing Code Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1067}, vr(VR::CS), vm_1, "TransportClassification", "Transport Classification", false},
+    tag_info{dicom_tag{0x4010, 0x1068}, vr(VR::LT), vm_1, "OOITypeDescriptor", "OOI Type Descriptor", false},
+    tag_info{dicom_tag{0x4010, 0x1069}, vr(VR::FL), vm_1, "TotalProcessingTime", "Total Processing Time", false},
+    tag_info{dicom_tag{0x4010, 0x106C}, vr(VR::OB), vm_1, "DetectorCalibrationData", "Detector Calibration Data", false},
+    tag_info{dicom_tag{0x4010, 0x106D}, vr(VR::CS), vm_1, "AdditionalScreeningPerformed", "Additional Screening Performed", false},
+    tag_info{dicom_tag{0x4010, 0x106E}, vr(VR::CS), vm_1, "AdditionalInspectionSelectionCriteria", "Additional Inspection Selection Criteria", false},
+    tag_info{dicom_tag{0x4010, 0x106F}, vr(VR::SQ), vm_1, "AdditionalInspectionMethodSequence", "Additional Inspection Method Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1070}, vr(VR::CS), vm_1, "AITDeviceType", "AIT Device Type", false},
+    tag_info{dicom_tag{0x4010, 0x1071}, vr(VR::SQ), vm_1, "QRMeasurementsSequence", "QR Measurements Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1072}, vr(VR::SQ), vm_1, "TargetMaterialSequence", "Target Material Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1073}, vr(VR::FD), vm_1, "SNRThreshold", "SNR Threshold", false},
+    tag_info{dicom_tag{0x4010, 0x1075}, vr(VR::DS), vm_1, "ImageScaleRepresentation", "Image Scale Representation", false},
+    tag_info{dicom_tag{0x4010, 0x1076}, vr(VR::SQ), vm_1, "ReferencedPTOSequence", "Referenced PTO Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1077}, vr(VR::SQ), vm_1, "ReferencedTDRInstanceSequence", "Referenced TDR Instance Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x1078}, vr(VR::ST), vm_1, "PTOLocationDescription", "PTO Location Description", false},
+    tag_info{dicom_tag{0x4010, 0x1079}, vr(VR::SQ), vm_1, "AnomalyLocatorIndicatorSequence", "Anomaly Locator Indicator Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x107A}, vr(VR::FL), vm_3, "AnomalyLocatorIndicator", "Anomaly Locator Indicator", false},
+    tag_info{dicom_tag{0x4010, 0x107B}, vr(VR::SQ), vm_1, "PTORegionSequence", "PTO Region Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x107C}, vr(VR::CS), vm_1, "InspectionSelectionCriteria", "Inspection Selection Criteria", false},
+    tag_info{dicom_tag{0x4010, 0x107D}, vr(VR::SQ), vm_1, "SecondaryInspectionMethodSequence", "Secondary Inspection Method Sequence", false},
+    tag_info{dicom_tag{0x4010, 0x107E}, vr(VR::DS), vm_6, "PRCSToRCSOrientation", "PRCS to RCS Orientation", false},
+    tag_info{dicom_tag{0x4FFE, 0x0001}, vr(VR::SQ), vm_1, "MACParametersSequence", "MAC Parameters Sequence", false},
+    tag_info{dicom_tag{0x5000, 0x0005}, vr(VR::US), vm_1, "CurveDimensions", "Curve Dimensions", true},  // (50xx,0005)
+    tag_info{dicom_tag{0x5000, 0x0010}, vr(VR::US), vm_1, "NumberOfPoints", "Number of Points", true},  // (50xx,0010)
+    tag_info{dicom_tag{0x5000, 0x0020}, vr(VR::CS), vm_1, "TypeOfData", "Type of Data", true},  // (50xx,0020)
+    tag_info{dicom_tag{0x5000, 0x0022}, vr(VR::LO), vm_1, "CurveDescription", "Curve Description", true},  // (50xx,0022)
+    tag_info{dicom_tag{0x5000, 0x0030}, vr(VR::SH), vm_1_n, "AxisUnits", "Axis Units", true},  // (50xx,0030)
+    tag_info{dicom_tag{0x5000, 0x0040}, vr(VR::SH), vm_1_n, "AxisLabels", "Axis Labels", true},  // (50xx,0040)
+    tag_info{dicom_tag{0x5000, 0x0103}, vr(VR::US), vm_1, "DataValueRepresentation", "Data Value Representation", true},  // (50xx,0103)
+    tag_info{dicom_tag{0x5000, 0x0104}, vr(VR::US), vm_1_n, "MinimumCoordinateValue", "Minimum Coordinate Value", true},  // (50xx,0104)
+    tag_info{dicom_tag{0x5000, 0x0105}, vr(VR::US), vm_1_n, "MaximumCoordinateValue", "Maximum Coordinate Value", true},  // (50xx,0105)
+    tag_info{dicom_tag{0x5000, 0x0106}, vr(VR::SH), vm_1_n, "CurveRange", "Curve Range", true},  // (50xx,0106)
+    tag_info{dicom_tag{0x5000, 0x0110}, vr(VR::US), vm_1_n, "CurveDataDescriptor", "Curve Data Descriptor", true},  // (50xx,0110)
+    tag_info{dicom_tag{0x5000, 0x0112}, vr(VR::US), vm_1_n, "CoordinateStartValue", "Coordinate Start Value", true},  // (50xx,0112)
+    tag_info{dicom_tag{0x5000, 0x0114}, vr(VR::US), vm_1_n, "CoordinateStepValue", "Coordinate Step Value", true},  // (50xx,0114)
+    tag_info{dicom_tag{0x5000, 0x1001}, vr(VR::CS), vm_1, "CurveActivationLayer", "Curve Activation Layer", true},  // (50xx,1001)
+    tag_info{dicom_tag{0x5000, 0x2000}, vr(VR::US), vm_1, "AudioType", "Audio Type", true},  // (50xx,2000)
+    tag_info{dicom_tag{0x5000, 0x2002}, vr(VR::US), vm_1, "AudioSampleFormat", "Audio Sample Format", true},  // (50xx,2002)
+    tag_info{dicom_tag{0x5000, 0x2004}, vr(VR::US), vm_1, "NumberOfChannels", "Number of Channels", true},  // (50xx,2004)
+    tag_info{dicom_tag{0x5000, 0x2006}, vr(VR::UL), vm_1, "NumberOfSamples", "Number of Samples", true},  // (50xx,2006)
+    tag_info{dicom_tag{0x5000, 0x2008}, vr(VR::UL), vm_1, "SampleRate", "Sample Rate", true},  // (50xx,2008)
+    tag_info{dicom_tag{0x5000, 0x200A}, vr(VR::UL), vm_1, "TotalTime", "Total Time", true},  // (50xx,200A)
+    tag_info{dicom_tag{0x5000, 0x200C}, vr(VR::OW), vm_1, "AudioSampleData", "Audio Sample Data", true},  // (50xx,200C)
+    tag_info{dicom_tag{0x5000, 0x200E}, vr(VR::LT), vm_1, "AudioComments", "Audio Comments", true},  // (50xx,200E)
+    tag_info{dicom_tag{0x5000, 0x2500}, vr(VR::LO), vm_1, "CurveLabel", "Curve Label", true},  // (50xx,2500)
+    tag_info{dicom_tag{0x5000, 0x2600}, vr(VR::SQ), vm_1, "CurveReferencedOverlaySequence", "Curve Referenced Overlay Sequence", true},  // (50xx,2600)
+    tag_info{dicom_tag{0x5000, 0x2610}, vr(VR::US), vm_1, "CurveReferencedOverlayGroup", "Curve Referenced Overlay Group", true},  // (50xx,2610)
+    tag_info{dicom_tag{0x5000, 0x3000}, vr(VR::OW), vm_1, "CurveData", "Curve Data", true},  // (50xx,3000)
+    tag_info{dicom_tag{0x5200, 0x9229}, vr(VR::SQ), vm_1, "SharedFunctionalGroupsSequence", "Shared Functional Groups Sequence", false},
+    tag_info{dicom_tag{0x5200, 0x9230}, vr(VR::SQ), vm_1, "PerFrameFunctionalGroupsSequence", "Per-Frame Functional Groups Sequence", false},
+    tag_info{dicom_tag{0x5400, 0x0100}, vr(VR::SQ), vm_1, "WaveformSequence", "Waveform Sequence", false},
+    tag_info{dicom_tag{0x5400, 0x0110}, vr(VR::OW), vm_1, "ChannelMinimumValue", "Channel Minimum Value", false},
+    tag_info{dicom_tag{0x5400, 0x0112}, vr(VR::OW), vm_1, "ChannelMaximumValue", "Channel Maximum Value", false},
+    tag_info{dicom_tag{0x5400, 0x1004}, vr(VR::US), vm_1, "WaveformBitsAllocated", "Waveform Bits Allocated", false},
+    tag_info{dicom_tag{0x5400, 0x1006}, vr(VR::CS), vm_1, "WaveformSampleInterpretation", "Waveform Sample Interpretation", false},
+    tag_info{dicom_tag{0x5400, 0x100A}, vr(VR::OW), vm_1, "WaveformPaddingValue", "Waveform Padding Value", false},
+    tag_info{dicom_tag{0x5400, 0x1010}, vr(VR::OW), vm_1, "WaveformData", "Waveform Data", false},
+    tag_info{dicom_tag{0x5600, 0x0010}, vr(VR::OF), vm_1, "FirstOrderPhaseCorrectionAngle", "First Order Phase Correction Angle", false},
+    tag_info{dicom_tag{0x5600, 0x0020}, vr(VR::OF), vm_1, "SpectroscopyData", "Spectroscopy Data", false},
+    tag_info{dicom_tag{0x6000, 0x0010}, vr(VR::US), vm_1, "OverlayRows", "Overlay Rows", false},  // (60xx,0010)
+    tag_info{dicom_tag{0x6000, 0x0011}, vr(VR::US), vm_1, "OverlayColumns", "Overlay Columns", false},  // (60xx,0011)
+    tag_info{dicom_tag{0x6000, 0x0012}, vr(VR::US), vm_1, "OverlayPlanes", "Overlay Planes", true},  // (60xx,0012)
+    tag_info{dicom_tag{0x6000, 0x0015}, vr(VR::IS), vm_1, "NumberOfFramesInOverlay", "Number of Frames in Overlay", false},  // (60xx,0015)
+    tag_info{dicom_tag{0x6000, 0x0022}, vr(VR::LO), vm_1, "OverlayDescription", "Overlay Description", false},  // (60xx,0022)
+    tag_info{dicom_tag{0x6000, 0x0040}, vr(VR::CS), vm_1, "OverlayType", "Overlay Type", false},  // (60xx,0040)
+    tag_info{dicom_tag{0x6000, 0x0045}, vr(VR::LO), vm_1, "OverlaySubtype", "Overlay Subtype", false},  // (60xx,0045)
+    tag_info{dicom_tag{0x6000, 0x0050}, vr(VR::SS), vm_2, "OverlayOrigin", "Overlay Origin", false},  // (60xx,0050)
+    tag_info{dicom_tag{0x6000, 0x0051}, vr(VR::US), vm_1, "ImageFrameOrigin", "Image Frame Origin", false},  // (60xx,0051)
+    tag_info{dicom_tag{0x6000, 0x0052}, vr(VR::US), vm_1, "OverlayPlaneOrigin", "Overlay Plane Origin", true},  // (60xx,0052)
+    tag_info{dicom_tag{0x6000, 0x0060}, vr(VR::CS), vm_1, "OverlayCompressionCode", "Overlay Compression Code", true},  // (60xx,0060)
+    tag_info{dicom_tag{0x6000, 0x0061}, vr(VR::SH), vm_1, "OverlayCompressionOriginator", "Overlay Compression Originator", true},  // (60xx,0061)
+    tag_info{dicom_tag{0x6000, 0x0062}, vr(VR::SH), vm_1, "OverlayCompressionLabel", "Overlay Compression Label", true},  // (60xx,0062)
+    tag_info{dicom_tag{0x6000, 0x0063}, vr(VR::CS), vm_1, "OverlayCompressionDescription", "Overlay Compression Description", true},  // (60xx,0063)
+    tag_info{dicom_tag{0x6000, 0x0066}, vr(VR::AT), vm_1_n, "OverlayCompressionStepPointers", "Overlay Compression Step Pointers", true},  // (60xx,0066)
+    tag_info{dicom_tag{0x6000, 0x0068}, vr(VR::US), vm_1, "OverlayRepeatInterval", "Overlay Repeat Interval", true},  // (60xx,0068)
+    tag_info{dicom_tag{0x6000, 0x0069}, vr(VR::US), vm_1, "OverlayBitsGrouped", "Overlay Bits Grouped", true},  // (60xx,0069)
+    tag_info{dicom_tag{0x6000, 0x0100}, vr(VR::US), vm_1, "OverlayBitsAllocated", "Overlay Bits Allocated", false},  // (60xx,0100)
+    tag_info{dicom_tag{0x6000, 0x0102}, vr(VR::US), vm_1, "OverlayBitPosition", "Overlay Bit Position", false},  // (60xx,0102)
+    tag_info{dicom_tag{0x6000, 0x0110}, vr(VR::CS), vm_1, "OverlayFormat", "Overlay Format", true},  // (60xx,0110)
+    tag_info{dicom_tag{0x6000, 0x0200}, vr(VR::US), vm_1, "OverlayLocation", "Overlay Location", true},  // (60xx,0200)
+    tag_info{dicom_tag{0x6000, 0x0800}, vr(VR::CS), vm_1_n, "OverlayCodeLabel", "Overlay Code Label", true},  // (60xx,0800)
+    tag_info{dicom_tag{0x6000, 0x0802}, vr(VR::US), vm_1, "OverlayNumberOfTables", "Overlay Number of Tables", true},  // (60xx,0802)
+    tag_info{dicom_tag{0x6000, 0x0803}, vr(VR::AT), vm_1_n, "OverlayCodeTableLocation", "Overlay Code Table Location", true},  // (60xx,0803)
+    tag_info{dicom_tag{0x6000, 0x0804}, vr(VR::US), vm_1, "OverlayBitsForCodeWord", "Overlay Bits For Code Word", true},  // (60xx,0804)
+    tag_info{dicom_tag{0x6000, 0x1001}, vr(VR::CS), vm_1, "OverlayActivationLayer", "Overlay Activation Layer", false},  // (60xx,1001)
+    tag_info{dicom_tag{0x6000, 0x1100}, vr(VR::US), vm_1, "OverlayDescriptorGray", "Overlay Descriptor - Gray", true},  // (60xx,1100)
+    tag_info{dicom_tag{0x6000, 0x1101}, vr(VR::US), vm_1, "OverlayDescriptorRed", "Overlay Descriptor - Red", true},  // (60xx,1101)
+    tag_info{dicom_tag{0x6000, 0x1102}, vr(VR::US), vm_1, "OverlayDescriptorGreen", "Overlay Descriptor - Green", true},  // (60xx,1102)
+    tag_info{dicom_tag{0x6000, 0x1103}, vr(VR::US), vm_1, "OverlayDescriptorBlue", "Overlay Descriptor - Blue", true},  // (60xx,1103)
+    tag_info{dicom_tag{0x6000, 0x1200}, vr(VR::US), vm_1_n, "OverlaysGray", "Overlays - Gray", true},  // (60xx,1200)
+    tag_info{dicom_tag{0x6000, 0x1201}, vr(VR::US), vm_1_n, "OverlaysRed", "Overlays - Red", true},  // (60xx,1201)
+    tag_info{dicom_tag{0x6000, 0x1202}, vr(VR::US), vm_1_n, "OverlaysGreen", "Overlays - Green", true},  // (60xx,1202)
+    tag_info{dicom_tag{0x6000, 0x1203}, vr(VR::US), vm_1_n, "OverlaysBlue", "Overlays - Blue", true},  // (60xx,1203)
+    tag_info{dicom_tag{0x6000, 0x1301}, vr(VR::IS), vm_1, "ROIArea", "ROI Area", false},  // (60xx,1301)
+    tag_info{dicom_tag{0x6000, 0x1302}, vr(VR::DS), vm_1, "ROIMean", "ROI Mean", false},  // (60xx,1302)
+    tag_info{dicom_tag{0x6000, 0x1303}, vr(VR::DS), vm_1, "ROIStandardDeviation", "ROI Standard Deviation", false},  // (60xx,1303)
+    tag_info{dicom_tag{0x6000, 0x1500}, vr(VR::LO), vm_1, "OverlayLabel", "Overlay Label", false},  // (60xx,1500)
+    tag_info{dicom_tag{0x6000, 0x3000}, vr(VR::OW), vm_1, "OverlayData", "Overlay Data", false},  // (60xx,3000)
+    tag_info{dicom_tag{0x6000, 0x4000}, vr(VR::LT), vm_1, "OverlayComments", "Overlay Comments", true},  // (60xx,4000)
+    tag_info{dicom_tag{0x7F00, 0x0010}, vr(VR::OW), vm_1, "VariablePixelData", "Variable Pixel Data", true},  // (7Fxx,0010)
+    tag_info{dicom_tag{0x7F00, 0x0011}, vr(VR::US), vm_1, "VariableNextDataGroup", "Variable Next Data Group", true},  // (7Fxx,0011)
+    tag_info{dicom_tag{0x7F00, 0x0020}, vr(VR::OW), vm_1, "VariableCoefficientsSDVN", "Variable Coefficients SDVN", true},  // (7Fxx,0020)
+    tag_info{dicom_tag{0x7F00, 0x0030}, vr(VR::OW), vm_1, "VariableCoefficientsSDHN", "Variable Coefficients SDHN", true},  // (7Fxx,0030)
+    tag_info{dicom_tag{0x7F00, 0x0040}, vr(VR::OW), vm_1, "VariableCoefficientsSDDN", "Variable Coefficients SDDN", true},  // (7Fxx,0040)
+    tag_info{dicom_tag{0x7FE0, 0x0001}, vr(VR::OV), vm_1, "ExtendedOffsetTable", "Extended Offset Table", false},
+    tag_info{dicom_tag{0x7FE0, 0x0002}, vr(VR::OV), vm_1, "ExtendedOffsetTableLengths", "Extended Offset Table Lengths", false},
+    tag_info{dicom_tag{0x7FE0, 0x0003}, vr(VR::UV), vm_1, "EncapsulatedPixelDataValueTotalLength", "Encapsulated Pixel Data Value Total Length", false},
+    tag_info{dicom_tag{0x7FE0, 0x0008}, vr(VR::OF), vm_1, "FloatPixelData", "Float Pixel Data", false},
+    tag_info{dicom_tag{0x7FE0, 0x0009}, vr(VR::OD), vm_1, "DoubleFloatPixelData", "Double Float Pixel Data", false},
     tag_info{dicom_tag{0x7FE0, 0x0010}, vr(VR::OW), vm_1, "PixelData", "Pixel Data", false},
-    tag_info{dicom_tag{0x7FE0, 0x0020}, vr(VR::OW), vm_1, "CoefficientsSDVN", "Coefficients SDVN", true},  // Retired
-    tag_info{dicom_tag{0x7FE0, 0x0030}, vr(VR::OW), vm_1, "CoefficientsSDHN", "Coefficients SDHN", true},  // Retired
-    tag_info{dicom_tag{0x7FE0, 0x0040}, vr(VR::OW), vm_1, "CoefficientsSDDN", "Coefficients SDDN", true},  // Retired
-
-    // ========================================================================
-    // Item Delimiters (0xFFFE)
-    // ========================================================================
+    tag_info{dicom_tag{0x7FE0, 0x0020}, vr(VR::OW), vm_1, "CoefficientsSDVN", "Coefficients SDVN", true},
+    tag_info{dicom_tag{0x7FE0, 0x0030}, vr(VR::OW), vm_1, "CoefficientsSDHN", "Coefficients SDHN", true},
+    tag_info{dicom_tag{0x7FE0, 0x0040}, vr(VR::OW), vm_1, "CoefficientsSDDN", "Coefficients SDDN", true},
+    tag_info{dicom_tag{0xFFFA, 0xFFFA}, vr(VR::SQ), vm_1, "DigitalSignaturesSequence", "Digital Signatures Sequence", false},
+    tag_info{dicom_tag{0xFFFC, 0xFFFC}, vr(VR::OB), vm_1, "DataSetTrailingPadding", "Data Set Trailing Padding", false},
     tag_info{dicom_tag{0xFFFE, 0xE000}, vr(VR::UN), vm_1, "Item", "Item", false},
     tag_info{dicom_tag{0xFFFE, 0xE00D}, vr(VR::UN), vm_1, "ItemDelimitationItem", "Item Delimitation Item", false},
     tag_info{dicom_tag{0xFFFE, 0xE0DD}, vr(VR::UN), vm_1, "SequenceDelimitationItem", "Sequence Delimitation Item", false},
 }};
+
+/// Repeating-group tags: a tag matches when (tag & mask) == value
+struct repeating_tag {
+    uint32_t mask;
+    uint32_t value;
+    uint16_t index;
+};
+
+constexpr std::array<repeating_tag, 88> repeating_tags = {{
+    {0xFFFFFF0F, 0x00280400, 2137},
+    {0xFFFFFF0F, 0x00280401, 2138},
+    {0xFFFFFF0F, 0x00280402, 2139},
+    {0xFFFFFF0F, 0x00280403, 2140},
+    {0xFFFFFF0F, 0x00280800, 2150},
+    {0xFFFFFF0F, 0x00280802, 2151},
+    {0xFFFFFF0F, 0x00280803, 2152},
+    {0xFFFFFF0F, 0x00280804, 2153},
+    {0xFFFFFF0F, 0x00280808, 2154},
+    {0xFF01FFFF, 0x50000005, 5083},
+    {0xFF01FFFF, 0x50000010, 5084},
+    {0xFF01FFFF, 0x50000020, 5085},
+    {0xFF01FFFF, 0x50000022, 5086},
+    {0xFF01FFFF, 0x50000030, 5087},
+    {0xFF01FFFF, 0x50000040, 5088},
+    {0xFF01FFFF, 0x50000103, 5089},
+    {0xFF01FFFF, 0x50000104, 5090},
+    {0xFF01FFFF, 0x50000105, 5091},
+    {0xFF01FFFF, 0x50000106, 5092},
+    {0xFF01FFFF, 0x50000110, 5093},
+    {0xFF01FFFF, 0x50000112, 5094},
+    {0xFF01FFFF, 0x50000114, 5095},
+    {0xFF01FFFF, 0x50001001, 5096},
+    {0xFF01FFFF, 0x50002000, 5097},
+    {0xFF01FFFF, 0x50002002, 5098},
+    {0xFF01FFFF, 0x50002004, 5099},
+    {0xFF01FFFF, 0x50002006, 5100},
+    {0xFF01FFFF, 0x50002008, 5101},
+    {0xFF01FFFF, 0x5000200A, 5102},
+    {0xFF01FFFF, 0x5000200C, 5103},
+    {0xFF01FFFF, 0x5000200E, 5104},
+    {0xFF01FFFF, 0x50002500, 5105},
+    {0xFF01FFFF, 0x50002600, 5106},
+    {0xFF01FFFF, 0x50002610, 5107},
+    {0xFF01FFFF, 0x50003000, 5108},
+    {0xFF01FFFF, 0x60000010, 5120},
+    {0xFF01FFFF, 0x60000011, 5121},
+    {0xFF01FFFF, 0x60000012, 5122},
+    {0xFF01FFFF, 0x60000015, 5123},
+    {0xFF01FFFF, 0x60000022, 5124},
+    {0xFF01FFFF, 0x60000040, 5125},
+    {0xFF01FFFF, 0x60000045, 5126},
+    {0xFF01FFFF, 0x60000050, 5127},
+    {0xFF01FFFF, 0x60000051, 5128},
+    {0xFF01FFFF, 0x60000052, 5129},
+    {0xFF01FFFF, 0x60000060, 5130},
+    {0xFF01FFFF, 0x60000061, 5131},
+    {0xFF01FFFF, 0x60000062, 5132},
+    {0xFF01FFFF, 0x60000063, 5133},
+    {0xFF01FFFF, 0x60000066, 5134},
+    {0xFF01FFFF, 0x60000068, 5135},
+    {0xFF01FFFF, 0x60000069, 5136},
+    {0xFF01FFFF, 0x60000100, 5137},
+    {0xFF01FFFF, 0x60000102, 5138},
+    {0xFF01FFFF, 0x60000110, 5139},
+    {0xFF01FFFF, 0x60000200, 5140},
+    {0xFF01FFFF, 0x60000800, 5141},
+    {0xFF01FFFF, 0x60000802, 5142},
+    {0xFF01FFFF, 0x60000803, 5143},
+    {0xFF01FFFF, 0x60000804, 5144},
+    {0xFF01FFFF, 0x60001001, 5145},
+    {0xFF01FFFF, 0x60001100, 5146},
+    {0xFF01FFFF, 0x60001101, 5147},
+    {0xFF01FFFF, 0x60001102, 5148},
+    {0xFF01FFFF, 0x60001103, 5149},
+    {0xFF01FFFF, 0x60001200, 5150},
+    {0xFF01FFFF, 0x60001201, 5151},
+    {0xFF01FFFF, 0x60001202, 5152},
+    {0xFF01FFFF, 0x60001203, 5153},
+    {0xFF01FFFF, 0x60001301, 5154},
+    {0xFF01FFFF, 0x60001302, 5155},
+    {0xFF01FFFF, 0x60001303, 5156},
+    {0xFF01FFFF, 0x60001500, 5157},
+    {0xFF01FFFF, 0x60003000, 5158},
+    {0xFF01FFFF, 0x60004000, 5159},
+    {0xFF01FFFF, 0x7F000010, 5160},
+    {0xFF01FFFF, 0x7F000011, 5161},
+    {0xFF01FFFF, 0x7F000020, 5162},
+    {0xFF01FFFF, 0x7F000030, 5163},
+    {0xFF01FFFF, 0x7F000040, 5164},
+    {0xFFFFFF00, 0x00203100, 1720},
+    {0xFFFF000F, 0x10000000, 3759},
+    {0xFFFF000F, 0x10000001, 3760},
+    {0xFFFF000F, 0x10000002, 3761},
+    {0xFFFF000F, 0x10000003, 3762},
+    {0xFFFF000F, 0x10000004, 3763},
+    {0xFFFF000F, 0x10000005, 3764},
+    {0xFFFF0000, 0x10100000, 3765},
+}};
+
+// Perfect hash by tag: displacement per bucket, then entry index + 1
+constexpr std::array<uint32_t, 2048> tag_displacements = {{
+    0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x1F4B8CEF, 0x4C081DBF, 0xDB408C9D, 0x3CD6E3F3, 0x92CA2F0E,
+    0x92CA2F0E, 0x3CD6E3F3, 0x91783BB0, 0x487981AB, 0x1B147DCC, 0x4C081DBF, 0x3CD6E3F3, 0x3CD6E3F3,
+    0x1B147DCC, 0x92CA2F0E, 0x65CBDD54, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0xDB408C9D,
+    0x92CA2F0E, 0x487981AB, 0x1B147DCC, 0x1B147DCC, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF,
+    0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E,
+    0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3,
+    0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E,
+    0x1B147DCC, 0x487981AB, 0x92CA2F0E, 0xDB408C9D, 0x487981AB, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x00000000,
+    0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0x4C081DBF, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E,
+    0x487981AB, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3,
+    0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x00000000, 0x1B147DCC,
+    0x92CA2F0E, 0x1B147DCC, 0xDB408C9D, 0x92CA2F0E, 0x4C081DBF, 0x1B147DCC, 0x00000000, 0x3CD6E3F3,
+    0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0xD83072E5, 0x92CA2F0E, 0x4C081DBF, 0x1B147DCC,
+    0x3CD6E3F3, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x92CA2F0E, 0x3CD6E3F3,
+    0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3,
+    0x78BC1B8F, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF,
+    0x4C081DBF, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x3CD6E3F3, 0x92CA2F0E,
+    0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x1F4B8CEF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x78BC1B8F, 0x78BC1B8F,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF,
+    0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB,
+    0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x4C081DBF, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x00000000, 0x1B147DCC, 0x1B147DCC, 0x00000000, 0x00000000, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E,
+    0xDB408C9D, 0x3CD6E3F3, 0x487981AB, 0x92CA2F0E, 0x00000000, 0x487981AB, 0x92CA2F0E, 0x3CD6E3F3,
+    0x92CA2F0E, 0x00000000, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E,
+    0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x4C081DBF,
+    0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x00000000,
+    0x92CA2F0E, 0xDB408C9D, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E,
+    0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3,
+    0x00000000, 0x1B147DCC, 0x00000000, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x4C081DBF, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0x91783BB0,
+    0x3CD6E3F3, 0x487981AB, 0x65CBDD54, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x78BC1B8F, 0x3CD6E3F3, 0x00000000, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF,
+    0x1B147DCC, 0xDB408C9D, 0x78BC1B8F, 0x1B147DCC, 0x487981AB, 0x3CD6E3F3, 0x00000000, 0xDB408C9D,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x0231739B, 0x3CD6E3F3, 0x487981AB, 0x3CD6E3F3,
+    0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0x00000000, 0x487981AB, 0x3CD6E3F3,
+    0xD83072E5, 0x3CD6E3F3, 0xDB408C9D, 0x4C081DBF, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF,
+    0x1F4B8CEF, 0x487981AB, 0x4C081DBF, 0x92CA2F0E, 0x4C081DBF, 0xD83072E5, 0x487981AB, 0x3CD6E3F3,
+    0x00000000, 0x78BC1B8F, 0xDB408C9D, 0xD83072E5, 0x92CA2F0E, 0x00000000, 0x78BC1B8F, 0x4C081DBF,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x3CD6E3F3, 0xDB408C9D, 0x1B147DCC,
+    0x65CBDD54, 0x1B147DCC, 0xD83072E5, 0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0x1B147DCC, 0x92CA2F0E,
+    0x3CD6E3F3, 0xDB408C9D, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x00000000, 0x3CD6E3F3, 0x3CD6E3F3, 0x00000000, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x00000000,
+    0x487981AB, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x91783BB0, 0x3CD6E3F3, 0x92CA2F0E,
+    0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x487981AB, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E,
+    0x92CA2F0E, 0x78BC1B8F, 0x92CA2F0E, 0x1B147DCC, 0xD83072E5, 0xDB408C9D, 0x92CA2F0E, 0x4C081DBF,
+    0x487981AB, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC, 0x4C081DBF,
+    0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0xD83072E5, 0x3CD6E3F3,
+    0x92CA2F0E, 0x65CBDD54, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x78BC1B8F, 0x92CA2F0E,
+    0x92CA2F0E, 0xDB408C9D, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x00000000,
+    0x92CA2F0E, 0xDB408C9D, 0x3CD6E3F3, 0x4C081DBF, 0x00000000, 0x1B147DCC, 0x1F4B8CEF, 0x3CD6E3F3,
+    0x3CD6E3F3, 0x92CA2F0E, 0x1F4B8CEF, 0x00000000, 0x92CA2F0E, 0xD83072E5, 0x92CA2F0E, 0x00000000,
+    0x92CA2F0E, 0x487981AB, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x487981AB, 0x78BC1B8F,
+    0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x91783BB0, 0x00000000, 0x92CA2F0E, 0x92CA2F0E,
+    0x3CD6E3F3, 0x00000000, 0x3CD6E3F3, 0x1B147DCC, 0x78BC1B8F, 0x92CA2F0E, 0x78BC1B8F, 0x3CD6E3F3,
+    0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x91783BB0, 0x4C081DBF, 0x92CA2F0E, 0x1F4B8CEF, 0x487981AB,
+    0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x00000000, 0x4C081DBF, 0x3CD6E3F3, 0x1B147DCC,
+    0x487981AB, 0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000,
+    0x3CD6E3F3, 0x92CA2F0E, 0x487981AB, 0x78BC1B8F, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC,
+    0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x1B147DCC, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x010B6880, 0x1B147DCC, 0x487981AB, 0x78BC1B8F, 0xD83072E5,
+    0x92CA2F0E, 0x65CBDD54, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x487981AB, 0x92CA2F0E,
+    0x1F4B8CEF, 0xDB408C9D, 0x4C081DBF, 0x3CD6E3F3, 0x65CBDD54, 0x4C081DBF, 0x487981AB, 0x92CA2F0E,
+    0x1B147DCC, 0xDB408C9D, 0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E,
+    0x3CD6E3F3, 0x92CA2F0E, 0x487981AB, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x78BC1B8F, 0x78BC1B8F,
+    0x1B147DCC, 0x487981AB, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x78BC1B8F, 0x3CD6E3F3,
+    0x00000000, 0x00000000, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x4C081DBF,
+    0x3CD6E3F3, 0x4C081DBF, 0x487981AB, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x00000000,
+    0x0231739B, 0x3CD6E3F3, 0x1B147DCC, 0x3CD6E3F3, 0x00000000, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x0231739B, 0x3CD6E3F3, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC,
+    0xB42BC0B0, 0x92CA2F0E, 0x1B147DCC, 0x487981AB, 0x487981AB, 0x92CA2F0E, 0x4C081DBF, 0x1B147DCC,
+    0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000,
+    0x92CA2F0E, 0x00000000, 0xDB408C9D, 0x65CBDD54, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3,
+    0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x1B147DCC, 0x3CD6E3F3,
+    0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x4C081DBF, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E,
+    0x00000000, 0x92CA2F0E, 0x487981AB, 0x1B147DCC, 0x1B147DCC, 0x3CD6E3F3, 0x487981AB, 0x92CA2F0E,
+    0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x1F4B8CEF, 0x4C081DBF, 0x92CA2F0E, 0x1B147DCC, 0x4C081DBF,
+    0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x1F4B8CEF, 0x92CA2F0E, 0x92CA2F0E, 0xD83072E5, 0x92CA2F0E,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0xDB408C9D, 0x1B147DCC,
+    0x4C081DBF, 0x78BC1B8F, 0x1B147DCC, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF,
+    0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x1B147DCC, 0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x3CD6E3F3, 0x4C081DBF, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0xD83072E5,
+    0x1B147DCC, 0xD83072E5, 0x1B147DCC, 0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x1B147DCC,
+    0x00000000, 0x3CD6E3F3, 0x78BC1B8F, 0x92CA2F0E, 0x487981AB, 0x487981AB, 0x91783BB0, 0x4C081DBF,
+    0x92CA2F0E, 0x92CA2F0E, 0x1F4B8CEF, 0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC, 0x1B147DCC, 0x92CA2F0E,
+    0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x78BC1B8F, 0x65CBDD54, 0x78BC1B8F,
+    0x78BC1B8F, 0x4C081DBF, 0x487981AB, 0x2AA96DD0, 0xDB408C9D, 0x00000000, 0x92CA2F0E, 0x487981AB,
+    0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x0231739B, 0x4C081DBF, 0x487981AB,
+    0x487981AB, 0xD83072E5, 0x78BC1B8F, 0xB42BC0B0, 0x3CD6E3F3, 0xDB408C9D, 0x00000000, 0x3CD6E3F3,
+    0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x79F70494, 0x92CA2F0E, 0x00000000, 0x92CA2F0E,
+    0x91783BB0, 0x92CA2F0E, 0x92CA2F0E, 0x65CBDD54, 0x487981AB, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC,
+    0x92CA2F0E, 0x00000000, 0x3CD6E3F3, 0xDB408C9D, 0x3CD6E3F3, 0x00000000, 0x91783BB0, 0x3CD6E3F3,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x3CD6E3F3, 0x92CA2F0E, 0x65CBDD54, 0x4C081DBF,
+    0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E,
+    0x487981AB, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3,
+    0x92CA2F0E, 0x010B6880, 0x3CD6E3F3, 0x1B147DCC, 0x1B147DCC, 0x65CBDD54, 0x0231739B, 0x1B147DCC,
+    0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x487981AB, 0x1B147DCC, 0x92CA2F0E,
+    0x00000000, 0x92CA2F0E, 0x4C081DBF, 0x65CBDD54, 0xD83072E5, 0x92CA2F0E, 0x00000000, 0x3CD6E3F3,
+    0xDB408C9D, 0x00000000, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x487981AB, 0x65CBDD54, 0x92CA2F0E,
+    0xD83072E5, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x78BC1B8F, 0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC,
+    0x92CA2F0E, 0x1B147DCC, 0x4C081DBF, 0x00000000, 0x1B147DCC, 0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC,
+    0x65CBDD54, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E,
+    0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x487981AB, 0x3CD6E3F3, 0x3CD6E3F3,
+    0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x487981AB, 0x3CD6E3F3,
+    0x1B147DCC, 0x1B147DCC, 0xD83072E5, 0x4C081DBF, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x78BC1B8F,
+    0x4C081DBF, 0xDB408C9D, 0x00000000, 0x010B6880, 0x92CA2F0E, 0x00000000, 0x65CBDD54, 0x4C081DBF,
+    0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E,
+    0x4C081DBF, 0x487981AB, 0x00000000, 0x1B147DCC, 0x3CD6E3F3, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E,
+    0x00000000, 0x3CD6E3F3, 0x3CD6E3F3, 0x487981AB, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x91783BB0, 0xDB408C9D, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0xD83072E5, 0x4C081DBF, 0x1B147DCC,
+    0x92CA2F0E, 0xDB408C9D, 0x3CD6E3F3, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC,
+    0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x1B147DCC, 0x4C081DBF, 0x00000000, 0x92CA2F0E,
+    0x3CD6E3F3, 0x4C081DBF, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3,
+    0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x1B147DCC,
+    0x78BC1B8F, 0xDB408C9D, 0x4C081DBF, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x4C081DBF, 0x00000000,
+    0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000,
+    0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x91783BB0, 0x92CA2F0E, 0xD83072E5, 0x00000000,
+    0x00000000, 0x1B147DCC, 0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E,
+    0x92CA2F0E, 0x487981AB, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x4C081DBF,
+    0xD83072E5, 0x78BC1B8F, 0x92CA2F0E, 0x92CA2F0E, 0x65CBDD54, 0x3CD6E3F3, 0x3CD6E3F3, 0xDB408C9D,
+    0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0xE411DDC1, 0x487981AB, 0x92CA2F0E, 0x487981AB,
+    0x1B147DCC, 0xB42BC0B0, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0x92CA2F0E,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x1B147DCC, 0x1B147DCC, 0x1B147DCC,
+    0x3CD6E3F3, 0x65CBDD54, 0x92CA2F0E, 0x65CBDD54, 0x3CD6E3F3, 0x00000000, 0x487981AB, 0x4C081DBF,
+    0x1B147DCC, 0x92CA2F0E, 0x4C081DBF, 0xDB408C9D, 0x0231739B, 0x92CA2F0E, 0x3CD6E3F3, 0xDB408C9D,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x1B147DCC, 0x3CD6E3F3, 0x487981AB,
+    0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0x1B147DCC,
+    0x3CD6E3F3, 0x00000000, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x78BC1B8F, 0x1B147DCC, 0x78BC1B8F,
+    0xDB408C9D, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0xDB408C9D, 0x92CA2F0E,
+    0x78BC1B8F, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0xD83072E5,
+    0x92CA2F0E, 0x487981AB, 0x487981AB, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x4C081DBF, 0x00000000, 0x92CA2F0E, 0x78BC1B8F, 0x4C081DBF, 0x00000000, 0x4C081DBF, 0x92CA2F0E,
+    0x3CD6E3F3, 0x1F4B8CEF, 0x487981AB, 0x65CBDD54, 0x00000000, 0x78BC1B8F, 0xDB408C9D, 0x487981AB,
+    0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x1F4B8CEF,
+    0x4C081DBF, 0x4C081DBF, 0x487981AB, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3,
+    0x1B147DCC, 0x487981AB, 0x1B147DCC, 0x92CA2F0E, 0xDB408C9D, 0xD83072E5, 0x3CD6E3F3, 0x1F4B8CEF,
+    0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x78BC1B8F, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3,
+    0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0xDB408C9D, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E,
+    0x92CA2F0E, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x1B147DCC,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0xD83072E5, 0x3CD6E3F3, 0x92CA2F0E,
+    0x92CA2F0E, 0x4C081DBF, 0x0231739B, 0x00000000, 0x1B147DCC, 0x00000000, 0x00000000, 0x4C081DBF,
+    0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC,
+    0x3CD6E3F3, 0x4C081DBF, 0x1B147DCC, 0xD83072E5, 0x92CA2F0E, 0x1B147DCC, 0xDB408C9D, 0x4C081DBF,
+    0x1B147DCC, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0xE2AD51BA, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x4C081DBF, 0x487981AB, 0x1B147DCC,
+    0x00000000, 0x92CA2F0E, 0x2AA96DD0, 0x92CA2F0E, 0x4C081DBF, 0x00000000, 0x92CA2F0E, 0x1B147DCC,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x487981AB, 0x1B147DCC, 0x4C081DBF,
+    0x00000000, 0x487981AB, 0x3CD6E3F3, 0x4C081DBF, 0x487981AB, 0x3CD6E3F3, 0x91783BB0, 0x92CA2F0E,
+    0x00000000, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x487981AB, 0x92CA2F0E, 0x78BC1B8F, 0x3CD6E3F3,
+    0x3CD6E3F3, 0x00000000, 0x00000000, 0x00000000, 0x3CD6E3F3, 0x487981AB, 0x1B147DCC, 0x4C081DBF,
+    0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0xD83072E5, 0x92CA2F0E, 0xDB408C9D, 0x487981AB,
+    0x487981AB, 0x3CD6E3F3, 0x00000000, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x00000000, 0x1B147DCC,
+    0x79F70494, 0x3CD6E3F3, 0x3CD6E3F3, 0x487981AB, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC,
+    0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x487981AB, 0x487981AB, 0x1B147DCC, 0x1B147DCC,
+    0xDB408C9D, 0x487981AB, 0x3CD6E3F3, 0x91783BB0, 0x487981AB, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3,
+    0x00000000, 0x4C081DBF, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x4C081DBF, 0x1B147DCC, 0x1B147DCC,
+    0x3CD6E3F3, 0x1B147DCC, 0x4C081DBF, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x487981AB, 0x91783BB0,
+    0x1F4B8CEF, 0x3CD6E3F3, 0x3CD6E3F3, 0x00000000, 0x3CD6E3F3, 0xDB408C9D, 0x78BC1B8F, 0x3CD6E3F3,
+    0x92CA2F0E, 0x1B147DCC, 0xD83072E5, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x487981AB,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3,
+    0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0xDB408C9D,
+    0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x0231739B,
+    0x1B147DCC, 0x00000000, 0xD83072E5, 0x1B147DCC, 0x00000000, 0x92CA2F0E, 0x00000000, 0x92CA2F0E,
+    0x92CA2F0E, 0xDB408C9D, 0x00000000, 0xA4523835, 0x92CA2F0E, 0x65CBDD54, 0x1B147DCC, 0x92CA2F0E,
+    0x4C081DBF, 0xDB408C9D, 0x1B147DCC, 0xDB408C9D, 0xDB408C9D, 0x00000000, 0x92CA2F0E, 0x92CA2F0E,
+    0x487981AB, 0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3,
+    0x2AA96DD0, 0x92CA2F0E, 0x92CA2F0E, 0xE2AD51BA, 0x92CA2F0E, 0x78BC1B8F, 0x92CA2F0E, 0x1B147DCC,
+    0x78BC1B8F, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0xD83072E5, 0x487981AB, 0x3CD6E3F3, 0x00000000,
+    0x78BC1B8F, 0x00000000, 0x3CD6E3F3, 0x487981AB, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC,
+    0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000,
+    0x1B147DCC, 0x92CA2F0E, 0x487981AB, 0x65CBDD54, 0x487981AB, 0xDB408C9D, 0x1B147DCC, 0xB42BC0B0,
+    0x92CA2F0E, 0x1B147DCC, 0xD83072E5, 0x78BC1B8F, 0x4C081DBF, 0x92CA2F0E, 0xDB408C9D, 0x92CA2F0E,
+    0x00000000, 0x00000000, 0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x487981AB,
+    0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D,
+    0x3CD6E3F3, 0xB18C6441, 0x3CD6E3F3, 0x1B147DCC, 0x00000000, 0x92CA2F0E, 0xDB408C9D, 0x00000000,
+    0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x78BC1B8F, 0x00000000,
+    0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x1F4B8CEF, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC,
+    0x487981AB, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E,
+    0x3CD6E3F3, 0xDB408C9D, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x487981AB,
+    0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0xA4523835, 0x92CA2F0E, 0x78BC1B8F, 0x487981AB,
+    0x92CA2F0E, 0x487981AB, 0x92CA2F0E, 0xE2AD51BA, 0xD83072E5, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E,
+    0x78BC1B8F, 0x1B147DCC, 0x1B147DCC, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3,
+    0x487981AB, 0xDB408C9D, 0x3CD6E3F3, 0x487981AB, 0xDB408C9D, 0x3CD6E3F3, 0xE2AD51BA, 0xD83072E5,
+    0x1B147DCC, 0x1F4B8CEF, 0x487981AB, 0x487981AB, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x0231739B,
+    0x92CA2F0E, 0x78BC1B8F, 0x487981AB, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E,
+    0xDB408C9D, 0x3CD6E3F3, 0x3CD6E3F3, 0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x65CBDD54,
+    0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x78BC1B8F, 0x65CBDD54, 0x92CA2F0E, 0x92CA2F0E, 0xD83072E5,
+    0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x487981AB,
+    0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x4C081DBF, 0xDB408C9D, 0x3CD6E3F3, 0x00000000, 0x4C081DBF,
+    0x3CD6E3F3, 0x4C081DBF, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x78BC1B8F, 0x487981AB,
+    0x4C081DBF, 0x4C081DBF, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x3CD6E3F3,
+    0x92CA2F0E, 0xCEEB36B7, 0x92CA2F0E, 0x1B147DCC, 0x00000000, 0x92CA2F0E, 0x00000000, 0x487981AB,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x487981AB, 0x4C081DBF, 0x4C081DBF, 0x78BC1B8F, 0x91783BB0,
+    0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x1B147DCC, 0x00000000, 0x487981AB, 0x4C081DBF, 0x92CA2F0E,
+    0x65CBDD54, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x1F4B8CEF, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E,
+    0x487981AB, 0x00000000, 0x1B147DCC, 0xD83072E5, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0xB18C6441,
+    0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x4C081DBF, 0x79F70494, 0x92CA2F0E, 0x92CA2F0E,
+    0x1B147DCC, 0x78BC1B8F, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x487981AB,
+    0x92CA2F0E, 0xDB408C9D, 0x487981AB, 0x00000000, 0x78BC1B8F, 0x92CA2F0E, 0x00000000, 0x1F4B8CEF,
+    0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0xDB408C9D, 0x3CD6E3F3, 0x1B147DCC, 0x1B147DCC, 0x3CD6E3F3,
+    0xDB408C9D, 0x00000000, 0x3CD6E3F3, 0xDB408C9D, 0x3CD6E3F3, 0xD83072E5, 0x00000000, 0x65CBDD54,
+    0x4C081DBF, 0xDB408C9D, 0x00000000, 0x3CD6E3F3, 0x3CD6E3F3, 0x487981AB, 0x487981AB, 0x1B147DCC,
+    0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC,
+    0x3CD6E3F3, 0x4C081DBF, 0x00000000, 0xD83072E5, 0x65CBDD54, 0x487981AB, 0x2AA96DD0, 0x92CA2F0E,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x1F4B8CEF, 0x92CA2F0E, 0x00000000, 0x4C081DBF, 0x3CD6E3F3, 0x487981AB,
+    0xD83072E5, 0x3CD6E3F3, 0x3CD6E3F3, 0x00000000, 0x3CD6E3F3, 0x487981AB, 0x00000000, 0x487981AB,
+    0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E,
+    0x00000000, 0x92CA2F0E, 0x4C081DBF, 0x4C081DBF, 0x78BC1B8F, 0xD939FF68, 0x3CD6E3F3, 0x92CA2F0E,
+    0x79F70494, 0x92CA2F0E, 0x3CD6E3F3, 0x65CBDD54, 0x92CA2F0E, 0x92CA2F0E, 0xD83072E5, 0x78BC1B8F,
+    0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x00000000, 0x3CD6E3F3, 0x78BC1B8F, 0x00000000, 0x92CA2F0E,
+    0x3CD6E3F3, 0x010B6880, 0x00000000, 0x00000000, 0x1B147DCC, 0x04E90BF5, 0x1B147DCC, 0x00000000,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0xD83072E5, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x78BC1B8F, 0xD83072E5, 0x92CA2F0E,
+    0x65CBDD54, 0xDB408C9D, 0x65CBDD54, 0x487981AB, 0x3CD6E3F3, 0x92CA2F0E, 0x91783BB0, 0x92CA2F0E,
+    0x00000000, 0x00000000, 0x00000000, 0xD83072E5, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E,
+    0x1F4B8CEF, 0x3CD6E3F3, 0x92CA2F0E, 0x487981AB, 0xDB408C9D, 0x92CA2F0E, 0x4C081DBF, 0x1B147DCC,
+    0x3CD6E3F3, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x4C081DBF,
+    0xD83072E5, 0x3CD6E3F3, 0x00000000, 0x00000000, 0xDB408C9D, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3,
+    0x92CA2F0E, 0x92CA2F0E, 0x78BC1B8F, 0xD83072E5, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3,
+    0x4C081DBF, 0xD83072E5, 0xDB408C9D, 0x91783BB0, 0x1F4B8CEF, 0xD83072E5, 0x3CD6E3F3, 0x92CA2F0E,
+    0x4C081DBF, 0x92CA2F0E, 0x4C081DBF, 0x78BC1B8F, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC,
+    0x2AA96DD0, 0x1B147DCC, 0x00000000, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x4C081DBF,
+    0x4C081DBF, 0x0231739B, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3,
+    0x1B147DCC, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x1B147DCC,
+    0x487981AB, 0xB42BC0B0, 0x3CD6E3F3, 0x00000000, 0x91783BB0, 0x010B6880, 0x487981AB, 0x3CD6E3F3,
+    0x4C081DBF, 0x78BC1B8F, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x65CBDD54, 0x487981AB,
+    0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x1F4B8CEF, 0x3CD6E3F3, 0x92CA2F0E, 0xDB408C9D,
+    0xD83072E5, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC, 0xD939FF68, 0x3CD6E3F3, 0x1B147DCC,
+    0x3CD6E3F3, 0x65CBDD54, 0x78BC1B8F, 0x487981AB, 0x4C081DBF, 0x92CA2F0E, 0x04E90BF5, 0x00000000,
+    0x1B147DCC, 0x1B147DCC, 0x487981AB, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0xB42BC0B0, 0xD83072E5,
+    0x4C081DBF, 0x92CA2F0E, 0x00000000, 0x3CD6E3F3, 0x78BC1B8F, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF,
+    0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x487981AB, 0x00000000,
+    0x1B147DCC, 0x487981AB, 0xD83072E5, 0x92CA2F0E, 0x00000000, 0xE2AD51BA, 0x3CD6E3F3, 0x92CA2F0E,
+    0x92CA2F0E, 0x65CBDD54, 0x78BC1B8F, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E,
+    0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E,
+    0x4C081DBF, 0x3CD6E3F3, 0x1F4B8CEF, 0x1B147DCC, 0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3,
+    0xD83072E5, 0x1B147DCC, 0x65CBDD54, 0x92CA2F0E, 0x487981AB, 0x92CA2F0E, 0x4C081DBF, 0x4C081DBF,
+    0x00000000, 0x00000000, 0x92CA2F0E, 0x00000000, 0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x65CBDD54,
+    0x00000000, 0xD83072E5, 0x65CBDD54, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x00000000, 0x3CD6E3F3,
+    0x92CA2F0E, 0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x2AA96DD0, 0x92CA2F0E,
+    0xD83072E5, 0x92CA2F0E, 0x1B147DCC, 0xD83072E5, 0x78BC1B8F, 0x3CD6E3F3, 0xDB408C9D, 0x4C081DBF,
+    0x3CD6E3F3, 0x487981AB, 0x78BC1B8F, 0x92CA2F0E, 0xDB408C9D, 0x78BC1B8F, 0x3CD6E3F3, 0x92CA2F0E,
+    0x4C081DBF, 0x1B147DCC, 0x1B147DCC, 0x4C081DBF, 0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC, 0x1F4B8CEF,
+    0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x65CBDD54, 0xDB408C9D,
+    0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x00000000, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x00000000,
+    0xD83072E5, 0x00000000, 0x91783BB0, 0x0231739B, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x91783BB0, 0x487981AB, 0x92CA2F0E,
+    0xD83072E5, 0x00000000, 0x1B147DCC, 0x1B147DCC, 0x00000000, 0x92CA2F0E, 0x1B147DCC, 0x487981AB,
+    0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x487981AB, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E,
+    0x487981AB, 0x2AA96DD0, 0x0231739B, 0x487981AB, 0x4C081DBF, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x4C081DBF, 0x00000000, 0x92CA2F0E, 0x92CA2F0E,
+    0x52DF2E19, 0x1B147DCC, 0x92CA2F0E, 0x78BC1B8F, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E,
+}};
+
+constexpr std::array<uint16_t, 8192> tag_slots = {{
+    0x0000, 0x0C45, 0x0EC2, 0x0000, 0x05F7, 0x0000, 0x0000, 0x0000, 0x0D99, 0x0ED0, 0x03C5, 0x03EA, 0x0C93, 0x1324, 0x1269, 0x0BF8,
+    0x0A21, 0x1036, 0x12D3, 0x12CC, 0x0000, 0x04F1, 0x11F1, 0x0DB9, 0x03FF, 0x0100, 0x0189, 0x11E4, 0x0208, 0x0E00, 0x0518, 0x0000,
+    0x0957, 0x0AF5, 0x0B17, 0x10B5, 0x0000, 0x00A2, 0x0D27, 0x1128, 0x0000, 0x0000, 0x0000, 0x0A61, 0x0000, 0x0972, 0x1214, 0x0000,
+    0x0478, 0x0737, 0x118A, 0x0EA8, 0x0BE0, 0x0000, 0x0CE1, 0x0000, 0x0000, 0x09D0, 0x0EF7, 0x0AD2, 0x0EC4, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1215, 0x0000, 0x0217, 0x054F, 0x081D, 0x0E43, 0x0000, 0x0000, 0x0000, 0x0824, 0x0000, 0x0A65, 0x0659, 0x0251, 0x0000,
+    0x085C, 0x0000, 0x0367, 0x0DF5, 0x0279, 0x0000, 0x0ACD, 0x0000, 0x0000, 0x0722, 0x09A7, 0x0000, 0x0C66, 0x0E5C, 0x03FA, 0x04AC,
+    0x0000, 0x109A, 0x0465, 0x0000, 0x060F, 0x0000, 0x0000, 0x005F, 0x073F, 0x0C1A, 0x0000, 0x0000, 0x1023, 0x0000, 0x0000, 0x0D38,
+    0x06D3, 0x0236, 0x0C16, 0x04D7, 0x0000, 0x0FBE, 0x0D54, 0x001E, 0x0882, 0x0000, 0x0000, 0x0000, 0x0CB6, 0x01B1, 0x0000, 0x0000,
+    0x09CE, 0x0090, 0x0065, 0x112E, 0x112D, 0x0000, 0x0AA7, 0x0E2F, 0x0000, 0x0000, 0x0188, 0x05DD, 0x13A6, 0x0000, 0x091F, 0x0000,
+    0x0B9A, 0x0000, 0x0000, 0x1384, 0x0000, 0x0D34, 0x08E9, 0x0DBD, 0x00A7, 0x0000, 0x0C63, 0x0F86, 0x0000, 0x0000, 0x0000, 0x07F5,
+    0x135D, 0x0A69, 0x0AB8, 0x081B, 0x0000, 0x11F0, 0x1021, 0x1306, 0x047C, 0x0000, 0x04BF, 0x0D60, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x042A, 0x0000, 0x03BD, 0x0B6C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ABB, 0x0491, 0x0000, 0x0000, 0x0109, 0x0000, 0x061F, 0x1102,
+    0x0F41, 0x1250, 0x1220, 0x0DEA, 0x0E42, 0x010D, 0x0000, 0x11A2, 0x0000, 0x04D1, 0x001F, 0x0C42, 0x043C, 0x01CF, 0x0000, 0x0FD3,
+    0x0000, 0x0000, 0x0045, 0x0000, 0x05EC, 0x111D, 0x0000, 0x0D31, 0x0509, 0x0EFE, 0x0000, 0x13FE, 0x0000, 0x0FBD, 0x0000, 0x1085,
+    0x0000, 0x11F6, 0x0EA0, 0x03BB, 0x0495, 0x0EAB, 0x0000, 0x0F4A, 0x0555, 0x008C, 0x04F4, 0x0040, 0x0000, 0x0ECE, 0x00E0, 0x0D19,
+    0x0A9B, 0x1401, 0x0000, 0x0E53, 0x0000, 0x0BF1, 0x0000, 0x0BA6, 0x0B06, 0x0989, 0x044A, 0x13E0, 0x057F, 0x0BB3, 0x0B40, 0x0B99,
+    0x0000, 0x135F, 0x09FC, 0x0000, 0x0000, 0x0000, 0x1273, 0x0000, 0x0000, 0x0DB4, 0x0000, 0x02CA, 0x0000, 0x0000, 0x09A6, 0x01A9,
+    0x0000, 0x0000, 0x0C22, 0x121E, 0x0000, 0x015E, 0x0000, 0x0000, 0x0000, 0x0E5A, 0x021B, 0x0000, 0x01AE, 0x0A2F, 0x0000, 0x0A8C,
+    0x076C, 0x0CC2, 0x08CA, 0x0F90, 0x0CB8, 0x0F37, 0x0000, 0x0000, 0x0000, 0x04F3, 0x030A, 0x0000, 0x0EF0, 0x0000, 0x0000, 0x1096,
+    0x1201, 0x0000, 0x0000, 0x0DD0, 0x0143, 0x1094, 0x0DB6, 0x08EC, 0x0000, 0x0F49, 0x0000, 0x0000, 0x0DEB, 0x13BD, 0x133B, 0x014A,
+    0x0FBF, 0x07D4, 0x0F6C, 0x0000, 0x03A2, 0x0F52, 0x0000, 0x0F85, 0x106F, 0x0000, 0x0000, 0x02DA, 0x1438, 0x0283, 0x138F, 0x060B,
+    0x0000, 0x0BBC, 0x0000, 0x0D2B, 0x1074, 0x0CBC, 0x051C, 0x0D77, 0x0844, 0x0481, 0x0CAC, 0x0FDD, 0x13E3, 0x0000, 0x0000, 0x06F7,
+    0x0000, 0x04E4, 0x0035, 0x0000, 0x0000, 0x0000, 0x0000, 0x0039, 0x00E7, 0x0323, 0x0000, 0x0239, 0x0204, 0x01C5, 0x0000, 0x08DF,
+    0x0A43, 0x0636, 0x0B4B, 0x11A9, 0x0706, 0x0000, 0x0000, 0x0BAA, 0x06CA, 0x0FBB, 0x0D4F, 0x0D16, 0x104E, 0x009A, 0x000A, 0x0000,
+    0x0ABD, 0x0115, 0x0000, 0x08F2, 0x028D, 0x0000, 0x07FC, 0x0000, 0x13ED, 0x05C9, 0x084C, 0x012B, 0x0000, 0x0000, 0x05B6, 0x021A,
+    0x0000, 0x0E5B, 0x0000, 0x0000, 0x13E7, 0x0076, 0x08D3, 0x0000, 0x019E, 0x0A48, 0x0000, 0x115E, 0x12CD, 0x0A64, 0x0E28, 0x0CDB,
+    0x0000, 0x002C, 0x1282, 0x044B, 0x07AB, 0x1056, 0x0000, 0x1265, 0x0B19, 0x0000, 0x0000, 0x0000, 0x0000, 0x0DF4, 0x0000, 0x122C,
+    0x0000, 0x13B1, 0x0000, 0x0000, 0x04F9, 0x044E, 0x0000, 0x0000, 0x13F3, 0x1009, 0x0529, 0x0423, 0x0000, 0x0000, 0x03B0, 0x0000,
+    0x03D3, 0x0CC5, 0x0000, 0x0819, 0x007E, 0x0B9E, 0x11F7, 0x0439, 0x022B, 0x014F, 0x079F, 0x0ECA, 0x0BE3, 0x0000, 0x115C, 0x0068,
+    0x06B8, 0x128E, 0x1138, 0x11BF, 0x0000, 0x0000, 0x02D7, 0x0574, 0x0000, 0x0802, 0x09E7, 0x00AB, 0x0245, 0x0E62, 0x0000, 0x137E,
+    0x0311, 0x0000, 0x0E5E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0AB1, 0x0F98, 0x0000, 0x0000, 0x0AB5, 0x0000, 0x0000, 0x0456, 0x0000,
+    0x0000, 0x09F7, 0x0000, 0x0511, 0x0C12, 0x0526, 0x0000, 0x0000, 0x020A, 0x0000, 0x0C5F, 0x070A, 0x0000, 0x0ED5, 0x1154, 0x048F,
+    0x102B, 0x0C2D, 0x0000, 0x0264, 0x0000, 0x0CFC, 0x0000, 0x02EC, 0x0395, 0x0000, 0x0000, 0x0000, 0x0CF5, 0x0000, 0x0F24, 0x0000,
+    0x029B, 0x0000, 0x0DB7, 0x0000, 0x0000, 0x0261, 0x0935, 0x0000, 0x0000, 0x02CB, 0x023F, 0x0000, 0x0544, 0x1192, 0x0000, 0x0EB2,
+    0x0000, 0x0AD1, 0x0F88, 0x0000, 0x0000, 0x121D, 0x0000, 0x0EE9, 0x09BC, 0x133E, 0x053D, 0x0000, 0x0781, 0x0543, 0x0000, 0x0AED,
+    0x0000, 0x0000, 0x0946, 0x0B27, 0x0000, 0x05D3, 0x1123, 0x0000, 0x0000, 0x0071, 0x1274, 0x0000, 0x04AB, 0x0000, 0x0525, 0x0000,
+    0x0E8F, 0x0000, 0x0000, 0x089B, 0x0000, 0x0000, 0x13F8, 0x11BE, 0x0D98, 0x0AC0, 0x0000, 0x110E, 0x0DD2, 0x0E93, 0x0941, 0x0000,
+    0x0BFD, 0x07BA, 0x0444, 0x0C94, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D32, 0x0000, 0x13C1, 0x06E7, 0x023D, 0x060E, 0x055A, 0x1104,
+    0x0000, 0x0A2E, 0x0A67, 0x0000, 0x027B, 0x0000, 0x01DB, 0x10DD, 0x11E8, 0x142C, 0x0A56, 0x0309, 0x022A, 0x096D, 0x0B94, 0x0A2A,
+    0x003E, 0x091D, 0x0CB1, 0x06F8, 0x0000, 0x01A4, 0x0000, 0x09AC, 0x0742, 0x0000, 0x0000, 0x09CB, 0x0575, 0x0000, 0x1156, 0x093F,
+    0x0318, 0x0000, 0x0C85, 0x07AD, 0x0D05, 0x0000, 0x065E, 0x0000, 0x072B, 0x045C, 0x083F, 0x0F61, 0x0000, 0x0598, 0x08A7, 0x05DA,
+    0x0440, 0x1290, 0x1148, 0x00BB, 0x067B, 0x0000, 0x0F64, 0x0000, 0x0000, 0x0000, 0x0000, 0x115D, 0x017E, 0x0000, 0x0000, 0x0000,
+    0x0388, 0x0000, 0x0B54, 0x0000, 0x036E, 0x0000, 0x0AFC, 0x0C8E, 0x0000, 0x01C3, 0x0817, 0x0884, 0x05E9, 0x02D3, 0x12C9, 0x111F,
+    0x050F, 0x0000, 0x1403, 0x04D8, 0x0BE9, 0x0FAF, 0x0F16, 0x0000, 0x0000, 0x0000, 0x07CE, 0x0000, 0x0DE7, 0x0000, 0x0686, 0x0000,
+    0x102C, 0x0B42, 0x0D14, 0x0000, 0x0000, 0x0000, 0x0E07, 0x01E4, 0x0944, 0x11FF, 0x0768, 0x0000, 0x0609, 0x0FF3, 0x0000, 0x0000,
+    0x0000, 0x017D, 0x0CF1, 0x0778, 0x073E, 0x048A, 0x0000, 0x0000, 0x0000, 0x1323, 0x0000, 0x0000, 0x0000, 0x0000, 0x0756, 0x0E37,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00A3, 0x1433, 0x0000, 0x0CA2, 0x10DC, 0x0000, 0x0000, 0x0601, 0x0216, 0x0000, 0x014D, 0x0000,
+    0x02DC, 0x0C96, 0x0000, 0x0F15, 0x05D5, 0x0AAD, 0x04EE, 0x0000, 0x0B91, 0x0A0C, 0x0000, 0x0000, 0x12F9, 0x0000, 0x0000, 0x0718,
+    0x0000, 0x061C, 0x009E, 0x0647, 0x1304, 0x040B, 0x0000, 0x0D96, 0x0284, 0x0000, 0x04FC, 0x0528, 0x04CE, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x137F, 0x0134, 0x0249, 0x116B, 0x0E97, 0x1048, 0x0FE0, 0x0C3C, 0x0D2F, 0x0000, 0x140B, 0x0000, 0x0AA9, 0x0CEF, 0x0881,
+    0x0EF2, 0x0454, 0x12A1, 0x129C, 0x01CA, 0x12AD, 0x08D9, 0x0000, 0x046E, 0x0000, 0x018C, 0x0DA2, 0x0585, 0x108E, 0x08F6, 0x0F09,
+    0x0000, 0x1031, 0x0EBF, 0x1311, 0x0000, 0x0000, 0x1397, 0x0000, 0x0000, 0x0000, 0x0111, 0x0CB2, 0x1142, 0x05D1, 0x00D6, 0x0000,
+    0x1255, 0x0000, 0x0E90, 0x0000, 0x0000, 0x13D8, 0x11EB, 0x038B, 0x1276, 0x0000, 0x0837, 0x0F01, 0x10BE, 0x087C, 0x04E6, 0x0F31,
+    0x02A5, 0x0060, 0x0A24, 0x11C8, 0x13BC, 0x0AD5, 0x12DC, 0x12C2, 0x071E, 0x070D, 0x05BD, 0x0000, 0x04B8, 0x0000, 0x0000, 0x0766,
+    0x0000, 0x0A34, 0x0000, 0x0000, 0x0513, 0x0000, 0x04A3, 0x1415, 0x13DE, 0x00EF, 0x066C, 0x0379, 0x068D, 0x12A7, 0x1421, 0x1174,
+    0x0000, 0x10D0, 0x097D, 0x0F0F, 0x09EE, 0x0193, 0x1121, 0x03F4, 0x0785, 0x0000, 0x0AB6, 0x0765, 0x119B, 0x1268, 0x0000, 0x03FD,
+    0x10A6, 0x0852, 0x1134, 0x0000, 0x1362, 0x0B3A, 0x01FE, 0x140A, 0x02D1, 0x015A, 0x1247, 0x0997, 0x0000, 0x02BF, 0x0000, 0x0F5D,
+    0x01BC, 0x0000, 0x006A, 0x012D, 0x0000, 0x0B4A, 0x1357, 0x0406, 0x05EA, 0x0000, 0x0E50, 0x0000, 0x0B73, 0x133C, 0x1430, 0x0496,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1399, 0x047E, 0x0000, 0x0A7D, 0x0000, 0x0000, 0x0000, 0x0281, 0x0000, 0x0000, 0x0365, 0x067A,
+    0x0831, 0x0000, 0x0000, 0x0000, 0x02D0, 0x07E1, 0x043F, 0x0F67, 0x0004, 0x0C24, 0x0000, 0x0000, 0x0000, 0x0000, 0x0380, 0x0244,
+    0x0F4E, 0x08F5, 0x0000, 0x0000, 0x0000, 0x0DA6, 0x128A, 0x0000, 0x0B34, 0x0000, 0x11BA, 0x12FE, 0x0C35, 0x02A8, 0x0426, 0x0000,
+    0x11C4, 0x0000, 0x0088, 0x0567, 0x0000, 0x0000, 0x0CAB, 0x000B, 0x058B, 0x03C6, 0x10A1, 0x0942, 0x0D61, 0x0DF3, 0x13F5, 0x0AB2,
+    0x0057, 0x0D2E, 0x07FA, 0x0000, 0x06ED, 0x0E0D, 0x0000, 0x0000, 0x1131, 0x02DF, 0x004A, 0x0000, 0x0800, 0x0795, 0x0757, 0x0CBD,
+    0x1152, 0x05A3, 0x0932, 0x0E65, 0x0980, 0x0000, 0x0000, 0x1059, 0x01E1, 0x0A57, 0x0000, 0x1411, 0x12B3, 0x0000, 0x0000, 0x0CCD,
+    0x02A7, 0x0000, 0x0EB1, 0x0000, 0x0E2C, 0x09BA, 0x08CF, 0x108D, 0x06E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F74, 0x0000, 0x13AF,
+    0x0FF9, 0x0D7F, 0x12B2, 0x0845, 0x0FED, 0x063E, 0x04B9, 0x0000, 0x0000, 0x0D66, 0x0280, 0x0000, 0x0EA2, 0x0166, 0x0556, 0x0000,
+    0x0993, 0x0BCE, 0x0000, 0x0000, 0x12EB, 0x0AF1, 0x0000, 0x0CC0, 0x00F8, 0x0A13, 0x0ABC, 0x02DE, 0x0000, 0x01A8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04B1, 0x0B6A, 0x0962, 0x010F, 0x0000, 0x09C9, 0x0B04, 0x0F7E, 0x1119, 0x0000, 0x03C1,
+    0x0A87, 0x0000, 0x0F13, 0x0000, 0x1232, 0x0000, 0x0000, 0x04F8, 0x07FB, 0x0994, 0x0000, 0x0000, 0x02A1, 0x0000, 0x06A4, 0x0747,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1299, 0x0E3D, 0x1367, 0x0000, 0x0000, 0x0000, 0x090A, 0x0276, 0x0B85, 0x0000, 0x12B4,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0C73, 0x0783, 0x0418, 0x0000, 0x0000, 0x07E5, 0x0000, 0x00CD, 0x083B, 0x0A06, 0x1091, 0x0000,
+    0x020E, 0x0000, 0x05AB, 0x0000, 0x00F7, 0x1202, 0x0000, 0x10AF, 0x04B2, 0x1317, 0x0000, 0x0000, 0x07B8, 0x0000, 0x0000, 0x00DF,
+    0x0E75, 0x05E8, 0x0F14, 0x0000, 0x00BA, 0x000C, 0x0000, 0x07BD, 0x0000, 0x06DE, 0x0502, 0x11BB, 0x099B, 0x0DB5, 0x0CA3, 0x0000,
+    0x03B9, 0x0000, 0x0000, 0x063C, 0x0000, 0x0744, 0x0000, 0x0CD8, 0x033B, 0x0000, 0x0000, 0x034E, 0x0764, 0x0000, 0x0000, 0x0979,
+    0x0661, 0x0000, 0x0691, 0x0535, 0x0000, 0x0CF2, 0x0D95, 0x0000, 0x0AD7, 0x059B, 0x0000, 0x006E, 0x11DF, 0x11A5, 0x0000, 0x0C2A,
+    0x034F, 0x122D, 0x0000, 0x120A, 0x0B89, 0x08F1, 0x020D, 0x0F28, 0x0FF1, 0x0000, 0x0000, 0x071F, 0x08C1, 0x0377, 0x1236, 0x0000,
+    0x0263, 0x0701, 0x13AB, 0x0000, 0x0000, 0x0000, 0x02C1, 0x0000, 0x066A, 0x0F47, 0x0000, 0x000F, 0x03B8, 0x0462, 0x050A, 0x0000,
+    0x0000, 0x0F7F, 0x0000, 0x0000, 0x0082, 0x1069, 0x0EF5, 0x0000, 0x0000, 0x0000, 0x0000, 0x1307, 0x0000, 0x118E, 0x0000, 0x0E20,
+    0x0DFF, 0x0AE0, 0x0000, 0x0000, 0x0176, 0x0A27, 0x0D67, 0x0000, 0x09B7, 0x0000, 0x0A49, 0x12A4, 0x0A0A, 0x0000, 0x0907, 0x0EF1,
+    0x0000, 0x02BC, 0x0FBA, 0x08CB, 0x0588, 0x028A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D48, 0x07E8, 0x0E95, 0x0000, 0x0000, 0x0368,
+    0x0B22, 0x05B0, 0x0378, 0x0000, 0x0000, 0x0101, 0x0F3E, 0x04B6, 0x10A9, 0x0DC9, 0x0000, 0x0650, 0x0000, 0x0000, 0x0624, 0x0000,
+    0x0000, 0x05DF, 0x0E47, 0x0919, 0x0B0A, 0x04E1, 0x0000, 0x1093, 0x0000, 0x0012, 0x105B, 0x0B9B, 0x0A0E, 0x0DC2, 0x03C4, 0x07CA,
+    0x0890, 0x0014, 0x0F3D, 0x0955, 0x0000, 0x0000, 0x0000, 0x0CB5, 0x06A8, 0x1171, 0x0000, 0x123D, 0x029C, 0x1163, 0x077E, 0x0981,
+    0x02E3, 0x09C7, 0x1027, 0x0000, 0x098D, 0x010C, 0x0F8D, 0x0B5F, 0x0572, 0x024E, 0x11D4, 0x0A25, 0x0D3E, 0x1248, 0x0FD2, 0x0000,
+    0x0000, 0x0000, 0x094B, 0x0000, 0x0137, 0x0000, 0x07B4, 0x0145, 0x04CF, 0x0000, 0x1266, 0x0000, 0x05C1, 0x0B05, 0x0000, 0x1414,
+    0x0000, 0x0E12, 0x0000, 0x0AFD, 0x0000, 0x05E6, 0x0000, 0x0DE2, 0x10A8, 0x0000, 0x0000, 0x0000, 0x0E86, 0x05E2, 0x06CE, 0x0268,
+    0x0000, 0x064D, 0x0000, 0x0000, 0x0000, 0x09F9, 0x0000, 0x0E44, 0x0000, 0x103C, 0x0000, 0x07C5, 0x0DA4, 0x06D5, 0x0000, 0x0E26,
+    0x045F, 0x0000, 0x0000, 0x0635, 0x0000, 0x04C0, 0x0DDA, 0x0206, 0x0000, 0x0EAE, 0x0000, 0x069E, 0x0349, 0x0000, 0x0749, 0x10B8,
+    0x0C3A, 0x0000, 0x0021, 0x099D, 0x0000, 0x0EB9, 0x0458, 0x0CA5, 0x0A93, 0x102A, 0x0ED6, 0x051A, 0x142B, 0x0D58, 0x12A3, 0x05F8,
+    0x0000, 0x0000, 0x031D, 0x0CF6, 0x0466, 0x0EDF, 0x0B23, 0x11B7, 0x13BB, 0x0000, 0x0BBD, 0x0000, 0x0000, 0x07C3, 0x11ED, 0x0000,
+    0x0000, 0x0829, 0x0EFD, 0x0C8F, 0x05EB, 0x03D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x07BC, 0x0000, 0x0000, 0x0054, 0x0420, 0x047D,
+    0x13F2, 0x13A1, 0x0789, 0x0FAC, 0x1258, 0x13D4, 0x0000, 0x045E, 0x0734, 0x077F, 0x0BD8, 0x0000, 0x01F4, 0x0E38, 0x0000, 0x02C4,
+    0x11FA, 0x0000, 0x0000, 0x00EE, 0x0000, 0x0000, 0x03BC, 0x0CC1, 0x0000, 0x0F8F, 0x091C, 0x0E2E, 0x0000, 0x0000, 0x030B, 0x0000,
+    0x0000, 0x0BC5, 0x0772, 0x08C8, 0x0000, 0x0431, 0x0B21, 0x0C17, 0x0000, 0x0EC6, 0x0000, 0x12ED, 0x004E, 0x0BB4, 0x112F, 0x12B6,
+    0x0351, 0x0000, 0x0BC0, 0x0A19, 0x0000, 0x0000, 0x132C, 0x0D0C, 0x07A6, 0x0B29, 0x070C, 0x0DE1, 0x0801, 0x0364, 0x0000, 0x0114,
+    0x0000, 0x10CD, 0x1216, 0x118F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0AF4, 0x053E, 0x0000, 0x0966, 0x01FB, 0x0000, 0x0AFA, 0x01F2,
+    0x0009, 0x0970, 0x0000, 0x0000, 0x0000, 0x07F7, 0x0D23, 0x0000, 0x0000, 0x07C1, 0x004F, 0x0000, 0x003C, 0x0000, 0x0000, 0x0000,
+    0x03A1, 0x0000, 0x0000, 0x1013, 0x0000, 0x0000, 0x0000, 0x0000, 0x0424, 0x126D, 0x03CC, 0x121B, 0x0000, 0x0000, 0x0B2E, 0x0000,
+    0x0712, 0x0000, 0x0000, 0x0000, 0x0A37, 0x100F, 0x0F30, 0x12E8, 0x0000, 0x0592, 0x0C0E, 0x0668, 0x0000, 0x0D7B, 0x0F35, 0x1006,
+    0x0000, 0x0EC9, 0x009D, 0x0000, 0x0000, 0x10E8, 0x05D7, 0x03DF, 0x0286, 0x0000, 0x1090, 0x0158, 0x057E, 0x1159, 0x0000, 0x0DCF,
+    0x0F27, 0x0FCB, 0x11B6, 0x1150, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FD, 0x0000, 0x0000, 0x0000, 0x00B0, 0x0000,
+    0x0435, 0x03EC, 0x0180, 0x099A, 0x00A4, 0x00F4, 0x118D, 0x1316, 0x0000, 0x0929, 0x0410, 0x1169, 0x0000, 0x0F7B, 0x0274, 0x0000,
+    0x033C, 0x0000, 0x0523, 0x0B8E, 0x0000, 0x0000, 0x0952, 0x09F1, 0x05B1, 0x0000, 0x0EE1, 0x0000, 0x0000, 0x09E9, 0x11E7, 0x0F1C,
+    0x0000, 0x0699, 0x0000, 0x06EE, 0x0B80, 0x0B65, 0x09F3, 0x1386, 0x0000, 0x0000, 0x0051, 0x06CC, 0x0000, 0x0FA4, 0x1064, 0x1127,
+    0x0000, 0x12B9, 0x0167, 0x11EE, 0x05C3, 0x094C, 0x0D3B, 0x0306, 0x0FAA, 0x0F43, 0x0000, 0x03DB, 0x0000, 0x062E, 0x0C38, 0x0000,
+    0x0000, 0x0000, 0x0558, 0x0522, 0x12EC, 0x0FD6, 0x0974, 0x1341, 0x007F, 0x0000, 0x0000, 0x0FC2, 0x0000, 0x0561, 0x0F11, 0x0D72,
+    0x08DB, 0x0D9A, 0x1346, 0x0E94, 0x0E39, 0x136F, 0x0000, 0x0505, 0x05AF, 0x0000, 0x1245, 0x0769, 0x0000, 0x0000, 0x0000, 0x0C62,
+    0x0EF8, 0x11F9, 0x0EC8, 0x0000, 0x0000, 0x0682, 0x0E13, 0x0259, 0x0000, 0x12B7, 0x07B9, 0x0000, 0x0FDC, 0x069C, 0x1222, 0x09DB,
+    0x0DF8, 0x074E, 0x093C, 0x0D91, 0x1296, 0x1200, 0x0735, 0x0000, 0x0000, 0x07EA, 0x0000, 0x0422, 0x0EFA, 0x0000, 0x07A9, 0x0000,
+    0x0804, 0x0000, 0x0878, 0x136C, 0x099F, 0x1205, 0x115F, 0x0000, 0x0CDA, 0x0EFF, 0x073D, 0x08C2, 0x02AB, 0x0000, 0x071C, 0x0617,
+    0x0000, 0x01FF, 0x0000, 0x06B5, 0x0000, 0x09A3, 0x11DD, 0x0F2A, 0x06A6, 0x0000, 0x0EC3, 0x0000, 0x0000, 0x0660, 0x0000, 0x0211,
+    0x0000, 0x0310, 0x0D4E, 0x0000, 0x130D, 0x0560, 0x0D04, 0x0000, 0x11B3, 0x1066, 0x052A, 0x0000, 0x0000, 0x01D1, 0x13EC, 0x0B33,
+    0x0589, 0x05F3, 0x0F9E, 0x0000, 0x0910, 0x05E4, 0x09AB, 0x06FB, 0x09A1, 0x0000, 0x0000, 0x0000, 0x09FF, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0632, 0x0BCF, 0x0E7E, 0x0000, 0x133A, 0x12BC, 0x1092, 0x0000, 0x09E1, 0x0000, 0x0000, 0x0C9D, 0x0000, 0x13E6, 0x0A46,
+    0x0AEF, 0x0000, 0x0000, 0x06AB, 0x0000, 0x0000, 0x0A3B, 0x0B24, 0x0000, 0x12D6, 0x0000, 0x0794, 0x0000, 0x0000, 0x0000, 0x06FE,
+    0x0F9F, 0x10F0, 0x0E03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x011E, 0x0C4D, 0x0A18, 0x10BB, 0x107C, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x08A9, 0x0000, 0x0000, 0x0000, 0x0043, 0x0EC5, 0x0000, 0x0000, 0x0000, 0x06E8, 0x104C, 0x0B2C, 0x026B, 0x0000, 0x080A,
+    0x0000, 0x0000, 0x12B0, 0x08CC, 0x0796, 0x0000, 0x0191, 0x11D8, 0x01B8, 0x0000, 0x0000, 0x0000, 0x10A0, 0x015F, 0x121A, 0x02FD,
+    0x0C0A, 0x09A4, 0x004D, 0x05B2, 0x0679, 0x06FF, 0x04AD, 0x05EE, 0x0000, 0x0000, 0x0000, 0x0A99, 0x0000, 0x089A, 0x06F9, 0x0702,
+    0x0A4C, 0x1082, 0x05B8, 0x047F, 0x079E, 0x0D50, 0x0275, 0x04B0, 0x0FDB, 0x028F, 0x0000, 0x0354, 0x0000, 0x0B0E, 0x1195, 0x0E1A,
+    0x0000, 0x0000, 0x0000, 0x05AD, 0x0C07, 0x07E6, 0x0000, 0x0000, 0x02D9, 0x0000, 0x0F8E, 0x0A0D, 0x0DEE, 0x0000, 0x0327, 0x094E,
+    0x0000, 0x05DB, 0x04B5, 0x057D, 0x0BD5, 0x0AE6, 0x028C, 0x0000, 0x0A09, 0x0000, 0x0000, 0x1237, 0x027D, 0x13D7, 0x1337, 0x0834,
+    0x0DD8, 0x0FA6, 0x0B01, 0x0288, 0x0514, 0x00CF, 0x0409, 0x0000, 0x0DBB, 0x0000, 0x0000, 0x0503, 0x0000, 0x0000, 0x11F8, 0x0C84,
+    0x0B5B, 0x0000, 0x1054, 0x049A, 0x0000, 0x134C, 0x1264, 0x0000, 0x1034, 0x0C78, 0x056A, 0x0000, 0x10C1, 0x0000, 0x01FA, 0x11D9,
+    0x03CB, 0x09C6, 0x0B3B, 0x0000, 0x1011, 0x0290, 0x1042, 0x01BA, 0x0165, 0x0000, 0x0599, 0x0DF0, 0x00E5, 0x0826, 0x0322, 0x0652,
+    0x08EA, 0x1329, 0x0DBA, 0x0000, 0x0E80, 0x0D85, 0x0000, 0x0C00, 0x0E17, 0x0027, 0x0000, 0x0000, 0x0000, 0x0000, 0x131E, 0x0E92,
+    0x026A, 0x0000, 0x0000, 0x0999, 0x0D2C, 0x014C, 0x07EF, 0x0A82, 0x0069, 0x0000, 0x116D, 0x0857, 0x0000, 0x111E, 0x042B, 0x13DA,
+    0x0C10, 0x0000, 0x0000, 0x0680, 0x0000, 0x00AC, 0x0124, 0x08C6, 0x01F6, 0x02EE, 0x0F93, 0x1335, 0x0F60, 0x0000, 0x0777, 0x0694,
+    0x042E, 0x0000, 0x0013, 0x0000, 0x0000, 0x0000, 0x09CF, 0x0000, 0x0876, 0x0000, 0x09C0, 0x1151, 0x0000, 0x06BF, 0x0000, 0x02F2,
+    0x0000, 0x017B, 0x05BB, 0x0000, 0x0E96, 0x139E, 0x0000, 0x0000, 0x0870, 0x0000, 0x0000, 0x0000, 0x0545, 0x014E, 0x13B3, 0x0DBF,
+    0x018B, 0x0F99, 0x0D82, 0x136E, 0x0000, 0x0000, 0x1229, 0x06F5, 0x0000, 0x0000, 0x040D, 0x0120, 0x03E2, 0x0000, 0x02F3, 0x0869,
+    0x1025, 0x13C3, 0x1144, 0x0000, 0x0000, 0x08ED, 0x0EBA, 0x0E60, 0x0000, 0x05BC, 0x09D6, 0x0B53, 0x0771, 0x037C, 0x05CC, 0x09EB,
+    0x090C, 0x1112, 0x08AF, 0x0000, 0x0000, 0x0930, 0x1164, 0x0000, 0x0000, 0x0689, 0x01A3, 0x141E, 0x11FE, 0x0000, 0x03C7, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0D86, 0x0000, 0x046B, 0x0000, 0x12BA, 0x0000, 0x0717, 0x0000, 0x0000, 0x03D1, 0x09AD, 0x024C, 0x0000,
+    0x0000, 0x05CB, 0x0000, 0x0347, 0x0000, 0x0000, 0x0467, 0x0FA2, 0x0940, 0x0000, 0x1363, 0x0000, 0x0D0E, 0x0000, 0x0AD0, 0x0D02,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013C, 0x0992, 0x0000, 0x01AC, 0x00C8, 0x0153, 0x0000, 0x0F56, 0x0638, 0x1193, 0x0000,
+    0x0674, 0x0C2E, 0x10D6, 0x0000, 0x0015, 0x0FE6, 0x0000, 0x12A9, 0x0000, 0x0DF1, 0x0000, 0x0000, 0x0000, 0x0000, 0x1051, 0x0B00,
+    0x0C82, 0x0A5C, 0x0000, 0x0091, 0x0213, 0x0000, 0x0DA7, 0x08E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x06FC, 0x0906, 0x0000, 0x03F0,
+    0x0000, 0x0000, 0x06B2, 0x0531, 0x113E, 0x05B3, 0x1432, 0x0000, 0x0000, 0x0F81, 0x0000, 0x08D0, 0x0F71, 0x0000, 0x00E6, 0x0A17,
+    0x1050, 0x1374, 0x141B, 0x0000, 0x1336, 0x07DF, 0x0D6E, 0x0000, 0x0000, 0x00E3, 0x043B, 0x0F62, 0x0FBC, 0x08F0, 0x0A94, 0x0385,
+    0x01BF, 0x08FB, 0x0000, 0x0000, 0x0000, 0x0140, 0x06D6, 0x0C9E, 0x087E, 0x0000, 0x0484, 0x0000, 0x0E9F, 0x0000, 0x1206, 0x0000,
+    0x0551, 0x1113, 0x0000, 0x0387, 0x0016, 0x03E9, 0x08C3, 0x09BE, 0x099C, 0x016C, 0x0A97, 0x0000, 0x0240, 0x0B4D, 0x0000, 0x0000,
+    0x0000, 0x0FB0, 0x0000, 0x027C, 0x0197, 0x0000, 0x0002, 0x024F, 0x0000, 0x0486, 0x0000, 0x065A, 0x0B8C, 0x0000, 0x0FB1, 0x0000,
+    0x119F, 0x0000, 0x0000, 0x0D11, 0x0000, 0x04DD, 0x114C, 0x07F2, 0x0E89, 0x07B5, 0x13C8, 0x0000, 0x0547, 0x0000, 0x0000, 0x01C4,
+    0x0000, 0x0E67, 0x0000, 0x1049, 0x03F5, 0x0BF4, 0x06B9, 0x0721, 0x0F0A, 0x109F, 0x0DC1, 0x0000, 0x0221, 0x1103, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x048C, 0x019A, 0x0000, 0x0000, 0x1272, 0x0000, 0x0000, 0x0A71, 0x0000, 0x0000, 0x08A5, 0x0D53, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x099E, 0x0F34, 0x08F4, 0x0000, 0x0899, 0x06BE, 0x0000, 0x10F6, 0x0000, 0x0436, 0x0767, 0x0000, 0x0000,
+    0x0880, 0x0000, 0x0640, 0x0000, 0x04C6, 0x0BE5, 0x0130, 0x13EF, 0x0000, 0x0000, 0x0031, 0x0000, 0x0000, 0x0000, 0x0B41, 0x0897,
+    0x09A2, 0x0000, 0x08B8, 0x0000, 0x12C5, 0x0F21, 0x0468, 0x0CE7, 0x1246, 0x11DB, 0x0343, 0x0000, 0x124E, 0x0673, 0x053A, 0x02AC,
+    0x0D35, 0x0000, 0x1161, 0x0803, 0x0000, 0x0811, 0x0CA6, 0x0000, 0x0000, 0x0C56, 0x0F87, 0x0000, 0x0000, 0x030D, 0x0C4F, 0x10D2,
+    0x0373, 0x125F, 0x0B83, 0x084F, 0x0000, 0x0000, 0x0000, 0x071B, 0x02E4, 0x0613, 0x0B66, 0x0000, 0x0000, 0x0D17, 0x0F9B, 0x0000,
+    0x005C, 0x0425, 0x0FDE, 0x0000, 0x0D3D, 0x0CA1, 0x0B92, 0x0873, 0x0000, 0x0626, 0x04DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x1125,
+    0x1053, 0x0DE4, 0x10C9, 0x061E, 0x0AEE, 0x0000, 0x0000, 0x0000, 0x0F03, 0x0AD9, 0x01BE, 0x0018, 0x0000, 0x0A47, 0x0DAF, 0x0B88,
+    0x04C4, 0x05AA, 0x0B15, 0x0000, 0x0000, 0x0000, 0x0000, 0x078B, 0x026C, 0x0A7E, 0x0000, 0x0000, 0x0000, 0x0CF9, 0x0296, 0x0D37,
+    0x0000, 0x0788, 0x0000, 0x12FD, 0x0000, 0x0334, 0x0000, 0x0000, 0x060A, 0x1350, 0x1179, 0x1284, 0x0D90, 0x07EE, 0x0000, 0x054D,
+    0x1347, 0x09AE, 0x0000, 0x0000, 0x0000, 0x0E29, 0x0000, 0x0000, 0x05E1, 0x0000, 0x0E71, 0x0D6B, 0x0E52, 0x0000, 0x10AE, 0x142F,
+    0x04FA, 0x074F, 0x041A, 0x0061, 0x021E, 0x0000, 0x0000, 0x12D9, 0x13AC, 0x001D, 0x10C2, 0x0000, 0x0A4E, 0x0000, 0x0E30, 0x0000,
+    0x0000, 0x0EA6, 0x0A6B, 0x0494, 0x0000, 0x0B0D, 0x0000, 0x0000, 0x0000, 0x0D5D, 0x10CC, 0x0C67, 0x1058, 0x08FE, 0x0F8B, 0x0000,
+    0x0A6F, 0x08BA, 0x0000, 0x02A6, 0x0D06, 0x07A0, 0x0000, 0x0000, 0x0000, 0x04B4, 0x1168, 0x0DA3, 0x1364, 0x138C, 0x0000, 0x0F51,
+    0x0DAB, 0x0D62, 0x0E51, 0x0000, 0x0278, 0x0530, 0x0443, 0x0209, 0x0000, 0x0000, 0x0963, 0x0000, 0x0000, 0x0641, 0x0A20, 0x0E7C,
+    0x0000, 0x0D65, 0x132D, 0x0089, 0x0000, 0x0CC6, 0x10CE, 0x0000, 0x0000, 0x0D92, 0x0000, 0x0358, 0x106B, 0x012E, 0x0EB5, 0x0C97,
+    0x0B0B, 0x0308, 0x0901, 0x0C40, 0x00C3, 0x0000, 0x0000, 0x0000, 0x0107, 0x0000, 0x04CA, 0x0D8D, 0x0000, 0x10A7, 0x0F9D, 0x08AD,
+    0x0000, 0x0348, 0x00D2, 0x0000, 0x0967, 0x0000, 0x0E8E, 0x0000, 0x0732, 0x0534, 0x0B8A, 0x0000, 0x0000, 0x0000, 0x032F, 0x0000,
+    0x0000, 0x0000, 0x11CA, 0x01B5, 0x0BDC, 0x0D24, 0x0000, 0x0584, 0x0000, 0x0000, 0x1354, 0x0782, 0x137A, 0x0000, 0x0DDE, 0x0000,
+    0x0000, 0x0A07, 0x0A38, 0x1407, 0x0BDE, 0x0000, 0x10C7, 0x0BB0, 0x0000, 0x0000, 0x01BB, 0x0000, 0x0000, 0x0000, 0x13B5, 0x0D89,
+    0x134F, 0x0000, 0x049D, 0x101C, 0x02A4, 0x0DCE, 0x103E, 0x0000, 0x1394, 0x063B, 0x0000, 0x0000, 0x0EDD, 0x0000, 0x09D1, 0x0BFF,
+    0x0000, 0x0222, 0x02A3, 0x0000, 0x0BEF, 0x0000, 0x0000, 0x0063, 0x01A5, 0x08BF, 0x0000, 0x0519, 0x0000, 0x0000, 0x0DEC, 0x0832,
+    0x03AF, 0x105F, 0x0000, 0x04F2, 0x0000, 0x019D, 0x08DA, 0x0B2B, 0x0185, 0x1360, 0x00BC, 0x1261, 0x1005, 0x0810, 0x04A0, 0x1435,
+    0x0E46, 0x0A60, 0x0D69, 0x01A1, 0x0000, 0x0C92, 0x0000, 0x0D68, 0x1301, 0x00BE, 0x1062, 0x12C8, 0x0000, 0x06A7, 0x0000, 0x0B8D,
+    0x0000, 0x0000, 0x07A7, 0x132B, 0x0477, 0x0000, 0x0ADF, 0x054C, 0x0000, 0x01B7, 0x13B8, 0x0000, 0x0E88, 0x0000, 0x0295, 0x0000,
+    0x04C7, 0x01AD, 0x10F2, 0x03AD, 0x021D, 0x095A, 0x0000, 0x0000, 0x02ED, 0x0000, 0x131D, 0x0BBB, 0x0B08, 0x0000, 0x059C, 0x0BC8,
+    0x0000, 0x1180, 0x0000, 0x05FE, 0x119E, 0x0000, 0x015C, 0x0000, 0x0000, 0x0000, 0x11DE, 0x0000, 0x0A9C, 0x0705, 0x088D, 0x0000,
+    0x0862, 0x0000, 0x0CD6, 0x067D, 0x0ECD, 0x00F2, 0x13DC, 0x0171, 0x0C52, 0x0000, 0x0BCB, 0x0000, 0x0412, 0x0912, 0x07E0, 0x02CF,
+    0x0000, 0x0156, 0x13B9, 0x0000, 0x1315, 0x0C75, 0x0DB1, 0x03D6, 0x0000, 0x0000, 0x0000, 0x05D8, 0x0000, 0x06DA, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0048, 0x0000, 0x1404, 0x0BE4, 0x0000, 0x0000, 0x0372, 0x0DD3, 0x0761, 0x018E, 0x0127, 0x0000, 0x05B7, 0x0628,
+    0x0000, 0x0000, 0x086F, 0x1422, 0x0000, 0x0000, 0x0000, 0x0A3C, 0x0B12, 0x0000, 0x04B7, 0x0DB3, 0x0000, 0x0000, 0x0470, 0x0000,
+    0x0853, 0x0000, 0x0000, 0x0207, 0x1291, 0x1086, 0x0000, 0x0FD4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0887, 0x0000, 0x12D4, 0x03E8,
+    0x0D80, 0x0357, 0x059F, 0x0000, 0x0000, 0x098A, 0x0956, 0x1100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05AC, 0x0000,
+    0x1120, 0x00AE, 0x0000, 0x0000, 0x11F5, 0x0498, 0x0000, 0x0441, 0x051D, 0x0000, 0x0000, 0x08D7, 0x0000, 0x08E0, 0x0EF4, 0x06BB,
+    0x0943, 0x0A39, 0x0000, 0x0000, 0x07FD, 0x0F2F, 0x0A8E, 0x0000, 0x041B, 0x0000, 0x0000, 0x0177, 0x0550, 0x0000, 0x0546, 0x0000,
+    0x0620, 0x0E2B, 0x0000, 0x131A, 0x1409, 0x0818, 0x0000, 0x0000, 0x0714, 0x13B6, 0x081C, 0x0000, 0x0EFC, 0x1412, 0x0471, 0x132A,
+    0x055E, 0x0E81, 0x10E5, 0x0FD7, 0x075E, 0x0000, 0x123B, 0x0297, 0x10D4, 0x0F48, 0x0614, 0x1035, 0x0D52, 0x0000, 0x104A, 0x06EC,
+    0x1075, 0x07E3, 0x0093, 0x0000, 0x12C0, 0x0000, 0x00BD, 0x08BC, 0x0B87, 0x0000, 0x0B59, 0x0A42, 0x07BE, 0x0000, 0x0000, 0x0AAB,
+    0x0000, 0x138B, 0x0190, 0x00A1, 0x0000, 0x04C9, 0x0000, 0x0000, 0x0029, 0x1271, 0x0000, 0x077B, 0x0847, 0x0C77, 0x0C6A, 0x0000,
+    0x0000, 0x12D0, 0x13E8, 0x0000, 0x0445, 0x13B2, 0x0000, 0x0A77, 0x020F, 0x0000, 0x0A2D, 0x02E2, 0x002E, 0x0BD4, 0x0A41, 0x0000,
+    0x0000, 0x0CE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x135A, 0x08DC, 0x10D9, 0x11B8, 0x0000, 0x0C37, 0x0EAD, 0x07ED, 0x0000, 0x0000,
+    0x0C68, 0x13E9, 0x0000, 0x025C, 0x0B8F, 0x0000, 0x0000, 0x0000, 0x01CD, 0x0000, 0x0000, 0x1029, 0x1008, 0x0000, 0x074B, 0x01F0,
+    0x035C, 0x0472, 0x0A44, 0x12B1, 0x016B, 0x0984, 0x082E, 0x02F6, 0x0000, 0x0000, 0x0A66, 0x0000, 0x08AC, 0x0000, 0x0000, 0x1172,
+    0x133F, 0x0580, 0x016D, 0x00A0, 0x0000, 0x0000, 0x0C0D, 0x0938, 0x0E1C, 0x0000, 0x0000, 0x0000, 0x0D5C, 0x0000, 0x0000, 0x0BE8,
+    0x0BE2, 0x0356, 0x1004, 0x02FA, 0x0745, 0x0320, 0x0000, 0x0000, 0x0A96, 0x01A0, 0x0000, 0x0000, 0x0A16, 0x114B, 0x013E, 0x0000,
+    0x0000, 0x0E0C, 0x0000, 0x0000, 0x0000, 0x0000, 0x03B1, 0x0007, 0x0DA5, 0x0EBD, 0x0000, 0x087A, 0x0510, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x130F, 0x0872, 0x024A, 0x12FC, 0x117D, 0x11C7, 0x0000, 0x0000, 0x0000, 0x092C, 0x02F4, 0x0CB7, 0x0000, 0x0000, 0x0362,
+    0x0000, 0x0E3B, 0x11D2, 0x0000, 0x0687, 0x0000, 0x135C, 0x1321, 0x0000, 0x0000, 0x0DDC, 0x0B6F, 0x06DD, 0x08A1, 0x1043, 0x09B8,
+    0x013F, 0x0E55, 0x1016, 0x1124, 0x0C0C, 0x00D7, 0x0000, 0x02AF, 0x0000, 0x0000, 0x0000, 0x0000, 0x01CC, 0x022D, 0x0F00, 0x11D6,
+    0x0000, 0x0000, 0x0BB1, 0x0000, 0x0540, 0x078F, 0x007C, 0x0D0F, 0x0B90, 0x0A15, 0x12D1, 0x0000, 0x05BE, 0x1001, 0x0447, 0x08BD,
+    0x0C1D, 0x0246, 0x0000, 0x112A, 0x0C87, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A12, 0x0000, 0x035F, 0x04EB, 0x0FD1, 0x07A2,
+    0x0000, 0x0B4C, 0x0000, 0x0000, 0x03F7, 0x0C86, 0x0000, 0x0000, 0x11E5, 0x0C31, 0x141D, 0x097A, 0x1309, 0x06A5, 0x0AA3, 0x0000,
+    0x0000, 0x093A, 0x0232, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04E5, 0x07AC, 0x0532, 0x02B5, 0x0000, 0x0EBB, 0x02F8, 0x0709,
+    0x0000, 0x04C1, 0x0E8A, 0x01C7, 0x0000, 0x0727, 0x10CF, 0x0787, 0x0DE3, 0x0000, 0x106E, 0x11A6, 0x0644, 0x0298, 0x05ED, 0x140C,
+    0x0EB8, 0x0000, 0x0339, 0x01E8, 0x0000, 0x0898, 0x0000, 0x0E01, 0x0000, 0x0000, 0x025D, 0x0AFB, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00F9, 0x054B, 0x0000, 0x00B5, 0x0C13, 0x09B9, 0x0000, 0x10ED, 0x0497, 0x0000, 0x0000, 0x0000, 0x0EA3, 0x0A04, 0x130E, 0x0C95,
+    0x0000, 0x056D, 0x117C, 0x0000, 0x0000, 0x109C, 0x0FEA, 0x0000, 0x032B, 0x0000, 0x091B, 0x1155, 0x0000, 0x0A70, 0x0C27, 0x08C9,
+    0x0A0B, 0x0000, 0x0AC9, 0x11B5, 0x13F4, 0x0000, 0x0000, 0x0B98, 0x08D6, 0x03C2, 0x05AE, 0x002B, 0x0671, 0x1253, 0x0198, 0x0720,
+    0x1073, 0x106A, 0x1047, 0x0F91, 0x0000, 0x124C, 0x0000, 0x0000, 0x0000, 0x0658, 0x0CFA, 0x0000, 0x1145, 0x11DA, 0x133D, 0x0FC9,
+    0x0000, 0x0411, 0x02BA, 0x05F4, 0x0493, 0x03B5, 0x03BE, 0x0000, 0x0321, 0x0755, 0x0000, 0x0000, 0x02A2, 0x0EEE, 0x0BD6, 0x0B1A,
+    0x11AE, 0x0000, 0x06D2, 0x0000, 0x0000, 0x0975, 0x0000, 0x09C4, 0x1249, 0x0CA9, 0x05F2, 0x10E0, 0x021C, 0x00A9, 0x0000, 0x0000,
+    0x0000, 0x0850, 0x0000, 0x0000, 0x00B2, 0x0000, 0x0000, 0x0CAF, 0x11F2, 0x0000, 0x0000, 0x0181, 0x0000, 0x1122, 0x01E3, 0x0000,
+    0x0DDB, 0x0000, 0x0FEB, 0x0E74, 0x05B9, 0x09A0, 0x0848, 0x05CE, 0x0000, 0x0DDF, 0x0725, 0x0000, 0x0000, 0x04DB, 0x01C8, 0x055F,
+    0x10C5, 0x0000, 0x1188, 0x0F1A, 0x0C6E, 0x0F2D, 0x085A, 0x0AA1, 0x1396, 0x06FD, 0x0E1E, 0x1392, 0x0B74, 0x0000, 0x0C90, 0x0FCE,
+    0x0000, 0x100E, 0x0000, 0x0000, 0x114F, 0x0000, 0x12A5, 0x0846, 0x0000, 0x0583, 0x0000, 0x13BE, 0x0DC0, 0x0000, 0x0000, 0x0FB6,
+    0x097B, 0x0000, 0x0000, 0x0361, 0x0457, 0x0000, 0x1431, 0x1007, 0x0000, 0x0F50, 0x0000, 0x1342, 0x0000, 0x0000, 0x09D8, 0x0000,
+    0x0000, 0x0000, 0x13D2, 0x0000, 0x0000, 0x0B69, 0x13C9, 0x0779, 0x0000, 0x13EE, 0x143B, 0x0257, 0x0000, 0x0000, 0x0D30, 0x0000,
+    0x0B82, 0x08DE, 0x0000, 0x0000, 0x0606, 0x0000, 0x0000, 0x0AEC, 0x0121, 0x0512, 0x0000, 0x0000, 0x141C, 0x10F7, 0x1345, 0x0934,
+    0x03D8, 0x079D, 0x0000, 0x05E5, 0x038D, 0x076E, 0x1057, 0x0520, 0x0000, 0x0000, 0x0000, 0x0FA7, 0x1256, 0x06E9, 0x1312, 0x1225,
+    0x0000, 0x0000, 0x0000, 0x044F, 0x0000, 0x0000, 0x0619, 0x0000, 0x01ED, 0x0000, 0x0000, 0x1211, 0x0000, 0x0000, 0x0596, 0x0564,
+    0x0BD0, 0x0D21, 0x05A1, 0x04C2, 0x0000, 0x076D, 0x0000, 0x0D55, 0x032E, 0x0F57, 0x0328, 0x0C74, 0x0149, 0x10D5, 0x06F1, 0x03EF,
+    0x10B2, 0x0E41, 0x0000, 0x1297, 0x0000, 0x13CF, 0x0126, 0x0000, 0x0000, 0x0A5F, 0x05C8, 0x0C6D, 0x0BCD, 0x05D6, 0x1314, 0x1330,
+    0x12CA, 0x046F, 0x13FD, 0x10EB, 0x0000, 0x0000, 0x0A8A, 0x0000, 0x0000, 0x0000, 0x0F53, 0x0000, 0x0C4E, 0x0969, 0x0BEC, 0x0000,
+    0x127D, 0x13F7, 0x0000, 0x0000, 0x0000, 0x020C, 0x0724, 0x06AA, 0x0000, 0x1257, 0x0000, 0x0000, 0x011A, 0x0000, 0x0748, 0x02F7,
+    0x0000, 0x0909, 0x0000, 0x103F, 0x0154, 0x0000, 0x031A, 0x0D45, 0x0F22, 0x0F1B, 0x0000, 0x0B07, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0363, 0x000E, 0x0000, 0x0078, 0x10EC, 0x117E, 0x0F46, 0x0C7A, 0x0000, 0x0000, 0x0000, 0x0E7A, 0x13B7, 0x0542, 0x0020, 0x01E0,
+    0x0000, 0x0000, 0x0000, 0x0AAF, 0x1084, 0x0000, 0x0591, 0x0CDD, 0x03DA, 0x06E5, 0x0077, 0x137D, 0x0000, 0x07C8, 0x0EE2, 0x0F0C,
+    0x0FE2, 0x0428, 0x04F6, 0x1241, 0x1162, 0x0656, 0x03CF, 0x0F92, 0x03EE, 0x0000, 0x0FE3, 0x0000, 0x0B63, 0x0814, 0x1405, 0x1040,
+    0x1199, 0x08CD, 0x0DC3, 0x0000, 0x0000, 0x0260, 0x0442, 0x094A, 0x0000, 0x08A6, 0x1289, 0x0000, 0x05BF, 0x0604, 0x0D8B, 0x02D2,
+    0x01D8, 0x0000, 0x0524, 0x0000, 0x09DA, 0x1434, 0x092A, 0x0000, 0x1157, 0x0000, 0x0000, 0x0000, 0x12C6, 0x04D5, 0x0B5E, 0x07AF,
+    0x0000, 0x01AB, 0x0EEA, 0x1110, 0x0000, 0x0482, 0x0000, 0x0E72, 0x0836, 0x053F, 0x0FD0, 0x04ED, 0x13B4, 0x1177, 0x0000, 0x0000,
+    0x0D2A, 0x006F, 0x0733, 0x0000, 0x0000, 0x0B51, 0x0123, 0x0C61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E08, 0x08B5, 0x0E16, 0x0D5A,
+    0x0BA5, 0x0000, 0x1340, 0x0000, 0x0000, 0x0CB3, 0x0EC1, 0x020B, 0x0000, 0x01A6, 0x0000, 0x001C, 0x0000, 0x0C25, 0x02B0, 0x09A5,
+    0x0075, 0x0000, 0x0ADD, 0x0161, 0x0DCC, 0x1310, 0x10E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0005, 0x0AE2, 0x0413, 0x1267, 0x01B2,
+    0x0BE7, 0x126F, 0x0657, 0x0000, 0x1277, 0x0460, 0x1338, 0x0000, 0x0EE7, 0x1331, 0x1425, 0x0000, 0x0000, 0x0000, 0x01C1, 0x0000,
+    0x029F, 0x0E56, 0x0D47, 0x0BB7, 0x0000, 0x0611, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D70, 0x0CBB, 0x027A, 0x09E0, 0x0E70, 0x0C0B,
+    0x0000, 0x01E5, 0x1213, 0x125E, 0x0000, 0x0C7C, 0x135E, 0x0374, 0x12D7, 0x0CE6, 0x0000, 0x0000, 0x0B3C, 0x0A1C, 0x0000, 0x04A6,
+    0x0243, 0x0000, 0x0000, 0x0538, 0x0000, 0x0266, 0x0FB7, 0x131B, 0x0000, 0x0DE8, 0x0277, 0x0A83, 0x0000, 0x0954, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x091A, 0x0BF6, 0x1072, 0x032A, 0x0892, 0x03D9, 0x0000, 0x0000, 0x03A7, 0x0000, 0x0746, 0x0000, 0x0000, 0x12E6,
+    0x0000, 0x0000, 0x0000, 0x0C6F, 0x0000, 0x0000, 0x02AA, 0x0000, 0x0448, 0x0000, 0x140D, 0x0DD5, 0x0C5E, 0x0871, 0x0CDC, 0x00B7,
+    0x0000, 0x0000, 0x0086, 0x0D28, 0x12CE, 0x03D7, 0x09D7, 0x0677, 0x0000, 0x0FC0, 0x0000, 0x0000, 0x0000, 0x0763, 0x0000, 0x103A,
+    0x12CF, 0x04D6, 0x10C3, 0x0000, 0x0000, 0x0000, 0x09F8, 0x130B, 0x0C20, 0x0F3A, 0x06B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x108A,
+    0x0C8D, 0x080C, 0x0D00, 0x0000, 0x0FD5, 0x049B, 0x0000, 0x0000, 0x102F, 0x0000, 0x0220, 0x0000, 0x0CE2, 0x0637, 0x0000, 0x05D0,
+    0x0E4C, 0x0A02, 0x0AE4, 0x0DEF, 0x05FF, 0x0000, 0x1292, 0x0D29, 0x0000, 0x0B16, 0x1227, 0x0C1B, 0x1132, 0x0105, 0x062F, 0x11B1,
+    0x0A92, 0x035B, 0x0DD1, 0x0AE8, 0x0DA8, 0x0000, 0x0000, 0x0000, 0x0397, 0x0621, 0x0000, 0x0162, 0x0FF4, 0x0D74, 0x0D6A, 0x0000,
+    0x0000, 0x0D18, 0x0000, 0x00AF, 0x1173, 0x0419, 0x02B7, 0x11FC, 0x0006, 0x0000, 0x0FA3, 0x0959, 0x0084, 0x109D, 0x0000, 0x132F,
+    0x0C58, 0x062C, 0x0000, 0x0B1C, 0x0254, 0x0000, 0x0FFB, 0x08D1, 0x087D, 0x0991, 0x0000, 0x0000, 0x1408, 0x081A, 0x0515, 0x0000,
+    0x0000, 0x04FD, 0x08E8, 0x0BFB, 0x0000, 0x0000, 0x00EA, 0x0C70, 0x069D, 0x07F6, 0x0000, 0x1046, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0FE5, 0x0000, 0x13A4, 0x0000, 0x0000, 0x0202, 0x0000, 0x12F5, 0x110A, 0x06A3, 0x0BD2, 0x0000, 0x05D9, 0x111B, 0x084A, 0x0000,
+    0x0000, 0x0046, 0x0A7F, 0x09C3, 0x056B, 0x05F5, 0x0000, 0x0F20, 0x0ED8, 0x0C3D, 0x0E59, 0x0F76, 0x112B, 0x03F3, 0x1107, 0x12E4,
+    0x0C3E, 0x0FE1, 0x0786, 0x0634, 0x1223, 0x1000, 0x134E, 0x02B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D9B, 0x084E,
+    0x00DE, 0x0000, 0x0000, 0x0D97, 0x0D63, 0x103B, 0x0000, 0x1218, 0x0D41, 0x0000, 0x0F32, 0x0173, 0x117A, 0x012C, 0x0000, 0x02EB,
+    0x041E, 0x0EDB, 0x0DF9, 0x0000, 0x0000, 0x027E, 0x1333, 0x0000, 0x0000, 0x0CAD, 0x0F63, 0x120B, 0x063A, 0x0000, 0x1055, 0x1382,
+    0x0000, 0x0000, 0x0000, 0x0F18, 0x0CD7, 0x0C1E, 0x097F, 0x0000, 0x05B4, 0x0000, 0x08DD, 0x0000, 0x132E, 0x0664, 0x126E, 0x0000,
+    0x0407, 0x0000, 0x0000, 0x0AB0, 0x0000, 0x0151, 0x0581, 0x0000, 0x0FC3, 0x065C, 0x01B9, 0x040E, 0x0A80, 0x038E, 0x0EAC, 0x0FCF,
+    0x008F, 0x02B9, 0x0000, 0x0D4B, 0x022C, 0x0103, 0x0000, 0x0EB0, 0x06B4, 0x0C1F, 0x0CB0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1326,
+    0x0F5B, 0x029E, 0x0A84, 0x0389, 0x0000, 0x123A, 0x0355, 0x06F4, 0x0000, 0x0000, 0x0E40, 0x0000, 0x0F05, 0x1262, 0x0937, 0x12E5,
+    0x13E1, 0x0C89, 0x0144, 0x129D, 0x0000, 0x0000, 0x0000, 0x034C, 0x0000, 0x04BA, 0x09C2, 0x0036, 0x0812, 0x1129, 0x0000, 0x0000,
+    0x0000, 0x025F, 0x1186, 0x0B1F, 0x03F1, 0x0000, 0x06DB, 0x0000, 0x0000, 0x0700, 0x0F25, 0x1413, 0x1380, 0x0000, 0x0D56, 0x08D2,
+    0x08B0, 0x0000, 0x0F40, 0x0000, 0x0FEC, 0x0474, 0x0000, 0x0026, 0x0DAE, 0x0062, 0x0BCC, 0x0A78, 0x03C8, 0x1294, 0x0000, 0x074D,
+    0x0CC7, 0x0008, 0x0D87, 0x07D0, 0x0AC6, 0x0000, 0x0FA5, 0x0398, 0x0112, 0x0000, 0x0000, 0x0371, 0x0000, 0x0DBC, 0x1389, 0x0E9B,
+    0x09FE, 0x057A, 0x0D6C, 0x0000, 0x0000, 0x008B, 0x0000, 0x0000, 0x1003, 0x0000, 0x0000, 0x1260, 0x02C5, 0x0AF0, 0x08B7, 0x0212,
+    0x0000, 0x0201, 0x0000, 0x0214, 0x075D, 0x0FE7, 0x045B, 0x0000, 0x0D07, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B43,
+    0x0000, 0x0000, 0x0000, 0x0E77, 0x087B, 0x09B0, 0x0A1D, 0x0241, 0x0325, 0x0000, 0x0301, 0x0000, 0x0DD4, 0x0000, 0x0000, 0x0E31,
+    0x0000, 0x0667, 0x0000, 0x0000, 0x005D, 0x0229, 0x01EF, 0x0000, 0x0000, 0x0042, 0x0000, 0x01EB, 0x0AC3, 0x1355, 0x1302, 0x00D9,
+    0x0000, 0x0BDF, 0x1108, 0x0000, 0x0000, 0x0815, 0x0FF7, 0x0000, 0x10F3, 0x0F77, 0x0000, 0x0000, 0x12EA, 0x0000, 0x0841, 0x0227,
+    0x12DB, 0x0044, 0x06C3, 0x1111, 0x0000, 0x0096, 0x0000, 0x0055, 0x0000, 0x03D4, 0x0527, 0x09F5, 0x12AF, 0x113C, 0x0BA3, 0x0000,
+    0x0F0B, 0x0000, 0x0000, 0x0B35, 0x10B1, 0x08C5, 0x0A26, 0x0607, 0x0000, 0x0150, 0x0000, 0x0000, 0x02CE, 0x0000, 0x1378, 0x0E11,
+    0x0CFD, 0x0C7F, 0x0000, 0x0405, 0x0000, 0x0EA4, 0x0000, 0x103D, 0x0000, 0x13D3, 0x082B, 0x0E04, 0x05E7, 0x1263, 0x0E83, 0x0CD2,
+    0x0D7C, 0x0000, 0x0676, 0x0000, 0x0D43, 0x0000, 0x0000, 0x0000, 0x08BB, 0x0000, 0x0000, 0x09D2, 0x0E4B, 0x0000, 0x0A03, 0x0D57,
+    0x0000, 0x0000, 0x0E84, 0x122B, 0x0000, 0x0128, 0x13CB, 0x0CBF, 0x0000, 0x063D, 0x1419, 0x0B75, 0x0BC1, 0x111A, 0x0000, 0x0E99,
+    0x080D, 0x0CBE, 0x10A2, 0x0000, 0x0F54, 0x0000, 0x0000, 0x03AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C7D, 0x0000, 0x0662, 0x1300,
+    0x015D, 0x0875, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0CD3, 0x0000, 0x0AAA, 0x0000, 0x0000, 0x0000, 0x026D,
+    0x05F9, 0x0291, 0x05E3, 0x072C, 0x104D, 0x0A86, 0x05DE, 0x07DA, 0x0BA7, 0x0C26, 0x0000, 0x0000, 0x0000, 0x0451, 0x023C, 0x040C,
+    0x0AC2, 0x0000, 0x0000, 0x0E45, 0x0187, 0x0B5A, 0x0133, 0x0000, 0x0000, 0x13DB, 0x0905, 0x1402, 0x05BA, 0x0FDF, 0x0DD6, 0x02C6,
+    0x08BE, 0x0000, 0x0000, 0x0B32, 0x0830, 0x0369, 0x0473, 0x0000, 0x0000, 0x0A73, 0x0225, 0x03CE, 0x0000, 0x12F2, 0x0000, 0x0000,
+    0x1060, 0x05C5, 0x0000, 0x0B1B, 0x0000, 0x0000, 0x0000, 0x0A58, 0x0000, 0x1088, 0x00ED, 0x1231, 0x0C6C, 0x0ACF, 0x0000, 0x0C02,
+    0x0936, 0x1418, 0x0000, 0x13AD, 0x0566, 0x12BF, 0x0E0F, 0x11A7, 0x1372, 0x124D, 0x0000, 0x012A, 0x0000, 0x0A53, 0x0000, 0x1353,
+    0x0A08, 0x01AF, 0x0F9C, 0x0740, 0x0129, 0x0000, 0x0000, 0x0000, 0x0925, 0x0350, 0x09E6, 0x0000, 0x11C6, 0x1379, 0x0000, 0x09E4,
+    0x0D5E, 0x0000, 0x0000, 0x0A3F, 0x034D, 0x0000, 0x0000, 0x0000, 0x032C, 0x0DFD, 0x05C0, 0x0000, 0x110D, 0x02C3, 0x0000, 0x0B7F,
+    0x101A, 0x0000, 0x0000, 0x0168, 0x0E06, 0x0697, 0x0104, 0x0BBE, 0x033A, 0x1010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C3B, 0x0C15,
+    0x13A3, 0x042D, 0x03B4, 0x02E8, 0x0D0D, 0x0000, 0x0324, 0x09E2, 0x0000, 0x0000, 0x0116, 0x0000, 0x0E73, 0x1135, 0x07F0, 0x0EFB,
+    0x0118, 0x105D, 0x0A10, 0x0000, 0x0000, 0x0000, 0x0000, 0x0988, 0x0192, 0x0000, 0x0000, 0x0000, 0x0034, 0x0EE3, 0x0000, 0x086A,
+    0x01B6, 0x0000, 0x116F, 0x0000, 0x10AB, 0x0000, 0x0F3B, 0x0000, 0x0000, 0x0DDD, 0x0464, 0x0000, 0x109B, 0x059E, 0x0000, 0x092E,
+    0x0000, 0x0000, 0x023E, 0x1212, 0x141F, 0x024D, 0x05A5, 0x022E, 0x0000, 0x0000, 0x0000, 0x039E, 0x0790, 0x107B, 0x0665, 0x01A7,
+    0x0000, 0x0000, 0x0317, 0x0000, 0x0586, 0x0CE8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0072, 0x1424, 0x114D, 0x1416, 0x08B1,
+    0x0741, 0x1328, 0x0770, 0x0000, 0x078E, 0x0BBF, 0x0F38, 0x122F, 0x0F0D, 0x033D, 0x0000, 0x0000, 0x0D10, 0x0000, 0x0990, 0x07E7,
+    0x10E9, 0x052B, 0x0000, 0x0E33, 0x13A7, 0x128B, 0x075B, 0x0139, 0x0EC0, 0x0000, 0x0BC9, 0x0C4C, 0x0E6D, 0x0EB6, 0x0000, 0x131F,
+    0x0000, 0x0C5B, 0x1410, 0x0000, 0x06CB, 0x0DE9, 0x0000, 0x0000, 0x0797, 0x10D1, 0x0000, 0x101D, 0x0000, 0x04E3, 0x0D49, 0x0000,
+    0x0000, 0x06E6, 0x0000, 0x095B, 0x0879, 0x105C, 0x0000, 0x0417, 0x0000, 0x0E0A, 0x08B9, 0x065D, 0x084D, 0x0000, 0x0000, 0x0000,
+    0x076A, 0x0F06, 0x0000, 0x051B, 0x10A4, 0x050E, 0x0000, 0x0000, 0x0F94, 0x0000, 0x0000, 0x0CF8, 0x0000, 0x0000, 0x088E, 0x07E2,
+    0x0000, 0x0000, 0x0B3F, 0x0895, 0x1146, 0x0000, 0x0CC8, 0x04F5, 0x0B2A, 0x0262, 0x11AF, 0x0000, 0x1136, 0x1083, 0x1077, 0x1176,
+    0x002A, 0x0E9E, 0x0000, 0x0E4E, 0x0EE4, 0x079A, 0x0000, 0x0000, 0x0E10, 0x0AC1, 0x0BF2, 0x0117, 0x0643, 0x0A9E, 0x0000, 0x00C4,
+    0x0D9D, 0x02EF, 0x0FA1, 0x0000, 0x0000, 0x0E91, 0x02E1, 0x0000, 0x10CB, 0x00E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0504,
+    0x09AF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0629, 0x09FD, 0x08B2, 0x0F6E, 0x0256, 0x098E, 0x0234, 0x0F3C, 0x07AA, 0x067E,
+    0x0000, 0x0000, 0x02AD, 0x0F8C, 0x1153, 0x11CE, 0x0000, 0x0000, 0x0A1F, 0x09C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000,
+    0x119C, 0x030F, 0x0000, 0x0C1C, 0x0FCA, 0x0000, 0x0F12, 0x0000, 0x0F2B, 0x0305, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B56, 0x0000,
+    0x11C0, 0x10FD, 0x0000, 0x0594, 0x0000, 0x1393, 0x0AF7, 0x029A, 0x095F, 0x005B, 0x0BEA, 0x0E63, 0x0000, 0x0627, 0x0E5D, 0x02D4,
+    0x11C1, 0x0000, 0x010E, 0x0000, 0x0000, 0x0000, 0x1182, 0x03B7, 0x0000, 0x0399, 0x0000, 0x10FE, 0x096C, 0x0C83, 0x0049, 0x0C01,
+    0x0BAB, 0x035D, 0x0000, 0x0B0F, 0x0000, 0x138A, 0x0000, 0x0F84, 0x0000, 0x06E0, 0x0CEC, 0x0C28, 0x0463, 0x0BB8, 0x0E25, 0x013D,
+    0x0000, 0x042F, 0x0EDE, 0x01F1, 0x11F4, 0x0000, 0x1020, 0x12FA, 0x0000, 0x0131, 0x0138, 0x0D39, 0x1318, 0x0000, 0x0000, 0x0E57,
+    0x0868, 0x1221, 0x0D5F, 0x03A0, 0x0000, 0x1210, 0x0102, 0x0000, 0x0000, 0x04D0, 0x0A32, 0x0000, 0x03A4, 0x0000, 0x09BB, 0x0000,
+    0x0AE7, 0x0000, 0x0000, 0x1198, 0x0000, 0x062D, 0x0000, 0x0D3A, 0x0030, 0x0000, 0x0000, 0x00D5, 0x09B6, 0x0B20, 0x096B, 0x0427,
+    0x0F69, 0x0000, 0x0000, 0x07A3, 0x049F, 0x0000, 0x0000, 0x0E19, 0x0000, 0x0A63, 0x0A55, 0x02B3, 0x0375, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x08A0, 0x0000, 0x05FC, 0x1235, 0x13CC, 0x0135, 0x0E27, 0x0289, 0x1371, 0x04E0, 0x0000, 0x0000, 0x07FF, 0x02B8, 0x01AA,
+    0x0000, 0x0000, 0x0000, 0x1098, 0x120D, 0x0D4C, 0x11D1, 0x0710, 0x0559, 0x064B, 0x07A8, 0x0BFC, 0x02E5, 0x0EA7, 0x12FF, 0x0809,
+    0x0BA4, 0x0D94, 0x0D7A, 0x0866, 0x0000, 0x001B, 0x0B03, 0x0B6B, 0x0DFB, 0x11EF, 0x0000, 0x0CD9, 0x0000, 0x0FB3, 0x0EA1, 0x0C5C,
+    0x0E79, 0x0033, 0x02BD, 0x0132, 0x0000, 0x0B1D, 0x077C, 0x0FC8, 0x0000, 0x0000, 0x01C9, 0x0000, 0x0000, 0x0000, 0x1390, 0x0000,
+    0x0000, 0x0C55, 0x0CED, 0x13D5, 0x0AE1, 0x0888, 0x0000, 0x0C8C, 0x10BD, 0x0157, 0x0000, 0x00FC, 0x1356, 0x0998, 0x0A75, 0x071D,
+    0x06E2, 0x122E, 0x0000, 0x0083, 0x076B, 0x0F6D, 0x10CA, 0x08FD, 0x0000, 0x0AA8, 0x0000, 0x0000, 0x01DF, 0x0000, 0x13A9, 0x06C7,
+    0x0000, 0x0F65, 0x1251, 0x0864, 0x0000, 0x0000, 0x1158, 0x0000, 0x03A6, 0x09CA, 0x0032, 0x1429, 0x10B7, 0x112C, 0x0000, 0x0294,
+    0x0252, 0x0F5C, 0x057C, 0x04BE, 0x0000, 0x02E7, 0x0113, 0x12D8, 0x0CE3, 0x0E76, 0x0000, 0x0000, 0x13CD, 0x0000, 0x0996, 0x016E,
+    0x0247, 0x11B2, 0x0D0A, 0x0000, 0x0000, 0x05F1, 0x0000, 0x095E, 0x12DF, 0x1190, 0x1398, 0x0000, 0x0568, 0x0000, 0x110B, 0x0CF3,
+    0x125A, 0x0B26, 0x092B, 0x080B, 0x0000, 0x0079, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11C2, 0x083C, 0x00A6, 0x0000, 0x043A,
+    0x0695, 0x09BF, 0x0000, 0x0000, 0x0B7A, 0x08F7, 0x0000, 0x0FEE, 0x0000, 0x07E9, 0x0000, 0x12AB, 0x0000, 0x05B5, 0x121C, 0x0BAF,
+    0x0B45, 0x03FC, 0x0C6B, 0x0000, 0x1259, 0x0000, 0x0E68, 0x06B1, 0x0FFD, 0x0708, 0x0287, 0x015B, 0x0000, 0x0F55, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x119D, 0x04AE, 0x00D0, 0x0C06, 0x0000, 0x0693, 0x0000, 0x1243, 0x0052, 0x008A, 0x0000, 0x0000,
+    0x0450, 0x0DC5, 0x1141, 0x0293, 0x0000, 0x0000, 0x0B57, 0x12BD, 0x0000, 0x0000, 0x0587, 0x08D4, 0x06F0, 0x0000, 0x047B, 0x0F68,
+    0x0000, 0x101F, 0x0000, 0x0B3D, 0x088B, 0x0159, 0x0AF3, 0x0000, 0x02B4, 0x0C65, 0x0FE4, 0x12CB, 0x0000, 0x0333, 0x0000, 0x12E9,
+    0x1313, 0x0CB4, 0x1061, 0x0000, 0x0A4D, 0x0000, 0x0000, 0x01A2, 0x0000, 0x0C80, 0x0F79, 0x03F8, 0x02FB, 0x0000, 0x0F2E, 0x02C2,
+    0x0000, 0x0000, 0x13CA, 0x1078, 0x0965, 0x0000, 0x0BDB, 0x12DE, 0x0C91, 0x0537, 0x0971, 0x0000, 0x0549, 0x0914, 0x0000, 0x09DE,
+    0x0F1D, 0x0AE3, 0x085F, 0x06EF, 0x0BB9, 0x10F4, 0x0C69, 0x0000, 0x0000, 0x0000, 0x05C2, 0x02BE, 0x0FD9, 0x0000, 0x0000, 0x0C2F,
+    0x0000, 0x008D, 0x08AA, 0x0000, 0x12B8, 0x0000, 0x11CF, 0x038A, 0x08AB, 0x0000, 0x086B, 0x0A00, 0x0715, 0x0000, 0x083E, 0x0953,
+    0x09A8, 0x0056, 0x0000, 0x0508, 0x0000, 0x05CF, 0x0000, 0x0ACE, 0x0003, 0x0C64, 0x0CA0, 0x0000, 0x07B7, 0x1018, 0x0000, 0x0B95,
+    0x0342, 0x10D7, 0x0B47, 0x11FD, 0x0000, 0x0E7D, 0x05E0, 0x0000, 0x0A36, 0x060D, 0x0000, 0x1228, 0x0147, 0x0000, 0x137C, 0x0000,
+    0x0000, 0x0000, 0x115B, 0x0000, 0x0CDF, 0x0000, 0x1439, 0x0B78, 0x1369, 0x056C, 0x0000, 0x0000, 0x02DD, 0x06C0, 0x03DE, 0x0000,
+    0x0B76, 0x098F, 0x0028, 0x1293, 0x0616, 0x0000, 0x025B, 0x1184, 0x0000, 0x0000, 0x0C08, 0x0000, 0x0000, 0x0EBE, 0x11B9, 0x0F96,
+    0x0000, 0x0000, 0x0B68, 0x0B13, 0x137B, 0x0939, 0x13D0, 0x0000, 0x0000, 0x0A90, 0x0681, 0x1359, 0x0000, 0x0000, 0x06EB, 0x0000,
+    0x0000, 0x0FB9, 0x0B1E, 0x0000, 0x0DA9, 0x0000, 0x09E8, 0x0000, 0x0968, 0x0235, 0x006D, 0x0A52, 0x0F4B, 0x0000, 0x0000, 0x0904,
+    0x028B, 0x0D9F, 0x0000, 0x0000, 0x0F6A, 0x0000, 0x0000, 0x10F1, 0x07CC, 0x1052, 0x0000, 0x06C8, 0x0000, 0x0381, 0x058E, 0x03D2,
+    0x07DC, 0x119A, 0x03CD, 0x0000, 0x0000, 0x0517, 0x0000, 0x0EAF, 0x0D71, 0x0C32, 0x02C7, 0x0D59, 0x027F, 0x0C9F, 0x1391, 0x01F5,
+    0x0255, 0x0000, 0x0000, 0x0000, 0x1175, 0x0000, 0x0B79, 0x0E9A, 0x11B4, 0x0000, 0x0000, 0x08D8, 0x1234, 0x0FAD, 0x0000, 0x11D3,
+    0x07BF, 0x0F59, 0x1244, 0x0000, 0x0000, 0x0000, 0x0576, 0x0404, 0x039B, 0x0000, 0x09CC, 0x0000, 0x0654, 0x0516, 0x0000, 0x0000,
+    0x1181, 0x086C, 0x0110, 0x0000, 0x0341, 0x0000, 0x0000, 0x0000, 0x017C, 0x11E2, 0x1420, 0x0000, 0x0B60, 0x0000, 0x049E, 0x0F95,
+    0x0000, 0x074A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0AB4, 0x129E, 0x09B1, 0x0D4A, 0x00CC, 0x0D81, 0x0000, 0x0315, 0x06A1, 0x12F3,
+    0x107A, 0x0C48, 0x1270, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x039C, 0x0000, 0x0FE8, 0x0ADB, 0x02E0, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x10C4, 0x0B38, 0x01D5, 0x13CE, 0x02F9, 0x0C30, 0x013B, 0x0995, 0x0D42, 0x124B, 0x0B62, 0x0A29, 0x0FFA, 0x0F5E, 0x0228,
+    0x0C9B, 0x0AC5, 0x0000, 0x11C5, 0x0A85, 0x0000, 0x0FCD, 0x0000, 0x0000, 0x031C, 0x1252, 0x03C0, 0x088F, 0x02FE, 0x01B4, 0x06BD,
+    0x047A, 0x1385, 0x057B, 0x04D2, 0x0000, 0x0D88, 0x100C, 0x0000, 0x0000, 0x0723, 0x0000, 0x0000, 0x0000, 0x0000, 0x0394, 0x0000,
+    0x0E05, 0x1109, 0x01D4, 0x03B6, 0x023B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00F3, 0x127E, 0x0000, 0x0000, 0x0ACA, 0x0000,
+    0x09F4, 0x0285, 0x0DC8, 0x0000, 0x0000, 0x10EF, 0x13FC, 0x0653, 0x0F7A, 0x0A14, 0x1207, 0x0000, 0x0F4C, 0x0000, 0x0AC8, 0x0000,
+    0x0BCA, 0x0000, 0x0EA5, 0x053C, 0x0000, 0x08CE, 0x0DF6, 0x0000, 0x0000, 0x0000, 0x0401, 0x0000, 0x03C3, 0x016F, 0x0E48, 0x08E7,
+    0x126C, 0x029D, 0x0000, 0x10B4, 0x0F5A, 0x0000, 0x0000, 0x07C0, 0x0019, 0x0000, 0x0D25, 0x0000, 0x065B, 0x0E85, 0x0000, 0x0000,
+    0x0330, 0x0000, 0x0000, 0x082A, 0x0FC4, 0x0000, 0x11EC, 0x13F0, 0x044C, 0x0000, 0x0622, 0x0000, 0x0813, 0x0C2C, 0x0D46, 0x0446,
+    0x0000, 0x0F36, 0x04D4, 0x05A9, 0x0000, 0x0EE5, 0x1030, 0x0000, 0x09B3, 0x07A1, 0x0000, 0x05C4, 0x068A, 0x0000, 0x0AF2, 0x09EA,
+    0x07CF, 0x0000, 0x0AF8, 0x07C7, 0x0ADC, 0x0000, 0x0685, 0x0000, 0x1024, 0x0FA8, 0x0B81, 0x0303, 0x07D7, 0x135B, 0x00FB, 0x0C9C,
+    0x0122, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x009C, 0x0AA6, 0x1118, 0x0000, 0x0A68, 0x056F, 0x0B2D, 0x0713, 0x08EB, 0x0000,
+    0x0000, 0x0839, 0x0421, 0x0000, 0x0000, 0x0CD0, 0x096A, 0x0000, 0x0000, 0x09CD, 0x02A9, 0x0F04, 0x02AE, 0x0000, 0x0000, 0x0F0E,
+    0x0E87, 0x1147, 0x02FF, 0x0000, 0x0AEA, 0x1079, 0x090F, 0x0000, 0x0000, 0x0000, 0x0A4F, 0x0933, 0x0D33, 0x0000, 0x0577, 0x0000,
+    0x0000, 0x0B52, 0x0874, 0x0000, 0x088A, 0x0000, 0x090D, 0x0000, 0x0000, 0x1366, 0x0000, 0x0000, 0x041D, 0x0000, 0x0000, 0x0C14,
+    0x0000, 0x0792, 0x12DA, 0x00DD, 0x1183, 0x0CFE, 0x09F6, 0x0000, 0x0ED1, 0x06C6, 0x039F, 0x0000, 0x12F6, 0x0ED2, 0x054E, 0x0000,
+    0x0000, 0x106D, 0x0000, 0x1288, 0x0000, 0x018A, 0x0F39, 0x0FA9, 0x12D5, 0x0000, 0x0000, 0x00FA, 0x13A2, 0x0178, 0x0000, 0x08F9,
+    0x0000, 0x0175, 0x03E6, 0x0000, 0x0000, 0x0000, 0x037D, 0x0B7C, 0x06AD, 0x0C71, 0x0271, 0x0000, 0x13F6, 0x0226, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0F7D, 0x0000, 0x0000, 0x0E54, 0x0DCB, 0x0827, 0x0B3E, 0x1063, 0x0856, 0x0352, 0x0000, 0x01D6, 0x044D, 0x0D84,
+    0x0000, 0x0F6F, 0x0000, 0x0A31, 0x0000, 0x10FA, 0x0D9C, 0x0000, 0x0000, 0x0194, 0x0000, 0x075F, 0x03E3, 0x0000, 0x1117, 0x0000,
+    0x0000, 0x0CCA, 0x13D9, 0x0000, 0x078C, 0x0000, 0x0000, 0x0CCF, 0x0000, 0x1437, 0x0758, 0x0000, 0x05CD, 0x0D76, 0x0087, 0x0C04,
+    0x13DF, 0x0000, 0x0D78, 0x0186, 0x0000, 0x0F78, 0x0000, 0x1351, 0x0000, 0x0000, 0x01C0, 0x0000, 0x0000, 0x0DFA, 0x0AB3, 0x1283,
+    0x0000, 0x0000, 0x0E14, 0x0FFE, 0x0000, 0x00D3, 0x06C1, 0x0000, 0x004C, 0x0000, 0x069A, 0x0000, 0x0C49, 0x0000, 0x0000, 0x0000,
+    0x04CB, 0x0BD3, 0x0000, 0x0FA0, 0x0000, 0x013A, 0x0041, 0x1348, 0x0000, 0x0000, 0x0000, 0x06C2, 0x003A, 0x01F7, 0x0C09, 0x0000,
+    0x0000, 0x0859, 0x0000, 0x0000, 0x0000, 0x0000, 0x01EE, 0x0023, 0x0E15, 0x0E0B, 0x0000, 0x0000, 0x0199, 0x019B, 0x128D, 0x0000,
+    0x0DB2, 0x0A7C, 0x07CD, 0x049C, 0x0000, 0x0432, 0x0000, 0x0000, 0x0D8E, 0x0000, 0x0000, 0x0987, 0x0000, 0x0E36, 0x0A8B, 0x0000,
+    0x0184, 0x0C79, 0x0000, 0x1038, 0x014B, 0x0000, 0x1373, 0x02C9, 0x032D, 0x0000, 0x03D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0902,
+    0x0000, 0x0D79, 0x0000, 0x0000, 0x04A1, 0x0000, 0x1167, 0x0000, 0x0918, 0x0FFF, 0x0000, 0x1037, 0x075A, 0x036F, 0x0000, 0x0FB8,
+    0x0000, 0x0A9F, 0x0164, 0x0000, 0x0736, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0603, 0x0000, 0x0000, 0x096E, 0x0174, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x10FB, 0x0000, 0x0AB9, 0x0000, 0x0314, 0x0000, 0x0058, 0x0633, 0x0EEB, 0x0000, 0x0000, 0x0000, 0x0893,
+    0x0108, 0x0000, 0x0000, 0x0000, 0x043D, 0x0703, 0x05FB, 0x0000, 0x0CC4, 0x0000, 0x0B4E, 0x0483, 0x0753, 0x0E64, 0x0000, 0x077D,
+    0x0000, 0x0950, 0x0000, 0x0C34, 0x0CD1, 0x134B, 0x01F3, 0x0C19, 0x0A4B, 0x0CF0, 0x04DC, 0x0000, 0x0000, 0x0960, 0x0000, 0x0000,
+    0x017A, 0x0000, 0x0000, 0x0000, 0x00F1, 0x0000, 0x0F70, 0x0000, 0x024B, 0x066F, 0x09AA, 0x1115, 0x0000, 0x0C4A, 0x0000, 0x0000,
+    0x0F7C, 0x046D, 0x0000, 0x0B9C, 0x0D12, 0x0000, 0x0000, 0x05F6, 0x0360, 0x0DCA, 0x0948, 0x05C7, 0x0A59, 0x082C, 0x0921, 0x10DE,
+    0x0011, 0x0554, 0x0000, 0x10E2, 0x1217, 0x0000, 0x085E, 0x0000, 0x0ADA, 0x0000, 0x07F1, 0x0AEB, 0x1406, 0x0571, 0x0000, 0x0CFB,
+    0x03E1, 0x0931, 0x105A, 0x0000, 0x0000, 0x0000, 0x0FF5, 0x1308, 0x06C9, 0x100B, 0x0608, 0x0EF3, 0x0000, 0x122A, 0x10D8, 0x0000,
+    0x08C0, 0x0860, 0x062A, 0x097C, 0x00C1, 0x0000, 0x08B6, 0x0000, 0x0548, 0x0F1F, 0x0698, 0x0000, 0x0807, 0x01C2, 0x0000, 0x09D5,
+    0x0E1B, 0x0370, 0x00FD, 0x08A8, 0x13D1, 0x0000, 0x043E, 0x089D, 0x131C, 0x0CFF, 0x0000, 0x0169, 0x0579, 0x01DE, 0x0000, 0x09C5,
+    0x072F, 0x0D93, 0x0000, 0x0A40, 0x0A35, 0x07D9, 0x02F1, 0x035E, 0x05DC, 0x05A0, 0x0000, 0x0000, 0x0000, 0x0CC3, 0x114A, 0x0000,
+    0x0000, 0x0000, 0x07D8, 0x03AE, 0x0000, 0x0000, 0x0000, 0x04AF, 0x0000, 0x0000, 0x0A51, 0x0A54, 0x0000, 0x01D9, 0x06D9, 0x074C,
+    0x08AE, 0x0BB2, 0x108F, 0x0000, 0x00A8, 0x0BC2, 0x00B4, 0x1428, 0x1166, 0x10EE, 0x0FB2, 0x0784, 0x0000, 0x0C43, 0x11BC, 0x0BE1,
+    0x0000, 0x0A95, 0x0000, 0x0791, 0x0AD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x107F, 0x0000, 0x00B1, 0x0000, 0x0248, 0x0A72, 0x0392,
+    0x07EC, 0x07C4, 0x0000, 0x0C98, 0x068C, 0x0D6F, 0x0646, 0x0806, 0x07E4, 0x0A5E, 0x1137, 0x0B97, 0x0000, 0x12E0, 0x0000, 0x0553,
+    0x10B9, 0x0000, 0x0000, 0x0C72, 0x1426, 0x0282, 0x0000, 0x0A1E, 0x0E23, 0x0386, 0x0D7E, 0x0000, 0x0E61, 0x0000, 0x002F, 0x1039,
+    0x0000, 0x0865, 0x0000, 0x02E6, 0x0000, 0x12AC, 0x0000, 0x08E6, 0x13B0, 0x0000, 0x0025, 0x0F72, 0x0AD4, 0x0FF2, 0x0F6B, 0x0A3E,
+    0x0000, 0x0000, 0x03FB, 0x0000, 0x04A8, 0x0000, 0x0C21, 0x0000, 0x06AE, 0x0000, 0x0AF6, 0x0000, 0x0000, 0x0469, 0x0670, 0x0B09,
+    0x0D8A, 0x0449, 0x12EF, 0x11E3, 0x0A7A, 0x1230, 0x0148, 0x07DD, 0x139C, 0x1240, 0x125B, 0x0000, 0x0000, 0x0000, 0x066E, 0x0000,
+    0x000D, 0x1002, 0x0000, 0x0000, 0x0E8C, 0x0000, 0x1019, 0x06D1, 0x0D3F, 0x0000, 0x0000, 0x048D, 0x0250, 0x0000, 0x0750, 0x075C,
+    0x068E, 0x01BD, 0x0867, 0x0000, 0x0119, 0x0EB4, 0x095D, 0x04BC, 0x0230, 0x0000, 0x0000, 0x02CD, 0x0000, 0x1280, 0x0D20, 0x037F,
+    0x0A4A, 0x0000, 0x1126, 0x0000, 0x0000, 0x0000, 0x0E35, 0x0000, 0x0B7E, 0x0FE9, 0x110F, 0x0000, 0x0E7B, 0x0FC1, 0x0BD9, 0x0000,
+    0x0000, 0x0000, 0x1375, 0x0000, 0x0739, 0x0CDE, 0x0B37, 0x0400, 0x01D2, 0x0838, 0x0000, 0x0730, 0x0000, 0x0000, 0x0CB9, 0x0000,
+    0x0D5B, 0x10B6, 0x0000, 0x0000, 0x0CF7, 0x0645, 0x13BF, 0x0CCC, 0x11D5, 0x03FE, 0x0C9A, 0x0D40, 0x0000, 0x0000, 0x139F, 0x0000,
+    0x06F3, 0x0000, 0x121F, 0x0237, 0x0FB5, 0x10FF, 0x0000, 0x070F, 0x10BF, 0x098B, 0x12F4, 0x06EA, 0x0B02, 0x0000, 0x09B2, 0x0000,
+    0x0000, 0x0B4F, 0x0651, 0x1170, 0x10A3, 0x01DA, 0x0000, 0x03ED, 0x134D, 0x0000, 0x0000, 0x0000, 0x1219, 0x0438, 0x142D, 0x0000,
+    0x0E32, 0x0000, 0x1285, 0x0000, 0x0000, 0x0000, 0x0000, 0x04D9, 0x0073, 0x0000, 0x0376, 0x0000, 0x117F, 0x0000, 0x0000, 0x1281,
+    0x07A4, 0x098C, 0x0000, 0x02D6, 0x0000, 0x117B, 0x0215, 0x0000, 0x06B3, 0x07C9, 0x0595, 0x129B, 0x0EB7, 0x114E, 0x0A6A, 0x0000,
+    0x078A, 0x0000, 0x0000, 0x1143, 0x03BA, 0x0000, 0x1381, 0x0000, 0x10AD, 0x0067, 0x0000, 0x11A3, 0x0927, 0x0816, 0x065F, 0x0000,
+    0x0602, 0x0000, 0x0000, 0x00B8, 0x0000, 0x0000, 0x079C, 0x0000, 0x0000, 0x0000, 0x05D4, 0x0095, 0x0B18, 0x0331, 0x0704, 0x0000,
+    0x0340, 0x0541, 0x0B67, 0x00AD, 0x0000, 0x0DA0, 0x04C8, 0x0000, 0x1239, 0x0000, 0x141A, 0x0000, 0x0000, 0x1068, 0x12BB, 0x07B1,
+    0x0ACB, 0x08F3, 0x095C, 0x0A74, 0x1352, 0x0000, 0x0000, 0x0000, 0x0DAC, 0x0000, 0x0000, 0x0000, 0x041F, 0x100D, 0x0917, 0x0000,
+    0x1071, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x003D, 0x0000, 0x0000, 0x0000, 0x0798, 0x0000, 0x0964, 0x0000, 0x13C4, 0x0000,
+    0x0337, 0x00C5, 0x069F, 0x02CC, 0x1224, 0x07AE, 0x084B, 0x0000, 0x0896, 0x06F6, 0x1303, 0x0000, 0x0000, 0x05F0, 0x0000, 0x0F89,
+    0x0000, 0x0000, 0x0000, 0x0074, 0x1305, 0x0000, 0x0000, 0x048B, 0x0000, 0x0000, 0x0000, 0x0FD8, 0x0000, 0x0000, 0x03A5, 0x066D,
+    0x0D44, 0x0000, 0x02BB, 0x0000, 0x08A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x08B4, 0x0000, 0x13FA, 0x1275, 0x04C3, 0x0000, 0x0000,
+    0x0000, 0x11AB, 0x0FF0, 0x0851, 0x045A, 0x0000, 0x0000, 0x0059, 0x0000, 0x046A, 0x0000, 0x06BC, 0x1017, 0x00CB, 0x0000, 0x0000,
+    0x0500, 0x0000, 0x0D08, 0x0000, 0x0000, 0x0000, 0x0000, 0x085B, 0x12E7, 0x0C33, 0x0000, 0x0346, 0x0DAD, 0x039A, 0x0000, 0x05EF,
+    0x1427, 0x0743, 0x0000, 0x0490, 0x052F, 0x0000, 0x123C, 0x0000, 0x0000, 0x1076, 0x0000, 0x1015, 0x0922, 0x00B3, 0x0E02, 0x0231,
+    0x0000, 0x0AF9, 0x0000, 0x072E, 0x1286, 0x02E9, 0x0000, 0x0000, 0x08A3, 0x0AA4, 0x0000, 0x0CCB, 0x0242, 0x0E21, 0x0B49, 0x0986,
+    0x0AA2, 0x0CE5, 0x0000, 0x0E1F, 0x1242, 0x0000, 0x0000, 0x03E5, 0x056E, 0x12F7, 0x0000, 0x00EC, 0x0AAC, 0x0000, 0x0A3D, 0x0E6E,
+    0x0D73, 0x0000, 0x0BAE, 0x09DD, 0x0000, 0x0000, 0x051F, 0x0000, 0x0CF4, 0x0000, 0x124A, 0x1033, 0x0000, 0x0000, 0x0000, 0x0272,
+    0x11D7, 0x093D, 0x0000, 0x0000, 0x02FC, 0x0000, 0x03E0, 0x07D2, 0x04B3, 0x11AC, 0x0AD3, 0x0000, 0x0000, 0x0854, 0x0000, 0x0903,
+    0x113B, 0x0000, 0x0775, 0x0E3A, 0x0172, 0x0000, 0x0A76, 0x115A, 0x06B6, 0x0000, 0x03B3, 0x0000, 0x0793, 0x05A7, 0x0000, 0x0000,
+    0x1101, 0x0000, 0x0D03, 0x1383, 0x0000, 0x0359, 0x13C0, 0x0000, 0x0ADE, 0x0A9A, 0x035A, 0x0094, 0x0000, 0x0000, 0x0160, 0x0000,
+    0x0C7B, 0x04BB, 0x0CAE, 0x0000, 0x08D5, 0x0393, 0x12B5, 0x0E9C, 0x0E3C, 0x12C7, 0x0000, 0x0000, 0x0BD1, 0x0000, 0x0292, 0x0000,
+    0x0000, 0x0683, 0x07D1, 0x0000, 0x0000, 0x04F7, 0x07FE, 0x097E, 0x0000, 0x0396, 0x00D8, 0x108C, 0x0000, 0x0BC7, 0x0000, 0x0000,
+    0x0000, 0x0F10, 0x0000, 0x0000, 0x0C03, 0x0000, 0x093B, 0x09DC, 0x0B61, 0x0B46, 0x0C11, 0x0000, 0x04CD, 0x0000, 0x04CC, 0x09B5,
+    0x0000, 0x127C, 0x0125, 0x0CA7, 0x0000, 0x0000, 0x109E, 0x0000, 0x0000, 0x0A88, 0x06D8, 0x0000, 0x0000, 0x0913, 0x0353, 0x0000,
+    0x0A79, 0x0B6D, 0x0F83, 0x0D7D, 0x0A1B, 0x0000, 0x11A4, 0x025E, 0x018D, 0x0000, 0x0000, 0x0DC7, 0x0B77, 0x0000, 0x0000, 0x0D36,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00C6, 0x0326, 0x0000, 0x0C53, 0x0319, 0x0000, 0x11BD, 0x0E82, 0x0B58, 0x0631, 0x1343, 0x0000,
+    0x09DF, 0x00FE, 0x13F1, 0x09FB, 0x12A2, 0x0000, 0x1191, 0x138E, 0x0205, 0x0000, 0x0000, 0x050D, 0x0000, 0x0000, 0x0000, 0x0600,
+    0x0B6E, 0x1194, 0x0000, 0x0610, 0x0BDA, 0x0000, 0x0000, 0x10B3, 0x0476, 0x0973, 0x0000, 0x0047, 0x11C3, 0x0000, 0x038F, 0x0000,
+    0x04EC, 0x023A, 0x0000, 0x1022, 0x0000, 0x116E, 0x13AE, 0x0000, 0x010B, 0x08E3, 0x0D3C, 0x0F80, 0x0000, 0x0DE6, 0x037A, 0x0000,
+    0x0843, 0x12A0, 0x0000, 0x0AE9, 0x0E49, 0x0000, 0x0000, 0x11D0, 0x0000, 0x0E1D, 0x1332, 0x0D1D, 0x0000, 0x0F3F, 0x0000, 0x0479,
+    0x08EE, 0x05D2, 0x113D, 0x0C2B, 0x0A8F, 0x0000, 0x0000, 0x0253, 0x0711, 0x0000, 0x0000, 0x0BD7, 0x0000, 0x0000, 0x0D2D, 0x0000,
+    0x0000, 0x0000, 0x02B1, 0x0C36, 0x0437, 0x07B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x1140, 0x0000, 0x00CE, 0x0947, 0x0000, 0x1095,
+    0x0000, 0x0000, 0x0000, 0x142E, 0x0ED4, 0x082F, 0x12E1, 0x1334, 0x0000, 0x009B, 0x00B6, 0x0A9D, 0x0000, 0x0000, 0x08E4, 0x12E2,
+    0x0258, 0x0141, 0x0BB6, 0x0000, 0x0000, 0x0E24, 0x0000, 0x06E3, 0x1295, 0x00C7, 0x02B6, 0x0D09, 0x1185, 0x005E, 0x0F75, 0x0655,
+    0x0273, 0x0EB3, 0x0000, 0x04F0, 0x04A7, 0x10F8, 0x0AB7, 0x0000, 0x0000, 0x055B, 0x0000, 0x0000, 0x13F9, 0x0000, 0x0605, 0x0000,
+    0x0A2B, 0x1365, 0x0C50, 0x0302, 0x0000, 0x0000, 0x0E22, 0x073A, 0x0AC4, 0x120F, 0x0000, 0x0D0B, 0x0000, 0x0000, 0x00EB, 0x0000,
+    0x0FDA, 0x1105, 0x06E1, 0x01D0, 0x127B, 0x11E0, 0x06AF, 0x0000, 0x1204, 0x0B5C, 0x0886, 0x0000, 0x03DD, 0x0926, 0x092D, 0x0000,
+    0x0000, 0x0000, 0x12EE, 0x0BAC, 0x0000, 0x0000, 0x12E3, 0x0182, 0x031B, 0x13EA, 0x067C, 0x116A, 0x03F9, 0x0000, 0x0000, 0x0000,
+    0x0EDA, 0x039D, 0x136D, 0x0000, 0x0000, 0x0000, 0x09C1, 0x0000, 0x08C7, 0x1099, 0x0D1C, 0x0000, 0x0569, 0x0C81, 0x07C6, 0x0000,
+    0x11DC, 0x0928, 0x0000, 0x05A2, 0x0ECF, 0x0000, 0x0C99, 0x1197, 0x11EA, 0x11A0, 0x0000, 0x0FCC, 0x0573, 0x0DB0, 0x00D1, 0x0000,
+    0x00C2, 0x0615, 0x0000, 0x1278, 0x0219, 0x0000, 0x0269, 0x0000, 0x0000, 0x10BA, 0x1080, 0x0000, 0x0000, 0x12BE, 0x0414, 0x0488,
+    0x0521, 0x0DFE, 0x0E3F, 0x0000, 0x102E, 0x0000, 0x0000, 0x0106, 0x0200, 0x0000, 0x0452, 0x05A4, 0x0000, 0x01F8, 0x0A0F, 0x0823,
+    0x0AA0, 0x0915, 0x0000, 0x0E18, 0x134A, 0x0EE8, 0x0000, 0x0064, 0x0D4D, 0x0000, 0x0000, 0x064C, 0x0000, 0x0000, 0x0000, 0x0C29,
+    0x0000, 0x0F02, 0x07DB, 0x04AA, 0x006B, 0x007B, 0x0900, 0x0000, 0x0000, 0x0000, 0x10E7, 0x0ACC, 0x0000, 0x0BEB, 0x07DE, 0x036D,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x02F5, 0x0C23, 0x083A, 0x0000, 0x0F45, 0x034B, 0x0885, 0x0000, 0x110C, 0x0CEB, 0x13C6, 0x0000,
+    0x0000, 0x0000, 0x0B44, 0x0000, 0x0000, 0x092F, 0x061D, 0x068B, 0x053B, 0x0CAA, 0x0A3A, 0x0000, 0x11AD, 0x10B0, 0x0000, 0x0849,
+    0x0000, 0x089F, 0x081F, 0x0833, 0x0000, 0x004B, 0x0B86, 0x0A2C, 0x0000, 0x0563, 0x0430, 0x0000, 0x0000, 0x0773, 0x0F29, 0x0000,
+    0x0612, 0x0000, 0x06F2, 0x0000, 0x087F, 0x0000, 0x073B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C51, 0x0B93, 0x0A81,
+    0x0000, 0x01B3, 0x0081, 0x03E4, 0x0000, 0x0000, 0x0B28, 0x09FA, 0x123E, 0x0776, 0x09D9, 0x0000, 0x0552, 0x0000, 0x10F9, 0x093E,
+    0x0000, 0x0C39, 0x0731, 0x0000, 0x04FF, 0x0E2D, 0x0203, 0x0000, 0x07D6, 0x021F, 0x0000, 0x0000, 0x0000, 0x09ED, 0x0000, 0x0BAD,
+    0x0000, 0x0000, 0x0218, 0x0000, 0x0000, 0x127F, 0x0000, 0x0945, 0x034A, 0x0000, 0x09F0, 0x0A7B, 0x0000, 0x0000, 0x1339, 0x00F6,
+    0x03DC, 0x0000, 0x1065, 0x1319, 0x0842, 0x0000, 0x0316, 0x0000, 0x12FB, 0x0BF7, 0x036B, 0x13C2, 0x08B3, 0x05A6, 0x0000, 0x0000,
+    0x130C, 0x0825, 0x02C0, 0x0000, 0x10FC, 0x0000, 0x0000, 0x011D, 0x0EAA, 0x0678, 0x0000, 0x0000, 0x0338, 0x04E9, 0x0000, 0x0000,
+    0x0D15, 0x0000, 0x08EF, 0x0E6A, 0x13A5, 0x04A5, 0x01DD, 0x0000, 0x1298, 0x00CA, 0x0C76, 0x0E98, 0x008E, 0x0000, 0x0000, 0x13E2,
+    0x0142, 0x0000, 0x0000, 0x0B30, 0x0000, 0x0000, 0x0000, 0x10DF, 0x0000, 0x0000, 0x0000, 0x007A, 0x0000, 0x0E4D, 0x04E7, 0x1423,
+    0x04A9, 0x1160, 0x0000, 0x128F, 0x0000, 0x0000, 0x1139, 0x0304, 0x10F5, 0x0CA8, 0x0000, 0x0000, 0x0000, 0x0000, 0x09BD, 0x0666,
+    0x0F2C, 0x0000, 0x0F07, 0x113A, 0x0000, 0x0416, 0x0000, 0x0000, 0x077A, 0x0C4B, 0x1196, 0x01FC, 0x0000, 0x0663, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x071A, 0x037B, 0x0000, 0x0000, 0x048E, 0x050C, 0x12AA, 0x0000, 0x0F19, 0x0000, 0x0000, 0x0D01, 0x0000, 0x0000,
+    0x0000, 0x04C5, 0x0000, 0x0000, 0x026F, 0x0762, 0x0799, 0x082D, 0x0B8B, 0x0000, 0x111C, 0x118B, 0x0000, 0x0000, 0x0000, 0x0B9D,
+    0x0000, 0x062B, 0x0267, 0x0000, 0x0FC7, 0x13EB, 0x0C46, 0x0000, 0x063F, 0x0C18, 0x1344, 0x0562, 0x0B31, 0x0000, 0x1070, 0x0000,
+    0x0C7E, 0x106C, 0x0000, 0x07B0, 0x0000, 0x0000, 0x022F, 0x0E78, 0x01EC, 0x0774, 0x009F, 0x0CA4, 0x0000, 0x00C0, 0x0D9E, 0x0000,
+    0x0D1B, 0x0000, 0x0000, 0x083D, 0x0000, 0x072D, 0x0000, 0x10C0, 0x0000, 0x13E5, 0x0000, 0x0000, 0x11CC, 0x0ED3, 0x0329, 0x0000,
+    0x0000, 0x0C41, 0x0499, 0x1320, 0x03C9, 0x0000, 0x0384, 0x073C, 0x0000, 0x0000, 0x0501, 0x0000, 0x0000, 0x064F, 0x054A, 0x04A2,
+    0x0000, 0x04FE, 0x0000, 0x0000, 0x0000, 0x0070, 0x0000, 0x068F, 0x0000, 0x0000, 0x0000, 0x0F33, 0x01E9, 0x069B, 0x0000, 0x0B71,
+    0x096F, 0x0000, 0x0B72, 0x0000, 0x03A8, 0x0BA8, 0x0000, 0x0FC6, 0x125C, 0x0000, 0x041C, 0x0ED7, 0x0FF6, 0x00F0, 0x064A, 0x006C,
+    0x052E, 0x0000, 0x0000, 0x123F, 0x0000, 0x0716, 0x0AD6, 0x0707, 0x10AA, 0x0000, 0x0BF0, 0x0080, 0x0D83, 0x0E2A, 0x06A2, 0x1045,
+    0x0000, 0x0E69, 0x08F8, 0x0233, 0x0000, 0x0C47, 0x0223, 0x12DD, 0x07B3, 0x0000, 0x03BF, 0x0000, 0x033F, 0x05C6, 0x0000, 0x07EB,
+    0x1388, 0x0E6F, 0x00B9, 0x0000, 0x010A, 0x0000, 0x1325, 0x0CD5, 0x0F4F, 0x1233, 0x0000, 0x0669, 0x0000, 0x0000, 0x0050, 0x078D,
+    0x0000, 0x0000, 0x089C, 0x081E, 0x12A6, 0x0894, 0x11C9, 0x0E66, 0x0CD4, 0x0000, 0x0000, 0x0000, 0x12F1, 0x0000, 0x0224, 0x0000,
+    0x0489, 0x0C8A, 0x0949, 0x0000, 0x0000, 0x06DC, 0x0AFF, 0x0000, 0x0000, 0x011B, 0x00E4, 0x016A, 0x0000, 0x0000, 0x0098, 0x0000,
+    0x0000, 0x07B2, 0x0000, 0x0BC3, 0x1400, 0x11AA, 0x0000, 0x0000, 0x127A, 0x0000, 0x0EE6, 0x0582, 0x0000, 0x0648, 0x0183, 0x0808,
+    0x1133, 0x0000, 0x0097, 0x01C6, 0x0000, 0x0DE0, 0x0000, 0x0C59, 0x0000, 0x0000, 0x00DA, 0x0000, 0x0BA0, 0x0B84, 0x0000, 0x0000,
+    0x002D, 0x01CE, 0x0000, 0x0000, 0x1203, 0x0DA1, 0x0155, 0x0000, 0x011F, 0x0000, 0x0000, 0x0000, 0x108B, 0x017F, 0x0000, 0x13FB,
+    0x0000, 0x09EF, 0x0F5F, 0x0000, 0x0A1A, 0x0000, 0x036A, 0x0F58, 0x129A, 0x0000, 0x0F9A, 0x1368, 0x0000, 0x0752, 0x0692, 0x0487,
+    0x0000, 0x08C4, 0x0000, 0x0FB4, 0x0000, 0x0000, 0x12AE, 0x0000, 0x0C60, 0x0000, 0x0000, 0x0570, 0x0000, 0x0000, 0x100A, 0x1189,
+    0x0000, 0x0000, 0x0883, 0x0DCD, 0x0000, 0x0000, 0x0000, 0x1358, 0x0642, 0x0000, 0x03AA, 0x0A6E, 0x126B, 0x0000, 0x086E, 0x0000,
+    0x090B, 0x0000, 0x090E, 0x012F, 0x0877, 0x028E, 0x0000, 0x0805, 0x037E, 0x0000, 0x0BC6, 0x0000, 0x0000, 0x007D, 0x07C2, 0x0719,
+    0x0976, 0x0000, 0x059A, 0x0000, 0x0000, 0x10C6, 0x0858, 0x104F, 0x0000, 0x0000, 0x0BF5, 0x0000, 0x08E5, 0x101E, 0x12C3, 0x09D4,
+    0x0000, 0x0618, 0x1087, 0x0000, 0x0F66, 0x03F2, 0x0000, 0x0000, 0x0000, 0x01CB, 0x09D3, 0x058C, 0x130A, 0x09EC, 0x07F9, 0x13C5,
+    0x0D6D, 0x0E8B, 0x0000, 0x0000, 0x0506, 0x0CBA, 0x08FF, 0x0000, 0x0000, 0x0C54, 0x13D6, 0x1041, 0x0000, 0x026E, 0x0821, 0x01E6,
+    0x0000, 0x0923, 0x0000, 0x033E, 0x04A4, 0x0BED, 0x04E2, 0x0CE4, 0x0345, 0x11E1, 0x0000, 0x0024, 0x02DB, 0x0EBC, 0x0000, 0x0000,
+    0x0000, 0x0A23, 0x0B5D, 0x107D, 0x0000, 0x042C, 0x06A9, 0x0000, 0x1165, 0x0455, 0x01EA, 0x0000, 0x0978, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x12F8, 0x0000, 0x1287, 0x0000, 0x1187, 0x0985, 0x0000, 0x0E6C, 0x0000, 0x0000, 0x09A9, 0x0336, 0x105E, 0x0000, 0x0000,
+    0x02F0, 0x0533, 0x055D, 0x0D64, 0x0000, 0x0000, 0x1238, 0x0000, 0x0000, 0x0210, 0x058D, 0x052D, 0x0F82, 0x0000, 0x0F26, 0x0000,
+    0x0000, 0x0C88, 0x0000, 0x04EF, 0x1089, 0x08E1, 0x0000, 0x0000, 0x08FA, 0x0000, 0x0000, 0x0459, 0x0590, 0x0152, 0x030E, 0x080F,
+    0x0DF2, 0x06CD, 0x0000, 0x0729, 0x076F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0390, 0x0982, 0x107E, 0x142A, 0x0000, 0x0000, 0x1178,
+    0x00BF, 0x128C, 0x06DF, 0x0690, 0x0000, 0x0EDC, 0x0DB8, 0x0BA1, 0x0000, 0x0754, 0x066B, 0x0000, 0x0675, 0x0000, 0x0B25, 0x0E4F,
+    0x0FAB, 0x0000, 0x0BE6, 0x0000, 0x0000, 0x0728, 0x02A0, 0x0000, 0x04D3, 0x0000, 0x0000, 0x0000, 0x06D7, 0x1361, 0x031E, 0x0000,
+    0x136B, 0x0BEE, 0x139B, 0x0391, 0x0738, 0x0E4A, 0x0C8B, 0x1114, 0x0000, 0x0726, 0x0433, 0x0000, 0x0000, 0x0000, 0x07D5, 0x0000,
+    0x0000, 0x0B7B, 0x085D, 0x0000, 0x067F, 0x0300, 0x00E8, 0x01E2, 0x13C7, 0x0000, 0x0000, 0x10EA, 0x10E6, 0x0F8A, 0x0000, 0x1012,
+    0x02D8, 0x03E7, 0x0000, 0x0000, 0x0AA5, 0x03AC, 0x0D26, 0x0C3F, 0x0630, 0x0000, 0x0000, 0x0597, 0x0136, 0x045D, 0x1014, 0x0F73,
+    0x0000, 0x0A05, 0x091E, 0x03EB, 0x0751, 0x1208, 0x0000, 0x0000, 0x13DD, 0x0000, 0x0000, 0x00A5, 0x0000, 0x07A5, 0x0759, 0x0A28,
+    0x0B14, 0x1370, 0x0AE5, 0x1149, 0x1081, 0x0CE9, 0x0000, 0x0A11, 0x10C8, 0x08A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E0E, 0x0000,
+    0x0313, 0x0461, 0x094F, 0x0000, 0x0335, 0x0000, 0x1032, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04FB, 0x0000, 0x0196, 0x0010,
+    0x050B, 0x0822, 0x0A6C, 0x0000, 0x0000, 0x019C, 0x0000, 0x124F, 0x0000, 0x1044, 0x10BC, 0x0000, 0x003F, 0x04DF, 0x125D, 0x0ED9,
+    0x0000, 0x11B0, 0x0000, 0x0000, 0x0000, 0x0B48, 0x0000, 0x0000, 0x0000, 0x055C, 0x1387, 0x001A, 0x0000, 0x0000, 0x0146, 0x0000,
+    0x0000, 0x09F2, 0x0000, 0x0BFE, 0x11E6, 0x0D51, 0x0099, 0x0C5D, 0x070B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0092, 0x03A3, 0x10DA,
+    0x0000, 0x0F1E, 0x0DD9, 0x0000, 0x0000, 0x0A5A, 0x01D7, 0x0BF3, 0x0536, 0x0000, 0x0ECC, 0x0A50, 0x0000, 0x0000, 0x0000, 0x0961,
+    0x0DC4, 0x05FA, 0x0CCE, 0x0000, 0x0000, 0x0383, 0x0000, 0x0000, 0x0000, 0x0F42, 0x00D4, 0x0B55, 0x1327, 0x0000, 0x0000, 0x0000,
+    0x138D, 0x0A98, 0x0000, 0x0000, 0x0000, 0x070E, 0x0000, 0x0366, 0x140F, 0x120E, 0x0623, 0x0000, 0x0000, 0x0000, 0x0000, 0x0DC6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0908, 0x0672, 0x1209, 0x064E, 0x1116, 0x0179, 0x1377, 0x0038, 0x0E58, 0x0000, 0x02D5, 0x0485,
+    0x0000, 0x104B, 0x12A8, 0x0B9F, 0x0000, 0x0E7F, 0x0D1A, 0x0983, 0x01B0, 0x00FF, 0x0820, 0x0000, 0x126A, 0x0000, 0x0BC4, 0x0085,
+    0x072A, 0x03F6, 0x0429, 0x1279, 0x0000, 0x0000, 0x0000, 0x0000, 0x0688, 0x018F, 0x13FF, 0x0000, 0x0000, 0x0BDD, 0x11CD, 0x0EE0,
+    0x0000, 0x03B2, 0x0A22, 0x0EF6, 0x06CF, 0x0FFC, 0x1417, 0x0000, 0x09E3, 0x0E3E, 0x052C, 0x0000, 0x101B, 0x0A6D, 0x0000, 0x0000,
+    0x003B, 0x1395, 0x0E5F, 0x06A0, 0x005A, 0x13AA, 0x0000, 0x0000, 0x094D, 0x0270, 0x0000, 0x00DB, 0x0000, 0x0000, 0x0684, 0x0000,
+    0x0000, 0x0891, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A91, 0x06C5, 0x0000, 0x1130, 0x0F08, 0x0170, 0x0000, 0x0000, 0x040A, 0x0000,
+    0x0000, 0x0000, 0x03CA, 0x0000, 0x0E9D, 0x0000, 0x0ABA, 0x0000, 0x0BBA, 0x0EF9, 0x0415, 0x0000, 0x0475, 0x0066, 0x0000, 0x00E1,
+    0x040F, 0x0000, 0x0000, 0x0000, 0x0BFA, 0x0000, 0x1026, 0x0000, 0x0000, 0x0B70, 0x1106, 0x0000, 0x06D0, 0x0000, 0x06BA, 0x030C,
+    0x0000, 0x0924, 0x0000, 0x0D1E, 0x10A5, 0x04E8, 0x0565, 0x0000, 0x0000, 0x0000, 0x04DA, 0x0E8D, 0x036C, 0x0000, 0x0BB5, 0x031F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x139D, 0x051E, 0x0000, 0x0539, 0x059D, 0x1067, 0x0EEC, 0x0D13, 0x0840, 0x0000, 0x0000,
+    0x0000, 0x113F, 0x0000, 0x058F, 0x0835, 0x0ABE, 0x0E6B, 0x0000, 0x07CB, 0x060C, 0x11E9, 0x0000, 0x0C0F, 0x0000, 0x13A8, 0x0B64,
+    0x0000, 0x0000, 0x12C4, 0x116C, 0x0C5A, 0x0332, 0x0889, 0x0000, 0x129F, 0x0DF7, 0x0760, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D1F,
+    0x0408, 0x038C, 0x0920, 0x0DAA, 0x05FD, 0x0C44, 0x0DFC, 0x0000, 0x080E, 0x0911, 0x0DBE, 0x0000, 0x0593, 0x0DED, 0x0000, 0x0CEA,
+    0x0639, 0x0000, 0x0000, 0x0BA9, 0x0000, 0x0000, 0x0492, 0x0F97, 0x0000, 0x04BD, 0x0000, 0x0863, 0x13E4, 0x0000, 0x079B, 0x0000,
+    0x0BF9, 0x086D, 0x0FC5, 0x088C, 0x0000, 0x0000, 0x0480, 0x0000, 0x10D3, 0x0578, 0x08FC, 0x0000, 0x0F4D, 0x0000, 0x0000, 0x01E7,
+    0x0A33, 0x0000, 0x0000, 0x0000, 0x06D4, 0x0000, 0x0000, 0x0000, 0x06AC, 0x0000, 0x0DD7, 0x0B2F, 0x0507, 0x136A, 0x0000, 0x0403,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x07F4, 0x0000, 0x0000, 0x0000, 0x0A5B, 0x0000, 0x12F0, 0x0000, 0x061B, 0x1254, 0x0000, 0x0861,
+    0x0000, 0x0382, 0x0E09, 0x0B50, 0x058A, 0x0B11, 0x0000, 0x0000, 0x0C05, 0x04EA, 0x0000, 0x0000, 0x01DC, 0x0000, 0x0000, 0x0B7D,
+    0x1349, 0x0ECB, 0x0000, 0x0EA9, 0x0000, 0x1097, 0x0000, 0x0B36, 0x06C4, 0x0EC7, 0x0958, 0x0DE5, 0x0000, 0x118C, 0x0000, 0x025A,
+    0x0000, 0x02C8, 0x0000, 0x0022, 0x0195, 0x0000, 0x0000, 0x0000, 0x0B10, 0x0AFE, 0x12C1, 0x09E5, 0x0CEE, 0x1028, 0x0434, 0x0000,
+    0x11A1, 0x09B4, 0x0000, 0x0780, 0x10DB, 0x0053, 0x0916, 0x0000, 0x0000, 0x0000, 0x0037, 0x00C9, 0x03A9, 0x139A, 0x0238, 0x0000,
+    0x0FF8, 0x0000, 0x1376, 0x0000, 0x046C, 0x12D2, 0x0A01, 0x0000, 0x0000, 0x0000, 0x05A8, 0x0453, 0x0625, 0x061A, 0x0FEF, 0x0B0C,
+    0x0A62, 0x0000, 0x0000, 0x0000, 0x11A8, 0x0000, 0x0000, 0x06FA, 0x0F17, 0x0000, 0x0AAE, 0x0A5D, 0x0344, 0x143A, 0x011C, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x00E9, 0x0017, 0x0000, 0x140E, 0x0CC9, 0x089E, 0x10E3, 0x07F3, 0x0B39, 0x0001, 0x0000, 0x120C, 0x0557,
+    0x0951, 0x01F9, 0x0000, 0x0000, 0x0000, 0x11F3, 0x0000, 0x0163, 0x0000, 0x06B7, 0x02EA, 0x0000, 0x0000, 0x0C57, 0x0A8D, 0x11CB,
+    0x0D8C, 0x0F23, 0x0A89, 0x0000, 0x00AA, 0x0D75, 0x019F, 0x0BA2, 0x0307, 0x0000, 0x0299, 0x0000, 0x0000, 0x0000, 0x0000, 0x0EED,
+    0x0E34, 0x0000, 0x0F44, 0x0000, 0x0000, 0x05CA, 0x0828, 0x0265, 0x07F8, 0x0000, 0x0312, 0x0977, 0x1322, 0x00F5, 0x0000, 0x0696,
+    0x0000, 0x0000, 0x0000, 0x0AC7, 0x13BA, 0x0000, 0x0402, 0x0000, 0x0855, 0x0000, 0x0B96, 0x0649, 0x0000, 0x0000, 0x0FAE, 0x1226,
+    0x0D8F, 0x01D3, 0x0A45, 0x13A0, 0x0D22, 0x10AC, 0x0ABF, 0x0A30, 0x10E1, 0x07D3, 0x1436, 0x0EEF, 0x11FB, 0x102D, 0x0000, 0x07BB,
+}};
+
+// Perfect hash by keyword: displacement per bucket, then entry index + 1
+constexpr std::array<uint32_t, 2048> keyword_displacements = {{
+    0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3,
+    0x4C081DBF, 0x3CD6E3F3, 0x1B147DCC, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC,
+    0x3CD6E3F3, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0xD83072E5,
+    0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0x00000000, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3,
+    0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0x3CD6E3F3,
+    0x3CD6E3F3, 0xDB408C9D, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x78BC1B8F, 0x92CA2F0E, 0x00000000,
+    0x4C081DBF, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x1B147DCC,
+    0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x1F4B8CEF, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x3CD6E3F3, 0x1B147DCC, 0x1B147DCC,
+    0xD83072E5, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x78BC1B8F,
+    0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x4C081DBF, 0x4C081DBF, 0x3CD6E3F3, 0x1F4B8CEF, 0x487981AB,
+    0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E,
+    0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0x4C081DBF, 0x1B147DCC, 0x3CD6E3F3,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3,
+    0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D,
+    0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x1B147DCC, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x00000000, 0x78BC1B8F, 0x3CD6E3F3, 0x4C081DBF, 0x3CD6E3F3,
+    0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x92CA2F0E, 0x487981AB, 0x3CD6E3F3,
+    0x92CA2F0E, 0xDB408C9D, 0x1B147DCC, 0x92CA2F0E, 0x78BC1B8F, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E,
+    0x2AA96DD0, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0xDB408C9D,
+    0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0xD83072E5,
+    0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x00000000,
+    0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x1F4B8CEF, 0x3CD6E3F3, 0x3CD6E3F3,
+    0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x00000000, 0x487981AB, 0xDB408C9D,
+    0x92CA2F0E, 0x1B147DCC, 0x78BC1B8F, 0x4C081DBF, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x78BC1B8F,
+    0x92CA2F0E, 0x487981AB, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC,
+    0xDB408C9D, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x487981AB, 0x3CD6E3F3, 0x1B147DCC, 0x00000000, 0x92CA2F0E, 0x00000000, 0x1B147DCC,
+    0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0xDB408C9D, 0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC, 0x4C081DBF,
+    0x00000000, 0xD83072E5, 0x3CD6E3F3, 0x1B147DCC, 0x3CD6E3F3, 0x487981AB, 0x3CD6E3F3, 0x92CA2F0E,
+    0x3CD6E3F3, 0x487981AB, 0x3CD6E3F3, 0x1B147DCC, 0x78BC1B8F, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3,
+    0x1B147DCC, 0x00000000, 0x00000000, 0x3CD6E3F3, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E,
+    0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0x3CD6E3F3, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3,
+    0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF,
+    0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0xDB408C9D, 0x3CD6E3F3, 0xDB408C9D, 0x78BC1B8F,
+    0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x1B147DCC, 0x4C081DBF, 0x00000000, 0x3CD6E3F3,
+    0xDB408C9D, 0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E,
+    0x3CD6E3F3, 0x1B147DCC, 0xD83072E5, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC,
+    0x487981AB, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x1F4B8CEF, 0x1B147DCC, 0x3CD6E3F3, 0xDB408C9D,
+    0x78BC1B8F, 0x4C081DBF, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC,
+    0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3,
+    0xE2AD51BA, 0x92CA2F0E, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x1F4B8CEF, 0x3CD6E3F3, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x00000000,
+    0x487981AB, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x65CBDD54, 0x1B147DCC,
+    0x3CD6E3F3, 0xDB408C9D, 0xD83072E5, 0x3CD6E3F3, 0x4C081DBF, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC, 0x00000000, 0xDB408C9D, 0x00000000, 0x92CA2F0E,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0xDB408C9D, 0xDB408C9D, 0x92CA2F0E,
+    0x1B147DCC, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E,
+    0x1B147DCC, 0x487981AB, 0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x00000000, 0x00000000, 0x00000000,
+    0xDB408C9D, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x00000000,
+    0x00000000, 0x4C081DBF, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x487981AB, 0x487981AB,
+    0x4C081DBF, 0x92CA2F0E, 0x487981AB, 0x1B147DCC, 0x487981AB, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF,
+    0x78BC1B8F, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0xDB408C9D, 0x78BC1B8F, 0x92CA2F0E, 0x1B147DCC,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x1B147DCC,
+    0x4C081DBF, 0x3CD6E3F3, 0x78BC1B8F, 0x00000000, 0x92CA2F0E, 0x65CBDD54, 0x92CA2F0E, 0xDB408C9D,
+    0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0x487981AB, 0x4C081DBF, 0x00000000, 0x00000000, 0x3CD6E3F3,
+    0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x79F70494, 0x1F4B8CEF, 0x00000000, 0x00000000,
+    0x92CA2F0E, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D,
+    0xD83072E5, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x4C081DBF,
+    0x1F4B8CEF, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0xB42BC0B0, 0x00000000, 0x92CA2F0E, 0x00000000,
+    0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x4C081DBF,
+    0x92CA2F0E, 0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x78BC1B8F, 0xDB408C9D, 0x4C081DBF, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x1B147DCC,
+    0x1B147DCC, 0x487981AB, 0xA4523835, 0x4C081DBF, 0x1B147DCC, 0x04E90BF5, 0x1B147DCC, 0x1B147DCC,
+    0x1B147DCC, 0x1B147DCC, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF,
+    0xDB408C9D, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x78BC1B8F, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3,
+    0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x78BC1B8F, 0x1B147DCC, 0x92CA2F0E, 0x00000000,
+    0x1B147DCC, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x3CD6E3F3,
+    0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x487981AB,
+    0x487981AB, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x00000000,
+    0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x487981AB, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x78BC1B8F,
+    0x1F4B8CEF, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x487981AB, 0x1B147DCC, 0x00000000,
+    0x92CA2F0E, 0x00000000, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E,
+    0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3,
+    0xD83072E5, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x4C081DBF,
+    0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x1B147DCC, 0x00000000,
+    0x4C081DBF, 0xB42BC0B0, 0x92CA2F0E, 0x00000000, 0xD83072E5, 0x00000000, 0x1B147DCC, 0x92CA2F0E,
+    0x92CA2F0E, 0xDB408C9D, 0xDB408C9D, 0x487981AB, 0x3CD6E3F3, 0x487981AB, 0x00000000, 0x78BC1B8F,
+    0x78BC1B8F, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x00000000, 0x1B147DCC, 0x3CD6E3F3, 0x4C081DBF,
+    0x487981AB, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x487981AB, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000,
+    0x487981AB, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0xDB408C9D, 0x92CA2F0E, 0x3CD6E3F3,
+    0x92CA2F0E, 0x3CD6E3F3, 0x487981AB, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x1B147DCC,
+    0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E,
+    0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x4C081DBF, 0x4C081DBF, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E,
+    0x92CA2F0E, 0xD83072E5, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E,
+    0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x487981AB,
+    0x92CA2F0E, 0x00000000, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x4C081DBF,
+    0x92CA2F0E, 0xDB408C9D, 0xD83072E5, 0x1B147DCC, 0x1B147DCC, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E,
+    0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x487981AB,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E,
+    0xDB408C9D, 0x00000000, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x00000000, 0x78BC1B8F, 0xDB408C9D,
+    0x487981AB, 0xD83072E5, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x487981AB, 0x1B147DCC,
+    0x010B6880, 0x92CA2F0E, 0x487981AB, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x0231739B, 0x1B147DCC, 0x92CA2F0E,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3,
+    0x487981AB, 0x3CD6E3F3, 0x4C081DBF, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x78BC1B8F,
+    0x4C081DBF, 0x1B147DCC, 0x00000000, 0x4C081DBF, 0xD83072E5, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E,
+    0x1B147DCC, 0x00000000, 0x4C081DBF, 0xDB408C9D, 0x00000000, 0x78BC1B8F, 0x3CD6E3F3, 0x3CD6E3F3,
+    0x487981AB, 0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC,
+    0x3CD6E3F3, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x1B147DCC,
+    0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3,
+    0x4C081DBF, 0x4C081DBF, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E,
+    0x4C081DBF, 0xDB408C9D, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0xD83072E5, 0x1B147DCC,
+    0x00000000, 0x00000000, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E,
+    0xDB408C9D, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x78BC1B8F, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E,
+    0x487981AB, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E,
+    0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E,
+    0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x4C081DBF, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x65CBDD54, 0xD83072E5,
+    0x3CD6E3F3, 0x92CA2F0E, 0x78BC1B8F, 0x3CD6E3F3, 0x00000000, 0xDB408C9D, 0x3CD6E3F3, 0x1B147DCC,
+    0x1F4B8CEF, 0xDB408C9D, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x487981AB, 0xDB408C9D, 0x487981AB,
+    0x00000000, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x79F70494, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0xDB408C9D, 0x92CA2F0E, 0x00000000, 0x010B6880, 0x1B147DCC, 0x91783BB0, 0x4C081DBF,
+    0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0xDB408C9D, 0xDB408C9D, 0x92CA2F0E, 0x65CBDD54, 0x00000000,
+    0x00000000, 0x92CA2F0E, 0xE2AD51BA, 0x00000000, 0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x4C081DBF,
+    0x1B147DCC, 0x92CA2F0E, 0x487981AB, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC,
+    0x92CA2F0E, 0xDB408C9D, 0x3CD6E3F3, 0x1B147DCC, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3,
+    0x1B147DCC, 0x00000000, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E,
+    0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x00000000,
+    0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0xB42BC0B0, 0x00000000, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3,
+    0x3CD6E3F3, 0xB7FBE3E5, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x65CBDD54, 0x92CA2F0E, 0x3CD6E3F3,
+    0x92CA2F0E, 0x4C081DBF, 0xDB408C9D, 0x4C081DBF, 0x92CA2F0E, 0x1B147DCC, 0xD83072E5, 0x78BC1B8F,
+    0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x00000000,
+    0x487981AB, 0x78BC1B8F, 0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3, 0x65CBDD54,
+    0x1B147DCC, 0x1B147DCC, 0x4C081DBF, 0x1B147DCC, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x92CA2F0E, 0x00000000, 0x3CD6E3F3, 0x78BC1B8F, 0x92CA2F0E,
+    0x91783BB0, 0x00000000, 0x3CD6E3F3, 0x1F4B8CEF, 0x91783BB0, 0x2AA96DD0, 0x92CA2F0E, 0x92CA2F0E,
+    0x4C081DBF, 0x3CD6E3F3, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x3CD6E3F3,
+    0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0xDB408C9D, 0x3CD6E3F3, 0x92CA2F0E, 0xDB408C9D,
+    0x3CD6E3F3, 0x1F4B8CEF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x78BC1B8F,
+    0x1B147DCC, 0x92CA2F0E, 0x487981AB, 0x3CD6E3F3, 0x4C081DBF, 0x1B147DCC, 0x92CA2F0E, 0x65CBDD54,
+    0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0x1B147DCC, 0x1F4B8CEF, 0x4C081DBF, 0x92CA2F0E, 0xD83072E5,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x00000000, 0xDB408C9D, 0x92CA2F0E, 0x4C081DBF, 0x4C081DBF, 0x92CA2F0E,
+    0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x78BC1B8F, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x3CD6E3F3,
+    0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E,
+    0x78BC1B8F, 0x92CA2F0E, 0x92CA2F0E, 0x1F4B8CEF, 0x4C081DBF, 0x3CD6E3F3, 0xDB408C9D, 0x00000000,
+    0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x00000000, 0xDB408C9D, 0x1B147DCC, 0x1B147DCC, 0x4C081DBF,
+    0x92CA2F0E, 0x1B147DCC, 0x4C081DBF, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E,
+    0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x4C081DBF, 0x487981AB, 0x1B147DCC,
+    0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x487981AB, 0x1B147DCC, 0x00000000, 0x78BC1B8F, 0xDB408C9D,
+    0x487981AB, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3,
+    0x1B147DCC, 0x487981AB, 0x78BC1B8F, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC, 0x1B147DCC,
+    0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0xD83072E5, 0x4C081DBF, 0x3CD6E3F3, 0x3CD6E3F3,
+    0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0xDB408C9D, 0x92CA2F0E,
+    0x92CA2F0E, 0x65CBDD54, 0x00000000, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000,
+    0x00000000, 0x92CA2F0E, 0xDB408C9D, 0x3CD6E3F3, 0x78BC1B8F, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB,
+    0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x92CA2F0E,
+    0x00000000, 0x3CD6E3F3, 0x78BC1B8F, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x00000000, 0x92CA2F0E, 0x1B147DCC, 0x487981AB, 0x92CA2F0E, 0x1B147DCC, 0x78BC1B8F, 0x00000000,
+    0x487981AB, 0x4C081DBF, 0x78BC1B8F, 0x00000000, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3,
+    0x1B147DCC, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0x92CA2F0E, 0xDD507B42, 0x92CA2F0E,
+    0x487981AB, 0x92CA2F0E, 0x1B147DCC, 0x00000000, 0x1B147DCC, 0xD83072E5, 0x78BC1B8F, 0x00000000,
+    0x1B147DCC, 0xD83072E5, 0x487981AB, 0x4C081DBF, 0xDB408C9D, 0x78BC1B8F, 0x92CA2F0E, 0x65CBDD54,
+    0x00000000, 0x4C081DBF, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x3CD6E3F3, 0x78BC1B8F, 0x3CD6E3F3, 0x92CA2F0E, 0x487981AB, 0x92CA2F0E, 0x1B147DCC, 0x00000000,
+    0x4C081DBF, 0x3CD6E3F3, 0x4C081DBF, 0x00000000, 0xDB408C9D, 0x1F4B8CEF, 0x00000000, 0x4C081DBF,
+    0x1F4B8CEF, 0x92CA2F0E, 0x92CA2F0E, 0xD83072E5, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x3CD6E3F3,
+    0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x3CD6E3F3, 0x4C081DBF, 0xDB408C9D, 0x3CD6E3F3,
+    0x4C081DBF, 0x4C081DBF, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x91783BB0,
+    0x3CD6E3F3, 0xDB408C9D, 0x487981AB, 0xDB408C9D, 0x78BC1B8F, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E,
+    0x4C081DBF, 0xDB408C9D, 0x4C081DBF, 0x4C081DBF, 0x3CD6E3F3, 0x0231739B, 0x3CD6E3F3, 0xDB408C9D,
+    0x00000000, 0x00000000, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x78BC1B8F,
+    0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E,
+    0x00000000, 0x65CBDD54, 0x00000000, 0x78BC1B8F, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x0231739B,
+    0xDB408C9D, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x1B147DCC, 0x4C081DBF, 0x1B147DCC, 0x92CA2F0E,
+    0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x1B147DCC, 0xD83072E5, 0x487981AB, 0x3CD6E3F3,
+    0x1B147DCC, 0x3CD6E3F3, 0x3CD6E3F3, 0x00000000, 0xD83072E5, 0x3CD6E3F3, 0x92CA2F0E, 0x78BC1B8F,
+    0x1B147DCC, 0x00000000, 0x487981AB, 0x1B147DCC, 0x2AA96DD0, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x487981AB, 0x92CA2F0E,
+    0x92CA2F0E, 0x3CD6E3F3, 0x4C081DBF, 0x1B147DCC, 0x1B147DCC, 0x92CA2F0E, 0x78BC1B8F, 0x1F4B8CEF,
+    0x92CA2F0E, 0x3CD6E3F3, 0x65CBDD54, 0x487981AB, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0xD83072E5,
+    0x92CA2F0E, 0x3CD6E3F3, 0x487981AB, 0x3CD6E3F3, 0xDB408C9D, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E,
+    0x78BC1B8F, 0x1B147DCC, 0x91783BB0, 0x92CA2F0E, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x78BC1B8F,
+    0x487981AB, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x010B6880, 0x1B147DCC, 0xD83072E5,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0x4C081DBF, 0x3CD6E3F3, 0x1F4B8CEF, 0x1B147DCC,
+    0x4C081DBF, 0x3CD6E3F3, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x010B6880,
+    0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x00000000, 0x92CA2F0E, 0x91783BB0,
+    0x92CA2F0E, 0x4C081DBF, 0x4C081DBF, 0xDB408C9D, 0x92CA2F0E, 0xB42BC0B0, 0x00000000, 0x92CA2F0E,
+    0x91783BB0, 0xD83072E5, 0x3CD6E3F3, 0xDB408C9D, 0x92CA2F0E, 0x00000000, 0x78BC1B8F, 0x4C081DBF,
+    0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x4C081DBF, 0x92CA2F0E, 0x78BC1B8F, 0x1B147DCC,
+    0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x487981AB, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E,
+    0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x010B6880, 0x1F4B8CEF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x2AA96DD0, 0x1B147DCC, 0x4C081DBF, 0x00000000,
+    0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x3CD6E3F3, 0xD83072E5, 0x3CD6E3F3,
+    0x92CA2F0E, 0x65CBDD54, 0x00000000, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x4C081DBF,
+    0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x4C081DBF, 0x1B147DCC,
+    0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x78BC1B8F, 0x3CD6E3F3, 0x1B147DCC, 0x3CD6E3F3, 0x4C081DBF,
+    0x00000000, 0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x78BC1B8F, 0x92CA2F0E,
+    0x3CD6E3F3, 0x4C081DBF, 0x3CD6E3F3, 0x4C081DBF, 0x00000000, 0x00000000, 0x4C081DBF, 0x3CD6E3F3,
+    0x78BC1B8F, 0x1B147DCC, 0x3CD6E3F3, 0x91783BB0, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E,
+    0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x3CD6E3F3, 0x487981AB, 0x3CD6E3F3,
+    0x78BC1B8F, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x78BC1B8F,
+    0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF, 0x4C081DBF, 0x3CD6E3F3, 0x3CD6E3F3, 0x65CBDD54, 0x4C081DBF,
+    0xDB408C9D, 0x1B147DCC, 0x3CD6E3F3, 0x3CD6E3F3, 0x78BC1B8F, 0x3CD6E3F3, 0x0231739B, 0x3CD6E3F3,
+    0x92CA2F0E, 0x4C081DBF, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x1F4B8CEF, 0x00000000, 0x3CD6E3F3,
+    0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0x4C081DBF, 0x65CBDD54,
+    0x4C081DBF, 0x00000000, 0x65CBDD54, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E, 0x91783BB0, 0x92CA2F0E,
+    0x92CA2F0E, 0x78BC1B8F, 0xDB408C9D, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E,
+    0x91783BB0, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x00000000, 0x4C081DBF, 0xDB408C9D,
+    0xDB408C9D, 0x3CD6E3F3, 0x91783BB0, 0x00000000, 0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x3CD6E3F3, 0x1F4B8CEF, 0x92CA2F0E, 0x1B147DCC, 0xD83072E5, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0x78BC1B8F,
+    0x00000000, 0x4C081DBF, 0x92CA2F0E, 0x1B147DCC, 0xDB408C9D, 0x92CA2F0E, 0x92CA2F0E, 0x00000000,
+    0x92CA2F0E, 0x1B147DCC, 0x1B147DCC, 0x1B147DCC, 0x91783BB0, 0x487981AB, 0x00000000, 0x3CD6E3F3,
+    0x487981AB, 0x92CA2F0E, 0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x1B147DCC, 0x4C081DBF, 0x92CA2F0E,
+    0x92CA2F0E, 0xDB408C9D, 0x1B147DCC, 0x487981AB, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x1B147DCC,
+    0x3CD6E3F3, 0xD83072E5, 0x92CA2F0E, 0x487981AB, 0x1B147DCC, 0x3CD6E3F3, 0x1B147DCC, 0x3CD6E3F3,
+    0x487981AB, 0x78BC1B8F, 0x92CA2F0E, 0x487981AB, 0x3CD6E3F3, 0x91783BB0, 0x92CA2F0E, 0x4C081DBF,
+    0x3CD6E3F3, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0xDB408C9D, 0x3CD6E3F3, 0x1B147DCC, 0x487981AB,
+    0x1F4B8CEF, 0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0xA4523835,
+    0x78BC1B8F, 0x0231739B, 0x78BC1B8F, 0x487981AB, 0x1B147DCC, 0x3CD6E3F3, 0x3CD6E3F3, 0x0231739B,
+    0x1B147DCC, 0x92CA2F0E, 0x487981AB, 0x00000000, 0x92CA2F0E, 0x487981AB, 0x1B147DCC, 0x1B147DCC,
+    0x3CD6E3F3, 0x92CA2F0E, 0x4C081DBF, 0x2AA96DD0, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D,
+    0x00000000, 0x1F4B8CEF, 0x4C081DBF, 0x3CD6E3F3, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E,
+    0x78BC1B8F, 0x1B147DCC, 0x1B147DCC, 0x1B147DCC, 0x487981AB, 0x92CA2F0E, 0x00000000, 0xDB408C9D,
+    0xDB408C9D, 0x3CD6E3F3, 0xDB408C9D, 0x00000000, 0x3CD6E3F3, 0x1B147DCC, 0x3CD6E3F3, 0x4C081DBF,
+    0x92CA2F0E, 0x1B147DCC, 0x65CBDD54, 0x487981AB, 0x92CA2F0E, 0x3CD6E3F3, 0x487981AB, 0x487981AB,
+    0xB7FBE3E5, 0x78BC1B8F, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x3CD6E3F3, 0x65CBDD54, 0x487981AB,
+    0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0xB42BC0B0, 0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x4C081DBF,
+    0x92CA2F0E, 0x487981AB, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC, 0xDB408C9D, 0x00000000,
+    0x1F4B8CEF, 0x1B147DCC, 0x3CD6E3F3, 0xDB408C9D, 0x4C081DBF, 0x3CD6E3F3, 0x3CD6E3F3, 0x92CA2F0E,
+    0x3CD6E3F3, 0x1F4B8CEF, 0x91783BB0, 0x4C081DBF, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x78BC1B8F, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB,
+    0x00000000, 0x3CD6E3F3, 0x3CD6E3F3, 0x4C081DBF, 0x3CD6E3F3, 0x00000000, 0x92CA2F0E, 0x3CD6E3F3,
+    0x00000000, 0x3CD6E3F3, 0xDB408C9D, 0x3CD6E3F3, 0x92CA2F0E, 0x00000000, 0x487981AB, 0x92CA2F0E,
+    0x04E90BF5, 0x92CA2F0E, 0x487981AB, 0x4C081DBF, 0x78BC1B8F, 0x92CA2F0E, 0x487981AB, 0x92CA2F0E,
+    0x3CD6E3F3, 0x4C081DBF, 0x487981AB, 0x91783BB0, 0x1B147DCC, 0x92CA2F0E, 0x1B147DCC, 0x92CA2F0E,
+    0x78BC1B8F, 0x00000000, 0x4C081DBF, 0x4C081DBF, 0x1B147DCC, 0xDB408C9D, 0xDB408C9D, 0x65CBDD54,
+    0x3CD6E3F3, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x04E90BF5, 0x3CD6E3F3, 0x1B147DCC, 0xD83072E5,
+    0xDB408C9D, 0xDB408C9D, 0x487981AB, 0x1B147DCC, 0x1B147DCC, 0xDB408C9D, 0x92CA2F0E, 0x3CD6E3F3,
+    0x92CA2F0E, 0xB42BC0B0, 0xDB408C9D, 0x1F4B8CEF, 0x487981AB, 0x92CA2F0E, 0x3CD6E3F3, 0x010B6880,
+    0x92CA2F0E, 0x1B147DCC, 0xB42BC0B0, 0xD83072E5, 0x00000000, 0x487981AB, 0x487981AB, 0x3CD6E3F3,
+    0x1F4B8CEF, 0xD83072E5, 0x4C081DBF, 0x00000000, 0x1B147DCC, 0x92CA2F0E, 0x92CA2F0E, 0x78BC1B8F,
+    0x92CA2F0E, 0x1B147DCC, 0x4C081DBF, 0x3CD6E3F3, 0x2AA96DD0, 0x92CA2F0E, 0x92CA2F0E, 0x1B147DCC,
+    0x92CA2F0E, 0x487981AB, 0x92CA2F0E, 0x4C081DBF, 0x92CA2F0E, 0x92CA2F0E, 0x487981AB, 0x3CD6E3F3,
+    0xDB408C9D, 0x3CD6E3F3, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0x78BC1B8F, 0x3CD6E3F3,
+    0x92CA2F0E, 0x00000000, 0x4C081DBF, 0x92CA2F0E, 0x1B147DCC, 0x3CD6E3F3, 0x00000000, 0x00000000,
+    0xD939FF68, 0x3CD6E3F3, 0x1B147DCC, 0x92CA2F0E, 0xDD507B42, 0x78BC1B8F, 0x4C081DBF, 0x92CA2F0E,
+    0x00000000, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E, 0xDB408C9D, 0x3CD6E3F3, 0xCEEB36B7, 0x78BC1B8F,
+    0x92CA2F0E, 0x92CA2F0E, 0x010B6880, 0x487981AB, 0x92CA2F0E, 0x1B147DCC, 0x4C081DBF, 0x3CD6E3F3,
+    0x78BC1B8F, 0x3CD6E3F3, 0x487981AB, 0x4C081DBF, 0x1B147DCC, 0x00000000, 0x92CA2F0E, 0x92CA2F0E,
+    0x3CD6E3F3, 0xDB408C9D, 0x1B147DCC, 0x4C081DBF, 0x92CA2F0E, 0x3CD6E3F3, 0x00000000, 0x00000000,
+    0x010B6880, 0x65CBDD54, 0x92CA2F0E, 0x3CD6E3F3, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x92CA2F0E,
+    0x92CA2F0E, 0x487981AB, 0x1E712332, 0x1B147DCC, 0x78BC1B8F, 0x3CD6E3F3, 0x91783BB0, 0x3CD6E3F3,
+    0x00000000, 0x57DCB96B, 0x3CD6E3F3, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3, 0x1B147DCC, 0x3CD6E3F3,
+    0x65CBDD54, 0x1B147DCC, 0x487981AB, 0x487981AB, 0x92CA2F0E, 0x92CA2F0E, 0x3CD6E3F3, 0x3CD6E3F3,
+    0x4C081DBF, 0x3CD6E3F3, 0x1B147DCC, 0x2AA96DD0, 0x92CA2F0E, 0x78BC1B8F, 0x3CD6E3F3, 0x1B147DCC,
+    0x3CD6E3F3, 0x1B147DCC, 0x487981AB, 0x3CD6E3F3, 0x91783BB0, 0x00000000, 0x00000000, 0x1B147DCC,
+    0x1F4B8CEF, 0x3CD6E3F3, 0x65CBDD54, 0x78BC1B8F, 0x3CD6E3F3, 0xD83072E5, 0x4C081DBF, 0x92CA2F0E,
+    0x4C081DBF, 0x487981AB, 0x3CD6E3F3, 0x3CD6E3F3, 0x65CBDD54, 0x92CA2F0E, 0x78BC1B8F, 0xD83072E5,
+}};
+
+constexpr std::array<uint16_t, 8192> keyword_slots = {{
+    0x0B61, 0x0000, 0x0162, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0EE4, 0x0E8B, 0x0948, 0x08DC, 0x082F, 0x076C, 0x0040, 0x0000,
+    0x04FC, 0x0000, 0x1434, 0x0000, 0x03BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x003B, 0x1034, 0x0DAA, 0x0580, 0x0000, 0x0152, 0x128F,
+    0x0202, 0x0000, 0x00F6, 0x0946, 0x0757, 0x0AB0, 0x0C83, 0x1379, 0x0000, 0x018C, 0x08C8, 0x0000, 0x0057, 0x0000, 0x0000, 0x0AC2,
+    0x0D20, 0x0000, 0x0B8D, 0x0000, 0x0CCD, 0x0FA3, 0x0449, 0x0000, 0x0972, 0x121E, 0x0000, 0x070F, 0x0000, 0x0A3C, 0x0420, 0x0000,
+    0x037F, 0x0661, 0x0000, 0x0000, 0x0D11, 0x0E12, 0x0056, 0x115A, 0x0C15, 0x0000, 0x1135, 0x0916, 0x0AF3, 0x0C4A, 0x0000, 0x015D,
+    0x0F53, 0x0000, 0x00A4, 0x1168, 0x0ED8, 0x11D1, 0x0000, 0x12AA, 0x0C23, 0x0000, 0x0F54, 0x132D, 0x06DF, 0x036E, 0x0000, 0x0000,
+    0x0E82, 0x0000, 0x0000, 0x0BF9, 0x0836, 0x11DE, 0x0C81, 0x06A9, 0x01FD, 0x140D, 0x0B75, 0x0000, 0x0D89, 0x0F9E, 0x0029, 0x0000,
+    0x0000, 0x00FB, 0x1141, 0x0000, 0x0000, 0x0115, 0x0E51, 0x0FA9, 0x0577, 0x01F4, 0x0000, 0x0000, 0x0FD5, 0x0F5E, 0x0000, 0x1107,
+    0x0967, 0x034A, 0x0A5E, 0x0000, 0x0000, 0x0649, 0x0471, 0x0000, 0x0B92, 0x0000, 0x0000, 0x0BA5, 0x12B3, 0x0D6F, 0x039F, 0x01E5,
+    0x0000, 0x0664, 0x0000, 0x021D, 0x0000, 0x0917, 0x046C, 0x0000, 0x0000, 0x0000, 0x0BE8, 0x0E2A, 0x0000, 0x01CF, 0x0000, 0x12AE,
+    0x1265, 0x030D, 0x04C4, 0x0000, 0x0519, 0x0000, 0x08A8, 0x0000, 0x072C, 0x0224, 0x0F99, 0x0000, 0x0000, 0x0000, 0x0211, 0x0000,
+    0x0857, 0x1248, 0x06C6, 0x0F07, 0x03F7, 0x01EA, 0x0A71, 0x12DA, 0x106F, 0x0000, 0x0000, 0x07E4, 0x1076, 0x0000, 0x0000, 0x0000,
+    0x0193, 0x1404, 0x1012, 0x004E, 0x0000, 0x0EEB, 0x04D0, 0x11B7, 0x08C5, 0x0F08, 0x0764, 0x0000, 0x01C8, 0x002D, 0x02FF, 0x0000,
+    0x0EB5, 0x0000, 0x0082, 0x0000, 0x0D23, 0x0000, 0x0000, 0x1325, 0x0E5E, 0x0000, 0x006B, 0x0000, 0x0E84, 0x0C36, 0x0000, 0x0000,
+    0x05EF, 0x0000, 0x02D1, 0x02F0, 0x0774, 0x000D, 0x0000, 0x134A, 0x0199, 0x0E2C, 0x0A89, 0x0000, 0x0000, 0x09F8, 0x11FC, 0x0000,
+    0x0515, 0x069C, 0x0000, 0x0000, 0x0356, 0x0044, 0x1429, 0x0000, 0x0000, 0x0921, 0x0FBB, 0x052B, 0x0000, 0x02AA, 0x08C3, 0x04B7,
+    0x0376, 0x092B, 0x07B9, 0x04E9, 0x02CD, 0x0000, 0x0000, 0x019B, 0x1191, 0x0B3D, 0x0000, 0x043B, 0x10A9, 0x140E, 0x0236, 0x04EC,
+    0x0000, 0x0AF0, 0x07E1, 0x10CC, 0x08E2, 0x0F55, 0x03F6, 0x003E, 0x0000, 0x0F9A, 0x10AD, 0x0000, 0x115E, 0x0000, 0x0000, 0x0000,
+    0x0A91, 0x0000, 0x073D, 0x0F2E, 0x0A06, 0x123A, 0x0ACE, 0x0000, 0x0000, 0x0000, 0x086C, 0x0D57, 0x0A56, 0x0AF6, 0x0000, 0x0C02,
+    0x069B, 0x0640, 0x0B67, 0x09A1, 0x0000, 0x0000, 0x0D61, 0x0000, 0x130A, 0x0000, 0x05A4, 0x05B4, 0x0C08, 0x0000, 0x0000, 0x0621,
+    0x0BD7, 0x0D43, 0x0769, 0x0E23, 0x0000, 0x06FC, 0x0000, 0x120E, 0x0000, 0x0000, 0x0243, 0x1025, 0x0A49, 0x0364, 0x1358, 0x0000,
+    0x03DA, 0x140F, 0x0892, 0x06C8, 0x081E, 0x0000, 0x04BA, 0x0C8C, 0x0000, 0x0000, 0x0C68, 0x0668, 0x12B5, 0x0000, 0x0000, 0x06B3,
+    0x0317, 0x059E, 0x0222, 0x142E, 0x0719, 0x0000, 0x0000, 0x0000, 0x08FD, 0x0000, 0x0E3D, 0x0000, 0x0000, 0x0A98, 0x0000, 0x0245,
+    0x0000, 0x119C, 0x138A, 0x0631, 0x0308, 0x0F30, 0x0A73, 0x0000, 0x0000, 0x1153, 0x01E1, 0x0000, 0x0FCB, 0x11ED, 0x13A6, 0x1343,
+    0x0000, 0x11BC, 0x0DD9, 0x0000, 0x0000, 0x0E8D, 0x0A27, 0x0F59, 0x0D5F, 0x10FA, 0x0479, 0x0000, 0x0000, 0x0B90, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0EEF, 0x0000, 0x00DF, 0x1395, 0x0000, 0x12D7, 0x0000, 0x0000, 0x047D, 0x0000, 0x0F4E, 0x0000, 0x002F,
+    0x10D6, 0x0B4C, 0x0E29, 0x12A8, 0x039C, 0x0000, 0x019F, 0x1143, 0x0000, 0x0A66, 0x1084, 0x0000, 0x002A, 0x0000, 0x078C, 0x13B2,
+    0x0000, 0x0D69, 0x08A6, 0x0000, 0x0000, 0x0000, 0x018F, 0x0000, 0x0319, 0x0B50, 0x0150, 0x0D03, 0x09A9, 0x0000, 0x0C3D, 0x0000,
+    0x0DB9, 0x0000, 0x02E3, 0x0000, 0x100A, 0x0854, 0x0426, 0x0000, 0x0B96, 0x02B5, 0x0BB9, 0x013A, 0x0FD4, 0x0197, 0x0000, 0x0400,
+    0x0000, 0x0E4E, 0x0000, 0x08F2, 0x0A45, 0x096B, 0x0000, 0x0000, 0x0436, 0x0000, 0x0000, 0x04D2, 0x0063, 0x0CB9, 0x0000, 0x0000,
+    0x0000, 0x037A, 0x0000, 0x0000, 0x080E, 0x0466, 0x0A0C, 0x0000, 0x0000, 0x09B7, 0x0B57, 0x0DF6, 0x0E7B, 0x0727, 0x0480, 0x0000,
+    0x0F79, 0x0000, 0x0A29, 0x0000, 0x0000, 0x08D3, 0x080D, 0x0884, 0x0A88, 0x140B, 0x0000, 0x1227, 0x0000, 0x0000, 0x0C7B, 0x0000,
+    0x09F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0980, 0x10C7, 0x0DC5, 0x09CD, 0x0000, 0x0000, 0x0000, 0x10EE, 0x088C, 0x0054, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x13CC, 0x1260, 0x0000, 0x07BA, 0x0C96, 0x0021, 0x0000, 0x0952, 0x0A44, 0x0000, 0x0BFC, 0x12E7, 0x0DFB,
+    0x0000, 0x0000, 0x09F3, 0x13C0, 0x0000, 0x0060, 0x0000, 0x0E06, 0x0651, 0x0000, 0x0000, 0x0000, 0x113B, 0x0CCC, 0x0000, 0x0000,
+    0x0F8B, 0x0248, 0x0000, 0x0D52, 0x0B81, 0x0112, 0x0000, 0x0000, 0x0000, 0x068B, 0x10B8, 0x0BAC, 0x08E9, 0x1342, 0x0000, 0x0000,
+    0x0CE3, 0x0000, 0x0000, 0x0000, 0x0000, 0x09E4, 0x0B60, 0x0000, 0x0000, 0x0AD9, 0x067E, 0x047A, 0x1368, 0x028C, 0x03E2, 0x0000,
+    0x0000, 0x0000, 0x1080, 0x0000, 0x0968, 0x0000, 0x0B09, 0x137D, 0x0000, 0x0373, 0x0000, 0x008B, 0x0DB4, 0x0BFF, 0x0000, 0x0ECB,
+    0x0000, 0x0000, 0x0000, 0x01BD, 0x061B, 0x026B, 0x0000, 0x02E5, 0x0000, 0x06D4, 0x0000, 0x1408, 0x133F, 0x0000, 0x0000, 0x0A09,
+    0x0000, 0x0875, 0x0B62, 0x078F, 0x0689, 0x0000, 0x105C, 0x0000, 0x0AED, 0x0329, 0x04DC, 0x0992, 0x0000, 0x0F98, 0x0000, 0x0000,
+    0x1271, 0x0EE5, 0x0000, 0x0458, 0x0D12, 0x09D1, 0x0000, 0x0000, 0x0518, 0x0D44, 0x0000, 0x0000, 0x117D, 0x04D6, 0x0000, 0x0E98,
+    0x0826, 0x0000, 0x0000, 0x02AF, 0x0D31, 0x0000, 0x1308, 0x05AB, 0x0000, 0x00D5, 0x03D6, 0x0000, 0x0000, 0x0118, 0x0000, 0x1304,
+    0x0000, 0x0ED2, 0x0833, 0x0000, 0x07FF, 0x049C, 0x126F, 0x07B7, 0x0B79, 0x0CDA, 0x0EF8, 0x0000, 0x040D, 0x0F21, 0x0000, 0x0000,
+    0x0F80, 0x0214, 0x07C9, 0x13FC, 0x123D, 0x0D56, 0x0E92, 0x0000, 0x117F, 0x022A, 0x07D1, 0x0761, 0x0000, 0x086A, 0x0433, 0x0000,
+    0x0000, 0x026D, 0x0D88, 0x0000, 0x0000, 0x073E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B21, 0x06E4, 0x0000, 0x09D9, 0x10B4, 0x139C,
+    0x108F, 0x081D, 0x11FF, 0x0A65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F97, 0x0005, 0x0000, 0x03EF, 0x0EA9, 0x0000, 0x0000, 0x0000,
+    0x10B7, 0x0B65, 0x062D, 0x0000, 0x0000, 0x0BEA, 0x0AEC, 0x0000, 0x0C66, 0x0127, 0x10D8, 0x0000, 0x080A, 0x115B, 0x0909, 0x0000,
+    0x0000, 0x0E6F, 0x1394, 0x0B6D, 0x0000, 0x0000, 0x0000, 0x02B6, 0x0EAC, 0x11DC, 0x090B, 0x0DA1, 0x07E9, 0x1242, 0x060E, 0x0000,
+    0x1269, 0x0D66, 0x0000, 0x0000, 0x0000, 0x0D1C, 0x0BCD, 0x08E6, 0x0CA0, 0x0B44, 0x0048, 0x05C2, 0x0CD6, 0x0000, 0x12BD, 0x09B8,
+    0x0D83, 0x007F, 0x1054, 0x0000, 0x000E, 0x0291, 0x0000, 0x0619, 0x0B74, 0x0BC9, 0x1022, 0x0DFD, 0x0000, 0x0000, 0x0C97, 0x137B,
+    0x132A, 0x1032, 0x0632, 0x0000, 0x0000, 0x0000, 0x0000, 0x0CDC, 0x0000, 0x0000, 0x0B54, 0x1422, 0x0000, 0x0000, 0x0000, 0x11AB,
+    0x1237, 0x0000, 0x1407, 0x0927, 0x0000, 0x1383, 0x0858, 0x0000, 0x12DF, 0x0C3B, 0x0E54, 0x0C9C, 0x0C3C, 0x0000, 0x0000, 0x0196,
+    0x0A77, 0x02D3, 0x1262, 0x027E, 0x01EF, 0x0000, 0x0650, 0x0A6B, 0x1250, 0x0000, 0x0485, 0x03D5, 0x0474, 0x0000, 0x0DF7, 0x0BFB,
+    0x02EE, 0x0281, 0x11E4, 0x0000, 0x01D7, 0x0000, 0x0558, 0x0000, 0x01CD, 0x0CF7, 0x042A, 0x015E, 0x097C, 0x113E, 0x094E, 0x056D,
+    0x0CD0, 0x114B, 0x01C6, 0x0000, 0x0C17, 0x0000, 0x0000, 0x0000, 0x0177, 0x0000, 0x1322, 0x03CE, 0x0000, 0x0D94, 0x138C, 0x0000,
+    0x1439, 0x0000, 0x0CDF, 0x05F4, 0x0000, 0x104D, 0x0C2D, 0x0EEA, 0x0000, 0x02C3, 0x0BD1, 0x0797, 0x09D5, 0x0000, 0x05F7, 0x040C,
+    0x0000, 0x0000, 0x0EE9, 0x0000, 0x0985, 0x0B4B, 0x0000, 0x1146, 0x1428, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04F9, 0x0000,
+    0x1147, 0x0554, 0x0000, 0x0000, 0x0000, 0x10A4, 0x0700, 0x0C71, 0x0000, 0x0943, 0x0684, 0x0AEB, 0x0FF1, 0x0EB6, 0x04A1, 0x0A7A,
+    0x0000, 0x0119, 0x0A25, 0x0000, 0x0000, 0x09B3, 0x11B8, 0x0000, 0x0253, 0x0C52, 0x0000, 0x0FA0, 0x06E3, 0x0DE7, 0x11EE, 0x11AC,
+    0x02CC, 0x0B1D, 0x07E8, 0x0000, 0x0D76, 0x087A, 0x0000, 0x0000, 0x115D, 0x0000, 0x0000, 0x0E44, 0x0000, 0x08B4, 0x08CD, 0x03ED,
+    0x0000, 0x0FAA, 0x0817, 0x0D7E, 0x0070, 0x0000, 0x00AC, 0x0DC6, 0x0000, 0x10A7, 0x0E17, 0x0000, 0x0788, 0x0000, 0x0772, 0x0000,
+    0x0000, 0x0000, 0x03C8, 0x066A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0454, 0x0000, 0x077D, 0x1251, 0x0A08, 0x0000, 0x0000,
+    0x0E7E, 0x0CD7, 0x0F14, 0x0000, 0x0511, 0x0218, 0x06F3, 0x0F71, 0x00C8, 0x0000, 0x0000, 0x0C0B, 0x0F8D, 0x13B9, 0x0C24, 0x0000,
+    0x1175, 0x0706, 0x0000, 0x0B53, 0x1218, 0x06BF, 0x0188, 0x0000, 0x10FF, 0x1386, 0x12E5, 0x058A, 0x0D7B, 0x104F, 0x0304, 0x0CC1,
+    0x0D6E, 0x082A, 0x0000, 0x0DBD, 0x0D37, 0x11DD, 0x0000, 0x0000, 0x141C, 0x0D04, 0x0000, 0x0000, 0x0000, 0x01AA, 0x0F57, 0x03AE,
+    0x07D8, 0x0A8B, 0x07A4, 0x11C8, 0x0000, 0x07A9, 0x05BF, 0x0600, 0x0000, 0x01E9, 0x0A2D, 0x0000, 0x0F6E, 0x0000, 0x0141, 0x0A37,
+    0x0424, 0x054A, 0x0C21, 0x0000, 0x113A, 0x0000, 0x0000, 0x06FB, 0x1081, 0x111C, 0x0000, 0x0000, 0x0221, 0x0000, 0x0FF3, 0x0000,
+    0x137A, 0x0000, 0x05DB, 0x0159, 0x0A9E, 0x11DB, 0x0AC5, 0x0000, 0x0CE5, 0x0000, 0x014F, 0x0111, 0x0000, 0x0402, 0x0000, 0x038B,
+    0x0464, 0x0DF2, 0x0000, 0x111D, 0x0D9A, 0x04FE, 0x0000, 0x0634, 0x101C, 0x0990, 0x0000, 0x12F2, 0x0000, 0x062A, 0x008F, 0x0470,
+    0x00C9, 0x0000, 0x0000, 0x1000, 0x0000, 0x009A, 0x05F0, 0x0290, 0x0000, 0x0871, 0x05D1, 0x0C7D, 0x0000, 0x0000, 0x0051, 0x12ED,
+    0x0000, 0x0000, 0x0153, 0x0000, 0x0C74, 0x0000, 0x0B48, 0x0000, 0x0000, 0x0000, 0x0000, 0x057F, 0x0000, 0x0665, 0x0000, 0x0DB8,
+    0x0000, 0x0000, 0x0000, 0x0513, 0x0467, 0x0000, 0x1289, 0x0000, 0x0000, 0x0ADA, 0x0000, 0x0371, 0x0FAF, 0x0000, 0x12EE, 0x13C4,
+    0x0000, 0x05F9, 0x0FA5, 0x04DF, 0x0139, 0x03AA, 0x031B, 0x0A1C, 0x09D2, 0x022C, 0x110A, 0x0546, 0x0430, 0x0000, 0x085D, 0x11C7,
+    0x129D, 0x0E04, 0x0D3D, 0x0000, 0x12F7, 0x05FF, 0x1360, 0x031C, 0x054E, 0x0000, 0x08F0, 0x0000, 0x0CEC, 0x0FF7, 0x1001, 0x0000,
+    0x0000, 0x0DFA, 0x1317, 0x0D02, 0x0000, 0x0E6A, 0x0E45, 0x0756, 0x0000, 0x0229, 0x0000, 0x0000, 0x1184, 0x12DE, 0x0043, 0x0000,
+    0x0463, 0x05B8, 0x0D47, 0x0000, 0x0408, 0x0000, 0x041D, 0x0000, 0x0FBF, 0x0000, 0x0000, 0x1380, 0x0382, 0x0A78, 0x1369, 0x042E,
+    0x0E76, 0x00F1, 0x1094, 0x0753, 0x073F, 0x0352, 0x0000, 0x0000, 0x0415, 0x034C, 0x0D27, 0x0000, 0x0000, 0x0030, 0x0277, 0x0000,
+    0x0000, 0x1023, 0x0102, 0x06DB, 0x0000, 0x056C, 0x0315, 0x05CD, 0x0000, 0x02E2, 0x0B3A, 0x010F, 0x1086, 0x041E, 0x095A, 0x1361,
+    0x0000, 0x1259, 0x1042, 0x0000, 0x0000, 0x0E39, 0x07E5, 0x07FB, 0x0000, 0x01A4, 0x0D34, 0x0000, 0x0000, 0x0E81, 0x05E9, 0x0000,
+    0x0C38, 0x12B6, 0x0000, 0x09E0, 0x0000, 0x0000, 0x0000, 0x05FB, 0x0C22, 0x09BB, 0x13E6, 0x0000, 0x0EA3, 0x081B, 0x086B, 0x0EF9,
+    0x0000, 0x0000, 0x0F39, 0x1069, 0x0000, 0x01A0, 0x08A2, 0x0D1D, 0x04B0, 0x11A5, 0x0000, 0x0000, 0x0994, 0x0CE2, 0x0F7B, 0x0000,
+    0x0000, 0x0000, 0x066D, 0x12C4, 0x091C, 0x040B, 0x00A0, 0x026F, 0x0ACB, 0x06E7, 0x0000, 0x08A5, 0x0D3E, 0x0000, 0x0000, 0x0000,
+    0x0ECC, 0x0000, 0x1263, 0x0C53, 0x13D3, 0x0000, 0x0920, 0x0000, 0x0000, 0x11E3, 0x1200, 0x0383, 0x05B2, 0x0694, 0x0000, 0x0000,
+    0x0000, 0x089E, 0x06B8, 0x048E, 0x090E, 0x0000, 0x0000, 0x006A, 0x1178, 0x0F13, 0x0000, 0x035A, 0x0000, 0x0000, 0x1226, 0x0E3C,
+    0x0813, 0x0885, 0x04F4, 0x0000, 0x136A, 0x1036, 0x0FAE, 0x0743, 0x07C3, 0x0E99, 0x0000, 0x03EE, 0x0000, 0x0000, 0x0000, 0x0F6D,
+    0x089C, 0x0000, 0x0E0B, 0x12A2, 0x0763, 0x0381, 0x0B80, 0x112A, 0x0000, 0x0000, 0x0A7D, 0x0947, 0x0F00, 0x03FB, 0x0A07, 0x0616,
+    0x0000, 0x030C, 0x11EF, 0x0000, 0x0000, 0x0671, 0x0000, 0x0000, 0x0000, 0x03E0, 0x0000, 0x0000, 0x139F, 0x137E, 0x022B, 0x0CA2,
+    0x11A1, 0x0000, 0x0000, 0x0362, 0x0986, 0x0000, 0x055F, 0x04E6, 0x0000, 0x0F61, 0x0000, 0x0000, 0x1315, 0x11E1, 0x0350, 0x0E0A,
+    0x0BA8, 0x0000, 0x0000, 0x0320, 0x0E9A, 0x0B88, 0x0000, 0x0000, 0x133E, 0x0A0A, 0x069D, 0x0F87, 0x0000, 0x0000, 0x00E6, 0x07C2,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1230, 0x107F, 0x0000, 0x1424, 0x0EC2, 0x0000, 0x0000, 0x0A53, 0x0000, 0x06C2, 0x0000, 0x0000,
+    0x049F, 0x0000, 0x0000, 0x060D, 0x0000, 0x0000, 0x127B, 0x10AE, 0x0C6A, 0x03F2, 0x0332, 0x0428, 0x04A4, 0x0000, 0x0F2D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0499, 0x0116, 0x11AE, 0x070E, 0x0CD4, 0x0000, 0x12C8, 0x0000, 0x0000, 0x0000, 0x09ED, 0x11EC, 0x012C,
+    0x044A, 0x1160, 0x1117, 0x0000, 0x0CB5, 0x0708, 0x0000, 0x090D, 0x1252, 0x0A13, 0x03B8, 0x0000, 0x031A, 0x0000, 0x0257, 0x0000,
+    0x04F0, 0x0000, 0x0B56, 0x0F8E, 0x0000, 0x0F0C, 0x0000, 0x05B9, 0x1376, 0x04F6, 0x0000, 0x0000, 0x0B7D, 0x0000, 0x1161, 0x0E0E,
+    0x01E3, 0x0034, 0x078E, 0x0000, 0x0C33, 0x0000, 0x0000, 0x0122, 0x0000, 0x0000, 0x0000, 0x0815, 0x0000, 0x0401, 0x00F2, 0x0656,
+    0x124D, 0x0C54, 0x018E, 0x0BDF, 0x0000, 0x00F5, 0x0E59, 0x0000, 0x0000, 0x0000, 0x011B, 0x0B66, 0x0254, 0x12BA, 0x0ABD, 0x06AE,
+    0x00C1, 0x1090, 0x0000, 0x0A0D, 0x0000, 0x122D, 0x0ACA, 0x0000, 0x03AC, 0x02DD, 0x0000, 0x0000, 0x0E88, 0x0000, 0x08FC, 0x0000,
+    0x0C3F, 0x02FD, 0x0FA4, 0x07FD, 0x0000, 0x0692, 0x0FE1, 0x0000, 0x0000, 0x0000, 0x0FF8, 0x015F, 0x11D7, 0x0000, 0x0000, 0x0191,
+    0x0201, 0x0000, 0x08FE, 0x01BE, 0x0358, 0x05D4, 0x0000, 0x0CD2, 0x0000, 0x0EF4, 0x08DD, 0x0000, 0x12B9, 0x0000, 0x0157, 0x0000,
+    0x0C0C, 0x0B84, 0x1156, 0x10C6, 0x06C9, 0x0000, 0x04DB, 0x0529, 0x0654, 0x0000, 0x060C, 0x1364, 0x08B8, 0x137C, 0x1133, 0x0000,
+    0x0680, 0x0000, 0x0611, 0x0000, 0x0000, 0x0BBF, 0x0000, 0x0000, 0x0504, 0x0000, 0x09BF, 0x0179, 0x0189, 0x1261, 0x0770, 0x0000,
+    0x0000, 0x0000, 0x07A7, 0x0BAF, 0x016D, 0x0000, 0x0EC1, 0x007C, 0x0000, 0x0000, 0x037B, 0x135B, 0x0000, 0x0EBD, 0x118F, 0x1247,
+    0x0B2C, 0x08EF, 0x06CF, 0x0720, 0x0BC8, 0x0000, 0x0000, 0x0729, 0x0000, 0x0C59, 0x03DD, 0x1299, 0x0AEA, 0x13A3, 0x0000, 0x0000,
+    0x01FE, 0x0D17, 0x134E, 0x0000, 0x1151, 0x0D59, 0x0B91, 0x0000, 0x0678, 0x0737, 0x12F6, 0x0300, 0x0359, 0x0247, 0x07D4, 0x07C7,
+    0x0000, 0x0000, 0x0612, 0x0000, 0x023B, 0x0000, 0x0A23, 0x0239, 0x063F, 0x0000, 0x09DE, 0x0C61, 0x0A9A, 0x0C65, 0x0000, 0x02F1,
+    0x0910, 0x0E7D, 0x0000, 0x0000, 0x121A, 0x119D, 0x134F, 0x0572, 0x0422, 0x0000, 0x06B9, 0x0000, 0x120F, 0x0000, 0x0FD1, 0x0000,
+    0x120A, 0x0575, 0x01D3, 0x0C0E, 0x0841, 0x0000, 0x0B9A, 0x0000, 0x1027, 0x05D5, 0x10E7, 0x0A58, 0x13AD, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0F31, 0x124F, 0x0339, 0x03B2, 0x0B6A, 0x0000, 0x0000, 0x068A, 0x00FD, 0x0000, 0x0000, 0x0000, 0x083D, 0x13EA, 0x0398,
+    0x0714, 0x092C, 0x0653, 0x100F, 0x0000, 0x06F5, 0x0000, 0x0CAE, 0x125E, 0x08B9, 0x0000, 0x10F8, 0x0000, 0x1275, 0x02EF, 0x0000,
+    0x0000, 0x00FA, 0x1177, 0x0000, 0x1212, 0x0028, 0x1423, 0x0B1C, 0x05E7, 0x0000, 0x0000, 0x0000, 0x0FE4, 0x0AE2, 0x1132, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0FDE, 0x0A54, 0x0EBA, 0x0000, 0x1354, 0x11DF, 0x1121, 0x0956, 0x00D8, 0x0000, 0x0DEE, 0x10F5, 0x0DA6,
+    0x12D9, 0x0FF5, 0x0000, 0x0A4A, 0x05A1, 0x03B0, 0x13A0, 0x0126, 0x0000, 0x0000, 0x0DCD, 0x0728, 0x0A81, 0x0000, 0x0000, 0x0000,
+    0x0BA1, 0x0000, 0x0000, 0x0C4C, 0x0342, 0x0000, 0x058D, 0x0000, 0x05DE, 0x0000, 0x1421, 0x13E4, 0x0A63, 0x0000, 0x0581, 0x10F9,
+    0x0000, 0x12C3, 0x11E2, 0x0E6C, 0x0FD3, 0x07F5, 0x06D1, 0x08F6, 0x08EC, 0x0C4F, 0x0000, 0x0409, 0x0000, 0x1122, 0x0B15, 0x0EE7,
+    0x078A, 0x1171, 0x0C60, 0x063A, 0x0CB7, 0x005B, 0x051C, 0x1138, 0x0B02, 0x0000, 0x0BFA, 0x12D5, 0x03A0, 0x0000, 0x0000, 0x1382,
+    0x0E47, 0x1039, 0x0000, 0x0000, 0x0010, 0x0000, 0x127E, 0x0000, 0x11F1, 0x0F48, 0x0000, 0x1427, 0x0F0E, 0x0000, 0x0000, 0x0D2B,
+    0x09B6, 0x0629, 0x06A5, 0x0244, 0x1256, 0x11FE, 0x053E, 0x0445, 0x0000, 0x0000, 0x0000, 0x0D10, 0x0ECA, 0x0000, 0x0000, 0x07C8,
+    0x0860, 0x06C5, 0x06EB, 0x019C, 0x137F, 0x0000, 0x1067, 0x057B, 0x03C0, 0x096E, 0x027B, 0x0667, 0x1341, 0x10EA, 0x0000, 0x0000,
+    0x0955, 0x101F, 0x0AD5, 0x0000, 0x0F65, 0x0000, 0x0FC4, 0x0C4D, 0x0988, 0x0565, 0x0000, 0x0000, 0x0D93, 0x0000, 0x0894, 0x0597,
+    0x0E6E, 0x0A64, 0x0000, 0x0C29, 0x0D92, 0x125C, 0x0000, 0x0000, 0x0432, 0x13E3, 0x0CC5, 0x0C0A, 0x06F1, 0x0000, 0x0585, 0x1140,
+    0x0000, 0x0000, 0x04A5, 0x0DDD, 0x0000, 0x00A3, 0x0000, 0x0DDF, 0x0000, 0x0784, 0x11B2, 0x0000, 0x1314, 0x0FBD, 0x0000, 0x1202,
+    0x05C8, 0x041B, 0x04AC, 0x04DD, 0x0000, 0x07ED, 0x0093, 0x1287, 0x12E9, 0x11F3, 0x1280, 0x0000, 0x0000, 0x0908, 0x0000, 0x0E74,
+    0x0000, 0x03DF, 0x0000, 0x0000, 0x0000, 0x1181, 0x0000, 0x0A33, 0x0AF5, 0x0CAD, 0x09A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0EC8,
+    0x03E6, 0x13FA, 0x0A46, 0x0000, 0x0000, 0x0000, 0x0925, 0x0D2F, 0x0AD3, 0x11C0, 0x0000, 0x0000, 0x0758, 0x0A05, 0x0000, 0x0171,
+    0x1165, 0x1021, 0x0EF1, 0x0000, 0x07A5, 0x0000, 0x0000, 0x0000, 0x0F4F, 0x11EA, 0x0CFD, 0x1011, 0x07B2, 0x12CB, 0x0747, 0x0BE9,
+    0x0F33, 0x02CA, 0x0000, 0x0000, 0x030F, 0x0000, 0x01D6, 0x0000, 0x0F58, 0x11E8, 0x07D5, 0x0000, 0x006C, 0x0000, 0x0D70, 0x0000,
+    0x0E14, 0x01DB, 0x06D2, 0x0B77, 0x12C6, 0x0F38, 0x0685, 0x12B2, 0x0267, 0x116E, 0x0E64, 0x0149, 0x0E93, 0x02CE, 0x0000, 0x0000,
+    0x0BD0, 0x0000, 0x0000, 0x0000, 0x0000, 0x009F, 0x0000, 0x0000, 0x040F, 0x02A5, 0x0299, 0x0187, 0x0000, 0x0000, 0x0000, 0x0B42,
+    0x0000, 0x0000, 0x0000, 0x0098, 0x0D36, 0x0000, 0x0000, 0x0DBB, 0x0A60, 0x02D0, 0x0000, 0x0C1F, 0x0000, 0x0BBA, 0x0000, 0x0000,
+    0x1190, 0x0000, 0x0CFE, 0x0000, 0x0316, 0x0000, 0x0C09, 0x100B, 0x0393, 0x0000, 0x09CF, 0x09C6, 0x0000, 0x0011, 0x0755, 0x0437,
+    0x0DE4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08C0, 0x0000, 0x0FE8, 0x111B, 0x0F85, 0x0379, 0x0D95, 0x03DE, 0x0000,
+    0x0DED, 0x0000, 0x0EE2, 0x0000, 0x04FF, 0x0274, 0x0016, 0x0000, 0x0000, 0x0000, 0x12B0, 0x034E, 0x0000, 0x06D3, 0x0C8E, 0x0000,
+    0x0000, 0x0000, 0x107B, 0x09E5, 0x0000, 0x09CE, 0x0B68, 0x02C7, 0x0000, 0x01E4, 0x0000, 0x038F, 0x0000, 0x1005, 0x0000, 0x0A93,
+    0x1047, 0x0C70, 0x0DE5, 0x0F18, 0x0000, 0x0C01, 0x0000, 0x106A, 0x1415, 0x0000, 0x0521, 0x0000, 0x0E66, 0x0B46, 0x126C, 0x05BC,
+    0x1183, 0x1378, 0x113D, 0x0000, 0x0000, 0x0000, 0x06A7, 0x0100, 0x1163, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07D3,
+    0x0BC2, 0x0D49, 0x0000, 0x0BF6, 0x006D, 0x00E1, 0x11C9, 0x0D4F, 0x061D, 0x0000, 0x0E52, 0x0000, 0x029C, 0x0000, 0x070B, 0x025B,
+    0x0699, 0x0000, 0x106D, 0x05E5, 0x005D, 0x0000, 0x0000, 0x02EC, 0x0000, 0x0000, 0x0733, 0x0000, 0x0000, 0x0FA8, 0x0AF8, 0x09B9,
+    0x0936, 0x049D, 0x00BE, 0x0000, 0x0D5A, 0x04ED, 0x0000, 0x0000, 0x07BF, 0x0000, 0x0000, 0x099D, 0x0CE9, 0x0FF2, 0x102C, 0x0000,
+    0x13F7, 0x0000, 0x0A1B, 0x0000, 0x077E, 0x0000, 0x0000, 0x0D72, 0x0000, 0x0845, 0x0C62, 0x0000, 0x114C, 0x0336, 0x0000, 0x0000,
+    0x136F, 0x0000, 0x0B51, 0x0259, 0x0000, 0x10B1, 0x0000, 0x0000, 0x00D4, 0x0FCC, 0x1214, 0x0000, 0x0B36, 0x1020, 0x1045, 0x0000,
+    0x056B, 0x1225, 0x1048, 0x0F5A, 0x0A5A, 0x0000, 0x0EFB, 0x0F9B, 0x0734, 0x01BB, 0x0000, 0x10D9, 0x0064, 0x0032, 0x0000, 0x0913,
+    0x0E5D, 0x0000, 0x0000, 0x1326, 0x0A86, 0x0000, 0x0000, 0x0000, 0x0723, 0x0484, 0x12C2, 0x1162, 0x0000, 0x0168, 0x00F3, 0x0DBE,
+    0x03F0, 0x04D8, 0x0BB7, 0x0965, 0x01D2, 0x0623, 0x0000, 0x0583, 0x0000, 0x07F6, 0x142A, 0x0D67, 0x059C, 0x0CE8, 0x0520, 0x0000,
+    0x0A67, 0x10CE, 0x0000, 0x02E1, 0x0000, 0x0CBD, 0x12AB, 0x12D2, 0x05BE, 0x1296, 0x0000, 0x0000, 0x05D0, 0x029D, 0x10AA, 0x0BBE,
+    0x083A, 0x0000, 0x05BD, 0x10C2, 0x115F, 0x0000, 0x0000, 0x108C, 0x1365, 0x07A3, 0x0E70, 0x0000, 0x01EB, 0x0FDC, 0x091A, 0x0740,
+    0x0000, 0x00F0, 0x0A90, 0x0000, 0x0000, 0x105B, 0x0104, 0x0000, 0x0000, 0x10B6, 0x0787, 0x0469, 0x136E, 0x0000, 0x0000, 0x0F51,
+    0x0696, 0x0A18, 0x0C10, 0x1418, 0x0178, 0x0000, 0x012E, 0x0501, 0x097B, 0x0D22, 0x0827, 0x0F70, 0x0000, 0x0000, 0x084A, 0x0903,
+    0x1179, 0x0000, 0x0000, 0x09B4, 0x0CCA, 0x0000, 0x0BB2, 0x0000, 0x0AB6, 0x03A8, 0x0000, 0x0BE7, 0x142C, 0x0F9C, 0x0D96, 0x0000,
+    0x0000, 0x0255, 0x0ECF, 0x047E, 0x062C, 0x004F, 0x0000, 0x0602, 0x0184, 0x0273, 0x0000, 0x00ED, 0x0000, 0x0000, 0x0000, 0x13BA,
+    0x037D, 0x0977, 0x0000, 0x1126, 0x0BAA, 0x0C7F, 0x0000, 0x05ED, 0x0D1A, 0x0B1A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A02, 0x0000,
+    0x0E41, 0x0000, 0x0000, 0x0535, 0x0BF0, 0x03F9, 0x0000, 0x0969, 0x0000, 0x0000, 0x019A, 0x072A, 0x0000, 0x0CBF, 0x0000, 0x1357,
+    0x10D1, 0x06EE, 0x0000, 0x0000, 0x131A, 0x0C19, 0x0B99, 0x0FE2, 0x0964, 0x079D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0033, 0x052D,
+    0x0E60, 0x06FE, 0x0FC5, 0x0644, 0x046D, 0x030E, 0x0000, 0x0000, 0x0CF3, 0x0D4C, 0x0000, 0x0000, 0x0ABC, 0x0000, 0x0FB9, 0x0000,
+    0x0000, 0x0000, 0x0CC8, 0x0000, 0x0961, 0x0AC1, 0x0000, 0x0BB5, 0x056E, 0x121D, 0x04F3, 0x0000, 0x0FFA, 0x0C8A, 0x0000, 0x00CD,
+    0x126E, 0x03C5, 0x0CB3, 0x0F90, 0x1273, 0x0000, 0x0000, 0x0062, 0x0B83, 0x10BB, 0x0000, 0x0709, 0x0000, 0x0E01, 0x0F24, 0x01B5,
+    0x0D16, 0x0DBC, 0x0000, 0x0000, 0x0E4D, 0x135A, 0x0000, 0x065E, 0x12FE, 0x0000, 0x0000, 0x0275, 0x0D9C, 0x0785, 0x1185, 0x020C,
+    0x0323, 0x0000, 0x0000, 0x04DA, 0x0000, 0x0000, 0x0000, 0x0FEF, 0x05A2, 0x0000, 0x01EC, 0x0000, 0x12B7, 0x0BD8, 0x07CC, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1318, 0x0000, 0x0000, 0x0000, 0x0000, 0x10B0, 0x0000, 0x09E1, 0x0882,
+    0x0000, 0x023F, 0x0000, 0x0E1F, 0x0000, 0x0000, 0x046E, 0x0716, 0x0000, 0x1239, 0x0BD9, 0x116A, 0x0A32, 0x0000, 0x0E48, 0x10A8,
+    0x0F3C, 0x0DB0, 0x0000, 0x0880, 0x0000, 0x133B, 0x076F, 0x00BC, 0x0000, 0x0C85, 0x0F04, 0x0000, 0x02FA, 0x0000, 0x0CAC, 0x0000,
+    0x06DE, 0x067C, 0x051B, 0x02D9, 0x0A70, 0x064B, 0x0D4D, 0x0000, 0x0983, 0x113C, 0x1366, 0x0000, 0x0B9B, 0x035B, 0x0000, 0x116F,
+    0x0000, 0x12DB, 0x0B2F, 0x13AE, 0x0354, 0x0478, 0x0000, 0x118A, 0x0AD1, 0x1344, 0x05B1, 0x0000, 0x00BF, 0x0C35, 0x0BAE, 0x0C14,
+    0x0204, 0x1277, 0x085C, 0x0000, 0x0000, 0x0E7C, 0x13B4, 0x0C80, 0x0416, 0x0000, 0x01C5, 0x012D, 0x0ABB, 0x01B3, 0x0BD2, 0x0240,
+    0x0000, 0x0000, 0x0000, 0x02BF, 0x053C, 0x0D24, 0x0000, 0x084F, 0x0A83, 0x04C2, 0x0000, 0x1189, 0x0000, 0x0000, 0x0742, 0x0A55,
+    0x0000, 0x1305, 0x0020, 0x0E15, 0x03B5, 0x00B5, 0x0F3E, 0x0481, 0x0000, 0x108A, 0x1142, 0x0000, 0x0BF8, 0x0E90, 0x09C2, 0x0000,
+    0x0919, 0x09D3, 0x0000, 0x0A6E, 0x1029, 0x0488, 0x0C99, 0x1116, 0x0ABA, 0x0000, 0x0000, 0x1425, 0x082B, 0x0000, 0x0E30, 0x03EC,
+    0x0000, 0x02F8, 0x0B7B, 0x0000, 0x0000, 0x117A, 0x0000, 0x0A5B, 0x1392, 0x0725, 0x0053, 0x11CF, 0x05E2, 0x0000, 0x0EDF, 0x1009,
+    0x0000, 0x0000, 0x0000, 0x063B, 0x0BCF, 0x0B32, 0x0D77, 0x1359, 0x0F8C, 0x0874, 0x0D29, 0x10B9, 0x04D9, 0x0FEE, 0x055B, 0x04B4,
+    0x0000, 0x0000, 0x07CD, 0x0EAA, 0x0CB8, 0x0000, 0x1257, 0x0A16, 0x06D6, 0x0000, 0x028E, 0x1351, 0x03BA, 0x0DA0, 0x02C6, 0x06E0,
+    0x0000, 0x0264, 0x0000, 0x009C, 0x0000, 0x09C4, 0x0A42, 0x1035, 0x0000, 0x0A61, 0x0000, 0x0000, 0x039E, 0x0866, 0x0000, 0x110E,
+    0x051F, 0x093C, 0x054D, 0x0000, 0x0000, 0x0E95, 0x0DA9, 0x0000, 0x0D8A, 0x0FFB, 0x0000, 0x0000, 0x08DB, 0x0000, 0x0000, 0x0000,
+    0x0C2F, 0x05DC, 0x02FB, 0x098D, 0x1282, 0x0000, 0x04BB, 0x0A39, 0x1139, 0x0543, 0x0B7A, 0x0C3E, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0E1C, 0x00BB, 0x0A96, 0x0000, 0x006F, 0x0CBB, 0x0000, 0x109B, 0x0000, 0x0000, 0x0DD1, 0x0000, 0x0AE9,
+    0x07B0, 0x00B2, 0x0000, 0x0F15, 0x0000, 0x0AFF, 0x0000, 0x0864, 0x0000, 0x0389, 0x0000, 0x04CB, 0x0000, 0x048F, 0x0B70, 0x0000,
+    0x096C, 0x03F1, 0x0000, 0x0000, 0x07B6, 0x07A2, 0x1345, 0x00A1, 0x0EDD, 0x0C2E, 0x025D, 0x0901, 0x0000, 0x0000, 0x06F4, 0x034B,
+    0x0000, 0x0000, 0x003F, 0x04EB, 0x0D2C, 0x08A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x04F5, 0x033F, 0x089F, 0x11F9, 0x03CC, 0x0000,
+    0x0002, 0x0BA4, 0x0000, 0x0000, 0x1307, 0x1103, 0x050C, 0x0DD4, 0x088D, 0x0C05, 0x024B, 0x0000, 0x00FC, 0x0FCD, 0x0000, 0x087F,
+    0x0000, 0x0000, 0x0000, 0x113F, 0x0B33, 0x01A9, 0x0000, 0x1100, 0x0073, 0x0000, 0x0227, 0x0000, 0x0000, 0x1061, 0x0AA2, 0x06FF,
+    0x124A, 0x0000, 0x0000, 0x13A1, 0x0000, 0x0F96, 0x0000, 0x102B, 0x0F4C, 0x031F, 0x084B, 0x0A84, 0x0000, 0x03FF, 0x0000, 0x0000,
+    0x0000, 0x03A2, 0x12F4, 0x0000, 0x0D28, 0x04E3, 0x0ED3, 0x0509, 0x106B, 0x0000, 0x0000, 0x0000, 0x0F5B, 0x11B5, 0x0D01, 0x0000,
+    0x0959, 0x121B, 0x055E, 0x0A50, 0x0215, 0x0000, 0x1065, 0x0960, 0x04AB, 0x0000, 0x122C, 0x0A1E, 0x0D60, 0x0148, 0x04A7, 0x02A3,
+    0x13F6, 0x0000, 0x0000, 0x0BD4, 0x0CE7, 0x0BE5, 0x09A5, 0x0E2E, 0x0000, 0x0000, 0x0000, 0x024C, 0x0000, 0x0000, 0x02BE, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x04E8, 0x0793, 0x0000, 0x0000, 0x0492, 0x0A99, 0x0000, 0x10C8, 0x0F4D, 0x0039, 0x12FF, 0x1089,
+    0x0D09, 0x0000, 0x016B, 0x0557, 0x0975, 0x0301, 0x01FA, 0x110D, 0x0C6F, 0x0000, 0x0000, 0x047C, 0x0BEB, 0x1078, 0x0DDE, 0x04C1,
+    0x0000, 0x0CFF, 0x125D, 0x0FE6, 0x0C5D, 0x13FF, 0x10BA, 0x1294, 0x0000, 0x0000, 0x0886, 0x0A1D, 0x0AD6, 0x0000, 0x0000, 0x0ED6,
+    0x1209, 0x0000, 0x0000, 0x07AE, 0x0000, 0x0212, 0x0000, 0x05DD, 0x0288, 0x0000, 0x0000, 0x04D5, 0x0000, 0x0EBF, 0x0000, 0x0000,
+    0x0846, 0x0000, 0x0F93, 0x0979, 0x05DA, 0x0000, 0x0000, 0x0000, 0x02CF, 0x131F, 0x0000, 0x06BB, 0x0000, 0x0BD5, 0x0000, 0x07BD,
+    0x0E02, 0x0000, 0x0000, 0x0BFE, 0x11F6, 0x01B4, 0x0DEC, 0x1353, 0x0A4C, 0x0000, 0x0000, 0x0F0A, 0x0FB1, 0x0C8B, 0x0FB5, 0x04A9,
+    0x0367, 0x07EA, 0x0DE3, 0x0000, 0x0423, 0x11B3, 0x0B5F, 0x01C4, 0x04EE, 0x120B, 0x0000, 0x0BEF, 0x0000, 0x0000, 0x064F, 0x03CA,
+    0x0000, 0x0476, 0x0000, 0x0687, 0x0000, 0x0652, 0x0847, 0x0000, 0x1049, 0x0000, 0x0000, 0x0000, 0x0368, 0x1298, 0x0A8D, 0x0EE8,
+    0x0000, 0x0000, 0x1338, 0x05CC, 0x0615, 0x107D, 0x0000, 0x0000, 0x00C7, 0x0453, 0x0C84, 0x1336, 0x04B6, 0x0F2F, 0x0B37, 0x12E0,
+    0x0998, 0x04AE, 0x132C, 0x0000, 0x0000, 0x0000, 0x074E, 0x0000, 0x037C, 0x0F1B, 0x0B03, 0x143A, 0x09B5, 0x0000, 0x0000, 0x0FB2,
+    0x0000, 0x0000, 0x0000, 0x0976, 0x0820, 0x0000, 0x0C1B, 0x06EF, 0x0000, 0x00F7, 0x03C9, 0x0000, 0x03DC, 0x0796, 0x0000, 0x0F6A,
+    0x0890, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0614, 0x02DB, 0x0000, 0x138D, 0x0000, 0x1432, 0x05F2, 0x00B9,
+    0x08BE, 0x1374, 0x0717, 0x00D0, 0x0000, 0x0000, 0x0000, 0x06A0, 0x0000, 0x0000, 0x0626, 0x0679, 0x0807, 0x1098, 0x0A11, 0x0000,
+    0x09BA, 0x0B4F, 0x0000, 0x0000, 0x0877, 0x0000, 0x0759, 0x0E79, 0x0000, 0x1101, 0x0000, 0x0000, 0x0635, 0x0000, 0x0EA8, 0x0000,
+    0x0000, 0x09E9, 0x0000, 0x0EFA, 0x0E9D, 0x0000, 0x0000, 0x05CA, 0x0F10, 0x0C57, 0x0B22, 0x0000, 0x01D5, 0x039B, 0x00A8, 0x0AAD,
+    0x0D51, 0x0000, 0x0DF9, 0x1236, 0x089B, 0x0F34, 0x11D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x04D3, 0x08CC, 0x0000, 0x0378, 0x0781,
+    0x0000, 0x0000, 0x1435, 0x0000, 0x126B, 0x0000, 0x0000, 0x0000, 0x016C, 0x0000, 0x0000, 0x1196, 0x13B6, 0x0000, 0x0000, 0x0A41,
+    0x004C, 0x0000, 0x0553, 0x0000, 0x1243, 0x01A7, 0x1051, 0x0D50, 0x0014, 0x1060, 0x0DA3, 0x058E, 0x0589, 0x0000, 0x0778, 0x09F4,
+    0x126A, 0x06AB, 0x03D9, 0x10AF, 0x073B, 0x0000, 0x005A, 0x110B, 0x00DA, 0x0000, 0x0000, 0x0BF4, 0x1120, 0x07FC, 0x06BE, 0x0322,
+    0x0015, 0x0000, 0x0A74, 0x0000, 0x1249, 0x024F, 0x0438, 0x10E0, 0x0000, 0x0918, 0x0E5B, 0x0E89, 0x05AA, 0x0000, 0x01C3, 0x0000,
+    0x0000, 0x0000, 0x0835, 0x1180, 0x0768, 0x0A20, 0x09BE, 0x01B1, 0x0000, 0x0707, 0x0CE1, 0x00A7, 0x05E4, 0x130B, 0x0000, 0x0000,
+    0x0A2B, 0x045F, 0x0000, 0x0000, 0x0000, 0x10E2, 0x01A2, 0x0000, 0x105F, 0x0828, 0x0D99, 0x0BC7, 0x0000, 0x05E1, 0x0695, 0x0801,
+    0x0000, 0x0000, 0x0605, 0x0000, 0x0000, 0x0000, 0x0000, 0x056A, 0x0000, 0x0517, 0x0ADF, 0x0146, 0x0AAF, 0x0000, 0x0000, 0x0A48,
+    0x12E3, 0x03EA, 0x04AA, 0x0000, 0x004A, 0x1077, 0x0524, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F7C, 0x0000, 0x07C5, 0x1222, 0x0FBA,
+    0x0000, 0x0000, 0x0468, 0x0000, 0x0024, 0x0000, 0x0000, 0x00EE, 0x0000, 0x071C, 0x023E, 0x0000, 0x0000, 0x0263, 0x125F, 0x12D0,
+    0x09EB, 0x0000, 0x114F, 0x0000, 0x048D, 0x0CDE, 0x0000, 0x0000, 0x0000, 0x128E, 0x0BDC, 0x0004, 0x0000, 0x0647, 0x07CF, 0x0261,
+    0x0000, 0x0000, 0x10FB, 0x0000, 0x0334, 0x0BC0, 0x076A, 0x0B35, 0x0000, 0x09C7, 0x0000, 0x0D63, 0x0BE0, 0x0036, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0731, 0x0000, 0x12B4, 0x0276, 0x0000, 0x05A0, 0x0F0B, 0x1290, 0x0000, 0x0000, 0x0539, 0x0000, 0x0000,
+    0x0000, 0x12C1, 0x1320, 0x0F81, 0x0000, 0x0AA6, 0x0000, 0x0417, 0x0000, 0x0EE6, 0x0421, 0x03AB, 0x0D73, 0x0ADB, 0x0F68, 0x0000,
+    0x0000, 0x0000, 0x0672, 0x0000, 0x0067, 0x1238, 0x0E3A, 0x0843, 0x0000, 0x1193, 0x0000, 0x0411, 0x0896, 0x0ABF, 0x0DD6, 0x0346,
+    0x0000, 0x0791, 0x0000, 0x0000, 0x0000, 0x1411, 0x06D9, 0x0E73, 0x0000, 0x0D5D, 0x0721, 0x012A, 0x052A, 0x0A4D, 0x0000, 0x013F,
+    0x0000, 0x110F, 0x0475, 0x1438, 0x09F9, 0x0000, 0x1417, 0x0080, 0x0000, 0x0000, 0x1062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x12FA, 0x0000, 0x0305, 0x0B2A, 0x0000, 0x0B95, 0x0000, 0x0000, 0x0B8F, 0x13F5, 0x12E4, 0x0000, 0x0000, 0x06A1, 0x0645, 0x0000,
+    0x0000, 0x0000, 0x12A6, 0x0000, 0x0385, 0x0000, 0x0000, 0x0D5B, 0x1398, 0x0000, 0x1234, 0x0000, 0x13EC, 0x0ED7, 0x1044, 0x0000,
+    0x0D55, 0x0D79, 0x0C32, 0x0000, 0x0FAB, 0x0003, 0x0D65, 0x1105, 0x0338, 0x08A1, 0x01AD, 0x0BAD, 0x0B17, 0x0176, 0x0B78, 0x0AC3,
+    0x0461, 0x0A69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D15, 0x0000, 0x0000, 0x0996, 0x0D3A, 0x0683, 0x0000, 0x0331, 0x03F5,
+    0x0000, 0x1391, 0x017B, 0x0C87, 0x0000, 0x0000, 0x0000, 0x075F, 0x0000, 0x0000, 0x01ED, 0x0E33, 0x0000, 0x0000, 0x05EE, 0x06CE,
+    0x0059, 0x0000, 0x1128, 0x0000, 0x094D, 0x103C, 0x0000, 0x0000, 0x02B0, 0x0000, 0x0000, 0x00B0, 0x0000, 0x0000, 0x0E2B, 0x0B6C,
+    0x0000, 0x0000, 0x08B2, 0x119F, 0x0610, 0x0000, 0x117C, 0x0E94, 0x0000, 0x0DCF, 0x0341, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0026, 0x0000, 0x0BC6, 0x0F05, 0x13BC, 0x00AA, 0x0618, 0x0000, 0x0000, 0x0F5D, 0x083B, 0x038D, 0x0000, 0x0209, 0x0000, 0x0000,
+    0x0000, 0x048C, 0x1099, 0x0000, 0x0000, 0x0000, 0x1173, 0x0A2F, 0x0000, 0x0B1F, 0x0F12, 0x12E8, 0x13C7, 0x1401, 0x0000, 0x0249,
+    0x0000, 0x0CD5, 0x099B, 0x0130, 0x081C, 0x0000, 0x0895, 0x10DF, 0x0FED, 0x0824, 0x0000, 0x011A, 0x02DA, 0x05C4, 0x07D9, 0x0DF3,
+    0x0000, 0x00D9, 0x12FB, 0x0E1E, 0x0000, 0x044E, 0x0EF6, 0x01D9, 0x00FE, 0x0000, 0x10CB, 0x095F, 0x0298, 0x142B, 0x0000, 0x0F1F,
+    0x0000, 0x0000, 0x0000, 0x0251, 0x0000, 0x0AF2, 0x0AE6, 0x0809, 0x0000, 0x0000, 0x11F8, 0x129A, 0x0E43, 0x0000, 0x029B, 0x0000,
+    0x065C, 0x072D, 0x0EB7, 0x09A4, 0x0000, 0x0EA2, 0x0000, 0x071F, 0x0F60, 0x0000, 0x0000, 0x0E22, 0x0000, 0x0B7F, 0x04CF, 0x0000,
+    0x04AD, 0x0000, 0x0B19, 0x0D46, 0x08DE, 0x0B8B, 0x0E0C, 0x0465, 0x0000, 0x09F2, 0x0000, 0x0000, 0x1409, 0x0715, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C37, 0x0E91, 0x034D, 0x1402, 0x0000, 0x0CF2, 0x1416, 0x0000,
+    0x112F, 0x0452, 0x1192, 0x093F, 0x0D7F, 0x131D, 0x0460, 0x0EE3, 0x0256, 0x033D, 0x0000, 0x020B, 0x077A, 0x0000, 0x0000, 0x01E6,
+    0x0542, 0x0000, 0x067B, 0x0000, 0x0000, 0x0000, 0x0BFD, 0x01E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x02E4, 0x09C3, 0x0154, 0x0000,
+    0x1072, 0x100C, 0x0000, 0x0446, 0x0000, 0x0DB7, 0x017C, 0x0F22, 0x0000, 0x1043, 0x0C98, 0x0313, 0x02C9, 0x0ED0, 0x0949, 0x0457,
+    0x0000, 0x05B6, 0x0F77, 0x0000, 0x0ACD, 0x1131, 0x0000, 0x0000, 0x0AE1, 0x0000, 0x1157, 0x0000, 0x0F3B, 0x00E0, 0x0F74, 0x0000,
+    0x0000, 0x11CB, 0x0000, 0x10CF, 0x02DE, 0x0704, 0x0000, 0x0958, 0x0000, 0x0697, 0x0BB3, 0x00AB, 0x0000, 0x0000, 0x0000, 0x0798,
+    0x0462, 0x0000, 0x020E, 0x104C, 0x0078, 0x0000, 0x0D2D, 0x112E, 0x01D8, 0x07DD, 0x0173, 0x0659, 0x0775, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0556, 0x073C, 0x1074, 0x0000, 0x0966, 0x0000, 0x0000, 0x0000, 0x043E, 0x0000, 0x02F3, 0x0000, 0x0413, 0x09E6, 0x0000,
+    0x09B1, 0x0000, 0x0000, 0x107E, 0x0F78, 0x0000, 0x0000, 0x0000, 0x0E20, 0x0000, 0x0306, 0x0000, 0x0863, 0x0540, 0x1109, 0x141B,
+    0x13DD, 0x0CC6, 0x0000, 0x03B4, 0x0000, 0x10AC, 0x0000, 0x0000, 0x0A9C, 0x0000, 0x0D19, 0x0B8E, 0x0BE3, 0x0000, 0x0000, 0x02FE,
+    0x0C03, 0x0DA8, 0x0ED9, 0x0CBC, 0x032C, 0x07B3, 0x1059, 0x0000, 0x0000, 0x0724, 0x0D7D, 0x0000, 0x10DD, 0x08C4, 0x04C3, 0x0CDD,
+    0x071A, 0x0AAB, 0x0318, 0x0BA6, 0x0B72, 0x0000, 0x0000, 0x0CF1, 0x0000, 0x092A, 0x0000, 0x0000, 0x0AB5, 0x0ADC, 0x0EB9, 0x08B1,
+    0x0000, 0x0000, 0x0172, 0x03FE, 0x0000, 0x0550, 0x0088, 0x01BF, 0x0000, 0x03A3, 0x1385, 0x0035, 0x0000, 0x1283, 0x0000, 0x0800,
+    0x09E3, 0x0000, 0x12F0, 0x0000, 0x0A4E, 0x0000, 0x12F3, 0x0000, 0x0000, 0x0000, 0x091E, 0x0CA5, 0x0000, 0x0EF3, 0x0862, 0x0ECD,
+    0x021A, 0x10DC, 0x0145, 0x0000, 0x0978, 0x0396, 0x05C1, 0x04E1, 0x0000, 0x0000, 0x0B05, 0x0000, 0x0AE4, 0x0532, 0x0000, 0x0000,
+    0x0CF0, 0x0F4A, 0x0217, 0x0000, 0x08BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DD, 0x0000, 0x07AF, 0x0FCA, 0x0F42, 0x077B, 0x0DEB,
+    0x05B5, 0x0850, 0x0E18, 0x03BD, 0x119E, 0x0000, 0x1399, 0x0000, 0x0000, 0x0000, 0x02F7, 0x0000, 0x0000, 0x0321, 0x0991, 0x0000,
+    0x0000, 0x0D0B, 0x1223, 0x11BD, 0x12FD, 0x0512, 0x07CE, 0x0000, 0x0000, 0x0000, 0x0FB7, 0x0000, 0x0000, 0x13E5, 0x101A, 0x028D,
+    0x10ED, 0x1127, 0x0000, 0x1330, 0x13B7, 0x0000, 0x0000, 0x11C5, 0x12D8, 0x0C69, 0x0000, 0x0CED, 0x0000, 0x1329, 0x0000, 0x013C,
+    0x0000, 0x0074, 0x129F, 0x0865, 0x0000, 0x0CC4, 0x0000, 0x0624, 0x1091, 0x0000, 0x0570, 0x0FE0, 0x068F, 0x0000, 0x0A31, 0x0406,
+    0x0502, 0x0D3F, 0x0000, 0x06DA, 0x033B, 0x0075, 0x1053, 0x0000, 0x11B1, 0x13DC, 0x0000, 0x083F, 0x0B13, 0x05A6, 0x041C, 0x11A7,
+    0x0855, 0x0234, 0x0000, 0x09DB, 0x0169, 0x0DCA, 0x066E, 0x0000, 0x0C06, 0x0000, 0x0FE9, 0x0000, 0x0561, 0x0000, 0x0000, 0x07B5,
+    0x0000, 0x0000, 0x085F, 0x0FD8, 0x0000, 0x104B, 0x0000, 0x1406, 0x0000, 0x0922, 0x0000, 0x0000, 0x129C, 0x0C26, 0x09D0, 0x112D,
+    0x0000, 0x0000, 0x0000, 0x0FC3, 0x075B, 0x011E, 0x0147, 0x0012, 0x0000, 0x11BE, 0x0000, 0x0000, 0x0BB1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0A9F, 0x03A1, 0x0DF4, 0x1264, 0x0000, 0x0821, 0x0000, 0x0000, 0x03CB, 0x061F, 0x1008, 0x0000, 0x0A43, 0x0447,
+    0x0867, 0x0000, 0x0000, 0x0000, 0x0DA4, 0x007B, 0x0831, 0x0C92, 0x0137, 0x0000, 0x0CBE, 0x0000, 0x0000, 0x08EE, 0x0C5A, 0x0427,
+    0x08D5, 0x0037, 0x0000, 0x0369, 0x13D9, 0x0000, 0x0096, 0x070D, 0x02D6, 0x0000, 0x0000, 0x0914, 0x09A2, 0x1129, 0x03D1, 0x0000,
+    0x0889, 0x0B41, 0x0000, 0x0937, 0x0000, 0x0CEB, 0x02AB, 0x0000, 0x01B6, 0x08F3, 0x0000, 0x133A, 0x07F9, 0x0000, 0x0000, 0x0AB8,
+    0x0D98, 0x0933, 0x0000, 0x0226, 0x134B, 0x0000, 0x01F2, 0x0000, 0x0000, 0x068E, 0x0658, 0x1390, 0x0B06, 0x0935, 0x0000, 0x12D3,
+    0x0C79, 0x0000, 0x13FD, 0x1281, 0x1092, 0x0FE5, 0x079A, 0x0000, 0x0000, 0x018B, 0x0872, 0x0000, 0x0081, 0x0000, 0x0000, 0x0789,
+    0x0000, 0x01B7, 0x11A4, 0x0000, 0x0DD5, 0x0000, 0x13E7, 0x0000, 0x0000, 0x048A, 0x09C0, 0x0000, 0x101D, 0x10F0, 0x0000, 0x0E34,
+    0x0000, 0x0000, 0x0924, 0x0000, 0x138E, 0x1026, 0x105A, 0x0000, 0x0000, 0x10F1, 0x08B3, 0x0000, 0x095C, 0x0000, 0x0C13, 0x0270,
+    0x0000, 0x12A9, 0x0F9D, 0x0000, 0x08A7, 0x0000, 0x00E2, 0x0000, 0x0D40, 0x0486, 0x006E, 0x0000, 0x0C50, 0x010C, 0x0000, 0x0000,
+    0x0161, 0x0A35, 0x0D6D, 0x0691, 0x0C9F, 0x01B2, 0x0000, 0x0000, 0x0DB6, 0x0206, 0x0B9F, 0x0000, 0x13CF, 0x02B7, 0x0000, 0x0E09,
+    0x0D18, 0x00E4, 0x0000, 0x0F23, 0x0000, 0x07EC, 0x03C6, 0x0000, 0x0000, 0x0765, 0x13C1, 0x0000, 0x0573, 0x0000, 0x0000, 0x003A,
+    0x0207, 0x0DA5, 0x10E9, 0x03CF, 0x0D97, 0x0552, 0x0606, 0x06E2, 0x0E9B, 0x0000, 0x0000, 0x0000, 0x06F2, 0x06F0, 0x0000, 0x0523,
+    0x0C27, 0x0000, 0x08E7, 0x125B, 0x0000, 0x0000, 0x0000, 0x0000, 0x04F8, 0x0E7F, 0x0000, 0x11C4, 0x10F3, 0x0E32, 0x066C, 0x1108,
+    0x0250, 0x08F4, 0x05D2, 0x0000, 0x07D6, 0x11E5, 0x04DE, 0x0000, 0x0500, 0x030B, 0x08FF, 0x0FDF, 0x092F, 0x0995, 0x0000, 0x0A85,
+    0x1106, 0x0000, 0x0000, 0x0BB4, 0x0F43, 0x0000, 0x0000, 0x0000, 0x0560, 0x0135, 0x0000, 0x0000, 0x0000, 0x12F9, 0x0000, 0x0A3B,
+    0x0B23, 0x0000, 0x1311, 0x0000, 0x0000, 0x0DC7, 0x0328, 0x0C40, 0x0C76, 0x0000, 0x1007, 0x026E, 0x1041, 0x0000, 0x036C, 0x0B55,
+    0x0B30, 0x021E, 0x096D, 0x0000, 0x01D0, 0x0000, 0x038A, 0x0000, 0x083C, 0x08DA, 0x0000, 0x0000, 0x0B24, 0x0D0A, 0x0000, 0x0000,
+    0x0000, 0x0089, 0x0C78, 0x0000, 0x0000, 0x0F1A, 0x0000, 0x0CCF, 0x0181, 0x025C, 0x0000, 0x0473, 0x1339, 0x0000, 0x064A, 0x097E,
+    0x0000, 0x074A, 0x0000, 0x0000, 0x0000, 0x00B8, 0x138B, 0x0000, 0x0844, 0x082D, 0x0F76, 0x0000, 0x0CA9, 0x0000, 0x0000, 0x00B4,
+    0x1384, 0x0000, 0x0000, 0x095D, 0x05EB, 0x05F1, 0x0000, 0x072B, 0x0000, 0x0A0F, 0x0541, 0x0000, 0x0370, 0x0F37, 0x0000, 0x0000,
+    0x0000, 0x0FAD, 0x03D7, 0x0000, 0x0745, 0x0136, 0x0450, 0x0000, 0x059D, 0x0000, 0x065A, 0x0000, 0x0F6B, 0x0D33, 0x0000, 0x13B8,
+    0x0403, 0x115C, 0x05F6, 0x0000, 0x0D26, 0x0000, 0x0330, 0x0000, 0x0BCE, 0x0000, 0x0000, 0x0FDB, 0x0636, 0x0000, 0x1266, 0x0000,
+    0x0D3B, 0x0D9B, 0x09E8, 0x04BF, 0x0000, 0x0510, 0x0397, 0x0000, 0x038C, 0x024A, 0x0D6C, 0x0B52, 0x1118, 0x0000, 0x09EC, 0x0439,
+    0x0000, 0x05E3, 0x0000, 0x0407, 0x0000, 0x0000, 0x0442, 0x0000, 0x050F, 0x0000, 0x109F, 0x13D2, 0x0EEE, 0x0000, 0x0D71, 0x0000,
+    0x082C, 0x0000, 0x0000, 0x0000, 0x139B, 0x07E6, 0x0266, 0x11F2, 0x0BDB, 0x0000, 0x132E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C91,
+    0x141D, 0x11F0, 0x0C9B, 0x0E21, 0x1235, 0x1017, 0x0000, 0x05F3, 0x0000, 0x0B5B, 0x0000, 0x1337, 0x0CFA, 0x0456, 0x08E5, 0x0000,
+    0x0000, 0x0000, 0x0F82, 0x0000, 0x0000, 0x0000, 0x0309, 0x0000, 0x0000, 0x01AE, 0x0128, 0x0000, 0x0000, 0x1410, 0x026C, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0E86, 0x0000, 0x0203, 0x0AC0, 0x0399, 0x0D9E, 0x1112, 0x0000, 0x0000, 0x0830, 0x12E2, 0x0000, 0x03D4,
+    0x0555, 0x0000, 0x00A9, 0x0E57, 0x0000, 0x09AA, 0x093E, 0x0000, 0x079C, 0x0DC0, 0x0C25, 0x02F2, 0x11C6, 0x07D2, 0x09DC, 0x0000,
+    0x0000, 0x0000, 0x042D, 0x11E7, 0x0000, 0x0B18, 0x0000, 0x0000, 0x0000, 0x0000, 0x09D6, 0x0000, 0x11A3, 0x11F7, 0x0591, 0x0637,
+    0x0000, 0x0210, 0x0000, 0x084D, 0x0DDB, 0x0000, 0x07B4, 0x0000, 0x0596, 0x0000, 0x0000, 0x0000, 0x0BC4, 0x0000, 0x0000, 0x0483,
+    0x04BE, 0x0000, 0x00DE, 0x13F4, 0x044C, 0x0000, 0x0000, 0x0343, 0x0A57, 0x0F6F, 0x0000, 0x0000, 0x06D5, 0x0FA6, 0x0394, 0x0E2D,
+    0x086F, 0x111F, 0x0345, 0x0000, 0x0F28, 0x0000, 0x0569, 0x0000, 0x0868, 0x0000, 0x0000, 0x109D, 0x12C9, 0x01F8, 0x029A, 0x0000,
+    0x0000, 0x0000, 0x13FE, 0x0C46, 0x096F, 0x0000, 0x114D, 0x0000, 0x0000, 0x0000, 0x04B5, 0x0000, 0x0000, 0x0AB4, 0x071B, 0x0AFC,
+    0x0AC8, 0x00DB, 0x0000, 0x0000, 0x0072, 0x032E, 0x11FA, 0x06BD, 0x03A9, 0x0000, 0x0000, 0x0BA0, 0x06DC, 0x0F47, 0x0A62, 0x0BC3,
+    0x0000, 0x0000, 0x0F7A, 0x0000, 0x0873, 0x050D, 0x0FEB, 0x0926, 0x1006, 0x0962, 0x0000, 0x0000, 0x0000, 0x086D, 0x0840, 0x10D3,
+    0x0213, 0x00EA, 0x00C5, 0x0000, 0x0000, 0x0E87, 0x0132, 0x0000, 0x0739, 0x0000, 0x0386, 0x0B00, 0x0000, 0x0000, 0x06B2, 0x0194,
+    0x0000, 0x0D64, 0x0000, 0x0F63, 0x0000, 0x0000, 0x0D4A, 0x0E62, 0x008C, 0x0198, 0x03EB, 0x0000, 0x0000, 0x0681, 0x0000, 0x0000,
+    0x01A3, 0x0000, 0x05D3, 0x0000, 0x095E, 0x056F, 0x0AB7, 0x0EB0, 0x0000, 0x1312, 0x0F92, 0x1119, 0x0000, 0x0000, 0x0000, 0x06A3,
+    0x0D8E, 0x0000, 0x0326, 0x0000, 0x0000, 0x1093, 0x0000, 0x0000, 0x074C, 0x12CF, 0x016A, 0x032F, 0x126D, 0x0593, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0A6D, 0x0000, 0x0000, 0x0EA7, 0x0762, 0x001D, 0x0000, 0x01AF, 0x1014, 0x014B, 0x12C0, 0x0A0E,
+    0x0000, 0x01F3, 0x010A, 0x04D4, 0x017A, 0x0000, 0x10BD, 0x085A, 0x0000, 0x0000, 0x0000, 0x0FB0, 0x0000, 0x06B6, 0x1130, 0x0D75,
+    0x0000, 0x0000, 0x0085, 0x1203, 0x0000, 0x00C3, 0x0000, 0x0000, 0x03D2, 0x0000, 0x06EA, 0x0000, 0x0C49, 0x11E6, 0x0000, 0x045C,
+    0x0000, 0x0000, 0x0000, 0x0C67, 0x0000, 0x0930, 0x0000, 0x0123, 0x076B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0915, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0BBD, 0x0C7A, 0x0DB2, 0x0000, 0x0000, 0x08E8, 0x131B, 0x0A3F, 0x103E, 0x08D7, 0x0590, 0x0D5C, 0x0392, 0x00EB,
+    0x0FB6, 0x11A2, 0x0F0F, 0x0000, 0x0000, 0x0000, 0x08F5, 0x0000, 0x0000, 0x0000, 0x015C, 0x0000, 0x0000, 0x07F1, 0x088F, 0x1195,
+    0x13D4, 0x0DC1, 0x0F46, 0x0000, 0x05AF, 0x0047, 0x0000, 0x0000, 0x0000, 0x08D4, 0x1150, 0x1085, 0x11FD, 0x0625, 0x0000, 0x1292,
+    0x0662, 0x065D, 0x0DBA, 0x0170, 0x0491, 0x0000, 0x0000, 0x0324, 0x0A21, 0x0000, 0x124E, 0x0FD0, 0x0000, 0x0000, 0x0D00, 0x0000,
+    0x0F5F, 0x0000, 0x03E5, 0x0514, 0x0238, 0x05AE, 0x0D53, 0x08CF, 0x0000, 0x0ED4, 0x0BF7, 0x0348, 0x0000, 0x0000, 0x09FC, 0x0000,
+    0x11A8, 0x0000, 0x0000, 0x1083, 0x0000, 0x13FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x048B, 0x0000, 0x0000, 0x001A, 0x135C, 0x03C3,
+    0x0CD1, 0x128B, 0x0A12, 0x06D8, 0x086E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x032B, 0x0000, 0x09B2, 0x0000, 0x0000,
+    0x13D1, 0x0A38, 0x0DAC, 0x0776, 0x1113, 0x0000, 0x1024, 0x0C7C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0566, 0x0000, 0x0C88, 0x0000,
+    0x0000, 0x1028, 0x1030, 0x0DA7, 0x0A5C, 0x0000, 0x0000, 0x044D, 0x0000, 0x1071, 0x121C, 0x0418, 0x0B98, 0x053B, 0x0595, 0x0000,
+    0x01B8, 0x04C9, 0x1016, 0x0DF5, 0x062F, 0x133C, 0x0183, 0x0000, 0x0932, 0x0434, 0x03A5, 0x06E5, 0x0851, 0x0000, 0x0A0B, 0x0000,
+    0x02F6, 0x0000, 0x00E5, 0x0000, 0x0000, 0x1286, 0x0000, 0x08BA, 0x0C45, 0x0000, 0x0000, 0x0CA8, 0x0900, 0x0000, 0x0000, 0x033A,
+    0x0CA1, 0x073A, 0x0000, 0x0E3B, 0x0E6D, 0x0000, 0x0B7E, 0x0907, 0x0000, 0x06C0, 0x0000, 0x0384, 0x0068, 0x0000, 0x0A76, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0805, 0x0DAD, 0x0090, 0x0000, 0x0000, 0x0963, 0x0252, 0x03E1, 0x0000, 0x047F, 0x0FB8,
+    0x0374, 0x0134, 0x03F8, 0x0279, 0x0000, 0x0158, 0x07D7, 0x0000, 0x01DC, 0x0000, 0x0C94, 0x0000, 0x0000, 0x0C2C, 0x032A, 0x0EAD,
+    0x1302, 0x08F1, 0x0000, 0x0000, 0x049E, 0x0000, 0x0507, 0x13AC, 0x042F, 0x0000, 0x0C5B, 0x1144, 0x0B5A, 0x0000, 0x0C6E, 0x0000,
+    0x08B5, 0x0000, 0x0000, 0x0746, 0x0F91, 0x0E35, 0x0722, 0x0D7A, 0x0000, 0x097F, 0x0185, 0x0EBC, 0x1375, 0x0C1C, 0x1217, 0x0000,
+    0x05D7, 0x0000, 0x0000, 0x1268, 0x0EE1, 0x0DF1, 0x111A, 0x0000, 0x0000, 0x0000, 0x087D, 0x0BCC, 0x0000, 0x094A, 0x13C5, 0x0B8C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0EEC, 0x0000, 0x12F8, 0x052C, 0x0092, 0x0000, 0x0A97, 0x02B9, 0x06BA, 0x0A00, 0x0F27,
+    0x0042, 0x0DB1, 0x0F50, 0x0000, 0x0525, 0x065F, 0x0000, 0x0E97, 0x0000, 0x0000, 0x0D1F, 0x0000, 0x0000, 0x0076, 0x0000, 0x0E05,
+    0x0E00, 0x1224, 0x0000, 0x13A2, 0x0000, 0x0A95, 0x0613, 0x0A8F, 0x0000, 0x0FA2, 0x055C, 0x1254, 0x0372, 0x0E8C, 0x0B1B, 0x11F4,
+    0x0000, 0x0C2A, 0x0639, 0x0B12, 0x0686, 0x069A, 0x0000, 0x0233, 0x07FE, 0x0000, 0x0AF7, 0x013B, 0x06B0, 0x0142, 0x0533, 0x1381,
+    0x0000, 0x0A1A, 0x0000, 0x0000, 0x0BEE, 0x0000, 0x100E, 0x1159, 0x0607, 0x033E, 0x0744, 0x000F, 0x009D, 0x0000, 0x1372, 0x01B9,
+    0x11CA, 0x0000, 0x0000, 0x0314, 0x1198, 0x0D9D, 0x0587, 0x0000, 0x0377, 0x127A, 0x0000, 0x0000, 0x0000, 0x0BED, 0x0000, 0x0D07,
+    0x05EC, 0x0726, 0x07DC, 0x0D7C, 0x0366, 0x06AC, 0x1303, 0x0B4A, 0x0000, 0x08ED, 0x0000, 0x10BE, 0x0000, 0x009E, 0x0050, 0x0208,
+    0x06C7, 0x0000, 0x06D7, 0x0AFB, 0x00BA, 0x11E9, 0x11AD, 0x0BF5, 0x06F6, 0x0934, 0x0A04, 0x0000, 0x0166, 0x0000, 0x143B, 0x0000,
+    0x0000, 0x0000, 0x07EB, 0x077F, 0x13BB, 0x0F25, 0x130F, 0x0000, 0x090A, 0x0000, 0x0AC9, 0x01F0, 0x0000, 0x0981, 0x07C4, 0x1367,
+    0x0000, 0x1333, 0x099F, 0x0000, 0x11D6, 0x0DFE, 0x0000, 0x09DD, 0x0000, 0x0000, 0x0333, 0x02A4, 0x13CA, 0x0DDC, 0x0000, 0x0000,
+    0x0482, 0x0000, 0x03D3, 0x0EA1, 0x081A, 0x0878, 0x0B93, 0x0283, 0x0000, 0x0984, 0x09C8, 0x1228, 0x12DD, 0x0BC1, 0x10F6, 0x1073,
+    0x0000, 0x075A, 0x049A, 0x0C5E, 0x0431, 0x0000, 0x0000, 0x0000, 0x0941, 0x0000, 0x0000, 0x13ED, 0x002B, 0x0000, 0x0000, 0x0ADD,
+    0x0000, 0x02C0, 0x089A, 0x0262, 0x06F9, 0x12A3, 0x037E, 0x0000, 0x0CEE, 0x0000, 0x0000, 0x0000, 0x0000, 0x141A, 0x0000, 0x098E,
+    0x116C, 0x1393, 0x0000, 0x04BC, 0x03E8, 0x0000, 0x0EC7, 0x0000, 0x0CFC, 0x0000, 0x0000, 0x08BF, 0x0A52, 0x0ECE, 0x0A68, 0x09A7,
+    0x0000, 0x0077, 0x0000, 0x09FD, 0x0000, 0x0FC6, 0x0000, 0x0000, 0x120C, 0x01F1, 0x0000, 0x1233, 0x0EA6, 0x0000, 0x0000, 0x0258,
+    0x0E1A, 0x0000, 0x11FB, 0x043F, 0x0CD3, 0x0000, 0x0B1E, 0x0000, 0x0000, 0x09BD, 0x0000, 0x0C18, 0x0000, 0x0000, 0x04A2, 0x042B,
+    0x0FFF, 0x0574, 0x0000, 0x0D32, 0x135D, 0x008A, 0x10F2, 0x0000, 0x0000, 0x132B, 0x0000, 0x0000, 0x0AC7, 0x0410, 0x0CBA, 0x04C6,
+    0x010D, 0x0000, 0x0000, 0x0000, 0x0DDA, 0x108E, 0x00A6, 0x0000, 0x0000, 0x0526, 0x0000, 0x0000, 0x0802, 0x014D, 0x0000, 0x0E11,
+    0x1167, 0x000C, 0x0000, 0x13DE, 0x01A5, 0x0FFD, 0x0DD8, 0x0675, 0x12AF, 0x07A1, 0x0B0A, 0x0223, 0x0000, 0x0A26, 0x11A9, 0x0E61,
+    0x1110, 0x0899, 0x0000, 0x0065, 0x0FC1, 0x13E9, 0x0766, 0x1079, 0x0000, 0x0A47, 0x0000, 0x0000, 0x0DC9, 0x0DE9, 0x0633, 0x03DB,
+    0x0000, 0x1276, 0x0000, 0x11B4, 0x0F7E, 0x0592, 0x0000, 0x13C6, 0x0000, 0x0195, 0x09EE, 0x0000, 0x0AB9, 0x11C3, 0x0286, 0x00A2,
+    0x01BC, 0x13A7, 0x1205, 0x01F7, 0x0000, 0x018D, 0x0000, 0x10B2, 0x08BC, 0x0A87, 0x021B, 0x0CE4, 0x0AF4, 0x0000, 0x0A7F, 0x05EA,
+    0x0000, 0x0114, 0x0000, 0x0000, 0x0000, 0x0000, 0x09AD, 0x0AF9, 0x0EBB, 0x07DA, 0x112B, 0x122A, 0x0000, 0x0000, 0x139A, 0x0736,
+    0x08EA, 0x00FF, 0x07A6, 0x08D9, 0x06CC, 0x0000, 0x0472, 0x12C7, 0x0EA0, 0x0000, 0x02BA, 0x0000, 0x0AA0, 0x13BE, 0x0BA3, 0x07AC,
+    0x02D8, 0x0B08, 0x0000, 0x0000, 0x02E7, 0x0F62, 0x0810, 0x06B4, 0x030A, 0x12C5, 0x10DB, 0x06E6, 0x0537, 0x08A0, 0x10E8, 0x0B9D,
+    0x0000, 0x1412, 0x0711, 0x0000, 0x0287, 0x0000, 0x0000, 0x0000, 0x0000, 0x1114, 0x0AF1, 0x11BF, 0x0000, 0x022D, 0x0009, 0x0361,
+    0x0C58, 0x0000, 0x0000, 0x0673, 0x0000, 0x0106, 0x0000, 0x0000, 0x0000, 0x08CB, 0x0DC2, 0x09EF, 0x0F84, 0x0000, 0x03BF, 0x02B1,
+    0x0000, 0x01E7, 0x02A1, 0x015B, 0x135F, 0x0041, 0x0000, 0x101B, 0x10A2, 0x0C75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0879,
+    0x0FDA, 0x0F67, 0x0B3E, 0x0000, 0x0000, 0x0000, 0x0303, 0x031D, 0x10C5, 0x09DA, 0x10A3, 0x0000, 0x0143, 0x0000, 0x0000, 0x04F1,
+    0x0853, 0x0B28, 0x063C, 0x1216, 0x0849, 0x12F5, 0x11EB, 0x004B, 0x0496, 0x0000, 0x0E77, 0x0E36, 0x0000, 0x00B1, 0x0D0D, 0x0E56,
+    0x0E2F, 0x0522, 0x0EAB, 0x127F, 0x014C, 0x1219, 0x0000, 0x0EF2, 0x0000, 0x0000, 0x0FD7, 0x0A9D, 0x1270, 0x01CA, 0x0F2B, 0x0FFC,
+    0x110C, 0x0086, 0x0000, 0x0D8F, 0x0A10, 0x12A4, 0x0000, 0x0957, 0x0101, 0x0000, 0x0000, 0x0AA5, 0x1241, 0x06B5, 0x012F, 0x0DD2,
+    0x0954, 0x0490, 0x11D4, 0x0000, 0x12EC, 0x04EF, 0x0C89, 0x0B6F, 0x0000, 0x0804, 0x0000, 0x0000, 0x0AA1, 0x0000, 0x01A6, 0x0E75,
+    0x0000, 0x0701, 0x0690, 0x0000, 0x0000, 0x119B, 0x0000, 0x07CB, 0x131C, 0x03BC, 0x129B, 0x02E6, 0x09C9, 0x0000, 0x0CCB, 0x0E0F,
+    0x08BD, 0x0BF3, 0x0232, 0x0A79, 0x0000, 0x0000, 0x0000, 0x13AF, 0x0000, 0x04EA, 0x0000, 0x0B71, 0x111E, 0x0C0F, 0x0000, 0x0000,
+    0x0000, 0x0923, 0x0000, 0x0000, 0x1197, 0x0000, 0x06C3, 0x0000, 0x0538, 0x0E3E, 0x0000, 0x0000, 0x061C, 0x05CF, 0x0000, 0x0CE0,
+    0x0000, 0x0FC8, 0x0000, 0x1229, 0x0DA2, 0x0A51, 0x0000, 0x122E, 0x0000, 0x122F, 0x0000, 0x123B, 0x0000, 0x0A1F, 0x0000, 0x1431,
+    0x0000, 0x0001, 0x0FEC, 0x10C3, 0x1430, 0x0AE5, 0x03C1, 0x0A7E, 0x0000, 0x0000, 0x0443, 0x0D30, 0x0951, 0x0000, 0x0220, 0x0D62,
+    0x0000, 0x0000, 0x0144, 0x0000, 0x12A7, 0x0000, 0x00E3, 0x0000, 0x0F9F, 0x05C6, 0x0000, 0x0904, 0x0000, 0x123F, 0x0125, 0x13CE,
+    0x047B, 0x061E, 0x0000, 0x09FE, 0x0228, 0x0000, 0x0638, 0x1279, 0x053F, 0x1031, 0x0000, 0x0225, 0x0000, 0x142F, 0x001B, 0x00F8,
+    0x0A8E, 0x0989, 0x0425, 0x0000, 0x0B27, 0x0F89, 0x0000, 0x0A59, 0x03B3, 0x071D, 0x0000, 0x139D, 0x05B7, 0x0FF4, 0x0000, 0x07BB,
+    0x119A, 0x062E, 0x13AB, 0x0C43, 0x0000, 0x0C48, 0x07B1, 0x0000, 0x0205, 0x0000, 0x131E, 0x0000, 0x0C9A, 0x0B8A, 0x0000, 0x0000,
+    0x0049, 0x03AF, 0x06A6, 0x13E2, 0x0000, 0x080C, 0x0000, 0x0000, 0x1206, 0x0839, 0x091B, 0x11E0, 0x136C, 0x0DE1, 0x0000, 0x0912,
+    0x0000, 0x0000, 0x0000, 0x0D05, 0x0AEF, 0x0838, 0x0000, 0x0DAB, 0x0000, 0x052E, 0x0782, 0x0000, 0x0000, 0x118E, 0x0000, 0x039D,
+    0x0000, 0x076E, 0x0AFE, 0x0000, 0x02F4, 0x0E07, 0x0AA8, 0x0B6B, 0x0000, 0x0BDE, 0x07A8, 0x0000, 0x0F1E, 0x0000, 0x0BC5, 0x0000,
+    0x09A6, 0x0000, 0x090C, 0x060B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07F8, 0x084C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0095, 0x0BA9, 0x0000, 0x0000, 0x1052, 0x0F06, 0x0000, 0x04B9, 0x0000, 0x0000, 0x0000,
+    0x0435, 0x0000, 0x06A2, 0x0000, 0x00B7, 0x0027, 0x0EB4, 0x01DE, 0x0000, 0x0000, 0x127C, 0x0A01, 0x0505, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1437, 0x13AA, 0x012B, 0x0C56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F6C, 0x0000, 0x0000, 0x0000, 0x0000, 0x1111, 0x0E4C,
+    0x0B40, 0x130D, 0x0000, 0x0000, 0x0710, 0x0000, 0x0000, 0x0FDD, 0x087E, 0x0000, 0x0000, 0x0000, 0x0000, 0x1331, 0x00D7, 0x0C16,
+    0x0A5F, 0x0C5F, 0x103B, 0x063D, 0x0BE1, 0x0E37, 0x0000, 0x01FF, 0x0000, 0x0F56, 0x0905, 0x0000, 0x094B, 0x0000, 0x0000, 0x0881,
+    0x0000, 0x05A5, 0x0C8D, 0x0735, 0x0000, 0x0000, 0x0000, 0x0000, 0x04FA, 0x04CE, 0x0000, 0x09C1, 0x10F4, 0x1066, 0x0DD3, 0x014E,
+    0x123E, 0x0F2A, 0x0268, 0x0000, 0x0000, 0x0E71, 0x0898, 0x0000, 0x0FD6, 0x0000, 0x0000, 0x0000, 0x10D4, 0x0000, 0x0752, 0x0000,
+    0x021C, 0x0000, 0x0931, 0x0000, 0x0023, 0x0C51, 0x06AF, 0x092E, 0x0295, 0x01AC, 0x1316, 0x10FE, 0x0997, 0x06E9, 0x0F0D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x02A2, 0x0000, 0x0000, 0x03B1, 0x140A, 0x07AA, 0x130C, 0x0C2B, 0x04E0, 0x0000, 0x0000, 0x0000,
+    0x0BB0, 0x033C, 0x1064, 0x0928, 0x0000, 0x020D, 0x0000, 0x0000, 0x049B, 0x0DAE, 0x0000, 0x0000, 0x0D91, 0x08AB, 0x0586, 0x0000,
+    0x0F83, 0x0C72, 0x07DF, 0x06B1, 0x0000, 0x0390, 0x0000, 0x0AD0, 0x0000, 0x0B31, 0x10C4, 0x13F3, 0x03C7, 0x0D80, 0x0000, 0x06B7,
+    0x00A5, 0x138F, 0x0000, 0x0000, 0x0000, 0x1123, 0x0E03, 0x0FBE, 0x0503, 0x0000, 0x0000, 0x0AB1, 0x1166, 0x0000, 0x0000, 0x08FB,
+    0x02C2, 0x027F, 0x0000, 0x1400, 0x01AB, 0x03FC, 0x0CD8, 0x0000, 0x0000, 0x03E7, 0x00CE, 0x0000, 0x1436, 0x0F72, 0x0000, 0x0ABE,
+    0x1291, 0x06D0, 0x087B, 0x0EDA, 0x0000, 0x103A, 0x0F66, 0x0A6F, 0x0235, 0x10C1, 0x0000, 0x0000, 0x07A0, 0x0598, 0x0000, 0x0000,
+    0x124C, 0x12CC, 0x0B26, 0x1170, 0x0E4F, 0x0000, 0x0000, 0x0007, 0x0A6C, 0x0105, 0x051D, 0x0F7D, 0x0000, 0x0000, 0x0750, 0x06CA,
+    0x13D6, 0x0000, 0x0000, 0x0000, 0x0CA4, 0x0000, 0x12AC, 0x057E, 0x0B94, 0x054C, 0x0940, 0x0C6B, 0x0000, 0x0AB3, 0x0CA7, 0x0000,
+    0x0D78, 0x0108, 0x0DFF, 0x0588, 0x0000, 0x1306, 0x0BD6, 0x0000, 0x0000, 0x07E3, 0x0F3F, 0x011F, 0x0000, 0x0000, 0x1037, 0x0000,
+    0x13B5, 0x001E, 0x0703, 0x0000, 0x10C9, 0x0000, 0x017E, 0x0F88, 0x0000, 0x098F, 0x105D, 0x1137, 0x0528, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0EC6, 0x0BB6, 0x022E, 0x08E1, 0x04CA, 0x0E49, 0x10CA, 0x0000, 0x0000, 0x0D85, 0x05D9, 0x0000, 0x019E, 0x0C63, 0x0000,
+    0x0000, 0x0000, 0x0F94, 0x0494, 0x0738, 0x0000, 0x003C, 0x0052, 0x0674, 0x0000, 0x0000, 0x13C2, 0x075D, 0x0000, 0x0269, 0x106C,
+    0x0000, 0x0000, 0x0000, 0x1362, 0x0B43, 0x0718, 0x1148, 0x13A9, 0x04E2, 0x0000, 0x0000, 0x03CD, 0x10D0, 0x0AA7, 0x10B3, 0x0200,
+    0x09CC, 0x0000, 0x0000, 0x04B1, 0x0D0F, 0x0000, 0x0EAF, 0x0A24, 0x0000, 0x1057, 0x0BBC, 0x0000, 0x0058, 0x0814, 0x0C39, 0x0000,
+    0x0FA1, 0x0231, 0x11D5, 0x0B4D, 0x0000, 0x079B, 0x03AD, 0x0156, 0x0516, 0x0869, 0x0000, 0x00EF, 0x050B, 0x0000, 0x0357, 0x124B,
+    0x0310, 0x0000, 0x04CD, 0x0F17, 0x1258, 0x07E2, 0x09F6, 0x03F4, 0x0CA6, 0x0BE6, 0x0000, 0x0000, 0x0000, 0x01CB, 0x0000, 0x13D8,
+    0x027A, 0x0000, 0x0000, 0x0000, 0x0006, 0x0000, 0x109E, 0x10A0, 0x06AA, 0x141E, 0x0D5E, 0x058C, 0x0000, 0x0455, 0x0911, 0x04A3,
+    0x0C1A, 0x0000, 0x0D25, 0x103D, 0x0000, 0x000A, 0x08C1, 0x0000, 0x0000, 0x0B97, 0x08C7, 0x0953, 0x1405, 0x0E4A, 0x0BEC, 0x0000,
+    0x075E, 0x0388, 0x13D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x10E5, 0x0000, 0x0000, 0x014A, 0x0000, 0x044F, 0x0C00, 0x0000, 0x00F9,
+    0x1176, 0x0B3F, 0x0000, 0x028F, 0x05BA, 0x0000, 0x0000, 0x0000, 0x109A, 0x0000, 0x032D, 0x0282, 0x09D8, 0x015A, 0x00D2, 0x0000,
+    0x0CAB, 0x1155, 0x1370, 0x0000, 0x114E, 0x0000, 0x03B7, 0x1323, 0x0000, 0x0CF6, 0x005F, 0x04B8, 0x0087, 0x0360, 0x0000, 0x0000,
+    0x093B, 0x01D1, 0x0000, 0x0A03, 0x01CC, 0x0DCC, 0x10E1, 0x0EC0, 0x0000, 0x0000, 0x0000, 0x0F09, 0x09AF, 0x045D, 0x1182, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1152, 0x0000, 0x005C, 0x0000, 0x0000, 0x0780, 0x0000, 0x0000, 0x0000, 0x12A5, 0x123C, 0x0000, 0x0448,
+    0x0000, 0x0837, 0x0559, 0x0000, 0x13BF, 0x0F5C, 0x0549, 0x0000, 0x0091, 0x0000, 0x0000, 0x0000, 0x0564, 0x09D7, 0x0000, 0x0363,
+    0x1297, 0x0F8F, 0x0000, 0x0000, 0x0578, 0x106E, 0x0000, 0x0000, 0x108D, 0x08CA, 0x091F, 0x0B11, 0x0000, 0x0F69, 0x0000, 0x04FD,
+    0x0698, 0x0000, 0x000B, 0x0D41, 0x0C64, 0x0CC9, 0x0000, 0x0AEE, 0x12EF, 0x0000, 0x13D0, 0x0000, 0x0000, 0x134D, 0x0B07, 0x0C9E,
+    0x0120, 0x0000, 0x0000, 0x0000, 0x0FF0, 0x0CC0, 0x0000, 0x0000, 0x01C9, 0x0B5E, 0x0000, 0x0000, 0x0000, 0x13C3, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03C4, 0x0000, 0x0278, 0x0F26, 0x0E80, 0x07B8, 0x0271, 0x041A, 0x0000, 0x12AD, 0x0000,
+    0x07AB, 0x0000, 0x10F7, 0x13B3, 0x0000, 0x0000, 0x02A9, 0x0B9E, 0x0000, 0x1350, 0x0280, 0x0000, 0x13B0, 0x0832, 0x0D8B, 0x09FB,
+    0x07F3, 0x12B8, 0x0000, 0x05AD, 0x0000, 0x0730, 0x0000, 0x0022, 0x0B76, 0x0000, 0x01FB, 0x091D, 0x080F, 0x1211, 0x1174, 0x08A4,
+    0x0000, 0x0000, 0x013E, 0x0FD9, 0x0799, 0x10A6, 0x0B39, 0x02CB, 0x0440, 0x02AD, 0x0000, 0x00F4, 0x0000, 0x0000, 0x0000, 0x04E5,
+    0x0000, 0x0C3A, 0x0E58, 0x0000, 0x0000, 0x0693, 0x13BD, 0x0CEA, 0x024D, 0x0DD7, 0x0B0F, 0x0000, 0x05DF, 0x0942, 0x0000, 0x0000,
+    0x036F, 0x0000, 0x06EC, 0x0000, 0x04CC, 0x027C, 0x1220, 0x09F7, 0x001F, 0x0B3B, 0x0F01, 0x0819, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1231, 0x0000, 0x118C, 0x03E4, 0x1033, 0x068D, 0x0000, 0x0000, 0x01CE, 0x0000, 0x0FAC, 0x0355, 0x0000, 0x118B, 0x0000, 0x08F9,
+    0x10B5, 0x1208, 0x0812, 0x0000, 0x01C2, 0x0B20, 0x0000, 0x1015, 0x0129, 0x03F3, 0x0000, 0x0000, 0x0000, 0x050E, 0x0000, 0x0000,
+    0x0974, 0x0811, 0x06A4, 0x01C1, 0x0F2C, 0x0CCE, 0x11F5, 0x0A15, 0x0000, 0x0000, 0x0000, 0x0856, 0x0000, 0x01F9, 0x0641, 0x00DC,
+    0x0000, 0x0000, 0x0000, 0x022F, 0x0000, 0x01C0, 0x0151, 0x057D, 0x0000, 0x06DD, 0x0000, 0x0000, 0x0000, 0x0B04, 0x0000, 0x0000,
+    0x0D35, 0x0000, 0x0000, 0x0000, 0x067A, 0x1240, 0x0601, 0x0069, 0x1327, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x064E, 0x0FC7,
+    0x0489, 0x02BB, 0x0000, 0x0000, 0x043D, 0x0000, 0x0000, 0x0D81, 0x0000, 0x0000, 0x0DF8, 0x0000, 0x0D54, 0x0E8E, 0x104A, 0x08FA,
+    0x0000, 0x0000, 0x0AAA, 0x1221, 0x0000, 0x0B25, 0x0B7C, 0x0E26, 0x092D, 0x0F45, 0x079F, 0x01F5, 0x0B6E, 0x05FD, 0x136D, 0x0000,
+    0x1115, 0x074B, 0x0803, 0x1244, 0x0783, 0x0834, 0x0760, 0x0F73, 0x0B64, 0x097A, 0x0000, 0x0B45, 0x0000, 0x0EC4, 0x0F44, 0x0000,
+    0x04C5, 0x0DC4, 0x132F, 0x0344, 0x0B5C, 0x02EB, 0x0000, 0x0000, 0x0579, 0x02D7, 0x0CF5, 0x0D38, 0x041F, 0x0BA7, 0x0B34, 0x0000,
+    0x0000, 0x0289, 0x0124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0617, 0x0000, 0x0497, 0x12CA, 0x0C31, 0x0F3A, 0x0000, 0x1204, 0x0000,
+    0x0000, 0x0A2E, 0x05A3, 0x02E0, 0x02C4, 0x08AE, 0x0EF0, 0x09A0, 0x050A, 0x1346, 0x06E8, 0x0046, 0x0FE7, 0x0000, 0x104E, 0x0584,
+    0x0786, 0x0000, 0x08AD, 0x0000, 0x1019, 0x0000, 0x0000, 0x0000, 0x0E24, 0x0000, 0x0000, 0x0000, 0x0891, 0x09FA, 0x0260, 0x0E3F,
+    0x0000, 0x0D06, 0x0000, 0x0987, 0x0000, 0x0E31, 0x0000, 0x0000, 0x0EFE, 0x0000, 0x1334, 0x0000, 0x0E4B, 0x0000, 0x0A92, 0x0000,
+    0x07EE, 0x0495, 0x0773, 0x0000, 0x0000, 0x0AE0, 0x0099, 0x0000, 0x0CB1, 0x0000, 0x0000, 0x0000, 0x0237, 0x0E96, 0x0A36, 0x0939,
+    0x0302, 0x1278, 0x0000, 0x0000, 0x1355, 0x0FC2, 0x055A, 0x118D, 0x0D0E, 0x0508, 0x0000, 0x0000, 0x105E, 0x0000, 0x0000, 0x0E08,
+    0x0000, 0x0000, 0x070A, 0x0192, 0x0000, 0x0000, 0x0D1B, 0x0000, 0x117E, 0x0412, 0x0A5D, 0x045B, 0x095B, 0x0E28, 0x078B, 0x116D,
+    0x023D, 0x0BE4, 0x0F32, 0x0000, 0x0E5C, 0x1349, 0x0000, 0x0000, 0x0000, 0x0B89, 0x0000, 0x0000, 0x0000, 0x00BD, 0x0999, 0x067F,
+    0x0000, 0x0AC6, 0x0000, 0x0000, 0x0BB8, 0x098B, 0x0000, 0x02EA, 0x0000, 0x0705, 0x02C5, 0x0000, 0x0000, 0x040A, 0x0527, 0x0000,
+    0x06FD, 0x0066, 0x10A1, 0x0000, 0x0219, 0x0FFE, 0x0000, 0x0562, 0x042C, 0x0000, 0x028A, 0x0950, 0x0109, 0x0000, 0x0C95, 0x0000,
+    0x10C0, 0x1164, 0x0D86, 0x0000, 0x0000, 0x0C28, 0x0000, 0x1419, 0x0380, 0x12BE, 0x12BC, 0x0000, 0x13E8, 0x0F8A, 0x0000, 0x002C,
+    0x0F03, 0x101E, 0x0000, 0x0000, 0x13EE, 0x141F, 0x0000, 0x0000, 0x019D, 0x0000, 0x10E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B2D,
+    0x025F, 0x0A2C, 0x05D6, 0x0284, 0x010B, 0x04C7, 0x02B4, 0x0349, 0x02E8, 0x0EA4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0876,
+    0x0EB1, 0x1056, 0x01DA, 0x09F5, 0x0000, 0x05C9, 0x0000, 0x007A, 0x00AD, 0x0000, 0x0642, 0x0E8F, 0x0628, 0x1285, 0x0C04, 0x1253,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0BBB, 0x0000, 0x023C, 0x1403, 0x0000, 0x0CC2, 0x00E9, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0887, 0x0B3C, 0x0A3E, 0x0459, 0x003D, 0x0000, 0x0000, 0x0103, 0x0582, 0x0444, 0x055D, 0x0A19, 0x0000, 0x088A, 0x0000, 0x0861,
+    0x09B0, 0x0000, 0x0BDA, 0x0395, 0x043A, 0x0AD8, 0x0AAE, 0x12E1, 0x0000, 0x07F2, 0x12D6, 0x04E7, 0x1300, 0x1213, 0x01C7, 0x135E,
+    0x01FC, 0x016F, 0x0F4B, 0x0000, 0x0000, 0x027D, 0x0E42, 0x054B, 0x0000, 0x06C4, 0x094C, 0x023A, 0x01D4, 0x1313, 0x063E, 0x0F7F,
+    0x008D, 0x11BB, 0x0D4E, 0x0365, 0x0FEA, 0x0000, 0x1004, 0x0000, 0x01E0, 0x0D9F, 0x10DE, 0x117B, 0x0000, 0x097D, 0x0E83, 0x0000,
+    0x04FB, 0x1210, 0x09C5, 0x0138, 0x0000, 0x11AA, 0x0000, 0x0000, 0x1288, 0x0000, 0x0117, 0x0000, 0x0F20, 0x0C6C, 0x0000, 0x011D,
+    0x0000, 0x0000, 0x13C8, 0x0000, 0x0794, 0x0594, 0x009B, 0x13DA, 0x0000, 0x046A, 0x09AC, 0x0000, 0x0000, 0x0677, 0x03FD, 0x05E0,
+    0x0000, 0x0000, 0x0D74, 0x13DB, 0x07DE, 0x0000, 0x0F35, 0x1075, 0x0F95, 0x0A4B, 0x0B4E, 0x0000, 0x0000, 0x0CAA, 0x0E38, 0x0DBF,
+    0x0000, 0x035E, 0x0669, 0x1088, 0x12DC, 0x0167, 0x0000, 0x03A7, 0x0000, 0x0000, 0x0000, 0x0604, 0x059B, 0x0A7B, 0x0000, 0x054F,
+    0x0B73, 0x0000, 0x0000, 0x0E16, 0x09F1, 0x0CA3, 0x0000, 0x0779, 0x0000, 0x04BD, 0x0025, 0x025E, 0x1055, 0x0E5F, 0x089D, 0x0000,
+    0x0000, 0x0D84, 0x0576, 0x0000, 0x00D3, 0x1363, 0x1154, 0x1215, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0BCB, 0x00D6, 0x0A30, 0x0000, 0x0741, 0x0000, 0x136B, 0x1124, 0x06ED, 0x0000, 0x0000, 0x0893, 0x0000, 0x0732, 0x0842, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E9C, 0x140C, 0x0F49, 0x12CD, 0x079E, 0x0F36, 0x0CB2, 0x0D45, 0x0000, 0x05E8, 0x0000,
+    0x0000, 0x0BCA, 0x04A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0DE8, 0x0000, 0x0C1D, 0x088E, 0x0000, 0x08E3, 0x07F0, 0x0000, 0x0000,
+    0x0C73, 0x0C7E, 0x0C4E, 0x08D2, 0x0A17, 0x0000, 0x01A8, 0x0000, 0x0666, 0x045E, 0x0000, 0x0F3D, 0x025A, 0x04D1, 0x0EB3, 0x05CB,
+    0x0676, 0x076D, 0x0000, 0x0000, 0x0000, 0x02A0, 0x0327, 0x099C, 0x0563, 0x1188, 0x0000, 0x0000, 0x0D13, 0x0000, 0x0ACF, 0x1396,
+    0x0688, 0x0246, 0x12F1, 0x07D0, 0x1063, 0x08EB, 0x0000, 0x0000, 0x0F86, 0x002E, 0x0F16, 0x01F6, 0x0B0D, 0x018A, 0x0175, 0x028B,
+    0x0000, 0x0000, 0x09BC, 0x0E13, 0x0000, 0x02ED, 0x0906, 0x0551, 0x0E69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x029F, 0x12A0,
+    0x1332, 0x0000, 0x0000, 0x0000, 0x0B86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B0B, 0x024E, 0x07FA, 0x0000, 0x1018, 0x02D4, 0x10BF,
+    0x09E7, 0x0000, 0x0DE2, 0x057A, 0x0000, 0x0748, 0x0008, 0x0000, 0x0000, 0x0165, 0x0FBC, 0x08B7, 0x0000, 0x0000, 0x10E4, 0x0000,
+    0x0973, 0x0307, 0x1373, 0x0000, 0x0749, 0x0BE2, 0x0000, 0x0B29, 0x10DA, 0x0000, 0x09CA, 0x0000, 0x0AD4, 0x0A4F, 0x09EA, 0x0000,
+    0x0A8A, 0x0E27, 0x0000, 0x0000, 0x06F7, 0x04A0, 0x0000, 0x02D5, 0x0000, 0x0000, 0x0C6D, 0x0A6A, 0x0000, 0x1272, 0x0164, 0x0000,
+    0x1301, 0x0000, 0x074D, 0x0BA2, 0x078D, 0x0000, 0x03A6, 0x0000, 0x1319, 0x0375, 0x053A, 0x0084, 0x0000, 0x0CE6, 0x066F, 0x0186,
+    0x1149, 0x0C34, 0x0000, 0x13B1, 0x0000, 0x0000, 0x062B, 0x053D, 0x0944, 0x10CD, 0x1058, 0x0000, 0x11B6, 0x0D82, 0x0643, 0x0000,
+    0x0000, 0x12BB, 0x059F, 0x11DA, 0x052F, 0x08B0, 0x0000, 0x0000, 0x0000, 0x07CA, 0x0000, 0x0E53, 0x0EA5, 0x0000, 0x0D0C, 0x0312,
+    0x0094, 0x00E8, 0x0000, 0x0000, 0x0599, 0x0D8D, 0x08AF, 0x0000, 0x0000, 0x0297, 0x02B2, 0x102F, 0x0000, 0x07DB, 0x0013, 0x0663,
+    0x0FC0, 0x0B5D, 0x1232, 0x00CA, 0x1013, 0x0000, 0x0000, 0x0000, 0x0000, 0x05FE, 0x0545, 0x0387, 0x0000, 0x0F41, 0x0E8A, 0x0000,
+    0x0000, 0x0C4B, 0x0000, 0x0000, 0x1102, 0x0000, 0x13E1, 0x01DD, 0x0000, 0x10EF, 0x0000, 0x0000, 0x1414, 0x0000, 0x0000, 0x0000,
+    0x013D, 0x0000, 0x0DFC, 0x02A7, 0x10D5, 0x0D4B, 0x12E6, 0x0000, 0x039A, 0x13C9, 0x0000, 0x085E, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0C44, 0x045A, 0x061A, 0x0000, 0x0000, 0x0E25, 0x10A5, 0x102E, 0x029E, 0x0000, 0x0938, 0x0000, 0x02AE, 0x0000, 0x0536, 0x0825,
+    0x0506, 0x0000, 0x0000, 0x0160, 0x0000, 0x0000, 0x0E7A, 0x074F, 0x09E2, 0x07AD, 0x0000, 0x0000, 0x04AF, 0x0000, 0x0000, 0x02DC,
+    0x0000, 0x0FE3, 0x0E72, 0x0000, 0x0E19, 0x11B9, 0x057C, 0x0000, 0x0000, 0x09FF, 0x02DF, 0x093D, 0x0E68, 0x0000, 0x0000, 0x0E40,
+    0x07C6, 0x0B01, 0x0D08, 0x11A6, 0x09CB, 0x0000, 0x142D, 0x0000, 0x0F1C, 0x0B85, 0x0000, 0x0D42, 0x08D1, 0x1010, 0x0AE7, 0x0000,
+    0x0000, 0x0C41, 0x0000, 0x0000, 0x06CB, 0x1347, 0x08E4, 0x0EFC, 0x0000, 0x094F, 0x03BE, 0x0000, 0x0A80, 0x0000, 0x0000, 0x0000,
+    0x0CF8, 0x05C7, 0x0DCB, 0x0000, 0x1003, 0x0AD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x121F, 0x13A5, 0x0792, 0x07F4, 0x01B0, 0x071E,
+    0x0CB4, 0x0000, 0x0000, 0x0E1B, 0x0000, 0x0C07, 0x0000, 0x0C20, 0x100D, 0x080B, 0x0A3A, 0x036D, 0x0AD2, 0x0BAB, 0x1246, 0x13A8,
+    0x0000, 0x0000, 0x08F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x08C6, 0x05C3, 0x05F8, 0x0000, 0x0000, 0x077C, 0x0000, 0x02A8, 0x0000,
+    0x1050, 0x007E, 0x05CE, 0x0544, 0x0808, 0x0477, 0x0000, 0x0A22, 0x1295, 0x0608, 0x0000, 0x0000, 0x0C86, 0x1186, 0x10AB, 0x0000,
+    0x0000, 0x0DE0, 0x0000, 0x0C0D, 0x1070, 0x098C, 0x03B9, 0x0000, 0x1433, 0x0AAC, 0x0000, 0x0000, 0x07EF, 0x0000, 0x0771, 0x064D,
+    0x0000, 0x0E78, 0x05D8, 0x13EF, 0x02AC, 0x0000, 0x0000, 0x0174, 0x0019, 0x0EF5, 0x05FA, 0x0ED5, 0x0163, 0x04E4, 0x0000, 0x13CB,
+    0x0000, 0x0FC9, 0x0F64, 0x0648, 0x0419, 0x0F40, 0x0000, 0x081F, 0x1096, 0x0000, 0x04B3, 0x004D, 0x00D1, 0x04F7, 0x0292, 0x0CF9,
+    0x1420, 0x02C1, 0x0848, 0x00CC, 0x0133, 0x0E50, 0x11C1, 0x05E6, 0x09AE, 0x0000, 0x0000, 0x0D8C, 0x01DF, 0x139E, 0x0C42, 0x0353,
+    0x11C2, 0x11D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0DEF, 0x046B, 0x0AA3, 0x0000, 0x0347, 0x03C2, 0x0902, 0x1348, 0x0000,
+    0x0CDB, 0x0000, 0x0D2E, 0x0B9C, 0x0000, 0x0000, 0x0071, 0x0EFF, 0x0AFA, 0x0A9B, 0x0FB3, 0x0A14, 0x02A6, 0x0E85, 0x0000, 0x0000,
+    0x103F, 0x0000, 0x0000, 0x02F9, 0x0000, 0x0DD0, 0x0000, 0x0000, 0x0000, 0x0F02, 0x0000, 0x0000, 0x0F11, 0x016E, 0x059A, 0x0216,
+    0x07BC, 0x134C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0AA9, 0x0000, 0x0DE6, 0x13E0, 0x0000, 0x0D3C, 0x0B82, 0x0816, 0x0C77,
+    0x0888, 0x0A2A, 0x0000, 0x0603, 0x00B3, 0x058F, 0x067D, 0x0000, 0x0000, 0x1194, 0x0FF9, 0x0000, 0x058B, 0x0000, 0x08A9, 0x035D,
+    0x0351, 0x0000, 0x087C, 0x114A, 0x11CD, 0x0993, 0x1002, 0x0000, 0x1321, 0x0712, 0x0000, 0x0CB6, 0x0000, 0x0DEA, 0x0CC3, 0x044B,
+    0x0000, 0x0242, 0x051E, 0x0B38, 0x0000, 0x04B2, 0x0000, 0x0000, 0x0829, 0x0E67, 0x0E46, 0x1340, 0x0BF2, 0x11D0, 0x0ACC, 0x0000,
+    0x0870, 0x0EC3, 0x0000, 0x0000, 0x0929, 0x0340, 0x05A7, 0x043C, 0x13CD, 0x0818, 0x13F9, 0x0B69, 0x06F8, 0x026A, 0x0000, 0x0000,
+    0x0265, 0x0000, 0x10FC, 0x1087, 0x11D9, 0x06AD, 0x0000, 0x0000, 0x05AC, 0x0000, 0x0335, 0x0000, 0x0D2A, 0x05F5, 0x0754, 0x069E,
+    0x0000, 0x090F, 0x0B14, 0x0000, 0x112C, 0x07E7, 0x0000, 0x00CF, 0x085B, 0x1352, 0x03A4, 0x070C, 0x0000, 0x0B2B, 0x0493, 0x0806,
+    0x0031, 0x0000, 0x0000, 0x0079, 0x0AE3, 0x0000, 0x0000, 0x1158, 0x0000, 0x06BC, 0x0000, 0x0061, 0x0B87, 0x0000, 0x0000, 0x0C90,
+    0x0000, 0x0000, 0x0000, 0x0113, 0x04F2, 0x1169, 0x0000, 0x0D21, 0x1068, 0x0C8F, 0x0547, 0x0000, 0x0414, 0x0000, 0x021F, 0x1377,
+    0x05C5, 0x0EF7, 0x0000, 0x08AC, 0x1172, 0x0000, 0x0F75, 0x0000, 0x0BDD, 0x0A40, 0x01EE, 0x0000, 0x0000, 0x0D87, 0x0000, 0x128A,
+    0x0000, 0x0000, 0x0000, 0x1388, 0x0A94, 0x064C, 0x0EC9, 0x0000, 0x1125, 0x0000, 0x1082, 0x07C0, 0x01BA, 0x11B0, 0x0000, 0x0EB8,
+    0x0000, 0x0182, 0x13A4, 0x0DCE, 0x12BF, 0x0000, 0x12D1, 0x0000, 0x08D0, 0x0293, 0x0000, 0x0C11, 0x128D, 0x125A, 0x0000, 0x07C1,
+    0x0E5A, 0x0000, 0x0000, 0x0000, 0x0CF4, 0x0DF0, 0x0000, 0x098A, 0x0487, 0x0000, 0x11D3, 0x0790, 0x0A8C, 0x122B, 0x07BE, 0x0441,
+    0x1413, 0x0404, 0x0000, 0x13F2, 0x04C0, 0x0568, 0x0E0D, 0x0713, 0x0038, 0x0A82, 0x0EED, 0x0000, 0x0000, 0x0000, 0x1356, 0x1335,
+    0x06E1, 0x0000, 0x12EB, 0x088B, 0x0000, 0x0E1D, 0x0A3D, 0x1293, 0x0000, 0x0000, 0x072E, 0x0D48, 0x0000, 0x1134, 0x0000, 0x0EFD,
+    0x0000, 0x0000, 0x0000, 0x00EC, 0x0630, 0x0DB5, 0x036A, 0x0000, 0x02E9, 0x093A, 0x0000, 0x0FCE, 0x0FCF, 0x0646, 0x035F, 0x03E9,
+    0x0000, 0x0C1E, 0x0000, 0x0000, 0x0EDB, 0x0AE8, 0x120D, 0x083E, 0x0E6B, 0x0294, 0x0000, 0x0A75, 0x0000, 0x0000, 0x04C8, 0x0000,
+    0x0000, 0x0000, 0x11BA, 0x13EB, 0x011C, 0x1199, 0x0000, 0x133D, 0x08D6, 0x10D2, 0x0000, 0x0FA7, 0x0DB3, 0x02B8, 0x09AB, 0x0000,
+    0x05A8, 0x0A7C, 0x065B, 0x0D14, 0x0000, 0x0D68, 0x0000, 0x0272, 0x0000, 0x03D0, 0x0000, 0x0000, 0x0000, 0x11A0, 0x0000, 0x0000,
+    0x1104, 0x038E, 0x0000, 0x13F0, 0x0391, 0x0B63, 0x1397, 0x0000, 0x13F8, 0x00C4, 0x0F29, 0x017F, 0x0000, 0x1284, 0x00C6, 0x107C,
+    0x0000, 0x1201, 0x084E, 0x0000, 0x0000, 0x099A, 0x0000, 0x03D8, 0x1324, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B59, 0x0ED1, 0x005E,
+    0x0000, 0x0000, 0x0BF1, 0x0EBE, 0x06CD, 0x0627, 0x12CE, 0x0548, 0x0CC7, 0x0405, 0x0017, 0x0000, 0x0000, 0x0C5C, 0x0000, 0x007D,
+    0x0285, 0x0EE0, 0x1310, 0x0000, 0x0000, 0x0000, 0x0767, 0x0B10, 0x0000, 0x0EB2, 0x0000, 0x05B3, 0x0000, 0x0000, 0x00CB, 0x1040,
+    0x00C2, 0x1426, 0x0000, 0x046F, 0x0BD3, 0x060F, 0x0000, 0x0121, 0x0D39, 0x08AA, 0x008E, 0x05BB, 0x0000, 0x0F19, 0x036B, 0x0000,
+    0x0A72, 0x0655, 0x107A, 0x1309, 0x0000, 0x0097, 0x034F, 0x0000, 0x02D2, 0x0000, 0x0702, 0x0000, 0x001C, 0x0000, 0x0B16, 0x0982,
+    0x0000, 0x0852, 0x075C, 0x0000, 0x0000, 0x1207, 0x0000, 0x1145, 0x051A, 0x0897, 0x0000, 0x0045, 0x0000, 0x11CE, 0x0000, 0x0000,
+    0x0000, 0x066B, 0x1038, 0x0018, 0x1245, 0x0B2E, 0x1046, 0x0AA4, 0x010E, 0x05FC, 0x020F, 0x12EA, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0534, 0x0D6A, 0x0000, 0x0131, 0x0311, 0x0000, 0x12B1, 0x12A1, 0x0F52, 0x0000, 0x02BD, 0x0000, 0x017D, 0x0000, 0x07F7, 0x060A,
+    0x0000, 0x02C8, 0x0000, 0x0FF6, 0x109C, 0x0AB2, 0x0000, 0x02FC, 0x0000, 0x031E, 0x0000, 0x0000, 0x12FC, 0x0000, 0x0000, 0x040E,
+    0x05C0, 0x1371, 0x0000, 0x0971, 0x0000, 0x096A, 0x08CE, 0x0000, 0x08E0, 0x0000, 0x0000, 0x04A8, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0530, 0x10BC, 0x0000, 0x0C55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04D7, 0x1389, 0x0000, 0x072F, 0x129E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0682, 0x0FD2, 0x0E9E, 0x0D6B, 0x1187, 0x10FD, 0x0823, 0x0D90, 0x0531, 0x0000, 0x0C93, 0x0155, 0x0230,
+    0x0000, 0x0140, 0x128C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0660, 0x0000, 0x0000, 0x0000, 0x0D58, 0x02B3, 0x0000, 0x03E3, 0x0190,
+    0x0CEF, 0x0B49, 0x03B6, 0x0000, 0x0A28, 0x0000, 0x09D4, 0x08D8, 0x0000, 0x08DF, 0x12D4, 0x1255, 0x0000, 0x0B47, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0E63, 0x02BC, 0x0000, 0x0D1E, 0x0C9D, 0x0000, 0x0055, 0x0571, 0x0000, 0x08C2, 0x0000, 0x0000, 0x0000,
+    0x0609, 0x0000, 0x0945, 0x0DC8, 0x01A1, 0x09DF, 0x0DAF, 0x0000, 0x0296, 0x0000, 0x0000, 0x099E, 0x102D, 0x0620, 0x0241, 0x0CFB,
+    0x08F8, 0x0000, 0x0000, 0x0000, 0x130E, 0x0000, 0x0000, 0x0000, 0x13F1, 0x0E65, 0x0429, 0x08B6, 0x1274, 0x06FA, 0x0083, 0x0622,
+    0x0B0E, 0x0000, 0x1267, 0x10EB, 0x0C12, 0x0000, 0x0000, 0x0567, 0x068C, 0x02F5, 0x0657, 0x10E3, 0x0A34, 0x0ADE, 0x0000, 0x0000,
+    0x0C82, 0x0000, 0x0000, 0x0FB4, 0x0859, 0x0000, 0x0777, 0x0000, 0x00E7, 0x0451, 0x0000, 0x020A, 0x0CD9, 0x0883, 0x0000, 0x0EAE,
+    0x13DF, 0x00AF, 0x0AFD, 0x0F1D, 0x0970, 0x1136, 0x0000, 0x0000, 0x0000, 0x102A, 0x03FA, 0x06C1, 0x00B6, 0x0000, 0x0CAF, 0x0EDE,
+    0x1097, 0x08C9, 0x0C30, 0x0EC5, 0x0000, 0x0EDC, 0x035C, 0x0337, 0x10EC, 0x0000, 0x0110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0498,
+    0x0000, 0x0000, 0x0000, 0x0B58, 0x0000, 0x11CC, 0x0000, 0x09A3, 0x0000, 0x0000, 0x13D5, 0x0DC3, 0x108B, 0x0000, 0x06A8, 0x0000,
+    0x0751, 0x0107, 0x00C0, 0x0000, 0x0AC4, 0x0000, 0x0000, 0x05A9, 0x116B, 0x0000, 0x0000, 0x0CB0, 0x0795, 0x0E10, 0x0B0C, 0x0000,
+    0x1095, 0x0C47, 0x0000, 0x07E0, 0x0670, 0x10D7, 0x1387, 0x01E8, 0x11AF, 0x0000, 0x082E, 0x069F, 0x0000, 0x0000, 0x0000, 0x0E55,
+}};
 // clang-format on
 
+/// Murmur3 finalizer, shared by both hash tables
+constexpr auto mix(uint32_t x) noexcept -> uint32_t {
+    x ^= x >> 16;
+    x *= 0x85EBCA6BU;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35U;
+    x ^= x >> 16;
+    return x;
+}
+
+/// FNV-1a over the keyword characters
+constexpr auto keyword_hash(std::string_view keyword) noexcept -> uint32_t {
+    uint32_t hash = 0x811C9DC5U;
+    for (const char c : keyword) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 0x01000193U;
+    }
+    return hash;
+}
+
+/// Slot of a key: its bucket's displacement picks a collision-free slot
+template <size_t Buckets, size_t Slots>
+constexpr auto slot_of(uint32_t key,
+                       const std::array<uint32_t, Buckets>& displacements,
+                       const std::array<uint16_t, Slots>& slots) noexcept
+    -> uint16_t {
+    static_assert((Buckets & (Buckets - 1)) == 0 && (Slots & (Slots - 1)) == 0);
+    const auto displacement = displacements[mix(key) & (Buckets - 1)];
+    return slots[mix(key ^ displacement) & (Slots - 1)];
+}
+
+constexpr auto lookup_tag(dicom_tag tag) noexcept -> const tag_info* {
+    const auto key = tag.combined();
+    const auto slot = slot_of(key, tag_displacements, tag_slots);
+    if (slot != 0 && standard_tags[slot - 1].tag == tag) {
+        return &standard_tags[slot - 1];
+    }
+    for (const auto& repeating : repeating_tags) {
+        if ((key & repeating.mask) == repeating.value) {
+            return &standard_tags[repeating.index];
+        }
+    }
+    return nullptr;
+}
+
+constexpr auto lookup_keyword(std::string_view keyword) noexcept
+    -> const tag_info* {
+    if (keyword.empty()) {
+        return nullptr;
+    }
+    const auto slot =
+        slot_of(keyword_hash(keyword), keyword_displacements, keyword_slots);
+    if (slot != 0 && standard_tags[slot - 1].keyword == keyword) {
+        return &standard_tags[slot - 1];
+    }
+    return nullptr;
+}
+
+static_assert(lookup_tag(dicom_tag{0x0010, 0x0010})->keyword == "PatientName");
+static_assert(lookup_tag(dicom_tag{0x7FE0, 0x0010})->keyword == "PixelData");
+static_assert(lookup_tag(dicom_tag{0x6002, 0x3000})->keyword == "OverlayData");
+static_assert(lookup_tag(dicom_tag{0x6001, 0x3000}) == nullptr);
+static_assert(lookup_keyword("StudyInstanceUID")->tag == dicom_tag{0x0020, 0x000D});
+static_assert(lookup_keyword("NotAKeyword") == nullptr);
+
+}  // namespace
+
 auto get_standard_tags() -> std::span<const tag_info> {
     return standard_tags;
 }
 
+auto find_standard_tag(dicom_tag tag) noexcept -> const tag_info* {
+    return lookup_tag(tag);
+}
+
+auto find_standard_keyword(std::string_view keyword) noexcept -> const tag_info* {
+    return lookup_keyword(keyword);
+}
+
 }  // namespace kcenon::pacs::core
@@ -0,0 +1,262 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file compression_codec.cpp
+ * @brief Frame-parallel batch operations shared by all codecs
+ */
+
+#include "kcenon/pacs/encoding/compression/compression_codec.h"
+
+#include "kcenon/pacs/encoding/compression/encapsulated_pixel_data.h"
+#include "kcenon/pacs/integration/thread_pool_interface.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace kcenon::pacs::encoding::compression {
+
+namespace {
+
+/**
+ * @brief Shared progress for a parallel chunked job
+ *
+ * The calling thread also claims chunks, and completion is tracked by a
+ * counter rather than by joining futures, so a caller running on the same
+ * pool cannot deadlock waiting for tasks that never get scheduled.
+ */
+struct chunk_job {
+    std::size_t total{0};
+    std::atomic<std::size_t> next{0};
+    std::size_t done{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::function<void(std::size_t, bool)> work;
+
+    void drain(bool caller) {
+        for (;;) {
+            const auto index = next.fetch_add(1, std::memory_order_relaxed);
+            if (index >= total) {
+                return;
+            }
+            work(index, caller);
+            std::lock_guard<std::mutex> lock(mutex);
+            if (++done == total) {
+                cv.notify_all();
+            }
+        }
+    }
+};
+
+/**
+ * @brief Run work(0..chunks-1) across the pool and the calling thread
+ *
+ * The second argument of @p work is true when the chunk runs on the
+ * calling thread.
+ */
+void run_chunks(const std::shared_ptr<integration::thread_pool_interface>& pool,
+                std::size_t chunks,
+                std::function<void(std::size_t, bool)> work) {
+    if (chunks == 0) {
+        return;
+    }
+
+    auto job = std::make_shared<chunk_job>();
+    job->total = chunks;
+    job->work = std::move(work);
+
+    std::vector<std::future<void>> async_helpers;
+    for (std::size_t i = 1; i < chunks; ++i) {
+        if (pool && pool->is_running()) {
+            pool->submit_fire_and_forget([job]() { job->drain(false); });
+        } else {
+            async_helpers.push_back(
+                std::async(std::launch::async, [job]() { job->drain(false); }));
+        }
+    }
+
+    job->drain(true);
+
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->cv.wait(lock, [&job]() { return job->done == job->total; });
+    lock.unlock();
+
+    for (auto& f : async_helpers) {
+        f.wait();
+    }
+}
+
+auto worker_count(const frame_parallel_options& parallel, std::size_t frames)
+    -> std::size_t {
+    std::size_t limit = parallel.max_workers;
+    if (limit == 0) {
+        limit = parallel.thread_pool ? parallel.thread_pool->get_thread_count() + 1
+                                     : std::thread::hardware_concurrency();
+    }
+    return std::clamp<std::size_t>(std::min(limit, frames), 1,
+                                   std::max<std::size_t>(frames, 1));
+}
+
+/**
+ * @brief Records the first failure reported by any worker
+ */
+class first_error {
+public:
+    void set(std::size_t frame, const std::string& message) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!message_) {
+            message_ = "Frame " + std::to_string(frame + 1) + ": " + message;
+        }
+        failed_.store(true, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool failed() const noexcept {
+        return failed_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const std::string& message() const { return *message_; }
+
+private:
+    std::mutex mutex_;
+    std::optional<std::string> message_;
+    std::atomic<bool> failed_{false};
+};
+
+}  // namespace
+
+codec_result compression_codec::encode_frames(
+    std::span<const uint8_t> pixel_data,
+    const image_params& params,
+    const compression_options& options,
+    const frame_parallel_options& parallel) const {
+    const std::size_t frame_count = std::max<uint32_t>(params.number_of_frames, 1);
+    const auto frame_size = params.frame_size_bytes();
+    if (frame_size == 0 || pixel_data.size() < frame_size * frame_count) {
+        return kcenon::pacs::pacs_error<compression_result>(
+            kcenon::pacs::error_codes::data_size_mismatch,
+            "Pixel data is shorter than Rows x Columns x Frames");
+    }
+
+    image_params frame_params = params;
+    frame_params.number_of_frames = 1;
+
+    std::vector<std::vector<uint8_t>> encoded(frame_count);
+    first_error error;
+
+    const auto workers = worker_count(parallel, frame_count);
+    const auto per_chunk = (frame_count + workers - 1) / workers;
+
+    run_chunks(parallel.thread_pool, workers, [&](std::size_t chunk, bool caller) {
+        // Codecs are not thread-safe: helpers use a private clone that is
+        // reused for every frame of their chunk
+        std::unique_ptr<compression_codec> own;
+        const compression_codec* codec = this;
+        if (!caller) {
+            own = clone();
+            codec = own.get();
+        }
+
+        const auto begin = chunk * per_chunk;
+        const auto end = std::min(frame_count, begin + per_chunk);
+        for (auto i = begin; i < end && !error.failed(); ++i) {
+            auto result = codec->encode(pixel_data.subspan(i * frame_size, frame_size),
+                                        frame_params, options);
+            if (result.is_err()) {
+                error.set(i, result.error().message);
+                return;
+            }
+            encoded[i] = std::move(result.value().data);
+        }
+    });
+
+    if (error.failed()) {
+        return kcenon::pacs::pacs_error<compression_result>(
+            kcenon::pacs::error_codes::compression_error, error.message());
+    }
+
+    compression_result result;
+    result.data = build_encapsulated_pixel_data(encoded);
+    result.output_params = params;
+    return codec_result::ok(std::move(result));
+}
+
+codec_result compression_codec::decode_frames(
+    std::span<const uint8_t> encapsulated_data,
+    const image_params& params,
+    const frame_parallel_options& parallel) const {
+    const uint32_t frame_count = std::max<uint32_t>(params.number_of_frames, 1);
+
+    auto split = split_encapsulated_frames(encapsulated_data, frame_count);
+    if (split.is_err()) {
+        return codec_result::err(split.error());
+    }
+    const auto& frames = split.value();
+
+    image_params frame_params = params;
+    frame_params.number_of_frames = 1;
+
+    // Decoders always emit interleaved samples
+    image_params out_params = frame_params;
+    out_params.planar_configuration = 0;
+    const auto frame_size = out_params.frame_size_bytes();
+    if (frame_size == 0) {
+        return kcenon::pacs::pacs_error<compression_result>(
+            kcenon::pacs::error_codes::decompression_error,
+            "Invalid image parameters for decoding");
+    }
+
+    compression_result result;
+    result.data.resize(frame_size * frame_count);
+    first_error error;
+
+    const auto workers = worker_count(parallel, frame_count);
+    const auto per_chunk = (frame_count + workers - 1) / workers;
+
+    run_chunks(parallel.thread_pool, workers, [&](std::size_t chunk, bool caller) {
+        std::unique_ptr<compression_codec> own;
+        const compression_codec* codec = this;
+        if (!caller) {
+            own = clone();
+            codec = own.get();
+        }
+
+        const auto begin = chunk * per_chunk;
+        const auto end = std::min<std::size_t>(frame_count, begin + per_chunk);
+        for (auto i = begin; i < end && !error.failed(); ++i) {
+            auto decoded = codec->decode(frames[i], frame_params);
+            if (decoded.is_err()) {
+                error.set(i, decoded.error().message);
+                return;
+            }
+            auto& bytes = decoded.value().data;
+            if (bytes.size() != frame_size) {
+                error.set(i, "Decoded " + std::to_string(bytes.size()) +
+                             " bytes, expected " + std::to_string(frame_size));
+                return;
+            }
+            std::memcpy(result.data.data() + i * frame_size, bytes.data(), frame_size);
+            if (i == 0) {
+                out_params.photometric = decoded.value().output_params.photometric;
+            }
+        }
+    });
+
+    if (error.failed()) {
+        return kcenon::pacs::pacs_error<compression_result>(
+            kcenon::pacs::error_codes::decompression_error, error.message());
+    }
+
+    out_params.number_of_frames = frame_count;
+    result.output_params = out_params;
+    return codec_result::ok(std::move(result));
+}
+
+}  // namespace kcenon::pacs::encoding::compression
@@ -0,0 +1,110 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+#include "kcenon/pacs/encoding/compression/encapsulated_pixel_data.h"
+#include <kcenon/pacs/core/frame_index.h>
+#include <kcenon/pacs/core/result.h>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace kcenon::pacs::encoding::compression {
+
+namespace {
+
+/// Item tag group for encapsulated items (FFFE)
+constexpr uint16_t kItemGroup = 0xFFFE;
+
+/// Item element (FFFE,E000)
+constexpr uint16_t kItemElement = 0xE000;
+
+/// Sequence Delimitation Item element (FFFE,E0DD)
+constexpr uint16_t kSequenceDelimiterElement = 0xE0DD;
+
+/// Size of an item header (tag + 32-bit length)
+constexpr size_t kItemHeaderSize = 8;
+
+inline void append_le16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(static_cast<uint8_t>(value & 0xFF));
+    out.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
+}
+
+inline void append_le32(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(static_cast<uint8_t>(value & 0xFF));
+    out.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
+    out.push_back(static_cast<uint8_t>((value >> 16) & 0xFF));
+    out.push_back(static_cast<uint8_t>((value >> 24) & 0xFF));
+}
+
+inline void append_item_header(std::vector<uint8_t>& out,
+                               uint16_t element,
+                               uint32_t length) {
+    append_le16(out, kItemGroup);
+    append_le16(out, element);
+    append_le32(out, length);
+}
+
+}  // namespace
+
+auto split_encapsulated_frames(std::span<const uint8_t> encapsulated,
+                               uint32_t number_of_frames)
+    -> kcenon::pacs::Result<std::vector<std::vector<uint8_t>>> {
+    using frames_t = std::vector<std::vector<uint8_t>>;
+
+    auto index = core::frame_index::from_encapsulated(encapsulated, number_of_frames);
+    if (index.is_err()) {
+        return kcenon::pacs::Result<frames_t>::err(index.error());
+    }
+
+    const auto& frame_map = index.value();
+    frames_t frames(frame_map.frame_count());
+    for (uint32_t f = 0; f < frame_map.frame_count(); ++f) {
+        auto& frame = frames[f];
+        frame.reserve(frame_map.frame_size(f + 1));
+        for (const auto& range : frame_map.fragments(f + 1)) {
+            const auto fragment = encapsulated.subspan(range.offset, range.length);
+            frame.insert(frame.end(), fragment.begin(), fragment.end());
+        }
+    }
+
+    return kcenon::pacs::Result<frames_t>::ok(std::move(frames));
+}
+
+auto build_encapsulated_pixel_data(
+    const std::vector<std::vector<uint8_t>>& frames) -> std::vector<uint8_t> {
+    size_t total = kItemHeaderSize + frames.size() * 4 + kItemHeaderSize;
+    for (const auto& frame : frames) {
+        total += kItemHeaderSize + frame.size() + (frame.size() & 1);
+    }
+
+    std::vector<uint8_t> out;
+    out.reserve(total);
+
+    // Basic Offset Table
+    append_item_header(out, kItemElement,
+                       static_cast<uint32_t>(frames.size() * 4));
+    uint32_t offset = 0;
+    for (const auto& frame : frames) {
+        append_le32(out, offset);
+        offset += static_cast<uint32_t>(
+            kItemHeaderSize + frame.size() + (frame.size() & 1));
+    }
+
+    // One fragment per frame, padded to even length
+    for (const auto& frame : frames) {
+        const auto padded = static_cast<uint32_t>(frame.size() + (frame.size() & 1));
+        append_item_header(out, kItemElement, padded);
+        out.insert(out.end(), frame.begin(), frame.end());
+        if (frame.size() & 1) {
+            out.push_back(0x00);
+        }
+    }
+
+    append_item_header(out, kSequenceDelimiterElement, 0);
+    return out;
+}
+
+}  // namespace kcenon::pacs::encoding::compression
@@ -59,6 +59,10 @@ bool frame_deflate_codec::can_decode(const image_params& params) const noexcept
     return can_encode(params);
 }
 
+std::unique_ptr<compression_codec> frame_deflate_codec::clone() const {
+    return std::make_unique<frame_deflate_codec>(compression_level_);
+}
+
 int frame_deflate_codec::compression_level() const noexcept {
     return compression_level_;
 }
@@ -56,6 +56,10 @@ bool hevc_codec::can_decode(const image_params& params) const noexcept {
     return can_encode(params);
 }
 
+std::unique_ptr<compression_codec> hevc_codec::clone() const {
+    return std::make_unique<hevc_codec>(main10_, quality_);
+}
+
 bool hevc_codec::is_main10_profile() const noexcept {
     return main10_;
 }
@@ -69,6 +69,11 @@ bool htj2k_codec::can_decode(const image_params& params) const noexcept {
     return can_encode(params);
 }
 
+std::unique_ptr<compression_codec> htj2k_codec::clone() const {
+    return std::make_unique<htj2k_codec>(lossless_, use_rpcl_, compression_ratio_,
+                                         resolution_levels_);
+}
+
 bool htj2k_codec::is_lossless_mode() const noexcept {
     return lossless_;
 }
@@ -633,6 +633,12 @@ bool jpeg2000_codec::can_decode(const image_params& params) const noexcept {
     return true;
 }
 
+std::unique_ptr<compression_codec> jpeg2000_codec::clone() const {
+    return std::make_unique<jpeg2000_codec>(impl_->is_lossless_mode(),
+                                            impl_->compression_ratio(),
+                                            impl_->resolution_levels());
+}
+
 bool jpeg2000_codec::is_lossless_mode() const noexcept {
     return impl_->is_lossless_mode();
 }
@@ -399,6 +399,10 @@ bool jpeg_baseline_codec::can_decode(const image_params& params) const noexcept
     return true;
 }
 
+std::unique_ptr<compression_codec> jpeg_baseline_codec::clone() const {
+    return std::make_unique<jpeg_baseline_codec>();
+}
+
 codec_result jpeg_baseline_codec::encode(
     std::span<const uint8_t> pixel_data,
     const image_params& params,
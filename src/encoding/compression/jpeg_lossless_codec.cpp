@@ -781,6 +781,11 @@ bool jpeg_lossless_codec::can_decode(const image_params& params) const noexcept
     return true;
 }
 
+std::unique_ptr<compression_codec> jpeg_lossless_codec::clone() const {
+    return std::make_unique<jpeg_lossless_codec>(impl_->predictor(),
+                                                 impl_->point_transform());
+}
+
 int jpeg_lossless_codec::predictor() const noexcept {
     return impl_->predictor();
 }
@@ -310,6 +310,10 @@ bool jpeg_ls_codec::can_decode(const image_params& params) const noexcept {
     return true;
 }
 
+std::unique_ptr<compression_codec> jpeg_ls_codec::clone() const {
+    return std::make_unique<jpeg_ls_codec>(impl_->is_lossless_mode(), impl_->near_value());
+}
+
 bool jpeg_ls_codec::is_lossless_mode() const noexcept {
     return impl_->is_lossless_mode();
 }
@@ -61,6 +61,10 @@ bool jpegxl_codec::can_decode(const image_params& params) const noexcept {
     return can_encode(params);
 }
 
+std::unique_ptr<compression_codec> jpegxl_codec::clone() const {
+    return std::make_unique<jpegxl_codec>(lossless_, jpeg_recompression_, quality_distance_);
+}
+
 bool jpegxl_codec::is_lossless_mode() const noexcept {
     return lossless_;
 }
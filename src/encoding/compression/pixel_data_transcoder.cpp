@@ -0,0 +1,224 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file pixel_data_transcoder.cpp
+ * @brief Implementation of whole-file transfer syntax conversion
+ */
+
+#include "kcenon/pacs/encoding/compression/pixel_data_transcoder.h"
+
+#include "kcenon/pacs/encoding/compression/codec_factory.h"
+
+#include <kcenon/pacs/core/dicom_tag_constants.h>
+
+#include <string>
+#include <vector>
+
+namespace kcenon::pacs::encoding::compression {
+
+namespace {
+
+/// Planar Configuration (0028,0006)
+constexpr core::dicom_tag planar_configuration_tag{0x0028, 0x0006};
+
+/// Number of Frames (0028,0008)
+constexpr core::dicom_tag number_of_frames_tag{0x0028, 0x0008};
+
+/// Lossy Image Compression (0028,2110)
+constexpr core::dicom_tag lossy_image_compression_tag{0x0028, 0x2110};
+
+/**
+ * @brief Check whether producing the given syntax discards information
+ */
+auto is_lossy_target(const transfer_syntax& ts) -> bool {
+    if (!ts.is_encapsulated()) {
+        return false;
+    }
+    auto codec = codec_factory::create(ts);
+    return codec && codec->is_lossy();
+}
+
+}  // namespace
+
+auto read_image_params(const core::dicom_dataset& ds) -> image_params {
+    image_params params;
+    params.width = ds.get_numeric<uint16_t>(core::tags::columns).value_or(0);
+    params.height = ds.get_numeric<uint16_t>(core::tags::rows).value_or(0);
+    params.bits_allocated =
+        ds.get_numeric<uint16_t>(core::tags::bits_allocated).value_or(0);
+    params.bits_stored =
+        ds.get_numeric<uint16_t>(core::tags::bits_stored).value_or(params.bits_allocated);
+    params.high_bit = ds.get_numeric<uint16_t>(core::tags::high_bit)
+                          .value_or(params.bits_stored > 0 ? params.bits_stored - 1 : 0);
+    params.samples_per_pixel =
+        ds.get_numeric<uint16_t>(core::tags::samples_per_pixel).value_or(1);
+    params.planar_configuration =
+        ds.get_numeric<uint16_t>(planar_configuration_tag).value_or(0);
+    params.pixel_representation =
+        ds.get_numeric<uint16_t>(core::tags::pixel_representation).value_or(0);
+    params.photometric = parse_photometric_interpretation(
+        ds.get_string(core::tags::photometric_interpretation, "MONOCHROME2"));
+
+    params.number_of_frames = 1;
+    const auto frames_str = ds.get_string(number_of_frames_tag);
+    if (!frames_str.empty()) {
+        try {
+            const auto n = std::stol(frames_str);
+            if (n > 0) {
+                params.number_of_frames = static_cast<uint32_t>(n);
+            }
+        } catch (...) {
+            // Keep single frame for malformed values
+        }
+    }
+    return params;
+}
+
+auto can_transcode(const transfer_syntax& source,
+                   const transfer_syntax& target,
+                   bool allow_lossy) -> bool {
+    if (!source.is_valid() || !target.is_valid()) {
+        return false;
+    }
+    if (source == target) {
+        return true;
+    }
+    // Encapsulated syntaxes are gated on codec availability below
+    if (!target.is_encapsulated() && !target.is_supported()) {
+        return false;
+    }
+    if (!allow_lossy && is_lossy_target(target)) {
+        return false;
+    }
+
+    if (!source.is_encapsulated() && !target.is_encapsulated()) {
+        return source.is_supported();
+    }
+
+    // Codec paths operate on little endian native pixel data
+    if (source.is_encapsulated()) {
+        if (!codec_factory::is_supported(source.uid())) {
+            return false;
+        }
+    } else if (source.endianness() != byte_order::little_endian) {
+        return false;
+    }
+
+    if (target.is_encapsulated()) {
+        return codec_factory::is_supported(target.uid());
+    }
+    return target.endianness() == byte_order::little_endian;
+}
+
+auto transcode_file(const core::dicom_file& file,
+                    const transfer_syntax& target,
+                    const transcode_options& options)
+    -> kcenon::pacs::Result<core::dicom_file> {
+    using result_type = kcenon::pacs::Result<core::dicom_file>;
+
+    const auto source = file.transfer_syntax();
+    if (source == target) {
+        return result_type::ok(file);
+    }
+
+    if (!can_transcode(source, target, options.allow_lossy)) {
+        return kcenon::pacs::pacs_error<core::dicom_file>(
+            kcenon::pacs::error_codes::codec_not_supported,
+            "Cannot transcode from " + std::string(source.name()) + " to " +
+            std::string(target.name()));
+    }
+
+    core::dicom_dataset dataset = file.dataset();
+    const auto* pixel_elem = dataset.get(core::tags::pixel_data);
+
+    // Without pixel data, or between native syntaxes, only the
+    // dataset encoding changes
+    if (pixel_elem == nullptr ||
+        (!source.is_encapsulated() && !target.is_encapsulated())) {
+        return result_type::ok(core::dicom_file::create(std::move(dataset), target));
+    }
+
+    auto params = read_image_params(dataset);
+    if (params.width == 0 || params.height == 0 || params.bits_allocated == 0) {
+        return kcenon::pacs::pacs_error<core::dicom_file>(
+            kcenon::pacs::error_codes::invalid_dicom_file,
+            "Missing Image Pixel Module attributes for transcoding");
+    }
+
+    // Obtain native pixel data for all frames
+    std::vector<uint8_t> decoded_pixels;
+    std::span<const uint8_t> native_pixels;
+    if (source.is_encapsulated()) {
+        auto codec = codec_factory::create(source);
+        if (!codec) {
+            return kcenon::pacs::pacs_error<core::dicom_file>(
+                kcenon::pacs::error_codes::codec_not_supported,
+                "No codec for " + std::string(source.uid()));
+        }
+        auto decoded = codec->decode_frames(pixel_elem->raw_data(), params,
+                                            options.parallel);
+        if (decoded.is_err()) {
+            return result_type::err(decoded.error());
+        }
+        decoded_pixels = std::move(decoded.value().data);
+        native_pixels = decoded_pixels;
+
+        // Decoders emit interleaved samples and may convert colour space
+        params.photometric = decoded.value().output_params.photometric;
+        params.planar_configuration = 0;
+    } else {
+        const auto pixels = pixel_elem->raw_data();
+        const auto total = params.frame_size_bytes() * params.number_of_frames;
+        if (total == 0 || pixels.size() < total) {
+            return kcenon::pacs::pacs_error<core::dicom_file>(
+                kcenon::pacs::error_codes::data_size_mismatch,
+                "Pixel data is shorter than Rows x Columns x Frames");
+        }
+        native_pixels = pixels.subspan(0, total);
+    }
+
+    if (target.is_encapsulated()) {
+        auto codec = codec_factory::create(target);
+        if (!codec) {
+            return kcenon::pacs::pacs_error<core::dicom_file>(
+                kcenon::pacs::error_codes::codec_not_supported,
+                "No codec for " + std::string(target.uid()));
+        }
+
+        auto encode_options = options.encode_options;
+        encode_options.lossless = !codec->is_lossy();
+
+        auto encoded = codec->encode_frames(native_pixels, params, encode_options,
+                                            options.parallel);
+        if (encoded.is_err()) {
+            return result_type::err(encoded.error());
+        }
+        dataset.insert(core::dicom_element(core::tags::pixel_data, vr_type::OB,
+                                           encoded.value().data));
+        if (codec->is_lossy()) {
+            dataset.set_string(lossy_image_compression_tag, vr_type::CS, "01");
+        }
+    } else {
+        std::vector<uint8_t> pixels(native_pixels.begin(), native_pixels.end());
+        if (pixels.size() & 1) {
+            pixels.push_back(0x00);
+        }
+        dataset.insert(core::dicom_element(
+            core::tags::pixel_data,
+            params.bits_allocated > 8 ? vr_type::OW : vr_type::OB,
+            pixels));
+    }
+
+    if (params.samples_per_pixel > 1) {
+        dataset.set_numeric<uint16_t>(planar_configuration_tag, vr_type::US,
+                                      params.planar_configuration);
+    }
+    dataset.set_string(core::tags::photometric_interpretation, vr_type::CS,
+                       to_string(params.photometric));
+
+    return result_type::ok(core::dicom_file::create(std::move(dataset), target));
+}
+
+}  // namespace kcenon::pacs::encoding::compression
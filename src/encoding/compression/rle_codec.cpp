@@ -597,6 +597,10 @@ bool rle_codec::can_decode(const image_params& params) const noexcept {
     return true;
 }
 
+std::unique_ptr<compression_codec> rle_codec::clone() const {
+    return std::make_unique<rle_codec>();
+}
+
 codec_result rle_codec::encode(
     std::span<const uint8_t> pixel_data,
     const image_params& params,
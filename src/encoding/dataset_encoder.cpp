@@ -0,0 +1,399 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file dataset_encoder.cpp
+ * @brief Implementation of the two-pass dataset encoder
+ */
+
+#include "kcenon/pacs/encoding/dataset_encoder.h"
+
+#include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/vr_info.h>
+#include <kcenon/pacs/encoding/vr_type.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace kcenon::pacs::encoding {
+
+namespace {
+
+// ============================================================================
+// DICOM Special Tags
+// ============================================================================
+
+constexpr uint16_t ITEM_GROUP = 0xFFFE;
+constexpr uint16_t ITEM_TAG_ELEMENT = 0xE000;       // Item
+constexpr uint16_t SEQ_DELIM_ELEMENT = 0xE0DD;      // Sequence Delimitation Item
+
+constexpr uint32_t UNDEFINED_LENGTH = 0xFFFFFFFF;
+
+/// Big Endian values are swapped in chunks of this many bytes
+constexpr std::size_t kSwapChunk = 4096;
+
+/**
+ * @brief Byte-swap unit of a VR in Big Endian encoding
+ * @return 2, 4 or 8; 1 for VRs written as is (strings, OB, UN)
+ *
+ * Matches explicit_vr_big_endian_codec::from_big_endian so that encoded
+ * values decode back unchanged.
+ */
+constexpr std::size_t swap_unit(vr_type vr) {
+    switch (vr) {
+        case vr_type::US:
+        case vr_type::SS:
+        case vr_type::OW:
+        case vr_type::AT:
+            return 2;
+
+        case vr_type::UL:
+        case vr_type::SL:
+        case vr_type::FL:
+        case vr_type::OL:
+        case vr_type::OF:
+            return 4;
+
+        case vr_type::FD:
+        case vr_type::OD:
+            return 8;
+
+        default:
+            return 1;
+    }
+}
+
+/// Pixel Data kept as its raw encapsulated item stream
+bool is_encapsulated_pixel_data(const core::dicom_element& element) {
+    const auto raw = element.raw_data();
+    return element.tag() == core::tags::pixel_data &&
+           element.vr() == vr_type::OB && raw.size() >= 8 &&
+           raw[0] == 0xFE && raw[1] == 0xFF && raw[2] == 0x00 && raw[3] == 0xE0;
+}
+
+// ============================================================================
+// Pass 1: sizes
+// ============================================================================
+
+/**
+ * @brief Computes encoded sizes and records every item length
+ *
+ * Item lengths are recorded in the order the writer visits items, so the
+ * second pass never has to measure a nested dataset again.
+ */
+class layout {
+public:
+    explicit layout(const encoder_options& options) : options_(options) {}
+
+    auto dataset(const core::dicom_dataset& dataset) -> std::size_t {
+        std::size_t size = 0;
+        for (const auto& [tag, element] : dataset) {
+            size += this->element(element);
+        }
+        return size;
+    }
+
+    auto element(const core::dicom_element& element) -> std::size_t {
+        const std::size_t header =
+            options_.vr == vr_encoding::implicit ||
+                    !has_explicit_32bit_length(element.vr())
+                ? 8
+                : 12;
+
+        if (element.is_sequence()) {
+            std::size_t size = header + 8;  // + Sequence Delimitation Item
+            for (const auto& item : element.sequence_items()) {
+                const auto slot = item_lengths.size();
+                item_lengths.push_back(0);
+                const auto length = dataset(item);
+                item_lengths[slot] = static_cast<uint32_t>(length);
+                size += 8 + length;
+            }
+            return size;
+        }
+
+        const auto value = element.raw_data().size();
+        if (encapsulated(element)) {
+            return header + value;
+        }
+        return header + value + (value & 1);
+    }
+
+    [[nodiscard]] auto encapsulated(const core::dicom_element& element) const -> bool {
+        return options_.undefined_length_encapsulated &&
+               options_.vr == vr_encoding::explicit_vr &&
+               options_.order == byte_order::little_endian &&
+               is_encapsulated_pixel_data(element);
+    }
+
+    /// Item lengths in visiting order
+    std::vector<uint32_t> item_lengths;
+
+private:
+    const encoder_options& options_;
+};
+
+// ============================================================================
+// Pass 2: outputs
+// ============================================================================
+
+/**
+ * @brief Output into a buffer already sized to the encoded length
+ */
+class buffer_output {
+public:
+    explicit buffer_output(uint8_t* out) noexcept : out_(out) {}
+
+    void put(std::span<const uint8_t> bytes) noexcept {
+        if (!bytes.empty()) {
+            std::memcpy(out_, bytes.data(), bytes.size());
+            out_ += bytes.size();
+        }
+    }
+
+    /// Space for n bytes (n <= kSwapChunk) the caller fills in
+    auto reserve(std::size_t n) noexcept -> uint8_t* {
+        auto* p = out_;
+        out_ += n;
+        return p;
+    }
+
+private:
+    uint8_t* out_;
+};
+
+/**
+ * @brief Output batching small writes into a staging buffer for a sink
+ *
+ * Values of at least dataset_encoder::direct_write_threshold bytes are
+ * passed to the sink directly from the element. After the first sink
+ * error further output is dropped.
+ */
+class sink_output {
+public:
+    explicit sink_output(byte_sink& sink)
+        : sink_(sink), staging_(dataset_encoder::staging_size) {}
+
+    void put(std::span<const uint8_t> bytes) {
+        if (bytes.size() >= dataset_encoder::direct_write_threshold) {
+            flush();
+            if (result_.is_ok()) {
+                result_ = sink_.write(bytes);
+            }
+            return;
+        }
+        std::memcpy(reserve(bytes.size()), bytes.data(), bytes.size());
+    }
+
+    /// Space for n bytes (n <= kSwapChunk) the caller fills in
+    auto reserve(std::size_t n) -> uint8_t* {
+        if (used_ + n > staging_.size()) {
+            flush();
+        }
+        auto* p = staging_.data() + used_;
+        used_ += n;
+        return p;
+    }
+
+    auto finish() -> VoidResult {
+        flush();
+        return result_;
+    }
+
+private:
+    void flush() {
+        if (used_ != 0 && result_.is_ok()) {
+            result_ = sink_.write({staging_.data(), used_});
+        }
+        used_ = 0;
+    }
+
+    byte_sink& sink_;
+    std::vector<uint8_t> staging_;
+    std::size_t used_{0};
+    VoidResult result_{ok()};
+};
+
+/**
+ * @brief Writes elements using the item lengths recorded by layout
+ */
+template <typename Output>
+class writer {
+public:
+    writer(const encoder_options& options, const layout& sizes, Output& out)
+        : options_(options), sizes_(sizes), out_(out) {}
+
+    void dataset(const core::dicom_dataset& dataset) {
+        for (const auto& [tag, element] : dataset) {
+            this->element(element);
+        }
+    }
+
+    void element(const core::dicom_element& element) {
+        const auto vr = element.vr();
+        uint8_t header[12];
+        std::size_t n = put_tag(header, element.tag());
+
+        const bool explicit_vr = options_.vr == vr_encoding::explicit_vr;
+        if (explicit_vr) {
+            const auto vr_str = to_string(vr);
+            header[n++] = static_cast<uint8_t>(vr_str[0]);
+            header[n++] = static_cast<uint8_t>(vr_str[1]);
+        }
+        const bool long_length = !explicit_vr || has_explicit_32bit_length(vr);
+        if (explicit_vr && long_length) {
+            header[n++] = 0x00;  // Reserved
+            header[n++] = 0x00;
+        }
+
+        if (element.is_sequence()) {
+            n += put32(header + n, UNDEFINED_LENGTH);
+            out_.put({header, n});
+            for (const auto& item : element.sequence_items()) {
+                n = put_tag(header, core::dicom_tag{ITEM_GROUP, ITEM_TAG_ELEMENT});
+                n += put32(header + n, sizes_.item_lengths[next_item_++]);
+                out_.put({header, n});
+                dataset(item);
+            }
+            n = put_tag(header, core::dicom_tag{ITEM_GROUP, SEQ_DELIM_ELEMENT});
+            n += put32(header + n, 0);
+            out_.put({header, n});
+            return;
+        }
+
+        const auto value = element.raw_data();
+        const bool encapsulated = sizes_.encapsulated(element);
+        const auto length = encapsulated
+                                ? UNDEFINED_LENGTH
+                                : static_cast<uint32_t>(value.size() + (value.size() & 1));
+        if (long_length) {
+            n += put32(header + n, length);
+        } else {
+            n += put16(header + n, static_cast<uint16_t>(length));
+        }
+        out_.put({header, n});
+
+        const auto unit = options_.order == byte_order::big_endian ? swap_unit(vr) : 1;
+        const auto padding = static_cast<uint8_t>(get_vr_info(vr).padding_char);
+        if (unit > 1 && (value.size() & 1) != 0) {
+            // Malformed odd-length binary value: pad first, then swap
+            std::vector<uint8_t> padded(value.begin(), value.end());
+            padded.push_back(padding);
+            put_swapped(padded, unit);
+            return;
+        }
+        if (unit > 1) {
+            put_swapped(value, unit);
+        } else {
+            out_.put(value);
+        }
+        if (!encapsulated && (value.size() & 1) != 0) {
+            *out_.reserve(1) = padding;
+        }
+    }
+
+private:
+    auto put16(uint8_t* p, uint16_t value) const noexcept -> std::size_t {
+        if (options_.order == byte_order::big_endian) {
+            p[0] = static_cast<uint8_t>(value >> 8);
+            p[1] = static_cast<uint8_t>(value);
+        } else {
+            p[0] = static_cast<uint8_t>(value);
+            p[1] = static_cast<uint8_t>(value >> 8);
+        }
+        return 2;
+    }
+
+    auto put32(uint8_t* p, uint32_t value) const noexcept -> std::size_t {
+        if (options_.order == byte_order::big_endian) {
+            put16(p, static_cast<uint16_t>(value >> 16));
+            put16(p + 2, static_cast<uint16_t>(value));
+        } else {
+            put16(p, static_cast<uint16_t>(value));
+            put16(p + 2, static_cast<uint16_t>(value >> 16));
+        }
+        return 4;
+    }
+
+    auto put_tag(uint8_t* p, core::dicom_tag tag) const noexcept -> std::size_t {
+        put16(p, tag.group());
+        put16(p + 2, tag.element());
+        return 4;
+    }
+
+    /// Copy a value reversing each unit; a trailing partial unit is copied as is
+    void put_swapped(std::span<const uint8_t> value, std::size_t unit) {
+        for (std::size_t offset = 0; offset < value.size(); offset += kSwapChunk) {
+            const auto chunk = value.subspan(offset, std::min(kSwapChunk, value.size() - offset));
+            auto* out = out_.reserve(chunk.size());
+            std::size_t i = 0;
+            for (; i + unit <= chunk.size(); i += unit) {
+                std::reverse_copy(chunk.begin() + static_cast<std::ptrdiff_t>(i),
+                                  chunk.begin() + static_cast<std::ptrdiff_t>(i + unit),
+                                  out + i);
+            }
+            std::copy(chunk.begin() + static_cast<std::ptrdiff_t>(i), chunk.end(), out + i);
+        }
+    }
+
+    const encoder_options& options_;
+    const layout& sizes_;
+    Output& out_;
+    std::size_t next_item_{0};
+};
+
+}  // namespace
+
+// ============================================================================
+// dataset_encoder
+// ============================================================================
+
+auto dataset_encoder::encoded_size(const core::dicom_dataset& dataset) const
+    -> std::size_t {
+    layout sizes(options_);
+    return sizes.dataset(dataset);
+}
+
+auto dataset_encoder::encoded_size(const core::dicom_element& element) const
+    -> std::size_t {
+    layout sizes(options_);
+    return sizes.element(element);
+}
+
+auto dataset_encoder::encode(const core::dicom_dataset& dataset) const
+    -> std::vector<uint8_t> {
+    std::vector<uint8_t> buffer;
+    encode_append(dataset, buffer);
+    return buffer;
+}
+
+auto dataset_encoder::encode(const core::dicom_element& element) const
+    -> std::vector<uint8_t> {
+    layout sizes(options_);
+    std::vector<uint8_t> buffer(sizes.element(element));
+    buffer_output out(buffer.data());
+    writer<buffer_output>(options_, sizes, out).element(element);
+    return buffer;
+}
+
+void dataset_encoder::encode_append(const core::dicom_dataset& dataset,
+                                    std::vector<uint8_t>& buffer) const {
+    layout sizes(options_);
+    const auto size = sizes.dataset(dataset);
+    const auto offset = buffer.size();
+    buffer.resize(offset + size);
+    buffer_output out(buffer.data() + offset);
+    writer<buffer_output>(options_, sizes, out).dataset(dataset);
+}
+
+auto dataset_encoder::encode(const core::dicom_dataset& dataset,
+                             byte_sink& sink) const -> VoidResult {
+    layout sizes(options_);
+    sizes.dataset(dataset);
+    sink_output out(sink);
+    writer<sink_output>(options_, sizes, out).dataset(dataset);
+    return out.finish();
+}
+
+}  // namespace kcenon::pacs::encoding
@@ -10,6 +10,7 @@
 #include "kcenon/pacs/encoding/explicit_vr_big_endian_codec.h"
 
 #include <kcenon/pacs/encoding/byte_swap.h>
+#include <kcenon/pacs/encoding/dataset_encoder.h>
 #include <kcenon/pacs/encoding/vr_info.h>
 #include <kcenon/pacs/encoding/vr_type.h>
 
@@ -159,94 +160,12 @@ std::vector<uint8_t> explicit_vr_big_endian_codec::from_big_endian(
 
 std::vector<uint8_t> explicit_vr_big_endian_codec::encode(
     const core::dicom_dataset& dataset) {
-    std::vector<uint8_t> buffer;
-    buffer.reserve(4096);  // Initial capacity
-
-    for (const auto& [tag, element] : dataset) {
-        auto encoded = encode_element(element);
-        buffer.insert(buffer.end(), encoded.begin(), encoded.end());
-    }
-
-    return buffer;
+    return dataset_encoder(transfer_syntax::explicit_vr_big_endian).encode(dataset);
 }
 
 std::vector<uint8_t> explicit_vr_big_endian_codec::encode_element(
     const core::dicom_element& element) {
-    std::vector<uint8_t> buffer;
-
-    // Write tag (4 bytes: group + element, big-endian)
-    write_be16(buffer, element.tag().group());
-    write_be16(buffer, element.tag().element());
-
-    // Write VR (2 ASCII characters)
-    auto vr_str = to_string(element.vr());
-    buffer.push_back(static_cast<uint8_t>(vr_str[0]));
-    buffer.push_back(static_cast<uint8_t>(vr_str[1]));
-
-    // Handle sequences specially
-    if (element.is_sequence()) {
-        encode_sequence(buffer, element);
-        return buffer;
-    }
-
-    // Get padded data and convert to big-endian
-    auto data = element.raw_data();
-    auto padded_data = pad_to_even(element.vr(), data);
-    auto be_data = to_big_endian(element.vr(), padded_data);
-    uint32_t length = static_cast<uint32_t>(be_data.size());
-
-    // Write length based on VR type
-    if (has_explicit_32bit_length(element.vr())) {
-        // Extended format: 2 reserved bytes + 4 byte length
-        write_be16(buffer, 0x0000);  // Reserved
-        write_be32(buffer, length);
-    } else {
-        // Standard format: 2 byte length
-        write_be16(buffer, static_cast<uint16_t>(length));
-    }
-
-    // Write value (already byte-swapped)
-    buffer.insert(buffer.end(), be_data.begin(), be_data.end());
-
-    return buffer;
-}
-
-void explicit_vr_big_endian_codec::encode_sequence(
-    std::vector<uint8_t>& buffer,
-    const core::dicom_element& element) {
-    // Write reserved bytes for SQ VR (uses 32-bit length)
-    write_be16(buffer, 0x0000);
-
-    // Write undefined length for sequence (big-endian)
-    write_be32(buffer, UNDEFINED_LENGTH);
-
-    // Encode each sequence item
-    const auto& items = element.sequence_items();
-    for (const auto& item : items) {
-        encode_sequence_item(buffer, item);
-    }
-
-    // Write sequence delimitation item (big-endian for tag and length)
-    write_be16(buffer, ITEM_GROUP);
-    write_be16(buffer, SEQ_DELIM_ELEMENT);
-    write_be32(buffer, 0);  // Length is always 0 for delimiter
-}
-
-void explicit_vr_big_endian_codec::encode_sequence_item(
-    std::vector<uint8_t>& buffer,
-    const core::dicom_dataset& item) {
-    // Write Item tag (big-endian)
-    write_be16(buffer, ITEM_GROUP);
-    write_be16(buffer, ITEM_TAG_ELEMENT);
-
-    // Encode item content first to determine length
-    auto item_content = encode(item);
-
-    // Write item length (big-endian)
-    write_be32(buffer, static_cast<uint32_t>(item_content.size()));
-
-    // Write item content
-    buffer.insert(buffer.end(), item_content.begin(), item_content.end());
+    return dataset_encoder(transfer_syntax::explicit_vr_big_endian).encode(element);
 }
 
 // ============================================================================
@@ -9,6 +9,7 @@
 
 #include "kcenon/pacs/encoding/explicit_vr_codec.h"
 
+#include <kcenon/pacs/encoding/dataset_encoder.h>
 #include <kcenon/pacs/encoding/vr_info.h>
 #include <kcenon/pacs/encoding/vr_type.h>
 
@@ -34,18 +35,6 @@ constexpr uint32_t read_le32(const uint8_t* data) {
            (static_cast<uint32_t>(data[3]) << 24);
 }
 
-void write_le16(std::vector<uint8_t>& buffer, uint16_t value) {
-    buffer.push_back(static_cast<uint8_t>(value & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-}
-
-void write_le32(std::vector<uint8_t>& buffer, uint32_t value) {
-    buffer.push_back(static_cast<uint8_t>(value & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 16) & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 24) & 0xFF));
-}
-
 // ============================================================================
 // DICOM Special Tags
 // ============================================================================
@@ -94,91 +83,12 @@ kcenon::pacs::Result<T> make_codec_error(int code, const std::string& message) {
 
 std::vector<uint8_t> explicit_vr_codec::encode(
     const core::dicom_dataset& dataset) {
-    std::vector<uint8_t> buffer;
-    buffer.reserve(4096);  // Initial capacity
-
-    for (const auto& [tag, element] : dataset) {
-        auto encoded = encode_element(element);
-        buffer.insert(buffer.end(), encoded.begin(), encoded.end());
-    }
-
-    return buffer;
+    return dataset_encoder(transfer_syntax::explicit_vr_little_endian).encode(dataset);
 }
 
 std::vector<uint8_t> explicit_vr_codec::encode_element(
     const core::dicom_element& element) {
-    std::vector<uint8_t> buffer;
-
-    // Write tag (4 bytes: group + element, little-endian)
-    write_le16(buffer, element.tag().group());
-    write_le16(buffer, element.tag().element());
-
-    // Write VR (2 ASCII characters)
-    auto vr_str = to_string(element.vr());
-    buffer.push_back(static_cast<uint8_t>(vr_str[0]));
-    buffer.push_back(static_cast<uint8_t>(vr_str[1]));
-
-    // Handle sequences specially
-    if (element.is_sequence()) {
-        encode_sequence(buffer, element);
-        return buffer;
-    }
-
-    // Get padded data
-    auto data = element.raw_data();
-    auto padded_data = pad_to_even(element.vr(), data);
-    uint32_t length = static_cast<uint32_t>(padded_data.size());
-
-    // Write length based on VR type
-    if (has_explicit_32bit_length(element.vr())) {
-        // Extended format: 2 reserved bytes + 4 byte length
-        write_le16(buffer, 0x0000);  // Reserved
-        write_le32(buffer, length);
-    } else {
-        // Standard format: 2 byte length
-        write_le16(buffer, static_cast<uint16_t>(length));
-    }
-
-    // Write value
-    buffer.insert(buffer.end(), padded_data.begin(), padded_data.end());
-
-    return buffer;
-}
-
-void explicit_vr_codec::encode_sequence(std::vector<uint8_t>& buffer,
-                                         const core::dicom_element& element) {
-    // Write reserved bytes for SQ VR (uses 32-bit length)
-    write_le16(buffer, 0x0000);
-
-    // Write undefined length for sequence
-    write_le32(buffer, UNDEFINED_LENGTH);
-
-    // Encode each sequence item
-    const auto& items = element.sequence_items();
-    for (const auto& item : items) {
-        encode_sequence_item(buffer, item);
-    }
-
-    // Write sequence delimitation item (implicit VR encoding for delimiters)
-    write_le16(buffer, ITEM_GROUP);
-    write_le16(buffer, SEQ_DELIM_ELEMENT);
-    write_le32(buffer, 0);  // Length is always 0 for delimiter
-}
-
-void explicit_vr_codec::encode_sequence_item(std::vector<uint8_t>& buffer,
-                                              const core::dicom_dataset& item) {
-    // Write Item tag (implicit VR encoding for item tags)
-    write_le16(buffer, ITEM_GROUP);
-    write_le16(buffer, ITEM_TAG_ELEMENT);
-
-    // Encode item content first to determine length
-    auto item_content = encode(item);
-
-    // Write item length
-    write_le32(buffer, static_cast<uint32_t>(item_content.size()));
-
-    // Write item content
-    buffer.insert(buffer.end(), item_content.begin(), item_content.end());
+    return dataset_encoder(transfer_syntax::explicit_vr_little_endian).encode(element);
 }
 
 // ============================================================================
@@ -10,6 +10,7 @@
 #include "kcenon/pacs/encoding/implicit_vr_codec.h"
 
 #include <kcenon/pacs/core/dicom_dictionary.h>
+#include <kcenon/pacs/encoding/dataset_encoder.h>
 #include <kcenon/pacs/encoding/vr_info.h>
 
 #include <cstring>
@@ -34,18 +35,6 @@ constexpr uint32_t read_le32(const uint8_t* data) {
            (static_cast<uint32_t>(data[3]) << 24);
 }
 
-void write_le16(std::vector<uint8_t>& buffer, uint16_t value) {
-    buffer.push_back(static_cast<uint8_t>(value & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-}
-
-void write_le32(std::vector<uint8_t>& buffer, uint32_t value) {
-    buffer.push_back(static_cast<uint8_t>(value & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 16) & 0xFF));
-    buffer.push_back(static_cast<uint8_t>((value >> 24) & 0xFF));
-}
-
 // ============================================================================
 // DICOM Special Tags
 // ============================================================================
@@ -90,75 +79,12 @@ kcenon::pacs::Result<T> make_codec_error(int code, const std::string& message) {
 
 std::vector<uint8_t> implicit_vr_codec::encode(
     const core::dicom_dataset& dataset) {
-    std::vector<uint8_t> buffer;
-    buffer.reserve(4096);  // Initial capacity
-
-    for (const auto& [tag, element] : dataset) {
-        auto encoded = encode_element(element);
-        buffer.insert(buffer.end(), encoded.begin(), encoded.end());
-    }
-
-    return buffer;
+    return dataset_encoder(transfer_syntax::implicit_vr_little_endian).encode(dataset);
 }
 
 std::vector<uint8_t> implicit_vr_codec::encode_element(
     const core::dicom_element& element) {
-    std::vector<uint8_t> buffer;
-
-    // Write tag (4 bytes: group + element, little-endian)
-    write_le16(buffer, element.tag().group());
-    write_le16(buffer, element.tag().element());
-
-    // Handle sequences specially
-    if (element.is_sequence()) {
-        encode_sequence(buffer, element);
-        return buffer;
-    }
-
-    // Write length (4 bytes, little-endian)
-    // Ensure even length by padding if necessary
-    auto data = element.raw_data();
-    auto padded_data = pad_to_even(element.vr(), data);
-
-    write_le32(buffer, static_cast<uint32_t>(padded_data.size()));
-
-    // Write value
-    buffer.insert(buffer.end(), padded_data.begin(), padded_data.end());
-
-    return buffer;
-}
-
-void implicit_vr_codec::encode_sequence(std::vector<uint8_t>& buffer,
-                                         const core::dicom_element& element) {
-    // Write undefined length for sequence
-    write_le32(buffer, UNDEFINED_LENGTH);
-
-    // Encode each sequence item
-    const auto& items = element.sequence_items();
-    for (const auto& item : items) {
-        encode_sequence_item(buffer, item);
-    }
-
-    // Write sequence delimitation item
-    write_le16(buffer, ITEM_GROUP);
-    write_le16(buffer, SEQ_DELIM_ELEMENT);
-    write_le32(buffer, 0);  // Length is always 0 for delimiter
-}
-
-void implicit_vr_codec::encode_sequence_item(std::vector<uint8_t>& buffer,
-                                              const core::dicom_dataset& item) {
-    // Write Item tag
-    write_le16(buffer, ITEM_GROUP);
-    write_le16(buffer, ITEM_TAG_ELEMENT);
-
-    // Encode item content first to determine length
-    auto item_content = encode(item);
-
-    // Write item length
-    write_le32(buffer, static_cast<uint32_t>(item_content.size()));
-
-    // Write item content
-    buffer.insert(buffer.end(), item_content.begin(), item_content.end());
+    return dataset_encoder(transfer_syntax::implicit_vr_little_endian).encode(element);
 }
 
 // ============================================================================
@@ -218,11 +144,10 @@ implicit_vr_codec::result<core::dicom_element> implicit_vr_codec::decode_element
     data = data.subspan(8);
 
     // Look up VR from dictionary
-    auto& dict = core::dicom_dictionary::instance();
-    auto tag_info = dict.find(tag);
+    const auto* tag_info = core::dicom_dictionary::instance().lookup(tag);
 
     vr_type vr = vr_type::UN;  // Default to Unknown if not found
-    if (tag_info) {
+    if (tag_info != nullptr) {
         vr = static_cast<vr_type>(tag_info->vr);
     }
 
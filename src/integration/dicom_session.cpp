@@ -8,6 +8,7 @@
  */
 
 #include <kcenon/pacs/integration/dicom_session.h>
+#include <kcenon/pacs/network/p_data_fragmenter.h>
 
 #include <kcenon/network/interfaces/i_session.h>
 #include <kcenon/network/session/session.h>
@@ -150,6 +151,30 @@ dicom_session::send_raw(const std::vector<uint8_t>& data) {
     return Result<std::monostate>(std::monostate{});
 }
 
+Result<std::monostate>
+dicom_session::send_p_data(const network::p_data_fragmenter& fragmenter) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (closed_) {
+        return Result<std::monostate>(error_info("Session is closed"));
+    }
+
+    if (fragmenter.fragments().empty()) {
+        return Result<std::monostate>(error_info("No P-DATA-TF fragments to send"));
+    }
+
+    // One buffer per PDU: the extra memory stays bounded by the maximum
+    // PDU length instead of the whole message
+    for (const auto& fragment : fragmenter.fragments()) {
+        std::vector<uint8_t> pdu;
+        pdu.reserve(fragment.size());
+        fragment.append_to(pdu);
+        send_data(std::move(pdu));
+    }
+
+    return Result<std::monostate>(std::monostate{});
+}
+
 Result<pdu_data>
 dicom_session::receive_pdu(duration timeout) {
     std::unique_lock<std::mutex> lock(mutex_);
@@ -11,6 +11,7 @@
 
 #include "kcenon/pacs/monitoring/pacs_metrics.h"
 
+#include <array>
 #include <iomanip>
 #include <sstream>
 
@@ -18,6 +19,119 @@ namespace kcenon::pacs::monitoring {
 
 namespace {
 
+/**
+ * @brief Prometheus bucket boundaries for latency histograms
+ *
+ * The fine log-linear buckets are folded into these cumulative buckets at
+ * export time. A fine bucket straddling a boundary is counted in the next
+ * one, so each cumulative count errs low by at most one fine bucket.
+ */
+struct prometheus_bucket {
+    std::string_view le;
+    std::uint64_t bound_ns;
+};
+
+constexpr std::array<prometheus_bucket, 18> kPrometheusBuckets{{
+    {"0.0001", 100'000},
+    {"0.00025", 250'000},
+    {"0.0005", 500'000},
+    {"0.001", 1'000'000},
+    {"0.0025", 2'500'000},
+    {"0.005", 5'000'000},
+    {"0.01", 10'000'000},
+    {"0.025", 25'000'000},
+    {"0.05", 50'000'000},
+    {"0.1", 100'000'000},
+    {"0.25", 250'000'000},
+    {"0.5", 500'000'000},
+    {"1", 1'000'000'000},
+    {"2.5", 2'500'000'000},
+    {"5", 5'000'000'000},
+    {"10", 10'000'000'000},
+    {"30", 30'000'000'000},
+    {"60", 60'000'000'000},
+}};
+
+/**
+ * @brief Helper to format a latency snapshot as JSON object (microseconds)
+ * @param snapshot The histogram snapshot to format
+ * @return JSON object string for the distribution
+ */
+std::string latency_to_json(const histogram_snapshot& snapshot) {
+    const auto us = [](std::uint64_t ns) { return static_cast<double>(ns) / 1000.0; };
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(3) << "{"
+        << R"("count":)" << snapshot.count
+        << R"(,"mean_us":)" << snapshot.mean() / 1000.0
+        << R"(,"p50_us":)" << us(snapshot.percentile(0.50))
+        << R"(,"p90_us":)" << us(snapshot.percentile(0.90))
+        << R"(,"p99_us":)" << us(snapshot.percentile(0.99))
+        << R"(,"p999_us":)" << us(snapshot.percentile(0.999))
+        << R"(,"max_us":)" << us(snapshot.max())
+        << "}";
+    return oss.str();
+}
+
+/**
+ * @brief Escape a Prometheus label value (also valid inside a JSON string)
+ */
+std::string escape_label(std::string_view value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (const auto c : value) {
+        if (c == '\\' || c == '"') {
+            escaped += '\\';
+            escaped += c;
+        } else if (c == '\n') {
+            escaped += "\\n";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+/**
+ * @brief Helper to write the header of a Prometheus histogram family
+ */
+void histogram_family_header(std::ostringstream& oss,
+                             std::string_view prefix,
+                             std::string_view name,
+                             std::string_view help) {
+    oss << "# HELP " << prefix << "_" << name << " " << help << "\n"
+        << "# TYPE " << prefix << "_" << name << " histogram\n";
+}
+
+/**
+ * @brief Helper to write one labelled Prometheus histogram series
+ * @param oss Output stream
+ * @param prefix Metric prefix
+ * @param name Family name without prefix
+ * @param labels Rendered labels without braces (e.g. operation="c_store")
+ * @param snapshot Histogram snapshot
+ */
+void histogram_to_prometheus(std::ostringstream& oss,
+                             std::string_view prefix,
+                             std::string_view name,
+                             const std::string& labels,
+                             const histogram_snapshot& snapshot) {
+    for (const auto& bucket : kPrometheusBuckets) {
+        oss << prefix << "_" << name << "_bucket{" << labels << R"(,le=")"
+            << bucket.le << R"("} )" << snapshot.count_at_or_below(bucket.bound_ns)
+            << "\n";
+    }
+    std::ostringstream sum;
+    sum << std::fixed << std::setprecision(9)
+        << static_cast<double>(snapshot.sum_ns) / 1e9;
+
+    oss << prefix << "_" << name << "_bucket{" << labels << R"(,le="+Inf"} )"
+        << snapshot.count << "\n"
+        << prefix << "_" << name << "_sum{" << labels << "} " << sum.str() << "\n"
+        << prefix << "_" << name << "_count{" << labels << "} " << snapshot.count
+        << "\n";
+}
+
 /**
  * @brief Helper to format a single operation counter as JSON object
  * @param counter The operation counter to format
@@ -44,6 +158,7 @@ std::string counter_to_json(const operation_counter& counter) {
             << R"(,"max_duration_us":)" << max_us;
     }
 
+    oss << R"(,"latency":)" << latency_to_json(counter.latency.snapshot());
     oss << "}";
     return oss.str();
 }
@@ -143,6 +258,50 @@ std::string pacs_metrics::to_json() const {
         << R"(,"peak_active":)" << associations_.peak_active.load(std::memory_order_relaxed)
         << "}";
 
+    // Transcoding section
+    oss << R"(,"transcoding":{)"
+        << R"("conversions":)" << counter_to_json(transcoding_.conversions)
+        << R"(,"frames_processed":)" << transcoding_.frames_processed.load(std::memory_order_relaxed)
+        << R"(,"cache_hits":)" << transcoding_.cache_hits.load(std::memory_order_relaxed)
+        << R"(,"cache_misses":)" << transcoding_.cache_misses.load(std::memory_order_relaxed)
+        << "}";
+
+    // Fixity section
+    oss << R"(,"fixity":{)"
+        << R"("files_verified":)" << fixity_.files_verified.load(std::memory_order_relaxed)
+        << R"(,"bytes_verified":)" << fixity_.bytes_verified.load(std::memory_order_relaxed)
+        << R"(,"mismatches":)" << fixity_.mismatches.load(std::memory_order_relaxed)
+        << R"(,"missing":)" << fixity_.missing.load(std::memory_order_relaxed)
+        << R"(,"unreadable":)" << fixity_.unreadable.load(std::memory_order_relaxed)
+        << R"(,"hashes_backfilled":)" << fixity_.hashes_backfilled.load(std::memory_order_relaxed)
+        << "}";
+
+    // Labelled latency sections
+    std::shared_lock lock(histograms_mutex_);
+    oss << R"(,"pipeline_stage_latency":{)";
+    bool first = true;
+    for (const auto& [stage, histogram] : stage_latency_) {
+        oss << (first ? "" : ",") << "\"" << stage << "\":"
+            << latency_to_json(histogram->snapshot());
+        first = false;
+    }
+    oss << "}";
+
+    oss << R"(,"calling_ae_latency":{)";
+    first = true;
+    for (const auto& [calling_ae, operations] : calling_ae_latency_) {
+        oss << (first ? "" : ",") << "\"" << escape_label(calling_ae) << "\":{";
+        bool first_op = true;
+        for (const auto& [op, histogram] : operations) {
+            oss << (first_op ? "" : ",") << "\"" << to_string(op) << "\":"
+                << latency_to_json(histogram->snapshot());
+            first_op = false;
+        }
+        oss << "}";
+        first = false;
+    }
+    oss << "}";
+
     oss << "}";
     return oss.str();
 }
@@ -163,6 +322,46 @@ std::string pacs_metrics::to_prometheus(std::string_view prefix) const {
     counter_to_prometheus(oss, prefix, "n_event", n_event_);
     counter_to_prometheus(oss, prefix, "n_delete", n_delete_);
 
+    // DIMSE latency histograms
+    histogram_family_header(oss, prefix, "dimse_duration_seconds",
+                            "Duration of DIMSE operations in seconds");
+    for (const auto op : {dimse_operation::c_echo, dimse_operation::c_store,
+                          dimse_operation::c_find, dimse_operation::c_move,
+                          dimse_operation::c_get, dimse_operation::n_create,
+                          dimse_operation::n_set, dimse_operation::n_get,
+                          dimse_operation::n_action, dimse_operation::n_event,
+                          dimse_operation::n_delete}) {
+        histogram_to_prometheus(oss, prefix, "dimse_duration_seconds",
+                                "operation=\"" + std::string(to_string(op)) + "\"",
+                                get_counter(op).latency.snapshot());
+    }
+
+    {
+        std::shared_lock lock(histograms_mutex_);
+        if (!stage_latency_.empty()) {
+            histogram_family_header(oss, prefix, "pipeline_stage_duration_seconds",
+                                    "Duration of I/O pipeline stage jobs in seconds");
+            for (const auto& [stage, histogram] : stage_latency_) {
+                histogram_to_prometheus(oss, prefix, "pipeline_stage_duration_seconds",
+                                        "stage=\"" + escape_label(stage) + "\"",
+                                        histogram->snapshot());
+            }
+        }
+        if (!calling_ae_latency_.empty()) {
+            histogram_family_header(oss, prefix, "calling_ae_duration_seconds",
+                                    "Duration of DIMSE operations by calling AE in seconds");
+            for (const auto& [calling_ae, operations] : calling_ae_latency_) {
+                for (const auto& [op, histogram] : operations) {
+                    histogram_to_prometheus(
+                        oss, prefix, "calling_ae_duration_seconds",
+                        "calling_ae=\"" + escape_label(calling_ae) +
+                            "\",operation=\"" + std::string(to_string(op)) + "\"",
+                        histogram->snapshot());
+                }
+            }
+        }
+    }
+
     // Data transfer metrics
     oss << "# HELP " << prefix << "_bytes_sent_total Total bytes sent over network\n"
         << "# TYPE " << prefix << "_bytes_sent_total counter\n"
@@ -201,6 +400,51 @@ std::string pacs_metrics::to_prometheus(std::string_view prefix) const {
         << "# TYPE " << prefix << "_associations_peak_active gauge\n"
         << prefix << "_associations_peak_active " << associations_.peak_active.load(std::memory_order_relaxed) << "\n";
 
+    // Transcoding metrics
+    const auto transcodes = transcoding_.conversions.total_count();
+    oss << "# HELP " << prefix << "_transcode_total Total transfer syntax conversions\n"
+        << "# TYPE " << prefix << "_transcode_total counter\n"
+        << prefix << "_transcode_total " << transcodes << "\n";
+
+    oss << "# HELP " << prefix << "_transcode_failure_total Failed transfer syntax conversions\n"
+        << "# TYPE " << prefix << "_transcode_failure_total counter\n"
+        << prefix << "_transcode_failure_total " << transcoding_.conversions.failure_count.load(std::memory_order_relaxed) << "\n";
+
+    oss << "# HELP " << prefix << "_transcode_duration_microseconds_sum Total time spent transcoding in microseconds\n"
+        << "# TYPE " << prefix << "_transcode_duration_microseconds_sum counter\n"
+        << prefix << "_transcode_duration_microseconds_sum " << transcoding_.conversions.total_duration_us.load(std::memory_order_relaxed) << "\n";
+
+    oss << "# HELP " << prefix << "_transcode_frames_total Total frames passed through a codec\n"
+        << "# TYPE " << prefix << "_transcode_frames_total counter\n"
+        << prefix << "_transcode_frames_total " << transcoding_.frames_processed.load(std::memory_order_relaxed) << "\n";
+
+    oss << "# HELP " << prefix << "_transcode_cache_hits_total Transcode cache hits\n"
+        << "# TYPE " << prefix << "_transcode_cache_hits_total counter\n"
+        << prefix << "_transcode_cache_hits_total " << transcoding_.cache_hits.load(std::memory_order_relaxed) << "\n";
+
+    oss << "# HELP " << prefix << "_transcode_cache_misses_total Transcode cache misses\n"
+        << "# TYPE " << prefix << "_transcode_cache_misses_total counter\n"
+        << prefix << "_transcode_cache_misses_total " << transcoding_.cache_misses.load(std::memory_order_relaxed) << "\n";
+
+    // Fixity metrics
+    oss << "# HELP " << prefix << "_fixity_files_verified_total Stored files re-read and matched against their hash\n"
+        << "# TYPE " << prefix << "_fixity_files_verified_total counter\n"
+        << prefix << "_fixity_files_verified_total " << fixity_.files_verified.load(std::memory_order_relaxed) << "\n";
+
+    oss << "# HELP " << prefix << "_fixity_bytes_verified_total Bytes re-read by fixity verification\n"
+        << "# TYPE " << prefix << "_fixity_bytes_verified_total counter\n"
+        << prefix << "_fixity_bytes_verified_total " << fixity_.bytes_verified.load(std::memory_order_relaxed) << "\n";
+
+    oss << "# HELP " << prefix << "_fixity_failures_total Fixity failures by kind\n"
+        << "# TYPE " << prefix << "_fixity_failures_total counter\n"
+        << prefix << "_fixity_failures_total{kind=\"mismatch\"} " << fixity_.mismatches.load(std::memory_order_relaxed) << "\n"
+        << prefix << "_fixity_failures_total{kind=\"missing\"} " << fixity_.missing.load(std::memory_order_relaxed) << "\n"
+        << prefix << "_fixity_failures_total{kind=\"unreadable\"} " << fixity_.unreadable.load(std::memory_order_relaxed) << "\n";
+
+    oss << "# HELP " << prefix << "_fixity_hashes_backfilled_total Hashes recorded for instances stored without one\n"
+        << "# TYPE " << prefix << "_fixity_hashes_backfilled_total counter\n"
+        << prefix << "_fixity_hashes_backfilled_total " << fixity_.hashes_backfilled.load(std::memory_order_relaxed) << "\n";
+
     return oss.str();
 }
 
@@ -0,0 +1,123 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file request_tracer.cpp
+ * @brief OTLP-JSON and Chrome trace export of recorded request spans
+ */
+
+#include "kcenon/pacs/monitoring/request_tracer.h"
+#include "kcenon/pacs/monitoring/health_json.h"
+
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+namespace kcenon::pacs::monitoring {
+
+namespace {
+
+/// OTLP span kinds
+constexpr int kSpanKindInternal = 1;
+constexpr int kSpanKindServer = 2;
+
+/// OTLP status code for failed spans
+constexpr int kStatusCodeError = 2;
+
+/// Format an id as fixed-width lowercase hex
+std::string to_hex(std::uint64_t value, int width = 16) {
+    std::ostringstream oss;
+    oss << std::hex << std::setfill('0') << std::setw(width) << value;
+    return oss.str();
+}
+
+/// OTLP trace ids are 16 bytes; ours fill the low 8
+std::string otlp_trace_id(std::uint64_t trace_id) {
+    return std::string(16, '0') + to_hex(trace_id);
+}
+
+void attributes_to_otlp(std::ostringstream& oss, const span_record& span) {
+    oss << R"("attributes":[)";
+    for (std::size_t i = 0; i < span.attributes.size(); ++i) {
+        const auto& [key, value] = span.attributes[i];
+        oss << (i == 0 ? "" : ",")
+            << R"({"key":")" << escape_json_string(key)
+            << R"(","value":{"stringValue":")" << escape_json_string(value) << R"("}})";
+    }
+    oss << "]";
+}
+
+}  // namespace
+
+std::string request_tracer::to_otlp_json(const std::vector<span_record>& spans,
+                                         std::string_view service_name) const {
+    std::ostringstream oss;
+    oss << R"({"resourceSpans":[{"resource":{"attributes":[)"
+        << R"({"key":"service.name","value":{"stringValue":")"
+        << escape_json_string(service_name) << R"("}}]},)"
+        << R"("scopeSpans":[{"scope":{"name":"kcenon.pacs"},"spans":[)";
+
+    for (std::size_t i = 0; i < spans.size(); ++i) {
+        const auto& span = spans[i];
+        oss << (i == 0 ? "" : ",") << "{"
+            << R"("traceId":")" << otlp_trace_id(span.trace_id) << R"(",)"
+            << R"("spanId":")" << to_hex(span.span_id) << R"(",)";
+        if (span.parent_span_id != 0) {
+            oss << R"("parentSpanId":")" << to_hex(span.parent_span_id) << R"(",)";
+        }
+        oss << R"("name":")" << escape_json_string(span.name) << R"(",)"
+            << R"("kind":)"
+            << (span.parent_span_id == 0 ? kSpanKindServer : kSpanKindInternal) << ","
+            << R"("startTimeUnixNano":")" << to_unix_ns(span.start_ns) << R"(",)"
+            << R"("endTimeUnixNano":")" << to_unix_ns(span.end_ns) << R"(",)";
+        attributes_to_otlp(oss, span);
+        if (span.error) {
+            oss << R"(,"status":{"code":)" << kStatusCodeError << "}";
+        }
+        oss << "}";
+    }
+
+    oss << "]}]}]}";
+    return oss.str();
+}
+
+std::string request_tracer::to_chrome_trace(const std::vector<span_record>& spans) const {
+    // Small, stable thread numbers keep the viewer's rows readable
+    std::map<std::uint64_t, std::size_t> thread_numbers;
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(3);
+    oss << R"({"displayTimeUnit":"ms","traceEvents":[)";
+
+    for (std::size_t i = 0; i < spans.size(); ++i) {
+        const auto& span = spans[i];
+        const auto tid =
+            thread_numbers.try_emplace(span.thread_id, thread_numbers.size() + 1).first->second;
+
+        oss << (i == 0 ? "" : ",") << "{"
+            << R"("name":")" << escape_json_string(span.name) << R"(",)"
+            << R"("cat":"pacs","ph":"X",)"
+            << R"("ts":)" << static_cast<double>(to_unix_ns(span.start_ns)) / 1000.0 << ","
+            << R"("dur":)" << static_cast<double>(span.duration_ns()) / 1000.0 << ","
+            << R"("pid":1,"tid":)" << tid << ","
+            << R"("args":{"trace_id":")" << to_hex(span.trace_id) << R"(",)"
+            << R"("span_id":")" << to_hex(span.span_id) << R"(")";
+        if (span.parent_span_id != 0) {
+            oss << R"(,"parent_span_id":")" << to_hex(span.parent_span_id) << R"(")";
+        }
+        if (span.error) {
+            oss << R"(,"error":true)";
+        }
+        for (const auto& [key, value] : span.attributes) {
+            oss << R"(,")" << escape_json_string(key) << R"(":")"
+                << escape_json_string(value) << R"(")";
+        }
+        oss << "}}";
+    }
+
+    oss << "]}";
+    return oss.str();
+}
+
+}  // namespace kcenon::pacs::monitoring
@@ -9,11 +9,14 @@
 
 #include "kcenon/pacs/network/association.h"
 #include "kcenon/pacs/network/pdu_encoder.h"
+#include "kcenon/pacs/network/p_data_fragmenter.h"
 #include "kcenon/pacs/network/dicom_server.h"
+#include "kcenon/pacs/monitoring/request_tracer.h"
 
 #include <algorithm>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
 namespace kcenon::pacs::network {
 
@@ -100,7 +103,9 @@ void rejection_info::build_description() {
 
 association::association() = default;
 
-association::association(association&& other) noexcept {
+association::association(association&& other) noexcept
+    : link_(std::exchange(other.link_, std::make_shared<deferred_link>())) {
+    attach_link();
     std::lock_guard<std::mutex> lock(other.mutex_);
     state_ = other.state_;
     calling_ae_ = std::move(other.calling_ae_);
@@ -120,6 +125,7 @@ association::association(association&& other) noexcept {
     abort_reason_ = other.abort_reason_;
     is_scu_ = other.is_scu_;
     peer_ = other.peer_;
+    p_data_transport_ = std::move(other.p_data_transport_);
     incoming_queue_ = std::move(other.incoming_queue_);
     other.incoming_queue_ = std::make_unique<message_queue_type>();
 
@@ -133,6 +139,13 @@ association::association(association&& other) noexcept {
 
 association& association::operator=(association&& other) noexcept {
     if (this != &other) {
+        {
+            std::lock_guard<std::mutex> link_lock(link_->mutex);
+            link_->target = nullptr;
+        }
+        link_ = std::exchange(other.link_, std::make_shared<deferred_link>());
+        attach_link();
+
         std::scoped_lock lock(mutex_, other.mutex_);
         state_ = other.state_;
         calling_ae_ = std::move(other.calling_ae_);
@@ -152,6 +165,7 @@ association& association::operator=(association&& other) noexcept {
         abort_reason_ = other.abort_reason_;
         is_scu_ = other.is_scu_;
         peer_ = other.peer_;
+        p_data_transport_ = std::move(other.p_data_transport_);
         incoming_queue_ = std::move(other.incoming_queue_);
         other.incoming_queue_ = std::make_unique<message_queue_type>();
 
@@ -166,6 +180,11 @@ association& association::operator=(association&& other) noexcept {
 }
 
 association::~association() {
+    {
+        // Waits for a deferred send in progress
+        std::lock_guard<std::mutex> link_lock(link_->mutex);
+        link_->target = nullptr;
+    }
     std::lock_guard<std::mutex> lock(mutex_);
     if (state_ == association_state::established) {
         // Abort silently on destruction
@@ -370,6 +389,9 @@ Result<std::monostate> association::send_dimse(
     uint8_t context_id,
     const dimse::dimse_message& msg) {
 
+    monitoring::trace_span send("dimse_send");
+    send.set_attribute("command", dimse::to_string(msg.command()));
+
     std::lock_guard<std::mutex> lock(mutex_);
 
     if (state_ != association_state::established) {
@@ -388,8 +410,16 @@ Result<std::monostate> association::send_dimse(
         return error_info{kcenon::pacs::error_codes::dimse_error, "Invalid DIMSE message", "network"};
     }
 
-    // Placeholder for actual send implementation
-    (void)msg;
+    if (p_data_transport_) {
+        auto encoded = dimse::dimse_message::encode(
+            msg, context_to_transfer_syntax_.at(context_id));
+        if (encoded.is_err()) {
+            return encoded.error();
+        }
+        const auto& [command_bytes, dataset_bytes] = encoded.value();
+        return send_p_data(context_id, command_bytes, dataset_bytes,
+                           msg.has_dataset());
+    }
 
     if (peer_) {
         peer_->enqueue_message(context_id, msg);
@@ -399,6 +429,92 @@ Result<std::monostate> association::send_dimse(
     return std::monostate{};
 }
 
+Result<std::monostate> association::send_dimse_encoded(
+    uint8_t context_id,
+    const dimse::dimse_message& command,
+    std::span<const uint8_t> dataset) {
+
+    monitoring::trace_span send("dimse_send");
+    send.set_attribute("command", dimse::to_string(command.command()));
+    send.set_attribute("encoded_dataset_bytes", std::to_string(dataset.size()));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (state_ != association_state::established) {
+        return error_info{invalid_association_state, "Cannot send DIMSE: association not established", "network"};
+    }
+
+    const auto ts = context_to_transfer_syntax_.find(context_id);
+    if (ts == context_to_transfer_syntax_.end()) {
+        return error_info{kcenon::pacs::error_codes::dimse_error, "Invalid presentation context ID", "network"};
+    }
+
+    if (!command.is_valid() || command.has_dataset()) {
+        return error_info{kcenon::pacs::error_codes::dimse_error, "Invalid DIMSE message", "network"};
+    }
+
+    // The command set announces the data set that follows it
+    dimse::dimse_message header = command;
+    header.command_set().set_numeric<uint16_t>(
+        dimse::tag_command_data_set_type, encoding::vr_type::US,
+        dimse::command_data_set_type_present);
+    auto encoded = dimse::dimse_message::encode(header, ts->second);
+    if (encoded.is_err()) {
+        return encoded.error();
+    }
+    const auto& command_bytes = encoded.value().first;
+
+    if (p_data_transport_) {
+        return send_p_data(context_id, command_bytes, dataset, true);
+    }
+
+    if (peer_) {
+        // The in-memory peer receives what a remote decoder would produce
+        auto decoded = dimse::dimse_message::decode(command_bytes, dataset, ts->second);
+        if (decoded.is_err()) {
+            return decoded.error();
+        }
+        peer_->enqueue_message(context_id, std::move(decoded.value()));
+    }
+
+    return std::monostate{};
+}
+
+void association::set_p_data_transport(p_data_transport transport) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    p_data_transport_ = std::move(transport);
+}
+
+Result<std::monostate> association::send_p_data(
+    uint8_t context_id,
+    std::span<const uint8_t> command,
+    std::span<const uint8_t> dataset,
+    bool has_dataset) {
+    p_data_fragmenter pdus(context_id, max_pdu_size_);
+    pdus.add_command(command);
+    if (has_dataset) {
+        pdus.add_dataset(dataset);
+    }
+    return p_data_transport_(pdus);
+}
+
+association::deferred_sender association::make_deferred_sender() {
+    attach_link();
+    return [link = link_](uint8_t context_id,
+                          const dimse::dimse_message& msg) -> Result<std::monostate> {
+        std::lock_guard<std::mutex> lock(link->mutex);
+        if (link->target == nullptr) {
+            return error_info{invalid_association_state, "Cannot send DIMSE: association no longer exists", "network"};
+        }
+        return link->target->send_dimse(context_id, msg);
+    };
+}
+
+void association::attach_link() {
+    std::lock_guard<std::mutex> lock(link_->mutex);
+    link_->target = this;
+}
+
 Result<std::pair<uint8_t, dimse::dimse_message>> association::receive_dimse(
     duration timeout) {
 
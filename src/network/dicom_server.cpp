@@ -12,6 +12,7 @@
 #include "kcenon/pacs/network/pdu_decoder.h"
 #include "kcenon/pacs/integration/thread_pool_adapter.h"
 #include "kcenon/pacs/core/events.h"
+#include "kcenon/pacs/monitoring/request_tracer.h"
 
 #include <kcenon/common/patterns/event_bus.h>
 
@@ -393,11 +394,16 @@ void dicom_server::message_loop(association_info& info) {
 
         // Dispatch message to service
         auto& [context_id, msg] = result.value();
+        auto request = monitoring::trace_span::start_request("dimse_request");
+        request.set_attribute("calling_ae", info.assoc.calling_ae());
+        request.set_attribute("command", dimse::to_string(msg.command()));
         auto dispatch_result = dispatch_to_service(info.assoc, context_id, msg);
 
         if (dispatch_result.is_err()) {
+            request.set_error();
             report_error(dispatch_result.error().message);
         }
+        request.finish();
 
         // Update statistics
         {
@@ -472,7 +478,13 @@ Result<std::monostate> dicom_server::dispatch_to_service(
     }
 
     // Dispatch to service
-    return service->handle_message(assoc, context_id, msg);
+    monitoring::trace_span handler("service_handler");
+    handler.set_attribute("sop_class", sop_class_uid);
+    auto result = service->handle_message(assoc, context_id, msg);
+    if (result.is_err()) {
+        handler.set_error();
+    }
+    return result;
 }
 
 bool dicom_server::validate_calling_ae(const std::string& calling_ae) const {
@@ -9,6 +9,7 @@
 
 #include <kcenon/pacs/network/dimse/dimse_message.h>
 
+#include <kcenon/pacs/encoding/dataset_encoder.h>
 #include <kcenon/pacs/encoding/implicit_vr_codec.h>
 #include <kcenon/pacs/encoding/explicit_vr_codec.h>
 #include <kcenon/pacs/encoding/vr_type.h>
@@ -266,25 +267,31 @@ void dimse_message::set_warning_subops(uint16_t count) {
 auto dimse_message::encode(const dimse_message& msg,
                            const encoding::transfer_syntax& dataset_ts)
     -> dimse_result<encoded_message> {
-    // Create a mutable copy for encoding
-    dimse_message copy = msg;
-    copy.update_command_group_length();
-
-    // Command set is always Implicit VR Little Endian
-    auto command_bytes = encoding::implicit_vr_codec::encode(copy.command_set_);
+    // Command set is always Implicit VR Little Endian. Only the (small)
+    // command set is copied to fill in CommandGroupLength; the dataset is
+    // encoded in place.
+    const encoding::dataset_encoder command_encoder(
+        encoding::transfer_syntax::implicit_vr_little_endian);
+    core::dicom_dataset command_set = msg.command_set_;
+    command_set.remove(tag_command_group_length);
+    command_set.set_numeric(
+        tag_command_group_length, encoding::vr_type::UL,
+        static_cast<uint32_t>(command_encoder.encoded_size(command_set)));
+    auto command_bytes = command_encoder.encode(command_set);
 
     // Encode dataset if present
     std::vector<uint8_t> dataset_bytes;
-    if (copy.has_dataset()) {
-        auto ds_result = copy.dataset();
+    if (msg.has_dataset()) {
+        auto ds_result = msg.dataset();
         if (ds_result.is_err()) {
             return ds_result.error();
         }
-        if (dataset_ts.vr_type() == encoding::vr_encoding::implicit) {
-            dataset_bytes = encoding::implicit_vr_codec::encode(ds_result.value().get());
-        } else {
-            dataset_bytes = encoding::explicit_vr_codec::encode(ds_result.value().get());
-        }
+        // Non-implicit syntaxes use Explicit VR Little Endian, matching decode()
+        const encoding::dataset_encoder dataset_encoder(
+            dataset_ts.vr_type() == encoding::vr_encoding::implicit
+                ? encoding::transfer_syntax::implicit_vr_little_endian
+                : encoding::transfer_syntax::explicit_vr_little_endian);
+        dataset_bytes = dataset_encoder.encode(ds_result.value().get());
     }
 
     return encoded_message{std::move(command_bytes), std::move(dataset_bytes)};
@@ -371,9 +378,10 @@ void dimse_message::update_command_group_length() {
     // First, remove CommandGroupLength to calculate without it
     command_set_.remove(tag_command_group_length);
 
-    // Encode command set to get the size
-    auto encoded = encoding::implicit_vr_codec::encode(command_set_);
-    auto length = static_cast<uint32_t>(encoded.size());
+    // Measure the command set without encoding it
+    const auto length = static_cast<uint32_t>(
+        encoding::dataset_encoder(encoding::transfer_syntax::implicit_vr_little_endian)
+            .encoded_size(command_set_));
 
     // Set CommandGroupLength
     command_set_.set_numeric(tag_command_group_length, encoding::vr_type::UL, length);
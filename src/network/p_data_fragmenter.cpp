@@ -0,0 +1,257 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file p_data_fragmenter.cpp
+ * @brief Implementation of zero-copy P-DATA-TF fragmentation
+ */
+
+#include "kcenon/pacs/network/p_data_fragmenter.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+#include <string>
+#include <system_error>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <winsock2.h>
+#else
+    #include <climits>
+    #include <sys/socket.h>
+    #include <sys/uio.h>
+#endif
+
+namespace kcenon::pacs::network {
+
+namespace {
+
+/// PDV length + context ID + control header, counted in the PDU length
+constexpr std::size_t kPdvOverhead = 6;
+
+/// PDU length is a 32-bit field
+constexpr std::size_t kMaxPduLength = std::numeric_limits<uint32_t>::max();
+
+void put_uint32_be(uint8_t* p, uint32_t value) noexcept {
+    p[0] = static_cast<uint8_t>(value >> 24);
+    p[1] = static_cast<uint8_t>(value >> 16);
+    p[2] = static_cast<uint8_t>(value >> 8);
+    p[3] = static_cast<uint8_t>(value);
+}
+
+#ifdef _WIN32
+using io_buffer = WSABUF;
+constexpr std::size_t kMaxIoBuffers = 1024;
+
+io_buffer make_buffer(const uint8_t* data, std::size_t size) noexcept {
+    io_buffer buffer;
+    buffer.buf = const_cast<char*>(reinterpret_cast<const char*>(data));
+    buffer.len = static_cast<ULONG>(size);
+    return buffer;
+}
+
+auto buffer_size(const io_buffer& buffer) noexcept -> std::size_t {
+    return buffer.len;
+}
+
+void advance_buffer(io_buffer& buffer, std::size_t n) noexcept {
+    buffer.buf += n;
+    buffer.len -= static_cast<ULONG>(n);
+}
+#else
+using io_buffer = iovec;
+#ifdef IOV_MAX
+constexpr std::size_t kMaxIoBuffers = IOV_MAX;
+#else
+constexpr std::size_t kMaxIoBuffers = 1024;
+#endif
+
+io_buffer make_buffer(const uint8_t* data, std::size_t size) noexcept {
+    return io_buffer{const_cast<uint8_t*>(data), size};
+}
+
+auto buffer_size(const io_buffer& buffer) noexcept -> std::size_t {
+    return buffer.iov_len;
+}
+
+void advance_buffer(io_buffer& buffer, std::size_t n) noexcept {
+    buffer.iov_base = static_cast<uint8_t*>(buffer.iov_base) + n;
+    buffer.iov_len -= n;
+}
+#endif
+
+/**
+ * @brief Send one batch of buffers
+ * @return Bytes written, or -1 with the error in @p error
+ */
+auto send_batch(native_socket socket, io_buffer* buffers, std::size_t count,
+                int& error) -> long long {
+#ifdef _WIN32
+    DWORD sent = 0;
+    if (::WSASend(static_cast<SOCKET>(socket), buffers,
+                  static_cast<DWORD>(count), &sent, 0, nullptr,
+                  nullptr) == SOCKET_ERROR) {
+        error = ::WSAGetLastError();
+        return -1;
+    }
+    return static_cast<long long>(sent);
+#else
+    msghdr message{};
+    message.msg_iov = buffers;
+    message.msg_iovlen = count;
+#ifdef MSG_NOSIGNAL
+    constexpr int flags = MSG_NOSIGNAL;
+#else
+    constexpr int flags = 0;
+#endif
+    const auto sent = ::sendmsg(socket, &message, flags);
+    if (sent < 0) {
+        error = errno;
+    }
+    return static_cast<long long>(sent);
+#endif
+}
+
+auto is_interrupted(int error) noexcept -> bool {
+#ifdef _WIN32
+    return error == WSAEINTR;
+#else
+    return error == EINTR;
+#endif
+}
+
+}  // namespace
+
+// ============================================================================
+// p_data_fragment
+// ============================================================================
+
+void p_data_fragment::append_to(std::vector<uint8_t>& out) const {
+    out.insert(out.end(), header.begin(), header.end());
+    out.insert(out.end(), payload.begin(), payload.end());
+}
+
+// ============================================================================
+// p_data_fragmenter
+// ============================================================================
+
+p_data_fragmenter::p_data_fragmenter(uint8_t context_id,
+                                     uint32_t max_pdu_length) noexcept
+    : context_id_(context_id),
+      max_payload_(max_pdu_length == 0
+                       ? kMaxPduLength - kPdvOverhead
+                       : std::max<std::size_t>(max_pdu_length, kPdvOverhead + 1) -
+                             kPdvOverhead) {}
+
+void p_data_fragmenter::add_command(std::span<const uint8_t> command) {
+    add(command, true);
+}
+
+void p_data_fragmenter::add_dataset(std::span<const uint8_t> dataset) {
+    add(dataset, false);
+}
+
+void p_data_fragmenter::add(std::span<const uint8_t> data, bool is_command) {
+    std::size_t offset = 0;
+    do {
+        const auto length = std::min(max_payload_, data.size() - offset);
+        const bool last = offset + length == data.size();
+
+        p_data_fragment fragment;
+        fragment.payload = data.subspan(offset, length);
+
+        // PDU header: type, reserved, PDU length
+        auto* h = fragment.header.data();
+        h[0] = static_cast<uint8_t>(pdu_type::p_data_tf);
+        h[1] = 0x00;
+        put_uint32_be(h + 2, static_cast<uint32_t>(kPdvOverhead + length));
+
+        // PDV header: item length, context ID, message control header
+        put_uint32_be(h + 6, static_cast<uint32_t>(2 + length));
+        h[10] = context_id_;
+        h[11] = static_cast<uint8_t>((is_command ? 0x01 : 0x00) |
+                                     (last ? 0x02 : 0x00));
+
+        total_size_ += fragment.size();
+        fragments_.push_back(fragment);
+        offset += length;
+    } while (offset < data.size());
+}
+
+auto p_data_fragmenter::to_bytes() const -> std::vector<uint8_t> {
+    std::vector<uint8_t> out;
+    out.reserve(total_size_);
+    for (const auto& fragment : fragments_) {
+        fragment.append_to(out);
+    }
+    return out;
+}
+
+void p_data_fragmenter::clear() noexcept {
+    fragments_.clear();
+    total_size_ = 0;
+}
+
+// ============================================================================
+// Gather I/O
+// ============================================================================
+
+auto write_gather(native_socket socket,
+                  std::span<const p_data_fragment> fragments)
+    -> Result<std::size_t> {
+    std::vector<io_buffer> buffers;
+    buffers.reserve(std::min(fragments.size() * 2, kMaxIoBuffers));
+
+    std::size_t total = 0;
+    std::size_t next = 0;  // next fragment to queue
+    std::size_t first = 0; // first unsent buffer
+
+    while (true) {
+        // Refill the batch once everything queued has been sent
+        if (first == buffers.size()) {
+            buffers.clear();
+            first = 0;
+            while (next < fragments.size() && buffers.size() + 2 <= kMaxIoBuffers) {
+                const auto& fragment = fragments[next++];
+                buffers.push_back(make_buffer(fragment.header.data(),
+                                              fragment.header.size()));
+                if (!fragment.payload.empty()) {
+                    buffers.push_back(make_buffer(fragment.payload.data(),
+                                                  fragment.payload.size()));
+                }
+            }
+            if (buffers.empty()) {
+                return total;
+            }
+        }
+
+        int error = 0;
+        const auto sent = send_batch(socket, buffers.data() + first,
+                                     buffers.size() - first, error);
+        if (sent < 0) {
+            if (is_interrupted(error)) {
+                continue;
+            }
+            return pacs_error<std::size_t>(
+                error_codes::send_failed,
+                "P-DATA-TF send failed: " + std::system_category().message(error));
+        }
+        total += static_cast<std::size_t>(sent);
+
+        // Skip fully written buffers, trim a partially written one
+        auto remaining = static_cast<std::size_t>(sent);
+        while (first < buffers.size() && remaining >= buffer_size(buffers[first])) {
+            remaining -= buffer_size(buffers[first]);
+            ++first;
+        }
+        if (remaining > 0) {
+            advance_buffer(buffers[first], remaining);
+        }
+    }
+}
+
+}  // namespace kcenon::pacs::network
@@ -12,6 +12,7 @@
 
 #include <kcenon/pacs/network/pipeline/jobs/response_encode_job.h>
 #include <kcenon/pacs/network/pipeline/jobs/send_network_io_job.h>
+#include <kcenon/pacs/network/p_data_fragmenter.h>
 
 #include <chrono>
 
@@ -110,106 +111,30 @@ auto response_encode_job::encode_response()
         return Result<std::vector<encoded_response>>(command_result.error());
     }
 
-    auto command_data = command_result.value();
+    const auto& command_data = command_result.value();
 
-    // Fragment the command data if needed
-    auto command_fragments = fragment_data(command_data);
+    // PDV headers are built separately; payloads stay views into the
+    // encoded command and data set until each PDU is assembled
+    p_data_fragmenter fragmenter(result_.presentation_context_id, max_pdu_size_);
+    fragmenter.add_command(command_data);
+    if (!result_.data_set.empty()) {
+        fragmenter.add_dataset(result_.data_set);
+    }
 
-    // Create P-DATA-TF PDUs for command
-    for (size_t i = 0; i < command_fragments.size(); ++i) {
+    const auto& fragments = fragmenter.fragments();
+    responses.reserve(fragments.size());
+    for (size_t i = 0; i < fragments.size(); ++i) {
         encoded_response response;
         response.session_id = result_.session_id;
         response.message_id = result_.message_id;
-        response.is_final = (i == command_fragments.size() - 1) && result_.data_set.empty();
-
-        // Build P-DATA-TF PDU
-        // PDU: Type (1) + Reserved (1) + Length (4) + PDV Items
-        // PDV: Length (4) + Presentation Context ID (1) + Control Header (1) + Data
-
-        const auto& frag = command_fragments[i];
-        size_t pdv_length = 2 + frag.size();  // Context ID + Control + Data
-        size_t pdu_length = 4 + pdv_length;    // PDV Length + PDV
-
-        response.pdu_data.resize(6 + pdu_length);
-
-        // PDU header
-        response.pdu_data[0] = 0x04;  // P-DATA-TF
-        response.pdu_data[1] = 0x00;  // Reserved
-
-        // PDU length (big-endian)
-        response.pdu_data[2] = static_cast<uint8_t>((pdu_length >> 24) & 0xFF);
-        response.pdu_data[3] = static_cast<uint8_t>((pdu_length >> 16) & 0xFF);
-        response.pdu_data[4] = static_cast<uint8_t>((pdu_length >> 8) & 0xFF);
-        response.pdu_data[5] = static_cast<uint8_t>(pdu_length & 0xFF);
-
-        // PDV length (big-endian)
-        size_t offset = 6;
-        response.pdu_data[offset++] = static_cast<uint8_t>((pdv_length >> 24) & 0xFF);
-        response.pdu_data[offset++] = static_cast<uint8_t>((pdv_length >> 16) & 0xFF);
-        response.pdu_data[offset++] = static_cast<uint8_t>((pdv_length >> 8) & 0xFF);
-        response.pdu_data[offset++] = static_cast<uint8_t>(pdv_length & 0xFF);
-
-        // Presentation context ID
-        response.pdu_data[offset++] = result_.presentation_context_id;
-
-        // Control header: command (bit 0) + last fragment (bit 1)
-        uint8_t control = 0x01;  // Command fragment
-        if (i == command_fragments.size() - 1) {
-            control |= 0x02;  // Last command fragment
-        }
-        response.pdu_data[offset++] = control;
+        response.is_final = (i == fragments.size() - 1);
 
-        // Copy fragment data
-        std::copy(frag.begin(), frag.end(), response.pdu_data.begin() + offset);
+        response.pdu_data.reserve(fragments[i].size());
+        fragments[i].append_to(response.pdu_data);
 
         responses.push_back(std::move(response));
     }
 
-    // Encode data set if present
-    if (!result_.data_set.empty()) {
-        auto data_fragments = fragment_data(result_.data_set);
-
-        for (size_t i = 0; i < data_fragments.size(); ++i) {
-            encoded_response response;
-            response.session_id = result_.session_id;
-            response.message_id = result_.message_id;
-            response.is_final = (i == data_fragments.size() - 1);
-
-            const auto& frag = data_fragments[i];
-            size_t pdv_length = 2 + frag.size();
-            size_t pdu_length = 4 + pdv_length;
-
-            response.pdu_data.resize(6 + pdu_length);
-
-            // PDU header
-            response.pdu_data[0] = 0x04;
-            response.pdu_data[1] = 0x00;
-
-            response.pdu_data[2] = static_cast<uint8_t>((pdu_length >> 24) & 0xFF);
-            response.pdu_data[3] = static_cast<uint8_t>((pdu_length >> 16) & 0xFF);
-            response.pdu_data[4] = static_cast<uint8_t>((pdu_length >> 8) & 0xFF);
-            response.pdu_data[5] = static_cast<uint8_t>(pdu_length & 0xFF);
-
-            size_t offset = 6;
-            response.pdu_data[offset++] = static_cast<uint8_t>((pdv_length >> 24) & 0xFF);
-            response.pdu_data[offset++] = static_cast<uint8_t>((pdv_length >> 16) & 0xFF);
-            response.pdu_data[offset++] = static_cast<uint8_t>((pdv_length >> 8) & 0xFF);
-            response.pdu_data[offset++] = static_cast<uint8_t>(pdv_length & 0xFF);
-
-            response.pdu_data[offset++] = result_.presentation_context_id;
-
-            uint8_t control = 0x00;  // Data fragment
-            if (i == data_fragments.size() - 1) {
-                control |= 0x02;  // Last data fragment
-            }
-            response.pdu_data[offset++] = control;
-
-            std::copy(frag.begin(), frag.end(), response.pdu_data.begin() + offset);
-
-            responses.push_back(std::move(response));
-        }
-    }
-
     return ok(std::move(responses));
 }
 
@@ -308,30 +233,4 @@ auto response_encode_job::encode_dimse_command()
     return ok(std::move(command));
 }
 
-auto response_encode_job::fragment_data(const std::vector<uint8_t>& data)
-    -> std::vector<std::vector<uint8_t>> {
-
-    std::vector<std::vector<uint8_t>> fragments;
-
-    // Max fragment size = max_pdu_size - PDU header (6) - PDV header (6)
-    size_t max_fragment_size = max_pdu_size_ - 12;
-    if (max_fragment_size > 16376) {
-        max_fragment_size = 16376;  // Reasonable default
-    }
-
-    size_t offset = 0;
-    while (offset < data.size()) {
-        size_t fragment_size = std::min(max_fragment_size, data.size() - offset);
-        fragments.emplace_back(data.begin() + offset,
-                               data.begin() + offset + fragment_size);
-        offset += fragment_size;
-    }
-
-    if (fragments.empty()) {
-        fragments.emplace_back();  // Empty fragment for empty data
-    }
-
-    return fragments;
-}
-
 }  // namespace kcenon::pacs::network::pipeline
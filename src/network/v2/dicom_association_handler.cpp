@@ -8,9 +8,15 @@
  */
 
 #include "kcenon/pacs/network/v2/dicom_association_handler.h"
+#include "kcenon/pacs/network/p_data_fragmenter.h"
 #include "kcenon/pacs/network/pdu_encoder.h"
 #include "kcenon/pacs/network/pdu_decoder.h"
+#include "kcenon/pacs/monitoring/pacs_metrics.h"
+#include "kcenon/pacs/monitoring/request_tracer.h"
 
+#include <chrono>
+#include <functional>
+#include <optional>
 #include <span>
 #include <sstream>
 #include <stdexcept>
@@ -236,6 +242,9 @@ void dicom_association_handler::on_data_received(const std::vector<uint8_t>& dat
 
     {
         std::lock_guard<std::mutex> lock(mutex_);
+        if (receive_buffer_.empty()) {
+            pdu_first_byte_ns_ = monitoring::request_tracer::now_ns();
+        }
         // Append to receive buffer
         receive_buffer_.insert(receive_buffer_.end(), data.begin(), data.end());
         touch();
@@ -288,6 +297,11 @@ void dicom_association_handler::process_buffer() {
             receive_buffer_.begin(),
             receive_buffer_.begin() + static_cast<std::ptrdiff_t>(pdu_total_length));
 
+        // Remaining bytes belong to the next PDU, which started arriving by now
+        const auto received_ns = monitoring::request_tracer::now_ns();
+        pdu_receive_ns_ = {pdu_first_byte_ns_, received_ns};
+        pdu_first_byte_ns_ = received_ns;
+
         // Parse PDU type
         auto type_opt = pdu_decoder::peek_pdu_type(pdu_data);
         if (!type_opt) {
@@ -467,6 +481,19 @@ void dicom_association_handler::handle_associate_rq(const std::vector<uint8_t>&
         return;
     }
 
+    // DIMSE messages sent by services leave as one P-DATA-TF PDU per
+    // fragment, so a send never buffers more than the peer's Maximum Length
+    association_.set_p_data_transport(
+        [this](const p_data_fragmenter& pdus) -> Result<std::monostate> {
+            for (const auto& fragment : pdus.fragments()) {
+                std::vector<uint8_t> pdu;
+                pdu.reserve(fragment.size());
+                fragment.append_to(pdu);
+                send_p_data_tf(std::move(pdu));
+            }
+            return std::monostate{};
+        });
+
     // Send A-ASSOCIATE-AC
     send_associate_ac();
 
@@ -538,6 +565,16 @@ void dicom_association_handler::handle_p_data_tf(const std::vector<uint8_t>& pay
         // Full DIMSE message handling with dataset fragmentation would require
         // accumulating PDVs until is_last is true for both command and data.
         if (pdv.is_last && pdv.is_command) {
+            // Sampled requests are traced from the first byte of their PDU
+            auto request = monitoring::trace_span::start_request(
+                "dimse_request", pdu_receive_ns_.first);
+            request.set_attribute("calling_ae", association_.calling_ae());
+            if (pdu_receive_ns_.first != 0) {
+                request.add_child("pdu_receive", pdu_receive_ns_.first,
+                                  pdu_receive_ns_.second);
+            }
+            monitoring::trace_span decode("dimse_decode");
+
             // For command-only messages (like C-ECHO), dataset is empty
             std::vector<uint8_t> empty_dataset;
 
@@ -556,18 +593,20 @@ void dicom_association_handler::handle_p_data_tf(const std::vector<uint8_t>& pay
                 ts_result.value());
 
             if (dimse_result.is_err()) {
+                decode.set_error();
+                request.set_error();
                 report_error("Failed to decode DIMSE message: " +
                              dimse_result.error().message);
                 continue;
             }
+            decode.finish();
 
             messages_processed_.fetch_add(1, std::memory_order_relaxed);
+            request.set_attribute("command", dimse::to_string(dimse_result.value().command()));
 
-            // Dispatch to service
-            auto dispatch_result = dispatch_to_service(pdv.context_id, dimse_result.value());
-            if (dispatch_result.is_err()) {
-                report_error("Service dispatch failed: " + dispatch_result.error().message);
-            }
+            // Dispatch to service (inline or on the pipeline)
+            execute_message(pdv.context_id, std::move(dimse_result.value()),
+                            std::move(request));
         }
     }
 }
@@ -575,6 +614,18 @@ void dicom_association_handler::handle_p_data_tf(const std::vector<uint8_t>& pay
 void dicom_association_handler::handle_release_rq() {
     transition_to(handler_state::releasing);
 
+    if (has_pending_dispatch()) {
+        // Answer the release only after the responses to earlier messages
+        schedule_ordered(pipeline::job_category::association, 0,
+                         [self = shared_from_this()]() {
+                             self->association_.process_release_rq();
+                             self->send_release_rp();
+                             self->close_handler(true);
+                             return true;
+                         });
+        return;
+    }
+
     // Process release on the association
     association_.process_release_rq();
 
@@ -609,40 +660,36 @@ void dicom_association_handler::handle_abort(const std::vector<uint8_t>& payload
 void dicom_association_handler::send_associate_ac() {
     associate_ac ac = association_.build_associate_ac();
     auto encoded = pdu_encoder::encode_associate_ac(ac);
-    send_pdu(pdu_type::associate_ac, encoded);
+    send_pdu(pdu_type::associate_ac, std::move(encoded));
 }
 
 void dicom_association_handler::send_associate_rj(
     reject_result result, uint8_t source, uint8_t reason) {
     associate_rj rj(result, source, reason);
     auto encoded = pdu_encoder::encode_associate_rj(rj);
-    send_pdu(pdu_type::associate_rj, encoded);
+    send_pdu(pdu_type::associate_rj, std::move(encoded));
 }
 
-void dicom_association_handler::send_p_data_tf(const std::vector<uint8_t>& payload) {
-    // Payload should already be a complete P-DATA-TF PDU
-    send_pdu(pdu_type::p_data_tf, payload);
+void dicom_association_handler::send_p_data_tf(std::vector<uint8_t> pdu) {
+    send_pdu(pdu_type::p_data_tf, std::move(pdu));
 }
 
 void dicom_association_handler::send_release_rp() {
     auto encoded = pdu_encoder::encode_release_rp();
-    send_pdu(pdu_type::release_rp, encoded);
+    send_pdu(pdu_type::release_rp, std::move(encoded));
 }
 
 void dicom_association_handler::send_abort(abort_source source, abort_reason reason) {
     auto encoded = pdu_encoder::encode_abort(source, reason);
-    send_pdu(pdu_type::abort, encoded);
+    send_pdu(pdu_type::abort, std::move(encoded));
 }
 
-void dicom_association_handler::send_pdu(pdu_type /*type*/, const std::vector<uint8_t>& encoded_pdu) {
+void dicom_association_handler::send_pdu(pdu_type /*type*/, std::vector<uint8_t> encoded_pdu) {
 #ifdef PACS_WITH_NETWORK_SYSTEM
     if (session_ && session_->is_connected()) {
-        // encoded_pdu already includes header for most PDU types
-        // For encode_associate_ac, encode_associate_rj, etc., the encoder returns full PDU
-
-        // We need to make a copy for the async send
-        std::vector<uint8_t> data_copy = encoded_pdu;
-        (void)session_->send(std::move(data_copy));
+        // The encoders return complete PDUs (header included); the buffer
+        // is owned by the async send from here on
+        (void)session_->send(std::move(encoded_pdu));
         pdus_sent_.fetch_add(1, std::memory_order_relaxed);
     }
 #else
@@ -654,6 +701,41 @@ void dicom_association_handler::send_pdu(pdu_type /*type*/, const std::vector<ui
 // Service Dispatching
 // =============================================================================
 
+namespace {
+
+/// Map a DIMSE request to the operation its latency is recorded under
+std::optional<monitoring::dimse_operation> to_dimse_operation(
+    dimse::command_field command) noexcept {
+    switch (command) {
+        case dimse::command_field::c_echo_rq:
+            return monitoring::dimse_operation::c_echo;
+        case dimse::command_field::c_store_rq:
+            return monitoring::dimse_operation::c_store;
+        case dimse::command_field::c_find_rq:
+            return monitoring::dimse_operation::c_find;
+        case dimse::command_field::c_move_rq:
+            return monitoring::dimse_operation::c_move;
+        case dimse::command_field::c_get_rq:
+            return monitoring::dimse_operation::c_get;
+        case dimse::command_field::n_create_rq:
+            return monitoring::dimse_operation::n_create;
+        case dimse::command_field::n_set_rq:
+            return monitoring::dimse_operation::n_set;
+        case dimse::command_field::n_get_rq:
+            return monitoring::dimse_operation::n_get;
+        case dimse::command_field::n_action_rq:
+            return monitoring::dimse_operation::n_action;
+        case dimse::command_field::n_event_report_rq:
+            return monitoring::dimse_operation::n_event;
+        case dimse::command_field::n_delete_rq:
+            return monitoring::dimse_operation::n_delete;
+        default:
+            return std::nullopt;
+    }
+}
+
+}  // namespace
+
 Result<std::monostate> dicom_association_handler::dispatch_to_service(
     uint8_t context_id,
     const dimse::dimse_message& msg) {
@@ -730,8 +812,27 @@ Result<std::monostate> dicom_association_handler::dispatch_to_service(
         }
     }
 
-    // Dispatch to service
-    return service->handle_message(association_, context_id, msg);
+    // Dispatch to service, recording the request's latency
+    monitoring::trace_span handler("service_handler");
+    handler.set_attribute("sop_class", abstract_syntax);
+
+    const auto operation = to_dimse_operation(msg.command());
+    if (!operation) {
+        return service->handle_message(association_, context_id, msg);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    auto result = service->handle_message(association_, context_id, msg);
+    if (result.is_err()) {
+        handler.set_error();
+    }
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    auto& metrics = monitoring::pacs_metrics::global_metrics();
+    metrics.record_operation(*operation, result.is_ok(), duration);
+    metrics.record_calling_ae(association_.calling_ae(), *operation, duration);
+    return result;
 }
 
 services::scp_service* dicom_association_handler::find_service(
@@ -743,6 +844,179 @@ services::scp_service* dicom_association_handler::find_service(
     return nullptr;
 }
 
+// =============================================================================
+// Pipelined Execution
+// =============================================================================
+
+namespace {
+
+/// Map a DIMSE command to the pipeline metrics category
+pipeline::job_category to_job_category(dimse::command_field command) noexcept {
+    switch (command) {
+        case dimse::command_field::c_echo_rq:
+            return pipeline::job_category::echo;
+        case dimse::command_field::c_store_rq:
+            return pipeline::job_category::store;
+        case dimse::command_field::c_find_rq:
+            return pipeline::job_category::find;
+        case dimse::command_field::c_get_rq:
+            return pipeline::job_category::get;
+        case dimse::command_field::c_move_rq:
+            return pipeline::job_category::move;
+        default:
+            return pipeline::job_category::other;
+    }
+}
+
+uint64_t steady_now_ns() noexcept {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+}  // namespace
+
+void dicom_association_handler::set_pipeline(
+    std::shared_ptr<pipeline::pipeline_coordinator> coordinator) {
+    const auto numeric_id = std::hash<std::string>{}(session_id());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pipeline_ = std::move(coordinator);
+    pipeline_session_id_ = numeric_id;
+}
+
+dimse_execution_mode dicom_association_handler::execution_mode() const noexcept {
+    return pipeline_ ? dimse_execution_mode::pipelined
+                     : dimse_execution_mode::inline_dispatch;
+}
+
+size_t dicom_association_handler::pending_dispatches() const {
+    std::lock_guard<std::mutex> lock(dispatch_mutex_);
+    return dispatch_queue_.size() + (dispatch_in_flight_ ? 1 : 0);
+}
+
+void dicom_association_handler::execute_message(
+    uint8_t context_id,
+    dimse::dimse_message msg,
+    monitoring::trace_span request) {
+
+    if (!pipeline_) {
+        auto dispatch_result = dispatch_to_service(context_id, msg);
+        if (dispatch_result.is_err()) {
+            request.set_error();
+            report_error("Service dispatch failed: " + dispatch_result.error().message);
+        }
+        return;
+    }
+
+    // The request span stays open until the queued dispatch has run
+    auto traced = std::make_shared<monitoring::trace_span>(std::move(request));
+    const auto category = to_job_category(msg.command());
+    const auto message_id = msg.message_id();
+    schedule_ordered(category, message_id,
+        [self = shared_from_this(), context_id, msg = std::move(msg), traced]() {
+            if (self->is_closed()) {
+                traced->finish();
+                return false;
+            }
+            auto dispatch_result = self->dispatch_to_service(context_id, msg);
+            if (dispatch_result.is_err()) {
+                traced->set_error();
+                traced->finish();
+                self->report_error("Service dispatch failed: " +
+                                   dispatch_result.error().message);
+                return false;
+            }
+            traced->finish();
+            return true;
+        });
+    traced->detach();
+}
+
+void dicom_association_handler::schedule_ordered(
+    pipeline::job_category category,
+    uint16_t message_id,
+    std::function<bool()> work) {
+
+    pipeline::job_context ctx;
+    ctx.job_id = pipeline_->generate_job_id();
+    ctx.session_id = pipeline_session_id_;
+    ctx.message_id = message_id;
+    ctx.stage = pipeline::pipeline_stage::storage_query_exec;
+    ctx.category = category;
+    ctx.enqueue_time_ns = steady_now_ns();
+
+    const auto trace = monitoring::request_tracer::current();
+    ctx.trace_id = trace.trace_id;
+    ctx.parent_span_id = trace.span_id;
+
+    {
+        std::lock_guard<std::mutex> lock(dispatch_mutex_);
+        ctx.sequence_number = next_sequence_++;
+        dispatch_queue_.emplace(ctx.sequence_number,
+                                pending_dispatch{ctx, std::move(work)});
+    }
+
+    submit_next_dispatch();
+}
+
+void dicom_association_handler::submit_next_dispatch() {
+    pending_dispatch next;
+    {
+        std::lock_guard<std::mutex> lock(dispatch_mutex_);
+        if (dispatch_in_flight_ || dispatch_queue_.empty()) {
+            return;
+        }
+        auto it = dispatch_queue_.begin();
+        next = std::move(it->second);
+        dispatch_queue_.erase(it);
+        dispatch_in_flight_ = true;
+    }
+
+    auto coordinator = pipeline_;
+    std::function<void()> task =
+        [self = shared_from_this(), coordinator, ctx = next.context,
+         work = std::move(next.work)]() {
+            monitoring::trace_context_scope trace({ctx.trace_id, ctx.parent_span_id});
+            monitoring::trace_span("pipeline_queue", ctx.enqueue_time_ns).finish();
+
+            const auto started = steady_now_ns();
+            bool success = false;
+            try {
+                success = work();
+            } catch (const std::exception& e) {
+                self->report_error(std::string("Exception in pipelined dispatch: ") +
+                                   e.what());
+            } catch (...) {
+                self->report_error("Unknown exception in pipelined dispatch");
+            }
+
+            const auto finished = steady_now_ns();
+            auto& metrics = coordinator->get_metrics();
+            metrics.record_stage_completion(ctx.stage, finished - started, success);
+            metrics.record_operation_completion(
+                ctx.category, finished - ctx.enqueue_time_ns, success);
+
+            {
+                std::lock_guard<std::mutex> lock(self->dispatch_mutex_);
+                self->dispatch_in_flight_ = false;
+            }
+            self->submit_next_dispatch();
+        };
+
+    auto submitted = coordinator->submit_task(
+        pipeline::pipeline_stage::storage_query_exec, task);
+    if (submitted.is_err()) {
+        // Coordinator is shutting down: run here so ordering is kept
+        task();
+    }
+}
+
+bool dicom_association_handler::has_pending_dispatch() const {
+    std::lock_guard<std::mutex> lock(dispatch_mutex_);
+    return dispatch_in_flight_ || !dispatch_queue_.empty();
+}
+
 // =============================================================================
 // State Management
 // =============================================================================
@@ -774,6 +1048,12 @@ void dicom_association_handler::close_handler(bool graceful) {
 
     transition_to(handler_state::closed);
 
+    // Drop dispatches that have not started; the peer is gone
+    {
+        std::lock_guard<std::mutex> lock(dispatch_mutex_);
+        dispatch_queue_.clear();
+    }
+
 #ifdef PACS_WITH_NETWORK_SYSTEM
     // Close the session
     try {
@@ -130,6 +130,12 @@ Result<std::monostate> dicom_server_v2::start() {
     }
 
 #ifdef PACS_WITH_NETWORK_SYSTEM
+    // Start the execution pipeline before accepting associations
+    if (auto pipeline_result = start_pipeline(); pipeline_result.is_err()) {
+        running_ = false;
+        return pipeline_result;
+    }
+
     try {
         // Create TCP server via tcp_facade
         kcenon::network::facade::tcp_facade facade;
@@ -174,6 +180,7 @@ Result<std::monostate> dicom_server_v2::start() {
         if (result.is_err()) {
             running_ = false;
             server_.reset();
+            stop_pipeline();
             return error_info("Failed to start server");
         }
 
@@ -183,12 +190,14 @@ Result<std::monostate> dicom_server_v2::start() {
         if (server_) {
             server_.reset();
         }
+        stop_pipeline();
         return error_info(std::string("Exception during server start: ") + e.what());
     } catch (...) {
         running_ = false;
         if (server_) {
             server_.reset();
         }
+        stop_pipeline();
         return error_info("Unknown exception during server start");
     }
 #else
@@ -251,6 +260,9 @@ void dicom_server_v2::stop(duration timeout) {
     // Allow any pending callbacks to complete
     std::this_thread::sleep_for(std::chrono::milliseconds{50});
 
+    // Drain pipelined dispatches now that no handler can submit new ones
+    stop_pipeline();
+
     // Clear callbacks to break reference cycles before server is destroyed.
     // The server object itself is kept alive until dicom_server_v2 is destroyed
     // to avoid use-after-free in the adapter's background I/O threads.
@@ -447,6 +459,11 @@ void dicom_server_v2::create_handler(
         }
     }
 
+    // Hand DIMSE execution to the pipeline in pipelined mode
+    if (auto coordinator = pipeline()) {
+        handler->set_pipeline(std::move(coordinator));
+    }
+
     // Set up handler callbacks
     auto weak_this = std::weak_ptr<dicom_server_v2*>(
         std::shared_ptr<dicom_server_v2*>(nullptr, [](dicom_server_v2**) {}));
@@ -571,6 +588,33 @@ void dicom_server_v2::report_error(const std::string& error) {
     }
 }
 
+Result<std::monostate> dicom_server_v2::start_pipeline() {
+    if (execution_mode_ != dimse_execution_mode::pipelined) {
+        return std::monostate{};
+    }
+
+    auto coordinator = std::make_shared<pipeline::pipeline_coordinator>(pipeline_config_);
+    auto result = coordinator->start();
+    if (result.is_err()) {
+        return error_info("Failed to start pipeline: " + result.error().message);
+    }
+
+    std::lock_guard<std::mutex> lock(pipeline_mutex_);
+    pipeline_ = std::move(coordinator);
+    return std::monostate{};
+}
+
+void dicom_server_v2::stop_pipeline() {
+    std::shared_ptr<pipeline::pipeline_coordinator> coordinator;
+    {
+        std::lock_guard<std::mutex> lock(pipeline_mutex_);
+        coordinator = std::move(pipeline_);
+    }
+    if (coordinator) {
+        (void)coordinator->stop();
+    }
+}
+
 // =============================================================================
 // Security / Access Control
 // =============================================================================
@@ -598,4 +642,27 @@ bool dicom_server_v2::is_access_control_enabled() const noexcept {
     return access_control_enabled_;
 }
 
+// =============================================================================
+// Execution Mode
+// =============================================================================
+
+void dicom_server_v2::set_execution_mode(dimse_execution_mode mode,
+                                         const pipeline::pipeline_config& config) {
+    if (running_) {
+        report_error("Execution mode cannot be changed while the server is running");
+        return;
+    }
+    execution_mode_ = mode;
+    pipeline_config_ = config;
+}
+
+dimse_execution_mode dicom_server_v2::execution_mode() const noexcept {
+    return execution_mode_;
+}
+
+std::shared_ptr<pipeline::pipeline_coordinator> dicom_server_v2::pipeline() const {
+    std::lock_guard<std::mutex> lock(pipeline_mutex_);
+    return pipeline_;
+}
+
 }  // namespace kcenon::pacs::network::v2
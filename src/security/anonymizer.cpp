@@ -39,6 +39,7 @@ anonymizer::anonymizer(anonymization_profile profile)
 anonymizer::anonymizer(const anonymizer& other)
     : profile_{other.profile_}
     , custom_actions_{other.custom_actions_}
+    , plan_{other.plan_}
     , date_offset_{other.date_offset_}
     , encryption_key_{other.encryption_key_}
     , hash_salt_{other.hash_salt_}
@@ -48,6 +49,7 @@ anonymizer::anonymizer(const anonymizer& other)
 anonymizer::anonymizer(anonymizer&& other) noexcept
     : profile_{other.profile_}
     , custom_actions_{std::move(other.custom_actions_)}
+    , plan_{other.plan_}
     , date_offset_{other.date_offset_}
     , encryption_key_{std::move(other.encryption_key_)}
     , hash_salt_{std::move(other.hash_salt_)}
@@ -58,6 +60,7 @@ auto anonymizer::operator=(const anonymizer& other) -> anonymizer& {
     if (this != &other) {
         profile_ = other.profile_;
         custom_actions_ = other.custom_actions_;
+        plan_ = other.plan_;
         date_offset_ = other.date_offset_;
         encryption_key_ = other.encryption_key_;
         hash_salt_ = other.hash_salt_;
@@ -71,6 +74,7 @@ auto anonymizer::operator=(anonymizer&& other) noexcept -> anonymizer& {
     if (this != &other) {
         profile_ = other.profile_;
         custom_actions_ = std::move(other.custom_actions_);
+        plan_ = other.plan_;
         date_offset_ = other.date_offset_;
         encryption_key_ = std::move(other.encryption_key_);
         hash_salt_ = std::move(other.hash_salt_);
@@ -95,16 +99,8 @@ auto anonymizer::anonymize_with_mapping(
     report.date_offset = date_offset_;
     report.timestamp = std::chrono::system_clock::now();
 
-    // Get profile actions
-    auto profile_actions = get_profile_actions(profile_);
-
-    // Merge with custom actions (custom takes precedence)
-    for (const auto& [tag, config] : custom_actions_) {
-        profile_actions[tag] = config;
-    }
-
-    // Process each tag in the profile
-    for (const auto& [tag, config] : profile_actions) {
+    // Process each tag in the compiled plan
+    for (const auto& [tag, config] : *plan_) {
         if (!dataset.contains(tag)) {
             continue;
         }
@@ -210,6 +206,7 @@ auto anonymizer::get_private_tag_action() const noexcept
 
 void anonymizer::add_tag_action(dicom_tag tag, tag_action_config config) {
     custom_actions_[tag] = std::move(config);
+    initialize_profile_actions();
 }
 
 void anonymizer::add_tag_actions(
@@ -218,31 +215,45 @@ void anonymizer::add_tag_actions(
     for (const auto& [tag, config] : actions) {
         custom_actions_[tag] = config;
     }
+    initialize_profile_actions();
 }
 
 auto anonymizer::remove_tag_action(dicom_tag tag) -> bool {
-    return custom_actions_.erase(tag) > 0;
+    if (custom_actions_.erase(tag) == 0) {
+        return false;
+    }
+    initialize_profile_actions();
+    return true;
 }
 
 void anonymizer::clear_custom_actions() {
     custom_actions_.clear();
+    initialize_profile_actions();
 }
 
 auto anonymizer::get_tag_action(dicom_tag tag) const -> tag_action_config {
-    auto it = custom_actions_.find(tag);
-    if (it != custom_actions_.end()) {
+    auto it = std::lower_bound(
+        plan_->begin(), plan_->end(), tag,
+        [](const auto& entry, dicom_tag key) { return entry.first < key; });
+    if (it != plan_->end() && it->first == tag) {
         return it->second;
     }
 
-    auto profile_actions = get_profile_actions(profile_);
-    auto profile_it = profile_actions.find(tag);
-    if (profile_it != profile_actions.end()) {
-        return profile_it->second;
-    }
-
     return tag_action_config::make_keep();
 }
 
+auto anonymizer::get_action_plan() const noexcept
+    -> std::span<const std::pair<dicom_tag, tag_action_config>> {
+    return *plan_;
+}
+
+auto anonymizer::preserves_pixel_data() const noexcept -> bool {
+    if (profile_ == anonymization_profile::clean_pixel) {
+        return false;
+    }
+    return plan_->empty() || plan_->back().first < tags::pixel_data;
+}
+
 void anonymizer::set_date_offset(std::chrono::days offset) {
     date_offset_ = offset;
 }
@@ -778,8 +789,13 @@ auto anonymizer::encrypt_value(std::string_view value) const
 }
 
 void anonymizer::initialize_profile_actions() {
-    // Profile actions are computed on-demand in get_profile_actions()
-    // This method can be used for any initialization if needed
+    // Merge with custom actions (custom takes precedence); std::map keeps
+    // the result in tag order
+    auto actions = get_profile_actions(profile_);
+    for (const auto& [tag, config] : custom_actions_) {
+        actions[tag] = config;
+    }
+    plan_ = std::make_shared<const action_plan>(actions.begin(), actions.end());
 }
 
 } // namespace kcenon::pacs::security
@@ -0,0 +1,310 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file batch_anonymizer.cpp
+ * @brief Implementation of parallel, streaming batch de-identification
+ */
+
+#include "kcenon/pacs/security/batch_anonymizer.h"
+
+#include "kcenon/pacs/core/dicom_file.h"
+#include "kcenon/pacs/core/dicom_tag_constants.h"
+#include "kcenon/pacs/core/frame_index.h"
+#include "kcenon/pacs/core/memory_mapped_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <system_error>
+#include <thread>
+
+namespace kcenon::pacs::security {
+
+using kcenon::common::make_error;
+
+namespace {
+
+/// Error codes for batch de-identification
+constexpr int kInputNotFound = 1;
+constexpr int kOutputError = 2;
+constexpr int kReadError = 3;
+constexpr int kAnonymizationError = 4;
+
+constexpr std::size_t kPreambleSize = 128;
+
+auto is_part10(std::span<const std::uint8_t> data) -> bool {
+    return data.size() >= kPreambleSize + 4 &&
+           std::memcmp(data.data() + kPreambleSize, "DICM", 4) == 0;
+}
+
+/**
+ * @brief Output location for a de-identified instance
+ */
+auto output_path(const std::filesystem::path& root,
+                 const core::dicom_dataset& dataset,
+                 const std::filesystem::path& source) -> std::filesystem::path {
+    auto component = [](std::string value) {
+        return value.empty() ? std::string("unknown") : value;
+    };
+    auto sop = dataset.get_string(core::tags::sop_instance_uid);
+    auto name = sop.empty() ? source.filename().string() : sop + ".dcm";
+    return root / component(dataset.get_string(core::tags::study_instance_uid)) /
+           component(dataset.get_string(core::tags::series_instance_uid)) / name;
+}
+
+/**
+ * @brief Write header and tail bytes, replacing the target atomically
+ * @return Number of bytes written
+ */
+auto write_output(const std::filesystem::path& target,
+                  std::span<const std::uint8_t> head,
+                  std::span<const std::uint8_t> tail)
+    -> kcenon::common::Result<std::uint64_t> {
+    std::error_code ec;
+    std::filesystem::create_directories(target.parent_path(), ec);
+    if (ec) {
+        return make_error<std::uint64_t>(
+            kOutputError, "Cannot create " + target.parent_path().string() +
+                              ": " + ec.message(),
+            "batch_anonymizer");
+    }
+
+    auto partial = target;
+    partial += ".part";
+    {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(head.data()),
+                  static_cast<std::streamsize>(head.size()));
+        out.write(reinterpret_cast<const char*>(tail.data()),
+                  static_cast<std::streamsize>(tail.size()));
+        if (!out) {
+            std::filesystem::remove(partial, ec);
+            return make_error<std::uint64_t>(
+                kOutputError, "Failed to write " + partial.string(),
+                "batch_anonymizer");
+        }
+    }
+
+    std::filesystem::rename(partial, target, ec);
+    if (ec) {
+        std::filesystem::remove(partial, ec);
+        return make_error<std::uint64_t>(
+            kOutputError, "Failed to rename " + partial.string(),
+            "batch_anonymizer");
+    }
+    return static_cast<std::uint64_t>(head.size() + tail.size());
+}
+
+}  // namespace
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+batch_anonymizer::batch_anonymizer(anonymizer prototype,
+                                   batch_anonymization_config config)
+    : prototype_(std::move(prototype)), config_(std::move(config)) {}
+
+// ============================================================================
+// Batch Operations
+// ============================================================================
+
+auto batch_anonymizer::run(const std::vector<std::filesystem::path>& inputs,
+                           uid_mapping& mapping)
+    -> kcenon::common::Result<batch_anonymization_result> {
+    cancel_requested_.store(false);
+    const auto start = std::chrono::steady_clock::now();
+
+    auto collected = collect_files(inputs);
+    if (collected.is_err()) {
+        return make_error<batch_anonymization_result>(
+            kInputNotFound, collected.error().message, "batch_anonymizer");
+    }
+    const auto files = std::move(collected.value());
+
+    std::error_code ec;
+    std::filesystem::create_directories(config_.output_directory, ec);
+    if (ec) {
+        return make_error<batch_anonymization_result>(
+            kOutputError,
+            "Cannot create output directory " +
+                config_.output_directory.string() + ": " + ec.message(),
+            "batch_anonymizer");
+    }
+
+    batch_anonymization_result result;
+    std::mutex result_mutex;
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> finished{0};
+
+    auto worker_loop = [&]() {
+        // Copies share the compiled plan; only per-call state is duplicated
+        anonymizer worker = prototype_;
+        for (;;) {
+            if (cancel_requested_.load()) {
+                return;
+            }
+            const auto index = next.fetch_add(1);
+            if (index >= files.size()) {
+                return;
+            }
+
+            auto outcome = process_file(worker, files[index], mapping);
+            {
+                std::lock_guard<std::mutex> lock(result_mutex);
+                if (outcome.is_err()) {
+                    ++result.instances_failed;
+                    result.failures.push_back({files[index], outcome.error().message});
+                    if (config_.stop_on_error) {
+                        cancel_requested_.store(true);
+                    }
+                } else if (outcome.value().skipped) {
+                    ++result.files_skipped;
+                } else {
+                    const auto& value = outcome.value();
+                    ++result.instances_processed;
+                    if (value.passthrough) {
+                        ++result.pixel_passthrough;
+                    }
+                    result.bytes_read += value.bytes_read;
+                    result.bytes_written += value.bytes_written;
+                    result.tags_processed += value.report.total_tags_processed;
+                    result.uids_replaced += value.report.uids_replaced;
+                    result.private_tags_removed += value.report.private_tags_removed;
+                }
+            }
+
+            const auto done = finished.fetch_add(1) + 1;
+            if (config_.on_progress) {
+                config_.on_progress(done, files.size());
+            }
+        }
+    };
+
+    std::size_t worker_count = config_.worker_count;
+    if (worker_count == 0) {
+        worker_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    worker_count = std::min(worker_count, files.size());
+
+    std::vector<std::thread> workers;
+    workers.reserve(worker_count);
+    for (std::size_t i = 0; i < worker_count; ++i) {
+        workers.emplace_back(worker_loop);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    result.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    return result;
+}
+
+void batch_anonymizer::cancel() noexcept {
+    cancel_requested_.store(true);
+}
+
+auto batch_anonymizer::config() const noexcept -> const batch_anonymization_config& {
+    return config_;
+}
+
+auto batch_anonymizer::collect_files(const std::vector<std::filesystem::path>& inputs)
+    -> kcenon::common::Result<std::vector<std::filesystem::path>> {
+    std::vector<std::filesystem::path> files;
+
+    for (const auto& input : inputs) {
+        std::error_code ec;
+        if (std::filesystem::is_regular_file(input, ec)) {
+            files.push_back(input);
+            continue;
+        }
+        if (!std::filesystem::is_directory(input, ec)) {
+            return make_error<std::vector<std::filesystem::path>>(
+                kInputNotFound, "Input not found: " + input.string(),
+                "batch_anonymizer");
+        }
+        for (std::filesystem::recursive_directory_iterator it(input, ec), end;
+             !ec && it != end; it.increment(ec)) {
+            if (it->is_regular_file(ec)) {
+                files.push_back(it->path());
+            }
+        }
+    }
+
+    std::sort(files.begin(), files.end());
+    files.erase(std::unique(files.begin(), files.end()), files.end());
+    return files;
+}
+
+// ============================================================================
+// Private Implementation
+// ============================================================================
+
+auto batch_anonymizer::process_file(anonymizer& worker,
+                                    const std::filesystem::path& path,
+                                    uid_mapping& mapping) const
+    -> kcenon::common::Result<file_outcome> {
+    auto mapped = core::memory_mapped_file::open(path);
+    if (mapped.is_err()) {
+        return make_error<file_outcome>(kReadError, mapped.error().message,
+                                        "batch_anonymizer");
+    }
+    const auto data = mapped.value().as_span();
+
+    file_outcome outcome;
+    if (!is_part10(data)) {
+        outcome.skipped = true;
+        return outcome;
+    }
+    outcome.bytes_read = data.size();
+
+    // Header-only rewrite: decode the attributes preceding Pixel Data and
+    // copy the Pixel Data element verbatim. Requires Pixel Data to be the
+    // last element, so nothing after it escapes the tag actions.
+    std::size_t header_size = data.size();
+    if (config_.pixel_passthrough && worker.preserves_pixel_data()) {
+        auto location = core::frame_index::locate_pixel_data(data);
+        if (location.is_ok() && location.value().element_end == data.size()) {
+            header_size = static_cast<std::size_t>(location.value().element_offset);
+        }
+    }
+    const bool passthrough = header_size < data.size();
+
+    auto file = core::dicom_file::from_bytes(data.first(header_size));
+    if (file.is_err()) {
+        return make_error<file_outcome>(kReadError, file.error().message,
+                                        "batch_anonymizer");
+    }
+    const auto transfer_syntax = file.value().transfer_syntax();
+    auto& dataset = file.value().dataset();
+
+    auto report = worker.anonymize_with_mapping(dataset, mapping);
+    if (report.is_err()) {
+        return make_error<file_outcome>(kAnonymizationError,
+                                        report.error().message,
+                                        "batch_anonymizer");
+    }
+    outcome.report = std::move(report.value());
+
+    const auto target = output_path(config_.output_directory, dataset, path);
+    const auto encoded =
+        core::dicom_file::create(std::move(dataset), transfer_syntax).to_bytes();
+
+    auto written = write_output(target, encoded,
+                                passthrough ? data.subspan(header_size)
+                                            : std::span<const std::uint8_t>{});
+    if (written.is_err()) {
+        return make_error<file_outcome>(kOutputError, written.error().message,
+                                        "batch_anonymizer");
+    }
+    outcome.bytes_written = written.value();
+    outcome.passthrough = passthrough;
+    return outcome;
+}
+
+}  // namespace kcenon::pacs::security
@@ -61,25 +61,29 @@ auto uid_mapping::operator=(uid_mapping&& other) noexcept -> uid_mapping& {
 auto uid_mapping::get_or_create(std::string_view original_uid)
     -> kcenon::common::Result<std::string> {
     // First try read-only lookup
+    std::string root;
     {
         std::shared_lock lock(mutex_);
         auto it = original_to_anon_.find(original_uid);
         if (it != original_to_anon_.end()) {
             return it->second;
         }
+        root = uid_root_;
     }
 
-    // Need to create new mapping - upgrade to write lock
+    // Generate the candidate before taking the write lock so concurrent
+    // callers only serialize on the insert
+    auto new_uid = make_uid(root);
+
     std::unique_lock lock(mutex_);
 
-    // Double-check after acquiring write lock
+    // Double-check after acquiring write lock; another thread may have
+    // mapped the same UID meanwhile, in which case the candidate is dropped
     auto it = original_to_anon_.find(original_uid);
     if (it != original_to_anon_.end()) {
         return it->second;
     }
 
-    // Generate new UID
-    auto new_uid = generate_uid();
     std::string original_str{original_uid};
 
     original_to_anon_[original_str] = new_uid;
@@ -231,6 +235,15 @@ auto uid_mapping::get_uid_root() const -> std::string {
 }
 
 auto uid_mapping::generate_uid() const -> std::string {
+    std::string root;
+    {
+        std::shared_lock lock(mutex_);
+        root = uid_root_;
+    }
+    return make_uid(root);
+}
+
+auto uid_mapping::make_uid(std::string_view root) const -> std::string {
     // Generate UID based on timestamp and counter
     auto now = std::chrono::system_clock::now();
     auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
@@ -239,14 +252,14 @@ auto uid_mapping::generate_uid() const -> std::string {
 
     auto counter = uid_counter_.fetch_add(1);
 
-    // Random component for additional uniqueness
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    // Random component for additional uniqueness; one engine per thread
+    // avoids seeding from std::random_device on every call
+    thread_local std::mt19937 gen{std::random_device{}()};
     std::uniform_int_distribution<std::uint32_t> dist(0, 999999);
     auto random_part = dist(gen);
 
     std::ostringstream oss;
-    oss << uid_root_ << "." << timestamp << "." << counter << "." << random_part;
+    oss << root << "." << timestamp << "." << counter << "." << random_part;
 
     return oss.str();
 }
@@ -8,12 +8,14 @@
  */
 
 #include "kcenon/pacs/services/retrieve_scp.h"
+#include "kcenon/pacs/services/transcoding/transcoding_service.h"
 
 #include "kcenon/pacs/core/dicom_tag_constants.h"
 #include "kcenon/pacs/core/events.h"
 #include "kcenon/pacs/core/result.h"
 #include "kcenon/pacs/network/dimse/command_field.h"
 #include "kcenon/pacs/network/dimse/status_codes.h"
+#include "kcenon/pacs/network/association.h"
 
 #include <kcenon/common/patterns/event_bus.h>
 
@@ -38,14 +40,35 @@ void retrieve_scp::set_destination_resolver(destination_resolver resolver) {
     destination_resolver_ = std::move(resolver);
 }
 
+void retrieve_scp::set_transcoder(std::shared_ptr<transcoding_service> transcoder) {
+    transcoder_ = std::move(transcoder);
+}
+
+auto retrieve_scp::transcoder() const noexcept
+    -> std::shared_ptr<transcoding_service> {
+    return transcoder_;
+}
+
 void retrieve_scp::set_store_sub_operation(store_sub_operation handler) {
     store_handler_ = std::move(handler);
 }
 
+void retrieve_scp::set_move_association_provider(
+    move_association_provider provider) {
+    move_association_provider_ = std::move(provider);
+}
+
 void retrieve_scp::set_cancel_check(retrieve_cancel_check check) {
     cancel_check_ = std::move(check);
 }
 
+void retrieve_scp::set_pass_through(
+    std::shared_ptr<storage::storage_interface> storage,
+    stored_instance_locator locator) {
+    pass_through_storage_ = std::move(storage);
+    instance_locator_ = std::move(locator);
+}
+
 // =============================================================================
 // scp_service Interface Implementation
 // =============================================================================
@@ -120,7 +143,7 @@ network::Result<std::monostate> retrieve_scp::handle_c_move(
     using namespace network::dimse;
 
     // Verify we have a retrieve handler
-    if (!retrieve_handler_) {
+    if (!retrieve_handler_ && !(pass_through_storage_ && instance_locator_)) {
         return kcenon::pacs::pacs_void_error(
             kcenon::pacs::error_codes::retrieve_handler_not_set,
             "No retrieve handler configured");
@@ -177,7 +200,10 @@ network::Result<std::monostate> retrieve_scp::handle_c_move(
 
     // Retrieve matching files
     const auto& query_keys = request.dataset().value().get();
-    auto files = retrieve_handler_(query_keys);
+    std::vector<core::dicom_file> files;
+    std::vector<std::string> stored;
+    find_matches(query_keys, files, stored);
+    const size_t match_count = files.size() + stored.size();
     auto start_time = std::chrono::steady_clock::now();
 
     // Get study UID for event
@@ -190,17 +216,24 @@ network::Result<std::monostate> retrieve_scp::handle_c_move(
             calling_ae,
             dest_ae,
             study_uid,
-            static_cast<uint16_t>(files.size())
+            static_cast<uint16_t>(match_count)
         }
     );
 
+    // Open the sub-association used by the default C-STORE path
+    std::shared_ptr<network::association> destination;
+    if (!store_handler_ && move_association_provider_ && match_count > 0) {
+        destination = move_association_provider_(
+            dest_ae, dest_addr->first, dest_addr->second);
+    }
+
     // Initialize sub-operation statistics
     sub_operation_stats stats;
-    stats.remaining = static_cast<uint16_t>(files.size());
+    stats.remaining = static_cast<uint16_t>(match_count);
     bool was_cancelled = false;
 
-    // Process each file (C-STORE sub-operations)
-    for (const auto& file : files) {
+    // Process each match (C-STORE sub-operations)
+    for (size_t i = 0; i < match_count; ++i) {
         // Check for cancel request
         if (cancel_check_ && cancel_check_()) {
             was_cancelled = true;
@@ -216,21 +249,10 @@ network::Result<std::monostate> retrieve_scp::handle_c_move(
             return pending_result;
         }
 
-        // Perform C-STORE sub-operation
-        // Note: In a full implementation, this would establish a sub-association
-        // to the destination and perform C-STORE. For now, we simulate success
-        // or use the provided store handler.
-        status_code store_status = status_success;
-
-        if (store_handler_) {
-            // Use custom store handler
-            // The handler should establish connection to dest_addr and perform C-STORE
-            // For now, we pass the current association (which isn't correct for C-MOVE)
-            // A real implementation would create a separate association to destination
-            store_status = store_handler_(
-                assoc, context_id, file,
-                calling_ae, message_id);
-        }
+        // Perform C-STORE sub-operation on the destination sub-association
+        const status_code store_status = store_match(
+            assoc, context_id, true, destination.get(), files, stored, i,
+            calling_ae, message_id);
 
         // Update statistics based on store result
         stats.remaining--;
@@ -283,7 +305,7 @@ network::Result<std::monostate> retrieve_scp::handle_c_get(
     using namespace network::dimse;
 
     // Verify we have a retrieve handler
-    if (!retrieve_handler_) {
+    if (!retrieve_handler_ && !(pass_through_storage_ && instance_locator_)) {
         return kcenon::pacs::pacs_void_error(
             kcenon::pacs::error_codes::retrieve_handler_not_set,
             "No retrieve handler configured");
@@ -305,7 +327,10 @@ network::Result<std::monostate> retrieve_scp::handle_c_get(
 
     // Retrieve matching files
     const auto& query_keys = request.dataset().value().get();
-    auto files = retrieve_handler_(query_keys);
+    std::vector<core::dicom_file> files;
+    std::vector<std::string> stored;
+    find_matches(query_keys, files, stored);
+    const size_t match_count = files.size() + stored.size();
     auto start_time = std::chrono::steady_clock::now();
 
     // Get study UID for event
@@ -318,17 +343,17 @@ network::Result<std::monostate> retrieve_scp::handle_c_get(
             calling_ae,
             "",  // No destination for C-GET
             study_uid,
-            static_cast<uint16_t>(files.size())
+            static_cast<uint16_t>(match_count)
         }
     );
 
     // Initialize sub-operation statistics
     sub_operation_stats stats;
-    stats.remaining = static_cast<uint16_t>(files.size());
+    stats.remaining = static_cast<uint16_t>(match_count);
     bool was_cancelled = false;
 
-    // Process each file (C-STORE sub-operations on same association)
-    for (const auto& file : files) {
+    // Process each match (C-STORE sub-operations on same association)
+    for (size_t i = 0; i < match_count; ++i) {
         // Check for cancel request
         if (cancel_check_ && cancel_check_()) {
             was_cancelled = true;
@@ -346,68 +371,9 @@ network::Result<std::monostate> retrieve_scp::handle_c_get(
 
         // Perform C-STORE sub-operation on the same association
         // For C-GET, images are sent back on the same association
-        status_code store_status = status_success;
-
-        if (store_handler_) {
-            // Use custom store handler
-            store_status = store_handler_(
-                assoc, context_id, file,
-                calling_ae, message_id);
-        } else {
-            // Default implementation: build and send C-STORE-RQ
-            // Get the SOP Class and Instance UIDs from the file
-            auto file_sop_class = file.sop_class_uid();
-            auto file_sop_instance = file.sop_instance_uid();
-
-            // Create C-STORE request
-            dimse_message store_rq{command_field::c_store_rq, message_id};
-            store_rq.set_affected_sop_class_uid(file_sop_class);
-            store_rq.set_affected_sop_instance_uid(file_sop_instance);
-            store_rq.set_priority(priority_medium);
-
-            // For C-GET, include Move Originator information
-            // (0000,1030) Move Originator Application Entity Title
-            // (0000,1031) Move Originator Message ID
-            store_rq.command_set().set_string(
-                tag_move_originator_aet,
-                encoding::vr_type::AE,
-                calling_ae);
-            store_rq.command_set().set_numeric<uint16_t>(
-                tag_move_originator_message_id,
-                encoding::vr_type::US,
-                message_id);
-
-            // Attach the dataset
-            store_rq.set_dataset(file.dataset());
-
-            // Find the presentation context for the SOP Class
-            auto store_context_id = assoc.accepted_context_id(file_sop_class);
-            if (!store_context_id.has_value()) {
-                // No accepted context for this SOP Class
-                stats.remaining--;
-                stats.failed++;
-                continue;
-            }
-
-            // Send the C-STORE request
-            auto send_result = assoc.send_dimse(store_context_id.value(), store_rq);
-            if (send_result.is_err()) {
-                stats.remaining--;
-                stats.failed++;
-                continue;
-            }
-
-            // Wait for C-STORE response
-            auto recv_result = assoc.receive_dimse();
-            if (recv_result.is_err()) {
-                stats.remaining--;
-                stats.failed++;
-                continue;
-            }
-
-            auto& [recv_ctx, store_rsp] = recv_result.value();
-            store_status = store_rsp.status();
-        }
+        const status_code store_status = store_match(
+            assoc, context_id, false, nullptr, files, stored, i,
+            calling_ae, message_id);
 
         // Update statistics based on store result
         stats.remaining--;
@@ -525,6 +491,278 @@ network::Result<std::monostate> retrieve_scp::send_final_response(
     return assoc.send_dimse(context_id, response);
 }
 
+network::Result<core::dicom_dataset> retrieve_scp::prepare_for_context(
+    network::association& assoc,
+    uint8_t context_id,
+    const core::dicom_file& file) const {
+
+    auto context_ts = assoc.context_transfer_syntax(context_id);
+    if (context_ts.is_err()) {
+        return network::Result<core::dicom_dataset>::ok(file.dataset());
+    }
+
+    const auto stored_ts = file.transfer_syntax();
+    const auto& target_ts = context_ts.value();
+
+    // Native syntaxes are re-encoded by the association itself
+    if (stored_ts == target_ts ||
+        (!stored_ts.is_encapsulated() && !target_ts.is_encapsulated())) {
+        return network::Result<core::dicom_dataset>::ok(file.dataset());
+    }
+
+    if (!transcoder_) {
+        return pacs_error<core::dicom_dataset>(
+            error_codes::unsupported_transfer_syntax,
+            "Stored transfer syntax " + std::string(stored_ts.name()) +
+            " not accepted and no transcoder configured");
+    }
+
+    auto converted = transcoder_->transcode(file, target_ts);
+    if (converted.is_err()) {
+        return network::Result<core::dicom_dataset>::err(converted.error());
+    }
+    return network::Result<core::dicom_dataset>::ok(converted.value().dataset());
+}
+
+// =============================================================================
+// Private Implementation - C-STORE Sub-operations
+// =============================================================================
+
+namespace {
+
+/// Whether stored data set bytes can be sent unchanged on a context
+///
+/// The DIMSE layer reads data sets as Little Endian without deflation, so
+/// other syntaxes are decoded and re-encoded even when they match.
+bool can_pass_through(const encoding::transfer_syntax& stored,
+                      const encoding::transfer_syntax& accepted) {
+    return stored == accepted && !stored.is_deflated() &&
+           stored.endianness() == encoding::byte_order::little_endian;
+}
+
+/// Stored bytes of an instance, mapped when the backend allows
+struct stored_bytes {
+    std::unique_ptr<storage::byte_source> source;
+    std::vector<uint8_t> owned;
+    std::span<const uint8_t> data;
+};
+
+std::optional<stored_bytes> read_stored(storage::storage_interface& storage,
+                                        std::string_view sop_instance_uid) {
+    auto source = storage.open_read(sop_instance_uid);
+    if (source.is_err()) {
+        return std::nullopt;
+    }
+
+    stored_bytes bytes;
+    bytes.source = std::move(source.value());
+    bytes.data = bytes.source->contiguous();
+    if (bytes.data.empty()) {
+        auto all = bytes.source->read_all();
+        if (all.is_err()) {
+            return std::nullopt;
+        }
+        bytes.owned = std::move(all.value());
+        bytes.data = bytes.owned;
+    }
+    return bytes;
+}
+
+}  // namespace
+
+network::dimse::dimse_message retrieve_scp::make_store_request(
+    std::string_view sop_class_uid,
+    std::string_view sop_instance_uid,
+    const std::string& move_originator_ae,
+    uint16_t move_originator_msg_id) {
+
+    using namespace network::dimse;
+
+    dimse_message store_rq{command_field::c_store_rq, move_originator_msg_id};
+    store_rq.set_affected_sop_class_uid(sop_class_uid);
+    store_rq.set_affected_sop_instance_uid(sop_instance_uid);
+    store_rq.set_priority(priority_medium);
+
+    // (0000,1030) Move Originator Application Entity Title
+    // (0000,1031) Move Originator Message ID
+    store_rq.command_set().set_string(
+        tag_move_originator_aet,
+        encoding::vr_type::AE,
+        move_originator_ae);
+    store_rq.command_set().set_numeric<uint16_t>(
+        tag_move_originator_message_id,
+        encoding::vr_type::US,
+        move_originator_msg_id);
+    return store_rq;
+}
+
+network::dimse::status_code retrieve_scp::receive_store_status(
+    network::association& assoc) {
+    auto recv_result = assoc.receive_dimse();
+    if (recv_result.is_err()) {
+        return network::dimse::status_error_unable_to_process;
+    }
+    return recv_result.value().second.status();
+}
+
+network::dimse::status_code retrieve_scp::send_file(
+    network::association& assoc,
+    const core::dicom_file& file,
+    const std::string& move_originator_ae,
+    uint16_t move_originator_msg_id) const {
+
+    using namespace network::dimse;
+
+    const auto file_sop_class = file.sop_class_uid();
+    auto store_rq = make_store_request(
+        file_sop_class, file.sop_instance_uid(),
+        move_originator_ae, move_originator_msg_id);
+
+    // Find the presentation context for the SOP Class
+    auto store_context_id = assoc.accepted_context_id(file_sop_class);
+    if (!store_context_id.has_value()) {
+        return status_refused_sop_class_not_supported;
+    }
+
+    // Attach the dataset, converting pixel data when the stored
+    // syntax differs in encapsulation from the accepted one
+    auto prepared = prepare_for_context(assoc, store_context_id.value(), file);
+    if (prepared.is_err()) {
+        return status_error_unable_to_process;
+    }
+    store_rq.set_dataset(std::move(prepared.value()));
+
+    if (assoc.send_dimse(store_context_id.value(), store_rq).is_err()) {
+        return status_error_unable_to_process;
+    }
+    return receive_store_status(assoc);
+}
+
+network::dimse::status_code retrieve_scp::send_stored_instance(
+    network::association& assoc,
+    std::string_view sop_instance_uid,
+    const std::string& move_originator_ae,
+    uint16_t move_originator_msg_id) const {
+
+    using namespace network::dimse;
+
+    if (!pass_through_storage_) {
+        return status_error_unable_to_process;
+    }
+    auto bytes = read_stored(*pass_through_storage_, sop_instance_uid);
+    if (!bytes) {
+        return status_error_unable_to_process;
+    }
+
+    // Only the File Meta Information is parsed up front
+    auto header = core::dicom_file::read_header(bytes->data);
+    if (header.is_err()) {
+        return status_error_unable_to_process;
+    }
+    const auto& meta = header.value().meta_info;
+    const auto sop_class = meta.get_string(core::tags::media_storage_sop_class_uid);
+
+    auto store_context_id = assoc.accepted_context_id(sop_class);
+    if (!store_context_id.has_value()) {
+        return status_refused_sop_class_not_supported;
+    }
+
+    auto store_rq = make_store_request(
+        sop_class,
+        meta.get_string(core::tags::media_storage_sop_instance_uid,
+                        std::string(sop_instance_uid)),
+        move_originator_ae, move_originator_msg_id);
+
+    auto context_ts = assoc.context_transfer_syntax(store_context_id.value());
+    network::Result<std::monostate> sent = std::monostate{};
+    if (context_ts.is_ok() &&
+        can_pass_through(header.value().transfer_syntax, context_ts.value())) {
+        sent = assoc.send_dimse_encoded(
+            store_context_id.value(), store_rq,
+            bytes->data.subspan(header.value().dataset_offset));
+    } else {
+        // Transcoding needed: decode and prepare as for any other file
+        auto file = core::dicom_file::from_bytes(bytes->data);
+        if (file.is_err()) {
+            return status_error_unable_to_process;
+        }
+        auto prepared = prepare_for_context(
+            assoc, store_context_id.value(), file.value());
+        if (prepared.is_err()) {
+            return status_error_unable_to_process;
+        }
+        store_rq.set_dataset(std::move(prepared.value()));
+        sent = assoc.send_dimse(store_context_id.value(), store_rq);
+    }
+
+    if (sent.is_err()) {
+        return status_error_unable_to_process;
+    }
+    return receive_store_status(assoc);
+}
+
+std::optional<core::dicom_file> retrieve_scp::load_stored_file(
+    std::string_view sop_instance_uid) const {
+    auto bytes = read_stored(*pass_through_storage_, sop_instance_uid);
+    if (!bytes) {
+        return std::nullopt;
+    }
+    auto file = core::dicom_file::from_bytes(bytes->data);
+    if (file.is_err()) {
+        return std::nullopt;
+    }
+    return std::move(file.value());
+}
+
+void retrieve_scp::find_matches(const core::dicom_dataset& query_keys,
+                                std::vector<core::dicom_file>& files,
+                                std::vector<std::string>& stored) const {
+    if (pass_through_storage_ && instance_locator_) {
+        stored = instance_locator_(query_keys);
+    } else {
+        files = retrieve_handler_(query_keys);
+    }
+}
+
+network::dimse::status_code retrieve_scp::store_match(
+    network::association& assoc,
+    uint8_t context_id,
+    bool is_move,
+    network::association* destination,
+    const std::vector<core::dicom_file>& files,
+    const std::vector<std::string>& stored,
+    size_t index,
+    const std::string& calling_ae,
+    uint16_t message_id) const {
+
+    using namespace network::dimse;
+
+    if (store_handler_) {
+        if (stored.empty()) {
+            return store_handler_(assoc, context_id, files[index],
+                                  calling_ae, message_id);
+        }
+        // Custom handlers take a decoded file
+        auto file = load_stored_file(stored[index]);
+        if (!file) {
+            return status_error_unable_to_process;
+        }
+        return store_handler_(assoc, context_id, *file, calling_ae, message_id);
+    }
+
+    // C-GET stores on the request association, C-MOVE on the sub-association
+    auto* target = is_move ? destination : &assoc;
+    if (target == nullptr) {
+        // Without a provider C-MOVE has no destination association
+        return move_association_provider_ ? status_error_unable_to_process
+                                          : status_success;
+    }
+    return stored.empty()
+               ? send_file(*target, files[index], calling_ae, message_id)
+               : send_stored_instance(*target, stored[index],
+                                      calling_ae, message_id);
+}
+
 std::string retrieve_scp::get_move_destination(
     const network::dimse::dimse_message& request) const {
 
@@ -13,9 +13,49 @@
 #include "kcenon/pacs/core/result.h"
 #include "kcenon/pacs/network/dimse/command_field.h"
 #include "kcenon/pacs/network/dimse/status_codes.h"
+#include "kcenon/pacs/storage/content_hash.h"
+
+#include <algorithm>
+#include <array>
 
 namespace kcenon::pacs::services {
 
+namespace {
+
+/// Prefix of the file hashes this SCP can recompute
+constexpr std::string_view kHashPrefix = "xxh64:";
+
+/// Hash the stored bytes of an instance, or "" if they cannot be read
+std::string hash_stored_instance(storage::storage_interface& storage,
+                                 const std::string& sop_instance_uid) {
+    auto source = storage.open_read(sop_instance_uid);
+    if (source.is_err()) {
+        return {};
+    }
+
+    storage::content_hasher hasher;
+    auto contiguous = source.value()->contiguous();
+    if (!contiguous.empty()) {
+        hasher.update(contiguous);
+        return hasher.hex_digest();
+    }
+
+    std::array<uint8_t, 64 * 1024> buffer{};
+    for (;;) {
+        auto n = source.value()->read(buffer);
+        if (n.is_err()) {
+            return {};
+        }
+        if (n.value() == 0) {
+            break;
+        }
+        hasher.update(std::span<const uint8_t>(buffer.data(), n.value()));
+    }
+    return hasher.hex_digest();
+}
+
+}  // namespace
+
 // =============================================================================
 // Construction
 // =============================================================================
@@ -23,8 +63,43 @@ namespace kcenon::pacs::services {
 storage_commitment_scp::storage_commitment_scp(
     std::shared_ptr<storage::storage_interface> storage,
     std::shared_ptr<di::ILogger> logger)
+    : storage_commitment_scp(std::move(storage),
+                             storage_commitment_scp_config{},
+                             std::move(logger)) {}
+
+storage_commitment_scp::storage_commitment_scp(
+    std::shared_ptr<storage::storage_interface> storage,
+    const storage_commitment_scp_config& config,
+    std::shared_ptr<di::ILogger> logger)
     : scp_service(std::move(logger))
-    , storage_(std::move(storage)) {}
+    , storage_(std::move(storage))
+    , config_(config) {}
+
+storage_commitment_scp::~storage_commitment_scp() {
+    {
+        std::lock_guard<std::mutex> lock(report_mutex_);
+        stopping_ = true;
+    }
+    report_cv_.notify_all();
+    if (report_worker_.joinable()) {
+        report_worker_.join();
+    }
+}
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+void storage_commitment_scp::set_hash_lookup(commitment_hash_lookup lookup) {
+    hash_lookup_ = std::move(lookup);
+}
+
+void storage_commitment_scp::wait_for_pending_reports() {
+    std::unique_lock<std::mutex> lock(report_mutex_);
+    report_cv_.wait(lock, [this] {
+        return report_queue_.empty() && reports_running_ == 0;
+    });
+}
 
 // =============================================================================
 // scp_service Interface
@@ -148,15 +223,29 @@ network::Result<std::monostate> storage_commitment_scp::handle_n_action(
     // Update statistics
     ++actions_processed_;
 
-    // Verify instances against storage
-    auto result = verify_instances(transaction_uid, references);
-
-    // Update instance statistics
-    instances_committed_ += result.success_references.size();
-    instances_failed_ += result.failed_references.size();
+    if (!config_.async_event_report) {
+        auto result = verify_instances(transaction_uid, references);
+        instances_committed_ += result.success_references.size();
+        instances_failed_ += result.failed_references.size();
+        return send_event_report(assoc, context_id, result);
+    }
 
-    // Send N-EVENT-REPORT with verification results
-    return send_event_report(assoc, context_id, result);
+    // Verify and report in the background so the association is free for
+    // further requests; the report is dropped if the association has gone
+    enqueue_report([this, sender = assoc.make_deferred_sender(), context_id,
+                    transaction_uid, references = std::move(references)] {
+        auto result = verify_instances(transaction_uid, references);
+        instances_committed_ += result.success_references.size();
+        instances_failed_ += result.failed_references.size();
+
+        auto sent = sender(context_id, build_event_report(result));
+        if (sent.is_err()) {
+            logger_->warn("Storage Commitment: N-EVENT-REPORT for " +
+                          result.transaction_uid + " not sent: " +
+                          sent.error().message);
+        }
+    });
+    return std::monostate{};
 }
 
 // =============================================================================
@@ -171,18 +260,138 @@ commitment_result storage_commitment_scp::verify_instances(
     result.transaction_uid = transaction_uid;
     result.timestamp = std::chrono::system_clock::now();
 
-    for (const auto& ref : references) {
-        if (storage_ && storage_->exists(ref.sop_instance_uid)) {
-            result.success_references.push_back(ref);
-        } else {
+    std::vector<bool> present(references.size(), false);
+    if (storage_) {
+        std::vector<std::string> uids;
+        uids.reserve(references.size());
+        for (const auto& ref : references) {
+            uids.push_back(ref.sop_instance_uid);
+        }
+        present = storage_->exists_batch(uids);
+        present.resize(references.size(), false);
+    }
+
+    std::vector<bool> mismatched(references.size(), false);
+    if (config_.verify_checksums && hash_lookup_ && storage_) {
+        mismatched = find_checksum_mismatches(references, present);
+    }
+
+    for (size_t i = 0; i < references.size(); ++i) {
+        if (!present[i]) {
             result.failed_references.emplace_back(
-                ref, commitment_failure_reason::no_such_object_instance);
+                references[i], commitment_failure_reason::no_such_object_instance);
+        } else if (mismatched[i]) {
+            result.failed_references.emplace_back(
+                references[i], commitment_failure_reason::processing_failure);
+        } else {
+            result.success_references.push_back(references[i]);
         }
     }
 
     return result;
 }
 
+std::vector<bool> storage_commitment_scp::find_checksum_mismatches(
+    const std::vector<sop_reference>& references,
+    const std::vector<bool>& present) {
+
+    std::vector<bool> mismatched(references.size(), false);
+
+    std::vector<std::string> uids;
+    for (size_t i = 0; i < references.size(); ++i) {
+        if (present[i]) {
+            uids.push_back(references[i].sop_instance_uid);
+        }
+    }
+    const auto recorded = hash_lookup_(uids);
+
+    // Instances with a hash this SCP can recompute
+    std::vector<std::pair<size_t, std::string_view>> pending;
+    for (size_t i = 0; i < references.size(); ++i) {
+        if (!present[i]) {
+            continue;
+        }
+        auto it = recorded.find(references[i].sop_instance_uid);
+        if (it != recorded.end() && it->second.starts_with(kHashPrefix)) {
+            pending.emplace_back(i, it->second);
+        }
+    }
+
+    // Each index is written by exactly one worker; vector<bool> packs bits,
+    // so results go to a byte vector first
+    std::vector<uint8_t> failed(pending.size(), 0);
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        for (auto n = next++; n < pending.size(); n = next++) {
+            const auto& [index, expected] = pending[n];
+            auto actual = hash_stored_instance(
+                *storage_, references[index].sop_instance_uid);
+            failed[n] = actual != expected ? 1 : 0;
+        }
+    };
+
+    const auto threads = std::min(std::max<size_t>(config_.checksum_threads, 1),
+                                  pending.size());
+    if (threads <= 1) {
+        worker();
+    } else {
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back(worker);
+        }
+        for (auto& thread : workers) {
+            thread.join();
+        }
+    }
+
+    for (size_t n = 0; n < pending.size(); ++n) {
+        if (failed[n] != 0) {
+            mismatched[pending[n].first] = true;
+            logger_->warn("Storage Commitment: checksum mismatch for " +
+                          references[pending[n].first].sop_instance_uid);
+        }
+    }
+    return mismatched;
+}
+
+// =============================================================================
+// Asynchronous Reporting
+// =============================================================================
+
+void storage_commitment_scp::enqueue_report(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(report_mutex_);
+        report_queue_.push_back(std::move(job));
+        if (!report_worker_.joinable()) {
+            report_worker_ = std::thread([this] { run_report_worker(); });
+        }
+    }
+    report_cv_.notify_all();
+}
+
+void storage_commitment_scp::run_report_worker() {
+    std::unique_lock<std::mutex> lock(report_mutex_);
+    for (;;) {
+        // Pending requests are still answered while stopping
+        report_cv_.wait(lock, [this] {
+            return stopping_ || !report_queue_.empty();
+        });
+        if (report_queue_.empty()) {
+            return;
+        }
+
+        auto job = std::move(report_queue_.front());
+        report_queue_.pop_front();
+        ++reports_running_;
+        lock.unlock();
+        job();
+        lock.lock();
+        --reports_running_;
+        report_cv_.notify_all();
+    }
+}
+
 // =============================================================================
 // N-EVENT-REPORT Sender
 // =============================================================================
@@ -192,6 +401,12 @@ network::Result<std::monostate> storage_commitment_scp::send_event_report(
     uint8_t context_id,
     const commitment_result& result) {
 
+    return assoc.send_dimse(context_id, build_event_report(result));
+}
+
+network::dimse::dimse_message storage_commitment_scp::build_event_report(
+    const commitment_result& result) {
+
     using namespace network::dimse;
 
     // Determine event type: 1 = all success, 2 = failures exist
@@ -210,8 +425,7 @@ network::Result<std::monostate> storage_commitment_scp::send_event_report(
     auto event_dataset = build_event_report_dataset(result);
     event_rq.set_dataset(std::move(event_dataset));
 
-    // Send N-EVENT-REPORT-RQ
-    return assoc.send_dimse(context_id, event_rq);
+    return event_rq;
 }
 
 // =============================================================================
@@ -0,0 +1,276 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file transcode_cache.cpp
+ * @brief Implementation of the on-disk transcode cache
+ */
+
+#include "kcenon/pacs/services/transcoding/transcode_cache.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <utility>
+
+namespace kcenon::pacs::services {
+
+namespace {
+
+/// File extension for cache entries
+constexpr std::string_view kEntryExtension = ".dcm";
+
+/// Separator between the SOP Instance UID, Transfer Syntax UID and source
+/// digest in file names
+constexpr char kKeySeparator = '@';
+
+/// UIDs are restricted to digits and dots (PS3.5 Section 9.1)
+auto is_valid_uid(std::string_view uid) -> bool {
+    return !uid.empty() && uid.size() <= 64 &&
+           std::all_of(uid.begin(), uid.end(), [](char c) {
+               return (c >= '0' && c <= '9') || c == '.';
+           });
+}
+
+/// Digests such as "xxh64:<hex>"; ':' is stored as '-' in file names
+auto is_valid_digest(std::string_view digest) -> bool {
+    return !digest.empty() && digest.size() <= 64 &&
+           std::all_of(digest.begin(), digest.end(), [](char c) {
+               return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+                      (c >= 'A' && c <= 'Z') || c == ':' || c == '-';
+           });
+}
+
+}  // namespace
+
+transcode_cache::transcode_cache(std::filesystem::path directory,
+                                 std::size_t max_bytes)
+    : directory_(std::move(directory)), max_bytes_(max_bytes) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    load_existing();
+}
+
+auto transcode_cache::make_key(std::string_view sop_instance_uid,
+                               std::string_view transfer_syntax_uid,
+                               std::string_view source_digest)
+    -> std::optional<std::string> {
+    if (!is_valid_uid(sop_instance_uid) || !is_valid_uid(transfer_syntax_uid) ||
+        !is_valid_digest(source_digest)) {
+        return std::nullopt;
+    }
+    std::string key;
+    key.reserve(sop_instance_uid.size() + transfer_syntax_uid.size() +
+                source_digest.size() + 2);
+    key.append(sop_instance_uid);
+    key.push_back(kKeySeparator);
+    key.append(transfer_syntax_uid);
+    key.push_back(kKeySeparator);
+    std::replace_copy(source_digest.begin(), source_digest.end(),
+                      std::back_inserter(key), ':', '-');
+    return key;
+}
+
+auto transcode_cache::path_for(const std::string& key) const
+    -> std::filesystem::path {
+    return directory_ / (key + std::string(kEntryExtension));
+}
+
+void transcode_cache::load_existing() {
+    std::error_code ec;
+    if (!std::filesystem::is_directory(directory_, ec)) {
+        return;
+    }
+
+    struct found {
+        std::string key;
+        std::size_t size;
+        std::filesystem::file_time_type mtime;
+    };
+    std::vector<found> entries;
+
+    for (const auto& dirent :
+         std::filesystem::directory_iterator(directory_, ec)) {
+        if (!dirent.is_regular_file(ec)) {
+            continue;
+        }
+        const auto& path = dirent.path();
+        if (path.extension() != kEntryExtension) {
+            // Leftover temporary files from an interrupted write
+            std::filesystem::remove(path, ec);
+            continue;
+        }
+        const auto stem = path.stem().string();
+        const auto first = stem.find(kKeySeparator);
+        const auto second = first == std::string::npos
+                                ? std::string::npos
+                                : stem.find(kKeySeparator, first + 1);
+        if (second == std::string::npos) {
+            // Entries written before keys carried a source digest can never
+            // be validated against the stored bytes
+            if (first != std::string::npos) {
+                std::filesystem::remove(path, ec);
+            }
+            continue;
+        }
+        const std::string_view view(stem);
+        if (!make_key(view.substr(0, first),
+                      view.substr(first + 1, second - first - 1),
+                      view.substr(second + 1))) {
+            continue;
+        }
+        entries.push_back(found{stem,
+                                static_cast<std::size_t>(dirent.file_size(ec)),
+                                dirent.last_write_time(ec)});
+    }
+
+    // Newest first so the LRU order survives a restart
+    std::sort(entries.begin(), entries.end(),
+              [](const found& a, const found& b) { return a.mtime > b.mtime; });
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& e : entries) {
+        lru_.push_back(entry{e.key, e.size});
+        index_[e.key] = std::prev(lru_.end());
+        total_bytes_ += e.size;
+    }
+    evict_to_fit(0);
+}
+
+auto transcode_cache::get(std::string_view sop_instance_uid,
+                          std::string_view transfer_syntax_uid,
+                          std::string_view source_digest)
+    -> std::optional<std::vector<uint8_t>> {
+    const auto key = make_key(sop_instance_uid, transfer_syntax_uid, source_digest);
+    if (!key) {
+        return std::nullopt;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(*key);
+    if (it == index_.end()) {
+        return std::nullopt;
+    }
+
+    std::ifstream in(path_for(*key), std::ios::binary | std::ios::ate);
+    if (!in) {
+        // File vanished underneath us; forget the entry
+        erase_locked(it->second);
+        return std::nullopt;
+    }
+
+    const auto size = in.tellg();
+    in.seekg(0, std::ios::beg);
+    std::vector<uint8_t> data(static_cast<std::size_t>(size));
+    if (!in.read(reinterpret_cast<char*>(data.data()), size)) {
+        erase_locked(it->second);
+        return std::nullopt;
+    }
+
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return data;
+}
+
+auto transcode_cache::put(std::string_view sop_instance_uid,
+                          std::string_view transfer_syntax_uid,
+                          std::string_view source_digest,
+                          std::span<const uint8_t> data) -> bool {
+    const auto key = make_key(sop_instance_uid, transfer_syntax_uid, source_digest);
+    if (!key || data.size() > max_bytes_) {
+        return false;
+    }
+
+    const auto final_path = path_for(*key);
+    auto temp_path = final_path;
+    temp_path += ".tmp";
+
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out ||
+            !out.write(reinterpret_cast<const char*>(data.data()),
+                       static_cast<std::streamsize>(data.size()))) {
+            std::error_code ec;
+            std::filesystem::remove(temp_path, ec);
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (auto it = index_.find(*key); it != index_.end()) {
+        total_bytes_ -= it->second->size;
+        lru_.erase(it->second);
+        index_.erase(it);
+    }
+    // Encodings of older source bytes can no longer be served
+    erase_prefix_locked(key->substr(0, key->rfind(kKeySeparator) + 1));
+    evict_to_fit(data.size());
+
+    std::error_code ec;
+    std::filesystem::rename(temp_path, final_path, ec);
+    if (ec) {
+        std::filesystem::remove(temp_path, ec);
+        return false;
+    }
+
+    lru_.push_front(entry{*key, data.size()});
+    index_[*key] = lru_.begin();
+    total_bytes_ += data.size();
+    return true;
+}
+
+void transcode_cache::invalidate(std::string_view sop_instance_uid) {
+    std::string prefix(sop_instance_uid);
+    prefix.push_back(kKeySeparator);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    erase_prefix_locked(prefix);
+}
+
+void transcode_cache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (!lru_.empty()) {
+        erase_locked(lru_.begin());
+    }
+}
+
+auto transcode_cache::size_bytes() const -> std::size_t {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return total_bytes_;
+}
+
+auto transcode_cache::entry_count() const -> std::size_t {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lru_.size();
+}
+
+auto transcode_cache::directory() const -> const std::filesystem::path& {
+    return directory_;
+}
+
+void transcode_cache::evict_to_fit(std::size_t incoming) {
+    while (!lru_.empty() && total_bytes_ + incoming > max_bytes_) {
+        erase_locked(std::prev(lru_.end()));
+    }
+}
+
+void transcode_cache::erase_locked(std::list<entry>::iterator it) {
+    std::error_code ec;
+    std::filesystem::remove(path_for(it->key), ec);
+    total_bytes_ -= it->size;
+    index_.erase(it->key);
+    lru_.erase(it);
+}
+
+void transcode_cache::erase_prefix_locked(const std::string& prefix) {
+    for (auto it = lru_.begin(); it != lru_.end();) {
+        auto next = std::next(it);
+        if (it->key.compare(0, prefix.size(), prefix) == 0) {
+            erase_locked(it);
+        }
+        it = next;
+    }
+}
+
+}  // namespace kcenon::pacs::services
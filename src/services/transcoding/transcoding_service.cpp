@@ -0,0 +1,151 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file transcoding_service.cpp
+ * @brief Implementation of on-the-fly transfer syntax conversion
+ */
+
+#include "kcenon/pacs/services/transcoding/transcoding_service.h"
+
+#include "kcenon/pacs/core/dicom_tag_constants.h"
+#include "kcenon/pacs/encoding/compression/pixel_data_transcoder.h"
+#include "kcenon/pacs/monitoring/pacs_metrics.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace kcenon::pacs::services {
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+transcoding_service::transcoding_service(
+    transcoding_config config,
+    std::shared_ptr<integration::thread_pool_interface> thread_pool)
+    : config_(std::move(config)), thread_pool_(std::move(thread_pool)) {
+    if (!config_.cache_directory.empty()) {
+        cache_ = std::make_unique<transcode_cache>(config_.cache_directory,
+                                                   config_.cache_max_bytes);
+    }
+}
+
+transcoding_service::~transcoding_service() = default;
+
+auto transcoding_service::cache() noexcept -> transcode_cache* {
+    return cache_.get();
+}
+
+auto transcoding_service::config() const noexcept -> const transcoding_config& {
+    return config_;
+}
+
+// =============================================================================
+// Capability
+// =============================================================================
+
+auto transcoding_service::can_transcode(
+    const encoding::transfer_syntax& source,
+    const encoding::transfer_syntax& target) const -> bool {
+    return encoding::compression::can_transcode(source, target, config_.allow_lossy);
+}
+
+auto transcoding_service::select_target(
+    const encoding::transfer_syntax& source,
+    std::span<const std::string> acceptable) const
+    -> std::optional<encoding::transfer_syntax> {
+    for (const auto& uid : acceptable) {
+        if (uid == source.uid()) {
+            return source;
+        }
+    }
+    for (const auto& uid : acceptable) {
+        auto ts = encoding::find_transfer_syntax(uid);
+        if (ts && can_transcode(source, *ts)) {
+            return ts;
+        }
+    }
+    return std::nullopt;
+}
+
+// =============================================================================
+// Conversion
+// =============================================================================
+
+auto transcoding_service::transcode(const core::dicom_file& file,
+                                    const encoding::transfer_syntax& target)
+    -> Result<core::dicom_file> {
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t frames = 0;
+
+    auto result = convert(file, target, frames);
+
+    if (config_.enable_metrics && frames > 0) {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        monitoring::pacs_metrics::global_metrics().transcoding().record_conversion(
+            result.is_ok(), elapsed, frames);
+    }
+    return result;
+}
+
+auto transcoding_service::transcode_to_bytes(const core::dicom_file& file,
+                                             const encoding::transfer_syntax& target,
+                                             std::string_view source_digest)
+    -> Result<std::vector<uint8_t>> {
+    const auto sop_uid = file.sop_instance_uid();
+    const bool use_cache =
+        cache_ && !source_digest.empty() && file.transfer_syntax() != target;
+
+    if (use_cache) {
+        auto cached = cache_->get(sop_uid, target.uid(), source_digest);
+        if (config_.enable_metrics) {
+            monitoring::pacs_metrics::global_metrics().transcoding().record_cache_lookup(
+                cached.has_value());
+        }
+        if (cached) {
+            return Result<std::vector<uint8_t>>::ok(std::move(*cached));
+        }
+    }
+
+    auto converted = transcode(file, target);
+    if (converted.is_err()) {
+        return Result<std::vector<uint8_t>>::err(converted.error());
+    }
+
+    auto bytes = converted.value().to_bytes();
+    if (use_cache) {
+        cache_->put(sop_uid, target.uid(), source_digest, bytes);
+    }
+    return Result<std::vector<uint8_t>>::ok(std::move(bytes));
+}
+
+auto transcoding_service::convert(const core::dicom_file& file,
+                                  const encoding::transfer_syntax& target,
+                                  std::size_t& frames)
+    -> Result<core::dicom_file> {
+    const auto source = file.transfer_syntax();
+    const auto& dataset = file.dataset();
+    if (source != target && dataset.contains(core::tags::pixel_data) &&
+        (source.is_encapsulated() || target.is_encapsulated())) {
+        frames = encoding::compression::read_image_params(dataset).number_of_frames;
+    }
+
+    encoding::compression::transcode_options options;
+    options.allow_lossy = config_.allow_lossy;
+    options.encode_options = config_.encode_options;
+    options.parallel = parallel_options();
+    return encoding::compression::transcode_file(file, target, options);
+}
+
+auto transcoding_service::parallel_options() const
+    -> encoding::compression::frame_parallel_options {
+    encoding::compression::frame_parallel_options parallel;
+    parallel.max_workers = config_.max_parallel_frames;
+    parallel.thread_pool = thread_pool_;
+    return parallel;
+}
+
+}  // namespace kcenon::pacs::services
@@ -0,0 +1,94 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file access_tracker.cpp
+ * @brief Implementation of the sharded access time buffer
+ */
+
+#include <kcenon/pacs/storage/access_tracker.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace kcenon::pacs::storage {
+
+/**
+ * @brief One independently locked partition, padded to its own cache line
+ */
+struct alignas(64) access_tracker::shard {
+    std::mutex mutex;
+    std::unordered_map<std::string, clock::time_point> entries;
+};
+
+access_tracker::access_tracker(clock::duration granularity,
+                               std::size_t shard_count)
+    : granularity_((std::max)(granularity, clock::duration{1})),
+      shard_count_((std::max)(shard_count, std::size_t{1})),
+      shards_(std::make_unique<shard[]>(shard_count_)) {}
+
+access_tracker::~access_tracker() = default;
+
+void access_tracker::record(std::string_view uid) {
+    record(uid, clock::now());
+}
+
+void access_tracker::record(std::string_view uid, clock::time_point when) {
+    const auto since_epoch = when.time_since_epoch();
+    const auto coarse =
+        clock::time_point{since_epoch - since_epoch % granularity_};
+
+    auto& s = shard_for(uid);
+    std::lock_guard lock(s.mutex);
+    auto [it, inserted] = s.entries.try_emplace(std::string(uid), coarse);
+    if (inserted) {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+    } else if (it->second < coarse) {
+        it->second = coarse;
+    }
+}
+
+auto access_tracker::last_access(std::string_view uid) const
+    -> std::optional<clock::time_point> {
+    auto& s = shard_for(uid);
+    std::lock_guard lock(s.mutex);
+    auto it = s.entries.find(std::string(uid));
+    if (it == s.entries.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+auto access_tracker::drain()
+    -> std::vector<std::pair<std::string, clock::time_point>> {
+    std::vector<std::pair<std::string, clock::time_point>> drained;
+    drained.reserve(pending_.load(std::memory_order_relaxed));
+
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+        std::unordered_map<std::string, clock::time_point> entries;
+        {
+            std::lock_guard lock(shards_[i].mutex);
+            entries.swap(shards_[i].entries);
+        }
+        pending_.fetch_sub(entries.size(), std::memory_order_relaxed);
+        for (auto& entry : entries) {
+            drained.emplace_back(std::move(entry.first), entry.second);
+        }
+    }
+    return drained;
+}
+
+auto access_tracker::pending() const noexcept -> std::size_t {
+    return pending_.load(std::memory_order_relaxed);
+}
+
+auto access_tracker::granularity() const noexcept -> clock::duration {
+    return granularity_;
+}
+
+auto access_tracker::shard_for(std::string_view uid) const -> shard& {
+    return shards_[std::hash<std::string_view>{}(uid) % shard_count_];
+}
+
+}  // namespace kcenon::pacs::storage
@@ -18,9 +18,12 @@
 #include <kcenon/pacs/core/dicom_tag_constants.h>
 #include <kcenon/pacs/encoding/transfer_syntax.h>
 #include <kcenon/pacs/encoding/vr_type.h>
+#include <kcenon/pacs/storage/content_hash.h>
 
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <set>
 #include <sstream>
 
@@ -44,14 +47,14 @@ constexpr int kConnectionError = -6;
 constexpr int kIntegrityError = -7;
 constexpr int kSerializationError = -8;
 constexpr int kTierChangeError = -9;
+constexpr int kInvalidRange = -10;
 
 /**
  * @brief Generate a simple hash for content verification
  * @param data Data to hash
  * @return Hex string representation of hash
  */
-auto compute_content_hash(const std::vector<std::uint8_t> &data)
-    -> std::string {
+auto compute_content_hash(std::span<const std::uint8_t> data) -> std::string {
   std::size_t hash = 0;
   for (const auto &byte : data) {
     hash = hash * 31 + byte;
@@ -83,19 +86,26 @@ auto generate_block_id(std::size_t block_index) -> std::string {
  * @brief Abstract interface for Azure Blob client operations
  *
  * Both mock_azure_client and azure_sdk_client implement this interface,
- * allowing compile-time selection of the backend.
+ * allowing compile-time selection of the backend. All operations may be
+ * called concurrently; blocks are staged from several threads.
  */
 class azure_blob_storage::azure_client_interface {
 public:
   virtual ~azure_client_interface() = default;
 
   [[nodiscard]] virtual auto put_blob(const std::string &blob_name,
-                                      const std::vector<std::uint8_t> &data)
+                                      std::span<const std::uint8_t> data)
       -> VoidResult = 0;
 
   [[nodiscard]] virtual auto get_blob(const std::string &blob_name)
       -> Result<std::vector<std::uint8_t>> = 0;
 
+  /// Ranged download; the range is already resolved against the blob size
+  [[nodiscard]] virtual auto get_blob_range(const std::string &blob_name,
+                                            std::uint64_t offset,
+                                            std::uint64_t length)
+      -> Result<std::vector<std::uint8_t>> = 0;
+
   [[nodiscard]] virtual auto delete_blob(const std::string &blob_name)
       -> VoidResult = 0;
 
@@ -118,7 +128,7 @@ public:
 
   [[nodiscard]] virtual auto stage_block(
       const std::string &blob_name, const std::string &block_id,
-      const std::vector<std::uint8_t> &data) -> VoidResult = 0;
+      std::span<const std::uint8_t> data) -> VoidResult = 0;
 
   [[nodiscard]] virtual auto commit_blocks(
       const std::string &blob_name,
@@ -147,7 +157,7 @@ public:
       : connected_(true) {}
 
   [[nodiscard]] auto put_blob(const std::string &blob_name,
-                              const std::vector<std::uint8_t> &data)
+                              std::span<const std::uint8_t> data)
       -> VoidResult override {
     if (!connected_) {
       return make_error<std::monostate>(
@@ -155,10 +165,11 @@ public:
           "azure_blob_storage");
     }
     blob_data blob;
-    blob.data = data;
+    blob.data.assign(data.begin(), data.end());
     blob.etag = "\"" + compute_content_hash(data) + "\"";
     blob.content_md5 = compute_content_hash(data);
     blob.tier = "Hot";
+    std::lock_guard lock(mutex_);
     blobs_[blob_name] = std::move(blob);
     return ok();
   }
@@ -170,6 +181,7 @@ public:
           kConnectionError, "Azure client not connected",
           "azure_blob_storage");
     }
+    std::lock_guard lock(mutex_);
     auto it = blobs_.find(blob_name);
     if (it == blobs_.end()) {
       return make_error<std::vector<std::uint8_t>>(
@@ -179,6 +191,28 @@ public:
     return it->second.data;
   }
 
+  [[nodiscard]] auto get_blob_range(const std::string &blob_name,
+                                    std::uint64_t offset, std::uint64_t length)
+      -> Result<std::vector<std::uint8_t>> override {
+    if (!connected_) {
+      return make_error<std::vector<std::uint8_t>>(
+          kConnectionError, "Azure client not connected",
+          "azure_blob_storage");
+    }
+    std::lock_guard lock(mutex_);
+    auto it = blobs_.find(blob_name);
+    if (it == blobs_.end()) {
+      return make_error<std::vector<std::uint8_t>>(
+          kBlobNotFound, "Blob not found: " + blob_name,
+          "azure_blob_storage");
+    }
+    const auto &data = it->second.data;
+    const auto begin = (std::min)(static_cast<std::size_t>(offset), data.size());
+    const auto end =
+        (std::min)(begin + static_cast<std::size_t>(length), data.size());
+    return std::vector<std::uint8_t>(data.begin() + begin, data.begin() + end);
+  }
+
   [[nodiscard]] auto delete_blob(const std::string &blob_name)
       -> VoidResult override {
     if (!connected_) {
@@ -186,6 +220,7 @@ public:
           kConnectionError, "Azure client not connected",
           "azure_blob_storage");
     }
+    std::lock_guard lock(mutex_);
     blobs_.erase(blob_name);
     return ok();
   }
@@ -195,11 +230,13 @@ public:
     if (!connected_) {
       return false;
     }
+    std::lock_guard lock(mutex_);
     return blobs_.contains(blob_name);
   }
 
   [[nodiscard]] auto get_blob_size(const std::string &blob_name) const
       -> std::size_t override {
+    std::lock_guard lock(mutex_);
     auto it = blobs_.find(blob_name);
     if (it != blobs_.end()) {
       return it->second.data.size();
@@ -209,6 +246,7 @@ public:
 
   [[nodiscard]] auto get_blob_etag(const std::string &blob_name) const
       -> std::string override {
+    std::lock_guard lock(mutex_);
     auto it = blobs_.find(blob_name);
     if (it != blobs_.end()) {
       return it->second.etag;
@@ -218,6 +256,7 @@ public:
 
   [[nodiscard]] auto get_blob_md5(const std::string &blob_name) const
       -> std::string override {
+    std::lock_guard lock(mutex_);
     auto it = blobs_.find(blob_name);
     if (it != blobs_.end()) {
       return it->second.content_md5;
@@ -227,6 +266,7 @@ public:
 
   [[nodiscard]] auto list_blobs() const
       -> std::vector<std::string> override {
+    std::lock_guard lock(mutex_);
     std::vector<std::string> names;
     names.reserve(blobs_.size());
     for (const auto &[name, data] : blobs_) {
@@ -241,14 +281,15 @@ public:
 
   [[nodiscard]] auto stage_block(const std::string &blob_name,
                                  const std::string &block_id,
-                                 const std::vector<std::uint8_t> &data)
+                                 std::span<const std::uint8_t> data)
       -> VoidResult override {
     if (!connected_) {
       return make_error<std::monostate>(
           kConnectionError, "Azure client not connected",
           "azure_blob_storage");
     }
-    staged_blocks_[blob_name][block_id] = data;
+    std::lock_guard lock(mutex_);
+    staged_blocks_[blob_name][block_id].assign(data.begin(), data.end());
     return ok();
   }
 
@@ -261,6 +302,7 @@ public:
           "azure_blob_storage");
     }
 
+    std::lock_guard lock(mutex_);
     auto it = staged_blocks_.find(blob_name);
     if (it == staged_blocks_.end()) {
       return make_error<std::monostate>(
@@ -299,6 +341,7 @@ public:
           kConnectionError, "Azure client not connected",
           "azure_blob_storage");
     }
+    std::lock_guard lock(mutex_);
     auto it = blobs_.find(blob_name);
     if (it == blobs_.end()) {
       return make_error<std::monostate>(
@@ -322,6 +365,7 @@ private:
                      std::unordered_map<std::string, std::vector<std::uint8_t>>>
       staged_blocks_;
   bool connected_;
+  mutable std::mutex mutex_;
 };
 
 // ============================================================================
@@ -355,11 +399,11 @@ public:
   }
 
   [[nodiscard]] auto put_blob(const std::string &blob_name,
-                              const std::vector<std::uint8_t> &data)
+                              std::span<const std::uint8_t> data)
       -> VoidResult override {
     try {
       auto blob_client = container_client_->GetBlockBlobClient(blob_name);
-      Azure::Core::IO::MemoryBodyStream stream(data);
+      Azure::Core::IO::MemoryBodyStream stream(data.data(), data.size());
       blob_client.Upload(stream);
       return ok();
     } catch (const Azure::Storage::StorageException &e) {
@@ -394,6 +438,40 @@ public:
     }
   }
 
+  [[nodiscard]] auto get_blob_range(const std::string &blob_name,
+                                    std::uint64_t offset, std::uint64_t length)
+      -> Result<std::vector<std::uint8_t>> override {
+    if (length == 0) {
+      return std::vector<std::uint8_t>{};
+    }
+    try {
+      auto blob_client = container_client_->GetBlobClient(blob_name);
+      Azure::Storage::Blobs::DownloadBlobOptions options;
+      Azure::Core::Http::HttpRange http_range;
+      http_range.Offset = static_cast<std::int64_t>(offset);
+      http_range.Length = static_cast<std::int64_t>(length);
+      options.Range = http_range;
+
+      auto response = blob_client.Download(options);
+      auto &body = response.Value.BodyStream;
+
+      std::vector<std::uint8_t> result(
+          static_cast<std::size_t>(body->Length()));
+      body->ReadToCount(result.data(), result.size());
+      return result;
+    } catch (const Azure::Storage::StorageException &e) {
+      if (e.StatusCode == Azure::Core::Http::HttpStatusCode::NotFound) {
+        return make_error<std::vector<std::uint8_t>>(
+            kBlobNotFound, "Blob not found: " + blob_name,
+            "azure_blob_storage");
+      }
+      return make_error<std::vector<std::uint8_t>>(
+          kDownloadError,
+          "Azure ranged GetBlob failed: " + std::string(e.what()),
+          "azure_blob_storage");
+    }
+  }
+
   [[nodiscard]] auto delete_blob(const std::string &blob_name)
       -> VoidResult override {
     try {
@@ -483,11 +561,11 @@ public:
 
   [[nodiscard]] auto stage_block(const std::string &blob_name,
                                  const std::string &block_id,
-                                 const std::vector<std::uint8_t> &data)
+                                 std::span<const std::uint8_t> data)
       -> VoidResult override {
     try {
       auto blob_client = container_client_->GetBlockBlobClient(blob_name);
-      Azure::Core::IO::MemoryBodyStream stream(data);
+      Azure::Core::IO::MemoryBodyStream stream(data.data(), data.size());
       blob_client.StageBlock(block_id, stream);
       return ok();
     } catch (const Azure::Storage::StorageException &e) {
@@ -570,9 +648,21 @@ auto azure_blob_storage::store(const core::dicom_dataset &dataset)
   return store_with_progress(dataset, nullptr);
 }
 
-auto azure_blob_storage::store_with_progress(
-    const core::dicom_dataset &dataset, azure_progress_callback callback)
-    -> VoidResult {
+auto azure_blob_storage::store_with_progress(const core::dicom_dataset &dataset,
+                                            azure_progress_callback callback) -> VoidResult {
+  return upload_file(core::dicom_file::create(
+                         dataset, encoding::transfer_syntax::explicit_vr_little_endian),
+                     std::move(callback));
+}
+
+auto azure_blob_storage::store_file(const core::dicom_file &file) -> VoidResult {
+  return upload_file(file, nullptr);
+}
+
+auto azure_blob_storage::upload_file(const core::dicom_file &file,
+                                    azure_progress_callback callback) -> VoidResult {
+  const auto &dataset = file.dataset();
+
   // Extract required UIDs
   auto study_uid = dataset.get_string(core::tags::study_instance_uid);
   auto series_uid = dataset.get_string(core::tags::series_instance_uid);
@@ -585,36 +675,57 @@ auto azure_blob_storage::store_with_progress(
         "azure_blob_storage");
   }
 
-  // Build blob name
-  auto blob_name = build_blob_name(study_uid, series_uid, sop_uid);
-
-  // Create DICOM file and serialize to bytes
-  auto dicom_file = core::dicom_file::create(
-      dataset, encoding::transfer_syntax::explicit_vr_little_endian);
-
-  auto data = dicom_file.to_bytes();
+  // Serialize to Part 10 bytes in the file's own transfer syntax
+  auto data = file.to_bytes();
   if (data.empty()) {
     return make_error<std::monostate>(kSerializationError,
                                       "Failed to serialize DICOM dataset",
                                       "azure_blob_storage");
   }
 
+  memory_byte_source source(std::move(data));
+  return upload_blob(study_uid, series_uid, sop_uid, source,
+                     std::move(callback));
+}
+
+auto azure_blob_storage::upload_blob(const std::string &study_uid,
+                                     const std::string &series_uid,
+                                     const std::string &sop_uid,
+                                     byte_source &source,
+                                     azure_progress_callback callback)
+    -> VoidResult {
+  // Build blob name
+  auto blob_name = build_blob_name(study_uid, series_uid, sop_uid);
+  const auto size = static_cast<std::size_t>(source.size());
+
   // Report initial progress
-  if (callback && !callback(0, data.size())) {
+  if (callback && !callback(0, size)) {
     return make_error<std::monostate>(kUploadError, "Upload cancelled by user",
                                       "azure_blob_storage");
   }
 
   // Upload to Azure (use block blob for large files)
   VoidResult upload_result = ok();
-  if (data.size() > config_.block_upload_threshold) {
-    upload_result = upload_block_blob(blob_name, data, callback);
+  if (size > config_.block_upload_threshold) {
+    upload_result = upload_block_blob(blob_name, source, callback);
   } else {
-    upload_result = client_->put_blob(blob_name, data);
+    auto body = source.contiguous();
+    std::vector<std::uint8_t> buffered;
+    if (body.empty() && size > 0) {
+      auto data = source.read_all();
+      if (data.is_err()) {
+        return make_error<std::monostate>(data.error().code,
+                                          data.error().message,
+                                          "azure_blob_storage");
+      }
+      buffered = std::move(data.value());
+      body = buffered;
+    }
+    upload_result = client_->put_blob(blob_name, body);
 
     // Report completion progress
     if (callback) {
-      callback(data.size(), data.size());
+      callback(size, size);
     }
   }
 
@@ -630,7 +741,7 @@ auto azure_blob_storage::store_with_progress(
     info.sop_instance_uid = sop_uid;
     info.study_instance_uid = study_uid;
     info.series_instance_uid = series_uid;
-    info.size_bytes = data.size();
+    info.size_bytes = size;
     info.etag = client_->get_blob_etag(blob_name);
     info.content_md5 = client_->get_blob_md5(blob_name);
     index_[sop_uid] = std::move(info);
@@ -639,53 +750,147 @@ auto azure_blob_storage::store_with_progress(
   return ok();
 }
 
+auto azure_blob_storage::store_stream(byte_source &source)
+    -> Result<stored_instance> {
+  // Mapped and in-memory sources are identified and uploaded in place
+  std::optional<memory_byte_source> buffered;
+  byte_source *body = &source;
+  if (source.contiguous().empty()) {
+    auto data = source.read_all();
+    if (data.is_err()) {
+      return make_error<stored_instance>(data.error().code,
+                                         data.error().message,
+                                         "azure_blob_storage");
+    }
+    body = &buffered.emplace(std::move(data.value()));
+  }
+
+  auto identity = identify_part10(body->contiguous());
+  if (identity.is_err()) {
+    return identity;
+  }
+  const auto &info = identity.value();
+
+  auto uploaded = upload_blob(info.study_instance_uid, info.series_instance_uid,
+                              info.sop_instance_uid, *body, nullptr);
+  if (uploaded.is_err()) {
+    return make_error<stored_instance>(uploaded.error().code,
+                                       uploaded.error().message,
+                                       "azure_blob_storage");
+  }
+  return identity;
+}
+
+auto azure_blob_storage::replace_file(const core::dicom_file &file)
+    -> Result<stored_instance> {
+  auto data = file.to_bytes();
+  content_hasher hasher;
+  hasher.update(data);
+
+  memory_byte_source source(std::move(data));
+  auto stored = store_stream(source);
+  if (stored.is_ok()) {
+    stored.value().content_hash = hasher.hex_digest();
+  }
+  return stored;
+}
+
+auto azure_blob_storage::open_read(std::string_view sop_instance_uid,
+                                   byte_range range)
+    -> Result<std::unique_ptr<byte_source>> {
+  auto blob = find_blob(sop_instance_uid);
+  if (!blob) {
+    return make_error<std::unique_ptr<byte_source>>(
+        kBlobNotFound,
+        "Instance not found: " + std::string{sop_instance_uid},
+        "azure_blob_storage");
+  }
+
+  auto resolved = range.resolve(blob->second);
+  if (!resolved) {
+    return make_error<std::unique_ptr<byte_source>>(
+        kInvalidRange, "Byte range starts past the end of the blob",
+        "azure_blob_storage");
+  }
+
+  std::vector<std::uint8_t> data;
+  data.reserve(static_cast<std::size_t>(resolved->length));
+  auto downloaded = download_range(
+      blob->first, blob->second, *resolved,
+      [&data](std::span<const std::uint8_t> part) -> VoidResult {
+        data.insert(data.end(), part.begin(), part.end());
+        return ok();
+      },
+      nullptr);
+  if (downloaded.is_err()) {
+    return make_error<std::unique_ptr<byte_source>>(
+        kDownloadError,
+        "Failed to download from Azure: " + downloaded.error().message,
+        "azure_blob_storage");
+  }
+
+  return std::unique_ptr<byte_source>(
+      std::make_unique<memory_byte_source>(std::move(data)));
+}
+
 auto azure_blob_storage::retrieve(std::string_view sop_instance_uid)
     -> Result<core::dicom_dataset> {
   return retrieve_with_progress(sop_instance_uid, nullptr);
 }
 
-auto azure_blob_storage::retrieve_with_progress(
-    std::string_view sop_instance_uid, azure_progress_callback callback)
+auto azure_blob_storage::retrieve_with_progress(std::string_view sop_instance_uid,
+                                               azure_progress_callback callback)
     -> Result<core::dicom_dataset> {
-  std::string blob_name;
+  auto file = download_file(sop_instance_uid, std::move(callback));
+  if (file.is_err()) {
+    return make_error<core::dicom_dataset>(
+        file.error().code, file.error().message, "azure_blob_storage");
+  }
+  return file.value().dataset();
+}
 
-  {
-    std::shared_lock lock(mutex_);
-    auto it = index_.find(std::string{sop_instance_uid});
-    if (it == index_.end()) {
-      return make_error<core::dicom_dataset>(
-          kBlobNotFound,
-          "Instance not found: " + std::string{sop_instance_uid},
-          "azure_blob_storage");
-    }
-    blob_name = it->second.blob_name;
+auto azure_blob_storage::retrieve_file(std::string_view sop_instance_uid)
+    -> Result<core::dicom_file> {
+  return download_file(sop_instance_uid, nullptr);
+}
+
+auto azure_blob_storage::download_file(std::string_view sop_instance_uid,
+                                      azure_progress_callback callback)
+    -> Result<core::dicom_file> {
+  auto blob = find_blob(sop_instance_uid);
+  if (!blob) {
+    return make_error<core::dicom_file>(
+        kBlobNotFound,
+        "Instance not found: " + std::string{sop_instance_uid},
+        "azure_blob_storage");
   }
 
   // Download from Azure
-  auto download_result = client_->get_blob(blob_name);
-  if (download_result.is_err()) {
-    return make_error<core::dicom_dataset>(kDownloadError,
+  std::vector<std::uint8_t> data;
+  data.reserve(static_cast<std::size_t>(blob->second));
+  auto downloaded = download_range(
+      blob->first, blob->second, byte_range{0, blob->second},
+      [&data](std::span<const std::uint8_t> part) -> VoidResult {
+        data.insert(data.end(), part.begin(), part.end());
+        return ok();
+      },
+      std::move(callback));
+  if (downloaded.is_err()) {
+    return make_error<core::dicom_file>(kDownloadError,
                                            "Failed to download from Azure",
                                            "azure_blob_storage");
   }
 
-  const auto &data = download_result.value();
-
-  // Report progress (download complete)
-  if (callback) {
-    callback(data.size(), data.size());
-  }
-
   // Deserialize DICOM data
   auto parse_result = core::dicom_file::from_bytes(data);
   if (parse_result.is_err()) {
-    return make_error<core::dicom_dataset>(
+    return make_error<core::dicom_file>(
         kSerializationError,
         "Failed to parse DICOM data: " + parse_result.error().message,
         "azure_blob_storage");
   }
 
-  return parse_result.value().dataset();
+  return std::move(parse_result.value());
 }
 
 auto azure_blob_storage::remove(std::string_view sop_instance_uid)
@@ -716,6 +921,18 @@ auto azure_blob_storage::exists(std::string_view sop_instance_uid) const
   return index_.contains(std::string{sop_instance_uid});
 }
 
+auto azure_blob_storage::exists_batch(
+    const std::vector<std::string> &sop_instance_uids) const
+    -> std::vector<bool> {
+  std::vector<bool> found;
+  found.reserve(sop_instance_uids.size());
+  std::shared_lock lock(mutex_);
+  for (const auto &uid : sop_instance_uids) {
+    found.push_back(index_.contains(uid));
+  }
+  return found;
+}
+
 auto azure_blob_storage::find(const core::dicom_dataset &query)
     -> Result<std::vector<core::dicom_dataset>> {
   std::vector<core::dicom_dataset> results;
@@ -868,6 +1085,52 @@ auto azure_blob_storage::is_connected() const -> bool {
   return client_ && client_->is_connected();
 }
 
+auto azure_blob_storage::download_to_file(std::string_view sop_instance_uid,
+                                          const std::filesystem::path &path,
+                                          azure_progress_callback callback)
+    -> VoidResult {
+  auto blob = find_blob(sop_instance_uid);
+  if (!blob) {
+    return make_error<std::monostate>(
+        kBlobNotFound,
+        "Instance not found: " + std::string{sop_instance_uid},
+        "azure_blob_storage");
+  }
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    return make_error<std::monostate>(kDownloadError,
+                                      "Cannot create file: " + path.string(),
+                                      "azure_blob_storage");
+  }
+
+  auto downloaded = download_range(
+      blob->first, blob->second, byte_range{0, blob->second},
+      [&out, &path](std::span<const std::uint8_t> part) -> VoidResult {
+        out.write(reinterpret_cast<const char *>(part.data()),
+                  static_cast<std::streamsize>(part.size()));
+        if (!out) {
+          return make_error<std::monostate>(
+              kDownloadError, "Failed to write file: " + path.string(),
+              "azure_blob_storage");
+        }
+        return ok();
+      },
+      std::move(callback));
+  out.close();
+
+  if (downloaded.is_err() || !out) {
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    return downloaded.is_err()
+               ? downloaded
+               : make_error<std::monostate>(
+                     kDownloadError, "Failed to write file: " + path.string(),
+                     "azure_blob_storage");
+  }
+  return ok();
+}
+
 auto azure_blob_storage::set_access_tier(std::string_view sop_instance_uid,
                                          std::string_view tier) -> VoidResult {
   std::string blob_name;
@@ -926,53 +1189,101 @@ auto azure_blob_storage::sanitize_uid(std::string_view uid) -> std::string {
   return result;
 }
 
-auto azure_blob_storage::upload_block_blob(
-    const std::string &blob_name, const std::vector<std::uint8_t> &data,
-    azure_progress_callback callback) -> VoidResult {
-  std::size_t total_bytes = data.size();
-  std::size_t bytes_uploaded = 0;
-  std::vector<std::string> block_ids;
-
-  // Stage blocks
-  std::size_t block_index = 0;
-  while (bytes_uploaded < total_bytes) {
-    std::size_t block_size =
-        (std::min)(config_.block_size, total_bytes - bytes_uploaded);
-
-    auto block_id = generate_block_id(block_index);
-    block_ids.push_back(block_id);
+auto azure_blob_storage::upload_block_blob(const std::string &blob_name,
+                                           byte_source &source,
+                                           azure_progress_callback callback)
+    -> VoidResult {
+  auto staged = parallel_upload(
+      source, transfer_settings(),
+      [&](std::size_t block_index,
+          std::span<const std::uint8_t> data) -> VoidResult {
+        return client_->stage_block(blob_name, generate_block_id(block_index),
+                                    data);
+      },
+      callback);
+  if (staged.is_err()) {
+    // Uncommitted blocks are discarded by the service after a week
+    return make_error<std::monostate>(
+        kUploadError, "Failed to stage blocks: " + staged.error().message,
+        "azure_blob_storage");
+  }
 
-    std::vector<std::uint8_t> block_data(data.begin() + bytes_uploaded,
-                                         data.begin() + bytes_uploaded +
-                                             block_size);
+  // Commit blocks in order
+  std::vector<std::string> block_ids;
+  block_ids.reserve(staged.value().parts);
+  for (std::size_t i = 0; i < staged.value().parts; ++i) {
+    block_ids.push_back(generate_block_id(i));
+  }
+  auto commit_result = client_->commit_blocks(blob_name, block_ids);
+  if (commit_result.is_err()) {
+    return make_error<std::monostate>(kUploadError, "Failed to commit blocks",
+                                      "azure_blob_storage");
+  }
 
-    auto stage_result = client_->stage_block(blob_name, block_id, block_data);
-    if (stage_result.is_err()) {
-      return make_error<std::monostate>(kUploadError,
-                                        "Failed to stage block: " + block_id,
-                                        "azure_blob_storage");
-    }
+  return ok();
+}
 
-    bytes_uploaded += block_size;
-    block_index++;
+auto azure_blob_storage::find_blob(std::string_view sop_instance_uid) const
+    -> std::optional<std::pair<std::string, std::uint64_t>> {
+  std::shared_lock lock(mutex_);
+  auto it = index_.find(std::string{sop_instance_uid});
+  if (it == index_.end()) {
+    return std::nullopt;
+  }
+  return std::pair<std::string, std::uint64_t>{it->second.blob_name,
+                                               it->second.size_bytes};
+}
 
-    if (callback && !callback(bytes_uploaded, total_bytes)) {
-      return make_error<std::monostate>(kUploadError,
-                                        "Upload cancelled by user",
+auto azure_blob_storage::download_range(const std::string &blob_name,
+                                        std::uint64_t blob_size,
+                                        byte_range range,
+                                        const part_sink_fn &sink,
+                                        azure_progress_callback callback)
+    -> VoidResult {
+  if (range.length > config_.block_upload_threshold) {
+    auto downloaded = parallel_download(
+        range.length, transfer_settings(),
+        [&](std::uint64_t offset, std::uint64_t length) {
+          return client_->get_blob_range(blob_name, range.offset + offset,
+                                         length);
+        },
+        sink, callback);
+    if (downloaded.is_err()) {
+      return make_error<std::monostate>(downloaded.error().code,
+                                        downloaded.error().message,
                                         "azure_blob_storage");
     }
+    return ok();
   }
 
-  // Commit blocks
-  auto commit_result = client_->commit_blocks(blob_name, block_ids);
-  if (commit_result.is_err()) {
-    return make_error<std::monostate>(kUploadError, "Failed to commit blocks",
+  // Small blobs take one request; whole-blob reads skip the Range header
+  auto data = range.offset == 0 && range.length == blob_size
+                  ? client_->get_blob(blob_name)
+                  : client_->get_blob_range(blob_name, range.offset,
+                                            range.length);
+  if (data.is_err()) {
+    return make_error<std::monostate>(data.error().code, data.error().message,
                                       "azure_blob_storage");
   }
-
+  auto written = sink(data.value());
+  if (written.is_err()) {
+    return written;
+  }
+  if (callback) {
+    callback(data.value().size(), data.value().size());
+  }
   return ok();
 }
 
+auto azure_blob_storage::transfer_settings() const -> transfer_options {
+  transfer_options options;
+  options.part_size = config_.block_size;
+  options.max_in_flight = config_.max_concurrency;
+  options.max_retries = config_.max_retries;
+  options.retry_delay = std::chrono::milliseconds(config_.retry_delay_ms);
+  return options;
+}
+
 auto azure_blob_storage::matches_query(const core::dicom_dataset &dataset,
                                        const core::dicom_dataset &query)
     -> bool {
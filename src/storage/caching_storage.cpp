@@ -0,0 +1,690 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file caching_storage.cpp
+ * @brief Implementation of the read-through disk cache decorator
+ */
+
+#include <kcenon/pacs/storage/caching_storage.h>
+
+#include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/storage/content_hash.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <sstream>
+
+namespace kcenon::pacs::storage {
+
+using kcenon::common::make_error;
+
+namespace {
+
+/// Error codes for cache operations
+constexpr int kNoBackend = -220;
+constexpr int kCacheWriteError = -221;
+constexpr int kParseError = -222;
+constexpr int kInvalidRange = -223;
+constexpr int kStaleFill = -224;
+
+/// Chunk size for copying fetched objects into the cache
+constexpr std::size_t kCopyChunkSize = 1024 * 1024;
+
+/// Journal records beyond live entries tolerated before compaction
+constexpr std::size_t kJournalSlack = 1024;
+
+constexpr const char* kJournalName = "index.journal";
+
+/// Hex digits of an XXH64 digest, as used for object file names
+auto digest_hex(std::uint64_t digest) -> std::string {
+    char buffer[17];
+    std::snprintf(buffer, sizeof(buffer), "%016llx",
+                  static_cast<unsigned long long>(digest));
+    return buffer;
+}
+
+/// Digest of a file on disk, or nullopt if it cannot be read
+auto digest_file(const std::filesystem::path& path) -> std::optional<std::string> {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return std::nullopt;
+    }
+    content_hasher hasher;
+    std::vector<char> buffer(kCopyChunkSize);
+    while (in) {
+        in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        const auto n = static_cast<std::size_t>(in.gcount());
+        hasher.update(std::span<const std::uint8_t>(
+            reinterpret_cast<const std::uint8_t*>(buffer.data()), n));
+    }
+    if (in.bad()) {
+        return std::nullopt;
+    }
+    return digest_hex(hasher.digest());
+}
+
+/// Unique temporary file name within the cache directory
+auto temp_object_path(const std::filesystem::path& directory)
+    -> std::filesystem::path {
+    static std::atomic<std::uint64_t> counter{0};
+    return directory / "tmp" /
+           ("object.tmp." + std::to_string(counter.fetch_add(1)));
+}
+
+}  // namespace
+
+// ============================================================================
+// Construction / Destruction
+// ============================================================================
+
+caching_storage::caching_storage(std::shared_ptr<storage_interface> backend,
+                                 cache_config config)
+    : backend_(std::move(backend)), config_(std::move(config)) {
+    std::error_code ec;
+    std::filesystem::create_directories(config_.directory / "objects", ec);
+    std::filesystem::create_directories(config_.directory / "tmp", ec);
+
+    load_index();
+}
+
+caching_storage::~caching_storage() = default;
+
+// ============================================================================
+// storage_interface Implementation
+// ============================================================================
+
+auto caching_storage::store(const core::dicom_dataset& dataset) -> VoidResult {
+    if (!backend_) {
+        return make_error<std::monostate>(kNoBackend, "No storage backend",
+                                          "caching_storage");
+    }
+    auto result = backend_->store(dataset);
+    invalidate(dataset.get_string(core::tags::sop_instance_uid));
+    return result;
+}
+
+auto caching_storage::store_file(const core::dicom_file& file) -> VoidResult {
+    if (!backend_) {
+        return make_error<std::monostate>(kNoBackend, "No storage backend",
+                                          "caching_storage");
+    }
+    auto result = backend_->store_file(file);
+    invalidate(file.sop_instance_uid());
+    return result;
+}
+
+auto caching_storage::store_stream(byte_source& source)
+    -> Result<stored_instance> {
+    if (!backend_) {
+        return make_error<stored_instance>(kNoBackend, "No storage backend",
+                                           "caching_storage");
+    }
+    auto result = backend_->store_stream(source);
+    if (result.is_ok()) {
+        invalidate(result.value().sop_instance_uid);
+    }
+    return result;
+}
+
+auto caching_storage::retrieve(std::string_view sop_instance_uid)
+    -> Result<core::dicom_dataset> {
+    auto file = retrieve_file(sop_instance_uid);
+    if (file.is_err()) {
+        return make_error<core::dicom_dataset>(
+            file.error().code, file.error().message, "caching_storage");
+    }
+    return file.value().dataset();
+}
+
+auto caching_storage::retrieve_file(std::string_view sop_instance_uid)
+    -> Result<core::dicom_file> {
+    auto source = read_object(sop_instance_uid);
+    if (source.is_err()) {
+        return make_error<core::dicom_file>(
+            source.error().code, source.error().message, "caching_storage");
+    }
+
+    auto& object = *source.value();
+    std::vector<std::uint8_t> buffer;
+    auto bytes = object.contiguous();
+    if (bytes.empty()) {
+        auto drained = object.read_all();
+        if (drained.is_err()) {
+            return make_error<core::dicom_file>(drained.error().code,
+                                                drained.error().message,
+                                                "caching_storage");
+        }
+        buffer = std::move(drained.value());
+        bytes = buffer;
+    }
+
+    auto parsed = core::dicom_file::from_bytes(bytes);
+    if (parsed.is_err()) {
+        return make_error<core::dicom_file>(
+            kParseError, "Failed to parse DICOM data: " + parsed.error().message,
+            "caching_storage");
+    }
+    return std::move(parsed.value());
+}
+
+auto caching_storage::open_read(std::string_view sop_instance_uid,
+                                byte_range range)
+    -> Result<std::unique_ptr<byte_source>> {
+    if (!backend_) {
+        return make_error<std::unique_ptr<byte_source>>(
+            kNoBackend, "No storage backend", "caching_storage");
+    }
+
+    if (range.is_whole()) {
+        return read_object(sop_instance_uid);
+    }
+
+    auto cached = open_cached(sop_instance_uid, range);
+    if (cached.is_err() || cached.value()) {
+        return cached;
+    }
+
+    // Uncached: fetch just the range instead of the whole object
+    auto result = backend_->open_read(sop_instance_uid, range);
+    std::lock_guard lock(mutex_);
+    ++stats_.range_passthroughs;
+    if (result.is_ok()) {
+        stats_.bytes_from_backend += result.value()->size();
+    }
+    return result;
+}
+
+auto caching_storage::remove(std::string_view sop_instance_uid) -> VoidResult {
+    if (!backend_) {
+        return make_error<std::monostate>(kNoBackend, "No storage backend",
+                                          "caching_storage");
+    }
+    invalidate(sop_instance_uid);
+    return backend_->remove(sop_instance_uid);
+}
+
+auto caching_storage::exists(std::string_view sop_instance_uid) const -> bool {
+    return backend_ && backend_->exists(sop_instance_uid);
+}
+
+auto caching_storage::exists_batch(
+    const std::vector<std::string>& sop_instance_uids) const
+    -> std::vector<bool> {
+    if (!backend_) {
+        return std::vector<bool>(sop_instance_uids.size(), false);
+    }
+    return backend_->exists_batch(sop_instance_uids);
+}
+
+auto caching_storage::find(const core::dicom_dataset& query)
+    -> Result<std::vector<core::dicom_dataset>> {
+    if (!backend_) {
+        return make_error<std::vector<core::dicom_dataset>>(
+            kNoBackend, "No storage backend", "caching_storage");
+    }
+    return backend_->find(query);
+}
+
+auto caching_storage::get_statistics() const -> storage_statistics {
+    return backend_ ? backend_->get_statistics() : storage_statistics{};
+}
+
+auto caching_storage::verify_integrity() -> VoidResult {
+    if (!backend_) {
+        return make_error<std::monostate>(kNoBackend, "No storage backend",
+                                          "caching_storage");
+    }
+    return backend_->verify_integrity();
+}
+
+// ============================================================================
+// Cache Control
+// ============================================================================
+
+auto caching_storage::is_cached(std::string_view sop_instance_uid) const
+    -> bool {
+    std::lock_guard lock(mutex_);
+    return entries_.contains(std::string(sop_instance_uid));
+}
+
+void caching_storage::invalidate(std::string_view sop_instance_uid) {
+    std::lock_guard lock(mutex_);
+    const std::string uid(sop_instance_uid);
+
+    // Fills already fetching may hold bytes older than this invalidation
+    if (auto fill = pending_fills_.find(uid); fill != pending_fills_.end()) {
+        ++fill->second.generation;
+    }
+
+    auto it = entries_.find(uid);
+    if (it == entries_.end()) {
+        return;
+    }
+    erase_entry(it);
+    append_journal("- " + std::string(sop_instance_uid));
+    ++stats_.invalidations;
+}
+
+void caching_storage::clear() {
+    std::lock_guard lock(mutex_);
+    for (auto& [uid, fill] : pending_fills_) {
+        ++fill.generation;
+    }
+    while (!entries_.empty()) {
+        erase_entry(entries_.begin());
+    }
+    compact_journal();
+}
+
+auto caching_storage::get_cache_statistics() const -> cache_statistics {
+    std::lock_guard lock(mutex_);
+    auto stats = stats_;
+    stats.entries = entries_.size();
+    return stats;
+}
+
+auto caching_storage::config() const noexcept -> const cache_config& {
+    return config_;
+}
+
+auto caching_storage::backend() const noexcept -> storage_interface* {
+    return backend_.get();
+}
+
+// ============================================================================
+// Private Implementation
+// ============================================================================
+
+auto caching_storage::open_cached(std::string_view sop_instance_uid,
+                                  byte_range range)
+    -> Result<std::unique_ptr<byte_source>> {
+    std::filesystem::path path;
+    {
+        std::lock_guard lock(mutex_);
+        auto it = entries_.find(std::string(sop_instance_uid));
+        if (it == entries_.end()) {
+            return std::unique_ptr<byte_source>{};
+        }
+        lru_.splice(lru_.begin(), lru_, it->second.lru);
+        path = object_path(it->second.digest);
+    }
+
+    // Map outside the lock; an eviction racing with this read removes the
+    // file, in which case the read falls back to the backend
+    auto mapped = core::memory_mapped_file::open(path);
+    if (mapped.is_err()) {
+        invalidate(sop_instance_uid);
+        return std::unique_ptr<byte_source>{};
+    }
+    return serve_mapped(std::move(mapped.value()), range);
+}
+
+auto caching_storage::serve_mapped(core::memory_mapped_file mapped,
+                                   byte_range range)
+    -> Result<std::unique_ptr<byte_source>> {
+    auto resolved = range.resolve(mapped.size());
+    if (!resolved) {
+        return make_error<std::unique_ptr<byte_source>>(
+            kInvalidRange, "Byte range starts past the end of the object",
+            "caching_storage");
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+        ++stats_.hits;
+        stats_.bytes_from_cache += resolved->length;
+    }
+    return std::unique_ptr<byte_source>(
+        std::make_unique<mapped_byte_source>(std::move(mapped), *resolved));
+}
+
+auto caching_storage::read_object(std::string_view sop_instance_uid)
+    -> Result<std::unique_ptr<byte_source>> {
+    if (!backend_) {
+        return make_error<std::unique_ptr<byte_source>>(
+            kNoBackend, "No storage backend", "caching_storage");
+    }
+
+    auto cached = open_cached(sop_instance_uid, {});
+    if (cached.is_err() || cached.value()) {
+        return cached;
+    }
+
+    // Registered before the fetch so an invalidate() racing with it is seen
+    const auto generation = begin_fill(sop_instance_uid);
+    auto result = read_through(sop_instance_uid, generation);
+    end_fill(sop_instance_uid);
+    return result;
+}
+
+auto caching_storage::read_through(std::string_view sop_instance_uid,
+                                   std::uint64_t generation)
+    -> Result<std::unique_ptr<byte_source>> {
+    auto fetched = backend_->open_read(sop_instance_uid);
+    if (fetched.is_err()) {
+        return fetched;
+    }
+    auto& source = *fetched.value();
+    {
+        std::lock_guard lock(mutex_);
+        ++stats_.misses;
+        stats_.bytes_from_backend += source.size();
+    }
+
+    if (!should_admit(sop_instance_uid, source.size())) {
+        return fetched;
+    }
+
+    auto admitted = admit(sop_instance_uid, source, generation);
+    if (admitted.is_err()) {
+        // The fetched source is consumed; read it from the backend again
+        return backend_->open_read(sop_instance_uid);
+    }
+
+    auto mapped = core::memory_mapped_file::open(object_path(admitted.value()));
+    if (mapped.is_err()) {
+        return backend_->open_read(sop_instance_uid);
+    }
+    const auto size = mapped.value().size();
+    return std::unique_ptr<byte_source>(std::make_unique<mapped_byte_source>(
+        std::move(mapped.value()), byte_range{0, size}));
+}
+
+auto caching_storage::begin_fill(std::string_view sop_instance_uid)
+    -> std::uint64_t {
+    std::lock_guard lock(mutex_);
+    auto& fill = pending_fills_[std::string(sop_instance_uid)];
+    ++fill.readers;
+    return fill.generation;
+}
+
+void caching_storage::end_fill(std::string_view sop_instance_uid) {
+    std::lock_guard lock(mutex_);
+    auto it = pending_fills_.find(std::string(sop_instance_uid));
+    if (it != pending_fills_.end() && --it->second.readers == 0) {
+        pending_fills_.erase(it);
+    }
+}
+
+auto caching_storage::should_admit(std::string_view sop_instance_uid,
+                                   std::uint64_t size) -> bool {
+    std::lock_guard lock(mutex_);
+    if (size > config_.max_object_size || size > config_.max_bytes) {
+        ++stats_.rejections;
+        return false;
+    }
+    if (config_.admission_threshold <= 1) {
+        return true;
+    }
+
+    std::string uid(sop_instance_uid);
+    auto it = history_.find(uid);
+    if (it == history_.end()) {
+        history_lru_.push_front(uid);
+        it = history_.emplace(std::move(uid), history_entry{0, history_lru_.begin()})
+                 .first;
+        while (history_.size() > (std::max)(config_.history_capacity, std::size_t{1})) {
+            history_.erase(history_lru_.back());
+            history_lru_.pop_back();
+        }
+    } else {
+        history_lru_.splice(history_lru_.begin(), history_lru_, it->second.lru);
+    }
+
+    if (++it->second.misses < config_.admission_threshold) {
+        ++stats_.rejections;
+        return false;
+    }
+    history_lru_.erase(it->second.lru);
+    history_.erase(it);
+    return true;
+}
+
+auto caching_storage::admit(std::string_view sop_instance_uid,
+                            byte_source& source,
+                            std::uint64_t generation) -> Result<std::string> {
+    const auto temp_path = temp_object_path(config_.directory);
+    content_hasher hasher;
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return make_error<std::string>(
+                kCacheWriteError, "Cannot create " + temp_path.string(),
+                "caching_storage");
+        }
+
+        auto bytes = source.contiguous();
+        if (!bytes.empty()) {
+            hasher.update(bytes);
+            out.write(reinterpret_cast<const char*>(bytes.data()),
+                      static_cast<std::streamsize>(bytes.size()));
+        } else {
+            std::vector<std::uint8_t> buffer(kCopyChunkSize);
+            for (;;) {
+                auto n = source.read(buffer);
+                if (n.is_err()) {
+                    out.close();
+                    std::filesystem::remove(temp_path);
+                    return make_error<std::string>(
+                        n.error().code, n.error().message, "caching_storage");
+                }
+                if (n.value() == 0) {
+                    break;
+                }
+                hasher.update(std::span<const std::uint8_t>(buffer.data(), n.value()));
+                out.write(reinterpret_cast<const char*>(buffer.data()),
+                          static_cast<std::streamsize>(n.value()));
+            }
+        }
+
+        out.flush();
+        if (!out) {
+            out.close();
+            std::error_code ec;
+            std::filesystem::remove(temp_path, ec);
+            return make_error<std::string>(
+                kCacheWriteError, "Failed to write " + temp_path.string(),
+                "caching_storage");
+        }
+    }
+
+    // The object file appears under its digest only once fully written,
+    // and the journal references it only after the rename
+    auto digest = digest_hex(hasher.digest());
+    const auto path = object_path(digest);
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp_path, ec);
+        return make_error<std::string>(kCacheWriteError,
+                                       "Failed to rename into " + path.string(),
+                                       "caching_storage");
+    }
+
+    std::lock_guard lock(mutex_);
+    std::string uid(sop_instance_uid);
+    if (auto fill = pending_fills_.find(uid);
+        fill == pending_fills_.end() || fill->second.generation != generation) {
+        if (!digest_refs_.contains(digest)) {
+            std::filesystem::remove(path, ec);
+        }
+        ++stats_.rejections;
+        return make_error<std::string>(
+            kStaleFill, "Instance was invalidated while it was being fetched",
+            "caching_storage");
+    }
+    if (auto it = entries_.find(uid); it != entries_.end()) {
+        if (it->second.digest == digest) {
+            return digest;
+        }
+        erase_entry(it);
+    }
+
+    if (digest_refs_[digest]++ == 0) {
+        stats_.bytes_cached += hasher.size();
+    }
+    lru_.push_front(uid);
+    entries_.emplace(uid, cache_entry{digest, hasher.size(), lru_.begin()});
+    append_journal("+ " + digest + " " + std::to_string(hasher.size()) + " " + uid);
+    ++stats_.admissions;
+
+    evict_to_fit();
+    return digest;
+}
+
+void caching_storage::load_index() {
+    std::lock_guard lock(mutex_);
+
+    // Replay: the last record for an instance wins; a torn final line fails
+    // to parse and is ignored
+    struct replayed {
+        std::string digest;
+        std::uint64_t size{0};
+        std::size_t order{0};
+    };
+    std::unordered_map<std::string, replayed> live;
+    std::size_t order = 0;
+    {
+        std::ifstream in(journal_path());
+        std::string line;
+        while (std::getline(in, line)) {
+            if (in.eof()) {
+                break;  // no trailing newline: record was torn by a crash
+            }
+            std::istringstream record(line);
+            std::string op;
+            std::string uid;
+            record >> op;
+            if (op == "+") {
+                replayed entry;
+                if (record >> entry.digest >> entry.size >> uid) {
+                    entry.order = order++;
+                    live[uid] = std::move(entry);
+                }
+            } else if (op == "-") {
+                if (record >> uid) {
+                    live.erase(uid);
+                }
+            }
+        }
+    }
+
+    // Keep entries backed by an intact object file, in journal order
+    std::vector<std::pair<std::string, replayed>> ordered(live.begin(), live.end());
+    std::sort(ordered.begin(), ordered.end(), [](const auto& a, const auto& b) {
+        return a.second.order > b.second.order;
+    });
+
+    std::unordered_map<std::string, bool> checked;
+    for (auto& [uid, entry] : ordered) {
+        auto [check, first] = checked.try_emplace(entry.digest, false);
+        if (first) {
+            const auto path = object_path(entry.digest);
+            std::error_code ec;
+            const auto size = std::filesystem::file_size(path, ec);
+            check->second = !ec && size == entry.size &&
+                            (!config_.verify_on_load ||
+                             digest_file(path) == entry.digest);
+        }
+        if (!check->second) {
+            continue;
+        }
+
+        if (digest_refs_[entry.digest]++ == 0) {
+            stats_.bytes_cached += entry.size;
+        }
+        lru_.push_back(uid);
+        entries_.emplace(uid, cache_entry{entry.digest, entry.size,
+                                          std::prev(lru_.end())});
+    }
+
+    // Remove object files no entry references and interrupted downloads
+    std::error_code ec;
+    for (std::filesystem::recursive_directory_iterator
+             it(config_.directory / "objects", ec),
+         end;
+         !ec && it != end; it.increment(ec)) {
+        if (it->is_regular_file(ec) &&
+            !digest_refs_.contains(it->path().filename().string())) {
+            std::error_code remove_ec;
+            std::filesystem::remove(it->path(), remove_ec);
+        }
+    }
+    for (std::filesystem::directory_iterator it(config_.directory / "tmp", ec), end;
+         !ec && it != end; it.increment(ec)) {
+        std::error_code remove_ec;
+        std::filesystem::remove(it->path(), remove_ec);
+    }
+
+    compact_journal();
+    evict_to_fit();
+}
+
+void caching_storage::compact_journal() {
+    journal_.close();
+
+    const auto temp_path = config_.directory / "tmp" / "index.journal.tmp";
+    {
+        std::ofstream out(temp_path, std::ios::trunc);
+        // Least recently used first, so a replay restores the LRU order
+        for (auto it = lru_.rbegin(); it != lru_.rend(); ++it) {
+            const auto& entry = entries_.at(*it);
+            out << "+ " << entry.digest << ' ' << entry.size << ' ' << *it
+                << '\n';
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temp_path, journal_path(), ec);
+    journal_.open(journal_path(), std::ios::app);
+    journal_records_ = entries_.size();
+}
+
+void caching_storage::append_journal(const std::string& record) {
+    journal_ << record << '\n';
+    journal_.flush();
+
+    if (++journal_records_ > 2 * entries_.size() + kJournalSlack) {
+        compact_journal();
+    }
+}
+
+void caching_storage::erase_entry(
+    std::unordered_map<std::string, cache_entry>::iterator it) {
+    const auto digest = it->second.digest;
+    const auto size = it->second.size;
+    lru_.erase(it->second.lru);
+    entries_.erase(it);
+
+    auto ref = digest_refs_.find(digest);
+    if (ref != digest_refs_.end() && --ref->second == 0) {
+        digest_refs_.erase(ref);
+        stats_.bytes_cached -= size;
+        std::error_code ec;
+        std::filesystem::remove(object_path(digest), ec);
+    }
+}
+
+void caching_storage::evict_to_fit() {
+    while (stats_.bytes_cached > config_.max_bytes && !lru_.empty()) {
+        auto uid = lru_.back();
+        erase_entry(entries_.find(uid));
+        append_journal("- " + uid);
+        ++stats_.evictions;
+    }
+}
+
+auto caching_storage::object_path(const std::string& digest) const
+    -> std::filesystem::path {
+    return config_.directory / "objects" / digest.substr(0, 2) / digest;
+}
+
+auto caching_storage::journal_path() const -> std::filesystem::path {
+    return config_.directory / kJournalName;
+}
+
+}  // namespace kcenon::pacs::storage
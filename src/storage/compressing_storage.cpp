@@ -0,0 +1,387 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file compressing_storage.cpp
+ * @brief Implementation of the compress-on-ingest storage decorator
+ */
+
+#include <kcenon/pacs/storage/compressing_storage.h>
+
+#include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/transfer_syntax.h>
+#include <kcenon/pacs/storage/index_database.h>
+
+#include <algorithm>
+
+namespace kcenon::pacs::storage {
+
+using kcenon::common::make_error;
+using kcenon::common::ok;
+
+namespace {
+
+/// Error code when no backend is configured
+constexpr int kNoBackend = -210;
+
+/// Error code when a replaced instance has no index record
+constexpr int kNotIndexed = -211;
+
+/// Weight of the newest sample in the throughput moving average
+constexpr double kThroughputSmoothing = 0.2;
+
+}  // namespace
+
+// ============================================================================
+// Construction / Destruction
+// ============================================================================
+
+compressing_storage::compressing_storage(std::shared_ptr<storage_interface> backend,
+                                         compression_policy policy,
+                                         index_database* database)
+    : backend_(std::move(backend)), policy_(std::move(policy)), database_(database) {
+    if (policy_.enabled() && policy_.mode != compression_mode::inline_only) {
+        const auto workers = std::max<std::size_t>(policy_.background_workers, 1);
+        workers_.reserve(workers);
+        for (std::size_t i = 0; i < workers; ++i) {
+            workers_.emplace_back([this]() { worker_loop(); });
+        }
+    }
+}
+
+compressing_storage::~compressing_storage() {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        stop_requested_.store(true);
+        queue_.clear();
+    }
+    queue_cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+// ============================================================================
+// storage_interface Implementation
+// ============================================================================
+
+auto compressing_storage::store(const core::dicom_dataset& dataset) -> VoidResult {
+    if (!backend_) {
+        return make_error<std::monostate>(kNoBackend, "No storage backend",
+                                          "compressing_storage");
+    }
+
+    const compression_rule* rule = nullptr;
+    if (!has_encapsulated_pixel_data(dataset)) {
+        rule = policy_.select(dataset);
+    }
+    if (rule == nullptr) {
+        {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            ++stats_.skipped;
+        }
+        return backend_->store(dataset);
+    }
+
+    return store_native(
+        core::dicom_file::create(dataset,
+                                 encoding::transfer_syntax::explicit_vr_little_endian),
+        *rule);
+}
+
+auto compressing_storage::store_file(const core::dicom_file& file) -> VoidResult {
+    if (!backend_) {
+        return make_error<std::monostate>(kNoBackend, "No storage backend",
+                                          "compressing_storage");
+    }
+
+    const auto* rule = policy_.select(file);
+    if (rule == nullptr) {
+        {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            ++stats_.skipped;
+        }
+        return backend_->store_file(file);
+    }
+    return store_native(file, *rule);
+}
+
+auto compressing_storage::retrieve(std::string_view sop_instance_uid)
+    -> Result<core::dicom_dataset> {
+    return backend_->retrieve(sop_instance_uid);
+}
+
+auto compressing_storage::retrieve_file(std::string_view sop_instance_uid)
+    -> Result<core::dicom_file> {
+    return backend_->retrieve_file(sop_instance_uid);
+}
+
+auto compressing_storage::replace_file(const core::dicom_file& file)
+    -> Result<stored_instance> {
+    if (!backend_) {
+        return make_error<stored_instance>(kNoBackend, "No storage backend",
+                                           "compressing_storage");
+    }
+    return backend_->replace_file(file);
+}
+
+auto compressing_storage::open_read(std::string_view sop_instance_uid,
+                                    byte_range range)
+    -> Result<std::unique_ptr<byte_source>> {
+    if (!backend_) {
+        return make_error<std::unique_ptr<byte_source>>(
+            kNoBackend, "No storage backend", "compressing_storage");
+    }
+    return backend_->open_read(sop_instance_uid, range);
+}
+
+auto compressing_storage::remove(std::string_view sop_instance_uid) -> VoidResult {
+    return backend_->remove(sop_instance_uid);
+}
+
+auto compressing_storage::exists(std::string_view sop_instance_uid) const -> bool {
+    return backend_->exists(sop_instance_uid);
+}
+
+auto compressing_storage::exists_batch(
+    const std::vector<std::string>& sop_instance_uids) const
+    -> std::vector<bool> {
+    return backend_->exists_batch(sop_instance_uids);
+}
+
+auto compressing_storage::find(const core::dicom_dataset& query)
+    -> Result<std::vector<core::dicom_dataset>> {
+    return backend_->find(query);
+}
+
+auto compressing_storage::get_statistics() const -> storage_statistics {
+    return backend_->get_statistics();
+}
+
+auto compressing_storage::verify_integrity() -> VoidResult {
+    return backend_->verify_integrity();
+}
+
+// ============================================================================
+// Compression Control
+// ============================================================================
+
+auto compressing_storage::get_compression_statistics() const
+    -> compression_statistics {
+    compression_statistics stats;
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        stats = stats_;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        stats.pending = queue_.size() + active_jobs_;
+    }
+    return stats;
+}
+
+auto compressing_storage::policy() const noexcept -> const compression_policy& {
+    return policy_;
+}
+
+auto compressing_storage::wait_idle(std::chrono::milliseconds timeout) -> bool {
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    return idle_cv_.wait_for(lock, timeout, [this]() {
+        return queue_.empty() && active_jobs_ == 0;
+    });
+}
+
+auto compressing_storage::backend() const noexcept -> storage_interface* {
+    return backend_.get();
+}
+
+// ============================================================================
+// Private Implementation
+// ============================================================================
+
+auto compressing_storage::store_native(const core::dicom_file& file,
+                                       const compression_rule& rule) -> VoidResult {
+    bool compress_inline = policy_.mode == compression_mode::inline_only;
+    if (policy_.mode == compression_mode::budgeted) {
+        const auto estimate = estimate_encode_time(
+            pixel_data_size(file.dataset()), rule.transfer_syntax);
+        compress_inline = estimate <= policy_.inline_budget;
+        if (!compress_inline) {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            ++stats_.deferred;
+        }
+    }
+
+    if (compress_inline) {
+        auto compressed = compress_measured(file, rule);
+        if (compressed.is_ok()) {
+            auto result = backend_->store_file(compressed.value());
+            if (result.is_ok()) {
+                std::lock_guard<std::mutex> lock(stats_mutex_);
+                ++stats_.compressed_inline;
+            }
+            return result;
+        }
+        // Keep the instance as received rather than failing the store
+        return backend_->store_file(file);
+    }
+
+    auto result = backend_->store_file(file);
+    if (result.is_ok()) {
+        enqueue(file.sop_instance_uid(), rule);
+    }
+    return result;
+}
+
+auto compressing_storage::compress_measured(const core::dicom_file& file,
+                                            const compression_rule& rule)
+    -> Result<core::dicom_file> {
+    const auto pixel_bytes = pixel_data_size(file.dataset());
+    const auto start = std::chrono::steady_clock::now();
+
+    auto result = policy_.compress(file, rule);
+
+    const auto elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start);
+
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    if (result.is_err()) {
+        ++stats_.failed;
+        return result;
+    }
+
+    stats_.bytes_before += pixel_bytes;
+    stats_.bytes_after += pixel_data_size(result.value().dataset());
+
+    if (pixel_bytes > 0 && elapsed.count() > 0.0) {
+        const auto sample = static_cast<double>(pixel_bytes) / elapsed.count();
+        auto [it, inserted] = throughput_.try_emplace(rule.transfer_syntax, sample);
+        if (!inserted) {
+            it->second += kThroughputSmoothing * (sample - it->second);
+        }
+    }
+    return result;
+}
+
+auto compressing_storage::estimate_encode_time(std::size_t pixel_bytes,
+                                               const std::string& transfer_syntax) const
+    -> std::chrono::microseconds {
+    double throughput = static_cast<double>(
+        std::max<std::size_t>(policy_.initial_throughput_bytes_per_sec, 1));
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        auto it = throughput_.find(transfer_syntax);
+        if (it != throughput_.end() && it->second > 0.0) {
+            throughput = it->second;
+        }
+    }
+    return std::chrono::microseconds{
+        static_cast<std::int64_t>(static_cast<double>(pixel_bytes) / throughput * 1e6)};
+}
+
+void compressing_storage::enqueue(std::string sop_instance_uid,
+                                  const compression_rule& rule) {
+    const auto rule_index =
+        static_cast<std::size_t>(&rule - policy_.rules.data());
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (queue_.size() >= policy_.max_pending) {
+            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+            ++stats_.queue_overflows;
+            return;
+        }
+        queue_.push_back({std::move(sop_instance_uid), rule_index});
+    }
+    queue_cv_.notify_one();
+}
+
+void compressing_storage::process_job(const pending_job& job) {
+    auto stored = backend_->retrieve_file(job.sop_instance_uid);
+    if (stored.is_err()) {
+        // Removed or replaced meanwhile; nothing to do
+        return;
+    }
+    const auto& original = stored.value();
+
+    // Skip instances that were replaced by a compressed version meanwhile
+    if (policy_.select(original) == nullptr) {
+        return;
+    }
+
+    auto compressed = compress_measured(original, policy_.rules[job.rule_index]);
+    if (compressed.is_err()) {
+        return;
+    }
+
+    // The backend writes the compressed copy in full before it takes the
+    // original's place, so the instance never goes missing
+    auto replaced = backend_->replace_file(compressed.value());
+    bool succeeded = replaced.is_ok();
+    if (succeeded && database_ != nullptr &&
+        update_index(replaced.value()).is_err()) {
+        // A file the index does not describe would fail fixity checks
+        (void)backend_->replace_file(original);
+        succeeded = false;
+    }
+
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    if (succeeded) {
+        ++stats_.compressed_background;
+    } else {
+        ++stats_.failed;
+    }
+}
+
+auto compressing_storage::update_index(const stored_instance& stored) -> VoidResult {
+    std::lock_guard<std::mutex> lock(database_mutex_);
+    auto record = database_->find_instance(stored.sop_instance_uid);
+    if (!record) {
+        return make_error<std::monostate>(
+            kNotIndexed, "Instance not indexed: " + stored.sop_instance_uid,
+            "compressing_storage");
+    }
+
+    record->file_size = static_cast<int64_t>(stored.size_bytes);
+    record->file_hash = stored.content_hash;
+    record->transfer_syntax = stored.transfer_syntax_uid;
+    auto result = database_->upsert_instance(*record);
+    if (result.is_err()) {
+        return make_error<std::monostate>(result.error().code,
+                                          result.error().message,
+                                          "compressing_storage");
+    }
+    return ok();
+}
+
+void compressing_storage::worker_loop() {
+    for (;;) {
+        pending_job job;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            queue_cv_.wait(lock, [this]() {
+                return stop_requested_.load() || !queue_.empty();
+            });
+            if (stop_requested_.load()) {
+                return;
+            }
+            job = std::move(queue_.front());
+            queue_.pop_front();
+            ++active_jobs_;
+        }
+
+        process_job(job);
+
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            --active_jobs_;
+            if (queue_.empty() && active_jobs_ == 0) {
+                idle_cv_.notify_all();
+            }
+        }
+    }
+}
+
+}  // namespace kcenon::pacs::storage
@@ -0,0 +1,163 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file compression_policy.cpp
+ * @brief Implementation of the lossless compression policy
+ */
+
+#include <kcenon/pacs/storage/compression_policy.h>
+
+#include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/compression/codec_factory.h>
+#include <kcenon/pacs/encoding/compression/pixel_data_transcoder.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+
+namespace kcenon::pacs::storage {
+
+using kcenon::common::make_error;
+
+namespace {
+
+/// Error codes for compression policy operations
+constexpr int kUnsupportedTarget = -200;
+constexpr int kLossyTarget = -201;
+constexpr int kCompressionFailed = -202;
+
+/**
+ * @brief Parse a DA value (YYYYMMDD) into a time point
+ */
+auto parse_study_date(std::string_view value)
+    -> std::optional<std::chrono::system_clock::time_point> {
+    if (value.size() < 8 ||
+        !std::all_of(value.begin(), value.begin() + 8,
+                     [](char c) { return c >= '0' && c <= '9'; })) {
+        return std::nullopt;
+    }
+    const auto year = std::stoi(std::string(value.substr(0, 4)));
+    const auto month = static_cast<unsigned>(std::stoi(std::string(value.substr(4, 2))));
+    const auto day = static_cast<unsigned>(std::stoi(std::string(value.substr(6, 2))));
+
+    const std::chrono::year_month_day ymd{std::chrono::year{year},
+                                          std::chrono::month{month},
+                                          std::chrono::day{day}};
+    if (!ymd.ok()) {
+        return std::nullopt;
+    }
+    return std::chrono::sys_days{ymd};
+}
+
+auto contains(const std::vector<std::string>& values, const std::string& value)
+    -> bool {
+    return std::find(values.begin(), values.end(), value) != values.end();
+}
+
+}  // namespace
+
+// ============================================================================
+// Rule Selection
+// ============================================================================
+
+auto compression_policy::select(const core::dicom_dataset& dataset,
+                                std::chrono::system_clock::time_point now) const
+    -> const compression_rule* {
+    if (rules.empty() || !dataset.contains(core::tags::pixel_data)) {
+        return nullptr;
+    }
+
+    const auto modality = dataset.get_string(core::tags::modality);
+    const auto sop_class = dataset.get_string(core::tags::sop_class_uid);
+    const auto study_date =
+        parse_study_date(dataset.get_string(core::tags::study_date));
+
+    for (const auto& rule : rules) {
+        if (!rule.modalities.empty() && !contains(rule.modalities, modality)) {
+            continue;
+        }
+        if (!rule.sop_classes.empty() && !contains(rule.sop_classes, sop_class)) {
+            continue;
+        }
+        if (rule.min_study_age.count() > 0) {
+            // Undated studies never satisfy an age requirement
+            if (!study_date || now - *study_date < rule.min_study_age) {
+                continue;
+            }
+        }
+        return &rule;
+    }
+    return nullptr;
+}
+
+auto compression_policy::select(const core::dicom_file& file,
+                                std::chrono::system_clock::time_point now) const
+    -> const compression_rule* {
+    if (file.transfer_syntax().is_encapsulated() ||
+        has_encapsulated_pixel_data(file.dataset())) {
+        return nullptr;
+    }
+    return select(file.dataset(), now);
+}
+
+// ============================================================================
+// Compression
+// ============================================================================
+
+auto compression_policy::compress(const core::dicom_file& file,
+                                  const compression_rule& rule) const
+    -> kcenon::common::Result<core::dicom_file> {
+    auto target = encoding::find_transfer_syntax(rule.transfer_syntax);
+    if (!target || !target->is_encapsulated() ||
+        !encoding::compression::codec_factory::is_supported(rule.transfer_syntax)) {
+        return make_error<core::dicom_file>(
+            kUnsupportedTarget,
+            "Unsupported compression target: " + rule.transfer_syntax,
+            "compression_policy");
+    }
+
+    auto codec = encoding::compression::codec_factory::create(*target);
+    if (!codec || codec->is_lossy()) {
+        return make_error<core::dicom_file>(
+            kLossyTarget,
+            "Storage compression must be lossless: " + rule.transfer_syntax,
+            "compression_policy");
+    }
+
+    encoding::compression::transcode_options options;
+    options.parallel.max_workers = max_parallel_frames;
+
+    auto result = encoding::compression::transcode_file(file, *target, options);
+    if (result.is_err()) {
+        return make_error<core::dicom_file>(
+            kCompressionFailed,
+            "Compression to " + std::string(target->name()) +
+                " failed: " + result.error().message,
+            "compression_policy");
+    }
+    return std::move(result.value());
+}
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+auto has_encapsulated_pixel_data(const core::dicom_dataset& dataset) -> bool {
+    const auto* pixel = dataset.get(core::tags::pixel_data);
+    if (pixel == nullptr) {
+        return false;
+    }
+    // Encapsulated values start with an Item tag (FFFE,E000), little endian
+    const auto raw = pixel->raw_data();
+    return raw.size() >= 8 && raw[0] == 0xFE && raw[1] == 0xFF &&
+           raw[2] == 0x00 && raw[3] == 0xE0;
+}
+
+auto pixel_data_size(const core::dicom_dataset& dataset) -> std::size_t {
+    const auto* pixel = dataset.get(core::tags::pixel_data);
+    return pixel != nullptr ? pixel->raw_data().size() : 0;
+}
+
+}  // namespace kcenon::pacs::storage
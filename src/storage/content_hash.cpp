@@ -0,0 +1,168 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file content_hash.cpp
+ * @brief Implementation of the streaming XXH64 content hasher
+ */
+
+#include <kcenon/pacs/storage/content_hash.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace kcenon::pacs::storage {
+
+namespace {
+
+constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+constexpr std::uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr std::uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+constexpr std::size_t kStripeSize = 32;
+
+constexpr auto rotl(std::uint64_t value, int bits) noexcept -> std::uint64_t {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+/// Little-endian loads (the format is defined on little-endian words)
+auto read64(const std::uint8_t* p) noexcept -> std::uint64_t {
+    std::uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) {
+        value = (value << 8) | p[i];
+    }
+    return value;
+}
+
+auto read32(const std::uint8_t* p) noexcept -> std::uint64_t {
+    return static_cast<std::uint64_t>(p[0]) |
+           (static_cast<std::uint64_t>(p[1]) << 8) |
+           (static_cast<std::uint64_t>(p[2]) << 16) |
+           (static_cast<std::uint64_t>(p[3]) << 24);
+}
+
+constexpr auto round(std::uint64_t acc, std::uint64_t lane) noexcept
+    -> std::uint64_t {
+    acc += lane * kPrime2;
+    acc = rotl(acc, 31);
+    return acc * kPrime1;
+}
+
+constexpr auto merge_round(std::uint64_t acc, std::uint64_t lane) noexcept
+    -> std::uint64_t {
+    acc ^= round(0, lane);
+    return acc * kPrime1 + kPrime4;
+}
+
+void consume_stripe(std::array<std::uint64_t, 4>& lanes,
+                    const std::uint8_t* p) noexcept {
+    lanes[0] = round(lanes[0], read64(p));
+    lanes[1] = round(lanes[1], read64(p + 8));
+    lanes[2] = round(lanes[2], read64(p + 16));
+    lanes[3] = round(lanes[3], read64(p + 24));
+}
+
+}  // namespace
+
+content_hasher::content_hasher(std::uint64_t seed) noexcept
+    : seed_(seed),
+      lanes_{seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1} {}
+
+void content_hasher::update(std::span<const std::uint8_t> data) noexcept {
+    const auto* p = data.data();
+    auto remaining = data.size();
+    total_ += remaining;
+
+    // Complete a partially filled stripe first
+    if (buffered_ > 0) {
+        const auto take = (std::min)(kStripeSize - buffered_, remaining);
+        std::memcpy(buffer_.data() + buffered_, p, take);
+        buffered_ += take;
+        p += take;
+        remaining -= take;
+        if (buffered_ < kStripeSize) {
+            return;
+        }
+        consume_stripe(lanes_, buffer_.data());
+        buffered_ = 0;
+    }
+
+    while (remaining >= kStripeSize) {
+        consume_stripe(lanes_, p);
+        p += kStripeSize;
+        remaining -= kStripeSize;
+    }
+
+    if (remaining > 0) {
+        std::memcpy(buffer_.data(), p, remaining);
+        buffered_ = remaining;
+    }
+}
+
+auto content_hasher::digest() const noexcept -> std::uint64_t {
+    std::uint64_t acc;
+    if (total_ >= kStripeSize) {
+        acc = rotl(lanes_[0], 1) + rotl(lanes_[1], 7) + rotl(lanes_[2], 12) +
+              rotl(lanes_[3], 18);
+        for (auto lane : lanes_) {
+            acc = merge_round(acc, lane);
+        }
+    } else {
+        acc = seed_ + kPrime5;
+    }
+    acc += total_;
+
+    const auto* p = buffer_.data();
+    auto remaining = buffered_;
+    while (remaining >= 8) {
+        acc ^= round(0, read64(p));
+        acc = rotl(acc, 27) * kPrime1 + kPrime4;
+        p += 8;
+        remaining -= 8;
+    }
+    if (remaining >= 4) {
+        acc ^= read32(p) * kPrime1;
+        acc = rotl(acc, 23) * kPrime2 + kPrime3;
+        p += 4;
+        remaining -= 4;
+    }
+    while (remaining > 0) {
+        acc ^= *p * kPrime5;
+        acc = rotl(acc, 11) * kPrime1;
+        ++p;
+        --remaining;
+    }
+
+    acc ^= acc >> 33;
+    acc *= kPrime2;
+    acc ^= acc >> 29;
+    acc *= kPrime3;
+    acc ^= acc >> 32;
+    return acc;
+}
+
+auto content_hasher::hex_digest() const -> std::string {
+    static constexpr char kHex[] = "0123456789abcdef";
+    auto value = digest();
+    std::string result = "xxh64:0000000000000000";
+    for (std::size_t i = result.size(); value != 0; value >>= 4) {
+        result[--i] = kHex[value & 0xF];
+    }
+    return result;
+}
+
+auto content_hasher::size() const noexcept -> std::uint64_t {
+    return total_;
+}
+
+auto content_hasher::hash(std::span<const std::uint8_t> data,
+                          std::uint64_t seed) noexcept -> std::uint64_t {
+    content_hasher hasher(seed);
+    hasher.update(data);
+    return hasher.digest();
+}
+
+}  // namespace kcenon::pacs::storage
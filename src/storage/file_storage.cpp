@@ -10,8 +10,13 @@
 #include <kcenon/pacs/storage/file_storage.h>
 
 #include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/core/frame_index.h>
+#include <kcenon/pacs/core/memory_mapped_file.h>
+#include <kcenon/pacs/encoding/dataset_encoder.h>
 #include <kcenon/pacs/encoding/transfer_syntax.h>
 #include <kcenon/pacs/encoding/vr_type.h>
+#include <kcenon/pacs/monitoring/request_tracer.h>
+#include <kcenon/pacs/storage/content_hash.h>
 
 #include <algorithm>
 #include <chrono>
@@ -34,6 +39,10 @@ constexpr int kFileWriteError = -4;
 constexpr int kFileReadError = -5;
 constexpr int kDirectoryCreateError = -6;
 constexpr int kIntegrityError = -7;
+constexpr int kInvalidRange = -8;
+
+/// Buffer size for streaming writes
+constexpr std::size_t kStreamChunkSize = 1024 * 1024;
 
 /// Generate a unique temporary filename
 auto generate_temp_filename(const std::filesystem::path& base)
@@ -47,6 +56,25 @@ auto generate_temp_filename(const std::filesystem::path& base)
     return base.parent_path() / temp_name;
 }
 
+/// Writes to a file and hashes the same bytes on the way
+class hashing_file_sink final : public encoding::byte_sink {
+public:
+    explicit hashing_file_sink(std::ostream& stream) noexcept : file_(stream) {}
+
+    auto write(std::span<const std::uint8_t> bytes) -> VoidResult override {
+        hasher_.update(bytes);
+        return file_.write(bytes);
+    }
+
+    [[nodiscard]] auto hex_digest() const -> std::string {
+        return hasher_.hex_digest();
+    }
+
+private:
+    encoding::ostream_sink file_;
+    content_hasher hasher_;
+};
+
 }  // namespace
 
 // ============================================================================
@@ -73,6 +101,52 @@ file_storage::file_storage(const file_storage_config& config)
 // ============================================================================
 
 auto file_storage::store(const core::dicom_dataset& dataset) -> VoidResult {
+    return write_instance(dataset, [&](encoding::byte_sink& sink) {
+        return core::dicom_file::write_dataset(
+            sink, dataset, encoding::transfer_syntax::explicit_vr_little_endian);
+    });
+}
+
+auto file_storage::store_file(const core::dicom_file& file) -> VoidResult {
+    return write_instance(file.dataset(), [&](encoding::byte_sink& sink) {
+        return file.write_to(sink);
+    });
+}
+
+auto file_storage::replace_file(const core::dicom_file& file)
+    -> Result<stored_instance> {
+    auto written = write_instance(
+        file.dataset(),
+        [&](encoding::byte_sink& sink) { return file.write_to(sink); },
+        true);
+    if (written.is_err()) {
+        return make_error<stored_instance>(
+            written.error().code, written.error().message, "file_storage");
+    }
+
+    const auto& dataset = file.dataset();
+    stored_instance info;
+    info.sop_instance_uid = dataset.get_string(core::tags::sop_instance_uid);
+    info.study_instance_uid = dataset.get_string(core::tags::study_instance_uid);
+    info.series_instance_uid = dataset.get_string(core::tags::series_instance_uid);
+    info.study_date = dataset.get_string(core::tags::study_date);
+    info.transfer_syntax_uid = std::string(file.transfer_syntax().uid());
+
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(
+        get_file_path(info.sop_instance_uid), ec);
+    info.size_bytes = ec ? 0 : size;
+    info.content_hash = get_file_hash(info.sop_instance_uid);
+    return info;
+}
+
+auto file_storage::write_instance(
+    const core::dicom_dataset& dataset,
+    const std::function<VoidResult(encoding::byte_sink&)>& write,
+    bool replace)
+    -> VoidResult {
+    monitoring::trace_span span("file_write");
+
     // Extract required UIDs
     auto study_uid = dataset.get_string(core::tags::study_instance_uid);
     auto series_uid = dataset.get_string(core::tags::series_instance_uid);
@@ -86,52 +160,18 @@ auto file_storage::store(const core::dicom_dataset& dataset) -> VoidResult {
     }
 
     // Build file path based on naming scheme
-    std::filesystem::path file_path;
-    switch (config_.naming) {
-        case naming_scheme::uid_hierarchical:
-            file_path = build_path(study_uid, series_uid, sop_uid);
-            break;
-        case naming_scheme::date_hierarchical: {
-            auto study_date = dataset.get_string(core::tags::study_date);
-            if (study_date.empty()) {
-                // Use current date if study date not available
-                auto now = std::chrono::system_clock::now();
-                auto time = std::chrono::system_clock::to_time_t(now);
-                std::tm tm_buf{};
-#ifdef _WIN32
-                localtime_s(&tm_buf, &time);
-#else
-                localtime_r(&time, &tm_buf);
-#endif
-                char date_str[9];
-                std::strftime(date_str, sizeof(date_str), "%Y%m%d", &tm_buf);
-                study_date = date_str;
-            }
-            file_path = build_date_path(study_date, study_uid, sop_uid);
-            break;
-        }
-        case naming_scheme::flat:
-            file_path = config_.root_path /
-                        (sanitize_uid(sop_uid) + config_.file_extension);
-            break;
-    }
+    auto file_path = instance_path(study_uid, series_uid, sop_uid,
+                                   dataset.get_string(core::tags::study_date));
 
     // Handle duplicate checking
-    {
-        std::shared_lock lock(mutex_);
-        if (index_.contains(sop_uid)) {
-            switch (config_.duplicate) {
-                case duplicate_policy::reject:
-                    return make_error<std::monostate>(
-                        kDuplicateInstance,
-                        "Instance already exists: " + sop_uid,
-                        "file_storage");
-                case duplicate_policy::ignore:
-                    return ok();
-                case duplicate_policy::replace:
-                    // Continue to overwrite
-                    break;
-            }
+    if (!replace) {
+        auto admitted = admit_instance(sop_uid);
+        if (admitted.is_err()) {
+            return make_error<std::monostate>(
+                admitted.error().code, admitted.error().message, "file_storage");
+        }
+        if (!admitted.value()) {
+            return ok();
         }
     }
 
@@ -147,20 +187,32 @@ auto file_storage::store(const core::dicom_dataset& dataset) -> VoidResult {
         }
     }
 
-    // Create DICOM file and write atomically
-    auto dicom_file = core::dicom_file::create(
-        dataset, encoding::transfer_syntax::explicit_vr_little_endian);
-
-    // Write to temporary file first
+    // Write to temporary file first, hashing the bytes as they go out,
+    // then rename atomically
     auto temp_path = generate_temp_filename(file_path);
-    auto save_result = dicom_file.save(temp_path);
-
-    if (save_result.is_err()) {
-        std::filesystem::remove(temp_path);
-        return make_error<std::monostate>(
-            kFileWriteError,
-            "Failed to write DICOM file: " + save_result.error().message,
-            "file_storage");
+    std::string content_hash;
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        hashing_file_sink sink(out);
+        auto save_result = out ? write(sink)
+                               : make_error<std::monostate>(
+                                     kFileWriteError,
+                                     "Failed to open " + temp_path.string(),
+                                     "file_storage");
+        if (save_result.is_ok() && !out.flush()) {
+            save_result = make_error<std::monostate>(
+                kFileWriteError, "Failed to flush " + temp_path.string(),
+                "file_storage");
+        }
+        if (save_result.is_err()) {
+            out.close();
+            std::filesystem::remove(temp_path);
+            return make_error<std::monostate>(
+                kFileWriteError,
+                "Failed to write DICOM file: " + save_result.error().message,
+                "file_storage");
+        }
+        content_hash = sink.hex_digest();
     }
 
     // Atomic rename
@@ -174,12 +226,10 @@ auto file_storage::store(const core::dicom_dataset& dataset) -> VoidResult {
             "file_storage");
     }
 
-    // Update index
-    {
-        std::unique_lock lock(mutex_);
-        index_[sop_uid] = file_path;
-    }
+    // A replaced instance invalidates its frame index
+    std::filesystem::remove(core::frame_index::sidecar_path(file_path), ec);
 
+    update_index(sop_uid, file_path, std::move(content_hash));
     return ok();
 }
 
@@ -211,6 +261,160 @@ auto file_storage::retrieve(std::string_view sop_instance_uid)
     return open_result.value().dataset();
 }
 
+auto file_storage::retrieve_file(std::string_view sop_instance_uid)
+    -> Result<core::dicom_file> {
+    auto file_path = get_file_path(sop_instance_uid);
+    if (file_path.empty()) {
+        return make_error<core::dicom_file>(
+            kFileNotFound,
+            "Instance not found: " + std::string{sop_instance_uid},
+            "file_storage");
+    }
+
+    auto open_result = core::dicom_file::open(file_path);
+    if (open_result.is_err()) {
+        return make_error<core::dicom_file>(
+            kFileReadError,
+            "Failed to read DICOM file: " + open_result.error().message,
+            "file_storage");
+    }
+
+    return std::move(open_result.value());
+}
+
+auto file_storage::store_stream(byte_source& source) -> Result<stored_instance> {
+    monitoring::trace_span span("file_write");
+    if (config_.create_directories) {
+        std::error_code ec;
+        std::filesystem::create_directories(config_.root_path, ec);
+        if (ec) {
+            return make_error<stored_instance>(
+                kDirectoryCreateError,
+                "Failed to create directory: " + ec.message(), "file_storage");
+        }
+    }
+
+    // Stream into a temporary file under the root; the final path depends
+    // on UIDs that are only known once the header has been read
+    auto temp_path = generate_temp_filename(config_.root_path / "incoming");
+    content_hasher hasher;
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        auto region = source.contiguous();
+        if (!region.empty()) {
+            hasher.update(region);
+            out.write(reinterpret_cast<const char*>(region.data()),
+                      static_cast<std::streamsize>(region.size()));
+        } else {
+            std::vector<std::uint8_t> buffer(kStreamChunkSize);
+            for (;;) {
+                auto n = source.read(buffer);
+                if (n.is_err()) {
+                    out.close();
+                    std::filesystem::remove(temp_path);
+                    return make_error<stored_instance>(
+                        n.error().code, n.error().message, "file_storage");
+                }
+                if (n.value() == 0 || !out) {
+                    break;
+                }
+                hasher.update(std::span<const std::uint8_t>(buffer.data(), n.value()));
+                out.write(reinterpret_cast<const char*>(buffer.data()),
+                          static_cast<std::streamsize>(n.value()));
+            }
+        }
+        if (!out) {
+            out.close();
+            std::filesystem::remove(temp_path);
+            return make_error<stored_instance>(
+                kFileWriteError, "Failed to write " + temp_path.string(),
+                "file_storage");
+        }
+    }
+
+    Result<stored_instance> identity = stored_instance{};
+    {
+        auto mapped = core::memory_mapped_file::open(temp_path);
+        if (mapped.is_err()) {
+            std::filesystem::remove(temp_path);
+            return make_error<stored_instance>(
+                kFileReadError, mapped.error().message, "file_storage");
+        }
+        identity = identify_part10(mapped.value().as_span());
+    }
+    if (identity.is_err()) {
+        std::filesystem::remove(temp_path);
+        return identity;
+    }
+    auto& info = identity.value();
+    info.content_hash = hasher.hex_digest();
+
+    auto admitted = admit_instance(info.sop_instance_uid);
+    if (admitted.is_err() || !admitted.value()) {
+        std::filesystem::remove(temp_path);
+        if (admitted.is_err()) {
+            return make_error<stored_instance>(
+                admitted.error().code, admitted.error().message, "file_storage");
+        }
+        return identity;
+    }
+
+    auto file_path = instance_path(info.study_instance_uid, info.series_instance_uid,
+                                   info.sop_instance_uid, info.study_date);
+    std::error_code ec;
+    if (config_.create_directories) {
+        std::filesystem::create_directories(file_path.parent_path(), ec);
+        if (ec) {
+            std::filesystem::remove(temp_path);
+            return make_error<stored_instance>(
+                kDirectoryCreateError,
+                "Failed to create directory: " + ec.message(), "file_storage");
+        }
+    }
+
+    std::filesystem::rename(temp_path, file_path, ec);
+    if (ec) {
+        std::filesystem::remove(temp_path);
+        return make_error<stored_instance>(
+            kFileWriteError, "Failed to rename temp file: " + ec.message(),
+            "file_storage");
+    }
+
+    // A replaced instance invalidates its frame index
+    std::filesystem::remove(core::frame_index::sidecar_path(file_path), ec);
+
+    update_index(info.sop_instance_uid, file_path, info.content_hash);
+    return identity;
+}
+
+auto file_storage::open_read(std::string_view sop_instance_uid, byte_range range)
+    -> Result<std::unique_ptr<byte_source>> {
+    auto file_path = get_file_path(sop_instance_uid);
+    if (file_path.empty()) {
+        return make_error<std::unique_ptr<byte_source>>(
+            kFileNotFound,
+            "Instance not found: " + std::string{sop_instance_uid},
+            "file_storage");
+    }
+
+    auto mapped = core::memory_mapped_file::open(file_path);
+    if (mapped.is_err()) {
+        return make_error<std::unique_ptr<byte_source>>(
+            kFileReadError,
+            "Failed to map DICOM file: " + mapped.error().message,
+            "file_storage");
+    }
+
+    auto resolved = range.resolve(mapped.value().size());
+    if (!resolved) {
+        return make_error<std::unique_ptr<byte_source>>(
+            kInvalidRange, "Byte range starts past the end of the file",
+            "file_storage");
+    }
+    return std::unique_ptr<byte_source>(std::make_unique<mapped_byte_source>(
+        std::move(mapped.value()), *resolved));
+}
+
 auto file_storage::remove(std::string_view sop_instance_uid) -> VoidResult {
     std::filesystem::path file_path;
 
@@ -223,17 +427,20 @@ auto file_storage::remove(std::string_view sop_instance_uid) -> VoidResult {
         }
         file_path = it->second;
         index_.erase(it);
+        hashes_.erase(std::string{sop_instance_uid});
     }
 
     // Delete the file
     std::error_code ec;
     std::filesystem::remove(file_path, ec);
     // Ignore errors - file might have been deleted externally
+    std::filesystem::remove(core::frame_index::sidecar_path(file_path), ec);
 
-    // Try to clean up empty parent directories
+    // Try to clean up empty parent directories; a concurrent remove may
+    // already have deleted them
     auto parent = file_path.parent_path();
     while (parent != config_.root_path) {
-        if (std::filesystem::is_empty(parent)) {
+        if (std::filesystem::is_empty(parent, ec) && !ec) {
             std::filesystem::remove(parent, ec);
             parent = parent.parent_path();
         } else {
@@ -249,6 +456,18 @@ auto file_storage::exists(std::string_view sop_instance_uid) const -> bool {
     return index_.contains(std::string{sop_instance_uid});
 }
 
+auto file_storage::exists_batch(
+    const std::vector<std::string>& sop_instance_uids) const
+    -> std::vector<bool> {
+    std::vector<bool> found;
+    found.reserve(sop_instance_uids.size());
+    std::shared_lock lock(mutex_);
+    for (const auto& uid : sop_instance_uids) {
+        found.push_back(index_.contains(uid));
+    }
+    return found;
+}
+
 auto file_storage::find(const core::dicom_dataset& query)
     -> Result<std::vector<core::dicom_dataset>> {
     std::vector<core::dicom_dataset> results;
@@ -372,6 +591,16 @@ auto file_storage::verify_integrity() -> VoidResult {
 // File-specific Operations
 // ============================================================================
 
+auto file_storage::get_file_hash(std::string_view sop_instance_uid) const
+    -> std::string {
+    std::shared_lock lock(mutex_);
+    auto it = hashes_.find(std::string{sop_instance_uid});
+    if (it != hashes_.end()) {
+        return it->second;
+    }
+    return {};
+}
+
 auto file_storage::get_file_path(std::string_view sop_instance_uid) const
     -> std::filesystem::path {
     std::shared_lock lock(mutex_);
@@ -382,6 +611,40 @@ auto file_storage::get_file_path(std::string_view sop_instance_uid) const
     return {};
 }
 
+auto file_storage::read_frame(std::string_view sop_instance_uid,
+                              uint32_t frame_number) const
+    -> Result<std::vector<uint8_t>> {
+    std::filesystem::path file_path;
+    {
+        std::shared_lock lock(mutex_);
+        auto it = index_.find(std::string{sop_instance_uid});
+        if (it == index_.end()) {
+            return make_error<std::vector<uint8_t>>(
+                kFileNotFound,
+                "Instance not found: " + std::string{sop_instance_uid},
+                "file_storage");
+        }
+        file_path = it->second;
+    }
+
+    auto index = core::frame_index::load_or_build(file_path);
+    if (index.is_err()) {
+        return make_error<std::vector<uint8_t>>(
+            kFileReadError,
+            "Failed to index frames: " + index.error().message,
+            "file_storage");
+    }
+
+    auto frame = index.value().read_frame(file_path, frame_number);
+    if (frame.is_err()) {
+        return make_error<std::vector<uint8_t>>(
+            kFileReadError,
+            "Failed to read frame: " + frame.error().message,
+            "file_storage");
+    }
+    return frame;
+}
+
 auto file_storage::import_directory(const std::filesystem::path& source)
     -> VoidResult {
     if (!std::filesystem::exists(source)) {
@@ -422,6 +685,7 @@ auto file_storage::root_path() const -> const std::filesystem::path& {
 auto file_storage::rebuild_index() -> VoidResult {
     std::unique_lock lock(mutex_);
     index_.clear();
+    hashes_.clear();  // files may have changed behind our back
 
     if (!std::filesystem::exists(config_.root_path)) {
         return ok();
@@ -488,15 +752,68 @@ auto file_storage::build_date_path(std::string_view study_date,
            (sanitize_uid(sop_uid) + config_.file_extension);
 }
 
+auto file_storage::instance_path(std::string_view study_uid,
+                                 std::string_view series_uid,
+                                 std::string_view sop_uid,
+                                 std::string study_date) const
+    -> std::filesystem::path {
+    switch (config_.naming) {
+        case naming_scheme::uid_hierarchical:
+            return build_path(study_uid, series_uid, sop_uid);
+        case naming_scheme::date_hierarchical: {
+            if (study_date.empty()) {
+                // Use current date if study date not available
+                auto now = std::chrono::system_clock::now();
+                auto time = std::chrono::system_clock::to_time_t(now);
+                std::tm tm_buf{};
+#ifdef _WIN32
+                localtime_s(&tm_buf, &time);
+#else
+                localtime_r(&time, &tm_buf);
+#endif
+                char date_str[9];
+                std::strftime(date_str, sizeof(date_str), "%Y%m%d", &tm_buf);
+                study_date = date_str;
+            }
+            return build_date_path(study_date, study_uid, sop_uid);
+        }
+        case naming_scheme::flat:
+            break;
+    }
+    return config_.root_path / (sanitize_uid(sop_uid) + config_.file_extension);
+}
+
+auto file_storage::admit_instance(const std::string& sop_uid) const
+    -> Result<bool> {
+    std::shared_lock lock(mutex_);
+    if (!index_.contains(sop_uid)) {
+        return true;
+    }
+    switch (config_.duplicate) {
+        case duplicate_policy::reject:
+            return make_error<bool>(kDuplicateInstance,
+                                    "Instance already exists: " + sop_uid,
+                                    "file_storage");
+        case duplicate_policy::ignore:
+            return false;
+        case duplicate_policy::replace:
+            break;
+    }
+    return true;
+}
+
 void file_storage::update_index(const std::string& sop_uid,
-                                const std::filesystem::path& path) {
+                                const std::filesystem::path& path,
+                                std::string content_hash) {
     std::unique_lock lock(mutex_);
     index_[sop_uid] = path;
+    hashes_[sop_uid] = std::move(content_hash);
 }
 
 void file_storage::remove_from_index(const std::string& sop_uid) {
     std::unique_lock lock(mutex_);
     index_.erase(sop_uid);
+    hashes_.erase(sop_uid);
 }
 
 auto file_storage::matches_query(const core::dicom_dataset& dataset,
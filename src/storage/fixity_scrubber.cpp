@@ -0,0 +1,322 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file fixity_scrubber.cpp
+ * @brief Implementation of throttled fixity verification
+ */
+
+#include <kcenon/pacs/storage/fixity_scrubber.h>
+
+#include <kcenon/pacs/monitoring/pacs_metrics.h>
+#include <kcenon/pacs/storage/content_hash.h>
+#include <kcenon/pacs/storage/index_database.h>
+#include <kcenon/pacs/storage/rate_limiter.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string_view>
+#include <thread>
+
+namespace kcenon::pacs::storage {
+
+namespace {
+
+/// Prefix of the hashes file_storage records at ingest
+constexpr std::string_view kHashPrefix = "xxh64:";
+
+/// Result of verifying one file, produced on a worker thread
+struct file_outcome {
+    fixity_status status{fixity_status::verified};
+    std::string expected;
+    std::string actual;
+    std::uint64_t bytes_read{0};
+};
+
+auto verify_file(const instance_record& record,
+                 const fixity_scrubber_config& config,
+                 rate_limiter& bandwidth,
+                 rate_limiter& iops) -> file_outcome {
+    file_outcome outcome;
+    const std::filesystem::path path(record.file_path);
+
+    iops.acquire(1.0);
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        outcome.status = std::filesystem::exists(path, ec)
+                             ? fixity_status::unreadable
+                             : fixity_status::missing;
+        return outcome;
+    }
+
+    if (record.file_size > 0 && size != static_cast<std::uint64_t>(record.file_size)) {
+        outcome.status = fixity_status::mismatch;
+        outcome.expected = std::to_string(record.file_size);
+        outcome.actual = std::to_string(size);
+        return outcome;
+    }
+
+    const bool recorded = record.file_hash.starts_with(kHashPrefix);
+    const bool backfill = record.file_hash.empty() && config.backfill_missing;
+    if (!config.verify_content || (!recorded && !backfill)) {
+        // Existence and size are all that can be checked
+        const bool checked = !config.verify_content && recorded;
+        outcome.status = checked ? fixity_status::verified : fixity_status::skipped;
+        return outcome;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        outcome.status = fixity_status::unreadable;
+        return outcome;
+    }
+
+    content_hasher hasher;
+    std::vector<std::uint8_t> buffer(std::max<std::size_t>(config.read_chunk_size, 4096));
+    for (;;) {
+        const auto remaining = size > outcome.bytes_read ? size - outcome.bytes_read : 0;
+        iops.acquire(1.0);
+        bandwidth.acquire(static_cast<double>(
+            std::min<std::uint64_t>(buffer.size(), remaining)));
+        file.read(reinterpret_cast<char*>(buffer.data()),
+                  static_cast<std::streamsize>(buffer.size()));
+        const auto n = static_cast<std::size_t>(file.gcount());
+        hasher.update(std::span<const std::uint8_t>(buffer.data(), n));
+        outcome.bytes_read += n;
+        if (file.eof()) {
+            break;
+        }
+        if (!file) {
+            outcome.status = fixity_status::unreadable;
+            return outcome;
+        }
+    }
+
+    outcome.actual = hasher.hex_digest();
+    if (backfill) {
+        outcome.status = fixity_status::backfilled;
+    } else if (outcome.actual == record.file_hash) {
+        outcome.status = fixity_status::verified;
+    } else {
+        outcome.status = fixity_status::mismatch;
+        outcome.expected = record.file_hash;
+    }
+    return outcome;
+}
+
+}  // namespace
+
+auto to_string(fixity_status status) -> std::string {
+    switch (status) {
+        case fixity_status::verified: return "verified";
+        case fixity_status::mismatch: return "mismatch";
+        case fixity_status::missing: return "missing";
+        case fixity_status::unreadable: return "unreadable";
+        case fixity_status::backfilled: return "backfilled";
+        case fixity_status::skipped: return "skipped";
+    }
+    return "unknown";
+}
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+fixity_scrubber::fixity_scrubber(index_database& database,
+                                 fixity_scrubber_config config)
+    : database_(database), config_(std::move(config)) {
+    config_.worker_count = std::max<std::size_t>(config_.worker_count, 1);
+    config_.batch_size = std::max<std::size_t>(config_.batch_size, 1);
+    load_checkpoint();
+}
+
+// ============================================================================
+// Verification
+// ============================================================================
+
+auto fixity_scrubber::run() -> fixity_report {
+    std::lock_guard run_lock(run_mutex_);
+    cancel_requested_ = false;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto& metrics = monitoring::pacs_metrics::global_metrics().fixity();
+    rate_limiter bandwidth(static_cast<double>(config_.max_bytes_per_second));
+    rate_limiter iops(static_cast<double>(config_.max_iops));
+
+    fixity_report report;
+    auto after_pk = checkpoint_.load();
+    std::size_t since_checkpoint = 0;
+
+    while (!cancel_requested_) {
+        auto limit = config_.batch_size;
+        if (config_.max_instances_per_run > 0) {
+            limit = std::min(limit, config_.max_instances_per_run - report.checked);
+            if (limit == 0) {
+                break;
+            }
+        }
+
+        auto page_result = database_.list_instances_after(after_pk, limit);
+        if (page_result.is_err()) {
+            report.error = page_result.error().message;
+            break;
+        }
+        const auto& page = page_result.value();
+
+        // Verify the page on the worker pool
+        std::vector<file_outcome> outcomes(page.size());
+        std::atomic<std::size_t> next{0};
+        const auto workers = std::min(config_.worker_count, page.size());
+        std::vector<std::thread> threads;
+        threads.reserve(workers);
+        for (std::size_t w = 0; w < workers; ++w) {
+            threads.emplace_back([&] {
+                for (auto i = next++; i < page.size(); i = next++) {
+                    outcomes[i] = verify_file(page[i], config_, bandwidth, iops);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (std::size_t i = 0; i < page.size(); ++i) {
+            const auto& record = page[i];
+            auto& outcome = outcomes[i];
+            report.bytes_read += outcome.bytes_read;
+
+            if (outcome.status == fixity_status::backfilled) {
+                // Conditional on the row still lacking a hash and matching
+                // the hashed size: the page may be stale by now
+                auto recorded = database_.set_missing_file_hash(
+                    record.sop_uid, outcome.actual,
+                    static_cast<int64_t>(outcome.bytes_read));
+                if (recorded.is_err() || !recorded.value()) {
+                    outcome.status = fixity_status::skipped;
+                }
+            }
+
+            switch (outcome.status) {
+                case fixity_status::verified:
+                    ++report.verified;
+                    metrics.record_verified(outcome.bytes_read);
+                    break;
+                case fixity_status::backfilled:
+                    ++report.backfilled;
+                    metrics.hashes_backfilled.fetch_add(1, std::memory_order_relaxed);
+                    break;
+                case fixity_status::skipped:
+                    ++report.skipped;
+                    break;
+                case fixity_status::mismatch:
+                    ++report.mismatched;
+                    metrics.mismatches.fetch_add(1, std::memory_order_relaxed);
+                    break;
+                case fixity_status::missing:
+                    ++report.missing;
+                    metrics.missing.fetch_add(1, std::memory_order_relaxed);
+                    break;
+                case fixity_status::unreadable:
+                    ++report.unreadable;
+                    metrics.unreadable.fetch_add(1, std::memory_order_relaxed);
+                    break;
+            }
+
+            const bool failed = outcome.status == fixity_status::mismatch ||
+                                outcome.status == fixity_status::missing ||
+                                outcome.status == fixity_status::unreadable;
+            if (failed && report.failures.size() < config_.max_reported_failures) {
+                report.failures.push_back({record.sop_uid, record.file_path,
+                                           outcome.status,
+                                           std::move(outcome.expected),
+                                           std::move(outcome.actual)});
+            }
+        }
+
+        report.checked += page.size();
+        since_checkpoint += page.size();
+
+        if (page.size() < limit) {
+            // End of the table: the next run starts a new pass
+            after_pk = 0;
+            report.pass_completed = true;
+            ++passes_completed_;
+            checkpoint_ = after_pk;
+            break;
+        }
+
+        after_pk = page.back().pk;
+        checkpoint_ = after_pk;
+        if (since_checkpoint >= config_.checkpoint_interval) {
+            save_checkpoint(after_pk);
+            since_checkpoint = 0;
+        }
+    }
+
+    save_checkpoint(after_pk);
+    report.resume_after_pk = after_pk;
+    report.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    return report;
+}
+
+void fixity_scrubber::cancel() noexcept {
+    cancel_requested_ = true;
+}
+
+// ============================================================================
+// Checkpoint
+// ============================================================================
+
+auto fixity_scrubber::checkpoint() const noexcept -> int64_t {
+    return checkpoint_.load();
+}
+
+void fixity_scrubber::reset_checkpoint() {
+    std::lock_guard run_lock(run_mutex_);
+    checkpoint_ = 0;
+    save_checkpoint(0);
+}
+
+auto fixity_scrubber::passes_completed() const noexcept -> std::size_t {
+    return passes_completed_.load();
+}
+
+auto fixity_scrubber::config() const noexcept -> const fixity_scrubber_config& {
+    return config_;
+}
+
+void fixity_scrubber::load_checkpoint() {
+    if (config_.checkpoint_path.empty()) {
+        return;
+    }
+
+    std::ifstream in(config_.checkpoint_path);
+    int64_t after_pk = 0;
+    if (in >> after_pk && after_pk > 0) {
+        checkpoint_ = after_pk;
+    }
+}
+
+void fixity_scrubber::save_checkpoint(int64_t after_pk) const {
+    if (config_.checkpoint_path.empty()) {
+        return;
+    }
+
+    // Write then rename, so a crash never leaves a torn checkpoint
+    auto temp_path = config_.checkpoint_path;
+    temp_path += ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::trunc);
+        out << after_pk << '\n';
+        if (!out.flush()) {
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp_path, config_.checkpoint_path, ec);
+}
+
+}  // namespace kcenon::pacs::storage
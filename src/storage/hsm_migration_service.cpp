@@ -74,6 +74,10 @@ void hsm_migration_service::stop(bool wait_for_completion) {
         stop_requested_.store(true);
     }
 
+    // Let a running cycle finish its in-flight transfers and return; the
+    // remaining candidates are migrated by the next cycle after restart
+    storage_.cancel_migration();
+
     // Wake up the worker thread
     cv_.notify_all();
 
@@ -186,16 +190,29 @@ void hsm_migration_service::run_loop() {
     while (!stop_requested_.load()) {
         std::unique_lock lock(mutex_);
 
-        // Wait until next cycle time or stop requested
-        cv_.wait_until(lock, next_cycle_time_, [this]() {
-            return stop_requested_.load() ||
-                   std::chrono::steady_clock::now() >= next_cycle_time_;
+        // Wait until next cycle time, the next access flush, or stop
+        auto wake_time = next_cycle_time_;
+        if (config_.access_flush_interval.count() > 0) {
+            wake_time = (std::min)(wake_time, std::chrono::steady_clock::now() +
+                                                  config_.access_flush_interval);
+        }
+        cv_.wait_until(lock, wake_time, [this, wake_time]() {
+            const auto now = std::chrono::steady_clock::now();
+            return stop_requested_.load() || now >= next_cycle_time_ ||
+                   now >= wake_time;
         });
 
         if (stop_requested_.load()) {
             break;
         }
 
+        // Woken for a flush only: keep access times current between cycles
+        if (std::chrono::steady_clock::now() < next_cycle_time_) {
+            lock.unlock();
+            storage_.flush_access_times();
+            continue;
+        }
+
         // Release lock during migration
         lock.unlock();
 
@@ -227,7 +244,7 @@ void hsm_migration_service::run_loop() {
 auto hsm_migration_service::execute_cycle() -> migration_result {
     cycle_in_progress_.store(true);
 
-    auto result = storage_.run_migration_cycle();
+    auto result = storage_.run_migration_cycle(config_.max_concurrent_migrations);
 
     // Call error callbacks for failures
     if (!result.failed_uids.empty() && config_.on_migration_error) {
@@ -248,6 +265,7 @@ void hsm_migration_service::update_stats(const migration_result& result) {
     cumulative_stats_.bytes_migrated += result.bytes_migrated;
     cumulative_stats_.duration += result.duration;
     cumulative_stats_.instances_skipped += result.instances_skipped;
+    cumulative_stats_.instances_recompressed += result.instances_recompressed;
 
     // Append failed UIDs (keep last N)
     constexpr std::size_t kMaxFailedUids = 100;
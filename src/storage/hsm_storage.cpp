@@ -9,13 +9,18 @@
 
 #include <kcenon/pacs/storage/hsm_storage.h>
 
+#include <kcenon/pacs/storage/content_hash.h>
+
 #include <kcenon/pacs/core/dicom_tag_constants.h>
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <stdexcept>
+#include <thread>
 
 namespace kcenon::pacs::storage {
 
@@ -31,6 +36,121 @@ constexpr int kMigrationFailed = -102;
 constexpr int kTierNotAvailable = -103;
 constexpr int kIntegrityError = -104;
 
+/// Read size for migration transfers and digest checks
+constexpr std::size_t kTransferChunkSize = 1024 * 1024;
+
+/**
+ * @brief Digest every byte of a source, reading in chunks if needed
+ */
+auto digest_source(byte_source& source) -> Result<std::uint64_t> {
+    auto region = source.contiguous();
+    if (!region.empty() || source.size() == 0) {
+        return content_hasher::hash(region);
+    }
+
+    content_hasher hasher;
+    std::vector<std::uint8_t> buffer(kTransferChunkSize);
+    for (;;) {
+        auto n = source.read(buffer);
+        if (n.is_err()) {
+            return make_error<std::uint64_t>(n.error().code, n.error().message,
+                                             "hsm_storage");
+        }
+        if (n.value() == 0) {
+            break;
+        }
+        hasher.update(std::span<const std::uint8_t>(buffer).first(n.value()));
+    }
+    return hasher.digest();
+}
+
+/**
+ * @brief Digest of the bytes a tier stores for an instance
+ */
+auto digest_stored(storage_interface& storage, std::string_view uid)
+    -> Result<std::uint64_t> {
+    auto reader = storage.open_read(uid);
+    if (reader.is_err()) {
+        return make_error<std::uint64_t>(reader.error().code,
+                                         reader.error().message, "hsm_storage");
+    }
+    return digest_source(*reader.value());
+}
+
+/**
+ * @brief byte_source that digests and paces the bytes passing through it
+ *
+ * Without pacing, a contiguous source is digested up front and handed on
+ * as one span, so file-to-file copies stay a single write.
+ */
+class transfer_source final : public byte_source {
+public:
+    transfer_source(byte_source& inner, std::function<void(std::size_t)> pace)
+        : inner_(inner), pace_(std::move(pace)) {
+        if (!pace_ && !inner_.contiguous().empty()) {
+            hasher_.update(inner_.contiguous());
+        }
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::uint64_t override {
+        return inner_.size();
+    }
+
+    [[nodiscard]] auto read(std::span<std::uint8_t> buffer)
+        -> Result<std::size_t> override {
+        const auto remaining = inner_.size() - consumed_;
+        buffer = buffer.first(static_cast<std::size_t>(
+            (std::min)({static_cast<std::uint64_t>(buffer.size()),
+                        static_cast<std::uint64_t>(kTransferChunkSize),
+                        remaining})));
+        if (buffer.empty()) {
+            return std::size_t{0};
+        }
+        if (pace_) {
+            pace_(buffer.size());
+        }
+        auto n = inner_.read(buffer);
+        if (n.is_ok()) {
+            hasher_.update(
+                std::span<const std::uint8_t>(buffer).first(n.value()));
+            consumed_ += n.value();
+        }
+        return n;
+    }
+
+    [[nodiscard]] auto contiguous() const noexcept
+        -> std::span<const std::uint8_t> override {
+        return pace_ ? std::span<const std::uint8_t>{} : inner_.contiguous();
+    }
+
+    /// Digest of the bytes handed out so far
+    [[nodiscard]] auto digest() const noexcept -> std::uint64_t {
+        return hasher_.digest();
+    }
+
+private:
+    byte_source& inner_;
+    std::function<void(std::size_t)> pace_;
+    content_hasher hasher_;
+    std::uint64_t consumed_{0};
+};
+
+/// Inactivity after which instances of from_tier move to to_tier
+auto inactivity_threshold(const tier_policy& policy, storage_tier from_tier,
+                          storage_tier to_tier)
+    -> std::optional<std::chrono::system_clock::duration> {
+    if (from_tier == storage_tier::hot && to_tier == storage_tier::warm) {
+        return policy.hot_to_warm;
+    }
+    if (from_tier == storage_tier::warm && to_tier == storage_tier::cold) {
+        return policy.warm_to_cold;
+    }
+    if (from_tier == storage_tier::hot && to_tier == storage_tier::cold) {
+        return policy.hot_to_warm + policy.warm_to_cold;
+    }
+    return std::nullopt;
+}
+
 }  // namespace
 
 // ============================================================================
@@ -44,7 +164,8 @@ hsm_storage::hsm_storage(std::unique_ptr<storage_interface> hot_tier,
     : hot_tier_(std::move(hot_tier)),
       warm_tier_(std::move(warm_tier)),
       cold_tier_(std::move(cold_tier)),
-      config_(config) {
+      config_(config),
+      access_tracker_(config.access_time_granularity) {
     if (!hot_tier_) {
         throw std::invalid_argument("hot_tier cannot be nullptr");
     }
@@ -75,6 +196,25 @@ auto hsm_storage::store(const core::dicom_dataset& dataset) -> VoidResult {
     return ok();
 }
 
+auto hsm_storage::store_file(const core::dicom_file& file) -> VoidResult {
+    const auto& dataset = file.dataset();
+    auto sop_uid = dataset.get_string(core::tags::sop_instance_uid);
+    if (sop_uid.empty()) {
+        return make_error<std::monostate>(
+            kInvalidConfiguration, "Missing SOP Instance UID", "hsm_storage");
+    }
+
+    auto result = hot_tier_->store_file(file);
+    if (!result.is_ok()) {
+        return result;
+    }
+
+    std::unique_lock lock(mutex_);
+    update_metadata(sop_uid, storage_tier::hot, dataset);
+
+    return ok();
+}
+
 auto hsm_storage::retrieve(std::string_view sop_instance_uid)
     -> Result<core::dicom_dataset> {
     // Find which tier contains the instance
@@ -98,10 +238,77 @@ auto hsm_storage::retrieve(std::string_view sop_instance_uid)
         return result;
     }
 
-    // Update access time if tracking is enabled
+    // Record the access; it reaches the metadata on the next flush
     if (config_.track_access_time) {
-        std::unique_lock lock(mutex_);
-        update_access_time(sop_instance_uid);
+        access_tracker_.record(sop_instance_uid);
+    }
+
+    return result;
+}
+
+auto hsm_storage::retrieve_file(std::string_view sop_instance_uid)
+    -> Result<core::dicom_file> {
+    auto tier = find_tier(sop_instance_uid);
+    if (!tier.has_value()) {
+        return make_error<core::dicom_file>(
+            kInstanceNotFound,
+            "Instance not found: " + std::string(sop_instance_uid),
+            "hsm_storage");
+    }
+
+    auto* storage = get_storage(*tier);
+    if (storage == nullptr) {
+        return make_error<core::dicom_file>(
+            kTierNotAvailable, "Tier storage not available", "hsm_storage");
+    }
+
+    auto result = storage->retrieve_file(sop_instance_uid);
+    if (!result.is_ok()) {
+        return result;
+    }
+
+    if (config_.track_access_time) {
+        access_tracker_.record(sop_instance_uid);
+    }
+
+    return result;
+}
+
+auto hsm_storage::store_stream(byte_source& source) -> Result<stored_instance> {
+    auto result = hot_tier_->store_stream(source);
+    if (!result.is_ok()) {
+        return result;
+    }
+
+    std::unique_lock lock(mutex_);
+    update_metadata(result.value(), storage_tier::hot);
+
+    return result;
+}
+
+auto hsm_storage::open_read(std::string_view sop_instance_uid, byte_range range)
+    -> Result<std::unique_ptr<byte_source>> {
+    auto tier = find_tier(sop_instance_uid);
+    if (!tier.has_value()) {
+        return make_error<std::unique_ptr<byte_source>>(
+            kInstanceNotFound,
+            "Instance not found: " + std::string(sop_instance_uid),
+            "hsm_storage");
+    }
+
+    auto* storage = get_storage(*tier);
+    if (storage == nullptr) {
+        return make_error<std::unique_ptr<byte_source>>(
+            kTierNotAvailable, "Tier storage not available", "hsm_storage");
+    }
+
+    auto result = storage->open_read(sop_instance_uid, range);
+    if (!result.is_ok()) {
+        return result;
+    }
+
+    if (config_.track_access_time) {
+        access_tracker_.record(sop_instance_uid);
     }
 
     return result;
@@ -139,6 +346,18 @@ auto hsm_storage::exists(std::string_view sop_instance_uid) const -> bool {
     return metadata_index_.contains(std::string(sop_instance_uid));
 }
 
+auto hsm_storage::exists_batch(
+    const std::vector<std::string>& sop_instance_uids) const
+    -> std::vector<bool> {
+    std::vector<bool> found;
+    found.reserve(sop_instance_uids.size());
+    std::shared_lock lock(mutex_);
+    for (const auto& uid : sop_instance_uids) {
+        found.push_back(metadata_index_.contains(uid));
+    }
+    return found;
+}
+
 auto hsm_storage::find(const core::dicom_dataset& query)
     -> Result<std::vector<core::dicom_dataset>> {
     std::vector<core::dicom_dataset> combined_results;
@@ -259,12 +478,21 @@ auto hsm_storage::get_tier(std::string_view sop_instance_uid) const
 
 auto hsm_storage::get_tier_metadata(std::string_view sop_instance_uid) const
     -> std::optional<tier_metadata> {
-    std::shared_lock lock(mutex_);
-    auto it = metadata_index_.find(std::string(sop_instance_uid));
-    if (it == metadata_index_.end()) {
-        return std::nullopt;
+    std::optional<tier_metadata> meta;
+    {
+        std::shared_lock lock(mutex_);
+        auto it = metadata_index_.find(std::string(sop_instance_uid));
+        if (it == metadata_index_.end()) {
+            return std::nullopt;
+        }
+        meta = it->second;
     }
-    return it->second;
+
+    if (auto pending = access_tracker_.last_access(sop_instance_uid);
+        pending && (!meta->last_accessed || *meta->last_accessed < *pending)) {
+        meta->last_accessed = pending;
+    }
+    return meta;
 }
 
 auto hsm_storage::migrate(std::string_view sop_instance_uid,
@@ -284,7 +512,12 @@ auto hsm_storage::migrate(std::string_view sop_instance_uid,
         return ok();
     }
 
-    return migrate_instance(sop_instance_uid, current_tier, target_tier);
+    auto result = migrate_instance(sop_instance_uid, current_tier, target_tier);
+    if (result.is_err()) {
+        return make_error<std::monostate>(result.error().code,
+                                          result.error().message, "hsm_storage");
+    }
+    return ok();
 }
 
 auto hsm_storage::get_migration_candidates(storage_tier from_tier,
@@ -293,10 +526,33 @@ auto hsm_storage::get_migration_candidates(storage_tier from_tier,
     std::vector<tier_metadata> candidates;
 
     std::shared_lock lock(mutex_);
-    for (const auto& [uid, meta] : metadata_index_) {
-        if (meta.current_tier == from_tier &&
-            meta.should_migrate(config_.policy, to_tier)) {
-            candidates.push_back(meta);
+    auto threshold = inactivity_threshold(config_.policy, from_tier, to_tier);
+    if (!threshold.has_value()) {
+        return candidates;
+    }
+
+    // activity_index_ never shows an instance as more recently active than
+    // it is (pending accesses only move activity forward), so stopping at
+    // the cutoff misses no candidate; pending accesses are checked per entry
+    const auto cutoff = std::chrono::system_clock::now() - *threshold;
+    for (auto it = activity_index_.lower_bound(
+             {from_tier, std::chrono::system_clock::time_point::min(), {}});
+         it != activity_index_.end() && std::get<0>(*it) == from_tier &&
+         std::get<1>(*it) <= cutoff;
+         ++it) {
+        const auto& uid = std::get<2>(*it);
+        auto meta_it = metadata_index_.find(uid);
+        if (meta_it == metadata_index_.end()) {
+            continue;
+        }
+
+        auto meta = meta_it->second;
+        if (auto pending = access_tracker_.last_access(uid);
+            pending && (!meta.last_accessed || *meta.last_accessed < *pending)) {
+            meta.last_accessed = pending;
+        }
+        if (meta.should_migrate(config_.policy, to_tier)) {
+            candidates.push_back(std::move(meta));
         }
     }
 
@@ -310,92 +566,138 @@ auto hsm_storage::get_migration_candidates(storage_tier from_tier,
 }
 
 auto hsm_storage::run_migration_cycle() -> migration_result {
+    return run_migration_cycle(0);
+}
+
+auto hsm_storage::run_migration_cycle(std::size_t parallelism)
+    -> migration_result {
     migration_result result;
     auto start_time = std::chrono::steady_clock::now();
+    const auto recompressed_before = instances_recompressed_.load();
+
+    if (parallelism == 0) {
+        parallelism = (std::max)(config_.migration_parallelism, std::size_t{1});
+    }
+    migration_cancelled_.store(false);
+    flush_access_times();
 
     // Hot to warm migration
     if (warm_tier_) {
-        auto candidates =
-            get_migration_candidates(storage_tier::hot, storage_tier::warm);
-
-        for (const auto& meta : candidates) {
-            if (result.instances_migrated >=
-                config_.policy.max_instances_per_cycle) {
-                break;
-            }
-            if (result.bytes_migrated >= config_.policy.max_bytes_per_cycle) {
-                break;
-            }
-
-            auto migrate_result = migrate_instance(
-                meta.sop_instance_uid, storage_tier::hot, storage_tier::warm);
-
-            if (migrate_result.is_ok()) {
-                result.instances_migrated++;
-                result.bytes_migrated += meta.size_bytes;
-            } else {
-                result.failed_uids.push_back(meta.sop_instance_uid);
-            }
-        }
+        migrate_candidates(
+            get_migration_candidates(storage_tier::hot, storage_tier::warm),
+            storage_tier::hot, storage_tier::warm, parallelism, result);
     }
 
     // Warm to cold migration
     if (cold_tier_) {
-        auto candidates =
-            get_migration_candidates(storage_tier::warm, storage_tier::cold);
+        migrate_candidates(
+            get_migration_candidates(storage_tier::warm, storage_tier::cold),
+            storage_tier::warm, storage_tier::cold, parallelism, result);
+    }
 
-        for (const auto& meta : candidates) {
-            if (result.instances_migrated >=
-                config_.policy.max_instances_per_cycle) {
-                break;
-            }
-            if (result.bytes_migrated >= config_.policy.max_bytes_per_cycle) {
-                break;
-            }
+    // Also check hot to cold (if warm tier is skipped)
+    if (!warm_tier_ && cold_tier_) {
+        migrate_candidates(
+            get_migration_candidates(storage_tier::hot, storage_tier::cold),
+            storage_tier::hot, storage_tier::cold, parallelism, result);
+    }
 
-            auto migrate_result = migrate_instance(
-                meta.sop_instance_uid, storage_tier::warm, storage_tier::cold);
+    result.instances_recompressed =
+        instances_recompressed_.load() - recompressed_before;
 
-            if (migrate_result.is_ok()) {
-                result.instances_migrated++;
-                result.bytes_migrated += meta.size_bytes;
-            } else {
-                result.failed_uids.push_back(meta.sop_instance_uid);
-            }
-        }
+    auto end_time = std::chrono::steady_clock::now();
+    result.duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        end_time - start_time);
+
+    {
+        std::lock_guard lock(throughput_mutex_);
+        throughput_.busy_time += result.duration;
+        throughput_.last_cycle_bytes_per_second = result.bytes_per_second();
     }
 
-    // Also check hot to cold (if warm tier is skipped)
-    if (!warm_tier_ && cold_tier_) {
-        auto candidates =
-            get_migration_candidates(storage_tier::hot, storage_tier::cold);
+    return result;
+}
 
-        for (const auto& meta : candidates) {
-            if (result.instances_migrated >=
+auto hsm_storage::flush_access_times() -> std::size_t {
+    if (access_tracker_.pending() == 0) {
+        return 0;
+    }
+
+    auto accesses = access_tracker_.drain();
+    std::unique_lock lock(mutex_);
+    for (const auto& [uid, when] : accesses) {
+        update_access_time(uid, when);
+    }
+    return accesses.size();
+}
+
+void hsm_storage::cancel_migration() noexcept {
+    migration_cancelled_.store(true);
+}
+
+void hsm_storage::migrate_candidates(const std::vector<tier_metadata>& candidates,
+                                     storage_tier from_tier,
+                                     storage_tier to_tier,
+                                     std::size_t parallelism,
+                                     migration_result& result) {
+    std::mutex result_mutex;
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> reserved_instances{result.instances_migrated};
+    std::atomic<std::uint64_t> reserved_bytes{result.bytes_migrated};
+
+    auto worker_loop = [&]() {
+        for (;;) {
+            if (migration_cancelled_.load()) {
+                return;
+            }
+            // Per-cycle budgets are reserved before the transfer starts so
+            // concurrent workers cannot overshoot them
+            if (reserved_instances.fetch_add(1) >=
                 config_.policy.max_instances_per_cycle) {
-                break;
+                return;
             }
-            if (result.bytes_migrated >= config_.policy.max_bytes_per_cycle) {
-                break;
+            const auto index = next.fetch_add(1);
+            if (index >= candidates.size()) {
+                return;
+            }
+            const auto& meta = candidates[index];
+            if (reserved_bytes.fetch_add(meta.size_bytes) >=
+                config_.policy.max_bytes_per_cycle) {
+                return;
             }
 
-            auto migrate_result = migrate_instance(
-                meta.sop_instance_uid, storage_tier::hot, storage_tier::cold);
+            auto migrated =
+                migrate_instance(meta.sop_instance_uid, from_tier, to_tier);
 
-            if (migrate_result.is_ok()) {
+            std::lock_guard lock(result_mutex);
+            if (migrated.is_ok()) {
                 result.instances_migrated++;
-                result.bytes_migrated += meta.size_bytes;
+                result.bytes_migrated += migrated.value();
             } else {
                 result.failed_uids.push_back(meta.sop_instance_uid);
             }
         }
+    };
+
+    const auto workers = (std::min)(parallelism, candidates.size());
+    if (workers <= 1) {
+        worker_loop();
+    } else {
+        std::vector<std::thread> threads;
+        threads.reserve(workers);
+        for (std::size_t i = 0; i < workers; ++i) {
+            threads.emplace_back(worker_loop);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
     }
 
-    auto end_time = std::chrono::steady_clock::now();
-    result.duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-        end_time - start_time);
-
-    return result;
+    if (migration_cancelled_.load()) {
+        const auto handled = (std::min)(next.load(), candidates.size());
+        result.instances_skipped += candidates.size() - handled;
+        result.interrupted = result.interrupted || handled < candidates.size();
+    }
 }
 
 auto hsm_storage::get_tier_policy() const -> tier_policy {
@@ -459,6 +761,11 @@ auto hsm_storage::get_hsm_statistics() const -> hsm_statistics {
     stats.cold.study_count = cold_studies.size();
     stats.cold.series_count = cold_series.size();
 
+    {
+        std::lock_guard throughput_lock(throughput_mutex_);
+        stats.migration = throughput_;
+    }
+
     return stats;
 }
 
@@ -525,40 +832,212 @@ void hsm_storage::update_metadata(std::string_view sop_instance_uid,
     // For now, estimate based on pixel data if present
     meta.size_bytes = 0;  // Will be updated by storage backend
 
-    metadata_index_[uid] = std::move(meta);
+    put_metadata(std::move(meta));
 }
 
-void hsm_storage::update_access_time(std::string_view sop_instance_uid) {
+void hsm_storage::update_metadata(const stored_instance& instance,
+                                   storage_tier tier) {
+    tier_metadata meta;
+    meta.sop_instance_uid = instance.sop_instance_uid;
+    meta.current_tier = tier;
+    meta.stored_at = std::chrono::system_clock::now();
+    meta.study_instance_uid = instance.study_instance_uid;
+    meta.series_instance_uid = instance.series_instance_uid;
+    meta.size_bytes = instance.size_bytes;
+
+    put_metadata(std::move(meta));
+}
+
+void hsm_storage::update_access_time(std::string_view sop_instance_uid,
+                                     std::chrono::system_clock::time_point when) {
     auto it = metadata_index_.find(std::string(sop_instance_uid));
-    if (it != metadata_index_.end()) {
-        it->second.last_accessed = std::chrono::system_clock::now();
+    if (it == metadata_index_.end() ||
+        (it->second.last_accessed && *it->second.last_accessed >= when)) {
+        return;
     }
+
+    activity_index_.erase(activity_key(it->second));
+    it->second.last_accessed = when;
+    activity_index_.insert(activity_key(it->second));
 }
 
 void hsm_storage::remove_metadata(std::string_view sop_instance_uid) {
-    metadata_index_.erase(std::string(sop_instance_uid));
+    auto it = metadata_index_.find(std::string(sop_instance_uid));
+    if (it == metadata_index_.end()) {
+        return;
+    }
+
+    activity_index_.erase(activity_key(it->second));
+    metadata_index_.erase(it);
+}
+
+void hsm_storage::put_metadata(tier_metadata meta) {
+    auto [it, inserted] =
+        metadata_index_.try_emplace(meta.sop_instance_uid, tier_metadata{});
+    if (!inserted) {
+        activity_index_.erase(activity_key(it->second));
+    }
+    it->second = std::move(meta);
+    activity_index_.insert(activity_key(it->second));
+}
+
+auto hsm_storage::activity_key(const tier_metadata& meta)
+    -> std::tuple<storage_tier, std::chrono::system_clock::time_point,
+                  std::string> {
+    return {meta.current_tier, meta.last_accessed.value_or(meta.stored_at),
+            meta.sop_instance_uid};
 }
 
 auto hsm_storage::migrate_instance(std::string_view uid, storage_tier from_tier,
-                                    storage_tier to_tier) -> VoidResult {
+                                    storage_tier to_tier)
+    -> Result<std::uint64_t> {
     auto* source = get_storage(from_tier);
     auto* target = get_storage(to_tier);
 
     if (source == nullptr) {
-        return make_error<std::monostate>(
+        return make_error<std::uint64_t>(
             kTierNotAvailable,
             "Source tier not available: " + std::string(to_string(from_tier)),
             "hsm_storage");
     }
     if (target == nullptr) {
-        return make_error<std::monostate>(
+        return make_error<std::uint64_t>(
             kTierNotAvailable,
             "Target tier not available: " + std::string(to_string(to_tier)),
             "hsm_storage");
     }
 
-    // Retrieve from source
-    auto retrieve_result = source->retrieve(uid);
+    // Recompression needs the decoded instance; everything else moves as
+    // the stored bytes
+    const auto& compression = to_tier == storage_tier::cold
+                                  ? config_.cold_compression
+                                  : config_.warm_compression;
+    const bool transcode = !config_.byte_copy_migration ||
+                           (to_tier != storage_tier::hot && compression.enabled());
+
+    std::uint64_t bytes = 0;
+    if (transcode) {
+        auto result = transcode_instance(uid, *source, *target, to_tier);
+        if (result.is_err()) {
+            return make_error<std::uint64_t>(result.error().code,
+                                             result.error().message,
+                                             "hsm_storage");
+        }
+        std::shared_lock lock(mutex_);
+        auto it = metadata_index_.find(std::string(uid));
+        bytes = it != metadata_index_.end() ? it->second.size_bytes : 0;
+    } else {
+        auto result = copy_instance_bytes(uid, *source, *target);
+        if (result.is_err()) {
+            return result;
+        }
+        bytes = result.value();
+    }
+
+    // Remove from source if configured
+    if (config_.delete_after_migration) {
+        auto remove_result = source->remove(uid);
+        // Ignore remove failure - the instance is already in target tier
+        (void)remove_result;
+    }
+
+    // Update metadata
+    {
+        std::unique_lock lock(mutex_);
+        auto it = metadata_index_.find(std::string(uid));
+        if (it != metadata_index_.end()) {
+            activity_index_.erase(activity_key(it->second));
+            it->second.current_tier = to_tier;
+            activity_index_.insert(activity_key(it->second));
+            if (!transcode) {
+                it->second.size_bytes = static_cast<std::size_t>(bytes);
+            }
+        }
+    }
+
+    {
+        std::lock_guard lock(throughput_mutex_);
+        throughput_.bytes_copied += bytes;
+        throughput_.instances_copied++;
+        if (transcode) {
+            throughput_.transcoded_copies++;
+        } else {
+            throughput_.byte_copies++;
+        }
+    }
+
+    return bytes;
+}
+
+auto hsm_storage::copy_instance_bytes(std::string_view uid,
+                                      storage_interface& source,
+                                      storage_interface& target)
+    -> Result<std::uint64_t> {
+    // An earlier transfer may have landed before it was interrupted; finish
+    // it without copying again when the bytes already match
+    if (target.exists(uid)) {
+        auto existing = digest_stored(target, uid);
+        auto original = digest_stored(source, uid);
+        if (existing.is_ok() && original.is_ok() &&
+            existing.value() == original.value()) {
+            auto reader = target.open_read(uid);
+            if (reader.is_ok()) {
+                std::lock_guard lock(throughput_mutex_);
+                throughput_.resumed++;
+                return reader.value()->size();
+            }
+        }
+        // Stale or partial copy: replace it
+        (void)target.remove(uid);
+    }
+
+    auto reader = source.open_read(uid);
+    if (reader.is_err()) {
+        return make_error<std::uint64_t>(
+            kMigrationFailed,
+            "Failed to read from source: " + reader.error().message,
+            "hsm_storage");
+    }
+
+    std::function<void(std::size_t)> pace;
+    if (config_.migration_bandwidth_limit > 0) {
+        pace = [this](std::size_t bytes) { throttle_transfer(bytes); };
+    }
+    transfer_source transfer(*reader.value(), std::move(pace));
+
+    auto stored = target.store_stream(transfer);
+    if (stored.is_err()) {
+        return make_error<std::uint64_t>(
+            kMigrationFailed,
+            "Failed to store to target: " + stored.error().message,
+            "hsm_storage");
+    }
+
+    if (config_.verify_after_migration) {
+        auto written = digest_stored(target, uid);
+        if (written.is_err() || written.value() != transfer.digest()) {
+            (void)target.remove(uid);
+            {
+                std::lock_guard lock(throughput_mutex_);
+                throughput_.verification_failures++;
+            }
+            return make_error<std::uint64_t>(
+                kIntegrityError,
+                "Verification failed: target digest differs from source for " +
+                    std::string(uid),
+                "hsm_storage");
+        }
+    }
+
+    return stored.value().size_bytes;
+}
+
+auto hsm_storage::transcode_instance(std::string_view uid,
+                                     storage_interface& source,
+                                     storage_interface& target,
+                                     storage_tier to_tier) -> VoidResult {
+    // Retrieve from source, keeping the stored transfer syntax
+    auto retrieve_result = source.retrieve_file(uid);
     if (!retrieve_result.is_ok()) {
         return make_error<std::monostate>(
             kMigrationFailed,
@@ -567,10 +1046,26 @@ auto hsm_storage::migrate_instance(std::string_view uid, storage_tier from_tier,
             "hsm_storage");
     }
 
-    auto& dataset = retrieve_result.value();
+    const core::dicom_file* file = &retrieve_result.value();
+
+    // Recompress native instances on their way to colder tiers. A failed
+    // compression does not block the migration; the instance moves as-is.
+    std::optional<core::dicom_file> compressed;
+    const auto& compression = to_tier == storage_tier::cold
+                                  ? config_.cold_compression
+                                  : config_.warm_compression;
+    if (to_tier != storage_tier::hot && compression.enabled()) {
+        if (const auto* rule = compression.select(*file)) {
+            auto compress_result = compression.compress(*file, *rule);
+            if (compress_result.is_ok()) {
+                compressed = std::move(compress_result.value());
+                file = &*compressed;
+            }
+        }
+    }
 
     // Store to target
-    auto store_result = target->store(dataset);
+    auto store_result = target.store_file(*file);
     if (!store_result.is_ok()) {
         return make_error<std::monostate>(
             kMigrationFailed,
@@ -581,7 +1076,7 @@ auto hsm_storage::migrate_instance(std::string_view uid, storage_tier from_tier,
 
     // Verify if configured
     if (config_.verify_after_migration) {
-        if (!target->exists(uid)) {
+        if (!target.exists(uid)) {
             return make_error<std::monostate>(
                 kMigrationFailed,
                 "Verification failed: instance not found in target tier",
@@ -589,23 +1084,31 @@ auto hsm_storage::migrate_instance(std::string_view uid, storage_tier from_tier,
         }
     }
 
-    // Remove from source if configured
-    if (config_.delete_after_migration) {
-        auto remove_result = source->remove(uid);
-        // Ignore remove failure - the instance is already in target tier
-        (void)remove_result;
+    if (compressed) {
+        instances_recompressed_.fetch_add(1, std::memory_order_relaxed);
     }
 
-    // Update metadata
-    {
-        std::unique_lock lock(mutex_);
-        auto it = metadata_index_.find(std::string(uid));
-        if (it != metadata_index_.end()) {
-            it->second.current_tier = to_tier;
-        }
+    return ok();
+}
+
+void hsm_storage::throttle_transfer(std::size_t bytes) {
+    const auto rate = config_.migration_bandwidth_limit;
+    if (rate == 0 || bytes == 0) {
+        return;
     }
 
-    return ok();
+    // Reserve the next slot on a shared timeline; concurrent transfers
+    // together stay within the configured rate
+    const auto cost = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(static_cast<double>(bytes) /
+                                      static_cast<double>(rate)));
+    std::chrono::steady_clock::time_point start;
+    {
+        std::lock_guard lock(throttle_mutex_);
+        start = (std::max)(std::chrono::steady_clock::now(), throttle_next_);
+        throttle_next_ = start + cost;
+    }
+    std::this_thread::sleep_until(start);
 }
 
 }  // namespace kcenon::pacs::storage
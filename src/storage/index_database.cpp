@@ -16,6 +16,7 @@
 #include <kcenon/pacs/core/result.h>
 #include <kcenon/pacs/storage/audit_repository.h>
 #include <kcenon/pacs/storage/instance_repository.h>
+#include <kcenon/pacs/monitoring/request_tracer.h>
 #include <kcenon/pacs/storage/mpps_repository.h>
 #include <kcenon/pacs/storage/patient_repository.h>
 #include <kcenon/pacs/storage/series_repository.h>
@@ -28,6 +29,7 @@
 #include <database/query_builder.h>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <ctime>
@@ -35,6 +37,7 @@
 #include <kcenon/pacs/compat/format.h>
 #include <kcenon/pacs/compat/time.h>
 #include <iomanip>
+#include <map>
 #include <set>
 #include <sstream>
 #include <variant>
@@ -904,6 +907,594 @@ auto index_database::update_modalities_in_study(int64_t study_pk)
     return study_repository_->update_modalities_in_study(study_pk);
 }
 
+// ============================================================================
+// Study Digest Operations
+// ============================================================================
+
+namespace {
+
+/// Sorts after every digit, closing a date prefix range
+constexpr char kDigestRangeEnd = '~';
+
+/// Studies of one day with the modalities of their series
+constexpr const char* kDigestDaySql = R"(
+    SELECT s.study_uid, s.num_instances,
+           (SELECT GROUP_CONCAT(m.modality, '\') FROM study_modalities m
+            WHERE m.study_pk = s.study_pk)
+    FROM studies s
+    WHERE s.study_date = ?1;
+)";
+
+/**
+ * @brief Prepared statement finalized on scope exit
+ */
+class scoped_statement {
+public:
+    scoped_statement(sqlite3* db, const char* sql) {
+        rc_ = sqlite3_prepare_v2(db, sql, -1, &stmt_, nullptr);
+    }
+
+    ~scoped_statement() { sqlite3_finalize(stmt_); }
+
+    scoped_statement(const scoped_statement&) = delete;
+    auto operator=(const scoped_statement&) -> scoped_statement& = delete;
+
+    [[nodiscard]] auto prepared() const noexcept -> bool { return rc_ == SQLITE_OK; }
+    [[nodiscard]] auto get() const noexcept -> sqlite3_stmt* { return stmt_; }
+
+    /// Binds text; an empty view binds '' rather than NULL
+    void bind(int index, std::string_view text) {
+        sqlite3_bind_text(stmt_, index, text.empty() ? "" : text.data(),
+                          static_cast<int>(text.size()), SQLITE_TRANSIENT);
+    }
+
+    void reset() {
+        sqlite3_reset(stmt_);
+        sqlite3_clear_bindings(stmt_);
+    }
+
+private:
+    sqlite3_stmt* stmt_{nullptr};
+    int rc_{SQLITE_ERROR};
+};
+
+auto is_digest_day(std::string_view date) noexcept -> bool {
+    return date.size() == 8 && is_valid_study_digest_key(date);
+}
+
+/// True if a bucket's modality set has one of the scope's modalities
+auto bucket_in_scope(std::string_view modalities, const study_digest_scope& scope)
+    -> bool {
+    if (scope.modalities.empty()) {
+        return true;
+    }
+    std::size_t start = 0;
+    while (start <= modalities.size()) {
+        auto end = modalities.find('\\', start);
+        if (end == std::string_view::npos) {
+            end = modalities.size();
+        }
+        const auto modality = modalities.substr(start, end - start);
+        if (std::find(scope.modalities.begin(), scope.modalities.end(), modality) !=
+            scope.modalities.end()) {
+            return true;
+        }
+        start = end + 1;
+    }
+    return false;
+}
+
+}  // namespace
+
+auto index_database::refresh_study_digests() -> Result<size_t> {
+    return refresh_study_digests({}, {});
+}
+
+auto index_database::refresh_study_digests(std::string_view from_date,
+                                           std::string_view to_date)
+    -> Result<size_t> {
+    if (!db_) {
+        return pacs_error<size_t>(database_connection_error, "Database not connected");
+    }
+    auto query_error = [this](std::string_view what) {
+        return pacs_error<size_t>(
+            database_query_error,
+            kcenon::pacs::compat::format("{}: {}", what, sqlite3_errmsg(db_)));
+    };
+
+    std::vector<std::string> days;
+    {
+        scoped_statement dirty(db_,
+            "SELECT bucket_date FROM study_digest_dirty "
+            "WHERE bucket_date >= ?1 AND bucket_date <= ?2;");
+        if (!dirty.prepared()) {
+            return query_error("Failed to list dirty digest days");
+        }
+        const std::string upper = to_date.empty() ? std::string(1, kDigestRangeEnd)
+                                                  : std::string(to_date);
+        dirty.bind(1, from_date);
+        dirty.bind(2, upper);
+        while (sqlite3_step(dirty.get()) == SQLITE_ROW) {
+            days.push_back(get_text(dirty.get(), 0));
+        }
+    }
+    if (days.empty()) {
+        return ok(size_t{0});
+    }
+
+    if (sqlite3_exec(db_, "SAVEPOINT study_digest_refresh;", nullptr, nullptr,
+                     nullptr) != SQLITE_OK) {
+        return query_error("Failed to begin digest refresh");
+    }
+
+    auto refresh = [&]() -> VoidResult {
+        scoped_statement select_day(db_, kDigestDaySql);
+        scoped_statement delete_buckets(db_,
+            "DELETE FROM study_digest_buckets WHERE bucket_date = ?1;");
+        scoped_statement insert_bucket(db_,
+            "INSERT INTO study_digest_buckets "
+            "(bucket_date, modality, study_count, instance_count, digest) "
+            "VALUES (?1, ?2, ?3, ?4, ?5);");
+        scoped_statement clear_dirty(db_,
+            "DELETE FROM study_digest_dirty WHERE bucket_date = ?1;");
+        if (!select_day.prepared() || !delete_buckets.prepared() ||
+            !insert_bucket.prepared() || !clear_dirty.prepared()) {
+            return make_error<std::monostate>(
+                database_query_error,
+                kcenon::pacs::compat::format("Failed to prepare digest refresh: {}",
+                                             sqlite3_errmsg(db_)),
+                "storage");
+        }
+
+        for (const auto& day : days) {
+            // Buckets of the day, keyed by modality set
+            std::map<std::string, study_digest_node> buckets;
+            if (is_digest_day(day)) {
+                select_day.bind(1, day);
+                while (sqlite3_step(select_day.get()) == SQLITE_ROW) {
+                    const auto uid = get_text(select_day.get(), 0);
+                    const auto instances = static_cast<std::size_t>(
+                        std::max<sqlite3_int64>(
+                            sqlite3_column_int64(select_day.get(), 1), 0));
+                    auto& bucket = buckets[normalize_study_modalities(
+                        get_text(select_day.get(), 2))];
+                    ++bucket.study_count;
+                    bucket.instance_count += instances;
+                    bucket.digest += study_digest_leaf(uid, instances);
+                }
+                select_day.reset();
+            }
+
+            delete_buckets.bind(1, day);
+            auto rc = sqlite3_step(delete_buckets.get());
+            delete_buckets.reset();
+
+            for (const auto& [modality, bucket] : buckets) {
+                if (rc != SQLITE_DONE) {
+                    break;
+                }
+                insert_bucket.bind(1, day);
+                insert_bucket.bind(2, modality);
+                sqlite3_bind_int64(insert_bucket.get(), 3,
+                                   static_cast<sqlite3_int64>(bucket.study_count));
+                sqlite3_bind_int64(insert_bucket.get(), 4,
+                                   static_cast<sqlite3_int64>(bucket.instance_count));
+                sqlite3_bind_int64(insert_bucket.get(), 5,
+                                   static_cast<sqlite3_int64>(bucket.digest));
+                rc = sqlite3_step(insert_bucket.get());
+                insert_bucket.reset();
+            }
+
+            if (rc == SQLITE_DONE) {
+                clear_dirty.bind(1, day);
+                rc = sqlite3_step(clear_dirty.get());
+                clear_dirty.reset();
+            }
+            if (rc != SQLITE_DONE) {
+                return make_error<std::monostate>(
+                    rc,
+                    kcenon::pacs::compat::format("Failed to refresh digests of {}: {}",
+                                                 day, sqlite3_errmsg(db_)),
+                    "storage");
+            }
+        }
+        return ok();
+    };
+
+    auto result = refresh();
+    if (result.is_err()) {
+        (void)sqlite3_exec(db_, "ROLLBACK TO study_digest_refresh;", nullptr,
+                           nullptr, nullptr);
+        (void)sqlite3_exec(db_, "RELEASE study_digest_refresh;", nullptr, nullptr,
+                           nullptr);
+        return pacs_error<size_t>(database_query_error, result.error().message);
+    }
+    if (sqlite3_exec(db_, "RELEASE study_digest_refresh;", nullptr, nullptr,
+                     nullptr) != SQLITE_OK) {
+        return query_error("Failed to commit digest refresh");
+    }
+    return ok(days.size());
+}
+
+auto index_database::study_digest_children(std::string_view parent_key,
+                                           const study_digest_scope& scope)
+    -> Result<std::vector<study_digest_node>> {
+    using node_list = std::vector<study_digest_node>;
+    if (!is_valid_study_digest_key(parent_key)) {
+        return pacs_error<node_list>(
+            database_query_error,
+            kcenon::pacs::compat::format("Invalid study digest key: {}", parent_key));
+    }
+    node_list children;
+    if (is_study_digest_bucket(parent_key)) {
+        return ok(std::move(children));
+    }
+
+    // Dates under the parent, clipped to the scope
+    std::string lower(parent_key);
+    std::string upper = std::string(parent_key) + kDigestRangeEnd;
+    if (!scope.from_date.empty() && scope.from_date > lower) {
+        lower = scope.from_date;
+    }
+    if (!scope.to_date.empty() && scope.to_date < upper) {
+        upper = scope.to_date;
+    }
+    if (lower > upper) {
+        return ok(std::move(children));
+    }
+
+    auto refreshed = refresh_study_digests(lower, upper);
+    if (refreshed.is_err()) {
+        return pacs_error<node_list>(refreshed.error().code, refreshed.error().message);
+    }
+
+    scoped_statement select(db_,
+        "SELECT bucket_date, modality, study_count, instance_count, digest "
+        "FROM study_digest_buckets "
+        "WHERE bucket_date >= ?1 AND bucket_date <= ?2 "
+        "ORDER BY bucket_date, modality;");
+    if (!select.prepared()) {
+        return pacs_error<node_list>(
+            database_query_error,
+            kcenon::pacs::compat::format("Failed to query study digests: {}",
+                                         sqlite3_errmsg(db_)));
+    }
+    select.bind(1, lower);
+    select.bind(2, upper);
+
+    // Rows come in key order at every level, so children are runs of rows
+    while (sqlite3_step(select.get()) == SQLITE_ROW) {
+        const auto date = get_text(select.get(), 0);
+        const auto modality = get_text(select.get(), 1);
+        if (!bucket_in_scope(modality, scope)) {
+            continue;
+        }
+
+        std::string key;
+        switch (parent_key.size()) {
+            case 0: key = date.substr(0, 6); break;
+            case 6: key = date; break;
+            default: key = study_digest_bucket_key(date, modality); break;
+        }
+
+        if (children.empty() || children.back().key != key) {
+            children.push_back({std::move(key), 0, 0, 0});
+        }
+        study_digest_node bucket;
+        bucket.study_count =
+            static_cast<std::size_t>(sqlite3_column_int64(select.get(), 2));
+        bucket.instance_count =
+            static_cast<std::size_t>(sqlite3_column_int64(select.get(), 3));
+        bucket.digest = static_cast<std::uint64_t>(sqlite3_column_int64(select.get(), 4));
+        children.back().combine(bucket);
+    }
+
+    return ok(std::move(children));
+}
+
+auto index_database::study_digest_root(const study_digest_scope& scope)
+    -> Result<study_digest_node> {
+    auto months = study_digest_children("", scope);
+    if (months.is_err()) {
+        return pacs_error<study_digest_node>(months.error().code,
+                                             months.error().message);
+    }
+    return ok(combine_study_digests("", months.value()));
+}
+
+auto index_database::study_digest_members(std::string_view bucket_key) const
+    -> Result<std::vector<study_digest_entry>> {
+    using entry_list = std::vector<study_digest_entry>;
+    if (!is_study_digest_bucket(bucket_key)) {
+        return pacs_error<entry_list>(
+            database_query_error,
+            kcenon::pacs::compat::format("Not a study digest bucket: {}", bucket_key));
+    }
+    if (!db_) {
+        return pacs_error<entry_list>(database_connection_error,
+                                      "Database not connected");
+    }
+
+    const auto day = bucket_key.substr(0, 8);
+    const auto modalities = bucket_key.substr(9);
+
+    scoped_statement select_day(db_, kDigestDaySql);
+    if (!select_day.prepared()) {
+        return pacs_error<entry_list>(
+            database_query_error,
+            kcenon::pacs::compat::format("Failed to query study digests: {}",
+                                         sqlite3_errmsg(db_)));
+    }
+    select_day.bind(1, day);
+
+    entry_list members;
+    while (sqlite3_step(select_day.get()) == SQLITE_ROW) {
+        if (normalize_study_modalities(get_text(select_day.get(), 2)) != modalities) {
+            continue;
+        }
+        members.push_back({get_text(select_day.get(), 0),
+                           static_cast<std::size_t>(std::max<sqlite3_int64>(
+                               sqlite3_column_int64(select_day.get(), 1), 0))});
+    }
+
+    std::sort(members.begin(), members.end(),
+              [](const auto& a, const auto& b) { return a.study_uid < b.study_uid; });
+    return ok(std::move(members));
+}
+
+// ============================================================================
+// Retention Operations
+// ============================================================================
+
+namespace {
+
+/// Comma separated '?' placeholders for an IN list
+auto sql_placeholders(std::size_t count) -> std::string {
+    std::string placeholders;
+    for (std::size_t i = 0; i < count; ++i) {
+        placeholders += i == 0 ? "?" : ",?";
+    }
+    return placeholders;
+}
+
+}  // namespace
+
+auto index_database::find_retention_candidates(const retention_criteria& criteria,
+                                               std::string_view after_date,
+                                               int64_t after_pk,
+                                               size_t limit) const
+    -> Result<std::vector<retention_candidate>> {
+    using candidate_list = std::vector<retention_candidate>;
+    if (!db_) {
+        return pacs_error<candidate_list>(database_connection_error,
+                                          "Database not connected");
+    }
+    if (criteria.default_cutoff.empty()) {
+        return pacs_error<candidate_list>(database_query_error,
+                                          "Retention cutoff not set");
+    }
+
+    // The date range drives idx_studies_date; the keyset predicate narrows
+    // it to rows after the previous page without defeating the index
+    std::string sql =
+        "SELECT s.study_pk, s.study_uid, s.study_date FROM studies s "
+        "WHERE s.study_date >= ?1 AND s.study_date <= ?2 AND s.study_date != '' "
+        "AND (s.study_date > ?1 OR s.study_pk > ?3)";
+
+    // Past the default cutoff only studies whose every modality has a
+    // longer-lived rule remain; each ruled modality must have expired too
+    if (!criteria.modality_cutoffs.empty()) {
+        const auto rules = criteria.modality_cutoffs.size();
+        sql += " AND (s.study_date <= ?4 OR (EXISTS (SELECT 1 FROM study_modalities m "
+               "WHERE m.study_pk = s.study_pk) AND NOT EXISTS (SELECT 1 FROM "
+               "study_modalities m WHERE m.study_pk = s.study_pk AND m.modality "
+               "NOT IN (" + sql_placeholders(rules) + "))))";
+        sql += " AND NOT EXISTS (SELECT 1 FROM study_modalities m "
+               "WHERE m.study_pk = s.study_pk AND (";
+        for (std::size_t i = 0; i < rules; ++i) {
+            sql += i == 0 ? "" : " OR ";
+            sql += "(m.modality = ? AND s.study_date > ?)";
+        }
+        sql += "))";
+    }
+    for (std::size_t i = 0; i < criteria.exclude_patterns.size(); ++i) {
+        sql += " AND instr(COALESCE(s.study_description, ''), ?) = 0";
+    }
+    sql += " ORDER BY s.study_date, s.study_pk LIMIT ?;";
+
+    scoped_statement select(db_, sql.c_str());
+    if (!select.prepared()) {
+        return pacs_error<candidate_list>(
+            database_query_error,
+            kcenon::pacs::compat::format("Failed to query retention candidates: {}",
+                                         sqlite3_errmsg(db_)));
+    }
+
+    select.bind(1, after_date);
+    select.bind(2, criteria.upper_cutoff());
+    sqlite3_bind_int64(select.get(), 3, after_pk);
+    int index = 4;
+    if (!criteria.modality_cutoffs.empty()) {
+        select.bind(index++, criteria.default_cutoff);
+        for (const auto& [modality, cutoff] : criteria.modality_cutoffs) {
+            select.bind(index++, modality);
+        }
+        for (const auto& [modality, cutoff] : criteria.modality_cutoffs) {
+            select.bind(index++, modality);
+            select.bind(index++, cutoff);
+        }
+    }
+    for (const auto& pattern : criteria.exclude_patterns) {
+        select.bind(index++, pattern);
+    }
+    sqlite3_bind_int64(select.get(), index, static_cast<sqlite3_int64>(limit));
+
+    candidate_list candidates;
+    int rc = SQLITE_ROW;
+    while ((rc = sqlite3_step(select.get())) == SQLITE_ROW) {
+        candidates.push_back({sqlite3_column_int64(select.get(), 0),
+                              get_text(select.get(), 1),
+                              get_text(select.get(), 2)});
+    }
+    if (rc != SQLITE_DONE) {
+        return pacs_error<candidate_list>(
+            database_query_error,
+            kcenon::pacs::compat::format("Failed to query retention candidates: {}",
+                                         sqlite3_errmsg(db_)));
+    }
+    return ok(std::move(candidates));
+}
+
+auto index_database::delete_expired_studies(const std::vector<int64_t>& study_pks,
+                                            bool queue_files)
+    -> Result<retention_batch> {
+    if (!db_) {
+        return pacs_error<retention_batch>(database_connection_error,
+                                           "Database not connected");
+    }
+    retention_batch batch;
+    if (study_pks.empty()) {
+        return ok(batch);
+    }
+
+    const auto in_list = "(" + sql_placeholders(study_pks.size()) + ")";
+    auto run = [&](const std::string& sql) -> int {
+        scoped_statement statement(db_, sql.c_str());
+        if (!statement.prepared()) {
+            return SQLITE_ERROR;
+        }
+        for (std::size_t i = 0; i < study_pks.size(); ++i) {
+            sqlite3_bind_int64(statement.get(), static_cast<int>(i + 1), study_pks[i]);
+        }
+        return sqlite3_step(statement.get());
+    };
+
+    if (sqlite3_exec(db_, "SAVEPOINT retention_batch;", nullptr, nullptr,
+                     nullptr) != SQLITE_OK) {
+        return pacs_error<retention_batch>(
+            database_query_error,
+            kcenon::pacs::compat::format("Failed to begin retention batch: {}",
+                                         sqlite3_errmsg(db_)));
+    }
+
+    int rc = SQLITE_DONE;
+    if (queue_files) {
+        rc = run("INSERT INTO retention_unlink_queue (sop_uid, file_path) "
+                 "SELECT i.sop_uid, i.file_path FROM instances i "
+                 "JOIN series se ON i.series_pk = se.series_pk "
+                 "WHERE se.study_pk IN " + in_list + ";");
+        batch.files_queued = static_cast<std::size_t>(sqlite3_changes(db_));
+    }
+    if (rc == SQLITE_DONE) {
+        rc = run("DELETE FROM studies WHERE study_pk IN " + in_list + ";");
+        batch.studies_deleted = static_cast<std::size_t>(sqlite3_changes(db_));
+    }
+
+    if (rc != SQLITE_DONE) {
+        auto message = kcenon::pacs::compat::format(
+            "Failed to delete expired studies: {}", sqlite3_errmsg(db_));
+        (void)sqlite3_exec(db_, "ROLLBACK TO retention_batch;", nullptr, nullptr,
+                           nullptr);
+        (void)sqlite3_exec(db_, "RELEASE retention_batch;", nullptr, nullptr,
+                           nullptr);
+        return pacs_error<retention_batch>(database_query_error, message);
+    }
+    if (sqlite3_exec(db_, "RELEASE retention_batch;", nullptr, nullptr,
+                     nullptr) != SQLITE_OK) {
+        return pacs_error<retention_batch>(
+            database_query_error,
+            kcenon::pacs::compat::format("Failed to commit retention batch: {}",
+                                         sqlite3_errmsg(db_)));
+    }
+    return ok(batch);
+}
+
+auto index_database::list_retention_unlinks(int64_t after_pk, size_t limit) const
+    -> Result<std::vector<retention_unlink>> {
+    using unlink_list = std::vector<retention_unlink>;
+    if (!db_) {
+        return pacs_error<unlink_list>(database_connection_error,
+                                       "Database not connected");
+    }
+
+    scoped_statement select(db_,
+        "SELECT queue_pk, sop_uid, file_path FROM retention_unlink_queue "
+        "WHERE queue_pk > ?1 ORDER BY queue_pk LIMIT ?2;");
+    if (!select.prepared()) {
+        return pacs_error<unlink_list>(
+            database_query_error,
+            kcenon::pacs::compat::format("Failed to list unlink queue: {}",
+                                         sqlite3_errmsg(db_)));
+    }
+    sqlite3_bind_int64(select.get(), 1, after_pk);
+    sqlite3_bind_int64(select.get(), 2, static_cast<sqlite3_int64>(limit));
+
+    unlink_list files;
+    while (sqlite3_step(select.get()) == SQLITE_ROW) {
+        files.push_back({sqlite3_column_int64(select.get(), 0),
+                         get_text(select.get(), 1), get_text(select.get(), 2)});
+    }
+    return ok(std::move(files));
+}
+
+auto index_database::complete_retention_unlinks(const std::vector<int64_t>& pks)
+    -> VoidResult {
+    if (!db_) {
+        return make_error<std::monostate>(database_connection_error,
+                                          "Database not connected", "storage");
+    }
+
+    scoped_statement remove(db_,
+        "DELETE FROM retention_unlink_queue WHERE queue_pk = ?1;");
+    if (!remove.prepared()) {
+        return make_error<std::monostate>(
+            database_query_error,
+            kcenon::pacs::compat::format("Failed to prepare dequeue: {}",
+                                         sqlite3_errmsg(db_)),
+            "storage");
+    }
+
+    if (sqlite3_exec(db_, "SAVEPOINT retention_dequeue;", nullptr, nullptr,
+                     nullptr) != SQLITE_OK) {
+        return make_error<std::monostate>(
+            database_query_error,
+            kcenon::pacs::compat::format("Failed to begin dequeue: {}",
+                                         sqlite3_errmsg(db_)),
+            "storage");
+    }
+    for (auto pk : pks) {
+        sqlite3_bind_int64(remove.get(), 1, pk);
+        const auto rc = sqlite3_step(remove.get());
+        remove.reset();
+        if (rc != SQLITE_DONE) {
+            auto message = kcenon::pacs::compat::format(
+                "Failed to dequeue unlinked file: {}", sqlite3_errmsg(db_));
+            (void)sqlite3_exec(db_, "ROLLBACK TO retention_dequeue;", nullptr,
+                               nullptr, nullptr);
+            (void)sqlite3_exec(db_, "RELEASE retention_dequeue;", nullptr,
+                               nullptr, nullptr);
+            return make_error<std::monostate>(rc, message, "storage");
+        }
+    }
+    (void)sqlite3_exec(db_, "RELEASE retention_dequeue;", nullptr, nullptr, nullptr);
+    return ok();
+}
+
+auto index_database::retention_unlink_count() const -> Result<size_t> {
+    if (!db_) {
+        return pacs_error<size_t>(database_connection_error, "Database not connected");
+    }
+
+    scoped_statement count(db_, "SELECT COUNT(*) FROM retention_unlink_queue;");
+    if (!count.prepared() || sqlite3_step(count.get()) != SQLITE_ROW) {
+        return pacs_error<size_t>(
+            database_query_error,
+            kcenon::pacs::compat::format("Failed to count unlink queue: {}",
+                                         sqlite3_errmsg(db_)));
+    }
+    return ok(static_cast<size_t>(sqlite3_column_int64(count.get(), 0)));
+}
+
 auto index_database::parse_study_row(void* stmt_ptr) const -> study_record {
     auto* stmt = static_cast<sqlite3_stmt*>(stmt_ptr);
     study_record record;
@@ -1049,6 +1640,7 @@ auto index_database::upsert_instance(int64_t series_pk,
                                      std::string_view transfer_syntax,
                                      std::optional<int> instance_number)
     -> Result<int64_t> {
+    monitoring::trace_span span("database_upsert");
     return instance_repository_->upsert_instance(
         series_pk, sop_uid, sop_class_uid, file_path, file_size,
         transfer_syntax, instance_number);
@@ -1056,6 +1648,7 @@ auto index_database::upsert_instance(int64_t series_pk,
 
 auto index_database::upsert_instance(const instance_record& record)
     -> Result<int64_t> {
+    monitoring::trace_span span("database_upsert");
     return instance_repository_->upsert_instance(record);
 }
 
@@ -1074,11 +1667,24 @@ auto index_database::list_instances(std::string_view series_uid) const
     return instance_repository_->list_instances(series_uid);
 }
 
+auto index_database::list_instances_after(int64_t after_pk, size_t limit) const
+    -> Result<std::vector<instance_record>> {
+    return instance_repository_->list_instances_after(after_pk, limit);
+}
+
 auto index_database::search_instances(const instance_query& query) const
     -> Result<std::vector<instance_record>> {
     return instance_repository_->search_instances(query);
 }
 
+auto index_database::set_missing_file_hash(std::string_view sop_uid,
+                                           std::string_view file_hash,
+                                           int64_t file_size)
+    -> Result<bool> {
+    return instance_repository_->set_missing_file_hash(sop_uid, file_hash,
+                                                       file_size);
+}
+
 auto index_database::delete_instance(std::string_view sop_uid) -> VoidResult {
     return instance_repository_->delete_instance(sop_uid);
 }
@@ -1157,6 +1763,12 @@ auto index_database::get_series_files(std::string_view series_instance_uid)
     return instance_repository_->get_series_files(series_instance_uid);
 }
 
+auto index_database::get_file_hashes(
+    const std::vector<std::string>& sop_instance_uids) const
+    -> Result<std::unordered_map<std::string, std::string>> {
+    return instance_repository_->get_file_hashes(sop_instance_uids);
+}
+
 // ============================================================================
 // Database Maintenance Operations
 // ============================================================================
@@ -12,6 +12,7 @@
 
 #include "kcenon/pacs/storage/instance_repository.h"
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <iomanip>
@@ -307,6 +308,41 @@ auto instance_repository::list_instances(std::string_view series_uid)
     return ok(std::move(records));
 }
 
+auto instance_repository::list_instances_after(int64_t after_pk, size_t limit)
+    -> Result<std::vector<instance_record>> {
+    if (!db() || !db()->is_connected()) {
+        return make_error<std::vector<instance_record>>(
+            -1, "Database not connected", "storage");
+    }
+
+    auto sql = kcenon::pacs::compat::format(
+        "SELECT instance_pk, series_pk, sop_uid, sop_class_uid, "
+        "instance_number, transfer_syntax, content_date, content_time, "
+        "rows, columns, bits_allocated, number_of_frames, "
+        "file_path, file_size, file_hash, created_at "
+        "FROM instances "
+        "WHERE instance_pk > {} "
+        "ORDER BY instance_pk ASC LIMIT {};",
+        after_pk, limit);
+
+    auto result = db()->select(sql);
+    if (result.is_err()) {
+        return make_error<std::vector<instance_record>>(
+            -1,
+            kcenon::pacs::compat::format("Failed to list instances: {}",
+                                 result.error().message),
+            "storage");
+    }
+
+    std::vector<instance_record> records;
+    records.reserve(result.value().size());
+    for (const auto& row : result.value()) {
+        records.push_back(map_row_to_entity(row));
+    }
+
+    return ok(std::move(records));
+}
+
 auto instance_repository::search_instances(const instance_query& query)
     -> Result<std::vector<instance_record>> {
     if (!db() || !db()->is_connected()) {
@@ -389,6 +425,41 @@ auto instance_repository::search_instances(const instance_query& query)
     return ok(std::move(records));
 }
 
+auto instance_repository::set_missing_file_hash(std::string_view sop_uid,
+                                                std::string_view file_hash,
+                                                int64_t file_size)
+    -> Result<bool> {
+    if (!db() || !db()->is_connected()) {
+        return make_error<bool>(-1, "Database not connected", "storage");
+    }
+
+    auto uid_cond =
+        database::query_condition("sop_uid", "=", std::string(sop_uid));
+    auto no_hash_cond =
+        database::query_condition("file_hash", "IS NULL", nullptr) ||
+        database::query_condition("file_hash", "=", std::string());
+    auto size_cond =
+        database::query_condition("file_size", "=", file_size) ||
+        database::query_condition("file_size", "=", int64_t{0});
+
+    auto builder = query_builder();
+    auto update_sql = builder.update(table_name())
+                          .set("file_hash", std::string(file_hash))
+                          .where(uid_cond && no_hash_cond && size_cond)
+                          .build();
+
+    auto result = db()->update(update_sql);
+    if (result.is_err()) {
+        return make_error<bool>(
+            -1,
+            kcenon::pacs::compat::format("Failed to record file hash: {}",
+                                 result.error().message),
+            "storage");
+    }
+
+    return ok(result.value() > 0);
+}
+
 auto instance_repository::delete_instance(std::string_view sop_uid)
     -> VoidResult {
     if (!db() || !db()->is_connected()) {
@@ -561,6 +632,64 @@ auto instance_repository::get_series_files(std::string_view series_instance_uid)
     return ok(std::move(files));
 }
 
+auto instance_repository::get_file_hashes(
+    const std::vector<std::string>& sop_instance_uids)
+    -> Result<std::unordered_map<std::string, std::string>> {
+    if (!db() || !db()->is_connected()) {
+        return make_error<std::unordered_map<std::string, std::string>>(
+            -1, "Database not connected", "storage");
+    }
+
+    // UIDs per IN-list query
+    constexpr std::size_t chunk = 500;
+
+    std::unordered_map<std::string, std::string> hashes;
+    hashes.reserve(sop_instance_uids.size());
+
+    for (std::size_t begin = 0; begin < sop_instance_uids.size();
+         begin += chunk) {
+        const auto end = (std::min)(begin + chunk, sop_instance_uids.size());
+
+        std::string sql = "SELECT sop_uid, file_hash FROM instances "
+                          "WHERE sop_uid IN (";
+        for (auto i = begin; i < end; ++i) {
+            if (i != begin) {
+                sql += ',';
+            }
+            sql += '\'';
+            for (char c : sop_instance_uids[i]) {
+                if (c == '\'') {
+                    sql += '\'';
+                }
+                sql += c;
+            }
+            sql += '\'';
+        }
+        sql += ");";
+
+        auto result = db()->select(sql);
+        if (result.is_err()) {
+            return make_error<std::unordered_map<std::string, std::string>>(
+                -1,
+                kcenon::pacs::compat::format("Failed to query file hashes: {}",
+                                     result.error().message),
+                "storage");
+        }
+
+        for (const auto& row : result.value()) {
+            auto uid = row.find("sop_uid");
+            if (uid == row.end()) {
+                continue;
+            }
+            auto hash = row.find("file_hash");
+            hashes.insert_or_assign(
+                uid->second, hash != row.end() ? hash->second : std::string{});
+        }
+    }
+
+    return ok(std::move(hashes));
+}
+
 auto instance_repository::map_row_to_entity(const database_row& row) const
     -> instance_record {
     instance_record record;
@@ -714,6 +843,9 @@ auto get_text(sqlite3_stmt* stmt, int col) -> std::string {
     return text ? std::string(text) : std::string{};
 }
 
+/// UIDs bound per IN-list query, below SQLite's host parameter limit
+constexpr std::size_t kHashLookupChunk = 500;
+
 }  // namespace
 
 instance_repository::instance_repository(sqlite3* db) : db_(db) {}
@@ -1005,6 +1137,43 @@ auto instance_repository::list_instances(std::string_view series_uid) const
     return ok(std::move(results));
 }
 
+auto instance_repository::list_instances_after(int64_t after_pk,
+                                               size_t limit) const
+    -> Result<std::vector<instance_record>> {
+    std::vector<instance_record> results;
+
+    const char* sql = R"(
+        SELECT instance_pk, series_pk, sop_uid, sop_class_uid, instance_number,
+               transfer_syntax, content_date, content_time,
+               rows, columns, bits_allocated, number_of_frames,
+               file_path, file_size, file_hash, created_at
+        FROM instances
+        WHERE instance_pk > ?
+        ORDER BY instance_pk ASC
+        LIMIT ?;
+    )";
+
+    sqlite3_stmt* stmt = nullptr;
+    auto rc = sqlite3_prepare_v2(db_, sql, -1, &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        return make_error<std::vector<instance_record>>(
+            database_query_error,
+            kcenon::pacs::compat::format("Failed to prepare query: {}",
+                                 sqlite3_errmsg(db_)),
+            "storage");
+    }
+
+    sqlite3_bind_int64(stmt, 1, after_pk);
+    sqlite3_bind_int64(stmt, 2, static_cast<sqlite3_int64>(limit));
+
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        results.push_back(parse_instance_row(stmt));
+    }
+
+    sqlite3_finalize(stmt);
+    return ok(std::move(results));
+}
+
 auto instance_repository::search_instances(const instance_query& query) const
     -> Result<std::vector<instance_record>> {
     std::vector<instance_record> results;
@@ -1087,6 +1256,47 @@ auto instance_repository::search_instances(const instance_query& query) const
     return ok(std::move(results));
 }
 
+auto instance_repository::set_missing_file_hash(std::string_view sop_uid,
+                                                std::string_view file_hash,
+                                                int64_t file_size)
+    -> Result<bool> {
+    const char* sql = R"(
+        UPDATE instances SET file_hash = ?
+        WHERE sop_uid = ?
+          AND (file_hash IS NULL OR file_hash = '')
+          AND (file_size = ? OR file_size = 0);
+    )";
+
+    sqlite3_stmt* stmt = nullptr;
+    auto rc = sqlite3_prepare_v2(db_, sql, -1, &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        return make_error<bool>(
+            rc,
+            kcenon::pacs::compat::format("Failed to prepare file hash update: {}",
+                                 sqlite3_errmsg(db_)),
+            "storage");
+    }
+
+    sqlite3_bind_text(stmt, 1, file_hash.data(),
+                      static_cast<int>(file_hash.size()), SQLITE_TRANSIENT);
+    sqlite3_bind_text(stmt, 2, sop_uid.data(),
+                      static_cast<int>(sop_uid.size()), SQLITE_TRANSIENT);
+    sqlite3_bind_int64(stmt, 3, file_size);
+
+    rc = sqlite3_step(stmt);
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE) {
+        return make_error<bool>(
+            rc,
+            kcenon::pacs::compat::format("Failed to record file hash: {}",
+                                 sqlite3_errmsg(db_)),
+            "storage");
+    }
+
+    return ok(sqlite3_changes(db_) > 0);
+}
+
 auto instance_repository::delete_instance(std::string_view sop_uid)
     -> VoidResult {
     const char* sql = "DELETE FROM instances WHERE sop_uid = ?;";
@@ -1268,6 +1478,51 @@ auto instance_repository::get_series_files(std::string_view series_instance_uid)
     return ok(std::move(results));
 }
 
+auto instance_repository::get_file_hashes(
+    const std::vector<std::string>& sop_instance_uids) const
+    -> Result<std::unordered_map<std::string, std::string>> {
+    std::unordered_map<std::string, std::string> hashes;
+    hashes.reserve(sop_instance_uids.size());
+
+    for (std::size_t begin = 0; begin < sop_instance_uids.size();
+         begin += kHashLookupChunk) {
+        const auto end = (std::min)(begin + kHashLookupChunk,
+                                    sop_instance_uids.size());
+
+        std::string sql = "SELECT sop_uid, file_hash FROM instances "
+                          "WHERE sop_uid IN (";
+        for (auto i = begin; i < end; ++i) {
+            sql += (i == begin) ? "?" : ",?";
+        }
+        sql += ");";
+
+        sqlite3_stmt* stmt = nullptr;
+        auto rc = sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr);
+        if (rc != SQLITE_OK) {
+            return make_error<std::unordered_map<std::string, std::string>>(
+                database_query_error,
+                kcenon::pacs::compat::format("Failed to prepare query: {}",
+                                     sqlite3_errmsg(db_)),
+                "storage");
+        }
+
+        for (auto i = begin; i < end; ++i) {
+            const auto& uid = sop_instance_uids[i];
+            sqlite3_bind_text(stmt, static_cast<int>(i - begin + 1),
+                              uid.data(), static_cast<int>(uid.size()),
+                              SQLITE_STATIC);
+        }
+
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            hashes.insert_or_assign(get_text(stmt, 0), get_text(stmt, 1));
+        }
+
+        sqlite3_finalize(stmt);
+    }
+
+    return ok(std::move(hashes));
+}
+
 }  // namespace kcenon::pacs::storage
 
 #endif  // PACS_WITH_DATABASE_SYSTEM
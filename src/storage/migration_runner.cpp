@@ -44,6 +44,9 @@ migration_runner::migration_runner() {
     migrations_.push_back({7, [this](sqlite3* db) { return migrate_v7(db); }});
     migrations_.push_back({8, [this](sqlite3* db) { return migrate_v8(db); }});
     migrations_.push_back({9, [this](sqlite3* db) { return migrate_v9(db); }});
+    migrations_.push_back({10, [this](sqlite3* db) { return migrate_v10(db); }});
+    migrations_.push_back({11, [this](sqlite3* db) { return migrate_v11(db); }});
+    migrations_.push_back({12, [this](sqlite3* db) { return migrate_v12(db); }});
 
 #ifdef PACS_WITH_DATABASE_SYSTEM
     // Register all migrations (pacs_database_adapter version)
@@ -65,6 +68,12 @@ migration_runner::migration_runner() {
         {8, [this](pacs_database_adapter& db) { return migrate_v8(db); }});
     adapter_migrations_.push_back(
         {9, [this](pacs_database_adapter& db) { return migrate_v9(db); }});
+    adapter_migrations_.push_back(
+        {10, [this](pacs_database_adapter& db) { return migrate_v10(db); }});
+    adapter_migrations_.push_back(
+        {11, [this](pacs_database_adapter& db) { return migrate_v11(db); }});
+    adapter_migrations_.push_back(
+        {12, [this](pacs_database_adapter& db) { return migrate_v12(db); }});
 #endif
 }
 
@@ -1000,6 +1009,274 @@ auto migration_runner::migrate_v9(sqlite3* db) -> VoidResult {
     return record_migration(db, 9, "Add Unified Procedure Step (UPS) tables");
 }
 
+auto migration_runner::migrate_v10(sqlite3* db) -> VoidResult {
+    // V10: Add study search indexes
+    const char* sql = R"(
+        -- =====================================================================
+        -- STUDY_MODALITIES TABLE (indexed ModalitiesInStudy matching)
+        -- =====================================================================
+        CREATE TABLE IF NOT EXISTS study_modalities (
+            modality    TEXT NOT NULL,
+            study_pk    INTEGER NOT NULL REFERENCES studies(study_pk)
+                        ON DELETE CASCADE,
+            PRIMARY KEY (modality, study_pk)
+        ) WITHOUT ROWID;
+
+        CREATE INDEX IF NOT EXISTS idx_study_modalities_study
+            ON study_modalities(study_pk);
+
+        INSERT OR IGNORE INTO study_modalities (modality, study_pk)
+            SELECT DISTINCT modality, study_pk FROM series
+            WHERE modality IS NOT NULL AND modality != '';
+
+        -- Trigger inserts test for existing rows instead of using OR IGNORE,
+        -- which an outer UPSERT's conflict handling would override
+        CREATE TRIGGER IF NOT EXISTS trg_series_modality_insert
+        AFTER INSERT ON series
+        WHEN NEW.modality IS NOT NULL AND NEW.modality != ''
+        BEGIN
+            INSERT INTO study_modalities (modality, study_pk)
+            SELECT NEW.modality, NEW.study_pk
+            WHERE NOT EXISTS (SELECT 1 FROM study_modalities
+                              WHERE modality = NEW.modality
+                                AND study_pk = NEW.study_pk);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_series_modality_update
+        AFTER UPDATE OF study_pk, modality ON series
+        BEGIN
+            DELETE FROM study_modalities
+            WHERE study_pk = OLD.study_pk AND modality = OLD.modality
+              AND NOT EXISTS (SELECT 1 FROM series
+                              WHERE study_pk = OLD.study_pk
+                                AND modality = OLD.modality);
+
+            INSERT INTO study_modalities (modality, study_pk)
+            SELECT NEW.modality, NEW.study_pk
+            WHERE NEW.modality IS NOT NULL AND NEW.modality != ''
+              AND NOT EXISTS (SELECT 1 FROM study_modalities
+                              WHERE modality = NEW.modality
+                                AND study_pk = NEW.study_pk);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_series_modality_delete
+        AFTER DELETE ON series
+        BEGIN
+            DELETE FROM study_modalities
+            WHERE study_pk = OLD.study_pk AND modality = OLD.modality
+              AND NOT EXISTS (SELECT 1 FROM series
+                              WHERE study_pk = OLD.study_pk
+                                AND modality = OLD.modality);
+        END;
+
+        -- Keyset pagination order: study_date, study_time, study_pk (rowid),
+        -- with missing values as ''
+        CREATE INDEX IF NOT EXISTS idx_studies_date_time
+            ON studies(COALESCE(study_date, ''), COALESCE(study_time, ''));
+    )";
+
+    auto result = execute_sql(db, sql);
+    if (result.is_err()) {
+        return result;
+    }
+
+    // Trigram full-text indexes serve wildcard name/description matching.
+    // They need SQLite 3.34+ built with FTS5; without it the searches keep
+    // using plain LIKE, so a failure here does not fail the migration.
+    const char* fts_sql = R"(
+        CREATE VIRTUAL TABLE IF NOT EXISTS patients_name_fts USING fts5(
+            patient_name, content='patients', content_rowid='patient_pk',
+            tokenize='trigram');
+
+        CREATE VIRTUAL TABLE IF NOT EXISTS studies_description_fts USING fts5(
+            study_description, content='studies', content_rowid='study_pk',
+            tokenize='trigram');
+
+        INSERT INTO patients_name_fts(patients_name_fts) VALUES ('rebuild');
+        INSERT INTO studies_description_fts(studies_description_fts)
+            VALUES ('rebuild');
+
+        CREATE TRIGGER IF NOT EXISTS trg_patients_name_fts_insert
+        AFTER INSERT ON patients
+        BEGIN
+            INSERT INTO patients_name_fts (rowid, patient_name)
+            VALUES (NEW.patient_pk, NEW.patient_name);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_patients_name_fts_update
+        AFTER UPDATE OF patient_name ON patients
+        WHEN OLD.patient_name IS NOT NEW.patient_name
+        BEGIN
+            INSERT INTO patients_name_fts (patients_name_fts, rowid, patient_name)
+            VALUES ('delete', OLD.patient_pk, OLD.patient_name);
+            INSERT INTO patients_name_fts (rowid, patient_name)
+            VALUES (NEW.patient_pk, NEW.patient_name);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_patients_name_fts_delete
+        AFTER DELETE ON patients
+        BEGIN
+            INSERT INTO patients_name_fts (patients_name_fts, rowid, patient_name)
+            VALUES ('delete', OLD.patient_pk, OLD.patient_name);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_studies_description_fts_insert
+        AFTER INSERT ON studies
+        BEGIN
+            INSERT INTO studies_description_fts (rowid, study_description)
+            VALUES (NEW.study_pk, NEW.study_description);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_studies_description_fts_update
+        AFTER UPDATE OF study_description ON studies
+        WHEN OLD.study_description IS NOT NEW.study_description
+        BEGIN
+            INSERT INTO studies_description_fts
+                (studies_description_fts, rowid, study_description)
+            VALUES ('delete', OLD.study_pk, OLD.study_description);
+            INSERT INTO studies_description_fts (rowid, study_description)
+            VALUES (NEW.study_pk, NEW.study_description);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_studies_description_fts_delete
+        AFTER DELETE ON studies
+        BEGIN
+            INSERT INTO studies_description_fts
+                (studies_description_fts, rowid, study_description)
+            VALUES ('delete', OLD.study_pk, OLD.study_description);
+        END;
+    )";
+
+    if (execute_sql(db, "SAVEPOINT v10_fts;").is_ok()) {
+        if (execute_sql(db, fts_sql).is_ok()) {
+            (void)execute_sql(db, "RELEASE v10_fts;");
+        } else {
+            (void)execute_sql(db, "ROLLBACK TO v10_fts;");
+            (void)execute_sql(db, "RELEASE v10_fts;");
+        }
+    }
+
+    return record_migration(db, 10, "Add study search indexes");
+}
+
+auto migration_runner::migrate_v11(sqlite3* db) -> VoidResult {
+    // V11: Add study digest tables for sync reconciliation
+    const char* sql = R"(
+        -- =====================================================================
+        -- STUDY DIGEST TABLES (hierarchical digests for sync reconciliation)
+        -- =====================================================================
+        CREATE TABLE IF NOT EXISTS study_digest_buckets (
+            bucket_date     TEXT NOT NULL,
+            modality        TEXT NOT NULL,
+            study_count     INTEGER NOT NULL,
+            instance_count  INTEGER NOT NULL,
+            digest          INTEGER NOT NULL,
+            PRIMARY KEY (bucket_date, modality)
+        ) WITHOUT ROWID;
+
+        -- Days whose buckets must be recomputed before they are read
+        CREATE TABLE IF NOT EXISTS study_digest_dirty (
+            bucket_date TEXT PRIMARY KEY
+        ) WITHOUT ROWID;
+
+        INSERT OR IGNORE INTO study_digest_dirty (bucket_date)
+            SELECT DISTINCT study_date FROM studies
+            WHERE study_date IS NOT NULL AND study_date != '';
+
+        CREATE TRIGGER IF NOT EXISTS trg_studies_digest_insert
+        AFTER INSERT ON studies
+        WHEN NEW.study_date IS NOT NULL AND NEW.study_date != ''
+        BEGIN
+            INSERT INTO study_digest_dirty (bucket_date)
+            SELECT NEW.study_date
+            WHERE NOT EXISTS (SELECT 1 FROM study_digest_dirty
+                              WHERE bucket_date = NEW.study_date);
+        END;
+
+        -- Instance triggers update studies.num_instances, which lands here
+        CREATE TRIGGER IF NOT EXISTS trg_studies_digest_update
+        AFTER UPDATE OF study_uid, study_date, num_instances ON studies
+        BEGIN
+            INSERT INTO study_digest_dirty (bucket_date)
+            SELECT OLD.study_date
+            WHERE OLD.study_date IS NOT NULL AND OLD.study_date != ''
+              AND NOT EXISTS (SELECT 1 FROM study_digest_dirty
+                              WHERE bucket_date = OLD.study_date);
+
+            INSERT INTO study_digest_dirty (bucket_date)
+            SELECT NEW.study_date
+            WHERE NEW.study_date IS NOT NULL AND NEW.study_date != ''
+              AND NOT EXISTS (SELECT 1 FROM study_digest_dirty
+                              WHERE bucket_date = NEW.study_date);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_studies_digest_delete
+        AFTER DELETE ON studies
+        WHEN OLD.study_date IS NOT NULL AND OLD.study_date != ''
+        BEGIN
+            INSERT INTO study_digest_dirty (bucket_date)
+            SELECT OLD.study_date
+            WHERE NOT EXISTS (SELECT 1 FROM study_digest_dirty
+                              WHERE bucket_date = OLD.study_date);
+        END;
+
+        -- A study changes bucket when a series adds or drops a modality
+        CREATE TRIGGER IF NOT EXISTS trg_study_modalities_digest_insert
+        AFTER INSERT ON study_modalities
+        BEGIN
+            INSERT INTO study_digest_dirty (bucket_date)
+            SELECT s.study_date FROM studies s
+            WHERE s.study_pk = NEW.study_pk
+              AND s.study_date IS NOT NULL AND s.study_date != ''
+              AND NOT EXISTS (SELECT 1 FROM study_digest_dirty
+                              WHERE bucket_date = s.study_date);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_study_modalities_digest_delete
+        AFTER DELETE ON study_modalities
+        BEGIN
+            INSERT INTO study_digest_dirty (bucket_date)
+            SELECT s.study_date FROM studies s
+            WHERE s.study_pk = OLD.study_pk
+              AND s.study_date IS NOT NULL AND s.study_date != ''
+              AND NOT EXISTS (SELECT 1 FROM study_digest_dirty
+                              WHERE bucket_date = s.study_date);
+        END;
+    )";
+
+    auto result = execute_sql(db, sql);
+    if (result.is_err()) {
+        return result;
+    }
+
+    return record_migration(db, 11, "Add study digest tables");
+}
+
+auto migration_runner::migrate_v12(sqlite3* db) -> VoidResult {
+    // V12: Add retention unlink queue
+    const char* sql = R"(
+        -- =====================================================================
+        -- RETENTION_UNLINK_QUEUE TABLE (files of deleted studies to unlink)
+        -- =====================================================================
+        -- Rows are written in the transaction that deletes their studies and
+        -- removed once the file is gone, so an interrupted retention run
+        -- leaves no file without either an index entry or a queue entry
+        CREATE TABLE IF NOT EXISTS retention_unlink_queue (
+            queue_pk    INTEGER PRIMARY KEY AUTOINCREMENT,
+            sop_uid     TEXT NOT NULL,
+            file_path   TEXT NOT NULL,
+            queued_at   TEXT NOT NULL DEFAULT (datetime('now'))
+        );
+    )";
+
+    auto result = execute_sql(db, sql);
+    if (result.is_err()) {
+        return result;
+    }
+
+    return record_migration(db, 12, "Add retention unlink queue");
+}
+
 #ifdef PACS_WITH_DATABASE_SYSTEM
 // ============================================================================
 // Migration Operations (pacs_database_adapter)
@@ -1933,6 +2210,274 @@ auto migration_runner::migrate_v9(pacs_database_adapter& db) -> VoidResult {
     return record_migration(db, 9, "Add Unified Procedure Step (UPS) tables");
 }
 
+auto migration_runner::migrate_v10(pacs_database_adapter& db) -> VoidResult {
+    // V10: Add study search indexes
+    const std::string sql = R"(
+        -- =====================================================================
+        -- STUDY_MODALITIES TABLE (indexed ModalitiesInStudy matching)
+        -- =====================================================================
+        CREATE TABLE IF NOT EXISTS study_modalities (
+            modality    TEXT NOT NULL,
+            study_pk    INTEGER NOT NULL REFERENCES studies(study_pk)
+                        ON DELETE CASCADE,
+            PRIMARY KEY (modality, study_pk)
+        ) WITHOUT ROWID;
+
+        CREATE INDEX IF NOT EXISTS idx_study_modalities_study
+            ON study_modalities(study_pk);
+
+        INSERT OR IGNORE INTO study_modalities (modality, study_pk)
+            SELECT DISTINCT modality, study_pk FROM series
+            WHERE modality IS NOT NULL AND modality != '';
+
+        -- Trigger inserts test for existing rows instead of using OR IGNORE,
+        -- which an outer UPSERT's conflict handling would override
+        CREATE TRIGGER IF NOT EXISTS trg_series_modality_insert
+        AFTER INSERT ON series
+        WHEN NEW.modality IS NOT NULL AND NEW.modality != ''
+        BEGIN
+            INSERT INTO study_modalities (modality, study_pk)
+            SELECT NEW.modality, NEW.study_pk
+            WHERE NOT EXISTS (SELECT 1 FROM study_modalities
+                              WHERE modality = NEW.modality
+                                AND study_pk = NEW.study_pk);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_series_modality_update
+        AFTER UPDATE OF study_pk, modality ON series
+        BEGIN
+            DELETE FROM study_modalities
+            WHERE study_pk = OLD.study_pk AND modality = OLD.modality
+              AND NOT EXISTS (SELECT 1 FROM series
+                              WHERE study_pk = OLD.study_pk
+                                AND modality = OLD.modality);
+
+            INSERT INTO study_modalities (modality, study_pk)
+            SELECT NEW.modality, NEW.study_pk
+            WHERE NEW.modality IS NOT NULL AND NEW.modality != ''
+              AND NOT EXISTS (SELECT 1 FROM study_modalities
+                              WHERE modality = NEW.modality
+                                AND study_pk = NEW.study_pk);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_series_modality_delete
+        AFTER DELETE ON series
+        BEGIN
+            DELETE FROM study_modalities
+            WHERE study_pk = OLD.study_pk AND modality = OLD.modality
+              AND NOT EXISTS (SELECT 1 FROM series
+                              WHERE study_pk = OLD.study_pk
+                                AND modality = OLD.modality);
+        END;
+
+        -- Keyset pagination order: study_date, study_time, study_pk (rowid),
+        -- with missing values as ''
+        CREATE INDEX IF NOT EXISTS idx_studies_date_time
+            ON studies(COALESCE(study_date, ''), COALESCE(study_time, ''));
+    )";
+
+    auto result = execute_sql(db, sql);
+    if (result.is_err()) {
+        return result;
+    }
+
+    // Trigram full-text indexes serve wildcard name/description matching.
+    // They need SQLite 3.34+ built with FTS5; without it the searches keep
+    // using plain LIKE, so a failure here does not fail the migration.
+    const std::string fts_sql = R"(
+        CREATE VIRTUAL TABLE IF NOT EXISTS patients_name_fts USING fts5(
+            patient_name, content='patients', content_rowid='patient_pk',
+            tokenize='trigram');
+
+        CREATE VIRTUAL TABLE IF NOT EXISTS studies_description_fts USING fts5(
+            study_description, content='studies', content_rowid='study_pk',
+            tokenize='trigram');
+
+        INSERT INTO patients_name_fts(patients_name_fts) VALUES ('rebuild');
+        INSERT INTO studies_description_fts(studies_description_fts)
+            VALUES ('rebuild');
+
+        CREATE TRIGGER IF NOT EXISTS trg_patients_name_fts_insert
+        AFTER INSERT ON patients
+        BEGIN
+            INSERT INTO patients_name_fts (rowid, patient_name)
+            VALUES (NEW.patient_pk, NEW.patient_name);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_patients_name_fts_update
+        AFTER UPDATE OF patient_name ON patients
+        WHEN OLD.patient_name IS NOT NEW.patient_name
+        BEGIN
+            INSERT INTO patients_name_fts (patients_name_fts, rowid, patient_name)
+            VALUES ('delete', OLD.patient_pk, OLD.patient_name);
+            INSERT INTO patients_name_fts (rowid, patient_name)
+            VALUES (NEW.patient_pk, NEW.patient_name);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_patients_name_fts_delete
+        AFTER DELETE ON patients
+        BEGIN
+            INSERT INTO patients_name_fts (patients_name_fts, rowid, patient_name)
+            VALUES ('delete', OLD.patient_pk, OLD.patient_name);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_studies_description_fts_insert
+        AFTER INSERT ON studies
+        BEGIN
+            INSERT INTO studies_description_fts (rowid, study_description)
+            VALUES (NEW.study_pk, NEW.study_description);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_studies_description_fts_update
+        AFTER UPDATE OF study_description ON studies
+        WHEN OLD.study_description IS NOT NEW.study_description
+        BEGIN
+            INSERT INTO studies_description_fts
+                (studies_description_fts, rowid, study_description)
+            VALUES ('delete', OLD.study_pk, OLD.study_description);
+            INSERT INTO studies_description_fts (rowid, study_description)
+            VALUES (NEW.study_pk, NEW.study_description);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_studies_description_fts_delete
+        AFTER DELETE ON studies
+        BEGIN
+            INSERT INTO studies_description_fts
+                (studies_description_fts, rowid, study_description)
+            VALUES ('delete', OLD.study_pk, OLD.study_description);
+        END;
+    )";
+
+    if (execute_sql(db, "SAVEPOINT v10_fts;").is_ok()) {
+        if (execute_sql(db, fts_sql).is_ok()) {
+            (void)execute_sql(db, "RELEASE v10_fts;");
+        } else {
+            (void)execute_sql(db, "ROLLBACK TO v10_fts;");
+            (void)execute_sql(db, "RELEASE v10_fts;");
+        }
+    }
+
+    return record_migration(db, 10, "Add study search indexes");
+}
+
+auto migration_runner::migrate_v11(pacs_database_adapter& db) -> VoidResult {
+    // V11: Add study digest tables for sync reconciliation
+    const std::string sql = R"(
+        -- =====================================================================
+        -- STUDY DIGEST TABLES (hierarchical digests for sync reconciliation)
+        -- =====================================================================
+        CREATE TABLE IF NOT EXISTS study_digest_buckets (
+            bucket_date     TEXT NOT NULL,
+            modality        TEXT NOT NULL,
+            study_count     INTEGER NOT NULL,
+            instance_count  INTEGER NOT NULL,
+            digest          INTEGER NOT NULL,
+            PRIMARY KEY (bucket_date, modality)
+        ) WITHOUT ROWID;
+
+        -- Days whose buckets must be recomputed before they are read
+        CREATE TABLE IF NOT EXISTS study_digest_dirty (
+            bucket_date TEXT PRIMARY KEY
+        ) WITHOUT ROWID;
+
+        INSERT OR IGNORE INTO study_digest_dirty (bucket_date)
+            SELECT DISTINCT study_date FROM studies
+            WHERE study_date IS NOT NULL AND study_date != '';
+
+        CREATE TRIGGER IF NOT EXISTS trg_studies_digest_insert
+        AFTER INSERT ON studies
+        WHEN NEW.study_date IS NOT NULL AND NEW.study_date != ''
+        BEGIN
+            INSERT INTO study_digest_dirty (bucket_date)
+            SELECT NEW.study_date
+            WHERE NOT EXISTS (SELECT 1 FROM study_digest_dirty
+                              WHERE bucket_date = NEW.study_date);
+        END;
+
+        -- Instance triggers update studies.num_instances, which lands here
+        CREATE TRIGGER IF NOT EXISTS trg_studies_digest_update
+        AFTER UPDATE OF study_uid, study_date, num_instances ON studies
+        BEGIN
+            INSERT INTO study_digest_dirty (bucket_date)
+            SELECT OLD.study_date
+            WHERE OLD.study_date IS NOT NULL AND OLD.study_date != ''
+              AND NOT EXISTS (SELECT 1 FROM study_digest_dirty
+                              WHERE bucket_date = OLD.study_date);
+
+            INSERT INTO study_digest_dirty (bucket_date)
+            SELECT NEW.study_date
+            WHERE NEW.study_date IS NOT NULL AND NEW.study_date != ''
+              AND NOT EXISTS (SELECT 1 FROM study_digest_dirty
+                              WHERE bucket_date = NEW.study_date);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_studies_digest_delete
+        AFTER DELETE ON studies
+        WHEN OLD.study_date IS NOT NULL AND OLD.study_date != ''
+        BEGIN
+            INSERT INTO study_digest_dirty (bucket_date)
+            SELECT OLD.study_date
+            WHERE NOT EXISTS (SELECT 1 FROM study_digest_dirty
+                              WHERE bucket_date = OLD.study_date);
+        END;
+
+        -- A study changes bucket when a series adds or drops a modality
+        CREATE TRIGGER IF NOT EXISTS trg_study_modalities_digest_insert
+        AFTER INSERT ON study_modalities
+        BEGIN
+            INSERT INTO study_digest_dirty (bucket_date)
+            SELECT s.study_date FROM studies s
+            WHERE s.study_pk = NEW.study_pk
+              AND s.study_date IS NOT NULL AND s.study_date != ''
+              AND NOT EXISTS (SELECT 1 FROM study_digest_dirty
+                              WHERE bucket_date = s.study_date);
+        END;
+
+        CREATE TRIGGER IF NOT EXISTS trg_study_modalities_digest_delete
+        AFTER DELETE ON study_modalities
+        BEGIN
+            INSERT INTO study_digest_dirty (bucket_date)
+            SELECT s.study_date FROM studies s
+            WHERE s.study_pk = OLD.study_pk
+              AND s.study_date IS NOT NULL AND s.study_date != ''
+              AND NOT EXISTS (SELECT 1 FROM study_digest_dirty
+                              WHERE bucket_date = s.study_date);
+        END;
+    )";
+
+    auto result = execute_sql(db, sql);
+    if (result.is_err()) {
+        return result;
+    }
+
+    return record_migration(db, 11, "Add study digest tables");
+}
+
+auto migration_runner::migrate_v12(pacs_database_adapter& db) -> VoidResult {
+    // V12: Add retention unlink queue
+    const std::string sql = R"(
+        -- =====================================================================
+        -- RETENTION_UNLINK_QUEUE TABLE (files of deleted studies to unlink)
+        -- =====================================================================
+        -- Rows are written in the transaction that deletes their studies and
+        -- removed once the file is gone, so an interrupted retention run
+        -- leaves no file without either an index entry or a queue entry
+        CREATE TABLE IF NOT EXISTS retention_unlink_queue (
+            queue_pk    INTEGER PRIMARY KEY AUTOINCREMENT,
+            sop_uid     TEXT NOT NULL,
+            file_path   TEXT NOT NULL,
+            queued_at   TEXT NOT NULL DEFAULT (datetime('now'))
+        );
+    )";
+
+    auto result = execute_sql(db, sql);
+    if (result.is_err()) {
+        return result;
+    }
+
+    return record_migration(db, 12, "Add retention unlink queue");
+}
+
 #endif  // PACS_WITH_DATABASE_SYSTEM
 
 }  // namespace kcenon::pacs::storage
@@ -0,0 +1,289 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file parallel_transfer.cpp
+ * @brief Implementation of the concurrent part-wise transfer scheduler
+ */
+
+#include <kcenon/pacs/storage/parallel_transfer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace kcenon::pacs::storage {
+
+using kcenon::common::make_error;
+
+namespace {
+
+/// Error codes for transfer scheduling
+constexpr int kTransferCancelled = -230;
+constexpr int kShortPart = -231;
+
+/**
+ * @brief First failure of a transfer; later failures are dropped
+ */
+struct transfer_failure {
+    std::optional<std::pair<int, std::string>> error;
+    std::atomic<bool> stop{false};
+
+    /// Record an error (caller holds the transfer mutex)
+    void set(int code, std::string message) {
+        if (!error) {
+            error.emplace(code, std::move(message));
+        }
+        stop.store(true);
+    }
+};
+
+/// Run an attempt, retrying failures with exponential backoff
+template <typename Attempt>
+auto with_retries(const transfer_options& options, const transfer_failure& failure,
+                  std::atomic<std::size_t>& retries, Attempt&& attempt) {
+    auto delay = options.retry_delay;
+    for (std::uint32_t tries = 0;; ++tries) {
+        auto result = attempt();
+        if (result.is_ok() || tries >= options.max_retries ||
+            failure.stop.load()) {
+            return result;
+        }
+        retries.fetch_add(1);
+        std::this_thread::sleep_for(delay);
+        delay *= 2;
+    }
+}
+
+/// Run worker on count threads (the calling thread when count is 1)
+template <typename Worker>
+void run_workers(std::size_t count, Worker& worker) {
+    if (count <= 1) {
+        worker();
+        return;
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        threads.emplace_back([&worker]() { worker(); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+auto part_count(std::uint64_t size, std::size_t part_size) -> std::size_t {
+    return static_cast<std::size_t>((size + part_size - 1) / part_size);
+}
+
+}  // namespace
+
+auto parallel_upload(byte_source& source, const transfer_options& options,
+                     const part_upload_fn& upload,
+                     const transfer_progress& progress)
+    -> Result<transfer_stats> {
+    const auto start = std::chrono::steady_clock::now();
+    const auto part_size = (std::max)(options.part_size, std::size_t{1});
+    const auto total = source.size();
+    const auto contiguous = source.contiguous();
+
+    // Guards the source, next_index, done and failure.error
+    std::mutex mutex;
+    std::size_t next_index = 0;
+    bool exhausted = false;
+    std::uint64_t done = 0;
+    transfer_failure failure;
+    std::atomic<std::size_t> retries{0};
+
+    auto worker = [&]() {
+        std::vector<std::uint8_t> buffer;
+        for (;;) {
+            std::size_t index = 0;
+            std::span<const std::uint8_t> part;
+            {
+                // Parts are taken in order; only the request runs unlocked
+                std::lock_guard lock(mutex);
+                if (failure.stop.load() || exhausted) {
+                    return;
+                }
+                index = next_index;
+                if (!contiguous.empty()) {
+                    const auto offset = index * part_size;
+                    if (offset >= contiguous.size()) {
+                        exhausted = true;
+                        return;
+                    }
+                    part = contiguous.subspan(
+                        offset, (std::min)(part_size, contiguous.size() - offset));
+                } else {
+                    buffer.resize(part_size);
+                    std::size_t filled = 0;
+                    while (filled < part_size) {
+                        auto n = source.read(std::span<std::uint8_t>(
+                            buffer.data() + filled, part_size - filled));
+                        if (n.is_err()) {
+                            failure.set(n.error().code, n.error().message);
+                            return;
+                        }
+                        if (n.value() == 0) {
+                            exhausted = true;
+                            break;
+                        }
+                        filled += n.value();
+                    }
+                    if (filled == 0) {
+                        return;
+                    }
+                    part = std::span<const std::uint8_t>(buffer.data(), filled);
+                }
+                ++next_index;
+            }
+
+            auto result = with_retries(options, failure, retries,
+                                       [&]() { return upload(index, part); });
+
+            std::lock_guard lock(mutex);
+            if (result.is_err()) {
+                failure.set(result.error().code,
+                            "Part " + std::to_string(index) + ": " +
+                                result.error().message);
+                return;
+            }
+            done += part.size();
+            if (progress && !progress(static_cast<std::size_t>(done),
+                                      static_cast<std::size_t>(total))) {
+                failure.set(kTransferCancelled, "Transfer cancelled by user");
+                return;
+            }
+        }
+    };
+
+    auto workers = (std::max)(options.max_in_flight, std::size_t{1});
+    if (total != byte_range::to_end) {
+        workers = (std::min)(workers, (std::max)(part_count(total, part_size),
+                                                 std::size_t{1}));
+    }
+    run_workers(workers, worker);
+
+    if (failure.error) {
+        return make_error<transfer_stats>(failure.error->first,
+                                          failure.error->second,
+                                          "parallel_transfer");
+    }
+
+    transfer_stats stats;
+    stats.parts = next_index;
+    stats.retries = retries.load();
+    stats.bytes = done;
+    stats.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    return stats;
+}
+
+auto parallel_download(std::uint64_t size, const transfer_options& options,
+                       const part_download_fn& download,
+                       const part_sink_fn& sink,
+                       const transfer_progress& progress)
+    -> Result<transfer_stats> {
+    const auto start = std::chrono::steady_clock::now();
+    const auto part_size = (std::max)(options.part_size, std::size_t{1});
+    const auto window = (std::max)(options.max_in_flight, std::size_t{1});
+    const auto parts = part_count(size, part_size);
+
+    // Guards the scheduling state, the sink and failure.error
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t next_request = 0;
+    std::size_t next_write = 0;
+    std::map<std::size_t, std::vector<std::uint8_t>> completed;
+    std::uint64_t done = 0;
+    transfer_failure failure;
+    std::atomic<std::size_t> retries{0};
+
+    auto worker = [&]() {
+        for (;;) {
+            std::size_t index = 0;
+            {
+                std::unique_lock lock(mutex);
+                cv.wait(lock, [&]() {
+                    return failure.stop.load() || next_request >= parts ||
+                           next_request < next_write + window;
+                });
+                if (failure.stop.load() || next_request >= parts) {
+                    return;
+                }
+                index = next_request++;
+            }
+
+            const auto offset = static_cast<std::uint64_t>(index) * part_size;
+            const auto length = (std::min)(static_cast<std::uint64_t>(part_size),
+                                           size - offset);
+            auto result = with_retries(
+                options, failure, retries,
+                [&]() -> Result<std::vector<std::uint8_t>> {
+                    auto data = download(offset, length);
+                    if (data.is_ok() && data.value().size() != length) {
+                        return make_error<std::vector<std::uint8_t>>(
+                            kShortPart,
+                            "Received " + std::to_string(data.value().size()) +
+                                " of " + std::to_string(length) + " bytes",
+                            "parallel_transfer");
+                    }
+                    return data;
+                });
+
+            std::unique_lock lock(mutex);
+            if (result.is_err()) {
+                failure.set(result.error().code,
+                            "Part " + std::to_string(index) + ": " +
+                                result.error().message);
+                cv.notify_all();
+                return;
+            }
+            completed.emplace(index, std::move(result.value()));
+
+            // Hand every part that is now in order to the sink
+            while (!failure.stop.load() && !completed.empty() &&
+                   completed.begin()->first == next_write) {
+                auto node = completed.extract(completed.begin());
+                auto written = sink(node.mapped());
+                if (written.is_err()) {
+                    failure.set(written.error().code, written.error().message);
+                    break;
+                }
+                done += node.mapped().size();
+                ++next_write;
+                if (progress && !progress(static_cast<std::size_t>(done),
+                                          static_cast<std::size_t>(size))) {
+                    failure.set(kTransferCancelled, "Transfer cancelled by user");
+                }
+            }
+            cv.notify_all();
+        }
+    };
+
+    run_workers((std::min)(window, (std::max)(parts, std::size_t{1})), worker);
+
+    if (failure.error) {
+        return make_error<transfer_stats>(failure.error->first,
+                                          failure.error->second,
+                                          "parallel_transfer");
+    }
+
+    transfer_stats stats;
+    stats.parts = parts;
+    stats.retries = retries.load();
+    stats.bytes = done;
+    stats.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    return stats;
+}
+
+}  // namespace kcenon::pacs::storage
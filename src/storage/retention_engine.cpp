@@ -0,0 +1,357 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file retention_engine.cpp
+ * @brief Implementation of batched retention deletes
+ */
+
+#include <kcenon/pacs/storage/retention_engine.h>
+
+#include <kcenon/pacs/compat/time.h>
+#include <kcenon/pacs/core/frame_index.h>
+#include <kcenon/pacs/storage/file_storage.h>
+#include <kcenon/pacs/storage/index_database.h>
+#include <kcenon/pacs/storage/rate_limiter.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <ctime>
+#include <deque>
+#include <filesystem>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace kcenon::pacs::storage {
+
+namespace {
+
+/// Studies per transaction, bounded by the IN list's bound parameters
+constexpr std::size_t kMaxBatchSize = 500;
+
+/// Queued files listed per query when topping up the workers
+constexpr std::size_t kUnlinkPageSize = 1000;
+
+/// Remove a file and its frame index sidecar; true once the file is gone
+auto unlink_file(file_storage* storage, const retention_unlink& file) -> bool {
+    if (storage != nullptr) {
+        // Keeps the storage's index in step and prunes empty directories
+        (void)storage->remove(file.sop_uid);
+    }
+
+    const std::filesystem::path path(file.file_path);
+    std::error_code ec;
+    std::filesystem::remove(core::frame_index::sidecar_path(path), ec);
+    ec.clear();
+    std::filesystem::remove(path, ec);
+    return !ec;
+}
+
+/**
+ * @brief Worker threads unlinking queued files
+ *
+ * Workers only touch the filesystem. The thread driving the run collects
+ * the queue keys of unlinked files with take_completed() and removes them
+ * from the database.
+ */
+class unlink_pool {
+public:
+    unlink_pool(file_storage* storage, std::size_t workers, double rate_per_second)
+        : storage_(storage), limiter_(rate_per_second) {
+        threads_.reserve(workers);
+        for (std::size_t i = 0; i < workers; ++i) {
+            threads_.emplace_back([this] { work(); });
+        }
+    }
+
+    ~unlink_pool() { stop(); }
+
+    unlink_pool(const unlink_pool&) = delete;
+    auto operator=(const unlink_pool&) -> unlink_pool& = delete;
+
+    void submit(std::vector<retention_unlink> files) {
+        {
+            std::lock_guard lock(mutex_);
+            for (auto& file : files) {
+                queue_.push_back(std::move(file));
+            }
+        }
+        work_cv_.notify_all();
+    }
+
+    /// Files submitted and not yet finished
+    [[nodiscard]] auto pending() -> std::size_t {
+        std::lock_guard lock(mutex_);
+        return queue_.size() + active_;
+    }
+
+    [[nodiscard]] auto take_completed() -> std::vector<int64_t> {
+        std::lock_guard lock(mutex_);
+        return std::exchange(completed_, {});
+    }
+
+    /// Wait until a file finishes or nothing is left
+    void wait_for_progress() {
+        std::unique_lock lock(mutex_);
+        progress_cv_.wait(lock, [this] {
+            return !completed_.empty() || (queue_.empty() && active_ == 0);
+        });
+    }
+
+    /// Finish the files being unlinked and drop the rest
+    void stop() {
+        {
+            std::lock_guard lock(mutex_);
+            if (stopping_) {
+                return;
+            }
+            stopping_ = true;
+            queue_.clear();
+        }
+        work_cv_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    [[nodiscard]] auto unlinked() const noexcept -> std::size_t {
+        return unlinked_.load();
+    }
+
+    [[nodiscard]] auto failures() const noexcept -> std::size_t {
+        return failures_.load();
+    }
+
+private:
+    void work() {
+        for (;;) {
+            retention_unlink file;
+            {
+                std::unique_lock lock(mutex_);
+                work_cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+                if (queue_.empty()) {
+                    return;
+                }
+                file = std::move(queue_.front());
+                queue_.pop_front();
+                ++active_;
+            }
+
+            limiter_.acquire(1.0);
+            const bool removed = unlink_file(storage_, file);
+            (removed ? unlinked_ : failures_).fetch_add(1);
+
+            {
+                std::lock_guard lock(mutex_);
+                --active_;
+                if (removed) {
+                    completed_.push_back(file.pk);
+                }
+            }
+            progress_cv_.notify_all();
+        }
+    }
+
+    file_storage* storage_;
+    rate_limiter limiter_;
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable progress_cv_;
+    std::deque<retention_unlink> queue_;
+    std::vector<int64_t> completed_;
+    std::size_t active_{0};
+    bool stopping_{false};
+
+    std::atomic<std::size_t> unlinked_{0};
+    std::atomic<std::size_t> failures_{0};
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace
+
+auto retention_cutoff_date(std::chrono::system_clock::time_point now,
+                           std::chrono::days retention) -> std::string {
+    const auto cutoff = std::chrono::system_clock::to_time_t(now - retention);
+    std::tm tm{};
+    kcenon::pacs::compat::localtime_safe(&cutoff, &tm);
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%Y%m%d");
+    return oss.str();
+}
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+retention_engine::retention_engine(index_database& database, file_storage* storage,
+                                   retention_engine_config config)
+    : database_(database), storage_(storage), config_(std::move(config)) {
+    config_.batch_size = std::clamp<std::size_t>(config_.batch_size, 1, kMaxBatchSize);
+    config_.unlink_workers = std::max<std::size_t>(config_.unlink_workers, 1);
+    config_.max_pending_unlinks = std::max<std::size_t>(config_.max_pending_unlinks, 1);
+}
+
+// ============================================================================
+// Retention
+// ============================================================================
+
+auto retention_engine::criteria(std::chrono::system_clock::time_point now) const
+    -> retention_criteria {
+    retention_criteria criteria;
+    criteria.default_cutoff = retention_cutoff_date(now, config_.default_retention);
+    for (const auto& [modality, retention] : config_.modality_retention) {
+        criteria.modality_cutoffs[modality] = retention_cutoff_date(now, retention);
+    }
+    criteria.exclude_patterns.assign(config_.exclude_patterns.begin(),
+                                     config_.exclude_patterns.end());
+    return criteria;
+}
+
+auto retention_engine::run(std::chrono::system_clock::time_point now)
+    -> retention_report {
+    std::lock_guard run_lock(run_mutex_);
+    cancel_requested_ = false;
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto policy = criteria(now);
+    retention_report report;
+
+    std::optional<unlink_pool> pool;
+    if (!config_.dry_run && !config_.database_only) {
+        pool.emplace(storage_, config_.unlink_workers,
+                     static_cast<double>(config_.max_unlinks_per_second));
+    }
+
+    // Dequeues unlinked files and tops the workers up from the queue table;
+    // files an earlier run left behind come first
+    int64_t queue_after_pk = 0;
+    bool queue_drained = false;
+    auto pump = [&]() -> bool {
+        auto done = pool->take_completed();
+        if (!done.empty()) {
+            auto dequeued = database_.complete_retention_unlinks(done);
+            if (dequeued.is_err()) {
+                report.error = dequeued.error().message;
+                return false;
+            }
+        }
+
+        queue_drained = false;
+        while (pool->pending() < config_.max_pending_unlinks) {
+            const auto room = config_.max_pending_unlinks - pool->pending();
+            auto page = database_.list_retention_unlinks(
+                queue_after_pk, std::min(room, kUnlinkPageSize));
+            if (page.is_err()) {
+                report.error = page.error().message;
+                return false;
+            }
+            if (page.value().empty()) {
+                queue_drained = true;
+                break;
+            }
+            queue_after_pk = page.value().back().pk;
+            pool->submit(std::move(page.value()));
+        }
+        return true;
+    };
+
+    // Delete in batches while the workers unlink earlier ones
+    bool exhausted = false;
+    std::string after_date;
+    int64_t after_pk = 0;
+    while (!cancel_requested_) {
+        if (pool && !pump()) {
+            break;
+        }
+
+        auto limit = config_.batch_size;
+        if (config_.max_deletions_per_run > 0) {
+            limit = std::min(limit, config_.max_deletions_per_run - report.studies_matched);
+            if (limit == 0) {
+                break;
+            }
+        }
+
+        auto page = database_.find_retention_candidates(policy, after_date, after_pk,
+                                                        limit);
+        if (page.is_err()) {
+            report.error = page.error().message;
+            break;
+        }
+        const auto& candidates = page.value();
+        if (candidates.empty()) {
+            exhausted = true;
+            break;
+        }
+
+        report.studies_matched += candidates.size();
+        after_date = candidates.back().study_date;
+        after_pk = candidates.back().study_pk;
+
+        if (!config_.dry_run) {
+            std::vector<int64_t> study_pks;
+            study_pks.reserve(candidates.size());
+            for (const auto& candidate : candidates) {
+                study_pks.push_back(candidate.study_pk);
+            }
+
+            auto batch = database_.delete_expired_studies(study_pks,
+                                                          !config_.database_only);
+            if (batch.is_err()) {
+                report.error = batch.error().message;
+                break;
+            }
+            ++report.batches;
+            report.studies_deleted += batch.value().studies_deleted;
+            report.files_queued += batch.value().files_queued;
+        }
+
+        if (candidates.size() < limit) {
+            exhausted = true;
+            break;
+        }
+    }
+
+    // Let the workers finish the queue
+    if (pool) {
+        while (!cancel_requested_ && report.error.empty() && pump()) {
+            if (queue_drained && pool->pending() == 0) {
+                break;
+            }
+            pool->wait_for_progress();
+        }
+        pool->stop();
+
+        auto done = pool->take_completed();
+        if (!done.empty()) {
+            auto dequeued = database_.complete_retention_unlinks(done);
+            if (dequeued.is_err() && report.error.empty()) {
+                report.error = dequeued.error().message;
+            }
+        }
+        report.files_unlinked = pool->unlinked();
+        report.unlink_failures = pool->failures();
+    }
+
+    report.completed = exhausted && !cancel_requested_ && report.error.empty() &&
+                       (!pool || (queue_drained && report.unlink_failures == 0));
+    report.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    return report;
+}
+
+void retention_engine::cancel() noexcept {
+    cancel_requested_ = true;
+}
+
+auto retention_engine::config() const noexcept -> const retention_engine_config& {
+    return config_;
+}
+
+}  // namespace kcenon::pacs::storage
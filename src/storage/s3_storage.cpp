@@ -18,8 +18,12 @@
 #include <kcenon/pacs/core/dicom_tag_constants.h>
 #include <kcenon/pacs/encoding/transfer_syntax.h>
 #include <kcenon/pacs/encoding/vr_type.h>
+#include <kcenon/pacs/storage/content_hash.h>
 
 #include <algorithm>
+#include <fstream>
+#include <map>
+#include <mutex>
 #include <set>
 #include <sstream>
 
@@ -38,7 +42,7 @@
 #include <aws/s3/model/CreateMultipartUploadRequest.h>
 #include <aws/s3/model/UploadPartRequest.h>
 
-#include <mutex>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 #endif
 
 namespace kcenon::pacs::storage {
@@ -56,6 +60,7 @@ constexpr int kDownloadError = -4;
 constexpr int kConnectionError = -6;
 constexpr int kIntegrityError = -7;
 constexpr int kSerializationError = -8;
+constexpr int kInvalidRange = -9;
 
 } // namespace
 
@@ -67,19 +72,26 @@ constexpr int kSerializationError = -8;
  * @brief Abstract interface for S3 client operations
  *
  * Both mock_s3_client and aws_s3_client implement this interface,
- * allowing compile-time selection of the backend.
+ * allowing compile-time selection of the backend. All operations may be
+ * called concurrently; multipart parts are uploaded from several threads.
  */
 class s3_storage::s3_client_interface {
 public:
   virtual ~s3_client_interface() = default;
 
   [[nodiscard]] virtual auto put_object(const std::string &key,
-                                        const std::vector<std::uint8_t> &data)
+                                        std::span<const std::uint8_t> data)
       -> VoidResult = 0;
 
   [[nodiscard]] virtual auto get_object(const std::string &key)
       -> Result<std::vector<std::uint8_t>> = 0;
 
+  /// Ranged GET; the range is already resolved against the object size
+  [[nodiscard]] virtual auto get_object_range(const std::string &key,
+                                              std::uint64_t offset,
+                                              std::uint64_t length)
+      -> Result<std::vector<std::uint8_t>> = 0;
+
   [[nodiscard]] virtual auto delete_object(const std::string &key)
       -> VoidResult = 0;
 
@@ -94,9 +106,26 @@ public:
 
   [[nodiscard]] virtual auto is_connected() const -> bool = 0;
 
-  [[nodiscard]] virtual auto multipart_upload(
-      const std::string &key, const std::vector<std::uint8_t> &data,
-      std::size_t part_size, progress_callback callback) -> VoidResult = 0;
+  /// Start a multipart upload and return its upload ID
+  [[nodiscard]] virtual auto create_multipart_upload(const std::string &key)
+      -> Result<std::string> = 0;
+
+  /// Upload one part (part numbers start at 1) and return its ETag
+  [[nodiscard]] virtual auto upload_part(const std::string &key,
+                                         const std::string &upload_id,
+                                         int part_number,
+                                         std::span<const std::uint8_t> data)
+      -> Result<std::string> = 0;
+
+  /// Assemble the object from parts 1..etags.size()
+  [[nodiscard]] virtual auto
+  complete_multipart_upload(const std::string &key, const std::string &upload_id,
+                            const std::vector<std::string> &etags)
+      -> VoidResult = 0;
+
+  /// Discard an unfinished multipart upload and its parts
+  virtual void abort_multipart_upload(const std::string &key,
+                                      const std::string &upload_id) = 0;
 };
 
 // ============================================================================
@@ -115,13 +144,14 @@ public:
       : connected_(true) {}
 
   [[nodiscard]] auto put_object(const std::string &key,
-                                const std::vector<std::uint8_t> &data)
+                                std::span<const std::uint8_t> data)
       -> VoidResult override {
     if (!connected_) {
       return make_error<std::monostate>(
           kConnectionError, "S3 client not connected", "s3_storage");
     }
-    objects_[key] = data;
+    std::lock_guard lock(mutex_);
+    objects_[key].assign(data.begin(), data.end());
     return ok();
   }
 
@@ -131,6 +161,7 @@ public:
       return make_error<std::vector<std::uint8_t>>(
           kConnectionError, "S3 client not connected", "s3_storage");
     }
+    std::lock_guard lock(mutex_);
     auto it = objects_.find(key);
     if (it == objects_.end()) {
       return make_error<std::vector<std::uint8_t>>(
@@ -139,12 +170,34 @@ public:
     return it->second;
   }
 
+  [[nodiscard]] auto get_object_range(const std::string &key,
+                                      std::uint64_t offset,
+                                      std::uint64_t length)
+      -> Result<std::vector<std::uint8_t>> override {
+    if (!connected_) {
+      return make_error<std::vector<std::uint8_t>>(
+          kConnectionError, "S3 client not connected", "s3_storage");
+    }
+    std::lock_guard lock(mutex_);
+    auto it = objects_.find(key);
+    if (it == objects_.end()) {
+      return make_error<std::vector<std::uint8_t>>(
+          kObjectNotFound, "Object not found: " + key, "s3_storage");
+    }
+    const auto &data = it->second;
+    const auto begin = (std::min)(static_cast<std::size_t>(offset), data.size());
+    const auto end =
+        (std::min)(begin + static_cast<std::size_t>(length), data.size());
+    return std::vector<std::uint8_t>(data.begin() + begin, data.begin() + end);
+  }
+
   [[nodiscard]] auto delete_object(const std::string &key)
       -> VoidResult override {
     if (!connected_) {
       return make_error<std::monostate>(
           kConnectionError, "S3 client not connected", "s3_storage");
     }
+    std::lock_guard lock(mutex_);
     objects_.erase(key);
     return ok();
   }
@@ -154,11 +207,13 @@ public:
     if (!connected_) {
       return false;
     }
+    std::lock_guard lock(mutex_);
     return objects_.contains(key);
   }
 
   [[nodiscard]] auto get_object_size(const std::string &key) const
       -> std::size_t override {
+    std::lock_guard lock(mutex_);
     auto it = objects_.find(key);
     if (it != objects_.end()) {
       return it->second.size();
@@ -168,6 +223,7 @@ public:
 
   [[nodiscard]] auto list_objects() const
       -> std::vector<std::string> override {
+    std::lock_guard lock(mutex_);
     std::vector<std::string> keys;
     keys.reserve(objects_.size());
     for (const auto &[key, data] : objects_) {
@@ -180,30 +236,66 @@ public:
     return connected_;
   }
 
-  [[nodiscard]] auto multipart_upload(const std::string &key,
-                                      const std::vector<std::uint8_t> &data,
-                                      std::size_t part_size,
-                                      progress_callback callback)
-      -> VoidResult override {
-    std::size_t total_bytes = data.size();
-    std::size_t bytes_uploaded = 0;
+  [[nodiscard]] auto create_multipart_upload(const std::string &key)
+      -> Result<std::string> override {
+    if (!connected_) {
+      return make_error<std::string>(kConnectionError,
+                                     "S3 client not connected", "s3_storage");
+    }
+    std::lock_guard lock(mutex_);
+    auto upload_id = key + "#" + std::to_string(++upload_counter_);
+    uploads_[upload_id];
+    return upload_id;
+  }
 
-    while (bytes_uploaded < total_bytes) {
-      std::size_t chunk = (std::min)(part_size, total_bytes - bytes_uploaded);
-      bytes_uploaded += chunk;
+  [[nodiscard]] auto upload_part(const std::string & /*key*/,
+                                 const std::string &upload_id, int part_number,
+                                 std::span<const std::uint8_t> data)
+      -> Result<std::string> override {
+    std::lock_guard lock(mutex_);
+    auto it = uploads_.find(upload_id);
+    if (it == uploads_.end()) {
+      return make_error<std::string>(
+          kUploadError, "No such upload: " + upload_id, "s3_storage");
+    }
+    it->second[part_number].assign(data.begin(), data.end());
+    return "etag-" + std::to_string(part_number);
+  }
 
-      if (callback && !callback(bytes_uploaded, total_bytes)) {
-        return make_error<std::monostate>(
-            kUploadError, "Upload cancelled by user", "s3_storage");
-      }
+  [[nodiscard]] auto
+  complete_multipart_upload(const std::string &key, const std::string &upload_id,
+                            const std::vector<std::string> &etags)
+      -> VoidResult override {
+    std::lock_guard lock(mutex_);
+    auto it = uploads_.find(upload_id);
+    if (it == uploads_.end() || it->second.size() != etags.size()) {
+      return make_error<std::monostate>(
+          kUploadError, "Incomplete multipart upload: " + key, "s3_storage");
+    }
+    std::vector<std::uint8_t> object;
+    for (const auto &[number, part] : it->second) {
+      object.insert(object.end(), part.begin(), part.end());
     }
+    objects_[key] = std::move(object);
+    uploads_.erase(it);
+    return ok();
+  }
 
-    return put_object(key, data);
+  void abort_multipart_upload(const std::string & /*key*/,
+                              const std::string &upload_id) override {
+    std::lock_guard lock(mutex_);
+    uploads_.erase(upload_id);
   }
 
 private:
   std::unordered_map<std::string, std::vector<std::uint8_t>> objects_;
+
+  /// Parts of unfinished multipart uploads by upload ID
+  std::unordered_map<std::string, std::map<int, std::vector<std::uint8_t>>>
+      uploads_;
+  std::size_t upload_counter_{0};
   bool connected_;
+  mutable std::mutex mutex_;
 };
 
 // ============================================================================
@@ -229,6 +321,27 @@ private:
   static inline Aws::SDKOptions options_;
 };
 
+/**
+ * @brief Request body reading caller-owned bytes without copying them
+ *
+ * The SDK only reads the buffer, so it can wrap the const span; the body
+ * must outlive the request it is attached to.
+ */
+class span_body {
+public:
+  explicit span_body(std::span<const std::uint8_t> data)
+      : buffer_(const_cast<unsigned char *>(data.data()), data.size()),
+        stream_(Aws::MakeShared<Aws::IOStream>("S3SpanBody", &buffer_)) {}
+
+  [[nodiscard]] auto stream() const -> std::shared_ptr<Aws::IOStream> {
+    return stream_;
+  }
+
+private:
+  Aws::Utils::Stream::PreallocatedStreamBuf buffer_;
+  std::shared_ptr<Aws::IOStream> stream_;
+};
+
 } // namespace
 
 /**
@@ -265,17 +378,16 @@ public:
   }
 
   [[nodiscard]] auto put_object(const std::string &key,
-                                const std::vector<std::uint8_t> &data)
+                                std::span<const std::uint8_t> data)
       -> VoidResult override {
     Aws::S3::Model::PutObjectRequest request;
     request.SetBucket(bucket_);
     request.SetKey(key);
     request.SetContentType("application/dicom");
 
-    auto stream = Aws::MakeShared<Aws::StringStream>("PutObjectStream");
-    stream->write(reinterpret_cast<const char *>(data.data()),
-                  static_cast<std::streamsize>(data.size()));
-    request.SetBody(stream);
+    span_body body(data);
+    request.SetBody(body.stream());
+    request.SetContentLength(static_cast<long long>(data.size()));
 
     auto outcome = client_->PutObject(request);
     if (!outcome.IsSuccess()) {
@@ -316,6 +428,41 @@ public:
     return result;
   }
 
+  [[nodiscard]] auto get_object_range(const std::string &key,
+                                      std::uint64_t offset,
+                                      std::uint64_t length)
+      -> Result<std::vector<std::uint8_t>> override {
+    if (length == 0) {
+      return std::vector<std::uint8_t>{};
+    }
+
+    Aws::S3::Model::GetObjectRequest request;
+    request.SetBucket(bucket_);
+    request.SetKey(key);
+    request.SetRange("bytes=" + std::to_string(offset) + "-" +
+                     std::to_string(offset + length - 1));
+
+    auto outcome = client_->GetObject(request);
+    if (!outcome.IsSuccess()) {
+      const auto &error = outcome.GetError();
+      if (error.GetErrorType() ==
+          Aws::S3::S3Errors::NO_SUCH_KEY) {
+        return make_error<std::vector<std::uint8_t>>(
+            kObjectNotFound, "Object not found: " + key, "s3_storage");
+      }
+      return make_error<std::vector<std::uint8_t>>(
+          kDownloadError,
+          "S3 ranged GetObject failed: " + std::string(error.GetMessage()),
+          "s3_storage");
+    }
+
+    auto &body = outcome.GetResult().GetBody();
+    std::vector<std::uint8_t> result(
+        (std::istreambuf_iterator<char>(body)),
+        std::istreambuf_iterator<char>());
+    return result;
+  }
+
   [[nodiscard]] auto delete_object(const std::string &key)
       -> VoidResult override {
     Aws::S3::Model::DeleteObjectRequest request;
@@ -390,106 +537,87 @@ public:
     return client_ != nullptr;
   }
 
-  [[nodiscard]] auto multipart_upload(const std::string &key,
-                                      const std::vector<std::uint8_t> &data,
-                                      std::size_t part_size,
-                                      progress_callback callback)
-      -> VoidResult override {
-    // Initiate multipart upload
-    Aws::S3::Model::CreateMultipartUploadRequest create_request;
-    create_request.SetBucket(bucket_);
-    create_request.SetKey(key);
-    create_request.SetContentType("application/dicom");
-
-    auto create_outcome = client_->CreateMultipartUpload(create_request);
-    if (!create_outcome.IsSuccess()) {
-      return make_error<std::monostate>(
+  [[nodiscard]] auto create_multipart_upload(const std::string &key)
+      -> Result<std::string> override {
+    Aws::S3::Model::CreateMultipartUploadRequest request;
+    request.SetBucket(bucket_);
+    request.SetKey(key);
+    request.SetContentType("application/dicom");
+
+    auto outcome = client_->CreateMultipartUpload(request);
+    if (!outcome.IsSuccess()) {
+      return make_error<std::string>(
           kUploadError,
           "Failed to initiate multipart upload: " +
-              std::string(create_outcome.GetError().GetMessage()),
+              std::string(outcome.GetError().GetMessage()),
           "s3_storage");
     }
+    return std::string(outcome.GetResult().GetUploadId());
+  }
 
-    auto upload_id = create_outcome.GetResult().GetUploadId();
-    Aws::S3::Model::CompletedMultipartUpload completed_upload;
+  [[nodiscard]] auto upload_part(const std::string &key,
+                                 const std::string &upload_id, int part_number,
+                                 std::span<const std::uint8_t> data)
+      -> Result<std::string> override {
+    span_body body(data);
 
-    std::size_t total_bytes = data.size();
-    std::size_t bytes_uploaded = 0;
-    int part_number = 1;
-
-    while (bytes_uploaded < total_bytes) {
-      std::size_t chunk =
-          (std::min)(part_size, total_bytes - bytes_uploaded);
-
-      auto stream = Aws::MakeShared<Aws::StringStream>("UploadPartStream");
-      stream->write(
-          reinterpret_cast<const char *>(data.data() + bytes_uploaded),
-          static_cast<std::streamsize>(chunk));
-
-      Aws::S3::Model::UploadPartRequest part_request;
-      part_request.SetBucket(bucket_);
-      part_request.SetKey(key);
-      part_request.SetUploadId(upload_id);
-      part_request.SetPartNumber(part_number);
-      part_request.SetBody(stream);
-      part_request.SetContentLength(static_cast<long long>(chunk));
-
-      auto part_outcome = client_->UploadPart(part_request);
-      if (!part_outcome.IsSuccess()) {
-        // Abort the multipart upload on failure
-        Aws::S3::Model::AbortMultipartUploadRequest abort_request;
-        abort_request.SetBucket(bucket_);
-        abort_request.SetKey(key);
-        abort_request.SetUploadId(upload_id);
-        client_->AbortMultipartUpload(abort_request);
-
-        return make_error<std::monostate>(
-            kUploadError,
-            "Failed to upload part " + std::to_string(part_number) + ": " +
-                std::string(part_outcome.GetError().GetMessage()),
-            "s3_storage");
-      }
+    Aws::S3::Model::UploadPartRequest request;
+    request.SetBucket(bucket_);
+    request.SetKey(key);
+    request.SetUploadId(upload_id);
+    request.SetPartNumber(part_number);
+    request.SetBody(body.stream());
+    request.SetContentLength(static_cast<long long>(data.size()));
 
+    auto outcome = client_->UploadPart(request);
+    if (!outcome.IsSuccess()) {
+      return make_error<std::string>(
+          kUploadError,
+          "Failed to upload part " + std::to_string(part_number) + ": " +
+              std::string(outcome.GetError().GetMessage()),
+          "s3_storage");
+    }
+    return std::string(outcome.GetResult().GetETag());
+  }
+
+  [[nodiscard]] auto
+  complete_multipart_upload(const std::string &key, const std::string &upload_id,
+                            const std::vector<std::string> &etags)
+      -> VoidResult override {
+    Aws::S3::Model::CompletedMultipartUpload completed_upload;
+    for (std::size_t i = 0; i < etags.size(); ++i) {
       Aws::S3::Model::CompletedPart completed_part;
-      completed_part.SetPartNumber(part_number);
-      completed_part.SetETag(part_outcome.GetResult().GetETag());
+      completed_part.SetPartNumber(static_cast<int>(i + 1));
+      completed_part.SetETag(etags[i]);
       completed_upload.AddParts(std::move(completed_part));
-
-      bytes_uploaded += chunk;
-      part_number++;
-
-      if (callback && !callback(bytes_uploaded, total_bytes)) {
-        // Abort on user cancellation
-        Aws::S3::Model::AbortMultipartUploadRequest abort_request;
-        abort_request.SetBucket(bucket_);
-        abort_request.SetKey(key);
-        abort_request.SetUploadId(upload_id);
-        client_->AbortMultipartUpload(abort_request);
-
-        return make_error<std::monostate>(
-            kUploadError, "Upload cancelled by user", "s3_storage");
-      }
     }
 
-    // Complete multipart upload
-    Aws::S3::Model::CompleteMultipartUploadRequest complete_request;
-    complete_request.SetBucket(bucket_);
-    complete_request.SetKey(key);
-    complete_request.SetUploadId(upload_id);
-    complete_request.SetMultipartUpload(completed_upload);
+    Aws::S3::Model::CompleteMultipartUploadRequest request;
+    request.SetBucket(bucket_);
+    request.SetKey(key);
+    request.SetUploadId(upload_id);
+    request.SetMultipartUpload(completed_upload);
 
-    auto complete_outcome = client_->CompleteMultipartUpload(complete_request);
-    if (!complete_outcome.IsSuccess()) {
+    auto outcome = client_->CompleteMultipartUpload(request);
+    if (!outcome.IsSuccess()) {
       return make_error<std::monostate>(
           kUploadError,
           "Failed to complete multipart upload: " +
-              std::string(complete_outcome.GetError().GetMessage()),
+              std::string(outcome.GetError().GetMessage()),
           "s3_storage");
     }
-
     return ok();
   }
 
+  void abort_multipart_upload(const std::string &key,
+                              const std::string &upload_id) override {
+    Aws::S3::Model::AbortMultipartUploadRequest request;
+    request.SetBucket(bucket_);
+    request.SetKey(key);
+    request.SetUploadId(upload_id);
+    client_->AbortMultipartUpload(request);
+  }
+
 private:
   std::string bucket_;
   std::unique_ptr<Aws::S3::S3Client> client_;
@@ -523,7 +651,20 @@ auto s3_storage::store(const core::dicom_dataset &dataset) -> VoidResult {
 }
 
 auto s3_storage::store_with_progress(const core::dicom_dataset &dataset,
-                                     progress_callback callback) -> VoidResult {
+                                    progress_callback callback) -> VoidResult {
+  return upload_file(core::dicom_file::create(
+                         dataset, encoding::transfer_syntax::explicit_vr_little_endian),
+                     std::move(callback));
+}
+
+auto s3_storage::store_file(const core::dicom_file &file) -> VoidResult {
+  return upload_file(file, nullptr);
+}
+
+auto s3_storage::upload_file(const core::dicom_file &file,
+                            progress_callback callback) -> VoidResult {
+  const auto &dataset = file.dataset();
+
   // Extract required UIDs
   auto study_uid = dataset.get_string(core::tags::study_instance_uid);
   auto series_uid = dataset.get_string(core::tags::series_instance_uid);
@@ -536,36 +677,53 @@ auto s3_storage::store_with_progress(const core::dicom_dataset &dataset,
         "s3_storage");
   }
 
-  // Build S3 object key
-  auto object_key = build_object_key(study_uid, series_uid, sop_uid);
-
-  // Create DICOM file and serialize to bytes
-  auto dicom_file = core::dicom_file::create(
-      dataset, encoding::transfer_syntax::explicit_vr_little_endian);
-
-  auto data = dicom_file.to_bytes();
+  // Serialize to Part 10 bytes in the file's own transfer syntax
+  auto data = file.to_bytes();
   if (data.empty()) {
     return make_error<std::monostate>(
         kSerializationError, "Failed to serialize DICOM dataset", "s3_storage");
   }
 
+  memory_byte_source source(std::move(data));
+  return upload_object(study_uid, series_uid, sop_uid, source,
+                       std::move(callback));
+}
+
+auto s3_storage::upload_object(const std::string &study_uid,
+                               const std::string &series_uid,
+                               const std::string &sop_uid, byte_source &source,
+                               progress_callback callback) -> VoidResult {
+  // Build S3 object key
+  auto object_key = build_object_key(study_uid, series_uid, sop_uid);
+  const auto size = static_cast<std::size_t>(source.size());
+
   // Report initial progress
-  if (callback && !callback(0, data.size())) {
+  if (callback && !callback(0, size)) {
     return make_error<std::monostate>(kUploadError, "Upload cancelled by user",
                                       "s3_storage");
   }
 
   // Upload to S3 (use multipart for large files)
   VoidResult upload_result = ok();
-  if (data.size() > config_.multipart_threshold) {
-    upload_result =
-        client_->multipart_upload(object_key, data, config_.part_size, callback);
+  if (size > config_.multipart_threshold) {
+    upload_result = upload_multipart(object_key, source, callback);
   } else {
-    upload_result = client_->put_object(object_key, data);
+    auto body = source.contiguous();
+    std::vector<std::uint8_t> buffered;
+    if (body.empty() && size > 0) {
+      auto data = source.read_all();
+      if (data.is_err()) {
+        return make_error<std::monostate>(data.error().code,
+                                          data.error().message, "s3_storage");
+      }
+      buffered = std::move(data.value());
+      body = buffered;
+    }
+    upload_result = client_->put_object(object_key, body);
 
     // Report completion progress
     if (callback) {
-      callback(data.size(), data.size());
+      callback(size, size);
     }
   }
 
@@ -581,58 +739,147 @@ auto s3_storage::store_with_progress(const core::dicom_dataset &dataset,
     info.sop_instance_uid = sop_uid;
     info.study_instance_uid = study_uid;
     info.series_instance_uid = series_uid;
-    info.size_bytes = data.size();
+    info.size_bytes = size;
     index_[sop_uid] = std::move(info);
   }
 
   return ok();
 }
 
+auto s3_storage::store_stream(byte_source &source) -> Result<stored_instance> {
+  // Mapped and in-memory sources are identified and uploaded in place
+  std::optional<memory_byte_source> buffered;
+  byte_source *body = &source;
+  if (source.contiguous().empty()) {
+    auto data = source.read_all();
+    if (data.is_err()) {
+      return make_error<stored_instance>(data.error().code,
+                                         data.error().message, "s3_storage");
+    }
+    body = &buffered.emplace(std::move(data.value()));
+  }
+
+  auto identity = identify_part10(body->contiguous());
+  if (identity.is_err()) {
+    return identity;
+  }
+  const auto &info = identity.value();
+
+  auto uploaded = upload_object(info.study_instance_uid, info.series_instance_uid,
+                                info.sop_instance_uid, *body, nullptr);
+  if (uploaded.is_err()) {
+    return make_error<stored_instance>(uploaded.error().code,
+                                       uploaded.error().message, "s3_storage");
+  }
+  return identity;
+}
+
+auto s3_storage::replace_file(const core::dicom_file &file)
+    -> Result<stored_instance> {
+  auto data = file.to_bytes();
+  content_hasher hasher;
+  hasher.update(data);
+
+  memory_byte_source source(std::move(data));
+  auto stored = store_stream(source);
+  if (stored.is_ok()) {
+    stored.value().content_hash = hasher.hex_digest();
+  }
+  return stored;
+}
+
+auto s3_storage::open_read(std::string_view sop_instance_uid, byte_range range)
+    -> Result<std::unique_ptr<byte_source>> {
+  auto object = find_object(sop_instance_uid);
+  if (!object) {
+    return make_error<std::unique_ptr<byte_source>>(
+        kObjectNotFound,
+        "Instance not found: " + std::string{sop_instance_uid}, "s3_storage");
+  }
+
+  auto resolved = range.resolve(object->second);
+  if (!resolved) {
+    return make_error<std::unique_ptr<byte_source>>(
+        kInvalidRange, "Byte range starts past the end of the object",
+        "s3_storage");
+  }
+
+  std::vector<std::uint8_t> data;
+  data.reserve(static_cast<std::size_t>(resolved->length));
+  auto downloaded = download_range(
+      object->first, object->second, *resolved,
+      [&data](std::span<const std::uint8_t> part) -> VoidResult {
+        data.insert(data.end(), part.begin(), part.end());
+        return ok();
+      },
+      nullptr);
+  if (downloaded.is_err()) {
+    return make_error<std::unique_ptr<byte_source>>(
+        kDownloadError,
+        "Failed to download from S3: " + downloaded.error().message,
+        "s3_storage");
+  }
+
+  return std::unique_ptr<byte_source>(
+      std::make_unique<memory_byte_source>(std::move(data)));
+}
+
 auto s3_storage::retrieve(std::string_view sop_instance_uid)
     -> Result<core::dicom_dataset> {
   return retrieve_with_progress(sop_instance_uid, nullptr);
 }
 
 auto s3_storage::retrieve_with_progress(std::string_view sop_instance_uid,
-                                        progress_callback callback)
+                                       progress_callback callback)
     -> Result<core::dicom_dataset> {
-  std::string object_key;
+  auto file = download_file(sop_instance_uid, std::move(callback));
+  if (file.is_err()) {
+    return make_error<core::dicom_dataset>(
+        file.error().code, file.error().message, "s3_storage");
+  }
+  return file.value().dataset();
+}
 
-  {
-    std::shared_lock lock(mutex_);
-    auto it = index_.find(std::string{sop_instance_uid});
-    if (it == index_.end()) {
-      return make_error<core::dicom_dataset>(
-          kObjectNotFound,
-          "Instance not found: " + std::string{sop_instance_uid}, "s3_storage");
-    }
-    object_key = it->second.key;
+auto s3_storage::retrieve_file(std::string_view sop_instance_uid)
+    -> Result<core::dicom_file> {
+  return download_file(sop_instance_uid, nullptr);
+}
+
+auto s3_storage::download_file(std::string_view sop_instance_uid,
+                              progress_callback callback)
+    -> Result<core::dicom_file> {
+  auto object = find_object(sop_instance_uid);
+  if (!object) {
+    return make_error<core::dicom_file>(
+        kObjectNotFound,
+        "Instance not found: " + std::string{sop_instance_uid}, "s3_storage");
   }
 
   // Download from S3
-  auto download_result = client_->get_object(object_key);
-  if (download_result.is_err()) {
-    return make_error<core::dicom_dataset>(
+  std::vector<std::uint8_t> data;
+  data.reserve(static_cast<std::size_t>(object->second));
+  auto downloaded = download_range(
+      object->first, object->second, byte_range{0, object->second},
+      [&data](std::span<const std::uint8_t> part) -> VoidResult {
+        data.insert(data.end(), part.begin(), part.end());
+        return ok();
+      },
+      std::move(callback));
+  if (downloaded.is_err()) {
+    return make_error<core::dicom_file>(
         kDownloadError, "Failed to download from S3", "s3_storage");
   }
 
-  const auto &data = download_result.value();
-
-  // Report progress (download complete)
-  if (callback) {
-    callback(data.size(), data.size());
-  }
-
   // Deserialize DICOM data
   auto parse_result = core::dicom_file::from_bytes(data);
   if (parse_result.is_err()) {
-    return make_error<core::dicom_dataset>(
+    return make_error<core::dicom_file>(
         kSerializationError,
         "Failed to parse DICOM data: " + parse_result.error().message,
         "s3_storage");
   }
 
-  return parse_result.value().dataset();
+  return std::move(parse_result.value());
 }
 
 auto s3_storage::remove(std::string_view sop_instance_uid) -> VoidResult {
@@ -661,6 +908,18 @@ auto s3_storage::exists(std::string_view sop_instance_uid) const -> bool {
   return index_.contains(std::string{sop_instance_uid});
 }
 
+auto s3_storage::exists_batch(
+    const std::vector<std::string> &sop_instance_uids) const
+    -> std::vector<bool> {
+  std::vector<bool> found;
+  found.reserve(sop_instance_uids.size());
+  std::shared_lock lock(mutex_);
+  for (const auto &uid : sop_instance_uids) {
+    found.push_back(index_.contains(uid));
+  }
+  return found;
+}
+
 auto s3_storage::find(const core::dicom_dataset &query)
     -> Result<std::vector<core::dicom_dataset>> {
   std::vector<core::dicom_dataset> results;
@@ -755,6 +1014,49 @@ auto s3_storage::verify_integrity() -> VoidResult {
 // S3-specific Operations
 // ============================================================================
 
+auto s3_storage::download_to_file(std::string_view sop_instance_uid,
+                                  const std::filesystem::path &path,
+                                  progress_callback callback) -> VoidResult {
+  auto object = find_object(sop_instance_uid);
+  if (!object) {
+    return make_error<std::monostate>(
+        kObjectNotFound,
+        "Instance not found: " + std::string{sop_instance_uid}, "s3_storage");
+  }
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    return make_error<std::monostate>(
+        kDownloadError, "Cannot create file: " + path.string(), "s3_storage");
+  }
+
+  auto downloaded = download_range(
+      object->first, object->second, byte_range{0, object->second},
+      [&out, &path](std::span<const std::uint8_t> part) -> VoidResult {
+        out.write(reinterpret_cast<const char *>(part.data()),
+                  static_cast<std::streamsize>(part.size()));
+        if (!out) {
+          return make_error<std::monostate>(
+              kDownloadError, "Failed to write file: " + path.string(),
+              "s3_storage");
+        }
+        return ok();
+      },
+      std::move(callback));
+  out.close();
+
+  if (downloaded.is_err() || !out) {
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    return downloaded.is_err()
+               ? downloaded
+               : make_error<std::monostate>(
+                     kDownloadError, "Failed to write file: " + path.string(),
+                     "s3_storage");
+  }
+  return ok();
+}
+
 auto s3_storage::get_object_key(std::string_view sop_instance_uid) const
     -> std::string {
   std::shared_lock lock(mutex_);
@@ -842,10 +1144,109 @@ auto s3_storage::sanitize_uid(std::string_view uid) -> std::string {
   return result;
 }
 
-auto s3_storage::upload_multipart(const std::string &key,
-                                  const std::vector<std::uint8_t> &data,
+auto s3_storage::upload_multipart(const std::string &key, byte_source &source,
                                   progress_callback callback) -> VoidResult {
-  return client_->multipart_upload(key, data, config_.part_size, callback);
+  auto upload_id = client_->create_multipart_upload(key);
+  if (upload_id.is_err()) {
+    return make_error<std::monostate>(upload_id.error().code,
+                                      upload_id.error().message, "s3_storage");
+  }
+
+  // ETags by part index; each part writes only its own slot
+  std::mutex etags_mutex;
+  std::vector<std::string> etags;
+
+  auto uploaded = parallel_upload(
+      source, transfer_settings(),
+      [&](std::size_t part_index,
+          std::span<const std::uint8_t> data) -> VoidResult {
+        auto etag = client_->upload_part(key, upload_id.value(),
+                                         static_cast<int>(part_index + 1), data);
+        if (etag.is_err()) {
+          return make_error<std::monostate>(etag.error().code,
+                                            etag.error().message, "s3_storage");
+        }
+        std::lock_guard lock(etags_mutex);
+        if (etags.size() <= part_index) {
+          etags.resize(part_index + 1);
+        }
+        etags[part_index] = std::move(etag.value());
+        return ok();
+      },
+      callback);
+
+  if (uploaded.is_ok()) {
+    auto completed =
+        client_->complete_multipart_upload(key, upload_id.value(), etags);
+    if (completed.is_ok()) {
+      return ok();
+    }
+    client_->abort_multipart_upload(key, upload_id.value());
+    return completed;
+  }
+
+  client_->abort_multipart_upload(key, upload_id.value());
+  return make_error<std::monostate>(kUploadError,
+                                    "Multipart upload failed: " +
+                                        uploaded.error().message,
+                                    "s3_storage");
+}
+
+auto s3_storage::find_object(std::string_view sop_instance_uid) const
+    -> std::optional<std::pair<std::string, std::uint64_t>> {
+  std::shared_lock lock(mutex_);
+  auto it = index_.find(std::string{sop_instance_uid});
+  if (it == index_.end()) {
+    return std::nullopt;
+  }
+  return std::pair<std::string, std::uint64_t>{it->second.key,
+                                               it->second.size_bytes};
+}
+
+auto s3_storage::download_range(const std::string &key,
+                                std::uint64_t object_size, byte_range range,
+                                const part_sink_fn &sink,
+                                progress_callback callback) -> VoidResult {
+  if (range.length > config_.multipart_threshold) {
+    auto downloaded = parallel_download(
+        range.length, transfer_settings(),
+        [&](std::uint64_t offset, std::uint64_t length) {
+          return client_->get_object_range(key, range.offset + offset, length);
+        },
+        sink, callback);
+    if (downloaded.is_err()) {
+      return make_error<std::monostate>(downloaded.error().code,
+                                        downloaded.error().message,
+                                        "s3_storage");
+    }
+    return ok();
+  }
+
+  // Small objects take one request; whole-object reads skip the Range header
+  auto data = range.offset == 0 && range.length == object_size
+                  ? client_->get_object(key)
+                  : client_->get_object_range(key, range.offset, range.length);
+  if (data.is_err()) {
+    return make_error<std::monostate>(data.error().code, data.error().message,
+                                      "s3_storage");
+  }
+  auto written = sink(data.value());
+  if (written.is_err()) {
+    return written;
+  }
+  if (callback) {
+    callback(data.value().size(), data.value().size());
+  }
+  return ok();
+}
+
+auto s3_storage::transfer_settings() const -> transfer_options {
+  transfer_options options;
+  options.part_size = config_.part_size;
+  options.max_in_flight = config_.max_concurrent_parts;
+  options.max_retries = config_.max_retries;
+  options.retry_delay = std::chrono::milliseconds(config_.retry_delay_ms);
+  return options;
 }
 
 auto s3_storage::matches_query(const core::dicom_dataset &dataset,
@@ -4,17 +4,130 @@
 
 /**
  * @file storage_interface.cpp
- * @brief Default implementations for storage_interface batch operations
+ * @brief Default implementations for storage_interface batch, file and raw byte operations
  */
 
 #include <kcenon/pacs/storage/storage_interface.h>
 
+#include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/core/frame_index.h>
+#include <kcenon/pacs/encoding/transfer_syntax.h>
+
+#include <algorithm>
+#include <cstring>
+
 namespace kcenon::pacs::storage {
 
 // Use common_system's ok() function
 using kcenon::common::ok;
 using kcenon::common::make_error;
 
+namespace {
+
+/// Error code for transfer syntaxes the backend cannot persist
+constexpr int kUnsupportedTransferSyntax = -15;
+
+/// Error code for a byte range starting past the end of the object
+constexpr int kInvalidRange = -16;
+
+/// Error code for bytes that are not a usable Part 10 file
+constexpr int kNotPart10 = -17;
+
+/// Error code for backends without an atomic replace
+constexpr int kReplaceUnsupported = -18;
+
+constexpr std::size_t kPreambleSize = 128;
+
+/// Chunk size for draining a sequential byte_source
+constexpr std::size_t kReadChunkSize = 1024 * 1024;
+
+}  // namespace
+
+// ============================================================================
+// byte_source
+// ============================================================================
+
+auto byte_source::read_all() -> Result<std::vector<std::uint8_t>> {
+    std::vector<std::uint8_t> data;
+    const auto expected = size();
+    if (expected != byte_range::to_end) {
+        data.reserve(static_cast<std::size_t>(expected));
+    }
+
+    std::size_t filled = 0;
+    for (;;) {
+        if (data.size() - filled < kReadChunkSize) {
+            data.resize(filled + kReadChunkSize);
+        }
+        auto n = read(std::span<std::uint8_t>(data.data() + filled,
+                                              data.size() - filled));
+        if (n.is_err()) {
+            return make_error<std::vector<std::uint8_t>>(
+                n.error().code, n.error().message, "storage_interface");
+        }
+        if (n.value() == 0) {
+            break;
+        }
+        filled += n.value();
+    }
+    data.resize(filled);
+    return data;
+}
+
+memory_byte_source::memory_byte_source(std::vector<std::uint8_t> data,
+                                       byte_range range)
+    : data_(std::move(data)) {
+    const auto resolved =
+        range.resolve(data_.size()).value_or(byte_range{data_.size(), 0});
+    begin_ = static_cast<std::size_t>(resolved.offset);
+    end_ = begin_ + static_cast<std::size_t>(resolved.length);
+    position_ = begin_;
+}
+
+auto memory_byte_source::size() const noexcept -> std::uint64_t {
+    return end_ - begin_;
+}
+
+auto memory_byte_source::read(std::span<std::uint8_t> buffer)
+    -> Result<std::size_t> {
+    const auto n = (std::min)(buffer.size(), end_ - position_);
+    if (n > 0) {
+        std::memcpy(buffer.data(), data_.data() + position_, n);
+        position_ += n;
+    }
+    return n;
+}
+
+auto memory_byte_source::contiguous() const noexcept
+    -> std::span<const std::uint8_t> {
+    return std::span<const std::uint8_t>(data_.data() + begin_, end_ - begin_);
+}
+
+mapped_byte_source::mapped_byte_source(core::memory_mapped_file file,
+                                       byte_range range)
+    : file_(std::move(file)),
+      region_(file_.as_span().subspan(static_cast<std::size_t>(range.offset),
+                                      static_cast<std::size_t>(range.length))) {}
+
+auto mapped_byte_source::size() const noexcept -> std::uint64_t {
+    return region_.size();
+}
+
+auto mapped_byte_source::read(std::span<std::uint8_t> buffer)
+    -> Result<std::size_t> {
+    const auto n = (std::min)(buffer.size(), region_.size() - position_);
+    if (n > 0) {
+        std::memcpy(buffer.data(), region_.data() + position_, n);
+        position_ += n;
+    }
+    return n;
+}
+
+auto mapped_byte_source::contiguous() const noexcept
+    -> std::span<const std::uint8_t> {
+    return region_;
+}
+
 // ============================================================================
 // Default Batch Operation Implementations
 // ============================================================================
@@ -47,4 +160,142 @@ auto storage_interface::retrieve_batch(
     return results;
 }
 
+auto storage_interface::exists_batch(
+    const std::vector<std::string>& sop_instance_uids) const
+    -> std::vector<bool> {
+    std::vector<bool> found;
+    found.reserve(sop_instance_uids.size());
+    for (const auto& uid : sop_instance_uids) {
+        found.push_back(exists(uid));
+    }
+    return found;
+}
+
+// ============================================================================
+// Default Part 10 File Operation Implementations
+// ============================================================================
+
+auto storage_interface::store_file(const core::dicom_file& file) -> VoidResult {
+    if (file.transfer_syntax().is_encapsulated()) {
+        return make_error<std::monostate>(
+            kUnsupportedTransferSyntax,
+            "Backend cannot keep encapsulated transfer syntax " +
+                std::string(file.transfer_syntax().uid()),
+            "storage_interface");
+    }
+    return store(file.dataset());
+}
+
+auto storage_interface::retrieve_file(std::string_view sop_instance_uid)
+    -> Result<core::dicom_file> {
+    auto result = retrieve(sop_instance_uid);
+    if (result.is_err()) {
+        return make_error<core::dicom_file>(
+            result.error().code, result.error().message, "storage_interface");
+    }
+    return core::dicom_file::create(
+        std::move(result.value()),
+        encoding::transfer_syntax::explicit_vr_little_endian);
+}
+
+auto storage_interface::replace_file(const core::dicom_file& file)
+    -> Result<stored_instance> {
+    return make_error<stored_instance>(
+        kReplaceUnsupported,
+        "Backend cannot replace instance " + file.sop_instance_uid() +
+            " atomically",
+        "storage_interface");
+}
+
+// ============================================================================
+// Default Raw Byte Operation Implementations
+// ============================================================================
+
+auto storage_interface::store_stream(byte_source& source)
+    -> Result<stored_instance> {
+    auto data = source.read_all();
+    if (data.is_err()) {
+        return make_error<stored_instance>(
+            data.error().code, data.error().message, "storage_interface");
+    }
+
+    auto identity = identify_part10(data.value());
+    if (identity.is_err()) {
+        return identity;
+    }
+
+    auto file = core::dicom_file::from_bytes(data.value());
+    if (file.is_err()) {
+        return make_error<stored_instance>(
+            kNotPart10, "Failed to parse DICOM data: " + file.error().message,
+            "storage_interface");
+    }
+
+    auto result = store_file(file.value());
+    if (result.is_err()) {
+        return make_error<stored_instance>(
+            result.error().code, result.error().message, "storage_interface");
+    }
+    return identity;
+}
+
+auto storage_interface::open_read(std::string_view sop_instance_uid,
+                                  byte_range range)
+    -> Result<std::unique_ptr<byte_source>> {
+    auto file = retrieve_file(sop_instance_uid);
+    if (file.is_err()) {
+        return make_error<std::unique_ptr<byte_source>>(
+            file.error().code, file.error().message, "storage_interface");
+    }
+
+    auto data = file.value().to_bytes();
+    if (!range.resolve(data.size())) {
+        return make_error<std::unique_ptr<byte_source>>(
+            kInvalidRange, "Byte range starts past the end of the object",
+            "storage_interface");
+    }
+    return std::unique_ptr<byte_source>(
+        std::make_unique<memory_byte_source>(std::move(data), range));
+}
+
+auto storage_interface::identify_part10(std::span<const std::uint8_t> data)
+    -> Result<stored_instance> {
+    if (data.size() < kPreambleSize + 4 ||
+        std::memcmp(data.data() + kPreambleSize, "DICM", 4) != 0) {
+        return make_error<stored_instance>(
+            kNotPart10, "Data is not a DICOM Part 10 file", "storage_interface");
+    }
+
+    // Decode only the attributes in front of Pixel Data when it can be found
+    auto header = data;
+    auto location = core::frame_index::locate_pixel_data(data);
+    if (location.is_ok()) {
+        header = data.first(static_cast<std::size_t>(location.value().element_offset));
+    }
+
+    auto file = core::dicom_file::from_bytes(header);
+    if (file.is_err()) {
+        return make_error<stored_instance>(
+            kNotPart10, "Failed to parse DICOM header: " + file.error().message,
+            "storage_interface");
+    }
+
+    const auto& dataset = file.value().dataset();
+    stored_instance identity;
+    identity.sop_instance_uid = dataset.get_string(core::tags::sop_instance_uid);
+    identity.study_instance_uid = dataset.get_string(core::tags::study_instance_uid);
+    identity.series_instance_uid = dataset.get_string(core::tags::series_instance_uid);
+    identity.study_date = dataset.get_string(core::tags::study_date);
+    identity.transfer_syntax_uid = std::string(file.value().transfer_syntax().uid());
+    identity.size_bytes = data.size();
+
+    if (identity.sop_instance_uid.empty() || identity.study_instance_uid.empty() ||
+        identity.series_instance_uid.empty()) {
+        return make_error<stored_instance>(
+            kNotPart10, "Missing required UID (Study, Series, or SOP Instance UID)",
+            "storage_interface");
+    }
+    return identity;
+}
+
 }  // namespace kcenon::pacs::storage
@@ -0,0 +1,143 @@
+// BSD 3-Clause License
+// Copyright (c) 2021-2025, 🍀☀🌕🌥 🌊
+// See the LICENSE file in the project root for full license information.
+
+/**
+ * @file study_digest.cpp
+ * @brief Implementation of the study digest tree helpers
+ */
+
+#include <kcenon/pacs/storage/study_digest.h>
+
+#include <kcenon/pacs/storage/content_hash.h>
+
+#include <algorithm>
+#include <cctype>
+
+namespace kcenon::pacs::storage {
+
+namespace {
+
+auto all_digits(std::string_view text) noexcept -> bool {
+    return std::all_of(text.begin(), text.end(), [](char c) {
+        return std::isdigit(static_cast<unsigned char>(c)) != 0;
+    });
+}
+
+auto trim(std::string_view text) noexcept -> std::string_view {
+    while (!text.empty() && text.front() == ' ') {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && text.back() == ' ') {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+}  // namespace
+
+auto study_digest_leaf(std::string_view study_uid,
+                       std::size_t instance_count) noexcept -> std::uint64_t {
+    content_hasher hasher;
+    hasher.update(std::span<const std::uint8_t>(
+        reinterpret_cast<const std::uint8_t*>(study_uid.data()), study_uid.size()));
+
+    // Fixed-width little-endian count after a separator byte
+    std::uint8_t count[9] = {0};
+    auto value = static_cast<std::uint64_t>(instance_count);
+    for (std::size_t i = 1; i < sizeof(count); ++i) {
+        count[i] = static_cast<std::uint8_t>(value & 0xFF);
+        value >>= 8;
+    }
+    hasher.update(std::span<const std::uint8_t>(count, sizeof(count)));
+    return hasher.digest();
+}
+
+auto normalize_study_modalities(std::string_view modalities_in_study)
+    -> std::string {
+    std::vector<std::string> modalities;
+    std::size_t start = 0;
+    while (start <= modalities_in_study.size()) {
+        auto end = modalities_in_study.find('\\', start);
+        if (end == std::string_view::npos) {
+            end = modalities_in_study.size();
+        }
+        auto value = trim(modalities_in_study.substr(start, end - start));
+        if (!value.empty()) {
+            modalities.emplace_back(value);
+        }
+        start = end + 1;
+    }
+
+    std::sort(modalities.begin(), modalities.end());
+    modalities.erase(std::unique(modalities.begin(), modalities.end()),
+                     modalities.end());
+
+    std::string normalized;
+    for (const auto& modality : modalities) {
+        if (!normalized.empty()) {
+            normalized += '\\';
+        }
+        normalized += modality;
+    }
+    return normalized;
+}
+
+auto study_digest_bucket_key(std::string_view study_date,
+                             std::string_view modalities) -> std::string {
+    std::string key(study_date);
+    key += '/';
+    key += modalities;
+    return key;
+}
+
+auto is_study_digest_bucket(std::string_view key) noexcept -> bool {
+    return key.size() > 8 && key[8] == '/' && all_digits(key.substr(0, 8));
+}
+
+auto is_valid_study_digest_key(std::string_view key) noexcept -> bool {
+    if (key.empty()) {
+        return true;
+    }
+    if (key.size() == 6 || key.size() == 8) {
+        return all_digits(key);
+    }
+    return is_study_digest_bucket(key);
+}
+
+auto combine_study_digests(std::string key,
+                           const std::vector<study_digest_node>& children)
+    -> study_digest_node {
+    study_digest_node parent;
+    parent.key = std::move(key);
+    for (const auto& child : children) {
+        parent.combine(child);
+    }
+    return parent;
+}
+
+auto diff_study_digests(const std::vector<study_digest_node>& local,
+                        const std::vector<study_digest_node>& remote)
+    -> std::vector<std::string> {
+    std::vector<std::string> differing;
+    auto l = local.begin();
+    auto r = remote.begin();
+    while (l != local.end() || r != remote.end()) {
+        if (r == remote.end() || (l != local.end() && l->key < r->key)) {
+            differing.push_back(l->key);
+            ++l;
+        } else if (l == local.end() || r->key < l->key) {
+            differing.push_back(r->key);
+            ++r;
+        } else {
+            if (!l->matches(*r)) {
+                differing.push_back(l->key);
+            }
+            ++l;
+            ++r;
+        }
+    }
+    return differing;
+}
+
+}  // namespace kcenon::pacs::storage
@@ -28,6 +28,23 @@ namespace kcenon::pacs::storage {
 using kcenon::common::make_error;
 using kcenon::common::ok;
 
+namespace {
+
+/// Escape a value for use inside a single-quoted SQL string literal
+auto escape_sql(std::string_view value) -> std::string {
+    std::string result;
+    result.reserve(value.size());
+    for (char c : value) {
+        if (c == '\'') {
+            result += '\'';
+        }
+        result += c;
+    }
+    return result;
+}
+
+}  // namespace
+
 // =============================================================================
 // Constructor
 // =============================================================================
@@ -107,6 +124,29 @@ auto study_repository::to_like_pattern(std::string_view pattern)
     return result;
 }
 
+auto study_repository::has_trigram_run(std::string_view pattern) -> bool {
+    // The trigram index narrows a LIKE only through runs of at least three
+    // literal characters; shorter patterns would scan the whole index
+    std::size_t run = 0;
+    for (char c : pattern) {
+        run = (c == '*' || c == '?') ? 0 : run + 1;
+        if (run >= 3) {
+            return true;
+        }
+    }
+    return false;
+}
+
+auto study_repository::has_trigram_index() -> bool {
+    if (!trigram_index_.has_value()) {
+        auto result = db()->select(
+            "SELECT name FROM sqlite_master WHERE type = 'table' "
+            "AND name = 'patients_name_fts';");
+        trigram_index_ = result.is_ok() && !result.value().empty();
+    }
+    return *trigram_index_;
+}
+
 // =============================================================================
 // Domain-Specific Operations
 // =============================================================================
@@ -286,96 +326,109 @@ auto study_repository::search_studies(const study_query& query)
             -1, "Database not connected", "storage");
     }
 
-    // Build SQL query with JOIN if patient filters are present
-    std::string sql;
+    std::string sql = R"(
+        SELECT s.study_pk, s.patient_pk, s.study_uid, s.study_id, s.study_date,
+               s.study_time, s.accession_number, s.referring_physician,
+               s.study_description, s.modalities_in_study, s.num_series,
+               s.num_instances, s.created_at, s.updated_at
+        FROM studies s
+    )";
     std::vector<std::string> where_clauses;
 
-    if (query.patient_id.has_value() || query.patient_name.has_value()) {
-        sql = R"(
-            SELECT s.study_pk, s.patient_pk, s.study_uid, s.study_id, s.study_date,
-                   s.study_time, s.accession_number, s.referring_physician,
-                   s.study_description, s.modalities_in_study, s.num_series,
-                   s.num_instances, s.created_at, s.updated_at
-            FROM studies s
-            JOIN patients p ON s.patient_pk = p.patient_pk
-        )";
-
-        if (query.patient_id.has_value()) {
-            where_clauses.push_back(
-                kcenon::pacs::compat::format("p.patient_id LIKE '{}'",
-                                   to_like_pattern(*query.patient_id)));
-        }
+    const bool trigram = (query.patient_name.has_value() ||
+                          query.study_description.has_value()) &&
+                         has_trigram_index();
+    const bool name_by_trigram =
+        trigram && query.patient_name.has_value() &&
+        has_trigram_run(*query.patient_name);
 
-        if (query.patient_name.has_value()) {
-            where_clauses.push_back(
-                kcenon::pacs::compat::format("p.patient_name LIKE '{}'",
-                                   to_like_pattern(*query.patient_name)));
-        }
-    } else {
-        sql = R"(
-            SELECT study_pk, patient_pk, study_uid, study_id, study_date,
-                   study_time, accession_number, referring_physician,
-                   study_description, modalities_in_study, num_series,
-                   num_instances, created_at, updated_at
-            FROM studies
-        )";
+    // Patient filters that cannot use the name index need the patients row
+    if (query.patient_id.has_value() ||
+        (query.patient_name.has_value() && !name_by_trigram)) {
+        sql += " JOIN patients p ON s.patient_pk = p.patient_pk";
     }
 
-    // Add study-specific filters
-    std::string prefix = (query.patient_id.has_value() || query.patient_name.has_value()) ? "s." : "";
+    if (query.patient_id.has_value()) {
+        where_clauses.push_back(kcenon::pacs::compat::format(
+            "p.patient_id LIKE '{}'",
+            escape_sql(to_like_pattern(*query.patient_id))));
+    }
 
-    if (query.study_uid.has_value()) {
+    if (query.patient_name.has_value()) {
+        const auto pattern = escape_sql(to_like_pattern(*query.patient_name));
         where_clauses.push_back(
-            kcenon::pacs::compat::format("{}study_uid = '{}'", prefix, *query.study_uid));
+            name_by_trigram
+                ? kcenon::pacs::compat::format(
+                      "s.patient_pk IN (SELECT rowid FROM patients_name_fts "
+                      "WHERE patient_name LIKE '{}')",
+                      pattern)
+                : kcenon::pacs::compat::format("p.patient_name LIKE '{}'",
+                                               pattern));
+    }
+
+    if (query.study_uid.has_value()) {
+        where_clauses.push_back(kcenon::pacs::compat::format(
+            "s.study_uid = '{}'", escape_sql(*query.study_uid)));
     }
 
     if (query.study_id.has_value()) {
-        where_clauses.push_back(
-            kcenon::pacs::compat::format("{}study_id LIKE '{}'", prefix,
-                               to_like_pattern(*query.study_id)));
+        where_clauses.push_back(kcenon::pacs::compat::format(
+            "s.study_id LIKE '{}'", escape_sql(to_like_pattern(*query.study_id))));
     }
 
     if (query.study_date.has_value()) {
-        where_clauses.push_back(
-            kcenon::pacs::compat::format("{}study_date = '{}'", prefix, *query.study_date));
+        where_clauses.push_back(kcenon::pacs::compat::format(
+            "s.study_date = '{}'", escape_sql(*query.study_date)));
     }
 
     if (query.study_date_from.has_value()) {
-        where_clauses.push_back(
-            kcenon::pacs::compat::format("{}study_date >= '{}'", prefix, *query.study_date_from));
+        where_clauses.push_back(kcenon::pacs::compat::format(
+            "s.study_date >= '{}'", escape_sql(*query.study_date_from)));
     }
 
     if (query.study_date_to.has_value()) {
-        where_clauses.push_back(
-            kcenon::pacs::compat::format("{}study_date <= '{}'", prefix, *query.study_date_to));
+        where_clauses.push_back(kcenon::pacs::compat::format(
+            "s.study_date <= '{}'", escape_sql(*query.study_date_to)));
     }
 
     if (query.accession_number.has_value()) {
-        where_clauses.push_back(
-            kcenon::pacs::compat::format("{}accession_number LIKE '{}'", prefix,
-                               to_like_pattern(*query.accession_number)));
+        where_clauses.push_back(kcenon::pacs::compat::format(
+            "s.accession_number LIKE '{}'",
+            escape_sql(to_like_pattern(*query.accession_number))));
     }
 
     if (query.referring_physician.has_value()) {
-        where_clauses.push_back(
-            kcenon::pacs::compat::format("{}referring_physician LIKE '{}'", prefix,
-                               to_like_pattern(*query.referring_physician)));
+        where_clauses.push_back(kcenon::pacs::compat::format(
+            "s.referring_physician LIKE '{}'",
+            escape_sql(to_like_pattern(*query.referring_physician))));
     }
 
     if (query.study_description.has_value()) {
+        const auto pattern =
+            escape_sql(to_like_pattern(*query.study_description));
         where_clauses.push_back(
-            kcenon::pacs::compat::format("{}study_description LIKE '{}'", prefix,
-                               to_like_pattern(*query.study_description)));
+            trigram && has_trigram_run(*query.study_description)
+                ? kcenon::pacs::compat::format(
+                      "s.study_pk IN (SELECT rowid FROM studies_description_fts "
+                      "WHERE study_description LIKE '{}')",
+                      pattern)
+                : kcenon::pacs::compat::format("s.study_description LIKE '{}'",
+                                               pattern));
     }
 
     if (query.modality.has_value()) {
-        const auto& mod = *query.modality;
         where_clauses.push_back(kcenon::pacs::compat::format(
-            "({}modalities_in_study = '{}' OR "
-            "{}modalities_in_study LIKE '{}\\%' OR "
-            "{}modalities_in_study LIKE '%\\{}' OR "
-            "{}modalities_in_study LIKE '%\\{}\\%')",
-            prefix, mod, prefix, mod, prefix, mod, prefix, mod));
+            "s.study_pk IN (SELECT study_pk FROM study_modalities "
+            "WHERE modality = '{}')",
+            escape_sql(*query.modality)));
+    }
+
+    if (query.after.has_value()) {
+        where_clauses.push_back(kcenon::pacs::compat::format(
+            "(COALESCE(s.study_date, ''), COALESCE(s.study_time, ''), s.study_pk) "
+            "< ('{}', '{}', {})",
+            escape_sql(query.after->study_date),
+            escape_sql(query.after->study_time), query.after->study_pk));
     }
 
     // Build WHERE clause
@@ -386,15 +439,20 @@ auto study_repository::search_studies(const study_query& query)
         }
     }
 
-    // Add ORDER BY
-    sql += kcenon::pacs::compat::format(" ORDER BY {}study_date DESC, {}study_time DESC",
-                               prefix, prefix);
+    // The primary key makes the order total, which keyset paging relies on.
+    // Missing dates and times sort as '' (the page key's value for them);
+    // a NULL would fail the keyset comparison and drop those studies.
+    sql += " ORDER BY COALESCE(s.study_date, '') DESC, COALESCE(s.study_time, '') DESC,"
+           " s.study_pk DESC";
 
     if (query.limit > 0) {
         sql += kcenon::pacs::compat::format(" LIMIT {}", query.limit);
     }
 
-    if (query.offset > 0) {
+    if (query.offset > 0 && !query.after.has_value()) {
+        if (query.limit == 0) {
+            sql += " LIMIT -1";
+        }
         sql += kcenon::pacs::compat::format(" OFFSET {}", query.offset);
     }
 
@@ -717,6 +775,35 @@ auto study_repository::to_like_pattern(std::string_view pattern)
     return result;
 }
 
+auto study_repository::has_trigram_run(std::string_view pattern) -> bool {
+    // The trigram index narrows a LIKE only through runs of at least three
+    // literal characters; shorter patterns would scan the whole index
+    std::size_t run = 0;
+    for (char c : pattern) {
+        run = (c == '*' || c == '?') ? 0 : run + 1;
+        if (run >= 3) {
+            return true;
+        }
+    }
+    return false;
+}
+
+auto study_repository::has_trigram_index() const -> bool {
+    if (!trigram_index_.has_value()) {
+        const char* sql =
+            "SELECT 1 FROM sqlite_master WHERE type = 'table' "
+            "AND name = 'patients_name_fts';";
+        sqlite3_stmt* stmt = nullptr;
+        bool found = false;
+        if (sqlite3_prepare_v2(db_, sql, -1, &stmt, nullptr) == SQLITE_OK) {
+            found = sqlite3_step(stmt) == SQLITE_ROW;
+        }
+        sqlite3_finalize(stmt);
+        trigram_index_ = found;
+    }
+    return *trigram_index_;
+}
+
 auto study_repository::parse_study_row(void* stmt_ptr) const -> study_record {
     auto* stmt = static_cast<sqlite3_stmt*>(stmt_ptr);
     study_record record;
@@ -915,13 +1002,22 @@ auto study_repository::search_studies(const study_query& query) const
 
     std::vector<std::string> params;
 
+    const bool trigram = (query.patient_name.has_value() ||
+                          query.study_description.has_value()) &&
+                         has_trigram_index();
+
     if (query.patient_id.has_value()) {
         sql += " AND p.patient_id LIKE ?";
         params.push_back(to_like_pattern(*query.patient_id));
     }
 
     if (query.patient_name.has_value()) {
-        sql += " AND p.patient_name LIKE ?";
+        if (trigram && has_trigram_run(*query.patient_name)) {
+            sql += " AND p.patient_pk IN (SELECT rowid FROM patients_name_fts "
+                   "WHERE patient_name LIKE ?)";
+        } else {
+            sql += " AND p.patient_name LIKE ?";
+        }
         params.push_back(to_like_pattern(*query.patient_name));
     }
 
@@ -956,14 +1052,9 @@ auto study_repository::search_studies(const study_query& query) const
     }
 
     if (query.modality.has_value()) {
-        sql += " AND (s.modalities_in_study = ? OR "
-               "s.modalities_in_study LIKE ? OR "
-               "s.modalities_in_study LIKE ? OR "
-               "s.modalities_in_study LIKE ?)";
+        sql += " AND s.study_pk IN (SELECT study_pk FROM study_modalities "
+               "WHERE modality = ?)";
         params.push_back(*query.modality);
-        params.push_back(*query.modality + "\\%");
-        params.push_back("%\\" + *query.modality);
-        params.push_back("%\\" + *query.modality + "\\%");
     }
 
     if (query.referring_physician.has_value()) {
@@ -972,17 +1063,38 @@ auto study_repository::search_studies(const study_query& query) const
     }
 
     if (query.study_description.has_value()) {
-        sql += " AND s.study_description LIKE ?";
+        if (trigram && has_trigram_run(*query.study_description)) {
+            sql += " AND s.study_pk IN (SELECT rowid FROM studies_description_fts "
+                   "WHERE study_description LIKE ?)";
+        } else {
+            sql += " AND s.study_description LIKE ?";
+        }
         params.push_back(to_like_pattern(*query.study_description));
     }
 
-    sql += " ORDER BY s.study_date DESC, s.study_time DESC";
+    if (query.after.has_value()) {
+        sql += kcenon::pacs::compat::format(
+            " AND (COALESCE(s.study_date, ''), COALESCE(s.study_time, ''), "
+            "s.study_pk) < (?, ?, {})",
+            query.after->study_pk);
+        params.push_back(query.after->study_date);
+        params.push_back(query.after->study_time);
+    }
+
+    // The primary key makes the order total, which keyset paging relies on.
+    // Missing dates and times sort as '' (the page key's value for them);
+    // a NULL would fail the keyset comparison and drop those studies.
+    sql += " ORDER BY COALESCE(s.study_date, '') DESC, COALESCE(s.study_time, '') DESC,"
+           " s.study_pk DESC";
 
     if (query.limit > 0) {
         sql += kcenon::pacs::compat::format(" LIMIT {}", query.limit);
     }
 
-    if (query.offset > 0) {
+    if (query.offset > 0 && !query.after.has_value()) {
+        if (query.limit == 0) {
+            sql += " LIMIT -1";
+        }
         sql += kcenon::pacs::compat::format(" OFFSET {}", query.offset);
     }
 
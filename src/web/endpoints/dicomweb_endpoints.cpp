@@ -24,10 +24,14 @@
 #include "kcenon/pacs/core/dicom_element.h"
 #include "kcenon/pacs/core/dicom_file.h"
 #include "kcenon/pacs/core/dicom_tag_constants.h"
+#include "kcenon/pacs/core/frame_index.h"
+#include "kcenon/pacs/core/memory_mapped_file.h"
 #include "kcenon/pacs/encoding/compression/htj2k_codec.h"
 #include "kcenon/pacs/encoding/compression/jpeg_baseline_codec.h"
 #include "kcenon/pacs/encoding/transfer_syntax.h"
 #include "kcenon/pacs/encoding/vr_type.h"
+#include "kcenon/pacs/services/transcoding/transcoding_service.h"
+#include "kcenon/pacs/storage/content_hash.h"
 #include "kcenon/pacs/storage/file_storage.h"
 #include "kcenon/pacs/storage/index_database.h"
 #include "kcenon/pacs/storage/instance_record.h"
@@ -46,6 +50,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <optional>
 #include <random>
 #include <sstream>
 
@@ -181,6 +186,21 @@ auto parse_accept_header(std::string_view accept_header)
     return result;
 }
 
+auto requested_transfer_syntax(const std::vector<accept_info>& accept_infos)
+    -> std::string {
+    for (const auto& info : accept_infos) {
+        if (info.media_type != media_type::dicom &&
+            info.media_type != "*/*") {
+            continue;
+        }
+        if (info.transfer_syntax.empty() || info.transfer_syntax == "*") {
+            return {};
+        }
+        return info.transfer_syntax;
+    }
+    return {};
+}
+
 auto is_acceptable(const std::vector<accept_info>& accept_infos,
                    std::string_view media_type) -> bool {
     if (accept_infos.empty()) {
@@ -1566,13 +1586,59 @@ std::vector<uint8_t> read_file_bytes(const std::filesystem::path& path) {
     return buffer;
 }
 
+/**
+ * @brief Read a stored instance in the requested transfer syntax
+ *
+ * Returns the stored bytes untouched when no specific syntax was requested
+ * or it already matches; otherwise converts via the configured transcoder.
+ *
+ * @return Part 10 bytes, or std::nullopt if the requested syntax cannot
+ *         be produced
+ */
+std::optional<std::vector<uint8_t>> read_instance_bytes(
+    const std::filesystem::path& path,
+    const rest_server_context& ctx,
+    std::string_view transfer_syntax_uid) {
+    auto data = read_file_bytes(path);
+    if (data.empty() || transfer_syntax_uid.empty()) {
+        return data;
+    }
+
+    auto file = core::dicom_file::from_bytes(
+        std::span<const uint8_t>(data.data(), data.size()));
+    if (file.is_err()) {
+        return data;
+    }
+    if (file.value().transfer_syntax().uid() == transfer_syntax_uid) {
+        return data;
+    }
+
+    auto target = encoding::find_transfer_syntax(transfer_syntax_uid);
+    if (!target || !ctx.transcoder) {
+        return std::nullopt;
+    }
+
+    // The digest of the stored bytes keys the transcode cache, so a
+    // re-stored or recompressed instance is never served a stale encoding
+    storage::content_hasher hasher;
+    hasher.update(std::span<const uint8_t>(data.data(), data.size()));
+
+    auto converted = ctx.transcoder->transcode_to_bytes(file.value(), *target,
+                                                        hasher.hex_digest());
+    if (converted.is_err()) {
+        return std::nullopt;
+    }
+    return std::move(converted.value());
+}
+
 /**
  * @brief Build retrieval response for multiple DICOM files
  */
 crow::response build_multipart_dicom_response(
     const std::vector<std::string>& file_paths,
     const rest_server_context& ctx,
-    std::string_view base_uri = "") {
+    std::string_view base_uri = "",
+    std::string_view transfer_syntax_uid = "") {
 
     crow::response res;
     add_cors_headers(res, ctx);
@@ -1586,7 +1652,15 @@ crow::response build_multipart_dicom_response(
 
     // Single file - return directly
     if (file_paths.size() == 1) {
-        auto data = read_file_bytes(file_paths[0]);
+        auto instance = read_instance_bytes(file_paths[0], ctx, transfer_syntax_uid);
+        if (!instance) {
+            res.code = 406;
+            res.add_header("Content-Type", "application/json");
+            res.body = make_error_json("NOT_ACCEPTABLE",
+                                       "Requested transfer syntax is not available");
+            return res;
+        }
+        auto& data = *instance;
         if (data.empty()) {
             res.code = 500;
             res.add_header("Content-Type", "application/json");
@@ -1604,10 +1678,11 @@ crow::response build_multipart_dicom_response(
     dicomweb::multipart_builder builder(dicomweb::media_type::dicom);
 
     for (size_t i = 0; i < file_paths.size(); ++i) {
-        auto data = read_file_bytes(file_paths[i]);
-        if (data.empty()) {
-            continue; // Skip files that can't be read
+        auto instance = read_instance_bytes(file_paths[i], ctx, transfer_syntax_uid);
+        if (!instance || instance->empty()) {
+            continue; // Skip files that can't be read or converted
         }
+        auto& data = *instance;
 
         if (base_uri.empty()) {
             builder.add_part(std::move(data));
@@ -1773,9 +1848,17 @@ bool store_instance_to_storage(
     auto instance_number = dataset.get_numeric<int>(
         core::tags::instance_number);
 
-    auto instance_pk_result = ctx->database->upsert_instance(
-        series_pk_result.value(), sop_uid, sop_class_uid,
-        file_path.string(), file_size, transfer_syntax, instance_number);
+    storage::instance_record instance;
+    instance.series_pk = series_pk_result.value();
+    instance.sop_uid = sop_uid;
+    instance.sop_class_uid = sop_class_uid;
+    instance.file_path = file_path.string();
+    instance.file_size = file_size;
+    instance.transfer_syntax = transfer_syntax;
+    instance.instance_number = instance_number;
+    instance.file_hash = ctx->file_storage->get_file_hash(sop_uid);
+
+    auto instance_pk_result = ctx->database->upsert_instance(instance);
     if (!instance_pk_result.is_ok()) {
         (void)ctx->file_storage->remove(sop_uid);
         result.success = false;
@@ -1846,7 +1929,9 @@ void register_dicomweb_endpoints_impl(crow::SimpleApp& app,
                     return res;
                 }
                 std::string base_uri = "/dicomweb/studies/" + study_uid;
-                return build_multipart_dicom_response(files_result.value(), *ctx, base_uri);
+                return build_multipart_dicom_response(
+                    files_result.value(), *ctx, base_uri,
+                    dicomweb::requested_transfer_syntax(accept_infos));
             });
 
     // GET /dicomweb/studies/{studyUID}/metadata - Study metadata
@@ -1943,7 +2028,9 @@ void register_dicomweb_endpoints_impl(crow::SimpleApp& app,
                 }
                 std::string base_uri = "/dicomweb/studies/" + study_uid +
                                        "/series/" + series_uid;
-                return build_multipart_dicom_response(files_result.value(), *ctx, base_uri);
+                return build_multipart_dicom_response(
+                    files_result.value(), *ctx, base_uri,
+                    dicomweb::requested_transfer_syntax(accept_infos));
             });
 
     // GET /dicomweb/studies/{studyUID}/series/{seriesUID}/metadata
@@ -2030,7 +2117,18 @@ void register_dicomweb_endpoints_impl(crow::SimpleApp& app,
                 }
 
                 // Return DICOM instance
-                auto data = read_file_bytes(*file_path);
+                auto instance = read_instance_bytes(
+                    *file_path, *ctx,
+                    dicomweb::requested_transfer_syntax(accept_infos));
+                if (!instance) {
+                    res.code = 406;
+                    res.add_header("Content-Type", "application/json");
+                    res.body = make_error_json(
+                        "NOT_ACCEPTABLE",
+                        "Requested transfer syntax is not available");
+                    return res;
+                }
+                auto& data = *instance;
                 if (data.empty()) {
                     res.code = 500;
                     res.add_header("Content-Type", "application/json");
@@ -2139,88 +2237,60 @@ void register_dicomweb_endpoints_impl(crow::SimpleApp& app,
                     return res;
                 }
 
-                // Load DICOM file
-                auto data = read_file_bytes(*file_path);
-                if (data.empty()) {
-                    res.code = 500;
+                // Locate frames through the frame index so only the
+                // requested byte ranges are read from the file
+                auto index_result = core::frame_index::load_or_build(*file_path);
+                if (index_result.is_err()) {
+                    const bool no_pixels = index_result.error().code ==
+                                           kcenon::pacs::error_codes::element_not_found;
+                    res.code = no_pixels ? 400 : 500;
                     res.add_header("Content-Type", "application/json");
-                    res.body = make_error_json("READ_ERROR",
-                                               "Failed to read DICOM file");
+                    res.body = no_pixels
+                        ? make_error_json("NOT_IMAGE",
+                                          "Instance does not contain image data")
+                        : make_error_json("PARSE_ERROR",
+                                          index_result.error().message);
                     return res;
                 }
+                const auto& index = index_result.value();
 
-                auto dicom_result = core::dicom_file::from_bytes(
-                    std::span<const uint8_t>(data.data(), data.size()));
-                if (dicom_result.is_err()) {
+                auto mapped = core::memory_mapped_file::open(*file_path);
+                if (mapped.is_err()) {
                     res.code = 500;
                     res.add_header("Content-Type", "application/json");
-                    res.body = make_error_json("PARSE_ERROR",
-                                               "Failed to parse DICOM file");
-                    return res;
-                }
-
-                const auto& dataset = dicom_result.value().dataset();
-
-                // Get image parameters
-                auto rows_elem = dataset.get(core::tags::rows);
-                auto cols_elem = dataset.get(core::tags::columns);
-                auto bits_alloc_elem = dataset.get(core::tags::bits_allocated);
-                auto samples_elem = dataset.get(core::tags::samples_per_pixel);
-                // Number of Frames (0028,0008)
-                constexpr core::dicom_tag number_of_frames_tag{0x0028, 0x0008};
-                auto num_frames_elem = dataset.get(number_of_frames_tag);
-                auto pixel_data_elem = dataset.get(core::tags::pixel_data);
-
-                if (!rows_elem || !cols_elem || !pixel_data_elem) {
-                    res.code = 400;
-                    res.add_header("Content-Type", "application/json");
-                    res.body = make_error_json("NOT_IMAGE",
-                                               "Instance does not contain image data");
+                    res.body = make_error_json("READ_ERROR",
+                                               "Failed to read DICOM file");
                     return res;
                 }
 
-                uint16_t rows = rows_elem->as_numeric<uint16_t>().unwrap_or(0);
-                uint16_t cols = cols_elem->as_numeric<uint16_t>().unwrap_or(0);
-                uint16_t bits_allocated = bits_alloc_elem ?
-                    bits_alloc_elem->as_numeric<uint16_t>().unwrap_or(16) : 16;
-                uint16_t samples_per_pixel = samples_elem ?
-                    samples_elem->as_numeric<uint16_t>().unwrap_or(1) : 1;
-                uint32_t num_frames = 1;
-                if (num_frames_elem) {
-                    try {
-                        num_frames = std::stoul(num_frames_elem->as_string().unwrap_or("1"));
-                    } catch (...) {}
-                }
-
-                // Calculate frame size
-                size_t frame_size = static_cast<size_t>(rows) * cols *
-                                    samples_per_pixel * ((bits_allocated + 7) / 8);
-
-                auto pixel_data = pixel_data_elem->raw_data();
-
                 // Check Accept header
                 auto accept = req.get_header_value("Accept");
 
                 // Build multipart response for multiple frames
                 dicomweb::multipart_builder builder(
                     dicomweb::media_type::octet_stream);
+                std::vector<uint8_t> first_frame;
 
                 for (uint32_t frame_num : frames) {
-                    if (frame_num > num_frames) {
+                    if (frame_num > index.frame_count()) {
                         // Skip invalid frame numbers
                         continue;
                     }
 
-                    auto frame_data = dicomweb::extract_frame(
-                        pixel_data, frame_num, frame_size);
+                    auto frame_data = index.read_frame(mapped.value(), frame_num);
+                    if (frame_data.is_err() || frame_data.value().empty()) {
+                        continue;
+                    }
 
-                    if (!frame_data.empty()) {
-                        std::string location = "/dicomweb/studies/" + study_uid +
-                                               "/series/" + series_uid +
-                                               "/instances/" + sop_uid +
-                                               "/frames/" + std::to_string(frame_num);
-                        builder.add_part_with_location(std::move(frame_data), location);
+                    if (builder.empty()) {
+                        first_frame = frame_data.value();
                     }
+                    std::string location = "/dicomweb/studies/" + study_uid +
+                                           "/series/" + series_uid +
+                                           "/instances/" + sop_uid +
+                                           "/frames/" + std::to_string(frame_num);
+                    builder.add_part_with_location(std::move(frame_data.value()),
+                                                   location);
                 }
 
                 if (builder.empty()) {
@@ -2234,16 +2304,12 @@ void register_dicomweb_endpoints_impl(crow::SimpleApp& app,
                 // Return single part or multipart
                 if (builder.size() == 1) {
                     // Single frame - return directly
-                    auto body = builder.build();
                     res.code = 200;
                     res.add_header("Content-Type",
                                    std::string(dicomweb::media_type::octet_stream));
-                    // Extract just the data part from multipart
-                    auto frame_data = dicomweb::extract_frame(
-                        pixel_data, frames[0], frame_size);
                     res.body = std::string(
-                        reinterpret_cast<char*>(frame_data.data()),
-                        frame_data.size());
+                        reinterpret_cast<char*>(first_frame.data()),
+                        first_frame.size());
                 } else {
                     // Multiple frames - return multipart
                     res.code = 200;
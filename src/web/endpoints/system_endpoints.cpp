@@ -24,8 +24,10 @@
 #include "kcenon/pacs/monitoring/health_checker.h"
 #include "kcenon/pacs/monitoring/health_json.h"
 #include "kcenon/pacs/monitoring/pacs_metrics.h"
+#include "kcenon/pacs/monitoring/request_tracer.h"
 #endif
 
+#include <cstdlib>
 #include <sstream>
 
 namespace kcenon::pacs::web::endpoints {
@@ -168,6 +170,61 @@ void register_system_endpoints_impl(crow::SimpleApp &app,
     return res;
   });
 
+  // GET /api/v1/system/traces - Sampled request trace spans
+  // Query: format=otlp|chrome (default otlp), trace_id=<hex> (optional)
+  CROW_ROUTE(app, "/api/v1/system/traces")
+      .methods(crow::HTTPMethod::GET)([ctx](const crow::request &req) {
+        crow::response res;
+        res.add_header("Content-Type", "application/json");
+        add_cors_headers(res, *ctx);
+
+        if (!check_permission(ctx, req, res, security::ResourceType::System,
+                              security::Action::Read)) {
+          return res;
+        }
+
+#ifdef PACS_WITH_MONITORING
+        const char *format_param = req.url_params.get("format");
+        const std::string format = format_param ? format_param : "otlp";
+        if (format != "otlp" && format != "chrome") {
+          res.code = 400;
+          res.body = make_error_json("INVALID_FORMAT",
+                                     "format must be 'otlp' or 'chrome'");
+          return res;
+        }
+
+        auto &tracer = monitoring::request_tracer::global();
+        std::vector<monitoring::span_record> spans;
+        if (const char *trace_param = req.url_params.get("trace_id")) {
+          char *end = nullptr;
+          const auto trace_id = std::strtoull(trace_param, &end, 16);
+          if (trace_id == 0 || end == trace_param || *end != '\0') {
+            res.code = 400;
+            res.body = make_error_json("INVALID_TRACE_ID",
+                                       "trace_id must be a non-zero hex id");
+            return res;
+          }
+          spans = tracer.spans(trace_id);
+        } else {
+          spans = tracer.spans();
+        }
+
+        if (format == "chrome") {
+          res.add_header("Content-Disposition",
+                         "attachment; filename=\"pacs_trace.json\"");
+          res.body = tracer.to_chrome_trace(spans);
+        } else {
+          res.body = tracer.to_otlp_json(spans);
+        }
+        res.code = 200;
+#else
+        res.body = make_error_json("TRACING_UNAVAILABLE",
+                                   "Monitoring module not available");
+        res.code = 503;
+#endif
+        return res;
+      });
+
   // GET /api/v1/system/config - Current configuration
   CROW_ROUTE(app, "/api/v1/system/config")
       .methods(crow::HTTPMethod::GET)([ctx]() {
@@ -197,6 +197,12 @@ void rest_server::set_oauth2_middleware(
   impl_->context->oauth2 = std::move(middleware);
 }
 
+void rest_server::set_transcoder(
+    std::shared_ptr<services::transcoding_service> transcoder) {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  impl_->context->transcoder = std::move(transcoder);
+}
+
 void rest_server::start() {
   if (impl_->running.exchange(true)) {
     return; // Already running
@@ -20,12 +20,62 @@
 #include <kcenon/common/interfaces/executor_interface.h>
 
 #include <algorithm>
+#include <cctype>
 #include <chrono>
+#include <ctime>
 #include <ranges>
 #include <sstream>
 
 namespace kcenon::pacs::workflow {
 
+namespace {
+
+/**
+ * @brief Parse a Scheduled Procedure Step Start Date/Time
+ *
+ * Accepts YYYYMMDD[HH[MM[SS]]] with optional fraction or offset, read as
+ * local time.
+ *
+ * @return The time point, or epoch if the value cannot be parsed
+ */
+auto parse_scheduled_datetime(const std::string& value)
+    -> std::chrono::system_clock::time_point {
+    std::string digits;
+    for (char c : value) {
+        if (!std::isdigit(static_cast<unsigned char>(c)) || digits.size() == 14) {
+            break;
+        }
+        digits.push_back(c);
+    }
+    if (digits.size() < 8) {
+        return {};
+    }
+    digits.resize(14, '0');
+
+    std::tm tm{};
+    tm.tm_year = std::stoi(digits.substr(0, 4)) - 1900;
+    tm.tm_mon = std::stoi(digits.substr(4, 2)) - 1;
+    tm.tm_mday = std::stoi(digits.substr(6, 2));
+    tm.tm_hour = std::stoi(digits.substr(8, 2));
+    tm.tm_min = std::stoi(digits.substr(10, 2));
+    tm.tm_sec = std::stoi(digits.substr(12, 2));
+    tm.tm_isdst = -1;
+
+    auto time = std::mktime(&tm);
+    if (time == static_cast<std::time_t>(-1)) {
+        return {};
+    }
+    return std::chrono::system_clock::from_time_t(time);
+}
+
+/// Key identifying a remote PACS for per-node association caps
+auto node_key(const remote_pacs_config& pacs_config) -> std::string {
+    return pacs_config.ae_title + "@" + pacs_config.host + ":" +
+           std::to_string(pacs_config.port);
+}
+
+}  // namespace
+
 // =========================================================================
 // Construction
 // =========================================================================
@@ -105,8 +155,12 @@ void auto_prefetch_service::stop(bool wait_for_completion) {
 
     stop_requested_.store(true);
 
-    // Wake up the worker thread
+    // Wake up the worker thread and any prefetch worker waiting for a slot
     cv_.notify_all();
+    {
+        std::lock_guard<std::mutex> dispatch_lock(dispatch_mutex_);
+    }
+    dispatch_cv_.notify_all();
 
     if (wait_for_completion && worker_thread_.joinable()) {
         worker_thread_.join();
@@ -137,15 +191,7 @@ auto auto_prefetch_service::prefetch_priors(
     request.patient_id = patient_id;
     request.request_time = std::chrono::system_clock::now();
 
-    // Override criteria lookback if specified
-    auto saved_lookback = config_.criteria.lookback_period;
-    config_.criteria.lookback_period = lookback;
-
-    auto result = process_request(request);
-
-    config_.criteria.lookback_period = saved_lookback;
-
-    return result;
+    return process_request(request, lookback);
 }
 
 void auto_prefetch_service::trigger_for_worklist(
@@ -180,6 +226,7 @@ void auto_prefetch_service::on_worklist_query(
         request.patient_name = item.patient_name;
         request.scheduled_modality = item.modality;
         request.scheduled_study_uid = item.study_uid;
+        request.scheduled_time = parse_scheduled_datetime(item.scheduled_datetime);
         request.request_time = std::chrono::system_clock::now();
 
         queue_request(request);
@@ -231,7 +278,40 @@ auto auto_prefetch_service::cycles_completed() const noexcept -> std::size_t {
 
 auto auto_prefetch_service::pending_requests() const noexcept -> std::size_t {
     std::lock_guard<std::mutex> lock(queue_mutex_);
-    return request_queue_.size();
+    return request_queue_.size() + retry_requests_.size();
+}
+
+auto auto_prefetch_service::pending_request_list() const
+    -> std::vector<prefetch_request> {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+
+    std::vector<prefetch_request> requests;
+    requests.reserve(request_queue_.size() + retry_requests_.size());
+    for (const auto& [deadline, entry] : request_queue_) {
+        requests.push_back(entry.request);
+    }
+
+    // Retries are served once their delay has passed
+    auto retries = retry_requests_;
+    std::ranges::sort(retries, {}, [](const auto& retry) { return retry.first; });
+    for (const auto& [ready_time, request] : retries) {
+        requests.push_back(request);
+    }
+    return requests;
+}
+
+auto auto_prefetch_service::queue_lag() const -> std::chrono::milliseconds {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+
+    auto now = std::chrono::steady_clock::now();
+    auto oldest = now;
+    for (const auto& [deadline, entry] : request_queue_) {
+        oldest = std::min(oldest, entry.ready_since);
+    }
+    for (const auto& [ready_time, request] : retry_requests_) {
+        oldest = std::min(oldest, ready_time);
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(now - oldest);
 }
 
 // =========================================================================
@@ -284,12 +364,15 @@ void auto_prefetch_service::run_loop() {
     while (!stop_requested_.load()) {
         std::unique_lock<std::mutex> lock(mutex_);
 
-        // Wait until next cycle time or until woken up
+        // Wait until next cycle time, a retry becomes due, or woken up
         auto wait_until = next_cycle_time_;
+        if (auto retry_time = next_retry_time()) {
+            wait_until = std::min(wait_until, *retry_time);
+        }
         cv_.wait_until(lock, wait_until, [this]() {
             return stop_requested_.load() ||
                    std::chrono::steady_clock::now() >= next_cycle_time_ ||
-                   !request_queue_.empty();
+                   has_ready_request();
         });
 
         if (stop_requested_.load()) {
@@ -299,7 +382,7 @@ void auto_prefetch_service::run_loop() {
         // Check if we should run a cycle
         auto now = std::chrono::steady_clock::now();
         bool should_run_cycle = (now >= next_cycle_time_) ||
-                                (!request_queue_.empty());
+                                has_ready_request();
 
         if (should_run_cycle) {
             lock.unlock();
@@ -336,24 +419,69 @@ auto auto_prefetch_service::execute_cycle() -> prefetch_result {
     cycle_result.timestamp = std::chrono::system_clock::now();
     auto cycle_start = std::chrono::steady_clock::now();
 
-    // Process all pending requests
-    while (auto request = dequeue_request()) {
-        if (stop_requested_.load()) {
-            break;
+    std::chrono::days lookback;
+    std::size_t max_workers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        lookback = config_.criteria.lookback_period;
+        max_workers = std::max<std::size_t>(config_.max_concurrent_prefetches, 1);
+    }
+
+    // Workers take requests earliest deadline first until none is ready
+    std::mutex result_mutex;
+    auto worker = [&]() {
+        while (!stop_requested_.load()) {
+            auto next = dequeue_request();
+            if (!next) {
+                break;
+            }
+
+            const auto& request = next->request;
+            auto lag = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - next->ready_since);
+            integration::monitoring_adapter::record_histogram(
+                "prefetch_queue_lag_ms", static_cast<double>(lag.count()));
+
+            auto result = process_request(request, lookback);
+            result.max_queue_lag = lag;
+
+            if (request.scheduled_time != std::chrono::system_clock::time_point{} &&
+                std::chrono::system_clock::now() > request.scheduled_time) {
+                result.deadlines_missed = 1;
+                integration::logger_adapter::warn(
+                    "Prefetch finished after scheduled start patient_id={} queue_lag_ms={}",
+                    request.patient_id, lag.count());
+            }
+
+            finish_request(request, result);
+
+            std::lock_guard<std::mutex> lock(result_mutex);
+            cycle_result += result;
         }
+    };
 
-        auto result = process_request(*request);
-        cycle_result += result;
+    const auto worker_count = std::min(max_workers, pending_requests());
+    std::vector<std::thread> workers;
+    workers.reserve(worker_count);
+    for (std::size_t i = 1; i < worker_count; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
     }
 
     cycle_result.duration = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::steady_clock::now() - cycle_start);
 
     integration::logger_adapter::info(
-        "Prefetch cycle completed patients={} studies_prefetched={} studies_failed={} duration_ms={}",
+        "Prefetch cycle completed patients={} studies_prefetched={} studies_failed={} "
+        "deadlines_missed={} max_queue_lag_ms={} duration_ms={}",
         cycle_result.patients_processed,
         cycle_result.studies_prefetched,
         cycle_result.studies_failed,
+        cycle_result.deadlines_missed,
+        cycle_result.max_queue_lag.count(),
         cycle_result.duration.count());
 
     // Record metrics
@@ -366,11 +494,17 @@ auto auto_prefetch_service::execute_cycle() -> prefetch_result {
     integration::monitoring_adapter::increment_counter(
         "prefetch_failures_total",
         static_cast<int64_t>(cycle_result.studies_failed));
+    integration::monitoring_adapter::increment_counter(
+        "prefetch_deadline_missed_total",
+        static_cast<int64_t>(cycle_result.deadlines_missed));
+    integration::monitoring_adapter::set_gauge(
+        "prefetch_queue_depth", static_cast<double>(pending_requests()));
 
     return cycle_result;
 }
 
-auto auto_prefetch_service::process_request(const prefetch_request& request)
+auto auto_prefetch_service::process_request(const prefetch_request& request,
+                                            std::chrono::days lookback)
     -> prefetch_result {
 
     prefetch_result result;
@@ -390,10 +524,14 @@ auto auto_prefetch_service::process_request(const prefetch_request& request)
         }
 
         // Query for prior studies
+        if (!acquire_node_slot(pacs)) {
+            break;
+        }
         auto prior_studies = query_prior_studies(
             pacs,
             request.patient_id,
-            config_.criteria.lookback_period);
+            lookback);
+        release_node_slot(pacs);
 
         // Filter based on criteria
         auto filtered_studies = filter_studies(prior_studies, request);
@@ -412,7 +550,11 @@ auto auto_prefetch_service::process_request(const prefetch_request& request)
             }
 
             // Attempt prefetch
+            if (!wait_for_rate_limit() || !acquire_node_slot(pacs)) {
+                break;
+            }
             bool success = prefetch_study(pacs, study);
+            release_node_slot(pacs);
 
             if (success) {
                 ++result.studies_prefetched;
@@ -433,23 +575,6 @@ auto auto_prefetch_service::process_request(const prefetch_request& request)
                         "Failed to prefetch study");
                 }
             }
-
-            // Check rate limiting
-            if (config_.rate_limit_per_minute > 0) {
-                auto elapsed = std::chrono::steady_clock::now() - start_time;
-                auto elapsed_minutes =
-                    std::chrono::duration_cast<std::chrono::minutes>(elapsed)
-                        .count();
-                if (elapsed_minutes < 1) {
-                    auto prefetched_this_minute =
-                        result.studies_prefetched + result.studies_failed;
-                    if (prefetched_this_minute >= config_.rate_limit_per_minute) {
-                        // Wait until the next minute
-                        std::this_thread::sleep_for(
-                            std::chrono::seconds(60) - elapsed);
-                    }
-                }
-            }
         }
     }
 
@@ -464,6 +589,10 @@ auto auto_prefetch_service::query_prior_studies(
     const std::string& patient_id,
     std::chrono::days lookback) -> std::vector<prior_study_info> {
 
+    if (config_.query_override) {
+        return config_.query_override(pacs_config, patient_id, lookback);
+    }
+
     std::vector<prior_study_info> results;
 
     // Calculate date range
@@ -702,6 +831,10 @@ auto auto_prefetch_service::prefetch_study(
     const remote_pacs_config& pacs_config,
     const prior_study_info& study) -> bool {
 
+    if (config_.retrieve_override) {
+        return config_.retrieve_override(pacs_config, study);
+    }
+
     integration::logger_adapter::debug(
         "Prefetching study study_uid={} patient_id={} remote_pacs={}",
         study.study_instance_uid,
@@ -795,28 +928,171 @@ void auto_prefetch_service::update_stats(const prefetch_result& result) {
 void auto_prefetch_service::queue_request(const prefetch_request& request) {
     std::lock_guard<std::mutex> lock(queue_mutex_);
 
-    // Deduplicate by patient ID
-    if (queued_patients_.count(request.patient_id) > 0) {
+    // Already being prefetched or waiting for a retry
+    if (in_flight_patients_.count(request.patient_id) > 0 ||
+        std::ranges::any_of(retry_requests_, [&](const auto& retry) {
+            return retry.second.patient_id == request.patient_id;
+        })) {
+        return;
+    }
+
+    // Prefetched recently; repeated worklist queries should not refetch
+    if (config_.request_dedup_window.count() > 0) {
+        auto recent = recently_prefetched_.find(request.patient_id);
+        if (recent != recently_prefetched_.end()) {
+            if (std::chrono::steady_clock::now() - recent->second <
+                config_.request_dedup_window) {
+                return;
+            }
+            recently_prefetched_.erase(recent);
+        }
+    }
+
+    // Deduplicate by patient ID, keeping the earlier deadline
+    auto queued = queued_patients_.find(request.patient_id);
+    if (queued != queued_patients_.end()) {
+        if (request.deadline() < queued->second->first) {
+            auto node = request_queue_.extract(queued->second);
+            node.key() = request.deadline();
+            node.mapped().request = request;
+            queued->second = request_queue_.insert(std::move(node));
+        }
         return;
     }
 
-    request_queue_.push(request);
-    queued_patients_.insert(request.patient_id);
+    auto entry = request_queue_.emplace(
+        request.deadline(),
+        queued_request{request, std::chrono::steady_clock::now()});
+    queued_patients_.emplace(request.patient_id, entry);
 }
 
 auto auto_prefetch_service::dequeue_request()
-    -> std::optional<prefetch_request> {
+    -> std::optional<queued_request> {
     std::lock_guard<std::mutex> lock(queue_mutex_);
 
+    // Retries whose delay has passed rejoin the queue by deadline
+    auto now = std::chrono::steady_clock::now();
+    std::erase_if(retry_requests_, [&](auto& retry) {
+        if (retry.first > now) {
+            return false;
+        }
+        auto entry = request_queue_.emplace(
+            retry.second.deadline(),
+            queued_request{std::move(retry.second), retry.first});
+        queued_patients_.emplace(entry->second.request.patient_id, entry);
+        return true;
+    });
+
     if (request_queue_.empty()) {
         return std::nullopt;
     }
 
-    auto request = std::move(request_queue_.front());
-    request_queue_.pop();
-    queued_patients_.erase(request.patient_id);
+    auto next = std::move(request_queue_.begin()->second);
+    request_queue_.erase(request_queue_.begin());
+    queued_patients_.erase(next.request.patient_id);
+    in_flight_patients_.insert(next.request.patient_id);
 
-    return request;
+    return next;
+}
+
+void auto_prefetch_service::finish_request(const prefetch_request& request,
+                                           const prefetch_result& result) {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+
+    in_flight_patients_.erase(request.patient_id);
+    if (stop_requested_.load()) {
+        return;  // Possibly cut short; let the next worklist query re-queue it
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (result.studies_failed > 0 && config_.retry_on_failure &&
+        request.retry_count < config_.max_retry_attempts) {
+        auto retry = request;
+        ++retry.retry_count;
+        retry_requests_.emplace_back(now + config_.retry_delay, std::move(retry));
+        return;
+    }
+
+    std::erase_if(recently_prefetched_, [&](const auto& entry) {
+        return now - entry.second >= config_.request_dedup_window;
+    });
+    if (config_.request_dedup_window.count() > 0) {
+        recently_prefetched_[request.patient_id] = now;
+    }
+}
+
+auto auto_prefetch_service::has_ready_request() const -> bool {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+
+    if (!request_queue_.empty()) {
+        return true;
+    }
+    auto now = std::chrono::steady_clock::now();
+    return std::ranges::any_of(retry_requests_, [&](const auto& retry) {
+        return retry.first <= now;
+    });
+}
+
+auto auto_prefetch_service::next_retry_time() const
+    -> std::optional<std::chrono::steady_clock::time_point> {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+
+    if (retry_requests_.empty()) {
+        return std::nullopt;
+    }
+    return std::ranges::min(retry_requests_, {}, [](const auto& retry) {
+        return retry.first;
+    }).first;
+}
+
+auto auto_prefetch_service::acquire_node_slot(
+    const remote_pacs_config& pacs_config) -> bool {
+    std::unique_lock<std::mutex> lock(dispatch_mutex_);
+
+    const auto limit = pacs_config.max_concurrent_associations;
+    auto& active = node_associations_[node_key(pacs_config)];
+    dispatch_cv_.wait(lock, [&]() {
+        return stop_requested_.load() || limit == 0 || active < limit;
+    });
+    if (stop_requested_.load()) {
+        return false;
+    }
+
+    ++active;
+    return true;
+}
+
+void auto_prefetch_service::release_node_slot(
+    const remote_pacs_config& pacs_config) {
+    {
+        std::lock_guard<std::mutex> lock(dispatch_mutex_);
+        --node_associations_[node_key(pacs_config)];
+    }
+    dispatch_cv_.notify_all();
+}
+
+auto auto_prefetch_service::wait_for_rate_limit() -> bool {
+    const auto limit = config_.rate_limit_per_minute;
+    if (limit == 0) {
+        return !stop_requested_.load();
+    }
+
+    std::unique_lock<std::mutex> lock(dispatch_mutex_);
+    while (!stop_requested_.load()) {
+        // Sliding one-minute window shared by all workers
+        auto now = std::chrono::steady_clock::now();
+        while (!recent_retrieves_.empty() &&
+               now - recent_retrieves_.front() >= std::chrono::minutes{1}) {
+            recent_retrieves_.pop_front();
+        }
+        if (recent_retrieves_.size() < limit) {
+            recent_retrieves_.push_back(now);
+            return true;
+        }
+        dispatch_cv_.wait_until(
+            lock, recent_retrieves_.front() + std::chrono::minutes{1});
+    }
+    return false;
 }
 
 }  // namespace kcenon::pacs::workflow
@@ -13,51 +13,91 @@
 
 #include <algorithm>
 #include <iomanip>
-#include <random>
 #include <sstream>
-#include <thread>
 
 namespace kcenon::pacs::workflow {
 
+namespace {
+
+using lock_result = kcenon::common::Result<lock_token>;
+using void_result = kcenon::common::Result<std::monostate>;
+
+auto lock_failure(int code, std::string message, std::string details = {})
+    -> lock_result {
+    return lock_result::err(kcenon::common::error_info{
+        code, std::move(message), "study_lock_manager", std::move(details)});
+}
+
+auto void_failure(int code, std::string message) -> void_result {
+    return void_result::err(kcenon::common::error_info{
+        code, std::move(message), "study_lock_manager"});
+}
+
+}  // namespace
+
 // =============================================================================
 // Construction / Destruction
 // =============================================================================
 
 study_lock_manager::study_lock_manager()
-    : config_{} {}
+    : study_lock_manager(study_lock_manager_config{}) {}
 
 study_lock_manager::study_lock_manager(const study_lock_manager_config& config)
-    : config_{config} {}
+    : config_{config} {
+    shards_.resize(std::max<std::size_t>(config_.shard_count, 1));
+    for (auto& shard : shards_) {
+        shard = std::make_unique<lock_shard>();
+    }
+    wheel_ = std::make_unique<expiry_wheel>();
+    wheel_->slots.resize(expiry_wheel::slot_count);
+    wheel_->cursor_time = std::chrono::system_clock::now();
+    start_expiry_timer();
+}
 
 study_lock_manager::~study_lock_manager() {
-    // Release all locks on destruction
-    std::unique_lock lock{mutex_};
-    locks_.clear();
-    token_to_study_.clear();
-}
-
-study_lock_manager::study_lock_manager(study_lock_manager&& other) noexcept
-    : config_{std::move(other.config_)},
-      locks_{std::move(other.locks_)},
-      token_to_study_{std::move(other.token_to_study_)},
-      stats_{std::move(other.stats_)},
-      next_token_id_{other.next_token_id_.load()},
-      on_lock_acquired_{std::move(other.on_lock_acquired_)},
-      on_lock_released_{std::move(other.on_lock_released_)},
-      on_lock_expired_{std::move(other.on_lock_expired_)} {}
+    stop_expiry_timer();
+}
+
+study_lock_manager::study_lock_manager(study_lock_manager&& other) noexcept {
+    *this = std::move(other);
+}
 
 study_lock_manager& study_lock_manager::operator=(
     study_lock_manager&& other) noexcept {
     if (this != &other) {
-        std::unique_lock lock{mutex_};
-        config_ = std::move(other.config_);
-        locks_ = std::move(other.locks_);
-        token_to_study_ = std::move(other.token_to_study_);
-        stats_ = std::move(other.stats_);
+        stop_expiry_timer();
+        other.stop_expiry_timer();
+
+        {
+            std::scoped_lock config_lock{config_mutex_, other.config_mutex_};
+            config_ = other.config_;
+        }
+        shards_ = std::move(other.shards_);
+        wheel_ = std::move(other.wheel_);
+        total_acquisitions_.store(other.total_acquisitions_.load());
+        total_releases_.store(other.total_releases_.load());
+        timeout_count_.store(other.timeout_count_.load());
+        force_unlock_count_.store(other.force_unlock_count_.load());
+        contention_count_.store(other.contention_count_.load());
+        wait_count_.store(other.wait_count_.load());
+        expired_count_.store(other.expired_count_.load());
+        total_duration_ms_.store(other.total_duration_ms_.load());
+        max_duration_ms_.store(other.max_duration_ms_.load());
         next_token_id_.store(other.next_token_id_.load());
         on_lock_acquired_ = std::move(other.on_lock_acquired_);
         on_lock_released_ = std::move(other.on_lock_released_);
         on_lock_expired_ = std::move(other.on_lock_expired_);
+
+        // Leave the source usable, with an empty table
+        other.shards_.resize(shards_.size());
+        for (auto& shard : other.shards_) {
+            shard = std::make_unique<lock_shard>();
+        }
+        other.wheel_ = std::make_unique<expiry_wheel>();
+        other.wheel_->slots.resize(expiry_wheel::slot_count);
+        other.wheel_->cursor_time = std::chrono::system_clock::now();
+
+        start_expiry_timer();
     }
     return *this;
 }
@@ -81,130 +121,156 @@ auto study_lock_manager::lock(
     const std::string& holder,
     std::chrono::seconds timeout) -> kcenon::common::Result<lock_token> {
     const auto resolved_holder = resolve_holder(holder);
-    const auto expiry = calculate_expiry(timeout);
-    const auto now = std::chrono::system_clock::now();
-
-    std::unique_lock lock{mutex_};
-
-    // Check if lock can be acquired
-    auto it = locks_.find(study_uid);
-    if (it != locks_.end()) {
-        auto& existing = it->second;
+    const auto max_shared = current_config().max_shared_locks;
 
-        // Check if existing lock is expired
-        if (existing.info.is_expired()) {
-            // Clean up expired lock
-            auto token_it = token_to_study_.find(existing.info.token_id);
-            if (token_it != token_to_study_.end()) {
-                token_to_study_.erase(token_it);
-            }
-            locks_.erase(it);
-            it = locks_.end();
-
-            // Notify expiration
-            if (on_lock_expired_) {
-                lock.unlock();
-                on_lock_expired_(study_uid, existing.info);
-                lock.lock();
-            }
+    auto& shard = shard_for(study_uid);
+    pending_events expired;
+    pending_events acquired;
+    lock_result result = lock_failure(lock_error::not_found, "Lock not found");
+    {
+        std::unique_lock lock{shard.mutex};
+        auto it = shard.locks.try_emplace(study_uid).first;
+        auto& entry = it->second;
+        expire_if_stale(study_uid, entry, expired);
+
+        // Queued waiters are served first; never overtake them
+        if (entry.waiters.empty() && can_grant(entry, type)) {
+            auto token = add_holder(study_uid, entry, type, reason,
+                                    resolved_holder, timeout);
+            acquired.emplace_back(study_uid, entry.info);
+            acquired.back().second.token_id = token.token_id;
+            acquired.back().second.holder = resolved_holder;
+            result = lock_result::ok(std::move(token));
+        } else if (entry.waiters.empty() && type == lock_type::shared &&
+                   entry.info.type == lock_type::shared &&
+                   entry.holders.size() >= max_shared) {
+            result = lock_failure(lock_error::max_shared_exceeded,
+                                  "Maximum shared locks exceeded");
+        } else {
+            ++contention_count_;
+            result = lock_failure(
+                lock_error::already_locked,
+                "Study is already locked by: " + entry.info.holder,
+                "Lock type: " + to_string(entry.info.type));
         }
+        erase_if_unused(shard, it);
     }
 
-    // Re-check after potential cleanup
-    it = locks_.find(study_uid);
-    if (it != locks_.end()) {
-        auto& existing = it->second;
-
-        // Handle shared lock upgrade/coexistence
-        if (type == lock_type::shared &&
-            existing.info.type == lock_type::shared) {
-            // Check max shared locks
-            if (existing.shared_holders.size() >= config_.max_shared_locks) {
-                return kcenon::common::Result<lock_token>::err(
-                    kcenon::common::error_info{
-                        lock_error::max_shared_exceeded,
-                        "Maximum shared locks exceeded",
-                        "study_lock_manager"});
-            }
-
-            // Add holder to shared list
-            existing.shared_holders.push_back(resolved_holder);
-            existing.info.shared_count = existing.shared_holders.size();
-
-            // Generate new token for this shared holder
-            const auto token_id = generate_token_id();
-            token_to_study_[token_id] = study_uid;
-
-            lock_token token;
-            token.token_id = token_id;
-            token.study_uid = study_uid;
-            token.type = lock_type::shared;
-            token.acquired_at = now;
-            token.expires_at = expiry;
-
-            record_acquisition(type);
-
-            if (on_lock_acquired_) {
-                lock_info info = existing.info;
-                info.token_id = token_id;
-                info.holder = resolved_holder;
-                lock.unlock();
-                on_lock_acquired_(study_uid, info);
-            }
-
-            return kcenon::common::Result<lock_token>::ok(token);
-        }
+    notify(on_lock_expired_, expired);
+    notify(on_lock_acquired_, acquired);
+    return result;
+}
 
-        // Cannot acquire lock - already locked
-        {
-            std::lock_guard stats_lock{stats_mutex_};
-            ++stats_.contention_count;
-        }
+auto study_lock_manager::lock_wait(
+    const std::string& study_uid,
+    lock_type type,
+    const std::string& reason,
+    const std::string& holder,
+    std::optional<std::chrono::milliseconds> wait,
+    std::chrono::seconds timeout) -> kcenon::common::Result<lock_token> {
+    const auto resolved_holder = resolve_holder(holder);
+    const auto wait_time = wait.value_or(current_config().acquire_wait_timeout);
+
+    auto& shard = shard_for(study_uid);
+    pending_events expired;
+    std::unique_lock lock{shard.mutex};
+    auto& entry = shard.locks.try_emplace(study_uid).first->second;
+    expire_if_stale(study_uid, entry, expired);
+
+    if (entry.waiters.empty() && can_grant(entry, type)) {
+        auto token = add_holder(study_uid, entry, type, reason,
+                                resolved_holder, timeout);
+        pending_events acquired{{study_uid, entry.info}};
+        acquired.back().second.token_id = token.token_id;
+        acquired.back().second.holder = resolved_holder;
+        lock.unlock();
+        notify(on_lock_expired_, expired);
+        notify(on_lock_acquired_, acquired);
+        return lock_result::ok(std::move(token));
+    }
 
-        return kcenon::common::Result<lock_token>::err(
-            kcenon::common::error_info{
-                lock_error::already_locked,
-                "Study is already locked by: " + existing.info.holder,
-                "study_lock_manager",
-                "Lock type: " + to_string(existing.info.type)});
+    lock_waiter waiter;
+    waiter.type = type;
+    waiter.reason = reason;
+    waiter.holder = resolved_holder;
+    waiter.timeout = timeout;
+
+    // Migration requests go ahead of ordinary ones, behind any upgrade
+    auto position = entry.waiters.end();
+    if (type == lock_type::migration) {
+        position = std::find_if(entry.waiters.begin(), entry.waiters.end(),
+                                [](const lock_waiter* queued) {
+                                    return queued->upgrade_token.empty() &&
+                                           queued->type != lock_type::migration;
+                                });
     }
+    entry.waiters.insert(position, &waiter);
+    ++contention_count_;
+    ++wait_count_;
+
+    lock.unlock();
+    notify(on_lock_expired_, expired);
+    lock.lock();
+    return wait_for_grant(lock, study_uid, waiter, wait_time);
+}
 
-    // Create new lock
-    const auto token_id = generate_token_id();
+auto study_lock_manager::upgrade_lock(
+    const lock_token& token,
+    std::optional<std::chrono::milliseconds> wait)
+    -> kcenon::common::Result<lock_token> {
+    const auto wait_time = wait.value_or(current_config().acquire_wait_timeout);
 
-    lock_entry entry;
-    entry.info.study_uid = study_uid;
-    entry.info.type = type;
-    entry.info.reason = reason;
-    entry.info.holder = resolved_holder;
-    entry.info.token_id = token_id;
-    entry.info.acquired_at = now;
-    entry.info.expires_at = expiry;
-    entry.info.shared_count = (type == lock_type::shared) ? 1 : 0;
+    auto& shard = shard_for(token.study_uid);
+    std::unique_lock lock{shard.mutex};
 
-    if (type == lock_type::shared) {
-        entry.shared_holders.push_back(resolved_holder);
+    auto it = shard.locks.find(token.study_uid);
+    if (it == shard.locks.end()) {
+        return lock_failure(lock_error::invalid_token, "Invalid or expired token");
+    }
+    auto& entry = it->second;
+    auto holder_it = std::find_if(
+        entry.holders.begin(), entry.holders.end(),
+        [&](const lock_holder& h) { return h.token_id == token.token_id; });
+    if (holder_it == entry.holders.end() || entry.info.is_expired()) {
+        return lock_failure(lock_error::invalid_token, "Invalid or expired token");
+    }
+    if (entry.info.type != lock_type::shared) {
+        return lock_failure(lock_error::upgrade_failed,
+                            "Only shared locks can be upgraded");
     }
 
-    locks_[study_uid] = std::move(entry);
-    token_to_study_[token_id] = study_uid;
-
-    lock_token token;
-    token.token_id = token_id;
-    token.study_uid = study_uid;
-    token.type = type;
-    token.acquired_at = now;
-    token.expires_at = expiry;
-
-    record_acquisition(type);
+    // Sole holder: convert in place
+    if (entry.holders.size() == 1) {
+        entry.info.type = lock_type::exclusive;
+        entry.info.shared_count = 0;
+        lock_token upgraded = token;
+        upgraded.type = lock_type::exclusive;
+        upgraded.expires_at = entry.info.expires_at;
+        return lock_result::ok(std::move(upgraded));
+    }
 
-    if (on_lock_acquired_) {
-        lock_info info = locks_[study_uid].info;
-        lock.unlock();
-        on_lock_acquired_(study_uid, info);
+    // Two waiting upgraders would each wait for the other to release
+    if (!entry.waiters.empty() && !entry.waiters.front()->upgrade_token.empty()) {
+        ++contention_count_;
+        return lock_failure(lock_error::upgrade_failed,
+                            "Another upgrade is already pending");
     }
 
-    return kcenon::common::Result<lock_token>::ok(token);
+    lock_waiter waiter;
+    waiter.type = lock_type::exclusive;
+    waiter.holder = holder_it->holder;
+    waiter.upgrade_token = token.token_id;
+    entry.waiters.push_front(&waiter);
+    ++contention_count_;
+    ++wait_count_;
+
+    auto result = wait_for_grant(lock, token.study_uid, waiter, wait_time);
+    if (result.is_ok()) {
+        auto upgraded = result.value();
+        upgraded.acquired_at = token.acquired_at;
+        return lock_result::ok(std::move(upgraded));
+    }
+    return result;
 }
 
 auto study_lock_manager::try_lock(
@@ -213,8 +279,7 @@ auto study_lock_manager::try_lock(
     const std::string& reason,
     const std::string& holder,
     std::chrono::seconds timeout) -> kcenon::common::Result<lock_token> {
-    // try_lock is the same as lock for this implementation
-    // since we don't block waiting
+    // lock() never blocks; lock_wait() is the blocking variant
     return lock(study_uid, type, reason, holder, timeout);
 }
 
@@ -224,71 +289,31 @@ auto study_lock_manager::try_lock(
 
 auto study_lock_manager::unlock(const lock_token& token)
     -> kcenon::common::Result<std::monostate> {
-    std::unique_lock lock{mutex_};
-
-    // Find study by token
-    auto token_it = token_to_study_.find(token.token_id);
-    if (token_it == token_to_study_.end()) {
-        return kcenon::common::Result<std::monostate>::err(
-            kcenon::common::error_info{
-                lock_error::invalid_token,
-                "Invalid or expired token",
-                "study_lock_manager"});
-    }
-
-    const auto study_uid = token_it->second;
-    auto lock_it = locks_.find(study_uid);
-    if (lock_it == locks_.end()) {
-        // Token exists but lock doesn't - clean up
-        token_to_study_.erase(token_it);
-        return kcenon::common::Result<std::monostate>::err(
-            kcenon::common::error_info{
-                lock_error::not_found,
-                "Lock not found",
-                "study_lock_manager"});
-    }
-
-    auto& entry = lock_it->second;
-    const auto duration = entry.info.duration();
-    const auto type = entry.info.type;
-    lock_info released_info = entry.info;
-
-    // Handle shared lock release
-    if (type == lock_type::shared && entry.shared_holders.size() > 1) {
-        // Just remove this holder from shared list
-        auto holder_it = std::find(
-            entry.shared_holders.begin(),
-            entry.shared_holders.end(),
-            token.token_id);  // Using token_id as holder identifier for shared
-
-        if (holder_it != entry.shared_holders.end()) {
-            entry.shared_holders.erase(holder_it);
-        }
-        token_to_study_.erase(token_it);
-        entry.info.shared_count = entry.shared_holders.size();
-
-        record_release(type, duration);
+    auto& shard = shard_for(token.study_uid);
+    pending_events released;
+    {
+        std::unique_lock lock{shard.mutex};
 
-        if (on_lock_released_) {
-            lock.unlock();
-            on_lock_released_(study_uid, released_info);
+        auto it = shard.locks.find(token.study_uid);
+        if (it == shard.locks.end()) {
+            return void_failure(lock_error::invalid_token, "Invalid or expired token");
+        }
+        auto& entry = it->second;
+        auto holder_it = std::find_if(
+            entry.holders.begin(), entry.holders.end(),
+            [&](const lock_holder& h) { return h.token_id == token.token_id; });
+        if (holder_it == entry.holders.end()) {
+            return void_failure(lock_error::invalid_token, "Invalid or expired token");
         }
 
-        return kcenon::common::Result<std::monostate>::ok(std::monostate{});
-    }
-
-    // Remove lock entirely
-    token_to_study_.erase(token_it);
-    locks_.erase(lock_it);
-
-    record_release(type, duration);
-
-    if (on_lock_released_) {
-        lock.unlock();
-        on_lock_released_(study_uid, released_info);
+        released.emplace_back(token.study_uid, entry.info);
+        remove_holder(entry, static_cast<std::size_t>(holder_it - entry.holders.begin()));
+        grant_waiters(token.study_uid, entry);
+        erase_if_unused(shard, it);
     }
 
-    return kcenon::common::Result<std::monostate>::ok(std::monostate{});
+    notify(on_lock_released_, released);
+    return void_result::ok(std::monostate{});
 }
 
 auto study_lock_manager::unlock(
@@ -297,70 +322,32 @@ auto study_lock_manager::unlock(
     -> kcenon::common::Result<std::monostate> {
     const auto resolved_holder = resolve_holder(holder);
 
-    std::unique_lock lock{mutex_};
-
-    auto lock_it = locks_.find(study_uid);
-    if (lock_it == locks_.end()) {
-        return kcenon::common::Result<std::monostate>::err(
-            kcenon::common::error_info{
-                lock_error::not_found,
-                "Lock not found for study",
-                "study_lock_manager"});
-    }
-
-    auto& entry = lock_it->second;
-
-    // Verify holder matches
-    if (entry.info.holder != resolved_holder) {
-        // Check shared holders
-        bool found_shared = false;
-        if (entry.info.type == lock_type::shared) {
-            auto holder_it = std::find(
-                entry.shared_holders.begin(),
-                entry.shared_holders.end(),
-                resolved_holder);
-            if (holder_it != entry.shared_holders.end()) {
-                found_shared = true;
-                entry.shared_holders.erase(holder_it);
-                entry.info.shared_count = entry.shared_holders.size();
-            }
-        }
+    auto& shard = shard_for(study_uid);
+    pending_events released;
+    {
+        std::unique_lock lock{shard.mutex};
 
-        if (!found_shared) {
-            return kcenon::common::Result<std::monostate>::err(
-                kcenon::common::error_info{
-                    lock_error::permission_denied,
-                    "Lock held by different holder: " + entry.info.holder,
-                    "study_lock_manager"});
+        auto it = shard.locks.find(study_uid);
+        if (it == shard.locks.end() || it->second.holders.empty()) {
+            return void_failure(lock_error::not_found, "Lock not found for study");
         }
-
-        if (!entry.shared_holders.empty()) {
-            // Other shared holders remain
-            record_release(entry.info.type, entry.info.duration());
-            return kcenon::common::Result<std::monostate>::ok(std::monostate{});
+        auto& entry = it->second;
+        auto holder_it = std::find_if(
+            entry.holders.begin(), entry.holders.end(),
+            [&](const lock_holder& h) { return h.holder == resolved_holder; });
+        if (holder_it == entry.holders.end()) {
+            return void_failure(lock_error::permission_denied,
+                                "Lock held by different holder: " + entry.info.holder);
         }
-    }
 
-    const auto duration = entry.info.duration();
-    const auto type = entry.info.type;
-    lock_info released_info = entry.info;
-
-    // Remove token mapping
-    auto token_it = token_to_study_.find(entry.info.token_id);
-    if (token_it != token_to_study_.end()) {
-        token_to_study_.erase(token_it);
+        released.emplace_back(study_uid, entry.info);
+        remove_holder(entry, static_cast<std::size_t>(holder_it - entry.holders.begin()));
+        grant_waiters(study_uid, entry);
+        erase_if_unused(shard, it);
     }
 
-    locks_.erase(lock_it);
-
-    record_release(type, duration);
-
-    if (on_lock_released_) {
-        lock.unlock();
-        on_lock_released_(study_uid, released_info);
-    }
-
-    return kcenon::common::Result<std::monostate>::ok(std::monostate{});
+    notify(on_lock_released_, released);
+    return void_result::ok(std::monostate{});
 }
 
 auto study_lock_manager::force_unlock(
@@ -368,55 +355,33 @@ auto study_lock_manager::force_unlock(
     [[maybe_unused]] const std::string& admin_reason)
     -> kcenon::common::Result<std::monostate> {
     // Note: admin_reason can be used for audit logging in future
-    if (!config_.allow_force_unlock) {
-        return kcenon::common::Result<std::monostate>::err(
-            kcenon::common::error_info{
-                lock_error::permission_denied,
-                "Force unlock is not allowed",
-                "study_lock_manager"});
-    }
-
-    std::unique_lock lock{mutex_};
-
-    auto lock_it = locks_.find(study_uid);
-    if (lock_it == locks_.end()) {
-        return kcenon::common::Result<std::monostate>::err(
-            kcenon::common::error_info{
-                lock_error::not_found,
-                "Lock not found for study",
-                "study_lock_manager"});
+    if (!current_config().allow_force_unlock) {
+        return void_failure(lock_error::permission_denied,
+                            "Force unlock is not allowed");
     }
 
-    const auto duration = lock_it->second.info.duration();
-    const auto type = lock_it->second.info.type;
-    lock_info released_info = lock_it->second.info;
-
-    // Remove token mapping
-    auto token_it = token_to_study_.find(lock_it->second.info.token_id);
-    if (token_it != token_to_study_.end()) {
-        token_to_study_.erase(token_it);
-    }
-
-    // Remove all shared holder tokens
-    for (const auto& shared_holder : lock_it->second.shared_holders) {
-        // Shared holders may have separate tokens - clean up if needed
-        (void)shared_holder;
-    }
-
-    locks_.erase(lock_it);
-
+    auto& shard = shard_for(study_uid);
+    pending_events released;
     {
-        std::lock_guard stats_lock{stats_mutex_};
-        ++stats_.force_unlock_count;
-    }
-    record_release(type, duration);
+        std::unique_lock lock{shard.mutex};
 
-    if (on_lock_released_) {
-        lock.unlock();
-        on_lock_released_(study_uid, released_info);
+        auto it = shard.locks.find(study_uid);
+        if (it == shard.locks.end() || it->second.holders.empty()) {
+            return void_failure(lock_error::not_found, "Lock not found for study");
+        }
+        auto& entry = it->second;
+
+        released.emplace_back(study_uid, entry.info);
+        while (!entry.holders.empty()) {
+            remove_holder(entry, entry.holders.size() - 1);
+        }
+        ++force_unlock_count_;
+        grant_waiters(study_uid, entry);
+        erase_if_unused(shard, it);
     }
 
-    return kcenon::common::Result<std::monostate>::ok(std::monostate{});
+    notify(on_lock_released_, released);
+    return void_result::ok(std::monostate{});
 }
 
 auto study_lock_manager::unlock_all_by_holder(const std::string& holder)
@@ -424,42 +389,26 @@ auto study_lock_manager::unlock_all_by_holder(const std::string& holder)
     const auto resolved_holder = resolve_holder(holder);
     std::size_t count = 0;
 
-    std::unique_lock lock{mutex_};
-
-    std::vector<std::string> to_remove;
-    for (auto& [study_uid, entry] : locks_) {
-        if (entry.info.holder == resolved_holder) {
-            to_remove.push_back(study_uid);
-        } else if (entry.info.type == lock_type::shared) {
-            // Check shared holders
-            auto it = std::find(
-                entry.shared_holders.begin(),
-                entry.shared_holders.end(),
-                resolved_holder);
-            if (it != entry.shared_holders.end()) {
-                entry.shared_holders.erase(it);
-                entry.info.shared_count = entry.shared_holders.size();
-                ++count;
-
-                if (entry.shared_holders.empty()) {
-                    to_remove.push_back(study_uid);
+    for (auto& shard : shards_) {
+        std::unique_lock lock{shard->mutex};
+        for (auto it = shard->locks.begin(); it != shard->locks.end();) {
+            auto& entry = it->second;
+            bool removed = false;
+            for (std::size_t i = entry.holders.size(); i-- > 0;) {
+                if (entry.holders[i].holder == resolved_holder) {
+                    remove_holder(entry, i);
+                    removed = true;
+                    ++count;
                 }
             }
-        }
-    }
-
-    for (const auto& study_uid : to_remove) {
-        auto it = locks_.find(study_uid);
-        if (it != locks_.end()) {
-            // Remove token mapping
-            auto token_it = token_to_study_.find(it->second.info.token_id);
-            if (token_it != token_to_study_.end()) {
-                token_to_study_.erase(token_it);
+            if (removed) {
+                grant_waiters(it->first, entry);
+            }
+            if (entry.holders.empty() && entry.waiters.empty()) {
+                it = shard->locks.erase(it);
+            } else {
+                ++it;
             }
-
-            record_release(it->second.info.type, it->second.info.duration());
-            locks_.erase(it);
-            ++count;
         }
     }
 
@@ -471,48 +420,24 @@ auto study_lock_manager::unlock_all_by_holder(const std::string& holder)
 // =============================================================================
 
 auto study_lock_manager::is_locked(const std::string& study_uid) const -> bool {
-    std::shared_lock lock{mutex_};
-
-    auto it = locks_.find(study_uid);
-    if (it == locks_.end()) {
-        return false;
-    }
-
-    // Check if expired
-    if (it->second.info.is_expired()) {
-        return false;
-    }
-
-    return true;
+    return get_lock_info(study_uid).has_value();
 }
 
 auto study_lock_manager::is_locked(
     const std::string& study_uid,
     lock_type type) const -> bool {
-    std::shared_lock lock{mutex_};
-
-    auto it = locks_.find(study_uid);
-    if (it == locks_.end()) {
-        return false;
-    }
-
-    if (it->second.info.is_expired()) {
-        return false;
-    }
-
-    return it->second.info.type == type;
+    auto info = get_lock_info(study_uid);
+    return info && info->type == type;
 }
 
 auto study_lock_manager::get_lock_info(const std::string& study_uid) const
     -> std::optional<lock_info> {
-    std::shared_lock lock{mutex_};
+    const auto& shard = shard_for(study_uid);
+    std::shared_lock lock{shard.mutex};
 
-    auto it = locks_.find(study_uid);
-    if (it == locks_.end()) {
-        return std::nullopt;
-    }
-
-    if (it->second.info.is_expired()) {
+    auto it = shard.locks.find(study_uid);
+    if (it == shard.locks.end() || it->second.holders.empty() ||
+        it->second.info.is_expired()) {
         return std::nullopt;
     }
 
@@ -522,88 +447,75 @@ auto study_lock_manager::get_lock_info(const std::string& study_uid) const
 auto study_lock_manager::get_lock_info_by_token(
     const std::string& token_id) const
     -> std::optional<lock_info> {
-    std::shared_lock lock{mutex_};
-
-    auto token_it = token_to_study_.find(token_id);
-    if (token_it == token_to_study_.end()) {
-        return std::nullopt;
-    }
-
-    auto lock_it = locks_.find(token_it->second);
-    if (lock_it == locks_.end()) {
-        return std::nullopt;
-    }
-
-    if (lock_it->second.info.is_expired()) {
-        return std::nullopt;
+    // Tokens do not identify their shard; this is an administrative lookup
+    for (const auto& shard : shards_) {
+        std::shared_lock lock{shard->mutex};
+        for (const auto& [study_uid, entry] : shard->locks) {
+            const bool held = std::any_of(
+                entry.holders.begin(), entry.holders.end(),
+                [&](const lock_holder& h) { return h.token_id == token_id; });
+            if (held) {
+                if (entry.info.is_expired()) {
+                    return std::nullopt;
+                }
+                return entry.info;
+            }
+        }
     }
-
-    return lock_it->second.info;
+    return std::nullopt;
 }
 
 auto study_lock_manager::validate_token(const lock_token& token) const -> bool {
-    std::shared_lock lock{mutex_};
-
-    auto token_it = token_to_study_.find(token.token_id);
-    if (token_it == token_to_study_.end()) {
-        return false;
-    }
+    const auto& shard = shard_for(token.study_uid);
+    std::shared_lock lock{shard.mutex};
 
-    auto lock_it = locks_.find(token_it->second);
-    if (lock_it == locks_.end()) {
+    auto it = shard.locks.find(token.study_uid);
+    if (it == shard.locks.end() || it->second.info.is_expired()) {
         return false;
     }
 
-    if (lock_it->second.info.is_expired()) {
-        return false;
-    }
-
-    return token_it->second == token.study_uid;
+    const auto& holders = it->second.holders;
+    return std::any_of(holders.begin(), holders.end(), [&](const lock_holder& h) {
+        return h.token_id == token.token_id;
+    });
 }
 
 auto study_lock_manager::refresh_lock(
     const lock_token& token,
     std::chrono::seconds extension)
     -> kcenon::common::Result<lock_token> {
-    std::unique_lock lock{mutex_};
+    const auto default_timeout = current_config().default_timeout;
 
-    auto token_it = token_to_study_.find(token.token_id);
-    if (token_it == token_to_study_.end()) {
-        return kcenon::common::Result<lock_token>::err(
-            kcenon::common::error_info{
-                lock_error::invalid_token,
-                "Invalid or expired token",
-                "study_lock_manager"});
-    }
+    auto& shard = shard_for(token.study_uid);
+    std::unique_lock lock{shard.mutex};
 
-    auto lock_it = locks_.find(token_it->second);
-    if (lock_it == locks_.end()) {
-        return kcenon::common::Result<lock_token>::err(
-            kcenon::common::error_info{
-                lock_error::not_found,
-                "Lock not found",
-                "study_lock_manager"});
+    auto it = shard.locks.find(token.study_uid);
+    if (it == shard.locks.end()) {
+        return lock_failure(lock_error::invalid_token, "Invalid or expired token");
+    }
+    auto& entry = it->second;
+    const bool held = std::any_of(
+        entry.holders.begin(), entry.holders.end(),
+        [&](const lock_holder& h) { return h.token_id == token.token_id; });
+    if (!held) {
+        return lock_failure(lock_error::invalid_token, "Invalid or expired token");
     }
 
-    if (lock_it->second.info.is_expired()) {
-        return kcenon::common::Result<lock_token>::err(
-            kcenon::common::error_info{
-                lock_error::expired,
-                "Lock has expired",
-                "study_lock_manager"});
+    if (entry.info.is_expired()) {
+        return lock_failure(lock_error::expired, "Lock has expired");
     }
 
     // Calculate new expiry
-    auto new_extension = extension.count() > 0 ? extension : config_.default_timeout;
+    auto new_extension = extension.count() > 0 ? extension : default_timeout;
     if (new_extension.count() > 0) {
-        lock_it->second.info.expires_at =
-            std::chrono::system_clock::now() + new_extension;
+        entry.info.expires_at = std::chrono::system_clock::now() + new_extension;
+        schedule_expiry(token.study_uid, *entry.info.expires_at);
     }
 
     lock_token updated_token = token;
-    updated_token.expires_at = lock_it->second.info.expires_at;
+    updated_token.expires_at = entry.info.expires_at;
 
-    return kcenon::common::Result<lock_token>::ok(updated_token);
+    return lock_result::ok(updated_token);
 }
 
 // =============================================================================
@@ -611,14 +523,14 @@ auto study_lock_manager::refresh_lock(
 // =============================================================================
 
 auto study_lock_manager::get_all_locks() const -> std::vector<lock_info> {
-    std::shared_lock lock{mutex_};
-
     std::vector<lock_info> result;
-    result.reserve(locks_.size());
 
-    for (const auto& [study_uid, entry] : locks_) {
-        if (!entry.info.is_expired()) {
-            result.push_back(entry.info);
+    for (const auto& shard : shards_) {
+        std::shared_lock lock{shard->mutex};
+        for (const auto& [study_uid, entry] : shard->locks) {
+            if (!entry.holders.empty() && !entry.info.is_expired()) {
+                result.push_back(entry.info);
+            }
         }
     }
 
@@ -628,21 +540,17 @@ auto study_lock_manager::get_all_locks() const -> std::vector<lock_info> {
 auto study_lock_manager::get_locks_by_holder(const std::string& holder) const
     -> std::vector<lock_info> {
     const auto resolved_holder = resolve_holder(holder);
-    std::shared_lock lock{mutex_};
-
     std::vector<lock_info> result;
 
-    for (const auto& [study_uid, entry] : locks_) {
-        if (entry.info.is_expired()) continue;
-
-        if (entry.info.holder == resolved_holder) {
-            result.push_back(entry.info);
-        } else if (entry.info.type == lock_type::shared) {
-            auto it = std::find(
-                entry.shared_holders.begin(),
-                entry.shared_holders.end(),
-                resolved_holder);
-            if (it != entry.shared_holders.end()) {
+    for (const auto& shard : shards_) {
+        std::shared_lock lock{shard->mutex};
+        for (const auto& [study_uid, entry] : shard->locks) {
+            if (entry.info.is_expired()) continue;
+
+            const bool held = std::any_of(
+                entry.holders.begin(), entry.holders.end(),
+                [&](const lock_holder& h) { return h.holder == resolved_holder; });
+            if (held) {
                 result.push_back(entry.info);
             }
         }
@@ -653,13 +561,15 @@ auto study_lock_manager::get_locks_by_holder(const std::string& holder) const
 
 auto study_lock_manager::get_locks_by_type(lock_type type) const
     -> std::vector<lock_info> {
-    std::shared_lock lock{mutex_};
-
     std::vector<lock_info> result;
 
-    for (const auto& [study_uid, entry] : locks_) {
-        if (!entry.info.is_expired() && entry.info.type == type) {
-            result.push_back(entry.info);
+    for (const auto& shard : shards_) {
+        std::shared_lock lock{shard->mutex};
+        for (const auto& [study_uid, entry] : shard->locks) {
+            if (!entry.holders.empty() && !entry.info.is_expired() &&
+                entry.info.type == type) {
+                result.push_back(entry.info);
+            }
         }
     }
 
@@ -667,13 +577,14 @@ auto study_lock_manager::get_locks_by_type(lock_type type) const
 }
 
 auto study_lock_manager::get_expired_locks() const -> std::vector<lock_info> {
-    std::shared_lock lock{mutex_};
-
     std::vector<lock_info> result;
 
-    for (const auto& [study_uid, entry] : locks_) {
-        if (entry.info.is_expired()) {
-            result.push_back(entry.info);
+    for (const auto& shard : shards_) {
+        std::shared_lock lock{shard->mutex};
+        for (const auto& [study_uid, entry] : shard->locks) {
+            if (!entry.holders.empty() && entry.info.is_expired()) {
+                result.push_back(entry.info);
+            }
         }
     }
 
@@ -685,52 +596,50 @@ auto study_lock_manager::get_expired_locks() const -> std::vector<lock_info> {
 // =============================================================================
 
 auto study_lock_manager::cleanup_expired_locks() -> std::size_t {
-    std::unique_lock lock{mutex_};
-
-    std::vector<std::string> expired_studies;
-
-    for (const auto& [study_uid, entry] : locks_) {
-        if (entry.info.is_expired()) {
-            expired_studies.push_back(study_uid);
-        }
-    }
-
-    for (const auto& study_uid : expired_studies) {
-        auto it = locks_.find(study_uid);
-        if (it != locks_.end()) {
-            lock_info expired_info = it->second.info;
-
-            // Remove token mapping
-            auto token_it = token_to_study_.find(it->second.info.token_id);
-            if (token_it != token_to_study_.end()) {
-                token_to_study_.erase(token_it);
-            }
-
-            locks_.erase(it);
+    std::size_t count = 0;
 
-            if (on_lock_expired_) {
-                lock.unlock();
-                on_lock_expired_(study_uid, expired_info);
-                lock.lock();
+    for (auto& shard : shards_) {
+        pending_events expired;
+        {
+            std::unique_lock lock{shard->mutex};
+            for (auto it = shard->locks.begin(); it != shard->locks.end();) {
+                expire_if_stale(it->first, it->second, expired);
+                if (it->second.holders.empty() && it->second.waiters.empty()) {
+                    it = shard->locks.erase(it);
+                } else {
+                    ++it;
+                }
             }
         }
+        count += expired.size();
+        notify(on_lock_expired_, expired);
     }
 
-    return expired_studies.size();
+    return count;
 }
 
 auto study_lock_manager::get_stats() const -> lock_manager_stats {
-    std::lock_guard stats_lock{stats_mutex_};
-    std::shared_lock lock{mutex_};
-
-    lock_manager_stats current_stats = stats_;
-    current_stats.active_locks = 0;
-    current_stats.exclusive_locks = 0;
-    current_stats.shared_locks = 0;
-    current_stats.migration_locks = 0;
+    lock_manager_stats current_stats;
+    current_stats.total_acquisitions = total_acquisitions_.load();
+    current_stats.total_releases = total_releases_.load();
+    current_stats.timeout_count = timeout_count_.load();
+    current_stats.force_unlock_count = force_unlock_count_.load();
+    current_stats.contention_count = contention_count_.load();
+    current_stats.wait_count = wait_count_.load();
+    current_stats.expired_count = expired_count_.load();
+    if (current_stats.total_releases > 0) {
+        current_stats.avg_lock_duration = std::chrono::milliseconds{
+            total_duration_ms_.load() /
+            static_cast<std::int64_t>(current_stats.total_releases)};
+    }
+    current_stats.max_lock_duration = std::chrono::milliseconds{max_duration_ms_.load()};
 
-    for (const auto& [study_uid, entry] : locks_) {
-        if (!entry.info.is_expired()) {
+    for (const auto& shard : shards_) {
+        std::shared_lock lock{shard->mutex};
+        for (const auto& [study_uid, entry] : shard->locks) {
+            if (entry.holders.empty() || entry.info.is_expired()) {
+                continue;
+            }
             ++current_stats.active_locks;
             switch (entry.info.type) {
                 case lock_type::exclusive:
@@ -750,8 +659,15 @@ auto study_lock_manager::get_stats() const -> lock_manager_stats {
 }
 
 void study_lock_manager::reset_stats() {
-    std::lock_guard stats_lock{stats_mutex_};
-    stats_ = lock_manager_stats{};
+    total_acquisitions_ = 0;
+    total_releases_ = 0;
+    timeout_count_ = 0;
+    force_unlock_count_ = 0;
+    contention_count_ = 0;
+    wait_count_ = 0;
+    expired_count_ = 0;
+    total_duration_ms_ = 0;
+    max_duration_ms_ = 0;
 }
 
 auto study_lock_manager::get_config() const
@@ -760,8 +676,15 @@ auto study_lock_manager::get_config() const
 }
 
 void study_lock_manager::set_config(const study_lock_manager_config& config) {
-    std::unique_lock lock{mutex_};
+    std::unique_lock lock{config_mutex_};
+    // Table layout and the expiry timer are fixed at construction
+    const auto shard_count = config_.shard_count;
+    const auto auto_cleanup = config_.auto_cleanup;
+    const auto expiry_tick = config_.expiry_tick;
     config_ = config;
+    config_.shard_count = shard_count;
+    config_.auto_cleanup = auto_cleanup;
+    config_.expiry_tick = expiry_tick;
 }
 
 // =============================================================================
@@ -781,7 +704,288 @@ void study_lock_manager::set_on_lock_expired(lock_event_callback callback) {
 }
 
 // =============================================================================
-// Internal Methods
+// Internal Methods - Lock Table
+// =============================================================================
+
+auto study_lock_manager::shard_for(const std::string& study_uid) const
+    -> lock_shard& {
+    return *shards_[std::hash<std::string>{}(study_uid) % shards_.size()];
+}
+
+auto study_lock_manager::can_grant(const lock_entry& entry, lock_type type) const
+    -> bool {
+    if (entry.holders.empty()) {
+        return true;
+    }
+
+    // Shared locks can coexist with other shared locks
+    return type == lock_type::shared && entry.info.type == lock_type::shared &&
+           entry.holders.size() < current_config().max_shared_locks;
+}
+
+auto study_lock_manager::add_holder(
+    const std::string& study_uid,
+    lock_entry& entry,
+    lock_type type,
+    const std::string& reason,
+    const std::string& holder,
+    std::chrono::seconds timeout) -> lock_token {
+    const auto now = std::chrono::system_clock::now();
+    const auto token_id = generate_token_id();
+
+    if (entry.holders.empty()) {
+        entry.info = lock_info{};
+        entry.info.study_uid = study_uid;
+        entry.info.type = type;
+        entry.info.reason = reason;
+        entry.info.holder = holder;
+        entry.info.token_id = token_id;
+        entry.info.acquired_at = now;
+        entry.info.expires_at = calculate_expiry(timeout);
+        if (entry.info.expires_at) {
+            schedule_expiry(study_uid, *entry.info.expires_at);
+        }
+    }
+    entry.holders.push_back({token_id, holder, now});
+    entry.info.shared_count = (type == lock_type::shared) ? entry.holders.size() : 0;
+
+    record_acquisition();
+
+    lock_token token;
+    token.token_id = token_id;
+    token.study_uid = study_uid;
+    token.type = type;
+    token.acquired_at = now;
+    token.expires_at = entry.info.expires_at;
+    return token;
+}
+
+void study_lock_manager::remove_holder(lock_entry& entry, std::size_t index) {
+    record_release(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now() - entry.holders[index].acquired_at));
+    entry.holders.erase(entry.holders.begin() + static_cast<std::ptrdiff_t>(index));
+
+    if (!entry.holders.empty()) {
+        // The lock is now reported under the longest remaining holder
+        entry.info.holder = entry.holders.front().holder;
+        entry.info.token_id = entry.holders.front().token_id;
+        if (entry.info.type == lock_type::shared) {
+            entry.info.shared_count = entry.holders.size();
+        }
+    }
+}
+
+void study_lock_manager::grant_waiters(const std::string& study_uid,
+                                       lock_entry& entry) {
+    while (!entry.waiters.empty()) {
+        auto* waiter = entry.waiters.front();
+
+        if (!waiter->upgrade_token.empty()) {
+            const auto holder_it = std::find_if(
+                entry.holders.begin(), entry.holders.end(),
+                [&](const lock_holder& h) { return h.token_id == waiter->upgrade_token; });
+            if (holder_it == entry.holders.end()) {
+                // The shared lock was released, forced or expired meanwhile
+                waiter->error = lock_error::not_found;
+            } else if (entry.holders.size() == 1) {
+                entry.info.type = lock_type::exclusive;
+                entry.info.shared_count = 0;
+                waiter->token.token_id = waiter->upgrade_token;
+                waiter->token.study_uid = study_uid;
+                waiter->token.type = lock_type::exclusive;
+                waiter->token.expires_at = entry.info.expires_at;
+                waiter->info = entry.info;
+            } else {
+                return;
+            }
+        } else {
+            if (!can_grant(entry, waiter->type)) {
+                return;
+            }
+            waiter->token = add_holder(study_uid, entry, waiter->type,
+                                       waiter->reason, waiter->holder,
+                                       waiter->timeout);
+            waiter->info = entry.info;
+            waiter->info.token_id = waiter->token.token_id;
+            waiter->info.holder = waiter->holder;
+        }
+
+        entry.waiters.pop_front();
+        waiter->done = true;
+        waiter->cv.notify_one();
+    }
+}
+
+auto study_lock_manager::expire_if_stale(const std::string& study_uid,
+                                         lock_entry& entry,
+                                         pending_events& expired) -> bool {
+    if (entry.holders.empty() || !entry.info.is_expired()) {
+        return false;
+    }
+
+    expired.emplace_back(study_uid, entry.info);
+    entry.holders.clear();
+    ++expired_count_;
+    grant_waiters(study_uid, entry);
+    return true;
+}
+
+void study_lock_manager::erase_if_unused(
+    lock_shard& shard,
+    std::unordered_map<std::string, lock_entry>::iterator it) {
+    if (it->second.holders.empty() && it->second.waiters.empty()) {
+        shard.locks.erase(it);
+    }
+}
+
+auto study_lock_manager::wait_for_grant(
+    std::unique_lock<std::shared_mutex>& lock,
+    const std::string& study_uid,
+    lock_waiter& waiter,
+    std::chrono::milliseconds wait) -> kcenon::common::Result<lock_token> {
+    auto& shard = shard_for(study_uid);
+    const auto deadline = std::chrono::steady_clock::now() + wait;
+    waiter.cv.wait_until(lock, deadline, [&] { return waiter.done; });
+
+    if (!waiter.done) {
+        // Leave the queue; requests behind this one may now be grantable
+        auto it = shard.locks.find(study_uid);
+        auto& waiters = it->second.waiters;
+        waiters.erase(std::find(waiters.begin(), waiters.end(), &waiter));
+        grant_waiters(study_uid, it->second);
+        erase_if_unused(shard, it);
+        ++timeout_count_;
+        return lock_failure(lock_error::timeout,
+                            "Timed out waiting for lock on study: " + study_uid);
+    }
+
+    if (waiter.error != 0) {
+        // The release that failed the upgrade may have erased the entry
+        auto it = shard.locks.find(study_uid);
+        if (it != shard.locks.end()) {
+            erase_if_unused(shard, it);
+        }
+        return lock_failure(waiter.error, "Lock was released while upgrading");
+    }
+
+    lock.unlock();
+    if (waiter.upgrade_token.empty()) {
+        notify(on_lock_acquired_, {{study_uid, waiter.info}});
+    }
+    return lock_result::ok(waiter.token);
+}
+
+void study_lock_manager::notify(const lock_event_callback& callback,
+                                const pending_events& events) const {
+    if (!callback) {
+        return;
+    }
+    for (const auto& [study_uid, info] : events) {
+        callback(study_uid, info);
+    }
+}
+
+// =============================================================================
+// Internal Methods - Expiry Timer Wheel
+// =============================================================================
+
+void study_lock_manager::schedule_expiry(
+    const std::string& study_uid,
+    std::chrono::system_clock::time_point deadline) {
+    if (!expiry_running_) {
+        return;  // Expired locks are removed lazily on access
+    }
+
+    const auto tick = current_config().expiry_tick;
+    std::lock_guard lock{wheel_->mutex};
+    const auto offset = deadline > wheel_->cursor_time
+                            ? static_cast<std::size_t>((deadline - wheel_->cursor_time) / tick)
+                            : std::size_t{0};
+    const auto slot = (wheel_->cursor + offset) % expiry_wheel::slot_count;
+    wheel_->slots[slot].emplace_back(deadline, study_uid);
+}
+
+void study_lock_manager::process_expiry_tick() {
+    const auto tick = current_config().expiry_tick;
+    const auto now = std::chrono::system_clock::now();
+    std::vector<std::string> due;
+
+    {
+        std::lock_guard lock{wheel_->mutex};
+        auto& wheel = *wheel_;
+
+        // After a long stall (or a clock jump), visit each slot once
+        std::size_t steps = 0;
+        while (wheel.cursor_time + tick <= now && steps < expiry_wheel::slot_count) {
+            auto& slot = wheel.slots[wheel.cursor];
+            auto keep = std::partition(slot.begin(), slot.end(), [&](const auto& item) {
+                return item.first > now;  // due in a later revolution
+            });
+            for (auto it = keep; it != slot.end(); ++it) {
+                due.push_back(std::move(it->second));
+            }
+            slot.erase(keep, slot.end());
+            wheel.cursor = (wheel.cursor + 1) % expiry_wheel::slot_count;
+            wheel.cursor_time += tick;
+            ++steps;
+        }
+        if (wheel.cursor_time + tick <= now) {
+            wheel.cursor_time = now;
+        }
+    }
+
+    for (const auto& study_uid : due) {
+        auto& shard = shard_for(study_uid);
+        pending_events expired;
+        {
+            std::unique_lock lock{shard.mutex};
+            auto it = shard.locks.find(study_uid);
+            if (it == shard.locks.end()) {
+                continue;
+            }
+            // Refreshed or re-acquired locks carry a later deadline
+            expire_if_stale(study_uid, it->second, expired);
+            erase_if_unused(shard, it);
+        }
+        notify(on_lock_expired_, expired);
+    }
+}
+
+void study_lock_manager::start_expiry_timer() {
+    if (!config_.auto_cleanup || config_.expiry_tick.count() <= 0) {
+        return;
+    }
+
+    const auto tick = config_.expiry_tick;
+    expiry_stop_ = false;
+    expiry_running_ = true;
+
+    expiry_thread_ = std::thread([this, tick] {
+        std::unique_lock lock{expiry_mutex_};
+        while (!expiry_cv_.wait_for(lock, tick,
+                                    [this] { return expiry_stop_; })) {
+            lock.unlock();
+            process_expiry_tick();
+            lock.lock();
+        }
+    });
+}
+
+void study_lock_manager::stop_expiry_timer() {
+    if (!expiry_thread_.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard lock{expiry_mutex_};
+        expiry_stop_ = true;
+    }
+    expiry_cv_.notify_all();
+    expiry_thread_.join();
+    expiry_running_ = false;
+}
+
+// =============================================================================
+// Internal Methods - Helpers
 // =============================================================================
 
 auto study_lock_manager::generate_token_id() const -> std::string {
@@ -812,7 +1016,8 @@ auto study_lock_manager::resolve_holder(const std::string& holder) const
 
 auto study_lock_manager::calculate_expiry(std::chrono::seconds timeout) const
     -> std::optional<std::chrono::system_clock::time_point> {
-    auto effective_timeout = timeout.count() > 0 ? timeout : config_.default_timeout;
+    auto effective_timeout =
+        timeout.count() > 0 ? timeout : current_config().default_timeout;
     if (effective_timeout.count() <= 0) {
         return std::nullopt;  // No expiration
     }
@@ -820,54 +1025,23 @@ auto study_lock_manager::calculate_expiry(std::chrono::seconds timeout) const
     return std::chrono::system_clock::now() + effective_timeout;
 }
 
-auto study_lock_manager::can_acquire_lock(
-    const std::string& study_uid,
-    lock_type type) const -> bool {
-    auto it = locks_.find(study_uid);
-    if (it == locks_.end()) {
-        return true;
-    }
-
-    if (it->second.info.is_expired()) {
-        return true;
-    }
-
-    // Shared locks can coexist with other shared locks
-    if (type == lock_type::shared &&
-        it->second.info.type == lock_type::shared) {
-        return it->second.shared_holders.size() < config_.max_shared_locks;
-    }
-
-    return false;
+auto study_lock_manager::current_config() const -> study_lock_manager_config {
+    std::shared_lock lock{config_mutex_};
+    return config_;
 }
 
-void study_lock_manager::record_acquisition(lock_type type) {
-    std::lock_guard stats_lock{stats_mutex_};
-    ++stats_.total_acquisitions;
-    (void)type;  // Type-specific stats are calculated in get_stats()
+void study_lock_manager::record_acquisition() {
+    ++total_acquisitions_;
 }
 
-void study_lock_manager::record_release(
-    lock_type type,
-    std::chrono::milliseconds duration) {
-    std::lock_guard stats_lock{stats_mutex_};
-    ++stats_.total_releases;
-
-    // Update average duration
-    if (stats_.total_releases > 0) {
-        auto total_duration =
-            stats_.avg_lock_duration.count() * (stats_.total_releases - 1) +
-            duration.count();
-        stats_.avg_lock_duration =
-            std::chrono::milliseconds{total_duration / stats_.total_releases};
-    }
+void study_lock_manager::record_release(std::chrono::milliseconds duration) {
+    ++total_releases_;
+    total_duration_ms_ += duration.count();
 
-    // Update max duration
-    if (duration > stats_.max_lock_duration) {
-        stats_.max_lock_duration = duration;
+    auto max = max_duration_ms_.load();
+    while (duration.count() > max &&
+           !max_duration_ms_.compare_exchange_weak(max, duration.count())) {
     }
-
-    (void)type;  // Type-specific stats are calculated in get_stats()
 }
 
 }  // namespace kcenon::pacs::workflow
@@ -10,6 +10,8 @@
 #include "kcenon/pacs/workflow/task_scheduler.h"
 #include "kcenon/pacs/storage/index_database.h"
 #include "kcenon/pacs/storage/file_storage.h"
+#include "kcenon/pacs/storage/fixity_scrubber.h"
+#include "kcenon/pacs/storage/retention_engine.h"
 #include "kcenon/pacs/integration/logger_adapter.h"
 #include "kcenon/pacs/integration/monitoring_adapter.h"
 #include "kcenon/pacs/integration/executor_adapter.h"
@@ -1107,112 +1109,46 @@ auto task_scheduler::generate_execution_id() const -> std::string {
 
 auto task_scheduler::create_cleanup_callback(const cleanup_config& config)
     -> task_callback_with_result {
-    return [this, config]() -> std::optional<std::string> {
+    storage::retention_engine_config engine_config;
+    engine_config.default_retention = config.default_retention;
+    engine_config.modality_retention = config.modality_retention;
+    engine_config.exclude_patterns = config.exclude_patterns;
+    engine_config.dry_run = config.dry_run;
+    engine_config.database_only = config.database_only;
+    engine_config.batch_size = config.batch_size;
+    engine_config.max_deletions_per_run = config.max_deletions_per_cycle;
+    engine_config.unlink_workers = config.unlink_workers;
+    engine_config.max_unlinks_per_second = config.max_unlinks_per_second;
+    auto engine = std::make_shared<storage::retention_engine>(
+        database_, file_storage_, std::move(engine_config));
+
+    return [config, engine]() -> std::optional<std::string> {
         integration::logger_adapter::info(
-            "Running cleanup task retention_days={}",
-            config.default_retention.count());
+            "Running cleanup task retention_days={} dry_run={}",
+            config.default_retention.count(), config.dry_run);
 
         try {
-            // Calculate cutoff date
-            auto now = std::chrono::system_clock::now();
-            auto cutoff = now - config.default_retention;
-
-            // Convert to YYYYMMDD format for database query
-            auto cutoff_time_t = std::chrono::system_clock::to_time_t(cutoff);
-            std::tm tm = *std::localtime(&cutoff_time_t);
-            std::ostringstream date_oss;
-            date_oss << std::put_time(&tm, "%Y%m%d");
-            std::string cutoff_date = date_oss.str();
-
-            // Query for studies older than cutoff
-            storage::study_query query;
-            query.study_date_to = cutoff_date;
-            query.limit = config.max_deletions_per_cycle;
-
-            auto studies_result = database_.search_studies(query);
-            if (!studies_result.is_ok()) {
+            auto report = engine->run();
+            if (!report.error.empty()) {
                 integration::logger_adapter::error(
-                    "Failed to query studies error={}",
-                    studies_result.error().message);
-                return "Cleanup failed: " + studies_result.error().message;
-            }
-
-            std::size_t deleted_count = 0;
-            std::size_t skipped_count = 0;
-
-            for (const auto& study : studies_result.value()) {
-                // Check modality-specific retention
-                auto modality_retention = config.retention_for(study.modalities_in_study);
-                auto modality_cutoff = now - modality_retention;
-                auto modality_cutoff_t = std::chrono::system_clock::to_time_t(modality_cutoff);
-                std::tm mod_tm = *std::localtime(&modality_cutoff_t);
-                std::ostringstream mod_oss;
-                mod_oss << std::put_time(&mod_tm, "%Y%m%d");
-                std::string modality_cutoff_date = mod_oss.str();
-
-                // Skip if study is newer than modality-specific retention
-                if (study.study_date > modality_cutoff_date) {
-                    ++skipped_count;
-                    continue;
-                }
-
-                // Check exclusion patterns
-                bool excluded = false;
-                for (const auto& pattern : config.exclude_patterns) {
-                    if (study.study_description.find(pattern) != std::string::npos) {
-                        excluded = true;
-                        break;
-                    }
-                }
-                if (excluded) {
-                    ++skipped_count;
-                    continue;
-                }
-
-                if (config.dry_run) {
-                    integration::logger_adapter::info(
-                        "Dry-run: would delete study study_uid={} study_date={} modality={}",
-                        study.study_uid, study.study_date, study.modalities_in_study);
-                    ++deleted_count;
-                    continue;
-                }
-
-                // Delete files from storage if not database_only
-                if (!config.database_only && file_storage_ != nullptr) {
-                    auto file_paths_result = database_.get_study_files(study.study_uid);
-                    if (file_paths_result.is_ok()) {
-                        for (const auto& file_path : file_paths_result.value()) {
-                            // Extract SOP UID from file path for removal
-                            std::filesystem::path p(file_path);
-                            std::string sop_uid = p.stem().string();
-                            auto remove_result = file_storage_->remove(sop_uid);
-                            if (remove_result.is_err()) {
-                                integration::logger_adapter::warn(
-                                    "Failed to remove file file_path={} error={}",
-                                    file_path, remove_result.error().message);
-                            }
-                        }
-                    }
-                }
-
-                // Delete from database
-                auto delete_result = database_.delete_study(study.study_uid);
-                if (delete_result.is_err()) {
-                    integration::logger_adapter::error(
-                        "Failed to delete study study_uid={} error={}",
-                        study.study_uid, delete_result.error().message);
-                    continue;
-                }
-
-                ++deleted_count;
-                integration::logger_adapter::debug(
-                    "Deleted study study_uid={} study_date={}",
-                    study.study_uid, study.study_date);
+                    "Cleanup stopped error={} deleted={}",
+                    report.error, report.studies_deleted);
+                return "Cleanup failed: " + report.error;
             }
 
             integration::logger_adapter::info(
-                "Cleanup task completed deleted={} skipped={} dry_run={}",
-                deleted_count, skipped_count, config.dry_run);
+                "Cleanup task completed matched={} deleted={} batches={} "
+                "files_queued={} files_unlinked={} unlink_failures={} "
+                "elapsed_ms={} completed={} dry_run={}",
+                report.studies_matched, report.studies_deleted, report.batches,
+                report.files_queued, report.files_unlinked, report.unlink_failures,
+                report.elapsed.count(), report.completed, config.dry_run);
+
+            if (report.unlink_failures > 0) {
+                integration::logger_adapter::warn(
+                    "Files left queued for the next cleanup count={}",
+                    report.unlink_failures);
+            }
 
             return std::nullopt;  // Success
         } catch (const std::exception& e) {
@@ -1355,16 +1291,25 @@ auto task_scheduler::create_archive_callback(const archive_config& config)
 
 auto task_scheduler::create_verification_callback(const verification_config& config)
     -> task_callback_with_result {
-    return [this, config]() -> std::optional<std::string> {
+    storage::fixity_scrubber_config scrubber_config;
+    scrubber_config.worker_count = config.worker_count;
+    scrubber_config.max_instances_per_run = config.max_verifications_per_cycle;
+    scrubber_config.max_bytes_per_second = config.max_bytes_per_second;
+    scrubber_config.max_iops = config.max_iops;
+    scrubber_config.verify_content = config.check_checksums;
+    scrubber_config.checkpoint_path = config.checkpoint_path;
+    auto scrubber = std::make_shared<storage::fixity_scrubber>(
+        database_, std::move(scrubber_config));
+
+    return [this, config, scrubber]() -> std::optional<std::string> {
         integration::logger_adapter::info(
-            "Running verification task check_checksums={} check_db={}",
+            "Running verification task check_checksums={} check_db={} resume_after={}",
             config.check_checksums,
-            config.check_db_consistency);
+            config.check_db_consistency,
+            scrubber->checkpoint());
 
         try {
-            std::size_t verified = 0;
             std::size_t errors = 0;
-            std::size_t missing_files = 0;
 
             // Database integrity check
             if (config.check_db_consistency) {
@@ -1379,68 +1324,28 @@ auto task_scheduler::create_verification_callback(const verification_config& con
                 }
             }
 
-            // Get studies for verification
-            storage::study_query query;
-            query.limit = config.max_verifications_per_cycle;
-            auto studies_result = database_.search_studies(query);
-            if (!studies_result.is_ok()) {
+            // Re-verify stored files against their ingest hashes
+            auto report = scrubber->run();
+            if (!report.error.empty()) {
                 integration::logger_adapter::error(
-                    "Failed to query studies error={}",
-                    studies_result.error().message);
-                return "Verification failed: " + studies_result.error().message;
+                    "Failed to list instances error={}", report.error);
+                return "Verification failed: " + report.error;
             }
 
-            for (const auto& study : studies_result.value()) {
-                // Get all files for this study
-                auto file_paths_result = database_.get_study_files(study.study_uid);
-                if (!file_paths_result.is_ok()) {
-                    integration::logger_adapter::error(
-                        "Failed to get study files study_uid={} error={}",
-                        study.study_uid, file_paths_result.error().message);
-                    ++errors;
-                    continue;
-                }
-
-                for (const auto& file_path : file_paths_result.value()) {
-                    std::filesystem::path path(file_path);
-
-                    // Check file existence
-                    if (!std::filesystem::exists(path)) {
-                        ++missing_files;
-                        integration::logger_adapter::warn(
-                            "Missing file detected file_path={} study_uid={}",
-                            file_path, study.study_uid);
-
-                        if (config.repair_on_failure) {
-                            // Extract SOP UID and remove orphaned database record
-                            std::string sop_uid = path.stem().string();
-                            (void)database_.delete_instance(sop_uid);
-                            integration::logger_adapter::info(
-                                "Removed orphaned database record sop_uid={}", sop_uid);
-                        }
-                        continue;
-                    }
-
-                    // Checksum verification
-                    if (config.check_checksums) {
-                        // Get file size as basic verification
-                        // Full checksum verification would require storing checksums in DB
-                        try {
-                            auto file_size = std::filesystem::file_size(path);
-                            if (file_size == 0) {
-                                ++errors;
-                                integration::logger_adapter::warn(
-                                    "Empty file detected file_path={}", file_path);
-                            }
-                        } catch (const std::filesystem::filesystem_error& e) {
-                            ++errors;
-                            integration::logger_adapter::error(
-                                "Cannot read file file_path={} error={}",
-                                file_path, e.what());
-                        }
-                    }
-
-                    ++verified;
+            for (const auto& failure : report.failures) {
+                integration::logger_adapter::warn(
+                    "Fixity check failed status={} sop_uid={} file_path={} "
+                    "expected={} actual={}",
+                    storage::to_string(failure.status), failure.sop_instance_uid,
+                    failure.file_path, failure.expected, failure.actual);
+
+                if (config.repair_on_failure &&
+                    failure.status == storage::fixity_status::missing) {
+                    // Remove the orphaned database record
+                    (void)database_.delete_instance(failure.sop_instance_uid);
+                    integration::logger_adapter::info(
+                        "Removed orphaned database record sop_uid={}",
+                        failure.sop_instance_uid);
                 }
             }
 
@@ -1455,13 +1360,18 @@ auto task_scheduler::create_verification_callback(const verification_config& con
             }
 
             integration::logger_adapter::info(
-                "Verification task completed verified={} errors={} missing_files={}",
-                verified, errors, missing_files);
-
-            if (errors > 0 || missing_files > 0) {
+                "Verification task completed checked={} verified={} backfilled={} "
+                "mismatched={} missing_files={} unreadable={} bytes={} "
+                "elapsed_ms={} pass_completed={}",
+                report.checked, report.verified, report.backfilled,
+                report.mismatched, report.missing, report.unreadable,
+                report.bytes_read, report.elapsed.count(), report.pass_completed);
+
+            errors += report.mismatched + report.unreadable;
+            if (errors > 0 || report.missing > 0) {
                 std::ostringstream oss;
                 oss << "Verification found " << errors << " errors and "
-                    << missing_files << " missing files";
+                    << report.missing << " missing files";
                 return oss.str();
             }
 
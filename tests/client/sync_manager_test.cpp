@@ -8,10 +8,13 @@
 
 #include <kcenon/pacs/client/sync_manager.h>
 #include <kcenon/pacs/client/sync_types.h>
+#include <kcenon/pacs/compat/format.h>
 #include <kcenon/pacs/di/ilogger.h>
+#include <kcenon/pacs/storage/index_database.h>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <memory>
@@ -330,3 +333,163 @@ TEST_CASE("sync_history initialization", "[sync_types]") {
     CHECK(history.studies_synced == 50);
     CHECK(history.conflicts_found == 5);
 }
+
+// =============================================================================
+// Digest Reconciliation Tests
+// =============================================================================
+
+namespace {
+
+using kcenon::pacs::storage::index_database;
+
+auto open_archive() -> std::shared_ptr<index_database> {
+    auto result = index_database::open(":memory:");
+    REQUIRE(result.is_ok());
+    return std::shared_ptr<index_database>(std::move(result.value()));
+}
+
+/// Index a CT study with @p instances instances
+void add_study(index_database& db, const std::string& study_uid,
+               std::string_view study_date, int instances) {
+    auto patient_pk = db.upsert_patient("P001", "TEST^PATIENT");
+    REQUIRE(patient_pk.is_ok());
+    auto study_pk = db.upsert_study(patient_pk.value(), study_uid, "", study_date);
+    REQUIRE(study_pk.is_ok());
+    auto series_pk = db.upsert_series(study_pk.value(), study_uid + ".1", "CT");
+    REQUIRE(series_pk.is_ok());
+    for (int i = 1; i <= instances; ++i) {
+        const auto sop_uid = study_uid + ".1." + std::to_string(i);
+        REQUIRE(db.upsert_instance(series_pk.value(), sop_uid,
+                                   "1.2.840.10008.5.1.4.1.1.2",
+                                   "/storage/" + sop_uid + ".dcm", 1024)
+                    .is_ok());
+    }
+}
+
+/// Two archives sharing most studies, and a manager comparing them
+struct digest_sync_fixture {
+    std::shared_ptr<index_database> local = open_archive();
+    std::shared_ptr<index_database> remote = open_archive();
+    std::shared_ptr<std::atomic<size_t>> children_calls =
+        std::make_shared<std::atomic<size_t>>(0);
+    sync_manager manager{sync_repositories{}, nullptr, nullptr, nullptr};
+
+    digest_sync_fixture() {
+        for (int day = 1; day <= 28; ++day) {
+            const auto date = kcenon::pacs::compat::format("202403{:02d}", day);
+            for (int n = 0; n < 3; ++n) {
+                const auto uid = kcenon::pacs::compat::format("1.2.{}.{}", day, n);
+                add_study(*local, uid, date, 2);
+                add_study(*remote, uid, date, 2);
+            }
+        }
+
+        sync_config config;
+        config.config_id = "digest";
+        config.source_node_id = "peer";
+        config.lookback = std::chrono::hours(24 * 365 * 50);
+        REQUIRE(manager.add_config(config).is_ok());
+
+        manager.set_local_database(local);
+        sync_digest_provider provider;
+        provider.children = [remote = remote, calls = children_calls](
+                                const std::string&, const std::string& key,
+                                const kcenon::pacs::storage::study_digest_scope& scope)
+            -> std::optional<std::vector<kcenon::pacs::storage::study_digest_node>> {
+            ++*calls;
+            auto children = remote->study_digest_children(key, scope);
+            if (children.is_err()) {
+                return std::nullopt;
+            }
+            return children.value();
+        };
+        provider.members = [remote = remote](const std::string&, const std::string& key)
+            -> std::optional<std::vector<kcenon::pacs::storage::study_digest_entry>> {
+            auto members = remote->study_digest_members(key);
+            if (members.is_err()) {
+                return std::nullopt;
+            }
+            return members.value();
+        };
+        manager.set_digest_provider(std::move(provider));
+    }
+};
+
+auto find_conflict(const sync_result& result, const std::string& study_uid)
+    -> const sync_conflict* {
+    auto it = std::find_if(result.conflicts.begin(), result.conflicts.end(),
+                           [&](const auto& c) { return c.study_uid == study_uid; });
+    return it == result.conflicts.end() ? nullptr : &*it;
+}
+
+}  // namespace
+
+TEST_CASE("sync_manager: identical archives compare by root only",
+          "[sync_manager][digest]") {
+    digest_sync_fixture fixture;
+
+    auto result = fixture.manager.compare("digest");
+
+    CHECK(result.success);
+    CHECK(result.errors.empty());
+    CHECK(result.conflicts.empty());
+    CHECK(result.studies_checked == 28 * 3);
+    CHECK(result.buckets_reconciled == 0);
+    CHECK(*fixture.children_calls == 1);
+}
+
+TEST_CASE("sync_manager: digest descent lists only differing buckets",
+          "[sync_manager][digest]") {
+    digest_sync_fixture fixture;
+    add_study(*fixture.remote, "1.2.99.1", "20240305", 1);  // pulled
+    add_study(*fixture.local, "1.2.99.2", "20240317", 4);   // pushed
+
+    // One more instance of an existing study remotely
+    auto series = fixture.remote->find_series("1.2.10.0.1");
+    REQUIRE(series.has_value());
+    REQUIRE(fixture.remote->upsert_instance(
+        series->pk, "1.2.10.0.1.3", "1.2.840.10008.5.1.4.1.1.2",
+        "/storage/1.2.10.0.1.3.dcm", 1024).is_ok());
+
+    auto result = fixture.manager.compare("digest");
+
+    REQUIRE(result.errors.empty());
+    CHECK(result.buckets_reconciled == 3);
+    REQUIRE(result.conflicts.size() == 3);
+
+    const auto* missing_local = find_conflict(result, "1.2.99.1");
+    REQUIRE(missing_local != nullptr);
+    CHECK(missing_local->conflict_type == sync_conflict_type::missing_local);
+
+    const auto* missing_remote = find_conflict(result, "1.2.99.2");
+    REQUIRE(missing_remote != nullptr);
+    CHECK(missing_remote->conflict_type == sync_conflict_type::missing_remote);
+    CHECK(missing_remote->local_instance_count == 4);
+
+    const auto* mismatch = find_conflict(result, "1.2.10.0");
+    REQUIRE(mismatch != nullptr);
+    CHECK(mismatch->conflict_type == sync_conflict_type::count_mismatch);
+    CHECK(mismatch->local_instance_count == 2);
+    CHECK(mismatch->remote_instance_count == 3);
+
+    // Root, one month, and the three differing days
+    CHECK(*fixture.children_calls == 5);
+}
+
+TEST_CASE("sync_manager: falls back to C-FIND without remote digests",
+          "[sync_manager][digest]") {
+    digest_sync_fixture fixture;
+    sync_digest_provider unsupported;
+    unsupported.children = [](const std::string&, const std::string&,
+                              const kcenon::pacs::storage::study_digest_scope&)
+        -> std::optional<std::vector<kcenon::pacs::storage::study_digest_node>> {
+        return std::nullopt;
+    };
+    fixture.manager.set_digest_provider(std::move(unsupported));
+
+    // The fallback needs a node manager, which this manager lacks
+    auto result = fixture.manager.compare("digest");
+    CHECK_FALSE(result.success);
+    REQUIRE_FALSE(result.errors.empty());
+    CHECK(result.errors.front() == "No remote node manager");
+}
@@ -8,6 +8,12 @@
 #include "kcenon/pacs/core/dicom_dictionary.h"
 #include "kcenon/pacs/encoding/vr_type.h"
 
+#include <atomic>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace kcenon::pacs::core;
 using kcenon::pacs::encoding::vr_type;
 
@@ -313,3 +319,126 @@ TEST_CASE("dicom_dictionary common clinical tags", "[dicom_dictionary]") {
         CHECK(dict.contains_keyword("RequestedProcedureID"));
     }
 }
+
+TEST_CASE("dicom_dictionary covers the full registry", "[dicom_dictionary]") {
+    auto& dict = dicom_dictionary::instance();
+
+    CHECK(dict.standard_tag_count() > 5000);
+
+    size_t seen = 0;
+    for (uint32_t group = 0; group <= 0xFFFF; group += 2) {
+        for (const auto& info : dict.get_tags_in_group(static_cast<uint16_t>(group))) {
+            ++seen;
+            const auto* by_tag = dict.lookup(info.tag);
+            REQUIRE(by_tag != nullptr);
+            CHECK(by_tag->keyword == info.keyword);
+            if (!info.keyword.empty()) {
+                const auto* by_keyword = dict.lookup_keyword(info.keyword);
+                REQUIRE(by_keyword != nullptr);
+                CHECK(by_keyword->tag == info.tag);
+            }
+        }
+    }
+    CHECK(seen == dict.standard_tag_count());
+}
+
+TEST_CASE("dicom_dictionary repeating group tags", "[dicom_dictionary]") {
+    auto& dict = dicom_dictionary::instance();
+
+    SECTION("Overlay data in any even overlay group") {
+        for (uint16_t group : {0x6000, 0x6002, 0x601E}) {
+            const auto* info = dict.lookup(dicom_tag{group, 0x3000});
+            REQUIRE(info != nullptr);
+            CHECK(info->keyword == "OverlayData");
+            CHECK(info->vr == static_cast<uint16_t>(vr_type::OW));
+        }
+        CHECK(dict.lookup(dicom_tag{0x6001, 0x3000}) == nullptr);
+    }
+
+    SECTION("Element wildcards") {
+        const auto* rows = dict.lookup(dicom_tag{0x0028, 0x0430});
+        REQUIRE(rows != nullptr);
+        CHECK(rows->keyword == "RowsForNthOrderCoefficients");
+
+        // (0028,0400) is a regular entry, not an instance of (0028,04x0)
+        const auto* label = dict.lookup(dicom_tag{0x0028, 0x0400});
+        REQUIRE(label != nullptr);
+        CHECK(label->keyword == "TransformLabel");
+    }
+}
+
+TEST_CASE("dicom_dictionary private overlay grows", "[dicom_dictionary]") {
+    auto& dict = dicom_dictionary::instance();
+    static std::deque<std::string> keywords;
+
+    const auto before = dict.private_tag_count();
+    for (uint16_t i = 0; i < 300; ++i) {
+        keywords.push_back("GrowthTest" + std::to_string(i));
+        CHECK(dict.register_private_tag(tag_info{
+            dicom_tag{0x0011, static_cast<uint16_t>(0x1000 + i)},
+            static_cast<uint16_t>(vr_type::LO), value_multiplicity{1, 1},
+            keywords.back(), keywords.back(), false}));
+    }
+    CHECK(dict.private_tag_count() == before + 300);
+    CHECK(dict.size() == dict.standard_tag_count() + dict.private_tag_count());
+
+    for (uint16_t i = 0; i < 300; ++i) {
+        const auto* info = dict.lookup(dicom_tag{0x0011, static_cast<uint16_t>(0x1000 + i)});
+        REQUIRE(info != nullptr);
+        CHECK(info->keyword == keywords[i]);
+        CHECK(dict.lookup_keyword(keywords[i]) == info);
+    }
+
+    auto group = dict.get_tags_in_group(0x0011);
+    CHECK(group.size() == 300);
+    for (size_t i = 1; i < group.size(); ++i) {
+        CHECK(group[i - 1].tag < group[i].tag);
+    }
+
+    CHECK_FALSE(dict.register_private_tag(tag_info{
+        dicom_tag{0x0011, 0x1000}, static_cast<uint16_t>(vr_type::LO),
+        value_multiplicity{1, 1}, "Duplicate", "Duplicate", false}));
+}
+
+TEST_CASE("dicom_dictionary lookups run during registration", "[dicom_dictionary]") {
+    auto& dict = dicom_dictionary::instance();
+    constexpr uint16_t kCount = 1000;
+
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                if (dict.lookup(dicom_tag{0x0010, 0x0010}) == nullptr) {
+                    ++failures;
+                }
+                // Tags are registered in element order; scanning backwards,
+                // once one is visible every earlier one must be too
+                bool visible = false;
+                for (uint16_t i = kCount; i-- > 0;) {
+                    const bool found =
+                        dict.lookup(dicom_tag{0x0013, static_cast<uint16_t>(0x1000 + i)}) != nullptr;
+                    if (visible && !found) {
+                        ++failures;
+                    }
+                    visible = visible || found;
+                }
+            }
+        });
+    }
+
+    for (uint16_t i = 0; i < kCount; ++i) {
+        CHECK(dict.register_private_tag(tag_info{
+            dicom_tag{0x0013, static_cast<uint16_t>(0x1000 + i)},
+            static_cast<uint16_t>(vr_type::UL), value_multiplicity{1, 1},
+            "", "", false}));
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    CHECK(failures.load() == 0);
+    CHECK(dict.get_tags_in_group(0x0013).size() == kCount);
+}
@@ -8,6 +8,7 @@
 #include <kcenon/pacs/core/dicom_file.h>
 #include <kcenon/pacs/core/dicom_tag_constants.h>
 #include <kcenon/pacs/core/result.h>
+#include <kcenon/pacs/encoding/explicit_vr_codec.h>
 
 #include <cstring>
 #include <filesystem>
@@ -209,6 +210,28 @@ TEST_CASE("dicom_file reading from bytes", "[core][dicom_file]") {
     }
 }
 
+TEST_CASE("dicom_file reading only the header", "[core][dicom_file]") {
+    auto data = create_minimal_dicom_bytes();
+
+    auto header = dicom_file::read_header(data);
+
+    REQUIRE(header.is_ok());
+    CHECK(header.value().meta_info.contains(tags::media_storage_sop_class_uid));
+    CHECK(header.value().transfer_syntax ==
+          kcenon::pacs::encoding::transfer_syntax::explicit_vr_little_endian);
+
+    // The data set starts right after the File Meta Information
+    auto file = dicom_file::from_bytes(data);
+    REQUIRE(file.is_ok());
+    const auto rest = std::span<const uint8_t>(data).subspan(header.value().dataset_offset);
+    auto dataset = kcenon::pacs::encoding::explicit_vr_codec::decode(rest);
+    REQUIRE(dataset.is_ok());
+    CHECK(dataset.value().get_string(tags::patient_name) == "DOE^JOHN");
+
+    data[128] = 'X';
+    CHECK(dicom_file::read_header(data).is_err());
+}
+
 TEST_CASE("dicom_file reading from file", "[core][dicom_file]") {
     SECTION("non-existent file returns error") {
         auto result = dicom_file::open("/nonexistent/path/test.dcm");
@@ -864,6 +887,63 @@ TEST_CASE("dicom_file Explicit VR BE round-trip", "[core][dicom_file][big_endian
     }
 }
 
+// ============================================================================
+// Streaming Writes
+// ============================================================================
+
+TEST_CASE("dicom_file streamed save", "[core][dicom_file][save]") {
+    dicom_dataset ds;
+    ds.set_string(tags::sop_class_uid, vr_type::UI, "1.2.840.10008.5.1.4.1.1.2");
+    ds.set_string(tags::sop_instance_uid, vr_type::UI, "6.6.6");
+    ds.set_string(tags::patient_id, vr_type::LO, "ODD");
+
+    dicom_element seq{dicom_tag{0x0008, 0x1140}, vr_type::SQ};
+    dicom_dataset item;
+    item.set_string(tags::sop_instance_uid, vr_type::UI, "6.6.7");
+    seq.add_sequence_item(std::move(item));
+    ds.insert(std::move(seq));
+
+    std::vector<uint16_t> pixels(40000);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint16_t>(i);
+    }
+    ds.insert(dicom_element{
+        tags::pixel_data, vr_type::OW,
+        std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(pixels.data()),
+                                 pixels.size() * 2)});
+
+    for (const auto* ts : {&transfer_syntax::explicit_vr_little_endian,
+                           &transfer_syntax::implicit_vr_little_endian,
+                           &transfer_syntax::explicit_vr_big_endian}) {
+        const auto path = create_temp_file_path("pacs_streamed_save_test.dcm");
+        REQUIRE(dicom_file::save_dataset(path, ds, *ts).is_ok());
+
+        // Same bytes as the in-memory encoding
+        const auto file = dicom_file::create(ds, *ts);
+        const auto expected = file.to_bytes();
+        CHECK(std::filesystem::file_size(path) == expected.size());
+
+        auto opened = dicom_file::open(path);
+        std::filesystem::remove(path);
+        REQUIRE(opened.is_ok());
+
+        const auto& restored = opened.value().dataset();
+        CHECK(opened.value().transfer_syntax() == *ts);
+        CHECK(restored.get_string(tags::patient_id) == "ODD");
+
+        const auto* restored_seq = restored.get(dicom_tag{0x0008, 0x1140});
+        REQUIRE(restored_seq != nullptr);
+        REQUIRE(restored_seq->sequence_items().size() == 1);
+        CHECK(restored_seq->sequence_items()[0].get_string(tags::sop_instance_uid) == "6.6.7");
+
+        const auto* restored_pixels = restored.get(tags::pixel_data);
+        REQUIRE(restored_pixels != nullptr);
+        REQUIRE(restored_pixels->length() == pixels.size() * 2);
+        CHECK(std::memcmp(restored_pixels->raw_data().data(), pixels.data(),
+                          pixels.size() * 2) == 0);
+    }
+}
+
 // ============================================================================
 // Transfer Syntax Interoperability Tests (Issue #460)
 // ============================================================================
@@ -0,0 +1,236 @@
+/**
+ * @file frame_index_test.cpp
+ * @brief Unit tests for the Pixel Data frame index
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <kcenon/pacs/core/frame_index.h>
+#include <kcenon/pacs/core/result.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace kcenon::pacs::core;
+
+namespace {
+
+void write_le16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(static_cast<uint8_t>(value & 0xFF));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void write_le32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+/**
+ * @brief Append an Explicit VR Little Endian element
+ */
+void write_element(std::vector<uint8_t>& out, uint16_t group, uint16_t element,
+                   const char* vr, const std::vector<uint8_t>& value) {
+    write_le16(out, group);
+    write_le16(out, element);
+    out.push_back(static_cast<uint8_t>(vr[0]));
+    out.push_back(static_cast<uint8_t>(vr[1]));
+    const std::string vr_str(vr, 2);
+    if (vr_str == "OB" || vr_str == "OW" || vr_str == "SQ") {
+        write_le16(out, 0);
+        write_le32(out, static_cast<uint32_t>(value.size()));
+    } else {
+        write_le16(out, static_cast<uint16_t>(value.size()));
+    }
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+void write_item(std::vector<uint8_t>& out, uint16_t element, uint32_t length) {
+    write_le16(out, 0xFFFE);
+    write_le16(out, element);
+    write_le32(out, length);
+}
+
+/**
+ * @brief Build a Part 10 file header followed by image attributes
+ */
+auto make_header(const std::string& ts_uid, const std::string& frames)
+    -> std::vector<uint8_t> {
+    std::vector<uint8_t> data(128, 0);
+    data.insert(data.end(), {'D', 'I', 'C', 'M'});
+
+    std::vector<uint8_t> ts(ts_uid.begin(), ts_uid.end());
+    if (ts.size() & 1) {
+        ts.push_back(0);
+    }
+    write_element(data, 0x0002, 0x0010, "UI", ts);
+
+    write_element(data, 0x0028, 0x0002, "US", {1, 0});
+    std::vector<uint8_t> nf(frames.begin(), frames.end());
+    if (nf.size() & 1) {
+        nf.push_back(' ');
+    }
+    write_element(data, 0x0028, 0x0008, "IS", nf);
+
+    // Undefined-length sequence that must be skipped
+    write_le16(data, 0x0040);
+    write_le16(data, 0x0275);
+    data.insert(data.end(), {'S', 'Q', 0, 0});
+    write_le32(data, 0xFFFFFFFF);
+    write_item(data, 0xE000, 0xFFFFFFFF);
+    write_element(data, 0x0028, 0x0010, "US", {9, 9});
+    write_item(data, 0xE00D, 0);
+    write_item(data, 0xE0DD, 0);
+
+    write_element(data, 0x0028, 0x0010, "US", {4, 0});
+    write_element(data, 0x0028, 0x0011, "US", {4, 0});
+    write_element(data, 0x0028, 0x0100, "US", {8, 0});
+    return data;
+}
+
+/**
+ * @brief Encapsulated file with three 4-byte fragments and an empty BOT
+ */
+auto make_encapsulated_file() -> std::vector<uint8_t> {
+    auto data = make_header("1.2.840.10008.1.2.5", "3");
+    write_le16(data, 0x7FE0);
+    write_le16(data, 0x0010);
+    data.insert(data.end(), {'O', 'B', 0, 0});
+    write_le32(data, 0xFFFFFFFF);
+    write_item(data, 0xE000, 0);
+    for (uint8_t f = 0; f < 3; ++f) {
+        write_item(data, 0xE000, 4);
+        for (uint8_t i = 0; i < 4; ++i) {
+            data.push_back(static_cast<uint8_t>(f * 10 + i));
+        }
+    }
+    write_item(data, 0xE0DD, 0);
+    return data;
+}
+
+/**
+ * @brief Native file with two 4x4 8-bit frames
+ */
+auto make_native_file() -> std::vector<uint8_t> {
+    auto data = make_header("1.2.840.10008.1.2.1", "2");
+    std::vector<uint8_t> pixels(32);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>(i);
+    }
+    write_element(data, 0x7FE0, 0x0010, "OB", pixels);
+    return data;
+}
+
+auto write_file(const std::string& name, const std::vector<uint8_t>& data)
+    -> std::filesystem::path {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(data.data()),
+              static_cast<std::streamsize>(data.size()));
+    std::error_code ec;
+    std::filesystem::remove(frame_index::sidecar_path(path), ec);
+    return path;
+}
+
+void cleanup(const std::filesystem::path& path) {
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    std::filesystem::remove(frame_index::sidecar_path(path), ec);
+}
+
+}  // namespace
+
+TEST_CASE("frame_index over encapsulated pixel data", "[core][frame_index]") {
+    auto path = write_file("pacs_frame_index_encapsulated.dcm", make_encapsulated_file());
+
+    auto result = frame_index::build(path);
+    REQUIRE(result.is_ok());
+    const auto& index = result.value();
+
+    SECTION("frames are delimited by fragments") {
+        CHECK(index.frame_count() == 3);
+        CHECK(index.is_encapsulated());
+        CHECK(index.transfer_syntax_uid() == "1.2.840.10008.1.2.5");
+        CHECK(index.fragments(2).size() == 1);
+        CHECK(index.frame_size(3) == 4);
+    }
+
+    SECTION("a single frame is read from the file") {
+        auto frame = index.read_frame(path, 2);
+        REQUIRE(frame.is_ok());
+        CHECK(frame.value() == std::vector<uint8_t>{10, 11, 12, 13});
+    }
+
+    SECTION("out of range frames are rejected") {
+        CHECK(index.fragments(0).empty());
+        CHECK(index.read_frame(path, 4).is_err());
+    }
+
+    cleanup(path);
+}
+
+TEST_CASE("frame_index over native pixel data", "[core][frame_index]") {
+    auto path = write_file("pacs_frame_index_native.dcm", make_native_file());
+
+    auto result = frame_index::build(path);
+    REQUIRE(result.is_ok());
+    CHECK(result.value().frame_count() == 2);
+    CHECK_FALSE(result.value().is_encapsulated());
+
+    auto frame = result.value().read_frame(path, 2);
+    REQUIRE(frame.is_ok());
+    REQUIRE(frame.value().size() == 16);
+    CHECK(frame.value().front() == 16);
+    CHECK(frame.value().back() == 31);
+
+    cleanup(path);
+}
+
+TEST_CASE("frame_index sidecar persistence", "[core][frame_index]") {
+    auto path = write_file("pacs_frame_index_sidecar.dcm", make_encapsulated_file());
+
+    SECTION("load_or_build writes a sidecar that can be reloaded") {
+        auto built = frame_index::load_or_build(path);
+        REQUIRE(built.is_ok());
+        REQUIRE(std::filesystem::exists(frame_index::sidecar_path(path)));
+
+        auto loaded = frame_index::load(frame_index::sidecar_path(path));
+        REQUIRE(loaded.is_ok());
+        CHECK(loaded.value().frame_count() == 3);
+        CHECK(loaded.value().read_frame(path, 3).value() ==
+              std::vector<uint8_t>{20, 21, 22, 23});
+    }
+
+    SECTION("a replaced instance triggers a rebuild") {
+        REQUIRE(frame_index::load_or_build(path).is_ok());
+
+        // Overwrite the instance but keep the now stale sidecar
+        const auto native = make_native_file();
+        std::ofstream(path, std::ios::binary | std::ios::trunc)
+            .write(reinterpret_cast<const char*>(native.data()),
+                   static_cast<std::streamsize>(native.size()));
+        REQUIRE(std::filesystem::exists(frame_index::sidecar_path(path)));
+
+        auto rebuilt = frame_index::load_or_build(path);
+        REQUIRE(rebuilt.is_ok());
+        CHECK_FALSE(rebuilt.value().is_encapsulated());
+    }
+
+    SECTION("corrupt sidecars are rejected") {
+        std::ofstream(frame_index::sidecar_path(path)) << "garbage";
+        CHECK(frame_index::load(frame_index::sidecar_path(path)).is_err());
+    }
+
+    cleanup(path);
+}
+
+TEST_CASE("frame_index rejects files without pixel data", "[core][frame_index]") {
+    auto data = make_header("1.2.840.10008.1.2.1", "1");
+    auto path = write_file("pacs_frame_index_no_pixels.dcm", data);
+
+    CHECK(frame_index::build(path).is_err());
+
+    cleanup(path);
+}
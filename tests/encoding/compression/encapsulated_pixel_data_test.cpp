@@ -0,0 +1,87 @@
+#include <catch2/catch_test_macros.hpp>
+#include <kcenon/pacs/core/result.h>
+
+#include "kcenon/pacs/encoding/compression/encapsulated_pixel_data.h"
+
+#include <cstdint>
+#include <vector>
+
+using namespace kcenon::pacs::encoding::compression;
+
+namespace {
+
+void append_item(std::vector<uint8_t>& out, const std::vector<uint8_t>& value) {
+    const uint32_t length = static_cast<uint32_t>(value.size());
+    out.insert(out.end(), {0xFE, 0xFF, 0x00, 0xE0});
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(length >> (8 * i)));
+    }
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+}  // namespace
+
+TEST_CASE("Encapsulated pixel data build and split", "[compression][encapsulated]") {
+    std::vector<std::vector<uint8_t>> frames = {
+        {0x01, 0x02, 0x03},
+        {0x04, 0x05},
+        {0x06, 0x07, 0x08, 0x09, 0x0A},
+    };
+
+    auto encapsulated = build_encapsulated_pixel_data(frames);
+
+    SECTION("Frames are recovered through the Basic Offset Table") {
+        auto split = split_encapsulated_frames(encapsulated, 3);
+        REQUIRE(split.is_ok());
+        REQUIRE(split.value().size() == 3);
+        // Odd-length frames are padded to even length
+        CHECK(split.value()[0] == std::vector<uint8_t>{0x01, 0x02, 0x03, 0x00});
+        CHECK(split.value()[1] == frames[1]);
+    }
+
+    SECTION("Sequence ends with a delimitation item") {
+        REQUIRE(encapsulated.size() >= 8);
+        const std::vector<uint8_t> tail(encapsulated.end() - 8, encapsulated.end());
+        CHECK(tail == std::vector<uint8_t>{0xFE, 0xFF, 0xDD, 0xE0, 0, 0, 0, 0});
+    }
+
+    SECTION("Frame count mismatch is reported") {
+        CHECK(split_encapsulated_frames(encapsulated, 5).is_err());
+    }
+}
+
+TEST_CASE("Encapsulated pixel data without offset table", "[compression][encapsulated]") {
+    std::vector<uint8_t> data;
+    append_item(data, {});  // empty Basic Offset Table
+
+    SECTION("One fragment per frame") {
+        append_item(data, {0x10, 0x11});
+        append_item(data, {0x20, 0x21});
+        auto split = split_encapsulated_frames(data, 2);
+        REQUIRE(split.is_ok());
+        CHECK(split.value()[1] == std::vector<uint8_t>{0x20, 0x21});
+    }
+
+    SECTION("Single frame spanning several fragments") {
+        append_item(data, {0x10, 0x11});
+        append_item(data, {0x20, 0x21});
+        auto split = split_encapsulated_frames(data, 1);
+        REQUIRE(split.is_ok());
+        CHECK(split.value()[0] == std::vector<uint8_t>{0x10, 0x11, 0x20, 0x21});
+    }
+
+    SECTION("Frames delimited by JPEG end-of-image markers") {
+        append_item(data, {0xFF, 0xD8, 0x01, 0x02});
+        append_item(data, {0x03, 0x04, 0xFF, 0xD9});
+        append_item(data, {0xFF, 0xD8, 0xFF, 0xD9});
+        auto split = split_encapsulated_frames(data, 2);
+        REQUIRE(split.is_ok());
+        CHECK(split.value()[0].size() == 8);
+        CHECK(split.value()[1].size() == 4);
+    }
+
+    SECTION("Malformed data is rejected") {
+        std::vector<uint8_t> garbage = {0x00, 0x01, 0x02};
+        CHECK(split_encapsulated_frames(garbage, 1).is_err());
+    }
+}
@@ -5,6 +5,7 @@
 
 #include "kcenon/pacs/encoding/compression/jpeg_lossless_codec.h"
 #include "kcenon/pacs/encoding/compression/codec_factory.h"
+#include "kcenon/pacs/encoding/compression/encapsulated_pixel_data.h"
 #include "kcenon/pacs/encoding/compression/image_params.h"
 
 #include <algorithm>
@@ -527,3 +528,43 @@ TEST_CASE("image_params validation for JPEG Lossless", "[encoding][compression][
         REQUIRE(params.valid_for_jpeg_lossless() == false);
     }
 }
+
+TEST_CASE("jpeg_lossless_codec frame-parallel batch keeps the predictor",
+          "[encoding][compression][lossless]") {
+    // Predictor 7 is not what codec_factory builds, so helper workers that
+    // fell back to a default instance would emit different bitstreams
+    jpeg_lossless_codec codec(7, 0);
+
+    image_params params;
+    params.width = 48;
+    params.height = 32;
+    params.bits_allocated = 8;
+    params.bits_stored = 8;
+    params.high_bit = 7;
+    params.samples_per_pixel = 1;
+    params.number_of_frames = 8;
+
+    image_params frame_params = params;
+    frame_params.number_of_frames = 1;
+
+    std::vector<uint8_t> original;
+    std::vector<std::vector<uint8_t>> expected;
+    for (uint32_t f = 0; f < params.number_of_frames; ++f) {
+        auto frame = create_noise_image_8bit(params.width, params.height, f);
+        auto single = codec.encode(frame, frame_params);
+        REQUIRE(single.is_ok());
+        expected.push_back(std::move(single.value().data));
+        original.insert(original.end(), frame.begin(), frame.end());
+    }
+
+    frame_parallel_options parallel;
+    parallel.max_workers = 4;
+
+    auto encoded = codec.encode_frames(original, params, {}, parallel);
+    REQUIRE(encoded.is_ok());
+    REQUIRE(encoded.value().data == build_encapsulated_pixel_data(expected));
+
+    auto decoded = codec.decode_frames(encoded.value().data, params, parallel);
+    REQUIRE(decoded.is_ok());
+    REQUIRE(images_identical(original, decoded.value().data));
+}
@@ -650,3 +650,62 @@ TEST_CASE("rle_codec move semantics", "[encoding][compression][rle]") {
         REQUIRE(codec2.transfer_syntax_uid() == "1.2.840.10008.1.2.5");
     }
 }
+
+TEST_CASE("rle_codec frame-parallel batch", "[encoding][compression][rle]") {
+    rle_codec codec;
+
+    image_params params;
+    params.width = 32;
+    params.height = 24;
+    params.bits_allocated = 8;
+    params.bits_stored = 8;
+    params.high_bit = 7;
+    params.samples_per_pixel = 1;
+    params.number_of_frames = 9;
+
+    std::vector<uint8_t> original;
+    for (uint32_t f = 0; f < params.number_of_frames; ++f) {
+        auto frame = create_noise_image_8bit(params.width, params.height, f);
+        original.insert(original.end(), frame.begin(), frame.end());
+    }
+
+    frame_parallel_options parallel;
+    parallel.max_workers = 4;
+
+    SECTION("round trip preserves every frame") {
+        auto encoded = codec.encode_frames(original, params, {}, parallel);
+        REQUIRE(encoded.is_ok());
+
+        auto decoded = codec.decode_frames(encoded.value().data, params, parallel);
+        REQUIRE(decoded.is_ok());
+        REQUIRE(images_identical(original, decoded.value().data));
+        REQUIRE(decoded.value().output_params.number_of_frames == 9);
+    }
+
+    SECTION("output carries a Basic Offset Table entry per frame") {
+        auto encoded = codec.encode_frames(original, params, {}, parallel);
+        REQUIRE(encoded.is_ok());
+
+        const auto& data = encoded.value().data;
+        REQUIRE(data.size() >= 8);
+        const uint32_t bot_length = data[4] | (data[5] << 8) |
+                                    (data[6] << 16) | (data[7] << 24);
+        REQUIRE(bot_length == params.number_of_frames * 4);
+    }
+
+    SECTION("single worker produces the same bytes") {
+        frame_parallel_options serial;
+        serial.max_workers = 1;
+
+        auto parallel_result = codec.encode_frames(original, params, {}, parallel);
+        auto serial_result = codec.encode_frames(original, params, {}, serial);
+        REQUIRE(parallel_result.is_ok());
+        REQUIRE(serial_result.is_ok());
+        REQUIRE(parallel_result.value().data == serial_result.value().data);
+    }
+
+    SECTION("short input is rejected") {
+        std::vector<uint8_t> truncated(original.begin(), original.begin() + 100);
+        REQUIRE(codec.encode_frames(truncated, params).is_err());
+    }
+}
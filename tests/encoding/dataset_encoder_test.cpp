@@ -0,0 +1,235 @@
+/**
+ * @file dataset_encoder_test.cpp
+ * @brief Unit tests for the two-pass dataset encoder
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <kcenon/pacs/core/dicom_dataset.h>
+#include <kcenon/pacs/core/dicom_element.h>
+#include <kcenon/pacs/core/dicom_tag.h>
+#include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/dataset_encoder.h>
+#include <kcenon/pacs/encoding/explicit_vr_big_endian_codec.h>
+#include <kcenon/pacs/encoding/explicit_vr_codec.h>
+#include <kcenon/pacs/encoding/implicit_vr_codec.h>
+#include <kcenon/pacs/encoding/vr_type.h>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+using namespace kcenon::pacs::core;
+using namespace kcenon::pacs::encoding;
+
+namespace {
+
+/// Dataset with strings (odd and even), numbers, a nested sequence and a
+/// value large enough to bypass the sink staging buffer
+dicom_dataset make_dataset() {
+    dicom_dataset ds;
+    ds.set_string(tags::patient_name, vr_type::PN, "DOE^JOHN");
+    ds.set_string(tags::patient_id, vr_type::LO, "ODD");
+    ds.set_numeric<uint16_t>(tags::rows, vr_type::US, 512);
+    ds.set_numeric<uint32_t>(dicom_tag{0x0028, 0x9001}, vr_type::UL, 70000);
+
+    dicom_element seq{dicom_tag{0x0008, 0x1140}, vr_type::SQ};
+    for (int i = 0; i < 2; ++i) {
+        dicom_dataset item;
+        item.set_string(tags::sop_instance_uid, vr_type::UI, "1.2.3." + std::to_string(i));
+
+        dicom_element inner{dicom_tag{0x0040, 0xA730}, vr_type::SQ};
+        dicom_dataset inner_item;
+        inner_item.set_string(dicom_tag{0x0040, 0xA160}, vr_type::UT, "text");
+        inner.add_sequence_item(std::move(inner_item));
+        item.insert(std::move(inner));
+
+        seq.add_sequence_item(std::move(item));
+    }
+    ds.insert(std::move(seq));
+
+    std::vector<uint8_t> pixels(dataset_encoder::direct_write_threshold * 3 + 2);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>(i * 7);
+    }
+    ds.insert(dicom_element{tags::pixel_data, vr_type::OW, pixels});
+    return ds;
+}
+
+/// Sink recording each write
+class recording_sink final : public byte_sink {
+public:
+    auto write(std::span<const uint8_t> bytes) -> kcenon::pacs::VoidResult override {
+        writes.push_back(bytes.size());
+        views.push_back(bytes.data());
+        data.insert(data.end(), bytes.begin(), bytes.end());
+        return kcenon::pacs::ok();
+    }
+
+    std::vector<uint8_t> data;
+    std::vector<size_t> writes;
+    std::vector<const uint8_t*> views;
+};
+
+/// Sink failing on its n-th write
+class failing_sink final : public byte_sink {
+public:
+    explicit failing_sink(int fail_at) : fail_at_(fail_at) {}
+
+    auto write(std::span<const uint8_t>) -> kcenon::pacs::VoidResult override {
+        if (++calls == fail_at_) {
+            return kcenon::pacs::pacs_void_error(
+                kcenon::pacs::error_codes::file_write_error, "disk full");
+        }
+        return kcenon::pacs::ok();
+    }
+
+    int calls{0};
+
+private:
+    int fail_at_;
+};
+
+}  // namespace
+
+// ============================================================================
+// Compatibility with the codecs
+// ============================================================================
+
+TEST_CASE("dataset_encoder matches the codec encodings", "[encoding][dataset_encoder]") {
+    const auto ds = make_dataset();
+
+    SECTION("Explicit VR Little Endian round trip") {
+        auto bytes = dataset_encoder(transfer_syntax::explicit_vr_little_endian).encode(ds);
+        CHECK(bytes == explicit_vr_codec::encode(ds));
+
+        auto decoded = explicit_vr_codec::decode(bytes);
+        REQUIRE(decoded.is_ok());
+        CHECK(decoded.value().get_string(tags::patient_id) == "ODD");
+        CHECK(decoded.value().get_numeric<uint32_t>(dicom_tag{0x0028, 0x9001}) == 70000u);
+        const auto* seq = decoded.value().get(dicom_tag{0x0008, 0x1140});
+        REQUIRE(seq != nullptr);
+        REQUIRE(seq->sequence_items().size() == 2);
+        CHECK(seq->sequence_items()[1].get_string(tags::sop_instance_uid) == "1.2.3.1");
+    }
+
+    SECTION("Implicit VR Little Endian round trip") {
+        auto bytes = dataset_encoder(transfer_syntax::implicit_vr_little_endian).encode(ds);
+        CHECK(bytes == implicit_vr_codec::encode(ds));
+
+        auto decoded = implicit_vr_codec::decode(bytes);
+        REQUIRE(decoded.is_ok());
+        CHECK(decoded.value().get_string(tags::patient_name) == "DOE^JOHN");
+    }
+
+    SECTION("Explicit VR Big Endian round trip") {
+        auto bytes = dataset_encoder(transfer_syntax::explicit_vr_big_endian).encode(ds);
+        CHECK(bytes == explicit_vr_big_endian_codec::encode(ds));
+
+        auto decoded = explicit_vr_big_endian_codec::decode(bytes);
+        REQUIRE(decoded.is_ok());
+        CHECK(decoded.value().get_numeric<uint16_t>(tags::rows) == 512);
+        const auto* pixels = decoded.value().get(tags::pixel_data);
+        REQUIRE(pixels != nullptr);
+        CHECK(std::ranges::equal(pixels->raw_data(), ds.get(tags::pixel_data)->raw_data()));
+    }
+}
+
+// ============================================================================
+// Sizes and buffers
+// ============================================================================
+
+TEST_CASE("dataset_encoder sizes are exact", "[encoding][dataset_encoder]") {
+    const auto ds = make_dataset();
+
+    for (const auto* ts : {&transfer_syntax::explicit_vr_little_endian,
+                           &transfer_syntax::implicit_vr_little_endian,
+                           &transfer_syntax::explicit_vr_big_endian}) {
+        dataset_encoder encoder(*ts);
+        const auto bytes = encoder.encode(ds);
+        CHECK(encoder.encoded_size(ds) == bytes.size());
+        CHECK(bytes.capacity() == bytes.size());
+
+        for (const auto& [tag, element] : ds) {
+            CHECK(encoder.encoded_size(element) == encoder.encode(element).size());
+        }
+    }
+
+    SECTION("encode_append grows the buffer by the encoded size") {
+        dataset_encoder encoder;
+        std::vector<uint8_t> buffer{0xAA, 0xBB};
+        encoder.encode_append(ds, buffer);
+        REQUIRE(buffer.size() == 2 + encoder.encoded_size(ds));
+        CHECK(buffer[0] == 0xAA);
+        CHECK(std::equal(buffer.begin() + 2, buffer.end(), encoder.encode(ds).begin()));
+    }
+}
+
+TEST_CASE("dataset_encoder encapsulated Pixel Data", "[encoding][dataset_encoder]") {
+    // Basic Offset Table (empty), one fragment, Sequence Delimitation Item
+    const std::vector<uint8_t> items{
+        0xFE, 0xFF, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
+        0xFE, 0xFF, 0x00, 0xE0, 0x04, 0x00, 0x00, 0x00, 1, 2, 3, 4,
+        0xFE, 0xFF, 0xDD, 0xE0, 0x00, 0x00, 0x00, 0x00};
+    dicom_dataset ds;
+    ds.insert(dicom_element{tags::pixel_data, vr_type::OB, items});
+
+    encoder_options options;
+    options.undefined_length_encapsulated = true;
+    const auto bytes = dataset_encoder(options).encode(ds);
+
+    REQUIRE(bytes.size() == 12 + items.size());
+    CHECK(bytes[8] == 0xFF);
+    CHECK(bytes[9] == 0xFF);
+    CHECK(bytes[10] == 0xFF);
+    CHECK(bytes[11] == 0xFF);
+    CHECK(std::equal(items.begin(), items.end(), bytes.begin() + 12));
+
+    // Without the option the value keeps its byte count
+    const auto plain = dataset_encoder().encode(ds);
+    CHECK(plain[8] == items.size());
+}
+
+// ============================================================================
+// Sinks
+// ============================================================================
+
+TEST_CASE("dataset_encoder streams into a sink", "[encoding][dataset_encoder]") {
+    const auto ds = make_dataset();
+    dataset_encoder encoder(transfer_syntax::explicit_vr_little_endian);
+
+    SECTION("sink output equals buffer output") {
+        recording_sink sink;
+        REQUIRE(encoder.encode(ds, sink).is_ok());
+        CHECK(sink.data == encoder.encode(ds));
+
+        for (auto size : sink.writes) {
+            CHECK(size > 0);
+        }
+    }
+
+    SECTION("large values are passed through without copying") {
+        recording_sink sink;
+        REQUIRE(encoder.encode(ds, sink).is_ok());
+
+        const auto pixels = ds.get(tags::pixel_data)->raw_data();
+        CHECK(std::find(sink.views.begin(), sink.views.end(), pixels.data()) !=
+              sink.views.end());
+    }
+
+    SECTION("ostream_sink") {
+        std::ostringstream out;
+        ostream_sink sink(out);
+        REQUIRE(encoder.encode(ds, sink).is_ok());
+        const auto bytes = encoder.encode(ds);
+        CHECK(out.str() == std::string(bytes.begin(), bytes.end()));
+    }
+
+    SECTION("first sink error is returned and output stops") {
+        failing_sink sink(2);
+        auto result = encoder.encode(ds, sink);
+        REQUIRE(result.is_err());
+        CHECK(result.error().message == "disk full");
+        CHECK(sink.calls == 2);
+    }
+}
@@ -0,0 +1,172 @@
+/**
+ * @file latency_histogram_test.cpp
+ * @brief Unit tests for the log-linear latency histogram
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "kcenon/pacs/monitoring/latency_histogram.h"
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace kcenon::pacs::monitoring;
+using namespace std::chrono_literals;
+
+// =============================================================================
+// Bucket layout tests
+// =============================================================================
+
+TEST_CASE("latency_histogram bucket layout", "[monitoring][histogram]") {
+    using h = latency_histogram;
+
+    SECTION("Small values have exact buckets") {
+        for (std::uint64_t v = 0; v < 16; ++v) {
+            CHECK(h::bucket_index(v) == v);
+            CHECK(h::bucket_lower_bound(v) == v);
+            CHECK(h::bucket_upper_bound(v) == v + 1);
+        }
+    }
+
+    SECTION("Buckets are contiguous and contain their values") {
+        for (std::size_t i = 0; i + 1 < h::bucket_count; ++i) {
+            CHECK(h::bucket_upper_bound(i) == h::bucket_lower_bound(i + 1));
+            CHECK(h::bucket_index(h::bucket_lower_bound(i)) == i);
+            CHECK(h::bucket_index(h::bucket_upper_bound(i) - 1) == i);
+        }
+    }
+
+    SECTION("Relative bucket width is at most 12.5%") {
+        for (std::size_t i = h::sub_bucket_count; i < h::bucket_count; ++i) {
+            const auto width = h::bucket_upper_bound(i) - h::bucket_lower_bound(i);
+            CHECK(width * 8 <= h::bucket_lower_bound(i));
+        }
+    }
+
+    SECTION("Values beyond the range share the last bucket") {
+        CHECK(h::bucket_index(std::uint64_t{1} << 40) == h::bucket_count - 1);
+        CHECK(h::bucket_index(UINT64_MAX) == h::bucket_count - 1);
+    }
+}
+
+// =============================================================================
+// Recording and snapshot tests
+// =============================================================================
+
+TEST_CASE("latency_histogram recording and percentiles", "[monitoring][histogram]") {
+    latency_histogram histogram;
+
+    SECTION("Empty histogram") {
+        auto snapshot = histogram.snapshot();
+        CHECK(snapshot.count == 0);
+        CHECK(snapshot.percentile(0.99) == 0);
+        CHECK(snapshot.max() == 0);
+        CHECK(snapshot.mean() == 0.0);
+    }
+
+    SECTION("Percentiles are within one bucket of the true value") {
+        for (int i = 1; i <= 1000; ++i) {
+            histogram.record(std::chrono::microseconds(i));
+        }
+        auto snapshot = histogram.snapshot();
+
+        CHECK(snapshot.count == 1000);
+        CHECK(snapshot.sum_ns == 500'500'000);
+
+        const auto p50 = snapshot.percentile(0.50);
+        const auto p99 = snapshot.percentile(0.99);
+        CHECK(p50 >= 500'000);
+        CHECK(p50 <= 500'000 * 9 / 8);
+        CHECK(p99 >= 990'000);
+        CHECK(p99 <= 990'000 * 9 / 8);
+        CHECK(snapshot.max() >= 1'000'000);
+        CHECK(snapshot.max() <= 1'000'000 * 9 / 8);
+    }
+
+    SECTION("Tail outliers show up in high percentiles only") {
+        for (int i = 0; i < 999; ++i) {
+            histogram.record(100us);
+        }
+        histogram.record(2s);
+        auto snapshot = histogram.snapshot();
+
+        CHECK(snapshot.percentile(0.99) < 120'000);
+        CHECK(snapshot.percentile(1.0) >= 2'000'000'000);
+    }
+
+    SECTION("Cumulative counts never include a bucket above the bound") {
+        histogram.record(90us);
+        histogram.record(100us);
+        histogram.record(110us);
+        auto snapshot = histogram.snapshot();
+
+        CHECK(snapshot.count_at_or_below(95'000) == 1);
+        CHECK(snapshot.count_at_or_below(1'000'000) == 3);
+        CHECK(snapshot.count_at_or_below(0) == 0);
+    }
+
+    SECTION("Negative durations are recorded as zero") {
+        histogram.record(std::chrono::nanoseconds(-5));
+        CHECK(histogram.snapshot().counts[0] == 1);
+    }
+
+    SECTION("Reset clears all shards") {
+        histogram.record(1ms);
+        histogram.reset();
+        CHECK(histogram.snapshot().count == 0);
+        CHECK(histogram.snapshot().sum_ns == 0);
+    }
+}
+
+TEST_CASE("latency_histogram snapshots merge", "[monitoring][histogram]") {
+    latency_histogram a;
+    latency_histogram b;
+    a.record(1ms);
+    b.record(3ms);
+    b.record(5ms);
+
+    auto merged = a.snapshot();
+    merged.merge(b.snapshot());
+
+    CHECK(merged.count == 3);
+    CHECK(merged.sum_ns == 9'000'000);
+    CHECK(merged.percentile(0.34) >= 3'000'000);
+    CHECK(merged.percentile(0.34) < 5'000'000);
+
+    histogram_snapshot empty;
+    empty.merge(merged);
+    CHECK(empty.count == 3);
+    CHECK(empty.counts == merged.counts);
+}
+
+TEST_CASE("latency_histogram concurrent recording", "[monitoring][histogram][threading]") {
+    latency_histogram histogram;
+    constexpr int num_threads = 16;
+    constexpr int records_per_thread = 10000;
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&histogram, t]() {
+            for (int i = 0; i < records_per_thread; ++i) {
+                histogram.record(std::chrono::nanoseconds(t * 1000 + i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto snapshot = histogram.snapshot();
+    CHECK(snapshot.count == num_threads * records_per_thread);
+
+    std::uint64_t expected_sum = 0;
+    for (int t = 0; t < num_threads; ++t) {
+        for (int i = 0; i < records_per_thread; ++i) {
+            expected_sum += static_cast<std::uint64_t>(t * 1000 + i);
+        }
+    }
+    CHECK(snapshot.sum_ns == expected_sum);
+}
@@ -98,6 +98,7 @@ TEST_CASE("operation_counter basic functionality", "[monitoring][metrics]") {
         CHECK(counter.total_duration_us.load() == 0);
         CHECK(counter.min_duration_us.load() == UINT64_MAX);
         CHECK(counter.max_duration_us.load() == 0);
+        CHECK(counter.latency.snapshot().count == 0);
     }
 }
 
@@ -325,6 +326,8 @@ TEST_CASE("pacs_metrics reset", "[monitoring][metrics]") {
     metrics.record_echo(true, 50us);
     metrics.record_association_established();
     metrics.record_bytes_sent(512);
+    metrics.stage_latency("pdu_decode").record(20us);
+    metrics.record_calling_ae("MODALITY", dimse_operation::c_store, 1000us);
 
     // Reset all
     metrics.reset();
@@ -334,6 +337,23 @@ TEST_CASE("pacs_metrics reset", "[monitoring][metrics]") {
     CHECK(metrics.get_counter(dimse_operation::c_echo).total_count() == 0);
     CHECK(metrics.transfer().bytes_sent.load() == 0);
     CHECK(metrics.associations().total_established.load() == 0);
+    CHECK(metrics.get_counter(dimse_operation::c_store).latency.snapshot().count == 0);
+    CHECK(metrics.stage_latency("pdu_decode").snapshot().count == 0);
+    CHECK(metrics.calling_ae_latency("MODALITY", dimse_operation::c_store).snapshot().count == 0);
+}
+
+TEST_CASE("pacs_metrics calling AE label cardinality", "[monitoring][metrics]") {
+    pacs_metrics metrics;
+
+    for (std::size_t i = 0; i < pacs_metrics::max_calling_ae_labels + 10; ++i) {
+        metrics.record_calling_ae("AE_" + std::to_string(i), dimse_operation::c_echo, 10us);
+    }
+
+    CHECK(metrics.calling_ae_latency("AE_0", dimse_operation::c_echo).snapshot().count == 1);
+    CHECK(metrics.calling_ae_latency(pacs_metrics::overflow_calling_ae, dimse_operation::c_echo)
+              .snapshot().count == 10);
+    CHECK(&metrics.calling_ae_latency("AE_999", dimse_operation::c_echo) ==
+          &metrics.calling_ae_latency(pacs_metrics::overflow_calling_ae, dimse_operation::c_echo));
 }
 
 // =============================================================================
@@ -384,6 +404,39 @@ TEST_CASE("pacs_metrics to_json export", "[monitoring][metrics][json]") {
         CHECK_THAT(json, Catch::Matchers::ContainsSubstring("\"total_established\":2"));
         CHECK_THAT(json, Catch::Matchers::ContainsSubstring("\"current_active\":1"));
     }
+
+    SECTION("JSON contains transcoding data") {
+        metrics.transcoding().record_conversion(true, 500us, 4);
+        metrics.transcoding().record_cache_lookup(true);
+        metrics.transcoding().record_cache_lookup(false);
+
+        std::string json = metrics.to_json();
+
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring("\"transcoding\""));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring("\"frames_processed\":4"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring("\"cache_hits\":1"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring("\"cache_misses\":1"));
+    }
+
+    SECTION("JSON contains latency percentiles") {
+        for (int i = 0; i < 99; ++i) {
+            metrics.record_query(true, 1000us);
+        }
+        metrics.record_query(true, 100ms);
+        metrics.stage_latency("dimse_process").record(10us);
+        metrics.record_calling_ae("CT_SCANNER", dimse_operation::c_store, 5ms);
+
+        std::string json = metrics.to_json();
+
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring("\"latency\":{\"count\":100"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring("\"p99_us\":"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring("\"pipeline_stage_latency\":{\"dimse_process\":{\"count\":1"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring("\"calling_ae_latency\":{\"CT_SCANNER\":{\"c_store\":{\"count\":1"));
+
+        const auto p99 = metrics.get_counter(dimse_operation::c_find).latency.snapshot().percentile(0.99);
+        CHECK(p99 >= 1'000'000);
+        CHECK(p99 < 1'125'000);
+    }
 }
 
 // =============================================================================
@@ -430,6 +483,56 @@ TEST_CASE("pacs_metrics to_prometheus export", "[monitoring][metrics][prometheus
         CHECK_THAT(prom, Catch::Matchers::ContainsSubstring("pacs_dimse_c_store_success_total 1"));
         CHECK_THAT(prom, Catch::Matchers::ContainsSubstring("pacs_images_stored_total 1"));
     }
+
+    SECTION("Prometheus contains transcoding values") {
+        metrics.transcoding().record_conversion(true, 500us, 3);
+        metrics.transcoding().record_conversion(false, 100us, 3);
+
+        std::string prom = metrics.to_prometheus();
+
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring("pacs_transcode_total 2"));
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring("pacs_transcode_failure_total 1"));
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring("pacs_transcode_frames_total 3"));
+    }
+
+    SECTION("Prometheus contains DIMSE latency histograms") {
+        metrics.record_store(true, 200us);
+        metrics.record_store(true, 2000us);
+        metrics.record_store(false, 20ms);
+
+        std::string prom = metrics.to_prometheus();
+
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring(
+                             "# TYPE pacs_dimse_duration_seconds histogram"));
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring(
+                             R"(pacs_dimse_duration_seconds_bucket{operation="c_store",le="0.0001"} 0)"));
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring(
+                             R"(pacs_dimse_duration_seconds_bucket{operation="c_store",le="0.00025"} 1)"));
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring(
+                             R"(pacs_dimse_duration_seconds_bucket{operation="c_store",le="0.0025"} 2)"));
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring(
+                             R"(pacs_dimse_duration_seconds_bucket{operation="c_store",le="+Inf"} 3)"));
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring(
+                             R"(pacs_dimse_duration_seconds_sum{operation="c_store"} 0.022200000)"));
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring(
+                             R"(pacs_dimse_duration_seconds_count{operation="c_store"} 3)"));
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring(
+                             R"(pacs_dimse_duration_seconds_count{operation="c_echo"} 0)"));
+    }
+
+    SECTION("Prometheus contains stage and calling AE histograms") {
+        metrics.stage_latency("pdu_decode").record(50us);
+        metrics.record_calling_ae("MODALITY_1", dimse_operation::c_find, 300us);
+
+        std::string prom = metrics.to_prometheus();
+
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring(
+                             "# TYPE pacs_pipeline_stage_duration_seconds histogram"));
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring(
+                             R"(pacs_pipeline_stage_duration_seconds_count{stage="pdu_decode"} 1)"));
+        CHECK_THAT(prom, Catch::Matchers::ContainsSubstring(
+                             R"(pacs_calling_ae_duration_seconds_bucket{calling_ae="MODALITY_1",operation="c_find",le="0.0005"} 1)"));
+    }
 }
 
 // =============================================================================
@@ -0,0 +1,213 @@
+/**
+ * @file request_tracer_test.cpp
+ * @brief Unit tests for sampled request trace spans and their export
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "kcenon/pacs/monitoring/request_tracer.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kcenon::pacs::monitoring;
+
+namespace {
+
+/// Reset the global tracer to trace every request into a fresh buffer
+request_tracer& fresh_tracer(std::uint32_t sample_every = 1, std::size_t capacity = 64) {
+    auto& tracer = request_tracer::global();
+    tracer.configure({sample_every, capacity});
+    tracer.clear();
+    return tracer;
+}
+
+auto find_span(const std::vector<span_record>& spans, const std::string& name)
+    -> const span_record* {
+    for (const auto& span : spans) {
+        if (span.name == name) {
+            return &span;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+// =============================================================================
+// Sampling and nesting
+// =============================================================================
+
+TEST_CASE("request_tracer samples one request in N", "[monitoring][tracing]") {
+    auto& tracer = fresh_tracer(4);
+
+    int sampled = 0;
+    for (int i = 0; i < 40; ++i) {
+        if (tracer.start_trace().sampled()) {
+            ++sampled;
+        }
+    }
+    CHECK(sampled == 10);
+
+    tracer.configure({0, 64});
+    CHECK_FALSE(tracer.start_trace().sampled());
+}
+
+TEST_CASE("trace_span nests under the active span", "[monitoring][tracing]") {
+    auto& tracer = fresh_tracer();
+
+    std::uint64_t trace_id = 0;
+    {
+        auto request = trace_span::start_request("dimse_request");
+        REQUIRE(request.active());
+        request.set_attribute("calling_ae", "MODALITY");
+        trace_id = request.context().trace_id;
+        {
+            trace_span handler("service_handler");
+            {
+                trace_span write("file_write");
+                CHECK(request_tracer::current().span_id == write.context().span_id);
+            }
+            CHECK(request_tracer::current().span_id == handler.context().span_id);
+            handler.set_error();
+        }
+        request.add_child("pdu_receive", 10, 20);
+    }
+    CHECK_FALSE(request_tracer::current().sampled());
+
+    auto spans = tracer.spans(trace_id);
+    REQUIRE(spans.size() == 4);
+
+    const auto* request = find_span(spans, "dimse_request");
+    const auto* handler = find_span(spans, "service_handler");
+    const auto* write = find_span(spans, "file_write");
+    const auto* receive = find_span(spans, "pdu_receive");
+    REQUIRE(request);
+    REQUIRE(handler);
+    REQUIRE(write);
+    REQUIRE(receive);
+
+    CHECK(request->parent_span_id == 0);
+    CHECK(handler->parent_span_id == request->span_id);
+    CHECK(write->parent_span_id == handler->span_id);
+    CHECK(receive->parent_span_id == request->span_id);
+    CHECK(receive->duration_ns() == 10);
+    CHECK(handler->error);
+    CHECK_FALSE(write->error);
+    CHECK(request->start_ns <= handler->start_ns);
+    CHECK(handler->end_ns <= request->end_ns);
+    REQUIRE(request->attributes.size() == 1);
+    CHECK(request->attributes[0].second == "MODALITY");
+}
+
+TEST_CASE("trace_span is inert outside a sampled request", "[monitoring][tracing]") {
+    auto& tracer = fresh_tracer(0);
+
+    {
+        auto request = trace_span::start_request("dimse_request");
+        CHECK_FALSE(request.active());
+        trace_span write("file_write");
+        CHECK_FALSE(write.active());
+        write.set_attribute("key", "value");
+    }
+    CHECK(tracer.spans().empty());
+}
+
+TEST_CASE("trace context follows work to another thread", "[monitoring][tracing]") {
+    auto& tracer = fresh_tracer();
+
+    auto request = trace_span::start_request("dimse_request");
+    const auto context = request.context();
+    request.detach();
+    CHECK_FALSE(request_tracer::current().sampled());
+
+    std::thread worker([&request, context]() {
+        trace_context_scope scope(context);
+        {
+            trace_span upsert("database_upsert");
+        }
+        request.finish();
+    });
+    worker.join();
+
+    auto spans = tracer.spans(context.trace_id);
+    REQUIRE(spans.size() == 2);
+    const auto* upsert = find_span(spans, "database_upsert");
+    REQUIRE(upsert);
+    CHECK(upsert->parent_span_id == context.span_id);
+}
+
+// =============================================================================
+// Ring buffer
+// =============================================================================
+
+TEST_CASE("request_tracer ring buffer keeps the newest spans", "[monitoring][tracing]") {
+    auto& tracer = fresh_tracer(1, 4);
+
+    std::vector<std::uint64_t> traces;
+    for (int i = 0; i < 6; ++i) {
+        auto request = trace_span::start_request("request_" + std::to_string(i));
+        traces.push_back(request.context().trace_id);
+    }
+
+    auto spans = tracer.spans();
+    REQUIRE(spans.size() == 4);
+    CHECK(spans.front().name == "request_2");
+    CHECK(spans.back().name == "request_5");
+    CHECK(tracer.overwritten() == 2);
+    CHECK(tracer.spans(traces[0]).empty());
+
+    tracer.clear();
+    CHECK(tracer.spans().empty());
+    CHECK(tracer.overwritten() == 0);
+
+    fresh_tracer(100, 4096);
+}
+
+// =============================================================================
+// Export
+// =============================================================================
+
+TEST_CASE("request_tracer exports OTLP-JSON and Chrome traces", "[monitoring][tracing]") {
+    auto& tracer = fresh_tracer();
+
+    {
+        auto request = trace_span::start_request("dimse_request");
+        request.set_attribute("calling_ae", "CT\"1");
+        trace_span write("file_write");
+        write.set_error();
+    }
+    auto spans = tracer.spans();
+    REQUIRE(spans.size() == 2);
+
+    SECTION("OTLP-JSON") {
+        const auto json = tracer.to_otlp_json(spans, "test_pacs");
+
+        CHECK_THAT(json, Catch::Matchers::StartsWith(R"({"resourceSpans":[)"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring(
+                             R"({"key":"service.name","value":{"stringValue":"test_pacs"}})"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring(R"("name":"dimse_request","kind":2)"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring(R"("name":"file_write","kind":1)"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring(R"("parentSpanId":")"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring(R"("status":{"code":2})"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring(R"("stringValue":"CT\"1")"));
+
+        const auto trace_id = json.find(R"("traceId":")");
+        REQUIRE(trace_id != std::string::npos);
+        CHECK(json.find('"', trace_id + 11) - (trace_id + 11) == 32);
+    }
+
+    SECTION("Chrome trace") {
+        const auto json = tracer.to_chrome_trace(spans);
+
+        CHECK_THAT(json, Catch::Matchers::StartsWith(R"({"displayTimeUnit":"ms","traceEvents":[)"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring(R"("name":"file_write","cat":"pacs","ph":"X")"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring(R"("pid":1,"tid":1)"));
+        CHECK_THAT(json, Catch::Matchers::ContainsSubstring(R"("error":true)"));
+        CHECK_THAT(json, Catch::Matchers::EndsWith("]}"));
+    }
+
+    fresh_tracer(100, 4096);
+}
@@ -6,8 +6,13 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "kcenon/pacs/network/association.h"
+#include "kcenon/pacs/network/p_data_fragmenter.h"
 #include "kcenon/pacs/network/pdu_types.h"
+#include "kcenon/pacs/core/dicom_tag_constants.h"
 #include "kcenon/pacs/core/result.h"
+#include "kcenon/pacs/encoding/explicit_vr_codec.h"
+
+#include <algorithm>
 
 using namespace kcenon::pacs::network;
 
@@ -486,6 +491,119 @@ TEST_CASE("association abort", "[association][abort]") {
     }
 }
 
+// =============================================================================
+// Deferred Sender Tests
+// =============================================================================
+
+TEST_CASE("association deferred sender", "[association][dimse]") {
+    associate_rq rq;
+    rq.calling_ae_title = "REMOTE_SCU";
+    rq.called_ae_title = "MY_SCP";
+    rq.application_context = DICOM_APPLICATION_CONTEXT;
+    rq.presentation_contexts.push_back({1, VERIFICATION_SOP_CLASS, {EXPLICIT_VR_LE}});
+
+    scp_config config;
+    config.ae_title = "MY_SCP";
+    config.supported_abstract_syntaxes = {VERIFICATION_SOP_CLASS};
+    config.supported_transfer_syntaxes = {EXPLICIT_VR_LE};
+
+    auto remote = association::accept(rq, config);
+    auto echo = dimse::make_c_echo_rq(1);
+
+    association::deferred_sender sender;
+    {
+        auto local = association::accept(rq, config);
+        local.set_peer(&remote);
+        sender = local.make_deferred_sender();
+
+        SECTION("follows the association when moved") {
+            auto moved = std::move(local);
+            REQUIRE(sender(1, echo).is_ok());
+            auto received = remote.receive_dimse(std::chrono::milliseconds(100));
+            REQUIRE(received.is_ok());
+            CHECK(received.value().second.command() == dimse::command_field::c_echo_rq);
+        }
+
+        SECTION("sends while the association exists") {
+            REQUIRE(sender(1, echo).is_ok());
+            CHECK(remote.receive_dimse(std::chrono::milliseconds(100)).is_ok());
+        }
+    }
+
+    // The association is gone; the sender fails instead of touching it
+    auto late = sender(1, echo);
+    REQUIRE(late.is_err());
+    CHECK(late.error().code == kcenon::pacs::error_codes::invalid_association_state);
+}
+
+TEST_CASE("association sends pre-encoded data sets", "[association][dimse]") {
+    associate_rq rq;
+    rq.calling_ae_title = "REMOTE_SCU";
+    rq.called_ae_title = "MY_SCP";
+    rq.application_context = DICOM_APPLICATION_CONTEXT;
+    rq.presentation_contexts.push_back({3, CT_IMAGE_STORAGE, {EXPLICIT_VR_LE}});
+
+    scp_config config;
+    config.ae_title = "MY_SCP";
+    config.supported_abstract_syntaxes = {CT_IMAGE_STORAGE};
+    config.supported_transfer_syntaxes = {EXPLICIT_VR_LE};
+
+    kcenon::pacs::core::dicom_dataset ds;
+    ds.set_string(kcenon::pacs::core::tags::patient_id, kcenon::pacs::encoding::vr_type::LO,
+                  "ENCODED");
+    ds.insert(kcenon::pacs::core::dicom_element{
+        kcenon::pacs::core::tags::pixel_data, kcenon::pacs::encoding::vr_type::OW,
+        std::vector<uint8_t>(40000, 0x11)});
+    const auto encoded = kcenon::pacs::encoding::explicit_vr_codec::encode(ds);
+
+    auto store = dimse::make_c_store_rq(9, CT_IMAGE_STORAGE, "1.2.3.9");
+    auto local = association::accept(rq, config);
+
+    SECTION("in-memory peer receives the decoded data set") {
+        auto remote = association::accept(rq, config);
+        local.set_peer(&remote);
+
+        REQUIRE(local.send_dimse_encoded(3, store, encoded).is_ok());
+        auto received = remote.receive_dimse(std::chrono::milliseconds(100));
+        REQUIRE(received.is_ok());
+        const auto& msg = received.value().second;
+        CHECK(msg.command() == dimse::command_field::c_store_rq);
+        REQUIRE(msg.has_dataset());
+        CHECK(msg.dataset().value().get().get_string(
+                  kcenon::pacs::core::tags::patient_id) == "ENCODED");
+    }
+
+    SECTION("transport receives PDUs referencing the encoded bytes") {
+        std::vector<const uint8_t*> payloads;
+        size_t largest = 0;
+        local.set_p_data_transport([&](const p_data_fragmenter& pdus)
+                                       -> Result<std::monostate> {
+            for (const auto& fragment : pdus.fragments()) {
+                if ((fragment.header[11] & 0x01) == 0) {
+                    payloads.push_back(fragment.payload.data());
+                }
+                largest = std::max(largest, fragment.payload.size());
+            }
+            return std::monostate{};
+        });
+
+        REQUIRE(local.send_dimse_encoded(3, store, encoded).is_ok());
+        REQUIRE_FALSE(payloads.empty());
+        CHECK(payloads.front() == encoded.data());
+        CHECK(largest <= local.max_pdu_size() - 6);
+    }
+
+    SECTION("a command carrying its own data set is rejected") {
+        auto with_dataset = store;
+        with_dataset.set_dataset(ds);
+        CHECK(local.send_dimse_encoded(3, with_dataset, encoded).is_err());
+    }
+
+    SECTION("unknown presentation context is rejected") {
+        CHECK(local.send_dimse_encoded(5, store, encoded).is_err());
+    }
+}
+
 // =============================================================================
 // Presentation Context Tests
 // =============================================================================
@@ -0,0 +1,189 @@
+/**
+ * @file p_data_fragmenter_test.cpp
+ * @brief Unit tests for zero-copy P-DATA-TF fragmentation and gather sends
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "kcenon/pacs/network/p_data_fragmenter.h"
+#include "kcenon/pacs/network/pdu_decoder.h"
+
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+using namespace kcenon::pacs::network;
+
+namespace {
+
+std::vector<uint8_t> make_bytes(size_t size, uint8_t seed) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<uint8_t>(seed + i * 31);
+    }
+    return data;
+}
+
+/// Decode every PDU of a fragmented message and reassemble command / data
+void reassemble(const std::vector<uint8_t>& stream, std::vector<uint8_t>& command,
+                std::vector<uint8_t>& dataset, size_t& pdus) {
+    size_t offset = 0;
+    while (offset < stream.size()) {
+        const uint32_t length = (static_cast<uint32_t>(stream[offset + 2]) << 24) |
+                                (static_cast<uint32_t>(stream[offset + 3]) << 16) |
+                                (static_cast<uint32_t>(stream[offset + 4]) << 8) |
+                                static_cast<uint32_t>(stream[offset + 5]);
+        auto decoded = pdu_decoder::decode_p_data_tf(
+            std::span<const uint8_t>(stream).subspan(offset, 6 + length));
+        REQUIRE(decoded.is_ok());
+        for (const auto& pdv : decoded.value().pdvs) {
+            auto& target = pdv.is_command ? command : dataset;
+            target.insert(target.end(), pdv.data.begin(), pdv.data.end());
+        }
+        offset += 6 + length;
+        ++pdus;
+    }
+}
+
+}  // namespace
+
+// ============================================================================
+// Fragmentation
+// ============================================================================
+
+TEST_CASE("p_data_fragmenter splits command and dataset", "[network][p_data]") {
+    const auto command = make_bytes(100, 1);
+    const auto dataset = make_bytes(10000, 7);
+
+    p_data_fragmenter fragmenter(3, 1024);
+    fragmenter.add_command(command);
+    fragmenter.add_dataset(dataset);
+
+    const auto& fragments = fragmenter.fragments();
+    CHECK(fragmenter.max_fragment_payload() == 1018);
+    REQUIRE(fragments.size() == 1 + 10);  // 10000 / 1018 rounded up
+
+    SECTION("headers carry lengths, context ID and control bits") {
+        CHECK(fragments[0].header[0] == 0x04);
+        CHECK(fragments[0].header[10] == 3);
+        CHECK(fragments[0].header[11] == 0x03);  // command, last
+        CHECK(fragments[1].header[11] == 0x00);  // data, not last
+        CHECK(fragments.back().header[11] == 0x02);  // data, last
+
+        for (const auto& fragment : fragments) {
+            CHECK(fragment.payload.size() <= fragmenter.max_fragment_payload());
+        }
+    }
+
+    SECTION("payloads are views into the source bytes") {
+        CHECK(fragments[0].payload.data() == command.data());
+        CHECK(fragments[1].payload.data() == dataset.data());
+        CHECK(fragments[2].payload.data() == dataset.data() + 1018);
+    }
+
+    SECTION("PDUs decode back to the original bytes") {
+        const auto stream = fragmenter.to_bytes();
+        CHECK(stream.size() == fragmenter.total_size());
+
+        std::vector<uint8_t> decoded_command;
+        std::vector<uint8_t> decoded_dataset;
+        size_t pdus = 0;
+        reassemble(stream, decoded_command, decoded_dataset, pdus);
+        CHECK(pdus == fragments.size());
+        CHECK(decoded_command == command);
+        CHECK(decoded_dataset == dataset);
+    }
+}
+
+TEST_CASE("p_data_fragmenter edge cases", "[network][p_data]") {
+    SECTION("empty data yields one last fragment") {
+        p_data_fragmenter fragmenter(1, 16384);
+        fragmenter.add_dataset({});
+        REQUIRE(fragmenter.fragments().size() == 1);
+        CHECK(fragmenter.fragments()[0].payload.empty());
+        CHECK(fragmenter.fragments()[0].header[11] == 0x02);
+        CHECK(fragmenter.total_size() == p_data_header_size);
+    }
+
+    SECTION("data of exactly one fragment") {
+        const auto data = make_bytes(16378, 2);
+        p_data_fragmenter fragmenter(1, 16384);
+        fragmenter.add_dataset(data);
+        CHECK(fragmenter.fragments().size() == 1);
+    }
+
+    SECTION("zero max PDU length means unlimited") {
+        const auto data = make_bytes(100000, 3);
+        p_data_fragmenter fragmenter(1, 0);
+        fragmenter.add_dataset(data);
+        CHECK(fragmenter.fragments().size() == 1);
+    }
+
+    SECTION("clear keeps the configuration") {
+        const auto data = make_bytes(5000, 4);
+        p_data_fragmenter fragmenter(5, 2048);
+        fragmenter.add_dataset(data);
+        fragmenter.clear();
+        CHECK(fragmenter.fragments().empty());
+        CHECK(fragmenter.total_size() == 0);
+        fragmenter.add_command(data);
+        CHECK(fragmenter.fragments().size() == 3);
+    }
+}
+
+// ============================================================================
+// Gather I/O
+// ============================================================================
+
+#ifndef _WIN32
+TEST_CASE("write_gather sends all PDUs over a socket", "[network][p_data]") {
+    int sockets[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+
+    // Enough fragments to need several IOV_MAX batches and partial writes
+    const auto command = make_bytes(180, 9);
+    const auto dataset = make_bytes(24 * 1024 * 1024 + 3, 5);
+    p_data_fragmenter fragmenter(7, 16384);
+    fragmenter.add_command(command);
+    fragmenter.add_dataset(dataset);
+
+    std::vector<uint8_t> received;
+    std::thread reader([&] {
+        std::vector<uint8_t> chunk(64 * 1024);
+        while (true) {
+            const auto n = ::read(sockets[1], chunk.data(), chunk.size());
+            if (n <= 0) {
+                break;
+            }
+            received.insert(received.end(), chunk.begin(), chunk.begin() + n);
+        }
+    });
+
+    auto sent = write_gather(sockets[0], fragmenter.fragments());
+    ::close(sockets[0]);
+    reader.join();
+    ::close(sockets[1]);
+
+    REQUIRE(sent.is_ok());
+    CHECK(sent.value() == fragmenter.total_size());
+    REQUIRE(received.size() == fragmenter.total_size());
+    CHECK(received == fragmenter.to_bytes());
+}
+
+TEST_CASE("write_gather reports send errors", "[network][p_data]") {
+    int sockets[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+    ::close(sockets[1]);
+
+    const auto data = make_bytes(4096, 1);
+    p_data_fragmenter fragmenter(1, 1024);
+    fragmenter.add_dataset(data);
+
+    auto sent = write_gather(sockets[0], fragmenter.fragments());
+    ::close(sockets[0]);
+    CHECK(sent.is_err());
+}
+#endif
@@ -508,3 +508,52 @@ TEST_CASE("dicom_server_v2 callback types", "[server_v2][callback_types]") {
         CHECK(cb != nullptr);
     }
 }
+
+// =============================================================================
+// Execution Mode Tests
+// =============================================================================
+
+TEST_CASE("dicom_server_v2 execution mode", "[server_v2][pipeline]") {
+    server_config config;
+    config.ae_title = TEST_AE_TITLE;
+    config.port = TEST_PORT;
+
+    dicom_server_v2 server(config);
+    server.register_service(std::make_unique<verification_scp>());
+
+    SECTION("inline dispatch is the default") {
+        CHECK(server.execution_mode() == dimse_execution_mode::inline_dispatch);
+        CHECK(server.pipeline() == nullptr);
+    }
+
+    SECTION("pipelined mode can be selected before start") {
+        kcenon::pacs::network::pipeline::pipeline_config pipeline_cfg;
+        pipeline_cfg.execution_workers = 2;
+        server.set_execution_mode(dimse_execution_mode::pipelined, pipeline_cfg);
+
+        CHECK(server.execution_mode() == dimse_execution_mode::pipelined);
+        // The coordinator only exists while the server is running
+        CHECK(server.pipeline() == nullptr);
+    }
+
+    SECTION("mode names") {
+        CHECK(std::string(to_string(dimse_execution_mode::inline_dispatch)) == "Inline");
+        CHECK(std::string(to_string(dimse_execution_mode::pipelined)) == "Pipelined");
+    }
+
+#if defined(PACS_WITH_NETWORK_SYSTEM) && !defined(__linux__)
+    SECTION("pipelined start creates and stop releases the coordinator") {
+        server.set_execution_mode(dimse_execution_mode::pipelined);
+
+        auto result = server.start();
+        REQUIRE(result.is_ok());
+        auto coordinator = server.pipeline();
+        REQUIRE(coordinator != nullptr);
+        CHECK(coordinator->is_running());
+
+        server.stop();
+        CHECK(server.pipeline() == nullptr);
+        CHECK_FALSE(coordinator->is_running());
+    }
+#endif
+}
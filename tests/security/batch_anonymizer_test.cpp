@@ -0,0 +1,358 @@
+/**
+ * @file batch_anonymizer_test.cpp
+ * @brief Unit tests for the compiled action plan, concurrent UID mapping and
+ *        batch de-identification
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "kcenon/pacs/security/anonymizer.h"
+#include "kcenon/pacs/security/batch_anonymizer.h"
+#include "kcenon/pacs/security/uid_mapping.h"
+#include "kcenon/pacs/core/dicom_file.h"
+#include "kcenon/pacs/core/dicom_tag_constants.h"
+#include "kcenon/pacs/encoding/compression/pixel_data_transcoder.h"
+#include "kcenon/pacs/encoding/transfer_syntax.h"
+#include "kcenon/pacs/encoding/vr_type.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kcenon::pacs::security;
+using namespace kcenon::pacs::core;
+using namespace kcenon::pacs::encoding;
+
+namespace {
+
+class temp_directory {
+public:
+    temp_directory() {
+        path_ = std::filesystem::temp_directory_path() /
+                ("pacs_batch_anon_test_" +
+                 std::to_string(std::chrono::steady_clock::now()
+                                    .time_since_epoch()
+                                    .count()));
+        std::filesystem::create_directories(path_);
+    }
+
+    ~temp_directory() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    [[nodiscard]] auto path() const -> const std::filesystem::path& {
+        return path_;
+    }
+
+private:
+    std::filesystem::path path_;
+};
+
+auto make_instance(const std::string& series_uid, const std::string& sop_uid)
+    -> dicom_dataset {
+    constexpr uint16_t rows = 16;
+    constexpr uint16_t cols = 16;
+
+    dicom_dataset ds;
+    ds.set_string(tags::patient_name, vr_type::PN, "DOE^JOHN");
+    ds.set_string(tags::patient_id, vr_type::LO, "12345");
+    ds.set_string(tags::institution_name, vr_type::LO, "General Hospital");
+    ds.set_string(tags::study_instance_uid, vr_type::UI, "1.2.3.100");
+    ds.set_string(tags::series_instance_uid, vr_type::UI, series_uid);
+    ds.set_string(tags::sop_instance_uid, vr_type::UI, sop_uid);
+    ds.set_string(tags::sop_class_uid, vr_type::UI, "1.2.840.10008.5.1.4.1.1.2");
+    ds.set_string(tags::modality, vr_type::CS, "CT");
+    ds.set_numeric<uint16_t>(tags::rows, vr_type::US, rows);
+    ds.set_numeric<uint16_t>(tags::columns, vr_type::US, cols);
+    ds.set_numeric<uint16_t>(tags::bits_allocated, vr_type::US, 8);
+    ds.set_numeric<uint16_t>(tags::bits_stored, vr_type::US, 8);
+    ds.set_numeric<uint16_t>(tags::high_bit, vr_type::US, 7);
+    ds.set_numeric<uint16_t>(tags::samples_per_pixel, vr_type::US, 1);
+    ds.set_numeric<uint16_t>(tags::pixel_representation, vr_type::US, 0);
+    ds.set_string(tags::photometric_interpretation, vr_type::CS, "MONOCHROME2");
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(rows) * cols);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>(i * 7);
+    }
+    ds.insert(dicom_element(tags::pixel_data, vr_type::OB, pixels));
+    return ds;
+}
+
+/**
+ * @brief Write a study with two series of three instances each
+ */
+void write_study(const std::filesystem::path& root,
+                 const transfer_syntax& ts = transfer_syntax::explicit_vr_little_endian) {
+    for (int series = 1; series <= 2; ++series) {
+        const auto series_uid = "1.2.3.100." + std::to_string(series);
+        const auto dir = root / ("series" + std::to_string(series));
+        std::filesystem::create_directories(dir);
+        for (int n = 1; n <= 3; ++n) {
+            const auto sop_uid = series_uid + "." + std::to_string(n);
+            auto file = dicom_file::create(make_instance(series_uid, sop_uid),
+                                           transfer_syntax::explicit_vr_little_endian);
+            if (ts != transfer_syntax::explicit_vr_little_endian) {
+                auto converted = compression::transcode_file(file, ts);
+                REQUIRE(converted.is_ok());
+                file = std::move(converted.value());
+            }
+            REQUIRE(file.save(dir / (std::to_string(n) + ".dcm")).is_ok());
+        }
+    }
+}
+
+auto output_files(const std::filesystem::path& root)
+    -> std::vector<std::filesystem::path> {
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+        if (entry.is_regular_file()) {
+            files.push_back(entry.path());
+        }
+    }
+    return files;
+}
+
+auto pixel_bytes(const dicom_file& file) -> std::vector<uint8_t> {
+    const auto* pixels = file.dataset().get(tags::pixel_data);
+    REQUIRE(pixels != nullptr);
+    const auto raw = pixels->raw_data();
+    return {raw.begin(), raw.end()};
+}
+
+}  // namespace
+
+// ============================================================================
+// Compiled Action Plan
+// ============================================================================
+
+TEST_CASE("anonymizer: compiled action plan", "[security][anonymization][batch]") {
+    anonymizer anon(anonymization_profile::basic);
+
+    SECTION("plan is sorted and matches the profile") {
+        const auto plan = anon.get_action_plan();
+        REQUIRE_FALSE(plan.empty());
+        CHECK(std::is_sorted(plan.begin(), plan.end(),
+                             [](const auto& a, const auto& b) {
+                                 return a.first < b.first;
+                             }));
+        CHECK(plan.size() == anonymizer::get_profile_actions(
+                                 anonymization_profile::basic).size());
+    }
+
+    SECTION("custom actions are compiled into the plan") {
+        anon.add_tag_action(tags::modality, tag_action_config::make_remove());
+        CHECK(anon.get_tag_action(tags::modality).action == tag_action::remove);
+
+        REQUIRE(anon.remove_tag_action(tags::modality));
+        CHECK(anon.get_tag_action(tags::modality).action == tag_action::keep);
+    }
+
+    SECTION("copies share the plan") {
+        anonymizer copy = anon;
+        CHECK(copy.get_action_plan().data() == anon.get_action_plan().data());
+    }
+
+    SECTION("pixel data preservation") {
+        CHECK(anon.preserves_pixel_data());
+
+        anon.add_tag_action(tags::pixel_data, tag_action_config::make_remove());
+        CHECK_FALSE(anon.preserves_pixel_data());
+
+        anonymizer clean(anonymization_profile::clean_pixel);
+        CHECK_FALSE(clean.preserves_pixel_data());
+    }
+}
+
+// ============================================================================
+// Concurrent UID Mapping
+// ============================================================================
+
+TEST_CASE("uid_mapping: concurrent get_or_create is consistent",
+          "[security][anonymization][batch]") {
+    uid_mapping mapping;
+    constexpr int kThreads = 8;
+    constexpr int kUids = 200;
+
+    std::vector<std::vector<std::string>> seen(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&mapping, &seen, t]() {
+            for (int i = 0; i < kUids; ++i) {
+                auto result = mapping.get_or_create("1.2.3." + std::to_string(i));
+                seen[t].push_back(result.is_ok() ? result.value() : "");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    CHECK(mapping.size() == kUids);
+    for (int t = 1; t < kThreads; ++t) {
+        CHECK(seen[t] == seen[0]);
+    }
+    CHECK(std::set<std::string>(seen[0].begin(), seen[0].end()).size() == kUids);
+}
+
+// ============================================================================
+// batch_anonymizer Tests
+// ============================================================================
+
+TEST_CASE("batch_anonymizer: de-identifies a study in parallel",
+          "[security][anonymization][batch]") {
+    temp_directory dir;
+    const auto input = dir.path() / "in";
+    const auto output = dir.path() / "out";
+    write_study(input);
+
+    batch_anonymization_config config;
+    config.output_directory = output;
+    config.worker_count = 3;
+    std::atomic<std::size_t> progress_calls{0};
+    config.on_progress = [&progress_calls](std::size_t, std::size_t) {
+        ++progress_calls;
+    };
+
+    uid_mapping mapping;
+    batch_anonymizer batch(anonymizer(anonymization_profile::basic), config);
+    auto result = batch.run({input}, mapping);
+    REQUIRE(result.is_ok());
+
+    const auto& stats = result.value();
+    CHECK(stats.instances_processed == 6);
+    CHECK(stats.instances_failed == 0);
+    CHECK(stats.pixel_passthrough == 6);
+    CHECK(stats.bytes_written > 0);
+    CHECK(progress_calls.load() == 6);
+
+    auto files = output_files(output);
+    REQUIRE(files.size() == 6);
+
+    // One anonymized study, two series, shared through the mapping
+    std::set<std::string> studies;
+    std::set<std::string> series;
+    const auto expected_pixels =
+        std::vector<uint8_t>(pixel_bytes(dicom_file::create(
+            make_instance("1.2.3.100.1", "1.2.3.100.1.1"),
+            transfer_syntax::explicit_vr_little_endian)));
+    for (const auto& path : files) {
+        auto file = dicom_file::open(path);
+        REQUIRE(file.is_ok());
+        const auto& ds = file.value().dataset();
+        studies.insert(ds.get_string(tags::study_instance_uid));
+        series.insert(ds.get_string(tags::series_instance_uid));
+        CHECK(ds.get_string(tags::patient_name) == "ANONYMOUS");
+        CHECK(file.value().sop_instance_uid() ==
+              ds.get_string(tags::sop_instance_uid));
+        CHECK(pixel_bytes(file.value()) == expected_pixels);
+    }
+    CHECK(studies.size() == 1);
+    CHECK(series.size() == 2);
+    CHECK(*studies.begin() == mapping.get_anonymized("1.2.3.100").value_or(""));
+}
+
+TEST_CASE("batch_anonymizer: full decode matches header-only rewrite",
+          "[security][anonymization][batch]") {
+    temp_directory dir;
+    const auto input = dir.path() / "in";
+    write_study(input);
+
+    auto run = [&](const std::string& name, bool passthrough) {
+        batch_anonymization_config config;
+        config.output_directory = dir.path() / name;
+        config.worker_count = 2;
+        config.pixel_passthrough = passthrough;
+
+        uid_mapping mapping;
+        REQUIRE(mapping.add_mapping("1.2.3.100", "2.25.1").is_ok());
+        batch_anonymizer batch(anonymizer(anonymization_profile::basic), config);
+        auto result = batch.run({input / "series1" / "1.dcm"}, mapping);
+        REQUIRE(result.is_ok());
+        CHECK(result.value().pixel_passthrough == (passthrough ? 1u : 0u));
+
+        auto files = output_files(config.output_directory);
+        REQUIRE(files.size() == 1);
+        auto file = dicom_file::open(files.front());
+        REQUIRE(file.is_ok());
+        return std::move(file.value());
+    };
+
+    const auto fast = run("fast", true);
+    const auto full = run("full", false);
+    CHECK(fast.dataset().get_string(tags::study_instance_uid) == "2.25.1");
+    CHECK(full.dataset().get_string(tags::study_instance_uid) == "2.25.1");
+    CHECK(fast.dataset().get_string(tags::institution_name) ==
+          full.dataset().get_string(tags::institution_name));
+    CHECK(pixel_bytes(fast) == pixel_bytes(full));
+}
+
+TEST_CASE("batch_anonymizer: encapsulated pixel data is copied through",
+          "[security][anonymization][batch]") {
+    temp_directory dir;
+    const auto input = dir.path() / "in";
+    const auto output = dir.path() / "out";
+    const auto rle = find_transfer_syntax("1.2.840.10008.1.2.5");
+    REQUIRE(rle.has_value());
+    write_study(input, *rle);
+
+    batch_anonymization_config config;
+    config.output_directory = output;
+    config.worker_count = 2;
+
+    uid_mapping mapping;
+    batch_anonymizer batch(anonymizer(anonymization_profile::basic), config);
+    auto result = batch.run({input}, mapping);
+    REQUIRE(result.is_ok());
+    CHECK(result.value().instances_processed == 6);
+    CHECK(result.value().pixel_passthrough == 6);
+
+    for (const auto& path : output_files(output)) {
+        auto file = dicom_file::open(path);
+        REQUIRE(file.is_ok());
+        CHECK(file.value().transfer_syntax().uid() == "1.2.840.10008.1.2.5");
+        auto decoded = compression::transcode_file(
+            file.value(), transfer_syntax::explicit_vr_little_endian);
+        REQUIRE(decoded.is_ok());
+        CHECK(decoded.value().dataset().get_string(tags::patient_name) == "ANONYMOUS");
+    }
+}
+
+TEST_CASE("batch_anonymizer: input handling", "[security][anonymization][batch]") {
+    temp_directory dir;
+    const auto input = dir.path() / "in";
+    write_study(input);
+    {
+        std::ofstream notes(input / "README.txt");
+        notes << "not a DICOM file";
+    }
+
+    batch_anonymization_config config;
+    config.output_directory = dir.path() / "out";
+    uid_mapping mapping;
+    batch_anonymizer batch(anonymizer(anonymization_profile::basic), config);
+
+    SECTION("non-DICOM files are skipped") {
+        auto result = batch.run({input}, mapping);
+        REQUIRE(result.is_ok());
+        CHECK(result.value().instances_processed == 6);
+        CHECK(result.value().files_skipped == 1);
+    }
+
+    SECTION("missing inputs are rejected") {
+        CHECK(batch.run({dir.path() / "missing"}, mapping).is_err());
+    }
+
+    SECTION("overlapping inputs are processed once") {
+        auto result = batch.run({input, input / "series1"}, mapping);
+        REQUIRE(result.is_ok());
+        CHECK(result.value().instances_processed == 6);
+    }
+}
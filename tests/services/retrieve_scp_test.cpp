@@ -8,10 +8,15 @@
 #include <kcenon/pacs/network/dimse/dimse_message.h>
 #include <kcenon/pacs/network/dimse/status_codes.h>
 #include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/implicit_vr_codec.h>
 #include <kcenon/pacs/encoding/vr_type.h>
+#include <kcenon/pacs/network/association.h>
+#include <kcenon/pacs/network/p_data_fragmenter.h>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <map>
+
 using namespace kcenon::pacs::services;
 using namespace kcenon::pacs::network;
 using namespace kcenon::pacs::network::dimse;
@@ -430,3 +435,297 @@ TEST_CASE("retrieve DIMSE tag constants", "[services][retrieve]") {
         CHECK(tag_move_originator_message_id.element() == 0x1031);
     }
 }
+
+// ============================================================================
+// Pass-through C-GET Tests
+// ============================================================================
+
+namespace {
+
+constexpr std::string_view ct_image_storage = "1.2.840.10008.5.1.4.1.1.2";
+
+/// Exposes stored bytes in place, like a memory-mapped file
+class view_byte_source final : public kcenon::pacs::storage::byte_source {
+public:
+    explicit view_byte_source(std::span<const uint8_t> data) : data_(data) {}
+
+    auto size() const noexcept -> std::uint64_t override { return data_.size(); }
+
+    auto read(std::span<uint8_t> buffer)
+        -> kcenon::pacs::storage::Result<std::size_t> override {
+        const auto n = std::min(buffer.size(), data_.size() - offset_);
+        std::copy_n(data_.begin() + static_cast<std::ptrdiff_t>(offset_), n,
+                    buffer.begin());
+        offset_ += n;
+        return n;
+    }
+
+    auto contiguous() const noexcept -> std::span<const uint8_t> override {
+        return data_;
+    }
+
+private:
+    std::span<const uint8_t> data_;
+    std::size_t offset_{0};
+};
+
+/// Storage holding Part 10 files in memory
+class part10_storage final : public kcenon::pacs::storage::storage_interface {
+public:
+    void add(const std::string& uid, const transfer_syntax& ts) {
+        dicom_dataset ds;
+        ds.set_string(tags::sop_class_uid, vr_type::UI, std::string(ct_image_storage));
+        ds.set_string(tags::sop_instance_uid, vr_type::UI, uid);
+        ds.set_string(tags::patient_name, vr_type::PN, "PASS^THROUGH");
+        ds.set_numeric<uint16_t>(tags::rows, vr_type::US, 64);
+        ds.insert(dicom_element{tags::pixel_data, vr_type::OW,
+                                std::vector<uint8_t>(64 * 64 * 2, 0x5A)});
+        files_[uid] = dicom_file::create(std::move(ds), ts).to_bytes();
+    }
+
+    auto bytes(const std::string& uid) const -> const std::vector<uint8_t>& {
+        return files_.at(uid);
+    }
+
+    auto store(const dicom_dataset&) -> kcenon::pacs::storage::VoidResult override {
+        return kcenon::common::ok();
+    }
+
+    auto retrieve(std::string_view)
+        -> kcenon::pacs::storage::Result<dicom_dataset> override {
+        return kcenon::common::make_error<dicom_dataset>(-1, "not implemented");
+    }
+
+    auto remove(std::string_view) -> kcenon::pacs::storage::VoidResult override {
+        return kcenon::common::ok();
+    }
+
+    auto exists(std::string_view uid) const -> bool override {
+        return files_.count(std::string(uid)) > 0;
+    }
+
+    auto open_read(std::string_view uid, kcenon::pacs::storage::byte_range)
+        -> kcenon::pacs::storage::Result<
+            std::unique_ptr<kcenon::pacs::storage::byte_source>> override {
+        auto it = files_.find(std::string(uid));
+        if (it == files_.end()) {
+            return kcenon::common::make_error<
+                std::unique_ptr<kcenon::pacs::storage::byte_source>>(-1, "not found");
+        }
+        return std::unique_ptr<kcenon::pacs::storage::byte_source>(
+            std::make_unique<view_byte_source>(it->second));
+    }
+
+    auto find(const dicom_dataset&)
+        -> kcenon::pacs::storage::Result<std::vector<dicom_dataset>> override {
+        return kcenon::common::Result<std::vector<dicom_dataset>>::ok(
+            std::vector<dicom_dataset>{});
+    }
+
+    auto get_statistics() const -> kcenon::pacs::storage::storage_statistics override {
+        return {};
+    }
+
+    auto verify_integrity() -> kcenon::pacs::storage::VoidResult override {
+        return kcenon::common::ok();
+    }
+
+private:
+    std::map<std::string, std::vector<uint8_t>> files_;
+};
+
+/// SCP side of a C-GET association accepting CT storage in @p store_ts
+association accept_get_association(const std::string& store_ts) {
+    associate_rq rq;
+    rq.calling_ae_title = "VIEWER";
+    rq.called_ae_title = "PACS";
+    rq.application_context = "1.2.840.10008.3.1.1.1";
+    rq.presentation_contexts.push_back({
+        1, std::string(study_root_get_sop_class_uid), {"1.2.840.10008.1.2"}});
+    rq.presentation_contexts.push_back({
+        3, std::string(ct_image_storage), {store_ts}});
+
+    scp_config config;
+    config.ae_title = "PACS";
+    config.supported_abstract_syntaxes = {
+        std::string(study_root_get_sop_class_uid), std::string(ct_image_storage)};
+    config.supported_transfer_syntaxes = {store_ts, "1.2.840.10008.1.2"};
+    return association::accept(rq, config);
+}
+
+/// C-STORE sub-operation captured from the wire
+struct captured_store {
+    std::vector<uint8_t> dataset;
+    std::vector<std::span<const uint8_t>> payloads;
+};
+
+/// Capture C-STORE PDUs sent on @p assoc and answer each with a successful
+/// C-STORE-RSP
+void capture_stores(association& assoc, std::vector<captured_store>& stores) {
+    assoc.set_p_data_transport([&assoc, &stores](const p_data_fragmenter& pdus)
+                                   -> Result<std::monostate> {
+        captured_store store;
+        for (const auto& fragment : pdus.fragments()) {
+            if ((fragment.header[11] & 0x01) == 0) {
+                store.payloads.push_back(fragment.payload);
+                store.dataset.insert(store.dataset.end(), fragment.payload.begin(),
+                                     fragment.payload.end());
+            }
+        }
+        if (!store.payloads.empty()) {
+            assoc.enqueue_message(3, make_c_store_rsp(5, ct_image_storage, "1"));
+            stores.push_back(std::move(store));
+        }
+        return std::monostate{};
+    });
+}
+
+std::vector<captured_store> run_c_get(retrieve_scp& scp, association& pacs) {
+    std::vector<captured_store> stores;
+    capture_stores(pacs, stores);
+
+    dimse_message request{command_field::c_get_rq, 5};
+    request.set_affected_sop_class_uid(study_root_get_sop_class_uid);
+    dicom_dataset keys;
+    keys.set_string(tags::query_retrieve_level, vr_type::CS, "STUDY");
+    keys.set_string(tags::study_instance_uid, vr_type::UI, "1.2.3");
+    request.set_dataset(std::move(keys));
+
+    auto result = scp.handle_message(pacs, 1, request);
+    REQUIRE(result.is_ok());
+    return stores;
+}
+
+/// SCP side of a C-MOVE association from VIEWER
+association accept_move_association() {
+    associate_rq rq;
+    rq.calling_ae_title = "VIEWER";
+    rq.called_ae_title = "PACS";
+    rq.application_context = "1.2.840.10008.3.1.1.1";
+    rq.presentation_contexts.push_back({
+        1, std::string(study_root_move_sop_class_uid), {"1.2.840.10008.1.2"}});
+
+    scp_config config;
+    config.ae_title = "PACS";
+    config.supported_abstract_syntaxes = {std::string(study_root_move_sop_class_uid)};
+    config.supported_transfer_syntaxes = {"1.2.840.10008.1.2"};
+    return association::accept(rq, config);
+}
+
+bool points_into(std::span<const uint8_t> view, const std::vector<uint8_t>& buffer) {
+    return view.data() >= buffer.data() &&
+           view.data() + view.size() <= buffer.data() + buffer.size();
+}
+
+}  // namespace
+
+TEST_CASE("retrieve_scp C-GET sends stored bytes when syntaxes match",
+          "[services][retrieve]") {
+    auto storage = std::make_shared<part10_storage>();
+    storage->add("1.2.3.4.1", transfer_syntax::explicit_vr_little_endian);
+
+    retrieve_scp scp;
+    scp.set_pass_through(storage, [](const dicom_dataset&) {
+        return std::vector<std::string>{"1.2.3.4.1"};
+    });
+
+    auto pacs = accept_get_association("1.2.840.10008.1.2.1");
+    const auto stores = run_c_get(scp, pacs);
+
+    REQUIRE(stores.size() == 1);
+    for (const auto& payload : stores[0].payloads) {
+        CHECK(points_into(payload, storage->bytes("1.2.3.4.1")));
+    }
+
+    const auto& stored = storage->bytes("1.2.3.4.1");
+    auto header = dicom_file::read_header(stored);
+    REQUIRE(header.is_ok());
+    CHECK(stores[0].dataset == std::vector<uint8_t>(
+        stored.begin() + static_cast<std::ptrdiff_t>(header.value().dataset_offset),
+        stored.end()));
+    CHECK(scp.images_transferred() == 1);
+}
+
+TEST_CASE("retrieve_scp C-GET decodes stored bytes when syntaxes differ",
+          "[services][retrieve]") {
+    auto storage = std::make_shared<part10_storage>();
+    storage->add("1.2.3.4.2", transfer_syntax::explicit_vr_little_endian);
+
+    retrieve_scp scp;
+    scp.set_pass_through(storage, [](const dicom_dataset&) {
+        return std::vector<std::string>{"1.2.3.4.2", "1.2.3.4.404"};
+    });
+
+    // Only Implicit VR Little Endian accepted for CT storage
+    auto pacs = accept_get_association("1.2.840.10008.1.2");
+    const auto stores = run_c_get(scp, pacs);
+
+    REQUIRE(stores.size() == 1);
+    for (const auto& payload : stores[0].payloads) {
+        CHECK_FALSE(points_into(payload, storage->bytes("1.2.3.4.2")));
+    }
+
+    auto decoded = implicit_vr_codec::decode(stores[0].dataset);
+    REQUIRE(decoded.is_ok());
+    CHECK(decoded.value().get_string(tags::patient_name) == "PASS^THROUGH");
+    CHECK(decoded.value().get_string(tags::sop_instance_uid) == "1.2.3.4.2");
+
+    // The missing instance counts as a failed sub-operation
+    CHECK(scp.images_transferred() == 1);
+}
+
+TEST_CASE("retrieve_scp C-MOVE sends stored bytes on the sub-association",
+          "[services][retrieve]") {
+    auto storage = std::make_shared<part10_storage>();
+    storage->add("1.2.3.4.3", transfer_syntax::explicit_vr_little_endian);
+
+    retrieve_scp scp;
+    scp.set_pass_through(storage, [](const dicom_dataset&) {
+        return std::vector<std::string>{"1.2.3.4.3"};
+    });
+    scp.set_destination_resolver([](const std::string& ae)
+                                     -> std::optional<std::pair<std::string, uint16_t>> {
+        if (ae == "ARCHIVE") {
+            return std::make_pair(std::string("127.0.0.1"), uint16_t{11113});
+        }
+        return std::nullopt;
+    });
+
+    // The destination accepts CT storage in the stored transfer syntax
+    auto destination = accept_get_association("1.2.840.10008.1.2.1");
+    std::vector<captured_store> stores;
+    capture_stores(destination, stores);
+
+    std::string opened_for;
+    scp.set_move_association_provider(
+        [&](const std::string& ae, const std::string&, uint16_t)
+            -> std::shared_ptr<association> {
+            opened_for = ae;
+            return {&destination, [](association*) {}};
+        });
+
+    auto pacs = accept_move_association();
+    dimse_message request{command_field::c_move_rq, 5};
+    request.set_affected_sop_class_uid(study_root_move_sop_class_uid);
+    request.command_set().set_string(tag_move_destination, vr_type::AE, "ARCHIVE");
+    dicom_dataset keys;
+    keys.set_string(tags::query_retrieve_level, vr_type::CS, "STUDY");
+    keys.set_string(tags::study_instance_uid, vr_type::UI, "1.2.3");
+    request.set_dataset(std::move(keys));
+
+    REQUIRE(scp.handle_message(pacs, 1, request).is_ok());
+
+    CHECK(opened_for == "ARCHIVE");
+    REQUIRE(stores.size() == 1);
+    for (const auto& payload : stores[0].payloads) {
+        CHECK(points_into(payload, storage->bytes("1.2.3.4.3")));
+    }
+    const auto& stored = storage->bytes("1.2.3.4.3");
+    auto header = dicom_file::read_header(stored);
+    REQUIRE(header.is_ok());
+    CHECK(stores[0].dataset == std::vector<uint8_t>(
+        stored.begin() + static_cast<std::ptrdiff_t>(header.value().dataset_offset),
+        stored.end()));
+    CHECK(scp.images_transferred() == 1);
+    CHECK(scp.move_operations() == 1);
+}
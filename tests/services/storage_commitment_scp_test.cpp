@@ -9,9 +9,13 @@
 #include <kcenon/pacs/network/dimse/command_field.h>
 #include <kcenon/pacs/network/dimse/dimse_message.h>
 #include <kcenon/pacs/network/dimse/status_codes.h>
+#include <kcenon/pacs/network/association.h>
+#include <kcenon/pacs/storage/content_hash.h>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <atomic>
+#include <map>
 #include <set>
 #include <string>
 
@@ -31,6 +35,14 @@ public:
         instances_.insert(std::move(uid));
     }
 
+    void add_instance(std::string uid, std::vector<uint8_t> bytes) {
+        contents_[uid] = std::move(bytes);
+        instances_.insert(std::move(uid));
+    }
+
+    mutable std::atomic<int> exists_calls{0};
+    mutable std::atomic<int> exists_batch_calls{0};
+
     auto store(const dicom_dataset&) -> kcenon::pacs::storage::VoidResult override {
         return kcenon::common::ok();
     }
@@ -46,9 +58,35 @@ public:
     }
 
     auto exists(std::string_view sop_instance_uid) const -> bool override {
+        ++exists_calls;
         return instances_.count(std::string(sop_instance_uid)) > 0;
     }
 
+    auto exists_batch(const std::vector<std::string>& sop_instance_uids) const
+        -> std::vector<bool> override {
+        ++exists_batch_calls;
+        std::vector<bool> found;
+        for (const auto& uid : sop_instance_uids) {
+            found.push_back(instances_.count(uid) > 0);
+        }
+        return found;
+    }
+
+    auto open_read(std::string_view sop_instance_uid,
+                   kcenon::pacs::storage::byte_range range)
+        -> kcenon::pacs::storage::Result<
+            std::unique_ptr<kcenon::pacs::storage::byte_source>> override {
+        auto it = contents_.find(std::string(sop_instance_uid));
+        if (it == contents_.end()) {
+            return kcenon::common::make_error<
+                std::unique_ptr<kcenon::pacs::storage::byte_source>>(
+                -1, "not found");
+        }
+        return std::unique_ptr<kcenon::pacs::storage::byte_source>(
+            std::make_unique<kcenon::pacs::storage::memory_byte_source>(
+                it->second, range));
+    }
+
     auto find(const dicom_dataset&)
         -> kcenon::pacs::storage::Result<std::vector<dicom_dataset>> override {
         return kcenon::common::Result<std::vector<dicom_dataset>>::ok(
@@ -65,6 +103,16 @@ public:
 
 private:
     std::set<std::string> instances_;
+    std::map<std::string, std::vector<uint8_t>> contents_;
+};
+
+/// Minimal storage relying on the default exists_batch()
+class exists_only_storage : public mock_storage {
+public:
+    auto exists_batch(const std::vector<std::string>& sop_instance_uids) const
+        -> std::vector<bool> override {
+        return storage_interface::exists_batch(sop_instance_uids);
+    }
 };
 
 // ============================================================================
@@ -271,3 +319,196 @@ TEST_CASE("mock_storage exists behavior", "[services][storage_commitment]") {
     CHECK_FALSE(storage->exists("1.2.3.4.7"));
     CHECK_FALSE(storage->exists(""));
 }
+
+// ============================================================================
+// Batched Verification Tests
+// ============================================================================
+
+TEST_CASE("storage_interface default exists_batch", "[services][storage_commitment]") {
+    exists_only_storage storage;
+    storage.add_instance("1.1");
+    storage.add_instance("1.3");
+
+    auto found = storage.exists_batch({"1.1", "1.2", "1.3", ""});
+    CHECK(found == std::vector<bool>{true, false, true, false});
+    CHECK(storage.exists_calls.load() == 4);
+}
+
+TEST_CASE("storage_commitment_scp verifies with one batch lookup",
+          "[services][storage_commitment]") {
+    auto storage = std::make_shared<mock_storage>();
+    std::vector<sop_reference> references;
+    for (int i = 0; i < 2000; ++i) {
+        auto uid = "1.2.3." + std::to_string(i);
+        if (i % 10 != 0) {
+            storage->add_instance(uid);
+        }
+        references.push_back({"1.2.840.10008.5.1.4.1.1.2", uid});
+    }
+
+    storage_commitment_scp scp(storage);
+    auto result = scp.verify_instances("2.25.1", references);
+
+    CHECK(storage->exists_batch_calls.load() == 1);
+    CHECK(storage->exists_calls.load() == 0);
+    CHECK(result.transaction_uid == "2.25.1");
+    CHECK(result.success_references.size() == 1800);
+    REQUIRE(result.failed_references.size() == 200);
+    CHECK(result.failed_references[0].first.sop_instance_uid == "1.2.3.0");
+    CHECK(result.failed_references[0].second ==
+          commitment_failure_reason::no_such_object_instance);
+}
+
+TEST_CASE("storage_commitment_scp checksum verification",
+          "[services][storage_commitment]") {
+    using kcenon::pacs::storage::content_hasher;
+
+    const std::vector<uint8_t> good{1, 2, 3, 4, 5};
+    const std::vector<uint8_t> corrupted{9, 9, 9};
+
+    auto storage = std::make_shared<mock_storage>();
+    storage->add_instance("1.1", good);
+    storage->add_instance("1.2", corrupted);
+    storage->add_instance("1.3", good);
+    storage->add_instance("1.4", good);
+
+    std::map<std::string, std::string> recorded{
+        {"1.1", "xxh64:" + std::string(16, '0')},
+        {"1.2", ""},
+        {"1.4", "sha256:abc"},
+    };
+    {
+        content_hasher hasher;
+        hasher.update(good);
+        recorded["1.1"] = hasher.hex_digest();
+        recorded["1.2"] = hasher.hex_digest();
+    }
+
+    storage_commitment_scp_config config;
+    config.verify_checksums = true;
+    config.checksum_threads = 3;
+    storage_commitment_scp scp(storage, config);
+
+    std::vector<std::string> looked_up;
+    scp.set_hash_lookup([&](const std::vector<std::string>& uids) {
+        looked_up = uids;
+        std::unordered_map<std::string, std::string> hashes;
+        for (const auto& uid : uids) {
+            if (auto it = recorded.find(uid); it != recorded.end()) {
+                hashes.emplace(uid, it->second);
+            }
+        }
+        return hashes;
+    });
+
+    auto result = scp.verify_instances("2.25.2", {
+        {"1.2.840.10008.5.1.4.1.1.2", "1.1"},
+        {"1.2.840.10008.5.1.4.1.1.2", "1.2"},
+        {"1.2.840.10008.5.1.4.1.1.2", "1.3"},
+        {"1.2.840.10008.5.1.4.1.1.2", "1.4"},
+        {"1.2.840.10008.5.1.4.1.1.2", "1.5"},
+    });
+
+    // Missing instances are not looked up; unknown hash formats pass
+    CHECK(looked_up == std::vector<std::string>{"1.1", "1.2", "1.3", "1.4"});
+    CHECK(result.success_references.size() == 3);
+    REQUIRE(result.failed_references.size() == 2);
+    CHECK(result.failed_references[0].first.sop_instance_uid == "1.2");
+    CHECK(result.failed_references[0].second ==
+          commitment_failure_reason::processing_failure);
+    CHECK(result.failed_references[1].first.sop_instance_uid == "1.5");
+    CHECK(result.failed_references[1].second ==
+          commitment_failure_reason::no_such_object_instance);
+}
+
+// ============================================================================
+// Asynchronous N-EVENT-REPORT Tests
+// ============================================================================
+
+namespace {
+
+association accept_commitment_association() {
+    associate_rq rq;
+    rq.calling_ae_title = "MODALITY";
+    rq.called_ae_title = "PACS";
+    rq.application_context = "1.2.840.10008.3.1.1.1";
+    rq.presentation_contexts.push_back({
+        1, std::string(storage_commitment_push_model_sop_class_uid),
+        {"1.2.840.10008.1.2.1"}});
+
+    scp_config config;
+    config.ae_title = "PACS";
+    config.supported_abstract_syntaxes = {
+        std::string(storage_commitment_push_model_sop_class_uid)};
+    config.supported_transfer_syntaxes = {"1.2.840.10008.1.2.1"};
+    return association::accept(rq, config);
+}
+
+dimse_message make_commitment_request(const std::vector<sop_reference>& refs) {
+    auto request = make_n_action_rq(
+        7, storage_commitment_push_model_sop_class_uid,
+        storage_commitment_push_model_sop_instance_uid,
+        storage_commitment_action_type_request);
+    request.set_dataset(build_action_dataset("2.25.99", refs));
+    return request;
+}
+
+}  // namespace
+
+TEST_CASE("storage_commitment_scp sends N-EVENT-REPORT asynchronously",
+          "[services][storage_commitment]") {
+    auto storage = std::make_shared<mock_storage>();
+    storage->add_instance("1.1.1.1");
+
+    auto modality = accept_commitment_association();
+    auto pacs = accept_commitment_association();
+    pacs.set_peer(&modality);
+
+    storage_commitment_scp scp(storage);
+    auto handled = scp.handle_message(pacs, 1, make_commitment_request({
+        {"1.2.840.10008.5.1.4.1.1.2", "1.1.1.1"},
+        {"1.2.840.10008.5.1.4.1.1.2", "1.1.1.9"},
+    }));
+    REQUIRE(handled.is_ok());
+    CHECK(scp.actions_processed() == 1);
+
+    auto rsp = modality.receive_dimse(std::chrono::milliseconds(1000));
+    REQUIRE(rsp.is_ok());
+    CHECK(rsp.value().second.command() == command_field::n_action_rsp);
+    CHECK(rsp.value().second.status() == status_success);
+
+    scp.wait_for_pending_reports();
+    auto report = modality.receive_dimse(std::chrono::milliseconds(1000));
+    REQUIRE(report.is_ok());
+    const auto& event = report.value().second;
+    CHECK(event.command() == command_field::n_event_report_rq);
+    CHECK(event.event_type_id() == storage_commitment_event_type_failure);
+    REQUIRE(event.has_dataset());
+    CHECK(event.dataset().value().get().get_string(tags::transaction_uid) ==
+          "2.25.99");
+    CHECK(scp.instances_committed() == 1);
+    CHECK(scp.instances_failed() == 1);
+}
+
+TEST_CASE("storage_commitment_scp outlives the requesting association",
+          "[services][storage_commitment]") {
+    auto storage = std::make_shared<mock_storage>();
+    storage->add_instance("1.1.1.1");
+    storage_commitment_scp scp(storage);
+
+    auto modality = accept_commitment_association();
+    {
+        auto pacs = accept_commitment_association();
+        pacs.set_peer(&modality);
+        REQUIRE(scp.handle_message(pacs, 1, make_commitment_request({
+            {"1.2.840.10008.5.1.4.1.1.2", "1.1.1.1"},
+        })).is_ok());
+    }
+
+    scp.wait_for_pending_reports();
+    CHECK(scp.instances_committed() == 1);
+
+    auto rsp = modality.receive_dimse(std::chrono::milliseconds(1000));
+    REQUIRE(rsp.is_ok());
+    CHECK(rsp.value().second.command() == command_field::n_action_rsp);
+}
@@ -0,0 +1,225 @@
+/**
+ * @file transcoding_service_test.cpp
+ * @brief Unit tests for transcoding_service and transcode_cache
+ */
+
+#include <kcenon/pacs/services/transcoding/transcoding_service.h>
+#include <kcenon/pacs/services/transcoding/transcode_cache.h>
+#include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/vr_type.h>
+#include <kcenon/pacs/monitoring/pacs_metrics.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace kcenon::pacs::services;
+using namespace kcenon::pacs::core;
+using namespace kcenon::pacs::encoding;
+
+namespace {
+
+constexpr dicom_tag number_of_frames_tag{0x0028, 0x0008};
+
+/**
+ * @brief Create a multi-frame 8-bit MONOCHROME2 instance
+ */
+dicom_file make_native_file(uint16_t rows, uint16_t cols, uint32_t frames,
+                            const std::string& sop_uid = "1.2.3.4.5.6.7") {
+    dicom_dataset ds;
+    ds.set_string(tags::sop_class_uid, vr_type::UI, "1.2.840.10008.5.1.4.1.1.7");
+    ds.set_string(tags::sop_instance_uid, vr_type::UI, sop_uid);
+    ds.set_numeric<uint16_t>(tags::rows, vr_type::US, rows);
+    ds.set_numeric<uint16_t>(tags::columns, vr_type::US, cols);
+    ds.set_numeric<uint16_t>(tags::bits_allocated, vr_type::US, 8);
+    ds.set_numeric<uint16_t>(tags::bits_stored, vr_type::US, 8);
+    ds.set_numeric<uint16_t>(tags::high_bit, vr_type::US, 7);
+    ds.set_numeric<uint16_t>(tags::samples_per_pixel, vr_type::US, 1);
+    ds.set_numeric<uint16_t>(tags::pixel_representation, vr_type::US, 0);
+    ds.set_string(tags::photometric_interpretation, vr_type::CS, "MONOCHROME2");
+    ds.set_string(number_of_frames_tag, vr_type::IS, std::to_string(frames));
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(rows) * cols * frames);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>((i / cols) % 7 == 0 ? 0 : i % 251);
+    }
+    ds.insert(dicom_element(tags::pixel_data, vr_type::OB, pixels));
+
+    return dicom_file::create(std::move(ds), transfer_syntax::explicit_vr_little_endian);
+}
+
+std::vector<uint8_t> pixel_bytes(const dicom_file& file) {
+    const auto* elem = file.dataset().get(tags::pixel_data);
+    REQUIRE(elem != nullptr);
+    auto raw = elem->raw_data();
+    return {raw.begin(), raw.end()};
+}
+
+struct temp_dir {
+    std::filesystem::path path;
+    explicit temp_dir(const std::string& name)
+        : path(std::filesystem::temp_directory_path() / name) {
+        std::filesystem::remove_all(path);
+    }
+    ~temp_dir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path, ec);
+    }
+};
+
+}  // namespace
+
+// ============================================================================
+// transcoding_service Tests
+// ============================================================================
+
+TEST_CASE("transcoding_service capability checks", "[services][transcoding]") {
+    transcoding_service service;
+
+    SECTION("identity conversion is always possible") {
+        CHECK(service.can_transcode(transfer_syntax::jpeg_baseline,
+                                    transfer_syntax::jpeg_baseline));
+    }
+
+    SECTION("native to native is possible") {
+        CHECK(service.can_transcode(transfer_syntax::explicit_vr_little_endian,
+                                    transfer_syntax::implicit_vr_little_endian));
+    }
+
+    SECTION("native to RLE is possible") {
+        CHECK(service.can_transcode(transfer_syntax::explicit_vr_little_endian,
+                                    transfer_syntax::rle_lossless));
+    }
+
+    SECTION("lossy targets require opt-in") {
+        CHECK_FALSE(service.can_transcode(transfer_syntax::explicit_vr_little_endian,
+                                          transfer_syntax::jpeg_baseline));
+    }
+
+    SECTION("select_target prefers the stored syntax") {
+        std::vector<std::string> acceptable = {
+            std::string(transfer_syntax::explicit_vr_little_endian.uid()),
+            std::string(transfer_syntax::rle_lossless.uid())};
+        auto selected = service.select_target(transfer_syntax::rle_lossless, acceptable);
+        REQUIRE(selected.has_value());
+        CHECK(*selected == transfer_syntax::rle_lossless);
+    }
+}
+
+TEST_CASE("transcoding_service conversions", "[services][transcoding]") {
+    transcoding_config config;
+    config.max_parallel_frames = 4;
+    transcoding_service service(config);
+
+    auto original = make_native_file(16, 16, 6);
+    const auto original_pixels = pixel_bytes(original);
+
+    SECTION("same transfer syntax returns the input") {
+        auto result = service.transcode(original, transfer_syntax::explicit_vr_little_endian);
+        REQUIRE(result.is_ok());
+        CHECK(pixel_bytes(result.value()) == original_pixels);
+    }
+
+    SECTION("native to native changes only the transfer syntax") {
+        auto result = service.transcode(original, transfer_syntax::implicit_vr_little_endian);
+        REQUIRE(result.is_ok());
+        CHECK(result.value().transfer_syntax() == transfer_syntax::implicit_vr_little_endian);
+        CHECK(pixel_bytes(result.value()) == original_pixels);
+    }
+
+    SECTION("multi-frame RLE round trip is lossless") {
+        auto& metrics = kcenon::pacs::monitoring::pacs_metrics::global_metrics();
+        const auto frames_before = metrics.transcoding().frames_processed.load();
+
+        auto compressed = service.transcode(original, transfer_syntax::rle_lossless);
+        REQUIRE(compressed.is_ok());
+        CHECK(compressed.value().transfer_syntax() == transfer_syntax::rle_lossless);
+
+        auto restored = service.transcode(compressed.value(),
+                                          transfer_syntax::explicit_vr_little_endian);
+        REQUIRE(restored.is_ok());
+        CHECK(pixel_bytes(restored.value()) == original_pixels);
+
+        CHECK(metrics.transcoding().frames_processed.load() - frames_before == 12);
+    }
+
+    SECTION("encapsulated output survives serialization") {
+        auto compressed = service.transcode(original, transfer_syntax::rle_lossless);
+        REQUIRE(compressed.is_ok());
+
+        auto bytes = compressed.value().to_bytes();
+        auto reparsed = dicom_file::from_bytes(bytes);
+        REQUIRE(reparsed.is_ok());
+
+        auto restored = service.transcode(reparsed.value(),
+                                          transfer_syntax::explicit_vr_little_endian);
+        REQUIRE(restored.is_ok());
+        CHECK(pixel_bytes(restored.value()) == original_pixels);
+    }
+}
+
+// ============================================================================
+// transcode_cache Tests
+// ============================================================================
+
+TEST_CASE("transcode_cache basic operations", "[services][transcoding]") {
+    temp_dir dir("pacs_transcode_cache_test");
+    transcode_cache cache(dir.path, 100);
+
+    std::vector<uint8_t> data(40, 0xAB);
+    const std::string kDigest = "xxh64:0123456789abcdef";
+
+    SECTION("miss then hit") {
+        CHECK_FALSE(cache.get("1.2.3", "1.2.840.10008.1.2.5", kDigest).has_value());
+        REQUIRE(cache.put("1.2.3", "1.2.840.10008.1.2.5", kDigest, data));
+        auto hit = cache.get("1.2.3", "1.2.840.10008.1.2.5", kDigest);
+        REQUIRE(hit.has_value());
+        CHECK(*hit == data);
+        CHECK(cache.entry_count() == 1);
+        CHECK(cache.size_bytes() == 40);
+    }
+
+    SECTION("least recently used entry is evicted") {
+        REQUIRE(cache.put("1.1", "1.2.840.10008.1.2.5", kDigest, data));
+        REQUIRE(cache.put("1.2", "1.2.840.10008.1.2.5", kDigest, data));
+        CHECK(cache.get("1.1", "1.2.840.10008.1.2.5", kDigest).has_value());  // touch 1.1
+        REQUIRE(cache.put("1.3", "1.2.840.10008.1.2.5", kDigest, data));
+
+        CHECK(cache.get("1.1", "1.2.840.10008.1.2.5", kDigest).has_value());
+        CHECK_FALSE(cache.get("1.2", "1.2.840.10008.1.2.5", kDigest).has_value());
+        CHECK(cache.size_bytes() <= 100);
+    }
+
+    SECTION("invalid UIDs are not used as file names") {
+        CHECK_FALSE(cache.put("../etc/passwd", "1.2", kDigest, data));
+        CHECK(cache.entry_count() == 0);
+    }
+
+    SECTION("invalidate removes every syntax of an instance") {
+        REQUIRE(cache.put("1.5", "1.2.840.10008.1.2.5", kDigest, data));
+        REQUIRE(cache.put("1.5", "1.2.840.10008.1.2.1", kDigest, std::vector<uint8_t>(10, 1)));
+        cache.invalidate("1.5");
+        CHECK(cache.entry_count() == 0);
+    }
+
+    SECTION("re-stored source bytes miss and replace the old encoding") {
+        REQUIRE(cache.put("1.6", "1.2.840.10008.1.2.5", kDigest, data));
+        CHECK_FALSE(
+            cache.get("1.6", "1.2.840.10008.1.2.5", "xxh64:fedcba9876543210").has_value());
+
+        REQUIRE(cache.put("1.6", "1.2.840.10008.1.2.5", "xxh64:fedcba9876543210",
+                          std::vector<uint8_t>(10, 2)));
+        CHECK_FALSE(cache.get("1.6", "1.2.840.10008.1.2.5", kDigest).has_value());
+        CHECK(cache.entry_count() == 1);
+        CHECK(cache.size_bytes() == 10);
+    }
+
+    SECTION("entries survive a restart") {
+        REQUIRE(cache.put("1.7", "1.2.840.10008.1.2.5", kDigest, data));
+        transcode_cache reopened(dir.path, 100);
+        CHECK(reopened.entry_count() == 1);
+        CHECK(reopened.get("1.7", "1.2.840.10008.1.2.5", kDigest).has_value());
+    }
+}
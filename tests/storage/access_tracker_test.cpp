@@ -0,0 +1,78 @@
+/**
+ * @file access_tracker_test.cpp
+ * @brief Unit tests for the sharded access time buffer
+ */
+
+#include <kcenon/pacs/storage/access_tracker.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kcenon::pacs::storage;
+using namespace std::chrono_literals;
+
+TEST_CASE("access_tracker: timestamps are truncated to the granularity",
+          "[storage][access_tracker]") {
+    access_tracker tracker{1s};
+    const auto when = access_tracker::clock::time_point{} + 1234567ms;
+
+    tracker.record("1.2.3", when);
+
+    auto recorded = tracker.last_access("1.2.3");
+    REQUIRE(recorded.has_value());
+    CHECK(*recorded == access_tracker::clock::time_point{} + 1234s);
+    CHECK_FALSE(tracker.last_access("4.5.6").has_value());
+}
+
+TEST_CASE("access_tracker: keeps the latest access per instance",
+          "[storage][access_tracker]") {
+    access_tracker tracker{1s};
+    const auto base = access_tracker::clock::time_point{} + 1000s;
+
+    tracker.record("1.2.3", base + 5s);
+    tracker.record("1.2.3", base);
+    tracker.record("1.2.3", base + 2s);
+
+    CHECK(tracker.pending() == 1);
+    CHECK(tracker.last_access("1.2.3") == base + 5s);
+}
+
+TEST_CASE("access_tracker: drain empties the buffer",
+          "[storage][access_tracker]") {
+    access_tracker tracker;
+    tracker.record("1.2.3");
+    tracker.record("1.2.4");
+    tracker.record("1.2.5");
+    REQUIRE(tracker.pending() == 3);
+
+    auto drained = tracker.drain();
+    CHECK(drained.size() == 3);
+    CHECK(tracker.pending() == 0);
+    CHECK_FALSE(tracker.last_access("1.2.3").has_value());
+    CHECK(tracker.drain().empty());
+}
+
+TEST_CASE("access_tracker: concurrent records", "[storage][access_tracker]") {
+    access_tracker tracker;
+    constexpr int kThreads = 8;
+    constexpr int kInstances = 200;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&tracker]() {
+            for (int i = 0; i < kInstances; ++i) {
+                tracker.record("1.2.3." + std::to_string(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    CHECK(tracker.pending() == kInstances);
+    CHECK(tracker.drain().size() == kInstances);
+}
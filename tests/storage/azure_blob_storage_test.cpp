@@ -8,12 +8,17 @@
 
 #include <kcenon/pacs/storage/azure_blob_storage.h>
 
+#include <kcenon/pacs/core/dicom_file.h>
 #include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/transfer_syntax.h>
 #include <kcenon/pacs/encoding/vr_type.h>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 
 using namespace kcenon::pacs::storage;
 using namespace kcenon::pacs::core;
@@ -476,6 +481,95 @@ TEST_CASE("azure_blob_storage: set_access_tier",
   }
 }
 
+// ============================================================================
+// Byte Stream Tests
+// ============================================================================
+
+TEST_CASE("azure_blob_storage: store_stream and ranged open_read",
+          "[storage][azure_blob_storage][stream]") {
+  auto config = create_test_config();
+  azure_blob_storage storage{config};
+
+  auto bytes = dicom_file::create(
+                   create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.5"),
+                   transfer_syntax::explicit_vr_little_endian)
+                   .to_bytes();
+  memory_byte_source source(bytes);
+
+  auto stored = storage.store_stream(source);
+  REQUIRE(stored.is_ok());
+  CHECK(stored.value().series_instance_uid == "1.2.3.4");
+  CHECK(storage.exists("1.2.3.4.5"));
+
+  auto whole = storage.open_read("1.2.3.4.5");
+  REQUIRE(whole.is_ok());
+  auto read_back = whole.value()->read_all();
+  REQUIRE(read_back.is_ok());
+  CHECK(read_back.value() == bytes);
+
+  auto tail = storage.open_read("1.2.3.4.5", byte_range{bytes.size() - 8, 100});
+  REQUIRE(tail.is_ok());
+  CHECK(tail.value()->size() == 8);
+
+  CHECK(storage.open_read("1.2.3.4.5", byte_range{bytes.size() + 1}).is_err());
+}
+
+TEST_CASE("azure_blob_storage: parallel part transfer and download_to_file",
+          "[storage][azure_blob_storage][stream]") {
+  auto config = create_test_config();
+  config.block_upload_threshold = 100;
+  config.block_size = 64;
+  config.max_concurrency = 4;
+  azure_blob_storage storage{config};
+
+  auto bytes = dicom_file::create(
+                   create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.5"),
+                   transfer_syntax::explicit_vr_little_endian)
+                   .to_bytes();
+  REQUIRE(bytes.size() > 4 * 64);
+  memory_byte_source source(bytes);
+
+  std::atomic<std::size_t> last_bytes{0};
+  auto stored = storage.store_stream(source);
+  REQUIRE(stored.is_ok());
+
+  auto whole = storage.open_read("1.2.3.4.5");
+  REQUIRE(whole.is_ok());
+  auto read_back = whole.value()->read_all();
+  REQUIRE(read_back.is_ok());
+  CHECK(read_back.value() == bytes);
+
+  auto middle = storage.open_read("1.2.3.4.5", byte_range{10, 200});
+  REQUIRE(middle.is_ok());
+  auto slice = middle.value()->read_all();
+  REQUIRE(slice.is_ok());
+  CHECK(slice.value() ==
+        std::vector<std::uint8_t>(bytes.begin() + 10, bytes.begin() + 210));
+
+  const auto path = std::filesystem::temp_directory_path() /
+                    "azure_blob_storage_download_to_file_test.dcm";
+  auto downloaded = storage.download_to_file(
+      "1.2.3.4.5", path, [&](std::size_t done, std::size_t) {
+        last_bytes = done;
+        return true;
+      });
+  REQUIRE(downloaded.is_ok());
+  CHECK(last_bytes.load() == bytes.size());
+  {
+    std::ifstream in(path, std::ios::binary);
+    std::vector<std::uint8_t> on_disk((std::istreambuf_iterator<char>(in)),
+                                      std::istreambuf_iterator<char>());
+    CHECK(on_disk == bytes);
+  }
+
+  auto cancelled = storage.download_to_file(
+      "1.2.3.4.5", path, [](std::size_t, std::size_t) { return false; });
+  CHECK(cancelled.is_err());
+  CHECK_FALSE(std::filesystem::exists(path));
+
+  CHECK(storage.download_to_file("9.9.9", path).is_err());
+}
+
 // ============================================================================
 // Azure Storage Config Tests
 // ============================================================================
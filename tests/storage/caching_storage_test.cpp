@@ -0,0 +1,422 @@
+/**
+ * @file caching_storage_test.cpp
+ * @brief Unit tests for the read-through disk cache decorator
+ *
+ * The cloud backends run against their built-in mock clients; a counting
+ * decorator between the cache and the backend shows which reads reached
+ * the backend.
+ */
+
+#include <kcenon/pacs/storage/azure_blob_storage.h>
+#include <kcenon/pacs/storage/caching_storage.h>
+#include <kcenon/pacs/storage/s3_storage.h>
+
+#include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/vr_type.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <fstream>
+#include <utility>
+
+using namespace kcenon::pacs::storage;
+using namespace kcenon::pacs::core;
+using namespace kcenon::pacs::encoding;
+
+namespace {
+
+class temp_directory {
+public:
+    temp_directory() {
+        path_ = std::filesystem::temp_directory_path() /
+                ("pacs_cache_test_" +
+                 std::to_string(
+                     std::chrono::steady_clock::now().time_since_epoch().count()));
+        std::filesystem::create_directories(path_);
+    }
+
+    ~temp_directory() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    [[nodiscard]] auto path() const -> const std::filesystem::path& {
+        return path_;
+    }
+
+private:
+    std::filesystem::path path_;
+};
+
+/**
+ * @brief Forwards to a backend and counts the reads reaching it
+ */
+class counting_storage : public storage_interface {
+public:
+    explicit counting_storage(std::unique_ptr<storage_interface> backend)
+        : backend_(std::move(backend)) {}
+
+    auto store(const dicom_dataset& dataset) -> VoidResult override {
+        return backend_->store(dataset);
+    }
+    auto retrieve(std::string_view uid) -> Result<dicom_dataset> override {
+        ++whole_reads;
+        return backend_->retrieve(uid);
+    }
+    auto open_read(std::string_view uid, byte_range range)
+        -> Result<std::unique_ptr<byte_source>> override {
+        ++(range.is_whole() ? whole_reads : range_reads);
+        auto source = backend_->open_read(uid, range);
+        if (after_fetch) {
+            std::exchange(after_fetch, nullptr)();
+        }
+        return source;
+    }
+    auto remove(std::string_view uid) -> VoidResult override {
+        return backend_->remove(uid);
+    }
+    auto exists(std::string_view uid) const -> bool override {
+        return backend_->exists(uid);
+    }
+    auto find(const dicom_dataset& query)
+        -> Result<std::vector<dicom_dataset>> override {
+        return backend_->find(query);
+    }
+    auto get_statistics() const -> storage_statistics override {
+        return backend_->get_statistics();
+    }
+    auto verify_integrity() -> VoidResult override {
+        return backend_->verify_integrity();
+    }
+
+    std::atomic<int> whole_reads{0};
+    std::atomic<int> range_reads{0};
+
+    /// Runs once after the next fetch, while the caller still holds it
+    std::function<void()> after_fetch;
+
+private:
+    std::unique_ptr<storage_interface> backend_;
+};
+
+auto create_test_dataset(const std::string& sop_uid,
+                         const std::string& patient_name = "TEST^PATIENT")
+    -> dicom_dataset {
+    dicom_dataset ds;
+    ds.set_string(tags::study_instance_uid, vr_type::UI, "1.2.3");
+    ds.set_string(tags::series_instance_uid, vr_type::UI, "1.2.3.4");
+    ds.set_string(tags::sop_instance_uid, vr_type::UI, sop_uid);
+    ds.set_string(tags::sop_class_uid, vr_type::UI, "1.2.840.10008.5.1.4.1.1.2");
+    ds.set_string(tags::patient_id, vr_type::LO, "P001");
+    ds.set_string(tags::patient_name, vr_type::PN, patient_name);
+    ds.set_string(tags::modality, vr_type::CS, "CT");
+    return ds;
+}
+
+auto create_s3_backend() -> std::shared_ptr<counting_storage> {
+    cloud_storage_config config;
+    config.bucket_name = "test-dicom-bucket";
+    config.region = "us-east-1";
+    config.access_key_id = "test-access-key";
+    config.secret_access_key = "test-secret-key";
+    config.endpoint_url = "http://localhost:9000";
+    return std::make_shared<counting_storage>(std::make_unique<s3_storage>(config));
+}
+
+auto create_azure_backend() -> std::shared_ptr<counting_storage> {
+    azure_storage_config config;
+    config.container_name = "test-dicom-container";
+    config.connection_string =
+        "DefaultEndpointsProtocol=http;AccountName=devstoreaccount1;"
+        "AccountKey=Eby8vdM02xNOcqFlqUwJPLlmEtlCDXJ1OUzFT50uSRZ6IFsuFq2UVErCz4I6t"
+        "q/K1SZFPTOtr/KBHBeksoGMGw==;"
+        "BlobEndpoint=http://127.0.0.1:10000/devstoreaccount1";
+    config.endpoint_url = "http://127.0.0.1:10000/devstoreaccount1";
+    return std::make_shared<counting_storage>(
+        std::make_unique<azure_blob_storage>(config));
+}
+
+auto object_size(storage_interface& backend, const std::string& uid)
+    -> std::uint64_t {
+    auto source = backend.open_read(uid);
+    REQUIRE(source.is_ok());
+    return source.value()->size();
+}
+
+}  // namespace
+
+TEST_CASE("caching_storage: repeated reads are served from the cache",
+          "[storage][cache]") {
+    temp_directory temp_dir;
+    auto backend = create_s3_backend();
+    cache_config config;
+    config.directory = temp_dir.path();
+    caching_storage cache{backend, config};
+
+    REQUIRE(cache.store(create_test_dataset("1.2.3.4.1")).is_ok());
+    CHECK_FALSE(cache.is_cached("1.2.3.4.1"));
+
+    auto first = cache.retrieve("1.2.3.4.1");
+    REQUIRE(first.is_ok());
+    CHECK(cache.is_cached("1.2.3.4.1"));
+
+    auto second = cache.retrieve("1.2.3.4.1");
+    REQUIRE(second.is_ok());
+    CHECK(second.value().get_string(tags::patient_name) == "TEST^PATIENT");
+    CHECK(backend->whole_reads == 1);
+
+    auto stats = cache.get_cache_statistics();
+    CHECK(stats.misses == 1);
+    CHECK(stats.hits == 1);
+    CHECK(stats.admissions == 1);
+    CHECK(stats.entries == 1);
+    CHECK(stats.bytes_cached > 0);
+}
+
+TEST_CASE("caching_storage: byte ranges of uncached objects are passed through",
+          "[storage][cache]") {
+    temp_directory temp_dir;
+    auto backend = create_s3_backend();
+    cache_config config;
+    config.directory = temp_dir.path();
+    caching_storage cache{backend, config};
+
+    REQUIRE(cache.store(create_test_dataset("1.2.3.4.1")).is_ok());
+
+    auto header = cache.open_read("1.2.3.4.1", {128, 4});
+    REQUIRE(header.is_ok());
+    auto bytes = header.value()->read_all();
+    REQUIRE(bytes.is_ok());
+    CHECK(std::string(bytes.value().begin(), bytes.value().end()) == "DICM");
+    CHECK(backend->range_reads == 1);
+    CHECK_FALSE(cache.is_cached("1.2.3.4.1"));
+
+    // Once cached, ranges are served locally
+    REQUIRE(cache.open_read("1.2.3.4.1").is_ok());
+    auto cached = cache.open_read("1.2.3.4.1", {128, 4});
+    REQUIRE(cached.is_ok());
+    CHECK(cached.value()->size() == 4);
+    CHECK(backend->range_reads == 1);
+    CHECK(backend->whole_reads == 1);
+    CHECK(cache.get_cache_statistics().range_passthroughs == 1);
+
+    CHECK(cache.open_read("1.2.3.4.1", {1u << 30, 4}).is_err());
+}
+
+TEST_CASE("caching_storage: admission threshold", "[storage][cache]") {
+    temp_directory temp_dir;
+    auto backend = create_s3_backend();
+    cache_config config;
+    config.directory = temp_dir.path();
+    config.admission_threshold = 2;
+    caching_storage cache{backend, config};
+
+    REQUIRE(cache.store(create_test_dataset("1.2.3.4.1")).is_ok());
+
+    REQUIRE(cache.retrieve("1.2.3.4.1").is_ok());
+    CHECK_FALSE(cache.is_cached("1.2.3.4.1"));
+    REQUIRE(cache.retrieve("1.2.3.4.1").is_ok());
+    CHECK(cache.is_cached("1.2.3.4.1"));
+    REQUIRE(cache.retrieve("1.2.3.4.1").is_ok());
+
+    CHECK(backend->whole_reads == 2);
+    auto stats = cache.get_cache_statistics();
+    CHECK(stats.rejections == 1);
+    CHECK(stats.admissions == 1);
+    CHECK(stats.hits == 1);
+}
+
+TEST_CASE("caching_storage: objects above the size limit are not cached",
+          "[storage][cache]") {
+    temp_directory temp_dir;
+    auto backend = create_s3_backend();
+    cache_config config;
+    config.directory = temp_dir.path();
+    config.max_object_size = 16;
+    caching_storage cache{backend, config};
+
+    REQUIRE(cache.store(create_test_dataset("1.2.3.4.1")).is_ok());
+    REQUIRE(cache.retrieve("1.2.3.4.1").is_ok());
+    CHECK_FALSE(cache.is_cached("1.2.3.4.1"));
+    CHECK(cache.get_cache_statistics().rejections == 1);
+}
+
+TEST_CASE("caching_storage: least recently used objects are evicted",
+          "[storage][cache]") {
+    temp_directory temp_dir;
+    auto backend = create_s3_backend();
+    for (int i = 1; i <= 3; ++i) {
+        REQUIRE(backend->store(create_test_dataset("1.2.3.4." + std::to_string(i)))
+                    .is_ok());
+    }
+    const auto size = object_size(*backend, "1.2.3.4.1");
+
+    cache_config config;
+    config.directory = temp_dir.path();
+    config.max_bytes = 2 * size + size / 2;
+    caching_storage cache{backend, config};
+
+    REQUIRE(cache.retrieve("1.2.3.4.1").is_ok());
+    REQUIRE(cache.retrieve("1.2.3.4.2").is_ok());
+    REQUIRE(cache.retrieve("1.2.3.4.1").is_ok());  // 2 is now least recent
+    REQUIRE(cache.retrieve("1.2.3.4.3").is_ok());
+
+    CHECK(cache.is_cached("1.2.3.4.1"));
+    CHECK_FALSE(cache.is_cached("1.2.3.4.2"));
+    CHECK(cache.is_cached("1.2.3.4.3"));
+
+    auto stats = cache.get_cache_statistics();
+    CHECK(stats.evictions == 1);
+    CHECK(stats.bytes_cached <= config.max_bytes);
+}
+
+TEST_CASE("caching_storage: stores and removes invalidate cached copies",
+          "[storage][cache]") {
+    temp_directory temp_dir;
+    auto backend = create_s3_backend();
+    cache_config config;
+    config.directory = temp_dir.path();
+    caching_storage cache{backend, config};
+
+    REQUIRE(cache.store(create_test_dataset("1.2.3.4.1", "FIRST^NAME")).is_ok());
+    REQUIRE(cache.retrieve("1.2.3.4.1").is_ok());
+    REQUIRE(cache.is_cached("1.2.3.4.1"));
+
+    REQUIRE(cache.store(create_test_dataset("1.2.3.4.1", "SECOND^NAME")).is_ok());
+    CHECK_FALSE(cache.is_cached("1.2.3.4.1"));
+
+    auto updated = cache.retrieve("1.2.3.4.1");
+    REQUIRE(updated.is_ok());
+    CHECK(updated.value().get_string(tags::patient_name) == "SECOND^NAME");
+
+    REQUIRE(cache.remove("1.2.3.4.1").is_ok());
+    CHECK_FALSE(cache.is_cached("1.2.3.4.1"));
+    CHECK(cache.retrieve("1.2.3.4.1").is_err());
+    CHECK(cache.get_cache_statistics().invalidations == 2);
+}
+
+TEST_CASE("caching_storage: fills invalidated during the fetch are not cached",
+          "[storage][cache]") {
+    temp_directory temp_dir;
+    auto backend = create_s3_backend();
+    cache_config config;
+    config.directory = temp_dir.path();
+    caching_storage cache{backend, config};
+
+    REQUIRE(cache.store(create_test_dataset("1.2.3.4.1", "FIRST^NAME")).is_ok());
+
+    // A store finishing while the old bytes are in flight invalidates them
+    backend->after_fetch = [&] {
+        REQUIRE(backend->store(create_test_dataset("1.2.3.4.1", "SECOND^NAME")).is_ok());
+        cache.invalidate("1.2.3.4.1");
+    };
+    REQUIRE(cache.retrieve("1.2.3.4.1").is_ok());
+    CHECK_FALSE(cache.is_cached("1.2.3.4.1"));
+
+    auto fresh = cache.retrieve("1.2.3.4.1");
+    REQUIRE(fresh.is_ok());
+    CHECK(fresh.value().get_string(tags::patient_name) == "SECOND^NAME");
+    REQUIRE(cache.is_cached("1.2.3.4.1"));
+
+    auto cached = cache.retrieve("1.2.3.4.1");
+    REQUIRE(cached.is_ok());
+    CHECK(cached.value().get_string(tags::patient_name) == "SECOND^NAME");
+}
+
+TEST_CASE("caching_storage: index survives a restart", "[storage][cache]") {
+    temp_directory temp_dir;
+    auto backend = create_s3_backend();
+    for (int i = 1; i <= 3; ++i) {
+        REQUIRE(backend->store(create_test_dataset("1.2.3.4." + std::to_string(i)))
+                    .is_ok());
+    }
+
+    cache_config config;
+    config.directory = temp_dir.path();
+    {
+        caching_storage cache{backend, config};
+        for (int i = 1; i <= 3; ++i) {
+            REQUIRE(cache.retrieve("1.2.3.4." + std::to_string(i)).is_ok());
+        }
+        cache.invalidate("1.2.3.4.3");
+    }
+    const auto reads_before = backend->whole_reads.load();
+
+    caching_storage cache{backend, config};
+    CHECK(cache.is_cached("1.2.3.4.1"));
+    CHECK(cache.is_cached("1.2.3.4.2"));
+    CHECK_FALSE(cache.is_cached("1.2.3.4.3"));
+
+    REQUIRE(cache.retrieve("1.2.3.4.1").is_ok());
+    CHECK(backend->whole_reads == reads_before);
+    CHECK(cache.get_cache_statistics().entries == 2);
+}
+
+TEST_CASE("caching_storage: recovery discards damaged state",
+          "[storage][cache]") {
+    temp_directory temp_dir;
+    auto backend = create_s3_backend();
+    for (int i = 1; i <= 2; ++i) {
+        REQUIRE(backend->store(create_test_dataset("1.2.3.4." + std::to_string(i)))
+                    .is_ok());
+    }
+
+    cache_config config;
+    config.directory = temp_dir.path();
+    std::filesystem::path truncated;
+    {
+        caching_storage cache{backend, config};
+        REQUIRE(cache.retrieve("1.2.3.4.1").is_ok());
+        REQUIRE(cache.retrieve("1.2.3.4.2").is_ok());
+    }
+
+    // Truncate one object, leave an interrupted download and a torn record
+    for (const auto& entry :
+         std::filesystem::recursive_directory_iterator(temp_dir.path() / "objects")) {
+        if (entry.is_regular_file()) {
+            truncated = entry.path();
+            break;
+        }
+    }
+    REQUIRE_FALSE(truncated.empty());
+    std::filesystem::resize_file(truncated, 10);
+    std::ofstream(temp_dir.path() / "tmp" / "object.tmp.42") << "partial";
+    std::ofstream(temp_dir.path() / "index.journal", std::ios::app)
+        << "+ 0123456789abcdef 100 1.2.3.4.9";
+
+    caching_storage cache{backend, config};
+    auto stats = cache.get_cache_statistics();
+    CHECK(stats.entries == 1);
+    CHECK_FALSE(cache.is_cached("1.2.3.4.9"));
+    CHECK_FALSE(std::filesystem::exists(truncated));
+    CHECK(std::filesystem::is_empty(temp_dir.path() / "tmp"));
+
+    // Both instances are still readable; the damaged one is fetched again
+    REQUIRE(cache.retrieve("1.2.3.4.1").is_ok());
+    REQUIRE(cache.retrieve("1.2.3.4.2").is_ok());
+    CHECK(cache.get_cache_statistics().entries == 2);
+}
+
+TEST_CASE("caching_storage: azure backend", "[storage][cache]") {
+    temp_directory temp_dir;
+    auto backend = create_azure_backend();
+    cache_config config;
+    config.directory = temp_dir.path();
+    caching_storage cache{backend, config};
+
+    REQUIRE(cache.store(create_test_dataset("1.2.3.4.1")).is_ok());
+    REQUIRE(cache.retrieve_file("1.2.3.4.1").is_ok());
+    auto again = cache.retrieve_file("1.2.3.4.1");
+    REQUIRE(again.is_ok());
+    CHECK(again.value().sop_instance_uid() == "1.2.3.4.1");
+    CHECK(backend->whole_reads == 1);
+
+    auto frame = cache.open_read("1.2.3.4.1", {0, 132});
+    REQUIRE(frame.is_ok());
+    CHECK(frame.value()->size() == 132);
+    CHECK(backend->range_reads == 0);
+}
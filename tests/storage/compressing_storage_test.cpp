@@ -0,0 +1,338 @@
+/**
+ * @file compressing_storage_test.cpp
+ * @brief Unit tests for compression_policy, compressing_storage and
+ *        recompression during HSM tier migration
+ */
+
+#include <kcenon/pacs/storage/compressing_storage.h>
+#include <kcenon/pacs/storage/compression_policy.h>
+#include <kcenon/pacs/storage/file_storage.h>
+#include <kcenon/pacs/storage/fixity_scrubber.h>
+#include <kcenon/pacs/storage/hsm_storage.h>
+#include <kcenon/pacs/storage/index_database.h>
+
+#include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/compression/pixel_data_transcoder.h>
+#include <kcenon/pacs/encoding/transfer_syntax.h>
+#include <kcenon/pacs/encoding/vr_type.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace kcenon::pacs::storage;
+using namespace kcenon::pacs::core;
+using namespace kcenon::pacs::encoding;
+
+namespace {
+
+constexpr const char* rle_uid = "1.2.840.10008.1.2.5";
+
+class temp_directory {
+public:
+    temp_directory() {
+        path_ = std::filesystem::temp_directory_path() /
+                ("pacs_compress_test_" +
+                 std::to_string(std::chrono::steady_clock::now()
+                                    .time_since_epoch()
+                                    .count()));
+        std::filesystem::create_directories(path_);
+    }
+
+    ~temp_directory() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    [[nodiscard]] auto path() const -> const std::filesystem::path& {
+        return path_;
+    }
+
+private:
+    std::filesystem::path path_;
+};
+
+/**
+ * @brief Create an 8-bit native image with compressible content
+ */
+auto make_image(const std::string& sop_uid, const std::string& modality = "CT",
+                const std::string& study_date = "20240101") -> dicom_dataset {
+    constexpr uint16_t rows = 32;
+    constexpr uint16_t cols = 32;
+
+    dicom_dataset ds;
+    ds.set_string(tags::study_instance_uid, vr_type::UI, "1.2.3");
+    ds.set_string(tags::series_instance_uid, vr_type::UI, "1.2.3.4");
+    ds.set_string(tags::sop_instance_uid, vr_type::UI, sop_uid);
+    ds.set_string(tags::sop_class_uid, vr_type::UI, "1.2.840.10008.5.1.4.1.1.2");
+    ds.set_string(tags::modality, vr_type::CS, modality);
+    ds.set_string(tags::study_date, vr_type::DA, study_date);
+    ds.set_numeric<uint16_t>(tags::rows, vr_type::US, rows);
+    ds.set_numeric<uint16_t>(tags::columns, vr_type::US, cols);
+    ds.set_numeric<uint16_t>(tags::bits_allocated, vr_type::US, 8);
+    ds.set_numeric<uint16_t>(tags::bits_stored, vr_type::US, 8);
+    ds.set_numeric<uint16_t>(tags::high_bit, vr_type::US, 7);
+    ds.set_numeric<uint16_t>(tags::samples_per_pixel, vr_type::US, 1);
+    ds.set_numeric<uint16_t>(tags::pixel_representation, vr_type::US, 0);
+    ds.set_string(tags::photometric_interpretation, vr_type::CS, "MONOCHROME2");
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(rows) * cols);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>(i / 64);
+    }
+    ds.insert(dicom_element(tags::pixel_data, vr_type::OB, pixels));
+    return ds;
+}
+
+auto make_file_storage(const std::filesystem::path& root)
+    -> std::shared_ptr<file_storage> {
+    file_storage_config config;
+    config.root_path = root;
+    config.duplicate = duplicate_policy::replace;
+    return std::make_shared<file_storage>(config);
+}
+
+/**
+ * @brief file_storage whose reads wait for open_gate()
+ *
+ * Holds the background worker until the test has indexed the instance, as
+ * the server does right after the store returns.
+ */
+class gated_file_storage : public file_storage {
+public:
+    using file_storage::file_storage;
+
+    void open_gate() { gate_.set_value(); }
+
+    auto retrieve_file(std::string_view sop_instance_uid)
+        -> Result<dicom_file> override {
+        opened_.wait();
+        return file_storage::retrieve_file(sop_instance_uid);
+    }
+
+private:
+    std::promise<void> gate_;
+    std::shared_future<void> opened_{gate_.get_future().share()};
+};
+
+auto rle_policy(compression_mode mode) -> compression_policy {
+    compression_policy policy;
+    policy.rules.push_back({{"CT", "MR"}, {}, std::chrono::days{0}, rle_uid});
+    policy.mode = mode;
+    return policy;
+}
+
+auto stored_syntax(storage_interface& storage, const std::string& uid)
+    -> std::string {
+    auto file = storage.retrieve_file(uid);
+    REQUIRE(file.is_ok());
+    return std::string(file.value().transfer_syntax().uid());
+}
+
+}  // namespace
+
+// ============================================================================
+// compression_policy Tests
+// ============================================================================
+
+TEST_CASE("compression_policy: rule selection", "[storage][compression]") {
+    compression_policy policy;
+    policy.rules.push_back({{"MR"}, {}, std::chrono::days{0}, rle_uid});
+    policy.rules.push_back({{"CT"}, {}, std::chrono::days{365}, rle_uid});
+
+    const auto now = std::chrono::sys_days{std::chrono::year{2025} /
+                                           std::chrono::month{6} /
+                                           std::chrono::day{1}};
+
+    SECTION("modality filter") {
+        CHECK(policy.select(make_image("1.1", "MR"), now) == &policy.rules[0]);
+        CHECK(policy.select(make_image("1.2", "US"), now) == nullptr);
+    }
+
+    SECTION("study age filter") {
+        CHECK(policy.select(make_image("1.3", "CT", "20230101"), now) ==
+              &policy.rules[1]);
+        CHECK(policy.select(make_image("1.4", "CT", "20250301"), now) == nullptr);
+        CHECK(policy.select(make_image("1.5", "CT", ""), now) == nullptr);
+    }
+
+    SECTION("encapsulated files are never selected") {
+        auto native = dicom_file::create(make_image("1.6", "MR"),
+                                         transfer_syntax::explicit_vr_little_endian);
+        auto compressed = policy.compress(native, policy.rules[0]);
+        REQUIRE(compressed.is_ok());
+        CHECK(policy.select(compressed.value(), now) == nullptr);
+        CHECK(has_encapsulated_pixel_data(compressed.value().dataset()));
+    }
+
+    SECTION("lossy targets are refused") {
+        compression_rule lossy{{}, {}, std::chrono::days{0}, "1.2.840.10008.1.2.4.50"};
+        auto native = dicom_file::create(make_image("1.7"),
+                                         transfer_syntax::explicit_vr_little_endian);
+        CHECK(policy.compress(native, lossy).is_err());
+    }
+}
+
+// ============================================================================
+// compressing_storage Tests
+// ============================================================================
+
+TEST_CASE("compressing_storage: inline compression", "[storage][compression]") {
+    temp_directory dir;
+    auto backend = make_file_storage(dir.path());
+    compressing_storage storage{backend, rle_policy(compression_mode::inline_only)};
+
+    const auto original = make_image("2.1");
+    REQUIRE(storage.store(original).is_ok());
+    REQUIRE(storage.store(make_image("2.2", "US")).is_ok());
+
+    CHECK(stored_syntax(*backend, "2.1") == rle_uid);
+    CHECK(stored_syntax(*backend, "2.2") == transfer_syntax::explicit_vr_little_endian.uid());
+
+    auto stats = storage.get_compression_statistics();
+    CHECK(stats.compressed_inline == 1);
+    CHECK(stats.skipped == 1);
+    CHECK(stats.compression_ratio() > 1.0);
+}
+
+TEST_CASE("compressing_storage: background compression", "[storage][compression]") {
+    temp_directory dir;
+    auto backend = make_file_storage(dir.path());
+    compressing_storage storage{backend, rle_policy(compression_mode::background)};
+
+    REQUIRE(storage.store(make_image("3.1")).is_ok());
+    REQUIRE(storage.store(make_image("3.2", "MR")).is_ok());
+    REQUIRE(storage.wait_idle(std::chrono::seconds{10}));
+
+    CHECK(stored_syntax(*backend, "3.1") == rle_uid);
+    CHECK(stored_syntax(*backend, "3.2") == rle_uid);
+
+    auto stats = storage.get_compression_statistics();
+    CHECK(stats.compressed_background == 2);
+    CHECK(stats.pending == 0);
+}
+
+TEST_CASE("compressing_storage: budget defers large instances",
+          "[storage][compression]") {
+    temp_directory dir;
+    auto backend = make_file_storage(dir.path());
+    auto policy = rle_policy(compression_mode::budgeted);
+    policy.inline_budget = std::chrono::milliseconds{0};
+    policy.initial_throughput_bytes_per_sec = 1;
+    compressing_storage storage{backend, policy};
+
+    REQUIRE(storage.store(make_image("4.1")).is_ok());
+    REQUIRE(storage.wait_idle(std::chrono::seconds{10}));
+
+    auto stats = storage.get_compression_statistics();
+    CHECK(stats.deferred == 1);
+    CHECK(stats.compressed_inline == 0);
+    CHECK(stats.compressed_background == 1);
+    CHECK(stored_syntax(*backend, "4.1") == rle_uid);
+}
+
+TEST_CASE("compressing_storage: background recompression keeps the index verifiable",
+          "[storage][compression][fixity]") {
+    temp_directory dir;
+
+    // Default duplicate policy (reject): the swap must not depend on it
+    file_storage_config config;
+    config.root_path = dir.path();
+    auto backend = std::make_shared<gated_file_storage>(config);
+
+    auto opened = index_database::open(":memory:");
+    REQUIRE(opened.is_ok());
+    auto db = std::move(opened.value());
+    auto patient_pk = db->upsert_patient("P001", "TEST^PATIENT");
+    REQUIRE(patient_pk.is_ok());
+    auto study_pk = db->upsert_study(patient_pk.value(), "1.2.3");
+    REQUIRE(study_pk.is_ok());
+    auto series_pk = db->upsert_series(study_pk.value(), "1.2.3.4", "CT");
+    REQUIRE(series_pk.is_ok());
+
+    compressing_storage storage{backend, rle_policy(compression_mode::background),
+                                db.get()};
+    REQUIRE(storage.store(make_image("6.1")).is_ok());
+
+    instance_record record;
+    record.series_pk = series_pk.value();
+    record.sop_uid = "6.1";
+    record.sop_class_uid = "1.2.840.10008.5.1.4.1.1.2";
+    record.transfer_syntax = transfer_syntax::explicit_vr_little_endian.uid();
+    record.file_path = backend->get_file_path("6.1").string();
+    record.file_size = static_cast<int64_t>(std::filesystem::file_size(record.file_path));
+    record.file_hash = backend->get_file_hash("6.1");
+    REQUIRE(db->upsert_instance(record).is_ok());
+
+    backend->open_gate();
+    REQUIRE(storage.wait_idle(std::chrono::seconds{10}));
+    REQUIRE(storage.get_compression_statistics().compressed_background == 1);
+    CHECK(stored_syntax(*backend, "6.1") == rle_uid);
+
+    auto updated = db->find_instance("6.1");
+    REQUIRE(updated.has_value());
+    CHECK(updated->transfer_syntax == rle_uid);
+    CHECK(updated->file_hash == backend->get_file_hash("6.1"));
+    CHECK(updated->file_hash != record.file_hash);
+    CHECK(updated->file_size ==
+          static_cast<int64_t>(std::filesystem::file_size(updated->file_path)));
+    CHECK(updated->file_size < record.file_size);
+
+    fixity_scrubber_config scrub_config;
+    scrub_config.max_bytes_per_second = 0;
+    scrub_config.max_iops = 0;
+    fixity_scrubber scrubber(*db, scrub_config);
+    auto report = scrubber.run();
+    CHECK(report.error.empty());
+    CHECK(report.checked == 1);
+    CHECK(report.verified == 1);
+    CHECK(report.failure_count() == 0);
+}
+
+// ============================================================================
+// hsm_storage Recompression Tests
+// ============================================================================
+
+TEST_CASE("hsm_storage: recompresses on migration to cold",
+          "[storage][compression][hsm]") {
+    temp_directory dir;
+
+    file_storage_config hot_config;
+    hot_config.root_path = dir.path() / "hot";
+    file_storage_config cold_config;
+    cold_config.root_path = dir.path() / "cold";
+
+    hsm_storage_config config;
+    config.cold_compression = rle_policy(compression_mode::inline_only);
+
+    hsm_storage storage{std::make_unique<file_storage>(hot_config), nullptr,
+                        std::make_unique<file_storage>(cold_config), config};
+
+    const auto original = make_image("5.1");
+    REQUIRE(storage.store(original).is_ok());
+    REQUIRE(storage.migrate("5.1", storage_tier::cold).is_ok());
+
+    CHECK(storage.get_tier("5.1") == storage_tier::cold);
+    CHECK(stored_syntax(storage, "5.1") == rle_uid);
+
+    // Pixel data decodes back to the original values
+    auto stored = storage.retrieve_file("5.1");
+    REQUIRE(stored.is_ok());
+    auto decoded = compression::transcode_file(
+        stored.value(), transfer_syntax::explicit_vr_little_endian);
+    REQUIRE(decoded.is_ok());
+    const auto* pixels = decoded.value().dataset().get(tags::pixel_data);
+    REQUIRE(pixels != nullptr);
+    const auto expected = original.get(tags::pixel_data)->raw_data();
+    const auto actual = pixels->raw_data();
+    CHECK(std::vector<uint8_t>(actual.begin(), actual.end()) ==
+          std::vector<uint8_t>(expected.begin(), expected.end()));
+
+    auto result = storage.run_migration_cycle();
+    CHECK(result.instances_recompressed == 0);
+}
@@ -0,0 +1,58 @@
+/**
+ * @file content_hash_test.cpp
+ * @brief Unit tests for the streaming XXH64 content hasher
+ */
+
+#include <kcenon/pacs/storage/content_hash.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+using namespace kcenon::pacs::storage;
+
+namespace {
+
+auto bytes_of(std::string_view text) -> std::vector<std::uint8_t> {
+    return {text.begin(), text.end()};
+}
+
+auto pattern(std::size_t size) -> std::vector<std::uint8_t> {
+    std::vector<std::uint8_t> data(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<std::uint8_t>(i * 131 + 7);
+    }
+    return data;
+}
+
+}  // namespace
+
+TEST_CASE("content_hasher: reference digests", "[storage][content_hash]") {
+    CHECK(content_hasher::hash({}) == 0xEF46DB3751D8E999ULL);
+    CHECK(content_hasher::hash(bytes_of("abc")) == 0x44BC2CF5AD770999ULL);
+    CHECK(content_hasher::hash(pattern(1000)) == 0x0BF0BDBCC82EB373ULL);
+}
+
+TEST_CASE("content_hasher: chunking does not change the digest",
+          "[storage][content_hash]") {
+    const auto data = pattern(1000);
+    const auto expected = content_hasher::hash(data);
+
+    for (std::size_t chunk : {1u, 3u, 31u, 32u, 33u, 100u, 999u}) {
+        content_hasher hasher;
+        for (std::size_t offset = 0; offset < data.size(); offset += chunk) {
+            hasher.update(std::span<const std::uint8_t>(data).subspan(
+                offset, std::min(chunk, data.size() - offset)));
+        }
+        CHECK(hasher.digest() == expected);
+        CHECK(hasher.size() == data.size());
+    }
+}
+
+TEST_CASE("content_hasher: hex digest", "[storage][content_hash]") {
+    content_hasher hasher;
+    hasher.update(bytes_of("abc"));
+    CHECK(hasher.hex_digest() == "xxh64:44bc2cf5ad770999");
+}
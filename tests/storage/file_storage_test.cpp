@@ -7,12 +7,17 @@
 
 #include <kcenon/pacs/storage/file_storage.h>
 
+#include <kcenon/pacs/core/dicom_file.h>
 #include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/transfer_syntax.h>
 #include <kcenon/pacs/encoding/vr_type.h>
+#include <kcenon/pacs/storage/content_hash.h>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 
 using namespace kcenon::pacs::storage;
 using namespace kcenon::pacs::core;
@@ -542,6 +547,29 @@ TEST_CASE("file_storage: store_batch", "[storage][file_storage][batch]") {
     CHECK(storage.exists("1.2.3.3.1.1"));
 }
 
+TEST_CASE("file_storage: exists_batch", "[storage][file_storage][batch]") {
+    temp_directory temp_dir;
+
+    file_storage_config config;
+    config.root_path = temp_dir.path();
+
+    file_storage storage{config};
+
+    REQUIRE(storage
+                .store(create_test_dataset("1.2.3.1", "1.2.3.1.1",
+                                            "1.2.3.1.1.1"))
+                .is_ok());
+    REQUIRE(storage
+                .store(create_test_dataset("1.2.3.2", "1.2.3.2.1",
+                                            "1.2.3.2.1.1"))
+                .is_ok());
+
+    auto found = storage.exists_batch(
+        {"1.2.3.2.1.1", "nonexistent", "1.2.3.1.1.1", ""});
+    CHECK(found == std::vector<bool>{true, false, true, false});
+    CHECK(storage.exists_batch({}).empty());
+}
+
 TEST_CASE("file_storage: retrieve_batch", "[storage][file_storage][batch]") {
     temp_directory temp_dir;
 
@@ -576,3 +604,192 @@ TEST_CASE("file_storage: retrieve_batch", "[storage][file_storage][batch]") {
         CHECK(result.value().size() == 2);
     }
 }
+
+// ============================================================================
+// Byte Stream Tests
+// ============================================================================
+
+namespace {
+
+/**
+ * @brief byte_source without a contiguous view, forcing chunked reads
+ */
+class chunked_source final : public byte_source {
+public:
+    explicit chunked_source(std::vector<uint8_t> data) : data_(std::move(data)) {}
+
+    [[nodiscard]] auto size() const noexcept -> uint64_t override {
+        return data_.size();
+    }
+
+    [[nodiscard]] auto read(std::span<uint8_t> buffer)
+        -> kcenon::pacs::storage::Result<size_t> override {
+        auto n = std::min<size_t>({buffer.size(), data_.size() - position_, 7});
+        std::copy_n(data_.begin() + static_cast<std::ptrdiff_t>(position_), n,
+                    buffer.begin());
+        position_ += n;
+        return n;
+    }
+
+private:
+    std::vector<uint8_t> data_;
+    size_t position_{0};
+};
+
+auto part10_bytes(const dicom_dataset& dataset) -> std::vector<uint8_t> {
+    return dicom_file::create(dataset, transfer_syntax::explicit_vr_little_endian)
+        .to_bytes();
+}
+
+}  // namespace
+
+TEST_CASE("file_storage: store_stream keeps bytes unchanged",
+          "[storage][file_storage][stream]") {
+    temp_directory temp_dir;
+
+    file_storage_config config;
+    config.root_path = temp_dir.path();
+    file_storage storage{config};
+
+    auto bytes = part10_bytes(create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.5"));
+
+    SECTION("contiguous source") {
+        memory_byte_source source(bytes);
+        auto stored = storage.store_stream(source);
+        REQUIRE(stored.is_ok());
+        CHECK(stored.value().sop_instance_uid == "1.2.3.4.5");
+        CHECK(stored.value().size_bytes == bytes.size());
+    }
+
+    SECTION("chunked source") {
+        chunked_source source(bytes);
+        REQUIRE(storage.store_stream(source).is_ok());
+    }
+
+    CHECK(storage.exists("1.2.3.4.5"));
+    CHECK(std::filesystem::file_size(storage.get_file_path("1.2.3.4.5")) ==
+          bytes.size());
+
+    auto reader = storage.open_read("1.2.3.4.5");
+    REQUIRE(reader.is_ok());
+    CHECK(reader.value()->contiguous().size() == bytes.size());
+    auto read_back = reader.value()->read_all();
+    REQUIRE(read_back.is_ok());
+    CHECK(read_back.value() == bytes);
+
+    auto retrieved = storage.retrieve("1.2.3.4.5");
+    REQUIRE(retrieved.is_ok());
+    CHECK(retrieved.value().get_string(tags::patient_id) == "P001");
+}
+
+TEST_CASE("file_storage: records content hash at ingest",
+          "[storage][file_storage][hash]") {
+    temp_directory temp_dir;
+
+    file_storage_config config;
+    config.root_path = temp_dir.path();
+    file_storage storage{config};
+
+    const auto hash_of_file = [](const std::filesystem::path& path) {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)),
+                                   std::istreambuf_iterator<char>());
+        content_hasher hasher;
+        hasher.update(bytes);
+        return hasher.hex_digest();
+    };
+
+    CHECK(storage.get_file_hash("1.2.3.4.5").empty());
+
+    REQUIRE(storage.store(create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.5")).is_ok());
+    const auto stored_hash = storage.get_file_hash("1.2.3.4.5");
+    CHECK(stored_hash.starts_with("xxh64:"));
+    CHECK(stored_hash == hash_of_file(storage.get_file_path("1.2.3.4.5")));
+
+    auto bytes = part10_bytes(create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.6"));
+    chunked_source source(bytes);
+    auto stream_info = storage.store_stream(source);
+    REQUIRE(stream_info.is_ok());
+    CHECK(stream_info.value().content_hash == storage.get_file_hash("1.2.3.4.6"));
+    CHECK(stream_info.value().content_hash ==
+          hash_of_file(storage.get_file_path("1.2.3.4.6")));
+
+    REQUIRE(storage.remove("1.2.3.4.5").is_ok());
+    CHECK(storage.get_file_hash("1.2.3.4.5").empty());
+}
+
+TEST_CASE("file_storage: store_stream applies duplicate policy",
+          "[storage][file_storage][stream]") {
+    temp_directory temp_dir;
+
+    file_storage_config config;
+    config.root_path = temp_dir.path();
+    config.duplicate = duplicate_policy::reject;
+    file_storage storage{config};
+
+    auto bytes = part10_bytes(create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.5"));
+    memory_byte_source first(bytes);
+    memory_byte_source second(bytes);
+
+    REQUIRE(storage.store_stream(first).is_ok());
+    CHECK(storage.store_stream(second).is_err());
+
+    // No temporary files left behind
+    size_t files = 0;
+    for (const auto& entry :
+         std::filesystem::recursive_directory_iterator(temp_dir.path())) {
+        if (entry.is_regular_file()) {
+            ++files;
+        }
+    }
+    CHECK(files == 1);
+}
+
+TEST_CASE("file_storage: store_stream rejects non-Part 10 input",
+          "[storage][file_storage][stream]") {
+    temp_directory temp_dir;
+
+    file_storage_config config;
+    config.root_path = temp_dir.path();
+    file_storage storage{config};
+
+    memory_byte_source source(std::vector<uint8_t>(300, 0x42));
+    CHECK(storage.store_stream(source).is_err());
+    CHECK(storage.get_statistics().total_instances == 0);
+}
+
+TEST_CASE("file_storage: open_read byte ranges",
+          "[storage][file_storage][stream]") {
+    temp_directory temp_dir;
+
+    file_storage_config config;
+    config.root_path = temp_dir.path();
+    file_storage storage{config};
+
+    REQUIRE(storage.store(create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.5"))
+                .is_ok());
+    const auto file_size =
+        std::filesystem::file_size(storage.get_file_path("1.2.3.4.5"));
+
+    SECTION("preamble prefix") {
+        auto reader = storage.open_read("1.2.3.4.5", byte_range{128, 4});
+        REQUIRE(reader.is_ok());
+        auto bytes = reader.value()->read_all();
+        REQUIRE(bytes.is_ok());
+        CHECK(std::string(bytes.value().begin(), bytes.value().end()) == "DICM");
+    }
+
+    SECTION("range clamped to the end of the file") {
+        auto reader = storage.open_read("1.2.3.4.5", byte_range{file_size - 10, 100});
+        REQUIRE(reader.is_ok());
+        CHECK(reader.value()->size() == 10);
+    }
+
+    SECTION("range past the end is rejected") {
+        CHECK(storage.open_read("1.2.3.4.5", byte_range{file_size + 1}).is_err());
+    }
+
+    SECTION("unknown instance") {
+        CHECK(storage.open_read("nonexistent").is_err());
+    }
+}
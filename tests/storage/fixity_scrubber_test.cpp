@@ -0,0 +1,298 @@
+/**
+ * @file fixity_scrubber_test.cpp
+ * @brief Unit tests for fixity_scrubber
+ *
+ * Tests re-verification of stored files against the hashes file_storage
+ * records at ingest, hash backfill, and checkpointed resume.
+ */
+
+#include <kcenon/pacs/storage/fixity_scrubber.h>
+
+#include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/vr_type.h>
+#include <kcenon/pacs/monitoring/pacs_metrics.h>
+#include <kcenon/pacs/storage/file_storage.h>
+#include <kcenon/pacs/storage/index_database.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace kcenon::pacs::storage;
+using namespace kcenon::pacs::core;
+using namespace kcenon::pacs::encoding;
+
+namespace {
+
+/**
+ * @brief RAII helper for creating temporary test directories
+ */
+class temp_directory {
+public:
+    temp_directory() {
+        auto temp = std::filesystem::temp_directory_path();
+        path_ = temp / ("pacs_fixity_test_" + std::to_string(
+                            std::chrono::steady_clock::now()
+                                .time_since_epoch()
+                                .count()));
+        std::filesystem::create_directories(path_);
+    }
+
+    ~temp_directory() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    [[nodiscard]] auto path() const -> const std::filesystem::path& {
+        return path_;
+    }
+
+private:
+    std::filesystem::path path_;
+};
+
+/**
+ * @brief Archive of stored files indexed the way the server indexes them
+ */
+struct test_archive {
+    temp_directory dir;
+    std::unique_ptr<file_storage> storage;
+    std::unique_ptr<index_database> db;
+    std::vector<std::string> sop_uids;
+
+    explicit test_archive(std::size_t count, bool record_hashes = true) {
+        file_storage_config config;
+        config.root_path = dir.path() / "archive";
+        storage = std::make_unique<file_storage>(config);
+
+        auto opened = index_database::open(":memory:");
+        REQUIRE(opened.is_ok());
+        db = std::move(opened.value());
+
+        auto patient_pk = db->upsert_patient("P001", "TEST^PATIENT");
+        REQUIRE(patient_pk.is_ok());
+        auto study_pk = db->upsert_study(patient_pk.value(), "1.2.3");
+        REQUIRE(study_pk.is_ok());
+        auto series_pk = db->upsert_series(study_pk.value(), "1.2.3.4", "CT");
+        REQUIRE(series_pk.is_ok());
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto sop_uid = "1.2.3.4." + std::to_string(i + 1);
+            dicom_dataset ds;
+            ds.set_string(tags::study_instance_uid, vr_type::UI, "1.2.3");
+            ds.set_string(tags::series_instance_uid, vr_type::UI, "1.2.3.4");
+            ds.set_string(tags::sop_instance_uid, vr_type::UI, sop_uid);
+            ds.set_string(tags::sop_class_uid, vr_type::UI,
+                          "1.2.840.10008.5.1.4.1.1.2");
+            ds.set_string(tags::patient_id, vr_type::LO, "P001");
+            ds.set_string(tags::modality, vr_type::CS, "CT");
+            REQUIRE(storage->store(ds).is_ok());
+
+            instance_record record;
+            record.series_pk = series_pk.value();
+            record.sop_uid = sop_uid;
+            record.sop_class_uid = "1.2.840.10008.5.1.4.1.1.2";
+            record.file_path = storage->get_file_path(sop_uid).string();
+            record.file_size = static_cast<int64_t>(
+                std::filesystem::file_size(record.file_path));
+            if (record_hashes) {
+                record.file_hash = storage->get_file_hash(sop_uid);
+            }
+            REQUIRE(db->upsert_instance(record).is_ok());
+            sop_uids.push_back(sop_uid);
+        }
+    }
+
+    [[nodiscard]] auto path_of(std::size_t index) const -> std::filesystem::path {
+        return storage->get_file_path(sop_uids[index]);
+    }
+};
+
+auto unthrottled() -> fixity_scrubber_config {
+    fixity_scrubber_config config;
+    config.max_bytes_per_second = 0;
+    config.max_iops = 0;
+    return config;
+}
+
+/// Flip one byte in place, keeping the file size
+void corrupt(const std::filesystem::path& path) {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(200);
+    char byte = 0;
+    file.read(&byte, 1);
+    file.seekp(200);
+    byte = static_cast<char>(byte ^ 0x5a);
+    file.write(&byte, 1);
+}
+
+}  // namespace
+
+// ============================================================================
+// Verification
+// ============================================================================
+
+TEST_CASE("fixity_scrubber: verifies intact files", "[storage][fixity]") {
+    test_archive archive(5);
+    auto& metrics = kcenon::pacs::monitoring::pacs_metrics::global_metrics().fixity();
+    const auto verified_before = metrics.files_verified.load();
+
+    auto config = unthrottled();
+    config.worker_count = 3;
+    config.batch_size = 2;
+    fixity_scrubber scrubber(*archive.db, config);
+
+    auto report = scrubber.run();
+
+    CHECK(report.error.empty());
+    CHECK(report.checked == 5);
+    CHECK(report.verified == 5);
+    CHECK(report.failure_count() == 0);
+    CHECK(report.bytes_read > 0);
+    CHECK(report.pass_completed);
+    CHECK(scrubber.passes_completed() == 1);
+    CHECK(scrubber.checkpoint() == 0);
+    CHECK(metrics.files_verified.load() - verified_before == 5);
+}
+
+TEST_CASE("fixity_scrubber: reports corrupt and missing files",
+          "[storage][fixity]") {
+    test_archive archive(4);
+    corrupt(archive.path_of(1));
+    std::filesystem::remove(archive.path_of(2));
+
+    fixity_scrubber scrubber(*archive.db, unthrottled());
+    auto report = scrubber.run();
+
+    CHECK(report.checked == 4);
+    CHECK(report.verified == 2);
+    CHECK(report.mismatched == 1);
+    CHECK(report.missing == 1);
+    REQUIRE(report.failures.size() == 2);
+
+    CHECK(report.failures[0].sop_instance_uid == archive.sop_uids[1]);
+    CHECK(report.failures[0].status == fixity_status::mismatch);
+    CHECK(report.failures[0].expected == archive.storage->get_file_hash(archive.sop_uids[1]));
+    CHECK(report.failures[0].actual != report.failures[0].expected);
+
+    CHECK(report.failures[1].sop_instance_uid == archive.sop_uids[2]);
+    CHECK(report.failures[1].status == fixity_status::missing);
+}
+
+TEST_CASE("fixity_scrubber: size-only mode skips content", "[storage][fixity]") {
+    test_archive archive(2);
+    corrupt(archive.path_of(0));
+
+    auto config = unthrottled();
+    config.verify_content = false;
+    fixity_scrubber scrubber(*archive.db, config);
+    auto report = scrubber.run();
+
+    CHECK(report.verified == 2);
+    CHECK(report.bytes_read == 0);
+}
+
+TEST_CASE("fixity_scrubber: backfills missing hashes", "[storage][fixity]") {
+    test_archive archive(3, false);
+
+    fixity_scrubber scrubber(*archive.db, unthrottled());
+    auto first = scrubber.run();
+
+    CHECK(first.backfilled == 3);
+    CHECK(first.failure_count() == 0);
+    auto record = archive.db->find_instance(archive.sop_uids[0]);
+    REQUIRE(record.has_value());
+    CHECK(record->file_hash == archive.storage->get_file_hash(archive.sop_uids[0]));
+
+    corrupt(archive.path_of(2));
+    auto second = scrubber.run();
+    CHECK(second.verified == 2);
+    CHECK(second.mismatched == 1);
+}
+
+TEST_CASE("fixity_scrubber: backfill never overwrites a newer record",
+          "[storage][fixity]") {
+    test_archive archive(1, false);
+    const auto& sop_uid = archive.sop_uids[0];
+    const auto size = archive.db->find_instance(sop_uid)->file_size;
+
+    // A hash of a different file size belongs to content that was replaced
+    auto stale = archive.db->set_missing_file_hash(sop_uid, "xxh64:0000000000000001",
+                                                   size + 1);
+    REQUIRE(stale.is_ok());
+    CHECK_FALSE(stale.value());
+    CHECK(archive.db->find_instance(sop_uid)->file_hash.empty());
+
+    auto first = archive.db->set_missing_file_hash(sop_uid, "xxh64:0000000000000002",
+                                                   size);
+    REQUIRE(first.is_ok());
+    CHECK(first.value());
+
+    // A hash recorded meanwhile (e.g. by a re-store) is kept
+    auto second = archive.db->set_missing_file_hash(sop_uid, "xxh64:0000000000000003",
+                                                    size);
+    REQUIRE(second.is_ok());
+    CHECK_FALSE(second.value());
+    CHECK(archive.db->find_instance(sop_uid)->file_hash == "xxh64:0000000000000002");
+}
+
+// ============================================================================
+// Checkpoint
+// ============================================================================
+
+TEST_CASE("fixity_scrubber: resumes from checkpoint", "[storage][fixity]") {
+    test_archive archive(5);
+
+    auto config = unthrottled();
+    config.batch_size = 1;
+    config.max_instances_per_run = 2;
+    config.checkpoint_interval = 1;
+    config.checkpoint_path = archive.dir.path() / "fixity.checkpoint";
+
+    int64_t resume_after = 0;
+    {
+        fixity_scrubber scrubber(*archive.db, config);
+        auto report = scrubber.run();
+        CHECK(report.checked == 2);
+        CHECK_FALSE(report.pass_completed);
+        resume_after = scrubber.checkpoint();
+        CHECK(resume_after > 0);
+    }
+
+    // A new scrubber (as after a restart) picks up where the last stopped
+    config.max_instances_per_run = 0;
+    fixity_scrubber scrubber(*archive.db, config);
+    CHECK(scrubber.checkpoint() == resume_after);
+
+    auto report = scrubber.run();
+    CHECK(report.checked == 3);
+    CHECK(report.verified == 3);
+    CHECK(report.pass_completed);
+    CHECK(scrubber.checkpoint() == 0);
+
+    scrubber.reset_checkpoint();
+    CHECK(scrubber.run().checked == 5);
+}
+
+TEST_CASE("fixity_scrubber: bandwidth limit slows reads", "[storage][fixity]") {
+    test_archive archive(4);
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < archive.sop_uids.size(); ++i) {
+        total += std::filesystem::file_size(archive.path_of(i));
+    }
+
+    // The bucket starts with one second of budget, so reading twice the
+    // per-second rate takes at least another second
+    auto config = unthrottled();
+    config.max_bytes_per_second = total / 2;
+    fixity_scrubber scrubber(*archive.db, config);
+    auto report = scrubber.run();
+
+    CHECK(report.verified == 4);
+    CHECK(report.bytes_read == total);
+    CHECK(report.elapsed >= std::chrono::milliseconds(900));
+}
@@ -12,7 +12,9 @@
 
 #include <kcenon/pacs/storage/file_storage.h>
 
+#include <kcenon/pacs/core/dicom_file.h>
 #include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/transfer_syntax.h>
 #include <kcenon/pacs/encoding/vr_type.h>
 
 #include <catch2/catch_test_macros.hpp>
@@ -254,6 +256,34 @@ TEST_CASE("hsm_storage: store and retrieve", "[storage][hsm][crud]") {
     CHECK(retrieved.get_string(tags::patient_id) == "P001");
 }
 
+TEST_CASE("hsm_storage: store_stream and open_read", "[storage][hsm][crud]") {
+    temp_directory temp_dir;
+    auto hot = create_file_storage(temp_dir.path() / "hot");
+    auto warm = create_file_storage(temp_dir.path() / "warm");
+
+    hsm_storage storage{std::move(hot), std::move(warm), nullptr};
+
+    auto bytes = dicom_file::create(
+                     create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.5"),
+                     transfer_syntax::explicit_vr_little_endian)
+                     .to_bytes();
+    memory_byte_source source(bytes);
+    REQUIRE(storage.store_stream(source).is_ok());
+
+    auto tier = storage.get_tier("1.2.3.4.5");
+    REQUIRE(tier.has_value());
+    CHECK(*tier == storage_tier::hot);
+    CHECK(storage.get_hsm_statistics().hot.total_bytes == bytes.size());
+
+    REQUIRE(storage.migrate("1.2.3.4.5", storage_tier::warm).is_ok());
+
+    auto reader = storage.open_read("1.2.3.4.5", byte_range{128, 4});
+    REQUIRE(reader.is_ok());
+    auto magic = reader.value()->read_all();
+    REQUIRE(magic.is_ok());
+    CHECK(std::string(magic.value().begin(), magic.value().end()) == "DICM");
+}
+
 TEST_CASE("hsm_storage: exists check", "[storage][hsm][crud]") {
     temp_directory temp_dir;
     auto hot = create_file_storage(temp_dir.path() / "hot");
@@ -329,6 +359,197 @@ TEST_CASE("hsm_storage: manual migration between tiers",
     REQUIRE(retrieve_result.is_ok());
 }
 
+TEST_CASE("hsm_storage: byte-copy migration keeps stored bytes",
+          "[storage][hsm][migration]") {
+    temp_directory temp_dir;
+    auto hot = create_file_storage(temp_dir.path() / "hot");
+    auto warm = create_file_storage(temp_dir.path() / "warm");
+
+    hsm_storage storage{std::move(hot), std::move(warm), nullptr};
+
+    auto bytes = dicom_file::create(
+                     create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.5"),
+                     transfer_syntax::explicit_vr_little_endian)
+                     .to_bytes();
+    memory_byte_source source(bytes);
+    REQUIRE(storage.store_stream(source).is_ok());
+
+    REQUIRE(storage.migrate("1.2.3.4.5", storage_tier::warm).is_ok());
+    CHECK(storage.get_tier("1.2.3.4.5") == storage_tier::warm);
+    CHECK_FALSE(storage.get_tier_storage(storage_tier::hot)->exists("1.2.3.4.5"));
+
+    auto reader = storage.open_read("1.2.3.4.5");
+    REQUIRE(reader.is_ok());
+    auto migrated = reader.value()->read_all();
+    REQUIRE(migrated.is_ok());
+    CHECK(migrated.value() == bytes);
+
+    auto stats = storage.get_hsm_statistics();
+    CHECK(stats.migration.byte_copies == 1);
+    CHECK(stats.migration.transcoded_copies == 0);
+    CHECK(stats.migration.bytes_copied == bytes.size());
+    CHECK(stats.warm.total_bytes == bytes.size());
+}
+
+TEST_CASE("hsm_storage: migration resumes an interrupted transfer",
+          "[storage][hsm][migration]") {
+    temp_directory temp_dir;
+    auto hot = create_file_storage(temp_dir.path() / "hot");
+    auto warm = create_file_storage(temp_dir.path() / "warm");
+
+    hsm_storage storage{std::move(hot), std::move(warm), nullptr};
+    REQUIRE(storage.store(create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.5"))
+                .is_ok());
+
+    // Simulate a copy that landed before the source was removed
+    auto landed = storage.get_tier_storage(storage_tier::hot)->open_read("1.2.3.4.5");
+    REQUIRE(landed.is_ok());
+    REQUIRE(storage.get_tier_storage(storage_tier::warm)
+                ->store_stream(*landed.value())
+                .is_ok());
+
+    REQUIRE(storage.migrate("1.2.3.4.5", storage_tier::warm).is_ok());
+    CHECK(storage.get_tier("1.2.3.4.5") == storage_tier::warm);
+    CHECK(storage.get_hsm_statistics().migration.resumed == 1);
+    CHECK(storage.retrieve("1.2.3.4.5").is_ok());
+}
+
+TEST_CASE("hsm_storage: parallel migration cycle",
+          "[storage][hsm][migration]") {
+    temp_directory temp_dir;
+    auto hot = create_file_storage(temp_dir.path() / "hot");
+    auto warm = create_file_storage(temp_dir.path() / "warm");
+
+    hsm_storage_config config;
+    config.policy.hot_to_warm = std::chrono::days{0};
+    config.migration_parallelism = 4;
+
+    hsm_storage storage{std::move(hot), std::move(warm), nullptr, config};
+
+    constexpr int kInstances = 20;
+    for (int i = 0; i < kInstances; ++i) {
+        REQUIRE(storage
+                    .store(create_test_dataset("1.2.3", "1.2.3.4",
+                                               "1.2.3.4." + std::to_string(i)))
+                    .is_ok());
+    }
+
+    auto result = storage.run_migration_cycle();
+    CHECK(result.is_success());
+    CHECK(result.instances_migrated == kInstances);
+    CHECK_FALSE(result.interrupted);
+    CHECK(result.bytes_migrated > 0);
+
+    auto stats = storage.get_hsm_statistics();
+    CHECK(stats.warm.instance_count == kInstances);
+    CHECK(stats.hot.instance_count == 0);
+    CHECK(stats.migration.instances_copied == kInstances);
+    CHECK(stats.migration.bytes_copied == result.bytes_migrated);
+}
+
+TEST_CASE("hsm_storage: migration bandwidth limit",
+          "[storage][hsm][migration]") {
+    temp_directory temp_dir;
+    auto hot = create_file_storage(temp_dir.path() / "hot");
+    auto warm = create_file_storage(temp_dir.path() / "warm");
+
+    hsm_storage_config config;
+    config.policy.hot_to_warm = std::chrono::days{0};
+    config.migration_parallelism = 2;
+    config.migration_bandwidth_limit = 20 * 1024;
+
+    hsm_storage storage{std::move(hot), std::move(warm), nullptr, config};
+
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(storage
+                    .store(create_test_dataset("1.2.3", "1.2.3.4",
+                                               "1.2.3.4." + std::to_string(i)))
+                    .is_ok());
+    }
+
+    auto result = storage.run_migration_cycle();
+    REQUIRE(result.instances_migrated == 10);
+
+    // All reads but the first wait for their slot on the shared timeline
+    const auto per_instance = result.bytes_migrated / 10;
+    const auto minimum = std::chrono::milliseconds(
+        (result.bytes_migrated - per_instance) * 1000 / config.migration_bandwidth_limit);
+    CHECK(result.duration >= minimum);
+}
+
+TEST_CASE("hsm_storage: retrieve buffers access time until flush",
+          "[storage][hsm][access]") {
+    temp_directory temp_dir;
+    auto hot = create_file_storage(temp_dir.path() / "hot");
+
+    hsm_storage storage{std::move(hot), nullptr, nullptr};
+    REQUIRE(storage.store(create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.5"))
+                .is_ok());
+
+    auto before = storage.get_tier_metadata("1.2.3.4.5");
+    REQUIRE(before.has_value());
+    CHECK_FALSE(before->last_accessed.has_value());
+
+    REQUIRE(storage.retrieve("1.2.3.4.5").is_ok());
+    REQUIRE(storage.open_read("1.2.3.4.5").is_ok());
+
+    // Pending accesses are visible before they are applied
+    auto pending = storage.get_tier_metadata("1.2.3.4.5");
+    REQUIRE(pending.has_value());
+    CHECK(pending->last_accessed.has_value());
+
+    CHECK(storage.flush_access_times() == 1);
+    CHECK(storage.flush_access_times() == 0);
+
+    auto flushed = storage.get_tier_metadata("1.2.3.4.5");
+    REQUIRE(flushed.has_value());
+    CHECK(flushed->last_accessed == pending->last_accessed);
+}
+
+TEST_CASE("hsm_storage: migration candidates follow tier and inactivity",
+          "[storage][hsm][access]") {
+    temp_directory temp_dir;
+    auto hot = create_file_storage(temp_dir.path() / "hot");
+    auto warm = create_file_storage(temp_dir.path() / "warm");
+    auto cold = create_file_storage(temp_dir.path() / "cold");
+
+    hsm_storage_config config;
+    config.policy.hot_to_warm = std::chrono::days{1};
+    config.policy.warm_to_cold = std::chrono::days{0};
+
+    hsm_storage storage{std::move(hot), std::move(warm), std::move(cold),
+                        config};
+    for (int i = 0; i < 5; ++i) {
+        REQUIRE(storage
+                    .store(create_test_dataset("1.2.3", "1.2.3.4",
+                                               "1.2.3.4." + std::to_string(i)))
+                    .is_ok());
+        REQUIRE(storage.retrieve("1.2.3.4." + std::to_string(i)).is_ok());
+    }
+
+    // Freshly stored and accessed: nothing is inactive for a day
+    CHECK(storage.get_migration_candidates(storage_tier::hot,
+                                           storage_tier::warm)
+              .empty());
+
+    REQUIRE(storage.migrate("1.2.3.4.0", storage_tier::warm).is_ok());
+    REQUIRE(storage.migrate("1.2.3.4.1", storage_tier::warm).is_ok());
+    REQUIRE(storage.remove("1.2.3.4.1").is_ok());
+
+    // Only instances currently in the warm tier are visited
+    auto candidates =
+        storage.get_migration_candidates(storage_tier::warm, storage_tier::cold);
+    REQUIRE(candidates.size() == 1);
+    CHECK(candidates[0].sop_instance_uid == "1.2.3.4.0");
+
+    auto policy = storage.get_tier_policy();
+    policy.hot_to_warm = std::chrono::days{0};
+    storage.set_tier_policy(policy);
+    CHECK(storage.get_migration_candidates(storage_tier::hot,
+                                           storage_tier::warm)
+              .size() == 3);
+}
+
 TEST_CASE("hsm_storage: migrate to same tier is no-op",
           "[storage][hsm][migration]") {
     temp_directory temp_dir;
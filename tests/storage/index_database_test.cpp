@@ -41,7 +41,7 @@ TEST_CASE("index_database: create in-memory database", "[storage][database]") {
     auto db = std::move(result.value());
 
     CHECK(db->is_open());
-    CHECK(db->schema_version() == 9);
+    CHECK(db->schema_version() == 12);
     // In-memory databases use shared cache URI format for connection sharing
     // Path will be "file:pacs_shared_memory?mode=memory&cache=shared"
     CHECK(db->path().find("memory") != std::string::npos);
@@ -61,7 +61,7 @@ TEST_CASE("index_database: create file-based database",
         auto db = std::move(result.value());
 
         CHECK(db->is_open());
-        CHECK(db->schema_version() == 9);
+        CHECK(db->schema_version() == 12);
     }
 
     // Verify file was created
@@ -2088,6 +2088,173 @@ TEST_CASE("index_database: get_series_files returns all files in series",
     CHECK(files[2] == "/storage/file3.dcm");
 }
 
+TEST_CASE("index_database: get_file_hashes resolves a batch",
+          "[storage][file_path]") {
+    auto db = create_test_database();
+    auto patient_pk = create_test_patient(*db);
+    auto study_pk = create_test_study(*db, patient_pk);
+    auto series_pk = create_test_series_helper(*db, study_pk);
+
+    // More UIDs than one IN-list query holds
+    std::vector<std::string> uids;
+    for (int i = 0; i < 1200; ++i) {
+        instance_record record;
+        record.series_pk = series_pk;
+        record.sop_uid = "1.2.3.9." + std::to_string(i);
+        record.sop_class_uid = "1.2.840.10008.5.1.4.1.1.2";
+        record.file_path = "/storage/" + std::to_string(i) + ".dcm";
+        record.file_size = 1024;
+        record.file_hash = (i % 2 == 0) ? "xxh64:" + std::to_string(i) : "";
+        REQUIRE(db->upsert_instance(record).is_ok());
+        uids.push_back(record.sop_uid);
+    }
+    uids.push_back("non.existent.uid");
+
+    auto hashes = db->get_file_hashes(uids);
+    REQUIRE(hashes.is_ok());
+    CHECK(hashes.value().size() == 1200);
+    CHECK(hashes.value().at("1.2.3.9.0") == "xxh64:0");
+    CHECK(hashes.value().at("1.2.3.9.1").empty());
+    CHECK(hashes.value().at("1.2.3.9.1198") == "xxh64:1198");
+    CHECK_FALSE(hashes.value().contains("non.existent.uid"));
+
+    auto empty = db->get_file_hashes({});
+    REQUIRE(empty.is_ok());
+    CHECK(empty.value().empty());
+}
+
+// ============================================================================
+// Study Digest Tests
+// ============================================================================
+
+namespace {
+
+/// Index a study with one series of @p instances instances
+void add_digest_study(index_database& db, int64_t patient_pk,
+                      const std::string& study_uid, std::string_view study_date,
+                      std::string_view modality, int instances) {
+    auto study_pk = db.upsert_study(patient_pk, study_uid, "", study_date);
+    REQUIRE(study_pk.is_ok());
+    auto series_pk = db.upsert_series(study_pk.value(), study_uid + ".1", modality);
+    REQUIRE(series_pk.is_ok());
+    for (int i = 1; i <= instances; ++i) {
+        const auto sop_uid = study_uid + ".1." + std::to_string(i);
+        REQUIRE(db.upsert_instance(series_pk.value(), sop_uid,
+                                   "1.2.840.10008.5.1.4.1.1.2",
+                                   "/storage/" + sop_uid + ".dcm", 1024)
+                    .is_ok());
+    }
+}
+
+}  // namespace
+
+TEST_CASE("study_digest: helpers", "[storage][digest]") {
+    CHECK(normalize_study_modalities("PT\\CT\\PT") == "CT\\PT");
+    CHECK(normalize_study_modalities("") == "");
+    CHECK(study_digest_bucket_key("20240115", "CT") == "20240115/CT");
+    CHECK(is_study_digest_bucket("20240115/CT"));
+    CHECK(is_study_digest_bucket("20240115/"));
+    CHECK_FALSE(is_study_digest_bucket("20240115"));
+    CHECK(is_valid_study_digest_key(""));
+    CHECK(is_valid_study_digest_key("202401"));
+    CHECK_FALSE(is_valid_study_digest_key("2024"));
+    CHECK(study_digest_leaf("1.2.3", 5) != study_digest_leaf("1.2.3", 6));
+
+    std::vector<study_digest_node> local{{"202401", 1, 1, 10}, {"202402", 1, 1, 20}};
+    std::vector<study_digest_node> remote{{"202401", 1, 1, 10}, {"202402", 1, 2, 21},
+                                          {"202403", 1, 1, 30}};
+    CHECK(diff_study_digests(local, remote) ==
+          std::vector<std::string>{"202402", "202403"});
+}
+
+TEST_CASE("index_database: study digest tree", "[storage][digest]") {
+    auto db = create_test_database();
+    auto patient_pk = create_test_patient(*db);
+    add_digest_study(*db, patient_pk, "1.2.1", "20240115", "CT", 2);
+    add_digest_study(*db, patient_pk, "1.2.2", "20240115", "MR", 1);
+    add_digest_study(*db, patient_pk, "1.2.3", "20240220", "CT", 3);
+    add_digest_study(*db, patient_pk, "1.2.4", "", "CT", 1);  // undated
+
+    auto months = db->study_digest_children("", {});
+    REQUIRE(months.is_ok());
+    REQUIRE(months.value().size() == 2);
+    CHECK(months.value()[0].key == "202401");
+    CHECK(months.value()[0].study_count == 2);
+    CHECK(months.value()[0].instance_count == 3);
+    CHECK(months.value()[1].key == "202402");
+
+    auto buckets = db->study_digest_children("20240115", {});
+    REQUIRE(buckets.is_ok());
+    REQUIRE(buckets.value().size() == 2);
+    CHECK(buckets.value()[0].key == "20240115/CT");
+    CHECK(buckets.value()[0].digest == study_digest_leaf("1.2.1", 2));
+    CHECK(buckets.value()[1].key == "20240115/MR");
+
+    auto root = db->study_digest_root({});
+    REQUIRE(root.is_ok());
+    CHECK(root.value().study_count == 3);
+    CHECK(root.value().digest == study_digest_leaf("1.2.1", 2) +
+                                     study_digest_leaf("1.2.2", 1) +
+                                     study_digest_leaf("1.2.3", 3));
+
+    SECTION("scope limits dates and modalities") {
+        study_digest_scope scope;
+        scope.from_date = "20240201";
+        auto in_range = db->study_digest_root(scope);
+        REQUIRE(in_range.is_ok());
+        CHECK(in_range.value().study_count == 1);
+
+        study_digest_scope mr_only;
+        mr_only.modalities = {"MR"};
+        auto mr = db->study_digest_root(mr_only);
+        REQUIRE(mr.is_ok());
+        CHECK(mr.value().study_count == 1);
+        CHECK(mr.value().digest == study_digest_leaf("1.2.2", 1));
+    }
+
+    SECTION("changes are folded in on the next read") {
+        const auto before = root.value().digest;
+        auto study = db->find_study("1.2.1");
+        REQUIRE(study.has_value());
+        auto series_pk = db->upsert_series(study->pk, "1.2.1.2", "PT");
+        REQUIRE(series_pk.is_ok());
+        REQUIRE(db->upsert_instance(series_pk.value(), "1.2.1.2.1",
+                                    "1.2.840.10008.5.1.4.1.1.128",
+                                    "/storage/1.2.1.2.1.dcm", 1024)
+                    .is_ok());
+
+        auto refreshed = db->refresh_study_digests();
+        REQUIRE(refreshed.is_ok());
+        CHECK(refreshed.value() == 1);
+
+        auto day = db->study_digest_children("20240115", {});
+        REQUIRE(day.is_ok());
+        REQUIRE(day.value().size() == 2);
+        CHECK(day.value()[0].key == "20240115/CT\\PT");
+        CHECK(day.value()[0].instance_count == 3);
+
+        auto after = db->study_digest_root({});
+        REQUIRE(after.is_ok());
+        CHECK(after.value().digest != before);
+
+        REQUIRE(db->delete_study("1.2.3").is_ok());
+        auto feb = db->study_digest_children("202402", {});
+        REQUIRE(feb.is_ok());
+        CHECK(feb.value().empty());
+    }
+
+    SECTION("bucket members") {
+        auto members = db->study_digest_members("20240115/CT");
+        REQUIRE(members.is_ok());
+        REQUIRE(members.value().size() == 1);
+        CHECK(members.value()[0].study_uid == "1.2.1");
+        CHECK(members.value()[0].instance_count == 2);
+
+        CHECK(db->study_digest_members("20240115").is_err());
+        CHECK(db->study_digest_children("2024", {}).is_err());
+    }
+}
+
 // ============================================================================
 // Database Maintenance Tests
 // ============================================================================
@@ -10,6 +10,7 @@
 #include <sqlite3.h>
 
 #include <memory>
+#include <string>
 
 using namespace kcenon::pacs::storage;
 
@@ -106,8 +107,8 @@ TEST_CASE("migration_runner initial state", "[migration][version]") {
         CHECK(runner.needs_migration(db.get()));
     }
 
-    SECTION("latest version is 9") {
-        CHECK(runner.get_latest_version() == 9);
+    SECTION("latest version is 12") {
+        CHECK(runner.get_latest_version() == 12);
     }
 
     SECTION("empty database has no history") {
@@ -128,7 +129,7 @@ TEST_CASE("migration_runner run_migrations", "[migration][execute]") {
         auto result = runner.run_migrations(db.get());
         REQUIRE(result.is_ok());
 
-        CHECK(runner.get_current_version(db.get()) == 9);
+        CHECK(runner.get_current_version(db.get()) == 12);
         CHECK_FALSE(runner.needs_migration(db.get()));
     }
 
@@ -139,7 +140,7 @@ TEST_CASE("migration_runner run_migrations", "[migration][execute]") {
         auto result2 = runner.run_migrations(db.get());
         REQUIRE(result2.is_ok());
 
-        CHECK(runner.get_current_version(db.get()) == 9);
+        CHECK(runner.get_current_version(db.get()) == 12);
     }
 
     SECTION("migration creates schema_version table") {
@@ -154,7 +155,7 @@ TEST_CASE("migration_runner run_migrations", "[migration][execute]") {
         REQUIRE(result.is_ok());
 
         auto history = runner.get_history(db.get());
-        REQUIRE(history.size() == 9);
+        REQUIRE(history.size() == 12);
         CHECK(history[0].version == 1);
         CHECK(history[0].description == "Initial schema creation");
         CHECK_FALSE(history[0].applied_at.empty());
@@ -183,6 +184,15 @@ TEST_CASE("migration_runner run_migrations", "[migration][execute]") {
         CHECK(history[8].description
               == "Add Unified Procedure Step (UPS) tables");
         CHECK_FALSE(history[8].applied_at.empty());
+        CHECK(history[9].version == 10);
+        CHECK(history[9].description == "Add study search indexes");
+        CHECK_FALSE(history[9].applied_at.empty());
+        CHECK(history[10].version == 11);
+        CHECK(history[10].description == "Add study digest tables");
+        CHECK_FALSE(history[10].applied_at.empty());
+        CHECK(history[11].version == 12);
+        CHECK(history[11].description == "Add retention unlink queue");
+        CHECK_FALSE(history[11].applied_at.empty());
     }
 }
 
@@ -475,6 +485,153 @@ TEST_CASE("migration_runner v5 creates routing_rules table", "[migration][v5][ta
     CHECK(db.index_exists("idx_routing_rules_priority"));
 }
 
+// ============================================================================
+// Schema Validation Tests (V10)
+// ============================================================================
+
+TEST_CASE("migration_runner v10 maintains study_modalities", "[migration][v10][triggers]") {
+    test_database db;
+    migration_runner runner;
+
+    auto result = runner.run_migrations(db.get());
+    REQUIRE(result.is_ok());
+
+    CHECK(db.table_exists("study_modalities"));
+    CHECK(db.index_exists("idx_studies_date_time"));
+    CHECK(db.trigger_exists("trg_series_modality_insert"));
+    CHECK(db.trigger_exists("trg_series_modality_update"));
+    CHECK(db.trigger_exists("trg_series_modality_delete"));
+
+    sqlite3_exec(db.get(), R"(
+        INSERT INTO patients (patient_id, patient_name) VALUES ('P001', 'Test^Patient');
+        INSERT INTO studies (patient_pk, study_uid) VALUES (1, '1.2.3.4.5');
+        INSERT INTO series (study_pk, series_uid, modality) VALUES (1, '1.2.3.4.5.1', 'CT');
+        INSERT INTO series (study_pk, series_uid, modality) VALUES (1, '1.2.3.4.5.2', 'CT');
+        INSERT INTO series (study_pk, series_uid, modality) VALUES (1, '1.2.3.4.5.3', 'MR');
+        INSERT INTO series (study_pk, series_uid, modality) VALUES (1, '1.2.3.4.5.4', '');
+    )", nullptr, nullptr, nullptr);
+
+    auto modalities = [&db]() {
+        std::string joined;
+        sqlite3_stmt* stmt = nullptr;
+        sqlite3_prepare_v2(db.get(),
+                           "SELECT modality FROM study_modalities "
+                           "WHERE study_pk = 1 ORDER BY modality;",
+                           -1, &stmt, nullptr);
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            joined += reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+            joined += ';';
+        }
+        sqlite3_finalize(stmt);
+        return joined;
+    };
+
+    CHECK(modalities() == "CT;MR;");
+
+    SECTION("a modality stays while another series still has it") {
+        sqlite3_exec(db.get(), "DELETE FROM series WHERE series_uid = '1.2.3.4.5.1';",
+                     nullptr, nullptr, nullptr);
+        CHECK(modalities() == "CT;MR;");
+
+        sqlite3_exec(db.get(), "DELETE FROM series WHERE series_uid = '1.2.3.4.5.2';",
+                     nullptr, nullptr, nullptr);
+        CHECK(modalities() == "MR;");
+    }
+
+    SECTION("changing a series modality moves the entry") {
+        sqlite3_exec(db.get(),
+                     "UPDATE series SET modality = 'SR' WHERE series_uid = '1.2.3.4.5.3';",
+                     nullptr, nullptr, nullptr);
+        CHECK(modalities() == "CT;SR;");
+    }
+
+    SECTION("deleting the study removes its entries") {
+        sqlite3_exec(db.get(), "PRAGMA foreign_keys = ON;", nullptr, nullptr, nullptr);
+        sqlite3_exec(db.get(), "DELETE FROM studies WHERE study_pk = 1;",
+                     nullptr, nullptr, nullptr);
+        CHECK(modalities().empty());
+    }
+}
+
+// ============================================================================
+// Schema Validation Tests (V11)
+// ============================================================================
+
+TEST_CASE("migration_runner v11 marks changed study days dirty",
+          "[migration][v11][triggers]") {
+    test_database db;
+    migration_runner runner;
+
+    auto result = runner.run_migrations(db.get());
+    REQUIRE(result.is_ok());
+
+    CHECK(db.table_exists("study_digest_buckets"));
+    CHECK(db.table_exists("study_digest_dirty"));
+    CHECK(db.trigger_exists("trg_studies_digest_insert"));
+    CHECK(db.trigger_exists("trg_studies_digest_update"));
+    CHECK(db.trigger_exists("trg_study_modalities_digest_insert"));
+
+    auto dirty_days = [&db]() {
+        std::string joined;
+        sqlite3_stmt* stmt = nullptr;
+        sqlite3_prepare_v2(db.get(),
+                           "SELECT bucket_date FROM study_digest_dirty "
+                           "ORDER BY bucket_date;",
+                           -1, &stmt, nullptr);
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            joined += reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+            joined += ';';
+        }
+        sqlite3_finalize(stmt);
+        return joined;
+    };
+    auto clear = [&db]() {
+        sqlite3_exec(db.get(), "DELETE FROM study_digest_dirty;",
+                     nullptr, nullptr, nullptr);
+    };
+
+    sqlite3_exec(db.get(), R"(
+        INSERT INTO patients (patient_id, patient_name) VALUES ('P001', 'Test^Patient');
+        INSERT INTO studies (patient_pk, study_uid, study_date)
+            VALUES (1, '1.2.3.4.5', '20240115');
+        INSERT INTO studies (patient_pk, study_uid) VALUES (1, '1.2.3.4.6');
+    )", nullptr, nullptr, nullptr);
+    CHECK(dirty_days() == "20240115;");
+
+    SECTION("a new series or instance dirties the study's day") {
+        clear();
+        sqlite3_exec(db.get(),
+                     "INSERT INTO series (study_pk, series_uid, modality) "
+                     "VALUES (1, '1.2.3.4.5.1', 'CT');",
+                     nullptr, nullptr, nullptr);
+        CHECK(dirty_days() == "20240115;");
+
+        clear();
+        sqlite3_exec(db.get(),
+                     "INSERT INTO instances (series_pk, sop_uid, sop_class_uid, "
+                     "file_path, file_size) VALUES (1, '1.2.3.4.5.1.1', "
+                     "'1.2.840.10008.5.1.4.1.1.2', '/tmp/1.dcm', 1024);",
+                     nullptr, nullptr, nullptr);
+        CHECK(dirty_days() == "20240115;");
+    }
+
+    SECTION("moving a study dirties both days") {
+        clear();
+        sqlite3_exec(db.get(),
+                     "UPDATE studies SET study_date = '20240116' "
+                     "WHERE study_uid = '1.2.3.4.5';",
+                     nullptr, nullptr, nullptr);
+        CHECK(dirty_days() == "20240115;20240116;");
+    }
+
+    SECTION("undated studies are not tracked") {
+        clear();
+        sqlite3_exec(db.get(), "DELETE FROM studies WHERE study_uid = '1.2.3.4.6';",
+                     nullptr, nullptr, nullptr);
+        CHECK(dirty_days().empty());
+    }
+}
+
 // ============================================================================
 // pacs_database_adapter Tests
 // ============================================================================
@@ -634,7 +791,7 @@ TEST_CASE("migration_runner with pacs_database_adapter run_migrations",
         auto result = runner.run_migrations(db.get());
         REQUIRE(result.is_ok());
 
-        CHECK(runner.get_current_version(db.get()) == 9);
+        CHECK(runner.get_current_version(db.get()) == 12);
         CHECK_FALSE(runner.needs_migration(db.get()));
     }
 
@@ -645,7 +802,7 @@ TEST_CASE("migration_runner with pacs_database_adapter run_migrations",
         auto result2 = runner.run_migrations(db.get());
         REQUIRE(result2.is_ok());
 
-        CHECK(runner.get_current_version(db.get()) == 9);
+        CHECK(runner.get_current_version(db.get()) == 12);
     }
 
     SECTION("migration creates schema_version table") {
@@ -660,7 +817,7 @@ TEST_CASE("migration_runner with pacs_database_adapter run_migrations",
         REQUIRE(result.is_ok());
 
         auto history = runner.get_history(db.get());
-        REQUIRE(history.size() == 9);
+        REQUIRE(history.size() == 12);
         CHECK(history[0].version == 1);
         CHECK(history[0].description == "Initial schema creation");
     }
@@ -0,0 +1,307 @@
+/**
+ * @file parallel_transfer_test.cpp
+ * @brief Unit tests for the concurrent part-wise transfer scheduler
+ */
+
+#include <kcenon/pacs/storage/parallel_transfer.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace kcenon::pacs::storage;
+using namespace std::chrono_literals;
+using kcenon::common::make_error;
+using kcenon::common::ok;
+
+namespace {
+
+auto make_bytes(std::size_t size) -> std::vector<std::uint8_t> {
+    std::vector<std::uint8_t> bytes(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<std::uint8_t>((i * 7 + i / 251) & 0xFF);
+    }
+    return bytes;
+}
+
+/**
+ * @brief Source readable only sequentially, in short reads
+ */
+class sequential_source final : public byte_source {
+public:
+    explicit sequential_source(std::vector<std::uint8_t> data)
+        : data_(std::move(data)) {}
+
+    [[nodiscard]] auto size() const noexcept -> std::uint64_t override {
+        return data_.size();
+    }
+
+    [[nodiscard]] auto read(std::span<std::uint8_t> buffer)
+        -> Result<std::size_t> override {
+        const auto n = (std::min)({buffer.size(), data_.size() - position_,
+                                   std::size_t{7}});
+        std::copy_n(data_.begin() + static_cast<std::ptrdiff_t>(position_), n,
+                    buffer.begin());
+        position_ += n;
+        return n;
+    }
+
+private:
+    std::vector<std::uint8_t> data_;
+    std::size_t position_{0};
+};
+
+/**
+ * @brief Collects uploaded parts by index
+ */
+struct part_collector {
+    std::mutex mutex;
+    std::map<std::size_t, std::vector<std::uint8_t>> parts;
+
+    auto upload() -> part_upload_fn {
+        return [this](std::size_t index,
+                      std::span<const std::uint8_t> data) -> VoidResult {
+            std::this_thread::sleep_for(std::chrono::microseconds(
+                (index % 3) * 200));
+            std::lock_guard lock(mutex);
+            parts[index].assign(data.begin(), data.end());
+            return ok();
+        };
+    }
+
+    auto assembled() -> std::vector<std::uint8_t> {
+        std::vector<std::uint8_t> bytes;
+        for (const auto& [index, part] : parts) {
+            bytes.insert(bytes.end(), part.begin(), part.end());
+        }
+        return bytes;
+    }
+};
+
+auto fast_options() -> transfer_options {
+    transfer_options options;
+    options.part_size = 100;
+    options.max_in_flight = 4;
+    options.retry_delay = 1ms;
+    return options;
+}
+
+}  // namespace
+
+TEST_CASE("parallel_upload: contiguous and sequential sources",
+          "[storage][parallel_transfer]") {
+    const auto bytes = make_bytes(1050);
+
+    SECTION("contiguous") {
+        memory_byte_source source(bytes);
+        part_collector collector;
+
+        auto stats = parallel_upload(source, fast_options(), collector.upload());
+        REQUIRE(stats.is_ok());
+        CHECK(stats.value().parts == 11);
+        CHECK(stats.value().bytes == bytes.size());
+        CHECK(collector.assembled() == bytes);
+        CHECK(collector.parts.rbegin()->second.size() == 50);
+    }
+
+    SECTION("sequential") {
+        sequential_source source(bytes);
+        part_collector collector;
+
+        auto stats = parallel_upload(source, fast_options(), collector.upload());
+        REQUIRE(stats.is_ok());
+        CHECK(stats.value().parts == 11);
+        CHECK(collector.assembled() == bytes);
+    }
+
+    SECTION("exact multiple of the part size") {
+        sequential_source source(make_bytes(400));
+        part_collector collector;
+
+        auto stats = parallel_upload(source, fast_options(), collector.upload());
+        REQUIRE(stats.is_ok());
+        CHECK(stats.value().parts == 4);
+        CHECK(collector.assembled() == make_bytes(400));
+    }
+}
+
+TEST_CASE("parallel_upload: bounded concurrency",
+          "[storage][parallel_transfer]") {
+    memory_byte_source source(make_bytes(2000));
+    std::atomic<int> active{0};
+    std::atomic<int> peak{0};
+
+    auto options = fast_options();
+    options.max_in_flight = 3;
+    auto stats = parallel_upload(
+        source, options,
+        [&](std::size_t, std::span<const std::uint8_t>) -> VoidResult {
+            const auto now = ++active;
+            int seen = peak.load();
+            while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+            }
+            std::this_thread::sleep_for(2ms);
+            --active;
+            return ok();
+        });
+
+    REQUIRE(stats.is_ok());
+    CHECK(peak.load() <= 3);
+    CHECK(peak.load() > 1);
+}
+
+TEST_CASE("parallel_upload: failed parts are retried",
+          "[storage][parallel_transfer]") {
+    const auto bytes = make_bytes(500);
+    memory_byte_source source(bytes);
+    part_collector collector;
+    auto store = collector.upload();
+
+    std::mutex mutex;
+    std::map<std::size_t, int> attempts;
+    auto flaky = [&](std::size_t index,
+                     std::span<const std::uint8_t> data) -> VoidResult {
+        {
+            std::lock_guard lock(mutex);
+            if (index % 2 == 0 && attempts[index]++ < 2) {
+                return make_error<std::monostate>(-1, "transient", "test");
+            }
+        }
+        return store(index, data);
+    };
+
+    auto stats = parallel_upload(source, fast_options(), flaky);
+    REQUIRE(stats.is_ok());
+    CHECK(stats.value().retries == 6);
+    CHECK(collector.assembled() == bytes);
+}
+
+TEST_CASE("parallel_upload: persistent failure and cancellation",
+          "[storage][parallel_transfer]") {
+    SECTION("a part failing every retry fails the transfer") {
+        memory_byte_source source(make_bytes(500));
+        std::atomic<int> calls{0};
+
+        auto options = fast_options();
+        options.max_retries = 2;
+        auto stats = parallel_upload(
+            source, options,
+            [&](std::size_t index, std::span<const std::uint8_t>) -> VoidResult {
+                ++calls;
+                if (index == 1) {
+                    return make_error<std::monostate>(-7, "broken", "test");
+                }
+                return ok();
+            });
+
+        REQUIRE(stats.is_err());
+        CHECK(stats.error().code == -7);
+        CHECK(calls.load() <= 5 + 2);
+    }
+
+    SECTION("progress returning false cancels") {
+        memory_byte_source source(make_bytes(1000));
+        std::atomic<int> uploaded{0};
+
+        auto options = fast_options();
+        options.max_in_flight = 1;
+        auto stats = parallel_upload(
+            source, options,
+            [&](std::size_t, std::span<const std::uint8_t>) -> VoidResult {
+                ++uploaded;
+                return ok();
+            },
+            [](std::size_t done, std::size_t) { return done < 300; });
+
+        REQUIRE(stats.is_err());
+        CHECK(uploaded.load() == 3);
+    }
+}
+
+TEST_CASE("parallel_download: delivers parts in order within the window",
+          "[storage][parallel_transfer]") {
+    const auto bytes = make_bytes(1234);
+    std::atomic<std::size_t> delivered{0};
+    std::atomic<std::size_t> max_ahead{0};
+
+    auto options = fast_options();
+    options.max_in_flight = 3;
+
+    std::vector<std::uint8_t> received;
+    std::vector<std::size_t> progress;
+    auto stats = parallel_download(
+        bytes.size(), options,
+        [&](std::uint64_t offset,
+            std::uint64_t length) -> Result<std::vector<std::uint8_t>> {
+            // Later parts finish first
+            const auto index = offset / 100;
+            std::this_thread::sleep_for(std::chrono::microseconds(
+                (3 - index % 3) * 300));
+            const auto ahead = index - delivered.load() / 100;
+            auto seen = max_ahead.load();
+            while (ahead > seen && !max_ahead.compare_exchange_weak(seen, ahead)) {
+            }
+            return std::vector<std::uint8_t>(
+                bytes.begin() + static_cast<std::ptrdiff_t>(offset),
+                bytes.begin() + static_cast<std::ptrdiff_t>(offset + length));
+        },
+        [&](std::span<const std::uint8_t> part) -> VoidResult {
+            received.insert(received.end(), part.begin(), part.end());
+            delivered += part.size();
+            return ok();
+        },
+        [&](std::size_t done, std::size_t total) {
+            CHECK(total == bytes.size());
+            progress.push_back(done);
+            return true;
+        });
+
+    REQUIRE(stats.is_ok());
+    CHECK(stats.value().parts == 13);
+    CHECK(received == bytes);
+    CHECK(max_ahead.load() < 3);
+    CHECK(std::is_sorted(progress.begin(), progress.end()));
+    CHECK(progress.back() == bytes.size());
+}
+
+TEST_CASE("parallel_download: short parts are retried, then fail",
+          "[storage][parallel_transfer]") {
+    const auto bytes = make_bytes(300);
+    std::atomic<int> short_reads{0};
+
+    auto download = [&](std::uint64_t offset, std::uint64_t length)
+        -> Result<std::vector<std::uint8_t>> {
+        auto end = offset + length;
+        if (offset == 100 && short_reads++ < 1) {
+            end -= 10;
+        }
+        return std::vector<std::uint8_t>(
+            bytes.begin() + static_cast<std::ptrdiff_t>(offset),
+            bytes.begin() + static_cast<std::ptrdiff_t>(end));
+    };
+
+    std::vector<std::uint8_t> received;
+    auto sink = [&](std::span<const std::uint8_t> part) -> VoidResult {
+        received.insert(received.end(), part.begin(), part.end());
+        return ok();
+    };
+
+    auto stats = parallel_download(bytes.size(), fast_options(), download, sink);
+    REQUIRE(stats.is_ok());
+    CHECK(stats.value().retries == 1);
+    CHECK(received == bytes);
+
+    auto options = fast_options();
+    options.max_retries = 0;
+    short_reads = 0;
+    received.clear();
+    auto failed = parallel_download(bytes.size(), options, download, sink);
+    REQUIRE(failed.is_err());
+    CHECK(failed.error().code == -231);
+}
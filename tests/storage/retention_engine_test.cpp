@@ -0,0 +1,366 @@
+/**
+ * @file retention_engine_test.cpp
+ * @brief Unit tests for retention_engine
+ *
+ * Tests the indexed retention query, batched deletion with queued file
+ * unlinks, and resumption of capped or interrupted runs.
+ */
+
+#include <kcenon/pacs/storage/retention_engine.h>
+
+#include <kcenon/pacs/storage/index_database.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace kcenon::pacs::storage;
+
+namespace {
+
+/**
+ * @brief RAII helper for creating temporary test directories
+ */
+class temp_directory {
+public:
+    temp_directory() {
+        auto temp = std::filesystem::temp_directory_path();
+        path_ = temp / ("pacs_retention_test_" + std::to_string(
+                            std::chrono::steady_clock::now()
+                                .time_since_epoch()
+                                .count()));
+        std::filesystem::create_directories(path_);
+    }
+
+    ~temp_directory() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    [[nodiscard]] auto path() const -> const std::filesystem::path& {
+        return path_;
+    }
+
+private:
+    std::filesystem::path path_;
+};
+
+/**
+ * @brief Index with studies whose instances are real files
+ */
+struct test_archive {
+    temp_directory dir;
+    std::unique_ptr<index_database> db;
+    int64_t patient_pk{0};
+
+    test_archive() {
+        auto opened = index_database::open(":memory:");
+        REQUIRE(opened.is_ok());
+        db = std::move(opened.value());
+
+        auto patient = db->upsert_patient("P001", "TEST^PATIENT");
+        REQUIRE(patient.is_ok());
+        patient_pk = patient.value();
+    }
+
+    /// Index a study with one series and file per modality
+    auto add_study(const std::string& study_uid, std::string_view study_date,
+                   const std::vector<std::string>& modalities,
+                   std::string_view description = "") -> std::vector<std::filesystem::path> {
+        auto study_pk = db->upsert_study(patient_pk, study_uid, "", study_date, "", "",
+                                         "", description);
+        REQUIRE(study_pk.is_ok());
+
+        std::vector<std::filesystem::path> files;
+        for (std::size_t i = 0; i < modalities.size(); ++i) {
+            const auto series_uid = study_uid + "." + std::to_string(i + 1);
+            auto series_pk = db->upsert_series(study_pk.value(), series_uid, modalities[i]);
+            REQUIRE(series_pk.is_ok());
+
+            const auto sop_uid = series_uid + ".1";
+            const auto path = dir.path() / (sop_uid + ".dcm");
+            std::ofstream(path) << "DICM";
+            REQUIRE(db->upsert_instance(series_pk.value(), sop_uid,
+                                        "1.2.840.10008.5.1.4.1.1.2", path.string(), 4)
+                        .is_ok());
+            files.push_back(path);
+        }
+        return files;
+    }
+
+    [[nodiscard]] auto queued() const -> std::size_t {
+        auto count = db->retention_unlink_count();
+        REQUIRE(count.is_ok());
+        return count.value();
+    }
+};
+
+auto study_uids(const std::vector<retention_candidate>& candidates)
+    -> std::vector<std::string> {
+    std::vector<std::string> uids;
+    for (const auto& candidate : candidates) {
+        uids.push_back(candidate.study_uid);
+    }
+    return uids;
+}
+
+auto unthrottled() -> retention_engine_config {
+    retention_engine_config config;
+    config.max_unlinks_per_second = 0;
+    return config;
+}
+
+/// Seven expired two-file studies and two current ones
+auto add_mixed_studies(test_archive& archive)
+    -> std::pair<std::vector<std::filesystem::path>, std::vector<std::filesystem::path>> {
+    std::vector<std::filesystem::path> expired;
+    std::vector<std::filesystem::path> current;
+    const auto today = retention_cutoff_date(std::chrono::system_clock::now(),
+                                             std::chrono::days{0});
+    for (int i = 1; i <= 7; ++i) {
+        auto files = archive.add_study("1.2.1." + std::to_string(i),
+                                       "2001010" + std::to_string(i), {"CT", "SR"});
+        expired.insert(expired.end(), files.begin(), files.end());
+    }
+    for (int i = 1; i <= 2; ++i) {
+        auto files = archive.add_study("1.2.2." + std::to_string(i), today, {"CT"});
+        current.insert(current.end(), files.begin(), files.end());
+    }
+    return {expired, current};
+}
+
+auto count_existing(const std::vector<std::filesystem::path>& files) -> std::size_t {
+    std::size_t existing = 0;
+    for (const auto& file : files) {
+        existing += std::filesystem::exists(file) ? 1 : 0;
+    }
+    return existing;
+}
+
+}  // namespace
+
+// ============================================================================
+// Retention Query
+// ============================================================================
+
+TEST_CASE("retention_engine: cutoff dates", "[storage][retention]") {
+    const auto now = std::chrono::system_clock::now();
+    const auto today = retention_cutoff_date(now, std::chrono::days{0});
+    CHECK(today.size() == 8);
+    CHECK(retention_cutoff_date(now, std::chrono::days{365}) < today);
+
+    retention_engine_config config;
+    config.default_retention = std::chrono::days{365};
+    config.modality_retention["MG"] = std::chrono::days{3650};
+    config.exclude_patterns = {"HOLD"};
+    auto db = index_database::open(":memory:");
+    REQUIRE(db.is_ok());
+    retention_engine engine(*db.value(), nullptr, config);
+
+    auto criteria = engine.criteria(now);
+    CHECK(criteria.default_cutoff == retention_cutoff_date(now, std::chrono::days{365}));
+    CHECK(criteria.modality_cutoffs.at("MG") < criteria.default_cutoff);
+    CHECK(criteria.upper_cutoff() == criteria.default_cutoff);
+    CHECK(criteria.exclude_patterns == std::vector<std::string>{"HOLD"});
+}
+
+TEST_CASE("index_database: retention candidates", "[storage][retention]") {
+    test_archive archive;
+    archive.add_study("1.1", "20100101", {"CT"});
+    archive.add_study("1.2", "20180101", {"CT"});
+    archive.add_study("1.3", "20180101", {"MG"});
+    archive.add_study("1.4", "20180101", {"CT", "MG"});
+    archive.add_study("1.5", "20100101", {"MG"});
+    archive.add_study("1.6", "20100101", {"CT"}, "LEGAL HOLD");
+    archive.add_study("1.7", "", {"CT"});
+    archive.add_study("1.8", "20210101", {"CT"});
+    archive.add_study("1.9", "20210101", {"CT", "US"});
+
+    SECTION("modality rules shorter than the default") {
+        retention_criteria criteria;
+        criteria.default_cutoff = "20200101";
+        criteria.modality_cutoffs["MG"] = "20150101";
+        criteria.exclude_patterns = {"HOLD"};
+
+        auto all = archive.db->find_retention_candidates(criteria, "", 0, 100);
+        REQUIRE(all.is_ok());
+        CHECK(study_uids(all.value()) == std::vector<std::string>{"1.1", "1.5", "1.2"});
+
+        // Keyset paging continues after the last candidate
+        auto first = archive.db->find_retention_candidates(criteria, "", 0, 2);
+        REQUIRE(first.is_ok());
+        REQUIRE(first.value().size() == 2);
+        const auto& last = first.value().back();
+        auto rest = archive.db->find_retention_candidates(criteria, last.study_date,
+                                                          last.study_pk, 2);
+        REQUIRE(rest.is_ok());
+        CHECK(study_uids(rest.value()) == std::vector<std::string>{"1.2"});
+    }
+
+    SECTION("modality rules longer than the default") {
+        // CT lives past the default, so a CT study dated after the default
+        // cutoff expires only if it has no other modality
+        retention_criteria criteria;
+        criteria.default_cutoff = "20150101";
+        criteria.modality_cutoffs["CT"] = "20220101";
+
+        auto all = archive.db->find_retention_candidates(criteria, "", 0, 100);
+        REQUIRE(all.is_ok());
+        CHECK(study_uids(all.value()) ==
+              std::vector<std::string>{"1.1", "1.5", "1.6", "1.2", "1.8"});
+    }
+
+    SECTION("missing cutoff is an error") {
+        CHECK(archive.db->find_retention_candidates({}, "", 0, 10).is_err());
+    }
+}
+
+TEST_CASE("index_database: expired study batches queue their files",
+          "[storage][retention]") {
+    test_archive archive;
+    archive.add_study("1.1", "20100101", {"CT", "SR"});
+    archive.add_study("1.2", "20100102", {"CT"});
+
+    auto study = archive.db->find_study("1.1");
+    REQUIRE(study.has_value());
+
+    auto batch = archive.db->delete_expired_studies({study->pk}, true);
+    REQUIRE(batch.is_ok());
+    CHECK(batch.value().studies_deleted == 1);
+    CHECK(batch.value().files_queued == 2);
+    CHECK_FALSE(archive.db->find_study("1.1").has_value());
+    CHECK(archive.db->find_study("1.2").has_value());
+
+    auto queued = archive.db->list_retention_unlinks(0, 10);
+    REQUIRE(queued.is_ok());
+    REQUIRE(queued.value().size() == 2);
+    CHECK(queued.value()[0].sop_uid == "1.1.1.1");
+
+    REQUIRE(archive.db->complete_retention_unlinks({queued.value()[0].pk}).is_ok());
+    CHECK(archive.queued() == 1);
+}
+
+// ============================================================================
+// Deletion
+// ============================================================================
+
+TEST_CASE("retention_engine: deletes expired studies in batches",
+          "[storage][retention]") {
+    test_archive archive;
+    auto [expired, current] = add_mixed_studies(archive);
+
+    auto config = unthrottled();
+    config.batch_size = 3;
+    config.unlink_workers = 2;
+    config.max_pending_unlinks = 3;
+    retention_engine engine(*archive.db, nullptr, config);
+
+    auto report = engine.run();
+
+    CHECK(report.error.empty());
+    CHECK(report.studies_matched == 7);
+    CHECK(report.studies_deleted == 7);
+    CHECK(report.batches == 3);
+    CHECK(report.files_queued == 14);
+    CHECK(report.files_unlinked == 14);
+    CHECK(report.unlink_failures == 0);
+    CHECK(report.completed);
+
+    CHECK(count_existing(expired) == 0);
+    CHECK(count_existing(current) == current.size());
+    CHECK(archive.queued() == 0);
+    CHECK(archive.db->study_count().value() == 2);
+}
+
+TEST_CASE("retention_engine: dry run and database-only runs keep files",
+          "[storage][retention]") {
+    test_archive archive;
+    auto [expired, current] = add_mixed_studies(archive);
+
+    SECTION("dry run") {
+        auto config = unthrottled();
+        config.dry_run = true;
+        config.batch_size = 2;
+        retention_engine engine(*archive.db, nullptr, config);
+
+        auto report = engine.run();
+        CHECK(report.studies_matched == 7);
+        CHECK(report.studies_deleted == 0);
+        CHECK(report.completed);
+        CHECK(archive.db->study_count().value() == 9);
+    }
+
+    SECTION("database only") {
+        auto config = unthrottled();
+        config.database_only = true;
+        retention_engine engine(*archive.db, nullptr, config);
+
+        auto report = engine.run();
+        CHECK(report.studies_deleted == 7);
+        CHECK(report.files_queued == 0);
+        CHECK(archive.queued() == 0);
+        CHECK(archive.db->study_count().value() == 2);
+    }
+
+    CHECK(count_existing(expired) == expired.size());
+}
+
+// ============================================================================
+// Resumption
+// ============================================================================
+
+TEST_CASE("retention_engine: resumes capped and interrupted runs",
+          "[storage][retention]") {
+    test_archive archive;
+    auto [expired, current] = add_mixed_studies(archive);
+
+    auto config = unthrottled();
+    config.batch_size = 2;
+    config.max_deletions_per_run = 4;
+    {
+        retention_engine engine(*archive.db, nullptr, config);
+        auto report = engine.run();
+        CHECK(report.studies_deleted == 4);
+        CHECK(report.files_unlinked == 8);
+        CHECK_FALSE(report.completed);
+    }
+
+    // A run killed after committing a batch leaves its files queued
+    auto study = archive.db->find_study("1.2.1.5");
+    REQUIRE(study.has_value());
+    REQUIRE(archive.db->delete_expired_studies({study->pk}, true).is_ok());
+    CHECK(archive.queued() == 2);
+    CHECK(count_existing(expired) == 6);
+
+    config.max_deletions_per_run = 0;
+    retention_engine engine(*archive.db, nullptr, config);
+    auto report = engine.run();
+
+    CHECK(report.studies_deleted == 2);
+    CHECK(report.files_queued == 4);
+    CHECK(report.files_unlinked == 6);
+    CHECK(report.completed);
+    CHECK(count_existing(expired) == 0);
+    CHECK(count_existing(current) == current.size());
+    CHECK(archive.queued() == 0);
+}
+
+TEST_CASE("retention_engine: unlink rate limit slows unlinks",
+          "[storage][retention]") {
+    test_archive archive;
+    add_mixed_studies(archive);
+
+    // The bucket starts with one second of budget, so 14 files at 8 per
+    // second take at least another 0.75 seconds
+    auto config = unthrottled();
+    config.max_unlinks_per_second = 8;
+    retention_engine engine(*archive.db, nullptr, config);
+
+    auto report = engine.run();
+    CHECK(report.files_unlinked == 14);
+    CHECK(report.elapsed >= std::chrono::milliseconds(650));
+}
@@ -8,12 +8,17 @@
 
 #include <kcenon/pacs/storage/s3_storage.h>
 
+#include <kcenon/pacs/core/dicom_file.h>
 #include <kcenon/pacs/core/dicom_tag_constants.h>
+#include <kcenon/pacs/encoding/transfer_syntax.h>
 #include <kcenon/pacs/encoding/vr_type.h>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 
 using namespace kcenon::pacs::storage;
 using namespace kcenon::pacs::core;
@@ -435,6 +440,100 @@ TEST_CASE("s3_storage: retrieve_with_progress",
   CHECK(callback_count > 0);
 }
 
+// ============================================================================
+// Byte Stream Tests
+// ============================================================================
+
+TEST_CASE("s3_storage: store_stream and ranged open_read",
+          "[storage][s3_storage][stream]") {
+  auto config = create_test_config();
+  s3_storage storage{config};
+
+  auto bytes = dicom_file::create(
+                   create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.5"),
+                   transfer_syntax::explicit_vr_little_endian)
+                   .to_bytes();
+  memory_byte_source source(bytes);
+
+  auto stored = storage.store_stream(source);
+  REQUIRE(stored.is_ok());
+  CHECK(stored.value().study_instance_uid == "1.2.3");
+  CHECK(storage.exists("1.2.3.4.5"));
+
+  auto whole = storage.open_read("1.2.3.4.5");
+  REQUIRE(whole.is_ok());
+  auto read_back = whole.value()->read_all();
+  REQUIRE(read_back.is_ok());
+  CHECK(read_back.value() == bytes);
+
+  auto prefix = storage.open_read("1.2.3.4.5", byte_range{128, 4});
+  REQUIRE(prefix.is_ok());
+  auto magic = prefix.value()->read_all();
+  REQUIRE(magic.is_ok());
+  CHECK(std::string(magic.value().begin(), magic.value().end()) == "DICM");
+
+  CHECK(storage.open_read("1.2.3.4.5", byte_range{bytes.size() + 1}).is_err());
+
+  memory_byte_source invalid(std::vector<std::uint8_t>(300, 0));
+  CHECK(storage.store_stream(invalid).is_err());
+}
+
+TEST_CASE("s3_storage: parallel part transfer and download_to_file",
+          "[storage][s3_storage][stream]") {
+  auto config = create_test_config();
+  config.multipart_threshold = 100;
+  config.part_size = 64;
+  config.max_concurrent_parts = 4;
+  s3_storage storage{config};
+
+  auto bytes = dicom_file::create(
+                   create_test_dataset("1.2.3", "1.2.3.4", "1.2.3.4.5"),
+                   transfer_syntax::explicit_vr_little_endian)
+                   .to_bytes();
+  REQUIRE(bytes.size() > 4 * 64);
+  memory_byte_source source(bytes);
+
+  std::atomic<std::size_t> last_bytes{0};
+  auto stored = storage.store_stream(source);
+  REQUIRE(stored.is_ok());
+
+  auto whole = storage.open_read("1.2.3.4.5");
+  REQUIRE(whole.is_ok());
+  auto read_back = whole.value()->read_all();
+  REQUIRE(read_back.is_ok());
+  CHECK(read_back.value() == bytes);
+
+  auto middle = storage.open_read("1.2.3.4.5", byte_range{10, 200});
+  REQUIRE(middle.is_ok());
+  auto slice = middle.value()->read_all();
+  REQUIRE(slice.is_ok());
+  CHECK(slice.value() ==
+        std::vector<std::uint8_t>(bytes.begin() + 10, bytes.begin() + 210));
+
+  const auto path = std::filesystem::temp_directory_path() /
+                    "s3_storage_download_to_file_test.dcm";
+  auto downloaded = storage.download_to_file(
+      "1.2.3.4.5", path, [&](std::size_t done, std::size_t) {
+        last_bytes = done;
+        return true;
+      });
+  REQUIRE(downloaded.is_ok());
+  CHECK(last_bytes.load() == bytes.size());
+  {
+    std::ifstream in(path, std::ios::binary);
+    std::vector<std::uint8_t> on_disk((std::istreambuf_iterator<char>(in)),
+                                      std::istreambuf_iterator<char>());
+    CHECK(on_disk == bytes);
+  }
+
+  auto cancelled = storage.download_to_file(
+      "1.2.3.4.5", path, [](std::size_t, std::size_t) { return false; });
+  CHECK(cancelled.is_err());
+  CHECK_FALSE(std::filesystem::exists(path));
+
+  CHECK(storage.download_to_file("9.9.9", path).is_err());
+}
+
 // ============================================================================
 // Cloud Storage Config Tests
 // ============================================================================
@@ -450,6 +549,9 @@ TEST_CASE("cloud_storage_config: default values", "[storage][s3_storage]") {
   CHECK(config.multipart_threshold == 100 * 1024 * 1024); // 100MB
   CHECK(config.part_size == 10 * 1024 * 1024);            // 10MB
   CHECK(config.max_connections == 25);
+  CHECK(config.max_concurrent_parts == 8);
+  CHECK(config.max_retries == 3);
+  CHECK(config.retry_delay_ms == 200);
   CHECK(config.connect_timeout_ms == 3000);
   CHECK(config.request_timeout_ms == 30000);
   CHECK_FALSE(config.enable_encryption);
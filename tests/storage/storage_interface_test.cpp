@@ -7,6 +7,8 @@
 
 #include <kcenon/pacs/storage/storage_interface.h>
 
+#include <kcenon/pacs/core/dicom_file.h>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include <map>
@@ -270,6 +272,95 @@ TEST_CASE("storage_interface: verify_integrity", "[storage][interface]") {
     CHECK(result.is_ok());
 }
 
+TEST_CASE("storage_interface: open_read default implementation",
+          "[storage][interface][stream]") {
+    mock_storage storage;
+    REQUIRE(storage.store(create_test_dataset("1.2.3.4.5")).is_ok());
+
+    auto whole = storage.open_read("1.2.3.4.5");
+    REQUIRE(whole.is_ok());
+    auto bytes = whole.value()->read_all();
+    REQUIRE(bytes.is_ok());
+    REQUIRE(bytes.value().size() > 132);
+    CHECK(std::string(bytes.value().begin() + 128, bytes.value().begin() + 132) ==
+          "DICM");
+
+    auto tail = storage.open_read("1.2.3.4.5", byte_range{128, 4});
+    REQUIRE(tail.is_ok());
+    CHECK(tail.value()->size() == 4);
+
+    CHECK(storage.open_read("1.2.3.4.5", byte_range{bytes.value().size() + 1})
+              .is_err());
+    CHECK(storage.open_read("nonexistent").is_err());
+}
+
+TEST_CASE("storage_interface: identify_part10", "[storage][interface][stream]") {
+    SECTION("rejects data without the DICM prefix") {
+        std::vector<uint8_t> data(256, 0);
+        CHECK(storage_interface::identify_part10(data).is_err());
+    }
+
+    SECTION("rejects files missing hierarchy UIDs") {
+        auto bytes = dicom_file::create(create_test_dataset("1.2.3.4.5"),
+                                        transfer_syntax::explicit_vr_little_endian)
+                         .to_bytes();
+        CHECK(storage_interface::identify_part10(bytes).is_err());
+    }
+
+    SECTION("extracts identity") {
+        auto ds = create_test_dataset("1.2.3.4.5");
+        ds.set_string(dicom_tag{0x0020, 0x000D}, vr_type::UI, "1.2.3");
+        ds.set_string(dicom_tag{0x0020, 0x000E}, vr_type::UI, "1.2.3.4");
+        ds.set_string(dicom_tag{0x0008, 0x0020}, vr_type::DA, "20240115");
+        auto bytes =
+            dicom_file::create(ds, transfer_syntax::explicit_vr_little_endian)
+                .to_bytes();
+
+        auto info = storage_interface::identify_part10(bytes);
+        REQUIRE(info.is_ok());
+        CHECK(info.value().sop_instance_uid == "1.2.3.4.5");
+        CHECK(info.value().study_instance_uid == "1.2.3");
+        CHECK(info.value().series_instance_uid == "1.2.3.4");
+        CHECK(info.value().study_date == "20240115");
+        CHECK(info.value().transfer_syntax_uid == "1.2.840.10008.1.2.1");
+        CHECK(info.value().size_bytes == bytes.size());
+    }
+}
+
+// ============================================================================
+// Byte Stream Tests
+// ============================================================================
+
+TEST_CASE("byte_range: resolve", "[storage][interface][stream]") {
+    CHECK(byte_range{}.is_whole());
+    CHECK(byte_range{}.resolve(100)->length == 100);
+    CHECK(byte_range{90, 50}.resolve(100)->length == 10);
+    CHECK(byte_range{100, 10}.resolve(100)->length == 0);
+    CHECK_FALSE(byte_range{101}.resolve(100).has_value());
+}
+
+TEST_CASE("memory_byte_source: chunked read", "[storage][interface][stream]") {
+    std::vector<uint8_t> data{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    memory_byte_source source(data, byte_range{2, 5});
+
+    CHECK(source.size() == 5);
+    CHECK(source.contiguous().size() == 5);
+
+    std::vector<uint8_t> buffer(3);
+    auto first = source.read(buffer);
+    REQUIRE(first.is_ok());
+    CHECK(first.value() == 3);
+    CHECK(buffer == std::vector<uint8_t>{2, 3, 4});
+
+    auto second = source.read(buffer);
+    REQUIRE(second.is_ok());
+    CHECK(second.value() == 2);
+
+    auto end = source.read(buffer);
+    REQUIRE(end.is_ok());
+    CHECK(end.value() == 0);
+}
+
 // ============================================================================
 // Storage Statistics Structure Tests
 // ============================================================================
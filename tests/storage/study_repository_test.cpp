@@ -3,6 +3,7 @@
  * @brief Unit tests for study_repository class
  *
  * Verifies CRUD operations, wildcard search, upsert semantics,
+ * indexed modality/name search, keyset pagination,
  * and modalities_in_study denormalization for the extracted study_repository.
  *
  * @see Issue #912 - Extract patient and study metadata repositories
@@ -11,6 +12,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <kcenon/pacs/storage/patient_repository.h>
+#include <kcenon/pacs/storage/series_repository.h>
 #include <kcenon/pacs/storage/study_repository.h>
 #include <kcenon/pacs/storage/migration_runner.h>
 
@@ -20,6 +22,9 @@
 #include <sqlite3.h>
 #endif
 
+#include <string>
+#include <vector>
+
 using namespace kcenon::pacs::storage;
 
 namespace {
@@ -383,6 +388,172 @@ TEST_CASE("study_repository search", "[storage][study]") {
 
 #endif  // PACS_WITH_DATABASE_SYSTEM
 
+// ============================================================================
+// Indexed Search and Keyset Pagination
+// ============================================================================
+
+TEST_CASE("study_repository indexed search and keyset paging", "[storage][study]") {
+#ifdef PACS_WITH_DATABASE_SYSTEM
+    if (!is_sqlite_backend_supported()) {
+        SUCCEED("Skipped: SQLite backend not supported");
+        return;
+    }
+#endif
+
+    test_database db;
+    patient_repository pat_repo(db.get());
+    study_repository repo(db.get());
+    series_repository series_repo(db.get());
+
+    auto smith = pat_repo.upsert_patient("IDX-1", "SMITH^JOHN", "19700101", "M");
+    auto blacksmith = pat_repo.upsert_patient("IDX-2", "BLACKSMITH^ANNA", "19800101", "F");
+    auto doe = pat_repo.upsert_patient("IDX-3", "DOE^JANE", "19900101", "F");
+    REQUIRE(smith.is_ok());
+    REQUIRE(blacksmith.is_ok());
+    REQUIRE(doe.is_ok());
+
+    struct fixture_study {
+        int64_t patient_pk;
+        const char* uid;
+        const char* date;
+        const char* description;
+        const char* modality;
+    };
+    const fixture_study studies[] = {
+        {smith.value(), "1.2.840.idx.1", "20240301", "MR Brain", "MR"},
+        {smith.value(), "1.2.840.idx.2", "20240301", "CT Chest", "CT"},
+        {blacksmith.value(), "1.2.840.idx.3", "20240301", "MR Knee", "MR"},
+        {doe.value(), "1.2.840.idx.4", "20240215", "CT Head", "CT"},
+        {doe.value(), "1.2.840.idx.5", "20240101", "US Abdomen", "US"},
+    };
+    for (const auto& study : studies) {
+        auto study_pk = repo.upsert_study(study.patient_pk, study.uid, "",
+                                          study.date, "120000", "", "",
+                                          study.description);
+        REQUIRE(study_pk.is_ok());
+        auto series_pk = series_repo.upsert_series(
+            study_pk.value(), std::string(study.uid) + ".1", study.modality);
+        REQUIRE(series_pk.is_ok());
+    }
+
+    auto uids = [](const std::vector<study_record>& records) {
+        std::vector<std::string> result;
+        for (const auto& record : records) {
+            result.push_back(record.study_uid);
+        }
+        return result;
+    };
+
+    SECTION("modality matches studies through their series") {
+        study_query query;
+        query.modality = "MR";
+        auto results = repo.search_studies(query);
+        REQUIRE(results.is_ok());
+        CHECK(uids(results.value()) ==
+              std::vector<std::string>{"1.2.840.idx.3", "1.2.840.idx.1"});
+
+        // A study gains a modality when one of its series has it
+        REQUIRE(series_repo.upsert_series(
+            repo.find_study("1.2.840.idx.4")->pk, "1.2.840.idx.4.2", "MR").is_ok());
+        results = repo.search_studies(query);
+        REQUIRE(results.is_ok());
+        CHECK(results.value().size() == 3);
+
+        query.modality = "MRI";
+        results = repo.search_studies(query);
+        REQUIRE(results.is_ok());
+        CHECK(results.value().empty());
+    }
+
+    SECTION("infix patient name and description wildcards") {
+        study_query query;
+        query.patient_name = "*smith*";
+        auto results = repo.search_studies(query);
+        REQUIRE(results.is_ok());
+        CHECK(results.value().size() == 3);
+
+        query.patient_name = "*SMITH^J*";
+        query.study_description = "*Brain*";
+        results = repo.search_studies(query);
+        REQUIRE(results.is_ok());
+        CHECK(uids(results.value()) == std::vector<std::string>{"1.2.840.idx.1"});
+
+        // Too short for the trigram index: plain LIKE
+        query = {};
+        query.patient_name = "D*";
+        results = repo.search_studies(query);
+        REQUIRE(results.is_ok());
+        CHECK(results.value().size() == 2);
+    }
+
+    SECTION("keyset pages walk the full order without overlap") {
+        study_query query;
+        auto all = repo.search_studies(query);
+        REQUIRE(all.is_ok());
+        REQUIRE(all.value().size() == 5);
+
+        std::vector<std::string> paged;
+        query.limit = 2;
+        for (int page = 0; page < 5; ++page) {
+            auto results = repo.search_studies(query);
+            REQUIRE(results.is_ok());
+            if (results.value().empty()) {
+                break;
+            }
+            CHECK(results.value().size() <= 2);
+            for (const auto& record : results.value()) {
+                paged.push_back(record.study_uid);
+            }
+            query.after = study_page_key::after(results.value().back());
+        }
+        CHECK(paged == uids(all.value()));
+
+        // Equal dates and times are ordered by primary key
+        CHECK(std::vector<std::string>(paged.begin(), paged.begin() + 3) ==
+              std::vector<std::string>{"1.2.840.idx.3", "1.2.840.idx.2",
+                                       "1.2.840.idx.1"});
+    }
+
+    SECTION("keyset pages include studies without date or time") {
+        const char* clear_date =
+            "UPDATE studies SET study_date = NULL, study_time = NULL "
+            "WHERE study_uid = '1.2.840.idx.4'";
+#ifdef PACS_WITH_DATABASE_SYSTEM
+        REQUIRE(db.get()->execute(clear_date).is_ok());
+#else
+        REQUIRE(sqlite3_exec(db.get(), clear_date, nullptr, nullptr, nullptr) ==
+                SQLITE_OK);
+#endif
+
+        study_query query;
+        query.limit = 2;
+        std::vector<std::string> paged;
+        for (int page = 0; page < 5; ++page) {
+            auto results = repo.search_studies(query);
+            REQUIRE(results.is_ok());
+            if (results.value().empty()) {
+                break;
+            }
+            for (const auto& record : results.value()) {
+                paged.push_back(record.study_uid);
+            }
+            query.after = study_page_key::after(results.value().back());
+        }
+        CHECK(paged == std::vector<std::string>{"1.2.840.idx.3", "1.2.840.idx.2",
+                                                "1.2.840.idx.1", "1.2.840.idx.5",
+                                                "1.2.840.idx.4"});
+    }
+
+    SECTION("offset without limit") {
+        study_query query;
+        query.offset = 3;
+        auto results = repo.search_studies(query);
+        REQUIRE(results.is_ok());
+        CHECK(uids(results.value()) ==
+              std::vector<std::string>{"1.2.840.idx.4", "1.2.840.idx.5"});
+    }
+}
+
 // ============================================================================
 // Delete and Count
 // ============================================================================
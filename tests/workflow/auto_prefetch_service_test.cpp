@@ -14,10 +14,14 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
 #include <thread>
+#include <vector>
 
 using namespace kcenon::pacs::workflow;
 using namespace kcenon::pacs::storage;
@@ -400,6 +404,179 @@ TEST_CASE("auto_prefetch_service: callbacks", "[workflow][prefetch][service]") {
     // In a real test, we'd use synchronization primitives
 }
 
+// ============================================================================
+// Scheduling Tests
+// ============================================================================
+
+namespace {
+
+/**
+ * @brief Config whose C-FIND returns one prior per patient and whose C-MOVE
+ *        records the order and concurrency of retrieves
+ */
+struct scripted_remote {
+    std::mutex mutex;
+    std::vector<std::string> retrieved_patients;
+    std::size_t active{0};
+    std::size_t max_active{0};
+    std::size_t failures_left{0};
+    std::chrono::milliseconds retrieve_time{0};
+
+    auto make_config() -> prefetch_service_config {
+        prefetch_service_config config;
+        remote_pacs_config remote;
+        remote.ae_title = "ARCHIVE";
+        remote.host = "archive.example";
+        config.remote_pacs.push_back(remote);
+        config.retry_delay = std::chrono::seconds{0};
+
+        config.query_override = [](const remote_pacs_config&,
+                                   const std::string& patient_id,
+                                   std::chrono::days) {
+            prior_study_info prior;
+            prior.study_instance_uid = "9.9." + patient_id;
+            prior.patient_id = patient_id;
+            return std::vector<prior_study_info>{prior};
+        };
+        config.retrieve_override = [this](const remote_pacs_config&,
+                                          const prior_study_info& study) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                max_active = std::max(max_active, ++active);
+            }
+            std::this_thread::sleep_for(retrieve_time);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            --active;
+            if (failures_left > 0) {
+                --failures_left;
+                return false;
+            }
+            retrieved_patients.push_back(study.patient_id);
+            return true;
+        };
+        return config;
+    }
+};
+
+auto make_item(const std::string& patient_id, const std::string& datetime)
+    -> worklist_item {
+    worklist_item item;
+    item.patient_id = patient_id;
+    item.modality = "CT";
+    item.scheduled_datetime = datetime;
+    return item;
+}
+
+}  // namespace
+
+TEST_CASE("auto_prefetch_service: serves earliest scheduled start first",
+          "[workflow][prefetch][schedule]") {
+    auto db = create_test_database();
+    scripted_remote remote;
+    auto config = remote.make_config();
+    config.max_concurrent_prefetches = 1;
+
+    auto_prefetch_service service{*db, config};
+    service.on_worklist_query({make_item("P_1100", "20231215110000"),
+                               make_item("P_0730", "20231215073000"),
+                               make_item("P_0900", "20231215090000")});
+
+    auto pending = service.pending_request_list();
+    REQUIRE(pending.size() == 3);
+    CHECK(pending[0].patient_id == "P_0730");
+    CHECK(pending[2].patient_id == "P_1100");
+
+    auto result = service.run_prefetch_cycle();
+
+    CHECK(result.studies_prefetched == 3);
+    CHECK(remote.retrieved_patients ==
+          std::vector<std::string>{"P_0730", "P_0900", "P_1100"});
+    // All three exams are in the past
+    CHECK(result.deadlines_missed == 3);
+}
+
+TEST_CASE("auto_prefetch_service: merges repeated worklist queries",
+          "[workflow][prefetch][schedule]") {
+    auto db = create_test_database();
+    scripted_remote remote;
+    auto config = remote.make_config();
+
+    SECTION("an earlier exam moves the pending request forward") {
+        auto_prefetch_service service{*db, config};
+        service.on_worklist_query({make_item("P1", "20231215100000"),
+                                   make_item("P2", "20231215110000")});
+        service.on_worklist_query({make_item("P2", "20231215080000")});
+
+        auto pending = service.pending_request_list();
+        REQUIRE(pending.size() == 2);
+        CHECK(pending[0].patient_id == "P2");
+    }
+
+    SECTION("recently prefetched patients are not queued again") {
+        auto_prefetch_service service{*db, config};
+        service.on_worklist_query({make_item("P1", "20231215100000")});
+        (void)service.run_prefetch_cycle();
+
+        service.on_worklist_query({make_item("P1", "20231215100000")});
+        CHECK(service.pending_requests() == 0);
+    }
+
+    SECTION("without a dedup window they are") {
+        config.request_dedup_window = std::chrono::minutes{0};
+        auto_prefetch_service service{*db, config};
+        service.on_worklist_query({make_item("P1", "20231215100000")});
+        (void)service.run_prefetch_cycle();
+
+        service.on_worklist_query({make_item("P1", "20231215100000")});
+        CHECK(service.pending_requests() == 1);
+    }
+}
+
+TEST_CASE("auto_prefetch_service: caps associations per remote node",
+          "[workflow][prefetch][schedule]") {
+    auto db = create_test_database();
+    scripted_remote remote;
+    remote.retrieve_time = std::chrono::milliseconds{20};
+    auto config = remote.make_config();
+    config.max_concurrent_prefetches = 8;
+    config.remote_pacs[0].max_concurrent_associations = 2;
+
+    auto_prefetch_service service{*db, config};
+    std::vector<worklist_item> items;
+    for (int i = 0; i < 8; ++i) {
+        items.push_back(make_item("P" + std::to_string(i), "20231215100000"));
+    }
+    service.on_worklist_query(items);
+
+    auto result = service.run_prefetch_cycle();
+
+    CHECK(result.patients_processed == 8);
+    CHECK(result.studies_prefetched == 8);
+    CHECK(remote.max_active == 2);
+    CHECK(service.pending_requests() == 0);
+}
+
+TEST_CASE("auto_prefetch_service: retries failed prefetches",
+          "[workflow][prefetch][schedule]") {
+    auto db = create_test_database();
+    scripted_remote remote;
+    remote.failures_left = 1;
+    auto config = remote.make_config();
+    config.max_retry_attempts = 1;
+
+    auto_prefetch_service service{*db, config};
+    service.on_worklist_query({make_item("P1", "20231215100000")});
+
+    auto result = service.run_prefetch_cycle();
+
+    // The retry is due immediately and runs in the same cycle
+    CHECK(result.studies_failed == 1);
+    CHECK(result.studies_prefetched == 1);
+    CHECK(remote.retrieved_patients == std::vector<std::string>{"P1"});
+    CHECK(service.pending_requests() == 0);
+}
+
 // ============================================================================
 // prior_study_info Tests
 // ============================================================================
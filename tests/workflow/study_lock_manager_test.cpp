@@ -10,6 +10,8 @@
 #include <atomic>
 #include <chrono>
 #include <future>
+#include <mutex>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -394,6 +396,7 @@ TEST_CASE("study_lock_manager get locks by type", "[study_lock_manager][query]")
 TEST_CASE("study_lock_manager cleanup expired locks", "[study_lock_manager][maintenance]") {
     study_lock_manager_config config;
     config.default_timeout = 1s;
+    config.auto_cleanup = false;  // Expired locks stay until swept
     study_lock_manager manager{config};
 
     // Create locks that will expire
@@ -413,6 +416,7 @@ TEST_CASE("study_lock_manager cleanup expired locks", "[study_lock_manager][main
 TEST_CASE("study_lock_manager get expired locks", "[study_lock_manager][maintenance]") {
     study_lock_manager_config config;
     config.default_timeout = 1s;
+    config.auto_cleanup = false;  // Expired locks stay until swept
     study_lock_manager manager{config};
 
     REQUIRE(manager.lock("study1", "Reason", "user1").is_ok());
@@ -570,6 +574,197 @@ TEST_CASE("study_lock_manager concurrent shared locks", "[study_lock_manager][co
     CHECK(success_count == num_threads);
 }
 
+// ============================================================================
+// Blocking Acquisition Tests
+// ============================================================================
+
+TEST_CASE("study_lock_manager lock_wait", "[study_lock_manager][wait]") {
+    study_lock_manager manager;
+
+    SECTION("waiters are granted in FIFO order") {
+        auto first = manager.lock("study1", "Reason", "owner");
+        REQUIRE(first.is_ok());
+
+        std::mutex order_mutex;
+        std::vector<std::string> order;
+        std::vector<std::future<void>> futures;
+        for (int i = 0; i < 3; ++i) {
+            const auto holder = "waiter" + std::to_string(i);
+            futures.push_back(std::async(std::launch::async, [&, holder]() {
+                auto result = manager.lock_wait(
+                    "study1", lock_type::exclusive, "Reason", holder, 5000ms);
+                REQUIRE(result.is_ok());
+                {
+                    std::lock_guard lock{order_mutex};
+                    order.push_back(holder);
+                }
+                REQUIRE(manager.unlock(result.value()).is_ok());
+            }));
+            // Let each waiter enqueue before the next one
+            while (manager.get_stats().wait_count < static_cast<std::size_t>(i + 1)) {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+
+        REQUIRE(manager.unlock(first.value()).is_ok());
+        for (auto& f : futures) {
+            f.get();
+        }
+
+        CHECK(order == std::vector<std::string>{"waiter0", "waiter1", "waiter2"});
+        CHECK_FALSE(manager.is_locked("study1"));
+    }
+
+    SECTION("times out while the lock is held") {
+        REQUIRE(manager.lock("study1", "Reason", "owner").is_ok());
+
+        auto result = manager.lock_wait(
+            "study1", lock_type::shared, "Reason", "reader", 50ms);
+        REQUIRE(result.is_err());
+        CHECK(result.error().code == lock_error::timeout);
+
+        auto stats = manager.get_stats();
+        CHECK(stats.wait_count == 1);
+        CHECK(stats.timeout_count == 1);
+        CHECK(manager.get_lock_info("study1")->holder == "owner");
+    }
+
+    SECTION("non-blocking lock does not overtake queued waiters") {
+        auto reader = manager.lock("study1", lock_type::shared, "Reason", "reader");
+        REQUIRE(reader.is_ok());
+
+        auto writer = std::async(std::launch::async, [&]() {
+            return manager.lock_wait(
+                "study1", lock_type::exclusive, "Reason", "writer", 5000ms);
+        });
+        while (manager.get_stats().wait_count == 0) {
+            std::this_thread::sleep_for(1ms);
+        }
+
+        // Compatible with the current holder, but the writer is first
+        auto second_reader = manager.lock("study1", lock_type::shared, "Reason", "reader2");
+        REQUIRE(second_reader.is_err());
+        CHECK(second_reader.error().code == lock_error::already_locked);
+
+        REQUIRE(manager.unlock(reader.value()).is_ok());
+        auto granted = writer.get();
+        REQUIRE(granted.is_ok());
+        CHECK(manager.is_locked("study1", lock_type::exclusive));
+    }
+}
+
+TEST_CASE("study_lock_manager upgrade_lock", "[study_lock_manager][wait]") {
+    study_lock_manager manager;
+
+    SECTION("sole shared holder is upgraded immediately") {
+        auto shared = manager.lock("study1", lock_type::shared, "Reason", "user1");
+        REQUIRE(shared.is_ok());
+
+        auto upgraded = manager.upgrade_lock(shared.value(), 0ms);
+        REQUIRE(upgraded.is_ok());
+        CHECK(upgraded.value().type == lock_type::exclusive);
+        CHECK(upgraded.value().token_id == shared.value().token_id);
+        CHECK(manager.is_locked("study1", lock_type::exclusive));
+        CHECK(manager.unlock(upgraded.value()).is_ok());
+    }
+
+    SECTION("waits for the other shared holders") {
+        auto mine = manager.lock("study1", lock_type::shared, "Reason", "user1");
+        auto other = manager.lock("study1", lock_type::shared, "Reason", "user2");
+        REQUIRE(mine.is_ok());
+        REQUIRE(other.is_ok());
+
+        auto upgrade = std::async(std::launch::async, [&]() {
+            return manager.upgrade_lock(mine.value(), 5000ms);
+        });
+        while (manager.get_stats().wait_count == 0) {
+            std::this_thread::sleep_for(1ms);
+        }
+        CHECK(manager.is_locked("study1", lock_type::shared));
+
+        SECTION("and is granted when they release") {
+            REQUIRE(manager.unlock(other.value()).is_ok());
+            auto upgraded = upgrade.get();
+            REQUIRE(upgraded.is_ok());
+            CHECK(manager.get_lock_info("study1")->holder == "user1");
+            CHECK(manager.is_locked("study1", lock_type::exclusive));
+        }
+
+        SECTION("a second upgrade fails instead of deadlocking") {
+            auto second = manager.upgrade_lock(other.value(), 5000ms);
+            REQUIRE(second.is_err());
+            CHECK(second.error().code == lock_error::upgrade_failed);
+
+            REQUIRE(manager.unlock(other.value()).is_ok());
+            CHECK(upgrade.get().is_ok());
+        }
+
+        SECTION("fails when the study is force-unlocked") {
+            REQUIRE(manager.force_unlock("study1", "Admin override").is_ok());
+            auto upgraded = upgrade.get();
+            REQUIRE(upgraded.is_err());
+            CHECK(upgraded.error().code == lock_error::not_found);
+            CHECK_FALSE(manager.is_locked("study1"));
+
+            // The table stays usable for the study
+            auto relocked = manager.lock("study1", "Reason", "user2");
+            REQUIRE(relocked.is_ok());
+            CHECK(manager.unlock(relocked.value()).is_ok());
+        }
+    }
+
+    SECTION("exclusive tokens cannot be upgraded") {
+        auto exclusive = manager.lock("study1", "Reason", "user1");
+        REQUIRE(exclusive.is_ok());
+
+        auto result = manager.upgrade_lock(exclusive.value());
+        REQUIRE(result.is_err());
+        CHECK(result.error().code == lock_error::upgrade_failed);
+    }
+}
+
+// ============================================================================
+// Proactive Expiry Tests
+// ============================================================================
+
+TEST_CASE("study_lock_manager expires locks in the background", "[study_lock_manager][expiry]") {
+    study_lock_manager_config config;
+    config.expiry_tick = 20ms;
+    study_lock_manager manager{config};
+
+    std::atomic<int> expired_count{0};
+    manager.set_on_lock_expired([&](const std::string&, const lock_info&) {
+        ++expired_count;
+    });
+
+    REQUIRE(manager.lock("study1", "Reason", "user1", 1s).is_ok());
+    REQUIRE(manager.lock("study2", "Reason", "user2", 30s).is_ok());
+
+    const auto deadline = std::chrono::steady_clock::now() + 3s;
+    while (expired_count == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(10ms);
+    }
+
+    // Expired without any call into the manager
+    CHECK(expired_count == 1);
+    CHECK(manager.get_stats().expired_count == 1);
+    CHECK_FALSE(manager.is_locked("study1"));
+    CHECK(manager.is_locked("study2"));
+}
+
+TEST_CASE("study_lock_manager expiry hands the lock to waiters", "[study_lock_manager][expiry]") {
+    study_lock_manager_config config;
+    config.expiry_tick = 20ms;
+    study_lock_manager manager{config};
+
+    REQUIRE(manager.lock("study1", "Reason", "stale", 1s).is_ok());
+
+    auto result = manager.lock_wait(
+        "study1", lock_type::exclusive, "Reason", "next", 3000ms);
+    REQUIRE(result.is_ok());
+    CHECK(manager.get_lock_info("study1")->holder == "next");
+}
+
 // ============================================================================
 // Lock Type Conversion Tests
 // ============================================================================